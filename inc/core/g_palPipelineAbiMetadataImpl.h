@@ -23,6 +23,12 @@
  *
  **********************************************************************************************************************/
 
+// The PerfectHashKeyTable initializers in this file are maintained by tools/generate/genPerfectHashKeyTables.py.  After
+// adding, removing or renaming a key, edit the table's key list (and its key-index enum) and rerun the script:
+//
+//     python tools/generate/genPerfectHashKeyTables.py --file inc/core/g_palPipelineAbiMetadataImpl.h \
+//                                                      --keyHeader inc/core/g_palPipelineAbiMetadata.h
+
 #pragma once
 
 #include "g_palPipelineAbiMetadata.h"
@@ -41,39 +47,48 @@ PAL_INLINE Result DeserializeEnum(
     MsgPackReader*  pReader,
     PipelineType*  pValue)
 {
+    static constexpr PerfectHashKeyTable<7, 3> KeyTable =
+    {
+        138u,
+        { 0, 3 },
+        { 3, 4, 0, 6, 1, 7, 2, 5 },
+        {
+            "VsPs",
+            "Gs",
+            "Cs",
+            "Ngg",
+            "Tess",
+            "GsTess",
+            "NggTess"
+        },
+        { 4, 2, 2, 3, 4, 6, 7 }
+    };
+    static_assert(KeyTable.IsValid(), "Perfect-hash key table does not match the key strings.");
+    static constexpr PipelineType Values[] =
+    {
+        PipelineType::VsPs,
+        PipelineType::Gs,
+        PipelineType::Cs,
+        PipelineType::Ngg,
+        PipelineType::Tess,
+        PipelineType::GsTess,
+        PipelineType::NggTess
+    };
+
     Result result = pReader->Next(CWP_ITEM_STR);
 
     if (result == Result::Success)
     {
-        const uint32 strHash = HashString(static_cast<const char*>(pReader->Get().as.str.start),
-                                          pReader->Get().as.str.length);
+        const uint32 index = KeyTable.Find(static_cast<const char*>(pReader->Get().as.str.start),
+                                           pReader->Get().as.str.length);
 
-        switch (strHash)
+        if (index < ArrayLen(Values))
+        {
+            *pValue = Values[index];
+        }
+        else
         {
-        case HashLiteralString("VsPs"):
-            *pValue = PipelineType::VsPs;
-            break;
-        case HashLiteralString("Gs"):
-            *pValue = PipelineType::Gs;
-            break;
-        case HashLiteralString("Cs"):
-            *pValue = PipelineType::Cs;
-            break;
-        case HashLiteralString("Ngg"):
-            *pValue = PipelineType::Ngg;
-            break;
-        case HashLiteralString("Tess"):
-            *pValue = PipelineType::Tess;
-            break;
-        case HashLiteralString("GsTess"):
-            *pValue = PipelineType::GsTess;
-            break;
-        case HashLiteralString("NggTess"):
-            *pValue = PipelineType::NggTess;
-            break;
-        default:
             result = Result::NotFound;
-            break;
         }
     }
 
@@ -122,36 +137,46 @@ PAL_INLINE Result DeserializeEnum(
     MsgPackReader*  pReader,
     ApiShaderType*  pValue)
 {
+    static constexpr PerfectHashKeyTable<6, 3> KeyTable =
+    {
+        1u,
+        { 0, 1 },
+        { 0, 6, 2, 1, 3, 4, 6, 5 },
+        {
+            ".compute",
+            ".vertex",
+            ".hull",
+            ".domain",
+            ".geometry",
+            ".pixel"
+        },
+        { 8, 7, 5, 7, 9, 6 }
+    };
+    static_assert(KeyTable.IsValid(), "Perfect-hash key table does not match the key strings.");
+    static constexpr ApiShaderType Values[] =
+    {
+        ApiShaderType::Cs,
+        ApiShaderType::Vs,
+        ApiShaderType::Hs,
+        ApiShaderType::Ds,
+        ApiShaderType::Gs,
+        ApiShaderType::Ps
+    };
+
     Result result = pReader->Next(CWP_ITEM_STR);
 
     if (result == Result::Success)
     {
-        const uint32 strHash = HashString(static_cast<const char*>(pReader->Get().as.str.start),
-                                          pReader->Get().as.str.length);
+        const uint32 index = KeyTable.Find(static_cast<const char*>(pReader->Get().as.str.start),
+                                           pReader->Get().as.str.length);
 
-        switch (strHash)
+        if (index < ArrayLen(Values))
+        {
+            *pValue = Values[index];
+        }
+        else
         {
-        case HashLiteralString(".compute"):
-            *pValue = ApiShaderType::Cs;
-            break;
-        case HashLiteralString(".vertex"):
-            *pValue = ApiShaderType::Vs;
-            break;
-        case HashLiteralString(".hull"):
-            *pValue = ApiShaderType::Hs;
-            break;
-        case HashLiteralString(".domain"):
-            *pValue = ApiShaderType::Ds;
-            break;
-        case HashLiteralString(".geometry"):
-            *pValue = ApiShaderType::Gs;
-            break;
-        case HashLiteralString(".pixel"):
-            *pValue = ApiShaderType::Ps;
-            break;
-        default:
             result = Result::NotFound;
-            break;
         }
     }
 
@@ -197,39 +222,48 @@ PAL_INLINE Result DeserializeEnum(
     MsgPackReader*  pReader,
     HardwareStage*  pValue)
 {
+    static constexpr PerfectHashKeyTable<7, 3> KeyTable =
+    {
+        20u,
+        { 1, 2 },
+        { 2, 3, 5, 7, 1, 4, 0, 6 },
+        {
+            ".ls",
+            ".hs",
+            ".es",
+            ".gs",
+            ".vs",
+            ".ps",
+            ".cs"
+        },
+        { 3, 3, 3, 3, 3, 3, 3 }
+    };
+    static_assert(KeyTable.IsValid(), "Perfect-hash key table does not match the key strings.");
+    static constexpr HardwareStage Values[] =
+    {
+        HardwareStage::Ls,
+        HardwareStage::Hs,
+        HardwareStage::Es,
+        HardwareStage::Gs,
+        HardwareStage::Vs,
+        HardwareStage::Ps,
+        HardwareStage::Cs
+    };
+
     Result result = pReader->Next(CWP_ITEM_STR);
 
     if (result == Result::Success)
     {
-        const uint32 strHash = HashString(static_cast<const char*>(pReader->Get().as.str.start),
-                                          pReader->Get().as.str.length);
+        const uint32 index = KeyTable.Find(static_cast<const char*>(pReader->Get().as.str.start),
+                                           pReader->Get().as.str.length);
 
-        switch (strHash)
+        if (index < ArrayLen(Values))
+        {
+            *pValue = Values[index];
+        }
+        else
         {
-        case HashLiteralString(".ls"):
-            *pValue = HardwareStage::Ls;
-            break;
-        case HashLiteralString(".hs"):
-            *pValue = HardwareStage::Hs;
-            break;
-        case HashLiteralString(".es"):
-            *pValue = HardwareStage::Es;
-            break;
-        case HashLiteralString(".gs"):
-            *pValue = HardwareStage::Gs;
-            break;
-        case HashLiteralString(".vs"):
-            *pValue = HardwareStage::Vs;
-            break;
-        case HashLiteralString(".ps"):
-            *pValue = HardwareStage::Ps;
-            break;
-        case HashLiteralString(".cs"):
-            *pValue = HardwareStage::Cs;
-            break;
-        default:
             result = Result::NotFound;
-            break;
         }
     }
 
@@ -278,108 +312,106 @@ PAL_INLINE Result DeserializeEnum(
     MsgPackReader*  pReader,
     PipelineSymbolType*  pValue)
 {
+    static constexpr PerfectHashKeyTable<30, 7> KeyTable =
+    {
+        21u,
+        { 8, 9 },
+        {
+            30, 30, 7, 30, 26, 29, 2, 19, 30, 30, 30, 10, 30, 30, 30, 30,
+            30, 30, 30, 30, 30, 30, 13, 0, 30, 30, 30, 23, 30, 30, 30, 30,
+            30, 21, 8, 30, 30, 30, 30, 30, 30, 30, 30, 30, 12, 30, 30, 30,
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 28, 30, 16,
+            30, 5, 30, 30, 30, 30, 30, 30, 30, 3, 30, 30, 30, 27, 30, 30,
+            30, 1, 24, 6, 14, 30, 18, 30, 17, 30, 30, 30, 22, 4, 30, 25,
+            30, 30, 30, 30, 30, 15, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            30, 30, 30, 20, 30, 30, 30, 30, 30, 11, 30, 9, 30, 30, 30, 30
+        },
+        {
+            "unknown",
+            "_amdgpu_ls_main",
+            "_amdgpu_hs_main",
+            "_amdgpu_es_main",
+            "_amdgpu_gs_main",
+            "_amdgpu_vs_main",
+            "_amdgpu_ps_main",
+            "_amdgpu_cs_main",
+            "_amdgpu_ls_shdr_intrl_tbl",
+            "_amdgpu_hs_shdr_intrl_tbl",
+            "_amdgpu_es_shdr_intrl_tbl",
+            "_amdgpu_gs_shdr_intrl_tbl",
+            "_amdgpu_vs_shdr_intrl_tbl",
+            "_amdgpu_ps_shdr_intrl_tbl",
+            "_amdgpu_cs_shdr_intrl_tbl",
+            "_amdgpu_ls_disasm",
+            "_amdgpu_hs_disasm",
+            "_amdgpu_es_disasm",
+            "_amdgpu_gs_disasm",
+            "_amdgpu_vs_disasm",
+            "_amdgpu_ps_disasm",
+            "_amdgpu_cs_disasm",
+            "_amdgpu_ls_shdr_intrl_data",
+            "_amdgpu_hs_shdr_intrl_data",
+            "_amdgpu_es_shdr_intrl_data",
+            "_amdgpu_gs_shdr_intrl_data",
+            "_amdgpu_vs_shdr_intrl_data",
+            "_amdgpu_ps_shdr_intrl_data",
+            "_amdgpu_cs_shdr_intrl_data",
+            "_amdgpu_pipeline_intrl_data"
+        },
+        {
+            7, 15, 15, 15, 15, 15, 15, 15, 25, 25, 25, 25, 25, 25, 25, 17,
+            17, 17, 17, 17, 17, 17, 26, 26, 26, 26, 26, 26, 26, 27
+        }
+    };
+    static_assert(KeyTable.IsValid(), "Perfect-hash key table does not match the key strings.");
+    static constexpr PipelineSymbolType Values[] =
+    {
+        PipelineSymbolType::Unknown,
+        PipelineSymbolType::LsMainEntry,
+        PipelineSymbolType::HsMainEntry,
+        PipelineSymbolType::EsMainEntry,
+        PipelineSymbolType::GsMainEntry,
+        PipelineSymbolType::VsMainEntry,
+        PipelineSymbolType::PsMainEntry,
+        PipelineSymbolType::CsMainEntry,
+        PipelineSymbolType::LsShdrIntrlTblPtr,
+        PipelineSymbolType::HsShdrIntrlTblPtr,
+        PipelineSymbolType::EsShdrIntrlTblPtr,
+        PipelineSymbolType::GsShdrIntrlTblPtr,
+        PipelineSymbolType::VsShdrIntrlTblPtr,
+        PipelineSymbolType::PsShdrIntrlTblPtr,
+        PipelineSymbolType::CsShdrIntrlTblPtr,
+        PipelineSymbolType::LsDisassembly,
+        PipelineSymbolType::HsDisassembly,
+        PipelineSymbolType::EsDisassembly,
+        PipelineSymbolType::GsDisassembly,
+        PipelineSymbolType::VsDisassembly,
+        PipelineSymbolType::PsDisassembly,
+        PipelineSymbolType::CsDisassembly,
+        PipelineSymbolType::LsShdrIntrlData,
+        PipelineSymbolType::HsShdrIntrlData,
+        PipelineSymbolType::EsShdrIntrlData,
+        PipelineSymbolType::GsShdrIntrlData,
+        PipelineSymbolType::VsShdrIntrlData,
+        PipelineSymbolType::PsShdrIntrlData,
+        PipelineSymbolType::CsShdrIntrlData,
+        PipelineSymbolType::PipelineIntrlData
+    };
+
     Result result = pReader->Next(CWP_ITEM_STR);
 
     if (result == Result::Success)
     {
-        const uint32 strHash = HashString(static_cast<const char*>(pReader->Get().as.str.start),
-                                          pReader->Get().as.str.length);
+        const uint32 index = KeyTable.Find(static_cast<const char*>(pReader->Get().as.str.start),
+                                           pReader->Get().as.str.length);
 
-        switch (strHash)
+        if (index < ArrayLen(Values))
+        {
+            *pValue = Values[index];
+        }
+        else
         {
-        case HashLiteralString("unknown"):
-            *pValue = PipelineSymbolType::Unknown;
-            break;
-        case HashLiteralString("_amdgpu_ls_main"):
-            *pValue = PipelineSymbolType::LsMainEntry;
-            break;
-        case HashLiteralString("_amdgpu_hs_main"):
-            *pValue = PipelineSymbolType::HsMainEntry;
-            break;
-        case HashLiteralString("_amdgpu_es_main"):
-            *pValue = PipelineSymbolType::EsMainEntry;
-            break;
-        case HashLiteralString("_amdgpu_gs_main"):
-            *pValue = PipelineSymbolType::GsMainEntry;
-            break;
-        case HashLiteralString("_amdgpu_vs_main"):
-            *pValue = PipelineSymbolType::VsMainEntry;
-            break;
-        case HashLiteralString("_amdgpu_ps_main"):
-            *pValue = PipelineSymbolType::PsMainEntry;
-            break;
-        case HashLiteralString("_amdgpu_cs_main"):
-            *pValue = PipelineSymbolType::CsMainEntry;
-            break;
-        case HashLiteralString("_amdgpu_ls_shdr_intrl_tbl"):
-            *pValue = PipelineSymbolType::LsShdrIntrlTblPtr;
-            break;
-        case HashLiteralString("_amdgpu_hs_shdr_intrl_tbl"):
-            *pValue = PipelineSymbolType::HsShdrIntrlTblPtr;
-            break;
-        case HashLiteralString("_amdgpu_es_shdr_intrl_tbl"):
-            *pValue = PipelineSymbolType::EsShdrIntrlTblPtr;
-            break;
-        case HashLiteralString("_amdgpu_gs_shdr_intrl_tbl"):
-            *pValue = PipelineSymbolType::GsShdrIntrlTblPtr;
-            break;
-        case HashLiteralString("_amdgpu_vs_shdr_intrl_tbl"):
-            *pValue = PipelineSymbolType::VsShdrIntrlTblPtr;
-            break;
-        case HashLiteralString("_amdgpu_ps_shdr_intrl_tbl"):
-            *pValue = PipelineSymbolType::PsShdrIntrlTblPtr;
-            break;
-        case HashLiteralString("_amdgpu_cs_shdr_intrl_tbl"):
-            *pValue = PipelineSymbolType::CsShdrIntrlTblPtr;
-            break;
-        case HashLiteralString("_amdgpu_ls_disasm"):
-            *pValue = PipelineSymbolType::LsDisassembly;
-            break;
-        case HashLiteralString("_amdgpu_hs_disasm"):
-            *pValue = PipelineSymbolType::HsDisassembly;
-            break;
-        case HashLiteralString("_amdgpu_es_disasm"):
-            *pValue = PipelineSymbolType::EsDisassembly;
-            break;
-        case HashLiteralString("_amdgpu_gs_disasm"):
-            *pValue = PipelineSymbolType::GsDisassembly;
-            break;
-        case HashLiteralString("_amdgpu_vs_disasm"):
-            *pValue = PipelineSymbolType::VsDisassembly;
-            break;
-        case HashLiteralString("_amdgpu_ps_disasm"):
-            *pValue = PipelineSymbolType::PsDisassembly;
-            break;
-        case HashLiteralString("_amdgpu_cs_disasm"):
-            *pValue = PipelineSymbolType::CsDisassembly;
-            break;
-        case HashLiteralString("_amdgpu_ls_shdr_intrl_data"):
-            *pValue = PipelineSymbolType::LsShdrIntrlData;
-            break;
-        case HashLiteralString("_amdgpu_hs_shdr_intrl_data"):
-            *pValue = PipelineSymbolType::HsShdrIntrlData;
-            break;
-        case HashLiteralString("_amdgpu_es_shdr_intrl_data"):
-            *pValue = PipelineSymbolType::EsShdrIntrlData;
-            break;
-        case HashLiteralString("_amdgpu_gs_shdr_intrl_data"):
-            *pValue = PipelineSymbolType::GsShdrIntrlData;
-            break;
-        case HashLiteralString("_amdgpu_vs_shdr_intrl_data"):
-            *pValue = PipelineSymbolType::VsShdrIntrlData;
-            break;
-        case HashLiteralString("_amdgpu_ps_shdr_intrl_data"):
-            *pValue = PipelineSymbolType::PsShdrIntrlData;
-            break;
-        case HashLiteralString("_amdgpu_cs_shdr_intrl_data"):
-            *pValue = PipelineSymbolType::CsShdrIntrlData;
-            break;
-        case HashLiteralString("_amdgpu_pipeline_intrl_data"):
-            *pValue = PipelineSymbolType::PipelineIntrlData;
-            break;
-        default:
             result = Result::NotFound;
-            break;
         }
     }
 
@@ -536,12 +568,34 @@ Result SerializeEnumBitflags(
     return result;
 }
 
+// =====================================================================================================================
+// Dense indices of the ShaderMetadata keys, in the order of the key table in DeserializeShaderMetadata().
+enum class ShaderMetadataKeyIndex : uint32
+{
+    ApiShaderHash,
+    HardwareMapping,
+    Count
+};
+
 // =====================================================================================================================
 PAL_INLINE Result DeserializeShaderMetadata(
     MsgPackReader*  pReader,
     ShaderMetadata*  pMetadata,
     uint32*  pRegistersOffset)
 {
+    static constexpr PerfectHashKeyTable<2, 1> KeyTable =
+    {
+        1u,
+        { 0, 1 },
+        { 0, 1 },
+        {
+            ShaderMetadataKey::ApiShaderHash,
+            ShaderMetadataKey::HardwareMapping
+        },
+        { 16, 17 }
+    };
+    static_assert(KeyTable.IsValid(), "Perfect-hash key table does not match the key strings.");
+
     Result result = (pReader->Type() == CWP_ITEM_MAP) ? Result::Success : Result::ErrorInvalidValue;
 
     for (uint32 i = pReader->Get().as.map.size; ((result == Result::Success) && (i > 0)); --i)
@@ -550,18 +604,18 @@ PAL_INLINE Result DeserializeShaderMetadata(
 
         if (result == Result::Success)
         {
-            const uint32 keyHash = HashString(static_cast<const char*>(pReader->Get().as.str.start),
-                                              pReader->Get().as.str.length);
+            const uint32 keyIndex = KeyTable.Find(static_cast<const char*>(pReader->Get().as.str.start),
+                                                  pReader->Get().as.str.length);
 
-            switch (keyHash)
+            switch (static_cast<ShaderMetadataKeyIndex>(keyIndex))
             {
-            case HashLiteralString(ShaderMetadataKey::ApiShaderHash):
+            case ShaderMetadataKeyIndex::ApiShaderHash:
                 PAL_ASSERT(pMetadata->hasEntry.apiShaderHash == 0);
                 result = pReader->UnpackNext(&pMetadata->apiShaderHash);
                 pMetadata->hasEntry.apiShaderHash = (result == Result::Success);
                 break;
 
-            case HashLiteralString(ShaderMetadataKey::HardwareMapping):
+            case ShaderMetadataKeyIndex::HardwareMapping:
                 PAL_ASSERT(pMetadata->hasEntry.hardwareMapping == 0);
                 result = DeserializeEnumBitflags<HardwareStage>(pReader, &pMetadata->hardwareMapping);
                 pMetadata->hasEntry.hardwareMapping = (result == Result::Success);
@@ -606,12 +660,63 @@ PAL_INLINE Result DeserializeShaderMetadata(
     return result;
 }
 
+// =====================================================================================================================
+// Dense indices of the HardwareStageMetadata keys, in the order of the key table in DeserializeHardwareStageMetadata().
+enum class HardwareStageMetadataKeyIndex : uint32
+{
+    EntryPoint,
+    ScratchMemorySize,
+    LdsSize,
+    PerfDataBufferSize,
+    VgprCount,
+    SgprCount,
+    VgprLimit,
+    SgprLimit,
+    ThreadgroupDimensions,
+    UsesUavs,
+    UsesRovs,
+    WritesUavs,
+    WritesDepth,
+    UsesAppendConsume,
+    MaxPrimsPerWave,
+    Count
+};
+
 // =====================================================================================================================
 PAL_INLINE Result DeserializeHardwareStageMetadata(
     MsgPackReader*  pReader,
     HardwareStageMetadata*  pMetadata,
     uint32*  pRegistersOffset)
 {
+    static constexpr PerfectHashKeyTable<15, 5> KeyTable =
+    {
+        7u,
+        { 1, 6 },
+        {
+            15, 8, 15, 15, 15, 15, 15, 11, 2, 15, 0, 6, 4, 1, 15, 7,
+            9, 5, 10, 15, 15, 15, 15, 12, 15, 3, 15, 13, 15, 15, 14, 15
+        },
+        {
+            HardwareStageMetadataKey::EntryPoint,
+            HardwareStageMetadataKey::ScratchMemorySize,
+            HardwareStageMetadataKey::LdsSize,
+            HardwareStageMetadataKey::PerfDataBufferSize,
+            HardwareStageMetadataKey::VgprCount,
+            HardwareStageMetadataKey::SgprCount,
+            HardwareStageMetadataKey::VgprLimit,
+            HardwareStageMetadataKey::SgprLimit,
+            HardwareStageMetadataKey::ThreadgroupDimensions,
+            HardwareStageMetadataKey::UsesUavs,
+            HardwareStageMetadataKey::UsesRovs,
+            HardwareStageMetadataKey::WritesUavs,
+            HardwareStageMetadataKey::WritesDepth,
+            HardwareStageMetadataKey::UsesAppendConsume,
+            HardwareStageMetadataKey::MaxPrimsPerWave
+        },
+        { 12, 20, 9, 22, 11, 11, 11, 11, 23, 10, 10, 12, 13, 20, 19 }
+    };
+    static_assert(KeyTable.IsValid(), "Perfect-hash key table does not match the key strings.");
+
     Result result = (pReader->Type() == CWP_ITEM_MAP) ? Result::Success : Result::ErrorInvalidValue;
 
     for (uint32 i = pReader->Get().as.map.size; ((result == Result::Success) && (i > 0)); --i)
@@ -620,66 +725,66 @@ PAL_INLINE Result DeserializeHardwareStageMetadata(
 
         if (result == Result::Success)
         {
-            const uint32 keyHash = HashString(static_cast<const char*>(pReader->Get().as.str.start),
-                                              pReader->Get().as.str.length);
+            const uint32 keyIndex = KeyTable.Find(static_cast<const char*>(pReader->Get().as.str.start),
+                                                  pReader->Get().as.str.length);
 
-            switch (keyHash)
+            switch (static_cast<HardwareStageMetadataKeyIndex>(keyIndex))
             {
-            case HashLiteralString(HardwareStageMetadataKey::EntryPoint):
+            case HardwareStageMetadataKeyIndex::EntryPoint:
                 PAL_ASSERT(pMetadata->hasEntry.entryPoint == 0);
                 result = DeserializeEnum(pReader, &pMetadata->entryPoint);
                 pMetadata->hasEntry.entryPoint = (result == Result::Success);
                 break;
 
-            case HashLiteralString(HardwareStageMetadataKey::ScratchMemorySize):
+            case HardwareStageMetadataKeyIndex::ScratchMemorySize:
                 PAL_ASSERT(pMetadata->hasEntry.scratchMemorySize == 0);
                 result = pReader->UnpackNext(&pMetadata->scratchMemorySize);
                 pMetadata->hasEntry.scratchMemorySize = (result == Result::Success);
                 break;
 
-            case HashLiteralString(HardwareStageMetadataKey::LdsSize):
+            case HardwareStageMetadataKeyIndex::LdsSize:
                 PAL_ASSERT(pMetadata->hasEntry.ldsSize == 0);
                 result = pReader->UnpackNext(&pMetadata->ldsSize);
                 pMetadata->hasEntry.ldsSize = (result == Result::Success);
                 break;
 
-            case HashLiteralString(HardwareStageMetadataKey::PerfDataBufferSize):
+            case HardwareStageMetadataKeyIndex::PerfDataBufferSize:
                 PAL_ASSERT(pMetadata->hasEntry.perfDataBufferSize == 0);
                 result = pReader->UnpackNext(&pMetadata->perfDataBufferSize);
                 pMetadata->hasEntry.perfDataBufferSize = (result == Result::Success);
                 break;
 
-            case HashLiteralString(HardwareStageMetadataKey::VgprCount):
+            case HardwareStageMetadataKeyIndex::VgprCount:
                 PAL_ASSERT(pMetadata->hasEntry.vgprCount == 0);
                 result = pReader->UnpackNext(&pMetadata->vgprCount);
                 pMetadata->hasEntry.vgprCount = (result == Result::Success);
                 break;
 
-            case HashLiteralString(HardwareStageMetadataKey::SgprCount):
+            case HardwareStageMetadataKeyIndex::SgprCount:
                 PAL_ASSERT(pMetadata->hasEntry.sgprCount == 0);
                 result = pReader->UnpackNext(&pMetadata->sgprCount);
                 pMetadata->hasEntry.sgprCount = (result == Result::Success);
                 break;
 
-            case HashLiteralString(HardwareStageMetadataKey::VgprLimit):
+            case HardwareStageMetadataKeyIndex::VgprLimit:
                 PAL_ASSERT(pMetadata->hasEntry.vgprLimit == 0);
                 result = pReader->UnpackNext(&pMetadata->vgprLimit);
                 pMetadata->hasEntry.vgprLimit = (result == Result::Success);
                 break;
 
-            case HashLiteralString(HardwareStageMetadataKey::SgprLimit):
+            case HardwareStageMetadataKeyIndex::SgprLimit:
                 PAL_ASSERT(pMetadata->hasEntry.sgprLimit == 0);
                 result = pReader->UnpackNext(&pMetadata->sgprLimit);
                 pMetadata->hasEntry.sgprLimit = (result == Result::Success);
                 break;
 
-            case HashLiteralString(HardwareStageMetadataKey::ThreadgroupDimensions):
+            case HardwareStageMetadataKeyIndex::ThreadgroupDimensions:
                 PAL_ASSERT(pMetadata->hasEntry.threadgroupDimensions == 0);
                 result = pReader->UnpackNext(&pMetadata->threadgroupDimensions);
                 pMetadata->hasEntry.threadgroupDimensions = (result == Result::Success);
                 break;
 
-            case HashLiteralString(HardwareStageMetadataKey::UsesUavs):
+            case HardwareStageMetadataKeyIndex::UsesUavs:
             {
                 PAL_ASSERT(pMetadata->hasEntry.usesUavs == 0);
                 bool value = false;
@@ -693,7 +798,7 @@ PAL_INLINE Result DeserializeHardwareStageMetadata(
                 break;
             }
 
-            case HashLiteralString(HardwareStageMetadataKey::UsesRovs):
+            case HardwareStageMetadataKeyIndex::UsesRovs:
             {
                 PAL_ASSERT(pMetadata->hasEntry.usesRovs == 0);
                 bool value = false;
@@ -707,7 +812,7 @@ PAL_INLINE Result DeserializeHardwareStageMetadata(
                 break;
             }
 
-            case HashLiteralString(HardwareStageMetadataKey::WritesUavs):
+            case HardwareStageMetadataKeyIndex::WritesUavs:
             {
                 PAL_ASSERT(pMetadata->hasEntry.writesUavs == 0);
                 bool value = false;
@@ -721,7 +826,7 @@ PAL_INLINE Result DeserializeHardwareStageMetadata(
                 break;
             }
 
-            case HashLiteralString(HardwareStageMetadataKey::WritesDepth):
+            case HardwareStageMetadataKeyIndex::WritesDepth:
             {
                 PAL_ASSERT(pMetadata->hasEntry.writesDepth == 0);
                 bool value = false;
@@ -735,7 +840,7 @@ PAL_INLINE Result DeserializeHardwareStageMetadata(
                 break;
             }
 
-            case HashLiteralString(HardwareStageMetadataKey::UsesAppendConsume):
+            case HardwareStageMetadataKeyIndex::UsesAppendConsume:
             {
                 PAL_ASSERT(pMetadata->hasEntry.usesAppendConsume == 0);
                 bool value = false;
@@ -749,7 +854,7 @@ PAL_INLINE Result DeserializeHardwareStageMetadata(
                 break;
             }
 
-            case HashLiteralString(HardwareStageMetadataKey::MaxPrimsPerWave):
+            case HardwareStageMetadataKeyIndex::MaxPrimsPerWave:
                 PAL_ASSERT(pMetadata->hasEntry.maxPrimsPerWave == 0);
                 result = pReader->UnpackNext(&pMetadata->maxPrimsPerWave);
                 pMetadata->hasEntry.maxPrimsPerWave = (result == Result::Success);
@@ -794,12 +899,65 @@ PAL_INLINE Result DeserializeHardwareStageMetadata(
     return result;
 }
 
+// =====================================================================================================================
+// Dense indices of the PipelineMetadata keys, in the order of the key table in DeserializePipelineMetadata().
+enum class PipelineMetadataKeyIndex : uint32
+{
+    Name,
+    Type,
+    InternalPipelineHash,
+    Shaders,
+    HardwareStages,
+    Registers,
+    UserDataLimit,
+    SpillThreshold,
+    UsesViewportArrayIndex,
+    EsGsLdsSize,
+    StreamOutTableAddress,
+    IndirectUserDataTableAddresses,
+    NumInterpolants,
+    ScratchMemorySize,
+    Api,
+    ApiCreateInfo,
+    Count
+};
+
 // =====================================================================================================================
 PAL_INLINE Result DeserializePipelineMetadata(
     MsgPackReader*  pReader,
     PipelineMetadata*  pMetadata,
     uint32*  pRegistersOffset)
 {
+    static constexpr PerfectHashKeyTable<16, 5> KeyTable =
+    {
+        208u,
+        { 0, 1 },
+        {
+            16, 9, 13, 3, 16, 12, 16, 1, 16, 5, 16, 0, 16, 16, 16, 8,
+            11, 16, 2, 16, 16, 16, 10, 4, 6, 15, 16, 7, 16, 14, 16, 16
+        },
+        {
+            PipelineMetadataKey::Name,
+            PipelineMetadataKey::Type,
+            PipelineMetadataKey::InternalPipelineHash,
+            PipelineMetadataKey::Shaders,
+            PipelineMetadataKey::HardwareStages,
+            PipelineMetadataKey::Registers,
+            PipelineMetadataKey::UserDataLimit,
+            PipelineMetadataKey::SpillThreshold,
+            PipelineMetadataKey::UsesViewportArrayIndex,
+            PipelineMetadataKey::EsGsLdsSize,
+            PipelineMetadataKey::StreamOutTableAddress,
+            PipelineMetadataKey::IndirectUserDataTableAddresses,
+            PipelineMetadataKey::NumInterpolants,
+            PipelineMetadataKey::ScratchMemorySize,
+            PipelineMetadataKey::Api,
+            PipelineMetadataKey::ApiCreateInfo
+        },
+        { 5, 5, 23, 8, 16, 10, 16, 16, 26, 15, 25, 35, 17, 20, 4, 16 }
+    };
+    static_assert(KeyTable.IsValid(), "Perfect-hash key table does not match the key strings.");
+
     Result result = (pReader->Type() == CWP_ITEM_ARRAY) ? Result::Success : Result::ErrorInvalidValue;
 
     if (result == Result::Success)
@@ -810,38 +968,34 @@ PAL_INLINE Result DeserializePipelineMetadata(
 
     for (uint32 i = pReader->Get().as.map.size; ((result == Result::Success) && (i > 0)); --i)
     {
-        uint32 keyHash = 0;
         result = pReader->Next(CWP_ITEM_STR);
 
         if (result == Result::Success)
         {
-            keyHash = HashString(static_cast<const char*>(pReader->Get().as.str.start),
-                                 pReader->Get().as.str.length);
-        }
+            const uint32 keyIndex = KeyTable.Find(static_cast<const char*>(pReader->Get().as.str.start),
+                                                  pReader->Get().as.str.length);
 
-        if (result == Result::Success)
-        {
-            switch (keyHash)
+            switch (static_cast<PipelineMetadataKeyIndex>(keyIndex))
             {
-            case HashLiteralString(PipelineMetadataKey::Name):
+            case PipelineMetadataKeyIndex::Name:
                 PAL_ASSERT(pMetadata->hasEntry.name == 0);
                 result = pReader->UnpackNext(&pMetadata->name);
                 pMetadata->hasEntry.name = (result == Result::Success);
                 break;
 
-            case HashLiteralString(PipelineMetadataKey::Type):
+            case PipelineMetadataKeyIndex::Type:
                 PAL_ASSERT(pMetadata->hasEntry.type == 0);
                 result = DeserializeEnum(pReader, &pMetadata->type);
                 pMetadata->hasEntry.type = (result == Result::Success);
                 break;
 
-            case HashLiteralString(PipelineMetadataKey::InternalPipelineHash):
+            case PipelineMetadataKeyIndex::InternalPipelineHash:
                 PAL_ASSERT(pMetadata->hasEntry.internalPipelineHash == 0);
                 result = pReader->UnpackNext(&pMetadata->internalPipelineHash);
                 pMetadata->hasEntry.internalPipelineHash = (result == Result::Success);
                 break;
 
-            case HashLiteralString(PipelineMetadataKey::Shaders):
+            case PipelineMetadataKeyIndex::Shaders:
                 result = pReader->Next();
                 if (result == Result::Success)
                 {
@@ -850,7 +1004,7 @@ PAL_INLINE Result DeserializePipelineMetadata(
                 }
                 break;
 
-            case HashLiteralString(PipelineMetadataKey::HardwareStages):
+            case PipelineMetadataKeyIndex::HardwareStages:
                 result = pReader->Next();
                 if (result == Result::Success)
                 {
@@ -859,7 +1013,7 @@ PAL_INLINE Result DeserializePipelineMetadata(
                 }
                 break;
 
-            case HashLiteralString(PipelineMetadataKey::Registers):
+            case PipelineMetadataKeyIndex::Registers:
                 if (pRegistersOffset != nullptr)
                 {
                     *pRegistersOffset = pReader->Tell();
@@ -867,19 +1021,19 @@ PAL_INLINE Result DeserializePipelineMetadata(
                 result = pReader->Skip(1);
                 break;
 
-            case HashLiteralString(PipelineMetadataKey::UserDataLimit):
+            case PipelineMetadataKeyIndex::UserDataLimit:
                 PAL_ASSERT(pMetadata->hasEntry.userDataLimit == 0);
                 result = pReader->UnpackNext(&pMetadata->userDataLimit);
                 pMetadata->hasEntry.userDataLimit = (result == Result::Success);
                 break;
 
-            case HashLiteralString(PipelineMetadataKey::SpillThreshold):
+            case PipelineMetadataKeyIndex::SpillThreshold:
                 PAL_ASSERT(pMetadata->hasEntry.spillThreshold == 0);
                 result = pReader->UnpackNext(&pMetadata->spillThreshold);
                 pMetadata->hasEntry.spillThreshold = (result == Result::Success);
                 break;
 
-            case HashLiteralString(PipelineMetadataKey::UsesViewportArrayIndex):
+            case PipelineMetadataKeyIndex::UsesViewportArrayIndex:
             {
                 PAL_ASSERT(pMetadata->hasEntry.usesViewportArrayIndex == 0);
                 bool value = false;
@@ -893,43 +1047,43 @@ PAL_INLINE Result DeserializePipelineMetadata(
                 break;
             }
 
-            case HashLiteralString(PipelineMetadataKey::EsGsLdsSize):
+            case PipelineMetadataKeyIndex::EsGsLdsSize:
                 PAL_ASSERT(pMetadata->hasEntry.esGsLdsSize == 0);
                 result = pReader->UnpackNext(&pMetadata->esGsLdsSize);
                 pMetadata->hasEntry.esGsLdsSize = (result == Result::Success);
                 break;
 
-            case HashLiteralString(PipelineMetadataKey::StreamOutTableAddress):
+            case PipelineMetadataKeyIndex::StreamOutTableAddress:
                 PAL_ASSERT(pMetadata->hasEntry.streamOutTableAddress == 0);
                 result = pReader->UnpackNext(&pMetadata->streamOutTableAddress);
                 pMetadata->hasEntry.streamOutTableAddress = (result == Result::Success);
                 break;
 
-            case HashLiteralString(PipelineMetadataKey::IndirectUserDataTableAddresses):
+            case PipelineMetadataKeyIndex::IndirectUserDataTableAddresses:
                 PAL_ASSERT(pMetadata->hasEntry.indirectUserDataTableAddresses == 0);
                 result = pReader->UnpackNext(&pMetadata->indirectUserDataTableAddresses);
                 pMetadata->hasEntry.indirectUserDataTableAddresses = (result == Result::Success);
                 break;
 
-            case HashLiteralString(PipelineMetadataKey::NumInterpolants):
+            case PipelineMetadataKeyIndex::NumInterpolants:
                 PAL_ASSERT(pMetadata->hasEntry.numInterpolants == 0);
                 result = pReader->UnpackNext(&pMetadata->numInterpolants);
                 pMetadata->hasEntry.numInterpolants = (result == Result::Success);
                 break;
 
-            case HashLiteralString(PipelineMetadataKey::ScratchMemorySize):
+            case PipelineMetadataKeyIndex::ScratchMemorySize:
                 PAL_ASSERT(pMetadata->hasEntry.scratchMemorySize == 0);
                 result = pReader->UnpackNext(&pMetadata->scratchMemorySize);
                 pMetadata->hasEntry.scratchMemorySize = (result == Result::Success);
                 break;
 
-            case HashLiteralString(PipelineMetadataKey::Api):
+            case PipelineMetadataKeyIndex::Api:
                 PAL_ASSERT(pMetadata->hasEntry.api == 0);
                 result = pReader->UnpackNext(&pMetadata->api);
                 pMetadata->hasEntry.api = (result == Result::Success);
                 break;
 
-            case HashLiteralString(PipelineMetadataKey::ApiCreateInfo):
+            case PipelineMetadataKeyIndex::ApiCreateInfo:
                 PAL_ASSERT(pMetadata->hasEntry.apiCreateInfo == 0);
                 result = pReader->Next();
 
@@ -951,12 +1105,34 @@ PAL_INLINE Result DeserializePipelineMetadata(
     return result;
 }
 
+// =====================================================================================================================
+// Dense indices of the PalCodeObjectMetadata keys, in the order of the key table in DeserializePalCodeObjectMetadata().
+enum class PalCodeObjectMetadataKeyIndex : uint32
+{
+    Version,
+    Pipelines,
+    Count
+};
+
 // =====================================================================================================================
 PAL_INLINE Result DeserializePalCodeObjectMetadata(
     MsgPackReader*  pReader,
     PalCodeObjectMetadata*  pMetadata,
     uint32*  pRegistersOffset)
 {
+    static constexpr PerfectHashKeyTable<2, 1> KeyTable =
+    {
+        2u,
+        { 0, 1 },
+        { 1, 0 },
+        {
+            PalCodeObjectMetadataKey::Version,
+            PalCodeObjectMetadataKey::Pipelines
+        },
+        { 14, 16 }
+    };
+    static_assert(KeyTable.IsValid(), "Perfect-hash key table does not match the key strings.");
+
     Result result = (pReader->Type() == CWP_ITEM_MAP) ? Result::Success : Result::ErrorInvalidValue;
 
     for (uint32 i = pReader->Get().as.map.size; ((result == Result::Success) && (i > 0)); --i)
@@ -965,18 +1141,18 @@ PAL_INLINE Result DeserializePalCodeObjectMetadata(
 
         if (result == Result::Success)
         {
-            const uint32 keyHash = HashString(static_cast<const char*>(pReader->Get().as.str.start),
-                                              pReader->Get().as.str.length);
+            const uint32 keyIndex = KeyTable.Find(static_cast<const char*>(pReader->Get().as.str.start),
+                                                  pReader->Get().as.str.length);
 
-            switch (keyHash)
+            switch (static_cast<PalCodeObjectMetadataKeyIndex>(keyIndex))
             {
-            case HashLiteralString(PalCodeObjectMetadataKey::Version):
+            case PalCodeObjectMetadataKeyIndex::Version:
                 PAL_ASSERT(pMetadata->hasEntry.version == 0);
                 result = pReader->UnpackNext(&pMetadata->version);
                 pMetadata->hasEntry.version = (result == Result::Success);
                 break;
 
-            case HashLiteralString(PalCodeObjectMetadataKey::Pipelines):
+            case PalCodeObjectMetadataKeyIndex::Pipelines:
                 result = pReader->Next();
                 if (result == Result::Success)
                 {
@@ -458,14 +458,34 @@ union CmdBufferBuildFlags
         /// the optimizeExclusiveSubmit flag is also set. This flag is ignored for root command buffers.
         uint32 disallowNestedLaunchViaIb2   :  1;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+        /// Records the location of every value written for the user-data entries selected by
+        /// CmdBufferBuildInfo::pPatchableUserDataRanges so that ICmdBuffer::PatchUserData() can later change those
+        /// values without re-recording the command buffer.  This forces the CPU update path for user-data tables and
+        /// disables PM4 optimization for the command buffer.
+        uint32 enableUserDataPatching       :  1;
+
+        /// Reserved for future use.
+        uint32 reserved                     : 23;
+#else
         /// Reserved for future use.
         uint32 reserved                     : 24;
+#endif
     };
 
     /// Flags packed as 32-bit uint.
     uint32 u32All;
 };
 
+/// Selects a range of user-data entries which may be patched after a command buffer is built.
+/// @see CmdBufferBuildInfo and ICmdBuffer::PatchUserData().
+struct PatchableUserDataRange
+{
+    PipelineBindPoint bindPoint;  ///< Selects graphics or compute user-data entries.
+    uint32            firstEntry; ///< First user-data entry in the range.
+    uint32            entryCount; ///< Number of user-data entries in the range.
+};
+
 /// Specifies options that direct command buffer building.
 struct CmdBufferBuildInfo
 {
@@ -478,7 +498,9 @@ struct CmdBufferBuildInfo
     const InheritedStateParams* pInheritedState;
 
     /// If non-null, the command buffer will begin with all states set as they are in this previously built command
-    /// buffer. Any state specified in pInheritedState is excluded if it is also provided.
+    /// buffer. Any state specified in pInheritedState is excluded if it is also provided.  This may also be a command
+    /// buffer which is still being built, such as the command buffer which will execute this nested command buffer,
+    /// as long as it is not being recorded into while this command buffer is being begun.
     const ICmdBuffer* pStateInheritCmdBuffer;
 
     /// Optional allocator for PAL to use when allocating temporary memory during command buffer building.  PAL will
@@ -492,6 +514,14 @@ struct CmdBufferBuildInfo
     ///   before calling Begin() or PAL will accidentally free it.
     Util::VirtualLinearAllocator* pMemAllocator;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+    /// User-data entries whose values ICmdBuffer::PatchUserData() may change once the command buffer is built.  Only
+    /// used if flags.enableUserDataPatching is set.  GPU addresses passed as user data, such as descriptor table
+    /// pointers, are selected the same way as any other user-data value.
+    uint32                        patchableUserDataRangeCount;
+    const PatchableUserDataRange* pPatchableUserDataRanges;
+#endif
+
 };
 
 /// Specifies info on how a compute shader should use resources.
@@ -1148,6 +1178,26 @@ typedef void (PAL_STDCALL *CmdDrawIndexedIndirectMultiFunc)(
     uint32            maximumCount,
     gpusize           countGpuAddr);
 
+/// @internal Function pointer type definition for issuing a batch of non-indexed draws.
+///
+/// @see ICmdBuffer::CmdDrawMulti().
+typedef void (PAL_STDCALL *CmdDrawMultiFunc)(
+    ICmdBuffer*             pCmdBuffer,
+    uint32                  drawCount,
+    const DrawIndirectArgs* pDrawArgs,
+    uint32                  userDataEntry,
+    const uint32*           pUserDataValues);
+
+/// @internal Function pointer type definition for issuing a batch of indexed draws.
+///
+/// @see ICmdBuffer::CmdDrawIndexedMulti().
+typedef void (PAL_STDCALL *CmdDrawIndexedMultiFunc)(
+    ICmdBuffer*                    pCmdBuffer,
+    uint32                         drawCount,
+    const DrawIndexedIndirectArgs* pDrawArgs,
+    uint32                         userDataEntry,
+    const uint32*                  pUserDataValues);
+
 /// @internal Function pointer type definition for issuing direct dispatches.
 ///
 /// @see ICmdBuffer::CmdDispatch().
@@ -1606,6 +1656,36 @@ public:
     /// @returns How many DWORDs of embedded data the command buffer can allocate at once.
     virtual uint32 GetEmbeddedDataLimit() const = 0;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+    /// Changes the values of patchable user-data entries in a command buffer which has already been built, so that it
+    /// can be submitted again without being re-recorded or re-validated.
+    ///
+    /// Every value the command buffer recorded for the given entries, both in user-SGPR writes and in user-data spill
+    /// tables, is overwritten in place with the new value.  Values recorded by PAL's internal operations (blits,
+    /// clears, etc.) and copies made by CmdExecuteIndirectCmds() are not affected.  Callers which inlined this command
+    /// buffer's commands by executing it as a nested command buffer are not affected either.
+    ///
+    /// The command buffer must have been built with CmdBufferBuildFlags::enableUserDataPatching and the entries must
+    /// have been selected in CmdBufferBuildInfo::pPatchableUserDataRanges.  The command buffer must not be in use by
+    /// the GPU.  Only supported by universal command buffers on GFXIP 9 and newer hardware.
+    ///
+    /// @param [in] bindPoint    Selects graphics or compute user-data entries.
+    /// @param [in] firstEntry   First user-data entry to patch.
+    /// @param [in] entryCount   Number of user-data entries to patch.
+    /// @param [in] pEntryValues New values for each entry.  Must not be null.
+    ///
+    /// @returns Success if the values were patched.  Otherwise, one of the following errors may be returned:
+    ///          + ErrorIncompleteCommandBuffer if the command buffer is not in the executable state.
+    ///          + ErrorUnavailable if the command buffer was not built with user-data patching enabled.
+    ///          + ErrorInvalidValue if any of the entries were not selected as patchable.
+    ///          + Unsupported if this command buffer cannot patch user data.
+    virtual Result PatchUserData(
+        PipelineBindPoint bindPoint,
+        uint32            firstEntry,
+        uint32            entryCount,
+        const uint32*     pEntryValues) = 0;
+#endif
+
     /// Binds a graphics or compute pipeline to the current command buffer state.
     ///
     /// @param [in] params Parameters necessary to manage dynamic pipeline shader information.
@@ -2058,6 +2138,58 @@ public:
         m_funcTable.pfnCmdDrawIndexedIndirectMulti(this, gpuMemory, offset, stride, maximumCount, countGpuAddr);
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    /// Issues a batch of instanced, non-indexed draw calls using the command buffer's currently bound graphics state.
+    /// This is equivalent to calling CmdDraw() once for each element of pDrawArgs, but the bound state is only
+    /// validated once for the whole batch, so it is considerably cheaper on the CPU for long runs of draws which only
+    /// differ in their arguments.
+    ///
+    /// Optionally, one graphics user-data entry can be changed between the draws: if pUserDataValues is non-null,
+    /// entry userDataEntry is set to pUserDataValues[i] before draw i is issued, as if CmdSetUserData() had been called
+    /// for it.  The entry keeps the value of the last draw once the batch is done.
+    ///
+    /// @see CmdDraw
+    ///
+    /// @param [in] drawCount       Number of draws to issue.
+    /// @param [in] pDrawArgs       Array of drawCount draw arguments.  Each draw will be discarded if its vertexCount
+    ///                             or instanceCount is zero.
+    /// @param [in] userDataEntry   Graphics user-data entry which receives the per-draw values.  Ignored if
+    ///                             pUserDataValues is null.
+    /// @param [in] pUserDataValues Optional array of drawCount per-draw values for userDataEntry.
+    PAL_INLINE void CmdDrawMulti(
+        uint32                  drawCount,
+        const DrawIndirectArgs* pDrawArgs,
+        uint32                  userDataEntry,
+        const uint32*           pUserDataValues)
+    {
+        m_funcTable.pfnCmdDrawMulti(this, drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+    }
+
+    /// Issues a batch of instanced, indexed draw calls using the command buffer's currently bound graphics state.  This
+    /// is equivalent to calling CmdDrawIndexed() once for each element of pDrawArgs, but the bound state is only
+    /// validated once for the whole batch.
+    ///
+    /// The per-draw user-data entry works the same way as in CmdDrawMulti().
+    ///
+    /// @see CmdDrawIndexed
+    /// @see CmdDrawMulti
+    ///
+    /// @param [in] drawCount       Number of draws to issue.
+    /// @param [in] pDrawArgs       Array of drawCount draw arguments.  Each draw will be discarded if its indexCount or
+    ///                             instanceCount is zero.
+    /// @param [in] userDataEntry   Graphics user-data entry which receives the per-draw values.  Ignored if
+    ///                             pUserDataValues is null.
+    /// @param [in] pUserDataValues Optional array of drawCount per-draw values for userDataEntry.
+    PAL_INLINE void CmdDrawIndexedMulti(
+        uint32                         drawCount,
+        const DrawIndexedIndirectArgs* pDrawArgs,
+        uint32                         userDataEntry,
+        const uint32*                  pUserDataValues)
+    {
+        m_funcTable.pfnCmdDrawIndexedMulti(this, drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+    }
+#endif
+
     /// Dispatches a compute workload of the given dimensions using the command buffer's currently bound compute state.
     ///
     /// The thread group size is defined in the compute shader.
@@ -3166,6 +3298,13 @@ public:
     /// + Both of the above points apply in between callees, if more than one command buffer is being executed by this
     ///   call.
     ///
+    /// Nested command buffers can be used to record one large piece of work on several threads at once: begin each
+    /// callee with @ref CmdBufferBuildInfo::pStateInheritCmdBuffer pointing at this command buffer so that it starts
+    /// from a snapshot of this command buffer's current state, record the callees in parallel and then execute all of
+    /// them in order with a single call.  Consecutive callees which were built with the optimizeExclusiveSubmit and
+    /// disallowNestedLaunchViaIb2 flags are chained directly from one to the next, so a sequence of such callees only
+    /// jumps back to this command buffer once, after the last of them.
+    ///
     /// @param [in]     cmdBufferCount  Number of nested command buffers to execute.  (i.e., size of the ppCmdBuffers
     ///                                 array).  This must be at least one, otherwise making this call is pointless.
     /// @param [in,out] ppCmdBuffers    Array of nested command buffers to execute.  It is an error condition if any
@@ -3401,6 +3540,10 @@ protected:
         CmdDrawIndexedFunc              pfnCmdDrawIndexed;              ///< CmdDrawIndexed function pointer.
         CmdDrawIndirectMultiFunc        pfnCmdDrawIndirectMulti;        ///< CmdDrawIndirectMulti function pointer.
         CmdDrawIndexedIndirectMultiFunc pfnCmdDrawIndexedIndirectMulti; ///< CmdDrawIndexedIndirectMulti func pointer.
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+        CmdDrawMultiFunc                pfnCmdDrawMulti;                ///< CmdDrawMulti function pointer.
+        CmdDrawIndexedMultiFunc         pfnCmdDrawIndexedMulti;         ///< CmdDrawIndexedMulti function pointer.
+#endif
         CmdDispatchFunc                 pfnCmdDispatch;                 ///< CmdDispatch function pointer.
         CmdDispatchIndirectFunc         pfnCmdDispatchIndirect;         ///< CmdDispatchIndirect function pointer.
         CmdDispatchOffsetFunc           pfnCmdDispatchOffset;           ///< CmdDispatchOffset function pointer.
@@ -1786,6 +1786,22 @@ struct CalibratedTimestamps
     uint64 maxDeviation;                  ///< Maximum deviation in nanoseconds between the GPU and CPU timestamps
 };
 
+/// Reports how a call to IDevice::CreateGraphicsPipelines() spent its time.  Every stage time is the sum of the time
+/// all threads spent in that stage, so dividing a stage time by the wall time gives the average number of threads
+/// which were busy with it.  All times are in nanoseconds.
+struct PipelineBatchStats
+{
+    uint32 threadCount;           ///< Number of threads which created pipelines, including the calling thread.
+    uint32 mappedAllocations;     ///< Number of GPU memory allocations which were mapped for CPU access in order to
+                                  ///  upload the batch.  Pipelines sharing an allocation share its mapping.
+    uint64 wallTime;              ///< Time from the start to the end of the whole call.
+    uint64 elfLoadTime;           ///< Time spent copying and parsing the pipeline ELF binaries.
+    uint64 metadataTime;          ///< Time spent decoding the pipeline metadata.
+    uint64 registerSetupTime;     ///< Time spent decoding register values and building the pipelines' hardware state.
+    uint64 uploadTime;            ///< Time spent allocating GPU memory, applying relocations and uploading code, data
+                                  ///  and registers.
+};
+
 #if (PAL_CLIENT_INTERFACE_MAJOR_VERSION < 470)
 /// Reports a current GPU timestamp along with a current CPU clock value, for use in calibrating CPU and GPU timelines.
 struct GpuTimestampCalibration
@@ -3685,6 +3701,34 @@ public:
         void*                             pPlacementAddr,
         IPipeline**                       ppPipeline) = 0;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 487
+    /// Creates a batch of graphics @ref IPipeline objects.  This is equivalent to calling CreateGraphicsPipeline() once
+    /// for each element of pCreateInfos, except that PAL may create the pipelines in parallel on internal worker
+    /// threads and upload them into GPU memory together.  The number of worker threads is controlled by the
+    /// PipelineBatchThreadCount setting.
+    ///
+    /// Each pipeline succeeds or fails on its own: ppPipelines[i] is null for every pipeline which failed.
+    ///
+    /// @param [in]  count            Number of pipelines to create.
+    /// @param [in]  pCreateInfos     Array of count pipeline create infos.
+    /// @param [in]  ppPlacementAddrs Array of count placement addresses.  Each must point to as much memory as reported
+    ///                               by GetGraphicsPipelineSize() for the matching create info.
+    /// @param [out] ppPipelines      Array of count constructed pipeline objects.
+    /// @param [out] pResults         Optional.  If non-null, receives the result of creating each pipeline.
+    /// @param [out] pStats           Optional.  If non-null, receives timing information about the call.
+    ///
+    /// @returns Success if all of the pipelines were successfully created.  Otherwise, ErrorInvalidPointer if one of
+    ///          the arrays is null, or the error of one of the pipelines which failed.  See CreateGraphicsPipeline()
+    ///          for the errors each pipeline may report.
+    virtual Result CreateGraphicsPipelines(
+        uint32                            count,
+        const GraphicsPipelineCreateInfo* pCreateInfos,
+        void*const*                       ppPlacementAddrs,
+        IPipeline**                       ppPipelines,
+        Result*                           pResults,
+        PipelineBatchStats*               pStats) = 0;
+#endif
+
     /// Determines the amount of system memory required for a MSAA state object.  An allocation of this amount of memory
     /// must be provided in the pPlacementAddr parameter of CreateMsaaState().
     ///
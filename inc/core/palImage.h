@@ -458,6 +458,21 @@ struct SubresRange
     uint32   numSlices;    ///< Number of slices in the range.
 };
 
+/// Specifies a region to copy between an image subresource and linear system memory using the CPU.  Input structure
+/// for IImage::CpuCopyToImage() and IImage::CpuCopyFromImage().
+struct CpuImageCopyRegion
+{
+    SubresId imageSubres;      ///< Selects the aspect, mip level and first array slice of the image.
+    Offset3d imageOffset;      ///< Offset of the region within the subresource in elements (i.e., texels, or blocks for
+                               ///  block-compressed formats).  For 3D images, z selects the first depth slice.
+    Extent3d imageExtent;      ///< Size of the region in elements.  For 3D images, depth is the number of depth slices.
+    uint32   numSlices;        ///< Number of array slices to copy.  Must be 1 for 3D images.
+    gpusize  memoryOffset;     ///< Offset in bytes from the start of the linear memory to the region's first element.
+    gpusize  memoryRowPitch;   ///< Offset in bytes between the same X position on two consecutive rows.
+    gpusize  memoryDepthPitch; ///< Offset in bytes between the same X,Y position on two consecutive (array or depth)
+                               ///  slices.
+};
+
 /**
  ***********************************************************************************************************************
  * @interface IImage
@@ -488,6 +503,53 @@ public:
         SubresId      subresId,
         SubresLayout* pLayout) const = 0;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 489
+    /// Uses the CPU to copy regions of linear system memory into the image's data, tiling the data as it goes.  This
+    /// lets clients which can map the image's GPU memory upload image data without a staging buffer or a GPU copy.
+    ///
+    /// The image must not have any metadata (e.g., compression) and must be single-sampled.  Nothing is done to
+    /// synchronize with the GPU; the client must ensure the GPU isn't accessing the affected subresources.
+    ///
+    /// @param [in]  pSrcData       Linear system memory which the regions' memory offsets and pitches are relative to.
+    /// @param [out] pImageData     CPU address of the start of the image's data: a mapping of the GPU memory this image
+    ///                             is bound to, advanced by the offset the image was bound at.
+    /// @param [in]  regionCount    Number of regions in pRegions.
+    /// @param [in]  pRegions       Regions to copy.
+    /// @param [in]  maxThreadCount Maximum number of threads to spread the copy across, including the calling thread.
+    ///                             Zero selects one thread per logical CPU core.  Small copies are always done on the
+    ///                             calling thread alone.
+    ///
+    /// @returns Success if the copy was done.  Otherwise, one of the following errors may be returned:
+    ///          + ErrorInvalidPointer if pSrcData, pImageData or pRegions is null.
+    ///          + ErrorInvalidValue if a region doesn't fit in its subresource.
+    ///          + ErrorUnavailable if the image has metadata or multiple samples.
+    ///          + Unsupported if the hardware layer or the image's format doesn't support CPU tiling.
+    virtual Result CpuCopyToImage(
+        const void*               pSrcData,
+        void*                     pImageData,
+        uint32                    regionCount,
+        const CpuImageCopyRegion* pRegions,
+        uint32                    maxThreadCount) const = 0;
+
+    /// Uses the CPU to copy regions of the image's data into linear system memory, untiling the data as it goes.  The
+    /// requirements and errors are the same as for @ref CpuCopyToImage().
+    ///
+    /// @param [in]  pImageData     CPU address of the start of the image's data.
+    /// @param [out] pDstData       Linear system memory which the regions' memory offsets and pitches are relative to.
+    /// @param [in]  regionCount    Number of regions in pRegions.
+    /// @param [in]  pRegions       Regions to copy.
+    /// @param [in]  maxThreadCount Maximum number of threads to spread the copy across, including the calling thread.
+    ///                             Zero selects one thread per logical CPU core.
+    ///
+    /// @returns Success if the copy was done, otherwise an appropriate error.
+    virtual Result CpuCopyFromImage(
+        const void*               pImageData,
+        void*                     pDstData,
+        uint32                    regionCount,
+        const CpuImageCopyRegion* pRegions,
+        uint32                    maxThreadCount) const = 0;
+#endif
+
     /// Reports the create info of image.
     ///
     /// @returns the reference to ImageCreateInfo
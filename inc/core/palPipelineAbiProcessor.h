@@ -216,7 +216,27 @@ public:
     ///          there is no metadata.
     Result GetMetadata(
         MsgPackReader*         pReader,
-        PalCodeObjectMetadata* pMetadata) const;
+        PalCodeObjectMetadata* pMetadata) const
+    {
+        uint32 registersOffset = UINT_MAX;
+        return GetMetadata(pReader, pMetadata, &registersOffset);
+    }
+
+    /// Get the Pipeline Metadata as a deserialized struct using the given MsgPackReader instance, and report where the
+    /// registers map starts.  This lets callers which cache the deserialized struct restore the reader's position
+    /// later without deserializing the metadata again.
+    ///
+    /// @param [in/out] pReader           Pointer to the MsgPackReader to use and (re)init with the metadata blob.
+    /// @param [out]    pMetadata         Pointer to where to store the deserialized metadata.
+    /// @param [out]    pRegistersOffset  Offset of the registers map within the metadata blob.  Set to UINT_MAX for
+    ///                                   legacy metadata, which is translated rather than read from the blob.
+    ///
+    /// @returns Result if successful, ErrorInvalidValue if a parser error occurred, ErrorInvalidPipelineElf if
+    ///          there is no metadata.
+    Result GetMetadata(
+        MsgPackReader*         pReader,
+        PalCodeObjectMetadata* pMetadata,
+        uint32*                pRegistersOffset) const;
 
     /// Get the Pipeline Metadata as a binary blob.
     ///
@@ -354,9 +374,21 @@ public:
     ///
     /// @param [in] pBuffer    Pointer to the buffer to load from.
     /// @param [in] bufferSize Size of the buffer in bytes to load from.
-    Result LoadFromBuffer(const void* pBuffer, size_t bufferSize);
+    Result LoadFromBuffer(const void* pBuffer, size_t bufferSize)
+        { return LoadFromBufferInternal(pBuffer, bufferSize, true); }
+
+    /// Load the ELF from a buffer without copying it.  Sections, symbols and metadata reference the buffer in place,
+    /// and a section is only copied if it is modified.  See Elf::ElfProcessor::LoadFromBufferView().
+    ///
+    /// @param [in] pBuffer    Pointer to the buffer to load from.  It must remain valid and unchanged for the lifetime
+    ///                        of this PipelineAbiProcessor.
+    /// @param [in] bufferSize Size of the buffer in bytes to load from.
+    Result LoadFromBufferView(const void* pBuffer, size_t bufferSize)
+        { return LoadFromBufferInternal(pBuffer, bufferSize, false); }
 
 private:
+    Result LoadFromBufferInternal(const void* pBuffer, size_t bufferSize, bool copyData);
+
     void RelocationHelper(
         void*                    pBuffer,
         uint64                   baseAddress,
@@ -312,11 +312,14 @@ Result PipelineAbiProcessor<Allocator>::SetAmdIl(
 template <typename Allocator>
 Result PipelineAbiProcessor<Allocator>::GetMetadata(
     MsgPackReader*         pReader,
-    PalCodeObjectMetadata* pMetadata
+    PalCodeObjectMetadata* pMetadata,
+    uint32*                pRegistersOffset
     ) const
 {
     Result result = Result::ErrorInvalidPipelineElf;
 
+    *pRegistersOffset = UINT_MAX;
+
     if (m_pMetadata != nullptr)
     {
         memset(pMetadata, 0, sizeof(*pMetadata));
@@ -328,16 +331,15 @@ Result PipelineAbiProcessor<Allocator>::GetMetadata(
         else if (m_metadataMajorVer == PipelineMetadataMajorVersion)
         {
             result = pReader->InitFromBuffer(m_pMetadata, static_cast<uint32>(m_metadataSize));
-            uint32 registersOffset = UINT_MAX;
 
             if (result == Result::Success)
             {
-                result = Metadata::DeserializePalCodeObjectMetadata(pReader, pMetadata, &registersOffset);
+                result = Metadata::DeserializePalCodeObjectMetadata(pReader, pMetadata, pRegistersOffset);
             }
 
             if (result == Result::Success)
             {
-                result = pReader->Seek(registersOffset);
+                result = pReader->Seek(*pRegistersOffset);
             }
         }
         else
@@ -879,11 +881,13 @@ PipelineSymbolType PipelineAbiProcessor<Allocator>::GetSymbolTypeFromName(
 
 // =====================================================================================================================
 template <typename Allocator>
-Result PipelineAbiProcessor<Allocator>::LoadFromBuffer(
+Result PipelineAbiProcessor<Allocator>::LoadFromBufferInternal(
     const void* pBuffer,
-    size_t      bufferSize)
+    size_t      bufferSize,
+    bool        copyData)
 {
-    Result result = m_elfProcessor.LoadFromBuffer(pBuffer, bufferSize);
+    Result result = copyData ? m_elfProcessor.LoadFromBuffer(pBuffer, bufferSize)
+                             : m_elfProcessor.LoadFromBufferView(pBuffer, bufferSize);
 
     if (result == Result::Success)
     {
@@ -34,6 +34,9 @@
 #include "pal.h"
 #include "palSysMemory.h"
 #include "palMemTrackerImpl.h"
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 492
+#include "palSlabAllocatorImpl.h"
+#endif
 #include "palDestroyable.h"
 #include "palDeveloperHooks.h"
 
@@ -467,7 +470,12 @@ public:
         m_pClientData = pClientData;
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 492
+    /// Allocates memory using the platform's ForwardAllocator.  Small allocations may instead be served from the
+    /// platform's slab allocator if it has been enabled.
+#else
     /// Allocates memory using the platform's ForwardAllocator.
+#endif
     ///
     /// @param [in] allocInfo @see Util::AllocInfo
     ///
@@ -476,18 +484,26 @@ public:
     {
 #if PAL_MEMTRACK
         return m_memTracker.Alloc(allocInfo);
+#elif PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 492
+        return m_slabAllocator.Alloc(allocInfo);
 #else
         return m_allocator.Alloc(allocInfo);
 #endif
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 492
+    /// Frees memory using the platform's ForwardAllocator (or slab allocator).
+#else
     /// Frees memory using the platform's ForwardAllocator.
+#endif
     ///
     /// @param [in] freeInfo @see Util::FreeInfo
     void  Free(const Util::FreeInfo& freeInfo)
     {
 #if PAL_MEMTRACK
         m_memTracker.Free(freeInfo);
+#elif PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 492
+        m_slabAllocator.Free(freeInfo);
 #else
         m_allocator.Free(freeInfo);
 #endif
@@ -527,10 +543,18 @@ protected:
     IPlatform(
         const Util::AllocCallbacks& allocCb)
         :
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 492
+        m_allocator(allocCb),
+        m_slabAllocator(&m_allocator),
+#if PAL_MEMTRACK
+        m_memTracker(&m_slabAllocator),
+#endif
+#else
 #if PAL_MEMTRACK
         m_memTracker(&m_allocator),
 #endif
         m_allocator(allocCb),
+#endif
         m_pClientData(nullptr) { }
 
     /// @internal Destructor. Prevent use of delete operator on this interface.  Client must destroy objects by
@@ -538,6 +562,23 @@ protected:
     /// object on their own.
     virtual ~IPlatform() { }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 492
+    /// @internal Initialization common to all platforms; must be called in subclass overrides of this function.
+    /// Currently only handles initialization of the slab allocator and the memory leak tracker.
+    virtual Result Init()
+    {
+        Result result = m_slabAllocator.Init();
+
+#if PAL_MEMTRACK
+        if (result == Result::Success)
+        {
+            result = m_memTracker.Init();
+        }
+#endif
+
+        return result;
+    }
+#else
     /// @internal Initialization common to all platforms; must be called in subclass overrides of this function.
     /// Currently only handles initialization of the memory leak tracker.
     virtual Result Init()
@@ -548,6 +589,7 @@ protected:
         return Result::Success;
 #endif
     }
+#endif
 
     /// Used by the InstallDeveloperCb to install the event handler according to the derived platform.
     ///
@@ -557,6 +599,21 @@ protected:
         Developer::Callback pfnDeveloperCb,
         void*               pPrivateData) = 0;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 492
+    /// @internal Memory allocator. Calls to Alloc() and Free() are chained down to the allocator's counterparts.
+    Util::ForwardAllocator m_allocator;
+
+    /// @internal Optional size-class allocator which serves small allocations from per-thread caches. It forwards all
+    /// other requests (and everything until it is enabled) to our forward allocator.
+    Util::SlabAllocator<Util::ForwardAllocator> m_slabAllocator;
+
+#if PAL_MEMTRACK
+    /// @internal Memory leak tracker. Requires an allocator in order to perform the actual allocations. We can't
+    /// provide this platform because that would result in a stack overflow. We must give it our slab allocator, which
+    /// is declared first so that it outlives the tracker's leak cleanup.
+    Util::MemTracker<Util::SlabAllocator<Util::ForwardAllocator>> m_memTracker;
+#endif
+#else
 #if PAL_MEMTRACK
     /// @internal Memory leak tracker. Requires an allocator in order to perform the actual allocations. We can't
     /// provide this platform because that would result in a stack overflow. We must give it our forward allocator.
@@ -565,6 +622,7 @@ protected:
 
     /// @internal Memory allocator. Calls to Alloc() and Free() are chained down to the allocator's counterparts.
     Util::ForwardAllocator m_allocator;
+#endif
 
 private:
     /// @internal Client data pointer. This can have an arbitrary value and can be returned by calling GetClientData()
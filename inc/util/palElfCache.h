@@ -0,0 +1,232 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palElfCache.h
+ * @brief PAL utility collection ElfCache class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palFileMap.h"
+#include "palMemMapFile.h"
+#include "palMetroHash.h"
+#include "palMutex.h"
+
+namespace Util
+{
+
+/// Identifies a single entry in an @ref ElfCache.
+struct ElfCacheKey
+{
+    MetroHash::Hash elfHash;   ///< MetroHash128 of the ELF binary the cached data was derived from.  See
+                               ///  @ref ElfCache::ComputeElfHash().
+    uint64          deviceKey; ///< Identifies the device (or any other context) the cached data is valid for.
+};
+
+/// Specifies properties for creating an @ref ElfCache.
+struct ElfCacheCreateInfo
+{
+    const char* pDirectory;  ///< Directory which holds the cache files.  It is created if it doesn't exist.
+    const char* pName;       ///< Base name of the cache files: "<pName>.idx", "<pName>.bin" and "<pName>.lock".
+    uint64      maxDataSize; ///< Least-recently used entries are evicted to keep the cached data below this size.
+    uint32      maxEntries;  ///< Least-recently used entries are evicted to keep the number of entries at or below
+                             ///  this count.  The index file is sized for this many entries, so every process sharing
+                             ///  the cache should use the same value.
+};
+
+/// Counters reported by @ref ElfCache::GetStats().  These only cover the calling process.
+struct ElfCacheStats
+{
+    uint64 hits;           ///< Number of successful calls to Load().
+    uint64 misses;         ///< Number of calls to Load() which didn't find a valid entry.
+    uint64 stores;         ///< Number of entries added by Store().
+    uint64 evictions;      ///< Number of entries evicted to honor the size cap or the entry limit.
+    uint64 compactions;    ///< Number of times the data file was compacted.
+    uint64 corruptEntries; ///< Number of entries which were found but failed their integrity check.
+    uint64 bytesRead;      ///< Total size of the data returned by Load().
+    uint64 bytesWritten;   ///< Total size of the data written by Store().
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief Persistent, content-addressed cache of data derived from ELF binaries, shared between processes.
+ *
+ * Each entry is a blob of client data keyed by the MetroHash128 of the ELF it was derived from plus a device key.  The
+ * cache is backed by two @ref MemMapFile containers:
+ * + An index file holding an open-addressing hash table of entry descriptors, sized for the maximum entry count given
+ *   at creation.  The entries are also linked into a least-recently used list.  The index is mapped once when the
+ *   cache is initialized.
+ * + A data file which entry contents are appended to.  When the space taken by evicted entries grows too large, the
+ *   live entries are packed together again.
+ *
+ * Any number of processes may open the same cache.  Load() holds a shared advisory lock on a third, empty lock file
+ * while it reads an entry, and Init() and Store() hold an exclusive lock, so readers never observe partially
+ * initialized, partially written or moved data.  Within a process, any number of threads may call Load() at once; only
+ * Store() and the occasional revalidation of the files are serialized.  Least-recently used entries are evicted when
+ * the cached data would exceed the size cap or the entry limit would be exceeded.  Loads don't reorder the LRU list
+ * directly; they queue the entries they hit, and the queue is applied the next time the exclusive lock is taken, so
+ * the LRU order is only approximate.
+ *
+ * Every change to the files bumps a generation counter in the index header.  Both file headers are validated (see
+ * @ref MemMapFile::ValidateStorage()) whenever the generation changes, and every entry records a checksum of its data,
+ * so a truncated or otherwise damaged cache produces misses rather than bad data.
+ ***********************************************************************************************************************
+ */
+class ElfCache
+{
+public:
+    ElfCache();
+    ~ElfCache();
+
+    /// Opens (or creates) the cache files.  Files left in an unusable state (e.g. by a crashed process or an older
+    /// version of PAL) are discarded.
+    ///
+    /// @param [in] createInfo Cache properties.
+    ///
+    /// @returns Success if the cache was opened, otherwise an appropriate error.  The cache may not be used if this
+    ///          fails.
+    Result Init(const ElfCacheCreateInfo& createInfo);
+
+    /// Computes the hash used to identify an ELF binary in an @ref ElfCacheKey.
+    ///
+    /// @param [in]  pElf     ELF binary.
+    /// @param [in]  elfSize  Size of the ELF binary in bytes.
+    /// @param [out] pHash    Receives the MetroHash128 of the binary.
+    static void ComputeElfHash(const void* pElf, size_t elfSize, MetroHash::Hash* pHash);
+
+    /// Looks up an entry and copies its data.
+    ///
+    /// @param [in]     key        Key of the entry to look up.
+    /// @param [out]    pData      Receives the entry's data.  May be null to query the size of the entry.
+    /// @param [in,out] pDataSize  Input: the size of pData in bytes.  Output: the size of the entry's data.
+    ///
+    /// @returns Success if the entry was found and copied, NotFound if the cache has no valid entry for this key, or
+    ///          ErrorInvalidMemorySize if pData is too small for the entry.
+    Result Load(const ElfCacheKey& key, void* pData, size_t* pDataSize);
+
+    /// Adds an entry to the cache, replacing any existing entry for the same key.
+    ///
+    /// @param [in] key       Key of the new entry.
+    /// @param [in] pData     Data to cache.
+    /// @param [in] dataSize  Size of pData in bytes.
+    ///
+    /// @returns Success if the entry was added, otherwise an appropriate error.
+    Result Store(const ElfCacheKey& key, const void* pData, size_t dataSize);
+
+    /// Reports this process' cache counters.
+    ///
+    /// @param [out] pStats Receives the current counters.
+    void GetStats(ElfCacheStats* pStats) const;
+
+private:
+    // Maximum length of the cache file paths.
+    static constexpr uint32 MaxFileNameLen    = 512;
+    // Number of LRU updates queued by Load() before they are applied to the index.
+    static constexpr uint32 PendingTouchCount = 64;
+
+    struct IndexHeader
+    {
+        uint32 magic;
+        uint32 version;
+        uint32 numSlots;
+        uint32 numEntries;
+        uint64 liveBytes;   // Total size of the data referenced by valid entries.
+        uint64 generation;  // Incremented each time the index or the data file is modified.
+        uint32 lruHead;     // Slot of the least-recently used entry, or InvalidSlot if the index is empty.
+        uint32 lruTail;     // Slot of the most-recently used entry, or InvalidSlot if the index is empty.
+        uint32 reserved[6];
+    };
+
+    struct IndexEntry
+    {
+        ElfCacheKey key;
+        uint64      dataOffset; // Offset of the entry's data in the data file.
+        uint64      checksum;   // MetroHash64 of the entry's data.
+        uint32      dataSize;
+        uint32      valid;      // Nonzero if this slot holds an entry.
+        uint32      lruPrev;    // Slot of the next less-recently used entry, or InvalidSlot.
+        uint32      lruNext;    // Slot of the next more-recently used entry, or InvalidSlot.
+        uint32      reserved[2];
+    };
+
+    Result OpenFile(MemMapFile* pFile, const char* pFileName, size_t minSize, bool allowGrowth);
+    Result ValidateFiles();
+    void   Revalidate();
+    bool   IndexIsValid() const;
+    void   ResetIndex();
+    Result LockShared();
+    void   UnlockShared();
+    bool   QueueTouch(const ElfCacheKey& key);
+    void   ApplyTouches();
+    void   FlushTouches();
+    uint32 HomeSlot(const ElfCacheKey& key) const;
+    bool   FindSlot(const ElfCacheKey& key, uint32* pSlot) const;
+    void   LinkMru(uint32 slot);
+    void   Unlink(uint32 slot);
+    void   EraseSlot(uint32 slot);
+    bool   EvictLru();
+    void   SiftDown(uint32* pOrder, uint32 root, uint32 heapSize) const;
+    void   SortByDataOffset(uint32* pOrder, uint32 count) const;
+    Result CompactData();
+
+    IndexHeader* IndexHdr() const
+        { return static_cast<IndexHeader*>(m_indexView.Ptr()); }
+    IndexEntry*  Entries() const
+        { return static_cast<IndexEntry*>(VoidPtrInc(m_indexView.Ptr(), sizeof(IndexHeader))); }
+    // Scratch space used to sort entries by data offset during compaction.  It follows the entries in the index file
+    // so that it's sized along with them; it holds no state between compactions.
+    uint32*      CompactOrder() const
+        { return static_cast<uint32*>(VoidPtrInc(Entries(), sizeof(IndexEntry) * m_numSlots)); }
+
+    char          m_indexFileName[MaxFileNameLen];
+    char          m_dataFileName[MaxFileNameLen];
+    char          m_lockFileName[MaxFileNameLen];
+    FileMapping   m_lockFile;        // Only used for its advisory lock, which serializes access between processes.
+    MemMapFile    m_indexFile;
+    MemMapFile    m_dataFile;
+    FileView      m_indexView;       // Persistent view of the index header, all index entries and the compaction
+                                     // scratch space.
+    uint64        m_maxDataSize;
+    uint32        m_maxEntries;
+    uint32        m_numSlots;        // Number of slots in the index hash table.  This is a power of two.
+    size_t        m_indexSize;       // Size of the index header, every index entry and the compaction scratch space.
+    RWLock        m_lock;            // Held shared by Load() and exclusively by everything which modifies this
+                                     // object's view of the files.
+    Mutex         m_fileReaderLock;  // Guards m_numFileReaders.
+    uint32        m_numFileReaders;  // Number of Load() calls in this process which hold the shared file lock.  The
+                                     // advisory lock belongs to the file descriptor, so only the last one releases it.
+    uint64        m_validGeneration; // Index generation the files were last validated at.
+    bool          m_indexValid;      // Whether the index was valid at m_validGeneration.
+    Mutex         m_touchLock;       // Guards the LRU update queue.
+    uint32        m_numPendingTouches;
+    ElfCacheKey   m_pendingTouches[PendingTouchCount];
+    ElfCacheStats m_stats;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(ElfCache);
+};
+
+} // Util
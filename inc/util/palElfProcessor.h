@@ -314,11 +314,25 @@ public:
     /// @param [in] index The index of the section.
     void SetIndex(uint32 index) { m_index = index; }
 
+    /// @internal Points the section at data owned by someone else (e.g. the buffer an ELF was loaded from) instead of
+    /// copying it.  The data is only copied if the section is modified later, so it must remain valid and unchanged
+    /// until then.
+    ///
+    /// @param [in] pData    Pointer to the data to reference.
+    /// @param [in] dataSize Size in bytes of the data being referenced.
+    void SetExternalData(const void* pData, size_t dataSize);
+
+    /// Returns true if the section references data owned by someone else rather than its own copy.
+    ///
+    /// @returns True if the section data was set by SetExternalData() and has not been modified since.
+    bool HasExternalData() const { return (m_pData != nullptr) && (m_ownsData == false); }
+
 private:
     uint32              m_index;
 
     const char*         m_pName;
     void*               m_pData;
+    bool                m_ownsData;     // False if m_pData points at external data which must not be freed.
 
     Section<Allocator>* m_pLinkSection;
     Section<Allocator>* m_pInfoSection;
@@ -870,15 +884,33 @@ public:
     /// @returns Success if successful, or ErrorOutOfMemory upon allocation failure.
     Result Init();
 
-    /// Load the ELF from a buffer.
+    /// Load the ELF from a buffer.  The names of non-standard sections reference the buffer, so it must outlive the
+    /// ElfProcessor if those sections are looked up by name after loading.
     ///
     /// @param [in] pBuffer    Pointer to the buffer to load from.
     /// @param [in] bufferSize Size of the buffer in bytes to load from.
     ///
-    /// @returns Success if successful, or ErrorOutOfMemory upon allocation failure.
-    Result LoadFromBuffer(const void* pBuffer, size_t bufferSize);
+    /// @returns Success if successful, ErrorInvalidValue if the buffer does not hold a valid ELF, or ErrorOutOfMemory
+    ///          upon allocation failure.
+    Result LoadFromBuffer(const void* pBuffer, size_t bufferSize)
+        { return LoadFromBufferInternal(pBuffer, bufferSize, true); }
+
+    /// Load the ELF from a buffer without copying any section data.  The section headers are indexed in place and
+    /// each section references its data in the buffer; a section's data is only copied if the section is modified.
+    /// This is the cheapest way to inspect an existing ELF, including one which is mapped from a file.
+    ///
+    /// @param [in] pBuffer    Pointer to the buffer to load from.  It must remain valid and unchanged for the lifetime
+    ///                        of this ElfProcessor.
+    /// @param [in] bufferSize Size of the buffer in bytes to load from.
+    ///
+    /// @returns Success if successful, ErrorInvalidValue if the buffer does not hold a valid ELF, or ErrorOutOfMemory
+    ///          upon allocation failure.
+    Result LoadFromBufferView(const void* pBuffer, size_t bufferSize)
+        { return LoadFromBufferInternal(pBuffer, bufferSize, false); }
 
 private:
+    Result LoadFromBufferInternal(const void* pBuffer, size_t bufferSize, bool copyData);
+
     FileHeader          m_fileHeader;
     Sections<Allocator> m_sections;
     Segments<Allocator> m_segments;
@@ -268,7 +268,9 @@ Section<Allocator>* Sections<Allocator>::Add(
             pSection = PAL_NEW(Section<Allocator>, m_pAllocator, AllocInternalTemp)(m_pAllocator);
             if (pSection != nullptr)
             {
-                const uint32 nameOffset = m_pStringProcessor->Add(pName);
+                // Sections loaded from an existing ELF already have their name in the loaded .shstrtab.
+                const uint32 nameOffset =
+                    (pSectionHdr == nullptr) ? m_pStringProcessor->Add(pName) : pSectionHdr->sh_name;
                 if (nameOffset == 0)
                 {
                     result = Result::ErrorOutOfMemory;
@@ -344,6 +346,7 @@ Section<Allocator>::Section(
     m_index(0),
     m_pName(nullptr),
     m_pData(nullptr),
+    m_ownsData(false),
     m_pLinkSection(nullptr),
     m_pInfoSection(nullptr),
     m_sectionHeader(),
@@ -355,7 +358,10 @@ Section<Allocator>::Section(
 template <typename Allocator>
 Section<Allocator>::~Section()
 {
-    PAL_SAFE_FREE(m_pData, m_pAllocator);
+    if (m_ownsData)
+    {
+        PAL_SAFE_FREE(m_pData, m_pAllocator);
+    }
 }
 
 // =====================================================================================================================
@@ -391,13 +397,16 @@ void* Section<Allocator>::SetData(
     void* pNewData = PAL_MALLOC(dataSize, m_pAllocator, AllocInternalTemp);
     if (pNewData != nullptr)
     {
-        if (m_pData != nullptr)
+        // Copy first: pData may point into our current data.
+        memcpy(pNewData, pData, dataSize);
+
+        if (m_ownsData)
         {
             PAL_SAFE_FREE(m_pData, m_pAllocator);
         }
 
-        memcpy(pNewData, pData, dataSize);
-        m_pData = pNewData;
+        m_pData    = pNewData;
+        m_ownsData = true;
         m_sectionHeader.sh_size = dataSize;
     }
     // NOTE: If memory allocation fails, no state will be changed, and nullptr is returned.
@@ -440,10 +449,15 @@ void* Section<Allocator>::AppendUninitializedData(
         if (m_pData != nullptr)
         {
             memcpy(pNewData, m_pData, GetDataSize());
-            PAL_SAFE_FREE(m_pData, m_pAllocator);
+
+            if (m_ownsData)
+            {
+                PAL_SAFE_FREE(m_pData, m_pAllocator);
+            }
         }
 
-        m_pData = pNewData;
+        m_pData    = pNewData;
+        m_ownsData = true;
         m_sectionHeader.sh_size = newDataSize;
     }
     // NOTE: If memory allocation fails, no state will be changed, and nullptr is returned.
@@ -451,6 +465,26 @@ void* Section<Allocator>::AppendUninitializedData(
     return pAppendData;
 }
 
+// =====================================================================================================================
+template <typename Allocator>
+void Section<Allocator>::SetExternalData(
+    const void* pData,
+    size_t      dataSize)
+{
+    PAL_ASSERT((pData != nullptr) || (dataSize == 0));
+
+    if (m_ownsData)
+    {
+        PAL_SAFE_FREE(m_pData, m_pAllocator);
+    }
+
+    // The data is never written through this pointer: every function which modifies the section data first makes a
+    // private copy because m_ownsData is false.
+    m_pData    = const_cast<void*>(pData);
+    m_ownsData = false;
+    m_sectionHeader.sh_size = dataSize;
+}
+
 // =====================================================================================================================
 template <typename Allocator>
 Segments<Allocator>::Segments(
@@ -1272,19 +1306,52 @@ void ElfProcessor<Allocator>::SaveToBuffer(
 
 // =====================================================================================================================
 template <typename Allocator>
-Result ElfProcessor<Allocator>::LoadFromBuffer(
+Result ElfProcessor<Allocator>::LoadFromBufferInternal(
     const void*  pBuffer,
-    size_t       bufferSize)
+    size_t       bufferSize,
+    bool         copyData)   // If false, sections reference their data in pBuffer instead of copying it.
 {
     const void* pBufferStart = pBuffer;
     PAL_ASSERT(bufferSize >= FileHeaderSize);
 
-    Result result = m_sections.Init();
+    Result result = (bufferSize >= FileHeaderSize) ? m_sections.Init() : Result::ErrorInvalidValue;
     if (result == Result::Success)
     {
         // Read in the ELF FileHeader
         memcpy(&m_fileHeader, pBufferStart, FileHeaderSize);
 
+        // Make sure every header and all section data lies within the buffer before touching any of it.
+        if ((m_fileHeader.e_shnum > 0) &&
+            ((m_fileHeader.e_shoff > bufferSize) ||
+             (((bufferSize - m_fileHeader.e_shoff) / SectionHeaderSize) < m_fileHeader.e_shnum)))
+        {
+            result = Result::ErrorInvalidValue;
+        }
+        else if ((m_fileHeader.e_phnum > 0) &&
+                 ((m_fileHeader.e_phoff > bufferSize) ||
+                  (((bufferSize - m_fileHeader.e_phoff) / ProgramHeaderSize) < m_fileHeader.e_phnum)))
+        {
+            result = Result::ErrorInvalidValue;
+        }
+        else
+        {
+            const SectionHeader* pSectionHdrs =
+                static_cast<const SectionHeader*>(VoidPtrInc(pBufferStart, static_cast<size_t>(m_fileHeader.e_shoff)));
+
+            for (uint32 i = 1; i < m_fileHeader.e_shnum; i++)
+            {
+                if ((pSectionHdrs[i].sh_offset > bufferSize) ||
+                    (pSectionHdrs[i].sh_size > (bufferSize - pSectionHdrs[i].sh_offset)))
+                {
+                    result = Result::ErrorInvalidValue;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (result == Result::Success)
+    {
         // Skip the program headers and go straight to the section headers.
         // Once the sections are created we can determine the segment section mappings.
         if (m_fileHeader.e_shnum > 0)
@@ -1336,11 +1403,17 @@ Result ElfProcessor<Allocator>::LoadFromBuffer(
                 pSection->SetOffset(static_cast<size_t>(pSectionHdrReader->sh_offset));
 
                 const void* pData = VoidPtrInc(pBufferStart, static_cast<size_t>(pSectionHdrReader->sh_offset));
-                if ((pSectionHdrReader->sh_size != 0) &&
-                    (pSection->SetData(pData, static_cast<size_t>(pSectionHdrReader->sh_size)) == nullptr))
+                if (pSectionHdrReader->sh_size != 0)
                 {
-                    result = Result::ErrorOutOfMemory;
-                    break;
+                    if (copyData == false)
+                    {
+                        pSection->SetExternalData(pData, static_cast<size_t>(pSectionHdrReader->sh_size));
+                    }
+                    else if (pSection->SetData(pData, static_cast<size_t>(pSectionHdrReader->sh_size)) == nullptr)
+                    {
+                        result = Result::ErrorOutOfMemory;
+                        break;
+                    }
                 }
 
                 pSectionHdrReader++;
@@ -99,6 +99,17 @@ public:
     /// @returns Success if the flush completes successfully.
     bool Flush();
 
+    /// Acquires an advisory lock on the mapped file. The lock is honored by every process which maps the same file
+    /// through a FileMapping, but it does not serialize threads which share a single FileMapping object.
+    ///
+    /// @param  exclusive  True to acquire an exclusive (writer) lock, false to acquire a shared (reader) lock.
+    ///
+    /// @returns Success if the lock was acquired.
+    Result Lock(bool exclusive);
+
+    /// Releases a lock acquired by @ref Lock().
+    void Unlock();
+
 private:
     int         m_fileHandle;       ///< File descriptor of the file that is opened for mapping
     bool        m_writeable;        ///< Flag that indicates if this mapping is writeable
@@ -0,0 +1,327 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palFlatHashBase.h
+ * @brief PAL utility collection shared structures and class declarations used by the FlatHashMap and FlatHashSet
+ *        containers.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palHashBase.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define PAL_FLAT_HASH_SSE2 1
+#include <emmintrin.h>
+#else
+#define PAL_FLAT_HASH_SSE2 0
+#endif
+
+namespace Util
+{
+
+// Control byte values.  A control byte is kept for every slot in a flat hash container; full slots store the low 7 bits
+// of the key's hash (so their control byte is never negative) and all other states are negative.
+constexpr int8 FlatHashCtrlEmpty    = -128;  ///< Slot has never held an entry since the last rehash.
+constexpr int8 FlatHashCtrlDeleted  = -2;    ///< Slot held an entry which has been erased (tombstone).
+constexpr int8 FlatHashCtrlSentinel = -1;    ///< Largest non-full control value; used for masking.
+
+/**
+ ***********************************************************************************************************************
+ * @brief  A window of control bytes which are probed together.
+ *
+ * Each query returns a bit-mask with one bit per control byte in the window; bit i is set if control byte i matches.
+ * On SSE2-capable CPUs the whole window is compared with a single instruction.
+ ***********************************************************************************************************************
+ */
+class FlatHashGroup
+{
+public:
+    /// Number of control bytes in one group.
+    static constexpr uint32 Width = 16;
+
+    /// Loads a group of control bytes.  pCtrl need not be aligned.
+    explicit FlatHashGroup(const int8* pCtrl)
+    {
+#if PAL_FLAT_HASH_SSE2
+        m_ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pCtrl));
+#else
+        memcpy(&m_ctrl[0], pCtrl, Width);
+#endif
+    }
+
+    /// Returns a mask of the full slots whose control byte matches the given 7-bit hash.
+    uint32 Match(int8 hash) const
+    {
+#if PAL_FLAT_HASH_SSE2
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hash), m_ctrl)));
+#else
+        uint32 mask = 0;
+        for (uint32 i = 0; i < Width; ++i)
+        {
+            mask |= (m_ctrl[i] == hash) ? (1u << i) : 0u;
+        }
+        return mask;
+#endif
+    }
+
+    /// Returns a mask of the empty slots.
+    uint32 MatchEmpty() const { return Match(FlatHashCtrlEmpty); }
+
+    /// Returns a mask of the slots which are either empty or deleted.
+    uint32 MatchEmptyOrDeleted() const
+    {
+#if PAL_FLAT_HASH_SSE2
+        return static_cast<uint32>(
+            _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(FlatHashCtrlSentinel), m_ctrl)));
+#else
+        uint32 mask = 0;
+        for (uint32 i = 0; i < Width; ++i)
+        {
+            mask |= (m_ctrl[i] < FlatHashCtrlSentinel) ? (1u << i) : 0u;
+        }
+        return mask;
+#endif
+    }
+
+private:
+#if PAL_FLAT_HASH_SSE2
+    __m128i m_ctrl;
+#else
+    int8    m_ctrl[Width];
+#endif
+};
+
+// Forward declarations.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc> class FlatHashBase;
+
+/**
+ ***********************************************************************************************************************
+ * @brief  Iterator for traversal of elements in a flat hash container.
+ *
+ * Entries are visited in slot order.  Backward iterating is not supported.
+ ***********************************************************************************************************************
+ */
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+class FlatHashIterator
+{
+public:
+    /// Convenience typedef for the associated container for this templated iterator.
+    typedef FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc> Container;
+
+    ~FlatHashIterator() { }
+
+    /// Returns a pointer to current entry.  Will return null if the iterator has been advanced off the end of the
+    /// container.
+    Entry* Get() const { return m_pCurrentEntry; }
+
+    /// Advances the iterator to the next position (move forward).
+    void Next();
+
+private:
+    FlatHashIterator(const Container* pContainer, uint32 startSlot);
+
+    // Moves forward from m_currentSlot (inclusive) to the next full slot.
+    void SkipToFull();
+
+    const Container* const m_pContainer;     // Hash container that we're iterating over.
+    uint32                 m_currentSlot;    // Current slot we're at now.
+    Entry*                 m_pCurrentEntry;  // Entry in the current slot, or null at the end.
+
+    PAL_DISALLOW_DEFAULT_CTOR(FlatHashIterator);
+
+    // Although this is a transgression of coding standards, it means that Container does not need to have a public
+    // interface specifically to implement this class. The added encapsulation this provides is worthwhile.
+    friend class FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>;
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief Templated base class for FlatHashMap and FlatHashSet, supporting the ability to store, find, and remove
+ *        entries.
+ *
+ * This is an open-addressing alternative to @ref HashBase.  All entries live in a single flat slot array, and a
+ * parallel array of one-byte control values records whether each slot is empty, deleted or full.  A full slot's control
+ * byte holds 7 bits of the key's hash, so a lookup compares a whole @ref FlatHashGroup of control bytes at once and
+ * only calls EqualFunc on the (rarely more than one) slot whose hash bits match.  Probing moves group by group using
+ * triangular steps, which visits every group exactly once for power-of-two capacities.
+ *
+ * Erased slots become tombstones unless no probe sequence can have passed through them.  When the table runs out of
+ * empty slots it either rehashes in place (if tombstones account for the shortfall) or doubles its capacity.  The
+ * maximum load factor is 7/8.
+ *
+ * The same restrictions as @ref HashBase apply: keys and entries must be POD-style types, because they are moved with
+ * memcpy when the table is rehashed.
+ *
+ * @warning Unlike @ref HashBase, growing the table moves every entry.  Pointers returned by FindAllocate or FindKey are
+ *          invalidated by any later call which inserts an entry.
+ ***********************************************************************************************************************
+ */
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+class FlatHashBase
+{
+public:
+    /// Convenience typedef for iterators of this templated FlatHashBase.
+    typedef FlatHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc> Iterator;
+
+    /// Initializes the hash container.
+    ///
+    /// @returns @ref Success if the initialization completed successfully, or ErrorOutOfMemory if the operation failed
+    ///          due to an internal failure to allocate system memory.
+    Result Init();
+
+    /// Returns number of entries in the container.
+    uint32 GetNumEntries() const { return m_numEntries; }
+
+    /// Returns an iterator pointing to the first entry.
+    Iterator Begin() const;
+
+    /// Empty the hash container.  The slot array keeps its current capacity.
+    void Reset();
+
+protected:
+    /// @internal Constructor
+    ///
+    /// @param [in] numSlots   Initial number of slots in the table; padded to a power of two no smaller than one
+    ///                        @ref FlatHashGroup.  The table grows automatically as entries are added.
+    /// @param [in] pAllocator The allocator that will allocate memory if required.
+    explicit FlatHashBase(uint32 numSlots, Allocator*const pAllocator);
+    virtual ~FlatHashBase() { PAL_SAFE_FREE(m_pMemory, m_pAllocator); }
+
+    /// @internal Returns the slot index holding the specified key, or InvalidSlot if it isn't present.
+    uint32 FindSlot(const Key& key) const;
+
+    /// @internal Returns the slot index holding the specified key, allocating (and zeroing) a slot for it if the key
+    /// isn't present.
+    ///
+    /// @param [in]  key      Key to search for.
+    /// @param [out] pExisted True if the key was already present.
+    /// @param [out] pSlot    Slot index for the key.
+    ///
+    /// @returns @ref Success, or @ref ErrorOutOfMemory if the table needed to grow and the allocation failed.
+    Result FindAllocateSlot(const Key& key, bool* pExisted, uint32* pSlot);
+
+    /// @internal Removes the entry in the given (full) slot.
+    void EraseSlot(uint32 slot);
+
+    /// @internal Returns the entry stored in the given slot.
+    Entry* GetSlot(uint32 slot) const { return &m_pSlots[slot]; }
+
+    /// @internal Returned by FindSlot when the key isn't present.
+    static constexpr uint32 InvalidSlot = UINT32_MAX;
+
+    const HashFunc   m_hashFunc;    ///< @internal Hash functor object.
+    const EqualFunc  m_equalFunc;   ///< @internal Key compare function object.
+    Allocator*const  m_pAllocator;  ///< @internal Allocator for the slot and control arrays.
+
+private:
+    // Returns the mixed 32-bit hash of a key.  Client hash functors (e.g., DefaultHashFunc) don't necessarily spread
+    // their entropy across all bits, so the result is passed through a finalizer before being split into H1 and H2.
+    uint32 Hash(const Key& key) const;
+
+    // Returns the slot holding the specified key with the given (mixed) hash, or InvalidSlot if it isn't present.
+    uint32 FindSlotWithHash(const Key& key, uint32 hash) const;
+
+    // H1 selects the first group to probe and H2 is the 7-bit tag stored in the control byte.
+    static uint32 H1(uint32 hash) { return (hash >> 7); }
+    static int8   H2(uint32 hash) { return static_cast<int8>(hash & 0x7F); }
+
+    // Writes a control byte, mirroring it into the cloned tail so groups which straddle the end of the table can be
+    // loaded with a single unaligned read.
+    void SetCtrl(uint32 slot, int8 value);
+
+    // Returns the first empty or deleted slot in the probe sequence for the given hash.
+    uint32 FindFirstNonFull(uint32 hash) const;
+
+    // Called when no empty slots remain.  Either removes tombstones in place or doubles the table's capacity.
+    Result RehashAndGrowIfNecessary();
+
+    // Reallocates the table with the given capacity and reinserts every entry.
+    Result Resize(uint32 newCapacity);
+
+    // Rehashes every entry without changing the capacity, turning all tombstones back into empty slots.
+    void DropDeletesWithoutResize();
+
+    // Returns the number of entries which can be stored in a table of the given capacity.
+    static uint32 CapacityToGrowth(uint32 capacity) { return capacity - (capacity / 8); }
+
+    // Returns the size in bytes of the control array (including the cloned tail) padded for slot alignment.
+    static size_t CtrlBytes(uint32 capacity)
+        { return Pow2Align(static_cast<size_t>(capacity) + FlatHashGroup::Width, alignof(Entry)); }
+
+    uint32  m_capacity;     // Number of slots; always a power of two.
+    uint32  m_numEntries;   // Number of full slots.
+    uint32  m_numDeleted;   // Number of tombstones.
+    uint32  m_growthLeft;   // Number of empty slots which may still be filled before a rehash is required.
+    void*   m_pMemory;      // Single allocation holding the control array followed by the slot array.
+    int8*   m_pCtrl;        // Control bytes; (m_capacity + FlatHashGroup::Width) of them.
+    Entry*  m_pSlots;       // Slot array.
+
+    PAL_DISALLOW_DEFAULT_CTOR(FlatHashBase);
+    PAL_DISALLOW_COPY_AND_ASSIGN(FlatHashBase);
+
+    // Although this is a transgression of coding standards, it prevents FlatHashIterator requiring a public
+    // constructor.
+    friend class FlatHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc>;
+};
+
+// =====================================================================================================================
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::FlatHashBase(
+    uint32          numSlots,
+    Allocator*const pAllocator)
+    :
+    m_hashFunc(),
+    m_equalFunc(),
+    m_pAllocator(pAllocator),
+    m_capacity(Pow2Pad(Max(numSlots, FlatHashGroup::Width))),
+    m_numEntries(0),
+    m_numDeleted(0),
+    m_growthLeft(0),
+    m_pMemory(nullptr),
+    m_pCtrl(nullptr),
+    m_pSlots(nullptr)
+{
+}
+
+} // Util
@@ -0,0 +1,540 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palFlatHashBaseImpl.h
+ * @brief PAL utility collection FlatHashBase and FlatHashIterator class implementations.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palFlatHashBase.h"
+#include "palHashBaseImpl.h"
+
+namespace Util
+{
+
+// =====================================================================================================================
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE FlatHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc>::FlatHashIterator(
+    const Container*  pContainer,  ///< [retained] The hash container to iterate over
+    uint32            startSlot)   ///< The slot to begin searching from
+    :
+    m_pContainer(pContainer),
+    m_currentSlot(startSlot),
+    m_pCurrentEntry(nullptr)
+{
+    SkipToFull();
+}
+
+// =====================================================================================================================
+// Moves forward from the current slot (inclusive) to the next full slot, or off the end of the container.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE void FlatHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc>::SkipToFull()
+{
+    m_pCurrentEntry = nullptr;
+
+    if (m_pContainer->m_pCtrl != nullptr)
+    {
+        for (; m_currentSlot < m_pContainer->m_capacity; ++m_currentSlot)
+        {
+            if (m_pContainer->m_pCtrl[m_currentSlot] >= 0)
+            {
+                m_pCurrentEntry = m_pContainer->GetSlot(m_currentSlot);
+                break;
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Proceeds to the next entry, null if to the end.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE void FlatHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc>::Next()
+{
+    if (m_pCurrentEntry != nullptr)
+    {
+        m_currentSlot++;
+        SkipToFull();
+    }
+}
+
+// =====================================================================================================================
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE Result FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::Init()
+{
+    return Resize(m_capacity);
+}
+
+// =====================================================================================================================
+// Returns an iterator pointing to the first entry.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+FlatHashIterator<Key, Entry, Allocator, HashFunc, EqualFunc>
+PAL_INLINE FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::Begin() const
+{
+    // Start off the end of the table if there is nothing to visit.
+    return Iterator(this, (m_numEntries != 0) ? 0 : m_capacity);
+}
+
+// =====================================================================================================================
+// Empty the hash table.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE void FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::Reset()
+{
+    if (m_pCtrl != nullptr)
+    {
+        memset(m_pCtrl, FlatHashCtrlEmpty, m_capacity + FlatHashGroup::Width);
+        m_growthLeft = CapacityToGrowth(m_capacity);
+    }
+
+    m_numEntries = 0;
+    m_numDeleted = 0;
+}
+
+// =====================================================================================================================
+// Returns the mixed hash of a key.  This is the MurmurHash3 32-bit finalizer, which spreads every input bit across the
+// whole result so that both H1 and H2 are usable even with weak hash functors like DefaultHashFunc.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE uint32 FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::Hash(
+    const Key& key
+    ) const
+{
+    uint32 hash = m_hashFunc(&key, sizeof(key));
+
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6B;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+// =====================================================================================================================
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE void FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::SetCtrl(
+    uint32 slot,
+    int8   value)
+{
+    m_pCtrl[slot] = value;
+
+    // The first (Width - 1) control bytes are duplicated after the end of the table.
+    if (slot < (FlatHashGroup::Width - 1))
+    {
+        m_pCtrl[m_capacity + slot] = value;
+    }
+}
+
+// =====================================================================================================================
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE uint32 FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::FindFirstNonFull(
+    uint32 hash
+    ) const
+{
+    const uint32 mask = m_capacity - 1;
+    uint32       pos  = H1(hash) & mask;
+    uint32       step = 0;
+    uint32       slot = InvalidSlot;
+
+    // The load factor guarantees at least one non-full slot so this always terminates.
+    while (slot == InvalidSlot)
+    {
+        const uint32 matches = FlatHashGroup(&m_pCtrl[pos]).MatchEmptyOrDeleted();
+
+        uint32 index = 0;
+        if (BitMaskScanForward(&index, matches))
+        {
+            slot = (pos + index) & mask;
+        }
+        else
+        {
+            step += FlatHashGroup::Width;
+            pos   = (pos + step) & mask;
+        }
+    }
+
+    return slot;
+}
+
+// =====================================================================================================================
+// Returns the slot holding the specified key, or InvalidSlot if the key isn't present.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE uint32 FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::FindSlot(
+    const Key& key
+    ) const
+{
+    return FindSlotWithHash(key, Hash(key));
+}
+
+// =====================================================================================================================
+// Probes for the specified key, returning InvalidSlot if it isn't present.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE uint32 FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::FindSlotWithHash(
+    const Key& key,
+    uint32     hash
+    ) const
+{
+    PAL_ASSERT(m_pCtrl != nullptr);
+
+    const int8   h2    = H2(hash);
+    const uint32 mask  = m_capacity - 1;
+    uint32       pos   = H1(hash) & mask;
+    uint32       step  = 0;
+    uint32       found = InvalidSlot;
+
+    for (uint32 probes = 0; probes <= mask; probes += FlatHashGroup::Width)
+    {
+        const FlatHashGroup group(&m_pCtrl[pos]);
+
+        uint32 matches = group.Match(h2);
+        uint32 index   = 0;
+
+        while (BitMaskScanForward(&index, matches))
+        {
+            const uint32 slot = (pos + index) & mask;
+
+            if (m_equalFunc(m_pSlots[slot].key, key))
+            {
+                found = slot;
+                break;
+            }
+
+            matches &= (matches - 1);
+        }
+
+        // An empty slot terminates every probe sequence which passed through this group, so the key can't be further
+        // along.
+        if ((found != InvalidSlot) || (group.MatchEmpty() != 0))
+        {
+            break;
+        }
+
+        step += FlatHashGroup::Width;
+        pos   = (pos + step) & mask;
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Returns the slot holding the specified key.  If the key isn't present, a zeroed slot is allocated for it.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE Result FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::FindAllocateSlot(
+    const Key& key,       // Key to search for.
+    bool*      pExisted,  // [out] True if a matching key was found.
+    uint32*    pSlot)     // [out] Slot for the specified key.
+{
+    PAL_ASSERT(pExisted != nullptr);
+    PAL_ASSERT(pSlot != nullptr);
+
+    const uint32 hash = Hash(key);
+
+    Result result = Result::Success;
+    uint32 slot   = FindSlotWithHash(key, hash);
+
+    *pExisted = (slot != InvalidSlot);
+
+    if (slot == InvalidSlot)
+    {
+        slot = FindFirstNonFull(hash);
+
+        // Reusing a tombstone doesn't consume any growth; only claiming an empty slot does.
+        if ((m_growthLeft == 0) && (m_pCtrl[slot] != FlatHashCtrlDeleted))
+        {
+            result = RehashAndGrowIfNecessary();
+
+            if (result == Result::Success)
+            {
+                slot = FindFirstNonFull(hash);
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            if (m_pCtrl[slot] == FlatHashCtrlEmpty)
+            {
+                m_growthLeft--;
+            }
+            else
+            {
+                m_numDeleted--;
+            }
+
+            SetCtrl(slot, H2(hash));
+            m_numEntries++;
+
+            // Match HashMap, which always hands out zeroed entries.
+            memset(&m_pSlots[slot], 0, sizeof(Entry));
+            m_pSlots[slot].key = key;
+        }
+    }
+
+    *pSlot = (result == Result::Success) ? slot : InvalidSlot;
+
+    PAL_ASSERT(result == Result::Success);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Removes the entry in the given slot.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE void FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::EraseSlot(
+    uint32 slot)
+{
+    PAL_ASSERT((slot < m_capacity) && (m_pCtrl[slot] >= 0));
+
+    const uint32 mask        = m_capacity - 1;
+    const uint32 slotBefore  = (slot - FlatHashGroup::Width) & mask;
+    const uint32 emptyAfter  = FlatHashGroup(&m_pCtrl[slot]).MatchEmpty();
+    const uint32 emptyBefore = FlatHashGroup(&m_pCtrl[slotBefore]).MatchEmpty();
+
+    // If every window of Width slots containing this one also contains an empty slot, no probe sequence can ever have
+    // moved past this slot and it can be marked empty directly.  Otherwise a tombstone must be left behind.
+    bool wasNeverFull = false;
+
+    uint32 firstEmptyAfter = 0;
+    uint32 lastEmptyBefore = 0;
+    if (BitMaskScanForward(&firstEmptyAfter, emptyAfter) && BitMaskScanReverse(&lastEmptyBefore, emptyBefore))
+    {
+        wasNeverFull = ((firstEmptyAfter + (FlatHashGroup::Width - 1 - lastEmptyBefore)) < FlatHashGroup::Width);
+    }
+
+    if (wasNeverFull)
+    {
+        SetCtrl(slot, FlatHashCtrlEmpty);
+        m_growthLeft++;
+    }
+    else
+    {
+        SetCtrl(slot, FlatHashCtrlDeleted);
+        m_numDeleted++;
+    }
+
+    PAL_ASSERT(m_numEntries > 0);
+    m_numEntries--;
+}
+
+// =====================================================================================================================
+// Called when an insertion needs an empty slot and none remain.  If enough of the table is tombstones, reclaim them by
+// rehashing in place; otherwise double the capacity.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE Result FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::RehashAndGrowIfNecessary()
+{
+    Result result = Result::Success;
+
+    // An in-place rehash is only worthwhile if it frees a meaningful amount of space.  Rehashing at loads up to 25/32
+    // leaves at least 3/32 of the table free afterwards, which keeps the amortized cost of insertion constant.
+    if ((m_capacity > FlatHashGroup::Width) &&
+        ((static_cast<uint64>(m_numEntries) * 32) <= (static_cast<uint64>(m_capacity) * 25)))
+    {
+        DropDeletesWithoutResize();
+    }
+    else
+    {
+        result = Resize(m_capacity * 2);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Reallocates the table with the given capacity and reinserts every entry.  On failure the table is left unchanged.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE Result FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::Resize(
+    uint32 newCapacity)
+{
+    PAL_ASSERT(IsPowerOfTwo(newCapacity) && (newCapacity >= FlatHashGroup::Width));
+
+    const size_t ctrlBytes = CtrlBytes(newCapacity);
+    void*const   pMemory   = PAL_MALLOC(ctrlBytes + (sizeof(Entry) * newCapacity), m_pAllocator, AllocInternal);
+
+    Result result = Result::ErrorOutOfMemory;
+
+    if (pMemory != nullptr)
+    {
+        void*const   pOldMemory   = m_pMemory;
+        const int8*  pOldCtrl     = m_pCtrl;
+        const Entry* pOldSlots    = m_pSlots;
+        const uint32 oldCapacity  = m_capacity;
+
+        m_pMemory    = pMemory;
+        m_pCtrl      = static_cast<int8*>(pMemory);
+        m_pSlots     = static_cast<Entry*>(VoidPtrInc(pMemory, ctrlBytes));
+        m_capacity   = newCapacity;
+        m_numDeleted = 0;
+        m_growthLeft = CapacityToGrowth(newCapacity) - m_numEntries;
+
+        memset(m_pCtrl, FlatHashCtrlEmpty, newCapacity + FlatHashGroup::Width);
+
+        if (pOldCtrl != nullptr)
+        {
+            for (uint32 i = 0; i < oldCapacity; ++i)
+            {
+                if (pOldCtrl[i] >= 0)
+                {
+                    const uint32 hash = Hash(pOldSlots[i].key);
+                    const uint32 slot = FindFirstNonFull(hash);
+
+                    SetCtrl(slot, H2(hash));
+                    memcpy(&m_pSlots[slot], &pOldSlots[i], sizeof(Entry));
+                }
+            }
+
+            PAL_FREE(pOldMemory, m_pAllocator);
+        }
+
+        result = Result::Success;
+    }
+
+    PAL_ALERT(result != Result::Success);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Rehashes every entry in place.  This is the classic algorithm for open-addressing tables with tombstones: first mark
+// every full slot as deleted and every tombstone as empty, then walk the table moving each "deleted" (i.e., not yet
+// placed) entry to the first non-full slot in its probe sequence, swapping with any unplaced entry found there.
+template<typename Key,
+         typename Entry,
+         typename Allocator,
+         typename HashFunc,
+         typename EqualFunc>
+PAL_INLINE void FlatHashBase<Key, Entry, Allocator, HashFunc, EqualFunc>::DropDeletesWithoutResize()
+{
+    const uint32 mask = m_capacity - 1;
+
+    for (uint32 i = 0; i < m_capacity; ++i)
+    {
+        m_pCtrl[i] = (m_pCtrl[i] >= 0) ? FlatHashCtrlDeleted : FlatHashCtrlEmpty;
+    }
+    memcpy(&m_pCtrl[m_capacity], &m_pCtrl[0], FlatHashGroup::Width - 1);
+
+    for (uint32 i = 0; i < m_capacity; )
+    {
+        if (m_pCtrl[i] != FlatHashCtrlDeleted)
+        {
+            ++i;
+            continue;
+        }
+
+        const uint32 hash       = Hash(m_pSlots[i].key);
+        const uint32 target     = FindFirstNonFull(hash);
+        const uint32 probeStart = H1(hash) & mask;
+
+        if ((((target - probeStart) & mask) / FlatHashGroup::Width) ==
+            (((i - probeStart) & mask) / FlatHashGroup::Width))
+        {
+            // The entry is already in the best group it can occupy, so leave it where it is.
+            SetCtrl(i, H2(hash));
+            ++i;
+        }
+        else if (m_pCtrl[target] == FlatHashCtrlEmpty)
+        {
+            SetCtrl(target, H2(hash));
+            memcpy(&m_pSlots[target], &m_pSlots[i], sizeof(Entry));
+            SetCtrl(i, FlatHashCtrlEmpty);
+            ++i;
+        }
+        else
+        {
+            // The target holds another entry which hasn't been placed yet.  Swap the two and process slot i again.
+            PAL_ASSERT(m_pCtrl[target] == FlatHashCtrlDeleted);
+            SetCtrl(target, H2(hash));
+
+            Entry tmp;
+            memcpy(&tmp,               &m_pSlots[i],      sizeof(Entry));
+            memcpy(&m_pSlots[i],      &m_pSlots[target], sizeof(Entry));
+            memcpy(&m_pSlots[target], &tmp,              sizeof(Entry));
+        }
+    }
+
+    m_numDeleted = 0;
+    m_growthLeft = CapacityToGrowth(m_capacity) - m_numEntries;
+}
+
+} // Util
@@ -0,0 +1,124 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palFlatHashMap.h
+ * @brief PAL utility collection FlatHashMap class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palFlatHashBase.h"
+#include "palHashMap.h"
+
+namespace Util
+{
+
+/**
+ ***********************************************************************************************************************
+ * @brief Templated open-addressing hash map container.
+ *
+ * This is a drop-in alternative to @ref HashMap which exposes the same interface, so a call site can switch between
+ * the two by changing a typedef.  It is a better choice for large or lookup-heavy maps: a lookup loads one group of
+ * control bytes and usually performs a single key comparison, and the container grows automatically instead of
+ * chaining ever longer bucket lists.  The cost is that entries move when the table grows, so value pointers are not
+ * stable across insertions.
+ *
+ * HashFunc and EqualFunc accept the same functors as @ref HashMap.  The hash value is remixed internally, so
+ * DefaultHashFunc remains a good choice for pointer keys.
+ *
+ * @warning This class is not thread-safe for Insert, FindAllocate, Erase, or iteration!
+ * @warning Init() must be called before using this container. Begin() and Reset() can be safely called before
+ *          initialization and Begin() will always return an iterator that points to null.
+ *
+ * For more details please refer to @ref FlatHashBase.
+ ***********************************************************************************************************************
+ */
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc  = DefaultHashFunc,
+         template<typename> class EqualFunc = DefaultEqualFunc>
+class FlatHashMap : public FlatHashBase<Key, HashMapEntry<Key, Value>, Allocator, HashFunc<Key>, EqualFunc<Key>>
+{
+public:
+    /// Convenience typedef for a templated entry of this hash map.
+    typedef HashMapEntry<Key, Value> Entry;
+
+    /// @internal Constructor
+    ///
+    /// @param [in] numSlots   Initial number of slots in the table.  The table grows as needed, so this is only a hint.
+    /// @param [in] pAllocator Pointer to an allocator that will create system memory requested by this hash container.
+    explicit FlatHashMap(uint32 numSlots, Allocator*const pAllocator) : Base::FlatHashBase(numSlots, pAllocator) { }
+    virtual ~FlatHashMap() { }
+
+    /// Finds a given entry; if no entry was found, allocate it.
+    ///
+    /// @param [in]  key      Key to search for.
+    /// @param [out] pExisted True if an entry for the specified key existed before this call was made.  False indicates
+    ///                       that a new entry was allocated as a result of this call.
+    /// @param [out] ppValue  Readable/writeable value in the hash map corresponding to the specified key.
+    ///
+    /// @returns @ref Success if the operation completed successfully, or @ref ErrorOutOfMemory if the operation failed
+    ///          because an internal memory allocation failed.
+    Result FindAllocate(const Key& key, bool* pExisted, Value** ppValue);
+
+    /// Gets a pointer to the value that matches the specified key.
+    ///
+    /// @param [in] key Key to search for.
+    ///
+    /// @returns A pointer to the value that matches the specified key or null if an entry for the key does not exist.
+    Value* FindKey(const Key& key) const;
+
+    /// Inserts a key/value pair entry if the key doesn't already exist in the hash map.
+    ///
+    /// @warning No action will be taken if an entry matching this key already exists, even if the specified value
+    ///          differs from the current value stored in the entry matching the specified key.
+    ///
+    /// @param [in] key   Key of the new entry to insert.
+    /// @param [in] value Value of the new entry to insert.
+    ///
+    /// @returns @ref Success if the operation completed successfully, or @ref ErrorOutOfMemory if the operation failed
+    ///          because an internal memory allocation failed.
+    Result Insert(const Key& key, const Value& value);
+
+    /// Removes an entry that matches the specified key.
+    ///
+    /// @param [in] key Key of the entry to erase.
+    ///
+    /// @returns True if the erase completed successfully, false if an entry for this key did not exist.
+    bool Erase(const Key& key);
+
+private:
+    // Typedef for the specialized 'FlatHashBase' object we're inheriting from so we can use properly qualified names
+    // when accessing members of FlatHashBase.
+    typedef FlatHashBase<Key, HashMapEntry<Key, Value>, Allocator, HashFunc<Key>, EqualFunc<Key>> Base;
+
+    PAL_DISALLOW_DEFAULT_CTOR(FlatHashMap);
+    PAL_DISALLOW_COPY_AND_ASSIGN(FlatHashMap);
+};
+
+} // Util
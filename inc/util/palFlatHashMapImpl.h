@@ -0,0 +1,126 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palFlatHashMapImpl.h
+ * @brief PAL utility collection FlatHashMap class implementation.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palFlatHashBaseImpl.h"
+#include "palFlatHashMap.h"
+
+namespace Util
+{
+
+// =====================================================================================================================
+// Gets a pointer to the value that matches the key.  If the key is not present, a pointer to empty space for the value
+// is returned.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE Result FlatHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::FindAllocate(
+    const Key& key,       // Key to search for.
+    bool*      pExisted,  // [out] True if a matching key was found.
+    Value**    ppValue)   // [out] Pointer to the value entry of the hash map's entry for the specified key.
+{
+    PAL_ASSERT(ppValue != nullptr);
+
+    uint32       slot   = Base::InvalidSlot;
+    const Result result = this->FindAllocateSlot(key, pExisted, &slot);
+
+    *ppValue = (result == Result::Success) ? &(this->GetSlot(slot)->value) : nullptr;
+
+    return result;
+}
+
+// =====================================================================================================================
+// Gets a pointer to the value that matches the key.  Returns null if no entry is present matching the specified key.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE Value* FlatHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::FindKey(
+    const Key& key
+    ) const
+{
+    const uint32 slot = this->FindSlot(key);
+
+    return (slot != Base::InvalidSlot) ? &(this->GetSlot(slot)->value) : nullptr;
+}
+
+// =====================================================================================================================
+// Inserts a key/value pair entry if it doesn't already exist.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE Result FlatHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::Insert(
+    const Key&   key,
+    const Value& value)
+{
+    bool   existed = true;
+    Value* pValue  = nullptr;
+
+    Result result = FindAllocate(key, &existed, &pValue);
+
+    // Add the new value if it did not exist already. If FindAllocate returns Success, pValue != nullptr.
+    if ((result == Result::Success) && (existed == false))
+    {
+        *pValue = value;
+    }
+
+    PAL_ASSERT(result == Result::Success);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Removes an entry with the specified key.
+template<typename Key,
+         typename Value,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE bool FlatHashMap<Key, Value, Allocator, HashFunc, EqualFunc>::Erase(
+    const Key& key)
+{
+    const uint32 slot = this->FindSlot(key);
+
+    if (slot != Base::InvalidSlot)
+    {
+        this->EraseSlot(slot);
+    }
+
+    return (slot != Base::InvalidSlot);
+}
+
+} // Util
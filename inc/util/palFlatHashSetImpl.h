@@ -0,0 +1,74 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palFlatHashSetImpl.h
+ * @brief PAL utility collection FlatHashSet class implementation.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palFlatHashBaseImpl.h"
+#include "palFlatHashSet.h"
+
+namespace Util
+{
+
+// =====================================================================================================================
+// Inserts a key if it doesn't already exist.
+template<typename Key,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE Result FlatHashSet<Key, Allocator, HashFunc, EqualFunc>::Insert(
+    const Key& key)
+{
+    bool   existed = false;
+    uint32 slot    = Base::InvalidSlot;
+
+    return this->FindAllocateSlot(key, &existed, &slot);
+}
+
+// =====================================================================================================================
+// Removes an entry with the specified key.
+template<typename Key,
+         typename Allocator,
+         template<typename> class HashFunc,
+         template<typename> class EqualFunc>
+PAL_INLINE bool FlatHashSet<Key, Allocator, HashFunc, EqualFunc>::Erase(
+    const Key& key)
+{
+    const uint32 slot = this->FindSlot(key);
+
+    if (slot != Base::InvalidSlot)
+    {
+        this->EraseSlot(slot);
+    }
+
+    return (slot != Base::InvalidSlot);
+}
+
+} // Util
@@ -25,7 +25,8 @@
 /**
  ***********************************************************************************************************************
  * @file  palHashLiteralString.h
- * @brief PAL utility collection implementation of the HashLiteralString constexpr template function.
+ * @brief PAL utility collection implementation of the HashLiteralString constexpr template function and the
+ *        PerfectHashKeyTable compile-time key lookup table.
  ***********************************************************************************************************************
  */
 
@@ -89,4 +90,102 @@ constexpr uint32 HashLiteralString(
     return Fnv1aHashHelper<N, N - 1>::Hash(string);
 }
 
+/// @internal Folds one byte into a perfect-hash sample using the FNV-1a mixing step.
+constexpr uint32 PerfectHashMix(
+    uint32 hash,
+    char   value)
+{
+    return LowPart(static_cast<uint64>(hash ^ static_cast<uint8>(value)) * Fnv1aPrime);
+}
+
+/// Computes the sampled key hash used by @ref PerfectHashKeyTable.  Only the length and three bytes of the key (at two
+/// table-specific pivot offsets, clamped to the key, and the last byte) contribute to the hash, so its cost does not
+/// depend on the key length.  Usable both at compile time and at runtime.
+///
+/// @param [in] pKey    Key characters; need not be null-terminated.
+/// @param [in] length  Number of characters in the key.  Must be non-zero.
+/// @param [in] seed    Table-specific seed.
+/// @param [in] pivot0  Offset of the first sampled byte.
+/// @param [in] pivot1  Offset of the second sampled byte.
+///
+/// @returns 32-bit hash of the sampled key bytes.
+constexpr uint32 PerfectHashSample(
+    const char* pKey,
+    uint32      length,
+    uint32      seed,
+    uint32      pivot0,
+    uint32      pivot1)
+{
+    return PerfectHashMix(PerfectHashMix(PerfectHashMix(seed ^ length,
+                                                        pKey[(pivot0 < length) ? pivot0 : (length - 1)]),
+                                         pKey[(pivot1 < length) ? pivot1 : (length - 1)]),
+                          pKey[length - 1]);
+}
+
+/**
+ ***********************************************************************************************************************
+ * @brief Compile-time perfect-hash table mapping a fixed set of string keys to dense indices.
+ *
+ * The seed and pivots are picked by tools/generate/genPerfectHashKeyTables.py so that every key lands in a distinct
+ * slot of a 2^TableBits entry table.  A lookup therefore costs one constant-time hash and a single length check plus
+ * memcmp() against the only candidate key, which also rejects unknown keys that happen to hash to an occupied slot.
+ * Instances are meant to be declared constexpr so that the slot assignments can be checked with static_assert() via
+ * @ref IsValid().  Rerun the script whenever a table's key list changes.
+ ***********************************************************************************************************************
+ */
+template <uint32 NumKeys, uint32 TableBits>
+struct PerfectHashKeyTable
+{
+    static_assert((NumKeys < 255) && (NumKeys <= (1u << TableBits)), "Unsupported perfect-hash table size.");
+
+    uint32      seed;                    ///< Hash seed.
+    uint32      pivot[2];                ///< Offsets of the sampled key bytes.
+    uint8       slots[1u << TableBits];  ///< Index of the key owning each slot, or NumKeys if the slot is unused.
+    const char* pKeys[NumKeys];          ///< Null-terminated key strings, in index order.
+    uint8       keyLengths[NumKeys];     ///< Length of each key string.
+
+    /// Returns the table slot for a key.
+    constexpr uint32 Slot(
+        const char* pKey,
+        uint32      length) const
+    {
+        return PerfectHashSample(pKey, length, seed, pivot[0], pivot[1]) >> (32 - TableBits);
+    }
+
+    /// Returns true if every key has the recorded length and owns the slot it hashes to.  Meant to be checked with
+    /// static_assert() so that a stale table fails to compile.
+    constexpr bool IsValid(
+        uint32 index = 0) const
+    {
+        return (index >= NumKeys) ||
+               ((KeyLength(pKeys[index]) == keyLengths[index])            &&
+                (slots[Slot(pKeys[index], keyLengths[index])] == index) &&
+                IsValid(index + 1));
+    }
+
+    /// Looks up a key.
+    ///
+    /// @param [in] pKey    Key characters; need not be null-terminated.
+    /// @param [in] length  Number of characters in the key.
+    ///
+    /// @returns The index of the matching key, or NumKeys if the key is not in the table.
+    uint32 Find(
+        const char* pKey,
+        uint32      length) const
+    {
+        const uint32 index = (length > 0) ? slots[Slot(pKey, length)] : NumKeys;
+
+        return ((index < NumKeys)                &&
+                (keyLengths[index] == length)    &&
+                (memcmp(pKeys[index], pKey, length) == 0)) ? index : NumKeys;
+    }
+
+private:
+    static constexpr uint32 KeyLength(
+        const char* pKey)
+    {
+        return (*pKey == '\0') ? 0 : (1 + KeyLength(pKey + 1));
+    }
+};
+
 } // Util
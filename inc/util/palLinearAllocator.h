@@ -37,6 +37,14 @@
 namespace Util
 {
 
+/// Counters which describe how often a @ref VirtualLinearAllocator called into the OS to commit or decommit pages.
+struct VirtualLinearAllocatorStats
+{
+    uint32 commitCalls;   ///< Number of times pages were committed, including the first page committed by Init().
+    uint32 decommitCalls; ///< Number of times pages were decommitted, either by Rewind() or by Trim().
+    uint64 pagesTrimmed;  ///< Number of pages decommitted by Trim().
+};
+
 /**
  ***********************************************************************************************************************
  * @brief A linear allocator that allocates virtual memory.
@@ -48,6 +56,10 @@ namespace Util
  * As clients reach a steady state, allocations from this allocator will become "free," essentially just costing a
  * pointer increment.
  *
+ * Pages which are not decommitted by Rewind() stay committed up to the allocator's high-water mark so that a pooled
+ * allocator can be recycled without any syscalls.  Owners of long-lived allocators should call Trim() periodically to
+ * release pages which have not been needed since the previous trim.
+ *
  * This allocator can be used with any of the memory management macros. @see Allocators for more information about the
  * Allocation pattern.
  ***********************************************************************************************************************
@@ -62,8 +74,12 @@ public:
     VirtualLinearAllocator(size_t size) :
         m_pStart(nullptr),
         m_pCurrent(nullptr),
+        m_pCommittedToPage(nullptr),
+        m_pUsedToPage(nullptr),
+        m_pPeakToPage(nullptr),
         m_size(size),
-        m_pageSize(0) {}
+        m_pageSize(0),
+        m_stats() {}
 
     /// Destructor.
     virtual ~VirtualLinearAllocator()
@@ -95,6 +111,9 @@ public:
         {
             m_pCurrent         = m_pStart;
             m_pCommittedToPage = VoidPtrInc(m_pCurrent, m_pageSize);
+            m_pUsedToPage      = m_pCommittedToPage;
+            m_pPeakToPage      = m_pCommittedToPage;
+            m_stats.commitCalls++;
         }
 
         return result;
@@ -120,7 +139,9 @@ public:
             if (result == Result::_Success)
             {
                 m_pCommittedToPage = VoidPtrInc(m_pCommittedToPage, commitBytes);
+                m_pUsedToPage      = m_pCommittedToPage;
                 m_pCurrent         = pNextCurrent;
+                m_stats.commitCalls++;
             }
             else
             {
@@ -130,6 +151,9 @@ public:
         }
         else
         {
+            // Track how far into the pages kept committed across rewinds this use has reached.
+            m_pUsedToPage = Max(m_pUsedToPage, pAlignedEnd);
+
             m_pCurrent = pNextCurrent;
         }
 
@@ -151,27 +175,27 @@ public:
 
         if (pStart != m_pCurrent)
         {
+            void*        pStartPage   = VoidPtrAlign(VoidPtrInc(pStart, 1), m_pageSize);
+            void*        pCurrentPage = VoidPtrAlign(m_pCurrent, m_pageSize);
+            const size_t numPages     =
+                (pCurrentPage > pStartPage) ? (VoidPtrDiff(pCurrentPage, pStartPage) / m_pageSize) : 0;
+
             if (decommit)
             {
-                void*        pStartPage   = VoidPtrAlign(VoidPtrInc(pStart, 1), m_pageSize);
-                void*        pCurrentPage = VoidPtrAlign(m_pCurrent, m_pageSize);
-                const size_t numPages     = VoidPtrDiff(pCurrentPage, pStartPage) / m_pageSize;
-
                 if (numPages > 0)
                 {
                     Result result = VirtualDecommit(pStartPage, m_pageSize * numPages);
                     PAL_ASSERT(result == Result::_Success);
 
                     m_pCommittedToPage = pStartPage;
+                    m_stats.decommitCalls++;
                 }
             }
 #if DEBUG
             else
             {
-                void*        pStartPage   = VoidPtrAlign(VoidPtrInc(pStart, 1), m_pageSize);
-                void*        pCurrentPage = VoidPtrAlign(m_pCurrent, m_pageSize);
-                const size_t numDwords    = VoidPtrDiff(pCurrentPage, pStartPage) / sizeof(uint32);
-                uint32*      pNewCurrent  = static_cast<uint32*>(pStartPage);
+                const size_t numDwords   = (numPages * m_pageSize) / sizeof(uint32);
+                uint32*      pNewCurrent = static_cast<uint32*>(pStartPage);
 
                 for (size_t dword = 0; dword < numDwords; dword++)
                 {
@@ -180,10 +204,45 @@ public:
             }
 #endif
 
-            m_pCurrent = pStart;
+            // Remember how far into the committed pages this allocator reached so that Trim() won't release them.
+            m_pPeakToPage = Max(m_pPeakToPage, m_pUsedToPage);
+            m_pUsedToPage = pStartPage;
+            m_pCurrent    = pStart;
+        }
+    }
+
+    /// Decommits all pages past the current allocation which have not been used since the previous call to Trim().
+    /// Calling this at a regular interval lets an allocator keep its working set committed across rewinds while still
+    /// eventually returning memory after a spike in usage.
+    ///
+    /// @returns The number of bytes which were decommitted.
+    size_t Trim()
+    {
+        void*  pKeepToPage  = Max(m_pPeakToPage, m_pUsedToPage);
+        size_t trimmedBytes = 0;
+
+        if (pKeepToPage < m_pCommittedToPage)
+        {
+            trimmedBytes = VoidPtrDiff(m_pCommittedToPage, pKeepToPage);
+
+            Result result = VirtualDecommit(pKeepToPage, trimmedBytes);
+            PAL_ASSERT(result == Result::_Success);
+
+            m_pCommittedToPage = pKeepToPage;
+            m_stats.decommitCalls++;
+            m_stats.pagesTrimmed += trimmedBytes / m_pageSize;
         }
+
+        m_pPeakToPage = m_pUsedToPage;
+
+        return trimmedBytes;
     }
 
+    /// Returns the counters which track how often this allocator committed and decommitted pages.
+    ///
+    /// @returns A reference to this allocator's statistics.
+    const VirtualLinearAllocatorStats& GetStats() const { return m_stats; }
+
     /// Returns the current pointer to backing memory.
     ///
     /// @returns Current pointer to backing memory.
@@ -208,10 +267,14 @@ private:
     void*  m_pStart;            ///< Pointer to where the backing allocation starts.
     void*  m_pCurrent;          ///< Pointer to the current position of backing memory.
     void*  m_pCommittedToPage;  ///< Pointer to the end of the last committed page.
+    void*  m_pUsedToPage;       ///< Pointer to the end of the last page used since the previous rewind.
+    void*  m_pPeakToPage;       ///< Pointer to the end of the last page used since the previous trim.
 
     size_t m_size;              ///< Size of the allocation.
     size_t m_pageSize;          ///< OS' defined page size.
 
+    VirtualLinearAllocatorStats m_stats; ///< Commit and decommit counters.
+
     PAL_DISALLOW_DEFAULT_CTOR(VirtualLinearAllocator);
     PAL_DISALLOW_COPY_AND_ASSIGN(VirtualLinearAllocator);
 };
@@ -0,0 +1,160 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palLockFreeRingBuffer.h
+ * @brief PAL utility collection LockFreeRingBuffer class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palInlineFuncs.h"
+#include "palMutex.h"
+#include "palRingBuffer.h"
+
+namespace Util
+{
+
+/// Selects which threads may access a @ref LockFreeRingBuffer concurrently.
+enum class RingBufferConcurrency : uint32
+{
+    SingleProducerSingleConsumer = 0,  ///< At most one writer thread and one reader thread at a time.
+    MultiProducerMultiConsumer,        ///< Any number of writer and reader threads.
+};
+
+/**
+************************************************************************************************************************
+* @brief  Bounded lock-free ring buffer, useful for handing slots between threads without a kernel call per handoff.
+*
+* This is an alternative to @ref RingBuffer which uses the same slot-callback interface.  Instead of a pair of
+* semaphores, each slot carries a sequence counter which tells writers and readers whether the slot is ready for them.
+* Acquiring a slot is a single compare-and-swap on the writer (or reader) position in the multi-producer/multi-consumer
+* configuration and a plain store in the single-producer/single-consumer one.  The configuration is a template
+* parameter so the unused paths compile away.
+*
+* A thread which finds the ring full (or empty) spins briefly, then yields, and only then parks on a semaphore.  The
+* releasing side posts that semaphore only when a thread is actually parked, so a ring which is kept moving never enters
+* the kernel.
+*
+* Because several buffers may be held at once, the Release functions take the buffer being released.  Writers may
+* release their buffers in any order; readers always receive buffers in the order they were acquired for writing.
+************************************************************************************************************************
+*/
+template <typename Allocator,
+          RingBufferConcurrency Concurrency = RingBufferConcurrency::MultiProducerMultiConsumer>
+class LockFreeRingBuffer
+{
+public:
+    /// Constructs a ring buffer object with the specified properties.
+    ///
+    /// @param [in] numElements Number of entries in the ring buffer.
+    /// @param [in] elementSize Size, in bytes, of each entry in the ring buffer.
+    /// @param [in] pAllocator  The allocator that will allocate memory if required.
+    LockFreeRingBuffer(uint32 numElements, size_t elementSize, Allocator*const pAllocator);
+    ~LockFreeRingBuffer() {};
+
+    /// Initializes the ring buffer, allocating memory for usage.
+    ///
+    /// @param [in] pfnInit     Initialization function to execute on every slot in the ring buffer.
+    /// @param [in] pData       User data to be passed to the initialization function.
+    ///
+    /// @returns @ref Success if successful, otherwise an appropriate error.
+    Result Init(RingBufferSlotFunc pfnInit, void* pData);
+
+    /// Destroys the ring buffer, undoing whatever initialization was performed in Init().
+    ///
+    /// @param [in] pfnDestroy  Destroy function to execute on every slot in the ring buffer.
+    /// @param [in] pData       User data to be passed to the destroy function.
+    ///
+    /// @returns @ref Success if successful, otherwise an appropriate error.
+    Result Destroy(RingBufferSlotFunc pfnDestroy, void* pData);
+
+    /// Retrieves the next buffer to write to.
+    ///
+    /// @param [in]  waitTimeMs  Number of milliseconds to wait for the next available buffer.
+    /// @param [out] ppBuffer    Pointer to the next available writeable buffer.
+    ///
+    /// @returns @ref Success if a buffer is available within the wait time, @ref Timeout otherwise.
+    Result GetBufferForWriting(uint32 waitTimeMs, void** ppBuffer);
+
+    /// Releases a writable buffer, making it available to readers.
+    ///
+    /// @param [in] pBuffer A buffer previously returned by GetBufferForWriting.
+    void ReleaseWriteBuffer(void* pBuffer);
+
+    /// Retrieves the next buffer to read from.
+    ///
+    /// @param [in]  waitTimeMs     Number of milliseconds to wait for the next available buffer.
+    /// @param [out] ppBuffer       Pointer to the next available readable buffer.
+    ///
+    /// @returns @ref Success if a buffer is available within the wait time, @ref Timeout otherwise.
+    Result GetBufferForReading(uint32 waitTimeMs, const void** ppBuffer);
+
+    /// Releases a readable buffer, making it available to writers.
+    ///
+    /// @param [in] pBuffer A buffer previously returned by GetBufferForReading.
+    void ReleaseReadBuffer(const void* pBuffer);
+
+private:
+    // Per-slot sequence counter, padded to a cache line so threads working on neighboring slots don't contend.
+    struct Slot
+    {
+        volatile uint64 sequence;
+        uint8           padding[PAL_CACHE_LINE_BYTES - sizeof(uint64)];
+    };
+
+    // One side of the ring (writers or readers): the next position to acquire and the threads parked waiting for it.
+    struct Cursor
+    {
+        volatile uint64 position;
+        uint8           padding[PAL_CACHE_LINE_BYTES - sizeof(uint64)];
+        volatile uint32 numWaiters;
+        Semaphore       wakeup;
+    };
+
+    bool TryAcquire(Cursor* pCursor, uint64 readyOffset, uint32* pSlotIdx);
+    Result Acquire(Cursor* pCursor, uint64 readyOffset, uint32 waitTimeMs, uint32* pSlotIdx);
+    void Publish(uint32 slotIdx, uint64 sequenceIncrement, Cursor* pWaiters);
+
+    uint32 BufferToSlotIdx(const void* pBuffer) const
+        { return static_cast<uint32>(VoidPtrDiff(pBuffer, m_pRingBuffer) / m_elementSize); }
+
+    // Number of times to retry an acquire before yielding, and number of yields before parking.
+    static constexpr uint32 SpinCount  = 64;
+    static constexpr uint32 YieldCount = 16;
+
+    void*             m_pRingBuffer;  // Allocated ring buffer memory.
+    Slot*             m_pSlots;       // Sequence counters, one per element.
+    const uint32      m_numElements;  // Number of elements in the ring buffer.
+    const size_t      m_elementSize;  // Size of each element in the ring buffer.
+    Cursor            m_writer;       // Writer position; a slot is writable when its sequence equals this position.
+    Cursor            m_reader;       // Reader position; a slot is readable when its sequence is one past it.
+    Allocator*const   m_pAllocator;   // Allocator for this ring buffer.
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(LockFreeRingBuffer);
+};
+
+} // Util
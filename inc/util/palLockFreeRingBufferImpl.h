@@ -0,0 +1,336 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "palLockFreeRingBuffer.h"
+#include "palMutex.h"
+#include "palSysMemory.h"
+#include "palSysUtil.h"
+
+namespace Util
+{
+
+// =====================================================================================================================
+template <typename Allocator, RingBufferConcurrency Concurrency>
+LockFreeRingBuffer<Allocator, Concurrency>::LockFreeRingBuffer(
+    uint32          numElements,
+    size_t          elementSize,
+    Allocator*const pAllocator)
+    :
+    m_pRingBuffer(nullptr),
+    m_pSlots(nullptr),
+    m_numElements(numElements),
+    m_elementSize(elementSize),
+    m_pAllocator(pAllocator)
+{
+    PAL_ASSERT(numElements > 0);
+    PAL_ASSERT(elementSize > 0);
+
+    m_writer.position   = 0;
+    m_writer.numWaiters = 0;
+    m_reader.position   = 0;
+    m_reader.numWaiters = 0;
+}
+
+// =====================================================================================================================
+// Initializes the contents of the ring buffer.
+template <typename Allocator, RingBufferConcurrency Concurrency>
+Result LockFreeRingBuffer<Allocator, Concurrency>::Init(
+    RingBufferSlotFunc pfnInit,
+    void*              pData)
+{
+    Result result = Result::ErrorOutOfMemory;
+
+    const size_t slotBytes = m_numElements * sizeof(Slot);
+    void*const   pMemory   = PAL_MALLOC_ALIGNED(slotBytes + (m_numElements * m_elementSize),
+                                                PAL_CACHE_LINE_BYTES,
+                                                m_pAllocator,
+                                                SystemAllocType::AllocInternal);
+
+    if (pMemory != nullptr)
+    {
+        m_pSlots      = static_cast<Slot*>(pMemory);
+        m_pRingBuffer = VoidPtrInc(pMemory, slotBytes);
+
+        // Slot i is first written at position i.
+        for (uint32 i = 0; i < m_numElements; i++)
+        {
+            m_pSlots[i].sequence = i;
+        }
+
+        result = m_writer.wakeup.Init(Semaphore::MaximumCountLimit, 0);
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_reader.wakeup.Init(Semaphore::MaximumCountLimit, 0);
+    }
+
+    if ((result == Result::Success) && (pfnInit != nullptr))
+    {
+        bool initSuccessful = true;
+
+        for (uint32 i = 0; ((initSuccessful == true) && (i < m_numElements)); i++)
+        {
+            initSuccessful = pfnInit(i, pData, VoidPtrInc(m_pRingBuffer, i * m_elementSize));
+        }
+
+        if (initSuccessful == false)
+        {
+            result = Result::ErrorInitializationFailed;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Destroys the contents of the ring buffer.
+template <typename Allocator, RingBufferConcurrency Concurrency>
+Result LockFreeRingBuffer<Allocator, Concurrency>::Destroy(
+    RingBufferSlotFunc pfnDestroy,
+    void*              pData)
+{
+    Result result = Result::Success;
+
+    if ((pfnDestroy != nullptr) && (m_pRingBuffer != nullptr))
+    {
+        bool initSuccessful = true;
+
+        for (uint32 i = 0; ((initSuccessful == true) && (i < m_numElements)); i++)
+        {
+            initSuccessful = pfnDestroy(i, pData, VoidPtrInc(m_pRingBuffer, i * m_elementSize));
+        }
+
+        if (initSuccessful == false)
+        {
+            result = Result::ErrorUnavailable;
+        }
+    }
+
+    // The slot array and the element storage share one allocation.
+    PAL_SAFE_FREE(m_pSlots, m_pAllocator);
+    m_pRingBuffer = nullptr;
+
+    return result;
+}
+
+// =====================================================================================================================
+// Attempts to claim the slot at the cursor's position without blocking.  A slot is ready for this cursor when its
+// sequence equals (position + readyOffset): writers use an offset of zero and readers an offset of one.
+template <typename Allocator, RingBufferConcurrency Concurrency>
+bool LockFreeRingBuffer<Allocator, Concurrency>::TryAcquire(
+    Cursor* pCursor,
+    uint64  readyOffset,
+    uint32* pSlotIdx)
+{
+    bool   acquired = false;
+    uint64 position = pCursor->position;
+
+    while (true)
+    {
+        const uint32 slotIdx  = static_cast<uint32>(position % m_numElements);
+        const uint64 sequence = m_pSlots[slotIdx].sequence;
+        const int64  diff     = static_cast<int64>(sequence - (position + readyOffset));
+
+        if (diff == 0)
+        {
+            if (Concurrency == RingBufferConcurrency::SingleProducerSingleConsumer)
+            {
+                // Nobody else moves this cursor.
+                pCursor->position = position + 1;
+                acquired = true;
+            }
+            else
+            {
+                // On failure the swap hands back the current position and we try again from there.
+                const uint64 prevPosition = AtomicCompareAndSwap64(&pCursor->position, position, position + 1);
+
+                acquired = (prevPosition == position);
+                position = prevPosition;
+            }
+
+            if (acquired)
+            {
+                *pSlotIdx = slotIdx;
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The slot hasn't been released by the other side yet: the ring is full (or empty).
+            break;
+        }
+        else
+        {
+            // Another thread claimed this position; catch up.
+            position = pCursor->position;
+        }
+    }
+
+    return acquired;
+}
+
+// =====================================================================================================================
+// Claims the slot at the cursor's position, spinning, then yielding, then parking until it's ready or time runs out.
+template <typename Allocator, RingBufferConcurrency Concurrency>
+Result LockFreeRingBuffer<Allocator, Concurrency>::Acquire(
+    Cursor* pCursor,
+    uint64  readyOffset,
+    uint32  waitTimeMs,
+    uint32* pSlotIdx)
+{
+    bool acquired = TryAcquire(pCursor, readyOffset, pSlotIdx);
+
+    for (uint32 i = 0; (acquired == false) && (waitTimeMs != 0) && (i < SpinCount + YieldCount); i++)
+    {
+        if (i >= SpinCount)
+        {
+            YieldThread();
+        }
+
+        acquired = TryAcquire(pCursor, readyOffset, pSlotIdx);
+    }
+
+    if ((acquired == false) && (waitTimeMs != 0))
+    {
+        const bool   infinite  = (waitTimeMs == UINT32_MAX);
+        const int64  frequency = GetPerfFrequency();
+        const int64  deadline  = GetPerfCpuTime() + ((static_cast<int64>(waitTimeMs) * frequency) / 1000);
+        uint32       timeoutMs = waitTimeMs;
+
+        while (acquired == false)
+        {
+            // Register as a waiter before the final check so that a concurrent release either sees us or we see it.
+            // The increment is a full barrier.
+            AtomicIncrement(&pCursor->numWaiters);
+
+            acquired = TryAcquire(pCursor, readyOffset, pSlotIdx);
+
+            Result waitResult = Result::Success;
+            if (acquired == false)
+            {
+                waitResult = pCursor->wakeup.Wait(timeoutMs);
+            }
+
+            AtomicDecrement(&pCursor->numWaiters);
+
+            if ((acquired == false) && (infinite == false))
+            {
+                // Wakeups may be spurious or stolen by another waiter, so recompute the remaining time every pass.
+                const int64 remaining = deadline - GetPerfCpuTime();
+
+                if ((waitResult == Result::Timeout) || (remaining <= 0))
+                {
+                    acquired = TryAcquire(pCursor, readyOffset, pSlotIdx);
+                    break;
+                }
+
+                timeoutMs = static_cast<uint32>(Max<int64>(((remaining * 1000) / frequency), 1));
+            }
+        }
+    }
+
+    return acquired ? Result::Success : Result::Timeout;
+}
+
+// =====================================================================================================================
+// Advances a slot's sequence to hand it to the other side, waking a parked thread on that side if there is one.
+template <typename Allocator, RingBufferConcurrency Concurrency>
+void LockFreeRingBuffer<Allocator, Concurrency>::Publish(
+    uint32  slotIdx,
+    uint64  sequenceIncrement,
+    Cursor* pWaiters)
+{
+    PAL_ASSERT(slotIdx < m_numElements);
+
+    // Only the thread holding the slot may modify its sequence, but the atomic add doubles as the full barrier which
+    // orders the slot's contents before the new sequence and the new sequence before the waiter check below.
+    AtomicAdd64(&m_pSlots[slotIdx].sequence, sequenceIncrement);
+
+    if (pWaiters->numWaiters > 0)
+    {
+        pWaiters->wakeup.Post();
+    }
+}
+
+// =====================================================================================================================
+// Retrieve next writeable buffer in the ring.
+template <typename Allocator, RingBufferConcurrency Concurrency>
+Result LockFreeRingBuffer<Allocator, Concurrency>::GetBufferForWriting(
+    uint32 waitTimeMs, // Wait time in milliseconds.
+    void** ppBuffer)
+{
+    uint32       slotIdx = 0;
+    const Result result  = Acquire(&m_writer, 0, waitTimeMs, &slotIdx);
+
+    if (result == Result::Success)
+    {
+        (*ppBuffer) = VoidPtrInc(m_pRingBuffer, slotIdx * m_elementSize);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Releases a held writeable buffer, marking it as written so that readers can consume it.
+template <typename Allocator, RingBufferConcurrency Concurrency>
+void LockFreeRingBuffer<Allocator, Concurrency>::ReleaseWriteBuffer(
+    void* pBuffer)
+{
+    // A slot written at position p becomes readable at sequence p + 1.
+    Publish(BufferToSlotIdx(pBuffer), 1, &m_reader);
+}
+
+// =====================================================================================================================
+// Retrieve next readable buffer in the ring.
+template <typename Allocator, RingBufferConcurrency Concurrency>
+Result LockFreeRingBuffer<Allocator, Concurrency>::GetBufferForReading(
+    uint32       waitTimeMs, // Wait time in milliseconds.
+    const void** ppBuffer)
+{
+    uint32       slotIdx = 0;
+    const Result result  = Acquire(&m_reader, 1, waitTimeMs, &slotIdx);
+
+    if (result == Result::Success)
+    {
+        (*ppBuffer) = VoidPtrInc(m_pRingBuffer, slotIdx * m_elementSize);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Releases a held readable buffer, marking it as read so that writers can refill it.
+template <typename Allocator, RingBufferConcurrency Concurrency>
+void LockFreeRingBuffer<Allocator, Concurrency>::ReleaseReadBuffer(
+    const void* pBuffer)
+{
+    // A slot read at position p (sequence p + 1) is next written at position p + numElements.
+    Publish(BufferToSlotIdx(pBuffer), m_numElements - 1, &m_writer);
+}
+
+} // Util
@@ -68,7 +68,7 @@ class MemMapFile
 public:
 
     /// Constructor.
-    MemMapFile() {}
+    MemMapFile() : m_pActiveContainerHeader(nullptr), m_mappingSize(0), m_accessFlags(0) {}
     ///Destructor.
     ~MemMapFile();
 
@@ -127,6 +127,26 @@ public:
     /// @returns Success if successful. On failure the storage container is no longer valid.
     Result ReloadIfNeeded(bool* pWasReloaded);
 
+    /// Returns the amount of storage which has been used so far, not counting the storage header. This is also the
+    /// offset at which the next call to @ref GetNewStorageSpace() will place its data.
+    ///
+    /// @returns Used size of the storage container, or InvalidOffset if the container is invalid.
+    size_t GetUsedStorageSize() const;
+
+    /// Moves the end of the used storage back to the specified size, discarding everything after it. The storage
+    /// capacity is not affected.
+    ///
+    /// @param  dataSize  New used storage size, not counting the storage header.
+    ///
+    /// @returns Success if successful, ErrorInvalidValue if dataSize exceeds the current used storage size.
+    Result TruncateStorage(size_t dataSize);
+
+    /// Checks that the shared storage header is still consistent. Other processes may modify or replace the file at any
+    /// time, so users which share the file should check this before trusting its contents.
+    ///
+    /// @returns Success if the header is valid, an appropriate error code otherwise.
+    Result ValidateStorage() const;
+
     /// Value returned for invalid offset or size
     static const size_t InvalidOffset = 0xffffffff;
 
@@ -0,0 +1,210 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palSlabAllocator.h
+ * @brief PAL utility collection SlabAllocator class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palMutex.h"
+#include "palSysMemory.h"
+#include "palThread.h"
+
+namespace Util
+{
+
+/// Statistics reported by @ref SlabAllocator::GetStats().
+struct SlabAllocatorStats
+{
+    size_t reservedBytes;     ///< Total size of all arenas requested from the backing allocator.
+    uint32 numArenas;         ///< Number of arenas requested from the backing allocator.
+    uint32 numThreadCaches;   ///< Number of threads which have allocated or freed through the slab allocator.
+    uint64 numPagesCarved;    ///< Number of slab pages handed out to a size class.
+    uint64 numDepotExchanges; ///< Number of magazine exchanges between a thread cache and the global depot.
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief Size-class slab allocator which caches small allocations per thread in front of another allocator.
+ *
+ * Small fixed-size objects (list nodes, deque blocks, hash groups, per-draw temporaries) are allocated and freed at
+ * high rates.  Rather than forwarding each of these requests to the backing allocator, this allocator rounds them up to
+ * one of a small number of size classes and serves them from large arenas obtained from the backing allocator.
+ *
+ * The design follows the classic magazine/depot scheme:
+ * + Each thread owns a cache holding a "loaded" and a "previous" magazine per size class.  A magazine is a fixed-size
+ *   stack of free objects, so the common Alloc() and Free() paths touch only thread-local state and take no locks.
+ * + When both magazines of a size class are exhausted (or full) the thread exchanges a whole magazine with the global
+ *   depot of that size class under the depot's lock.  The depot refills empty magazines by carving objects out of
+ *   64 KiB slab pages, each of which is dedicated to a single size class.
+ * + Arenas grow geometrically and are never returned to the backing allocator until the SlabAllocator is destroyed.
+ *
+ * Requests which are too large, over-aligned, or made before Enable() is called are forwarded to the backing allocator.
+ * Free() identifies slab memory by its address, so memory from either source may be freed at any time.
+ *
+ * A MemTracker layered on top of this allocator continues to account for every allocation, since it sees all requests
+ * before they reach the slab allocator.
+ *
+ * When a thread exits, its cache's magazines are handed back to the depots so that other threads can reuse the objects
+ * they hold.
+ ***********************************************************************************************************************
+ */
+template <typename Allocator>
+class SlabAllocator
+{
+public:
+    /// Constructor.
+    ///
+    /// @param [in] pAllocator The allocator which will be used for arenas, bookkeeping and unsupported requests.
+    explicit SlabAllocator(Allocator*const pAllocator);
+    ~SlabAllocator();
+
+    /// Performs any non-safe initialization that cannot be done in the constructor.
+    ///
+    /// @returns Result::Success if initialization is successful, otherwise an appropriate error.
+    Result Init();
+
+    /// Starts serving small allocations from the slab arenas.  Until this is called, all requests are forwarded to the
+    /// backing allocator.  The allocator cannot be disabled again once it has been enabled.  Must not be called while
+    /// other threads are using the allocator.
+    void Enable();
+
+    /// Returns true if small allocations are currently being served from the slab arenas.
+    bool IsEnabled() const { return m_enabled; }
+
+    /// Allocates a block of memory.
+    ///
+    /// @param [in] allocInfo Contains information about the requested allocation.
+    ///
+    /// @returns Pointer to the allocated memory, nullptr if the allocation failed.
+    void* Alloc(const AllocInfo& allocInfo);
+
+    /// Frees a block of memory.
+    ///
+    /// @param [in] freeInfo Contains information about the requested free.
+    void Free(const FreeInfo& freeInfo);
+
+    /// Reports arena usage and depot traffic.  The values are gathered without stopping other threads so they are only
+    /// approximate while the allocator is in use.
+    ///
+    /// @param [out] pStats Receives the current statistics.
+    void GetStats(SlabAllocatorStats* pStats) const;
+
+private:
+    // Smallest size class and the granularity of all size classes.  This is also the largest alignment we can honor.
+    static constexpr size_t SizeClassGranularity = 16;
+    // Largest request which is served from the slab arenas.
+    static constexpr size_t MaxSlabSize          = 2048;
+    // Number of distinct size classes; see the table in SlabAllocator::Init().
+    static constexpr uint32 NumSizeClasses       = 24;
+    // Number of objects held by a single magazine.
+    static constexpr uint32 MagazineCapacity     = 32;
+    // Every slab page is dedicated to a single size class.
+    static constexpr size_t SlabPageSize         = 64 * 1024;
+    static constexpr uint32 SlabPageShift        = 16;
+    // Arenas start small and double in size up to the maximum.
+    static constexpr size_t MinArenaSize         = 1024 * 1024;
+    static constexpr size_t MaxArenaSize         = 64 * 1024 * 1024;
+    static constexpr uint32 MaxArenas            = 64;
+
+    // A fixed-capacity stack of free objects belonging to a single size class.
+    struct Magazine
+    {
+        Magazine* pNext;                     // Next magazine in a depot list.
+        uint32    count;                     // Number of valid entries in pObjects.
+        void*     pObjects[MagazineCapacity];
+    };
+
+    // Per-thread state.  Only ever touched by its owning thread, except during destruction.
+    struct ThreadCache
+    {
+        SlabAllocator* pOwner;               // Allocator which owns this cache; needed by the thread exit callback.
+        ThreadCache*   pPrev;                // Previous cache in the list of all caches owned by this allocator.
+        ThreadCache*   pNext;                // Next cache in the list of all caches owned by this allocator.
+        struct
+        {
+            Magazine* pLoaded;
+            Magazine* pPrevious;
+        } classes[NumSizeClasses];
+    };
+
+    // Global, lock-protected state for a single size class.
+    struct Depot
+    {
+        Mutex     lock;
+        Magazine* pFullList;                 // Magazines with MagazineCapacity objects.
+        Magazine* pEmptyList;                // Magazines with no objects.
+        void*     pLooseList;                // Objects freed by a thread which could not create its cache.
+        uint8*    pCarveCur;                 // Next unused object in the size class' current slab page.
+        uint8*    pCarveEnd;                 // End of the size class' current slab page.
+        uint64    numPagesCarved;
+        uint64    numExchanges;
+    };
+
+    // A large block of memory from the backing allocator which is subdivided into slab pages.
+    struct Arena
+    {
+        uint8* pBase;
+        size_t size;
+        uint8* pPageClass;                   // Size class index of each slab page in this arena.
+    };
+
+    ThreadCache* GetThreadCache();
+    void         ReleaseThreadCache(ThreadCache* pCache);
+    void         ReturnMagazine(Depot* pDepot, Magazine* pMagazine);
+    static void  ThreadExitCallback(void* pValue);
+    Magazine*    AllocMagazine();
+    bool         RefillFromDepot(uint32 sizeClass, ThreadCache* pCache);
+    bool         SpillToDepot(uint32 sizeClass, ThreadCache* pCache);
+    bool         CarvePage(uint32 sizeClass, Depot* pDepot);
+    bool         FindSizeClass(const void* pMem, uint32* pSizeClass) const;
+
+    Allocator*const      m_pAllocator;
+    bool                 m_initialized;
+    volatile bool        m_enabled;
+    ThreadLocalKey       m_cacheKey;         // Only valid once the allocator has been enabled.
+
+    uint8                m_sizeClassLookup[(MaxSlabSize / SizeClassGranularity) + 1]; // Maps (size+15)/16 to a class.
+    uint32               m_sizeClassBytes[NumSizeClasses];                              // Object size of each class.
+
+    Depot                m_depots[NumSizeClasses];
+
+    Mutex                m_arenaLock;        // Serializes arena growth and updates to the thread cache list.
+    Arena                m_arenas[MaxArenas];
+    volatile uint32      m_numArenas;        // Published with a full barrier once an arena is fully set up.
+    uint8*               m_pArenaCur;        // Next unused slab page in the newest arena.
+    uint8*               m_pArenaEnd;        // End of the newest arena.
+    size_t               m_reservedBytes;
+    ThreadCache*         m_pCacheList;
+    uint32               m_numThreadCaches;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(SlabAllocator);
+    PAL_DISALLOW_DEFAULT_CTOR(SlabAllocator);
+};
+
+} // Util
@@ -0,0 +1,641 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palSlabAllocatorImpl.h
+ * @brief PAL utility collection SlabAllocator class implementation.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palInlineFuncs.h"
+#include "palSlabAllocator.h"
+
+#include <cstring>
+
+namespace Util
+{
+
+// =====================================================================================================================
+template <typename Allocator>
+SlabAllocator<Allocator>::SlabAllocator(
+    Allocator*const pAllocator)
+    :
+    m_pAllocator(pAllocator),
+    m_initialized(false),
+    m_enabled(false),
+    m_cacheKey(),
+    m_numArenas(0),
+    m_pArenaCur(nullptr),
+    m_pArenaEnd(nullptr),
+    m_reservedBytes(0),
+    m_pCacheList(nullptr),
+    m_numThreadCaches(0)
+{
+    memset(&m_sizeClassLookup[0], 0, sizeof(m_sizeClassLookup));
+    memset(&m_sizeClassBytes[0],  0, sizeof(m_sizeClassBytes));
+    memset(&m_arenas[0],          0, sizeof(m_arenas));
+
+    for (uint32 i = 0; i < NumSizeClasses; ++i)
+    {
+        m_depots[i].pFullList      = nullptr;
+        m_depots[i].pEmptyList     = nullptr;
+        m_depots[i].pLooseList     = nullptr;
+        m_depots[i].pCarveCur      = nullptr;
+        m_depots[i].pCarveEnd      = nullptr;
+        m_depots[i].numPagesCarved = 0;
+        m_depots[i].numExchanges   = 0;
+    }
+}
+
+// =====================================================================================================================
+// Releases every arena, magazine and thread cache back to the backing allocator.  Any slab allocations which are still
+// outstanding become invalid.
+template <typename Allocator>
+SlabAllocator<Allocator>::~SlabAllocator()
+{
+    if (m_enabled)
+    {
+        // Deleting the key first guarantees that the thread exit callback can no longer touch the cache list.
+        DeleteThreadLocalKey(m_cacheKey);
+    }
+
+    while (m_pCacheList != nullptr)
+    {
+        ThreadCache*const pCache = m_pCacheList;
+        m_pCacheList = pCache->pNext;
+
+        for (uint32 i = 0; i < NumSizeClasses; ++i)
+        {
+            PAL_FREE(pCache->classes[i].pLoaded,   m_pAllocator);
+            PAL_FREE(pCache->classes[i].pPrevious, m_pAllocator);
+        }
+
+        PAL_FREE(pCache, m_pAllocator);
+    }
+
+    for (uint32 i = 0; i < NumSizeClasses; ++i)
+    {
+        Magazine* pLists[] = { m_depots[i].pFullList, m_depots[i].pEmptyList };
+
+        for (uint32 list = 0; list < ArrayLen(pLists); ++list)
+        {
+            while (pLists[list] != nullptr)
+            {
+                Magazine*const pMagazine = pLists[list];
+                pLists[list] = pMagazine->pNext;
+                PAL_FREE(pMagazine, m_pAllocator);
+            }
+        }
+    }
+
+    const uint32 numArenas = m_numArenas;
+
+    for (uint32 i = 0; i < numArenas; ++i)
+    {
+        PAL_FREE(m_arenas[i].pPageClass, m_pAllocator);
+        PAL_FREE(m_arenas[i].pBase,      m_pAllocator);
+    }
+}
+
+// =====================================================================================================================
+// Builds the size class tables and initializes the depot locks.
+template <typename Allocator>
+Result SlabAllocator<Allocator>::Init()
+{
+    // Size classes are spaced 16 bytes apart up to 128 bytes and then four to each power-of-two interval, which keeps
+    // internal fragmentation below 25% for every request size.
+    static constexpr uint32 SizeClasses[NumSizeClasses] =
+    {
+          16,   32,   48,   64,   80,   96,  112,  128,
+         160,  192,  224,  256,  320,  384,  448,  512,
+         640,  768,  896, 1024, 1280, 1536, 1792, 2048,
+    };
+
+    static_assert(SizeClasses[NumSizeClasses - 1] == MaxSlabSize, "The largest size class must match MaxSlabSize.");
+    static_assert((1u << SlabPageShift) == SlabPageSize,           "SlabPageShift does not match SlabPageSize.");
+
+    uint32 sizeClass = 0;
+    for (uint32 i = 0; i < ArrayLen(m_sizeClassLookup); ++i)
+    {
+        while ((i * SizeClassGranularity) > SizeClasses[sizeClass])
+        {
+            ++sizeClass;
+        }
+
+        m_sizeClassLookup[i] = static_cast<uint8>(sizeClass);
+    }
+
+    memcpy(&m_sizeClassBytes[0], &SizeClasses[0], sizeof(m_sizeClassBytes));
+
+    Result result = m_arenaLock.Init();
+
+    for (uint32 i = 0; (result == Result::Success) && (i < NumSizeClasses); ++i)
+    {
+        result = m_depots[i].lock.Init();
+    }
+
+    m_initialized = (result == Result::Success);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates the thread-local key used to find each thread's cache and starts serving small allocations.  The key is only
+// created here so that a disabled allocator doesn't consume one of the process' limited thread-local keys.
+template <typename Allocator>
+void SlabAllocator<Allocator>::Enable()
+{
+    if (m_initialized && (m_enabled == false))
+    {
+        m_enabled = (CreateThreadLocalKey(&m_cacheKey, &ThreadExitCallback) == Result::Success);
+    }
+}
+
+// =====================================================================================================================
+// Allocates a block of memory.  Small requests are served from the calling thread's magazines whenever possible.
+template <typename Allocator>
+void* SlabAllocator<Allocator>::Alloc(
+    const AllocInfo& allocInfo)
+{
+    void* pMem = nullptr;
+
+    if (IsEnabled() && (allocInfo.bytes <= MaxSlabSize) && (allocInfo.alignment <= SizeClassGranularity))
+    {
+        const uint32 sizeClass = m_sizeClassLookup[(allocInfo.bytes + SizeClassGranularity - 1) / SizeClassGranularity];
+        ThreadCache*const pCache = GetThreadCache();
+
+        if (pCache != nullptr)
+        {
+            auto*const pClass = &pCache->classes[sizeClass];
+
+            if (((pClass->pLoaded   == nullptr) || (pClass->pLoaded->count == 0)) &&
+                ((pClass->pPrevious != nullptr) && (pClass->pPrevious->count > 0)))
+            {
+                Magazine*const pTemp = pClass->pLoaded;
+                pClass->pLoaded      = pClass->pPrevious;
+                pClass->pPrevious    = pTemp;
+            }
+
+            if (((pClass->pLoaded != nullptr) && (pClass->pLoaded->count > 0)) || RefillFromDepot(sizeClass, pCache))
+            {
+                pMem = pClass->pLoaded->pObjects[--pClass->pLoaded->count];
+
+                if (allocInfo.zeroMem)
+                {
+                    memset(pMem, 0, allocInfo.bytes);
+                }
+            }
+        }
+    }
+
+    if (pMem == nullptr)
+    {
+        pMem = m_pAllocator->Alloc(allocInfo);
+    }
+
+    return pMem;
+}
+
+// =====================================================================================================================
+// Frees a block of memory.  Slab objects are returned to the calling thread's magazines, regardless of which thread
+// allocated them; everything else is forwarded to the backing allocator.
+template <typename Allocator>
+void SlabAllocator<Allocator>::Free(
+    const FreeInfo& freeInfo)
+{
+    uint32 sizeClass = 0;
+
+    if (freeInfo.pClientMem == nullptr)
+    {
+        // Nothing to do.
+    }
+    else if (FindSizeClass(freeInfo.pClientMem, &sizeClass) == false)
+    {
+        m_pAllocator->Free(freeInfo);
+    }
+    else
+    {
+        ThreadCache*const pCache = GetThreadCache();
+        bool              cached = false;
+
+        if (pCache != nullptr)
+        {
+            auto*const pClass = &pCache->classes[sizeClass];
+
+            if (((pClass->pLoaded   == nullptr) || (pClass->pLoaded->count == MagazineCapacity)) &&
+                ((pClass->pPrevious != nullptr) && (pClass->pPrevious->count < MagazineCapacity)))
+            {
+                Magazine*const pTemp = pClass->pLoaded;
+                pClass->pLoaded      = pClass->pPrevious;
+                pClass->pPrevious    = pTemp;
+            }
+
+            if (((pClass->pLoaded != nullptr) && (pClass->pLoaded->count < MagazineCapacity)) ||
+                SpillToDepot(sizeClass, pCache))
+            {
+                pClass->pLoaded->pObjects[pClass->pLoaded->count++] = freeInfo.pClientMem;
+                cached = true;
+            }
+        }
+
+        if (cached == false)
+        {
+            // We're out of system memory.  Every slab object is large enough to hold a pointer so just chain it onto
+            // the depot's loose list; it will be handed out again by the next refill.
+            Depot*const pDepot = &m_depots[sizeClass];
+            MutexAuto   lock(&pDepot->lock);
+
+            *static_cast<void**>(freeInfo.pClientMem) = pDepot->pLooseList;
+            pDepot->pLooseList = freeInfo.pClientMem;
+        }
+    }
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+void SlabAllocator<Allocator>::GetStats(
+    SlabAllocatorStats* pStats
+    ) const
+{
+    memset(pStats, 0, sizeof(*pStats));
+
+    pStats->reservedBytes   = m_reservedBytes;
+    pStats->numArenas       = m_numArenas;
+    pStats->numThreadCaches = m_numThreadCaches;
+
+    for (uint32 i = 0; i < NumSizeClasses; ++i)
+    {
+        pStats->numPagesCarved    += m_depots[i].numPagesCarved;
+        pStats->numDepotExchanges += m_depots[i].numExchanges;
+    }
+}
+
+// =====================================================================================================================
+// Returns the calling thread's cache, creating it on first use.  Returns null if the cache could not be created.
+template <typename Allocator>
+typename SlabAllocator<Allocator>::ThreadCache* SlabAllocator<Allocator>::GetThreadCache()
+{
+    ThreadCache* pCache = static_cast<ThreadCache*>(GetThreadLocalValue(m_cacheKey));
+
+    if (pCache == nullptr)
+    {
+        pCache = static_cast<ThreadCache*>(PAL_CALLOC(sizeof(ThreadCache), m_pAllocator, AllocInternal));
+
+        if ((pCache != nullptr) && (SetThreadLocalValue(m_cacheKey, pCache) != Result::Success))
+        {
+            PAL_SAFE_FREE(pCache, m_pAllocator);
+        }
+
+        if (pCache != nullptr)
+        {
+            MutexAuto lock(&m_arenaLock);
+
+            pCache->pOwner = this;
+            pCache->pNext  = m_pCacheList;
+
+            if (m_pCacheList != nullptr)
+            {
+                m_pCacheList->pPrev = pCache;
+            }
+
+            m_pCacheList = pCache;
+            m_numThreadCaches++;
+        }
+    }
+
+    return pCache;
+}
+
+// =====================================================================================================================
+// Called by the threading library when a thread which owns a cache exits.
+template <typename Allocator>
+void SlabAllocator<Allocator>::ThreadExitCallback(
+    void* pValue)
+{
+    ThreadCache*const pCache = static_cast<ThreadCache*>(pValue);
+
+    pCache->pOwner->ReleaseThreadCache(pCache);
+}
+
+// =====================================================================================================================
+// Hands all of an exiting thread's magazines back to the depots, then unlinks and frees its cache.
+template <typename Allocator>
+void SlabAllocator<Allocator>::ReleaseThreadCache(
+    ThreadCache* pCache)
+{
+    for (uint32 i = 0; i < NumSizeClasses; ++i)
+    {
+        Depot*const pDepot = &m_depots[i];
+        MutexAuto   lock(&pDepot->lock);
+
+        ReturnMagazine(pDepot, pCache->classes[i].pLoaded);
+        ReturnMagazine(pDepot, pCache->classes[i].pPrevious);
+    }
+
+    {
+        MutexAuto lock(&m_arenaLock);
+
+        if (pCache->pPrev != nullptr)
+        {
+            pCache->pPrev->pNext = pCache->pNext;
+        }
+        else
+        {
+            m_pCacheList = pCache->pNext;
+        }
+
+        if (pCache->pNext != nullptr)
+        {
+            pCache->pNext->pPrev = pCache->pPrev;
+        }
+
+        m_numThreadCaches--;
+    }
+
+    PAL_FREE(pCache, m_pAllocator);
+}
+
+// =====================================================================================================================
+// Gives a magazine from a thread cache back to its depot.  The depot only tracks full and empty magazines, so the
+// objects in a partially filled magazine are moved to the loose list.  Must be called with the depot's lock held.
+template <typename Allocator>
+void SlabAllocator<Allocator>::ReturnMagazine(
+    Depot*    pDepot,
+    Magazine* pMagazine)
+{
+    if (pMagazine != nullptr)
+    {
+        if (pMagazine->count == MagazineCapacity)
+        {
+            pMagazine->pNext  = pDepot->pFullList;
+            pDepot->pFullList = pMagazine;
+        }
+        else
+        {
+            while (pMagazine->count > 0)
+            {
+                void*const pObject = pMagazine->pObjects[--pMagazine->count];
+
+                *static_cast<void**>(pObject) = pDepot->pLooseList;
+                pDepot->pLooseList = pObject;
+            }
+
+            pMagazine->pNext   = pDepot->pEmptyList;
+            pDepot->pEmptyList = pMagazine;
+        }
+    }
+}
+
+// =====================================================================================================================
+template <typename Allocator>
+typename SlabAllocator<Allocator>::Magazine* SlabAllocator<Allocator>::AllocMagazine()
+{
+    Magazine*const pMagazine = static_cast<Magazine*>(PAL_MALLOC(sizeof(Magazine), m_pAllocator, AllocInternal));
+
+    if (pMagazine != nullptr)
+    {
+        pMagazine->pNext = nullptr;
+        pMagazine->count = 0;
+    }
+
+    return pMagazine;
+}
+
+// =====================================================================================================================
+// Called when both of a thread's magazines for the given size class are empty.  Trades the thread's previous magazine
+// for a full one from the depot, or fills a magazine from the loose list and the current slab page if the depot has no
+// full magazines.  On success, the thread's loaded magazine is guaranteed to be non-empty.
+template <typename Allocator>
+bool SlabAllocator<Allocator>::RefillFromDepot(
+    uint32       sizeClass,
+    ThreadCache* pCache)
+{
+    auto*const  pClass = &pCache->classes[sizeClass];
+    Depot*const pDepot = &m_depots[sizeClass];
+    MutexAuto   lock(&pDepot->lock);
+
+    pDepot->numExchanges++;
+
+    bool success = false;
+
+    if (pDepot->pFullList != nullptr)
+    {
+        // The previous magazine is empty (or missing); give it to the depot and demote the empty loaded magazine.
+        if (pClass->pPrevious != nullptr)
+        {
+            pClass->pPrevious->pNext = pDepot->pEmptyList;
+            pDepot->pEmptyList       = pClass->pPrevious;
+        }
+
+        pClass->pPrevious = pClass->pLoaded;
+        pClass->pLoaded   = pDepot->pFullList;
+        pDepot->pFullList = pClass->pLoaded->pNext;
+        success           = true;
+    }
+    else
+    {
+        if (pClass->pLoaded == nullptr)
+        {
+            if (pDepot->pEmptyList != nullptr)
+            {
+                pClass->pLoaded    = pDepot->pEmptyList;
+                pDepot->pEmptyList = pClass->pLoaded->pNext;
+            }
+            else
+            {
+                pClass->pLoaded = AllocMagazine();
+            }
+        }
+
+        Magazine*const pMagazine = pClass->pLoaded;
+
+        if (pMagazine != nullptr)
+        {
+            PAL_ASSERT(pMagazine->count == 0);
+
+            while ((pMagazine->count < MagazineCapacity) && (pDepot->pLooseList != nullptr))
+            {
+                void*const pObject = pDepot->pLooseList;
+                pDepot->pLooseList = *static_cast<void**>(pObject);
+                pMagazine->pObjects[pMagazine->count++] = pObject;
+            }
+
+            const size_t objectSize = m_sizeClassBytes[sizeClass];
+
+            while (pMagazine->count < MagazineCapacity)
+            {
+                if ((VoidPtrDiff(pDepot->pCarveEnd, pDepot->pCarveCur) < objectSize) &&
+                    (CarvePage(sizeClass, pDepot) == false))
+                {
+                    break;
+                }
+
+                pMagazine->pObjects[pMagazine->count++] = pDepot->pCarveCur;
+                pDepot->pCarveCur += objectSize;
+            }
+
+            success = (pMagazine->count > 0);
+        }
+    }
+
+    return success;
+}
+
+// =====================================================================================================================
+// Called when both of a thread's magazines for the given size class are full.  Hands the thread's previous magazine
+// to the depot and replaces it with an empty one.  On success, the thread's loaded magazine is guaranteed to be empty.
+template <typename Allocator>
+bool SlabAllocator<Allocator>::SpillToDepot(
+    uint32       sizeClass,
+    ThreadCache* pCache)
+{
+    auto*const  pClass = &pCache->classes[sizeClass];
+    Depot*const pDepot = &m_depots[sizeClass];
+    MutexAuto   lock(&pDepot->lock);
+
+    pDepot->numExchanges++;
+
+    Magazine* pEmpty = pDepot->pEmptyList;
+
+    if (pEmpty != nullptr)
+    {
+        pDepot->pEmptyList = pEmpty->pNext;
+    }
+    else
+    {
+        pEmpty = AllocMagazine();
+    }
+
+    if (pEmpty != nullptr)
+    {
+        if (pClass->pPrevious != nullptr)
+        {
+            PAL_ASSERT(pClass->pPrevious->count == MagazineCapacity);
+
+            pClass->pPrevious->pNext = pDepot->pFullList;
+            pDepot->pFullList        = pClass->pPrevious;
+        }
+
+        pClass->pPrevious = pClass->pLoaded;
+        pClass->pLoaded   = pEmpty;
+    }
+
+    return (pEmpty != nullptr);
+}
+
+// =====================================================================================================================
+// Assigns a new slab page to the given size class, growing the arena list if the newest arena is exhausted.  Must be
+// called with the depot's lock held.
+template <typename Allocator>
+bool SlabAllocator<Allocator>::CarvePage(
+    uint32 sizeClass,
+    Depot* pDepot)
+{
+    MutexAuto lock(&m_arenaLock);
+
+    const uint32 numArenas = m_numArenas;
+
+    if ((m_pArenaCur == m_pArenaEnd) && (numArenas < MaxArenas))
+    {
+        const size_t arenaSize = (numArenas == 0) ? MinArenaSize : Min(m_arenas[numArenas - 1].size * 2, MaxArenaSize);
+        const size_t numPages  = arenaSize / SlabPageSize;
+
+        Arena*const pArena = &m_arenas[numArenas];
+
+        pArena->pBase      = static_cast<uint8*>(PAL_MALLOC_ALIGNED(arenaSize,
+                                                                    PAL_CACHE_LINE_BYTES,
+                                                                    m_pAllocator,
+                                                                    AllocInternal));
+        pArena->pPageClass = static_cast<uint8*>(PAL_MALLOC(numPages, m_pAllocator, AllocInternal));
+
+        if ((pArena->pBase != nullptr) && (pArena->pPageClass != nullptr))
+        {
+            pArena->size     = arenaSize;
+            m_pArenaCur      = pArena->pBase;
+            m_pArenaEnd      = pArena->pBase + arenaSize;
+            m_reservedBytes += arenaSize;
+
+            // Publish the new arena so that Free() on other threads can find it.  The increment is a full barrier so
+            // the arena's fields are visible before the new count.
+            AtomicIncrement(&m_numArenas);
+        }
+        else
+        {
+            PAL_SAFE_FREE(pArena->pBase,      m_pAllocator);
+            PAL_SAFE_FREE(pArena->pPageClass, m_pAllocator);
+        }
+    }
+
+    bool success = false;
+
+    if (m_pArenaCur != m_pArenaEnd)
+    {
+        const Arena& arena = m_arenas[m_numArenas - 1];
+
+        // The page's size class must be recorded before any of its objects can be handed out.
+        arena.pPageClass[VoidPtrDiff(m_pArenaCur, arena.pBase) >> SlabPageShift] = static_cast<uint8>(sizeClass);
+
+        pDepot->pCarveCur = m_pArenaCur;
+        pDepot->pCarveEnd = m_pArenaCur + SlabPageSize;
+        pDepot->numPagesCarved++;
+
+        m_pArenaCur += SlabPageSize;
+        success      = true;
+    }
+
+    return success;
+}
+
+// =====================================================================================================================
+// Determines if the given pointer was allocated from one of our arenas and, if so, which size class it belongs to.
+template <typename Allocator>
+bool SlabAllocator<Allocator>::FindSizeClass(
+    const void* pMem,
+    uint32*     pSizeClass
+    ) const
+{
+    const uint32 numArenas = m_numArenas;
+    bool         found     = false;
+
+    // There are only a handful of arenas because they grow geometrically, so a linear search is cheap.  Newer arenas
+    // are larger and hold most of the live objects so search them first.
+    for (uint32 i = numArenas; i > 0; --i)
+    {
+        const Arena& arena = m_arenas[i - 1];
+
+        if ((pMem >= arena.pBase) && (pMem < arena.pBase + arena.size))
+        {
+            *pSizeClass = arena.pPageClass[VoidPtrDiff(pMem, arena.pBase) >> SlabPageShift];
+            found       = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+} // Util
@@ -242,6 +242,18 @@ extern Result ListDir(
 /// @returns The Process ID of the current process
 extern uint32 GetIdOfCurrentProcess();
 
+/// Retrieves the build ID which the linker embedded in the executable or shared library that contains PAL.  Unlike a
+/// build timestamp, this identifies the exact contents of the binary and is stable across reproducible rebuilds.
+///
+/// @param [out]    pBuildId     Receives the build ID.  May be null to query its size.
+/// @param [in,out] pBuildIdSize Input: the size of pBuildId in bytes.  Output: the size of the build ID in bytes.
+///
+/// @returns Success if the build ID was returned, Unsupported if the binary has no build ID (e.g. it was linked without
+///          --build-id), or ErrorInvalidMemorySize if pBuildId is too small.
+extern Result GetCurrentModuleBuildId(
+    void*   pBuildId,
+    uint32* pBuildIdSize);
+
 /// OS-specific wrapper for printing stack trace information.
 ///
 /// @param [out] pOutput    Output string. If buffer is a nullptr it returns the length of the string that would be
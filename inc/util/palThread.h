@@ -118,6 +118,23 @@ typedef pthread_key_t ThreadLocalKey;
 ///          + ErrorUnavailable if no more keys can be created.
 extern Result CreateThreadLocalKey(ThreadLocalKey* pKey);
 
+/// Callback invoked when a thread exits while it has a non-null value associated with a thread-local key.
+///
+/// @param [in] pValue The exiting thread's value for the key.
+typedef void (*ThreadLocalDestructor)(void* pValue);
+
+/// Creates a new key for this process to store and retrieve thread-local data, with a callback which is invoked on
+/// each thread's non-null value when that thread exits.  The callback is not invoked for values which are still set
+/// when the key is deleted.
+///
+/// @param [in,out] pKey          Pointer to the key being created.
+/// @param [in]     pfnDestructor Function to call on an exiting thread's value.  May be null.
+///
+/// @returns Success if the key was successfully created.  Otherwise, one of the following error codes may be returned.
+///          + ErrorInvalidPointer if pKey is null.
+///          + ErrorUnavailable if no more keys can be created.
+extern Result CreateThreadLocalKey(ThreadLocalKey* pKey, ThreadLocalDestructor pfnDestructor);
+
 /// Deletes a key that was previously created by @ref CreateThreadLocalKey.  It is the caller's responsibility to free
 /// any thread-local dynamic allocations stored at this key.  The key is considered invalid after the call returns.
 ///
@@ -264,6 +264,21 @@ static bool IsRotatedSwizzle(
             (swizzleMode == ADDR_SW_VAR_R_X));
 }
 
+// =====================================================================================================================
+// Returns true if the associated swizzle mode uses the variable-sized swizzle block
+static bool IsVarSwizzle(
+    AddrSwizzleMode  swizzleMode)
+{
+    return ((swizzleMode == ADDR_SW_VAR_Z)   ||
+            (swizzleMode == ADDR_SW_VAR_S)   ||
+            (swizzleMode == ADDR_SW_VAR_D)   ||
+            (swizzleMode == ADDR_SW_VAR_R)   ||
+            (swizzleMode == ADDR_SW_VAR_Z_X) ||
+            (swizzleMode == ADDR_SW_VAR_S_X) ||
+            (swizzleMode == ADDR_SW_VAR_D_X) ||
+            (swizzleMode == ADDR_SW_VAR_R_X));
+}
+
 // =====================================================================================================================
 // Returns true if the associated swizzle mode works with pipe-bank-xor values
 static bool IsXorSwizzle(
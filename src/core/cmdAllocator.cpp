@@ -39,14 +39,16 @@ namespace Pal
 {
 
 // =====================================================================================================================
-// Determines how much space is required to hold a CmdAllocator and its optional Mutex.
+// Determines how much space is required to hold a CmdAllocator, its optional Mutexes and its chunk shards.
 size_t CmdAllocator::GetSize(
     const CmdAllocatorCreateInfo& createInfo,
     Result*                       pResult)    // [optional] The additional validation result is stored here.
 {
-    // We need extra space for two Mutex objects if the allocator is thread safe.
+    // We need extra space for two Mutex objects and a full set of chunk shards if the allocator is thread safe.
     size_t size = sizeof(CmdAllocator) + (createInfo.flags.threadSafe ? (2 * sizeof(Mutex)) : 0);
 
+    size += (createInfo.flags.threadSafe ? MaxChunkShards : 1) * sizeof(ChunkShard);
+
     // Validate the createInfo if requested.
     if (pResult != nullptr)
     {
@@ -89,13 +91,19 @@ CmdAllocator::CmdAllocator(
     :
     m_pDevice(pDevice),
     m_pChunkLock(nullptr),
+    m_pChunkShards(nullptr),
+    m_numChunkShards(1),
     m_lastPagingFence(0),
     m_pLinearAllocLock(nullptr),
+    m_linearAllocResetCount(0),
     m_pDummyChunkAllocation(nullptr)
 {
 #if PAL_ENABLE_PRINTS_ASSERTS
     memset(m_pHistograms, 0, sizeof(m_pHistograms));
     m_numHistogramBins = 0;
+    memset(&m_linearAllocStats, 0, sizeof(m_linearAllocStats));
+    memset(&m_recordingStats, 0, sizeof(m_recordingStats));
+    m_numRecordingsLogged = 0;
 #endif
 
     m_flags.u32All          = 0;
@@ -105,11 +113,23 @@ CmdAllocator::CmdAllocator(
         m_flags.trackBusyChunks = m_flags.autoMemoryReuse;
     }
 
+    void* pShardAddr = this + 1;
+
     if (createInfo.flags.threadSafe)
     {
         // If this allocator is thread safe we construct mutexes immediately following this object in memory.
         m_pChunkLock       = PAL_PLACEMENT_NEW(this + 1) Mutex();
         m_pLinearAllocLock = PAL_PLACEMENT_NEW(m_pChunkLock + 1) Mutex();
+        pShardAddr         = m_pLinearAllocLock + 1;
+        m_numChunkShards   = MaxChunkShards;
+    }
+
+    // The chunk shards always follow this object and its mutexes.
+    m_pChunkShards = static_cast<ChunkShard*>(pShardAddr);
+
+    for (uint32 i = 0; i < m_numChunkShards; ++i)
+    {
+        PAL_PLACEMENT_NEW(&m_pChunkShards[i]) ChunkShard();
     }
 
     const uint32 residencyFlags = m_pDevice->GetPublicSettings()->cmdAllocResidency;
@@ -207,6 +227,12 @@ CmdAllocator::~CmdAllocator()
     FreeAllChunks();
     FreeAllLinearAllocators();
 
+    // The shards were also created using placement new.
+    for (uint32 i = 0; i < m_numChunkShards; ++i)
+    {
+        m_pChunkShards[i].~ChunkShard();
+    }
+
     // Free the dummy chunk.
     if (m_pDummyChunkAllocation != nullptr)
     {
@@ -262,7 +288,7 @@ void CmdAllocator::FreeAllChunks()
         &m_gpuAllocInfo[GpuScratchMemAlloc],
         &m_sysAllocInfo,
     };
-    static_assert(ArrayLen(pAllocInfo) == (CmdAllocatorTypeCount + 1),
+    static_assert(ArrayLen(pAllocInfo) == ChunkListCount,
                   "Unexpected number of command allocation memory types!");
 
 #if PAL_ENABLE_PRINTS_ASSERTS
@@ -271,11 +297,14 @@ void CmdAllocator::FreeAllChunks()
     // asserts enabled.
     if (TrackBusyChunks())
     {
-        for (uint32 i = 0; i < (CmdAllocatorTypeCount + 1); ++i)
+        for (uint32 i = 0; i < ChunkListCount; ++i)
         {
-            for (auto iter = pAllocInfo[i]->busyList.Begin(); iter.IsValid(); iter.Next())
+            for (uint32 shard = 0; shard < m_numChunkShards; ++shard)
             {
-                PAL_ASSERT(iter.Get()->IsIdleOnGpu());
+                for (auto iter = m_pChunkShards[shard].busyList[i].Begin(); iter.IsValid(); iter.Next())
+                {
+                    PAL_ASSERT(iter.Get()->IsIdleOnGpu());
+                }
             }
 
             for (auto iter = pAllocInfo[i]->reuseList.Begin(); iter.IsValid(); iter.Next())
@@ -288,13 +317,18 @@ void CmdAllocator::FreeAllChunks()
 
     // Note that as soon as we start destroying allocations our command chunk's head chunks become invalid. Nothing
     // called in this loop can access those head chunks.
-    for (uint32 i = 0; i < (CmdAllocatorTypeCount + 1); ++i)
+    for (uint32 i = 0; i < ChunkListCount; ++i)
     {
         // Empty out the chunk lists so we can destroy the chunks.
         pAllocInfo[i]->freeList.EraseAll();
-        pAllocInfo[i]->busyList.EraseAll();
         pAllocInfo[i]->reuseList.EraseAll();
 
+        for (uint32 shard = 0; shard < m_numChunkShards; ++shard)
+        {
+            m_pChunkShards[shard].freeList[i].EraseAll();
+            m_pChunkShards[shard].busyList[i].EraseAll();
+        }
+
         // Destroy all allocations (which also destroys all chunks).
         for (auto iter = pAllocInfo[i]->allocList.Begin(); iter.IsValid();)
         {
@@ -309,6 +343,21 @@ void CmdAllocator::FreeAllChunks()
     }
 }
 
+#if PAL_ENABLE_PRINTS_ASSERTS
+// =====================================================================================================================
+// Adds the given linear allocator's counters to the given totals.
+static void AccumulateLinearAllocStats(
+    const VirtualLinearAllocator& allocator,
+    VirtualLinearAllocatorStats*  pTotals)
+{
+    const VirtualLinearAllocatorStats& stats = allocator.GetStats();
+
+    pTotals->commitCalls   += stats.commitCalls;
+    pTotals->decommitCalls += stats.decommitCalls;
+    pTotals->pagesTrimmed  += stats.pagesTrimmed;
+}
+#endif
+
 // =====================================================================================================================
 // Removes all linear allocators from our lists and deletes them.
 void CmdAllocator::FreeAllLinearAllocators()
@@ -317,6 +366,9 @@ void CmdAllocator::FreeAllLinearAllocators()
     {
         VirtualLinearAllocatorWithNode*const pAllocator = iter.Get();
         m_linearAllocFreeList.Erase(&iter);
+#if PAL_ENABLE_PRINTS_ASSERTS
+        AccumulateLinearAllocStats(*pAllocator, &m_linearAllocStats);
+#endif
         PAL_DELETE(pAllocator, m_pDevice->GetPlatform());
     }
 
@@ -324,10 +376,26 @@ void CmdAllocator::FreeAllLinearAllocators()
     {
         VirtualLinearAllocatorWithNode*const pAllocator = iter.Get();
         m_linearAllocBusyList.Erase(&iter);
+#if PAL_ENABLE_PRINTS_ASSERTS
+        AccumulateLinearAllocStats(*pAllocator, &m_linearAllocStats);
+#endif
         PAL_DELETE(pAllocator, m_pDevice->GetPlatform());
     }
 }
 
+// =====================================================================================================================
+// Decommits the pages of each idle linear allocator which haven't been needed since the last time this was called.
+// The caller must hold the linear allocator lock.
+void CmdAllocator::TrimLinearAllocators()
+{
+    for (auto iter = m_linearAllocFreeList.Begin(); iter.IsValid(); iter.Next())
+    {
+        iter.Get()->Trim();
+    }
+
+    m_linearAllocResetCount = 0;
+}
+
 // =====================================================================================================================
 Result CmdAllocator::Init()
 {
@@ -339,6 +407,12 @@ Result CmdAllocator::Init()
         result = m_pLinearAllocLock->Init();
     }
 
+    // The shard locks are only needed if the allocator is thread safe.
+    for (uint32 i = 0; (m_pChunkLock != nullptr) && (result == Result::Success) && (i < m_numChunkShards); ++i)
+    {
+        result = m_pChunkShards[i].lock.Init();
+    }
+
 #if PAL_ENABLE_PRINTS_ASSERTS
     const auto& settings = m_pDevice->Settings();
 
@@ -402,14 +476,36 @@ Result CmdAllocator::Reset()
     }
     else
     {
-        for (uint32 i = 0; i < CmdAllocatorTypeCount; ++i)
+        for (uint32 i = 0; i < ChunkListCount; ++i)
         {
-            TransferChunks(&m_gpuAllocInfo[i].freeList, &m_gpuAllocInfo[i].busyList);
-            TransferChunks(&m_gpuAllocInfo[i].freeList, &m_gpuAllocInfo[i].reuseList);
-        }
+            CmdAllocInfo*const pAllocInfo = (i == CmdAllocatorTypeCount) ? &m_sysAllocInfo : &m_gpuAllocInfo[i];
+
+            // Gather every shard's chunks back onto the shared free list. The shards will refill themselves as the
+            // recording threads need chunks, which rebalances chunks between threads after each reset.
+            for (uint32 shard = 0; shard < m_numChunkShards; ++shard)
+            {
+                ChunkShard*const pShard = &m_pChunkShards[shard];
 
-        TransferChunks(&m_sysAllocInfo.freeList, &m_sysAllocInfo.busyList);
-        TransferChunks(&m_sysAllocInfo.freeList, &m_sysAllocInfo.reuseList);
+                if (m_pChunkLock != nullptr)
+                {
+                    pShard->lock.Lock();
+                }
+
+                TransferChunks(&pAllocInfo->freeList, &pShard->busyList[i]);
+
+                if (pShard->freeList[i].IsEmpty() == false)
+                {
+                    pAllocInfo->freeList.PushFrontList(&pShard->freeList[i]);
+                }
+
+                if (m_pChunkLock != nullptr)
+                {
+                    pShard->lock.Unlock();
+                }
+            }
+
+            TransferChunks(&pAllocInfo->freeList, &pAllocInfo->reuseList);
+        }
     }
 
     if (m_pChunkLock != nullptr)
@@ -427,9 +523,19 @@ Result CmdAllocator::Reset()
     {
         FreeAllLinearAllocators();
     }
-    else if (m_linearAllocBusyList.IsEmpty() == false)
+    else
     {
-        m_linearAllocFreeList.PushFrontList(&m_linearAllocBusyList);
+        if (m_linearAllocBusyList.IsEmpty() == false)
+        {
+            m_linearAllocFreeList.PushFrontList(&m_linearAllocBusyList);
+        }
+
+        // Pooled allocators keep their pages committed between uses; only release pages which have gone unused for
+        // a whole trim interval.
+        if (++m_linearAllocResetCount >= LinearAllocTrimInterval)
+        {
+            TrimLinearAllocators();
+        }
     }
 
     if (m_pLinearAllocLock != nullptr)
@@ -441,7 +547,8 @@ Result CmdAllocator::Reset()
 }
 
 // =====================================================================================================================
-// Takes an iterator to a list of CmdStreamChunk(s) and moves them to the reuse list for use later.
+// Takes an iterator to a list of CmdStreamChunk(s) and returns them to the allocator in bulk. If the root chunk is idle
+// the chunks are reset and cached on the shards they came from, otherwise they are moved to the reuse list.
 void CmdAllocator::ReuseChunks(
     CmdAllocType   allocType,
     bool           systemMemory,
@@ -452,40 +559,61 @@ void CmdAllocator::ReuseChunks(
 
     if (AutomaticMemoryReuse())
     {
-        // If necessary, engage the chunk lock.
+        // If necessary, engage the chunk lock. We need it even if all of these chunks go back to their shards because
+        // resetting a chunk changes its generation, which other chunks' busy trackers read under this lock.
         if (m_pChunkLock != nullptr)
         {
             m_pChunkLock->Lock();
         }
 
-        auto*const pAllocInfo = (systemMemory ? &m_sysAllocInfo : &m_gpuAllocInfo[allocType]);
+        auto*const   pAllocInfo = (systemMemory ? &m_sysAllocInfo : &m_gpuAllocInfo[allocType]);
+        const uint32 listIdx    = ChunkListIndex(allocType, systemMemory);
 
-        // If the root chunk is idle, we can reset and push all the chunks to the free list.
-        if (iter.Get()->IsIdle())
+        // If the root chunk is idle, we can reset and push all the chunks to the free lists.
+        const bool   rootIdle   = iter.Get()->IsIdle();
+
+        // A command stream's chunks almost always come from a single shard so we keep its lock until the shard changes.
+        ChunkShard*  pLockedShard = nullptr;
+
+        while (iter.IsValid())
         {
-            while (iter.IsValid())
+            CmdStreamChunk*const pChunk = iter.Get();
+            ChunkShard*const     pShard = &m_pChunkShards[pChunk->CacheShard()];
+
+            if ((pShard != pLockedShard) && (m_pChunkLock != nullptr))
             {
-                // Move this chunk from the busy list to the front of the free list.
-                auto*const pNode = iter.Get()->ListNode();
-                pAllocInfo->busyList.Erase(pNode);
-                pAllocInfo->freeList.PushFront(pNode);
-
-                // Remember that items on the free list must be reset.
-                iter.Get()->Reset(true);
-                iter.Next();
+                if (pLockedShard != nullptr)
+                {
+                    pLockedShard->lock.Unlock();
+                }
+
+                pShard->lock.Lock();
             }
-        }
-        else
-        {
-            while (iter.IsValid())
+
+            pLockedShard = pShard;
+
+            auto*const pNode = pChunk->ListNode();
+            pShard->busyList[listIdx].Erase(pNode);
+
+            if (rootIdle)
+            {
+                // Move this chunk from the busy list to the front of its shard's free list. Remember that items on the
+                // free list must be reset.
+                pShard->freeList[listIdx].PushFront(pNode);
+                pChunk->Reset(true);
+            }
+            else
             {
                 // Move this chunk from the busy list to the front of the reuse list.
-                auto*const pNode = iter.Get()->ListNode();
-                pAllocInfo->busyList.Erase(pNode);
                 pAllocInfo->reuseList.PushFront(pNode);
-
-                iter.Next();
             }
+
+            iter.Next();
+        }
+
+        if ((pLockedShard != nullptr) && (m_pChunkLock != nullptr))
+        {
+            pLockedShard->lock.Unlock();
         }
 
         if (m_pChunkLock != nullptr)
@@ -495,6 +623,14 @@ void CmdAllocator::ReuseChunks(
     }
 }
 
+// =====================================================================================================================
+// Returns the index of the chunk shard used by the calling thread. Platform thread slots are handed out round-robin
+// as threads first ask for them so that up to MaxChunkShards threads each map to their own chunk shard.
+uint32 CmdAllocator::CurrentChunkShard() const
+{
+    return (m_numChunkShards > 1) ? (m_pDevice->GetPlatform()->GetThreadSlot() % m_numChunkShards) : 0;
+}
+
 // =====================================================================================================================
 // Obtains the next available CmdStreamChunk and returns a pointer to it.
 Result CmdAllocator::GetNewChunk(
@@ -505,95 +641,197 @@ Result CmdAllocator::GetNewChunk(
     // System memory allocations are only allowed for command data!
     PAL_ASSERT((systemMemory == false) || (allocType == CommandDataAlloc));
 
-    // If necessary, engage the chunk lock while we search for a free chunk.
+    const uint32     shardIdx = CurrentChunkShard();
+    const uint32     listIdx  = ChunkListIndex(allocType, systemMemory);
+    ChunkShard*const pShard   = &m_pChunkShards[shardIdx];
+
+    Result          result = Result::Success;
+    CmdStreamChunk* pChunk = nullptr;
+
+    // If necessary, engage our shard's lock while we search for a free chunk.
     if (m_pChunkLock != nullptr)
     {
-        m_pChunkLock->Lock();
+        pShard->lock.Lock();
     }
 
-    Result result = FindFreeChunk(systemMemory ? &m_sysAllocInfo : &m_gpuAllocInfo[allocType], ppChunk);
-    if (result == Result::Success)
+    while ((pChunk == nullptr) && (result == Result::Success))
     {
-        (*ppChunk)->AddCommandStreamReference();
+        ChunkList*const pFreeList = &pShard->freeList[listIdx];
+
+        if (pFreeList->IsEmpty() == false)
+        {
+            // Pop a chunk off of the free list because free chunks, by definition, are no longer in use by the CPU or
+            // GPU. Checking for IsIdle with automatic memory reuse disabled is undefined. The best we can do is check
+            // if it is idle on the GPU.
+            pChunk = pFreeList->Back();
+            PAL_ASSERT((AutomaticMemoryReuse() && pChunk->IsIdle()) || pChunk->IsIdleOnGpu());
+
+            // Move the chunk from the free list to the front of the busy list.
+            auto*const pNode = pChunk->ListNode();
+            pFreeList->Erase(pNode);
+            pShard->busyList[listIdx].PushFront(pNode);
+
+            pChunk->SetCacheShard(shardIdx);
+            pChunk->AddCommandStreamReference();
+        }
+        else
+        {
+            // Our cache is empty; grab a batch of chunks from the shared lists. We must not hold our shard's lock while
+            // we take the chunk lock because ReuseChunks acquires them in the opposite order.
+            ChunkList refillList;
+
+            if (m_pChunkLock != nullptr)
+            {
+                pShard->lock.Unlock();
+            }
+
+            result = RefillChunks(systemMemory ? &m_sysAllocInfo : &m_gpuAllocInfo[allocType],
+                                  listIdx,
+                                  shardIdx,
+                                  &refillList);
+
+            if (m_pChunkLock != nullptr)
+            {
+                pShard->lock.Lock();
+            }
+
+            if (refillList.IsEmpty() == false)
+            {
+                pFreeList->PushBackList(&refillList);
+            }
+        }
     }
 
     if (m_pChunkLock != nullptr)
     {
-        m_pChunkLock->Unlock();
+        pShard->lock.Unlock();
     }
 
+    *ppChunk = pChunk;
     return result;
 }
 
 // =====================================================================================================================
-// Searches the free and busy lists for a free chunk. A new CmdStreamAllocation will be created if needed.
-Result CmdAllocator::FindFreeChunk(
-    CmdAllocInfo*    pAllocInfo,
-    CmdStreamChunk** ppChunk)
+// Moves up to ChunkShardRefillSize free chunks from the shared free and reuse lists into the given list. If those are
+// empty, free chunks cached by other shards are taken instead. A new CmdStreamAllocation will be created only if no
+// chunks are available anywhere.
+Result CmdAllocator::RefillChunks(
+    CmdAllocInfo* pAllocInfo,
+    uint32        listIdx,
+    uint32        shardIdx,   // The caller's shard, which must not be locked.
+    ChunkList*    pChunks)
 {
-    Result result = Result::Success;
-    CmdStreamChunk* pChunk = nullptr;
+    Result result   = Result::Success;
+    uint32 numFound = 0;
 
-    // Search the free-list first.
-    if (pAllocInfo->freeList.IsEmpty() == false)
+    if (m_pChunkLock != nullptr)
     {
-        // Pop a chunk off of the free list because free chunks, by definition, are no longer in use by the CPU or GPU.
-        // Checking for IsIdle with automatic memory reuse disabled is undefined. The best we can do is check if it is
-        // idle on the GPU.
-        pChunk = pAllocInfo->freeList.Back();
-        PAL_ASSERT((AutomaticMemoryReuse() && pChunk->IsIdle()) || pChunk->IsIdleOnGpu());
-
-        // Move the chunk from the free list to the front of the busy list.
-        auto*const pNode = pChunk->ListNode();
-        pAllocInfo->freeList.Erase(pNode);
-        pAllocInfo->busyList.PushFront(pNode);
+        m_pChunkLock->Lock();
     }
-    else
+
+    // If our free list runs dry, check the reuse list and then try to create new chunks. Creating an allocation can
+    // fail in rare circumstances (e.g., out of GPU memory) but we do not expect it to occur.
+    for (uint32 attempt = 0; (numFound == 0) && (result == Result::Success); ++attempt)
     {
-        if (AutomaticMemoryReuse())
+        // Search the free-list first.
+        while ((numFound < ChunkShardRefillSize) && (pAllocInfo->freeList.IsEmpty() == false))
         {
-            // Search the reuse list for a chunk that expired after it was returned to us. Start at the end because
-            // those chunks have been on the list the longest and are most likely to be idle.
-            for (auto reuseIter = pAllocInfo->reuseList.End(); reuseIter.IsValid(); reuseIter.Prev())
+            auto*const pNode = pAllocInfo->freeList.Back()->ListNode();
+            pAllocInfo->freeList.Erase(pNode);
+            pChunks->PushBack(pNode);
+            numFound++;
+        }
+
+        if ((numFound == 0) && (attempt == 0))
+        {
+            if (AutomaticMemoryReuse())
             {
-                if (reuseIter.Get()->IsIdle())
+                // Search the reuse list for chunks that expired after they were returned to us. Start at the end
+                // because those chunks have been on the list the longest and are most likely to be idle.
+                for (auto reuseIter = pAllocInfo->reuseList.End();
+                     reuseIter.IsValid() && (numFound < ChunkShardRefillSize);)
                 {
-                    pChunk = reuseIter.Get();
-                    pChunk->Reset(true);
-
-                    // Move this chunk from the reuse list to the front of the busy list.
-                    auto*const pNode = pChunk->ListNode();
-                    pAllocInfo->reuseList.Erase(pNode);
-                    pAllocInfo->busyList.PushFront(pNode);
-                    break;
+                    CmdStreamChunk*const pChunk = reuseIter.Get();
+                    reuseIter.Prev();
+
+                    if (pChunk->IsIdle())
+                    {
+                        pChunk->Reset(true);
+
+                        // Move this chunk from the reuse list to the refill list.
+                        auto*const pNode = pChunk->ListNode();
+                        pAllocInfo->reuseList.Erase(pNode);
+                        pChunks->PushBack(pNode);
+                        numFound++;
+                    }
                 }
             }
-        }
 
-        if (pChunk == nullptr)
+            if (numFound == 0)
+            {
+                // Chunks freed by one thread go back to that thread's shard, so without this a thread which mostly
+                // consumes chunks would keep allocating while other shards sit on idle ones.
+                numFound = StealChunks(listIdx, shardIdx, pChunks);
+            }
+        }
+        else if (numFound == 0)
         {
-            // All busy chunks were still in-use so we must create a new ChunkAllocation. It is possible for this call
-            // to fail in rare circumstances (e.g., out of GPU memory) but we do not expect it to occur.
-            result = CreateAllocation(pAllocInfo, false, &pChunk);
+            // All busy chunks were still in-use so we must create a new ChunkAllocation.
+            result = CreateAllocation(pAllocInfo, false);
         }
     }
 
-    *ppChunk = pChunk;
+    if (m_pChunkLock != nullptr)
+    {
+        m_pChunkLock->Unlock();
+    }
+
     return result;
 }
 
 // =====================================================================================================================
-// Creates a new command stream allocation and returns one of its chunks for immediate use. If the allocation contains
-// more than one chunk the rest will be pushed onto the free chunk list.
+// Moves up to ChunkShardRefillSize free chunks from the free lists of shards other than the given one into the given
+// list. Must be called with the chunk lock held, which keeps the lock order (chunk lock, then shard lock) consistent
+// with ReuseChunks. Returns the number of chunks moved.
+uint32 CmdAllocator::StealChunks(
+    uint32     listIdx,
+    uint32     shardIdx,
+    ChunkList* pChunks)
+{
+    uint32 numFound = 0;
+
+    // Visit the other shards starting with our neighbor so that concurrent thieves don't all drain the same shard.
+    for (uint32 i = 1; (i < m_numChunkShards) && (numFound < ChunkShardRefillSize); ++i)
+    {
+        ChunkShard*const pShard    = &m_pChunkShards[(shardIdx + i) % m_numChunkShards];
+        ChunkList*const  pFreeList = &pShard->freeList[listIdx];
+
+        pShard->lock.Lock();
+
+        // The owner pops from the back of its free list, so steal from the front.
+        while ((numFound < ChunkShardRefillSize) && (pFreeList->IsEmpty() == false))
+        {
+            auto*const pNode = pFreeList->Front()->ListNode();
+            pFreeList->Erase(pNode);
+            pChunks->PushBack(pNode);
+            numFound++;
+        }
+
+        pShard->lock.Unlock();
+    }
+
+    return numFound;
+}
+
+// =====================================================================================================================
+// Creates a new command stream allocation and pushes all of its chunks onto the free chunk list.
 Result CmdAllocator::CreateAllocation(
     CmdAllocInfo*    pAllocInfo,
-    bool             dummyAlloc,
-    CmdStreamChunk** ppChunk)
+    bool             dummyAlloc)
 {
     Result result = Result::ErrorOutOfMemory;
 
     CmdStreamAllocation* pAlloc = nullptr;
-    CmdStreamChunk*      pChunk = nullptr;
 
     CmdStreamAllocationCreateInfo allocCreateInfo = pAllocInfo->allocCreateInfo;
     // dummyAlloc indicates that the new CmdStreamAllocation will get its GPU memory from device and will not own
@@ -622,17 +860,13 @@ Result CmdAllocator::CreateAllocation(
         PAL_ASSERT(result == Result::Success);
         pAllocInfo->allocList.PushBack(pAlloc->ListNode());
 
-        pChunk = pAlloc->Chunks();
-        for (uint32 idx = 1; idx < allocCreateInfo.numChunks; ++idx)
+        CmdStreamChunk*const pChunks = pAlloc->Chunks();
+        for (uint32 idx = 0; idx < allocCreateInfo.numChunks; ++idx)
         {
-            pAllocInfo->freeList.PushBack(pChunk[idx].ListNode());
+            pAllocInfo->freeList.PushBack(pChunks[idx].ListNode());
         }
-
-        // Move the first newly created chunk to the busy list.
-        pAllocInfo->busyList.PushBack(pChunk->ListNode());
     }
 
-    *ppChunk = pChunk;
     return result;
 }
 
@@ -689,8 +923,10 @@ VirtualLinearAllocator* CmdAllocator::GetNewLinearAllocator()
 
     if (m_linearAllocFreeList.IsEmpty() == false)
     {
-        // Just pop the first free allocator off of the list.
-        pAllocator = m_linearAllocFreeList.Back();
+        // Just pop the most recently returned allocator off of the list. Its pages are the most likely to still be
+        // committed and hot in the cache, and reusing the same few allocators lets the rest go idle so that they can
+        // be trimmed.
+        pAllocator = m_linearAllocFreeList.Front();
 
         // Move the allocator from the free list to the front of the busy list.
         auto*const pNode = pAllocator->GetNode();
@@ -792,7 +1028,32 @@ void CmdAllocator::LogCommit(
 }
 
 // =====================================================================================================================
-// Write the commit histograms out to the commit log.
+// Adds a command buffer's recording statistics to the totals. Only called when logCmdBufCommitSizes is true.
+void CmdAllocator::LogRecordingStats(
+    const CmdBufferRecordingStats& stats)
+{
+    PAL_ASSERT(m_pDevice->Settings().logCmdBufCommitSizes);
+
+    if (m_pChunkLock != nullptr)
+    {
+        m_pChunkLock->Lock();
+    }
+
+    m_recordingStats.cmdDwords                    += stats.cmdDwords;
+    m_recordingStats.pm4OptDwordsEliminated       += stats.pm4OptDwordsEliminated;
+    m_recordingStats.pm4OptContextRollsEliminated += stats.pm4OptContextRollsEliminated;
+    m_recordingStats.stateObjectImagesWritten     += stats.stateObjectImagesWritten;
+    m_recordingStats.stateObjectImagesSkipped     += stats.stateObjectImagesSkipped;
+    m_numRecordingsLogged++;
+
+    if (m_pChunkLock != nullptr)
+    {
+        m_pChunkLock->Unlock();
+    }
+}
+
+// =====================================================================================================================
+// Write the commit histograms, the linear allocator counters and the recording statistics out to the commit log.
 void CmdAllocator::PrintCommitLog() const
 {
     File   commitLog;
@@ -838,6 +1099,33 @@ void CmdAllocator::PrintCommitLog() const
                 result = commitLog.Printf("\n");
             }
         }
+
+        // Our linear allocators are all deleted by now, so these are the totals over this allocator's lifetime.
+        if (result == Result::Success)
+        {
+            result = commitLog.Printf("Linear Allocator Commits,%u\n"
+                                      "Linear Allocator Decommits,%u\n"
+                                      "Linear Allocator Pages Trimmed,%llu\n",
+                                      m_linearAllocStats.commitCalls,
+                                      m_linearAllocStats.decommitCalls,
+                                      m_linearAllocStats.pagesTrimmed);
+        }
+
+        if (result == Result::Success)
+        {
+            result = commitLog.Printf("Command Buffers Recorded,%llu\n"
+                                      "Command DWORDs,%llu\n"
+                                      "PM4 Optimizer DWORDs Eliminated,%llu\n"
+                                      "PM4 Optimizer Context Rolls Eliminated,%llu\n"
+                                      "State Object Images Written,%llu\n"
+                                      "State Object Images Skipped,%llu\n",
+                                      m_numRecordingsLogged,
+                                      m_recordingStats.cmdDwords,
+                                      m_recordingStats.pm4OptDwordsEliminated,
+                                      m_recordingStats.pm4OptContextRollsEliminated,
+                                      m_recordingStats.stateObjectImagesWritten,
+                                      m_recordingStats.stateObjectImagesSkipped);
+        }
     }
 
     if (result == Result::Success)
@@ -39,6 +39,21 @@ namespace Pal
 class Device;
 class Platform;
 
+// Statistics about the commands a command buffer recorded and how much work the PM4 optimizer and the state object
+// tracking saved while recording them. They're complete once the command buffer's command streams have been ended.
+struct CmdBufferRecordingStats
+{
+    gpusize cmdDwords;                    // Command DWORDs allocated across all of the command buffer's command
+                                          // streams, including chaining and padding packets.
+    uint64  pm4OptDwordsEliminated;       // Command DWORDs skipped by the PM4 optimizer.
+    uint64  pm4OptContextRollsEliminated; // Draws whose preceding context register writes were all skipped by the
+                                          // PM4 optimizer.
+    uint64  stateObjectImagesWritten;     // Color blend, depth stencil and MSAA state object images written at draw
+                                          // time because a different object of that kind was last written.
+    uint64  stateObjectImagesSkipped;     // State object images which were bound but not written at draw time
+                                          // because the same object was still programmed.
+};
+
 // =====================================================================================================================
 // The CmdAllocator class is responsible for allocating CmdStreamAllocations and managing their CmdStreamChunks.
 class CmdAllocator : public ICmdAllocator
@@ -85,6 +100,7 @@ public:
 
 #if PAL_ENABLE_PRINTS_ASSERTS
     void LogCommit(EngineType engineType, bool isConstantEngine, uint32 numDwords);
+    void LogRecordingStats(const CmdBufferRecordingStats& stats);
 #endif
 
     bool AutomaticMemoryReuse() const { return (m_flags.autoMemoryReuse != 0); }
@@ -98,22 +114,44 @@ private:
     {
         AllocList allocList; // Unordered list of allocations owned by the allocator.
         ChunkList freeList;  // Unordered list of chunks that are reset and not in use (busy-tracker indicates idle).
-        ChunkList busyList;  // Unordered list of chunks that might be waiting for their busy-tracker to indicate
-                             // that the GPU has finished processing them.
         ChunkList reuseList; // Unordered list of chunks that have been 'returned' to the allocator for reuse.
 
         // All allocations for each alloc type are identical, so we can build the create info up-front.
         CmdStreamAllocationCreateInfo allocCreateInfo;
     };
 
+    // One list per GPU memory alloc type plus one for system memory command data.
+    static constexpr uint32 ChunkListCount = CmdAllocatorTypeCount + 1;
+
+    // Chunks are handed out through shards so that threads recording on the same allocator don't all serialize on
+    // m_pChunkLock. Each thread maps to one shard, which caches a few free chunks and tracks the chunks it handed out.
+    // Shards are refilled in batches from the shared free list under m_pChunkLock, or from the other shards' free
+    // lists when the shared lists run dry. Thread-unsafe allocators use a single shard and never lock it.
+    static constexpr uint32 MaxChunkShards       = 16;
+    static constexpr uint32 ChunkShardRefillSize = 8;
+
+    struct ChunkShard
+    {
+        Util::Mutex lock;                     // Protects this shard's lists if the allocator is thread safe.
+        ChunkList   freeList[ChunkListCount]; // Reset chunks reserved for this shard's threads.
+        ChunkList   busyList[ChunkListCount]; // Chunks handed out by this shard which might be waiting for their
+                                              // busy-tracker to indicate that the GPU has finished processing them.
+    };
+
+    static uint32 ChunkListIndex(CmdAllocType allocType, bool systemMemory)
+        { return systemMemory ? CmdAllocatorTypeCount : static_cast<uint32>(allocType); }
+
     // These internal functions are used to manage all types of chunks.
-    Result FindFreeChunk(CmdAllocInfo* pAllocInfo, CmdStreamChunk** ppChunk);
-    Result CreateAllocation(CmdAllocInfo* pAllocInfo, bool dummyAlloc, CmdStreamChunk** ppChunk);
+    uint32 CurrentChunkShard() const;
+    Result RefillChunks(CmdAllocInfo* pAllocInfo, uint32 listIdx, uint32 shardIdx, ChunkList* pChunks);
+    uint32 StealChunks(uint32 listIdx, uint32 shardIdx, ChunkList* pChunks);
+    Result CreateAllocation(CmdAllocInfo* pAllocInfo, bool dummyAlloc);
     Result CreateDummyChunkAllocation();
 
     void TransferChunks(ChunkList* pFreeList, ChunkList* pSrcList);
     void FreeAllChunks();
     void FreeAllLinearAllocators();
+    void TrimLinearAllocators();
 
 #if PAL_ENABLE_PRINTS_ASSERTS
     void PrintCommitLog() const;
@@ -136,6 +174,8 @@ private:
     Util::Mutex*    m_pChunkLock;          // If non-null, this protects the allocator's command-chunk state.
     CmdAllocInfo    m_gpuAllocInfo[CmdAllocatorTypeCount];
     CmdAllocInfo    m_sysAllocInfo;
+    ChunkShard*     m_pChunkShards;        // Placed in memory immediately after this object (and its mutexes).
+    uint32          m_numChunkShards;
 
     // Most-recent paging fence value returned from the OS when allocating command-chunk allocations
     uint64          m_lastPagingFence;
@@ -144,6 +184,13 @@ private:
     LinearAllocList m_linearAllocFreeList; // Unordered list of allocators that are reset and not in use.
     LinearAllocList m_linearAllocBusyList; // Unordered list of allocators that are being used by command buffers.
 
+    // Idle linear allocator pages are decommitted once every LinearAllocTrimInterval resets if they weren't needed
+    // since the previous trim. This keeps the steady-state working set committed without pinning the memory of a
+    // one-off spike in usage forever.
+    static constexpr uint32 LinearAllocTrimInterval = 16;
+
+    uint32 m_linearAllocResetCount; // Number of resets since the linear allocators were last trimmed.
+
 #if PAL_ENABLE_PRINTS_ASSERTS
     // To help us make informed decisions about command stream use, the allocator can build histograms of commit sizes
     // and log them to a csv file on destruction. If we exclude the timer queue (no packets) and include the Constant
@@ -156,6 +203,13 @@ private:
     // be rounded up when selecting a bin as this will guarantee that the "zero" bin only holds commits of size zero.
     uint64* m_pHistograms[HistogramCount];
     uint32  m_numHistogramBins;
+
+    // Commit and decommit counters of every linear allocator this allocator has deleted, logged with the histograms.
+    Util::VirtualLinearAllocatorStats m_linearAllocStats;
+
+    // Sums of the recording statistics of every command buffer built with this allocator, logged with the histograms.
+    CmdBufferRecordingStats m_recordingStats;
+    uint64                  m_numRecordingsLogged;
 #endif
 
     // Dummy chunk used to handle cases where we've run out of GPU memory.
@@ -24,6 +24,7 @@
  **********************************************************************************************************************/
 
 #include "core/cmdBuffer.h"
+#include "core/cmdStream.h"
 #include "core/device.h"
 #include "core/gpuEvent.h"
 #include "core/platform.h"
@@ -88,6 +89,20 @@ static void PAL_STDCALL CmdDrawIndexedIndirectMultiInvalid(
     uint32            stride,
     uint32            maximumCount,
     gpusize           countGpuAddr);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+static void PAL_STDCALL CmdDrawMultiInvalid(
+    ICmdBuffer*             pCmdBuffer,
+    uint32                  drawCount,
+    const DrawIndirectArgs* pDrawArgs,
+    uint32                  userDataEntry,
+    const uint32*           pUserDataValues);
+static void PAL_STDCALL CmdDrawIndexedMultiInvalid(
+    ICmdBuffer*                    pCmdBuffer,
+    uint32                         drawCount,
+    const DrawIndexedIndirectArgs* pDrawArgs,
+    uint32                         userDataEntry,
+    const uint32*                  pUserDataValues);
+#endif
 static void PAL_STDCALL CmdDispatchInvalid(ICmdBuffer* pCmdBuffer, uint32 x, uint32 y, uint32 z);
 static void PAL_STDCALL CmdDispatchIndirectInvalid(ICmdBuffer* pCmdBuffer, const IGpuMemory& gpuMemory, gpusize offset);
 static void PAL_STDCALL CmdDispatchOffsetInvalid(
@@ -143,6 +158,10 @@ CmdBuffer::CmdBuffer(
     m_funcTable.pfnCmdDrawIndexed              = CmdDrawIndexedInvalid;
     m_funcTable.pfnCmdDrawIndirectMulti        = CmdDrawIndirectMultiInvalid;
     m_funcTable.pfnCmdDrawIndexedIndirectMulti = CmdDrawIndexedIndirectMultiInvalid;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    m_funcTable.pfnCmdDrawMulti                = CmdDrawMultiInvalid;
+    m_funcTable.pfnCmdDrawIndexedMulti         = CmdDrawIndexedMultiInvalid;
+#endif
     m_funcTable.pfnCmdDispatch                 = CmdDispatchInvalid;
     m_funcTable.pfnCmdDispatchIndirect         = CmdDispatchIndirectInvalid;
     m_funcTable.pfnCmdDispatchOffset           = CmdDispatchOffsetInvalid;
@@ -251,6 +270,19 @@ Result CmdBuffer::Begin(
                 m_buildFlags.disallowNestedLaunchViaIb2 = 0;
             }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+            if (SupportsUserDataPatching() == false)
+            {
+                m_buildFlags.enableUserDataPatching = 0;
+            }
+            else if (m_buildFlags.enableUserDataPatching == 1)
+            {
+                // Patch points are only recorded for user-data tables which are written by the CPU.  CE RAM copies
+                // would have to be patched in the CE stream instead.
+                m_buildFlags.useCpuPathForTableUpdates = 1;
+            }
+#endif
+
             // Obtain a linear allocator for this command building session. It should be impossible for us to have a
             // non-null linear allocator at this time.
             PAL_ASSERT(m_pMemAllocator == nullptr);
@@ -278,6 +310,9 @@ Result CmdBuffer::Begin(
                     (((settings.cmdBufOptimizePm4 == Pm4OptDefaultEnable) && m_buildFlags.optimizeGpuSmallBatch) ||
                      (settings.cmdBufOptimizePm4 == Pm4OptForceEnable));
 
+                // The PM4 optimizer may drop or merge the packets which hold user-data patch points.
+                cmdStreamflags.optimizeCommands &= (IsUserDataPatchingEnabled() == false);
+
                 // If the app explicitly called "reset" on this command buffer, there's no need to do another reset
                 // on the command streams.
                 result = BeginCommandStreams(cmdStreamflags, m_recordState != CmdBufferRecordState::Reset);
@@ -419,6 +454,41 @@ Result CmdBuffer::Reset(
     return m_status;
 }
 
+// =====================================================================================================================
+// Gathers the recording statistics of each of this command buffer's command streams.
+void CmdBuffer::GetRecordingStats(
+    CmdBufferRecordingStats* pStats
+    ) const
+{
+    PAL_ASSERT(pStats != nullptr);
+    memset(pStats, 0, sizeof(*pStats));
+
+    for (uint32 idx = 0; idx < NumCmdStreams(); ++idx)
+    {
+        const CmdStream*const pCmdStream = GetCmdStream(idx);
+
+        if (pCmdStream != nullptr)
+        {
+            pCmdStream->AccumulateRecordingStats(pStats);
+        }
+    }
+}
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+// =====================================================================================================================
+// Adds this command buffer's recording statistics to the totals our command allocator writes to the commit log.
+void CmdBuffer::LogRecordingStats() const
+{
+    if (m_device.Settings().logCmdBufCommitSizes)
+    {
+        CmdBufferRecordingStats stats;
+        GetRecordingStats(&stats);
+
+        m_pCmdAllocator->LogRecordingStats(stats);
+    }
+}
+#endif
+
 // =====================================================================================================================
 // Returns a new chunk by first searching the retained chunk list for a valid chunk then querying the command allocator
 // if there are no retained chunks available.
@@ -1080,6 +1150,33 @@ static void PAL_STDCALL CmdDrawIndexedIndirectMultiInvalid(
     PAL_NEVER_CALLED();
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+// =====================================================================================================================
+// Default implementation of CmdDrawMulti is unimplemented, derived CmdBuffer classes should override it if supported.
+static void PAL_STDCALL CmdDrawMultiInvalid(
+    ICmdBuffer*             pCmdBuffer,
+    uint32                  drawCount,
+    const DrawIndirectArgs* pDrawArgs,
+    uint32                  userDataEntry,
+    const uint32*           pUserDataValues)
+{
+    PAL_NEVER_CALLED();
+}
+
+// =====================================================================================================================
+// Default implementation of CmdDrawIndexedMulti is unimplemented, derived CmdBuffer classes should override it if
+// supported.
+static void PAL_STDCALL CmdDrawIndexedMultiInvalid(
+    ICmdBuffer*                    pCmdBuffer,
+    uint32                         drawCount,
+    const DrawIndexedIndirectArgs* pDrawArgs,
+    uint32                         userDataEntry,
+    const uint32*                  pUserDataValues)
+{
+    PAL_NEVER_CALLED();
+}
+#endif
+
 // =====================================================================================================================
 // Default implementation of CmdDispatch is unimplemented, derived CmdBuffer classes should override it if supported.
 void PAL_STDCALL CmdBuffer::CmdDispatchInvalid(
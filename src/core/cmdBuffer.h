@@ -190,6 +190,14 @@ public:
     virtual uint32 GetEmbeddedDataLimit() const override
         { return m_pCmdAllocator->ChunkSize(EmbeddedDataAlloc) / sizeof(uint32); }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+    virtual Result PatchUserData(
+        PipelineBindPoint bindPoint,
+        uint32            firstEntry,
+        uint32            entryCount,
+        const uint32*     pEntryValues) override { return Result::Unsupported; }
+#endif
+
     virtual void CmdBarrier(const BarrierInfo& barrierInfo) override;
 
     virtual void CmdRelease(
@@ -772,6 +780,9 @@ public:
     // Returns a pointer to the command stream specified by "cmdStreamIdx".
     virtual const CmdStream* GetCmdStream(uint32 cmdStreamIdx) const = 0;
 
+    // Gathers statistics about the commands recorded since the most recent call to Begin().
+    virtual void GetRecordingStats(CmdBufferRecordingStats* pStats) const;
+
     CmdBufferRecordState RecordState() const { return m_recordState; }
 
     QueueType       GetQueueType()      const { return m_createInfo.queueType; }
@@ -784,6 +795,11 @@ public:
     bool IsExclusiveSubmit() const { return (m_buildFlags.optimizeExclusiveSubmit != 0); }
     bool IsOneTimeSubmit() const { return (m_buildFlags.optimizeOneTimeSubmit != 0); }
     bool AllowLaunchViaIb2() const { return (m_buildFlags.disallowNestedLaunchViaIb2 == 0); }
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+    bool IsUserDataPatchingEnabled() const { return (m_buildFlags.enableUserDataPatching != 0); }
+#else
+    bool IsUserDataPatchingEnabled() const { return false; }
+#endif
 
     uint64 LastPagingFence() const { return m_lastPagingFence; }
 
@@ -832,6 +848,9 @@ protected:
     // to add as much data as needed to their respective command streams.
     virtual Result AddPostamble() { return Result::_Success; }
 
+    // Returns true if this command buffer can record user-data patch points for ICmdBuffer::PatchUserData().
+    virtual bool SupportsUserDataPatching() const { return false; }
+
     // CmdStream::Begin needs to call Begin on all command streams part-way through. Note that m_pMemAllocator will be
     // valid when this is called so it can be used to allocate temporary state objects.
     virtual Result BeginCommandStreams(CmdStreamBeginFlags cmdStreamFlags, bool doReset);
@@ -903,6 +922,10 @@ protected:
     Util::File* DumpFile() { return &m_file; }
     uint32      UniqueId() const { return m_uniqueId; }
     uint32      NumBegun() const { return m_numCmdBufsBegun; }
+
+    // Adds this command buffer's recording statistics to the commit log if logCmdBufCommitSizes is enabled. Must be
+    // called after the command streams have been ended.
+    void LogRecordingStats() const;
 #endif
 
     const CmdBufferCreateInfo     m_createInfo;
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include "core/cmdAllocator.h"
 #include "core/cmdStreamAllocation.h"
 #include "core/platform.h"
 #include "core/g_palSettings.h"
@@ -241,10 +242,15 @@ public:
 
     ChunkRefList::Iter GetFwdIterator() const { return m_chunkList.Begin(); }
     CmdStreamChunk*    GetFirstChunk()  const { return m_chunkList.Front(); }
+    CmdStreamChunk*    GetLastChunk()   const { return m_chunkList.Back(); }
 
     // An upper-bound on all allocated command chunk space. Can be called on a finalized command stream.
     gpusize TotalChunkDwords() const { return m_totalChunkDwords; }
 
+    // Adds this command stream's recording statistics to pStats. Can be called on a finalized command stream.
+    virtual void AccumulateRecordingStats(CmdBufferRecordingStats* pStats) const
+        { pStats->cmdDwords += m_totalChunkDwords; }
+
     // Returns whether PM4 optimizer is enabled or not
     bool Pm4OptimizerEnabled() const { return m_flags.optimizeCommands; }
 
@@ -215,6 +215,7 @@ CmdStreamChunk::CmdStreamChunk(
     m_offset(byteOffset),
     m_referenceCount(0),
     m_generation(0),
+    m_cacheShard(0),
     m_usedDataSizeDwords(0),
     m_cmdDwordsToExecute(0),
     m_cmdDwordsToExecuteNoPostamble(0),
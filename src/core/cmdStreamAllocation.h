@@ -154,6 +154,11 @@ public:
 
     ChunkList::Node* ListNode() { return &m_parentNode; }
 
+    // The index of the CmdAllocator chunk shard whose busy list currently owns this chunk.
+    // NOTE: Outside of this class, this can only be called by the thread-safe logic within a command allocator.
+    uint32 CacheShard() const { return m_cacheShard; }
+    void SetCacheShard(uint32 shard) { m_cacheShard = shard; }
+
     const uint32* PeekNextCommandAddr() const { return &m_pWriteAddr[m_usedDataSizeDwords]; }
 
     GpuMemory* GpuMemory() const { return m_allocation.GpuMemory(); }
@@ -233,6 +238,9 @@ private:
     // counter doesn't need to be volatile because it is only accessed within the allocator's thread-safe logic.
     uint32 m_generation;
 
+    // The command allocator hands out chunks from per-thread shards; this remembers which shard this chunk came from.
+    uint32 m_cacheShard;
+
     struct
     {
         // The "root" chunk in any command buffer is the first chunk in that buffer. The root chunk contains the GPU
@@ -36,15 +36,18 @@
 #include "core/queue.h"
 #include "core/settingsLoader.h"
 #include "core/hw/gfxip/gfxDevice.h"
+#include "core/hw/gfxip/pipeline.h"
 #include "core/hw/ossip/ossDevice.h"
 #include "core/addrMgr/addrMgr.h"
 #include "core/svmMgr.h"
+#include "palElfCache.h"
 #include "palFormatInfo.h"
 #include "palHashMapImpl.h"
 #include "palIntrusiveListImpl.h"
 #include "palPipeline.h"
 #include "palSysUtil.h"
 #include "palTextWriterImpl.h"
+#include "palThread.h"
 
 #include <limits.h>
 
@@ -213,6 +216,8 @@ Device::Device(
     m_pOssDevice(nullptr),
     m_pTextWriter(nullptr),
     m_devDriverClientId(0),
+    m_pElfCache(nullptr),
+    m_elfCacheBuildId(0),
     m_pFormatPropertiesTable(nullptr),
     m_perPipelineBindPointGds(false),
 #if PAL_ENABLE_PRINTS_ASSERTS
@@ -336,6 +341,11 @@ Result Device::Cleanup()
         PAL_SAFE_DELETE(m_pTextWriter, m_pPlatform);
     }
 
+    if (m_pElfCache != nullptr)
+    {
+        PAL_SAFE_DELETE(m_pElfCache, m_pPlatform);
+    }
+
     for (uint32 engineType = 0; engineType < EngineTypeCount; engineType++)
     {
         PAL_SAFE_DELETE(m_pDummyCommandStreams[engineType], m_pPlatform);
@@ -1422,6 +1432,11 @@ Result Device::Finalize(
         result        = (m_pTextWriter != nullptr) ? m_pTextWriter->Init() : Result::ErrorOutOfMemory;
     }
 
+    if (result == Result::Success)
+    {
+        InitElfCache();
+    }
+
     m_texOptLevel = finalizeInfo.internalTexOptLevel;
 
 #if PAL_ENABLE_PRINTS_ASSERTS
@@ -1519,6 +1534,56 @@ Result Device::CreateEngine(
     return result;
 }
 
+// =====================================================================================================================
+// Opens the on-disk cache of parsed pipeline ELF metadata if the client enabled the on-disk shader cache. The cache is
+// only an optimization, so failing to open it is not an error.
+void Device::InitElfCache()
+{
+    const PalSettings& settings = Settings();
+
+    // Cached entries are only valid for the build of PAL which stored them. The build is identified by the linker's
+    // build ID of the binary PAL is part of, so the cache is skipped if the binary doesn't have one.
+    uint8      buildId[64] = {};
+    uint32     buildIdSize = sizeof(buildId);
+    const bool haveBuildId = (GetCurrentModuleBuildId(&buildId[0], &buildIdSize) == Result::Success);
+
+    if ((m_pElfCache == nullptr)                                 &&
+        haveBuildId                                              &&
+        (settings.elfCacheMaxSizeMb > 0)                         &&
+        (settings.elfCacheMaxEntries > 0)                        &&
+        (m_publicSettings.shaderCacheMode == ShaderCacheOnDisk) &&
+        (m_cacheFilePath[0] != '\0'))
+    {
+        MetroHash64 hasher;
+        hasher.Update(PAL_INTERFACE_MAJOR_VERSION);
+        hasher.Update(PAL_INTERFACE_MINOR_VERSION);
+        hasher.Update(&buildId[0], buildIdSize);
+        hasher.Finalize(reinterpret_cast<uint8*>(&m_elfCacheBuildId));
+
+        m_pElfCache = PAL_NEW(Util::ElfCache, m_pPlatform, AllocInternal);
+
+        if (m_pElfCache != nullptr)
+        {
+            char directory[MaxPathStrLen];
+            Snprintf(&directory[0], sizeof(directory), "%s/AMD/PalElfCache", &m_cacheFilePath[0]);
+
+            Util::ElfCacheCreateInfo createInfo = {};
+            createInfo.pDirectory  = &directory[0];
+            createInfo.pName       = "metadata";
+            createInfo.maxDataSize = static_cast<uint64>(settings.elfCacheMaxSizeMb) * 1024 * 1024;
+            createInfo.maxEntries  = settings.elfCacheMaxEntries;
+
+            const Result result = m_pElfCache->Init(createInfo);
+
+            if (result != Result::Success)
+            {
+                PAL_ALERT_ALWAYS();
+                PAL_SAFE_DELETE(m_pElfCache, m_pPlatform);
+            }
+        }
+    }
+}
+
 // =====================================================================================================================
 // This helper function allows us to create Dummy Command Streams (Filled with NOP) for ip-specific engines
 Result Device::CreateDummyCommandStreams()
@@ -3375,6 +3440,155 @@ Result Device::CreateGraphicsPipeline(
             Result::ErrorUnavailable;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 487
+// =====================================================================================================================
+// Shared state of the threads which create the pipelines of a single CreateGraphicsPipelines() call.
+struct GraphicsPipelineBatchJob
+{
+    GfxDevice*                         pGfxDevice;
+    GraphicsPipelineInternalCreateInfo internalInfo;
+    uint32                             count;
+    const GraphicsPipelineCreateInfo*  pCreateInfos;
+    void*const*                        ppPlacementAddrs;
+    IPipeline**                        ppPipelines;
+    Result*                            pResults;
+    volatile uint32                    nextIndex;     // Index of the next pipeline which no thread has started on.
+};
+
+// =====================================================================================================================
+// Thread function which creates pipelines of a batch until there are none left.  Pipelines are handed out one at a
+// time because their creation times vary a lot.
+static void CreateGraphicsPipelinesThread(
+    void* pJobData)
+{
+    auto*const pJob = static_cast<GraphicsPipelineBatchJob*>(pJobData);
+
+    // AtomicIncrement returns the incremented value, so every thread claims the index just below it.
+    for (uint32 i = AtomicIncrement(&pJob->nextIndex) - 1; i < pJob->count; i = AtomicIncrement(&pJob->nextIndex) - 1)
+    {
+        pJob->ppPipelines[i] = nullptr;
+        pJob->pResults[i]    = pJob->pGfxDevice->CreateGraphicsPipeline(pJob->pCreateInfos[i],
+                                                                        pJob->internalInfo,
+                                                                        pJob->ppPlacementAddrs[i],
+                                                                        pJob->pCreateInfos[i].flags.clientInternal,
+                                                                        &pJob->ppPipelines[i]);
+    }
+}
+
+// =====================================================================================================================
+// Creates and initializes a batch of graphics pipelines, spreading them across the calling thread and the platform's
+// worker pool.
+Result Device::CreateGraphicsPipelines(
+    uint32                            count,
+    const GraphicsPipelineCreateInfo* pCreateInfos,
+    void*const*                       ppPlacementAddrs,
+    IPipeline**                       ppPipelines,
+    Result*                           pResults,
+    PipelineBatchStats*               pStats)
+{
+    const int64 startTime = GetPerfCpuTime();
+
+    if (pStats != nullptr)
+    {
+        memset(pStats, 0, sizeof(*pStats));
+    }
+
+    Result result = Result::Success;
+
+    if (m_pGfxDevice == nullptr)
+    {
+        result = Result::ErrorUnavailable;
+    }
+    else if ((count > 0) && ((pCreateInfos == nullptr) || (ppPlacementAddrs == nullptr) || (ppPipelines == nullptr)))
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+
+    uint32 threadCount = Settings().pipelineBatchThreadCount;
+    if (threadCount == 0)
+    {
+        SystemInfo systemInfo = { };
+        threadCount = (QuerySystemInfo(&systemInfo) == Result::Success) ? systemInfo.cpuLogicalCoreCount : 1;
+    }
+
+    // Waking a worker costs far less than creating a pipeline, but a tiny batch still isn't worth splitting up.
+    constexpr uint32 MinPipelinesPerThread = 2;
+    threadCount = Max(Min(threadCount, count / MinPipelinesPerThread), 1u);
+
+    PipelineCreateBatch batch(this);
+    Result*             pResultsAlloc = nullptr;
+
+    if (result == Result::Success)
+    {
+        result = batch.Init();
+    }
+
+    if ((result == Result::Success) && (pResults == nullptr) && (count > 0))
+    {
+        pResultsAlloc = PAL_NEW_ARRAY(Result, count, GetPlatform(), AllocInternalTemp);
+        pResults      = pResultsAlloc;
+
+        if (pResults == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        GraphicsPipelineBatchJob job = { };
+        job.pGfxDevice                = m_pGfxDevice;
+        job.internalInfo.pCreateBatch = &batch;
+        job.count                     = count;
+        job.pCreateInfos              = pCreateInfos;
+        job.ppPlacementAddrs          = ppPlacementAddrs;
+        job.ppPipelines               = ppPipelines;
+        job.pResults                  = pResults;
+        job.nextIndex                 = 0;
+
+        threadCount = GetPlatform()->GetWorkerPool()->Run(&CreateGraphicsPipelinesThread, &job, threadCount);
+
+        if (pStats != nullptr)
+        {
+            batch.GetStats(pStats);
+            pStats->threadCount = threadCount;
+        }
+
+        batch.UnmapAll();
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            if (pResults[i] != Result::Success)
+            {
+                result = pResults[i];
+                break;
+            }
+        }
+    }
+    else if (ppPipelines != nullptr)
+    {
+        for (uint32 i = 0; i < count; ++i)
+        {
+            ppPipelines[i] = nullptr;
+
+            if (pResults != nullptr)
+            {
+                pResults[i] = result;
+            }
+        }
+    }
+
+    PAL_SAFE_DELETE_ARRAY(pResultsAlloc, GetPlatform());
+
+    if (pStats != nullptr)
+    {
+        pStats->wallTime = PerfTicksToNanoseconds(GetPerfCpuTime() - startTime);
+    }
+
+    return result;
+}
+#endif
+
 // =====================================================================================================================
 // Determine if hardware accelerated stereo rendering can be enabled for given graphic pipeline.
 bool Device::DetermineHwStereoRenderingSupported(
@@ -47,6 +47,7 @@ typedef void* ADDR_HANDLE;
 
 namespace Util { enum class ValueType : uint32; }
 namespace Util { namespace MetroHash { struct Hash; } }
+namespace Util { class ElfCache; }
 
 namespace Pal
 {
@@ -1181,6 +1182,17 @@ public:
         void*                             pPlacementAddr,
         IPipeline**                       ppPipeline) override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 487
+    // NOTE: Part of the public IDevice interface.
+    virtual Result CreateGraphicsPipelines(
+        uint32                            count,
+        const GraphicsPipelineCreateInfo* pCreateInfos,
+        void*const*                       ppPlacementAddrs,
+        IPipeline**                       ppPipelines,
+        Result*                           pResults,
+        PipelineBatchStats*               pStats) override;
+#endif
+
     // NOTE: Part of the public IDevice interface.
     virtual size_t GetMsaaStateSize(
         const MsaaStateCreateInfo& createInfo,
@@ -1480,6 +1492,11 @@ public:
 
     Platform* GetPlatform() const;
 
+    // Returns the on-disk cache of parsed pipeline ELF metadata, or null if it is disabled.
+    Util::ElfCache* GetElfCache() const { return m_pElfCache; }
+    // Identifies this build of PAL to the ELF metadata cache.  Only meaningful if GetElfCache() is not null.
+    uint64 ElfCacheBuildId() const { return m_elfCacheBuildId; }
+
     ADDR_HANDLE AddrLibHandle() const { return GetAddrMgr()->AddrLibHandle(); }
 
     const GdsInfo& GdsInfo(EngineType engineType, uint32 queueIndex) const
@@ -1773,6 +1790,8 @@ protected:
 
     GpuUtil::TextWriter<Platform>*     m_pTextWriter;
     uint32                             m_devDriverClientId;
+    Util::ElfCache*                    m_pElfCache;
+    uint64                             m_elfCacheBuildId;
 
     FlglState                          m_flglState;
 
@@ -1842,6 +1861,7 @@ private:
 
     Result CreateEngines(const DeviceFinalizeInfo& finalizeInfo);
 
+    void   InitElfCache();
     Result CreateDummyCommandStreams();
 
     uint64 GetTimeoutValueInNs(uint64  appTimeoutInNs) const;
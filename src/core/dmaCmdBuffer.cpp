@@ -163,6 +163,8 @@ Result DmaCmdBuffer::End()
     {
 
 #if PAL_ENABLE_PRINTS_ASSERTS
+        LogRecordingStats();
+
         if (IsDumpingEnabled() && DumpFile()->IsOpen())
         {
             if (m_pDevice->Settings().cmdBufDumpFormat == CmdBufDumpFormatBinaryHeaders)
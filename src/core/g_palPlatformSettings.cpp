@@ -105,6 +105,7 @@ void PlatformSettingsLoader::SetupDefaults()
     m_settings.gpuProfilerConfig.recordPipelineStats = false;
     m_settings.gpuProfilerConfig.breakSubmitBatches = false;
     m_settings.gpuProfilerConfig.traceModeMask = 0x0;
+    m_settings.gpuProfilerConfig.binaryOutput = false;
     memset(m_settings.gpuProfilerPerfCounterConfig.globalPerfCounterConfigFile, 0, 256);
     strncpy(m_settings.gpuProfilerPerfCounterConfig.globalPerfCounterConfigFile, "", 256);
     m_settings.gpuProfilerPerfCounterConfig.cacheFlushOnCounterCollection = false;
@@ -141,6 +142,10 @@ void PlatformSettingsLoader::SetupDefaults()
     m_settings.interfaceLoggerConfig.multithreaded = false;
     m_settings.interfaceLoggerConfig.basePreset = 0x7;
     m_settings.interfaceLoggerConfig.elevatedPreset = 0x1f;
+    m_settings.interfaceLoggerConfig.asyncBufferCount = 16;
+    m_settings.interfaceLoggerConfig.crashSafeFlush = false;
+    m_settings.interfaceLoggerConfig.binaryCapture = false;
+    m_settings.slabAllocatorEnabled = false;
 
     m_settings.numSettings = g_palPlatformNumSettings;
 }
@@ -370,6 +375,11 @@ void PlatformSettingsLoader::ReadSettings(Pal::Device* pDevice)
                            &m_settings.gpuProfilerConfig.traceModeMask,
                            InternalSettingScope::PrivatePalKey);
 
+    pDevice->ReadSetting(pGpuProfilerConfig_BinaryOutputStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.gpuProfilerConfig.binaryOutput,
+                           InternalSettingScope::PrivatePalKey);
+
     pDevice->ReadSetting(pGpuProfilerPerfCounterConfig_GlobalPerfCounterConfigFileStr,
                            Util::ValueType::Str,
                            &m_settings.gpuProfilerPerfCounterConfig.globalPerfCounterConfigFile,
@@ -538,6 +548,26 @@ void PlatformSettingsLoader::ReadSettings(Pal::Device* pDevice)
                            &m_settings.interfaceLoggerConfig.elevatedPreset,
                            InternalSettingScope::PrivatePalKey);
 
+    pDevice->ReadSetting(pInterfaceLoggerConfig_AsyncBufferCountStr,
+                           Util::ValueType::Uint,
+                           &m_settings.interfaceLoggerConfig.asyncBufferCount,
+                           InternalSettingScope::PrivatePalKey);
+
+    pDevice->ReadSetting(pInterfaceLoggerConfig_CrashSafeFlushStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.interfaceLoggerConfig.crashSafeFlush,
+                           InternalSettingScope::PrivatePalKey);
+
+    pDevice->ReadSetting(pInterfaceLoggerConfig_BinaryCaptureStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.interfaceLoggerConfig.binaryCapture,
+                           InternalSettingScope::PrivatePalKey);
+
+    pDevice->ReadSetting(pSlabAllocatorEnabledStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.slabAllocatorEnabled,
+                           InternalSettingScope::PrivatePalKey);
+
 }
 
 // =====================================================================================================================
@@ -754,6 +784,11 @@ void PlatformSettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.gpuProfilerConfig.traceModeMask);
     m_settingsInfoMap.Insert(2733188403, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.gpuProfilerConfig.binaryOutput;
+    info.valueSize = sizeof(m_settings.gpuProfilerConfig.binaryOutput);
+    m_settingsInfoMap.Insert(535220987, info);
+
     info.type      = SettingType::String;
     info.pValuePtr = &m_settings.gpuProfilerPerfCounterConfig.globalPerfCounterConfigFile;
     info.valueSize = sizeof(m_settings.gpuProfilerPerfCounterConfig.globalPerfCounterConfigFile);
@@ -919,6 +954,26 @@ void PlatformSettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.interfaceLoggerConfig.elevatedPreset);
     m_settingsInfoMap.Insert(4040226650, info);
 
+    info.type      = SettingType::Uint;
+    info.pValuePtr = &m_settings.interfaceLoggerConfig.asyncBufferCount;
+    info.valueSize = sizeof(m_settings.interfaceLoggerConfig.asyncBufferCount);
+    m_settingsInfoMap.Insert(3474385318, info);
+
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.interfaceLoggerConfig.crashSafeFlush;
+    info.valueSize = sizeof(m_settings.interfaceLoggerConfig.crashSafeFlush);
+    m_settingsInfoMap.Insert(2240106715, info);
+
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.interfaceLoggerConfig.binaryCapture;
+    info.valueSize = sizeof(m_settings.interfaceLoggerConfig.binaryCapture);
+    m_settingsInfoMap.Insert(1105727656, info);
+
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.slabAllocatorEnabled;
+    info.valueSize = sizeof(m_settings.slabAllocatorEnabled);
+    m_settingsInfoMap.Insert(1395659347, info);
+
 }
 
 // =====================================================================================================================
@@ -940,9 +995,9 @@ void PlatformSettingsLoader::DevDriverRegister()
             component.pfnSetValue = ISettingsLoader::SetValue;
             component.pSettingsData = &g_palPlatformJsonData[0];
             component.settingsDataSize = sizeof(g_palPlatformJsonData);
-            component.settingsDataHash = 2888708906;
-            component.settingsDataHeader.isEncoded = true;
-            component.settingsDataHeader.magicBufferId = 402778310;
+            component.settingsDataHash = 0;
+            component.settingsDataHeader.isEncoded = false;
+            component.settingsDataHeader.magicBufferId = 0;
             component.settingsDataHeader.magicBufferOffset = 0;
 
             pSettingsService->RegisterComponent(component);
@@ -143,6 +143,7 @@ struct PalPlatformSettings : public Pal::DriverSettings
         bool                              recordPipelineStats;
         bool                              breakSubmitBatches;
         uint32                            traceModeMask;
+        bool                              binaryOutput;
     } gpuProfilerConfig;
     struct {
         char                              globalPerfCounterConfigFile[MaxFileNameStrLen];
@@ -186,7 +187,11 @@ struct PalPlatformSettings : public Pal::DriverSettings
         bool                              multithreaded;
         uint32                            basePreset;
         uint32                            elevatedPreset;
+        uint32                            asyncBufferCount;
+        bool                              crashSafeFlush;
+        bool                              binaryCapture;
     } interfaceLoggerConfig;
+    bool                              slabAllocatorEnabled;
 
 };
 #if PAL_ENABLE_PRINTS_ASSERTS
@@ -250,6 +255,7 @@ static const char* pGpuProfilerConfig_FrameCountStr = "#3899735123";
 static const char* pGpuProfilerConfig_RecordPipelineStatsStr = "#3225763835";
 static const char* pGpuProfilerConfig_BreakSubmitBatchesStr = "#3699637222";
 static const char* pGpuProfilerConfig_TraceModeMaskStr = "#2733188403";
+static const char* pGpuProfilerConfig_BinaryOutputStr = "#535220987";
 static const char* pGpuProfilerPerfCounterConfig_GlobalPerfCounterConfigFileStr = "#2182449032";
 static const char* pGpuProfilerPerfCounterConfig_CacheFlushOnCounterCollectionStr = "#1201772335";
 static const char* pGpuProfilerPerfCounterConfig_GranularityStr = "#3414628368";
@@ -283,8 +289,12 @@ static const char* pInterfaceLoggerConfig_LogDirectoryStr = "#885284478";
 static const char* pInterfaceLoggerConfig_MultithreadedStr = "#800910225";
 static const char* pInterfaceLoggerConfig_BasePresetStr = "#2924533825";
 static const char* pInterfaceLoggerConfig_ElevatedPresetStr = "#4040226650";
+static const char* pInterfaceLoggerConfig_AsyncBufferCountStr = "#3474385318";
+static const char* pInterfaceLoggerConfig_CrashSafeFlushStr = "#2240106715";
+static const char* pInterfaceLoggerConfig_BinaryCaptureStr = "#1105727656";
+static const char* pSlabAllocatorEnabledStr = "#1395659347";
 
-static const uint32 g_palPlatformNumSettings = 74;
+static const uint32 g_palPlatformNumSettings = 79;
 static const SettingNameHash g_palPlatformSettingHashList[] = {
 #if PAL_ENABLE_PRINTS_ASSERTS
 3336086055,
@@ -347,6 +357,7 @@ static const SettingNameHash g_palPlatformSettingHashList[] = {
 3225763835,
 3699637222,
 2733188403,
+535220987,
 2182449032,
 1201772335,
 3414628368,
@@ -380,2093 +391,1991 @@ static const SettingNameHash g_palPlatformSettingHashList[] = {
 800910225,
 2924533825,
 4040226650,
+3474385318,
+2240106715,
+1105727656,
+1395659347,
 
 };
 
 static const uint8 g_palPlatformJsonData[] = {
-    26, 210, 55, 147, 78, 111, 96, 105, 135, 206, 59, 11, 175, 26, 113, 216, 199, 159, 198, 36, 51, 254, 113, 108, 73,
-    48, 7, 110, 248, 62, 48, 97, 103, 89, 138, 93, 241, 99, 77, 79, 211, 26, 67, 213, 32, 1, 164, 201, 234, 235, 230,
-    100, 118, 110, 13, 82, 172, 75, 41, 46, 152, 137, 208, 11, 154, 116, 11, 151, 103, 95, 247, 34, 5, 65, 6, 1, 201,
-    240, 159, 130, 12, 179, 137, 50, 135, 21, 164, 238, 253, 29, 48, 226, 37, 73, 189, 8, 78, 92, 160, 219, 167, 117,
-    22, 10, 176, 34, 129, 24, 185, 92, 210, 223, 70, 137, 97, 240, 30, 138, 231, 111, 247, 159, 190, 14, 137, 80, 210,
-    217, 9, 158, 29, 122, 197, 248, 91, 221, 221, 218, 80, 149, 249, 180, 180, 141, 137, 125, 76, 37, 220, 117, 106,
-    171, 148, 153, 189, 160, 246, 119, 110, 137, 235, 72, 236, 226, 189, 89, 174, 96, 110, 192, 130, 33, 199, 75, 108,
-    77, 218, 150, 231, 244, 16, 16, 145, 212, 166, 84, 158, 129, 158, 149, 131, 74, 229, 184, 129, 99, 194, 98, 82, 147,
-    15, 164, 151, 201, 205, 156, 222, 183, 176, 59, 255, 166, 217, 102, 99, 232, 114, 221, 82, 192, 12, 145, 165, 161,
-    63, 71, 28, 215, 119, 171, 12, 156, 29, 101, 106, 8, 145, 52, 202, 137, 54, 221, 77, 0, 89, 85, 19, 27, 255, 107,
-    226, 168, 179, 115, 181, 184, 218, 137, 42, 31, 162, 189, 153, 192, 246, 186, 23, 27, 222, 134, 31, 80, 240, 247,
-    40, 49, 205, 133, 73, 96, 7, 65, 127, 237, 121, 58, 172, 78, 123, 33, 108, 130, 221, 48, 244, 94, 112, 202, 97, 147,
-    173, 54, 199, 168, 17, 54, 68, 98, 18, 93, 228, 75, 55, 225, 189, 54, 83, 18, 105, 88, 22, 24, 177, 231, 135, 242,
-    134, 197, 217, 5, 70, 146, 147, 182, 106, 136, 52, 109, 229, 26, 185, 184, 133, 19, 85, 116, 141, 132, 6, 210, 125,
-    107, 73, 213, 153, 222, 31, 16, 85, 9, 76, 238, 191, 8, 31, 55, 125, 251, 168, 99, 97, 169, 91, 141, 137, 145, 127,
-    6, 79, 59, 58, 87, 166, 117, 69, 130, 161, 53, 35, 215, 28, 200, 253, 241, 235, 11, 192, 152, 97, 48, 185, 78, 175,
-    1, 68, 111, 161, 86, 70, 30, 118, 73, 157, 77, 181, 172, 214, 37, 209, 245, 23, 54, 79, 53, 60, 55, 68, 172, 120,
-    231, 40, 42, 220, 78, 136, 144, 183, 88, 159, 156, 239, 149, 20, 215, 136, 112, 199, 61, 169, 63, 12, 206, 54, 98,
-    95, 163, 110, 233, 19, 75, 147, 176, 229, 62, 130, 157, 144, 2, 206, 189, 152, 181, 212, 169, 100, 77, 203, 42, 217,
-    124, 227, 222, 160, 236, 203, 232, 6, 85, 92, 123, 53, 112, 206, 217, 229, 30, 172, 34, 66, 102, 115, 106, 228, 118,
-    8, 99, 217, 136, 83, 116, 247, 238, 198, 149, 251, 8, 49, 182, 9, 249, 138, 217, 139, 49, 248, 157, 72, 48, 34, 165,
-    166, 149, 1, 71, 96, 86, 150, 238, 165, 3, 160, 144, 219, 173, 41, 73, 228, 50, 231, 36, 187, 242, 60, 165, 54, 171,
-    221, 121, 142, 168, 233, 84, 97, 51, 74, 210, 114, 84, 62, 247, 33, 168, 199, 137, 4, 163, 198, 34, 238, 33, 72, 70,
-    199, 158, 100, 108, 21, 1, 200, 156, 179, 149, 74, 224, 92, 40, 181, 126, 229, 86, 197, 71, 208, 95, 85, 14, 54, 56,
-    63, 90, 106, 83, 156, 0, 151, 100, 13, 14, 174, 56, 119, 31, 69, 124, 189, 199, 219, 72, 175, 190, 177, 208, 215,
-    194, 87, 44, 208, 91, 242, 129, 167, 157, 119, 69, 212, 88, 47, 133, 125, 234, 0, 185, 83, 68, 82, 247, 111, 136,
-    225, 26, 88, 103, 143, 176, 109, 18, 207, 133, 149, 98, 181, 125, 172, 12, 145, 162, 92, 180, 98, 106, 40, 156, 79,
-    85, 146, 39, 184, 156, 177, 241, 185, 227, 175, 129, 174, 178, 135, 15, 95, 9, 22, 33, 137, 226, 153, 95, 17, 23,
-    14, 177, 79, 4, 247, 169, 112, 66, 45, 217, 10, 235, 183, 216, 58, 45, 235, 252, 217, 166, 243, 122, 224, 169, 220,
-    36, 95, 215, 177, 152, 84, 52, 196, 124, 228, 198, 91, 228, 22, 206, 148, 185, 251, 239, 71, 207, 135, 104, 121, 31,
-    4, 169, 19, 176, 45, 174, 49, 54, 232, 0, 152, 28, 5, 12, 147, 41, 234, 236, 212, 177, 224, 143, 245, 159, 25, 21,
-    115, 239, 106, 245, 108, 5, 47, 60, 254, 135, 225, 84, 220, 221, 187, 0, 15, 103, 213, 229, 155, 153, 44, 130, 207,
-    143, 98, 2, 233, 61, 210, 10, 218, 0, 161, 100, 158, 254, 107, 13, 218, 54, 133, 8, 208, 206, 218, 70, 33, 110, 15,
-    66, 44, 21, 97, 204, 180, 42, 10, 102, 29, 120, 193, 141, 174, 42, 67, 199, 153, 194, 145, 3, 187, 111, 38, 89, 233,
-    14, 182, 71, 178, 64, 101, 1, 19, 97, 130, 192, 89, 212, 230, 99, 208, 60, 42, 129, 50, 156, 67, 178, 77, 119, 234,
-    8, 157, 27, 91, 242, 223, 128, 165, 208, 65, 35, 129, 157, 59, 61, 162, 48, 112, 4, 217, 231, 96, 210, 246, 253, 31,
-    66, 94, 62, 251, 15, 48, 105, 99, 142, 206, 75, 73, 81, 60, 6, 134, 159, 212, 52, 230, 85, 9, 248, 25, 2, 165, 4,
-    187, 68, 18, 170, 232, 254, 218, 85, 136, 131, 112, 174, 148, 164, 160, 190, 235, 204, 238, 151, 217, 33, 112, 217,
-    52, 82, 216, 184, 9, 181, 51, 1, 91, 97, 17, 246, 143, 214, 179, 208, 118, 24, 64, 186, 126, 138, 225, 137, 135,
-    196, 181, 204, 200, 173, 230, 67, 51, 148, 246, 221, 169, 166, 156, 225, 123, 62, 141, 73, 221, 91, 245, 74, 176,
-    253, 216, 116, 38, 141, 33, 197, 144, 224, 155, 105, 8, 116, 223, 244, 139, 100, 178, 223, 188, 127, 63, 188, 127,
-    204, 75, 45, 78, 38, 123, 188, 40, 209, 58, 209, 205, 39, 51, 137, 83, 123, 188, 249, 215, 80, 152, 24, 166, 105,
-    111, 145, 146, 86, 104, 181, 241, 148, 38, 85, 27, 51, 45, 198, 62, 235, 13, 38, 163, 228, 76, 104, 140, 34, 22,
-    120, 79, 250, 215, 19, 217, 169, 6, 114, 153, 117, 157, 190, 237, 207, 164, 183, 115, 231, 93, 69, 199, 52, 179,
-    220, 162, 99, 207, 104, 131, 116, 253, 173, 11, 129, 181, 66, 82, 197, 167, 71, 112, 224, 66, 34, 244, 104, 6, 189,
-    10, 178, 248, 187, 148, 174, 18, 122, 69, 170, 200, 126, 79, 251, 128, 189, 216, 45, 70, 53, 95, 19, 90, 59, 138,
-    88, 136, 213, 255, 206, 151, 46, 231, 223, 112, 141, 132, 208, 37, 220, 153, 109, 31, 77, 5, 38, 144, 235, 72, 114,
-    140, 159, 87, 187, 97, 216, 179, 138, 63, 110, 106, 148, 244, 248, 93, 243, 73, 115, 200, 37, 87, 7, 91, 120, 187,
-    94, 122, 77, 231, 212, 197, 251, 207, 192, 74, 140, 183, 49, 34, 9, 23, 210, 140, 121, 191, 59, 107, 86, 24, 188,
-    51, 177, 78, 170, 29, 237, 210, 21, 54, 214, 65, 117, 243, 208, 18, 98, 237, 31, 25, 141, 182, 250, 76, 152, 116,
-    242, 184, 154, 184, 156, 168, 114, 219, 51, 53, 23, 141, 195, 168, 166, 195, 156, 148, 45, 192, 157, 155, 217, 129,
-    80, 32, 6, 93, 18, 221, 73, 57, 90, 155, 181, 125, 239, 162, 159, 215, 14, 51, 104, 209, 132, 179, 140, 151, 178,
-    186, 211, 137, 190, 190, 29, 57, 207, 179, 181, 52, 178, 109, 155, 200, 112, 37, 231, 92, 10, 25, 32, 23, 112, 154,
-    238, 94, 85, 0, 210, 16, 102, 68, 143, 62, 197, 56, 240, 45, 22, 134, 14, 2, 37, 168, 181, 92, 26, 135, 116, 8, 99,
-    218, 209, 27, 80, 197, 211, 81, 77, 77, 234, 99, 224, 179, 8, 12, 40, 230, 232, 174, 229, 205, 97, 223, 119, 15, 38,
-    158, 148, 221, 163, 17, 197, 2, 54, 111, 177, 217, 205, 160, 240, 80, 28, 48, 134, 161, 168, 216, 241, 201, 127, 43,
-    187, 55, 33, 223, 166, 25, 74, 155, 125, 74, 18, 152, 177, 70, 203, 79, 144, 228, 162, 165, 250, 220, 174, 120, 100,
-    17, 64, 146, 15, 110, 84, 218, 94, 172, 243, 90, 233, 86, 247, 250, 28, 50, 27, 105, 143, 64, 130, 215, 240, 88,
-    140, 172, 243, 120, 40, 43, 151, 12, 98, 150, 162, 11, 85, 91, 123, 174, 158, 15, 15, 188, 226, 216, 136, 8, 142,
-    130, 19, 197, 149, 204, 171, 64, 88, 18, 146, 30, 0, 254, 213, 44, 72, 250, 121, 42, 64, 86, 219, 132, 148, 130,
-    147, 132, 8, 9, 79, 204, 6, 225, 9, 116, 228, 168, 183, 153, 226, 57, 250, 129, 23, 154, 15, 203, 194, 215, 25, 235,
-    241, 248, 84, 9, 191, 71, 237, 131, 65, 139, 208, 225, 131, 184, 66, 103, 195, 55, 57, 110, 86, 196, 35, 131, 246,
-    30, 38, 215, 137, 23, 215, 68, 166, 213, 137, 244, 170, 110, 140, 252, 7, 139, 8, 51, 124, 156, 184, 78, 184, 230,
-    229, 155, 222, 69, 188, 134, 127, 40, 4, 223, 56, 245, 165, 77, 103, 134, 112, 220, 54, 37, 112, 126, 218, 197, 30,
-    120, 55, 100, 131, 123, 180, 17, 143, 238, 46, 221, 25, 164, 124, 153, 8, 69, 233, 139, 75, 46, 109, 21, 44, 77,
-    212, 105, 119, 219, 68, 2, 23, 35, 173, 196, 175, 137, 119, 135, 162, 54, 88, 195, 249, 104, 148, 72, 96, 126, 128,
-    249, 7, 164, 243, 198, 98, 135, 86, 236, 254, 45, 92, 193, 156, 68, 43, 135, 188, 72, 121, 69, 131, 227, 34, 11,
-    205, 165, 209, 129, 94, 61, 73, 38, 6, 80, 231, 224, 77, 231, 2, 17, 198, 74, 173, 113, 89, 127, 139, 97, 103, 29,
-    95, 245, 253, 0, 12, 120, 97, 195, 47, 77, 210, 190, 101, 134, 217, 162, 112, 77, 3, 155, 32, 183, 153, 47, 148, 20,
-    242, 230, 131, 244, 208, 78, 174, 22, 240, 33, 208, 85, 4, 71, 109, 35, 165, 24, 184, 143, 182, 78, 64, 44, 161,
-    134, 68, 93, 55, 166, 59, 119, 231, 124, 91, 219, 76, 8, 147, 64, 177, 183, 14, 150, 192, 161, 207, 174, 12, 151,
-    199, 225, 177, 121, 49, 11, 11, 1, 180, 148, 194, 215, 104, 102, 140, 205, 114, 47, 57, 191, 0, 101, 24, 161, 136,
-    8, 22, 118, 43, 96, 124, 254, 247, 7, 22, 246, 33, 88, 129, 184, 254, 208, 179, 17, 48, 200, 126, 69, 124, 32, 48,
-    26, 2, 132, 192, 114, 85, 50, 172, 140, 147, 139, 122, 8, 20, 211, 2, 127, 96, 176, 222, 131, 222, 164, 67, 108, 94,
-    252, 19, 100, 20, 171, 79, 50, 48, 51, 186, 223, 21, 241, 155, 111, 61, 161, 188, 9, 47, 75, 44, 248, 3, 0, 147, 25,
-    120, 209, 127, 203, 144, 236, 241, 231, 245, 231, 169, 115, 59, 211, 0, 82, 209, 23, 44, 31, 32, 74, 95, 116, 251,
-    43, 186, 115, 213, 64, 177, 148, 223, 136, 99, 240, 20, 246, 147, 138, 0, 146, 52, 107, 104, 63, 147, 172, 4, 239,
-    196, 220, 94, 239, 103, 64, 120, 47, 64, 163, 19, 218, 77, 78, 40, 121, 158, 100, 133, 114, 245, 195, 69, 81, 119,
-    75, 70, 125, 162, 75, 231, 171, 107, 87, 118, 233, 57, 26, 155, 89, 134, 124, 160, 180, 225, 207, 50, 220, 115, 215,
-    173, 115, 240, 203, 177, 141, 107, 182, 205, 163, 2, 67, 4, 159, 57, 151, 35, 110, 120, 176, 60, 19, 114, 192, 168,
-    1, 164, 134, 5, 222, 232, 95, 89, 62, 42, 110, 68, 180, 239, 161, 165, 142, 136, 231, 101, 193, 178, 116, 201, 2,
-    181, 126, 36, 233, 60, 65, 196, 189, 95, 97, 23, 126, 78, 1, 176, 248, 238, 186, 87, 83, 125, 147, 75, 250, 236,
-    226, 6, 37, 197, 214, 110, 115, 146, 171, 213, 65, 87, 69, 58, 53, 177, 191, 107, 71, 248, 237, 56, 19, 130, 252,
-    92, 88, 166, 132, 93, 51, 52, 211, 142, 48, 251, 95, 45, 57, 48, 107, 40, 120, 57, 250, 175, 143, 203, 55, 15, 203,
-    245, 13, 238, 149, 129, 232, 255, 82, 8, 163, 165, 38, 29, 48, 38, 10, 206, 46, 132, 52, 34, 242, 158, 123, 16, 74,
-    133, 87, 101, 116, 222, 50, 142, 14, 184, 61, 145, 145, 207, 97, 214, 66, 113, 20, 201, 121, 124, 40, 129, 245, 20,
-    237, 163, 42, 208, 153, 229, 182, 55, 44, 253, 212, 43, 19, 184, 248, 33, 193, 25, 251, 210, 251, 179, 32, 75, 132,
-    178, 28, 32, 230, 148, 123, 130, 59, 83, 60, 4, 64, 114, 239, 41, 23, 12, 152, 208, 120, 139, 168, 17, 117, 12, 172,
-    90, 196, 91, 201, 121, 149, 55, 255, 176, 168, 103, 221, 46, 140, 52, 48, 94, 60, 116, 207, 192, 64, 132, 51, 149,
-    200, 77, 37, 66, 13, 35, 15, 183, 211, 89, 222, 113, 9, 184, 253, 11, 64, 33, 141, 85, 213, 157, 240, 200, 37, 44,
-    157, 188, 51, 166, 179, 70, 109, 102, 44, 51, 148, 133, 123, 159, 105, 190, 35, 201, 210, 205, 214, 101, 56, 109,
-    138, 128, 124, 88, 242, 191, 236, 255, 15, 118, 222, 67, 12, 113, 221, 204, 134, 246, 121, 89, 166, 233, 11, 206,
-    131, 222, 202, 68, 39, 144, 116, 67, 16, 181, 221, 232, 18, 202, 93, 166, 109, 211, 86, 125, 162, 140, 144, 84, 99,
-    58, 176, 245, 207, 80, 72, 115, 9, 125, 193, 85, 93, 14, 21, 177, 92, 4, 28, 234, 135, 118, 117, 132, 44, 23, 212,
-    5, 163, 176, 49, 83, 203, 94, 107, 6, 74, 58, 19, 71, 233, 148, 77, 59, 143, 12, 92, 21, 59, 206, 203, 56, 228, 134,
-    29, 13, 187, 246, 148, 114, 32, 207, 3, 19, 51, 11, 231, 221, 78, 45, 203, 190, 166, 13, 245, 236, 185, 209, 49,
-    207, 34, 6, 34, 178, 126, 28, 10, 185, 130, 49, 178, 112, 232, 235, 126, 21, 64, 206, 147, 83, 80, 199, 135, 246,
-    249, 22, 232, 47, 71, 62, 162, 227, 51, 12, 8, 173, 103, 230, 30, 235, 2, 112, 100, 90, 82, 117, 91, 198, 223, 247,
-    60, 17, 251, 213, 234, 155, 218, 205, 145, 87, 133, 65, 25, 183, 64, 195, 138, 38, 214, 79, 228, 191, 11, 223, 100,
-    236, 168, 143, 63, 129, 254, 41, 83, 10, 34, 227, 209, 224, 38, 10, 80, 124, 182, 168, 37, 2, 132, 122, 57, 49, 116,
-    97, 246, 88, 110, 159, 247, 152, 40, 178, 160, 12, 113, 161, 100, 135, 97, 243, 166, 60, 139, 234, 191, 216, 225,
-    237, 208, 87, 214, 81, 151, 187, 61, 153, 14, 241, 129, 172, 142, 156, 173, 10, 238, 208, 78, 43, 199, 254, 218, 9,
-    114, 58, 91, 200, 201, 63, 96, 234, 115, 110, 98, 129, 3, 45, 97, 229, 87, 121, 32, 21, 212, 84, 75, 238, 101, 84,
-    152, 161, 57, 93, 87, 91, 223, 152, 63, 159, 186, 78, 122, 255, 129, 17, 158, 72, 215, 63, 58, 111, 145, 233, 20,
-    14, 245, 106, 231, 236, 106, 123, 193, 108, 253, 175, 40, 254, 52, 73, 114, 83, 105, 169, 159, 82, 46, 244, 95, 55,
-    194, 158, 253, 141, 90, 237, 167, 27, 8, 25, 159, 84, 206, 12, 113, 57, 89, 174, 253, 164, 52, 181, 14, 253, 93,
-    111, 168, 254, 50, 100, 20, 143, 49, 65, 155, 231, 65, 105, 146, 54, 4, 39, 14, 224, 238, 91, 209, 73, 153, 243, 16,
-    7, 16, 86, 151, 18, 84, 106, 178, 236, 146, 33, 209, 136, 90, 24, 83, 70, 246, 225, 231, 22, 94, 14, 158, 59, 247,
-    181, 203, 130, 152, 43, 95, 105, 25, 201, 155, 13, 142, 86, 38, 150, 191, 5, 245, 53, 214, 226, 167, 185, 119, 4,
-    38, 102, 122, 58, 100, 151, 119, 124, 179, 78, 195, 181, 55, 48, 150, 90, 214, 243, 135, 213, 70, 196, 110, 206,
-    135, 217, 0, 77, 25, 122, 131, 180, 147, 51, 109, 194, 14, 30, 179, 67, 18, 56, 74, 15, 140, 241, 29, 225, 137, 215,
-    107, 125, 140, 111, 45, 248, 237, 90, 158, 57, 76, 132, 247, 191, 188, 83, 252, 137, 157, 190, 103, 90, 21, 52, 85,
-    247, 8, 188, 181, 59, 205, 76, 130, 200, 97, 83, 14, 172, 74, 134, 26, 53, 35, 119, 162, 0, 60, 3, 58, 35, 9, 233,
-    208, 32, 79, 151, 29, 24, 194, 232, 111, 77, 228, 52, 26, 154, 140, 182, 2, 114, 194, 126, 216, 178, 74, 183, 57, 0,
-    84, 13, 207, 86, 76, 53, 102, 190, 183, 143, 67, 223, 34, 247, 251, 90, 224, 214, 231, 251, 202, 199, 210, 192, 46,
-    43, 29, 119, 253, 100, 15, 63, 54, 118, 196, 79, 119, 140, 112, 55, 45, 116, 145, 206, 110, 111, 106, 235, 171, 144,
-    177, 37, 70, 49, 133, 146, 195, 93, 121, 248, 117, 186, 19, 80, 101, 6, 33, 47, 203, 248, 126, 117, 204, 143, 174,
-    73, 219, 162, 128, 160, 251, 68, 91, 161, 233, 181, 17, 214, 14, 45, 227, 184, 194, 76, 239, 136, 208, 4, 125, 228,
-    237, 142, 156, 17, 148, 107, 117, 195, 114, 227, 60, 170, 168, 164, 160, 130, 110, 45, 37, 105, 133, 223, 131, 113,
-    252, 180, 1, 100, 23, 252, 217, 64, 217, 15, 93, 76, 252, 92, 230, 30, 250, 131, 118, 5, 145, 100, 193, 126, 33, 12,
-    97, 118, 7, 151, 242, 190, 112, 75, 22, 141, 180, 219, 139, 149, 47, 95, 167, 78, 91, 157, 163, 71, 138, 150, 118,
-    151, 178, 51, 168, 4, 11, 192, 136, 210, 155, 65, 81, 40, 221, 229, 96, 250, 12, 199, 215, 219, 109, 57, 192, 219,
-    145, 30, 183, 89, 45, 151, 19, 110, 6, 214, 82, 33, 87, 129, 212, 209, 147, 232, 41, 13, 211, 194, 146, 10, 105,
-    196, 222, 31, 252, 192, 187, 65, 34, 192, 203, 207, 58, 116, 215, 98, 13, 21, 0, 93, 219, 117, 253, 10, 235, 111,
-    68, 223, 79, 120, 93, 3, 84, 139, 140, 200, 94, 223, 99, 195, 184, 38, 34, 48, 235, 197, 186, 62, 218, 240, 235,
-    231, 249, 109, 207, 183, 53, 209, 201, 161, 221, 213, 128, 225, 132, 150, 205, 152, 82, 209, 48, 241, 77, 81, 53,
-    58, 44, 11, 5, 81, 218, 4, 194, 124, 10, 140, 66, 9, 21, 28, 203, 215, 108, 116, 81, 3, 71, 56, 79, 229, 233, 50,
-    95, 206, 124, 18, 64, 33, 208, 68, 195, 31, 176, 153, 107, 187, 247, 115, 158, 159, 50, 147, 61, 98, 44, 180, 212,
-    190, 151, 138, 156, 191, 123, 85, 122, 174, 52, 236, 156, 7, 203, 99, 45, 229, 204, 43, 122, 243, 252, 233, 175, 74,
-    132, 201, 125, 27, 105, 86, 30, 92, 243, 197, 151, 57, 226, 184, 73, 8, 210, 81, 159, 211, 218, 11, 157, 10, 97,
-    180, 28, 12, 87, 146, 44, 11, 185, 247, 109, 241, 233, 179, 125, 196, 230, 149, 12, 165, 138, 199, 20, 40, 206, 43,
-    132, 36, 162, 26, 105, 111, 97, 26, 96, 181, 191, 152, 74, 31, 197, 155, 242, 143, 92, 250, 15, 243, 114, 10, 214,
-    28, 141, 216, 33, 210, 132, 120, 21, 156, 10, 75, 148, 95, 197, 94, 180, 184, 71, 134, 33, 53, 166, 147, 135, 44,
-    90, 4, 56, 224, 171, 31, 144, 136, 252, 31, 36, 43, 156, 2, 32, 213, 220, 172, 191, 37, 246, 190, 50, 181, 59, 132,
-    5, 216, 130, 8, 106, 148, 19, 90, 74, 66, 62, 109, 85, 105, 39, 155, 217, 151, 178, 170, 12, 140, 159, 16, 144, 176,
-    33, 196, 29, 7, 245, 129, 167, 24, 223, 120, 245, 45, 228, 46, 128, 132, 186, 65, 154, 242, 121, 166, 211, 198, 39,
-    80, 12, 174, 193, 35, 17, 83, 33, 107, 28, 135, 160, 216, 81, 49, 109, 51, 62, 73, 225, 218, 43, 68, 194, 10, 15,
-    183, 99, 83, 25, 30, 239, 62, 160, 175, 151, 0, 27, 78, 248, 239, 65, 167, 25, 85, 73, 0, 9, 154, 37, 187, 235, 170,
-    91, 83, 61, 42, 1, 208, 61, 131, 204, 121, 66, 6, 51, 121, 130, 227, 202, 188, 62, 195, 199, 174, 168, 119, 40, 22,
-    162, 187, 146, 189, 36, 40, 201, 192, 194, 204, 211, 16, 17, 71, 102, 254, 209, 252, 64, 142, 76, 42, 37, 230, 252,
-    113, 51, 244, 18, 70, 205, 3, 213, 74, 4, 211, 171, 38, 170, 169, 217, 94, 222, 62, 221, 131, 249, 130, 242, 62,
-    233, 125, 70, 67, 167, 222, 143, 66, 133, 226, 191, 126, 164, 230, 150, 52, 125, 101, 81, 244, 72, 248, 203, 54,
-    249, 137, 255, 255, 32, 143, 184, 242, 101, 245, 103, 247, 207, 50, 138, 214, 165, 164, 16, 218, 228, 68, 181, 122,
-    42, 30, 194, 120, 96, 203, 82, 222, 151, 234, 151, 196, 175, 3, 72, 224, 118, 200, 78, 184, 112, 222, 66, 78, 30,
-    139, 69, 171, 73, 228, 204, 16, 138, 106, 226, 198, 250, 100, 126, 151, 110, 143, 222, 208, 214, 248, 63, 211, 13,
-    59, 107, 216, 237, 12, 81, 26, 44, 187, 246, 39, 105, 26, 80, 195, 119, 78, 186, 206, 128, 174, 225, 32, 195, 220,
-    159, 136, 1, 34, 135, 223, 255, 92, 199, 82, 142, 237, 132, 121, 10, 234, 225, 232, 69, 68, 16, 175, 174, 59, 105,
-    50, 0, 11, 142, 252, 125, 81, 206, 127, 127, 161, 28, 153, 233, 18, 46, 172, 222, 38, 192, 77, 73, 205, 246, 222,
-    184, 55, 115, 203, 97, 220, 157, 21, 250, 92, 180, 210, 41, 235, 189, 139, 122, 210, 186, 228, 255, 210, 231, 180,
-    188, 213, 52, 47, 191, 165, 196, 44, 90, 6, 154, 8, 76, 159, 13, 108, 246, 75, 221, 51, 209, 7, 194, 211, 15, 167,
-    3, 178, 165, 254, 35, 135, 203, 245, 31, 195, 218, 67, 121, 112, 176, 96, 222, 188, 91, 181, 106, 191, 85, 155, 209,
-    111, 77, 91, 9, 170, 207, 192, 167, 170, 137, 64, 153, 38, 160, 7, 217, 2, 179, 149, 182, 192, 175, 195, 154, 154,
-    32, 70, 188, 205, 17, 217, 46, 49, 213, 12, 51, 106, 17, 124, 63, 237, 34, 103, 218, 122, 192, 67, 174, 148, 201,
-    235, 239, 189, 182, 186, 132, 154, 173, 27, 46, 254, 148, 208, 202, 204, 37, 228, 182, 216, 45, 214, 96, 172, 13,
-    195, 211, 245, 36, 236, 16, 139, 222, 51, 67, 129, 39, 219, 140, 184, 116, 147, 99, 99, 90, 14, 36, 246, 53, 216,
-    108, 149, 145, 86, 34, 117, 65, 238, 34, 22, 236, 124, 251, 0, 102, 25, 169, 206, 58, 230, 56, 122, 173, 248, 198,
-    162, 199, 110, 224, 69, 253, 164, 197, 103, 179, 56, 73, 127, 183, 134, 225, 116, 155, 49, 1, 72, 210, 72, 160, 186,
-    252, 65, 246, 164, 89, 224, 157, 89, 28, 133, 242, 85, 97, 8, 84, 103, 53, 152, 214, 250, 213, 29, 157, 41, 179,
-    165, 190, 62, 136, 211, 98, 224, 114, 15, 142, 253, 235, 105, 147, 43, 113, 151, 241, 255, 208, 3, 132, 152, 207,
-    233, 29, 242, 242, 2, 35, 4, 87, 188, 28, 109, 231, 142, 100, 180, 216, 203, 70, 213, 217, 163, 24, 62, 81, 160, 25,
-    213, 47, 171, 127, 37, 16, 49, 124, 204, 235, 99, 92, 169, 71, 211, 36, 20, 5, 67, 219, 147, 213, 117, 241, 85, 128,
-    142, 126, 143, 223, 201, 29, 129, 142, 96, 197, 161, 74, 79, 110, 37, 137, 71, 241, 153, 50, 125, 19, 240, 224, 254,
-    171, 67, 204, 48, 128, 119, 49, 147, 47, 25, 82, 24, 0, 236, 123, 210, 221, 30, 108, 203, 129, 201, 210, 206, 220,
-    122, 24, 74, 102, 247, 173, 237, 180, 124, 228, 130, 25, 42, 53, 44, 112, 143, 255, 81, 213, 241, 148, 21, 228, 52,
-    77, 237, 27, 67, 169, 4, 13, 76, 113, 20, 54, 9, 22, 14, 216, 18, 13, 49, 66, 164, 27, 201, 215, 126, 54, 197, 158,
-    219, 16, 194, 111, 237, 40, 210, 76, 229, 177, 107, 70, 206, 131, 154, 105, 178, 145, 39, 85, 8, 62, 165, 43, 10, 7,
-    185, 155, 189, 164, 210, 60, 21, 17, 207, 137, 105, 247, 158, 99, 17, 112, 116, 177, 230, 133, 244, 160, 93, 165,
-    151, 112, 182, 70, 133, 170, 113, 7, 56, 35, 128, 106, 191, 140, 125, 19, 165, 234, 12, 144, 187, 6, 162, 11, 101,
-    10, 37, 10, 222, 247, 62, 48, 16, 140, 95, 86, 122, 197, 114, 213, 92, 230, 56, 41, 196, 221, 222, 119, 16, 232,
-    144, 139, 195, 5, 45, 147, 9, 191, 250, 82, 196, 100, 31, 137, 77, 222, 100, 17, 94, 12, 117, 74, 242, 106, 236,
-    172, 218, 246, 105, 255, 54, 174, 27, 61, 231, 65, 157, 176, 49, 166, 9, 188, 255, 132, 46, 156, 113, 69, 25, 166,
-    234, 17, 121, 209, 1, 142, 184, 158, 189, 216, 181, 34, 144, 192, 97, 181, 26, 83, 15, 203, 100, 133, 31, 204, 217,
-    56, 144, 244, 203, 231, 27, 48, 26, 154, 227, 1, 167, 87, 169, 57, 58, 61, 81, 6, 98, 20, 216, 218, 249, 201, 2, 3,
-    46, 50, 145, 155, 200, 162, 118, 70, 57, 81, 107, 39, 40, 137, 7, 254, 161, 50, 195, 175, 168, 224, 147, 115, 204,
-    133, 186, 62, 137, 240, 143, 209, 12, 35, 31, 57, 129, 167, 1, 79, 148, 45, 114, 117, 22, 31, 73, 129, 94, 198, 207,
-    39, 254, 200, 226, 240, 174, 68, 62, 168, 137, 244, 143, 136, 10, 142, 47, 209, 218, 179, 81, 107, 230, 88, 171,
-    248, 216, 81, 155, 249, 121, 43, 192, 61, 222, 33, 208, 11, 70, 234, 110, 128, 139, 102, 254, 223, 224, 224, 26,
-    171, 21, 66, 175, 214, 20, 34, 179, 215, 200, 189, 113, 127, 147, 173, 83, 173, 201, 254, 61, 17, 83, 171, 140, 232,
-    108, 173, 44, 237, 19, 154, 217, 93, 93, 135, 60, 239, 211, 129, 62, 254, 202, 43, 187, 139, 241, 194, 189, 138,
-    106, 145, 83, 252, 195, 212, 31, 143, 229, 232, 212, 187, 138, 60, 217, 62, 139, 118, 162, 117, 191, 41, 223, 48,
-    47, 66, 21, 67, 98, 136, 167, 241, 202, 211, 109, 16, 142, 127, 45, 238, 212, 225, 58, 244, 10, 124, 249, 77, 106,
-    65, 142, 185, 81, 230, 221, 94, 184, 251, 200, 39, 175, 254, 131, 172, 251, 251, 212, 116, 17, 101, 187, 215, 198,
-    57, 33, 49, 156, 199, 144, 18, 216, 48, 240, 22, 202, 152, 43, 188, 229, 128, 0, 192, 187, 255, 21, 155, 164, 225,
-    23, 207, 200, 186, 19, 36, 19, 3, 44, 34, 4, 58, 24, 21, 54, 185, 96, 23, 89, 255, 21, 181, 195, 213, 90, 167, 18,
-    235, 254, 253, 67, 128, 243, 137, 197, 103, 170, 95, 116, 220, 190, 124, 120, 88, 103, 66, 161, 19, 135, 98, 169,
-    169, 222, 170, 204, 87, 105, 213, 55, 60, 108, 161, 195, 45, 173, 51, 5, 237, 194, 28, 42, 6, 53, 199, 35, 174, 169,
-    56, 231, 98, 151, 206, 146, 64, 248, 8, 94, 136, 105, 154, 141, 20, 113, 202, 49, 49, 222, 43, 5, 226, 125, 97, 78,
-    221, 16, 110, 45, 215, 152, 107, 77, 12, 101, 81, 131, 99, 229, 40, 204, 88, 156, 56, 220, 129, 220, 42, 219, 68,
-    137, 182, 66, 37, 59, 98, 198, 127, 86, 216, 69, 200, 198, 77, 26, 228, 79, 73, 209, 133, 7, 6, 222, 188, 93, 64,
-    181, 60, 201, 198, 43, 216, 237, 127, 112, 150, 214, 11, 17, 220, 37, 48, 12, 141, 174, 29, 81, 247, 187, 63, 233,
-    88, 146, 230, 15, 42, 164, 97, 136, 39, 138, 187, 152, 188, 222, 104, 113, 229, 93, 15, 244, 148, 82, 95, 51, 14,
-    130, 246, 101, 242, 131, 245, 186, 201, 79, 176, 220, 134, 233, 140, 223, 90, 62, 54, 238, 40, 251, 108, 27, 104,
-    111, 225, 233, 108, 154, 174, 194, 48, 244, 252, 251, 149, 182, 250, 212, 100, 47, 191, 62, 68, 158, 174, 228, 113,
-    111, 156, 243, 186, 225, 103, 248, 184, 228, 208, 252, 197, 245, 145, 176, 17, 219, 157, 171, 10, 168, 164, 121,
-    164, 100, 29, 194, 95, 198, 174, 242, 129, 183, 234, 104, 53, 38, 52, 163, 199, 23, 165, 55, 121, 209, 11, 44, 44,
-    116, 141, 85, 149, 245, 169, 57, 213, 10, 46, 34, 162, 108, 92, 28, 152, 213, 141, 209, 54, 82, 92, 166, 70, 164,
-    209, 75, 237, 197, 3, 250, 17, 240, 0, 111, 16, 70, 55, 234, 204, 219, 159, 179, 29, 187, 171, 174, 24, 252, 3, 179,
-    135, 30, 168, 134, 182, 45, 124, 228, 96, 168, 149, 200, 158, 246, 94, 111, 232, 252, 41, 70, 11, 153, 143, 71, 27,
-    62, 195, 98, 49, 227, 126, 176, 194, 209, 52, 178, 141, 203, 244, 165, 10, 105, 23, 1, 215, 140, 134, 111, 142, 188,
-    101, 113, 82, 177, 160, 153, 147, 225, 240, 133, 251, 149, 28, 158, 54, 218, 107, 236, 35, 143, 212, 152, 235, 222,
-    228, 123, 148, 117, 93, 78, 53, 158, 58, 42, 76, 27, 60, 125, 235, 143, 50, 68, 193, 200, 147, 78, 76, 186, 240, 82,
-    65, 9, 219, 59, 73, 245, 154, 235, 105, 150, 54, 160, 81, 228, 202, 209, 241, 39, 121, 219, 23, 123, 167, 24, 255,
-    108, 162, 83, 124, 202, 95, 138, 161, 244, 9, 22, 27, 105, 202, 15, 48, 149, 6, 34, 57, 252, 127, 145, 3, 127, 137,
-    55, 49, 233, 185, 225, 3, 186, 112, 127, 28, 220, 190, 24, 180, 18, 130, 7, 164, 243, 148, 212, 54, 214, 39, 251,
-    181, 253, 80, 172, 38, 45, 188, 152, 108, 243, 182, 10, 200, 153, 254, 85, 157, 21, 33, 45, 216, 241, 237, 141, 186,
-    233, 28, 192, 101, 19, 254, 33, 200, 90, 165, 200, 178, 199, 27, 199, 44, 1, 28, 57, 170, 41, 227, 80, 161, 6, 135,
-    103, 58, 69, 234, 108, 92, 236, 156, 32, 125, 45, 177, 29, 249, 213, 242, 218, 111, 195, 82, 78, 105, 169, 194, 106,
-    125, 55, 233, 211, 202, 149, 0, 113, 111, 170, 165, 75, 239, 255, 116, 18, 12, 250, 50, 240, 2, 189, 224, 43, 184,
-    217, 76, 108, 64, 79, 29, 112, 242, 116, 7, 8, 254, 131, 59, 191, 23, 100, 111, 182, 103, 202, 234, 161, 179, 69,
-    64, 195, 10, 153, 83, 137, 113, 212, 15, 153, 142, 140, 252, 165, 228, 131, 112, 15, 102, 142, 172, 219, 142, 198,
-    154, 91, 19, 192, 48, 91, 164, 196, 77, 211, 98, 125, 223, 68, 125, 247, 22, 140, 123, 156, 124, 165, 239, 183, 196,
-    159, 79, 247, 149, 228, 67, 114, 211, 134, 196, 94, 184, 28, 105, 15, 81, 47, 93, 18, 80, 124, 152, 229, 155, 217,
-    3, 143, 92, 30, 204, 105, 32, 255, 54, 204, 245, 81, 194, 91, 125, 82, 11, 75, 47, 217, 93, 42, 249, 135, 166, 179,
-    91, 161, 196, 81, 84, 119, 19, 171, 212, 146, 159, 225, 196, 108, 165, 65, 44, 188, 150, 240, 70, 11, 246, 55, 0,
-    153, 150, 91, 152, 247, 101, 240, 205, 145, 121, 31, 109, 147, 229, 170, 213, 99, 49, 234, 7, 159, 56, 200, 42, 240,
-    239, 232, 142, 160, 200, 253, 62, 227, 54, 200, 190, 167, 157, 240, 122, 106, 194, 231, 235, 17, 138, 221, 179, 84,
-    171, 197, 148, 89, 2, 8, 118, 36, 251, 27, 252, 245, 52, 71, 139, 241, 206, 34, 23, 41, 208, 38, 219, 37, 28, 152,
-    236, 26, 3, 230, 23, 186, 3, 91, 62, 166, 83, 107, 170, 175, 162, 247, 121, 231, 125, 254, 4, 117, 5, 43, 173, 172,
-    173, 235, 137, 219, 243, 205, 112, 18, 242, 15, 163, 46, 230, 243, 146, 142, 30, 93, 250, 91, 130, 1, 154, 104, 65,
-    56, 99, 151, 161, 232, 253, 18, 192, 63, 105, 162, 168, 14, 167, 229, 197, 46, 94, 172, 56, 128, 160, 38, 118, 236,
-    58, 159, 227, 85, 210, 120, 78, 44, 3, 4, 154, 236, 6, 142, 171, 226, 130, 72, 88, 113, 147, 137, 106, 53, 101, 6,
-    162, 27, 46, 99, 179, 38, 33, 54, 174, 15, 48, 138, 149, 72, 114, 26, 198, 249, 253, 126, 12, 112, 199, 54, 113, 24,
-    106, 123, 202, 164, 233, 138, 218, 153, 142, 65, 99, 227, 241, 97, 245, 71, 92, 233, 40, 103, 128, 188, 127, 3, 6,
-    0, 1, 72, 95, 53, 152, 139, 43, 156, 242, 79, 59, 152, 229, 21, 83, 83, 162, 182, 67, 83, 83, 72, 3, 49, 84, 242,
-    72, 47, 189, 87, 158, 0, 12, 60, 192, 197, 105, 182, 249, 158, 156, 24, 51, 54, 50, 98, 197, 199, 143, 91, 158, 32,
-    35, 4, 95, 188, 74, 97, 70, 107, 160, 132, 71, 112, 211, 186, 233, 113, 199, 1, 80, 98, 196, 14, 44, 165, 2, 4, 11,
-    203, 125, 22, 14, 53, 151, 45, 203, 210, 151, 250, 42, 0, 90, 128, 125, 73, 139, 253, 155, 200, 241, 71, 109, 217,
-    137, 90, 44, 1, 200, 230, 230, 231, 228, 213, 103, 10, 204, 74, 203, 125, 149, 212, 175, 61, 223, 211, 146, 83, 150,
-    227, 236, 151, 187, 207, 129, 184, 119, 8, 190, 13, 43, 107, 111, 253, 169, 206, 171, 22, 196, 76, 167, 2, 134, 176,
-    45, 6, 218, 132, 52, 144, 225, 126, 182, 219, 167, 101, 103, 222, 7, 253, 126, 171, 126, 91, 124, 48, 156, 216, 226,
-    26, 124, 173, 6, 208, 164, 175, 170, 127, 60, 87, 155, 123, 114, 198, 135, 5, 22, 81, 68, 163, 156, 253, 162, 37,
-    48, 206, 203, 84, 21, 85, 116, 201, 91, 41, 9, 220, 29, 103, 99, 189, 165, 88, 131, 220, 84, 152, 123, 168, 20, 114,
-    215, 183, 161, 142, 28, 1, 207, 129, 227, 161, 8, 69, 192, 205, 86, 65, 192, 48, 130, 106, 108, 21, 143, 87, 164,
-    216, 106, 30, 96, 202, 42, 234, 241, 100, 155, 63, 179, 111, 3, 93, 164, 74, 162, 185, 24, 204, 155, 95, 229, 6,
-    209, 79, 214, 19, 199, 25, 17, 188, 131, 43, 42, 10, 200, 245, 16, 23, 231, 106, 108, 199, 40, 140, 88, 112, 246,
-    209, 178, 144, 12, 187, 225, 175, 220, 28, 133, 153, 226, 10, 198, 14, 74, 140, 120, 181, 64, 122, 8, 14, 65, 1, 5,
-    57, 168, 97, 76, 232, 101, 32, 206, 80, 201, 166, 4, 151, 231, 70, 123, 158, 192, 71, 128, 114, 58, 152, 25, 59,
-    160, 127, 146, 103, 163, 165, 213, 252, 210, 142, 94, 192, 227, 236, 55, 101, 74, 78, 180, 219, 75, 163, 247, 210,
-    35, 101, 149, 73, 183, 118, 166, 238, 253, 141, 52, 92, 17, 52, 22, 74, 96, 158, 88, 130, 101, 127, 145, 2, 133,
-    197, 215, 89, 81, 188, 91, 9, 250, 33, 238, 57, 177, 134, 132, 200, 172, 47, 209, 200, 71, 13, 68, 43, 141, 229,
-    100, 204, 84, 177, 148, 132, 33, 223, 111, 122, 96, 87, 135, 158, 81, 70, 110, 251, 68, 16, 80, 88, 24, 128, 57,
-    233, 246, 168, 56, 160, 161, 222, 155, 255, 139, 225, 248, 232, 208, 130, 191, 21, 128, 98, 181, 44, 248, 16, 147,
-    131, 200, 104, 207, 55, 253, 143, 251, 247, 76, 105, 197, 33, 78, 216, 14, 147, 28, 75, 128, 2, 69, 212, 220, 223,
-    183, 127, 32, 171, 141, 223, 242, 17, 137, 193, 14, 222, 52, 235, 84, 169, 101, 139, 56, 103, 172, 234, 250, 123,
-    208, 48, 37, 57, 1, 80, 79, 47, 122, 106, 249, 211, 188, 8, 88, 19, 205, 209, 126, 180, 188, 192, 131, 252, 15, 51,
-    80, 43, 7, 177, 233, 85, 159, 190, 17, 250, 159, 26, 136, 146, 14, 96, 32, 12, 231, 37, 211, 167, 237, 47, 158, 211,
-    69, 114, 35, 174, 241, 53, 176, 76, 52, 241, 209, 165, 206, 84, 197, 62, 54, 67, 131, 221, 137, 10, 201, 27, 224,
-    118, 124, 177, 168, 204, 66, 238, 142, 220, 119, 110, 48, 53, 200, 117, 142, 144, 49, 189, 28, 246, 90, 107, 66,
-    198, 232, 41, 93, 211, 243, 73, 255, 171, 210, 239, 31, 234, 176, 142, 109, 172, 157, 151, 41, 183, 191, 40, 190,
-    199, 223, 63, 111, 106, 211, 59, 243, 232, 219, 235, 136, 148, 11, 64, 23, 172, 242, 190, 41, 29, 183, 31, 26, 47,
-    19, 196, 251, 114, 195, 34, 121, 242, 215, 132, 30, 44, 173, 114, 152, 103, 22, 107, 6, 226, 158, 36, 201, 0, 41,
-    159, 75, 162, 235, 159, 182, 79, 24, 232, 73, 131, 8, 32, 215, 144, 87, 137, 149, 173, 17, 244, 255, 114, 87, 38,
-    112, 78, 194, 116, 53, 47, 183, 0, 0, 116, 204, 151, 92, 110, 113, 124, 244, 225, 123, 38, 23, 212, 132, 78, 192,
-    234, 170, 103, 208, 139, 0, 229, 240, 61, 155, 37, 82, 234, 173, 235, 136, 154, 18, 95, 15, 168, 188, 2, 195, 54,
-    173, 237, 148, 156, 192, 231, 253, 102, 207, 12, 76, 188, 184, 133, 144, 110, 221, 112, 129, 231, 134, 211, 98, 219,
-    146, 21, 246, 138, 46, 19, 194, 110, 192, 23, 72, 117, 63, 83, 199, 242, 226, 19, 207, 222, 40, 73, 109, 29, 156,
-    238, 42, 140, 33, 7, 33, 177, 82, 174, 71, 49, 97, 3, 97, 196, 199, 226, 48, 131, 255, 178, 215, 101, 75, 136, 33,
-    139, 197, 210, 60, 198, 190, 35, 86, 249, 141, 7, 160, 45, 51, 0, 74, 70, 144, 130, 202, 161, 132, 99, 59, 125, 255,
-    154, 155, 30, 176, 133, 30, 138, 191, 226, 47, 182, 62, 25, 15, 94, 245, 59, 72, 50, 201, 171, 189, 43, 214, 116,
-    167, 58, 26, 82, 82, 226, 171, 133, 241, 54, 200, 202, 201, 57, 128, 94, 87, 59, 122, 109, 47, 209, 236, 217, 63,
-    32, 54, 153, 224, 59, 54, 183, 253, 63, 57, 225, 186, 66, 46, 40, 88, 208, 116, 86, 52, 78, 203, 18, 28, 137, 29,
-    158, 89, 163, 104, 210, 27, 98, 251, 1, 194, 77, 80, 161, 138, 122, 189, 149, 54, 218, 74, 24, 194, 39, 200, 99,
-    213, 193, 8, 118, 158, 63, 116, 71, 28, 87, 171, 121, 231, 26, 29, 3, 250, 214, 235, 251, 155, 104, 200, 215, 20,
-    253, 150, 204, 148, 103, 81, 150, 33, 27, 220, 171, 9, 18, 147, 22, 140, 101, 160, 109, 192, 207, 86, 102, 120, 14,
-    216, 35, 118, 63, 66, 72, 8, 174, 111, 10, 59, 158, 129, 101, 131, 250, 223, 175, 1, 107, 159, 30, 81, 82, 252, 152,
-    170, 10, 138, 130, 199, 106, 170, 231, 150, 20, 32, 252, 238, 192, 160, 163, 22, 113, 23, 49, 45, 101, 2, 205, 130,
-    3, 243, 169, 173, 15, 118, 54, 110, 224, 7, 116, 90, 28, 194, 226, 44, 166, 191, 247, 97, 237, 216, 255, 199, 118,
-    249, 7, 66, 91, 136, 250, 22, 73, 76, 151, 56, 21, 123, 109, 227, 45, 231, 184, 235, 104, 35, 62, 20, 198, 54, 62,
-    201, 253, 189, 226, 254, 47, 252, 118, 175, 19, 3, 94, 36, 37, 215, 110, 27, 12, 183, 129, 216, 8, 60, 250, 152, 8,
-    205, 125, 147, 13, 246, 169, 34, 246, 214, 65, 103, 159, 135, 235, 155, 223, 66, 45, 28, 125, 190, 3, 243, 139, 49,
-    145, 214, 173, 135, 231, 245, 46, 176, 179, 80, 12, 26, 113, 50, 27, 48, 163, 155, 169, 216, 121, 112, 6, 192, 185,
-    7, 38, 143, 230, 204, 34, 27, 47, 210, 246, 51, 148, 103, 63, 254, 203, 87, 22, 76, 58, 35, 220, 144, 149, 65, 190,
-    153, 9, 49, 188, 127, 108, 11, 71, 44, 87, 58, 27, 219, 177, 109, 149, 147, 18, 38, 239, 222, 135, 196, 110, 231,
-    70, 18, 119, 116, 33, 28, 173, 9, 215, 202, 86, 139, 133, 223, 134, 176, 217, 164, 228, 48, 173, 120, 254, 112, 249,
-    37, 182, 138, 236, 143, 249, 65, 13, 9, 159, 83, 233, 33, 7, 239, 61, 151, 35, 228, 202, 179, 110, 248, 126, 22, 21,
-    210, 226, 82, 26, 97, 157, 117, 90, 25, 42, 35, 109, 241, 82, 43, 125, 124, 195, 111, 101, 207, 106, 70, 102, 160,
-    5, 185, 115, 81, 34, 190, 223, 3, 181, 190, 128, 103, 117, 147, 179, 118, 172, 39, 220, 174, 92, 246, 5, 0, 30, 157,
-    61, 205, 100, 154, 232, 3, 239, 44, 154, 26, 187, 228, 110, 117, 119, 61, 23, 202, 55, 138, 205, 16, 64, 50, 160,
-    138, 23, 162, 199, 153, 232, 181, 74, 86, 170, 134, 28, 213, 175, 53, 63, 93, 65, 153, 57, 204, 210, 50, 16, 84,
-    189, 18, 205, 82, 127, 219, 172, 56, 50, 227, 113, 140, 149, 83, 176, 21, 230, 172, 35, 50, 126, 14, 84, 142, 198,
-    189, 106, 211, 2, 188, 9, 17, 198, 232, 12, 157, 219, 53, 222, 95, 229, 236, 73, 193, 42, 83, 153, 110, 11, 120, 16,
-    18, 129, 25, 241, 74, 145, 42, 88, 169, 78, 236, 109, 123, 158, 115, 199, 192, 30, 237, 7, 128, 26, 66, 53, 25, 127,
-    41, 119, 173, 114, 89, 190, 73, 147, 26, 219, 55, 245, 160, 12, 201, 104, 91, 215, 120, 44, 252, 28, 16, 143, 43,
-    74, 49, 41, 250, 174, 71, 6, 131, 89, 38, 36, 128, 48, 181, 36, 253, 26, 171, 61, 220, 115, 156, 104, 226, 133, 105,
-    61, 10, 192, 236, 7, 231, 187, 40, 194, 79, 113, 137, 20, 74, 172, 244, 157, 55, 3, 154, 29, 183, 135, 174, 236,
-    173, 170, 142, 97, 201, 65, 77, 151, 250, 17, 189, 46, 115, 208, 217, 76, 16, 177, 55, 141, 20, 91, 199, 108, 102,
-    143, 80, 142, 68, 203, 176, 118, 32, 110, 117, 108, 215, 214, 217, 41, 77, 76, 171, 14, 54, 229, 94, 34, 206, 134,
-    52, 220, 119, 162, 165, 198, 205, 56, 245, 100, 52, 20, 151, 187, 13, 196, 70, 62, 115, 100, 230, 18, 180, 242, 140,
-    220, 247, 189, 207, 89, 85, 65, 179, 112, 106, 42, 248, 65, 150, 21, 144, 135, 11, 31, 103, 141, 124, 216, 174, 203,
-    110, 1, 187, 162, 246, 126, 174, 152, 156, 12, 54, 29, 172, 67, 216, 37, 0, 29, 123, 108, 218, 30, 80, 171, 117,
-    164, 87, 124, 104, 4, 56, 0, 254, 46, 78, 201, 50, 70, 251, 113, 220, 247, 214, 40, 184, 92, 223, 247, 174, 61, 128,
-    6, 107, 119, 242, 116, 81, 25, 87, 206, 115, 148, 123, 25, 146, 35, 176, 182, 73, 90, 2, 25, 247, 217, 66, 123, 46,
-    141, 103, 233, 10, 86, 185, 215, 11, 127, 191, 231, 215, 14, 39, 77, 138, 117, 18, 214, 161, 44, 168, 48, 105, 211,
-    18, 209, 123, 248, 132, 247, 113, 34, 119, 171, 38, 127, 179, 94, 71, 230, 196, 164, 121, 6, 92, 248, 117, 247, 161,
-    110, 175, 110, 131, 138, 60, 34, 66, 24, 110, 75, 64, 189, 109, 68, 143, 235, 190, 227, 195, 23, 82, 52, 101, 163,
-    86, 233, 223, 64, 19, 248, 37, 31, 57, 34, 190, 78, 77, 210, 89, 35, 240, 13, 65, 98, 145, 93, 10, 200, 93, 71, 40,
-    233, 45, 122, 16, 103, 208, 218, 34, 158, 20, 225, 150, 143, 13, 164, 0, 43, 96, 159, 63, 121, 0, 53, 76, 1, 114,
-    224, 107, 71, 45, 207, 9, 21, 228, 232, 88, 175, 210, 121, 50, 71, 250, 3, 133, 244, 59, 82, 66, 96, 93, 215, 61,
-    180, 32, 17, 114, 72, 177, 93, 18, 25, 60, 164, 235, 189, 174, 165, 192, 5, 65, 212, 170, 184, 110, 215, 143, 33,
-    255, 103, 135, 170, 221, 26, 220, 46, 216, 48, 94, 104, 34, 30, 247, 198, 81, 21, 62, 83, 92, 156, 135, 243, 104,
-    111, 10, 126, 231, 97, 13, 36, 206, 48, 104, 97, 215, 202, 54, 192, 89, 29, 120, 143, 251, 54, 188, 238, 34, 73,
-    185, 219, 111, 230, 233, 149, 196, 172, 210, 253, 145, 101, 104, 199, 29, 155, 219, 141, 150, 181, 143, 174, 149,
-    29, 218, 226, 44, 144, 46, 129, 159, 205, 7, 33, 94, 130, 42, 237, 199, 148, 193, 235, 245, 127, 7, 44, 133, 10, 29,
-    52, 149, 217, 146, 233, 115, 187, 113, 178, 63, 150, 29, 121, 174, 222, 118, 242, 178, 115, 74, 18, 147, 84, 116,
-    68, 113, 233, 145, 218, 80, 44, 43, 91, 144, 122, 100, 5, 151, 152, 21, 123, 218, 124, 93, 65, 176, 178, 34, 211,
-    37, 182, 195, 115, 178, 203, 247, 50, 112, 211, 86, 150, 255, 48, 211, 94, 30, 220, 27, 104, 225, 214, 180, 253,
-    200, 246, 96, 82, 194, 126, 148, 147, 167, 196, 244, 180, 72, 128, 76, 179, 79, 41, 36, 247, 131, 82, 118, 222, 220,
-    162, 110, 91, 218, 13, 49, 45, 201, 222, 193, 53, 237, 184, 156, 122, 150, 237, 122, 113, 3, 58, 112, 221, 195, 78,
-    185, 167, 122, 85, 143, 252, 178, 195, 183, 58, 150, 13, 14, 17, 211, 158, 100, 58, 83, 198, 8, 221, 195, 253, 66,
-    205, 225, 40, 132, 123, 191, 112, 56, 249, 23, 160, 92, 135, 203, 154, 202, 98, 119, 162, 205, 121, 209, 12, 143,
-    251, 249, 233, 125, 37, 55, 65, 249, 192, 157, 140, 186, 186, 45, 72, 214, 203, 119, 158, 223, 67, 152, 235, 102, 3,
-    22, 25, 142, 107, 106, 234, 119, 63, 44, 11, 99, 226, 204, 74, 149, 242, 150, 101, 125, 223, 10, 78, 64, 52, 170,
-    243, 41, 51, 116, 182, 177, 47, 150, 181, 128, 63, 50, 240, 125, 142, 184, 190, 173, 207, 6, 113, 125, 54, 201, 101,
-    44, 155, 178, 170, 177, 96, 29, 106, 56, 92, 37, 88, 51, 126, 68, 8, 163, 230, 136, 242, 38, 180, 252, 134, 176,
-    251, 88, 245, 202, 205, 138, 29, 112, 53, 144, 16, 111, 59, 149, 158, 133, 51, 44, 23, 227, 192, 250, 169, 196, 228,
-    221, 160, 159, 104, 206, 233, 236, 123, 161, 21, 67, 45, 133, 135, 133, 227, 123, 61, 192, 62, 129, 216, 61, 123,
-    174, 255, 16, 235, 243, 113, 14, 95, 96, 114, 160, 72, 214, 52, 38, 135, 221, 13, 213, 92, 196, 16, 83, 76, 68, 76,
-    162, 170, 144, 116, 208, 213, 23, 213, 190, 240, 80, 236, 251, 129, 139, 207, 214, 26, 179, 209, 36, 167, 81, 114,
-    171, 72, 157, 189, 137, 181, 130, 149, 163, 75, 87, 247, 109, 202, 109, 31, 188, 187, 5, 90, 65, 93, 43, 232, 169,
-    43, 108, 149, 7, 246, 64, 242, 232, 184, 53, 59, 0, 190, 177, 235, 201, 231, 18, 90, 201, 120, 10, 116, 183, 165,
-    121, 54, 198, 211, 210, 99, 109, 253, 247, 220, 85, 60, 218, 95, 9, 57, 117, 152, 42, 80, 54, 107, 188, 208, 84, 9,
-    122, 29, 166, 137, 39, 221, 20, 62, 5, 220, 108, 139, 69, 206, 60, 23, 60, 34, 242, 47, 119, 116, 105, 176, 108, 79,
-    136, 66, 117, 34, 88, 220, 100, 146, 193, 85, 20, 187, 97, 167, 237, 6, 182, 195, 242, 142, 234, 198, 40, 51, 230,
-    228, 230, 199, 191, 88, 56, 200, 133, 219, 89, 144, 186, 37, 51, 189, 141, 253, 143, 182, 18, 111, 93, 93, 127, 248,
-    48, 41, 7, 139, 32, 104, 233, 62, 107, 149, 5, 29, 93, 29, 92, 102, 158, 239, 18, 36, 100, 150, 86, 154, 81, 186,
-    136, 240, 152, 146, 219, 136, 239, 16, 245, 234, 104, 236, 158, 101, 78, 131, 229, 103, 29, 127, 191, 34, 224, 115,
-    83, 53, 211, 170, 46, 202, 64, 224, 83, 121, 122, 58, 14, 184, 16, 110, 127, 198, 112, 21, 188, 123, 191, 2, 169,
-    90, 67, 232, 196, 91, 137, 36, 206, 61, 23, 246, 226, 142, 202, 71, 62, 116, 50, 247, 79, 40, 42, 180, 126, 14, 105,
-    176, 132, 2, 202, 32, 220, 128, 222, 239, 175, 221, 15, 164, 235, 239, 154, 18, 103, 201, 156, 29, 240, 233, 42,
-    184, 234, 197, 29, 48, 240, 13, 163, 81, 239, 67, 241, 146, 213, 81, 32, 124, 11, 5, 47, 40, 214, 69, 166, 190, 21,
-    245, 236, 174, 254, 8, 28, 18, 113, 103, 204, 12, 93, 56, 220, 62, 228, 93, 57, 211, 73, 100, 70, 71, 1, 144, 1,
-    121, 124, 120, 120, 174, 149, 107, 182, 64, 27, 139, 153, 202, 12, 68, 128, 200, 65, 210, 145, 220, 160, 143, 49,
-    156, 155, 233, 147, 200, 91, 121, 24, 153, 234, 68, 235, 153, 125, 253, 12, 235, 118, 85, 59, 106, 70, 34, 39, 189,
-    139, 110, 226, 107, 20, 33, 54, 69, 255, 163, 11, 249, 184, 104, 165, 28, 221, 64, 173, 230, 126, 145, 80, 216, 85,
-    164, 59, 247, 14, 133, 77, 197, 14, 34, 249, 91, 6, 56, 130, 36, 114, 55, 79, 176, 120, 232, 191, 84, 5, 207, 190,
-    78, 4, 125, 94, 184, 158, 44, 89, 91, 134, 200, 26, 203, 13, 98, 163, 54, 14, 254, 240, 252, 67, 162, 12, 62, 18,
-    133, 151, 180, 173, 130, 103, 24, 241, 186, 16, 167, 45, 193, 64, 128, 186, 183, 167, 169, 27, 142, 209, 35, 217,
-    64, 64, 60, 99, 131, 106, 196, 244, 17, 78, 90, 141, 49, 96, 165, 146, 23, 200, 34, 126, 67, 239, 75, 121, 246, 3,
-    11, 20, 39, 85, 110, 134, 253, 22, 185, 144, 106, 95, 104, 221, 196, 108, 239, 38, 149, 75, 65, 51, 101, 176, 98,
-    243, 125, 11, 244, 178, 86, 10, 219, 75, 149, 50, 54, 107, 0, 102, 159, 40, 166, 30, 164, 107, 71, 22, 198, 18, 231,
-    151, 181, 237, 113, 224, 111, 232, 114, 12, 48, 53, 237, 30, 185, 192, 32, 19, 144, 53, 93, 49, 42, 7, 156, 198, 71,
-    62, 48, 215, 129, 71, 25, 0, 173, 3, 4, 171, 110, 176, 85, 97, 5, 179, 5, 139, 64, 98, 154, 74, 224, 71, 148, 140,
-    152, 103, 122, 195, 131, 110, 109, 30, 65, 2, 123, 100, 209, 89, 233, 95, 209, 249, 199, 119, 120, 176, 150, 221,
-    16, 109, 126, 15, 125, 44, 248, 225, 180, 38, 161, 86, 10, 158, 96, 78, 47, 153, 86, 2, 66, 188, 189, 25, 58, 83,
-    221, 251, 18, 36, 149, 76, 102, 249, 190, 241, 69, 72, 46, 210, 30, 21, 25, 151, 100, 174, 188, 178, 22, 93, 163,
-    228, 230, 116, 211, 196, 241, 103, 60, 155, 31, 20, 232, 100, 138, 125, 151, 234, 76, 157, 236, 95, 85, 68, 184,
-    132, 124, 154, 109, 110, 95, 53, 124, 234, 139, 218, 26, 158, 202, 34, 241, 86, 97, 200, 135, 11, 171, 230, 107,
-    204, 244, 173, 37, 45, 101, 226, 71, 159, 62, 150, 115, 94, 33, 94, 58, 181, 57, 218, 193, 40, 249, 173, 252, 174,
-    34, 164, 16, 166, 223, 114, 2, 135, 151, 181, 215, 238, 241, 255, 109, 138, 63, 189, 9, 122, 69, 14, 235, 139, 118,
-    17, 55, 153, 52, 175, 253, 116, 101, 43, 70, 231, 71, 106, 142, 50, 30, 67, 95, 35, 65, 111, 105, 114, 104, 182,
-    208, 98, 91, 130, 68, 82, 8, 244, 208, 203, 177, 46, 94, 153, 122, 5, 68, 133, 248, 24, 9, 205, 30, 44, 149, 53, 92,
-    81, 35, 244, 184, 6, 143, 85, 152, 7, 93, 242, 205, 173, 142, 200, 146, 140, 2, 231, 44, 94, 70, 57, 245, 146, 114,
-    191, 122, 237, 52, 154, 219, 198, 77, 18, 161, 181, 254, 45, 95, 19, 0, 80, 0, 92, 71, 51, 168, 54, 37, 120, 146,
-    151, 114, 66, 229, 101, 181, 222, 20, 67, 64, 81, 246, 113, 62, 201, 23, 27, 197, 195, 112, 228, 148, 17, 80, 227,
-    56, 164, 155, 244, 71, 55, 54, 166, 163, 191, 228, 86, 74, 161, 252, 41, 188, 250, 178, 228, 231, 152, 148, 30, 7,
-    251, 234, 187, 110, 88, 22, 203, 90, 245, 11, 226, 173, 0, 113, 5, 241, 127, 190, 76, 223, 225, 6, 184, 28, 170,
-    178, 46, 136, 81, 247, 248, 64, 93, 184, 212, 65, 134, 103, 64, 37, 205, 223, 17, 183, 52, 222, 42, 150, 179, 185,
-    212, 128, 215, 23, 182, 73, 16, 193, 90, 210, 21, 136, 65, 130, 14, 226, 29, 168, 150, 129, 88, 247, 178, 198, 193,
-    157, 221, 15, 43, 4, 206, 150, 163, 140, 190, 220, 75, 140, 233, 27, 94, 231, 227, 53, 37, 149, 197, 113, 96, 210,
-    112, 246, 248, 179, 156, 115, 234, 241, 206, 167, 50, 26, 119, 105, 44, 35, 42, 155, 195, 123, 178, 246, 67, 253,
-    215, 161, 163, 242, 65, 237, 33, 30, 237, 142, 239, 136, 80, 72, 112, 94, 11, 123, 173, 134, 85, 120, 67, 209, 6,
-    51, 125, 6, 86, 93, 80, 197, 209, 4, 174, 33, 12, 3, 245, 43, 214, 133, 0, 91, 150, 95, 106, 100, 17, 170, 171, 36,
-    9, 42, 72, 22, 49, 162, 82, 137, 251, 245, 219, 201, 197, 49, 151, 126, 55, 236, 55, 91, 159, 186, 231, 13, 53, 9,
-    153, 240, 44, 227, 20, 189, 177, 94, 9, 157, 240, 80, 182, 23, 167, 120, 170, 130, 16, 222, 234, 152, 219, 18, 120,
-    10, 2, 222, 234, 116, 75, 194, 64, 101, 36, 96, 248, 195, 117, 154, 67, 154, 149, 155, 90, 69, 127, 41, 204, 103,
-    151, 41, 105, 140, 135, 149, 100, 19, 65, 83, 47, 96, 236, 225, 22, 252, 255, 160, 37, 171, 62, 0, 52, 126, 21, 154,
-    161, 225, 172, 21, 68, 184, 45, 242, 193, 246, 249, 245, 35, 8, 211, 190, 82, 198, 220, 66, 213, 73, 94, 62, 63, 30,
-    136, 137, 251, 176, 47, 35, 79, 99, 77, 170, 143, 24, 39, 57, 11, 220, 218, 31, 210, 185, 177, 154, 186, 33, 49,
-    191, 249, 219, 6, 12, 137, 170, 61, 38, 128, 158, 196, 248, 179, 82, 57, 54, 5, 148, 204, 155, 83, 151, 211, 145,
-    212, 196, 75, 88, 78, 21, 165, 53, 70, 241, 182, 232, 127, 89, 251, 207, 139, 112, 11, 14, 34, 228, 96, 132, 152,
-    154, 4, 41, 33, 66, 49, 58, 85, 104, 128, 44, 135, 147, 16, 162, 4, 168, 184, 187, 204, 252, 195, 152, 204, 63, 77,
-    12, 144, 28, 11, 91, 212, 56, 135, 61, 226, 195, 34, 49, 56, 126, 134, 40, 72, 250, 5, 60, 201, 182, 66, 25, 210,
-    180, 190, 36, 170, 82, 196, 235, 139, 164, 209, 116, 229, 118, 206, 144, 66, 3, 5, 108, 251, 130, 196, 137, 22, 169,
-    238, 58, 198, 121, 34, 34, 119, 18, 44, 169, 211, 80, 233, 207, 178, 248, 163, 157, 202, 222, 138, 219, 218, 48,
-    122, 112, 46, 162, 113, 169, 200, 225, 157, 55, 68, 217, 78, 174, 85, 181, 202, 21, 208, 32, 64, 146, 22, 45, 203,
-    22, 228, 30, 61, 77, 244, 132, 24, 61, 222, 148, 216, 245, 214, 24, 168, 182, 44, 34, 84, 4, 208, 204, 191, 63, 105,
-    66, 153, 170, 201, 72, 93, 15, 53, 82, 82, 45, 252, 31, 67, 133, 254, 207, 99, 66, 36, 66, 145, 122, 23, 140, 212,
-    43, 141, 222, 92, 118, 52, 105, 174, 19, 79, 140, 200, 23, 206, 113, 149, 119, 97, 222, 62, 43, 164, 172, 239, 55,
-    177, 214, 92, 250, 108, 43, 167, 112, 201, 248, 196, 81, 222, 180, 121, 98, 23, 199, 66, 73, 3, 85, 130, 194, 34,
-    174, 112, 214, 51, 13, 138, 227, 60, 111, 126, 82, 169, 18, 225, 84, 152, 24, 1, 160, 51, 11, 5, 126, 244, 20, 123,
-    240, 186, 146, 30, 99, 217, 216, 122, 246, 169, 37, 248, 249, 36, 29, 164, 166, 103, 140, 158, 138, 41, 255, 21, 82,
-    177, 9, 55, 157, 218, 115, 251, 47, 9, 8, 175, 149, 99, 219, 25, 123, 101, 53, 51, 115, 94, 177, 22, 157, 12, 192,
-    191, 47, 154, 155, 134, 128, 30, 57, 80, 163, 91, 187, 46, 204, 170, 209, 96, 212, 200, 251, 89, 222, 55, 34, 83,
-    234, 13, 106, 68, 57, 231, 199, 141, 61, 149, 54, 211, 143, 78, 134, 62, 128, 84, 114, 51, 247, 197, 5, 246, 12,
-    115, 187, 139, 54, 50, 175, 71, 37, 149, 14, 58, 95, 2, 69, 78, 72, 84, 122, 182, 185, 15, 97, 6, 148, 39, 13, 11,
-    48, 249, 60, 27, 170, 168, 28, 181, 238, 16, 43, 204, 51, 45, 93, 135, 99, 83, 93, 255, 198, 111, 35, 158, 196, 213,
-    207, 71, 99, 222, 152, 94, 207, 194, 20, 145, 64, 22, 197, 50, 83, 204, 24, 5, 203, 207, 248, 142, 3, 49, 185, 0,
-    20, 37, 159, 224, 179, 134, 52, 52, 49, 233, 53, 82, 46, 38, 131, 202, 25, 224, 149, 211, 24, 121, 31, 51, 240, 198,
-    33, 2, 75, 199, 213, 88, 49, 8, 152, 158, 137, 41, 209, 39, 40, 42, 241, 69, 61, 56, 40, 106, 82, 243, 98, 248, 61,
-    12, 1, 178, 75, 184, 108, 219, 157, 219, 106, 102, 82, 47, 230, 185, 240, 240, 30, 107, 236, 189, 58, 188, 131, 189,
-    237, 237, 177, 233, 8, 138, 13, 73, 255, 113, 38, 235, 160, 135, 47, 117, 222, 75, 101, 109, 50, 205, 208, 113, 28,
-    27, 171, 202, 27, 177, 47, 200, 60, 214, 98, 94, 58, 14, 227, 67, 173, 56, 191, 203, 27, 214, 173, 48, 165, 25, 32,
-    126, 118, 61, 222, 69, 23, 130, 241, 108, 132, 234, 50, 119, 13, 122, 59, 2, 51, 182, 217, 111, 200, 10, 14, 197,
-    237, 178, 29, 209, 176, 235, 46, 242, 167, 40, 190, 100, 9, 112, 65, 55, 179, 64, 21, 11, 158, 84, 37, 93, 28, 251,
-    38, 253, 227, 48, 21, 221, 111, 52, 71, 144, 129, 171, 76, 89, 34, 169, 196, 60, 8, 46, 178, 221, 109, 250, 220,
-    229, 184, 137, 229, 146, 51, 96, 102, 66, 144, 111, 169, 120, 154, 109, 162, 220, 243, 38, 156, 17, 96, 28, 235, 48,
-    249, 54, 196, 31, 204, 143, 235, 26, 87, 37, 251, 60, 227, 57, 88, 114, 19, 113, 55, 255, 50, 203, 140, 189, 239,
-    59, 226, 137, 29, 144, 165, 252, 158, 109, 127, 60, 132, 144, 108, 1, 234, 85, 82, 123, 173, 205, 181, 153, 233,
-    218, 31, 97, 160, 163, 110, 159, 241, 59, 73, 228, 54, 24, 86, 181, 54, 252, 218, 49, 25, 217, 197, 148, 18, 157,
-    25, 123, 20, 183, 5, 76, 156, 144, 177, 196, 135, 40, 22, 173, 6, 60, 44, 232, 39, 16, 162, 60, 96, 102, 33, 73, 94,
-    135, 109, 210, 1, 191, 73, 58, 228, 104, 3, 6, 255, 79, 119, 239, 19, 128, 113, 139, 174, 38, 121, 210, 84, 115,
-    225, 236, 29, 22, 192, 39, 93, 64, 226, 117, 219, 170, 81, 134, 39, 223, 105, 101, 165, 113, 8, 234, 158, 153, 190,
-    100, 73, 219, 236, 224, 87, 160, 220, 195, 230, 46, 2, 78, 131, 133, 191, 153, 253, 160, 23, 198, 62, 9, 174, 6, 41,
-    169, 204, 240, 214, 50, 22, 107, 144, 92, 169, 197, 115, 64, 67, 144, 191, 232, 169, 193, 47, 192, 33, 122, 53, 157,
-    5, 101, 184, 125, 117, 228, 77, 142, 99, 136, 156, 114, 115, 253, 48, 169, 119, 207, 119, 97, 28, 236, 98, 42, 38,
-    73, 65, 48, 178, 156, 6, 45, 72, 108, 244, 242, 255, 219, 109, 249, 107, 1, 4, 171, 43, 190, 131, 148, 1, 128, 238,
-    209, 117, 236, 163, 231, 130, 60, 50, 152, 222, 185, 246, 100, 64, 6, 155, 79, 71, 215, 240, 182, 47, 217, 77, 241,
-    37, 116, 58, 143, 35, 104, 67, 131, 101, 107, 173, 135, 48, 34, 17, 88, 41, 210, 226, 252, 2, 208, 227, 244, 162,
-    14, 176, 193, 104, 222, 99, 127, 4, 209, 74, 6, 176, 216, 138, 98, 138, 147, 243, 237, 156, 207, 39, 108, 178, 96,
-    255, 235, 103, 87, 179, 50, 39, 117, 8, 224, 208, 9, 161, 10, 104, 64, 121, 161, 143, 43, 37, 226, 245, 152, 207,
-    112, 153, 41, 94, 142, 32, 153, 66, 187, 15, 113, 32, 96, 106, 69, 179, 72, 217, 31, 45, 13, 155, 43, 82, 10, 141,
-    60, 157, 31, 78, 44, 212, 248, 232, 204, 175, 62, 174, 130, 0, 225, 210, 90, 43, 125, 167, 42, 94, 189, 236, 109,
-    99, 135, 247, 188, 112, 12, 59, 25, 253, 108, 76, 28, 211, 197, 77, 146, 96, 103, 240, 168, 139, 2, 151, 171, 5, 69,
-    26, 114, 23, 224, 172, 133, 56, 86, 2, 217, 148, 46, 85, 226, 62, 163, 255, 203, 13, 13, 20, 57, 211, 16, 57, 111,
-    67, 127, 248, 101, 62, 39, 3, 135, 15, 103, 26, 125, 218, 255, 55, 141, 114, 21, 209, 156, 160, 211, 134, 64, 84,
-    213, 91, 216, 239, 183, 101, 229, 71, 207, 86, 91, 195, 14, 238, 157, 211, 153, 72, 225, 228, 224, 242, 146, 134,
-    245, 209, 64, 100, 31, 67, 188, 118, 167, 172, 212, 180, 73, 84, 110, 72, 44, 1, 15, 172, 182, 76, 48, 59, 248, 1,
-    154, 40, 102, 255, 55, 181, 55, 207, 188, 29, 245, 210, 102, 228, 8, 194, 29, 13, 183, 143, 28, 182, 14, 209, 177,
-    237, 185, 195, 192, 220, 109, 57, 138, 11, 145, 153, 109, 89, 132, 169, 113, 113, 150, 197, 228, 60, 79, 181, 92,
-    229, 20, 39, 22, 66, 140, 211, 191, 37, 202, 200, 0, 38, 205, 220, 115, 246, 241, 132, 141, 166, 217, 155, 131, 45,
-    120, 142, 141, 81, 61, 138, 101, 59, 12, 103, 41, 14, 36, 204, 100, 35, 255, 161, 151, 6, 149, 20, 29, 226, 105, 67,
-    131, 243, 100, 244, 167, 27, 212, 209, 131, 240, 240, 154, 77, 98, 91, 202, 201, 127, 157, 121, 254, 141, 36, 60,
-    211, 148, 134, 51, 41, 25, 223, 115, 15, 13, 183, 94, 234, 212, 167, 32, 198, 67, 130, 176, 179, 11, 178, 71, 36,
-    196, 208, 214, 50, 147, 50, 55, 81, 119, 142, 121, 2, 69, 245, 71, 126, 84, 170, 180, 244, 118, 63, 116, 199, 200,
-    40, 182, 23, 141, 161, 20, 214, 91, 169, 238, 227, 233, 23, 62, 117, 170, 144, 124, 50, 105, 235, 176, 2, 190, 49,
-    58, 56, 246, 153, 209, 217, 102, 63, 163, 144, 116, 34, 56, 48, 225, 51, 150, 62, 56, 114, 65, 95, 185, 57, 84, 82,
-    170, 122, 127, 167, 114, 126, 18, 176, 196, 129, 239, 90, 93, 41, 133, 90, 104, 68, 8, 177, 59, 254, 170, 139, 12,
-    152, 233, 16, 74, 54, 59, 223, 182, 145, 11, 78, 175, 252, 86, 247, 170, 113, 156, 209, 163, 172, 48, 22, 98, 245,
-    38, 57, 205, 28, 25, 121, 137, 154, 144, 150, 181, 230, 99, 115, 147, 220, 81, 54, 192, 33, 147, 7, 163, 65, 65,
-    220, 154, 190, 200, 32, 48, 218, 84, 215, 240, 233, 132, 87, 187, 157, 147, 229, 252, 255, 218, 94, 97, 62, 180,
-    147, 183, 79, 142, 231, 101, 98, 29, 5, 24, 240, 99, 255, 28, 120, 181, 211, 233, 246, 92, 79, 14, 243, 126, 102,
-    135, 198, 215, 37, 213, 40, 183, 144, 125, 232, 106, 116, 159, 58, 161, 225, 10, 148, 152, 67, 199, 250, 168, 119,
-    42, 127, 243, 247, 103, 185, 241, 235, 118, 195, 55, 147, 49, 84, 211, 224, 157, 25, 232, 255, 212, 160, 187, 216,
-    125, 120, 226, 96, 165, 123, 20, 204, 44, 150, 204, 44, 228, 75, 191, 228, 20, 225, 0, 174, 97, 140, 104, 150, 89,
-    252, 209, 226, 64, 166, 88, 83, 160, 137, 11, 245, 3, 56, 94, 40, 73, 10, 184, 84, 89, 40, 85, 27, 43, 2, 204, 52,
-    72, 175, 235, 2, 229, 28, 182, 121, 152, 23, 195, 34, 83, 150, 169, 179, 33, 240, 94, 161, 70, 171, 151, 33, 139,
-    118, 62, 236, 75, 235, 160, 169, 102, 214, 136, 28, 129, 24, 25, 9, 210, 122, 149, 164, 34, 133, 32, 4, 221, 2, 45,
-    143, 240, 31, 140, 84, 222, 241, 8, 60, 95, 88, 97, 177, 231, 8, 221, 203, 164, 160, 213, 87, 75, 187, 46, 58, 142,
-    228, 189, 88, 27, 142, 11, 49, 190, 58, 70, 127, 96, 152, 232, 133, 109, 73, 19, 188, 251, 176, 174, 66, 26, 221, 2,
-    160, 98, 7, 201, 203, 254, 119, 113, 148, 97, 6, 22, 178, 235, 203, 143, 115, 168, 94, 145, 67, 8, 91, 141, 137,
-    174, 249, 226, 54, 162, 230, 238, 8, 191, 111, 198, 45, 62, 234, 35, 30, 103, 74, 168, 153, 9, 23, 190, 61, 246,
-    132, 150, 133, 143, 128, 186, 77, 56, 170, 202, 209, 133, 118, 191, 31, 165, 14, 4, 43, 245, 175, 103, 255, 78, 162,
-    249, 221, 173, 87, 73, 186, 214, 255, 138, 95, 254, 137, 74, 32, 63, 71, 171, 123, 171, 239, 230, 191, 39, 151, 54,
-    133, 177, 126, 216, 42, 3, 201, 194, 143, 113, 231, 34, 73, 58, 81, 2, 242, 18, 132, 218, 25, 29, 212, 219, 73, 63,
-    145, 192, 196, 133, 190, 244, 136, 128, 232, 163, 29, 63, 178, 113, 2, 159, 219, 208, 153, 168, 107, 184, 144, 22,
-    143, 222, 151, 10, 71, 146, 68, 48, 122, 21, 19, 51, 115, 183, 47, 22, 53, 120, 42, 173, 212, 112, 189, 131, 17,
-    120, 253, 195, 74, 47, 43, 100, 57, 85, 253, 19, 78, 117, 52, 31, 24, 27, 186, 88, 178, 217, 176, 182, 214, 80, 190,
-    4, 92, 228, 199, 82, 96, 124, 37, 191, 146, 140, 99, 71, 213, 251, 140, 123, 179, 81, 226, 96, 3, 200, 89, 92, 29,
-    58, 137, 92, 55, 179, 15, 110, 12, 166, 31, 173, 11, 174, 15, 38, 248, 160, 90, 127, 112, 146, 19, 98, 179, 75, 136,
-    75, 109, 243, 21, 51, 219, 84, 12, 121, 130, 243, 22, 155, 58, 105, 4, 233, 129, 92, 177, 94, 217, 242, 74, 162,
-    206, 252, 122, 92, 54, 31, 159, 211, 94, 123, 171, 237, 24, 74, 117, 164, 121, 112, 225, 172, 60, 100, 197, 253,
-    136, 17, 24, 96, 117, 247, 147, 203, 35, 241, 224, 225, 251, 55, 156, 201, 180, 34, 136, 130, 93, 101, 160, 33, 212,
-    4, 55, 97, 219, 68, 2, 171, 165, 17, 179, 160, 138, 106, 49, 21, 138, 196, 29, 13, 231, 158, 69, 12, 244, 68, 93,
-    197, 47, 124, 168, 101, 0, 178, 178, 229, 12, 238, 119, 184, 64, 36, 186, 233, 234, 204, 168, 16, 40, 152, 139, 195,
-    12, 174, 22, 39, 13, 183, 228, 153, 253, 39, 69, 87, 184, 44, 193, 123, 60, 3, 149, 145, 52, 143, 244, 2, 23, 9,
-    128, 95, 137, 24, 89, 232, 233, 72, 248, 221, 251, 43, 144, 173, 158, 222, 240, 93, 82, 65, 15, 160, 172, 198, 26,
-    137, 14, 9, 226, 46, 85, 36, 154, 246, 230, 229, 255, 39, 184, 213, 104, 230, 9, 45, 19, 99, 9, 228, 76, 112, 79,
-    139, 253, 113, 215, 67, 8, 59, 235, 29, 221, 167, 108, 114, 21, 64, 243, 24, 81, 232, 190, 220, 53, 35, 6, 209, 141,
-    55, 4, 82, 237, 126, 245, 103, 240, 60, 101, 220, 214, 122, 116, 21, 106, 47, 220, 172, 36, 231, 160, 182, 179, 175,
-    171, 211, 60, 183, 38, 243, 222, 47, 27, 155, 241, 160, 38, 39, 225, 62, 220, 141, 4, 135, 224, 97, 2, 29, 54, 174,
-    247, 41, 8, 60, 231, 178, 255, 198, 119, 7, 186, 113, 14, 71, 35, 3, 145, 108, 129, 161, 86, 29, 215, 172, 106, 139,
-    31, 201, 18, 231, 222, 67, 225, 182, 7, 207, 89, 183, 51, 142, 59, 102, 182, 138, 253, 203, 176, 219, 153, 2, 87,
-    37, 42, 197, 79, 27, 234, 65, 93, 226, 203, 82, 165, 87, 164, 97, 87, 143, 118, 220, 237, 212, 227, 150, 240, 237,
-    195, 171, 129, 176, 138, 76, 177, 59, 169, 145, 102, 95, 190, 70, 33, 133, 133, 179, 126, 53, 55, 71, 225, 159, 128,
-    120, 211, 151, 172, 3, 43, 24, 230, 20, 252, 126, 85, 47, 49, 64, 169, 240, 149, 189, 51, 117, 150, 139, 3, 162, 31,
-    7, 225, 53, 180, 161, 130, 185, 225, 97, 144, 197, 216, 115, 247, 142, 150, 243, 106, 207, 25, 97, 51, 66, 81, 227,
-    134, 207, 148, 72, 74, 101, 229, 123, 1, 163, 28, 28, 7, 187, 109, 32, 113, 241, 107, 129, 137, 251, 232, 227, 122,
-    151, 204, 230, 64, 175, 126, 90, 238, 163, 144, 58, 12, 162, 92, 27, 21, 202, 243, 23, 20, 213, 3, 134, 234, 137,
-    81, 42, 123, 174, 120, 172, 139, 93, 174, 246, 166, 212, 150, 157, 163, 150, 47, 132, 109, 123, 124, 1, 27, 230,
-    198, 229, 137, 130, 69, 161, 186, 123, 222, 118, 116, 45, 68, 143, 1, 142, 166, 95, 198, 228, 165, 24, 74, 78, 173,
-    233, 117, 147, 158, 60, 57, 85, 58, 220, 31, 231, 73, 30, 232, 29, 27, 145, 116, 199, 138, 41, 102, 115, 205, 160,
-    99, 148, 13, 7, 56, 24, 122, 1, 245, 61, 156, 183, 28, 24, 233, 215, 110, 74, 93, 38, 44, 102, 68, 95, 158, 107,
-    114, 63, 96, 58, 67, 45, 156, 130, 28, 254, 4, 202, 139, 166, 72, 233, 91, 96, 115, 200, 174, 235, 59, 148, 139,
-    119, 160, 210, 5, 74, 127, 41, 75, 235, 224, 146, 209, 172, 48, 117, 113, 197, 101, 236, 67, 130, 230, 80, 134, 224,
-    154, 97, 239, 43, 103, 224, 100, 226, 79, 190, 163, 192, 64, 207, 131, 167, 68, 139, 246, 158, 248, 244, 171, 201,
-    3, 3, 245, 194, 81, 69, 136, 68, 215, 85, 87, 63, 136, 218, 32, 51, 106, 43, 210, 118, 224, 18, 154, 80, 215, 121,
-    89, 76, 230, 250, 16, 229, 222, 226, 222, 1, 62, 122, 129, 250, 174, 233, 47, 142, 173, 25, 197, 250, 201, 102, 62,
-    132, 220, 206, 47, 46, 34, 202, 227, 75, 37, 34, 223, 98, 28, 8, 49, 87, 180, 215, 167, 40, 77, 236, 40, 72, 133,
-    191, 204, 52, 221, 228, 50, 70, 37, 108, 47, 225, 160, 6, 128, 48, 0, 174, 87, 251, 35, 64, 158, 112, 215, 214, 119,
-    169, 126, 99, 216, 209, 249, 89, 19, 106, 7, 224, 102, 191, 172, 149, 135, 70, 146, 191, 223, 43, 8, 190, 161, 170,
-    216, 127, 74, 13, 122, 58, 52, 229, 54, 255, 2, 36, 109, 114, 118, 191, 203, 59, 163, 243, 113, 101, 220, 8, 102,
-    200, 58, 63, 165, 15, 164, 104, 241, 241, 62, 59, 189, 40, 202, 192, 182, 28, 136, 210, 156, 212, 182, 153, 178,
-    174, 108, 214, 252, 172, 124, 185, 16, 105, 203, 81, 32, 218, 2, 45, 68, 3, 27, 211, 100, 156, 125, 231, 113, 195,
-    186, 52, 33, 247, 143, 117, 71, 211, 182, 117, 50, 180, 218, 23, 248, 78, 25, 160, 130, 214, 70, 74, 167, 133, 64,
-    233, 93, 61, 137, 201, 169, 138, 71, 51, 95, 246, 4, 216, 100, 205, 63, 240, 209, 95, 251, 196, 8, 7, 43, 124, 160,
-    53, 90, 193, 248, 83, 21, 34, 68, 125, 182, 57, 239, 244, 168, 221, 143, 147, 200, 59, 198, 43, 185, 87, 238, 30,
-    174, 21, 50, 165, 20, 38, 8, 66, 166, 143, 197, 88, 49, 103, 50, 5, 39, 255, 243, 191, 166, 73, 21, 246, 56, 51, 19,
-    249, 11, 8, 116, 176, 11, 81, 251, 186, 201, 141, 150, 45, 25, 49, 101, 74, 115, 65, 145, 254, 44, 201, 32, 52, 221,
-    29, 114, 21, 87, 48, 101, 112, 93, 191, 68, 174, 105, 50, 19, 203, 174, 218, 248, 152, 162, 133, 197, 195, 118, 116,
-    155, 89, 161, 1, 54, 122, 187, 174, 105, 129, 167, 57, 249, 175, 148, 173, 138, 7, 190, 104, 127, 249, 152, 106,
-    234, 139, 78, 124, 161, 95, 103, 119, 10, 213, 211, 94, 154, 11, 54, 3, 160, 237, 82, 83, 106, 27, 138, 153, 158,
-    124, 190, 195, 129, 218, 93, 221, 226, 47, 55, 62, 41, 181, 167, 139, 240, 124, 95, 26, 51, 17, 33, 94, 214, 234,
-    76, 216, 46, 83, 155, 248, 168, 198, 41, 30, 252, 105, 203, 101, 213, 93, 66, 140, 82, 25, 120, 254, 64, 169, 255,
-    251, 153, 135, 133, 195, 103, 102, 50, 202, 245, 131, 98, 7, 47, 216, 122, 30, 10, 109, 155, 237, 126, 188, 79, 132,
-    162, 33, 38, 91, 70, 138, 5, 106, 175, 99, 213, 167, 230, 161, 102, 90, 233, 216, 46, 24, 166, 209, 11, 227, 159,
-    202, 83, 173, 112, 123, 128, 76, 25, 254, 208, 185, 212, 176, 13, 0, 189, 77, 10, 67, 223, 6, 154, 88, 147, 41, 159,
-    83, 51, 67, 220, 109, 99, 150, 247, 42, 115, 84, 213, 78, 14, 84, 156, 60, 108, 53, 148, 48, 230, 177, 190, 189,
-    111, 191, 164, 109, 99, 237, 31, 222, 60, 157, 182, 233, 4, 162, 106, 198, 29, 138, 102, 43, 93, 255, 130, 239, 27,
-    104, 82, 139, 114, 239, 203, 34, 83, 118, 22, 198, 86, 178, 125, 69, 20, 113, 254, 117, 197, 198, 234, 38, 248, 30,
-    145, 177, 116, 15, 119, 161, 7, 61, 28, 124, 2, 236, 61, 209, 211, 83, 224, 115, 54, 214, 27, 42, 27, 209, 129, 109,
-    105, 78, 232, 102, 244, 98, 207, 172, 151, 141, 43, 50, 3, 181, 168, 157, 176, 8, 3, 179, 49, 249, 7, 152, 139, 147,
-    33, 5, 131, 139, 140, 221, 239, 43, 93, 211, 39, 131, 72, 185, 191, 89, 194, 105, 228, 2, 208, 75, 201, 127, 197,
-    123, 16, 45, 178, 171, 227, 33, 223, 182, 66, 204, 40, 97, 128, 166, 19, 255, 214, 168, 191, 244, 157, 228, 181,
-    158, 178, 131, 241, 22, 224, 206, 86, 72, 34, 79, 50, 79, 150, 49, 112, 82, 85, 190, 81, 166, 206, 29, 184, 125, 2,
-    54, 171, 35, 245, 101, 233, 162, 142, 111, 164, 155, 149, 233, 192, 155, 237, 213, 205, 6, 96, 4, 128, 24, 105, 116,
-    54, 126, 163, 247, 97, 237, 144, 137, 61, 35, 248, 77, 235, 191, 135, 16, 28, 95, 48, 88, 39, 237, 197, 44, 125,
-    154, 227, 169, 130, 209, 202, 36, 65, 123, 138, 84, 82, 108, 147, 62, 34, 157, 113, 132, 116, 137, 100, 82, 179,
-    229, 87, 114, 195, 26, 159, 173, 148, 182, 9, 51, 251, 141, 48, 43, 109, 246, 252, 109, 203, 53, 75, 248, 44, 243,
-    242, 209, 46, 71, 60, 55, 177, 148, 75, 28, 240, 201, 241, 70, 210, 165, 57, 134, 213, 201, 204, 141, 96, 212, 133,
-    227, 156, 250, 226, 173, 139, 124, 76, 192, 142, 55, 241, 126, 192, 150, 78, 152, 52, 5, 48, 162, 142, 239, 101, 15,
-    176, 141, 7, 137, 178, 32, 78, 19, 178, 62, 27, 223, 188, 37, 83, 161, 136, 99, 38, 160, 22, 133, 165, 213, 110,
-    141, 66, 51, 113, 56, 22, 20, 159, 96, 112, 255, 244, 123, 87, 108, 220, 186, 46, 186, 202, 201, 91, 130, 80, 103,
-    101, 177, 175, 4, 20, 196, 106, 191, 252, 52, 203, 224, 97, 168, 109, 52, 182, 155, 76, 75, 35, 12, 211, 136, 195,
-    236, 63, 254, 65, 238, 90, 129, 71, 63, 161, 4, 191, 116, 57, 216, 146, 123, 3, 89, 157, 181, 217, 45, 245, 186,
-    169, 56, 48, 192, 137, 183, 43, 187, 25, 46, 243, 94, 34, 181, 81, 137, 73, 229, 91, 237, 52, 227, 251, 186, 208,
-    175, 116, 177, 254, 220, 24, 172, 220, 116, 170, 67, 65, 125, 230, 170, 57, 45, 215, 61, 24, 113, 36, 188, 209, 200,
-    50, 178, 141, 37, 184, 7, 125, 36, 2, 236, 175, 166, 18, 66, 43, 75, 27, 252, 91, 97, 188, 3, 106, 218, 170, 153,
-    77, 121, 39, 68, 219, 232, 228, 180, 221, 255, 219, 55, 107, 63, 42, 68, 173, 39, 135, 89, 25, 124, 177, 63, 182,
-    239, 45, 121, 250, 2, 230, 74, 20, 41, 127, 146, 127, 247, 112, 204, 246, 210, 252, 54, 104, 199, 106, 161, 217, 71,
-    115, 204, 124, 206, 229, 105, 80, 120, 145, 199, 102, 84, 10, 173, 121, 231, 226, 175, 29, 228, 163, 42, 10, 111,
-    83, 13, 103, 189, 87, 85, 36, 86, 96, 223, 184, 245, 23, 157, 73, 85, 151, 199, 238, 83, 240, 90, 70, 23, 236, 248,
-    209, 101, 200, 32, 17, 48, 78, 241, 34, 111, 101, 251, 209, 210, 217, 101, 110, 60, 198, 194, 49, 202, 12, 105, 6,
-    25, 110, 118, 27, 1, 30, 201, 238, 99, 168, 187, 55, 6, 174, 118, 39, 98, 101, 50, 109, 157, 38, 52, 65, 79, 71,
-    135, 92, 15, 146, 209, 158, 15, 61, 47, 187, 113, 137, 37, 23, 138, 99, 27, 236, 193, 93, 204, 216, 98, 188, 141,
-    43, 58, 120, 219, 217, 56, 133, 12, 187, 93, 188, 177, 120, 242, 161, 81, 190, 222, 190, 53, 225, 44, 213, 99, 175,
-    173, 144, 20, 88, 193, 44, 242, 22, 52, 145, 241, 164, 61, 104, 232, 238, 197, 117, 153, 138, 237, 143, 7, 240, 77,
-    100, 64, 33, 37, 245, 249, 132, 255, 235, 88, 134, 216, 228, 84, 119, 108, 7, 207, 123, 75, 86, 154, 166, 126, 70,
-    148, 185, 165, 57, 159, 104, 142, 58, 217, 3, 193, 47, 109, 100, 85, 215, 172, 8, 120, 188, 244, 222, 61, 140, 195,
-    136, 14, 154, 233, 170, 151, 74, 219, 188, 204, 77, 209, 83, 33, 5, 111, 51, 189, 38, 33, 55, 242, 187, 231, 159,
-    144, 160, 59, 138, 109, 238, 95, 203, 209, 222, 98, 153, 237, 168, 181, 139, 133, 74, 42, 230, 204, 133, 186, 211,
-    76, 132, 77, 143, 142, 59, 20, 5, 61, 66, 146, 85, 81, 220, 144, 103, 25, 211, 76, 25, 184, 223, 46, 6, 172, 61,
-    178, 16, 214, 230, 134, 8, 68, 14, 231, 174, 188, 163, 196, 241, 145, 112, 28, 182, 222, 83, 162, 181, 31, 183, 99,
-    159, 178, 54, 129, 64, 137, 89, 112, 230, 107, 146, 255, 133, 138, 26, 124, 214, 136, 152, 127, 67, 21, 183, 199,
-    184, 67, 251, 90, 90, 15, 145, 177, 15, 51, 213, 18, 227, 26, 136, 224, 209, 170, 159, 237, 151, 146, 22, 92, 120,
-    237, 111, 26, 56, 203, 5, 82, 49, 118, 30, 160, 48, 254, 83, 117, 231, 89, 122, 237, 219, 38, 228, 90, 179, 216,
-    139, 110, 56, 44, 91, 84, 80, 221, 105, 53, 172, 91, 219, 28, 207, 204, 52, 46, 42, 186, 233, 149, 49, 196, 231,
-    251, 15, 195, 0, 66, 141, 104, 207, 171, 205, 192, 89, 201, 75, 15, 39, 189, 220, 66, 66, 254, 108, 32, 198, 165,
-    24, 111, 11, 25, 190, 27, 159, 224, 196, 90, 173, 203, 73, 0, 164, 206, 125, 137, 68, 93, 135, 25, 74, 182, 217,
-    247, 102, 106, 246, 80, 88, 54, 158, 79, 55, 62, 32, 144, 13, 61, 217, 133, 68, 172, 90, 210, 3, 82, 159, 21, 103,
-    250, 113, 33, 49, 31, 67, 91, 102, 180, 140, 94, 73, 74, 137, 53, 105, 148, 219, 112, 21, 107, 231, 28, 176, 143,
-    55, 188, 35, 184, 95, 177, 148, 249, 55, 146, 231, 17, 71, 168, 83, 71, 97, 223, 154, 9, 81, 42, 165, 175, 3, 67,
-    195, 253, 246, 124, 104, 142, 149, 247, 89, 163, 233, 120, 152, 40, 17, 204, 250, 250, 215, 181, 140, 80, 44, 167,
-    81, 211, 111, 204, 238, 164, 117, 127, 198, 94, 50, 20, 60, 1, 8, 7, 162, 233, 104, 161, 156, 216, 229, 232, 215,
-    26, 154, 4, 153, 190, 20, 235, 199, 39, 150, 36, 214, 93, 145, 151, 168, 173, 39, 139, 188, 11, 170, 67, 47, 21, 88,
-    194, 148, 47, 31, 236, 115, 89, 208, 130, 165, 31, 104, 215, 228, 222, 75, 64, 212, 224, 182, 144, 227, 1, 45, 17,
-    75, 209, 233, 174, 109, 90, 65, 222, 103, 20, 47, 176, 69, 95, 24, 210, 121, 163, 100, 105, 29, 102, 128, 118, 81,
-    32, 205, 158, 220, 149, 25, 7, 185, 119, 58, 21, 140, 140, 101, 95, 83, 97, 103, 95, 141, 220, 190, 40, 79, 51, 231,
-    255, 120, 239, 43, 131, 23, 141, 91, 111, 61, 201, 208, 226, 211, 57, 238, 211, 6, 207, 99, 112, 89, 172, 213, 124,
-    255, 191, 58, 62, 175, 180, 28, 251, 249, 227, 152, 207, 107, 167, 195, 173, 132, 18, 26, 241, 175, 203, 218, 62,
-    216, 93, 153, 24, 10, 92, 19, 245, 166, 135, 164, 19, 28, 124, 106, 5, 42, 43, 96, 163, 106, 182, 192, 73, 81, 219,
-    186, 23, 155, 228, 106, 238, 183, 49, 137, 255, 174, 235, 155, 200, 71, 186, 66, 60, 187, 158, 60, 16, 240, 114,
-    234, 210, 226, 113, 104, 108, 243, 90, 187, 202, 187, 146, 147, 32, 38, 19, 63, 221, 88, 239, 23, 5, 26, 105, 13,
-    69, 180, 59, 202, 110, 141, 111, 123, 69, 59, 178, 53, 212, 157, 132, 126, 9, 249, 233, 173, 255, 45, 35, 246, 194,
-    139, 83, 57, 196, 106, 209, 233, 81, 222, 73, 80, 199, 224, 133, 157, 251, 30, 143, 160, 60, 47, 70, 249, 116, 238,
-    71, 167, 192, 94, 90, 74, 158, 237, 135, 72, 98, 11, 60, 169, 224, 42, 53, 173, 27, 19, 221, 240, 78, 177, 174, 9,
-    203, 170, 71, 248, 161, 96, 255, 45, 3, 96, 112, 124, 121, 170, 12, 72, 136, 51, 91, 110, 58, 192, 51, 162, 212,
-    197, 234, 50, 251, 159, 172, 212, 80, 101, 131, 235, 103, 187, 23, 28, 14, 57, 49, 202, 75, 61, 161, 243, 6, 119,
-    156, 4, 179, 14, 209, 244, 119, 30, 61, 25, 84, 80, 138, 122, 201, 12, 33, 134, 147, 192, 169, 244, 169, 191, 114,
-    125, 209, 132, 29, 108, 137, 152, 40, 153, 240, 77, 52, 37, 112, 160, 248, 7, 17, 75, 76, 200, 85, 79, 11, 245, 165,
-    126, 214, 203, 37, 82, 30, 220, 237, 183, 102, 23, 190, 215, 76, 221, 149, 253, 153, 217, 181, 139, 3, 205, 186, 58,
-    180, 246, 114, 185, 9, 40, 60, 198, 26, 119, 199, 79, 0, 89, 4, 185, 223, 140, 64, 14, 244, 19, 52, 237, 97, 107,
-    60, 243, 109, 162, 232, 29, 252, 70, 99, 60, 248, 207, 109, 220, 18, 168, 221, 73, 225, 237, 121, 173, 231, 5, 246,
-    58, 27, 227, 103, 146, 56, 224, 220, 122, 234, 57, 155, 39, 172, 178, 93, 194, 47, 99, 71, 58, 153, 250, 19, 224,
-    128, 235, 11, 47, 177, 154, 232, 136, 184, 202, 164, 165, 35, 148, 64, 79, 151, 80, 160, 10, 247, 89, 141, 210, 20,
-    176, 56, 94, 43, 128, 108, 171, 67, 5, 114, 163, 175, 181, 59, 228, 232, 75, 89, 180, 229, 35, 131, 64, 245, 157,
-    112, 181, 174, 108, 20, 179, 182, 145, 250, 102, 159, 127, 242, 125, 180, 221, 138, 63, 30, 152, 109, 183, 3, 137,
-    169, 23, 80, 169, 168, 116, 184, 223, 57, 148, 26, 236, 240, 111, 252, 235, 138, 9, 226, 207, 236, 178, 62, 135,
-    189, 137, 106, 226, 229, 245, 1, 20, 243, 81, 43, 58, 255, 201, 15, 25, 15, 166, 27, 4, 254, 92, 201, 174, 120, 60,
-    147, 136, 187, 0, 101, 12, 206, 57, 138, 56, 209, 57, 18, 226, 77, 87, 87, 9, 180, 136, 79, 180, 65, 167, 188, 30,
-    181, 48, 142, 24, 23, 1, 167, 84, 34, 61, 135, 126, 164, 41, 149, 64, 206, 229, 106, 186, 108, 38, 175, 42, 169,
-    105, 220, 144, 123, 96, 43, 164, 211, 192, 100, 221, 24, 41, 147, 226, 8, 47, 74, 195, 248, 63, 89, 230, 156, 97,
-    137, 243, 112, 184, 196, 16, 13, 236, 170, 250, 117, 233, 159, 98, 183, 243, 48, 253, 50, 43, 44, 16, 10, 226, 66,
-    108, 128, 35, 100, 44, 221, 32, 110, 144, 99, 24, 151, 168, 167, 23, 109, 87, 145, 142, 7, 92, 46, 2, 119, 205, 8,
-    146, 37, 121, 68, 179, 139, 210, 177, 160, 151, 187, 198, 90, 115, 52, 98, 128, 29, 59, 244, 41, 118, 193, 132, 205,
-    12, 72, 230, 106, 30, 246, 63, 1, 208, 177, 102, 138, 71, 120, 82, 207, 123, 231, 69, 210, 250, 42, 223, 69, 61, 38,
-    181, 30, 91, 66, 204, 118, 13, 223, 175, 182, 228, 44, 213, 163, 167, 10, 215, 162, 235, 151, 24, 63, 96, 115, 50,
-    180, 90, 40, 221, 6, 182, 29, 29, 81, 161, 202, 232, 95, 48, 33, 187, 0, 33, 68, 254, 24, 122, 36, 174, 121, 25,
-    208, 166, 191, 98, 41, 251, 65, 152, 244, 246, 247, 189, 33, 71, 20, 136, 148, 148, 212, 224, 124, 160, 200, 64, 63,
-    131, 142, 253, 153, 193, 98, 219, 94, 149, 86, 62, 96, 134, 42, 38, 212, 83, 74, 133, 0, 244, 223, 9, 217, 162, 190,
-    231, 239, 191, 159, 69, 127, 202, 251, 14, 165, 183, 7, 189, 245, 8, 165, 12, 132, 202, 172, 249, 81, 50, 80, 53,
-    91, 252, 252, 170, 124, 238, 112, 56, 69, 119, 63, 58, 76, 21, 11, 203, 185, 108, 37, 79, 152, 46, 113, 98, 59, 48,
-    36, 62, 113, 127, 65, 239, 25, 26, 114, 132, 0, 23, 45, 100, 225, 37, 41, 138, 226, 107, 198, 243, 176, 253, 237,
-    232, 177, 123, 151, 96, 131, 207, 190, 3, 107, 17, 40, 14, 65, 155, 121, 101, 0, 173, 144, 5, 126, 196, 189, 129,
-    217, 54, 112, 118, 137, 186, 93, 218, 24, 8, 35, 251, 238, 120, 194, 55, 56, 246, 82, 232, 142, 242, 244, 69, 111,
-    253, 67, 38, 187, 225, 35, 242, 96, 199, 6, 101, 129, 64, 11, 8, 133, 84, 161, 190, 150, 213, 41, 54, 201, 46, 15,
-    90, 250, 237, 221, 215, 209, 124, 153, 23, 183, 214, 142, 23, 165, 185, 2, 150, 136, 81, 21, 233, 40, 186, 236, 213,
-    221, 184, 45, 43, 38, 247, 224, 27, 216, 194, 38, 116, 103, 17, 30, 20, 193, 29, 225, 236, 216, 161, 113, 28, 247,
-    50, 239, 51, 163, 140, 222, 84, 86, 111, 193, 169, 180, 120, 61, 119, 174, 14, 69, 64, 23, 50, 159, 40, 207, 225, 0,
-    115, 64, 121, 241, 208, 152, 181, 74, 153, 248, 132, 110, 218, 25, 134, 75, 193, 16, 86, 216, 77, 200, 196, 163, 16,
-    1, 164, 3, 121, 168, 106, 5, 46, 65, 227, 29, 78, 1, 211, 169, 30, 181, 25, 153, 108, 247, 115, 92, 197, 27, 200,
-    101, 67, 91, 105, 219, 166, 124, 188, 243, 19, 9, 104, 6, 76, 73, 147, 56, 45, 200, 156, 97, 160, 83, 7, 115, 216,
-    168, 125, 60, 249, 99, 215, 100, 158, 212, 187, 231, 27, 120, 4, 85, 185, 133, 8, 141, 187, 60, 248, 94, 93, 16,
-    182, 53, 148, 149, 251, 226, 183, 214, 35, 61, 151, 223, 230, 78, 236, 44, 235, 2, 75, 56, 90, 64, 47, 233, 0, 164,
-    1, 181, 111, 160, 181, 12, 2, 94, 255, 185, 150, 63, 206, 74, 52, 53, 46, 43, 150, 24, 145, 146, 44, 53, 40, 168,
-    81, 22, 250, 151, 9, 130, 220, 168, 73, 158, 59, 61, 83, 249, 7, 25, 124, 15, 42, 126, 253, 213, 55, 253, 73, 181,
-    210, 44, 230, 111, 238, 181, 226, 134, 183, 109, 101, 46, 138, 70, 1, 246, 117, 10, 58, 14, 237, 145, 19, 233, 81,
-    227, 75, 94, 91, 22, 163, 77, 62, 107, 232, 66, 105, 57, 42, 133, 11, 125, 52, 242, 89, 187, 196, 51, 56, 149, 59,
-    195, 238, 168, 67, 48, 95, 210, 4, 111, 55, 84, 227, 124, 55, 65, 242, 74, 29, 193, 106, 223, 115, 94, 201, 203, 39,
-    108, 61, 25, 84, 48, 132, 65, 105, 7, 34, 237, 198, 15, 236, 124, 42, 82, 75, 8, 232, 245, 108, 11, 213, 145, 37,
-    60, 188, 133, 208, 112, 31, 64, 152, 240, 19, 7, 205, 137, 29, 77, 122, 122, 184, 6, 68, 6, 79, 120, 200, 56, 196,
-    182, 207, 3, 89, 86, 46, 173, 157, 19, 177, 117, 60, 107, 163, 208, 178, 118, 71, 72, 242, 163, 116, 44, 29, 157,
-    123, 167, 102, 142, 25, 229, 231, 57, 181, 146, 37, 127, 96, 21, 125, 44, 0, 77, 116, 108, 210, 65, 157, 233, 104,
-    35, 95, 200, 238, 222, 149, 236, 113, 30, 170, 186, 31, 25, 127, 27, 69, 174, 236, 146, 1, 135, 86, 20, 75, 75, 2,
-    8, 245, 74, 140, 140, 252, 55, 26, 90, 241, 8, 32, 23, 207, 217, 37, 109, 235, 36, 71, 66, 203, 102, 99, 159, 151,
-    216, 232, 57, 63, 157, 174, 112, 103, 166, 174, 223, 146, 176, 67, 20, 219, 143, 49, 189, 179, 239, 46, 194, 125,
-    94, 5, 11, 198, 169, 232, 54, 163, 128, 65, 157, 15, 111, 7, 233, 87, 139, 245, 255, 148, 229, 0, 1, 183, 156, 215,
-    163, 154, 62, 109, 86, 208, 194, 88, 133, 141, 233, 237, 91, 248, 154, 139, 251, 71, 204, 142, 251, 201, 44, 190,
-    71, 215, 39, 94, 140, 238, 57, 111, 29, 4, 123, 99, 62, 251, 8, 102, 131, 3, 13, 95, 133, 217, 41, 26, 114, 131, 85,
-    140, 198, 104, 126, 62, 117, 221, 115, 99, 5, 99, 237, 154, 197, 119, 241, 113, 191, 158, 244, 240, 192, 127, 22, 8,
-    147, 112, 160, 210, 173, 108, 150, 19, 24, 122, 240, 74, 107, 151, 5, 149, 78, 135, 113, 190, 189, 233, 24, 133,
-    161, 35, 252, 219, 42, 45, 107, 13, 101, 11, 101, 25, 8, 189, 177, 242, 238, 0, 106, 46, 75, 63, 91, 120, 97, 65,
-    112, 66, 175, 82, 107, 155, 95, 183, 199, 115, 186, 28, 243, 147, 206, 239, 188, 121, 1, 178, 137, 136, 178, 150,
-    131, 93, 189, 209, 63, 70, 35, 204, 24, 117, 201, 28, 172, 17, 179, 151, 22, 210, 67, 153, 157, 161, 234, 7, 247,
-    233, 67, 33, 142, 60, 130, 32, 164, 175, 141, 21, 94, 25, 189, 187, 27, 194, 190, 220, 24, 145, 130, 174, 197, 130,
-    105, 182, 12, 76, 31, 106, 32, 56, 155, 65, 93, 39, 51, 118, 223, 109, 74, 233, 98, 16, 35, 197, 101, 205, 10, 190,
-    181, 61, 125, 71, 140, 117, 139, 255, 70, 65, 254, 180, 194, 198, 253, 186, 61, 21, 90, 97, 26, 39, 16, 227, 108,
-    243, 46, 9, 60, 139, 17, 122, 102, 196, 130, 47, 104, 168, 155, 75, 62, 157, 223, 43, 49, 216, 131, 177, 190, 182,
-    81, 161, 198, 18, 107, 61, 149, 9, 127, 231, 158, 171, 30, 219, 187, 115, 191, 187, 55, 141, 59, 235, 62, 188, 81,
-    25, 35, 176, 101, 199, 213, 66, 80, 226, 102, 169, 96, 114, 78, 91, 141, 212, 167, 119, 64, 102, 62, 216, 171, 24,
-    159, 52, 225, 10, 132, 71, 201, 153, 83, 191, 184, 132, 135, 50, 123, 228, 139, 34, 253, 142, 82, 174, 60, 247, 94,
-    155, 7, 199, 51, 146, 127, 28, 166, 108, 57, 253, 121, 95, 51, 180, 12, 83, 86, 141, 43, 60, 10, 206, 127, 236, 24,
-    200, 237, 46, 109, 88, 113, 52, 205, 178, 176, 104, 72, 180, 189, 220, 252, 85, 214, 1, 52, 85, 226, 58, 45, 230,
-    248, 51, 224, 94, 15, 222, 234, 253, 221, 59, 181, 172, 28, 1, 235, 17, 127, 215, 141, 221, 32, 13, 109, 235, 99,
-    224, 110, 164, 26, 51, 53, 14, 121, 99, 128, 149, 116, 172, 92, 206, 145, 221, 87, 122, 61, 78, 8, 149, 19, 232,
-    208, 30, 194, 57, 27, 62, 4, 22, 49, 168, 206, 133, 87, 121, 241, 33, 183, 154, 191, 181, 127, 227, 73, 148, 237,
-    23, 39, 86, 193, 1, 135, 23, 226, 224, 200, 112, 17, 138, 224, 82, 124, 213, 138, 60, 87, 191, 137, 84, 46, 114, 91,
-    99, 185, 206, 169, 50, 207, 103, 164, 140, 226, 249, 236, 113, 133, 131, 27, 140, 50, 36, 129, 139, 175, 230, 86,
-    61, 128, 110, 187, 8, 180, 122, 39, 13, 70, 28, 20, 94, 233, 36, 82, 243, 249, 92, 88, 55, 140, 49, 129, 150, 12,
-    182, 168, 132, 51, 29, 232, 81, 202, 135, 42, 229, 52, 101, 130, 13, 159, 255, 118, 76, 134, 133, 141, 138, 110,
-    177, 86, 87, 225, 62, 97, 76, 205, 224, 224, 154, 21, 158, 153, 193, 183, 183, 195, 9, 75, 20, 14, 51, 161, 167,
-    164, 184, 13, 240, 242, 174, 130, 96, 212, 141, 133, 251, 1, 4, 151, 191, 1, 107, 176, 136, 145, 1, 34, 122, 78, 78,
-    242, 99, 145, 141, 220, 241, 32, 116, 97, 143, 156, 40, 193, 35, 224, 124, 185, 166, 245, 76, 179, 41, 102, 116,
-    190, 222, 156, 219, 234, 175, 162, 14, 229, 52, 9, 178, 74, 42, 197, 237, 196, 121, 154, 41, 246, 211, 233, 142,
-    190, 31, 50, 255, 201, 171, 95, 181, 128, 185, 175, 206, 7, 172, 144, 131, 109, 65, 166, 166, 33, 128, 40, 66, 234,
-    40, 35, 55, 93, 167, 95, 53, 98, 119, 50, 231, 231, 59, 14, 16, 188, 169, 10, 155, 100, 209, 12, 171, 193, 101, 13,
-    51, 91, 31, 70, 63, 90, 228, 186, 120, 94, 217, 234, 151, 81, 117, 197, 72, 251, 178, 80, 143, 228, 14, 19, 133, 49,
-    214, 134, 119, 69, 206, 213, 21, 80, 84, 231, 254, 18, 253, 179, 17, 132, 72, 110, 65, 12, 52, 171, 170, 125, 97,
-    179, 196, 177, 243, 8, 253, 189, 245, 63, 26, 169, 200, 16, 234, 111, 165, 30, 162, 68, 9, 84, 240, 24, 7, 9, 13,
-    184, 81, 162, 211, 167, 104, 226, 63, 116, 42, 86, 63, 199, 44, 41, 100, 19, 152, 242, 162, 100, 37, 48, 67, 174, 6,
-    136, 63, 36, 3, 203, 202, 19, 82, 151, 114, 137, 5, 11, 59, 123, 157, 248, 82, 116, 46, 123, 97, 190, 63, 236, 195,
-    3, 74, 245, 53, 16, 118, 252, 17, 217, 182, 154, 217, 89, 120, 65, 73, 40, 219, 166, 53, 69, 177, 61, 28, 122, 82,
-    26, 61, 194, 87, 228, 13, 80, 5, 215, 36, 50, 154, 190, 115, 187, 82, 200, 160, 140, 108, 212, 166, 78, 242, 104,
-    10, 176, 43, 199, 183, 24, 135, 120, 159, 42, 37, 45, 184, 7, 98, 44, 102, 20, 253, 200, 4, 16, 116, 10, 230, 226,
-    22, 177, 0, 5, 4, 211, 233, 29, 124, 226, 139, 213, 144, 113, 117, 246, 186, 32, 20, 93, 64, 151, 226, 150, 95, 175,
-    195, 225, 42, 187, 8, 165, 207, 119, 249, 3, 108, 71, 9, 237, 132, 51, 88, 9, 97, 226, 225, 83, 195, 79, 60, 66, 78,
-    254, 83, 23, 40, 87, 149, 189, 112, 73, 86, 29, 209, 47, 132, 88, 189, 35, 80, 185, 58, 50, 96, 59, 117, 98, 72, 72,
-    211, 221, 215, 227, 223, 252, 222, 9, 225, 84, 162, 159, 35, 103, 29, 210, 162, 115, 121, 210, 65, 66, 161, 156, 1,
-    41, 108, 169, 173, 66, 179, 131, 230, 213, 10, 210, 213, 169, 233, 218, 32, 171, 137, 33, 161, 12, 79, 136, 1, 122,
-    240, 64, 105, 149, 250, 169, 255, 248, 71, 115, 190, 194, 174, 232, 113, 181, 166, 86, 184, 136, 159, 129, 119, 80,
-    202, 104, 68, 19, 130, 171, 237, 249, 153, 147, 246, 5, 14, 36, 29, 99, 91, 67, 18, 119, 194, 112, 188, 229, 10,
-    227, 135, 245, 44, 46, 135, 138, 10, 6, 124, 79, 114, 168, 250, 7, 229, 81, 173, 4, 68, 92, 174, 176, 41, 227, 215,
-    254, 152, 234, 201, 162, 77, 246, 172, 59, 240, 62, 191, 205, 183, 220, 129, 158, 199, 169, 146, 97, 224, 27, 152,
-    246, 218, 189, 82, 212, 145, 64, 77, 67, 3, 235, 112, 162, 65, 172, 213, 138, 68, 14, 224, 0, 230, 96, 187, 13, 15,
-    219, 122, 49, 42, 187, 110, 170, 222, 154, 35, 37, 19, 128, 24, 231, 238, 165, 9, 175, 175, 105, 78, 148, 9, 218,
-    201, 165, 101, 98, 67, 207, 41, 224, 73, 102, 139, 37, 108, 218, 31, 142, 162, 102, 6, 172, 22, 227, 46, 94, 164,
-    204, 240, 26, 149, 203, 249, 13, 128, 196, 158, 105, 115, 196, 109, 138, 182, 111, 176, 116, 136, 40, 71, 67, 239,
-    137, 159, 31, 246, 44, 196, 205, 124, 85, 203, 121, 13, 96, 216, 253, 36, 124, 146, 202, 84, 64, 58, 137, 26, 245,
-    186, 114, 208, 107, 228, 71, 144, 247, 21, 11, 49, 67, 192, 104, 44, 194, 192, 138, 100, 207, 207, 30, 30, 98, 160,
-    136, 184, 184, 154, 70, 220, 231, 222, 29, 49, 167, 237, 220, 215, 251, 115, 17, 9, 1, 17, 105, 145, 158, 41, 47,
-    16, 128, 20, 5, 201, 205, 195, 164, 53, 213, 123, 36, 43, 131, 11, 221, 63, 48, 228, 248, 127, 128, 85, 82, 248, 37,
-    142, 203, 72, 239, 247, 178, 240, 209, 183, 164, 61, 120, 97, 243, 123, 87, 214, 72, 107, 155, 119, 59, 118, 79,
-    255, 28, 60, 150, 200, 109, 60, 107, 95, 31, 78, 7, 185, 68, 96, 89, 26, 193, 250, 14, 151, 12, 32, 219, 62, 139,
-    139, 49, 156, 159, 231, 187, 145, 218, 18, 20, 5, 6, 66, 71, 79, 235, 6, 223, 169, 252, 37, 227, 10, 3, 95, 222,
-    124, 123, 37, 53, 58, 231, 139, 184, 220, 107, 244, 164, 149, 19, 122, 137, 105, 14, 31, 81, 31, 201, 103, 195, 230,
-    55, 22, 160, 94, 70, 184, 29, 182, 108, 168, 31, 228, 69, 152, 108, 122, 153, 153, 111, 160, 132, 145, 177, 6, 195,
-    3, 126, 188, 48, 115, 120, 116, 197, 249, 80, 170, 147, 63, 241, 65, 222, 82, 7, 165, 125, 134, 54, 237, 221, 230,
-    202, 139, 220, 240, 8, 193, 6, 59, 109, 221, 190, 30, 20, 182, 75, 35, 26, 92, 125, 85, 41, 55, 14, 115, 97, 37,
-    149, 238, 120, 29, 80, 98, 150, 44, 85, 217, 239, 164, 70, 37, 166, 63, 107, 38, 86, 150, 86, 234, 104, 33, 53, 75,
-    125, 5, 244, 65, 47, 249, 114, 73, 110, 112, 99, 113, 109, 111, 1, 86, 67, 23, 45, 76, 130, 25, 114, 170, 242, 65,
-    41, 6, 4, 149, 18, 215, 99, 69, 33, 48, 106, 117, 35, 221, 188, 241, 157, 11, 215, 49, 234, 60, 105, 176, 71, 162,
-    70, 23, 120, 120, 157, 1, 21, 49, 80, 231, 93, 150, 219, 164, 103, 57, 66, 67, 246, 76, 237, 197, 109, 20, 173, 170,
-    55, 148, 154, 230, 113, 253, 164, 205, 166, 57, 87, 115, 121, 218, 169, 3, 137, 144, 145, 139, 27, 203, 189, 45, 3,
-    134, 186, 222, 66, 131, 216, 174, 188, 1, 108, 6, 211, 18, 39, 190, 152, 149, 88, 20, 100, 145, 228, 243, 238, 73,
-    122, 101, 253, 56, 28, 60, 218, 168, 0, 12, 66, 121, 175, 203, 111, 247, 7, 121, 82, 149, 128, 31, 62, 141, 51, 214,
-    38, 105, 2, 35, 10, 247, 228, 47, 144, 112, 181, 70, 103, 55, 233, 41, 220, 221, 97, 148, 237, 206, 119, 94, 15, 11,
-    117, 41, 226, 222, 173, 255, 194, 193, 100, 246, 199, 156, 108, 67, 125, 144, 53, 126, 200, 88, 221, 185, 98, 66,
-    61, 4, 187, 230, 8, 178, 199, 8, 130, 187, 37, 239, 51, 61, 0, 72, 225, 64, 238, 152, 251, 27, 84, 105, 220, 44,
-    238, 161, 216, 246, 187, 142, 147, 128, 54, 10, 236, 228, 86, 133, 5, 156, 159, 41, 218, 235, 123, 34, 12, 120, 250,
-    11, 93, 139, 56, 244, 230, 176, 234, 97, 60, 186, 216, 28, 48, 66, 37, 95, 1, 186, 70, 95, 15, 148, 17, 254, 61,
-    139, 67, 219, 61, 246, 68, 109, 110, 70, 66, 221, 80, 21, 31, 151, 157, 15, 255, 85, 191, 186, 142, 184, 24, 105,
-    160, 200, 157, 66, 83, 79, 170, 122, 221, 110, 194, 125, 120, 241, 69, 158, 54, 67, 196, 1, 230, 76, 24, 133, 168,
-    110, 96, 250, 123, 90, 167, 250, 162, 209, 23, 231, 234, 241, 154, 251, 1, 68, 222, 106, 66, 225, 247, 21, 199, 111,
-    10, 91, 215, 171, 161, 71, 39, 10, 102, 173, 89, 118, 204, 169, 67, 200, 180, 108, 66, 13, 238, 15, 39, 219, 111,
-    222, 86, 132, 98, 213, 252, 62, 228, 153, 20, 190, 174, 80, 7, 57, 37, 205, 10, 109, 192, 243, 200, 137, 216, 31,
-    170, 226, 157, 231, 226, 117, 146, 123, 207, 61, 46, 225, 95, 158, 63, 69, 89, 201, 179, 176, 226, 243, 205, 82, 82,
-    153, 252, 153, 58, 65, 171, 193, 129, 149, 216, 247, 56, 131, 150, 197, 64, 53, 45, 119, 96, 181, 32, 71, 193, 105,
-    189, 134, 230, 54, 177, 181, 200, 2, 149, 103, 81, 188, 25, 253, 101, 229, 45, 44, 5, 0, 111, 144, 148, 208, 21, 18,
-    74, 203, 141, 246, 209, 52, 102, 154, 120, 123, 82, 36, 63, 136, 48, 188, 115, 79, 27, 164, 85, 160, 94, 41, 206,
-    131, 42, 92, 137, 208, 106, 29, 22, 227, 242, 225, 6, 212, 107, 217, 135, 124, 106, 188, 64, 129, 193, 166, 46, 115,
-    57, 28, 83, 125, 209, 32, 184, 132, 173, 63, 181, 107, 13, 231, 133, 207, 106, 28, 87, 99, 242, 176, 195, 112, 2,
-    191, 90, 62, 97, 2, 157, 93, 238, 83, 182, 105, 182, 46, 119, 134, 245, 166, 83, 213, 253, 227, 206, 183, 67, 14,
-    26, 203, 101, 206, 141, 201, 140, 79, 89, 43, 54, 116, 43, 185, 113, 127, 64, 165, 148, 73, 84, 173, 241, 197, 248,
-    196, 192, 157, 253, 99, 224, 61, 234, 175, 185, 123, 47, 162, 185, 154, 119, 184, 156, 6, 251, 136, 18, 2, 105, 184,
-    139, 38, 11, 176, 246, 77, 15, 221, 176, 28, 84, 23, 26, 34, 108, 41, 222, 132, 137, 150, 212, 121, 68, 240, 236,
-    77, 250, 17, 139, 51, 224, 83, 255, 26, 125, 10, 143, 90, 246, 23, 12, 51, 16, 234, 81, 94, 78, 212, 50, 162, 35,
-    84, 2, 63, 45, 28, 130, 16, 35, 244, 132, 138, 175, 45, 90, 136, 196, 194, 65, 95, 151, 250, 140, 189, 102, 210, 81,
-    189, 201, 69, 43, 203, 215, 110, 109, 85, 44, 14, 213, 43, 129, 2, 205, 49, 202, 100, 108, 176, 185, 125, 248, 6,
-    186, 92, 254, 135, 213, 85, 214, 147, 145, 75, 16, 238, 191, 203, 90, 98, 174, 79, 81, 149, 125, 94, 149, 153, 58,
-    48, 80, 218, 74, 176, 197, 214, 192, 91, 132, 78, 35, 58, 20, 238, 81, 249, 246, 2, 118, 114, 73, 114, 20, 118, 216,
-    249, 9, 5, 125, 33, 119, 68, 155, 12, 150, 56, 214, 26, 243, 168, 178, 84, 221, 74, 126, 89, 143, 205, 206, 208, 37,
-    73, 1, 97, 0, 136, 217, 50, 158, 13, 208, 170, 52, 96, 14, 61, 51, 69, 147, 249, 86, 233, 182, 41, 220, 21, 71, 33,
-    2, 254, 12, 113, 64, 208, 115, 64, 150, 48, 63, 163, 176, 104, 230, 200, 65, 189, 107, 204, 71, 211, 80, 195, 155,
-    147, 206, 221, 223, 167, 153, 175, 204, 74, 179, 213, 142, 88, 255, 217, 216, 6, 103, 206, 72, 25, 217, 86, 171, 57,
-    14, 172, 190, 35, 196, 51, 32, 205, 151, 113, 224, 5, 199, 76, 211, 27, 90, 33, 195, 167, 122, 158, 26, 215, 196,
-    147, 182, 6, 81, 148, 92, 228, 123, 217, 122, 190, 249, 179, 223, 97, 71, 158, 132, 127, 28, 40, 247, 74, 37, 88,
-    248, 34, 6, 222, 58, 119, 182, 113, 61, 27, 184, 241, 145, 111, 31, 253, 47, 119, 180, 249, 50, 141, 54, 43, 76,
-    200, 197, 173, 45, 6, 130, 242, 14, 58, 70, 187, 218, 4, 146, 113, 136, 11, 28, 74, 188, 130, 55, 55, 109, 50, 83,
-    18, 121, 11, 10, 249, 100, 34, 63, 26, 79, 157, 163, 26, 221, 119, 45, 116, 86, 37, 110, 60, 194, 172, 97, 151, 122,
-    129, 193, 186, 124, 23, 36, 30, 87, 175, 6, 9, 92, 215, 126, 218, 216, 24, 217, 254, 218, 135, 189, 67, 206, 243,
-    228, 151, 209, 113, 74, 207, 72, 153, 147, 235, 62, 74, 108, 58, 132, 173, 186, 127, 171, 50, 126, 140, 251, 243,
-    108, 75, 79, 231, 201, 244, 24, 83, 205, 131, 180, 75, 200, 222, 168, 71, 13, 116, 85, 1, 227, 2, 111, 116, 147, 80,
-    222, 81, 211, 22, 10, 125, 159, 92, 41, 158, 20, 53, 197, 11, 99, 49, 182, 69, 9, 160, 99, 152, 64, 61, 73, 115,
-    161, 90, 88, 145, 18, 193, 159, 101, 73, 7, 135, 210, 16, 31, 149, 128, 17, 252, 152, 162, 129, 104, 240, 129, 151,
-    205, 87, 82, 229, 200, 238, 4, 171, 211, 195, 147, 164, 49, 35, 25, 235, 221, 129, 205, 178, 90, 198, 203, 83, 175,
-    36, 250, 54, 100, 198, 216, 252, 240, 194, 51, 106, 76, 70, 237, 216, 174, 107, 86, 200, 175, 200, 64, 185, 21, 98,
-    241, 17, 37, 212, 104, 100, 219, 81, 52, 56, 224, 194, 33, 118, 231, 134, 18, 243, 238, 213, 198, 154, 96, 194, 233,
-    252, 139, 164, 206, 216, 30, 147, 15, 34, 27, 78, 143, 19, 136, 43, 130, 73, 147, 114, 59, 176, 239, 47, 110, 153,
-    109, 221, 213, 234, 35, 190, 148, 145, 79, 250, 218, 220, 49, 23, 192, 85, 228, 35, 90, 235, 84, 235, 221, 48, 88,
-    158, 201, 109, 219, 53, 184, 9, 233, 128, 137, 97, 125, 223, 66, 38, 30, 110, 33, 197, 137, 76, 168, 251, 122, 205,
-    71, 18, 20, 145, 65, 93, 57, 113, 38, 154, 57, 26, 230, 158, 136, 253, 54, 90, 113, 5, 197, 99, 176, 135, 91, 139,
-    52, 214, 44, 251, 98, 239, 160, 227, 241, 233, 243, 74, 118, 84, 108, 67, 46, 34, 167, 55, 48, 56, 147, 174, 40, 13,
-    162, 1, 242, 218, 89, 160, 119, 168, 254, 118, 147, 44, 22, 74, 221, 211, 121, 97, 19, 193, 122, 244, 50, 160, 7,
-    226, 211, 175, 227, 72, 24, 8, 223, 217, 249, 231, 10, 201, 96, 171, 215, 117, 248, 94, 172, 111, 129, 156, 141, 39,
-    75, 92, 153, 53, 137, 149, 102, 128, 57, 74, 97, 203, 10, 39, 62, 172, 43, 198, 237, 59, 59, 237, 219, 29, 114, 242,
-    16, 238, 9, 89, 30, 88, 20, 35, 157, 171, 30, 11, 25, 178, 38, 173, 252, 228, 137, 173, 223, 196, 242, 132, 179,
-    165, 9, 204, 175, 221, 197, 222, 121, 90, 41, 25, 142, 255, 73, 195, 254, 177, 143, 23, 243, 41, 167, 232, 80, 109,
-    216, 119, 208, 203, 217, 69, 255, 202, 137, 36, 249, 156, 21, 220, 240, 23, 59, 62, 236, 238, 106, 197, 111, 216,
-    32, 123, 100, 253, 5, 7, 66, 145, 105, 154, 255, 174, 216, 132, 211, 80, 130, 226, 244, 249, 75, 122, 28, 242, 149,
-    196, 133, 99, 113, 233, 89, 140, 172, 61, 15, 10, 37, 59, 120, 180, 169, 195, 104, 243, 120, 61, 87, 58, 4, 252, 32,
-    40, 205, 76, 239, 186, 198, 214, 32, 62, 201, 19, 185, 110, 220, 70, 64, 231, 50, 80, 57, 0, 15, 116, 110, 104, 73,
-    101, 171, 121, 143, 103, 132, 49, 7, 93, 1, 116, 65, 137, 18, 170, 192, 130, 231, 217, 240, 182, 237, 31, 114, 152,
-    81, 210, 63, 218, 1, 175, 5, 250, 55, 48, 217, 152, 44, 192, 78, 111, 150, 187, 201, 182, 124, 38, 98, 65, 89, 102,
-    236, 140, 243, 174, 153, 110, 83, 89, 95, 128, 156, 152, 126, 118, 116, 130, 214, 86, 217, 92, 25, 55, 161, 188, 61,
-    42, 248, 60, 89, 8, 76, 228, 190, 140, 241, 76, 52, 73, 149, 252, 164, 120, 105, 34, 22, 117, 11, 81, 32, 76, 250,
-    55, 208, 241, 28, 241, 225, 202, 207, 98, 184, 254, 48, 15, 239, 231, 8, 85, 184, 202, 37, 118, 174, 248, 21, 27,
-    46, 145, 112, 189, 66, 114, 65, 232, 54, 240, 245, 42, 205, 108, 89, 125, 14, 55, 81, 201, 183, 76, 174, 76, 63,
-    158, 161, 217, 28, 54, 201, 182, 135, 95, 132, 176, 159, 74, 232, 100, 229, 231, 192, 74, 211, 68, 114, 12, 61, 106,
-    162, 208, 19, 41, 20, 144, 25, 164, 64, 57, 244, 190, 64, 46, 95, 4, 95, 248, 217, 78, 160, 133, 173, 243, 96, 208,
-    57, 23, 123, 252, 37, 161, 221, 146, 119, 175, 45, 66, 240, 94, 238, 153, 248, 70, 71, 248, 119, 235, 51, 154, 160,
-    162, 226, 41, 11, 255, 13, 198, 101, 93, 204, 93, 122, 30, 246, 212, 197, 209, 199, 125, 127, 235, 53, 31, 146, 247,
-    150, 48, 241, 214, 239, 79, 138, 99, 245, 71, 185, 44, 215, 113, 238, 73, 32, 54, 153, 157, 248, 31, 127, 217, 230,
-    145, 189, 166, 6, 149, 1, 208, 179, 38, 97, 114, 119, 183, 205, 4, 77, 86, 85, 144, 108, 212, 254, 230, 29, 250,
-    215, 109, 198, 114, 145, 132, 94, 96, 156, 89, 227, 43, 225, 43, 65, 13, 107, 113, 57, 45, 193, 233, 51, 156, 214,
-    10, 208, 109, 203, 199, 109, 36, 68, 169, 26, 221, 123, 197, 210, 218, 171, 152, 68, 97, 124, 103, 98, 217, 69, 179,
-    85, 125, 69, 126, 76, 184, 81, 72, 73, 53, 140, 182, 240, 254, 198, 1, 215, 200, 148, 185, 53, 125, 116, 17, 68,
-    137, 85, 42, 181, 223, 211, 13, 226, 187, 54, 85, 42, 196, 225, 179, 60, 9, 231, 14, 121, 71, 27, 74, 169, 240, 100,
-    109, 71, 203, 74, 128, 196, 40, 80, 187, 222, 54, 184, 153, 82, 74, 170, 113, 177, 82, 171, 118, 171, 168, 79, 131,
-    10, 225, 111, 69, 101, 43, 174, 57, 189, 101, 64, 206, 172, 117, 223, 165, 12, 39, 70, 37, 199, 4, 228, 90, 75, 55,
-    22, 229, 44, 88, 245, 176, 90, 100, 228, 89, 225, 110, 98, 56, 237, 173, 165, 194, 238, 49, 172, 144, 160, 156, 208,
-    70, 46, 178, 102, 52, 179, 194, 227, 74, 210, 72, 29, 95, 65, 127, 31, 65, 66, 96, 111, 40, 137, 96, 128, 5, 115,
-    25, 143, 42, 132, 5, 25, 174, 133, 42, 37, 39, 189, 20, 71, 218, 171, 232, 16, 214, 76, 89, 233, 85, 95, 222, 66,
-    137, 161, 87, 210, 220, 119, 102, 213, 113, 8, 111, 233, 151, 136, 164, 53, 249, 55, 93, 55, 125, 36, 219, 10, 82,
-    239, 30, 31, 68, 242, 0, 75, 236, 247, 211, 225, 154, 50, 144, 183, 181, 144, 196, 64, 52, 242, 17, 8, 182, 105,
-    193, 159, 112, 112, 225, 123, 127, 204, 47, 223, 211, 230, 130, 194, 208, 119, 162, 158, 61, 224, 69, 98, 150, 209,
-    101, 252, 187, 163, 191, 103, 243, 68, 235, 117, 4, 165, 179, 16, 35, 166, 119, 149, 51, 145, 86, 105, 131, 174,
-    200, 52, 207, 191, 245, 72, 44, 113, 196, 50, 93, 60, 117, 196, 86, 164, 8, 226, 239, 137, 196, 247, 161, 81, 10, 0,
-    213, 170, 161, 185, 237, 205, 205, 211, 230, 162, 156, 139, 56, 11, 87, 187, 62, 113, 193, 131, 147, 72, 119, 230,
-    150, 52, 91, 175, 30, 218, 97, 223, 138, 13, 234, 176, 236, 199, 188, 214, 157, 0, 168, 19, 201, 229, 175, 83, 14,
-    130, 5, 189, 24, 106, 35, 250, 170, 212, 1, 65, 34, 181, 152, 64, 35, 125, 173, 221, 242, 235, 144, 255, 119, 244,
-    60, 68, 93, 117, 30, 255, 207, 238, 111, 48, 158, 88, 90, 105, 138, 86, 130, 87, 245, 46, 99, 54, 162, 134, 63, 73,
-    42, 110, 84, 6, 177, 159, 157, 32, 176, 175, 185, 41, 82, 223, 185, 239, 220, 167, 234, 176, 166, 29, 1, 141, 46,
-    60, 47, 157, 55, 212, 253, 68, 143, 167, 183, 114, 174, 171, 156, 188, 180, 177, 91, 253, 156, 45, 226, 72, 64, 207,
-    120, 29, 128, 94, 3, 193, 204, 59, 218, 208, 24, 249, 227, 137, 196, 13, 165, 84, 214, 237, 124, 6, 9, 170, 138,
-    101, 139, 29, 34, 95, 102, 120, 48, 133, 250, 131, 62, 144, 218, 212, 41, 50, 135, 192, 6, 227, 181, 214, 113, 235,
-    237, 23, 213, 165, 46, 34, 167, 33, 188, 210, 72, 252, 248, 140, 151, 227, 90, 201, 64, 252, 5, 179, 76, 43, 153,
-    237, 250, 3, 207, 75, 202, 125, 192, 30, 17, 119, 19, 203, 233, 141, 206, 187, 52, 28, 51, 168, 29, 173, 111, 57,
-    224, 100, 229, 88, 129, 175, 220, 212, 43, 84, 113, 89, 117, 216, 182, 23, 151, 54, 189, 106, 145, 233, 247, 204,
-    143, 251, 252, 11, 69, 54, 40, 42, 96, 178, 54, 93, 128, 229, 11, 122, 22, 232, 10, 45, 91, 119, 59, 14, 221, 112,
-    25, 223, 24, 120, 126, 116, 137, 33, 86, 128, 103, 212, 103, 150, 207, 51, 190, 160, 133, 173, 41, 95, 58, 61, 142,
-    122, 193, 153, 208, 249, 207, 104, 112, 63, 68, 219, 89, 71, 238, 105, 234, 247, 238, 108, 63, 165, 154, 175, 36,
-    53, 113, 47, 198, 19, 31, 161, 32, 184, 237, 196, 101, 69, 136, 121, 191, 71, 88, 220, 147, 152, 113, 98, 152, 130,
-    32, 96, 227, 27, 3, 136, 17, 130, 251, 112, 107, 17, 70, 27, 11, 3, 232, 169, 145, 126, 89, 0, 213, 240, 52, 76,
-    137, 62, 15, 80, 102, 107, 149, 150, 27, 215, 131, 41, 17, 194, 125, 85, 203, 195, 75, 219, 135, 12, 123, 120, 41,
-    118, 161, 137, 231, 46, 212, 156, 45, 117, 44, 5, 109, 94, 105, 157, 130, 125, 179, 202, 236, 149, 35, 15, 64, 236,
-    57, 205, 160, 216, 201, 88, 242, 124, 2, 99, 205, 237, 87, 229, 46, 131, 239, 172, 42, 245, 163, 53, 140, 36, 165,
-    75, 131, 177, 143, 104, 13, 108, 116, 201, 71, 85, 80, 233, 153, 128, 110, 151, 184, 145, 129, 45, 53, 231, 100,
-    165, 62, 206, 108, 171, 34, 128, 138, 4, 60, 139, 119, 187, 101, 232, 47, 107, 63, 59, 233, 171, 241, 23, 173, 8,
-    131, 135, 194, 31, 107, 244, 255, 18, 168, 137, 63, 192, 222, 37, 39, 196, 227, 145, 25, 251, 167, 221, 65, 45, 127,
-    119, 153, 209, 15, 121, 63, 199, 173, 255, 104, 224, 222, 203, 220, 122, 201, 95, 109, 177, 245, 150, 131, 4, 177,
-    78, 223, 161, 219, 75, 248, 161, 251, 87, 143, 235, 216, 196, 149, 183, 237, 252, 253, 0, 114, 94, 176, 65, 127,
-    153, 83, 173, 53, 209, 232, 31, 48, 142, 143, 55, 175, 137, 154, 70, 53, 228, 111, 181, 250, 137, 109, 78, 98, 220,
-    60, 65, 74, 255, 142, 7, 99, 37, 243, 88, 137, 136, 173, 18, 53, 68, 187, 84, 212, 222, 252, 116, 152, 81, 141, 148,
-    86, 136, 182, 166, 74, 11, 10, 201, 239, 165, 132, 231, 157, 236, 181, 208, 53, 234, 2, 175, 122, 165, 68, 224, 255,
-    116, 148, 126, 156, 75, 20, 92, 103, 9, 141, 186, 78, 255, 9, 194, 95, 242, 91, 159, 211, 98, 205, 231, 217, 184,
-    189, 132, 182, 234, 174, 239, 47, 49, 71, 235, 190, 19, 169, 91, 0, 178, 176, 173, 63, 115, 173, 202, 78, 42, 131,
-    55, 253, 184, 156, 94, 93, 125, 18, 112, 178, 87, 28, 173, 15, 24, 28, 136, 102, 229, 75, 179, 91, 76, 74, 196, 109,
-    9, 182, 23, 206, 238, 206, 79, 30, 226, 2, 125, 81, 0, 174, 49, 153, 19, 141, 21, 120, 249, 177, 226, 154, 30, 88,
-    221, 113, 126, 98, 92, 80, 234, 7, 135, 179, 66, 42, 132, 175, 2, 55, 161, 232, 29, 180, 0, 246, 98, 245, 157, 58,
-    98, 72, 121, 146, 123, 229, 175, 81, 184, 78, 144, 32, 202, 19, 232, 14, 76, 162, 192, 178, 144, 149, 44, 115, 221,
-    98, 129, 119, 44, 30, 13, 143, 42, 128, 190, 121, 221, 211, 251, 243, 96, 51, 67, 104, 55, 128, 60, 40, 97, 125,
-    205, 64, 198, 242, 120, 55, 234, 186, 220, 186, 243, 205, 116, 199, 126, 244, 143, 26, 218, 254, 7, 203, 88, 198,
-    25, 147, 112, 206, 80, 210, 239, 63, 93, 142, 27, 71, 111, 157, 17, 219, 84, 114, 77, 195, 163, 203, 50, 140, 230,
-    81, 131, 99, 10, 161, 56, 243, 138, 26, 230, 43, 111, 91, 181, 212, 46, 21, 166, 108, 178, 82, 117, 110, 100, 81,
-    103, 132, 81, 160, 238, 235, 186, 185, 48, 27, 128, 1, 61, 118, 127, 74, 48, 224, 250, 126, 186, 165, 91, 247, 104,
-    190, 62, 167, 94, 50, 68, 73, 240, 227, 229, 141, 151, 125, 241, 144, 220, 106, 70, 97, 80, 240, 12, 171, 86, 187,
-    38, 93, 154, 75, 188, 220, 164, 131, 77, 226, 106, 221, 83, 188, 220, 16, 46, 156, 42, 213, 71, 136, 151, 68, 4,
-    165, 203, 38, 154, 66, 138, 232, 117, 111, 209, 49, 200, 50, 161, 44, 109, 32, 208, 203, 184, 146, 30, 136, 241,
-    193, 241, 192, 122, 179, 15, 195, 80, 49, 9, 26, 143, 28, 198, 182, 49, 79, 148, 18, 252, 115, 23, 21, 180, 251, 29,
-    21, 254, 145, 6, 205, 20, 75, 235, 105, 186, 76, 76, 92, 32, 144, 138, 43, 74, 85, 7, 105, 251, 127, 135, 91, 145,
-    202, 151, 95, 251, 7, 205, 63, 59, 204, 226, 42, 196, 59, 202, 18, 2, 205, 51, 145, 49, 125, 217, 51, 231, 103, 139,
-    44, 41, 153, 251, 67, 108, 97, 206, 115, 247, 221, 191, 21, 220, 75, 125, 179, 255, 143, 100, 229, 39, 202, 215,
-    189, 19, 53, 207, 24, 216, 105, 238, 121, 73, 141, 147, 195, 125, 12, 38, 161, 37, 100, 28, 23, 215, 232, 1, 248,
-    248, 157, 73, 108, 133, 157, 199, 17, 135, 31, 243, 129, 122, 84, 167, 84, 206, 112, 35, 84, 207, 7, 84, 186, 192,
-    205, 251, 248, 183, 171, 49, 250, 224, 15, 209, 44, 240, 221, 125, 95, 52, 67, 240, 118, 18, 245, 222, 109, 142, 31,
-    49, 4, 73, 93, 238, 251, 129, 143, 78, 25, 144, 40, 159, 78, 63, 6, 29, 21, 153, 75, 154, 40, 200, 103, 0, 58, 249,
-    176, 136, 202, 173, 153, 116, 222, 90, 108, 31, 29, 175, 15, 221, 215, 39, 16, 168, 227, 88, 179, 19, 32, 186, 34,
-    175, 95, 190, 197, 65, 191, 227, 79, 166, 154, 189, 209, 229, 69, 208, 188, 83, 253, 97, 165, 10, 58, 246, 208, 251,
-    218, 158, 76, 249, 193, 157, 248, 160, 105, 161, 146, 13, 137, 5, 43, 116, 129, 26, 5, 160, 137, 23, 170, 233, 107,
-    188, 146, 133, 206, 116, 22, 161, 155, 7, 15, 224, 191, 251, 49, 81, 82, 228, 99, 70, 214, 46, 115, 98, 28, 7, 20,
-    27, 251, 202, 82, 93, 178, 234, 17, 204, 3, 247, 207, 225, 151, 170, 51, 57, 228, 247, 217, 215, 89, 236, 160, 5,
-    145, 113, 139, 127, 116, 26, 40, 69, 174, 140, 163, 249, 78, 99, 238, 133, 73, 21, 54, 28, 243, 237, 197, 180, 55,
-    249, 205, 236, 59, 76, 55, 35, 13, 37, 27, 57, 94, 34, 112, 20, 180, 172, 223, 80, 105, 121, 63, 151, 204, 227, 149,
-    149, 121, 57, 27, 77, 123, 74, 120, 80, 176, 167, 224, 58, 70, 228, 104, 233, 70, 61, 52, 164, 185, 18, 189, 122,
-    203, 221, 195, 154, 13, 167, 183, 206, 187, 128, 101, 106, 195, 64, 111, 43, 181, 61, 138, 148, 143, 130, 206, 169,
-    85, 111, 53, 246, 150, 112, 81, 202, 46, 3, 85, 224, 183, 6, 237, 203, 120, 87, 121, 67, 231, 140, 21, 28, 117, 28,
-    15, 73, 220, 5, 221, 246, 176, 195, 108, 241, 183, 39, 42, 131, 101, 145, 178, 20, 45, 41, 120, 191, 81, 26, 158,
-    12, 183, 142, 61, 228, 3, 35, 146, 238, 241, 83, 251, 39, 38, 126, 212, 92, 136, 12, 52, 181, 216, 254, 107, 181,
-    182, 130, 42, 18, 102, 4, 27, 235, 39, 220, 113, 35, 254, 255, 241, 46, 229, 180, 94, 192, 74, 231, 183, 166, 14,
-    157, 176, 189, 120, 65, 105, 233, 5, 142, 34, 41, 14, 135, 65, 50, 187, 240, 11, 31, 96, 242, 118, 84, 243, 9, 221,
-    145, 215, 190, 10, 80, 173, 247, 168, 128, 98, 105, 30, 20, 130, 208, 189, 120, 155, 5, 158, 216, 206, 45, 120, 201,
-    44, 76, 101, 65, 201, 149, 90, 102, 106, 244, 71, 133, 236, 4, 34, 101, 168, 126, 62, 62, 11, 86, 137, 40, 206, 4,
-    210, 76, 144, 147, 138, 6, 169, 183, 83, 243, 156, 177, 197, 105, 134, 249, 186, 109, 216, 6, 119, 209, 1, 127, 32,
-    242, 40, 233, 198, 191, 90, 0, 43, 160, 134, 27, 203, 120, 154, 148, 181, 197, 76, 61, 241, 109, 214, 105, 54, 60,
-    16, 229, 109, 215, 17, 60, 98, 49, 210, 206, 192, 191, 141, 241, 229, 194, 96, 37, 135, 156, 51, 255, 248, 86, 204,
-    129, 37, 37, 166, 250, 155, 83, 43, 130, 159, 163, 60, 34, 68, 60, 100, 231, 117, 124, 86, 162, 205, 78, 161, 153,
-    186, 213, 125, 30, 225, 100, 26, 26, 219, 60, 128, 80, 26, 166, 77, 247, 70, 204, 83, 70, 132, 111, 137, 205, 234,
-    159, 142, 118, 1, 47, 149, 198, 128, 156, 142, 242, 79, 20, 96, 239, 32, 76, 118, 174, 48, 20, 137, 158, 23, 152,
-    163, 62, 98, 31, 178, 250, 204, 97, 56, 95, 57, 228, 29, 235, 70, 114, 254, 134, 238, 254, 169, 86, 220, 214, 82,
-    128, 63, 144, 193, 71, 122, 133, 212, 158, 14, 243, 51, 107, 52, 110, 229, 186, 62, 137, 243, 54, 73, 45, 161, 191,
-    13, 182, 232, 156, 240, 193, 199, 97, 19, 136, 115, 252, 229, 76, 101, 255, 28, 96, 95, 86, 106, 195, 87, 97, 6,
-    148, 120, 239, 247, 42, 4, 196, 46, 205, 190, 140, 41, 183, 26, 229, 120, 195, 49, 52, 169, 113, 21, 238, 250, 153,
-    62, 102, 176, 178, 206, 20, 83, 11, 165, 248, 40, 71, 252, 188, 124, 98, 67, 236, 225, 70, 40, 12, 67, 93, 238, 130,
-    135, 116, 206, 122, 100, 222, 12, 247, 162, 253, 69, 218, 213, 142, 188, 71, 127, 247, 117, 20, 158, 232, 110, 185,
-    133, 233, 248, 42, 193, 192, 111, 200, 81, 197, 159, 127, 157, 46, 221, 71, 97, 127, 102, 76, 131, 92, 175, 232,
-    200, 73, 247, 79, 154, 206, 85, 132, 205, 242, 217, 96, 79, 245, 240, 144, 62, 153, 106, 140, 248, 200, 17, 99, 57,
-    185, 127, 225, 70, 122, 141, 41, 18, 1, 19, 23, 189, 186, 232, 111, 192, 66, 189, 17, 31, 172, 2, 183, 207, 74, 159,
-    104, 77, 105, 16, 162, 136, 252, 106, 59, 200, 39, 48, 155, 109, 34, 51, 107, 79, 31, 151, 104, 190, 10, 144, 109,
-    71, 120, 202, 152, 86, 212, 137, 2, 134, 141, 52, 125, 28, 181, 66, 119, 51, 255, 239, 146, 19, 254, 227, 164, 158,
-    19, 138, 10, 147, 181, 209, 57, 43, 21, 203, 218, 190, 156, 251, 193, 42, 19, 165, 141, 178, 4, 198, 82, 50, 221,
-    167, 7, 150, 11, 2, 46, 55, 134, 146, 162, 3, 218, 155, 108, 131, 20, 240, 122, 152, 60, 129, 129, 244, 228, 96, 68,
-    39, 200, 82, 224, 248, 156, 148, 235, 234, 80, 144, 110, 14, 239, 36, 109, 84, 210, 35, 61, 88, 111, 34, 95, 3, 149,
-    206, 138, 16, 176, 64, 62, 229, 124, 84, 170, 127, 192, 172, 115, 73, 38, 178, 72, 250, 5, 62, 234, 253, 85, 79, 59,
-    34, 21, 174, 189, 93, 30, 14, 22, 56, 113, 4, 14, 164, 99, 248, 118, 96, 60, 171, 25, 18, 210, 107, 99, 68, 87, 4,
-    168, 221, 27, 56, 32, 97, 95, 185, 107, 223, 131, 87, 216, 38, 89, 130, 197, 204, 78, 11, 198, 38, 27, 1, 167, 245,
-    100, 106, 245, 244, 177, 234, 39, 29, 121, 95, 137, 47, 239, 107, 132, 128, 122, 107, 129, 63, 226, 98, 113, 155,
-    200, 137, 124, 142, 52, 157, 200, 157, 245, 143, 228, 134, 21, 162, 142, 184, 116, 50, 105, 130, 82, 151, 132, 173,
-    86, 7, 49, 2, 14, 141, 246, 21, 222, 58, 98, 251, 230, 74, 204, 12, 202, 185, 1, 207, 133, 196, 197, 112, 208, 185,
-    32, 225, 32, 193, 41, 252, 39, 149, 209, 85, 198, 173, 142, 181, 191, 0, 47, 208, 199, 18, 138, 165, 186, 134, 46,
-    212, 131, 248, 131, 252, 213, 61, 148, 164, 34, 32, 195, 78, 36, 0, 114, 218, 129, 216, 38, 62, 14, 63, 36, 34, 159,
-    108, 136, 165, 145, 141, 74, 63, 122, 25, 188, 125, 142, 55, 140, 105, 223, 132, 78, 137, 94, 126, 49, 82, 105, 35,
-    186, 147, 143, 240, 162, 100, 229, 129, 224, 18, 162, 191, 197, 244, 48, 68, 30, 108, 189, 166, 27, 83, 33, 113,
-    203, 148, 145, 53, 100, 102, 183, 6, 173, 5, 91, 198, 247, 109, 90, 28, 178, 227, 180, 97, 116, 246, 195, 148, 240,
-    86, 62, 214, 252, 171, 216, 106, 80, 159, 230, 154, 37, 244, 127, 203, 231, 245, 252, 221, 84, 221, 181, 154, 185,
-    75, 162, 164, 35, 225, 195, 43, 227, 140, 224, 109, 183, 203, 76, 148, 117, 83, 34, 73, 247, 205, 73, 154, 55, 76,
-    4, 87, 11, 142, 182, 174, 227, 231, 86, 31, 32, 64, 227, 88, 70, 251, 254, 148, 39, 17, 90, 78, 133, 47, 248, 103,
-    34, 114, 22, 32, 89, 10, 76, 4, 111, 144, 127, 106, 166, 229, 41, 193, 193, 11, 158, 97, 2, 74, 165, 200, 111, 96,
-    120, 102, 141, 245, 142, 121, 133, 27, 144, 96, 51, 98, 219, 112, 35, 31, 168, 0, 165, 210, 26, 194, 126, 222, 104,
-    94, 133, 203, 218, 169, 124, 133, 53, 1, 98, 190, 189, 205, 213, 80, 155, 70, 73, 221, 78, 251, 61, 204, 41, 181,
-    164, 180, 252, 242, 47, 206, 135, 119, 210, 71, 50, 45, 155, 143, 236, 19, 243, 152, 10, 114, 49, 243, 113, 11, 139,
-    157, 75, 140, 84, 155, 28, 56, 115, 187, 151, 187, 27, 30, 251, 189, 137, 149, 238, 238, 82, 235, 197, 112, 243,
-    125, 130, 0, 1, 204, 245, 122, 121, 57, 242, 93, 251, 215, 228, 194, 160, 44, 23, 229, 218, 107, 152, 197, 93, 50,
-    64, 60, 247, 52, 213, 35, 249, 90, 164, 216, 237, 85, 211, 27, 209, 91, 178, 47, 222, 168, 131, 27, 211, 212, 149,
-    90, 119, 35, 140, 85, 150, 51, 243, 78, 227, 13, 249, 180, 108, 61, 204, 116, 222, 211, 193, 163, 67, 188, 16, 91,
-    175, 86, 211, 95, 26, 117, 23, 122, 84, 240, 185, 218, 182, 207, 195, 1, 235, 156, 234, 163, 150, 76, 0, 65, 3, 111,
-    0, 40, 201, 154, 176, 46, 48, 157, 185, 116, 204, 236, 157, 215, 111, 59, 202, 207, 6, 220, 58, 96, 31, 48, 77, 24,
-    226, 21, 167, 227, 255, 140, 47, 197, 194, 116, 31, 178, 254, 37, 22, 152, 172, 3, 35, 177, 32, 82, 52, 78, 175, 24,
-    28, 40, 41, 112, 14, 186, 172, 124, 60, 237, 191, 87, 149, 232, 240, 78, 151, 130, 95, 29, 192, 252, 131, 99, 110,
-    231, 175, 29, 20, 166, 70, 170, 144, 207, 189, 6, 40, 88, 1, 133, 22, 103, 102, 44, 205, 150, 234, 147, 231, 10, 65,
-    203, 29, 93, 132, 16, 9, 237, 8, 111, 156, 110, 106, 40, 63, 213, 253, 153, 43, 165, 169, 60, 166, 136, 223, 71, 86,
-    58, 161, 38, 232, 196, 17, 10, 147, 31, 222, 63, 244, 211, 191, 241, 220, 76, 118, 209, 225, 29, 127, 38, 143, 255,
-    195, 45, 54, 34, 241, 47, 231, 158, 117, 205, 82, 152, 143, 185, 177, 107, 188, 63, 26, 176, 128, 252, 185, 116, 51,
-    204, 94, 10, 2, 203, 235, 7, 235, 208, 223, 77, 46, 145, 193, 243, 68, 83, 154, 134, 156, 168, 167, 45, 12, 42, 194,
-    6, 6, 190, 229, 230, 16, 0, 227, 42, 241, 26, 6, 204, 217, 104, 143, 234, 80, 17, 250, 88, 90, 227, 66, 164, 81,
-    156, 16, 88, 181, 179, 235, 240, 217, 201, 165, 31, 15, 186, 220, 100, 152, 72, 13, 147, 79, 99, 129, 171, 191, 19,
-    156, 47, 145, 34, 104, 169, 86, 169, 250, 159, 9, 73, 217, 29, 246, 26, 32, 232, 112, 107, 249, 212, 134, 239, 42,
-    224, 142, 172, 243, 118, 11, 189, 15, 40, 159, 53, 196, 13, 188, 130, 83, 125, 50, 132, 56, 50, 23, 229, 128, 4,
-    204, 176, 12, 31, 223, 77, 88, 136, 111, 171, 175, 144, 96, 236, 242, 50, 195, 88, 239, 126, 157, 197, 249, 123,
-    212, 145, 114, 1, 106, 15, 154, 182, 201, 139, 181, 150, 101, 224, 120, 240, 118, 205, 120, 250, 92, 229, 163, 169,
-    138, 195, 36, 230, 5, 63, 68, 4, 139, 69, 141, 79, 186, 16, 3, 3, 44, 198, 96, 35, 212, 45, 197, 38, 35, 137, 214,
-    177, 3, 238, 162, 255, 137, 136, 156, 163, 190, 234, 84, 153, 50, 80, 208, 12, 130, 164, 193, 24, 198, 102, 55, 159,
-    75, 218, 228, 41, 234, 8, 190, 191, 246, 36, 161, 59, 255, 62, 30, 26, 22, 212, 226, 66, 194, 38, 47, 118, 3, 49,
-    72, 26, 207, 129, 2, 75, 252, 193, 28, 9, 231, 122, 17, 200, 55, 48, 247, 185, 243, 92, 169, 174, 220, 109, 175,
-    240, 10, 11, 56, 216, 151, 123, 183, 164, 164, 71, 93, 63, 0, 192, 215, 186, 28, 134, 23, 8, 229, 154, 124, 178,
-    216, 143, 34, 5, 67, 232, 64, 168, 239, 135, 42, 137, 138, 136, 175, 51, 51, 69, 1, 107, 122, 214, 191, 225, 48,
-    166, 195, 253, 146, 35, 152, 66, 181, 231, 85, 15, 69, 214, 162, 57, 144, 70, 233, 245, 245, 148, 237, 60, 41, 157,
-    249, 252, 185, 248, 248, 0, 99, 229, 255, 181, 1, 171, 47, 227, 77, 131, 157, 70, 1, 94, 109, 69, 217, 151, 192,
-    206, 252, 159, 42, 18, 46, 72, 39, 21, 42, 224, 80, 198, 3, 36, 227, 234, 92, 134, 75, 203, 226, 163, 66, 31, 64,
-    156, 65, 235, 242, 238, 87, 113, 146, 58, 92, 231, 198, 207, 148, 146, 175, 87, 198, 212, 172, 48, 178, 105, 82,
-    111, 247, 96, 98, 49, 185, 43, 185, 17, 44, 34, 69, 103, 47, 0, 0, 119, 198, 121, 71, 243, 117, 204, 223, 178, 145,
-    205, 181, 79, 116, 31, 71, 201, 175, 21, 111, 83, 223, 63, 94, 121, 114, 45, 147, 181, 136, 200, 49, 79, 105, 21,
-    90, 221, 40, 39, 44, 93, 212, 233, 204, 210, 32, 189, 173, 221, 164, 98, 93, 86, 214, 185, 81, 199, 172, 2, 184,
-    111, 10, 181, 39, 248, 99, 234, 197, 167, 55, 250, 28, 10, 206, 167, 193, 66, 7, 166, 195, 84, 193, 84, 84, 73, 191,
-    165, 90, 236, 63, 70, 142, 38, 211, 240, 109, 223, 13, 198, 130, 160, 156, 167, 67, 179, 226, 122, 33, 2, 161, 189,
-    46, 21, 134, 4, 218, 224, 93, 129, 245, 109, 185, 60, 178, 54, 231, 141, 244, 66, 119, 77, 81, 3, 251, 152, 102,
-    192, 102, 212, 108, 191, 218, 122, 73, 115, 141, 6, 252, 144, 34, 42, 234, 128, 196, 146, 35, 246, 174, 199, 60,
-    241, 151, 55, 98, 93, 68, 194, 64, 3, 39, 224, 11, 128, 18, 239, 9, 143, 165, 171, 108, 126, 109, 6, 255, 132, 207,
-    0, 107, 65, 88, 131, 179, 135, 248, 198, 52, 91, 4, 171, 192, 237, 210, 124, 197, 92, 207, 25, 205, 225, 75, 55,
-    101, 237, 148, 187, 202, 56, 151, 108, 36, 91, 211, 103, 2, 30, 246, 7, 37, 123, 117, 47, 120, 151, 40, 26, 99, 209,
-    30, 220, 152, 112, 35, 53, 108, 188, 206, 152, 40, 50, 148, 236, 113, 223, 128, 9, 66, 205, 64, 220, 34, 73, 181,
-    191, 86, 105, 216, 53, 157, 40, 230, 240, 104, 7, 67, 8, 214, 235, 4, 131, 67, 124, 84, 50, 243, 85, 114, 218, 181,
-    132, 125, 129, 139, 12, 14, 169, 37, 197, 220, 25, 73, 59, 217, 125, 20, 135, 155, 113, 207, 129, 247, 178, 162,
-    116, 6, 79, 216, 46, 133, 139, 148, 100, 27, 44, 12, 255, 36, 6, 94, 37, 14, 44, 162, 215, 175, 210, 219, 73, 255,
-    156, 90, 226, 65, 246, 24, 242, 196, 243, 134, 134, 165, 202, 141, 214, 165, 14, 215, 81, 99, 213, 78, 57, 205, 85,
-    35, 244, 235, 24, 131, 104, 73, 213, 89, 101, 4, 24, 76, 164, 65, 156, 194, 151, 180, 11, 218, 31, 225, 79, 31, 242,
-    76, 225, 110, 101, 18, 69, 247, 230, 107, 48, 73, 157, 25, 183, 142, 44, 243, 1, 145, 23, 8, 38, 194, 194, 208, 160,
-    161, 124, 226, 91, 221, 225, 187, 90, 181, 114, 8, 169, 239, 195, 191, 227, 47, 30, 236, 87, 140, 187, 88, 247, 247,
-    22, 5, 36, 191, 171, 218, 160, 189, 85, 228, 131, 181, 181, 52, 99, 3, 33, 217, 72, 144, 74, 148, 241, 255, 19, 76,
-    41, 215, 133, 104, 28, 214, 216, 158, 16, 45, 227, 114, 126, 128, 56, 197, 248, 86, 172, 191, 112, 21, 188, 24, 123,
-    109, 217, 245, 240, 8, 236, 151, 126, 93, 119, 48, 170, 65, 203, 66, 203, 113, 28, 55, 50, 21, 65, 88, 29, 0, 226,
-    172, 238, 34, 72, 39, 222, 187, 85, 121, 56, 251, 169, 183, 107, 155, 169, 35, 8, 222, 72, 108, 120, 186, 19, 36,
-    137, 14, 201, 213, 199, 19, 210, 239, 214, 122, 150, 95, 130, 254, 250, 141, 111, 133, 178, 185, 190, 107, 155, 178,
-    167, 243, 199, 146, 253, 179, 246, 199, 248, 127, 158, 248, 175, 145, 170, 28, 225, 9, 113, 161, 227, 135, 195, 146,
-    69, 252, 42, 208, 32, 2, 89, 24, 19, 234, 185, 184, 144, 163, 114, 67, 115, 80, 1, 67, 135, 249, 160, 118, 41, 72,
-    222, 121, 35, 159, 106, 153, 24, 138, 214, 137, 251, 213, 26, 250, 172, 102, 213, 55, 34, 83, 72, 138, 232, 169, 37,
-    201, 66, 85, 49, 65, 151, 20, 179, 231, 37, 159, 133, 52, 133, 208, 29, 190, 113, 113, 77, 12, 99, 83, 239, 117, 6,
-    96, 112, 52, 5, 187, 188, 234, 176, 41, 170, 64, 109, 17, 180, 33, 50, 83, 221, 204, 73, 31, 60, 219, 176, 165, 185,
-    145, 79, 122, 129, 44, 151, 15, 71, 242, 233, 150, 149, 122, 132, 101, 99, 113, 94, 110, 56, 113, 66, 223, 55, 12,
-    47, 44, 3, 163, 62, 93, 91, 80, 164, 246, 179, 94, 25, 53, 118, 120, 115, 118, 51, 195, 157, 163, 38, 161, 48, 232,
-    0, 222, 214, 12, 84, 41, 254, 20, 222, 142, 73, 148, 45, 208, 92, 60, 116, 234, 169, 9, 222, 131, 115, 4, 44, 98,
-    187, 193, 249, 189, 165, 13, 58, 227, 150, 157, 77, 44, 183, 85, 56, 65, 192, 173, 189, 40, 103, 66, 67, 28, 232,
-    164, 59, 28, 161, 58, 145, 19, 236, 232, 185, 129, 50, 219, 1, 119, 237, 48, 88, 207, 53, 94, 193, 98, 110, 49, 122,
-    166, 63, 181, 196, 176, 232, 241, 78, 98, 144, 105, 49, 66, 78, 99, 60, 238, 24, 208, 99, 144, 250, 124, 252, 127,
-    57, 70, 163, 68, 203, 151, 145, 26, 246, 127, 13, 91, 47, 59, 30, 41, 160, 50, 235, 76, 23, 217, 147, 125, 160, 111,
-    155, 16, 111, 61, 5, 37, 36, 13, 15, 72, 185, 37, 193, 131, 63, 233, 50, 236, 245, 140, 85, 253, 90, 126, 66, 77,
-    214, 74, 155, 102, 92, 49, 42, 224, 176, 63, 153, 51, 27, 169, 92, 104, 205, 52, 43, 23, 49, 75, 198, 123, 247, 242,
-    201, 239, 200, 209, 118, 186, 206, 152, 240, 85, 242, 11, 174, 3, 173, 149, 72, 112, 168, 172, 157, 168, 185, 13, 2,
-    187, 20, 2, 252, 124, 28, 194, 195, 152, 226, 84, 195, 121, 6, 130, 142, 129, 117, 154, 129, 58, 94, 130, 82, 143,
-    168, 11, 180, 182, 24, 65, 203, 100, 170, 46, 237, 61, 151, 80, 255, 134, 40, 134, 23, 137, 198, 43, 124, 236, 76,
-    176, 224, 57, 51, 57, 69, 106, 218, 115, 122, 15, 206, 144, 112, 53, 149, 139, 10, 251, 205, 112, 126, 167, 37, 136,
-    105, 19, 104, 234, 20, 76, 114, 12, 124, 183, 205, 4, 242, 254, 119, 145, 87, 82, 148, 229, 52, 52, 171, 188, 45,
-    80, 38, 211, 166, 137, 101, 211, 46, 181, 29, 181, 0, 208, 193, 118, 203, 7, 233, 221, 80, 19, 52, 0, 22, 68, 28,
-    239, 104, 210, 240, 114, 70, 124, 152, 170, 137, 56, 90, 29, 221, 126, 115, 0, 179, 65, 43, 61, 180, 165, 160, 226,
-    54, 95, 71, 12, 97, 2, 46, 48, 87, 195, 17, 50, 9, 56, 231, 37, 223, 123, 72, 221, 213, 211, 239, 92, 218, 167, 177,
-    34, 238, 177, 165, 168, 141, 203, 161, 83, 93, 126, 19, 133, 148, 111, 245, 146, 30, 99, 160, 240, 100, 127, 161,
-    70, 244, 66, 94, 194, 188, 69, 120, 157, 255, 90, 115, 170, 181, 47, 5, 219, 231, 153, 227, 160, 50, 98, 66, 119,
-    57, 172, 3, 248, 217, 199, 179, 12, 121, 191, 9, 239, 188, 18, 19, 58, 43, 153, 159, 88, 120, 128, 142, 254, 70,
-    196, 15, 145, 172, 14, 193, 124, 130, 165, 75, 181, 145, 59, 146, 24, 1, 142, 31, 67, 45, 232, 70, 81, 27, 143, 249,
-    0, 78, 141, 149, 34, 5, 46, 199, 20, 119, 210, 239, 191, 10, 249, 63, 79, 88, 144, 149, 229, 196, 16, 0, 156, 71,
-    85, 145, 137, 119, 209, 8, 252, 8, 25, 250, 154, 102, 192, 105, 30, 254, 98, 211, 78, 17, 181, 57, 232, 231, 22,
-    249, 154, 19, 101, 115, 45, 132, 153, 113, 220, 55, 51, 182, 208, 155, 42, 56, 210, 28, 238, 237, 74, 192, 62, 177,
-    99, 199, 72, 191, 243, 129, 38, 141, 234, 15, 63, 230, 110, 196, 251, 50, 35, 110, 166, 98, 32, 173, 47, 17, 216, 4,
-    24, 52, 125, 183, 111, 85, 208, 50, 10, 140, 218, 195, 13, 47, 133, 8, 83, 65, 209, 204, 167, 240, 201, 4, 53, 107,
-    52, 10, 125, 152, 74, 192, 73, 206, 210, 119, 99, 86, 192, 230, 46, 17, 123, 210, 214, 38, 201, 195, 145, 152, 78,
-    74, 112, 76, 216, 182, 143, 114, 209, 241, 73, 133, 40, 11, 248, 15, 112, 174, 43, 116, 161, 145, 254, 41, 135, 226,
-    230, 88, 15, 145, 113, 138, 16, 74, 182, 171, 29, 18, 37, 249, 188, 43, 77, 80, 225, 225, 33, 141, 208, 90, 127, 3,
-    132, 3, 177, 90, 63, 77, 96, 8, 30, 158, 58, 251, 48, 62, 112, 60, 161, 236, 110, 10, 201, 51, 155, 13, 69, 147, 91,
-    137, 238, 61, 253, 8, 196, 93, 153, 10, 198, 221, 188, 132, 26, 126, 126, 108, 159, 224, 133, 42, 1, 143, 75, 61,
-    67, 93, 242, 247, 125, 109, 40, 100, 45, 47, 160, 102, 249, 233, 171, 243, 145, 230, 151, 58, 138, 156, 5, 112, 62,
-    232, 234, 89, 4, 45, 209, 78, 112, 160, 26, 20, 108, 1, 66, 102, 107, 92, 73, 54, 75, 209, 200, 77, 80, 38, 167,
-    244, 51, 119, 130, 245, 238, 226, 64, 28, 31, 175, 217, 74, 218, 85, 86, 234, 83, 246, 145, 83, 30, 85, 74, 7, 4,
-    25, 185, 97, 14, 113, 19, 237, 173, 247, 168, 157, 98, 240, 156, 159, 115, 153, 106, 225, 157, 22, 147, 240, 132,
-    154, 185, 217, 199, 66, 205, 187, 237, 201, 91, 193, 107, 38, 176, 238, 213, 235, 134, 76, 239, 91, 214, 124, 17,
-    255, 83, 168, 8, 189, 75, 70, 165, 36, 219, 46, 93, 239, 154, 48, 93, 246, 42, 20, 182, 180, 240, 146, 159, 215, 68,
-    123, 23, 107, 156, 53, 175, 114, 116, 117, 136, 86, 53, 2, 20, 130, 247, 130, 80, 55, 75, 188, 232, 103, 9, 92, 237,
-    176, 217, 197, 230, 101, 238, 9, 83, 161, 136, 40, 218, 210, 229, 226, 82, 196, 151, 136, 158, 152, 109, 142, 93,
-    161, 94, 39, 75, 65, 225, 0, 18, 65, 67, 187, 39, 56, 235, 76, 124, 4, 25, 240, 116, 180, 11, 53, 227, 239, 193, 56,
-    138, 244, 199, 229, 139, 49, 210, 213, 243, 155, 48, 198, 114, 125, 124, 104, 136, 189, 227, 156, 240, 152, 126,
-    118, 131, 78, 94, 164, 89, 98, 107, 173, 161, 30, 141, 115, 8, 152, 179, 90, 243, 75, 30, 168, 38, 249, 217, 167,
-    74, 69, 200, 135, 144, 240, 74, 168, 34, 190, 236, 193, 6, 183, 235, 102, 79, 122, 146, 108, 79, 158, 1, 102, 91,
-    106, 101, 91, 46, 96, 255, 214, 81, 152, 91, 127, 79, 181, 232, 84, 15, 105, 170, 146, 243, 184, 8, 181, 253, 179,
-    189, 193, 41, 16, 241, 180, 203, 94, 123, 93, 14, 15, 13, 234, 92, 194, 82, 115, 150, 18, 235, 182, 47, 32, 82, 60,
-    141, 83, 255, 153, 232, 210, 238, 214, 145, 23, 179, 84, 36, 194, 214, 86, 41, 108, 196, 230, 129, 150, 254, 197,
-    31, 184, 61, 249, 249, 191, 84, 7, 222, 165, 76, 227, 17, 137, 60, 208, 81, 128, 126, 36, 221, 105, 246, 46, 210,
-    190, 70, 43, 154, 84, 64, 9, 177, 21, 234, 174, 32, 101, 65, 181, 212, 194, 39, 78, 133, 194, 38, 78, 94, 189, 89,
-    75, 27, 62, 8, 192, 148, 74, 196, 138, 26, 184, 101, 10, 169, 245, 60, 14, 129, 82, 22, 135, 57, 59, 153, 216, 18,
-    182, 26, 211, 49, 95, 75, 97, 170, 124, 237, 69, 107, 125, 122, 90, 78, 210, 14, 64, 206, 193, 186, 153, 248, 184,
-    114, 230, 62, 26, 87, 117, 96, 134, 168, 108, 73, 218, 147, 90, 194, 76, 125, 15, 76, 206, 64, 221, 32, 145, 156, 9,
-    130, 86, 184, 199, 26, 7, 123, 21, 196, 16, 160, 47, 107, 247, 168, 112, 213, 185, 131, 91, 103, 93, 107, 228, 208,
-    96, 227, 34, 184, 244, 210, 157, 212, 171, 147, 209, 193, 168, 201, 114, 1, 76, 78, 98, 196, 234, 188, 81, 72, 99,
-    132, 17, 218, 211, 179, 179, 0, 241, 132, 224, 251, 134, 234, 55, 168, 43, 165, 103, 11, 160, 242, 240, 84, 221, 54,
-    40, 217, 195, 9, 165, 58, 6, 85, 137, 145, 235, 89, 74, 182, 94, 194, 78, 228, 235, 177, 243, 56, 188, 91, 223, 251,
-    202, 26, 65, 213, 5, 217, 157, 249, 127, 225, 128, 157, 175, 234, 147, 247, 13, 23, 59, 231, 158, 251, 87, 199, 188,
-    117, 253, 9, 163, 87, 180, 207, 50, 71, 248, 1, 246, 115, 132, 165, 177, 57, 18, 251, 175, 118, 11, 199, 22, 43,
-    233, 121, 223, 39, 233, 102, 118, 238, 44, 157, 136, 25, 146, 253, 52, 234, 166, 198, 168, 123, 155, 151, 108, 71,
-    49, 108, 131, 91, 31, 204, 246, 11, 187, 56, 180, 28, 161, 92, 0, 42, 184, 232, 179, 73, 197, 136, 213, 135, 88, 68,
-    124, 215, 132, 41, 136, 77, 104, 38, 108, 228, 4, 113, 202, 196, 114, 196, 160, 194, 7, 169, 162, 238, 51, 55, 251,
-    121, 132, 236, 62, 76, 238, 168, 209, 76, 61, 142, 86, 171, 4, 160, 230, 137, 238, 171, 42, 57, 213, 149, 78, 68,
-    98, 213, 149, 191, 162, 198, 108, 246, 85, 231, 60, 4, 132, 95, 39, 222, 211, 225, 226, 120, 167, 57, 78, 212, 8,
-    222, 99, 252, 112, 84, 184, 26, 25, 224, 33, 124, 216, 38, 143, 58, 70, 237, 234, 120, 88, 41, 94, 209, 69, 231,
-    183, 155, 166, 227, 68, 150, 130, 254, 110, 252, 238, 252, 181, 62, 216, 169, 131, 99, 12, 93, 14, 60, 199, 62, 210,
-    169, 189, 201, 88, 7, 98, 59, 39, 232, 102, 184, 172, 5, 245, 192, 83, 232, 225, 117, 79, 171, 109, 243, 190, 75,
-    138, 62, 125, 117, 54, 196, 53, 165, 96, 42, 210, 39, 211, 104, 110, 221, 103, 129, 244, 14, 5, 201, 185, 228, 137,
-    65, 71, 65, 5, 6, 162, 75, 89, 145, 150, 12, 158, 8, 207, 138, 106, 104, 86, 31, 253, 6, 152, 131, 84, 189, 70, 63,
-    156, 44, 224, 249, 212, 143, 177, 72, 3, 205, 83, 153, 205, 129, 144, 245, 192, 85, 120, 137, 174, 114, 65, 249, 50,
-    217, 76, 108, 23, 130, 63, 68, 225, 255, 86, 194, 166, 205, 202, 201, 186, 240, 190, 142, 199, 209, 143, 2, 181,
-    141, 145, 188, 158, 148, 89, 53, 49, 150, 34, 82, 89, 211, 7, 99, 226, 83, 10, 165, 117, 220, 79, 224, 171, 71, 86,
-    163, 176, 108, 111, 221, 66, 122, 108, 250, 46, 23, 202, 56, 140, 122, 171, 244, 116, 248, 125, 201, 202, 79, 122,
-    208, 237, 212, 103, 103, 230, 17, 233, 116, 190, 246, 6, 215, 42, 65, 107, 47, 29, 254, 39, 126, 89, 156, 188, 131,
-    28, 236, 56, 52, 111, 35, 5, 125, 191, 29, 106, 63, 21, 115, 246, 118, 96, 131, 153, 166, 155, 118, 188, 41, 129,
-    160, 86, 18, 210, 136, 163, 189, 93, 60, 25, 97, 164, 34, 83, 57, 214, 227, 121, 162, 5, 193, 166, 15, 137, 81, 100,
-    66, 25, 156, 174, 52, 135, 81, 117, 196, 242, 37, 196, 58, 101, 88, 239, 131, 142, 2, 203, 170, 92, 157, 28, 228,
-    10, 253, 215, 14, 220, 53, 25, 103, 191, 78, 16, 149, 137, 47, 36, 19, 150, 170, 119, 191, 211, 216, 58, 240, 202,
-    2, 132, 21, 18, 81, 57, 85, 248, 235, 51, 134, 192, 207, 227, 77, 19, 79, 137, 30, 251, 153, 87, 67, 61, 83, 123,
-    26, 216, 77, 232, 233, 9, 89, 94, 98, 47, 51, 141, 136, 45, 18, 2, 176, 19, 12, 95, 159, 165, 105, 143, 154, 200,
-    246, 35, 213, 247, 146, 180, 177, 43, 97, 125, 7, 133, 104, 230, 176, 118, 35, 10, 3, 99, 236, 84, 216, 103, 93,
-    103, 139, 64, 66, 101, 123, 42, 219, 174, 32, 253, 39, 29, 3, 20, 151, 173, 166, 203, 8, 40, 220, 12, 61, 220, 137,
-    2, 80, 12, 196, 39, 72, 38, 30, 160, 3, 76, 134, 255, 158, 175, 223, 198, 188, 104, 45, 16, 0, 233, 145, 26, 232,
-    157, 89, 212, 251, 102, 102, 155, 227, 202, 7, 129, 236, 95, 85, 247, 198, 227, 8, 208, 63, 186, 150, 4, 42, 156,
-    16, 238, 128, 1, 17, 139, 1, 255, 118, 83, 223, 132, 103, 220, 90, 173, 65, 96, 97, 138, 244, 138, 101, 177, 161,
-    145, 122, 160, 93, 62, 152, 247, 44, 214, 26, 22, 56, 219, 217, 157, 164, 83, 158, 21, 13, 253, 190, 143, 5, 64,
-    180, 154, 185, 228, 211, 19, 70, 44, 103, 161, 151, 141, 213, 187, 191, 229, 8, 209, 10, 194, 2, 231, 106, 233, 99,
-    208, 151, 170, 226, 249, 17, 70, 127, 206, 136, 55, 104, 123, 85, 250, 225, 182, 223, 163, 110, 31, 99, 92, 130, 35,
-    235, 39, 84, 163, 251, 136, 243, 163, 122, 233, 251, 171, 109, 219, 41, 137, 96, 49, 216, 117, 152, 43, 20, 195,
-    190, 17, 119, 149, 229, 236, 138, 8, 13, 251, 97, 154, 250, 132, 246, 60, 244, 181, 89, 120, 109, 125, 172, 46, 137,
-    139, 3, 153, 251, 52, 96, 24, 150, 245, 39, 69, 231, 176, 37, 108, 78, 226, 178, 196, 38, 170, 182, 57, 235, 117,
-    220, 103, 159, 70, 209, 49, 25, 85, 15, 30, 149, 163, 119, 165, 56, 89, 30, 31, 79, 248, 47, 169, 246, 22, 231, 192,
-    210, 43, 193, 111, 38, 49, 199, 176, 28, 251, 253, 220, 73, 95, 27, 57, 126, 242, 151, 219, 130, 181, 142, 220, 96,
-    91, 215, 251, 30, 125, 7, 1, 51, 120, 204, 94, 25, 68, 212, 25, 238, 217, 21, 236, 131, 159, 224, 1, 46, 168, 77,
-    254, 200, 97, 203, 197, 70, 198, 204, 126, 68, 5, 82, 117, 194, 37, 96, 127, 200, 178, 183, 56, 104, 160, 69, 138,
-    57, 54, 38, 226, 158, 163, 116, 183, 91, 14, 218, 18, 109, 4, 249, 243, 249, 170, 72, 73, 146, 51, 198, 25, 77, 133,
-    216, 112, 161, 99, 83, 230, 86, 94, 138, 68, 189, 29, 153, 77, 67, 4, 254, 220, 25, 124, 197, 135, 80, 248, 58, 249,
-    228, 207, 13, 60, 146, 96, 208, 238, 182, 146, 236, 56, 91, 57, 119, 204, 65, 122, 238, 105, 245, 118, 65, 0, 232,
-    59, 122, 47, 108, 243, 239, 205, 62, 103, 245, 9, 190, 148, 61, 197, 244, 186, 99, 116, 75, 135, 223, 110, 142, 230,
-    134, 128, 69, 128, 121, 189, 231, 130, 175, 146, 199, 245, 79, 29, 24, 175, 48, 252, 166, 61, 66, 107, 15, 217, 47,
-    89, 211, 250, 30, 207, 9, 177, 238, 232, 26, 131, 220, 153, 87, 68, 230, 105, 30, 109, 94, 44, 180, 92, 238, 150,
-    53, 12, 203, 97, 124, 172, 9, 87, 44, 186, 252, 198, 219, 222, 44, 184, 65, 105, 172, 198, 182, 239, 111, 197, 239,
-    49, 146, 131, 246, 42, 180, 106, 61, 241, 231, 171, 87, 154, 97, 214, 225, 135, 169, 34, 18, 198, 184, 204, 219, 17,
-    55, 137, 78, 91, 218, 71, 69, 249, 221, 82, 205, 238, 164, 46, 249, 178, 64, 0, 63, 175, 25, 42, 150, 228, 141, 100,
-    4, 12, 50, 74, 159, 88, 127, 254, 104, 74, 173, 232, 146, 20, 138, 187, 23, 154, 91, 5, 244, 201, 202, 95, 9, 140,
-    22, 245, 99, 58, 39, 171, 252, 225, 4, 223, 150, 46, 193, 36, 148, 101, 168, 113, 224, 11, 32, 100, 54, 219, 173,
-    135, 57, 6, 58, 64, 209, 111, 243, 151, 242, 205, 216, 91, 111, 246, 62, 64, 61, 208, 83, 198, 107, 37, 92, 145,
-    182, 230, 54, 59, 216, 201, 244, 48, 180, 12, 167, 47, 35, 115, 1, 119, 116, 2, 201, 76, 172, 42, 202, 42, 4, 253,
-    29, 139, 78, 91, 176, 124, 119, 212, 151, 120, 102, 47, 225, 210, 70, 232, 183, 63, 4, 165, 66, 117, 7, 34, 65, 147,
-    224, 186, 131, 171, 0, 130, 206, 208, 254, 221, 233, 160, 31, 193, 150, 234, 193, 40, 58, 174, 51, 221, 150, 249,
-    226, 215, 175, 247, 26, 44, 54, 27, 117, 90, 112, 49, 192, 114, 30, 142, 2, 0, 209, 32, 37, 122, 183, 107, 23, 229,
-    139, 46, 128, 87, 64, 41, 166, 169, 31, 182, 181, 214, 167, 168, 65, 113, 120, 6, 11, 51, 75, 126, 151, 210, 135,
-    211, 137, 149, 66, 34, 120, 19, 204, 206, 119, 181, 149, 225, 37, 21, 115, 130, 252, 74, 88, 136, 125, 238, 137, 17,
-    111, 37, 12, 144, 61, 88, 58, 127, 142, 5, 98, 55, 17, 54, 45, 30, 54, 163, 187, 156, 95, 144, 167, 90, 57, 199,
-    200, 37, 118, 137, 138, 70, 247, 236, 138, 11, 214, 81, 246, 220, 1, 174, 72, 114, 31, 44, 42, 95, 18, 165, 45, 222,
-    42, 243, 209, 39, 199, 18, 183, 100, 39, 71, 169, 145, 93, 21, 240, 67, 122, 103, 60, 52, 224, 50, 230, 133, 15,
-    146, 146, 170, 247, 235, 208, 73, 34, 11, 171, 197, 90, 141, 124, 170, 147, 92, 42, 197, 44, 111, 136, 250, 246,
-    143, 95, 238, 79, 131, 171, 176, 53, 75, 165, 40, 150, 2, 89, 129, 235, 254, 118, 135, 141, 40, 163, 19, 113, 159,
-    17, 236, 63, 214, 142, 32, 233, 117, 202, 151, 168, 170, 83, 210, 8, 50, 187, 77, 22, 82, 88, 230, 235, 170, 123,
-    163, 186, 231, 31, 54, 109, 109, 241, 80, 172, 206, 108, 100, 196, 158, 253, 80, 65, 41, 83, 225, 50, 198, 93, 66,
-    166, 182, 67, 236, 64, 70, 209, 132, 91, 137, 169, 62, 160, 12, 73, 167, 233, 181, 59, 139, 197, 45, 218, 143, 216,
-    4, 28, 25, 161, 102, 151, 116, 79, 243, 236, 121, 102, 86, 75, 229, 25, 41, 148, 232, 121, 254, 169, 230, 109, 55,
-    42, 146, 28, 140, 223, 188, 148, 52, 157, 38, 233, 217, 200, 86, 145, 169, 29, 196, 77, 21, 136, 255, 55, 97, 78,
-    198, 154, 208, 86, 199, 124, 152, 181, 187, 86, 250, 163, 219, 57, 208, 253, 77, 109, 245, 76, 74, 48, 131, 145,
-    154, 113, 190, 76, 163, 21, 252, 191, 52, 21, 161, 42, 28, 80, 102, 54, 68, 70, 162, 85, 226, 19, 53, 98, 41, 219,
-    62, 71, 49, 187, 137, 222, 255, 255, 31, 40, 29, 246, 207, 152, 35, 147, 235, 7, 57, 67, 199, 124, 105, 143, 12,
-    117, 90, 21, 3, 52, 26, 117, 33, 80, 89, 72, 193, 92, 168, 68, 102, 16, 40, 112, 181, 97, 74, 91, 230, 203, 9, 192,
-    247, 13, 13, 216, 82, 76, 223, 136, 197, 88, 131, 38, 151, 4, 119, 50, 111, 104, 208, 159, 24, 129, 233, 42, 141,
-    104, 246, 179, 240, 4, 254, 6, 3, 237, 162, 220, 157, 158, 203, 90, 151, 165, 22, 49, 72, 76, 87, 172, 71, 150, 91,
-    158, 223, 136, 156, 95, 194, 62, 119, 94, 40, 132, 159, 12, 114, 167, 161, 206, 156, 83, 125, 4, 197, 56, 200, 241,
-    240, 212, 62, 180, 63, 62, 236, 96, 47, 108, 204, 193, 63, 148, 211, 106, 116, 116, 56, 227, 108, 26, 87, 27, 25,
-    187, 173, 55, 198, 137, 159, 122, 204, 79, 189, 211, 152, 246, 249, 8, 3, 37, 71, 24, 71, 254, 67, 186, 145, 89,
-    162, 175, 178, 76, 106, 222, 17, 33, 72, 115, 203, 172, 159, 172, 84, 154, 198, 108, 215, 177, 50, 4, 82, 22, 152,
-    70, 41, 88, 119, 122, 215, 211, 104, 163, 153, 158, 183, 219, 132, 125, 163, 2, 157, 193, 226, 209, 59, 144, 185,
-    79, 41, 85, 75, 187, 222, 93, 134, 4, 65, 47, 186, 19, 156, 68, 20, 10, 246, 66, 204, 115, 196, 243, 142, 164, 126,
-    192, 61, 115, 108, 188, 12, 88, 103, 110, 165, 158, 50, 22, 141, 89, 83, 5, 222, 80, 114, 146, 73, 170, 234, 59,
-    250, 158, 89, 177, 188, 48, 164, 154, 39, 58, 21, 131, 43, 54, 161, 48, 42, 59, 191, 125, 184, 101, 22, 155, 154,
-    224, 156, 79, 56, 108, 1, 36, 49, 0, 117, 97, 106, 255, 1, 1, 88, 178, 194, 18, 101, 149, 81, 83, 29, 113, 169, 43,
-    236, 140, 103, 6, 115, 52, 200, 34, 221, 26, 177, 166, 69, 88, 129, 85, 28, 76, 73, 19, 31, 223, 218, 151, 228, 192,
-    15, 61, 6, 163, 166, 80, 12, 153, 81, 160, 51, 66, 188, 194, 240, 244, 232, 4, 131, 203, 50, 170, 123, 246, 150,
-    102, 53, 122, 192, 138, 141, 142, 101, 5, 249, 31, 82, 168, 41, 221, 74, 205, 106, 11, 37, 255, 185, 13, 61, 217,
-    233, 120, 233, 12, 250, 167, 155, 96, 97, 158, 76, 57, 88, 94, 200, 237, 120, 2, 82, 150, 19, 169, 145, 252, 161, 2,
-    178, 11, 140, 161, 33, 48, 85, 5, 58, 186, 203, 53, 85, 187, 120, 252, 122, 214, 253, 62, 74, 227, 153, 147, 169,
-    219, 181, 244, 137, 85, 251, 24, 3, 113, 56, 14, 209, 21, 20, 238, 24, 97, 51, 213, 31, 216, 120, 41, 59, 88, 205,
-    155, 126, 28, 184, 175, 154, 9, 253, 238, 1, 0, 233, 195, 67, 192, 169, 134, 43, 180, 226, 141, 220, 132, 184, 244,
-    230, 191, 197, 249, 17, 33, 215, 119, 157, 65, 26, 194, 51, 166, 12, 82, 53, 164, 226, 35, 223, 203, 213, 219, 127,
-    98, 127, 217, 58, 74, 224, 141, 73, 185, 13, 111, 196, 208, 112, 72, 142, 43, 97, 254, 72, 94, 49, 116, 183, 197,
-    24, 186, 1, 90, 55, 74, 52, 211, 37, 227, 216, 182, 250, 205, 222, 68, 90, 80, 152, 185, 146, 116, 11, 238, 235, 9,
-    205, 211, 226, 235, 196, 132, 242, 222, 169, 215, 92, 234, 49, 125, 31, 153, 124, 100, 36, 77, 3, 116, 162, 157,
-    112, 130, 170, 110, 39, 236, 133, 42, 89, 188, 96, 231, 162, 241, 51, 208, 126, 85, 174, 230, 206, 238, 164, 15, 96,
-    125, 41, 9, 113, 121, 19, 145, 39, 244, 148, 183, 103, 70, 119, 234, 179, 240, 200, 157, 247, 113, 200, 159, 124,
-    179, 217, 109, 99, 52, 172, 212, 136, 41, 59, 211, 178, 182, 133, 204, 188, 156, 9, 2, 40, 102, 191, 16, 21, 132,
-    153, 90, 155, 37, 73, 91, 226, 78, 54, 148, 197, 167, 94, 11, 173, 146, 233, 189, 180, 222, 206, 88, 251, 145, 59,
-    244, 114, 189, 210, 35, 71, 82, 252, 176, 135, 6, 187, 19, 222, 246, 16, 68, 205, 171, 191, 128, 76, 74, 24, 52, 88,
-    18, 255, 229, 71, 40, 193, 22, 84, 37, 163, 224, 142, 146, 94, 110, 215, 252, 174, 130, 52, 254, 32, 170, 173, 247,
-    64, 252, 249, 225, 25, 25, 121, 146, 174, 148, 183, 82, 187, 246, 149, 45, 135, 235, 222, 118, 237, 35, 188, 24,
-    222, 184, 92, 218, 2, 24, 234, 73, 80, 27, 79, 176, 158, 128, 22, 161, 54, 196, 125, 123, 175, 119, 223, 239, 222,
-    129, 253, 59, 239, 233, 38, 88, 66, 177, 56, 88, 8, 85, 226, 218, 165, 42, 254, 23, 26, 198, 49, 161, 72, 50, 22,
-    190, 141, 12, 236, 228, 178, 142, 78, 157, 242, 125, 32, 47, 160, 71, 177, 171, 207, 181, 253, 140, 148, 32, 171,
-    149, 94, 20, 40, 242, 147, 157, 186, 192, 77, 68, 30, 180, 45, 64, 154, 17, 39, 138, 73, 209, 52, 147, 88, 76, 33,
-    96, 205, 12, 183, 60, 142, 68, 173, 53, 136, 91, 58, 154, 81, 168, 52, 175, 90, 23, 97, 53, 18, 115, 50, 2, 157, 65,
-    179, 94, 186, 7, 0, 30, 243, 183, 195, 83, 43, 180, 200, 137, 217, 203, 15, 192, 158, 158, 61, 78, 12, 35, 65, 41,
-    207, 127, 143, 61, 238, 63, 223, 235, 142, 206, 229, 218, 138, 240, 133, 150, 76, 105, 84, 176, 36, 8, 216, 254, 54,
-    250, 139, 239, 157, 54, 109, 164, 252, 243, 152, 158, 223, 115, 22, 158, 166, 113, 145, 154, 220, 17, 232, 172, 1,
-    139, 231, 173, 167, 39, 53, 6, 117, 35, 202, 255, 72, 70, 77, 121, 90, 114, 49, 12, 167, 141, 191, 228, 208, 189,
-    23, 166, 58, 30, 159, 71, 124, 207, 78, 10, 27, 182, 145, 167, 37, 247, 170, 109, 63, 168, 154, 188, 47, 62, 246,
-    78, 105, 129, 45, 110, 80, 231, 238, 131, 21, 187, 90, 188, 203, 192, 221, 246, 91, 188, 201, 47, 47, 80, 100, 103,
-    148, 8, 111, 226, 168, 45, 88, 10, 189, 241, 160, 159, 241, 95, 95, 53, 139, 113, 7, 188, 93, 190, 152, 218, 69, 87,
-    38, 241, 154, 47, 150, 127, 126, 230, 118, 172, 140, 170, 201, 149, 199, 10, 146, 163, 195, 110, 65, 105, 240, 122,
-    48, 201, 129, 93, 119, 31, 195, 208, 252, 145, 159, 142, 68, 214, 4, 71, 252, 152, 195, 179, 203, 128, 212, 176,
-    220, 105, 121, 125, 239, 158, 119, 102, 149, 161, 18, 197, 231, 193, 153, 245, 139, 37, 219, 243, 232, 56, 91, 39,
-    24, 123, 234, 65, 165, 125, 108, 7, 194, 206, 85, 72, 34, 254, 174, 167, 23, 200, 246, 157, 28, 147, 146, 86, 155,
-    103, 208, 48, 245, 245, 125, 62, 129, 60, 33, 13, 4, 212, 214, 151, 255, 230, 62, 144, 90, 56, 205, 196, 140, 155,
-    139, 170, 18, 19, 226, 183, 136, 45, 32, 65, 152, 184, 172, 35, 164, 93, 195, 130, 163, 22, 171, 72, 22, 176, 26,
-    79, 198, 0, 67, 122, 148, 60, 218, 240, 129, 139, 129, 69, 22, 95, 102, 226, 156, 116, 171, 124, 22, 117, 216, 3,
-    103, 35, 179, 174, 223, 175, 74, 168, 163, 168, 92, 194, 30, 2, 243, 243, 94, 41, 176, 79, 26, 229, 42, 183, 92, 65,
-    2, 220, 228, 16, 188, 167, 162, 140, 75, 241, 244, 215, 225, 179, 29, 71, 190, 51, 61, 193, 33, 124, 56, 9, 44, 16,
-    212, 62, 89, 178, 126, 48, 80, 32, 58, 172, 99, 68, 7, 41, 123, 215, 179, 13, 57, 238, 113, 211, 128, 103, 82, 232,
-    106, 78, 113, 15, 63, 255, 195, 159, 63, 118, 77, 255, 12, 97, 193, 172, 196, 21, 23, 195, 38, 2, 89, 212, 136, 206,
-    132, 224, 214, 218, 46, 96, 245, 236, 132, 2, 192, 232, 207, 153, 246, 120, 189, 4, 36, 155, 236, 249, 98, 166, 52,
-    113, 225, 18, 183, 33, 4, 239, 94, 249, 147, 236, 58, 85, 160, 91, 151, 228, 134, 174, 237, 139, 11, 120, 207, 45,
-    229, 102, 131, 81, 78, 69, 79, 205, 214, 74, 193, 233, 23, 0, 37, 176, 132, 67, 174, 173, 19, 81, 74, 146, 132, 142,
-    142, 243, 23, 25, 113, 0, 120, 112, 68, 75, 6, 30, 188, 11, 94, 192, 1, 118, 13, 103, 226, 158, 166, 41, 86, 45,
-    164, 204, 2, 112, 168, 146, 131, 8, 28, 198, 63, 92, 254, 65, 144, 150, 252, 131, 145, 178, 121, 234, 123, 16, 2,
-    233, 183, 216, 30, 52, 0, 41, 68, 8, 141, 116, 195, 209, 151, 22, 133, 113, 33, 253, 134, 65, 236, 173, 69, 1, 118,
-    126, 109, 126, 113, 197, 139, 70, 15, 70, 81, 115, 7, 80, 167, 12, 119, 223, 80, 34, 169, 41, 62, 138, 156, 157, 5,
-    172, 53, 122, 243, 49, 212, 153, 185, 38, 26, 60, 20, 189, 177, 30, 107, 100, 94, 210, 85, 200, 122, 152, 91, 183,
-    12, 104, 176, 157, 134, 80, 108, 45, 247, 179, 115, 102, 124, 207, 30, 71, 150, 45, 139, 193, 86, 123, 173, 158,
-    229, 158, 119, 239, 228, 93, 107, 129, 122, 255, 40, 17, 20, 50, 154, 118, 200, 54, 165, 217, 139, 218, 226, 81,
-    192, 67, 32, 85, 222, 13, 39, 183, 254, 76, 244, 58, 58, 25, 129, 73, 183, 88, 205, 106, 231, 43, 82, 35, 50, 80,
-    43, 245, 158, 39, 181, 234, 6, 125, 80, 25, 31, 230, 209, 73, 141, 72, 88, 244, 44, 125, 67, 112, 103, 86, 69, 220,
-    95, 64, 40, 184, 208, 65, 229, 228, 201, 185, 199, 238, 196, 222, 139, 132, 220, 127, 13, 176, 128, 104, 13, 144,
-    251, 1, 161, 51, 248, 68, 167, 11, 153, 82, 124, 96, 124, 215, 3, 197, 75, 158, 151, 173, 109, 85, 210, 178, 168,
-    222, 109, 147, 165, 9, 131, 163, 72, 214, 189, 227, 35, 229, 252, 173, 6, 225, 38, 236, 6, 44, 86, 167, 65, 255,
-    131, 51, 177, 122, 166, 142, 126, 9, 25, 107, 78, 156, 108, 154, 9, 227, 162, 232, 32, 94, 59, 1, 159, 226, 161,
-    245, 242, 197, 147, 253, 206, 229, 166, 6, 231, 168, 178, 245, 86, 19, 34, 93, 43, 83, 190, 160, 20, 251, 155, 27,
-    54, 43, 61, 30, 215, 47, 31, 105, 250, 0, 142, 204, 49, 255, 14, 245, 151, 35, 111, 200, 139, 248, 229, 21, 129,
-    172, 226, 81, 189, 115, 103, 159, 68, 112, 155, 116, 212, 39, 186, 46, 6, 214, 192, 203, 175, 201, 74, 19, 188, 82,
-    89, 163, 14, 185, 91, 117, 107, 32, 165, 164, 235, 248, 52, 49, 191, 126, 57, 54, 1, 242, 84, 5, 100, 101, 6, 102,
-    188, 99, 106, 170, 168, 142, 32, 214, 141, 16, 169, 129, 70, 47, 129, 20, 108, 57, 94, 91, 117, 113, 116, 78, 240,
-    192, 197, 74, 126, 221, 10, 27, 48, 158, 125, 27, 143, 45, 222, 97, 216, 165, 6, 210, 56, 84, 58, 27, 52, 14, 75,
-    69, 54, 52, 238, 41, 197, 10, 129, 111, 89, 230, 162, 106, 252, 227, 101, 78, 130, 71, 169, 95, 118, 90, 181, 140,
-    63, 15, 30, 40, 133, 85, 72, 154, 124, 42, 30, 221, 17, 153, 250, 189, 27, 155, 125, 12, 22, 207, 53, 14, 135, 217,
-    127, 86, 97, 152, 41, 69, 212, 46, 220, 88, 119, 11, 122, 66, 59, 112, 109, 81, 191, 47, 243, 240, 230, 10, 253, 19,
-    81, 49, 161, 233, 114, 96, 4, 42, 183, 35, 90, 124, 33, 5, 197, 220, 7, 91, 5, 101, 139, 103, 216, 38, 199, 51, 65,
-    147, 179, 184, 92, 160, 83, 62, 150, 6, 244, 209, 226, 215, 106, 247, 78, 90, 91, 183, 188, 111, 75, 229, 99, 209,
-    118, 147, 28, 71, 59, 37, 20, 72, 145, 116, 53, 46, 229, 36, 22, 87, 153, 11, 178, 145, 70, 60, 20, 230, 31, 208,
-    94, 198, 35, 122, 6, 146, 244, 104, 176, 247, 144, 178, 160, 252, 108, 86, 61, 202, 253, 206, 237, 195, 67, 240, 86,
-    185, 81, 51, 164, 65, 198, 94, 48, 110, 73, 136, 20, 229, 164, 28, 22, 15, 198, 61, 155, 173, 123, 17, 216, 63, 56,
-    254, 11, 177, 110, 214, 2, 128, 185, 186, 236, 81, 106, 172, 241, 72, 158, 145, 132, 167, 114, 191, 21, 158, 200,
-    107, 42, 189, 232, 33, 144, 10, 147, 139, 47, 242, 177, 93, 191, 217, 6, 166, 238, 118, 240, 99, 65, 188, 45, 27,
-    70, 218, 31, 165, 53, 142, 38, 167, 217, 216, 246, 40, 140, 10, 228, 119, 4, 173, 229, 148, 193, 1, 123, 163, 201,
-    143, 117, 120, 108, 133, 64, 129, 238, 3, 3, 146, 130, 30, 13, 133, 192, 67, 230, 88, 194, 5, 226, 236, 109, 117,
-    222, 191, 16, 233, 145, 128, 96, 215, 61, 145, 146, 34, 94, 164, 106, 125, 94, 149, 191, 164, 239, 91, 48, 117, 47,
-    59, 245, 205, 62, 123, 53, 107, 98, 238, 202, 177, 168, 12, 50, 0, 22, 171, 81, 145, 206, 23, 12, 233, 199, 216,
-    254, 9, 1, 179, 71, 62, 204, 168, 58, 107, 57, 156, 21, 213, 160, 250, 1, 215, 216, 85, 184, 4, 107, 160, 21, 186,
-    215, 92, 168, 162, 13, 146, 222, 101, 4, 65, 65, 102, 255, 218, 220, 52, 51, 114, 110, 216, 181, 159, 210, 68, 42,
-    183, 73, 68, 197, 187, 215, 165, 98, 193, 206, 42, 230, 136, 102, 77, 32, 253, 50, 170, 174, 132, 117, 139, 140,
-    116, 108, 120, 247, 37, 144, 67, 22, 184, 72, 46, 237, 78, 202, 20, 44, 50, 171, 146, 218, 115, 134, 132, 164, 103,
-    195, 71, 132, 246, 212, 138, 0, 13, 170, 119, 78, 253, 43, 253, 41, 157, 185, 142, 187, 45, 140, 76, 203, 106, 236,
-    114, 73, 183, 156, 139, 126, 125, 26, 203, 145, 25, 176, 85, 110, 129, 185, 34, 113, 222, 179, 238, 14, 33, 40, 97,
-    111, 113, 50, 254, 135, 156, 109, 212, 247, 111, 62, 158, 36, 214, 135, 57, 108, 163, 114, 22, 27, 22, 100, 221,
-    221, 2, 30, 109, 62, 225, 245, 20, 65, 202, 211, 238, 225, 159, 90, 89, 12, 252, 0, 75, 75, 202, 199, 229, 67, 212,
-    113, 214, 49, 181, 228, 22, 232, 92, 191, 175, 5, 202, 15, 9, 154, 193, 48, 217, 37, 223, 208, 0, 215, 41, 176, 192,
-    228, 43, 95, 217, 141, 165, 174, 228, 14, 74, 29, 157, 90, 0, 47, 203, 209, 71, 233, 75, 28, 224, 12, 3, 172, 113,
-    178, 67, 251, 133, 8, 179, 238, 106, 230, 29, 85, 69, 243, 8, 225, 49, 94, 99, 1, 178, 255, 228, 27, 243, 46, 239,
-    7, 93, 119, 0, 253, 96, 170, 185, 12, 146, 150, 199, 9, 226, 85, 83, 244, 103, 153, 130, 82, 152, 127, 76, 34, 110,
-    36, 228, 92, 194, 167, 136, 87, 23, 229, 156, 36, 235, 22, 243, 155, 48, 254, 45, 131, 184, 69, 135, 115, 63, 143,
-    249, 54, 200, 117, 112, 62, 143, 51, 43, 107, 176, 71, 160, 57, 32, 166, 238, 46, 254, 137, 197, 72, 90, 52, 21,
-    232, 138, 254, 119, 225, 212, 16, 226, 47, 123, 211, 217, 17, 111, 177, 159, 151, 50, 25, 253, 169, 235, 186, 169,
-    69, 189, 252, 40, 203, 138, 236, 221, 55, 43, 43, 204, 161, 190, 217, 159, 209, 202, 225, 43, 128, 223, 18, 212, 44,
-    103, 128, 91, 195, 229, 57, 115, 159, 121, 172, 31, 132, 99, 240, 120, 40, 127, 152, 54, 242, 0, 45, 212, 247, 246,
-    250, 178, 241, 226, 116, 162, 126, 148, 40, 49, 254, 72, 75, 115, 97, 87, 181, 122, 199, 211, 24, 61, 21, 197, 159,
-    53, 149, 8, 171, 13, 248, 51, 210, 241, 131, 122, 221, 200, 73, 119, 111, 14, 163, 105, 228, 29, 185, 225, 118, 30,
-    107, 174, 152, 203, 107, 195, 127, 5, 248, 162, 86, 48, 23, 236, 9, 42, 230, 173, 27, 217, 78, 190, 4, 97, 175, 249,
-    249, 167, 247, 157, 28, 201, 41, 133, 210, 175, 152, 204, 206, 148, 43, 119, 52, 254, 143, 106, 26, 143, 84, 221,
-    216, 168, 129, 250, 45, 2, 178, 57, 180, 33, 58, 226, 140, 145, 55, 82, 14, 95, 34, 19, 1, 58, 173, 233, 117, 237,
-    87, 10, 7, 179, 144, 46, 218, 98, 189, 155, 81, 164, 20, 215, 131, 154, 247, 96, 57, 142, 196, 155, 9, 100, 143,
-    231, 48, 62, 18, 117, 213, 184, 17, 48, 132, 42, 184, 207, 41, 236, 115, 16, 71, 84, 19, 71, 181, 77, 112, 75, 138,
-    80, 126, 123, 202, 188, 42, 255, 11, 64, 34, 248, 98, 49, 93, 133, 165, 51, 177, 158, 130, 3, 84, 1, 87, 65, 242,
-    167, 112, 133, 189, 170, 129, 186, 85, 113, 226, 27, 38, 88, 230, 94, 175, 154, 0, 251, 240, 25, 181, 82, 73, 254,
-    69, 74, 217, 98, 56, 138, 33, 15, 179, 65, 109, 36, 243, 98, 95, 121, 98, 185, 154, 158, 31, 91, 162, 135, 0, 183,
-    89, 254, 241, 20, 99, 224, 129, 168, 28, 9, 243, 251, 3, 56, 228, 42, 241, 18, 118, 225, 171, 42, 136, 235, 184, 31,
-    4, 174, 239, 108, 63, 247, 234, 210, 20, 69, 45, 76, 247, 205, 221, 152, 32, 78, 46, 217, 1, 199, 154, 227, 79, 177,
-    254, 74, 70, 151, 124, 230, 214, 236, 105, 108, 181, 25, 13, 51, 175, 207, 83, 50, 31, 33, 18, 81, 80, 66, 52, 136,
-    185, 168, 213, 79, 126, 135, 37, 0, 101, 135, 104, 246, 65, 84, 104, 127, 172, 172, 215, 232, 95, 199, 175, 167,
-    248, 236, 77, 106, 34, 208, 118, 17, 209, 142, 85, 233, 106, 86, 191, 66, 34, 225, 198, 136, 57, 29, 183, 119, 72,
-    37, 119, 6, 165, 204, 50, 226, 79, 69, 97, 2, 229, 133, 61, 217, 74, 68, 149, 131, 59, 27, 188, 30, 254, 232, 242,
-    168, 59, 24, 220, 84, 157, 142, 223, 36, 161, 179, 52, 52, 117, 157, 247, 210, 193, 130, 225, 217, 76, 92, 220, 237,
-    68, 231, 94, 182, 196, 0, 130, 166, 71, 22, 94, 16, 49, 120, 100, 93, 242, 0, 146, 52, 56, 73, 237, 160, 172, 163,
-    178, 235, 58, 174, 38, 59, 151, 111, 9, 24, 207, 166, 13, 221, 196, 133, 20, 99, 148, 225, 227, 43, 202, 118, 50,
-    207, 220, 75, 0, 246, 95, 25, 189, 87, 81, 144, 67, 109, 190, 250, 11, 196, 38, 146, 92, 2, 193, 249, 19, 78, 239,
-    23, 137, 29, 125, 227, 237, 172, 172, 127, 5, 203, 250, 211, 174, 26, 207, 187, 193, 206, 120, 254, 191, 164, 140,
-    36, 154, 26, 166, 1, 66, 28, 57, 150, 29, 223, 101, 172, 78, 143, 215, 209, 17, 116, 60, 92, 212, 210, 129, 212, 10,
-    120, 170, 110, 242, 36, 27, 32, 89, 26, 35, 126, 238, 113, 175, 42, 43, 12, 170, 27, 3, 200, 226, 155, 116, 231,
-    193, 163, 94, 50, 236, 77, 102, 85, 215, 68, 52, 236, 240, 148, 214, 84, 22, 147, 197, 169, 238, 128, 35, 33, 19,
-    59, 119, 117, 69, 10, 181, 101, 99, 104, 150, 160, 242, 20, 29, 72, 80, 88, 185, 139, 226, 192, 8, 228, 34, 51, 69,
-    207, 201, 156, 240, 117, 231, 234, 11, 175, 19, 86, 177, 109, 161, 198, 131, 216, 60, 216, 61, 120, 152, 247, 197,
-    150, 80, 116, 99, 5, 50, 95, 200, 94, 124, 121, 166, 104, 151, 237, 32, 140, 95, 106, 65, 110, 237, 163, 97, 249,
-    233, 42, 107, 120, 51, 161, 144, 249, 106, 126, 28, 167, 58, 91, 85, 4, 92, 112, 49, 1, 241, 251, 193, 189, 40, 199,
-    112, 27, 209, 156, 1, 152, 235, 72, 56, 107, 44, 44, 60, 147, 120, 251, 176, 12, 97, 142, 5, 46, 202, 154, 61, 169,
-    39, 9, 42, 204, 160, 24, 66, 231, 79, 64, 91, 84, 185, 241, 227, 231, 142, 138, 212, 155, 155, 109, 23, 202, 110,
-    92, 142, 220, 169, 227, 53, 253, 160, 204, 78, 117, 101, 248, 212, 219, 162, 74, 56, 71, 245, 126, 12, 70, 69, 211,
-    97, 126, 196, 236, 205, 50, 248, 150, 101, 41, 186, 110, 21, 11, 133, 127, 53, 243, 148, 108, 24, 218, 12, 73, 178,
-    254, 155, 13, 55, 47, 207, 251, 199, 48, 79, 79, 135, 240, 70, 132, 165, 90, 155, 49, 57, 134, 155, 241, 35, 225,
-    238, 95, 252, 123, 142, 177, 43, 82, 186, 79, 123, 185, 212, 31, 192, 95, 60, 30, 31, 163, 229, 63, 45, 0, 127, 118,
-    251, 175, 94, 216, 54, 204, 47, 64, 251, 170, 203, 63, 83, 63, 233, 242, 240, 63, 151, 114, 59, 127, 219, 113, 38,
-    224, 42, 32, 31, 213, 230, 47, 176, 114, 155, 186, 149, 232, 130, 73, 44, 206, 248, 74, 94, 150, 183, 182, 120, 30,
-    247, 172, 232, 46, 187, 112, 55, 177, 216, 94, 38, 238, 153, 243, 169, 37, 189, 89, 94, 63, 230, 97, 193, 245, 143,
-    103, 240, 200, 219, 12, 163, 228, 80, 73, 27, 188, 235, 103, 141, 52, 232, 211, 77, 24, 135, 65, 193, 89, 17, 185,
-    112, 79, 142, 53, 170, 164, 102, 119, 208, 235, 15, 163, 22, 211, 133, 115, 235, 31, 120, 13, 11, 39, 191, 168, 83,
-    27, 14, 9, 111, 130, 182, 144, 57, 206, 178, 76, 89, 52, 255, 253, 20, 101, 230, 49, 158, 235, 58, 113, 240, 90, 67,
-    126, 255, 25, 60, 117, 152, 209, 107, 106, 197, 22, 18, 3, 19, 6, 201, 101, 145, 255, 130, 168, 78, 136, 250, 29,
-    12, 186, 160, 235, 35, 4, 243, 186, 51, 33, 72, 32, 111, 222, 20, 26, 195, 127, 190, 42, 208, 17, 203, 43, 32, 66,
-    238, 232, 32, 81, 44, 49, 212, 199, 173, 15, 123, 187, 74, 126, 134, 192, 66, 87, 229, 159, 180, 27, 227, 200, 184,
-    140, 114, 232, 124, 213, 182, 122, 34, 2, 7, 116, 113, 32, 8, 107, 224, 218, 231, 205, 254, 121, 88, 106, 54, 89,
-    105, 41, 112, 221, 113, 136, 44, 175, 60, 19, 19, 249, 203, 116, 188, 6, 200, 207, 234, 86, 163, 112, 51, 37, 95,
-    199, 162, 241, 5, 239, 94, 40, 49, 217, 19, 127, 70, 117, 7, 140, 103, 164, 202, 200, 63, 172, 54, 139, 131, 95,
-    241, 101, 10, 19, 20, 39, 104, 186, 128, 206, 238, 169, 39, 63, 242, 27, 70, 190, 79, 182, 64, 35, 27, 171, 183, 71,
-    187, 26, 37, 83, 72, 226, 170, 40, 212, 247, 94, 109, 43, 172, 37, 151, 154, 123, 190, 231, 99, 23, 215, 127, 126,
-    110, 115, 43, 3, 186, 225, 45, 216, 63, 236, 217, 31, 196, 106, 130, 18, 94, 50, 215, 128, 92, 6, 106, 124, 213, 9,
-    197, 139, 186, 95, 162, 174, 185, 179, 171, 68, 55, 108, 232, 184, 233, 206, 161, 72, 252, 124, 212, 207, 242, 126,
-    26, 78, 196, 109, 186, 151, 18, 183, 215, 130, 137, 49, 162, 198, 56, 97, 71, 195, 146, 69, 57, 44, 92, 198, 13, 41,
-    203, 37, 15, 88, 156, 236, 178, 254, 255, 194, 64, 167, 223, 62, 209, 79, 129, 21, 50, 210, 232, 91, 54, 190, 5,
-    106, 217, 218, 170, 246, 117, 9, 12, 28, 148, 161, 50, 221, 55, 164, 81, 52, 144, 184, 223, 32, 246, 78, 245, 206,
-    146, 204, 82, 5, 122, 5, 44, 68, 33, 82, 239, 129, 213, 199, 32, 35, 34, 76, 249, 201, 22, 38, 88, 64, 49, 243, 135,
-    167, 104, 39, 155, 14, 76, 131, 140, 107, 57, 240, 161, 153, 160, 151, 11, 249, 208, 108, 158, 76, 175, 92, 186,
-    171, 215, 3, 63, 130, 125, 64, 243, 134, 246, 172, 202, 4, 105, 163, 207, 58, 28, 240, 95, 227, 78, 206, 128, 255,
-    252, 83, 37, 174, 166, 32, 215, 35, 103, 131, 183, 220, 138, 189, 252, 75, 2, 213, 12, 52, 191, 23, 175, 63, 235,
-    57, 231, 64, 114, 231, 203, 136, 226, 37, 245, 91, 91, 183, 74, 115, 154, 136, 118, 222, 106, 93, 104, 129, 85, 47,
-    93, 187, 3, 42, 240, 128, 31, 12, 153, 83, 251, 16, 109, 131, 5, 142, 170, 35, 209, 165, 65, 103, 138, 232, 7, 107,
-    44, 93, 115, 29, 114, 33, 172, 200, 71, 152, 214, 15, 27, 115, 207, 48, 210, 56, 45, 82, 136, 206, 212, 10, 4, 244,
-    240, 16, 117, 137, 40, 37, 114, 48, 39, 86, 81, 46, 49, 40, 172, 36, 137, 82, 166, 22, 87, 243, 170, 120, 122, 14,
-    123, 34, 36, 116, 134, 124, 13, 211, 27, 51, 125, 168, 235, 136, 149, 47, 20, 83, 89, 199, 188, 162, 99, 66, 210,
-    29, 79, 243, 54, 154, 48, 195, 231, 19, 204, 243, 155, 161, 86, 63, 230, 8, 64, 6, 239, 124, 126, 117, 171, 87, 97,
-    90, 147, 83, 23, 156, 64, 179, 206, 66, 246, 64, 20, 10, 244, 153, 58, 52, 94, 237, 72, 91, 93, 200, 44, 237, 76,
-    60, 177, 79, 155, 223, 34, 57, 155, 99, 254, 87, 233, 32, 252, 252, 30, 79, 51, 108, 252, 174, 70, 116, 54, 49, 98,
-    199, 112, 59, 17, 180, 143, 5, 45, 145, 241, 120, 183, 24, 18, 83, 72, 208, 243, 93, 220, 209, 199, 245, 147, 218,
-    123, 120, 108, 70, 164, 139, 239, 118, 54, 30, 40, 83, 222, 5, 198, 236, 219, 79, 107, 241, 239, 95, 75, 233, 1, 41,
-    158, 42, 222, 96, 143, 14, 185, 64, 57, 229, 116, 27, 91, 219, 30, 220, 84, 100, 103, 229, 134, 50, 215, 188, 231,
-    166, 16, 31, 242, 246, 81, 51, 45, 87, 135, 184, 18, 74, 209, 120, 223, 5, 47, 227, 226, 217, 126, 118, 50, 141, 9,
-    13, 120, 77, 248, 62, 179, 237, 115, 48, 203, 96, 223, 154, 168, 10, 145, 190, 92, 43, 228, 175, 59, 223, 226, 108,
-    144, 227, 215, 255, 4, 77, 126, 52, 42, 233, 84, 147, 95, 174, 63, 87, 59, 56, 70, 186, 60, 155, 179, 178, 19, 195,
-    148, 11, 237, 26, 47, 9, 35, 214, 157, 178, 160, 4, 112, 146, 170, 123, 238, 82, 91, 249, 163, 108, 164, 15, 175,
-    91, 1, 164, 185, 164, 198, 184, 206, 231, 147, 197, 247, 78, 202, 251, 30, 98, 16, 220, 164, 198, 53, 63, 119, 118,
-    106, 58, 205, 20, 117, 42, 181, 113, 86, 2, 14, 122, 17, 39, 227, 181, 95, 57, 30, 84, 94, 246, 221, 212, 221, 132,
-    5, 207, 11, 3, 89, 116, 184, 159, 143, 165, 194, 4, 197, 233, 2, 202, 109, 185, 85, 69, 14, 236, 14, 100, 158, 78,
-    75, 155, 255, 185, 50, 247, 243, 186, 206, 145, 180, 152, 78, 46, 248, 250, 25, 186, 19, 138, 187, 229, 125, 109,
-    111, 47, 227, 133, 12, 64, 66, 197, 229, 210, 183, 215, 84, 27, 202, 219, 218, 13, 4, 149, 234, 42, 119, 59, 218,
-    215, 96, 206, 76, 122, 77, 19, 222, 247, 121, 194, 89, 63, 109, 228, 150, 201, 40, 239, 254, 78, 79, 67, 25, 191,
-    120, 220, 212, 118, 140, 66, 227, 155, 230, 225, 170, 11, 24, 46, 8, 184, 127, 111, 66, 206, 225, 139, 122, 86, 63,
-    96, 127, 89, 209, 222, 180, 205, 120, 36, 242, 251, 210, 121, 63, 200, 57, 109, 167, 22, 87, 252, 219, 4, 25, 180,
-    68, 77, 174, 60, 199, 118, 129, 43, 251, 230, 238, 203, 201, 35, 113, 92, 189, 246, 237, 49, 91, 242, 26, 194, 6,
-    71, 95, 85, 128, 103, 29, 19, 162, 102, 237, 41, 12, 128, 254, 249, 233, 171, 11, 238, 217, 171, 242, 67, 77, 0,
-    160, 184, 192, 15, 208, 145, 77, 89, 133, 182, 178, 238, 190, 140, 20, 51, 45, 248, 91, 128, 129, 161, 254, 141,
-    168, 5, 205, 136, 129, 53, 4, 214, 61, 171, 200, 103, 159, 49, 120, 168, 46, 172, 0, 146, 109, 206, 205, 134, 233,
-    135, 141, 38, 221, 53, 91, 100, 42, 77, 94, 246, 209, 209, 1, 25, 120, 55, 153, 70, 80, 67, 45, 172, 248, 52, 241,
-    39, 83, 249, 14, 107, 152, 187, 248, 199, 162, 12, 72, 220, 20, 136, 195, 122, 204, 22, 5, 82, 254, 142, 13, 169,
-    231, 97, 16, 123, 118, 240, 236, 22, 171, 231, 122, 149, 128, 220, 184, 205, 251, 226, 140, 221, 244, 212, 226, 30,
-    142, 178, 114, 87, 219, 169, 140, 168, 243, 171, 239, 113, 135, 91, 220, 64, 247, 185, 128, 166, 190, 80, 185, 169,
-    219, 134, 184, 96, 235, 83, 154, 137, 47, 8, 156, 208, 225, 38, 212, 144, 117, 192, 52, 218, 55, 107, 180, 68, 143,
-    236, 140, 92, 76, 165, 33, 188, 230, 113, 21, 128, 113, 173, 82, 240, 219, 179, 214, 159, 184, 116, 167, 43, 48, 4,
-    227, 250, 49, 250, 166, 216, 10, 217, 81, 25, 97, 125, 212, 93, 226, 175, 96, 155, 44, 171, 210, 210, 121, 3, 143,
-    54, 73, 64, 224, 108, 247, 138, 249, 252, 15, 179, 182, 157, 175, 30, 232, 21, 190, 125, 125, 136, 137, 118, 115,
-    80, 106, 120, 154, 65, 160, 82, 129, 29, 184, 11, 206, 67, 101, 182, 69, 233, 153, 73, 32, 49, 51, 97, 143, 113, 34,
-    140, 189, 84, 108, 5, 33, 36, 108, 84, 176, 126, 21, 235, 81, 183, 204, 151, 63, 133, 234, 193, 105, 76, 117, 106,
-    69, 113, 188, 198, 249, 31, 107, 31, 96, 167, 158, 201, 13, 14, 99, 155, 184, 124, 57, 21, 184, 94, 227, 111, 60,
-    99, 129, 68, 163, 1, 242, 31, 130, 179, 205, 160, 156, 215, 156, 9, 182, 84, 46, 183, 240, 158, 90, 57, 4, 179, 107,
-    213, 91, 18, 165, 150, 103, 28, 87, 205, 215, 212, 206, 54, 223, 66, 31, 114, 106, 181, 60, 214, 162, 163, 185, 78,
-    172, 211, 232, 23, 52, 214, 216, 92, 191, 193, 126, 234, 249, 147, 210, 161, 18, 239, 40, 237, 178, 237, 168, 233,
-    200, 175, 141, 164, 107, 138, 149, 52, 113, 167, 171, 229, 253, 228, 218, 136, 146, 77, 33, 30, 128, 211, 102, 13,
-    242, 148, 88, 48, 238, 191, 126, 205, 103, 237, 32, 112, 107, 114, 202, 56, 205, 230, 204, 76, 127, 31, 0, 100, 255,
-    251, 82, 92, 112, 46, 73, 238, 95, 208, 220, 59, 3, 163, 69, 123, 185, 209, 110, 37, 116, 219, 248, 200, 204, 64,
-    41, 188, 44, 163, 55, 36, 148, 218, 230, 46, 220, 194, 188, 107, 213, 226, 111, 251, 65, 44, 80, 229, 19, 66, 185,
-    158, 206, 142, 229, 139, 152, 178, 149, 227, 224, 135, 71, 216, 217, 124, 169, 0, 98, 106, 56, 236, 79, 156, 128,
-    141, 9, 236, 163, 168, 245, 90, 143, 22, 233, 28, 237, 13, 210, 20, 222, 39, 23, 183, 92, 208, 234, 142, 16, 167,
-    178, 7, 153, 175, 46, 156, 219, 38, 174, 153, 32, 206, 212, 0, 149, 222, 229, 53, 250, 218, 86, 70, 55, 25, 175,
-    170, 203, 140, 51, 7, 222, 190, 138, 143, 85, 211, 185, 247, 223, 187, 13, 185, 165, 148, 179, 248, 121, 59, 238,
-    136, 168, 129, 109, 157, 149, 250, 45, 188, 209, 178, 245, 57, 125, 165, 244, 48, 175, 73, 56, 95, 158, 142, 41,
-    180, 72, 150, 127, 251, 58, 127, 84, 46, 34, 202, 81, 69, 230, 133, 58, 191, 30, 128, 19, 225, 154, 93, 222, 227,
-    132, 151, 184, 155, 90, 196, 186, 243, 182, 179, 68, 181, 72, 206, 172, 76, 8, 187, 122, 137, 197, 119, 89, 8, 26,
-    91, 86, 149, 135, 59, 162, 137, 77, 205, 48, 187, 27, 198, 89, 148, 102, 86, 132, 177, 95, 198, 208, 180, 11, 72,
-    199, 14, 120, 140, 66, 154, 147, 50, 75, 76, 194, 32, 147, 42, 197, 135, 27, 76, 247, 24, 116, 99, 248, 217, 84, 30,
-    17, 61, 164, 66, 13, 4, 206, 253, 237, 128, 48, 44, 104, 55, 164, 180, 202, 8, 175, 84, 58, 14, 126, 205, 193, 40,
-    97, 97, 251, 178, 248, 190, 93, 33, 121, 149, 173, 29, 226, 69, 79, 59, 217, 83, 105, 137, 99, 62, 126, 12, 194, 39,
-    3, 184, 166, 183, 145, 229, 56, 244, 109, 195, 201, 195, 220, 65, 216, 94, 207, 60, 83, 22, 161, 30, 190, 138, 251,
-    33, 103, 135, 177, 183, 36, 191, 113, 42, 103, 125, 196, 164, 59, 39, 176, 204, 181, 149, 171, 143, 62, 14, 229,
-    131, 34, 114, 252, 158, 87, 121, 40, 97, 186, 236, 56, 22, 248, 187, 199, 253, 67, 168, 176, 28, 224, 92, 233, 127,
-    74, 255, 71, 200, 158, 198, 151, 151, 15, 240, 218, 5, 80, 43, 139, 38, 11, 147, 12, 98, 214, 197, 45, 251, 184,
-    129, 225, 226, 72, 237, 10, 193, 62, 59, 202, 255, 226, 39, 152, 14, 54, 24, 184, 161, 158, 143, 117, 138, 208, 137,
-    195, 1, 102, 14, 49, 244, 236, 239, 38, 184, 2, 186, 183, 215, 194, 240, 147, 239, 168, 8, 40, 120, 210, 7, 194,
-    226, 188, 187, 239, 34, 146, 98, 235, 208, 125, 155, 113, 81, 174, 3, 118, 60, 176, 126, 182, 150, 30, 154, 155, 79,
-    216, 48, 170, 158, 154, 106, 46, 123, 17, 107, 241, 254, 82, 104, 125, 82, 208, 146, 210, 168, 21, 92, 207, 219, 27,
-    185, 13, 147, 204, 215, 99, 82, 147, 127, 45, 227, 215, 164, 220, 205, 117, 143, 135, 252, 15, 110, 219, 48, 195,
-    87, 104, 57, 72, 109, 207, 95, 242, 54, 90, 99, 93, 32, 224, 151, 192, 184, 84, 172, 101, 6, 89, 23, 31, 175, 104,
-    127, 254, 91, 152, 239, 141, 215, 42, 212, 75, 23, 43, 129, 53, 142, 253, 235, 158, 243, 26, 179, 5, 238, 22, 211,
-    114, 141, 104, 248, 250, 128, 168, 0, 143, 73, 30, 227, 197, 87, 47, 128, 67, 121, 19, 152, 7, 52, 198, 120, 49,
-    105, 181, 15, 78, 160, 91, 105, 46, 151, 71, 101, 94, 232, 23, 186, 251, 233, 244, 7, 197, 228, 105, 68, 114, 8, 9,
-    15, 122, 20, 45, 11, 37, 94, 19, 165, 130, 205, 121, 141, 125, 129, 14, 78, 220, 29, 132, 132, 112, 175, 54, 242,
-    65, 56, 218, 131, 55, 26, 72, 14, 209, 103, 169, 231, 250, 80, 250, 55, 134, 192, 104, 225, 14, 217, 33, 32, 28,
-    207, 157, 18, 251, 132, 255, 60, 170, 236, 151, 99, 174, 135, 69, 65, 62, 30, 15, 174, 75, 134, 95, 49, 96, 125,
-    194, 61, 5, 209, 66, 122, 241, 65, 69, 174, 33, 178, 91, 136, 75, 184, 167, 255, 121, 247, 198, 50, 196, 131, 19,
-    238, 183, 37, 58, 83, 231, 151, 20, 13, 24, 77, 166, 151, 208, 188, 95, 42, 43, 12, 203, 30, 147, 232, 5, 20, 61,
-    150, 176, 118, 60, 13, 183, 154, 185, 14, 81, 22, 243, 202, 164, 118, 210, 27, 131, 97, 163, 34, 137, 23, 238, 33,
-    227, 179, 170, 5, 97, 24, 102, 93, 49, 181, 40, 13, 164, 121, 18, 138, 80, 127, 79, 235, 74, 205, 213, 175, 119,
-    250, 78, 229, 204, 84, 244, 78, 45, 12, 80, 205, 222, 147, 144, 36, 29, 117, 188, 232, 90, 148, 170, 15, 217, 211,
-    161, 189, 62, 238, 82, 223, 53, 136, 139, 7, 16, 91, 140, 70, 135, 30, 237, 14, 27, 39, 219, 38, 120, 234, 249, 216,
-    174, 58, 12, 7, 67, 95, 151, 119, 94, 68, 228, 153, 198, 61, 30, 95, 24, 250, 99, 194, 32, 192, 34, 254, 249, 131,
-    103, 122, 121, 195, 216, 145, 143, 130, 44, 217, 105, 117, 48, 32, 86, 110, 240, 203, 253, 156, 58, 41, 212, 234,
-    160, 197, 243, 70, 81, 43, 147, 205, 1, 4, 150, 142, 34, 185, 233, 90, 224, 195, 188, 162, 14, 136, 120, 92, 131,
-    220, 215, 70, 189, 220, 196, 158, 92, 202, 209, 209, 172, 233, 231, 15, 93, 37, 114, 76, 255, 130, 100, 5, 78, 44,
-    191, 220, 254, 197, 41, 189, 41, 32, 163, 158, 150, 232, 165, 246, 103, 43, 21, 22, 235, 60, 112, 115, 162, 12, 233,
-    147, 50, 23, 42, 89, 233, 110, 82, 16, 108, 160, 181, 62, 0, 237, 213, 54, 13, 238, 74, 198, 244, 10, 136, 194, 178,
-    51, 11, 210, 5, 189, 117, 182, 203, 83, 166, 2, 39, 46, 208, 168, 235, 21, 106, 72, 117, 229, 46, 205, 21, 214, 230,
-    66, 82, 133, 25, 5, 208, 21, 184, 51, 82, 162, 220, 140, 140, 116, 200, 180, 136, 14, 19, 107, 207, 206, 80, 154,
-    211, 48, 189, 179, 201, 118, 228, 32, 110, 11, 96, 149, 249, 202, 180, 250, 48, 152, 8, 199, 24, 60, 222, 72, 185,
-    63, 122, 32, 156, 136, 216, 240, 58, 125, 165, 143, 31, 148, 190, 255, 215, 233, 88, 77, 10, 54, 194, 87, 201, 237,
-    126, 94, 193, 107, 107, 247, 235, 237, 175, 180, 221, 228, 147, 22, 38, 52, 116, 24, 53, 107, 83, 37, 127, 66, 198,
-    26, 222, 154, 46, 188, 73, 49, 23, 110, 207, 184, 63, 142, 203, 220, 34, 144, 101, 5, 27, 141, 86, 224, 85, 100,
-    253, 181, 132, 206, 229, 105, 234, 218, 253, 136, 170, 194, 122, 74, 243, 125, 105, 46, 58, 221, 208, 79, 46, 229,
-    97, 62, 178, 120, 82, 25, 43, 102, 47, 214, 17, 29, 84, 120, 72, 2, 37, 147, 36, 194, 217, 238, 48, 194, 122, 220,
-    12, 215, 238, 217, 50, 76, 189, 191, 169, 173, 166, 35, 79, 97, 186, 11, 171, 116, 2, 125, 244, 255, 74, 180, 199,
-    4, 84, 108, 95, 48, 111, 36, 72, 131, 108, 138, 166, 232, 42, 181, 82, 0, 24, 28, 22, 189, 180, 236, 167, 41, 27,
-    178, 90, 39, 86, 35, 190, 4, 252, 152, 92, 100, 161, 242, 234, 78, 55, 22, 184, 176, 186, 140, 18, 109, 34, 30, 128,
-    141, 97, 48, 88, 11, 48, 118, 52, 131, 58, 25, 174, 234, 165, 148, 200, 96, 31, 191, 83, 169, 221, 213, 173, 21,
-    221, 73, 57, 165, 49, 253, 7, 144, 12, 15, 68, 82, 207, 218, 53, 169, 210, 60, 39, 62, 5, 100, 98, 3, 216, 182, 0,
-    11, 50, 251, 42, 126, 188, 93, 189, 88, 241, 148, 203, 34, 143, 90, 189, 113, 246, 137, 125, 227, 209, 191, 72, 20,
-    136, 234, 122, 91, 97, 6, 208, 88, 51, 47, 201, 205, 106, 49, 253, 64, 9, 142, 253, 214, 187, 66, 249, 122, 77, 126,
-    238, 84, 163, 23, 76, 68, 28, 77, 220, 7, 58, 141, 189, 254, 23, 109, 236, 140, 42, 91, 12, 176, 48, 21, 26, 41,
-    107, 184, 80, 167, 72, 176, 28, 16, 228, 10, 244, 95, 179, 207, 213, 70, 118, 116, 253, 78, 31, 40, 161, 20, 196,
-    11, 31, 233, 82, 155, 194, 213, 149, 151, 9, 98, 59, 127, 32, 77, 170, 244, 219, 227, 162, 42, 175, 84, 205, 54, 66,
-    151, 57, 192, 253, 124, 109, 18, 235, 170, 61, 126, 123, 190, 63, 223, 96, 96, 242, 243, 104, 137, 23, 145, 191, 57,
-    123, 174, 147, 64, 13, 201, 240, 94, 70, 144, 228, 227, 88, 109, 192, 14, 119, 216, 46, 74, 222, 99, 23, 101, 146,
-    226, 103, 17, 195, 231, 164, 171, 112, 199, 10, 213, 60, 213, 123, 35, 238, 67, 153, 122, 253, 1, 19, 146, 160, 78,
-    150, 16, 82, 22, 29, 5, 93, 189, 25, 109, 79, 146, 206, 84, 194, 29, 23, 9, 228, 228, 181, 137, 236, 53, 90, 77,
-    181, 90, 219, 151, 13, 31, 45, 10, 251, 147, 39, 221, 214, 254, 250, 81, 165, 131, 148, 196, 75, 210, 167, 185, 89,
-    75, 182, 58, 190, 168, 241, 184, 14, 93, 149, 30, 236, 174, 88, 165, 159, 27, 181, 187, 193, 57, 12, 87, 128, 20,
-    132, 96, 246, 119, 127, 166, 188, 132, 138, 59, 82, 206, 221, 77, 162, 44, 88, 38, 231, 73, 226, 116, 165, 117, 191,
-    26, 48, 68, 254, 198, 222, 200, 125, 24, 196, 221, 170, 208, 130, 188, 8, 182, 7, 223, 250, 92, 150, 225, 28, 13,
-    173, 226, 234, 131, 75, 84, 22, 14, 95, 241, 177, 37, 53, 66, 247, 61, 173, 147, 110, 239, 67, 172, 201, 42, 1, 2,
-    38, 154, 18, 42, 63, 167, 96, 234, 11, 165, 231, 217, 181, 132, 220, 113, 84, 61, 254, 60, 120, 160, 140, 182, 36,
-    136, 166, 5, 54, 177, 252, 86, 143, 242, 83, 106, 76, 197, 59, 234, 89, 118, 255, 182, 127, 28, 30, 125, 35, 11, 41,
-    83, 222, 202, 19, 98, 93, 14, 67, 233, 6, 78, 112, 156, 128, 113, 230, 250, 150, 96, 148, 133, 121, 217, 231, 227,
-    59, 89, 244, 243, 88, 205, 83, 65, 239, 154, 97, 50, 192, 33, 111, 75, 75, 179, 50, 233, 53, 104, 131, 241, 199, 63,
-    207, 219, 3, 147, 108, 82, 117, 15, 42, 19, 86, 137, 9, 111, 20, 191, 179, 28, 99, 231, 175, 134, 203, 86, 51, 59,
-    248, 18, 33, 138, 90, 170, 214, 89, 193, 206, 237, 43, 88, 24, 205, 96, 48, 244, 86, 135, 34, 44, 106, 238, 146,
-    252, 219, 104, 20, 226, 23, 195, 113, 226, 31, 49, 92, 155, 132, 162, 172, 237, 0, 2, 252, 31, 249, 171, 251, 91,
-    121, 185, 53, 149, 14, 12, 1, 172, 45, 72, 135, 41, 170, 159, 218, 4, 66, 122, 200, 61, 209, 99, 19, 150, 92, 117,
-    91, 252, 76, 104, 149, 80, 187, 49, 169, 108, 97, 116, 125, 194, 67, 149, 173, 183, 145, 144, 9, 80, 192, 74, 196,
-    87, 5, 67, 43, 228, 172, 129, 67, 249, 3, 224, 111, 136, 95, 18, 48, 248, 111, 170, 227, 142, 118, 218, 251, 155,
-    141, 241, 250, 61, 231, 241, 84, 217, 16, 21, 81, 19, 207, 186, 86, 228, 90, 255, 151, 148, 51, 205, 99, 51, 167,
-    227, 202, 199, 222, 187, 104, 37, 31, 127, 178, 193, 52, 185, 214, 122, 44, 249, 191, 74, 164, 9, 76, 49, 38, 80,
-    181, 211, 30, 41, 89, 155, 60, 132, 62, 192, 16, 248, 76, 86, 210, 151, 127, 109, 19, 43, 9, 68, 0, 17, 126, 73, 40,
-    83, 191, 237, 244, 10, 214, 121, 186, 12, 43, 103, 54, 205, 249, 72, 230, 44, 66, 64, 124, 246, 186, 144, 17, 149,
-    14, 68, 79, 68, 229, 53, 223, 210, 55, 164, 187, 25, 39, 238, 56, 145, 224, 216, 169, 30, 152, 172, 245, 68, 38,
-    244, 226, 126, 40, 164, 143, 25, 2, 208, 81, 224, 30, 66, 133, 97, 19, 190, 8, 137, 59, 200, 55, 1, 68, 172, 185,
-    217, 84, 204, 70, 90, 219, 139, 68, 217, 155, 139, 177, 226, 81, 79, 191, 224, 0, 204, 129, 204, 110, 254, 180, 209,
-    212, 51, 246, 233, 198, 112, 36, 170, 75, 3, 104, 53, 132, 67, 37, 148, 142, 63, 77, 15, 253, 201, 62, 206, 70, 57,
-    190, 136, 88, 146, 126, 238, 173, 97, 26, 245, 0, 228, 80, 155, 2, 89, 246, 181, 15, 46, 203, 179, 92, 122, 155,
-    135, 63, 112, 155, 254, 242, 42, 106, 102, 207, 139, 140, 216, 90, 222, 253, 148, 10, 98, 63, 57, 218, 48, 128, 195,
-    167, 159, 180, 179, 58, 194, 1, 199, 40, 113, 91, 5, 169, 195, 181, 150, 175, 128, 194, 8, 69, 54, 8, 159, 233, 231,
-    52, 108, 238, 29, 0, 241, 145, 78, 39, 106, 157, 95, 84, 184, 187, 104, 84, 57, 5, 142, 99, 36, 204, 48, 74, 34,
-    124, 20, 112, 173, 4, 147, 234, 143, 140, 119, 226, 233, 40, 139, 92, 182, 16, 197, 3, 214, 7, 156, 59, 231, 94,
-    155, 211, 228, 65, 90, 195, 69, 214, 116, 146, 186, 180, 79, 52, 56, 103, 115, 246, 108, 160, 243, 116, 243, 141,
-    131, 224, 74, 236, 53, 115, 194, 185, 193, 207, 81, 216, 57, 103, 82, 89, 251, 124, 157, 47, 46, 196, 92, 96, 3,
-    156, 172, 61, 8, 52, 28, 156, 96, 45, 228, 218, 128, 246, 139, 133, 98, 226, 114, 200, 87, 39, 146, 76, 194, 96, 89,
-    48, 45, 116, 129, 15, 165, 29, 66, 148, 35, 157, 253, 80, 19, 27, 138, 140, 254, 241, 141, 43, 7, 174, 176, 218, 95,
-    128, 31, 39, 24, 103, 33, 215, 25, 156, 128, 185, 69, 150, 11, 84, 23, 52, 90, 236, 62, 200, 29, 21, 22, 74, 154,
-    253, 254, 117, 130, 183, 140, 142, 150, 107, 88, 192, 202, 19, 249, 12, 89, 26, 158, 201, 44, 117, 133, 163, 49, 26,
-    223, 175, 129, 57, 198, 199, 232, 30, 136, 246, 195, 221, 44, 156, 199, 139, 191, 98, 38, 138, 192, 236, 139, 245,
-    160, 38, 89, 35, 196, 32, 255, 239, 166, 221, 132, 178, 226, 106, 222, 94, 201, 155, 91, 56, 130, 53, 195, 21, 234,
-    165, 245, 229, 242, 125, 23, 189, 32, 237, 170, 195, 244, 162, 231, 213, 88, 39, 54, 122, 85, 10, 44, 153, 20, 218,
-    9, 130, 89, 195, 241, 133, 96, 227, 218, 203, 82, 239, 104, 3, 221, 225, 142, 43, 205, 41, 150, 69, 46, 221, 160,
-    31, 108, 38, 22, 217, 98, 230, 124, 160, 19, 84, 213, 122, 199, 181, 11, 164, 154, 237, 197, 235, 83, 96, 20, 53,
-    37, 107, 41, 251, 230, 159, 158, 54, 100, 159, 44, 11, 212, 11, 46, 54, 129, 19, 85, 105, 170, 26, 229, 151, 192,
-    253, 114, 245, 209, 19, 60, 162, 11, 26, 150, 64, 236, 62, 64, 252, 230, 32, 158, 159, 111, 20, 127, 251, 222, 86,
-    7, 234, 222, 182, 136, 51, 17, 187, 139, 117, 128, 143, 194, 169, 38, 15, 16, 248, 195, 37, 168, 244, 245, 32, 207,
-    199, 90, 9, 53, 10, 23, 206, 129, 187, 168, 79, 26, 165, 79, 26, 203, 162, 152, 171, 237, 122, 141, 42, 160, 105,
-    136, 168, 154, 95, 111, 206, 23, 132, 254, 200, 119, 148, 222, 214, 112, 42, 191, 177, 79, 125, 68, 21, 143, 88,
-    233, 169, 83, 50, 175, 105, 131, 147, 41, 50, 243, 159, 62, 242, 1, 252, 102, 148, 84, 131, 18, 113, 17, 114, 126,
-    45, 90, 248, 104, 124, 183, 29, 174, 211, 77, 253, 48, 5, 159, 65, 224, 172, 93, 36, 131, 123, 150, 102, 115, 189,
-    227, 209, 223, 123, 7, 17, 241, 228, 225, 92, 161, 227, 91, 63, 63, 186, 187, 27, 67, 44, 184, 82, 66, 47, 201, 22,
-    239, 24, 142, 160, 145, 60, 153, 235, 67, 198, 229, 77, 173, 72, 226, 38, 250, 94, 15, 200, 217, 181, 32, 160, 20,
-    122, 25, 226, 51, 154, 205, 222, 87, 159, 167, 248, 226, 248, 14, 239, 129, 192, 110, 249, 11, 128, 134, 90, 195,
-    22, 188, 76, 58, 66, 184, 43, 12, 249, 56, 152, 148, 217, 57, 140, 203, 195, 144, 156, 26, 150, 193, 91, 164, 96,
-    172, 236, 103, 62, 23, 11, 212, 95, 52, 171, 196, 142, 177, 79, 183, 119, 10, 206, 239, 52, 143, 198, 53, 185, 186,
-    148, 161, 118, 238, 77, 16, 155, 216, 103, 245, 235, 66, 195, 14, 76, 163, 22, 172, 67, 225, 5, 120, 1, 195, 209,
-    10, 6, 205, 4, 45, 244, 45, 88, 74, 14, 99, 15, 41, 108, 86, 103, 195, 240, 82, 66, 104, 218, 183, 79, 164, 72, 119,
-    64, 146, 120, 50, 188, 81, 146, 102, 238, 125, 150, 223, 183, 88, 180, 227, 203, 189, 244, 233, 148, 6, 70, 157,
-    212, 104, 3, 35, 131, 15, 196, 31, 17, 155, 169, 14, 248, 112, 155, 67, 57, 81, 166, 165, 146, 179, 68, 67, 39, 82,
-    172, 213, 16, 202, 142, 107, 195, 212, 101, 97, 26, 213, 250, 3, 226, 222, 134, 184, 190, 46, 34, 160, 6, 179, 72,
-    179, 181, 64, 8, 62, 5, 69, 23, 185, 110, 80, 190, 70, 225, 40, 110, 18, 63, 206, 56, 95, 120, 171, 221, 246, 90,
-    48, 232, 74, 34, 126, 78, 230, 15, 167, 168, 213, 13, 86, 54, 191, 147, 25, 195, 19, 206, 170, 163, 154, 167, 33,
-    233, 100, 239, 246, 34, 204, 192, 76, 62, 139, 245, 186, 43, 80, 230, 1, 62, 197, 239, 30, 226, 8, 73, 184, 161, 80,
-    150, 109, 159, 191, 181, 120, 91, 228, 105, 220, 43, 201, 142, 57, 1, 170, 206, 197, 192, 27, 14, 230, 172, 2, 129,
-    51, 208, 153, 68, 125, 248, 160, 108, 69, 179, 64, 142, 163, 191, 104, 25, 11, 209, 153, 67, 240, 234, 130, 58, 60,
-    242, 142, 198, 18, 128, 70, 213, 191, 237, 113, 105, 33, 22, 163, 199, 85, 158, 87, 214, 95, 59, 77, 98, 193, 224,
-    221, 29, 217, 114, 227, 85, 98, 107, 210, 46, 211, 207, 52, 171, 248, 240, 232, 183, 80, 25, 121, 23, 236, 67, 122,
-    108, 18, 168, 219, 230, 62, 178, 184, 240, 59, 88, 6, 182, 18, 44, 108, 133, 217, 159, 143, 199, 221, 217, 86, 112,
-    191, 25, 57, 162, 202, 251, 145, 130, 244, 158, 85, 9, 246, 210, 35, 120, 52, 184, 127, 156, 147, 215, 225, 112,
-    111, 91, 0, 113, 56, 225, 124, 125, 0, 31, 39, 207, 86, 80, 165, 46, 157, 248, 43, 215, 171, 165, 223, 246, 216,
-    172, 177, 149, 54, 9, 111, 193, 103, 44, 218, 102, 246, 204, 183, 130, 117, 67, 214, 104, 48, 85, 94, 208, 216, 107,
-    94, 252, 12, 115, 177, 251, 13, 16, 55, 201, 49, 31, 127, 125, 172, 247, 182, 201, 237, 207, 216, 117, 242, 213,
-    112, 35, 120, 61, 125, 90, 204, 31, 253, 17, 120, 150, 251, 32, 163, 67, 249, 121, 167, 104, 54, 90, 54, 41, 185,
-    56, 159, 137, 11, 133, 184, 183, 45, 160, 185, 111, 13, 37, 137, 18, 89, 89, 163, 81, 201, 222, 35, 31, 230, 160,
-    22, 246, 229, 222, 92, 251, 15, 42, 106, 232, 123, 98, 65, 28, 149, 203, 211, 90, 250, 79, 54, 110, 73, 19, 255, 48,
-    244, 37, 213, 206, 8, 88, 29, 49, 67, 77, 131, 123, 40, 209, 98, 203, 151, 86, 54, 152, 179, 124, 29, 138, 196, 80,
-    158, 142, 167, 6, 122, 172, 166, 111, 71, 147, 67, 176, 113, 196, 113, 40, 1, 210, 214, 248, 248, 171, 250, 106,
-    222, 27, 223, 112, 89, 11, 190, 96, 40, 187, 99, 35, 136, 60, 96, 84, 87, 74, 128, 167, 80, 108, 223, 174, 65, 154,
-    175, 213, 161, 87, 110, 136, 51, 55, 61, 44, 135, 183, 164, 156, 27, 8, 47, 86, 69, 158, 109, 41, 159, 152, 5, 39,
-    12, 102, 122, 51, 134, 68, 27, 152, 213, 14, 237, 169, 9, 12, 219, 59, 240, 20, 157, 7, 220, 23, 127, 208, 205, 111,
-    188, 191, 60, 133, 211, 164, 6, 108, 230, 198, 135, 55, 122, 242, 127, 97, 20, 33, 164, 249, 73, 244, 124, 193, 238,
-    182, 229, 39, 225, 0, 179, 126, 108, 130, 92, 138, 186, 79, 39, 211, 119, 85, 74, 199, 133, 57, 233, 151, 215, 32,
-    3, 250, 157, 235, 195, 61, 228, 185, 211, 58, 249, 252, 194, 82, 40, 113, 217, 183, 12, 139, 3, 8, 7, 226, 114, 120,
-    241, 38, 248, 127, 87, 172, 40, 122, 80, 58, 233, 62, 26, 179, 15, 86, 51, 232, 87, 228, 178, 25, 43, 190, 37, 248,
-    110, 136, 194, 4, 6, 77, 84, 225, 246, 61, 133, 158, 69, 110, 158, 161, 214, 210, 145, 10, 121, 218, 81, 40, 60,
-    234, 119, 155, 105, 99, 225, 0, 112, 123, 109, 149, 212, 216, 127, 40, 52, 123, 32, 237, 196, 188, 181, 214, 194,
-    21, 251, 217, 46, 12, 44, 93, 11, 183, 128, 107, 207, 41, 37, 94, 44, 167, 252, 28, 177, 143, 184, 37, 162, 208,
-    155, 241, 222, 236, 180, 242, 247, 9, 52, 24, 109, 30, 33, 212, 197, 91, 198, 255, 22, 169, 168, 238, 60, 178, 43,
-    76, 135, 134, 47, 89, 43, 40, 207, 140, 92, 52, 221, 96, 200, 207, 67, 212, 186, 97, 36, 51, 3, 250, 185, 124, 214,
-    180, 254, 59, 201, 231, 62, 35, 80, 170, 16, 211, 60, 24, 245, 214, 151, 99, 168, 249, 72, 190, 166, 15, 227, 74,
-    63, 228, 41, 204, 182, 223, 225, 110, 200, 46, 206, 168, 60, 188, 101, 186, 111, 214, 105, 250, 21, 175, 104, 54,
-    44, 214, 126, 208, 134, 47, 115, 212, 120, 2, 21, 3, 147, 232, 245, 183, 105, 212, 142, 87, 0, 146, 46, 171, 51,
-    124, 175, 148, 165, 67, 76, 5, 56, 73, 222, 80, 128, 49, 20, 149, 122, 32, 221, 157, 82, 140, 81, 172, 83, 80, 35,
-    240, 234, 29, 135, 210, 80, 254, 246, 71, 98, 243, 174, 246, 135, 197, 109, 63, 107, 226, 36, 121, 104, 19, 26, 149,
-    221, 201, 11, 103, 219, 109, 11, 74, 250, 25, 89, 32, 255, 127, 174, 178, 133, 152, 178, 1, 77, 64, 13, 67, 57, 77,
-    160, 109, 219, 86, 222, 242, 113, 69, 237, 251, 184, 21, 23, 116, 135, 128, 246, 28, 246, 16, 183, 8, 220, 90, 123,
-    202, 241, 47, 206, 27, 236, 248, 27, 82, 106, 8, 252, 145, 7, 132, 159, 60, 179, 161, 37, 178, 3, 193, 66, 186, 47,
-    245, 244, 10, 178, 7, 47, 160, 88, 108, 95, 185, 107, 51, 211, 15, 133, 104, 140, 10, 70, 189, 59, 123, 79, 157,
-    114, 61, 235, 32, 140, 224, 74, 34, 156, 201, 237, 9, 98, 240, 48, 185, 69, 147, 236, 44, 146, 245, 29, 118, 9, 101,
-    234, 117, 183, 187, 50, 66, 126, 100, 197, 141, 232, 94, 161, 46, 208, 234, 147, 32, 39, 33, 41, 178, 207, 42, 241,
-    41, 240, 155, 58, 15, 102, 28, 183, 47, 169, 41, 176, 104, 184, 66, 90, 132, 225, 117, 52, 241, 20, 190, 145, 43,
-    249, 186, 98, 6, 167, 108, 32, 174, 77, 72, 240, 94, 3, 183, 189, 133, 203, 219, 125, 156, 69, 6, 53, 184, 0, 250,
-    51, 230, 31, 71, 100, 255, 72, 18, 18, 186, 209, 40, 52, 244, 148, 155, 194, 152, 87, 63, 87, 148, 82, 212, 231,
-    180, 223, 242, 243, 148, 121, 132, 24, 162, 144, 234, 227, 117, 230, 100, 40, 169, 208, 80, 244, 129, 207, 6, 251,
-    58, 98, 211, 206, 166, 137, 207, 8, 169, 205, 139, 66, 224, 61, 51, 12, 59, 142, 227, 58, 16, 95, 185, 234, 180, 94,
-    212, 185, 59, 96, 194, 248, 233, 81, 54, 93, 146, 56, 219, 20, 133, 10, 192, 22, 67, 86, 17, 85, 137, 48, 195, 107,
-    125, 232, 158, 160, 193, 90, 227, 89, 35, 115, 115, 3, 156, 88, 125, 207, 21, 175, 218, 13, 224, 105, 152, 252, 65,
-    84, 208, 246, 250, 112, 18, 75, 72, 103, 244, 141, 46, 219, 129, 73, 188, 33, 8, 69, 230, 44, 160, 103, 123, 163,
-    51, 41, 91, 34, 114, 160, 94, 51, 186, 70, 238, 120, 166, 109, 95, 242, 52, 176, 69, 126, 55, 110, 180, 104, 107,
-    63, 170, 166, 34, 30, 231, 187, 69, 182, 251, 12, 73, 129, 122, 180, 61, 221, 142, 76, 182, 130, 24, 135, 224, 35,
-    180, 56, 49, 76, 242, 14, 253, 245, 68, 165, 7, 228, 130, 223, 248, 51, 79, 84, 25, 230, 97, 120, 18, 141, 74, 143,
-    42, 36, 153, 237, 20, 114, 111, 159, 72, 28, 235, 122, 199, 191, 122, 25, 151, 74, 56, 18, 136, 244, 191, 116, 226,
-    167, 150, 163, 210, 142, 107, 200, 65, 152, 54, 148, 224, 61, 7, 159, 32, 243, 215, 110, 31, 75, 141, 204, 243, 89,
-    86, 52, 104, 223, 44, 199, 55, 61, 237, 229, 28, 228, 142, 145, 22, 198, 252, 139, 186, 35, 111, 80, 98, 223, 228,
-    248, 49, 9, 174, 112, 2, 138, 147, 41, 59, 0, 221, 198, 124, 168, 190, 148, 59, 232, 176, 66, 129, 64, 180, 167, 73,
-    42, 191, 101, 213, 150, 189, 87, 0, 199, 76, 141, 48, 27, 96, 57, 172, 208, 254, 255, 213, 192, 98, 174, 21, 142,
-    172, 140, 244, 253, 106, 58, 64, 99, 241, 50, 188, 21, 110, 124, 97, 81, 10, 243, 4, 194, 124, 187, 127, 7, 11, 223,
-    122, 25, 177, 70, 68, 229, 209, 29, 96, 230, 80, 29, 209, 163, 167, 175, 183, 79, 84, 170, 178, 200, 175, 150, 181,
-    192, 136, 25, 22, 14, 93, 175, 225, 35, 5, 236, 110, 165, 76, 28, 86, 218, 236, 3, 37, 209, 228, 20, 19, 5, 165,
-    190, 76, 55, 27, 86, 243, 42, 80, 127, 236, 18, 207, 255, 35, 255, 102, 194, 184, 67, 169, 171, 115, 84, 216, 47,
-    60, 107, 94, 31, 77, 210, 62, 26, 68, 155, 145, 172, 161, 123, 105, 26, 172, 53, 187, 110, 109, 112, 249, 171, 73,
-    118, 51, 51, 73, 56, 182, 64, 152, 235, 203, 65, 102, 126, 12, 199, 175, 186, 80, 162, 75, 215, 76, 208, 18, 177,
-    223, 40, 228, 224, 104, 129, 214, 87, 81, 168, 211, 4, 71, 76, 60, 158, 231, 117, 42, 121, 176, 245, 235, 166, 174,
-    12, 115, 39, 84, 110, 108, 83, 253, 142, 187, 104, 235, 253, 224, 39, 101, 65, 239, 254, 15, 127, 144, 197, 102,
-    214, 49, 34, 142, 23, 52, 15, 70, 85, 39, 230, 167, 72, 245, 188, 241, 19, 87, 102, 14, 88, 193, 119, 226, 140, 88,
-    160, 169, 160, 172, 164, 37, 216, 227, 146, 161, 162, 238, 132, 253, 210, 201, 143, 177, 80, 116, 89, 60, 86, 181,
-    159, 39, 141, 7, 89, 36, 102, 95, 139, 110, 69, 131, 90, 165, 189, 36, 50, 85, 198, 80, 63, 122, 212, 243, 216, 22,
-    81, 235, 50, 198, 171, 80, 122, 134, 6, 159, 41, 133, 98, 25, 175, 127, 6, 248, 234, 197, 110, 208, 7, 146, 195,
-    203, 28, 99, 224, 115, 80, 118, 44, 186, 151, 197, 121, 194, 92, 149, 133, 66, 55, 222, 33, 85, 180, 144, 182, 162,
-    246, 181, 66, 112, 138, 123, 2, 134, 177, 74, 93, 42, 167, 130, 78, 81, 248, 74, 30, 242, 147, 187, 3, 44, 105, 37,
-    144, 185, 211, 54, 182, 202, 153, 81, 63, 196, 177, 176, 211, 126, 197, 147, 242, 114, 215, 62, 24, 223, 147, 192,
-    254, 71, 153, 250, 223, 224, 142, 0, 235, 147, 108, 218, 159, 64, 196, 137, 139, 176, 8, 9, 177, 77, 151, 28, 102,
-    206, 17, 137, 118, 45, 74, 255, 177, 33, 214, 245, 77, 106, 218, 118, 109, 36, 115, 95, 88, 24, 249, 205, 88, 107,
-    72, 197, 236, 173, 215, 19, 195, 172, 169, 35, 188, 5, 50, 4, 187, 105, 101, 177, 245, 207, 180, 144, 46, 225, 146,
-    118, 202, 159, 219, 89, 158, 226, 206, 241, 11, 83, 155, 60, 225, 177, 4, 15, 91, 162, 91, 135, 156, 102, 107, 115,
-    10, 215, 209, 36, 208, 227, 117, 108, 158, 27, 245, 142, 93, 19, 103, 222, 72, 29, 182, 97, 136, 80, 218, 147, 7,
-    80, 66, 117, 209, 26, 12, 15, 172, 121, 1, 142, 71, 141, 176, 126, 17, 1, 149, 207, 71, 89, 34, 157, 8, 90, 15, 103,
-    138, 106, 201, 153, 165, 50, 153, 208, 182, 114, 119, 248, 22, 0, 35, 124, 63, 91, 118, 62, 214, 77, 160, 198, 96,
-    34, 2, 238, 186, 171, 68, 53, 115, 105, 129, 236, 224, 52, 161, 2, 131, 51, 214, 4, 102, 94, 139, 232, 231, 115,
-    226, 226, 186, 92, 188, 153, 139, 242, 99, 255, 97, 95, 75, 180, 96, 218, 241, 145, 4, 129, 35, 62, 19, 151, 61, 14,
-    11, 170, 14, 73, 90, 118, 247, 95, 101, 21, 141, 246, 188, 255, 133, 141, 43, 73, 254, 205, 209, 154, 215, 231, 9,
-    224, 58, 213, 125, 52, 196, 87, 142, 240, 92, 48, 27, 168, 43, 86, 150, 234, 46, 197, 190, 201, 100, 132, 205, 26,
-    198, 94, 56, 125, 142, 174, 131, 80, 243, 221, 163, 103, 203, 39, 164, 173, 251, 69, 31, 112, 152, 167, 174, 130,
-    173, 52, 98, 151, 200, 64, 20, 219, 186, 124, 198, 158, 46, 198, 39, 120, 186, 165, 218, 69, 14, 149, 164, 167, 167,
-    42, 205, 96, 189, 198, 99, 221, 125, 230, 0, 211, 169, 79, 8, 231, 59, 137, 221, 211, 14, 116, 227, 183, 202, 153,
-    225, 11, 1, 234, 160, 153, 133, 223, 230, 219, 250, 18, 94, 57, 56, 206, 170, 87, 250, 227, 111, 19, 164, 206, 194,
-    194, 25, 34, 69, 217, 1, 4, 254, 80, 119, 188, 23, 225, 0, 112, 41, 183, 51, 234, 178, 37, 149, 242, 79, 252, 173,
-    173, 234, 119, 139, 61, 122, 177, 133, 207, 130, 254, 98, 194, 186, 224, 244, 23, 182, 123, 204, 181, 6, 194, 178,
-    180, 214, 157, 128, 96, 233, 111, 218, 206, 188, 148, 228, 64, 175, 234, 255, 2, 48, 241, 197, 228, 66, 97, 57, 110,
-    166, 173, 88, 223, 134, 55, 28, 217, 55, 174, 31, 193, 65, 159, 235, 97, 208, 213, 50, 234, 117, 202, 134, 150, 51,
-    177, 223, 214, 79, 177, 155, 119, 65, 87, 137, 111, 17, 2, 97, 78, 51, 52, 44, 141, 139, 206, 65, 64, 247, 65, 12,
-    146, 135, 161, 42, 161, 136, 62, 193, 252, 212, 163, 42, 139, 71, 26, 97, 217, 153, 118, 61, 53, 149, 136, 192, 50,
-    166, 10, 197, 5, 194, 231, 235, 216, 139, 9, 57, 143, 227, 146, 233, 87, 179, 87, 133, 249, 46, 91, 41, 100, 69,
-    253, 96, 125, 131, 185, 109, 59, 5, 91, 250, 196, 251, 105, 87, 29, 46, 240, 39, 54, 122, 220, 190, 51, 204, 199,
-    244, 210, 182, 91, 83, 99, 74, 68, 190, 115, 25, 98, 180, 122, 114, 183, 118, 239, 16, 180, 100, 122, 93, 92, 167,
-    228, 93, 161, 18, 203, 18, 140, 126, 35, 180, 53, 169, 185, 153, 246, 100, 44, 33, 78, 176, 23, 232, 6, 220, 16, 22,
-    174, 124, 180, 154, 40, 33, 171, 228, 150, 164, 31, 60, 93, 23, 253, 67, 200, 162, 30, 75, 58, 234, 169, 243, 200,
-    43, 180, 40, 43, 117, 155, 228, 250, 241, 21, 70, 204, 81, 141, 98, 26, 121, 146, 249, 111, 203, 58, 2, 84, 189, 20,
-    12, 139, 95, 163, 37, 87, 119, 183, 25, 219, 97, 53, 245, 66, 223, 188, 201, 252, 186, 77, 177, 59, 212, 67, 173, 6,
-    146, 222, 31, 53, 180, 54, 107, 229, 21, 199, 149, 27, 189, 160, 229, 131, 31, 217, 29, 174, 138, 74, 39, 226, 197,
-    116, 149, 233, 29, 110, 140, 238, 151, 177, 206, 17, 182, 193, 201, 111, 106, 145, 36, 81, 142, 64, 151, 113, 139,
-    31, 127, 53, 19, 38, 207, 56, 43, 53, 187, 98, 237, 243, 68, 196, 138, 103, 111, 144, 224, 195, 201, 225, 184, 32,
-    222, 174, 222, 75, 221, 209, 228, 105, 70, 39, 242, 43, 243, 166, 149, 116, 148, 134, 18, 45, 235, 109, 25, 247,
-    183, 11, 138, 12, 146, 179, 158, 200, 36, 8, 80, 174, 51, 253, 44, 26, 234, 137, 221, 52, 109, 40, 199, 163, 158,
-    232, 210, 196, 9, 192, 70, 42, 220, 42, 0, 160, 159, 3, 231, 238, 33, 11, 205, 177, 193, 180, 204, 134, 15, 60, 132,
-    187, 121, 60, 245, 106, 101, 10, 80, 160, 32, 35, 236, 9, 80, 89, 130, 237, 203, 166, 233, 172, 93, 113, 43, 252,
-    18, 153, 84, 187, 108, 162, 217, 167, 32, 101, 29, 205, 97, 220, 83, 53, 117, 73, 180, 56, 51, 74, 3, 190, 7, 231,
-    183, 201, 171, 139, 81, 56, 189, 115, 231, 13, 62, 224, 160, 105, 204, 4, 162, 138, 34, 44, 60, 30, 38, 63, 72, 135,
-    65, 25, 158, 133, 230, 190, 240, 83, 119, 89, 1, 53, 223, 172, 65, 209, 116, 243, 228, 61, 245, 163, 99, 113, 107,
-    76, 19, 74, 77, 149, 90, 16, 119, 222, 97, 51, 42, 125, 166, 154, 142, 4, 105, 236, 152, 117, 74, 116, 67, 142, 31,
-    90, 41, 149, 98, 95, 41, 15, 79, 252, 248, 200, 35, 180, 7, 174, 38, 229, 83, 25, 176, 124, 215, 51, 33, 192, 124,
-    70, 165, 125, 136, 248, 154, 188, 6, 141, 151, 93, 225, 150, 129, 43, 140, 252, 103, 3, 151, 155, 201, 150, 191,
-    228, 168, 182, 234, 239, 46, 41, 122, 226, 53, 227, 32, 110, 107, 196, 255, 135, 249, 195, 172, 13, 76, 178, 63,
-    224, 59, 255, 105, 33, 26, 119, 198, 230, 208, 235, 51, 10, 40, 49, 97, 255, 37, 160, 138, 113, 157, 67, 241, 70,
-    234, 32, 254, 69, 191, 67, 183, 128, 100, 98, 169, 64, 63, 25, 22, 37, 89, 193, 58, 65, 126, 61, 192, 145, 48, 163,
-    31, 148, 190, 186, 97, 22, 94, 138, 51, 149, 177, 23, 242, 192, 192, 26, 12, 163, 126, 111, 136, 73, 60, 34, 0, 195,
-    167, 205, 34, 248, 130, 76, 66, 20, 13, 24, 81, 226, 147, 168, 120, 230, 74, 253, 135, 235, 254, 31, 68, 128, 19,
-    11, 172, 198, 10, 149, 1, 200, 190, 2, 149, 5, 123, 238, 111, 9, 59, 174, 112, 252, 202, 132, 194, 72, 255, 43, 180,
-    37, 127, 4, 227, 13, 237, 128, 83, 187, 236, 176, 200, 240, 154, 91, 174, 221, 222, 23, 154, 61, 97, 8, 0, 70, 188,
-    133, 44, 173, 243, 149, 147, 226, 133, 248, 81, 139, 130, 161, 218, 240, 169, 193, 5, 217, 82, 117, 230, 227, 41,
-    47, 95, 123, 121, 142, 63, 136, 43, 19, 72, 149, 168, 158, 169, 246, 35, 41, 3, 14, 21, 156, 39, 23, 151, 188, 112,
-    155, 43, 134, 193, 91, 222, 78, 241, 228, 168, 82, 224, 40, 42, 119, 201, 134, 251, 40, 105, 193, 114, 45, 253, 44,
-    180, 3, 10, 180, 240, 236, 156, 161, 0, 57, 251, 19, 196, 8, 25, 183, 142, 64, 31, 65, 200, 179, 244, 44, 185, 124,
-    246, 81, 103, 71, 236, 122, 67, 42, 163, 224, 194, 43, 118, 61, 252, 162, 194, 252, 83, 142, 246, 173, 14, 48, 24,
-    228, 239, 181, 35, 172, 7, 90, 248, 171, 49, 233, 244, 213, 153, 19, 115, 3, 237, 167, 106, 156, 115, 213, 242, 60,
-    37, 252, 93, 3, 181, 201, 30, 76, 2, 109, 79, 76, 199, 127, 203, 190, 174, 147, 41, 164, 200, 83, 122, 38, 61, 95,
-    32, 190, 176, 144, 46, 94, 90, 37, 113, 248, 212, 183, 209, 93, 89, 150, 246, 134, 117, 140, 44, 247, 170, 67, 72,
-    79, 193, 204, 160, 173, 62, 50, 238, 209, 233, 88, 117, 59, 132, 59, 223, 87, 95, 79, 190, 228, 221, 51, 200, 173,
-    71, 250, 47, 23, 190, 228, 165, 127, 165, 39, 195, 241, 231, 116, 100, 112, 74, 49, 225, 252, 99, 33, 121, 50, 132,
-    209, 16, 143, 92, 159, 36, 156, 237, 125, 82, 167, 238, 37, 118, 237, 27, 208, 237, 31, 6, 23, 23, 237, 119, 132,
-    113, 66, 117, 235, 148, 37, 223, 87, 94, 77, 35, 151, 45, 32, 81, 81, 237, 65, 248, 159, 139, 165, 118, 224, 7, 31,
-    45, 134, 83, 15, 35, 165, 131, 107, 58, 247, 86, 248, 52, 227, 137, 244, 153, 182, 86, 151, 130, 99, 81, 13, 172,
-    230, 87, 125, 214, 209, 142, 41, 118, 64, 30, 192, 190, 80, 70, 14, 17, 79, 247, 3, 218, 101, 118, 152, 164, 97,
-    191, 208, 115, 179, 60, 224, 162, 4, 122, 141, 95, 146, 81, 26, 129, 40, 134, 130, 236, 36, 80, 100, 90, 89, 243,
-    125, 230, 22, 209, 155, 252, 180, 198, 34, 255, 164, 197, 56, 200, 89, 66, 54, 83, 210, 7, 119, 188, 236, 10, 216,
-    42, 92, 66, 6, 161, 17, 244, 70, 86, 68, 210, 182, 56, 19, 101, 235, 50, 15, 98, 131, 105, 129, 40, 134, 46, 61,
-    144, 85, 227, 243, 179, 161, 8, 95, 164, 197, 23, 199, 183, 195, 88, 177, 20, 219, 250, 127, 72, 92, 226, 205, 148,
-    49, 139, 123, 137, 164, 29, 87, 10, 132, 224, 8, 119, 45, 168, 201, 118, 183, 49, 111, 51, 123, 170, 232, 36, 53,
-    51, 141, 221, 208, 244, 190, 90, 16, 135, 116, 224, 165, 228, 14, 21, 44, 251, 253, 149, 121, 141, 248, 109, 96,
-    136, 44, 173, 211, 137, 121, 84, 77, 5, 77, 171, 174, 82, 171, 78, 166, 187, 73, 115, 180, 97, 99, 122, 77, 38, 148,
-    229, 246, 240, 165, 160, 125, 224, 132, 101, 146, 203, 128, 238, 136, 133, 247, 89, 213, 216, 216, 9, 196, 139, 74,
-    196, 103, 246, 170, 48, 241, 248, 34, 112, 36, 190, 118, 52, 54, 85, 121, 27, 11, 204, 16, 150, 206, 201, 125, 114,
-    65, 172, 112, 211, 189, 121, 235, 227, 158, 137, 8, 28, 14, 233, 6, 184, 38, 138, 163, 170, 205, 202, 211, 245, 18,
-    43, 185, 56, 251, 4, 233, 47, 23, 183, 127, 77, 137, 248, 133, 63, 113, 210, 222, 24, 218, 45, 139, 87, 245, 157,
-    230, 189, 143, 57, 252, 192, 28, 175, 235, 5, 45, 65, 105, 9, 35, 17, 143, 153, 119, 11, 78, 198, 118, 215, 249,
-    123, 176, 152, 7, 95, 223, 252, 216, 174, 203, 134, 95, 159, 201, 194, 168, 229, 227, 89, 46, 115, 135, 170, 144,
-    224, 253, 27, 173, 99, 136, 253, 156, 130, 195, 143, 193, 159, 12, 192, 214, 178, 243, 102, 85, 35, 90, 164, 192,
-    76, 17, 59, 83, 43, 112, 118, 220, 64, 84, 180, 50, 33, 176, 11, 226, 217, 215, 19, 197, 184, 153, 173, 172, 183,
-    93, 107, 199, 128, 25, 167, 242, 243, 69, 234, 234, 192, 203, 246, 169, 178, 110, 96, 4, 97, 175, 179, 222, 152, 93,
-    199, 187, 225, 83, 125, 218, 127, 197, 47, 39, 131, 255, 229, 222, 89, 26, 91, 151, 245, 30, 114, 48, 83, 153, 138,
-    165, 85, 70, 154, 137, 62, 0, 106, 192, 104, 47, 30, 3, 249, 116, 203, 184, 49, 59, 236, 15, 190, 21, 154, 131, 232,
-    251, 27, 58, 61, 98, 27, 21, 54, 27, 173, 31, 111, 63, 50, 140, 142, 2, 0, 48, 249, 159, 71, 43, 246, 220, 59, 248,
-    53, 158, 170, 120, 136, 237, 116, 47, 224, 176, 140, 201, 252, 47, 2, 36, 233, 2, 23, 131, 46, 43, 164, 190, 61, 73,
-    116, 67, 29, 72, 54, 40, 87, 244, 141, 168, 70, 80, 26, 221, 68, 149, 60, 114, 216, 80, 30, 75, 38, 55, 177, 185,
-    156, 115, 26, 198, 81, 145, 11, 164, 196, 187, 52, 113, 205, 191, 52, 58, 51, 100, 30, 16, 142, 114, 181, 4, 207,
-    155, 11, 164, 28, 153, 151, 250, 218, 153, 79, 242, 66, 248, 68, 218, 65, 167, 73, 155, 134, 9, 1, 208, 234, 250,
-    137, 244, 177, 167, 150, 87, 40, 4, 220, 245, 105, 15, 194, 192, 193, 90, 242, 30, 86, 245, 164, 48, 236, 183, 126,
-    84, 176, 3, 152, 89, 220, 251, 125, 40, 56, 218, 108, 199, 240, 193, 185, 13, 81, 60, 127, 35, 95, 230, 169, 2, 234,
-    152, 86, 25, 218, 201, 14, 77, 117, 36, 76, 237, 18, 106, 187, 5, 247, 230, 14, 48, 87, 200, 83, 237, 127, 42, 203,
-    213, 111, 142, 114, 149, 63, 176, 34, 111, 122, 70, 156, 132, 166, 120, 217, 100, 90, 234, 237, 247, 73, 107, 235,
-    205, 183, 95, 133, 77, 236, 1, 245, 107, 245, 149, 166, 1, 120, 114, 226, 73, 40, 6, 56, 163, 188, 160, 94, 122,
-    147, 74, 226, 251, 119, 195, 3, 160, 215, 129, 199, 99, 191, 35, 244, 37, 135, 50, 201, 199, 237, 128, 84, 20, 177,
-    201, 98, 156, 226, 39, 80, 224, 78, 155, 7, 0, 114, 50, 51, 1, 156, 174, 162, 55, 179, 41, 200, 194, 131, 49, 214,
-    199, 139, 252, 159, 189, 69, 223, 197, 188, 61, 137, 1, 67, 135, 2, 226, 172, 75, 21, 110, 54, 24, 247, 83, 75, 190,
-    103, 110, 204, 234, 43, 241, 148, 237, 173, 101, 96, 153, 217, 125, 182, 7, 31, 13, 33, 194, 240, 163, 196, 222, 16,
-    239, 178, 119, 197, 31, 203, 131, 179, 182, 51, 201, 64, 120, 243, 131, 228, 108, 235, 139, 89, 108, 117, 114, 57,
-    129, 213, 170, 46, 88, 228, 92, 80, 81, 254, 95, 233, 3, 53, 214, 143, 160, 208, 197, 160, 134, 179, 48, 5, 9, 141,
-    34, 171, 213, 134, 71, 232, 158, 206, 154, 110, 252, 128, 118, 216, 16, 133, 166, 139, 184, 224, 224, 237, 168, 108,
-    52, 44, 19, 192, 60, 124, 94, 156, 1, 172, 72, 101, 178, 39, 1, 73, 70, 178, 138, 137, 179, 202, 118, 62, 124, 17,
-    194, 164, 162, 17, 73, 174, 251, 89, 102, 126, 134, 121, 28, 131, 124, 86, 133, 119, 148, 253, 67, 171, 66, 1, 50,
-    139, 253, 196, 124, 23, 142, 137, 103, 164, 26, 21, 166, 134, 95, 106, 74, 23, 76, 179, 26, 27, 194, 214, 156, 216,
-    114, 46, 38, 173, 86, 129, 83, 136, 120, 123, 241, 240, 164, 100, 2, 130, 226, 157, 26, 240, 64, 50, 54, 77, 59, 21,
-    118, 212, 175, 190, 31, 16, 132, 210, 126, 151, 114, 168, 88, 150, 157, 207, 215, 103, 254, 18, 214, 131, 73, 187,
-    14, 252, 72, 161, 43, 222, 237, 170, 138, 172, 115, 191, 15, 221, 242, 101, 177, 234, 104, 153, 25, 162, 242, 86,
-    163, 43, 238, 191, 107, 2, 249, 32, 55, 119, 174, 43, 188, 233, 144, 97, 52, 181, 240, 219, 33, 112, 154, 119, 35,
-    97, 130, 203, 221, 4, 169, 158, 202, 178, 68, 214, 53, 62, 139, 66, 243, 140, 226, 47, 254, 253, 214, 130, 190, 215,
-    105, 210, 215, 144, 34, 106, 239, 8, 208, 195, 41, 241, 36, 187, 24, 90, 226, 68, 151, 101, 229, 161, 85, 241, 254,
-    120, 12, 152, 56, 81, 205, 18, 53, 161, 107, 23, 14, 104, 175, 229, 223, 197, 139, 171, 246, 208, 18, 5, 118, 139,
-    65, 145, 241, 106, 47, 128, 4, 75, 41, 205, 60, 213, 249, 46, 253, 38, 130, 192, 16, 152, 93, 61, 224, 175, 110,
-    146, 105, 205, 200, 152, 82, 79, 21, 5, 139, 213, 203, 180, 106, 145, 159, 19, 241, 9, 0, 23, 130, 144, 142, 23,
-    175, 171, 236, 172, 242, 125, 128, 4, 76, 134, 50, 16, 209, 205, 243, 94, 91, 68, 118, 10, 126, 203, 242, 27, 171,
-    46, 55, 212, 222, 98, 147, 94, 18, 231, 168, 191, 134, 33, 39, 84, 172, 62, 52, 170, 76, 63, 80, 145, 128, 57, 33,
-    158, 248, 29, 251, 232, 57, 45, 221, 88, 97, 236, 110, 113, 222, 158, 157, 94, 56, 182, 150, 82, 37, 95, 136, 101,
-    168, 52, 18, 169, 223, 219, 149, 103, 1, 17, 10, 24, 41, 58, 28, 187, 34, 122, 18, 248, 39, 23, 252, 10, 80, 176,
-    104, 17, 189, 68, 141, 103, 86, 10, 100, 10, 27, 64, 222, 93, 213, 126, 134, 208, 60, 119, 71, 47, 209, 215, 20,
-    205, 150, 229, 200, 189, 144, 7, 118, 166, 36, 95, 216, 228, 116, 196, 145, 250, 11, 199, 133, 254, 17, 109, 202, 2,
-    118, 31, 233, 132, 47, 105, 148, 156, 208, 95, 13, 118, 202, 24, 221, 184, 224, 192, 72, 239, 23, 187, 72, 254, 9,
-    204, 129, 244, 198, 77, 137, 77, 142, 11, 205, 92, 96, 186, 238, 92, 133, 144, 232, 0, 30, 28, 249, 39, 118, 157,
-    26, 106, 236, 197, 224, 176, 116, 60, 139, 145, 237, 150, 101, 24, 27, 242, 29, 50, 153, 216, 17, 203, 90, 25, 5,
-    55, 162, 56, 38, 46, 38, 165, 83, 251, 168, 190, 100, 16, 123, 188, 15, 212, 69, 172, 150, 78, 112, 247, 80, 6, 237,
-    62, 222, 87, 102, 186, 153, 146, 228, 3, 164, 144, 202, 17, 253, 173, 14, 205, 252, 134, 250, 149, 181, 112, 225,
-    150, 150, 185, 183, 69, 97, 190, 249, 152, 165, 209, 232, 116, 180, 23, 155, 88, 34, 69, 27, 157, 133, 205, 59, 32,
-    60, 176, 249, 102, 67, 217, 230, 194, 203, 218, 148, 6, 17, 60, 162, 54, 19, 29, 117, 254, 108, 36, 193, 46, 182,
-    194, 18, 152, 190, 34, 41, 95, 32, 212, 76, 181, 255, 23, 20, 174, 208, 33, 28, 59, 98, 143, 206, 37, 101, 6, 227,
-    241, 118, 228, 58, 208, 197, 29, 68, 110, 88, 143, 253, 226, 23, 212, 191, 75, 204, 136, 162, 126, 58, 231, 168, 57,
-    163, 115, 190, 37, 77, 76, 221, 101, 165, 20, 31, 143, 152, 227, 29, 40, 248, 214, 5, 232, 196, 13, 94, 39, 54, 221,
-    78, 121, 109, 205, 129, 118, 124, 216, 131, 159, 226, 197, 155, 205, 46, 158, 220, 165, 248, 0, 125, 122, 255, 58,
-    144, 96, 203, 128, 168, 106, 80, 1, 32, 142, 176, 125, 135, 138, 237, 95, 129, 244, 59, 157, 118, 248, 210, 139, 56,
-    221, 105, 14, 49, 5, 80, 42, 82, 35, 218, 65, 23, 251, 158, 35, 221, 69, 126, 250, 158, 127, 42, 219, 215, 194, 213,
-    28, 158, 170, 87, 169, 65, 64, 168, 95, 52, 28, 159, 24, 201, 105, 224, 207, 213, 254, 11, 230, 10, 103, 119, 193,
-    217, 3, 109, 15, 112, 189, 111, 236, 204, 142, 211, 79, 50, 32, 204, 175, 20, 58, 199, 218, 98, 168, 1, 134, 44, 3,
-    111, 219, 88, 210, 185, 181, 8, 178, 193, 25, 152, 54, 156, 119, 176, 96, 42, 40, 205, 240, 48, 204, 254, 198, 187,
-    168, 64, 91, 60, 32, 60, 250, 193, 171, 74, 151, 135, 27, 9, 230, 86, 34, 92, 50, 203, 51, 131, 38, 160, 221, 133,
-    158, 209, 216, 229, 143, 82, 38, 23, 41, 231, 169, 60, 109, 243, 141, 91, 41, 89, 15, 58, 147, 18, 127, 26, 179, 74,
-    128, 121, 205, 184, 251, 182, 209, 197, 192, 1, 108, 76, 44, 255, 236, 164, 62, 78, 159, 216, 162, 190, 107, 48,
-    255, 32, 116, 217, 53, 69, 22, 194, 121, 3, 51, 54, 83, 59, 70, 136, 10, 12, 169, 134, 79, 226, 114, 159, 76, 28,
-    95, 64, 102, 27, 156, 20, 13, 98, 103, 188, 243, 45, 227, 94, 122, 156, 76, 112, 207, 57, 99, 224, 108, 167, 131,
-    192, 214, 245, 101, 5, 72, 89, 5, 230, 231, 34, 176, 97, 124, 100, 251, 169, 133, 23, 217, 80, 208, 14, 28, 133,
-    174, 180, 55, 114, 218, 75, 19, 43, 243, 143, 193, 181, 137, 39, 75, 152, 97, 156, 163, 155, 84, 151, 26, 199, 202,
-    84, 211, 98, 178, 206, 177, 138, 142, 97, 144, 240, 115, 201, 238, 222, 34, 8, 182, 31, 64, 124, 185, 171, 202, 42,
-    126, 13, 233, 112, 19, 165, 248, 9, 106, 81, 74, 186, 45, 106, 77, 125, 11, 210, 238, 11, 255, 49, 234, 66, 39, 184,
-    177, 146, 153, 29, 205, 249, 221, 80, 176, 150, 246, 152, 38, 171, 55, 131, 147, 173, 48, 228, 8, 150, 152, 183,
-    128, 84, 204, 183, 184, 148, 142, 216, 219, 27, 101, 35, 170, 201, 41, 137, 79, 250, 147, 73, 13, 134, 230, 199, 84,
-    177, 201, 62, 98, 193, 155, 86, 149, 153, 37, 109, 55, 214, 28, 234, 106, 62, 194, 161, 56, 214, 60, 86, 240, 50,
-    183, 48, 14, 92, 157, 218, 206, 0, 210, 252, 95, 96, 46, 100, 235, 90, 107, 239, 233, 126, 83, 239, 245, 178, 161,
-    78, 69, 97, 193, 17, 198, 20, 110, 14, 208, 139, 129, 213, 93, 33, 212, 138, 161, 27, 202, 26, 179, 85, 81, 191,
-    253, 222, 51, 33, 28, 240, 59, 255, 189, 163, 0, 144, 130, 170, 10, 160, 197, 37, 78, 45, 196, 156, 251, 9, 235, 18,
-    36, 78, 133, 51, 25, 105, 0, 94, 78, 25, 247, 48, 203, 123, 177, 107, 49, 99, 59, 177, 106, 9, 121, 76, 23, 239,
-    215, 49, 240, 82, 206, 90, 72, 52, 231, 45, 144, 236, 23, 228, 206, 67, 86, 99, 40, 45, 16, 4, 163, 239, 158, 90,
-    76, 76, 148, 232, 5, 58, 100, 215, 108, 158, 165, 15, 41, 78, 251, 73, 150, 9, 46, 27, 17, 195, 163, 122, 204, 120,
-    10, 237, 101, 242, 45, 4, 26, 184, 192, 35, 130, 34, 174, 45, 170, 43, 250, 79, 116, 95, 71, 169, 44, 55, 140, 255,
-    59, 6, 155, 120, 46, 242, 163, 225, 173, 22, 238, 253, 18, 235, 215, 59, 45, 135, 14, 63, 45, 193, 241, 46, 207,
-    158, 184, 254, 194, 198, 15, 59, 136, 111, 28, 57, 217, 151, 246, 228, 182, 185, 247, 190, 193, 169, 61, 188, 40,
-    113, 121, 38, 132, 140, 52, 231, 130, 237, 207, 152, 56, 30, 117, 170, 235, 151, 109, 209, 245, 57, 157, 169, 11,
-    230, 111, 135, 38, 41, 200, 209, 65, 51, 252, 10, 87, 183, 212, 121, 72, 17, 32, 62, 60, 253, 100, 126, 201, 8, 14,
-    64, 200, 235, 136, 249, 153, 213, 55, 18, 35, 81, 80, 199, 194, 240, 75, 93, 149, 68, 126, 146, 10, 143, 212, 67,
-    88, 236, 57, 206, 96, 149, 138, 5, 23, 230, 20, 194, 102, 14, 4, 246, 169, 78, 251, 22, 191, 210, 68, 77, 252, 249,
-    165, 161, 22, 215, 69, 110, 155, 166, 158, 170, 13, 35, 165, 7, 131, 15, 148, 255, 232, 44, 4, 172, 43, 168, 235,
-    62, 106, 169, 17, 174, 49, 109, 111, 237, 194, 44, 243, 92, 196, 158, 46, 222, 227, 250, 184, 9, 114, 76, 236, 24,
-    106, 55, 148, 68, 123, 118, 14, 33, 186, 253, 136, 154, 234, 115, 100, 7, 23, 255, 59, 86, 114, 252, 243, 192, 172,
-    48, 102, 251, 192, 108, 253, 6, 189, 87, 125, 23, 75, 215, 121, 158, 131, 68, 126, 3, 171, 97, 18, 36, 103, 253,
-    139, 112, 201, 125, 117, 218, 80, 26, 237, 74, 44, 104, 97, 62, 53, 178, 69, 82, 234, 46, 198, 71, 245, 250, 227,
-    54, 47, 23, 117, 125, 104, 12, 114, 121, 139, 88, 40, 105, 81, 77, 88, 6, 65, 161, 99, 33, 210, 53, 64, 226, 103,
-    112, 109, 189, 230, 103, 112, 233, 207, 221, 33, 67, 69, 168, 1, 48, 123, 204, 11, 103, 98, 45, 133, 48, 130, 41,
-    42, 231, 50, 104, 52, 204, 161, 22, 210, 217, 79, 155, 55, 43, 53, 14, 174, 140, 228, 123, 214, 134, 43, 184, 195,
-    151, 42, 113, 80, 94, 14, 173, 123, 188, 108, 231, 172, 185, 157, 9, 88, 117, 154, 227, 251, 87, 131, 89, 96, 151,
-    111, 120, 214, 32, 233, 232, 241, 51, 166, 143, 28, 249, 253, 132, 133, 93, 15, 123, 160, 11, 193, 151, 138, 16, 17,
-    239, 177, 167, 136, 235, 30, 187, 180, 139, 120, 240, 154, 84, 158, 7, 6, 67, 240, 245, 252, 182, 226, 154, 91, 46,
-    104, 15, 223, 191, 182, 220, 4, 126, 221, 243, 71, 146, 204, 138, 128, 243, 65, 193, 0, 226, 249, 110, 127, 55, 54,
-    170, 249, 209, 69, 103, 110, 47, 115, 21, 202, 133, 242, 203, 120, 88, 242, 81, 146, 119, 231, 83, 192, 7, 87, 7,
-    151, 58, 96, 255, 151, 133, 158, 199, 8, 203, 7, 11, 132, 78, 118, 0, 35, 195, 219, 226, 252, 179, 224, 143, 198,
-    230, 133, 59, 99, 195, 245, 84, 178, 116, 41, 33, 252, 112, 39, 64, 220, 187, 15, 64, 49, 164, 197, 121, 227, 167,
-    254, 198, 5, 11, 144, 145, 53, 79, 239, 158, 200, 230, 50, 119, 214, 156, 41, 34, 152, 5, 250, 78, 172, 221, 190,
-    23, 16, 21, 73, 235, 132, 194, 194, 234, 242, 238, 109, 68, 3, 29, 162, 195, 59, 159, 156, 57, 52, 185, 16, 183, 24,
-    237, 28, 61, 44, 39, 210, 252, 38, 59, 0, 105, 231, 67, 43, 85, 243, 246, 44, 66, 11, 58, 69, 157, 58, 63, 15, 21,
-    208, 214, 122, 122, 3, 224, 219, 244, 139, 199, 105, 33, 168, 168, 51, 229, 139, 22, 30, 108, 188, 36, 197, 71, 44,
-    20, 17, 149, 35, 232, 231, 134, 252, 7, 134, 54, 101, 187, 13, 124, 75, 211, 192, 18, 82, 62, 202, 94, 144, 111, 70,
-    239, 230, 94, 88, 178, 10, 190, 80, 100, 52, 160, 227, 152, 2, 216, 201, 69, 57, 186, 134, 85, 135, 50, 56, 136,
-    104, 77, 87, 216, 46, 93, 89, 63, 224, 6, 64, 8, 10, 216, 200, 207, 186, 2, 201, 37, 2, 209, 14, 8, 63, 63, 197,
-    250, 181, 95, 151, 6, 88, 85, 150, 3, 118, 86, 91, 210, 106, 251, 156, 60, 183, 188, 158, 191, 170, 145, 117, 235,
-    169, 177, 92, 50, 247, 225, 9, 8, 185, 45, 187, 229, 230, 153, 213, 111, 46, 78, 206, 46, 5, 236, 123, 242, 53, 226,
-    25, 0, 202, 13, 79, 112, 83, 200, 83, 168, 34, 197, 48, 34, 17, 157, 170, 78, 133, 210, 158, 99, 216, 106, 159, 182,
-    103, 43, 112, 239, 243, 70, 44, 158, 135, 19, 233, 199, 188, 142, 49, 69, 154, 49, 128, 77, 158, 37, 191, 22, 119,
-    7, 168, 156, 196, 85, 164, 209, 61, 169, 251, 161, 118, 124, 97, 205, 136, 121, 253, 27, 157, 48, 10, 56, 171, 18,
-    182, 158, 65, 39, 254, 210, 175, 233, 0, 215, 172, 204, 156, 192, 193, 249, 189, 50, 187, 201, 77, 56, 10, 224, 140,
-    210, 197, 10, 194, 27, 52, 210, 253, 34, 118, 164, 91, 161, 125, 4, 31, 234, 69, 255, 218, 166, 208, 197, 159, 19,
-    114, 45, 146, 193, 212, 205, 188, 59, 224, 206, 247, 129, 178, 249, 176, 1, 129, 187, 144, 124, 49, 89, 12, 40, 34,
-    66, 53, 171, 157, 119, 66, 249, 232, 231, 192, 112, 194, 46, 34, 230, 96, 250, 72, 200, 46, 217, 193, 18, 184, 59,
-    234, 245, 45, 140, 20, 18, 184, 97, 86, 128, 48, 103, 248, 186, 223, 90, 115, 140, 186, 99, 62, 91, 180, 65, 31, 21,
-    216, 145, 14, 217, 204, 122, 218, 175, 9, 219, 105, 142, 185, 136, 236, 197, 184, 47, 82, 106, 17, 247, 176, 6, 253,
-    79, 231, 42, 145, 48, 17, 245, 128, 70, 246, 9, 100, 27, 207, 72, 166, 77, 112, 211, 167, 213, 55, 241, 116, 159,
-    76, 34, 144, 191, 226, 195, 26, 29, 81, 233, 47, 23, 131, 229, 177, 239, 133, 49, 69, 146, 61, 137, 229, 98, 242,
-    154, 142, 38, 246, 109, 200, 195, 253, 63, 26, 209, 87, 89, 124, 48, 19, 52, 13, 172, 59, 247, 143, 53, 222, 235,
-    114, 20, 9, 241, 1, 191, 99, 143, 145, 254, 176, 94, 8, 168, 108, 122, 13, 238, 151, 252, 188, 194, 120, 87, 102, 8,
-    108, 132, 201, 166, 215, 29, 110, 49, 194, 231, 163, 244, 3, 145, 74, 199, 217, 93, 48, 55, 207, 75, 155, 224, 213,
-    66, 121, 81, 184, 129, 165, 78, 135, 185, 212, 202, 38, 166, 107, 0, 106, 232, 246, 91, 247, 141, 172, 164, 186,
-    171, 246, 84, 140, 33, 57, 33, 162, 227, 141, 62, 152, 3, 11, 14, 137, 65, 43, 63, 71, 97, 23, 164, 209, 179, 141,
-    192, 212, 41, 200, 101, 174, 118, 48, 200, 185, 244, 233, 61, 252, 90, 170, 143, 92, 9, 224, 30, 131, 227, 178, 41,
-    215, 12, 74, 96, 223, 41, 202, 54, 41, 161, 179, 59, 125, 29, 45, 155, 241, 207, 44, 142, 33, 115, 14, 51, 188, 113,
-    251, 251, 5, 34, 160, 191, 41, 109, 55, 202, 156, 118, 242, 157, 154, 113, 85, 130, 63, 148, 185, 113, 234, 86, 159,
-    17, 80, 214, 70, 136, 85, 244, 242, 75, 179, 50, 60, 198, 124, 168, 144, 46, 57, 55, 223, 181, 140, 13, 196, 89,
-    199, 83, 221, 155, 9, 177, 11, 168, 133, 158, 216, 227, 246, 25, 97, 202, 95, 94, 27, 49, 172, 193, 101, 207, 54,
-    193, 52, 39, 252, 75, 175, 23, 69, 14, 131, 128, 55, 163, 0, 123, 81, 173, 197, 166, 78, 80, 76, 132, 58, 91, 51,
-    239, 166, 177, 188, 133, 109, 84, 244, 226, 234, 101, 252, 174, 96, 87, 215, 96, 1, 201, 42, 199, 164, 244, 142, 14,
-    166, 227, 128, 76, 127, 102, 210, 223, 208, 138, 204, 151, 72, 52, 44, 223, 121, 105, 47, 49, 10, 96, 189, 114, 43,
-    153, 163, 252, 208, 64, 1, 78, 175, 22, 189, 82, 15, 45, 39, 135, 51, 43, 127, 155, 69, 80, 242, 205, 19, 218, 217,
-    254, 199, 126, 138, 255, 193, 168, 32, 124, 80, 151, 208, 203, 129, 208, 106, 1, 79, 140, 242, 184, 115, 111, 207,
-    52, 41, 45, 99, 111, 218, 91, 110, 79, 103, 177, 248, 168, 169, 30, 9, 125, 240, 208, 243, 145, 15, 37, 66, 45, 80,
-    101, 85, 217, 64, 215, 112, 63, 248, 10, 137, 88, 63, 121, 127, 126, 76, 14, 198, 216, 240, 155, 206, 220, 86, 32,
-    55, 11, 167, 177, 173, 34, 113, 118, 215, 139, 252, 231, 152, 97, 50, 177, 22, 162, 54, 191, 228, 178, 35, 198, 254,
-    173, 180, 207, 103, 48, 116, 46, 9, 167, 67, 22, 218, 98, 149, 153, 24, 88, 84, 170, 225, 26, 16, 16, 146, 61, 142,
-    197, 187, 196, 111, 227, 123, 218, 156, 82, 202, 19, 64, 212, 40, 216, 127, 206, 209, 9, 1, 139, 61, 101, 73, 206,
-    10, 156, 45, 194, 48, 201, 243, 172, 249, 233, 100, 216, 80, 52, 66, 89, 8, 222, 184, 90, 253, 126, 20, 189, 27,
-    195, 47, 67, 189, 74, 111, 169, 188, 217, 32, 179, 135, 39, 0, 122, 75, 210, 149, 55, 47, 62, 176, 115, 91, 235, 9,
-    104, 120, 93, 75, 21, 156, 245, 202, 108, 92, 65, 130, 249, 139, 243, 93, 81, 173, 202, 116, 202, 144, 205, 224,
-    237, 131, 27, 132, 150, 215, 78, 111, 1, 194, 60, 20, 89, 130, 120, 89, 52, 12, 198, 22, 229, 4, 120, 63, 164, 30,
-    41, 138, 214, 29, 73, 23, 110, 228, 208, 249, 77, 150, 15, 146, 253, 190, 79, 99, 220, 190, 236, 105, 28, 80, 248,
-    210, 105, 168, 27, 83, 169, 24, 41, 108, 158, 165, 238, 183, 163, 245, 54, 251, 122, 34, 237, 254, 44, 35, 152, 7,
-    97, 94, 122, 194, 176, 43, 162, 62, 170, 106, 16, 71, 209, 244, 197, 6, 25, 118, 171, 69, 139, 154, 235, 76, 154,
-    58, 184, 63, 201, 85, 210, 203, 193, 151, 102, 83, 77, 239, 230, 181, 254, 17, 5, 145, 203, 52, 31, 177, 154, 245,
-    195, 184, 36, 197, 166, 45, 139, 205, 143, 118, 167, 162, 246, 231, 35, 191, 254, 231, 51, 244, 99, 137, 11, 254,
-    102, 190, 42, 220, 137, 125, 84, 147, 100, 245, 225, 192, 98, 87, 58, 36, 73, 49, 185, 254, 124, 113, 221, 168, 218,
-    255, 206, 191, 209, 137, 142, 240, 193, 130, 105, 132, 154, 230, 116, 96, 92, 158, 218, 194, 187, 47, 154, 102, 186,
-    66, 22, 227, 252, 48, 46, 247, 170, 224, 142, 201, 175, 103, 192, 98, 140, 5, 171, 103, 4, 13, 47, 17, 104, 197,
-    165, 185, 217, 90, 187, 111, 81, 137, 248, 0, 103, 66, 230, 118, 73, 139, 228, 59, 18, 27, 28, 161, 236, 31, 196,
-    94, 159, 67, 49, 79, 166, 83, 164, 25, 16, 196, 41, 69, 8, 78, 73, 202, 132, 168, 0, 219, 55, 217, 74, 23, 253, 176,
-    152, 245, 165, 145, 104, 141, 58, 61, 205, 168, 100, 89, 197, 81, 72, 52, 113, 211, 245, 236, 212, 108, 68, 243,
-    120, 231, 212, 78, 247, 244, 84, 178, 66, 123, 151, 88, 40, 16, 139, 89, 198, 224, 33, 55, 164, 246, 36, 77, 164,
-    191, 139, 174, 188, 237, 55, 72, 57, 139, 168, 150, 104, 80, 54, 12, 239, 34, 195, 203, 56, 31, 79, 52, 62, 63, 218,
-    226, 8, 155, 190, 235, 171, 60, 108, 90, 133, 32, 230, 26, 151, 231, 159, 188, 106, 9, 148, 210, 128, 133, 217, 34,
-    226, 149, 45, 160, 211, 105, 2, 192, 115, 69, 116, 55, 31, 251, 145, 56, 23, 76, 157, 156, 6, 101, 225, 155, 119,
-    94, 38, 173, 179, 198, 212, 64, 68, 192, 26, 149, 134, 244, 49, 231, 156, 224, 195, 130, 176, 178, 48, 61, 2, 144,
-    46, 100, 239, 6, 175, 234, 238, 168, 117, 25, 138, 62, 45, 0, 137, 163, 170, 254, 126, 236, 73, 247, 248, 101, 105,
-    57, 50, 108, 199, 174, 16, 84, 145, 113, 241, 74, 179, 33, 139, 111, 173, 73, 76, 218, 223, 167, 237, 179, 187, 21,
-    247, 51, 149, 245, 30, 152, 46, 78, 101, 59, 203, 223, 37, 168, 180, 36, 166, 236, 241, 216, 227, 190, 44, 241, 195,
-    61, 16, 94, 58, 242, 82, 12, 161, 247, 231, 29, 41, 238, 163, 157, 17, 237, 95, 109, 155, 247, 0, 214, 30, 211, 233,
-    68, 19, 145, 94, 24, 241, 82, 51, 17, 87, 108, 141, 19, 58, 28, 3, 134, 238, 81, 11, 141, 245, 38, 19, 183, 219,
-    148, 59, 219, 49, 172, 187, 113, 159, 181, 183, 200, 196, 24, 79, 84, 86, 80, 180, 119, 97, 254, 56, 255, 195, 89,
-    170, 65, 141, 174, 48, 112, 208, 25, 127, 166, 232, 228, 178, 131, 189, 160, 225, 163, 191, 128, 103, 138, 79, 23,
-    122, 95, 161, 0, 67, 73, 96, 216, 222, 16, 195, 163, 29, 97, 238, 57, 71, 240, 189, 58, 230, 39, 213, 60, 163, 205,
-    215, 18, 113, 101, 10, 176, 16, 60, 63, 102, 187, 203, 97, 154, 120, 110, 121, 197, 166, 253, 111, 61, 16, 94, 46,
-    111, 117, 219, 16, 72, 107, 83, 29, 235, 151, 59, 141, 64, 143, 83, 3, 25, 171, 83, 106, 71, 188, 50, 181, 145, 158,
-    173, 107, 90, 195, 254, 52, 198, 211, 58, 29, 97, 73, 60, 218, 158, 62, 253, 235, 246, 138, 139, 21, 174, 219, 213,
-    35, 103, 120, 218, 32, 38, 211, 1, 196, 114, 228, 207, 24, 255, 67, 150, 228, 224, 190, 181, 137, 36, 31, 97, 99,
-    232, 61, 21, 203, 36, 32, 198, 16, 127, 226, 213, 150, 228, 194, 193, 132, 253, 15, 88, 26, 39, 3, 112, 207, 85,
-    228, 115, 124, 234, 4, 172, 221, 22, 93, 181, 97, 105, 59, 254, 14, 127, 197, 234, 251, 171, 244, 58, 53, 92, 114,
-    187, 218, 143, 70, 221, 239, 12, 104, 131, 247, 69, 191, 166, 150, 206, 63, 60, 10, 84, 123, 181, 72, 82, 0, 59,
-    209, 140, 244, 147, 161, 201, 76, 28, 161, 187, 199, 106, 96, 19, 83, 226, 187, 71, 148, 60, 116, 66, 180, 236, 14,
-    21, 125, 81, 140, 151, 192, 241, 170, 81, 201, 149, 220, 21, 43, 128, 215, 62, 161, 157, 206, 206, 161, 3, 230, 185,
-    82, 30, 113, 221, 136, 44, 64, 76, 167, 177, 107, 63, 167, 166, 15, 239, 185, 158, 197, 156, 105, 52, 42, 62, 8, 46,
-    247, 165, 123, 158, 97, 204, 92, 56, 66, 169, 214, 240, 76, 70, 232, 232, 2, 33, 28, 20, 68, 45, 130, 100, 8, 226,
-    243, 225, 225, 45, 253, 91, 29, 184, 171, 153, 104, 121, 226, 178, 159, 176, 53, 192, 13, 121, 31, 109, 66, 97, 149,
-    3, 248, 229, 211, 179, 179, 110, 164, 231, 168, 27, 97, 129, 254, 114, 13, 169, 201, 176, 81, 96, 111, 199, 182, 82,
-    2, 244, 145, 48, 232, 50, 51, 54, 144, 44, 163, 80, 58, 237, 164, 22, 12, 58, 231, 127, 45, 77, 24, 92, 224, 106,
-    94, 3, 104, 134, 167, 157, 222, 151, 46, 203, 211, 192, 225, 132, 241, 94, 232, 198, 218, 171, 231, 138, 71, 143,
-    123, 80, 83, 191, 245, 96, 113, 50, 75, 122, 245, 122, 62, 133, 86, 2, 149, 20, 202, 100, 105, 55, 0, 192, 113, 98,
-    119, 67, 129, 247, 132, 51, 41, 122, 37, 189, 70, 20, 38, 253, 80, 239, 73, 46, 33, 246, 201, 130, 146, 201, 220,
-    219, 141, 104, 220, 76, 44, 58, 129, 154, 203, 107, 7, 188, 152, 172, 142, 202, 247, 70, 192, 209, 121, 85, 242, 64,
-    13, 148, 151, 233, 104, 203, 65, 57, 173, 130, 210, 107, 47, 71, 45, 68, 213, 74, 61, 21, 3, 199, 226, 202, 68, 128,
-    13, 98, 133, 132, 204, 234, 55, 156, 113, 199, 50, 135, 251, 1, 179, 237, 89, 90, 118, 164, 154, 165, 93, 18, 49,
-    238, 84, 192, 252, 237, 173, 10, 13, 165, 14, 18, 158, 92, 11, 37, 14, 89, 45, 94, 125, 127, 67, 176, 243, 211, 253,
-    110, 192, 38, 238, 185, 148, 187, 223, 76, 106, 35, 4, 88, 162, 88, 116, 220, 12, 178, 191, 210, 148, 200, 144, 188,
-    16, 241, 176, 157, 190, 80, 84, 109, 181, 18, 31, 106, 13, 236, 43, 107, 56, 217, 191, 169, 57, 192, 236, 107, 36,
-    114, 13, 175, 193, 193, 81, 106, 10, 37, 152, 23, 243, 154, 118, 112, 191, 161, 23, 32, 84, 11, 0, 117, 126, 43,
-    153, 166, 110, 86, 212, 108, 68, 64, 242, 52, 212, 33, 161, 194, 91, 201, 174, 29, 82, 127, 26, 100, 242, 190, 154,
-    162, 111, 144, 175, 231, 121, 152, 255, 162, 149, 40, 191, 63, 17, 100, 37, 33, 146, 70, 213, 222, 89, 15, 230, 245,
-    248, 246, 170, 21, 227, 188, 111, 19, 223, 34, 87, 119, 250, 162, 218, 177, 57, 183, 39, 147, 196, 186, 161, 145,
-    46, 153, 121, 27, 108, 191, 226, 81, 25, 54, 104, 247, 255, 171, 29, 203, 135, 13, 59, 167, 126, 86, 13, 29, 111,
-    202, 79, 83, 64, 218, 228, 126, 11, 180, 248, 161, 248, 13, 122, 172, 254, 184, 165, 128, 73, 43, 45, 89, 191, 244,
-    229, 240, 155, 48, 204, 170, 165, 201, 44, 242, 207, 29, 41, 225, 73, 106, 239, 215, 250, 128, 191, 74, 92, 56, 183,
-    204, 142, 185, 7, 82, 125, 106, 68, 127, 80, 52, 38, 30, 46, 57, 195, 170, 86, 246, 194, 88, 205, 3, 55, 255, 243,
-    22, 82, 163, 25, 59, 4, 129, 30, 201, 168, 231, 152, 106, 99, 82, 33, 131, 90, 238, 196, 151, 18, 186, 127, 194, 32,
-    115, 13, 76, 153, 141, 187, 72, 115, 121, 82, 155, 143, 94, 60, 95, 165, 14, 68, 146, 67, 29, 31, 234, 133, 204, 0,
-    16, 217, 230, 95, 144, 117, 162, 37, 227, 40, 156, 189, 228, 225, 122, 50, 201, 90, 15, 91, 60, 139, 38, 18, 33, 22,
-    173, 255, 242, 146, 125, 179, 131, 41, 65, 113, 183, 218, 177, 165, 36, 44, 69, 209, 88, 126, 2, 244, 124, 31, 204,
-    110, 140, 177, 181, 130, 231, 16, 174, 48, 217, 2, 173, 217, 126, 193, 228, 144, 82, 222, 193, 247, 90, 189, 195,
-    181, 84, 114, 128, 155, 126, 81, 248, 36, 207, 85, 232, 2, 255, 190, 8, 168, 241, 49, 139, 88, 219, 131, 196, 223,
-    108, 61, 50, 21, 176, 34, 38, 20, 66, 199, 161, 157, 144, 44, 32, 96, 217, 13, 148, 75, 112, 8, 119, 60, 72, 97,
-    133, 91, 77, 38, 116, 244, 57, 131, 249, 1, 159, 150, 47, 254, 190, 25, 69, 141, 99, 174, 156, 246, 147, 155, 65,
-    247, 139, 208, 25, 175, 67, 232, 10, 217, 190, 144, 5, 88, 195, 86, 137, 172, 61, 161, 2, 120, 141, 29, 54, 201,
-    183, 39, 137, 53, 239, 62, 85, 182, 147, 252, 40, 223, 103, 178, 115, 139, 167, 202, 161, 100, 21, 53, 42, 157, 215,
-    247, 5, 169, 199, 83, 135, 90, 220, 212, 71, 219, 228, 187, 75, 63, 15, 21, 181, 159, 11, 184, 246, 144, 198, 120,
-    86, 153, 6, 153, 45, 211, 247, 239, 79, 127, 63, 125, 56, 32, 100, 183, 163, 140, 241, 42, 75, 26, 68, 80, 1, 64,
-    247, 43, 88, 140, 59, 70, 37, 50, 195, 16, 215, 88, 24, 135, 139, 151, 39, 172, 66, 193, 1, 138, 172, 244, 99, 8,
-    131, 87, 143, 35, 208, 93, 56, 115, 25, 199, 190, 225, 116, 122, 135, 28, 65, 45, 14, 229, 196, 156, 99, 153, 120,
-    211, 198, 45, 76, 23, 60, 120, 251, 57, 25, 59, 10, 9, 45, 224, 44, 165, 239, 157, 1, 244, 91, 12, 170, 240, 117,
-    171, 6, 65, 193, 28, 199, 38, 64, 248, 59, 5, 220, 6, 251, 8, 161, 49, 222, 155, 10, 123, 166, 35, 121, 16, 156,
-    132, 3, 153, 211, 230, 111, 81, 116, 239, 77, 72, 172, 52, 39, 81, 205, 13, 132, 246, 192, 39, 149, 207, 100, 45,
-    100, 124, 202, 200, 33, 196, 34, 154, 80, 214, 229, 83, 44, 153, 221, 40, 197, 50, 76, 188, 235, 242, 8, 220, 154,
-    131, 201, 167, 41, 50, 249, 99, 91, 251, 22, 110, 87, 83, 123, 131, 113, 70, 212, 35, 104, 96, 244, 124, 251, 165,
-    170, 253, 59, 208, 117, 68, 95, 100, 25, 0, 5, 115, 13, 121, 12, 36, 244, 95, 117, 89, 19, 6, 234, 253, 53, 143,
-    103, 110, 217, 241, 182, 235, 48, 60, 156, 137, 116, 74, 121, 74, 195, 13, 82, 181, 70, 166, 177, 114, 97, 199, 80,
-    248, 65, 33, 227, 150, 212, 211, 218, 75, 98, 170, 161, 58, 187, 248, 210, 255, 196, 0, 122, 112, 69, 121, 180, 208,
-    127, 187, 156, 0, 161, 203, 88, 255, 200, 93, 146, 140, 12, 246, 153, 186, 4, 34, 187, 85, 40, 12, 245, 16, 180, 58,
-    69, 96, 155, 25, 78, 91, 142, 53, 53, 53, 252, 240, 76, 171, 47, 55, 60, 1, 142, 2, 14, 216, 114, 95, 72, 44, 204,
-    171, 7, 201, 200, 211, 72, 88, 5, 98, 204, 196, 31, 127, 17, 33, 209, 65, 33, 155, 119, 184, 80, 13, 201, 38, 168,
-    200, 163, 52, 111, 234, 63, 76, 177, 121, 0, 166, 189, 82, 136, 181, 190, 173, 203, 118, 131, 1, 93, 192, 239, 16,
-    235, 209, 21, 41, 229, 114, 160, 100, 194, 23, 40, 172, 95, 102, 160, 155, 201, 146, 10, 118, 104, 145, 163, 171,
-    48, 233, 73, 22, 21, 246, 132, 29, 185, 20, 112, 15, 53, 9, 129, 171, 210, 52, 189, 15, 129, 125, 248, 228, 6, 153,
-    138, 195, 169, 0, 210, 84, 245, 197, 240, 239, 141, 212, 132, 19, 176, 31, 168, 70, 106, 149, 153, 63, 158, 125, 97,
-    209, 95, 220, 19, 131, 60, 126, 27, 252, 35, 132, 135, 209, 102, 123, 83, 189, 190, 245, 226, 31, 151, 77, 71, 157,
-    224, 219, 130, 246, 208, 212, 137, 204, 49, 160, 148, 59, 43, 169, 31, 53, 27, 189, 44, 127, 176, 128, 13, 32, 221,
-    219, 157, 112, 54, 53, 56, 52, 81, 171, 229, 40, 183, 77, 128, 196, 230, 255, 255, 41, 171, 56, 104, 29, 73, 44,
-    147, 163, 82, 98, 31, 45, 100, 212, 117, 80, 153, 247, 122, 85, 52, 167, 47, 84, 234, 247, 255, 94, 213, 162, 155,
-    44, 56, 76, 150, 160, 5, 231, 21, 172, 175, 3, 84, 147, 166, 117, 244, 215, 161, 244, 204, 45, 239, 170, 141, 21,
-    141, 129, 135, 97, 25, 102, 92, 57, 71, 182, 89, 98, 108, 212, 21, 231, 197, 96, 160, 158, 130, 119, 86, 201, 107,
-    218, 231, 142, 194, 95, 124, 153, 225, 255, 225, 204, 177, 203, 165, 55, 62, 169, 245, 177, 122, 243, 144, 244, 251,
-    76, 52, 43, 239, 207, 41, 31, 19, 175, 145, 84, 7, 162, 111, 120, 153, 171, 147, 22, 179, 81, 234, 167, 252, 155,
-    94, 5, 144, 179, 156, 142, 231, 228, 183, 79, 0, 43, 153, 167, 126, 114, 190, 129, 212, 218, 251, 175, 219, 79, 63,
-    173, 174, 27, 151, 56, 177, 69, 146, 64, 102, 242, 105, 196, 243, 66, 70, 123, 235, 241, 31, 193, 154, 237, 251, 57,
-    11, 128, 12, 66, 120, 18, 75, 140, 165, 149, 158, 169, 149, 219, 10, 43, 3, 193, 81, 64, 138, 51, 78, 4, 6, 113, 49,
-    213, 234, 239, 133, 255, 3, 169, 102, 235, 235, 211, 108, 151, 169, 209, 211, 249, 169, 204, 68, 149, 214, 80, 116,
-    78, 33, 97, 121, 224, 190, 34, 114, 200, 239, 44, 0, 56, 48, 85, 75, 100, 4, 134, 162, 76, 147, 49, 220, 46, 1, 145,
-    225, 227, 3, 218, 215, 142, 22, 226, 132, 229, 230, 245, 26, 40, 185, 187, 62, 52, 253, 36, 131, 104, 42, 211, 83,
-    43, 92, 193, 253, 109, 189, 62, 150, 113, 52, 42, 25, 197, 174, 5, 23, 59, 126, 17, 104, 163, 12, 64, 240, 231, 225,
-    26, 236, 88, 55, 166, 212, 87, 178, 213, 189, 63, 75, 75, 175, 35, 193, 214, 99, 8, 216, 50, 0, 164, 96, 24, 80,
-    178, 117, 153, 244, 156, 139, 247, 243, 152, 221, 237, 237, 123, 188, 96, 154, 5, 205, 54, 114, 94, 50, 230, 212,
-    154, 226, 40, 125, 171, 172, 93, 65, 30, 248, 115, 97, 56, 97, 241, 183, 165, 110, 112, 45, 218, 57, 24, 177, 202,
-    129, 206, 243, 80, 21, 174, 196, 206, 185, 2, 7, 169, 198, 6, 134, 8, 218, 47, 193, 99, 228, 125, 180, 242, 17, 29,
-    164, 114, 99, 161, 189, 151, 11, 132, 220, 64, 117, 24, 202, 118, 21, 47, 225, 190, 88, 37, 17, 137, 61, 169, 236,
-    41, 46, 36, 101, 247, 7, 176, 231, 158, 135, 226, 211, 68, 25, 69, 188, 111, 183, 83, 177, 102, 237, 206, 19, 61,
-    74, 104, 226, 156, 73, 228, 126, 153, 70, 180, 39, 54, 248, 157, 179, 42, 30, 108, 254, 251, 213, 182, 24, 173, 223,
-    218, 238, 18, 19, 150, 47, 98, 145, 37, 48, 156, 185, 77, 226, 92, 176, 161, 58, 9, 227, 213, 21, 206, 20, 197, 203,
-    44, 169, 84, 213, 175, 143, 146, 66, 192, 10, 5, 214, 149, 21, 150, 196, 22, 167, 97, 10, 53, 223, 149, 225, 23,
-    194, 116, 119, 50, 162, 0, 74, 144, 133, 14, 194, 211, 100, 71, 52, 13, 55, 86, 29, 241, 99, 247, 204, 217, 76, 81,
-    86, 186, 136, 24, 52, 232, 136, 132, 191, 49, 126, 53, 37, 143, 186, 181, 191, 141, 162, 28, 135, 90, 152, 224, 132,
-    105, 55, 191, 81, 11, 193, 250, 230, 75, 203, 232, 201, 173, 143, 12, 76, 9, 254, 208, 175, 27, 245, 165, 135, 236,
-    245, 3, 215, 164, 218, 85, 26, 102, 201, 72, 253, 106, 176, 56, 0, 86, 179, 142, 215, 206, 179, 95, 214, 123, 136,
-    95, 26, 141, 161, 9, 233, 207, 161, 240, 206, 183, 182, 157, 9, 93, 25, 249, 239, 120, 150, 16, 46, 195, 220, 152,
-    209, 156, 133, 51, 37, 75, 165, 9, 223, 122, 200, 224, 181, 1, 105, 47, 197, 26, 133, 178, 109, 34, 152, 203, 199,
-    128, 24, 52, 108, 233, 188, 134, 233, 239, 159, 199, 47, 21, 96, 131, 215, 188, 23, 130, 95, 186, 45, 103, 176, 24,
-    145, 150, 88, 173, 144, 250, 141, 47, 174, 218, 132, 6, 202, 13, 62, 102, 70, 248, 197, 196, 85, 23, 211, 136, 151,
-    162, 81, 181, 46, 110, 169, 184, 186, 158, 153, 121, 173, 247, 252, 102, 167, 99, 122, 169, 80, 219, 66, 149, 57,
-    211, 208, 146, 155, 29, 117, 199, 167, 49, 237, 203, 211, 180, 131, 165, 1, 159, 202, 95, 145, 19, 48, 19, 224, 180,
-    48, 1, 201, 206, 188, 183, 177, 137, 19, 122, 109, 170, 134, 138, 141, 167, 100, 23, 10, 108, 30, 129, 163, 238, 10,
-    103, 33, 1, 22, 190, 124, 56, 21, 79, 37, 12, 60, 180, 115, 120, 172, 182, 52, 27, 231, 134, 65, 120, 153, 148, 20,
-    21, 125, 184, 67, 121, 121, 78, 91, 199, 107, 39, 202, 20, 38, 158, 74, 167, 32, 221, 248, 230, 32, 116, 60, 216,
-    242, 204, 69, 82, 116, 106, 232, 16, 233, 30, 236, 184, 233, 31, 9, 26, 140, 251, 26, 155, 7, 145, 181, 176, 143,
-    26, 116, 136, 83, 78, 138, 99, 13, 168, 31, 188, 195, 85, 84, 25, 76, 107, 217, 123, 125, 237, 90, 193, 7, 196, 63,
-    29, 86, 197, 126, 231, 158, 189, 32, 208, 239, 138, 6, 138, 227, 86, 96, 14, 42, 8, 203, 97, 124, 91, 15, 56, 252,
-    6, 77, 200, 134, 5, 27, 241, 244, 70, 19, 169, 143, 98, 57, 24, 115, 101, 45, 143, 28, 39, 20, 69, 70, 40, 162, 159,
-    243, 57, 87, 182, 129, 163, 234, 38, 57, 182, 83, 1, 179, 149, 188, 215, 132, 165, 54, 157, 180, 136, 77, 15, 85,
-    79, 34, 72, 87, 204, 224, 248, 176, 198, 3, 38, 85, 96, 124, 45, 74, 67, 98, 0, 199, 163, 175, 251, 178, 41, 184,
-    224, 51, 172, 192, 39, 29, 5, 134, 50, 151, 222, 157, 54, 175, 249, 215, 208, 235, 134, 168, 60, 241, 107, 73, 72,
-    9, 254, 11, 71, 78, 61, 133, 209, 212, 101, 162, 234, 151, 29, 166, 20, 171, 70, 122, 197, 15, 130, 97, 167, 76,
-    235, 206, 240, 24, 116, 48, 163, 164, 67, 194, 244, 229, 107, 131, 191, 193, 80, 32, 147, 69, 205, 92, 245, 110,
-    184, 155, 93, 242, 113, 32, 183, 7, 104, 208, 173, 13, 207, 84, 32, 23, 134, 157, 196, 93, 54, 184, 249, 40, 211,
-    59, 12, 89, 221, 241, 247, 254, 24, 153, 194, 248, 116, 133, 218, 56, 121, 169, 58, 245, 245, 171, 172, 31, 136,
-    248, 113, 166, 56, 177, 29, 120, 187, 165, 175, 50, 169, 58, 214, 113, 24, 150, 85, 86, 59, 236, 46, 135, 25, 161,
-    125, 190, 35, 176, 20, 102, 65, 3, 129, 194, 190, 75, 116, 173, 112, 29, 126, 69, 175, 45, 221, 29, 147, 147, 124,
-    122, 21, 50, 137, 165, 83, 188, 173, 56, 233, 69, 10, 6, 9, 96, 153, 49, 93, 150, 31, 233, 244, 104, 42, 250, 105,
-    143, 133, 44, 68, 67, 213, 70, 6, 69, 207, 21, 54, 128, 211, 114, 104, 49, 230, 95, 135, 73, 247, 79, 218, 57, 82,
-    158, 71, 37, 92, 244, 246, 165, 6, 108, 169, 78, 104, 43, 77, 112, 132, 192, 33, 165, 116, 120, 208, 66, 23, 109,
-    145, 209, 93, 194, 13, 168, 86, 220, 43, 73, 11, 192, 14, 92, 143, 209, 225, 40, 162, 42, 103, 28, 195, 213, 71,
-    219, 29, 23, 51, 127, 11, 231, 254, 31, 10, 90, 187, 198, 224, 223, 134, 169, 5, 159, 21, 78, 224, 80, 41, 147, 9,
-    126, 118, 165, 94, 164, 44, 10, 59, 219, 122, 160, 129, 6, 238, 241, 152, 232, 17, 135, 162, 82, 53, 64, 95, 162,
-    171, 194, 220, 92, 246, 120, 191, 9, 78, 42, 104, 159, 167, 132, 167, 2, 58, 62, 133, 45, 183, 14, 152, 20, 175, 14,
-    82, 153, 117, 88, 168, 131, 199, 85, 57, 176, 6, 234, 209, 207, 243, 33, 28, 230, 2, 171, 215, 52, 252, 179, 167,
-    25, 110, 32, 26, 210, 247, 162, 183, 252, 136, 57, 250, 123, 162, 46, 56, 86, 180, 216, 30, 156, 175, 205, 245, 113,
-    53, 23, 163, 224, 164, 199, 254, 64, 220, 60, 22, 84, 62, 4, 19, 207, 21, 114, 16, 110, 126, 6, 168, 206, 26, 12,
-    145, 19, 150, 246, 30, 16, 90, 61, 138, 86, 195, 84, 29, 250, 158, 62, 211, 137, 63, 83, 25, 223, 240, 75, 255, 148,
-    254, 20, 184, 158, 167, 84, 115, 97, 241, 130, 207, 0, 9, 130, 152, 213, 234, 199, 203, 162, 79, 82, 229, 27, 88,
-    16, 88, 96, 99, 18, 119, 37, 213, 216, 67, 47, 17, 226, 233, 239, 159, 132, 99, 169, 188, 195, 213, 191, 62, 62, 87,
-    69, 244, 193, 109, 178, 121, 48, 138, 244, 22, 32, 208, 147, 102, 39, 45, 89, 166, 223, 168, 2, 160, 227, 173, 61,
-    124, 166, 131, 147, 164, 185, 118, 24, 176, 36, 252, 221, 73, 215, 165, 197, 210, 152, 99, 50, 116, 78, 81, 246, 30,
-    20, 185, 201, 23, 167, 120, 138, 234, 157, 132, 115, 156, 84, 174, 67, 228, 160, 119, 43, 139, 122, 115, 200, 236,
-    91, 163, 112, 29, 211, 69, 57, 136, 219, 94, 50, 37, 63, 206, 117, 211, 230, 225, 93, 233, 13, 85, 156, 173, 187,
-    162, 197, 165, 32, 140, 152, 208, 22, 74, 57, 106, 98, 87, 213, 87, 61, 158, 186, 250, 73, 35, 221, 212, 214, 116,
-    243, 203, 63, 20, 170, 79, 64, 47, 65, 127, 233, 194, 72, 146, 169, 115, 181, 44, 200, 113, 122, 51, 108, 237, 63,
-    170, 163, 174, 184, 137, 234, 122, 140, 137, 123, 145, 217, 193, 123, 224, 244, 7, 59, 107, 252, 52, 186, 80, 28, 0,
-    78, 151, 76, 198, 204, 151, 123, 8, 131, 42, 237, 33, 188, 240, 97, 149, 185, 29, 148, 205, 199, 160, 95, 245, 81,
-    19, 88, 136, 167, 63, 1, 204, 14, 39, 249, 208, 112, 154, 60, 226, 253, 185, 216, 130, 124, 203, 252, 69, 166, 252,
-    82, 75, 101, 122, 62, 165, 199, 27, 213, 215, 132, 174, 220, 71, 170, 41, 190, 170, 60, 252, 198, 57, 49, 133, 41,
-    201, 16, 216, 2, 9, 10, 136, 19, 195, 87, 165, 232, 94, 247, 82, 147, 43, 223, 121, 32, 198, 197, 64, 116, 26, 54,
-    141, 29, 34, 149, 189, 151, 56, 22, 245, 116, 156, 245, 227, 144, 1, 62, 123, 124, 232, 139, 128, 173, 229, 36, 248,
-    20, 174, 231, 39, 46, 227, 147, 178, 226, 175, 109, 165, 168, 164, 103, 69, 173, 204, 150, 15, 146, 246, 176, 192,
-    32, 217, 10, 90, 71, 161, 227, 129, 128, 112, 74, 206, 116, 116, 89, 19, 71, 193, 77, 108, 72, 166, 5, 106, 188,
-    147, 98, 243, 251, 158, 245, 92, 1, 215, 135, 43, 33, 242, 174, 144, 28, 218, 176, 97, 120, 92, 195, 126, 255, 161,
-    169, 101, 117, 90, 65, 56, 249, 152, 171, 35, 63, 75, 141, 80, 140, 44, 118, 223, 97, 182, 43, 205, 41, 167, 210,
-    248, 143, 159, 83, 5, 32, 207, 56, 218, 73, 89, 144, 240, 124, 220, 164, 130, 5, 5, 244, 111, 20, 204, 47, 0, 143,
-    96, 5, 42, 195, 62, 130, 185, 27, 19, 93, 23, 146, 52, 171, 189, 24, 237, 242, 154, 219, 182, 75, 95, 15, 183, 33,
-    76, 142, 238, 225, 3, 245, 60, 116, 206, 138, 138, 3, 80, 231, 124, 79, 242, 214, 120, 15, 172, 174, 119, 254, 64,
-    203, 149, 69, 22, 68, 58, 172, 194, 150, 107, 98, 169, 112, 18, 202, 203, 78, 1, 130, 81, 90, 246, 218, 93, 15, 101,
-    167, 59, 13, 25, 239, 243, 81, 237, 87, 235, 77, 229, 207, 74, 62, 83, 206, 34, 146, 168, 180, 14, 45, 236, 22, 118,
-    79, 145, 197, 101, 71, 225, 13, 18, 152, 253, 241, 131, 175, 84, 46, 14, 5, 0, 231, 146, 133, 168, 229, 4, 26, 194,
-    144, 43, 194, 254, 60, 220, 109, 95, 185, 121, 196, 148, 181, 11, 140, 0, 196, 84, 255, 44, 63, 113, 62, 135, 71,
-    141, 220, 136, 222, 4, 50, 142, 55, 206, 203, 29, 232, 123, 190, 23, 220, 59, 4, 181, 104, 82, 159, 57, 74, 186, 72,
-    217, 15, 169, 174, 155, 136, 170, 78, 203, 214, 139, 30, 133, 170, 245, 181, 78, 100, 146, 165, 164, 97, 178, 207,
-    213, 86, 139, 93, 117, 5, 132, 122, 190, 148, 68, 58, 127, 245, 97, 19, 239, 189, 113, 211, 147, 191, 167, 20, 31,
-    159, 155, 141, 246, 239, 132, 13, 138, 16, 168, 81, 69, 90, 203, 218, 36, 1, 51, 11, 21, 114, 96, 125, 157, 57, 47,
-    39, 208, 48, 20, 93, 238, 128, 160, 17, 222, 150, 51, 191, 253, 86, 233, 254, 120, 76, 193, 67, 182, 64, 23, 159,
-    178, 194, 186, 71, 38, 193, 4, 29, 74, 19, 176, 214, 173, 80, 189, 93, 7, 224, 101, 109, 142, 197, 197, 222, 166,
-    132, 165, 227, 36, 62, 216, 223, 229, 208, 196, 173, 10, 117, 146, 119, 99, 125, 47, 248, 148, 95, 98, 212, 240, 5,
-    37, 61, 135, 10, 0, 158, 205, 112, 87, 5, 10, 82, 182, 26, 247, 102, 37, 241, 248, 187, 155, 104, 15, 114, 212, 123,
-    120, 91, 12, 188, 1, 107, 73, 13, 107, 176, 124, 80, 176, 77, 16, 64, 197, 145, 60, 196, 166, 43, 245, 96, 23, 251,
-    45, 53, 205, 163, 196, 121, 163, 131, 87, 124, 183, 132, 118, 141, 89, 112, 190, 175, 239, 245, 52, 213, 25, 192,
-    128, 246, 132, 27, 6, 160, 33, 225, 168, 83, 43, 143, 58, 55, 2, 84, 33, 31, 52, 78, 245, 207, 83, 26, 163, 195, 25,
-    161, 159, 234, 240, 172, 3, 16, 49, 163, 21, 130, 28, 243, 192, 126, 84, 168, 253, 222, 236, 101, 160, 183, 147,
-    160, 124, 74, 23, 110, 215, 197, 209, 238, 210, 10, 45, 188, 229, 172, 12, 33, 57, 233, 26, 98, 134, 176, 141, 115,
-    71, 199, 10, 220, 93, 65, 99, 26, 243, 54, 190, 220, 183, 179, 79, 197, 39, 161, 88, 104, 133, 200, 118, 218, 40,
-    194, 115, 95, 155, 34, 129, 119, 153, 167, 14, 38, 96, 70, 17, 158, 136, 79, 25, 188, 155, 85, 98, 102, 147, 66,
-    192, 225, 121, 3, 112, 195, 37, 51, 106, 188, 197, 203, 12, 223, 54, 83, 11, 237, 220, 237, 25, 168, 102, 25, 161,
-    118, 34, 159, 81, 148, 46, 245, 192, 242, 115, 233, 83, 220, 105, 156, 5, 83, 77, 199, 195, 139, 109, 224, 51, 12,
-    237, 24, 27, 1, 200, 174, 160, 181, 179, 22, 227, 221, 172, 172, 102, 24, 252, 185, 155, 239, 251, 18, 54, 136, 162,
-    120, 118, 252, 81, 77, 70, 139, 71, 229, 114, 31, 189, 21, 3, 152, 11, 114, 34, 60, 20, 102, 105, 87, 179, 90, 100,
-    183, 60, 169, 196, 202, 50, 113, 40, 85, 66, 180, 64, 184, 153, 87, 61, 233, 35, 39, 63, 194, 252, 83, 123, 228,
-    210, 103, 235, 52, 127, 62, 203, 180, 4, 191, 174, 150, 132, 12, 78, 133, 16, 137, 172, 117, 97, 31, 45, 222, 11,
-    172, 248, 223, 235, 141, 185, 148, 173, 21, 116, 217, 153, 2, 51, 189, 44, 20, 200, 235, 107, 227, 49, 109, 137, 9,
-    56, 78, 153, 206, 187, 195, 168, 153, 132, 241, 181, 212, 153, 235, 174, 126, 72, 43, 0, 160, 202, 230, 115, 126,
-    116, 222, 81, 131, 118, 28, 22, 35, 158, 118, 84, 59, 214, 46, 214, 203, 161, 112, 57, 254, 48, 197, 147, 140, 196,
-    136, 130, 7, 132, 85, 204, 228, 2, 111, 183, 46, 137, 250, 7, 250, 179, 253, 12, 165, 125, 70, 139, 140, 55, 103, 2,
-    113, 135, 7, 126, 100, 13, 47, 228, 22, 221, 201, 241, 206, 60, 85, 4, 3, 66, 18, 36, 130, 208, 166, 44, 116, 42,
-    93, 14, 182, 140, 84, 112, 27, 106, 188, 103, 220, 80, 64, 251, 188, 40, 89, 165, 176, 195, 197, 16, 60, 80, 134,
-    163, 104, 124, 106, 82, 34, 236, 36, 10, 96, 249, 255, 38, 27, 116, 248, 23, 10, 121, 195, 83, 19, 208, 218, 11, 88,
-    177, 93, 235, 245, 159, 0, 72, 234, 253, 101, 119, 226, 23, 172, 224, 84, 21, 34, 235, 102, 226, 136, 191, 106, 112,
-    172, 143, 225, 53, 50, 54, 4, 127, 127, 255, 188, 107, 189, 5, 228, 170, 81, 18, 65, 255, 68, 35, 223, 5, 223, 225,
-    76, 49, 50, 141, 222, 249, 124, 81, 237, 220, 211, 4, 240, 143, 65, 183, 161, 62, 185, 189, 251, 239, 137, 66, 208,
-    74, 82, 125, 9, 204, 172, 123, 11, 242, 38, 45, 255, 111, 115, 146, 122, 69, 10, 8, 56, 215, 54, 92, 58, 199, 248,
-    21, 35, 3, 191, 94, 164, 72, 36, 152, 136, 209, 207, 55, 226, 166, 193, 121, 64, 11, 30, 230, 216, 8, 43, 199, 39,
-    7, 26, 111, 252, 106, 249, 47, 120, 211, 43, 189, 150, 210, 6, 78, 102, 9, 78, 153, 212, 98, 47, 194, 93, 249, 159,
-    217, 189, 177, 207, 171, 64, 118, 224, 237, 50, 177, 160, 140, 20, 96, 114, 203, 50, 108, 93, 70, 108, 23, 174, 54,
-    54, 41, 22, 89, 54, 155, 73, 150, 191, 223, 192, 59, 248, 85, 160, 221, 229, 198, 187, 193, 126, 247, 21, 186, 163,
-    123, 239, 125, 71, 90, 7, 197, 9, 186, 236, 117, 125, 234, 250, 37, 130, 97, 250, 48, 44, 95, 193, 198, 85, 7, 13,
-    125, 97, 43, 54, 8, 104, 199, 245, 77, 55, 22, 30, 136, 59, 56, 34, 34, 157, 164, 165, 21, 72, 209, 169, 124, 34,
-    31, 149, 79, 19, 210, 25, 125, 91, 167, 217, 79, 195, 2, 15, 251, 242, 43, 182, 165, 31, 124, 143, 188, 207, 250,
-    169, 181, 162, 250, 229, 252, 74, 127, 168, 234, 181, 163, 186, 78, 120, 91, 164, 124, 252, 223, 113, 126, 93, 218,
-    83, 104, 209, 157, 200, 225, 119, 187, 151, 83, 74, 223, 154, 180, 105, 33, 143, 139, 188, 226, 205, 71, 97, 26, 48,
-    216, 224, 154, 70, 176, 109, 223, 108, 240, 84, 147, 63, 200, 229, 149, 128, 35, 128, 245, 235, 60, 194, 37, 89,
-    133, 96, 184, 114, 101, 76, 31, 210, 236, 6, 69, 181, 101, 204, 185, 72, 230, 67, 173, 106, 138, 30, 219, 174, 178,
-    146, 66, 57, 126, 168, 254, 142, 138, 20, 97, 60, 37, 153, 236, 72, 119, 153, 182, 83, 196, 136, 38, 249, 16, 95,
-    179, 110, 214, 64, 0, 176, 75, 62, 225, 101, 114, 151, 119, 16, 136, 5, 54, 59, 46, 173, 196, 28, 220, 94, 147, 242,
-    88, 60, 182, 12, 184, 221, 183, 12, 205, 160, 23, 130, 85, 62, 61, 213, 73, 46, 38, 93, 52, 123, 36, 233, 237, 14,
-    188, 165, 125, 44, 3, 137, 99, 133, 67, 25, 34, 202, 43, 59, 133, 133, 128, 76, 209, 155, 152, 80, 76, 143, 96, 23,
-    123, 178, 136, 210, 35, 202, 80, 229, 118, 223, 154, 52, 213, 66, 66, 115, 235, 189, 173, 163, 118, 194, 218, 233,
-    249, 32, 224, 99, 125, 24, 159, 86, 163, 91, 223, 197, 225, 86, 120, 205, 43, 97, 138, 146, 73, 176, 178, 54, 175,
-    64, 186, 197, 48, 122, 24, 4, 204, 103, 148, 114, 104, 226, 122, 216, 116, 99, 157, 60, 147, 224, 220, 59, 201, 11,
-    223, 111, 241, 157, 121, 16, 180, 164, 120, 188, 151, 239, 199, 120, 165, 254, 169, 12, 126, 186, 18, 53, 161, 112,
-    60, 32, 207, 86, 229, 250, 103, 46, 171, 238, 68, 124, 3, 134, 149, 245, 216, 231, 161, 231, 189, 131, 176, 229, 87,
-    218, 49, 117, 84, 181, 59, 180, 112, 235, 138, 44, 193, 20, 106, 39, 254, 37, 173, 12, 8, 212, 90, 229, 25, 135,
-    153, 117, 21, 137, 180, 153, 247, 117, 152, 252, 46, 75, 119, 19, 181, 197, 105, 242, 82, 130, 227, 168, 193, 253,
-    152, 178, 220, 100, 18, 85, 23, 206, 7, 146, 213, 252, 231, 87, 124, 243, 222, 135, 139, 116, 193, 201, 192, 159,
-    218, 162, 32, 125, 45, 232, 49, 78, 13, 117, 160, 128, 198, 197, 137, 185, 114, 188, 133, 119, 95, 219, 199, 193,
-    100, 188, 18, 66, 18, 35, 18, 241, 209, 1, 167, 156, 254, 210, 98, 252, 119, 224, 246, 211, 179, 132, 67, 172, 113,
-    102, 224, 159, 195, 237, 203, 138, 8, 23, 213, 207, 248, 214, 253, 162, 200, 164, 77, 231, 50, 88, 241, 198, 184,
-    105, 180, 49, 124, 249, 96, 82, 252, 202, 156, 182, 174, 20, 161, 89, 122, 218, 213, 216, 15, 11, 152, 4, 114, 182,
-    135, 235, 56, 40, 62, 221, 82, 23, 124, 251, 167, 211, 236, 48, 178, 191, 125, 173, 78, 107, 165, 100, 20, 199, 160,
-    120, 15, 217, 159, 162, 248, 37, 162, 80, 44, 84, 105, 59, 194, 242, 17, 196, 255, 209, 252, 3, 153, 24, 70, 230,
-    83, 9, 132, 238, 124, 118, 204, 233, 166, 54, 46, 59, 238, 153, 4, 29, 170, 162, 91, 143, 59, 13, 112, 62, 181, 169,
-    244, 41, 250, 224, 181, 88, 71, 217, 131, 236, 61, 187, 66, 187, 221, 144, 142, 101, 254, 122, 130, 24, 233, 204,
-    129, 119, 239, 138, 11, 58, 136, 242, 219, 98, 102, 225, 29, 78, 18, 148, 198, 74, 106, 104, 163, 240, 218, 0, 80,
-    192, 45, 77, 121, 96, 79, 72, 188, 143, 124, 77, 48, 80, 216, 192, 74, 37, 166, 20, 225, 194, 199, 81, 41, 79, 121,
-    206, 94, 9, 189, 14, 9, 73, 18, 189, 72, 168, 238, 66, 233, 17, 227, 189, 3, 151, 115, 3, 232, 47, 238, 61, 86, 124,
-    252, 70, 15, 47, 255, 23, 132, 166, 117, 33, 223, 25, 4, 254, 99, 245, 223, 80, 230, 203, 55, 39, 95, 138, 250, 223,
-    122, 72, 104, 171, 215, 22, 51, 225, 116, 150, 1, 218, 81, 84, 104, 139, 223, 54, 74, 165, 64, 96, 53, 233, 178,
-    104, 144, 209, 248, 209, 131, 194, 252, 80, 107, 191, 156, 151, 69, 12, 15, 96, 122, 9, 76, 169, 28, 205, 212, 152,
-    142, 163, 254, 140, 118, 179, 117, 136, 158, 122, 83, 67, 64, 229, 185, 100, 37, 18, 172, 93, 1, 21, 255, 241, 66,
-    8, 229, 167, 43, 218, 238, 31, 21, 201, 14, 243, 85, 218, 189, 75, 183, 203, 169, 194, 78, 212, 204, 145, 239, 181,
-    35, 109, 232, 113, 91, 186, 217, 119, 102, 34, 81, 140, 55, 12, 171, 1, 17, 61, 227, 27, 147, 208, 24, 237, 69, 208,
-    216, 109, 94, 116, 163, 76, 239, 142, 81, 34, 222, 137, 254, 68, 230, 22, 50, 209, 47, 225, 145, 230, 131, 157, 24,
-    186, 247, 241, 138, 228, 146, 92, 163, 169, 55, 105, 240, 172, 250, 193, 36, 238, 87, 131, 221, 226, 49, 34, 187,
-    99, 181, 39, 46, 151, 72, 14, 230, 214, 140, 221, 55, 133, 155, 253, 26, 82, 146, 3, 95, 175, 69, 172, 48, 188, 69,
-    94, 213, 121, 14, 86, 42, 8, 113, 160, 145, 32, 29, 239, 153, 190, 208, 35, 228, 4, 87, 237, 205, 136, 206, 255,
-    157, 175, 150, 102, 88, 215, 245, 218, 255, 98, 118, 87, 155, 189, 225, 8, 248, 60, 10, 162, 161, 174, 198, 140,
-    168, 234, 5, 164, 189, 148, 134, 216, 94, 217, 220, 119, 252, 43, 170, 42, 2, 136, 209, 188, 254, 161, 224, 189,
-    118, 137, 179, 67, 149, 163, 207, 246, 38, 118, 0, 203, 23, 100, 211, 95, 82, 205, 9, 234, 91, 39, 200, 82, 230, 46,
-    106, 188, 72, 190, 11, 195, 152, 121, 145, 149, 157, 192, 249, 91, 61, 96, 82, 28, 215, 112, 203, 44, 26, 143, 42,
-    50, 130, 26, 192, 194, 99, 171, 32, 230, 1, 61, 183, 99, 113, 92, 113, 131, 113, 250, 48, 181, 182, 112, 220, 8,
-    222, 129, 49, 220, 11, 137, 88, 52, 62, 124, 134, 9, 33, 30, 226, 166, 128, 123, 20, 122, 125, 82, 14, 212, 108,
-    243, 45, 168, 119, 254, 98, 53, 34, 234, 160, 102, 252, 119, 144, 186, 122, 25, 36, 44, 2, 141, 211, 216, 49, 19,
-    39, 88, 69, 3, 255, 28, 20, 54, 24, 196, 167, 32, 189, 213, 14, 252, 145, 171, 166, 34, 103, 107, 155, 111, 80, 107,
-    23, 19, 53, 129, 62, 35, 51, 222, 77, 145, 72, 215, 106, 22, 19, 81, 82, 91, 72, 116, 143, 119, 109, 211, 5, 148,
-    103, 47, 95, 126, 220, 75, 184, 99, 212, 196, 245, 79, 152, 118, 222, 13, 129, 202, 81, 115, 22, 141, 240, 162, 108,
-    113, 123, 203, 152, 248, 224, 61, 162, 60, 214, 50, 106, 28, 43, 46, 64, 106, 168, 9, 200, 133, 146, 157, 192, 36,
-    65, 24, 140, 214, 187, 34, 18, 186, 237, 1, 228, 206, 183, 3, 189, 244, 101, 205, 97, 127, 18, 212, 193, 181, 171,
-    226, 183, 16, 137, 252, 222, 214, 97, 70, 46, 254, 87, 184, 118, 123, 240, 95, 188, 207, 106, 101, 65, 98, 80, 82,
-    29, 25, 181, 31, 118, 33, 79, 253, 249, 171, 137, 72, 194, 198, 91, 76, 73, 7, 88, 4, 75, 95, 250, 245, 70, 251,
-    118, 85, 191, 171, 148, 29, 230, 181, 144, 48, 249, 206, 101, 232, 140, 117, 217, 249, 6, 3, 99, 105, 148, 155, 195,
-    177, 181, 142, 43, 197, 45, 57, 57, 174, 34, 158, 57, 67, 170, 211, 254, 32, 12, 245, 79, 39, 43, 160, 177, 128, 80,
-    126, 64, 188, 78, 108, 253, 233, 161, 179, 103, 12, 245, 134, 72, 45, 144, 114, 148, 226, 58, 98, 238, 32, 105, 159,
-    165, 63, 143, 137, 135, 19, 181, 12, 39, 224, 10, 207, 122, 109, 205, 31, 16, 50, 206, 44, 222, 212, 25, 245, 91,
-    85, 2, 1, 92, 95, 210, 172, 241, 37, 123, 214, 224, 163, 227, 51, 56, 15, 241, 42, 185, 171, 241, 50, 192, 253, 14,
-    81, 181, 220, 103, 18, 85, 132, 118, 178, 12, 47, 13, 38, 232, 98, 171, 59, 223, 195, 228, 182, 132, 152, 181, 108,
-    71, 202, 13, 239, 157, 146, 86, 143, 188, 1, 43, 11, 112, 35, 222, 206, 215, 138, 87, 146, 233, 252, 28, 136, 208,
-    76, 196, 71, 52, 137, 58, 73, 24, 20, 254, 25, 4, 62, 210, 28, 46, 156, 116, 165, 80, 219, 207, 59, 133, 26, 41, 59,
-    228, 65, 188, 58, 223, 213, 44, 92, 164, 186, 9, 3, 246, 51, 235, 137, 142, 209, 201, 199, 17, 103, 165, 119, 37,
-    118, 220, 126, 158, 165, 232, 117, 158, 58, 62, 117, 97, 151, 238, 207, 248, 64, 11, 157, 31, 151, 63, 136, 140,
-    249, 11, 17, 196, 220, 198, 108, 207, 203, 222, 137, 43, 169, 149, 232, 2, 109, 188, 60, 210, 134, 107, 239, 47,
-    108, 152, 47, 95, 16, 160, 113, 123, 90, 154, 241, 112, 205, 118, 152, 19, 153, 46, 169, 125, 207, 12, 156, 141,
-    235, 247, 111, 172, 109, 78, 122, 133, 63, 168, 49, 74, 126, 241, 243, 34, 178, 10, 116, 240, 202, 37, 93, 24, 192,
-    48, 168, 188, 98, 150, 59, 22, 251, 75, 81, 52, 238, 165, 253, 115, 185, 118, 192, 226, 3, 94, 235, 201, 99, 67,
-    117, 88, 119, 141, 241, 157, 149, 145, 16, 212, 85, 239, 87, 102, 252, 130, 170, 184, 240, 35, 79, 143, 221, 16, 18,
-    149, 19, 237, 11, 39, 3, 69, 194, 177, 82, 200, 111, 188, 208, 175, 124, 20, 40, 65, 136, 85, 56, 120, 234, 194, 70,
-    194, 13, 59, 173, 217, 129, 58, 150, 10, 29, 97, 101, 129, 141, 76, 8, 96, 228, 253, 92, 100, 122, 95, 240, 159, 91,
-    8, 41, 100, 36, 88, 83, 200, 119, 253, 188, 121, 169, 110, 247, 201, 248, 31, 93, 127, 186, 21, 34, 17, 193, 197,
-    115, 54, 30, 71, 243, 177, 147, 112, 228, 179, 95, 254, 253, 116, 108, 113, 147, 129, 35, 45, 220, 214, 243, 122,
-    244, 153, 43, 68, 91, 170, 158, 77, 246, 25, 15, 197, 224, 164, 187, 174, 204, 75, 97, 4, 172, 98, 37, 5, 121, 124,
-    132, 245, 223, 132, 154, 97, 7, 77, 20, 97, 86, 176, 181, 140, 250, 204, 250, 135, 110, 253, 99, 229, 239, 24, 2,
-    159, 72, 221, 50, 123, 164, 91, 217, 125, 236, 82, 171, 254, 187, 201, 194, 134, 62, 13, 47, 196, 255, 196, 128, 3,
-    233, 23, 207, 124, 23, 231, 251, 184, 243, 189, 157, 223, 190, 127, 5, 110, 87, 51, 242, 156, 89, 54, 17, 44, 42,
-    115, 134, 217, 70, 204, 19, 218, 16, 82, 218, 229, 6, 49, 87, 205, 157, 165, 11, 251, 172, 47, 238, 89, 139, 213,
-    255, 114, 124, 129, 23, 73, 65, 134, 149, 29, 99, 231, 8, 244, 222, 174, 141, 227, 179, 114, 136, 86, 146, 222, 121,
-    206, 44, 95, 54, 185, 195, 30, 140, 127, 56, 13, 67, 249, 12, 99, 164, 29, 152, 15, 230, 33, 240, 91, 65, 44, 103,
-    200, 242, 189, 34, 115, 6, 245, 38, 127, 109, 168, 189, 108, 240, 214, 5, 152, 125, 69, 51, 252, 190, 149, 252, 157,
-    244, 3, 195, 127, 20, 24, 166, 254, 149, 87, 39, 253, 68, 21, 103, 180, 206, 194, 20, 130, 45, 75, 188, 251, 12,
-    133, 160, 19, 66, 108, 219, 19, 82, 67, 112, 125, 57, 84, 53, 157, 229, 132, 235, 182, 62, 214, 51, 117, 146, 1,
-    200, 233, 173, 229, 98, 14, 217, 61, 79, 59, 71, 200, 59, 110, 129, 137, 92, 235, 113, 145, 185, 76, 196, 187, 120,
-    158, 74, 95, 26, 109, 245, 62, 22, 199, 196, 97, 59, 17, 18, 52, 81, 18, 6, 162, 106, 29, 128, 240, 128, 251, 173,
-    92, 194, 238, 110, 131, 136, 216, 88, 157, 130, 68, 167, 169, 175, 70, 251, 123, 17, 190, 242, 181, 158, 48, 238,
-    31, 78, 107, 117, 124, 122, 175, 211, 4, 93, 163, 231, 158, 15, 109, 95, 116, 164, 17, 85, 14, 13, 5, 143, 192, 89,
-    49, 131, 122, 7, 177, 90, 41, 224, 131, 102, 27, 116, 0, 172, 245, 133, 213, 232, 174, 183, 204, 58, 216, 123, 107,
-    38, 177, 185, 9, 160, 2, 40, 184, 24, 164, 40, 27, 143, 28, 25, 164, 86, 252, 53, 136, 242, 190, 13, 129, 194, 223,
-    97, 4, 133, 95, 189, 33, 167, 152, 199, 248, 83, 61, 24, 65, 161, 254, 210, 34, 79, 250, 53, 79, 170, 4, 51, 58,
-    215, 243, 102, 187, 224, 200, 243, 231, 143, 145, 213, 144, 65, 183, 135, 22, 56, 103, 146, 62, 131, 19, 172, 116,
-    187, 249, 136, 177, 136, 67, 137, 244, 61, 71, 248, 90, 102, 167, 150, 77, 55, 172, 35, 77, 231, 241, 119, 20, 25,
-    228, 231, 135, 151, 120, 160, 19, 243, 218, 222, 100, 93, 35, 184, 171, 93, 240, 12, 221, 191, 124, 252, 35, 111,
-    147, 65, 137, 29, 172, 253, 170, 156, 138, 226, 50, 69, 80, 55, 78, 205, 121, 12, 218, 133, 250, 140, 4, 254, 7, 55,
-    13, 209, 203, 249, 93, 19, 180, 99, 215, 42, 242, 197, 54, 73, 143, 78, 168, 69, 88, 175, 12, 192, 11, 43, 233, 76,
-    155, 43, 15, 237, 133, 115, 52, 83, 56, 208, 220, 123, 9, 231, 248, 204, 38, 166, 36, 114, 184, 110, 178, 122, 179,
-    151, 216, 93, 132, 51, 151, 99, 4, 100, 163, 16, 65, 82, 244, 53, 77, 134, 32, 132, 157, 54, 171, 26, 189, 142, 137,
-    250, 198, 163, 2, 96, 232, 136, 52, 151, 217, 165, 185, 161, 81, 215, 136, 198, 172, 245, 70, 5, 34, 180, 201, 244,
-    141, 62, 154, 77, 161, 235, 154, 118, 79, 63, 196, 180, 79, 150, 8, 135, 177, 8, 109, 18, 160, 162, 161, 202, 167,
-    173, 141, 147, 150, 182, 231, 34, 27, 36, 167, 101, 204, 57, 195, 67, 230, 85, 120, 50, 26, 94, 248, 197, 74, 151,
-    1, 146, 36, 245, 97, 247, 40, 19, 144, 231, 122, 192, 78, 208, 225, 175, 82, 177, 177, 130, 139, 123, 125, 230, 188,
-    194, 149, 244, 46, 29, 20, 118, 161, 252, 90, 15, 50, 73, 89, 156, 204, 193, 205, 51, 31, 199, 252, 227, 67, 71,
-    235, 100, 171, 177, 5, 38, 93, 217, 159, 31, 115, 16, 225, 255, 72, 137, 235, 216, 103, 205, 140, 147, 119, 208, 98,
-    235, 220, 223, 102, 227, 219, 162, 121, 242, 108, 40, 138, 69, 10, 183, 62, 139, 134, 186, 141, 30, 246, 174, 24,
-    248, 191, 200, 255, 230, 152, 141, 138, 16, 125, 149, 70, 157, 254, 45, 33, 48, 200, 158, 75, 218, 244, 211, 88, 0,
-    154, 83, 96, 22, 98, 238, 47, 12, 13, 179, 152, 44, 214, 176, 58, 107, 174, 215, 26, 108, 119, 104, 114, 28, 240,
-    59, 115, 97, 215, 78, 31, 47, 243, 215, 10, 94, 67, 187, 180, 116, 187, 66, 189, 36, 125, 40, 213, 119, 232, 71, 21,
-    49, 95, 149, 50, 239, 194, 155, 133, 234, 114, 221, 245, 131, 7, 253, 6, 188, 217, 174, 83, 59, 87, 157, 177, 91,
-    57, 229, 214, 29, 90, 44, 205, 22, 78, 232, 129, 52, 27, 237, 63, 251, 109, 176, 49, 190, 211, 193, 50, 72, 245,
-    104, 81, 252, 81, 185, 134, 206, 110, 67, 3, 159, 17, 4, 158, 130, 199, 88, 39, 208, 111, 246, 56, 108, 211, 174,
-    239, 244, 122, 203, 134, 186, 222, 216, 137, 245, 227, 162, 23, 253, 170, 243, 35, 56, 182, 206, 161, 107, 20, 160,
-    200, 163, 55, 111, 146, 232, 114, 44, 0, 221, 155, 42, 219, 129, 189, 168, 24, 207, 201, 140, 168, 83, 124, 53, 146,
-    236, 197, 66, 3, 153, 42, 81, 45, 209, 75, 88, 186, 13, 90, 91, 140, 45, 63, 204, 145, 1, 31, 173, 155, 147, 12,
-    148, 232, 218, 232, 120, 156, 29, 112, 252, 82, 115, 229, 42, 141, 100, 176, 65, 22, 87, 73, 145, 25, 152, 10, 58,
-    112, 197, 145, 117, 82, 58, 137, 5, 111, 225, 219, 239, 38, 118, 64, 81, 49, 76, 208, 237, 174, 27, 164, 79, 201,
-    94, 215, 111, 218, 189, 225, 143, 134, 229, 115, 113, 15, 204, 155, 110, 179, 239, 176, 132, 210, 167, 11, 24, 238,
-    245, 243, 229, 210, 141, 196, 105, 90, 38, 249, 159, 210, 55, 22, 146, 230, 78, 5, 148, 25, 80, 23, 10, 94, 249,
-    180, 229, 102, 193, 201, 209, 223, 166, 255, 120, 93, 6, 63, 183, 142, 77, 115, 235, 157, 127, 159, 99, 6, 92, 5,
-    48, 75, 206, 75, 69, 103, 132, 139, 142, 187, 40, 4, 190, 200, 207, 126, 168, 20, 220, 68, 125, 168, 94, 146, 97,
-    49, 98, 13, 70, 235, 224, 56, 178, 7, 32, 34, 92, 194, 24, 205, 238, 19, 165, 219, 232, 205, 188, 70, 233, 191, 21,
-    122, 25, 40, 111, 25, 101, 251, 8, 212, 176, 124, 170, 225, 226, 91, 0, 30, 107, 167, 148, 224, 22, 198, 99, 199, 1,
-    218, 174, 165, 115, 189, 133, 161, 134, 63, 191, 230, 253, 177, 198, 172, 125, 233, 55, 212, 130, 149, 153, 198,
-    241, 66, 129, 194, 64, 221, 185, 220, 31, 146, 217, 113, 223, 205, 56, 68, 178, 137, 168, 114, 92, 145, 41, 153, 11,
-    232, 146, 132, 24, 184, 215, 58, 47, 77, 67, 174, 192, 235, 143, 91, 164, 202, 39, 253, 218, 241, 66, 48, 117, 131,
-    8, 151, 166, 111, 97, 166, 207, 168, 43, 51, 37, 4, 26, 133, 243, 243, 50, 250, 79, 111, 82, 0, 10, 159, 210, 121,
-    159, 101, 29, 96, 55, 221, 78, 202, 123, 11, 18, 147, 245, 205, 116, 189, 85, 202, 47, 224, 225, 35, 194, 154, 4,
-    113, 230, 103, 115, 125, 180, 225, 102, 115, 136, 174, 191, 218, 149, 237, 112, 193, 214, 32, 166, 115, 93, 252,
-    186, 40, 234, 143, 124, 127, 228, 96, 156, 167, 41, 154, 56, 58, 153, 128, 155, 146, 175, 73, 102, 229, 118, 98, 70,
-    50, 168, 229, 161, 151, 158, 90, 70, 64, 91, 4, 185, 99, 187, 58, 141, 74, 159, 186, 107, 84, 122, 251, 124, 144,
-    159, 181, 237, 124, 163, 185, 92, 19, 238, 82, 133, 153, 70, 127, 175, 145, 180, 141, 221, 20, 235, 226, 202, 90,
-    124, 166, 165, 237, 147, 112, 175, 126, 161, 167, 240, 66, 16, 17, 41, 125, 254, 145, 135, 98, 111, 89, 39, 144,
-    189, 224, 216, 245, 194, 113, 138, 74, 250, 206, 55, 155, 123, 230, 174, 126, 133, 112, 70, 146, 222, 123, 162, 222,
-    47, 151, 67, 2, 170, 201, 43, 63, 91, 54, 16, 219, 27, 112, 141, 253, 214, 15, 85, 181, 53, 132, 250, 237, 204, 110,
-    58, 31, 174, 122, 208, 118, 189, 168, 195, 56, 227, 207, 37, 209, 220, 64, 121, 78, 83, 56, 164, 159, 24, 26, 225,
-    153, 149, 229, 55, 144, 57, 105, 185, 8, 147, 171, 94, 214, 178, 67, 230, 46, 8, 39, 168, 42, 30, 122, 123, 52, 185,
-    130, 186, 82, 41, 38, 194, 232, 229, 251, 130, 27, 3, 20, 148, 232, 86, 194, 210, 150, 42, 109, 186, 128, 82, 238,
-    72, 230, 7, 35, 26, 78, 69, 126, 26, 68, 114, 225, 6, 216, 191, 194, 16, 105, 46, 109, 251, 224, 182, 149, 33, 112,
-    124, 12, 123, 254, 204, 231, 70, 53, 37, 209, 136, 71, 177, 30, 33, 130, 9, 219, 177, 237, 88, 64, 229, 80, 8, 78,
-    212, 66, 171, 98, 31, 36, 38, 230, 14, 246, 253, 62, 253, 133, 241, 26, 92, 25, 135, 107, 168, 69, 48, 106, 121,
-    228, 80, 33, 238, 7, 34, 171, 23, 212, 74, 20, 181, 186, 19, 2, 232, 76, 190, 27, 118, 26, 216, 242, 220, 201, 174,
-    84, 16, 183, 41, 158, 20, 182, 24, 143, 42, 126, 110, 188, 157, 227, 206, 158, 229, 92, 59, 179, 167, 133, 237, 34,
-    148, 53, 142, 135, 183, 68, 53, 92, 32, 190, 144, 58, 160, 56, 128, 192, 174, 149, 179, 168, 202, 62, 142, 98, 109,
-    216, 98, 252, 3, 86, 155, 33, 101, 243, 202, 34, 81, 200, 136, 85, 183, 59, 98, 90, 239, 167, 76, 59, 71, 138, 170,
-    12, 6, 170, 151, 184, 114, 176, 69, 229, 59, 28, 163, 211, 89, 223, 151, 147, 45, 102, 53, 143, 131, 204, 44, 85,
-    237, 100, 97, 235, 130, 132, 108, 149, 93, 33, 8, 236, 209, 247, 181, 224, 169, 147, 119, 199, 154, 213, 196, 39,
-    18, 31, 109, 24, 157, 226, 78, 93, 245, 178, 67, 56, 210, 98, 124, 93, 70, 95, 79, 89, 115, 79, 127, 217, 142, 219,
-    7, 59, 29, 238, 134, 165, 63, 126, 184, 226, 198, 54, 13, 234, 4, 52, 188, 56, 148, 197, 244, 149, 181, 67, 6, 156,
-    221, 146, 197, 237, 64, 198, 4, 146, 62, 220, 140, 187, 218, 11, 21, 207, 178, 122, 192, 201, 236, 244, 102, 98, 74,
-    11, 212, 2, 101, 12, 149, 106, 141, 233, 163, 208, 166, 216, 162, 33, 247, 149, 156, 63, 199, 36, 127, 190, 117, 49,
-    3, 20, 56, 140, 175, 71, 246, 183, 119, 214, 88, 238, 108, 253, 166, 210, 155, 106, 71, 180, 161, 227, 250, 24, 144,
-    152, 18, 132, 56, 181, 237, 214, 178, 126, 197, 84, 55, 233, 174, 247, 230, 106, 22, 134, 209, 199, 1, 204, 225, 44,
-    249, 51, 48, 101, 69, 54, 14, 132, 77, 195, 129, 20, 149, 54, 196, 208, 67, 65, 130, 192, 36, 230, 107, 249, 81, 58,
-    149, 209, 247, 225, 83, 150, 11, 104, 57, 173, 136, 78, 243, 66, 246, 231, 144, 85, 40, 94, 18, 75, 166, 26, 131,
-    26, 24, 181, 4, 71, 183, 182, 247, 41, 141, 162, 30, 154, 246, 171, 58, 145, 63, 75, 182, 209, 58, 227, 138, 90,
-    215, 13, 240, 179, 33, 65, 176, 71, 78, 6, 153, 77, 78, 216, 144, 60, 115, 140, 126, 251, 142, 107, 144, 245, 79,
-    153, 76, 93, 133, 236, 194, 224, 126, 175, 188, 111, 47, 95, 72, 105, 253, 85, 104, 209, 88, 225, 133, 188, 74, 69,
-    5, 96, 122, 38, 160, 175, 58, 208, 169, 7, 254, 43, 132, 221, 145, 7, 239, 211, 63, 51, 228, 166, 37, 62, 18, 178,
-    10, 215, 6, 76, 106, 192, 181, 187, 136, 198, 105, 79, 134, 21, 18, 48, 118, 227, 63, 198, 165, 142, 133, 189, 88,
-    6, 193, 236, 111, 209, 253, 104, 57, 112, 174, 248, 120, 220, 248, 39, 177, 95, 88, 40, 137, 158, 102, 113, 25, 212,
-    46, 252, 80, 121, 68, 190, 207, 10, 210, 36, 174, 159, 54, 4, 208, 209, 176, 157, 133, 27, 69, 156, 178, 165, 252,
-    240, 89, 5, 245, 120, 35, 31, 52, 140, 138, 48, 134, 172, 201, 239, 3, 211, 190, 225, 139, 164, 95, 59, 112, 249,
-    123, 28, 181, 80, 249, 241, 104, 48, 212, 148, 130, 191, 205, 217, 212, 13, 186, 1, 76, 152, 124, 47, 210, 210, 220,
-    159, 91, 29, 244, 169, 114, 162, 220, 197, 73, 38, 0, 168, 169, 3, 243, 153, 80, 104, 38, 1, 234, 57, 215, 146, 93,
-    193, 249, 89, 154, 176, 100, 117, 145, 101, 159, 63, 229, 101, 227, 122, 79, 90, 221, 135, 36, 231, 91, 97, 190, 48,
-    136, 134, 142, 37, 27, 207, 136, 11, 178, 111, 114, 188, 90, 173, 4, 102, 185, 214, 119, 9, 149, 28, 91, 66, 62,
-    183, 187, 11, 216, 207, 159, 136, 138, 167, 234, 108, 182, 226, 167, 65, 116, 193, 115, 56, 41, 151, 183, 167, 89,
-    252, 130, 33, 84, 35, 106, 140, 2, 106, 63, 63, 98, 235, 92, 91, 92, 89, 25, 61, 148, 143, 6, 157, 240, 89, 105,
-    103, 73, 249, 5, 166, 82, 205, 148, 198, 74, 228, 165, 126, 63, 155, 19, 203, 133, 159, 101, 207, 161, 203, 103,
-    191, 157, 14, 80, 174, 118, 242, 100, 175, 44, 97, 255, 35, 99, 42, 13, 69, 44, 192, 110, 134, 124, 31, 91, 157,
-    127, 234, 101, 250, 105, 67, 246, 117, 183, 44, 31, 75, 247, 247, 246, 22, 83, 109, 218, 60, 125, 92, 231, 10, 12,
-    228, 176, 96, 163, 249, 122, 107, 82, 218, 42, 105, 60, 40, 175, 61, 144, 194, 233, 131, 165, 35, 227, 193, 218,
-    226, 225, 197, 181, 110, 146, 190, 127, 3, 24, 11, 164, 41, 199, 197, 21, 220, 81, 134, 174, 158, 1, 105, 43, 199,
-    188, 152, 210, 173, 128, 101, 23, 51, 196, 58, 217, 99, 96, 50, 222, 203, 240, 117, 234, 104, 237, 189, 17, 213,
-    174, 170, 227, 134, 40, 242, 151, 193, 200, 97, 223, 5, 90, 170, 56, 191, 179, 42, 12, 3, 148, 5, 63, 215, 13, 211,
-    67, 251, 42, 179, 7, 66, 52, 148, 209, 1, 4, 171, 102, 76, 39, 175, 49, 176, 166, 200, 228, 89, 221, 138, 180, 228,
-    65, 235, 215, 30, 192, 40, 68, 114, 203, 140, 254, 177, 200, 91, 215, 0, 251, 91, 152, 138, 102, 151, 252, 253, 185,
-    61, 37, 226, 12, 72, 199, 142, 73, 147, 228, 211, 113, 86, 165, 39, 216, 74, 62, 121, 183, 68, 233, 162, 87, 14, 93,
-    72, 147, 85, 181, 215, 243, 32, 169, 194, 153, 167, 235, 42, 246, 241, 190, 173, 54, 165, 119, 36, 249, 20, 192, 12,
-    6, 168, 183, 119, 145, 87, 5, 151, 227, 49, 37, 233, 121, 196, 34, 185, 217, 72, 98, 105, 88, 49, 219, 29, 180, 122,
-    37, 230, 158, 241, 192, 174, 238, 86, 108, 96, 212, 31, 250, 8, 103, 59, 158, 147, 20, 134, 167, 0, 179, 175, 18,
-    243, 4, 135, 57, 49, 162, 58, 99, 49, 178, 237, 105, 222, 133, 174, 253, 86, 1, 17, 3, 195, 27, 71, 0, 168, 40, 183,
-    51, 155, 0, 87, 77, 115, 158, 135, 29, 110, 107, 53, 245, 183, 103, 176, 236, 100, 174, 207, 101, 154, 174, 80, 192,
-    78, 96, 138, 99, 114, 178, 26, 164, 17, 246, 130, 134, 134, 48, 126, 210, 247, 186, 118, 52, 199, 44, 191, 140, 232,
-    237, 251, 187, 23, 70, 62, 235, 187, 45, 99, 241, 184, 131, 65, 234, 255, 233, 142, 216, 78, 174, 79, 181, 189, 208,
-    182, 144, 8, 38, 191, 79, 98, 254, 59, 134, 118, 114, 70, 80, 206, 118, 204, 7, 149, 206, 213, 248, 72, 151, 92,
-    102, 153, 43, 248, 191, 9, 50, 76, 229, 41, 210, 128, 198, 173, 156, 131, 171, 91, 160, 211, 149, 212, 89, 95, 150,
-    160, 19, 111, 143, 89, 191, 14, 213, 100, 246, 67, 105, 73, 140, 13, 195, 251, 237, 62, 159, 114, 108, 145, 67, 230,
-    156, 235, 135, 79, 47, 69, 197, 165, 195, 175, 234, 48, 199, 209, 204, 25, 62, 33, 70, 192, 248, 248, 33, 147, 42,
-    234, 175, 229, 55, 182, 30, 133, 208, 177, 39, 136, 203, 144, 23, 154, 58, 122, 161, 59, 211, 192, 213, 139, 19,
-    139, 106, 196, 240, 234, 124, 63, 193, 126, 195, 80, 155, 253, 147, 251, 173, 132, 190, 74, 88, 254, 230, 84, 140,
-    10, 29, 137, 243, 184, 124, 175, 42, 177, 144, 200, 163, 218, 115, 95, 240, 147, 90, 176, 5, 191, 155, 57, 97, 154,
-    184, 207, 78, 252, 164, 20, 193, 171, 63, 251, 93, 180, 181, 241, 71, 97, 114, 127, 153, 96, 9, 11, 115, 24, 152,
-    92, 136, 73, 95, 181, 187, 79, 5, 248, 244, 133, 234, 85, 154, 51, 51, 104, 29, 22, 112, 85, 91, 77, 82, 239, 138,
-    86, 224, 93, 59, 1, 204, 189, 247, 69, 171, 185, 158, 44, 143, 105, 72, 54, 16, 105, 45, 197, 159, 164, 101, 142,
-    168, 8, 211, 119, 169, 167, 183, 246, 71, 132, 205, 187, 101, 225, 217, 25, 183, 42, 40, 83, 103, 112, 131, 89, 18,
-    148, 136, 213, 76, 9, 150, 144, 202, 47, 138, 81, 41, 36, 216, 249, 86, 104, 108, 100, 163, 8, 82, 160, 193, 115,
-    183, 243, 87, 52, 102, 47, 114, 125, 15, 224, 26, 53, 30, 212, 50, 27, 205, 13, 81, 11, 157, 56, 217, 128, 96, 54,
-    100, 93, 206, 111, 185, 103, 81, 209, 7, 172, 55, 207, 70, 235, 190, 113, 231, 218, 50, 97, 56, 144, 141, 108, 54,
-    183, 118, 244, 204, 161, 238, 102, 58, 225, 56, 18, 239, 81, 146, 161, 32, 152, 148, 251, 0, 134, 221, 210, 174,
-    242, 74, 120, 154, 36, 213, 113, 190, 210, 219, 52, 28, 224, 209, 32, 126, 44, 51, 226, 83, 122, 152, 75, 142, 89,
-    213, 161, 11, 160, 91, 253, 210, 92, 89, 93, 9, 60, 109, 40, 242, 146, 84, 197, 34, 185, 234, 143, 77, 58, 28, 71,
-    166, 8, 226, 85, 30, 2, 105, 35, 126, 209, 114, 53, 218, 15, 11, 135, 108, 151, 171, 26, 246, 250, 222, 187, 167,
-    178, 9, 88, 202, 54, 62, 110, 187, 93, 80, 74, 228, 51, 253, 21, 231, 195, 152, 76, 109, 44, 246, 158, 94, 144, 78,
-    202, 5, 32, 52, 174, 116, 217, 231, 6, 68, 187, 186, 148, 14, 140, 119, 190, 66, 94, 164, 113, 246, 174, 16, 160,
-    122, 185, 201, 195, 20, 191, 57, 215, 232, 249, 196, 170, 113, 167, 93, 146, 109, 246, 103, 228, 194, 159, 214, 30,
-    45, 217, 212, 73, 43, 192, 120, 34, 194, 226, 114, 245, 163, 80, 196, 238, 142, 204, 65, 20, 155, 96, 80, 88, 174,
-    237, 20, 232, 246, 85, 30, 65, 248, 230, 83, 166, 116, 175, 192, 29, 160, 57, 104, 155, 31, 9, 52, 6, 145, 60, 253,
-    184, 50, 58, 60, 135, 189, 68, 4, 107, 55, 22, 239, 223, 226, 97, 157, 83, 17, 87, 116, 101, 192, 12, 244, 144, 136,
-    159, 44, 154, 57, 169, 126, 49, 111, 125, 173, 240, 172, 201, 115, 58, 128, 6, 141, 38, 80, 209, 56, 20, 161, 229,
-    11, 34, 14, 160, 122, 155, 54, 130, 156, 167, 82, 108, 109, 207, 200, 229, 90, 169, 240, 34, 223, 209, 227, 78, 230,
-    165, 99, 91, 217, 96, 156, 120, 159, 47, 137, 108, 109, 216, 128, 235, 126, 191, 88, 107, 150, 23, 164, 106, 79, 77,
-    84, 99, 19, 211, 250, 77, 168, 77, 255, 175, 171, 150, 242, 235, 246, 59, 37, 113, 33, 46, 217, 108, 21, 183, 13,
-    97, 197, 98, 149, 200, 43, 247, 220, 123, 13, 124, 0, 83, 135, 148, 112, 185, 12, 130, 145, 142, 235, 37, 133, 68,
-    77, 102, 152, 167, 73, 216, 226, 96, 151, 250, 132, 99, 48, 83, 131, 236, 65, 196, 150, 27, 128, 132, 22, 235, 229,
-    244, 63, 38, 16, 39, 176, 108, 72, 36, 169, 165, 148, 59, 29, 186, 128, 245, 187, 83, 74, 242, 194, 105, 91, 156,
-    98, 53, 65, 216, 26, 14, 218, 43, 160, 186, 141, 66, 240, 231, 147, 125, 77, 173, 175, 112, 19, 155, 203, 194, 227,
-    173, 64, 104, 176, 204, 246, 237, 132, 174, 255, 85, 161, 224, 236, 234, 127, 228, 21, 173, 26, 20, 103, 224, 24,
-    17, 34, 254, 8, 213, 16, 242, 191, 207, 110, 50, 148, 45, 72, 119, 223, 189, 177, 11, 150, 244, 88, 121, 68, 165,
-    75, 75, 221, 175, 148, 72, 220, 47, 218, 199, 51, 138, 156, 143, 182, 191, 68, 186, 132, 53, 152, 248, 113, 13, 155,
-    201, 64, 145, 66, 123, 255, 209, 126, 238, 155, 223, 124, 21, 153, 54, 39, 223, 87, 242, 156, 8, 176, 99, 165, 215,
-    198, 188, 159, 97, 142, 34, 32, 218, 80, 156, 109, 247, 34, 18, 178, 185, 88, 87, 241, 217, 183, 229, 149, 190, 88,
-    0, 156, 15, 183, 196, 68, 248, 5, 199, 136, 9, 82, 108, 226, 214, 110, 10, 13, 127, 108, 116, 51, 192, 66, 254, 106,
-    241, 17, 194, 135, 17, 234, 68, 16, 100, 181, 202, 40, 86, 9, 67, 172, 51, 78, 111, 213, 156, 74, 240, 219, 22, 186,
-    6, 21, 132, 101, 118, 70, 224, 251, 205, 204, 3, 97, 133, 13, 206, 30, 67, 48, 180, 74, 171, 199, 230, 24, 102, 74,
-    111, 69, 74, 83, 40, 251, 20, 79, 143, 94, 129, 58, 92, 90, 21, 112, 74, 20, 77, 108, 228, 229, 123, 44, 112, 130,
-    113
+    123, 10, 32, 32, 34, 67, 111, 109, 112, 111, 110, 101, 110, 116, 78, 97, 109, 101, 34, 58, 32, 34, 80, 97, 108, 95,
+    80, 108, 97, 116, 102, 111, 114, 109, 34, 44, 10, 32, 32, 34, 68, 114, 105, 118, 101, 114, 83, 116, 97, 116, 101,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 34, 72, 97, 108, 116, 101, 100, 79, 110, 80, 108, 97, 116, 102, 111, 114, 109,
+    73, 110, 105, 116, 34, 10, 32, 32, 93, 44, 10, 32, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 98, 103, 80, 114,
+    105, 110, 116, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 98, 117, 103, 32, 80, 114, 105, 110, 116, 34, 10, 32, 32, 32,
+    32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 52, 50, 48,
+    54, 48, 53, 53, 57, 51, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 115, 116, 114, 117, 99, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 100, 98, 103, 80, 114, 105, 110, 116, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    69, 110, 97, 98, 108, 101, 115, 32, 100, 101, 98, 117, 103, 32, 112, 114, 105, 110, 116, 32, 109, 101, 115, 115, 97,
+    103, 101, 115, 32, 105, 110, 32, 116, 104, 101, 32, 73, 110, 102, 111, 32, 99, 97, 116, 101, 103, 111, 114, 121, 32,
+    91, 68, 98, 103, 80, 114, 105, 110, 116, 67, 97, 116, 73, 110, 102, 111, 77, 115, 103, 93, 46, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 51, 54, 48, 56, 54, 48,
+    53, 53, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108,
+    115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 105, 110, 102, 111, 69, 110, 97, 98, 108, 101, 100,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 110, 102, 111, 69,
+    110, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 100, 101, 98, 117, 103, 32, 112, 114, 105, 110, 116, 32, 109, 101, 115,
+    115, 97, 103, 101, 115, 32, 105, 110, 32, 116, 104, 101, 32, 87, 97, 114, 110, 105, 110, 103, 32, 99, 97, 116, 101,
+    103, 111, 114, 121, 32, 91, 68, 98, 103, 80, 114, 105, 110, 116, 67, 97, 116, 87, 97, 114, 110, 77, 115, 103, 93,
+    46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 56,
+    50, 55, 51, 55, 53, 52, 56, 51, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 114, 110, 105, 110, 103,
+    69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 87, 97, 114, 110, 105, 110, 103, 69, 110, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 100, 101, 98, 117, 103, 32,
+    112, 114, 105, 110, 116, 32, 109, 101, 115, 115, 97, 103, 101, 115, 32, 105, 110, 32, 116, 104, 101, 32, 69, 114,
+    114, 111, 114, 32, 99, 97, 116, 101, 103, 111, 114, 121, 32, 91, 68, 98, 103, 80, 114, 105, 110, 116, 67, 97, 116,
+    69, 114, 114, 111, 114, 77, 115, 103, 93, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 49, 52, 52, 52, 51, 49, 49, 49, 56, 57, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 101, 114, 114, 111, 114, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 114, 114, 111, 114, 69, 110, 97, 98, 108, 101, 100, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32,
+    100, 101, 98, 117, 103, 32, 112, 114, 105, 110, 116, 32, 109, 101, 115, 115, 97, 103, 101, 115, 32, 105, 110, 32,
+    116, 104, 101, 32, 83, 67, 32, 99, 97, 116, 101, 103, 111, 114, 121, 32, 91, 68, 98, 103, 80, 114, 105, 110, 116,
+    67, 97, 116, 83, 99, 77, 115, 103, 93, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 54, 57, 53, 51, 48, 57, 51, 54, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 83, 99, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 83, 99, 69, 110, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 100, 101, 98, 117, 103, 32, 112, 114,
+    105, 110, 116, 32, 109, 101, 115, 115, 97, 103, 101, 115, 32, 105, 110, 32, 116, 104, 101, 32, 69, 118, 101, 110,
+    116, 32, 80, 114, 105, 110, 116, 32, 99, 97, 116, 101, 103, 111, 114, 121, 32, 91, 68, 98, 103, 80, 114, 105, 110,
+    116, 67, 97, 116, 69, 118, 101, 110, 116, 80, 114, 105, 110, 116, 77, 115, 103, 93, 46, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 55, 50, 49, 51, 52, 53, 55, 49, 52, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 118, 101, 110, 116, 80, 114, 105, 110, 116, 69, 110, 97, 98, 108,
+    101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 118, 101,
+    110, 116, 80, 114, 105, 110, 116, 69, 110, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 100, 101, 98, 117, 103, 32, 112, 114,
+    105, 110, 116, 32, 109, 101, 115, 115, 97, 103, 101, 115, 32, 105, 110, 32, 116, 104, 101, 32, 69, 118, 101, 110,
+    116, 32, 80, 114, 105, 110, 116, 32, 67, 97, 108, 108, 98, 97, 99, 107, 32, 99, 97, 116, 101, 103, 111, 114, 121,
+    32, 91, 68, 98, 103, 80, 114, 105, 110, 116, 67, 97, 116, 69, 118, 101, 110, 116, 80, 114, 105, 110, 116, 67, 97,
+    108, 108, 98, 97, 99, 107, 77, 115, 103, 93, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 50, 50, 48, 51, 55, 52, 50, 49, 51, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111,
+    108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 101, 118, 101, 110, 116, 80, 114, 105, 110, 116, 67, 98, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 118, 101, 110, 116, 80, 114, 105,
+    110, 116, 67, 98, 69, 110, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32,
+    32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    67, 111, 110, 116, 114, 111, 108, 115, 32, 100, 101, 98, 117, 103, 32, 112, 114, 105, 110, 116, 32, 99, 97, 116,
+    101, 103, 111, 114, 121, 32, 101, 110, 97, 98, 108, 101, 47, 100, 105, 115, 97, 98, 108, 101, 46, 34, 10, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 115,
+    115, 101, 114, 116, 115, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 65, 115, 115, 101, 114, 116, 115, 32, 97, 110, 100, 32, 65,
+    108, 101, 114, 116, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 49, 49, 49, 48, 54, 48, 53, 48, 48, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 115, 115, 101, 114, 116, 115, 69, 110, 97,
+    98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 100, 114, 105, 118, 101, 114, 32, 97, 115, 115, 101, 114, 116, 115,
+    46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 65, 108, 101, 114, 116, 115, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 65, 115, 115, 101, 114, 116, 115, 32, 97, 110,
+    100, 32, 65, 108, 101, 114, 116, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 51, 51, 48, 48, 52, 56, 53, 57, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 108, 101, 114, 116, 115, 69, 110,
+    97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 100, 114, 105, 118, 101, 114, 32, 97, 108, 101, 114, 116, 115,
+    46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 98, 117,
+    103, 32, 79, 118, 101, 114, 108, 97, 121, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 54, 50, 49, 54, 51, 56, 48, 49, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 101, 98, 117, 103, 79, 118,
+    101, 114, 108, 97, 121, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 100, 101,
+    98, 117, 103, 32, 111, 118, 101, 114, 108, 97, 121, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97,
+    121, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 98, 117, 103, 32, 79, 118, 101, 114, 108, 97, 121, 34, 10, 32, 32, 32, 32,
+    32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 50, 49, 53, 52,
+    52, 51, 53, 50, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 69, 110, 97, 98, 108, 101, 100, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99,
+    116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    100, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87,
+    114, 105, 116, 101, 115, 32, 100, 101, 98, 117, 103, 32, 111, 118, 101, 114, 108, 97, 121, 32, 105, 110, 102, 111,
+    114, 109, 97, 116, 105, 111, 110, 32, 116, 111, 32, 116, 104, 101, 32, 115, 99, 114, 101, 101, 110, 46, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 49, 49, 54, 49, 54,
+    53, 51, 51, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116,
+    114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 118, 105, 115, 117, 97, 108, 67, 111, 110, 102,
+    105, 114, 109, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 86, 105, 115, 117, 97, 108, 67, 111, 110, 102, 105, 114, 109, 69, 110, 97, 98, 108, 101, 100,
+    34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 114, 97, 119, 115,
+    32, 116, 104, 101, 32, 116, 105, 109, 101, 103, 114, 97, 112, 104, 32, 116, 111, 32, 116, 104, 101, 32, 115, 99,
+    114, 101, 101, 110, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 50, 52, 56, 53, 56, 56, 55, 55, 56, 51, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 105,
+    109, 101, 71, 114, 97, 112, 104, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 109, 101, 71, 114, 97, 112, 104, 69, 110, 97, 98, 108, 101, 100, 34,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 85, 112, 112, 101, 114, 76, 101, 102, 116,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 85, 112, 112, 101, 114, 82, 105, 103, 104, 116,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 76, 111, 119, 101, 114, 82, 105, 103, 104, 116,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    50, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 76, 111, 119, 101, 114, 76, 101, 102, 116, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 67, 111, 117, 110, 116, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114,
+    108, 97, 121, 76, 111, 99, 97, 116, 105, 111, 110, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114,
+    108, 97, 121, 76, 111, 99, 97, 116, 105, 111, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 56, 56, 57, 57, 52, 52, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114, 108, 97, 121, 76,
+    111, 119, 101, 114, 76, 101, 102, 116, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 111, 118, 101, 114,
+    108, 97, 121, 76, 111, 99, 97, 116, 105, 111, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 99, 97, 116, 105, 111, 110, 32, 116, 111, 32,
+    100, 105, 115, 112, 108, 97, 121, 32, 100, 101, 98, 117, 103, 32, 116, 101, 120, 116, 46, 34, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 110, 102, 111, 114, 109, 97, 116, 105, 111,
+    110, 32, 97, 98, 111, 117, 116, 32, 116, 104, 101, 32, 99, 108, 105, 101, 110, 116, 32, 112, 101, 114, 102, 111,
+    114, 109, 105, 110, 103, 32, 116, 104, 101, 32, 114, 101, 110, 100, 101, 114, 105, 110, 103, 46, 32, 70, 111, 114,
+    32, 101, 120, 97, 109, 112, 108, 101, 58, 32, 82, 101, 110, 100, 101, 114, 101, 100, 32, 66, 121, 32, 80, 65, 76,
+    32, 40, 48, 46, 48, 46, 49, 41, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 51, 57, 54, 53, 56, 49, 55, 52, 53, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 77, 105, 115, 99, 83, 116, 114,
+    76, 101, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116,
+    114, 105, 110, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 114, 101, 110, 100, 101, 114, 101, 100, 66, 121, 83, 116, 114, 105, 110, 103, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 101, 110, 100, 101, 114, 101,
+    100, 66, 121, 83, 116, 114, 105, 110, 103, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 68, 101, 98, 117, 103, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 116, 104,
+    97, 116, 32, 116, 104, 101, 32, 99, 108, 105, 101, 110, 116, 32, 111, 114, 32, 116, 101, 115, 116, 101, 114, 32,
+    109, 105, 103, 104, 116, 32, 119, 97, 110, 116, 32, 114, 101, 112, 111, 114, 116, 101, 100, 46, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 52, 53, 50, 53, 49, 57,
+    49, 51, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 34, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 105, 122, 101, 34,
+    58, 32, 34, 77, 97, 120, 77, 105, 115, 99, 83, 116, 114, 76, 101, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 105, 115, 99, 101, 108,
+    108, 97, 110, 101, 111, 117, 115, 68, 101, 98, 117, 103, 83, 116, 114, 105, 110, 103, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 105, 115, 99, 101, 108, 108, 97, 110, 101, 111,
+    117, 115, 68, 101, 98, 117, 103, 83, 116, 114, 105, 110, 103, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 79, 117, 116, 112, 117, 116, 32, 99, 117, 114, 114, 101, 110, 116, 32, 102,
+    114, 97, 109, 101, 32, 110, 117, 109, 98, 101, 114, 32, 105, 110, 32, 116, 104, 101, 32, 100, 101, 98, 117, 103, 32,
+    111, 118, 101, 114, 108, 97, 121, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 51, 55, 57, 56, 53, 48, 52, 52, 52, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 112, 114, 105, 110, 116, 70, 114, 97, 109, 101, 78, 117, 109, 98, 101, 114, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 114, 105, 110, 116, 70, 114, 97, 109, 101, 78, 117,
+    109, 98, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111,
+    108, 115, 32, 119, 104, 97, 116, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 105, 115, 32, 100,
+    105, 115, 112, 108, 97, 121, 101, 100, 32, 111, 110, 32, 116, 104, 101, 32, 68, 101, 98, 117, 103, 32, 79, 118, 101,
+    114, 108, 97, 121, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 84, 105, 109, 101, 71, 114, 97, 112, 104, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 98, 117,
+    103, 32, 79, 118, 101, 114, 108, 97, 121, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 49, 48, 49, 53, 53, 48, 49, 57, 56, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101,
+    116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101,
+    114, 108, 97, 121, 69, 110, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 105, 109, 101, 71, 114, 97, 112, 104, 67, 111,
+    110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32,
+    91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100,
+    86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69,
+    110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 66, 108, 97, 99, 107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 66, 108, 97, 99, 107, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 82, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 82, 101, 100, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71,
+    114, 101, 101, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 71, 114, 101, 101, 110, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    66, 108, 117, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 51, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 66, 108, 117, 101, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 89,
+    101, 108, 108, 111, 119, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 89, 101, 108, 108, 111, 119, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 67, 121, 97, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 108, 117, 101, 34, 58, 32, 53, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 67, 121, 97, 110, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 77, 97, 103, 101, 110, 116, 97, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 54, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 103, 101, 110, 116, 97, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 87, 104, 105, 116, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 55, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 104, 105, 116, 101, 67, 111, 108, 111, 114, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 109, 101, 71, 114,
+    97, 112, 104, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 114, 105, 100, 76, 105, 110, 101, 67, 111, 108,
+    111, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    50, 55, 55, 52, 51, 51, 56, 49, 52, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 34, 82, 101, 100, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    103, 114, 105, 100, 76, 105, 110, 101, 67, 111, 108, 111, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 108, 111, 114, 32, 111, 102, 32,
+    116, 104, 101, 32, 103, 114, 105, 100, 32, 108, 105, 110, 101, 32, 105, 110, 32, 116, 104, 101, 32, 116, 105, 109,
+    101, 32, 103, 114, 97, 112, 104, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 108, 97, 99, 107, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 108,
+    97, 99, 107, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 100, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 101, 100, 67,
+    111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 114, 101, 101, 110, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 114, 101, 101, 110, 67,
+    111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 108, 117, 101, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 108, 117, 101, 67, 111, 108,
+    111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 89, 101, 108, 108, 111, 119, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 89, 101, 108, 108, 111, 119,
+    67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 121, 97, 110, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 53, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 121, 97, 110, 67, 111,
+    108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 103, 101, 110, 116, 97, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 54, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 103, 101, 110,
+    116, 97, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 105, 116, 101, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 55, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 104, 105,
+    116, 101, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 84, 105, 109, 101, 71, 114, 97, 112, 104, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67,
+    112, 117, 76, 105, 110, 101, 67, 111, 108, 111, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 53, 57, 51, 51, 53, 56, 57, 51, 54, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 89, 101, 108, 108, 111, 119, 67, 111, 108, 111, 114,
+    34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 112, 117, 76, 105, 110, 101, 67, 111, 108, 111, 114,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 67, 111, 108, 111, 114, 32, 111, 102, 32, 116, 104, 101, 32, 67, 80, 85, 32, 108, 105, 110, 101, 32, 105,
+    110, 32, 116, 104, 101, 32, 116, 105, 109, 101, 32, 103, 114, 97, 112, 104, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 66, 108, 97, 99, 107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 66, 108, 97, 99, 107, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 82, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 82, 101, 100, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71,
+    114, 101, 101, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 71, 114, 101, 101, 110, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    66, 108, 117, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 51, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 66, 108, 117, 101, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 89,
+    101, 108, 108, 111, 119, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 89, 101, 108, 108, 111, 119, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 67, 121, 97, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 108, 117, 101, 34, 58, 32, 53, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 67, 121, 97, 110, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 77, 97, 103, 101, 110, 116, 97, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 54, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 103, 101, 110, 116, 97, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 87, 104, 105, 116, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 55, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 104, 105, 116, 101, 67, 111, 108, 111, 114, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 109, 101, 71, 114,
+    97, 112, 104, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 76, 105, 110, 101, 67, 111, 108, 111,
+    114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 54, 56,
+    51, 56, 52, 56, 49, 51, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 34, 71, 114, 101, 101, 110, 67, 111, 108, 111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    103, 112, 117, 76, 105, 110, 101, 67, 111, 108, 111, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 108, 111, 114, 32, 111, 102, 32, 116,
+    104, 101, 32, 71, 80, 85, 32, 108, 105, 110, 101, 32, 105, 110, 32, 116, 104, 101, 32, 116, 105, 109, 101, 32, 103,
+    114, 97, 112, 104, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 105, 109, 101, 32, 71,
+    114, 97, 112, 104, 32, 100, 105, 115, 112, 108, 97, 121, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105,
+    111, 110, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 79, 118, 101, 114, 108, 97, 121, 66, 101, 110, 99, 104, 109, 97, 114, 107, 67, 111, 110, 102,
+    105, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 98, 117, 103, 32, 79, 118, 101, 114, 108, 97, 121, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 55, 48, 56, 53, 50, 57, 52, 48, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98,
+    117, 103, 79, 118, 101, 114, 108, 97, 121, 69, 110, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 111, 118, 101, 114, 108,
+    97, 121, 66, 101, 110, 99, 104, 109, 97, 114, 107, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110,
+    100, 32, 98, 101, 110, 99, 104, 109, 97, 114, 107, 32, 97, 102, 116, 101, 114, 32, 115, 112, 101, 99, 105, 102, 105,
+    101, 100, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 115, 101, 99, 111, 110, 100, 115, 46, 32, 32, 84, 104,
+    101, 32, 98, 101, 110, 99, 104, 109, 97, 114, 107, 32, 99, 97, 110, 32, 115, 116, 105, 108, 108, 32, 98, 101, 32,
+    101, 110, 100, 101, 100, 32, 101, 97, 114, 108, 121, 32, 98, 121, 32, 104, 105, 116, 116, 105, 110, 103, 32, 70, 49,
+    49, 46, 32, 32, 65, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 48, 32, 119, 105, 108, 108, 32, 97, 108, 108, 111,
+    119, 32, 116, 104, 101, 32, 98, 101, 110, 99, 104, 109, 97, 114, 107, 32, 116, 111, 32, 114, 117, 110, 32, 102, 111,
+    114, 101, 118, 101, 114, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 49, 54, 49, 51, 56, 54, 53, 56, 52, 53, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 66,
+    101, 110, 99, 104, 109, 97, 114, 107, 84, 105, 109, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 66, 101, 110, 99, 104, 109, 97, 114, 107, 84, 105, 109, 101, 34, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 116, 104, 101, 114,
+    32, 111, 114, 32, 110, 111, 116, 32, 97, 32, 108, 111, 103, 32, 101, 110, 116, 114, 121, 32, 111, 102, 32, 80, 65,
+    76, 32, 117, 115, 97, 103, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 103, 101, 110, 101, 114, 97, 116, 101, 100,
+    32, 116, 111, 32, 100, 105, 115, 107, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 49, 52, 51, 57, 48, 48, 48, 48, 50, 57, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 117, 115, 97, 103, 101, 76, 111, 103, 69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 115, 97, 103, 101, 76, 111, 103, 69, 110, 97, 98, 108, 101, 34,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 108, 97, 116, 105,
+    118, 101, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 119, 104, 101, 114, 101, 32, 117, 115, 97, 103, 101,
+    32, 108, 111, 103, 115, 32, 97, 114, 101, 32, 112, 108, 97, 99, 101, 100, 46, 32, 82, 101, 108, 97, 116, 105, 118,
+    101, 32, 116, 111, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 110, 32, 116, 104, 101, 32, 65, 77, 68, 95,
+    68, 69, 66, 85, 71, 95, 68, 73, 82, 32, 101, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 118, 97, 114,
+    105, 97, 98, 108, 101, 46, 32, 73, 102, 32, 116, 104, 97, 116, 32, 101, 110, 118, 32, 118, 97, 114, 32, 105, 115,
+    110, 39, 116, 32, 115, 101, 116, 44, 32, 116, 104, 101, 32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105, 115, 32,
+    112, 108, 97, 116, 102, 111, 114, 109, 32, 100, 101, 112, 101, 110, 100, 101, 110, 116, 46, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 52, 53, 53, 49, 53, 53, 56,
+    57, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 80, 97, 116, 104, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 87, 105,
+    110, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108, 76, 111, 103, 92, 92, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 76, 110, 120, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100,
+    112, 97, 108, 47, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116, 114, 76, 101, 110, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 117, 115, 97, 103, 101, 76, 111, 103, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 115, 97, 103, 101, 76, 111, 103, 68, 105, 114, 101,
+    99, 116, 111, 114, 121, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    70, 105, 108, 101, 110, 97, 109, 101, 32, 97, 110, 100, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 111,
+    102, 32, 116, 104, 101, 32, 117, 115, 97, 103, 101, 32, 108, 111, 103, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 53, 55, 48, 56, 56, 55, 56, 57, 57, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108, 85, 115, 97, 103, 101,
+    76, 111, 103, 46, 116, 120, 116, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116, 114, 76, 101,
+    110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105,
+    110, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 117, 115, 97, 103, 101, 76, 111, 103, 70, 105, 108, 101, 110, 97, 109, 101, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 115, 97, 103, 101, 76, 111, 103, 70, 105,
+    108, 101, 110, 97, 109, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 76, 111, 103, 32, 102, 114, 97, 109, 101, 32, 116, 105, 109, 101, 32, 97, 110, 100, 32, 97, 118, 101, 114,
+    97, 103, 101, 32, 70, 80, 83, 32, 100, 117, 114, 105, 110, 103, 32, 98, 101, 110, 99, 104, 109, 97, 114, 107, 32,
+    115, 101, 115, 115, 105, 111, 110, 32, 116, 111, 32, 102, 105, 108, 101, 115, 46, 32, 79, 110, 108, 121, 32, 101,
+    110, 97, 98, 108, 101, 100, 32, 119, 104, 101, 110, 32, 68, 101, 98, 117, 103, 86, 105, 115, 117, 97, 108, 68, 105,
+    115, 112, 108, 97, 121, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 56, 57, 51, 51, 50, 54, 56, 53, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 70, 114, 97, 109, 101, 83, 116, 97, 116, 115, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 70, 114, 97, 109, 101,
+    83, 116, 97, 116, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82,
+    101, 108, 97, 116, 105, 118, 101, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 119, 104, 101, 114, 101, 32,
+    102, 114, 97, 109, 101, 32, 115, 116, 97, 116, 105, 115, 116, 105, 99, 32, 108, 111, 103, 115, 32, 97, 114, 101, 32,
+    112, 108, 97, 99, 101, 100, 46, 32, 82, 101, 108, 97, 116, 105, 118, 101, 32, 116, 111, 32, 116, 104, 101, 32, 112,
+    97, 116, 104, 32, 105, 110, 32, 116, 104, 101, 32, 65, 77, 68, 95, 68, 69, 66, 85, 71, 95, 68, 73, 82, 32, 101, 110,
+    118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 118, 97, 114, 105, 97, 98, 108, 101, 46, 32, 73, 102, 32, 116, 104,
+    97, 116, 32, 101, 110, 118, 32, 118, 97, 114, 32, 105, 115, 110, 39, 116, 32, 115, 101, 116, 44, 32, 116, 104, 101,
+    32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105, 115, 32, 112, 108, 97, 116, 102, 111, 114, 109, 32, 100, 101,
+    112, 101, 110, 100, 101, 110, 116, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 49, 49, 50, 56, 52, 50, 51, 52, 48, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 80, 97,
+    116, 104, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 87, 105, 110, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34,
+    80, 97, 108, 76, 111, 103, 92, 92, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 76, 110, 120, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80,
+    97, 116, 104, 83, 116, 114, 76, 101, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 114, 97, 109, 101, 83, 116, 97, 116, 115, 76, 111,
+    103, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 70, 114, 97, 109, 101, 83, 116, 97, 116, 115, 76, 111, 103, 68, 105, 114, 101, 99, 116, 111,
+    114, 121, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120,
+    32, 109, 117, 109, 98, 101, 114, 32, 111, 102, 32, 102, 114, 97, 109, 101, 32, 116, 105, 109, 101, 32, 115, 97, 109,
+    112, 108, 101, 115, 32, 116, 104, 97, 116, 32, 99, 97, 110, 32, 98, 101, 32, 108, 111, 103, 103, 101, 100, 32, 105,
+    110, 32, 97, 32, 98, 101, 110, 99, 104, 109, 97, 114, 107, 32, 115, 101, 115, 115, 105, 111, 110, 46, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 52, 55, 52, 53,
+    50, 52, 55, 51, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 54,
+    53, 53, 51, 54, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 76, 111, 103, 103, 101, 100,
+    70, 114, 97, 109, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 77, 97, 120, 76, 111, 103, 103, 101, 100, 70, 114, 97, 109, 101, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 68, 101, 98, 117, 103, 32, 79, 118, 101, 114, 108, 97, 121, 32, 66, 101, 110, 99, 104,
+    109, 97, 114, 107, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 46, 34, 10, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 118, 101,
+    114, 108, 97, 121, 77, 101, 109, 111, 114, 121, 73, 110, 102, 111, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 98, 117, 103,
+    32, 79, 118, 101, 114, 108, 97, 121, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 53, 48, 56, 50, 55, 49, 48, 50, 50, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116,
+    116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 98, 117, 103, 79, 118, 101, 114,
+    108, 97, 121, 69, 110, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 111, 118, 101, 114, 108, 97, 121, 77, 101, 109, 111, 114,
+    121, 73, 110, 102, 111, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 116, 114, 117, 99,
+    116, 117, 114, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 104, 101, 32, 116,
+    111, 116, 97, 108, 32, 109, 101, 109, 111, 114, 121, 32, 97, 108, 108, 111, 99, 97, 116, 101, 100, 32, 102, 114,
+    111, 109, 32, 116, 104, 101, 32, 116, 119, 111, 32, 110, 111, 110, 45, 108, 111, 99, 97, 108, 32, 104, 101, 97, 112,
+    115, 32, 115, 104, 111, 117, 108, 100, 32, 98, 101, 32, 115, 104, 111, 119, 110, 32, 105, 110, 32, 97, 32, 115, 105,
+    110, 103, 108, 101, 32, 108, 105, 110, 101, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 49, 52, 49, 50, 56, 56, 57, 49, 53, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 99, 111, 109, 98, 105, 110, 101, 78, 111, 110, 76, 111, 99, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 111, 109, 98, 105, 110, 101, 78, 111, 110, 76, 111, 99, 97,
+    108, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116, 101,
+    114, 109, 105, 110, 101, 115, 32, 105, 102, 32, 116, 104, 101, 32, 111, 118, 101, 114, 108, 97, 121, 32, 119, 105,
+    108, 108, 32, 114, 101, 112, 111, 114, 116, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 97, 98,
+    111, 117, 116, 32, 67, 109, 100, 65, 108, 108, 111, 99, 97, 116, 111, 114, 32, 97, 108, 108, 111, 99, 97, 116, 105,
+    111, 110, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 56, 49, 57, 48, 54, 50, 56, 55, 54, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 114, 101, 112, 111,
+    114, 116, 67, 109, 100, 65, 108, 108, 111, 99, 97, 116, 111, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 101, 112, 111, 114, 116, 67, 109, 100, 65, 108, 108, 111, 99, 97, 116,
+    111, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116,
+    101, 114, 109, 105, 110, 101, 115, 32, 105, 102, 32, 116, 104, 101, 32, 111, 118, 101, 114, 108, 97, 121, 32, 119,
+    105, 108, 108, 32, 114, 101, 112, 111, 114, 116, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 97,
+    98, 111, 117, 116, 32, 101, 120, 116, 101, 114, 110, 97, 108, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110,
+    115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49,
+    50, 49, 49, 52, 52, 57, 51, 51, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 114, 101, 112, 111, 114, 116, 69,
+    120, 116, 101, 114, 110, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 82, 101, 112, 111, 114, 116, 69, 120, 116, 101, 114, 110, 97, 108, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116, 101, 114, 109, 105, 110, 101, 115, 32, 105, 102,
+    32, 116, 104, 101, 32, 111, 118, 101, 114, 108, 97, 121, 32, 119, 105, 108, 108, 32, 114, 101, 112, 111, 114, 116,
+    32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 97, 98, 111, 117, 116, 32, 105, 110, 116, 101, 114,
+    110, 97, 108, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 55, 51, 56, 57, 56, 56, 52, 48, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 114, 101, 112, 111, 114, 116, 73, 110, 116, 101, 114, 110, 97, 108, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 101, 112, 111, 114, 116, 73, 110, 116,
+    101, 114, 110, 97, 108, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 102, 105,
+    103, 117, 114, 101, 115, 32, 116, 104, 101, 32, 109, 101, 109, 111, 114, 121, 32, 117, 115, 97, 103, 101, 32, 100,
+    105, 115, 112, 108, 97, 121, 32, 111, 110, 32, 116, 104, 101, 32, 68, 101, 98, 117, 103, 32, 79, 118, 101, 114, 108,
+    97, 121, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117,
+    101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 68, 105, 115,
+    97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114, 32, 68, 105, 115, 97, 98, 108, 101,
+    100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111,
+    102, 105, 108, 101, 114, 67, 111, 117, 110, 116, 101, 114, 65, 110, 100, 84, 105, 109, 105, 110, 103, 79, 110, 108,
+    121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 84, 114, 97, 99, 101, 115, 32, 97, 114, 101, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 98, 117, 116, 32,
+    112, 101, 114, 102, 32, 99, 111, 117, 110, 116, 101, 114, 32, 97, 110, 100, 32, 116, 105, 109, 105, 110, 103, 32,
+    111, 112, 101, 114, 97, 116, 105, 111, 110, 115, 32, 97, 114, 101, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108,
+    101, 114, 84, 114, 97, 99, 101, 69, 110, 97, 98, 108, 101, 100, 84, 116, 118, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114, 97, 99, 101, 115, 32, 40,
+    83, 112, 109, 32, 97, 110, 100, 47, 111, 114, 32, 83, 113, 116, 116, 41, 32, 97, 114, 101, 32, 111, 117, 116, 112,
+    117, 116, 32, 105, 110, 32, 102, 111, 114, 109, 97, 116, 32, 40, 46, 99, 115, 118, 44, 32, 46, 111, 117, 116, 41,
+    32, 102, 111, 114, 32, 84, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 32, 118, 105, 101, 119, 101, 114, 46,
+    34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102,
+    105, 108, 101, 114, 84, 114, 97, 99, 101, 69, 110, 97, 98, 108, 101, 100, 82, 103, 112, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114, 97, 99, 101, 32,
+    100, 97, 116, 97, 32, 40, 83, 112, 109, 32, 97, 110, 100, 47, 111, 114, 32, 83, 113, 116, 116, 41, 32, 105, 115, 32,
+    111, 117, 116, 112, 117, 116, 32, 97, 115, 32, 46, 114, 103, 112, 32, 102, 105, 108, 101, 32, 102, 111, 114, 32, 82,
+    97, 100, 101, 111, 110, 32, 71, 112, 117, 32, 80, 114, 111, 102, 105, 108, 101, 114, 46, 34, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 77, 111, 100, 101, 34, 10, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114,
+    111, 102, 105, 108, 101, 114, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114, 34, 10, 32,
+    32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 52,
+    57, 48, 48, 56, 53, 52, 49, 53, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 71, 112, 117, 80,
+    114, 111, 102, 105, 108, 101, 114, 68, 105, 115, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75,
+    101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 80,
+    114, 111, 102, 105, 108, 101, 114, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 97, 110, 100, 32, 115, 101, 116,
+    115, 32, 116, 104, 101, 32, 83, 81, 84, 84, 32, 109, 111, 100, 101, 32, 102, 111, 114, 32, 116, 104, 101, 32, 71,
+    80, 85, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 112, 114, 111, 102, 105, 108, 101, 114, 32,
+    108, 97, 121, 101, 114, 46, 32, 32, 65, 99, 116, 117, 97, 108, 32, 99, 97, 112, 116, 117, 114, 101, 32, 111, 102,
+    32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 100, 97, 116, 97, 32, 109, 117, 115, 116, 32, 98, 101,
+    32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 118, 105, 97, 32, 102, 114, 97, 109, 101, 32, 110, 117, 109, 98,
+    101, 114, 32, 119, 105, 116, 104, 32, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 67, 111, 110, 102, 105,
+    103, 46, 83, 116, 97, 114, 116, 70, 114, 97, 109, 101, 32, 111, 114, 32, 98, 121, 32, 104, 111, 108, 100, 105, 110,
+    103, 32, 115, 104, 105, 102, 116, 45, 70, 49, 49, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114,
+    84, 111, 107, 101, 110, 65, 108, 108, 111, 99, 97, 116, 111, 114, 83, 105, 122, 101, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 80, 85, 32, 80, 114, 111, 102,
+    105, 108, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 50, 55, 49, 54, 49, 56, 51, 49, 56, 51, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112,
+    101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116, 116, 105, 110,
+    103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114,
+    111, 102, 105, 108, 101, 114, 77, 111, 100, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 34, 52, 42, 49, 48, 50, 52, 42, 49, 48, 50, 52, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 105, 122, 101, 95, 116, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 80,
+    114, 111, 102, 105, 108, 101, 114, 84, 111, 107, 101, 110, 65, 108, 108, 111, 99, 97, 116, 111, 114, 83, 105, 122,
+    101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    66, 97, 116, 99, 104, 101, 100, 32, 99, 109, 100, 32, 98, 117, 102, 102, 101, 114, 32, 116, 111, 107, 101, 110, 32,
+    115, 105, 122, 101, 32, 119, 105, 116, 104, 32, 51, 50, 32, 98, 105, 116, 32, 98, 117, 105, 108, 100, 32, 119, 104,
+    101, 110, 32, 71, 80, 85, 32, 112, 114, 111, 102, 105, 108, 101, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100,
+    46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 80, 85, 32, 80,
+    114, 111, 102, 105, 108, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 51, 54, 49, 52, 54, 52, 50, 50, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116,
+    116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104,
+    97, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112,
+    117, 80, 114, 111, 102, 105, 108, 101, 114, 77, 111, 100, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 80, 114, 111, 102, 105,
+    108, 101, 114, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 116, 114, 117, 99, 116, 117,
+    114, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 108, 97, 116, 105, 118, 101, 32, 100,
+    105, 114, 101, 99, 116, 111, 114, 121, 32, 119, 104, 101, 114, 101, 32, 71, 80, 85, 32, 112, 114, 111, 102, 105,
+    108, 101, 114, 32, 108, 111, 103, 115, 32, 97, 114, 101, 32, 119, 114, 105, 116, 116, 101, 110, 46, 32, 82, 101,
+    108, 97, 116, 105, 118, 101, 32, 116, 111, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 110, 32, 116, 104,
+    101, 32, 65, 77, 68, 95, 68, 69, 66, 85, 71, 95, 68, 73, 82, 32, 101, 110, 118, 105, 114, 111, 110, 109, 101, 110,
+    116, 32, 118, 97, 114, 105, 97, 98, 108, 101, 46, 32, 73, 102, 32, 116, 104, 97, 116, 32, 101, 110, 118, 32, 118,
+    97, 114, 32, 105, 115, 110, 39, 116, 32, 115, 101, 116, 44, 32, 116, 104, 101, 32, 108, 111, 99, 97, 116, 105, 111,
+    110, 32, 105, 115, 32, 112, 108, 97, 116, 102, 111, 114, 109, 32, 100, 101, 112, 101, 110, 100, 101, 110, 116, 46,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 55, 56,
+    54, 49, 57, 55, 51, 55, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 80, 97, 116, 104, 34, 58, 32, 116, 114, 117,
+    101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 87, 105, 110, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108, 76, 111, 103, 92, 92,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 76, 110, 120, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116, 114, 76,
+    101, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114,
+    105, 110, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 108, 111, 103, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 68, 105, 114, 101, 99, 116, 111, 114, 121,
+    34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 114, 97, 109, 101,
+    32, 110, 117, 109, 98, 101, 114, 32, 116, 111, 32, 98, 101, 103, 105, 110, 32, 112, 101, 114, 102, 111, 114, 109,
+    97, 110, 99, 101, 32, 100, 97, 116, 97, 32, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 46, 32, 67, 117, 114,
+    114, 101, 110, 116, 108, 121, 32, 71, 112, 117, 32, 80, 114, 111, 102, 105, 108, 101, 114, 32, 100, 111, 101, 115,
+    110, 39, 116, 32, 115, 117, 112, 112, 111, 114, 116, 32, 112, 114, 111, 102, 105, 108, 105, 110, 103, 32, 102, 114,
+    97, 109, 101, 32, 48, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 51, 50, 56, 49, 57, 52, 49, 50, 54, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 116, 97, 114,
+    116, 70, 114, 97, 109, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 83, 116, 97, 114, 116, 70, 114, 97, 109, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 78, 117, 109, 98, 101, 114, 32, 111, 102, 32, 102, 114, 97, 109, 101, 115, 32, 116, 111,
+    32, 101, 110, 97, 98, 108, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 100, 97, 116, 97, 32,
+    99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 56, 57, 57, 55, 51, 53, 49, 50, 51, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 102, 114, 97, 109, 101, 67, 111, 117, 110, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 70, 114, 97, 109, 101, 67, 111, 117, 110, 116, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 114, 101, 99, 111, 114, 100, 105,
+    110, 103, 32, 111, 102, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 115, 116, 97, 116, 115, 32, 102, 111, 114,
+    32, 101, 97, 99, 104, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 32, 111, 110, 32, 116, 104, 101, 32, 99, 111,
+    109, 112, 117, 116, 101, 32, 111, 114, 32, 117, 110, 105, 118, 101, 114, 115, 97, 108, 32, 113, 117, 101, 117, 101,
+    46, 32, 69, 110, 97, 98, 108, 105, 110, 103, 32, 116, 104, 105, 115, 32, 109, 97, 121, 32, 97, 100, 118, 101, 114,
+    115, 101, 108, 121, 32, 97, 102, 102, 101, 99, 116, 32, 113, 117, 97, 108, 105, 116, 121, 32, 111, 102, 32, 116,
+    104, 101, 32, 71, 80, 85, 32, 116, 105, 109, 105, 110, 103, 32, 100, 97, 116, 97, 46, 32, 32, 78, 111, 116, 32, 115,
+    117, 112, 112, 111, 114, 116, 101, 100, 32, 102, 111, 114, 32, 102, 114, 97, 109, 101, 45, 103, 114, 97, 110, 117,
+    108, 97, 114, 105, 116, 121, 32, 99, 97, 112, 116, 117, 114, 101, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 50, 50, 53, 55, 54, 51, 56, 51, 53, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 114, 101, 99, 111, 114, 100, 80, 105, 112, 101, 108, 105, 110, 101, 83, 116,
+    97, 116, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 101, 99,
+    111, 114, 100, 80, 105, 112, 101, 108, 105, 110, 101, 83, 116, 97, 116, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 112, 108, 105, 116, 32, 117, 112, 32, 73, 81, 117, 101, 117,
+    101, 58, 58, 83, 117, 98, 109, 105, 116, 40, 41, 32, 99, 97, 108, 108, 115, 32, 115, 111, 32, 116, 104, 97, 116, 32,
+    116, 104, 101, 32, 80, 65, 76, 32, 99, 111, 114, 101, 32, 105, 115, 32, 99, 97, 108, 108, 101, 100, 32, 111, 110,
+    99, 101, 32, 112, 101, 114, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 105, 110, 32,
+    116, 104, 101, 32, 98, 97, 116, 99, 104, 46, 32, 32, 84, 104, 105, 115, 32, 99, 97, 110, 32, 115, 105, 103, 110,
+    105, 102, 105, 99, 97, 110, 116, 108, 121, 32, 114, 101, 100, 117, 99, 101, 32, 116, 104, 101, 32, 71, 80, 85, 32,
+    109, 101, 109, 111, 114, 121, 32, 111, 118, 101, 114, 104, 101, 97, 100, 32, 111, 102, 32, 116, 104, 101, 32, 112,
+    114, 111, 102, 105, 108, 101, 114, 44, 32, 98, 117, 116, 32, 109, 97, 121, 32, 104, 97, 118, 101, 32, 97, 32, 115,
+    108, 105, 103, 104, 116, 32, 105, 109, 112, 97, 99, 116, 32, 111, 110, 32, 114, 101, 115, 117, 108, 116, 115, 46,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 54, 57,
+    57, 54, 51, 55, 50, 50, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 114, 101, 97, 107, 83, 117,
+    98, 109, 105, 116, 66, 97, 116, 99, 104, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 66, 114, 101, 97, 107, 83, 117, 98, 109, 105, 116, 66, 97, 116, 99, 104, 101, 115, 34, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114, 97, 99, 101, 32, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112,
+    117, 80, 114, 111, 102, 105, 108, 101, 114, 84, 114, 97, 99, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 83, 80, 77, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105,
+    108, 101, 114, 84, 114, 97, 99, 101, 83, 112, 109, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97,
+    98, 108, 101, 32, 83, 81, 84, 84, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 84, 114, 97, 99, 101, 83,
+    113, 116, 116, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 84, 114, 97, 99, 101, 77, 111, 100, 101, 70, 108, 97, 103,
+    115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 84, 114, 97, 99, 101, 77, 111, 100, 101, 77, 97, 115, 107, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 55, 51, 51, 49, 56, 56, 52, 48, 51,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32,
+    116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32,
+    116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 114, 97, 99, 101, 77, 111, 100,
+    101, 77, 97, 115, 107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 77, 97, 115, 107, 32, 105, 110, 100, 105, 99, 97, 116, 105, 110, 103, 32, 119, 104,
+    105, 99, 104, 32, 116, 114, 97, 99, 101, 115, 32, 97, 114, 101, 32, 101, 110, 97, 98, 108, 101, 100, 46, 32, 66,
+    111, 116, 104, 32, 115, 112, 109, 32, 116, 114, 97, 99, 101, 32, 97, 110, 100, 32, 83, 113, 116, 116, 32, 116, 114,
+    97, 99, 101, 32, 97, 114, 101, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 40, 48, 120, 48, 41, 32, 32, 32, 83,
+    112, 109, 32, 116, 114, 97, 99, 101, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 32, 40, 48, 120, 49, 41, 46,
+    32, 83, 113, 116, 116, 32, 116, 114, 97, 99, 101, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 32, 40, 48,
+    120, 50, 41, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87,
+    114, 105, 116, 101, 115, 32, 116, 104, 101, 32, 112, 101, 114, 45, 102, 114, 97, 109, 101, 32, 99, 97, 108, 108, 32,
+    108, 111, 103, 115, 32, 97, 115, 32, 98, 105, 110, 97, 114, 121, 32, 99, 111, 108, 117, 109, 110, 97, 114, 32, 102,
+    105, 108, 101, 115, 32, 40, 46, 98, 105, 110, 41, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 46, 99,
+    115, 118, 32, 116, 101, 120, 116, 46, 32, 82, 111, 119, 115, 32, 97, 114, 101, 32, 115, 116, 111, 114, 101, 100, 32,
+    97, 115, 32, 102, 105, 120, 101, 100, 45, 119, 105, 100, 116, 104, 32, 114, 101, 99, 111, 114, 100, 115, 32, 119,
+    105, 116, 104, 32, 97, 32, 115, 116, 114, 105, 110, 103, 32, 116, 97, 98, 108, 101, 32, 97, 110, 100, 32, 119, 114,
+    105, 116, 116, 101, 110, 32, 111, 117, 116, 32, 105, 110, 32, 108, 97, 114, 103, 101, 32, 98, 108, 111, 99, 107,
+    115, 44, 32, 119, 104, 105, 99, 104, 32, 105, 115, 32, 102, 97, 114, 32, 99, 104, 101, 97, 112, 101, 114, 32, 116,
+    104, 97, 110, 32, 102, 111, 114, 109, 97, 116, 116, 105, 110, 103, 32, 101, 118, 101, 114, 121, 32, 102, 105, 101,
+    108, 100, 46, 32, 116, 111, 111, 108, 115, 47, 103, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 84, 111, 111,
+    108, 115, 47, 116, 105, 109, 105, 110, 103, 82, 101, 112, 111, 114, 116, 46, 112, 121, 32, 114, 101, 97, 100, 115,
+    32, 101, 105, 116, 104, 101, 114, 32, 102, 111, 114, 109, 97, 116, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 53, 51, 53, 50, 50, 48, 57, 56, 55, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 98, 105, 110, 97, 114, 121, 79, 117, 116, 112, 117, 116, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 105, 110, 97, 114, 121, 79, 117, 116, 112, 117,
+    116, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 102, 105, 103, 117, 114, 97,
+    116, 105, 111, 110, 32, 111, 112, 116, 105, 111, 110, 115, 32, 102, 111, 114, 32, 116, 104, 101, 32, 80, 65, 76, 32,
+    71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114, 32, 108, 97, 121, 101, 114, 46, 34, 10, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80,
+    114, 111, 102, 105, 108, 101, 114, 80, 101, 114, 102, 67, 111, 117, 110, 116, 101, 114, 67, 111, 110, 102, 105, 103,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 52, 56, 53, 53, 48, 55, 54, 53, 57, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108,
+    101, 114, 77, 111, 100, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 80, 101, 114, 102,
+    67, 111, 117, 110, 116, 101, 114, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 116, 114,
+    117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 105, 108, 101, 32, 112,
+    97, 116, 104, 32, 115, 112, 101, 99, 105, 102, 121, 105, 110, 103, 32, 119, 104, 101, 114, 101, 32, 116, 104, 101,
+    32, 103, 108, 111, 98, 97, 108, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 99, 111, 117, 110, 116,
+    101, 114, 32, 99, 111, 110, 102, 105, 103, 32, 102, 105, 108, 101, 32, 99, 97, 110, 32, 98, 101, 32, 102, 111, 117,
+    110, 100, 46, 32, 32, 84, 104, 105, 115, 32, 102, 105, 108, 101, 32, 115, 104, 111, 117, 108, 100, 32, 104, 97, 118,
+    101, 32, 111, 110, 101, 32, 108, 105, 110, 101, 32, 112, 101, 114, 32, 99, 111, 117, 110, 116, 101, 114, 32, 116,
+    111, 32, 99, 97, 112, 116, 117, 114, 101, 32, 105, 110, 32, 116, 104, 101, 32, 102, 111, 114, 109, 32, 92, 34, 66,
+    108, 111, 99, 107, 32, 73, 68, 32, 73, 110, 115, 116, 97, 110, 99, 101, 32, 78, 97, 109, 101, 92, 34, 46, 32, 66,
+    108, 111, 99, 107, 32, 99, 97, 110, 32, 98, 101, 32, 111, 110, 101, 32, 111, 102, 32, 116, 104, 101, 32, 102, 111,
+    108, 108, 111, 119, 105, 110, 103, 58, 32, 67, 66, 44, 32, 67, 80, 67, 44, 32, 67, 80, 70, 44, 32, 67, 80, 71, 44,
+    32, 68, 66, 44, 32, 68, 77, 65, 44, 32, 71, 68, 83, 44, 32, 71, 82, 66, 77, 44, 32, 71, 82, 66, 77, 95, 83, 69, 44,
+    32, 73, 65, 44, 32, 77, 67, 44, 32, 80, 65, 44, 32, 82, 76, 67, 44, 32, 83, 67, 44, 32, 83, 80, 73, 44, 32, 83, 81,
+    44, 32, 83, 82, 66, 77, 44, 32, 83, 88, 44, 32, 84, 65, 44, 32, 84, 67, 65, 44, 32, 84, 67, 67, 44, 32, 84, 67, 80,
+    44, 32, 84, 67, 83, 44, 32, 84, 68, 44, 32, 86, 71, 84, 44, 32, 87, 68, 46, 32, 73, 68, 32, 115, 104, 111, 117, 108,
+    100, 32, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 32, 116, 111, 32, 116, 104, 101, 32, 115, 112, 101, 99,
+    105, 102, 105, 99, 32, 99, 111, 117, 110, 116, 101, 114, 32, 111, 102, 32, 105, 110, 116, 101, 114, 101, 115, 116,
+    32, 102, 111, 114, 32, 116, 104, 101, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 66, 108, 111, 99, 107, 44,
+    32, 116, 104, 101, 115, 101, 32, 99, 97, 110, 32, 98, 101, 32, 115, 101, 108, 101, 99, 116, 101, 100, 32, 98, 121,
+    32, 114, 101, 97, 100, 105, 110, 103, 32, 116, 104, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101,
+    32, 99, 111, 117, 110, 116, 101, 114, 32, 115, 101, 108, 101, 99, 116, 32, 114, 101, 103, 105, 115, 116, 101, 114,
+    32, 102, 111, 114, 32, 116, 104, 97, 116, 32, 98, 108, 111, 99, 107, 46, 32, 73, 110, 115, 116, 97, 110, 99, 101,
+    32, 99, 97, 110, 32, 98, 101, 32, 116, 104, 101, 32, 98, 108, 111, 99, 107, 32, 105, 110, 115, 116, 97, 110, 99,
+    101, 32, 111, 114, 100, 105, 110, 97, 108, 32, 111, 102, 32, 105, 110, 116, 101, 114, 101, 115, 116, 46, 32, 73,
+    116, 32, 99, 97, 110, 32, 97, 108, 115, 111, 32, 98, 101, 32, 116, 104, 101, 32, 101, 110, 117, 109, 32, 69, 65, 67,
+    72, 32, 119, 104, 105, 99, 104, 32, 109, 101, 97, 110, 115, 32, 101, 118, 101, 114, 121, 32, 105, 110, 115, 116, 97,
+    110, 99, 101, 32, 111, 102, 32, 116, 104, 101, 32, 98, 108, 111, 99, 107, 32, 105, 115, 32, 111, 102, 32, 105, 110,
+    116, 101, 114, 101, 115, 116, 46, 32, 65, 108, 115, 111, 32, 73, 116, 32, 99, 97, 110, 32, 98, 101, 32, 65, 76, 76,
+    44, 32, 119, 104, 105, 99, 104, 32, 104, 97, 115, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 109, 101, 97, 110,
+    105, 110, 103, 32, 97, 115, 32, 69, 65, 67, 72, 44, 32, 98, 117, 116, 32, 116, 104, 101, 32, 114, 101, 115, 117,
+    108, 116, 115, 32, 111, 102, 32, 101, 118, 101, 114, 121, 32, 105, 110, 115, 116, 97, 110, 99, 101, 32, 119, 105,
+    108, 108, 32, 98, 101, 32, 97, 99, 99, 117, 109, 108, 97, 116, 101, 100, 46, 32, 78, 97, 109, 101, 32, 119, 105,
+    108, 108, 32, 98, 101, 32, 116, 104, 101, 32, 104, 101, 97, 100, 101, 114, 32, 111, 102, 32, 116, 104, 101, 32, 99,
+    111, 108, 117, 109, 110, 32, 105, 110, 32, 116, 104, 101, 32, 46, 99, 115, 118, 32, 102, 105, 108, 101, 32, 40, 108,
+    105, 109, 105, 116, 101, 100, 32, 116, 111, 32, 49, 50, 55, 32, 99, 104, 97, 114, 97, 99, 116, 101, 114, 115, 41,
+    46, 32, 32, 65, 32, 92, 34, 35, 92, 34, 32, 99, 97, 110, 32, 98, 101, 32, 105, 110, 115, 101, 114, 116, 101, 100,
+    32, 97, 115, 32, 116, 104, 101, 32, 102, 105, 114, 115, 116, 32, 99, 104, 97, 114, 97, 99, 116, 101, 114, 32, 105,
+    110, 32, 97, 32, 108, 105, 110, 101, 32, 116, 111, 32, 102, 111, 114, 99, 101, 32, 116, 104, 97, 116, 32, 108, 105,
+    110, 101, 32, 116, 111, 32, 98, 101, 32, 105, 103, 110, 111, 114, 101, 100, 46, 32, 32, 71, 97, 116, 104, 101, 114,
+    105, 110, 103, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 99, 111, 117, 110, 116, 101, 114, 115,
+    32, 104, 97, 115, 32, 97, 32, 104, 117, 103, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 105,
+    109, 112, 97, 99, 116, 59, 32, 99, 111, 110, 115, 105, 100, 101, 114, 32, 100, 105, 115, 97, 98, 108, 105, 110, 103,
+    32, 84, 68, 82, 115, 32, 111, 110, 32, 87, 105, 110, 100, 111, 119, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 49, 56, 50, 52, 52, 57, 48, 51, 50, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 73, 115, 70, 105, 108, 101, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 34,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 105, 122,
+    101, 34, 58, 32, 34, 77, 97, 120, 70, 105, 108, 101, 78, 97, 109, 101, 83, 116, 114, 76, 101, 110, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    103, 108, 111, 98, 97, 108, 80, 101, 114, 102, 67, 111, 117, 110, 116, 101, 114, 67, 111, 110, 102, 105, 103, 70,
+    105, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 108,
+    111, 98, 97, 108, 80, 101, 114, 102, 67, 111, 117, 110, 116, 101, 114, 67, 111, 110, 102, 105, 103, 70, 105, 108,
+    101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 110, 115, 101,
+    114, 116, 32, 99, 97, 99, 104, 101, 32, 102, 108, 117, 115, 104, 32, 97, 110, 100, 32, 105, 110, 118, 97, 108, 105,
+    100, 97, 116, 101, 32, 101, 118, 101, 110, 116, 115, 32, 98, 101, 102, 111, 114, 101, 32, 97, 110, 100, 32, 97, 102,
+    116, 101, 114, 32, 101, 118, 101, 114, 121, 32, 114, 97, 110, 103, 101, 32, 111, 102, 32, 99, 111, 109, 109, 97,
+    110, 100, 115, 32, 119, 104, 101, 114, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 99, 111,
+    117, 110, 116, 101, 114, 115, 32, 97, 114, 101, 32, 99, 111, 108, 108, 101, 99, 116, 101, 100, 46, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 48, 49, 55, 55, 50,
+    51, 51, 53, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 97, 99, 104, 101, 70, 108, 117, 115, 104, 79,
+    110, 67, 111, 117, 110, 116, 101, 114, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 97, 99, 104, 101, 70, 108, 117, 115, 104, 79, 110,
+    67, 111, 117, 110, 116, 101, 114, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 34, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117,
+    80, 114, 111, 102, 105, 108, 101, 114, 71, 114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 68, 114, 97, 119, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 80, 101, 114, 32, 100, 114, 97, 119, 46, 32, 32, 69, 97, 99, 104, 32, 115, 101, 112, 97,
+    114, 97, 116, 101, 32, 100, 114, 97, 119, 32, 119, 105, 108, 108, 32, 98, 101, 32, 109, 101, 97, 115, 117, 114, 101,
+    100, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 71, 114, 97, 110, 117, 108, 97, 114,
+    105, 116, 121, 67, 109, 100, 66, 117, 102, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 101, 114, 32, 99, 111, 109, 109,
+    97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 46, 32, 32, 87, 104, 111, 108, 101, 32, 99, 111, 109, 109, 97, 110,
+    100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 103, 114, 111, 117, 112, 101,
+    100, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 71, 114, 97, 110, 117, 108, 97, 114,
+    105, 116, 121, 70, 114, 97, 109, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 101, 114, 32, 102, 114, 97, 109, 101,
+    44, 32, 116, 104, 101, 32, 119, 104, 111, 108, 101, 32, 102, 114, 97, 109, 101, 32, 119, 105, 108, 108, 32, 98, 101,
+    32, 103, 114, 111, 117, 112, 101, 100, 46, 32, 32, 85, 115, 101, 102, 117, 108, 32, 116, 111, 32, 103, 101, 116, 32,
+    97, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 32, 99, 111, 118, 101, 114, 105, 110, 103, 32, 97,
+    108, 108, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 97, 99, 114, 111, 115, 115,
+    32, 116, 104, 101, 32, 117, 110, 105, 118, 101, 114, 115, 97, 108, 32, 97, 110, 100, 32, 99, 111, 109, 112, 117,
+    116, 101, 32, 113, 117, 101, 117, 101, 115, 46, 32, 32, 80, 105, 112, 101, 108, 105, 110, 101, 32, 115, 116, 97,
+    116, 115, 32, 119, 105, 108, 108, 32, 110, 111, 116, 32, 98, 101, 32, 103, 97, 116, 104, 101, 114, 101, 100, 32,
+    105, 110, 32, 116, 104, 105, 115, 32, 109, 111, 100, 101, 46, 32, 32, 78, 79, 84, 69, 58, 32, 83, 105, 110, 99, 101,
+    32, 83, 81, 84, 84, 32, 119, 105, 108, 108, 32, 98, 101, 32, 102, 105, 108, 116, 101, 114, 101, 100, 32, 98, 121,
+    32, 86, 77, 73, 68, 32, 105, 102, 32, 121, 111, 117, 32, 119, 105, 115, 104, 32, 116, 111, 32, 103, 97, 116, 104,
+    101, 114, 32, 97, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 32, 97, 99, 114, 111, 115, 115, 32,
+    109, 117, 108, 116, 105, 112, 108, 101, 32, 113, 117, 101, 117, 101, 115, 32, 40, 105, 46, 101, 46, 44, 32, 105,
+    110, 99, 108, 117, 100, 105, 110, 103, 32, 97, 115, 121, 110, 99, 32, 99, 111, 109, 112, 117, 116, 101, 32, 119,
+    111, 114, 107, 41, 44, 32, 97, 32, 68, 101, 98, 117, 103, 32, 86, 77, 73, 68, 32, 115, 104, 111, 117, 108, 100, 32,
+    97, 108, 115, 111, 32, 98, 101, 32, 114, 101, 113, 117, 101, 115, 116, 101, 100, 32, 116, 111, 32, 101, 110, 115,
+    117, 114, 101, 32, 119, 111, 114, 107, 32, 105, 110, 32, 97, 108, 108, 32, 113, 117, 101, 117, 101, 115, 32, 115,
+    104, 97, 114, 101, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 86, 77, 73, 68, 46, 34, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108,
+    101, 114, 71, 114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 114, 97, 110, 117, 108,
+    97, 114, 105, 116, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 51, 52, 49, 52, 54, 50, 56, 51, 54, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 71, 114, 97, 110, 117, 108,
+    97, 114, 105, 116, 121, 68, 114, 97, 119, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 114, 97, 110,
+    117, 108, 97, 114, 105, 116, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116, 101, 114, 109, 105, 110, 101, 115, 32, 119, 104, 97,
+    116, 32, 103, 114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 32, 115, 104, 111, 117, 108, 100, 32, 98, 101, 32,
+    117, 115, 101, 100, 32, 102, 111, 114, 32, 103, 97, 116, 104, 101, 114, 105, 110, 103, 32, 112, 101, 114, 102, 111,
+    114, 109, 97, 110, 99, 101, 32, 100, 97, 116, 97, 58, 32, 32, 48, 58, 32, 80, 101, 114, 32, 100, 114, 97, 119, 46,
+    32, 32, 69, 97, 99, 104, 32, 115, 101, 112, 97, 114, 97, 116, 101, 32, 100, 114, 97, 119, 32, 119, 105, 108, 108,
+    32, 98, 101, 32, 109, 101, 97, 115, 117, 114, 101, 100, 46, 32, 49, 58, 32, 80, 101, 114, 32, 99, 111, 109, 109, 97,
+    110, 100, 32, 98, 117, 102, 102, 101, 114, 46, 32, 32, 87, 104, 111, 108, 101, 32, 99, 111, 109, 109, 97, 110, 100,
+    32, 98, 117, 102, 102, 101, 114, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 103, 114, 111, 117, 112, 101, 100,
+    46, 32, 50, 58, 32, 80, 101, 114, 32, 102, 114, 97, 109, 101, 46, 32, 32, 87, 104, 111, 108, 101, 32, 102, 114, 97,
+    109, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 103, 114, 111, 117, 112, 101, 100, 46, 32, 32, 85, 115, 101, 102,
+    117, 108, 32, 116, 111, 32, 103, 101, 116, 32, 97, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 32,
+    99, 111, 118, 101, 114, 105, 110, 103, 32, 97, 108, 108, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102,
+    101, 114, 115, 32, 97, 99, 114, 111, 115, 115, 32, 116, 104, 101, 32, 117, 110, 105, 118, 101, 114, 115, 97, 108,
+    32, 97, 110, 100, 32, 99, 111, 109, 112, 117, 116, 101, 32, 113, 117, 101, 117, 101, 115, 46, 32, 32, 80, 105, 112,
+    101, 108, 105, 110, 101, 32, 115, 116, 97, 116, 115, 32, 99, 97, 110, 110, 111, 116, 32, 98, 101, 32, 103, 97, 116,
+    104, 101, 114, 101, 100, 32, 105, 110, 32, 116, 104, 105, 115, 32, 109, 111, 100, 101, 46, 32, 32, 73, 102, 32, 121,
+    111, 117, 32, 119, 105, 115, 104, 32, 116, 111, 32, 103, 97, 116, 104, 101, 114, 32, 97, 32, 116, 104, 114, 101, 97,
+    100, 32, 116, 114, 97, 99, 101, 32, 97, 99, 114, 111, 115, 115, 32, 109, 117, 108, 116, 105, 112, 108, 101, 32, 113,
+    117, 101, 117, 101, 115, 32, 40, 105, 46, 101, 46, 44, 32, 105, 110, 99, 108, 117, 100, 105, 110, 103, 32, 97, 115,
+    121, 110, 99, 32, 99, 111, 109, 112, 117, 116, 101, 32, 119, 111, 114, 107, 41, 44, 32, 121, 111, 117, 32, 115, 104,
+    111, 117, 108, 100, 32, 97, 108, 115, 111, 32, 115, 101, 116, 32, 114, 101, 113, 117, 101, 115, 116, 68, 101, 98,
+    117, 103, 86, 109, 105, 100, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 93, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110,
+    102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 32, 111, 112, 116, 105, 111, 110, 115, 32, 102, 111, 114, 32, 112,
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 99, 111, 117, 110, 116, 101, 114, 32, 99, 111, 108, 108, 101,
+    99, 116, 105, 111, 110, 32, 116, 104, 114, 111, 117, 103, 104, 32, 116, 104, 101, 32, 80, 65, 76, 32, 71, 80, 85,
+    32, 80, 114, 111, 102, 105, 108, 101, 114, 32, 76, 97, 121, 101, 114, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102,
+    105, 108, 101, 114, 83, 113, 116, 116, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101,
+    114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 51, 48, 52, 54, 56, 52, 52, 54, 53, 56, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100,
+    115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 49, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 76, 111,
+    103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108,
+    101, 114, 77, 111, 100, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 83, 113, 116, 116,
+    67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 84, 111, 107, 101, 110, 77, 97, 115, 107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 49, 51, 54, 48, 57, 53, 52, 56, 52, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 54, 53, 53, 51, 53, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 111, 107, 101, 110, 77, 97, 115, 107, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97,
+    115, 107, 32, 105, 110, 100, 105, 99, 97, 116, 105, 110, 103, 32, 119, 104, 105, 99, 104, 32, 83, 81, 84, 84, 32,
+    116, 111, 107, 101, 110, 115, 32, 115, 104, 111, 117, 108, 100, 32, 98, 101, 32, 105, 110, 99, 108, 117, 100, 101,
+    100, 32, 105, 110, 32, 116, 104, 101, 32, 116, 114, 97, 99, 101, 46, 32, 32, 86, 97, 108, 117, 101, 32, 119, 105,
+    108, 108, 32, 98, 101, 32, 119, 114, 105, 116, 116, 101, 110, 32, 116, 111, 32, 84, 79, 75, 69, 78, 95, 77, 65, 83,
+    75, 32, 102, 105, 101, 108, 100, 32, 105, 110, 32, 104, 97, 114, 100, 119, 97, 114, 101, 46, 32, 32, 70, 111, 114,
+    32, 114, 101, 102, 101, 114, 101, 110, 99, 101, 44, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 71, 70, 88, 56, 32,
+    83, 81, 84, 84, 32, 117, 115, 101, 114, 32, 103, 117, 105, 100, 101, 58, 32, 48, 120, 48, 48, 48, 49, 58, 32, 84,
+    73, 77, 69, 32, 40, 84, 84, 50, 46, 48, 32, 111, 110, 108, 121, 41, 44, 32, 77, 73, 83, 67, 32, 40, 84, 84, 50, 46,
+    49, 43, 41, 32, 48, 120, 48, 48, 48, 50, 58, 32, 84, 73, 77, 69, 83, 84, 65, 77, 80, 32, 48, 120, 48, 48, 48, 52,
+    58, 32, 82, 69, 71, 32, 48, 120, 48, 48, 48, 56, 58, 32, 87, 65, 86, 69, 95, 83, 84, 65, 82, 84, 32, 48, 120, 48,
+    48, 49, 48, 58, 32, 87, 65, 86, 69, 95, 80, 83, 95, 65, 76, 76, 79, 67, 32, 40, 84, 84, 50, 46, 48, 32, 111, 110,
+    108, 121, 41, 32, 47, 32, 87, 65, 86, 69, 95, 65, 76, 76, 79, 67, 32, 40, 84, 84, 50, 46, 49, 43, 41, 32, 48, 120,
+    48, 48, 50, 48, 58, 32, 87, 65, 86, 69, 95, 86, 83, 95, 65, 76, 76, 79, 67, 32, 40, 84, 84, 50, 46, 48, 32, 111,
+    110, 108, 121, 41, 32, 47, 32, 82, 69, 71, 95, 67, 83, 80, 82, 73, 86, 32, 40, 84, 84, 50, 46, 49, 43, 41, 32, 48,
+    120, 48, 48, 52, 48, 58, 32, 87, 65, 86, 69, 95, 69, 78, 68, 32, 48, 120, 48, 48, 56, 48, 58, 32, 69, 86, 69, 78,
+    84, 32, 48, 120, 48, 49, 48, 48, 58, 32, 69, 86, 69, 78, 84, 95, 67, 83, 32, 48, 120, 48, 50, 48, 48, 58, 32, 69,
+    86, 69, 78, 84, 95, 71, 70, 88, 49, 32, 48, 120, 48, 52, 48, 48, 58, 32, 73, 78, 83, 84, 32, 48, 120, 48, 56, 48,
+    48, 58, 32, 73, 78, 83, 84, 95, 80, 67, 32, 48, 120, 49, 48, 48, 48, 58, 32, 73, 78, 83, 84, 95, 85, 83, 69, 82, 68,
+    65, 84, 65, 32, 48, 120, 50, 48, 48, 48, 58, 32, 73, 83, 83, 85, 69, 32, 48, 120, 52, 48, 48, 48, 58, 32, 80, 69,
+    82, 70, 32, 48, 120, 56, 48, 48, 48, 58, 32, 77, 73, 83, 67, 32, 40, 84, 84, 50, 46, 48, 32, 111, 110, 108, 121, 41,
+    44, 32, 82, 69, 71, 95, 67, 83, 40, 84, 84, 50, 46, 49, 43, 41, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 104, 97, 100, 101, 114, 69, 110,
+    103, 105, 110, 101, 45, 48, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114, 97, 99, 101, 32, 102, 111, 114, 32, 83, 104,
+    97, 100, 101, 114, 32, 69, 110, 103, 105, 110, 101, 32, 48, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 104, 97, 100, 101, 114, 69, 110, 103,
+    105, 110, 101, 45, 49, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114, 97, 99, 101, 32, 102, 111, 114, 32, 83, 104, 97,
+    100, 101, 114, 32, 69, 110, 103, 105, 110, 101, 32, 49, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 104, 97, 100, 101, 114, 69, 110, 103, 105,
+    110, 101, 45, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114, 97, 99, 101, 32, 102, 111, 114, 32, 83, 104, 97, 100,
+    101, 114, 32, 69, 110, 103, 105, 110, 101, 32, 50, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 104, 97, 100, 101, 114, 69, 110, 103, 105,
+    110, 101, 45, 51, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114, 97, 99, 101, 32, 102, 111, 114, 32, 83, 104, 97, 100,
+    101, 114, 32, 69, 110, 103, 105, 110, 101, 32, 51, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 69, 77, 97, 115, 107, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 48, 54, 54, 53,
+    53, 53, 57, 53, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114,
+    117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114,
+    117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 49, 53, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 101, 77,
+    97, 115, 107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 77, 97, 115, 107, 32, 105, 110, 100, 105, 99, 97, 116, 105, 110, 103, 32, 119, 104, 105,
+    99, 104, 32, 119, 104, 105, 99, 104, 32, 83, 69, 32, 116, 111, 32, 103, 97, 116, 104, 101, 114, 32, 116, 104, 114,
+    101, 97, 100, 32, 116, 114, 97, 99, 101, 32, 102, 114, 111, 109, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 32, 99, 111, 109, 112, 105,
+    108, 101, 114, 32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108, 101, 32, 83, 81, 32, 116, 104, 114,
+    101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 32, 73, 102, 32, 116, 104, 105, 115, 32, 105,
+    115, 32, 122, 101, 114, 111, 44, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 119, 105, 108,
+    108, 32, 98, 101, 32, 101, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 112, 105, 112, 101,
+    108, 105, 110, 101, 115, 46, 32, 32, 84, 104, 105, 115, 32, 102, 105, 108, 116, 101, 114, 105, 110, 103, 32, 111,
+    110, 108, 121, 32, 97, 112, 112, 108, 105, 101, 115, 32, 116, 111, 32, 100, 114, 97, 119, 32, 111, 114, 32, 99, 109,
+    100, 98, 117, 102, 32, 112, 114, 111, 102, 105, 108, 105, 110, 103, 32, 103, 114, 97, 110, 117, 108, 97, 114, 105,
+    116, 121, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 51, 57, 51, 50, 55, 56, 57, 57, 56, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32,
+    116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112,
+    105, 112, 101, 108, 105, 110, 101, 72, 97, 115, 104, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 72, 97, 115, 104, 34, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 86, 115, 72, 97, 115, 104, 72, 105, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 49, 54, 51, 50, 53, 57, 57, 56, 55, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117,
+    105, 110, 116, 54, 52, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 118, 115, 72, 97, 115, 104, 72, 105, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 72, 105, 103, 104, 32, 81, 87, 79,
+    82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 86, 83, 32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108,
+    101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 34, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 115, 72, 97, 115, 104, 76, 111, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 56, 48, 49, 51, 57, 55, 56, 56, 57, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 118, 115, 72, 97, 115, 104, 76, 111, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76,
+    111, 119, 32, 81, 87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 86, 83, 32, 104, 97, 115, 104, 32, 116, 111,
+    32, 101, 110, 97, 98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32,
+    102, 111, 114, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 72, 115, 72, 97, 115, 104, 72, 105, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 51, 57, 48,
+    52, 56, 57, 54, 48, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 104, 115, 72, 97, 115, 104,
+    72, 105, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 72, 105, 103, 104, 32, 81, 87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 72, 83, 32,
+    104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32,
+    116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 72, 115,
+    72, 97, 115, 104, 76, 111, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 56, 56, 54, 53, 55, 50, 54, 53, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108,
+    97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34,
+    58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 104, 115, 72, 97, 115, 104, 76, 111, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 119, 32, 81, 87, 79, 82, 68, 32, 111, 102, 32, 116, 104,
+    101, 32, 72, 83, 32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108, 101, 32, 83, 81, 32, 116, 104, 114,
+    101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 68, 115, 72, 97, 115, 104, 72, 105, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 49, 53, 52, 53, 54, 49, 51, 51, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115,
+    72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116,
+    54, 52, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 100, 115, 72, 97, 115, 104, 72, 105, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 72, 105, 103, 104, 32, 81, 87, 79, 82, 68, 32,
+    111, 102, 32, 116, 104, 101, 32, 68, 83, 32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108, 101, 32,
+    83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 34, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 115, 72, 97, 115, 104, 76, 111, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 55, 53, 50, 51, 54, 53, 55, 55, 53, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 117, 105, 110, 116, 54, 52, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 115, 72, 97, 115, 104, 76, 111, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 119, 32, 81,
+    87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 68, 83, 32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97,
+    98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46,
+    34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 115, 72, 97, 115, 104, 72, 105, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 55, 55, 53, 57, 51, 49, 52,
+    56, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 115, 72, 97, 115, 104, 72, 105, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    72, 105, 103, 104, 32, 81, 87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 71, 83, 32, 104, 97, 115, 104, 32,
+    116, 111, 32, 101, 110, 97, 98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101,
+    115, 32, 102, 111, 114, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 115, 72, 97, 115, 104,
+    76, 111, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49,
+    49, 51, 55, 54, 57, 48, 52, 49, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34,
+    58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114,
+    117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 115, 72, 97,
+    115, 104, 76, 111, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 76, 111, 119, 32, 81, 87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 71, 83,
+    32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100,
+    32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80,
+    115, 72, 97, 115, 104, 72, 105, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 49, 56, 48, 53, 55, 53, 56, 55, 57, 51, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101,
+    120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54,
+    52, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 112, 115, 72, 97, 115, 104, 72, 105, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 72, 105, 103, 104, 32, 81, 87, 79, 82, 68, 32, 111,
+    102, 32, 116, 104, 101, 32, 80, 83, 32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108, 101, 32, 83, 81,
+    32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 34, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 80, 115, 72, 97, 115, 104, 76, 111, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 51, 48, 49, 56, 52, 49, 56, 52, 51, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    117, 105, 110, 116, 54, 52, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 115, 72, 97, 115, 104, 76, 111, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 119, 32, 81, 87, 79,
+    82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 80, 83, 32, 104, 97, 115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108,
+    101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115, 32, 102, 111, 114, 46, 34, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 72, 97, 115, 104, 72, 105, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 50, 57, 50, 57, 55, 50, 57, 52, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 115, 72, 97, 115, 104, 72, 105, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 72,
+    105, 103, 104, 32, 81, 87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 67, 83, 32, 104, 97, 115, 104, 32, 116,
+    111, 32, 101, 110, 97, 98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 115,
+    32, 102, 111, 114, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 72, 97, 115, 104, 76, 111,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 54,
+    51, 52, 52, 48, 57, 49, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 115, 72, 97, 115, 104,
+    76, 111, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 76, 111, 119, 32, 81, 87, 79, 82, 68, 32, 111, 102, 32, 116, 104, 101, 32, 67, 83, 32, 104, 97,
+    115, 104, 32, 116, 111, 32, 101, 110, 97, 98, 108, 101, 32, 83, 81, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114,
+    97, 99, 101, 115, 32, 102, 111, 114, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 68,
+    114, 97, 119, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 51, 50, 48, 56, 55, 51, 53, 56, 49, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97,
+    103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58,
+    32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    109, 97, 120, 68, 114, 97, 119, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 100,
+    114, 97, 119, 115, 32, 116, 111, 32, 116, 104, 114, 101, 97, 100, 45, 116, 114, 97, 99, 101, 46, 32, 32, 65, 32,
+    118, 97, 108, 117, 101, 32, 111, 102, 32, 48, 32, 105, 110, 100, 105, 99, 97, 116, 101, 115, 32, 110, 111, 32, 108,
+    105, 109, 105, 116, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 84, 116, 118, 72,
+    97, 115, 104, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 50, 55, 55, 52, 52, 52, 52, 57, 56, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 100,
+    100, 84, 116, 118, 72, 97, 115, 104, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 116, 104, 101, 114, 32, 116, 111, 32, 105, 110,
+    106, 101, 99, 116, 32, 116, 104, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 104, 97, 115, 104, 32, 97,
+    110, 100, 32, 99, 108, 105, 101, 110, 116, 32, 115, 104, 97, 100, 101, 114, 32, 104, 97, 115, 101, 115, 32, 105,
+    110, 116, 111, 32, 116, 104, 101, 32, 116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 32, 102, 111, 114, 32,
+    84, 104, 114, 101, 97, 100, 32, 84, 114, 97, 99, 101, 32, 86, 105, 101, 119, 101, 114, 32, 97, 110, 97, 108, 121,
+    115, 105, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97,
+    120, 105, 109, 117, 109, 32, 97, 109, 111, 117, 110, 116, 32, 111, 102, 32, 100, 97, 116, 97, 32, 105, 110, 32, 98,
+    121, 116, 101, 115, 32, 116, 111, 32, 99, 97, 112, 116, 117, 114, 101, 32, 112, 101, 114, 32, 116, 114, 97, 99, 101,
+    46, 32, 32, 65, 32, 116, 114, 97, 99, 101, 32, 119, 105, 108, 108, 32, 99, 111, 118, 101, 114, 32, 97, 32, 115, 112,
+    97, 110, 32, 111, 102, 32, 99, 111, 109, 109, 97, 110, 100, 115, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 116,
+    104, 101, 32, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 71, 114, 97, 110, 117, 108, 97, 114, 105, 116,
+    121, 32, 115, 101, 116, 116, 105, 110, 103, 46, 32, 32, 68, 101, 102, 97, 117, 108, 116, 115, 32, 116, 111, 32, 49,
+    77, 66, 46, 32, 32, 67, 117, 114, 114, 101, 110, 116, 32, 72, 87, 32, 114, 101, 113, 117, 105, 114, 101, 115, 32,
+    116, 104, 101, 32, 115, 105, 122, 101, 32, 98, 101, 32, 97, 108, 105, 103, 110, 101, 100, 32, 116, 111, 32, 48, 120,
+    49, 48, 48, 48, 32, 98, 121, 116, 101, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 55, 55, 48, 55, 56, 55, 50, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 48, 52, 56, 53, 55, 54, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 105, 122,
+    101, 95, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 98, 117, 102, 102, 101, 114, 83, 105, 122, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 83, 116, 97,
+    108, 108, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65,
+    108, 119, 97, 121, 115, 32, 115, 116, 97, 108, 108, 44, 32, 110, 101, 118, 101, 114, 32, 100, 105, 115, 99, 97, 114,
+    100, 32, 100, 97, 116, 97, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 83, 116, 97, 108, 108, 65, 108, 119,
+    97, 121, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 115, 101, 32, 100, 101, 116, 97, 105, 108,
+    101, 100, 32, 112, 114, 111, 102, 105, 108, 105, 110, 103, 32, 100, 97, 116, 97, 32, 119, 104, 101, 110, 32, 110,
+    101, 99, 101, 115, 115, 97, 114, 121, 32, 116, 111, 32, 97, 116, 116, 101, 109, 112, 116, 32, 116, 111, 32, 97, 118,
+    111, 105, 100, 32, 115, 116, 97, 108, 108, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 83, 116, 97, 108,
+    108, 76, 111, 115, 101, 68, 101, 116, 97, 105, 108, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 101, 118,
+    101, 114, 32, 115, 116, 97, 108, 108, 44, 32, 100, 105, 115, 99, 97, 114, 100, 32, 100, 97, 116, 97, 32, 105, 102,
+    32, 116, 104, 101, 32, 98, 117, 102, 102, 101, 114, 32, 105, 115, 32, 102, 117, 108, 108, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114,
+    111, 102, 105, 108, 101, 114, 83, 116, 97, 108, 108, 78, 101, 118, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 116, 97,
+    108, 108, 66, 101, 104, 97, 118, 105, 111, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 49, 48, 54, 51, 51, 51, 49, 50, 50, 57, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 83,
+    116, 97, 108, 108, 65, 108, 119, 97, 121, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 116, 97,
+    108, 108, 66, 101, 104, 97, 118, 105, 111, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 101, 104, 97, 118, 105, 111, 114, 32, 116, 111, 32,
+    116, 97, 107, 101, 32, 119, 104, 101, 110, 32, 116, 114, 97, 99, 101, 32, 98, 117, 102, 102, 101, 114, 32, 105, 115,
+    32, 102, 117, 108, 108, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 102, 105,
+    103, 117, 114, 97, 116, 105, 111, 110, 32, 111, 112, 116, 105, 111, 110, 115, 32, 102, 111, 114, 32, 99, 97, 112,
+    116, 117, 114, 105, 110, 103, 32, 97, 32, 83, 81, 32, 84, 104, 114, 101, 97, 100, 32, 84, 114, 97, 99, 101, 32, 116,
+    104, 114, 111, 117, 103, 104, 32, 116, 104, 101, 32, 80, 65, 76, 32, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108,
+    101, 114, 32, 108, 97, 121, 101, 114, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 83, 112, 109,
+    67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32,
+    93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 49, 53, 51, 53, 52, 50,
+    49, 57, 50, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32,
+    91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34,
+    71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 77, 111, 100, 101, 34, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114,
+    117, 99, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 103, 112, 117, 80, 114, 111, 102, 105, 108, 101, 114, 83, 112, 109, 67, 111, 110, 102, 105, 103, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 70, 105, 108, 101, 32, 112, 97, 116, 104, 32, 115, 112, 101, 99, 105, 102, 121, 105, 110, 103, 32,
+    119, 104, 101, 114, 101, 32, 116, 104, 101, 32, 103, 108, 111, 98, 97, 108, 32, 112, 101, 114, 102, 111, 114, 109,
+    97, 110, 99, 101, 32, 99, 111, 117, 110, 116, 101, 114, 32, 99, 111, 110, 102, 105, 103, 32, 102, 105, 108, 101, 32,
+    99, 97, 110, 32, 98, 101, 32, 102, 111, 117, 110, 100, 46, 32, 32, 84, 104, 105, 115, 32, 102, 105, 108, 101, 32,
+    115, 104, 111, 117, 108, 100, 32, 104, 97, 118, 101, 32, 111, 110, 101, 32, 108, 105, 110, 101, 32, 112, 101, 114,
+    32, 99, 111, 117, 110, 116, 101, 114, 32, 116, 111, 32, 99, 97, 112, 116, 117, 114, 101, 32, 105, 110, 32, 116, 104,
+    101, 32, 102, 111, 114, 109, 32, 92, 34, 66, 108, 111, 99, 107, 32, 73, 68, 32, 73, 110, 115, 116, 97, 110, 99, 101,
+    32, 78, 97, 109, 101, 92, 34, 46, 32, 66, 108, 111, 99, 107, 32, 99, 97, 110, 32, 98, 101, 32, 111, 110, 101, 32,
+    111, 102, 32, 116, 104, 101, 32, 102, 111, 108, 108, 111, 119, 105, 110, 103, 58, 32, 67, 66, 44, 32, 67, 80, 67,
+    44, 32, 67, 80, 70, 44, 32, 67, 80, 71, 44, 32, 68, 66, 44, 32, 68, 77, 65, 44, 32, 71, 68, 83, 44, 32, 71, 82, 66,
+    77, 44, 32, 71, 82, 66, 77, 95, 83, 69, 44, 32, 73, 65, 44, 32, 77, 67, 44, 32, 80, 65, 44, 32, 82, 76, 67, 44, 32,
+    83, 67, 44, 32, 83, 80, 73, 44, 32, 83, 81, 44, 32, 83, 82, 66, 77, 44, 32, 83, 88, 44, 32, 84, 65, 44, 32, 84, 67,
+    65, 44, 32, 84, 67, 67, 44, 32, 84, 67, 80, 44, 32, 84, 67, 83, 44, 32, 84, 68, 44, 32, 86, 71, 84, 44, 32, 87, 68,
+    46, 32, 32, 73, 68, 32, 115, 104, 111, 117, 108, 100, 32, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 32, 99,
+    111, 117, 110, 116, 101, 114, 32, 111, 102, 32, 105, 110, 116, 101, 114, 101, 115, 116, 32, 102, 111, 114, 32, 116,
+    104, 101, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 66, 108, 111, 99, 107, 44, 32, 116, 104, 101, 115,
+    101, 32, 99, 97, 110, 32, 98, 101, 32, 115, 101, 108, 101, 99, 116, 101, 100, 32, 98, 121, 32, 114, 101, 97, 100,
+    105, 110, 103, 32, 116, 104, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 116, 111, 32, 116,
+    104, 101, 32, 115, 112, 101, 99, 105, 102, 105, 99, 32, 99, 111, 117, 110, 116, 101, 114, 32, 115, 101, 108, 101,
+    99, 116, 32, 114, 101, 103, 105, 115, 116, 101, 114, 32, 102, 111, 114, 32, 116, 104, 97, 116, 32, 98, 108, 111, 99,
+    107, 46, 32, 73, 110, 115, 116, 97, 110, 99, 101, 32, 99, 97, 110, 32, 98, 101, 32, 116, 104, 101, 32, 98, 108, 111,
+    99, 107, 32, 105, 110, 115, 116, 97, 110, 99, 101, 32, 111, 114, 100, 105, 110, 97, 108, 32, 111, 102, 32, 105, 110,
+    116, 101, 114, 101, 115, 116, 46, 32, 73, 116, 32, 99, 97, 110, 32, 97, 108, 115, 111, 32, 98, 101, 32, 116, 104,
+    101, 32, 101, 110, 117, 109, 32, 69, 65, 67, 72, 32, 119, 104, 105, 99, 104, 32, 109, 101, 97, 110, 115, 32, 101,
+    118, 101, 114, 121, 32, 105, 110, 115, 116, 97, 110, 99, 101, 32, 111, 102, 32, 116, 104, 101, 32, 98, 108, 111, 99,
+    107, 32, 105, 115, 32, 111, 102, 32, 105, 110, 116, 101, 114, 101, 115, 116, 46, 32, 65, 108, 115, 111, 32, 73, 116,
+    32, 99, 97, 110, 32, 98, 101, 32, 65, 76, 76, 44, 32, 119, 104, 105, 99, 104, 32, 104, 97, 115, 32, 116, 104, 101,
+    32, 115, 97, 109, 101, 32, 109, 101, 97, 110, 105, 110, 103, 32, 97, 115, 32, 69, 65, 67, 72, 44, 32, 98, 117, 116,
+    32, 116, 104, 101, 32, 114, 101, 115, 117, 108, 116, 115, 32, 111, 102, 32, 101, 118, 101, 114, 121, 32, 105, 110,
+    115, 116, 97, 110, 99, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 97, 99, 99, 117, 109, 108, 97, 116, 101, 100,
+    46, 32, 78, 97, 109, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 116, 104, 101, 32, 104, 101, 97, 100, 101, 114,
+    32, 111, 102, 32, 116, 104, 101, 32, 99, 111, 108, 117, 109, 110, 32, 105, 110, 32, 116, 104, 101, 32, 46, 99, 115,
+    118, 32, 102, 105, 108, 101, 32, 40, 108, 105, 109, 105, 116, 101, 100, 32, 116, 111, 32, 49, 50, 55, 32, 99, 104,
+    97, 114, 97, 99, 116, 101, 114, 115, 41, 46, 32, 32, 65, 32, 92, 34, 35, 92, 34, 32, 99, 97, 110, 32, 98, 101, 32,
+    105, 110, 115, 101, 114, 116, 101, 100, 32, 97, 115, 32, 116, 104, 101, 32, 102, 105, 114, 115, 116, 32, 99, 104,
+    97, 114, 97, 99, 116, 101, 114, 32, 105, 110, 32, 97, 32, 108, 105, 110, 101, 32, 116, 111, 32, 102, 111, 114, 99,
+    101, 32, 116, 104, 97, 116, 32, 108, 105, 110, 101, 32, 116, 111, 32, 98, 101, 32, 105, 103, 110, 111, 114, 101,
+    100, 46, 32, 32, 71, 97, 116, 104, 101, 114, 105, 110, 103, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101,
+    32, 99, 111, 117, 110, 116, 101, 114, 115, 32, 104, 97, 115, 32, 97, 32, 104, 117, 103, 101, 32, 112, 101, 114, 102,
+    111, 114, 109, 97, 110, 99, 101, 32, 105, 109, 112, 97, 99, 116, 59, 32, 99, 111, 110, 115, 105, 100, 101, 114, 32,
+    100, 105, 115, 97, 98, 108, 105, 110, 103, 32, 84, 68, 82, 115, 32, 111, 110, 32, 87, 105, 110, 100, 111, 119, 115,
+    46, 32, 87, 65, 82, 78, 73, 78, 71, 58, 32, 80, 97, 103, 101, 32, 102, 97, 117, 108, 116, 32, 119, 105, 108, 108,
+    32, 111, 99, 99, 117, 114, 32, 119, 104, 101, 110, 32, 97, 116, 116, 101, 109, 112, 116, 105, 110, 103, 32, 115,
+    112, 109, 32, 116, 114, 97, 99, 101, 115, 32, 111, 110, 32, 71, 70, 88, 57, 32, 72, 87, 44, 32, 117, 110, 108, 101,
+    115, 115, 32, 82, 76, 67, 95, 83, 80, 77, 95, 86, 77, 73, 68, 32, 105, 115, 32, 115, 101, 116, 32, 105, 110, 32,
+    116, 104, 101, 32, 82, 76, 67, 95, 83, 80, 77, 95, 77, 67, 95, 67, 78, 84, 76, 32, 114, 101, 103, 105, 115, 116,
+    101, 114, 46, 32, 75, 77, 68, 32, 104, 97, 115, 32, 116, 111, 32, 115, 101, 116, 32, 116, 104, 105, 115, 32, 114,
+    101, 103, 105, 115, 116, 101, 114, 46, 32, 84, 104, 105, 115, 32, 114, 101, 103, 105, 115, 116, 101, 114, 32, 99,
+    97, 110, 32, 98, 101, 32, 115, 101, 116, 32, 109, 97, 110, 117, 97, 108, 108, 121, 32, 40, 100, 101, 98, 117, 103,
+    32, 86, 77, 73, 68, 58, 32, 48, 120, 98, 44, 32, 82, 101, 113, 117, 101, 115, 116, 68, 101, 98, 117, 103, 86, 109,
+    105, 100, 61, 116, 114, 117, 101, 41, 32, 102, 111, 114, 32, 116, 101, 115, 116, 105, 110, 103, 46, 32, 65, 108,
+    115, 111, 44, 32, 116, 104, 101, 32, 115, 97, 109, 112, 108, 101, 32, 100, 101, 108, 97, 121, 32, 114, 101, 103,
+    105, 115, 116, 101, 114, 32, 118, 97, 108, 117, 101, 115, 32, 110, 101, 101, 100, 32, 116, 111, 32, 98, 101, 32,
+    115, 101, 116, 32, 102, 111, 114, 32, 99, 111, 114, 114, 101, 99, 116, 32, 115, 116, 114, 101, 97, 109, 105, 110,
+    103, 32, 99, 111, 117, 110, 116, 101, 114, 32, 100, 97, 116, 97, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 55, 52, 52, 55, 57, 54, 49, 56, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 73, 115, 70, 105, 108, 101, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 105, 122, 101, 34, 58,
+    32, 34, 77, 97, 120, 70, 105, 108, 101, 78, 97, 109, 101, 83, 116, 114, 76, 101, 110, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 112, 109,
+    80, 101, 114, 102, 67, 111, 117, 110, 116, 101, 114, 67, 111, 110, 102, 105, 103, 70, 105, 108, 101, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 112, 109, 80, 101, 114, 102, 67, 111,
+    117, 110, 116, 101, 114, 67, 111, 110, 102, 105, 103, 70, 105, 108, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105,
+    100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114,
+    101, 97, 116, 101, 114, 84, 104, 97, 110, 79, 114, 69, 113, 117, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77,
+    105, 110, 105, 109, 117, 109, 32, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 50, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 112, 109, 84, 114, 97, 99, 101, 73,
+    110, 116, 101, 114, 118, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 51, 55, 53, 54, 50, 50, 54, 55, 57, 57, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 52, 48, 57, 54, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 115, 112, 109, 84, 114, 97, 99, 101, 73, 110, 116, 101, 114, 118, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 97, 109, 112, 108, 101,
+    32, 105, 110, 116, 101, 114, 118, 97, 108, 32, 105, 110, 32, 115, 99, 108, 99, 107, 46, 34, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 97, 109, 111,
+    117, 110, 116, 32, 111, 102, 32, 100, 97, 116, 97, 32, 105, 110, 32, 98, 121, 116, 101, 115, 32, 116, 111, 32, 99,
+    97, 112, 116, 117, 114, 101, 32, 112, 101, 114, 32, 116, 114, 97, 99, 101, 46, 32, 32, 65, 32, 116, 114, 97, 99,
+    101, 32, 119, 105, 108, 108, 32, 99, 111, 118, 101, 114, 32, 97, 32, 115, 112, 97, 110, 32, 111, 102, 32, 99, 111,
+    109, 109, 97, 110, 100, 115, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 116, 104, 101, 32, 71, 112, 117, 80, 114,
+    111, 102, 105, 108, 101, 114, 71, 114, 97, 110, 117, 108, 97, 114, 105, 116, 121, 32, 115, 101, 116, 116, 105, 110,
+    103, 46, 32, 32, 68, 101, 102, 97, 117, 108, 116, 115, 32, 116, 111, 32, 49, 77, 66, 46, 32, 32, 67, 117, 114, 114,
+    101, 110, 116, 32, 72, 87, 32, 114, 101, 113, 117, 105, 114, 101, 115, 32, 116, 104, 101, 32, 115, 105, 122, 101,
+    32, 98, 101, 32, 97, 108, 105, 103, 110, 101, 100, 32, 116, 111, 32, 48, 120, 49, 48, 48, 48, 32, 98, 121, 116, 101,
+    115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51,
+    55, 57, 56, 52, 51, 48, 49, 49, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 49, 48, 52, 56, 53, 55, 54, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 105, 122, 101, 95, 116, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 112, 109, 66,
+    117, 102, 102, 101, 114, 83, 105, 122, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 83, 112, 109, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 34, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 32, 111, 112,
+    116, 105, 111, 110, 115, 32, 102, 111, 114, 32, 99, 97, 112, 116, 117, 114, 105, 110, 103, 32, 83, 116, 114, 101,
+    97, 109, 105, 110, 103, 32, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 77, 111, 110, 105, 116, 111,
+    114, 115, 32, 116, 104, 114, 111, 117, 103, 104, 32, 116, 104, 101, 32, 80, 65, 76, 32, 71, 80, 85, 32, 80, 114,
+    111, 102, 105, 108, 101, 114, 32, 108, 97, 121, 101, 114, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114,
+    76, 111, 103, 103, 101, 114, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114, 32, 76, 111,
+    103, 103, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 49, 50, 48, 54, 57, 56, 50, 56, 51, 52, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 102, 101, 114, 76,
+    111, 103, 103, 101, 114, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 99, 111,
+    109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 108, 111, 103, 103, 101, 114, 32, 108, 97, 121, 101,
+    114, 44, 32, 119, 104, 105, 99, 104, 32, 112, 114, 111, 118, 105, 100, 101, 115, 32, 73, 67, 109, 100, 66, 117, 102,
+    102, 101, 114, 32, 108, 101, 118, 101, 108, 32, 97, 110, 110, 111, 116, 97, 116, 105, 111, 110, 115, 32, 100, 105,
+    114, 101, 99, 116, 108, 121, 32, 105, 110, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32,
+    100, 117, 109, 112, 115, 46, 32, 84, 104, 101, 115, 101, 32, 97, 110, 110, 111, 97, 116, 105, 111, 110, 115, 32, 99,
+    97, 110, 32, 108, 97, 116, 101, 114, 32, 98, 101, 32, 100, 101, 99, 105, 112, 104, 101, 114, 101, 100, 32, 117, 115,
+    105, 110, 103, 32, 111, 102, 102, 108, 105, 110, 101, 32, 116, 111, 111, 108, 115, 46, 34, 10, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66,
+    117, 102, 102, 101, 114, 76, 111, 103, 103, 101, 114, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 109, 100, 66, 117, 102, 102,
+    101, 114, 32, 76, 111, 103, 103, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 48, 51, 54, 57, 55, 50, 53, 57, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101,
+    116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 102, 101,
+    114, 76, 111, 103, 103, 101, 114, 69, 110, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 102,
+    101, 114, 76, 111, 103, 103, 101, 114, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 116,
+    114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 109, 100, 66, 97, 114, 114, 105, 101, 114, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 67, 109, 100, 68, 114, 97, 119, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    67, 109, 100, 68, 105, 115, 112, 97, 116, 99, 104, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 109,
+    100, 87, 114, 105, 116, 101, 84, 105, 109, 101, 115, 116, 97, 109, 112, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 67, 109, 100, 66, 105, 110, 100, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 54, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 109, 100, 83, 101,
+    116, 85, 115, 101, 114, 68, 97, 116, 97, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 50, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 109, 100, 83, 101, 116,
+    115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 54, 52, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 109, 100, 66, 108, 116, 115, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 50, 56, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 77, 105, 115, 99, 101, 108, 108, 97, 110, 101, 111, 117, 115, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 53, 54, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114, 76, 111, 103, 103, 101, 114, 65, 110, 110, 111, 116, 97, 116,
+    105, 111, 110, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114, 32, 76, 111, 103,
+    103, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 48, 56, 52, 53, 57, 52, 52, 48, 48, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 53,
+    49, 49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109,
+    100, 66, 117, 102, 102, 101, 114, 76, 111, 103, 103, 101, 114, 65, 110, 110, 111, 116, 97, 116, 105, 111, 110, 115,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 66, 105, 116, 109, 97, 115, 107, 32, 99, 111, 110, 116, 114, 111, 108, 108, 105, 110, 103, 32, 119, 104,
+    105, 99, 104, 32, 73, 67, 109, 100, 66, 117, 102, 102, 101, 114, 32, 99, 97, 108, 108, 115, 32, 116, 111, 32, 97,
+    110, 110, 111, 116, 97, 116, 101, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 105, 109, 101, 115, 116,
+    97, 109, 112, 68, 114, 97, 119, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 105, 109, 101, 115, 116, 97,
+    109, 112, 68, 105, 115, 112, 97, 116, 99, 104, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 105,
+    109, 101, 115, 116, 97, 109, 112, 66, 97, 114, 114, 105, 101, 114, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 84, 105, 109, 101, 115, 116, 97, 109, 112, 66, 108, 116, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    84, 105, 109, 101, 115, 116, 97, 109, 112, 80, 105, 112, 101, 108, 105, 110, 101, 66, 105, 110, 100, 115, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 54,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 97, 105, 116, 73, 100, 108, 101, 68, 114, 97, 119, 115, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 50, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 87, 97, 105, 116, 73, 100, 108, 101, 68, 105, 115, 112, 97, 116, 99, 104, 101,
+    115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 54, 52, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 97, 105, 116, 73, 100, 108, 101, 66, 97, 114, 114, 105,
+    101, 114, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 49, 50, 56, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 97, 105, 116, 73, 100, 108, 101, 66,
+    108, 116, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 50, 53, 54, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 97, 105, 116, 73, 100, 108, 101, 80,
+    105, 112, 101, 108, 105, 110, 101, 66, 105, 110, 100, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 53, 49, 50, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66,
+    117, 102, 102, 101, 114, 76, 111, 103, 103, 101, 114, 83, 105, 110, 103, 108, 101, 83, 116, 101, 112, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114, 32, 76, 111, 103, 103, 101, 114, 34, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 49, 53, 55, 48, 50, 57, 49, 50, 52, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70,
+    108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120,
+    34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 66, 105, 116,
+    109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 102, 101, 114, 76,
+    111, 103, 103, 101, 114, 83, 105, 110, 103, 108, 101, 83, 116, 101, 112, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 109, 97, 115, 107,
+    32, 99, 111, 110, 116, 114, 111, 108, 108, 105, 110, 103, 32, 115, 105, 110, 103, 108, 101, 32, 115, 116, 101, 112,
+    32, 98, 101, 104, 97, 118, 105, 111, 114, 32, 102, 111, 114, 32, 73, 67, 109, 100, 66, 117, 102, 102, 101, 114, 32,
+    99, 97, 108, 108, 115, 32, 102, 111, 114, 32, 68, 114, 97, 119, 47, 68, 105, 115, 112, 97, 116, 99, 104, 47, 66, 97,
+    114, 114, 105, 101, 114, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 102,
+    105, 103, 117, 114, 97, 116, 105, 111, 110, 32, 111, 112, 116, 105, 111, 110, 115, 32, 102, 111, 114, 32, 116, 104,
+    101, 32, 67, 109, 100, 66, 117, 102, 102, 101, 114, 32, 76, 111, 103, 103, 101, 114, 32, 108, 97, 121, 101, 114, 46,
+    34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 73, 110, 116, 101, 114, 102, 97, 99, 101, 76, 111, 103, 103, 101, 114, 69, 110, 97, 98, 108, 101, 100, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73,
+    110, 116, 101, 114, 102, 97, 99, 101, 32, 76, 111, 103, 103, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 55, 56, 48, 53, 52, 49, 49, 55,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 105,
+    110, 116, 101, 114, 102, 97, 99, 101, 76, 111, 103, 103, 101, 114, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108,
+    101, 115, 32, 116, 104, 101, 32, 80, 65, 76, 32, 105, 110, 116, 101, 114, 102, 97, 99, 101, 32, 108, 111, 103, 103,
+    105, 110, 103, 32, 108, 97, 121, 101, 114, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 110, 116, 101, 114, 102, 97, 99, 101, 76, 111, 103, 103,
+    101, 114, 67, 111, 110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 110, 116, 101, 114, 102, 97, 99, 101, 32, 76, 111, 103, 103, 101, 114, 34,
+    10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    50, 57, 57, 54, 49, 52, 53, 56, 50, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79,
+    110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 114, 117, 101,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 73, 110, 116, 101, 114, 102, 97, 99, 101, 76, 111, 103, 103, 101, 114, 69, 110,
+    97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93,
+    10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 115, 116, 114, 117, 99, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 105, 110, 116, 101, 114, 102, 97, 99, 101, 76, 111, 103, 103, 101, 114, 67, 111,
+    110, 102, 105, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32,
+    91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 108, 97, 116, 105, 118, 101, 32, 100, 105, 114, 101, 99, 116,
+    111, 114, 121, 32, 119, 104, 101, 114, 101, 32, 116, 104, 101, 32, 105, 110, 116, 101, 114, 102, 97, 99, 101, 32,
+    108, 111, 103, 103, 101, 114, 32, 119, 114, 105, 116, 101, 115, 32, 105, 116, 115, 32, 108, 111, 103, 115, 46, 32,
+    82, 101, 108, 97, 116, 105, 118, 101, 32, 116, 111, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 110, 32, 116,
+    104, 101, 32, 65, 77, 68, 95, 68, 69, 66, 85, 71, 95, 68, 73, 82, 32, 101, 110, 118, 105, 114, 111, 110, 109, 101,
+    110, 116, 32, 118, 97, 114, 105, 97, 98, 108, 101, 46, 32, 73, 102, 32, 116, 104, 97, 116, 32, 101, 110, 118, 32,
+    118, 97, 114, 32, 105, 115, 110, 39, 116, 32, 115, 101, 116, 44, 32, 116, 104, 101, 32, 108, 111, 99, 97, 116, 105,
+    111, 110, 32, 105, 115, 32, 112, 108, 97, 116, 102, 111, 114, 109, 32, 100, 101, 112, 101, 110, 100, 101, 110, 116,
+    46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 56,
+    53, 50, 56, 52, 52, 55, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 80, 97, 116, 104, 34, 58, 32, 116, 114, 117,
+    101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 87, 105, 110, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108, 76, 111, 103, 92, 92,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 76, 110, 120, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116, 114, 76,
+    101, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114,
+    105, 110, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 108, 111, 103, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 68, 105, 114, 101, 99, 116, 111, 114, 121,
+    34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 97, 99, 104, 32,
+    116, 104, 114, 101, 97, 100, 32, 119, 105, 108, 108, 32, 119, 114, 105, 116, 101, 32, 105, 110, 116, 111, 32, 105,
+    116, 115, 32, 111, 119, 110, 32, 108, 111, 103, 32, 102, 105, 108, 101, 44, 32, 97, 118, 111, 105, 100, 105, 110,
+    103, 32, 116, 97, 107, 105, 110, 103, 32, 97, 32, 103, 108, 111, 98, 97, 108, 32, 108, 111, 99, 107, 46, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 48, 48, 57, 49, 48,
+    50, 50, 53, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 117, 108, 116, 105, 116, 104, 114, 101, 97,
+    100, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 117,
+    108, 116, 105, 116, 104, 114, 101, 97, 100, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108,
+    117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111,
+    103, 70, 108, 97, 103, 71, 101, 110, 101, 114, 97, 108, 67, 97, 108, 108, 115, 58, 32, 70, 117, 110, 99, 116, 105,
+    111, 110, 115, 32, 119, 104, 105, 99, 104, 32, 97, 114, 101, 32, 104, 97, 114, 100, 32, 116, 111, 32, 99, 108, 97,
+    115, 115, 105, 102, 121, 32, 111, 114, 32, 114, 97, 114, 101, 108, 121, 32, 99, 97, 108, 108, 101, 100, 46, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 67, 114, 101, 97, 116, 101, 68, 101, 115,
+    116, 114, 111, 121, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 119, 104, 105, 99, 104, 32, 99, 114, 101,
+    97, 116, 101, 32, 97, 110, 100, 32, 100, 101, 115, 116, 114, 111, 121, 32, 80, 65, 76, 32, 111, 98, 106, 101, 99,
+    116, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 50, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 66, 105, 110, 100, 71,
+    112, 117, 77, 101, 109, 111, 114, 121, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 114, 101, 108, 101,
+    118, 97, 110, 116, 32, 116, 111, 32, 71, 80, 85, 32, 109, 101, 109, 111, 114, 121, 32, 98, 105, 110, 100, 105, 110,
+    103, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 52, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 81, 117, 101, 117, 101, 79,
+    112, 115, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 114, 101, 108, 101, 118, 97, 110, 116, 32, 116,
+    111, 32, 73, 81, 117, 101, 117, 101, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 115, 46, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 67, 109, 100, 66, 117, 105, 108, 100, 105, 110, 103,
+    58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 119, 104, 105, 99, 104, 32, 98, 117, 105, 108, 100, 32, 73,
+    67, 109, 100, 66, 117, 102, 102, 101, 114, 32, 99, 111, 109, 109, 97, 110, 100, 115, 46, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 54, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 67, 114, 101, 97, 116, 101, 83, 114, 100, 115, 58, 32, 70,
+    117, 110, 99, 116, 105, 111, 110, 115, 32, 119, 104, 105, 99, 104, 32, 99, 114, 101, 97, 116, 101, 32, 83, 82, 68,
+    115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 51, 50, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 97, 115, 101, 80, 114, 101, 115, 101, 116, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 50, 52, 53, 51, 51, 56, 50, 53, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 55, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 97, 115, 101, 80, 114, 101, 115, 101,
+    116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 66, 105, 116, 109, 97, 115, 107, 32, 111, 102, 32, 119, 104, 105, 99, 104, 32, 105, 110, 116, 101,
+    114, 102, 97, 99, 101, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 97, 108, 108, 115, 32, 119, 105, 108, 108,
+    32, 98, 101, 32, 108, 111, 103, 103, 101, 100, 32, 98, 121, 32, 100, 101, 102, 97, 117, 108, 116, 46, 34, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 71, 101, 110, 101, 114, 97, 108, 67, 97,
+    108, 108, 115, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 119, 104, 105, 99, 104, 32, 97, 114, 101, 32,
+    104, 97, 114, 100, 32, 116, 111, 32, 99, 108, 97, 115, 115, 105, 102, 121, 32, 111, 114, 32, 114, 97, 114, 101, 108,
+    121, 32, 99, 97, 108, 108, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103,
+    67, 114, 101, 97, 116, 101, 68, 101, 115, 116, 114, 111, 121, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32,
+    119, 104, 105, 99, 104, 32, 99, 114, 101, 97, 116, 101, 32, 97, 110, 100, 32, 100, 101, 115, 116, 114, 111, 121, 32,
+    80, 65, 76, 32, 111, 98, 106, 101, 99, 116, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103,
+    70, 108, 97, 103, 66, 105, 110, 100, 71, 112, 117, 77, 101, 109, 111, 114, 121, 58, 32, 70, 117, 110, 99, 116, 105,
+    111, 110, 115, 32, 114, 101, 108, 101, 118, 97, 110, 116, 32, 116, 111, 32, 71, 80, 85, 32, 109, 101, 109, 111, 114,
+    121, 32, 98, 105, 110, 100, 105, 110, 103, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108,
+    97, 103, 81, 117, 101, 117, 101, 79, 112, 115, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 114, 101, 108,
+    101, 118, 97, 110, 116, 32, 116, 111, 32, 73, 81, 117, 101, 117, 101, 32, 111, 112, 101, 114, 97, 116, 105, 111,
+    110, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 56, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 67, 109, 100, 66, 117,
+    105, 108, 100, 105, 110, 103, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 119, 104, 105, 99, 104, 32, 98,
+    117, 105, 108, 100, 32, 73, 67, 109, 100, 66, 117, 102, 102, 101, 114, 32, 99, 111, 109, 109, 97, 110, 100, 115, 46,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    49, 54, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 103, 70, 108, 97, 103, 67, 114, 101, 97, 116, 101, 83,
+    114, 100, 115, 58, 32, 70, 117, 110, 99, 116, 105, 111, 110, 115, 32, 119, 104, 105, 99, 104, 32, 99, 114, 101, 97,
+    116, 101, 32, 83, 82, 68, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 51, 50, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 108, 101, 118, 97, 116, 101, 100, 80, 114,
+    101, 115, 101, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 52, 48, 52, 48, 50, 50, 54, 54, 53, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97,
+    103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58,
+    32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 66, 105, 116, 109, 97,
+    115, 107, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 51, 49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116,
+    51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 101, 108, 101, 118, 97, 116, 101, 100, 80, 114, 101, 115, 101, 116, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 109,
+    97, 115, 107, 32, 111, 102, 32, 119, 104, 105, 99, 104, 32, 105, 110, 116, 101, 114, 102, 97, 99, 101, 32, 102, 117,
+    110, 99, 116, 105, 111, 110, 32, 99, 97, 108, 108, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 108, 111, 103, 103,
+    101, 100, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 117, 115, 101, 114, 32, 104, 111, 108, 100, 115, 32, 83,
+    104, 105, 102, 116, 45, 70, 49, 49, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 78, 117, 109, 98, 101, 114, 32, 111, 102, 32, 54, 52, 32, 75, 105, 66, 32, 98, 117, 102, 102, 101, 114,
+    115, 32, 101, 97, 99, 104, 32, 108, 111, 103, 32, 102, 105, 108, 101, 32, 109, 97, 121, 32, 113, 117, 101, 117, 101,
+    32, 102, 111, 114, 32, 105, 116, 115, 32, 98, 97, 99, 107, 103, 114, 111, 117, 110, 100, 32, 119, 114, 105, 116,
+    101, 114, 32, 116, 104, 114, 101, 97, 100, 46, 32, 76, 111, 103, 103, 105, 110, 103, 32, 116, 104, 114, 101, 97,
+    100, 115, 32, 111, 110, 108, 121, 32, 98, 108, 111, 99, 107, 32, 119, 104, 101, 110, 32, 97, 108, 108, 32, 111, 102,
+    32, 116, 104, 101, 109, 32, 97, 114, 101, 32, 119, 97, 105, 116, 105, 110, 103, 32, 116, 111, 32, 98, 101, 32, 119,
+    114, 105, 116, 116, 101, 110, 46, 32, 48, 32, 119, 114, 105, 116, 101, 115, 32, 97, 110, 100, 32, 102, 108, 117,
+    115, 104, 101, 115, 32, 116, 104, 101, 32, 108, 111, 103, 32, 111, 110, 32, 116, 104, 101, 32, 108, 111, 103, 103,
+    105, 110, 103, 32, 116, 104, 114, 101, 97, 100, 32, 97, 102, 116, 101, 114, 32, 101, 118, 101, 114, 121, 32, 99, 97,
+    108, 108, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 51, 52, 55, 52, 51, 56, 53, 51, 49, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 49, 54, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 115, 121, 110, 99, 66,
+    117, 102, 102, 101, 114, 67, 111, 117, 110, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 65, 115, 121, 110, 99, 66, 117, 102, 102, 101, 114, 67, 111, 117, 110, 116, 34, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 72, 97, 110, 100, 115, 32, 101,
+    118, 101, 114, 121, 32, 108, 111, 103, 103, 101, 100, 32, 99, 97, 108, 108, 32, 116, 111, 32, 116, 104, 101, 32, 98,
+    97, 99, 107, 103, 114, 111, 117, 110, 100, 32, 119, 114, 105, 116, 101, 114, 44, 32, 119, 104, 105, 99, 104, 32,
+    102, 108, 117, 115, 104, 101, 115, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 97, 102, 116, 101, 114, 32, 101,
+    97, 99, 104, 32, 119, 114, 105, 116, 101, 44, 32, 97, 110, 100, 32, 100, 114, 97, 105, 110, 115, 32, 97, 108, 108,
+    32, 113, 117, 101, 117, 101, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 105, 102, 32, 116, 104, 101, 32, 112,
+    114, 111, 99, 101, 115, 115, 32, 114, 101, 99, 101, 105, 118, 101, 115, 32, 97, 32, 102, 97, 116, 97, 108, 32, 115,
+    105, 103, 110, 97, 108, 46, 32, 67, 111, 115, 116, 115, 32, 115, 111, 109, 101, 32, 116, 104, 114, 111, 117, 103,
+    104, 112, 117, 116, 32, 98, 117, 116, 32, 107, 101, 101, 112, 115, 32, 116, 104, 101, 32, 108, 111, 103, 32, 99,
+    111, 109, 112, 108, 101, 116, 101, 32, 117, 112, 32, 116, 111, 32, 116, 104, 101, 32, 108, 97, 115, 116, 32, 108,
+    111, 103, 103, 101, 100, 32, 99, 97, 108, 108, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 97, 112, 112, 108,
+    105, 99, 97, 116, 105, 111, 110, 32, 99, 114, 97, 115, 104, 101, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 50, 52, 48, 49, 48, 54, 55, 49, 53, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 114, 97, 115, 104, 83, 97, 102, 101, 70, 108, 117, 115, 104, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 114, 97, 115, 104, 83, 97, 102,
+    101, 70, 108, 117, 115, 104, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 87, 114, 105, 116, 101, 115, 32, 108, 111, 103, 115, 32, 105, 110, 32, 97, 32, 99, 111, 109, 112, 97, 99,
+    116, 32, 98, 105, 110, 97, 114, 121, 32, 102, 111, 114, 109, 97, 116, 32, 40, 46, 98, 105, 110, 32, 102, 105, 108,
+    101, 115, 41, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 74, 83, 79, 78, 32, 116, 101, 120, 116, 46,
+    32, 83, 116, 114, 105, 110, 103, 115, 32, 97, 114, 101, 32, 105, 110, 116, 101, 114, 110, 101, 100, 44, 32, 105,
+    110, 116, 101, 103, 101, 114, 115, 32, 97, 114, 101, 32, 118, 97, 114, 105, 110, 116, 45, 101, 110, 99, 111, 100,
+    101, 100, 32, 97, 110, 100, 32, 102, 108, 111, 97, 116, 115, 32, 97, 110, 100, 32, 101, 110, 117, 109, 115, 32, 97,
+    114, 101, 32, 115, 116, 111, 114, 101, 100, 32, 119, 105, 116, 104, 111, 117, 116, 32, 116, 101, 120, 116, 32, 102,
+    111, 114, 109, 97, 116, 116, 105, 110, 103, 44, 32, 119, 104, 105, 99, 104, 32, 109, 97, 107, 101, 115, 32, 108,
+    111, 110, 103, 32, 99, 97, 112, 116, 117, 114, 101, 115, 32, 109, 117, 99, 104, 32, 99, 104, 101, 97, 112, 101, 114,
+    32, 116, 111, 32, 114, 101, 99, 111, 114, 100, 46, 32, 67, 111, 110, 118, 101, 114, 116, 32, 97, 32, 99, 97, 112,
+    116, 117, 114, 101, 32, 116, 111, 32, 116, 104, 101, 32, 117, 115, 117, 97, 108, 32, 74, 83, 79, 78, 32, 108, 111,
+    103, 115, 32, 119, 105, 116, 104, 32, 116, 111, 111, 108, 115, 47, 105, 110, 116, 101, 114, 102, 97, 99, 101, 76,
+    111, 103, 103, 101, 114, 84, 111, 111, 108, 115, 47, 99, 111, 110, 118, 101, 114, 116, 66, 105, 110, 97, 114, 121,
+    76, 111, 103, 46, 112, 121, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 49, 49, 48, 53, 55, 50, 55, 54, 53, 54, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 98, 105, 110, 97, 114, 121, 67, 97, 112, 116, 117, 114, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 105, 110, 97, 114, 121, 67, 97, 112, 116, 117, 114, 101, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110,
+    32, 111, 112, 116, 105, 111, 110, 115, 32, 102, 111, 114, 32, 116, 104, 101, 32, 80, 65, 76, 32, 73, 110, 116, 101,
+    114, 102, 97, 99, 101, 32, 76, 111, 103, 103, 101, 114, 32, 108, 97, 121, 101, 114, 46, 34, 10, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 108, 97, 98, 65,
+    108, 108, 111, 99, 97, 116, 111, 114, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 77, 101, 109, 111, 114, 121, 34, 10, 32, 32,
+    32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 51, 57,
+    53, 54, 53, 57, 51, 52, 55, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101,
+    10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 115, 108, 97, 98, 65, 108, 108, 111, 99, 97, 116, 111, 114, 69, 110, 97, 98, 108, 101,
+    100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    83, 101, 114, 118, 101, 115, 32, 115, 109, 97, 108, 108, 32, 105, 110, 116, 101, 114, 110, 97, 108, 32, 115, 121,
+    115, 116, 101, 109, 32, 109, 101, 109, 111, 114, 121, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 32,
+    102, 114, 111, 109, 32, 112, 101, 114, 45, 116, 104, 114, 101, 97, 100, 32, 115, 105, 122, 101, 45, 99, 108, 97,
+    115, 115, 32, 99, 97, 99, 104, 101, 115, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 99, 97, 108, 108,
+    105, 110, 103, 32, 116, 104, 101, 32, 99, 108, 105, 101, 110, 116, 39, 115, 32, 97, 108, 108, 111, 99, 97, 116, 105,
+    111, 110, 32, 99, 97, 108, 108, 98, 97, 99, 107, 115, 32, 102, 111, 114, 32, 101, 97, 99, 104, 32, 111, 110, 101,
+    46, 32, 82, 101, 113, 117, 101, 115, 116, 115, 32, 108, 97, 114, 103, 101, 114, 32, 116, 104, 97, 110, 32, 50, 32,
+    75, 105, 66, 32, 97, 114, 101, 32, 97, 108, 119, 97, 121, 115, 32, 102, 111, 114, 119, 97, 114, 100, 101, 100, 32,
+    116, 111, 32, 116, 104, 101, 32, 99, 108, 105, 101, 110, 116, 46, 34, 10, 32, 32, 32, 32, 125, 10, 32, 32, 93, 44,
+    10, 32, 32, 34, 68, 101, 102, 105, 110, 101, 100, 67, 111, 110, 115, 116, 97, 110, 116, 115, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104,
+    83, 116, 114, 76, 101, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 53, 49, 50,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97,
+    120, 105, 109, 117, 109, 32, 115, 116, 114, 105, 110, 103, 32, 108, 101, 110, 103, 116, 104, 32, 102, 111, 114, 32,
+    97, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 47, 112, 97, 116, 104, 32, 115, 101, 116, 116, 105, 110, 103,
+    34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 77, 97, 120, 70, 105, 108, 101, 78, 97, 109, 101, 83, 116, 114, 76, 101, 110, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 53, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 115, 116, 114, 105, 110,
+    103, 32, 108, 101, 110, 103, 116, 104, 32, 102, 111, 114, 32, 97, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32,
+    115, 101, 116, 116, 105, 110, 103, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 77, 105, 115, 99, 83, 116, 114, 76, 101, 110, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 54, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 115, 116, 114, 105, 110,
+    103, 32, 108, 101, 110, 103, 116, 104, 32, 102, 111, 114, 32, 97, 32, 109, 105, 115, 99, 101, 108, 108, 97, 110,
+    101, 111, 117, 115, 32, 115, 116, 114, 105, 110, 103, 32, 115, 101, 116, 116, 105, 110, 103, 34, 10, 32, 32, 32, 32,
+    125, 10, 32, 32, 93, 44, 10, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 34, 68, 101, 98, 117,
+    103, 32, 80, 114, 105, 110, 116, 34, 44, 10, 32, 32, 32, 32, 34, 68, 101, 98, 117, 103, 32, 79, 118, 101, 114, 108,
+    97, 121, 34, 44, 10, 32, 32, 32, 32, 34, 71, 80, 85, 32, 80, 114, 111, 102, 105, 108, 101, 114, 34, 44, 10, 32, 32,
+    32, 32, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114, 32, 76, 111, 103, 103, 101, 114, 34, 44, 10, 32, 32, 32, 32,
+    34, 73, 110, 116, 101, 114, 102, 97, 99, 101, 32, 76, 111, 103, 103, 101, 114, 34, 44, 10, 32, 32, 32, 32, 34, 83,
+    104, 97, 100, 101, 114, 32, 68, 101, 98, 117, 103, 34, 44, 10, 32, 32, 32, 32, 34, 77, 101, 109, 111, 114, 121, 34,
+    10, 32, 32, 93, 10, 125
 };  // g_palPlatformJsonData[]
 
 } // Pal
@@ -71,6 +71,10 @@ void SettingsLoader::SetupDefaults()
     m_settings.addr2DisableXorTileMode = false;
     m_settings.overlayReportHDR = true;
     m_settings.wholePipelineOptimizations = OptTrimUnusedOutputs;
+    m_settings.elfCacheMaxSizeMb = 64;
+    m_settings.elfCacheMaxEntries = 16384;
+    m_settings.pipelineBatchThreadCount = 0;
+    m_settings.enableScalableVaAllocator = true;
     m_settings.forceHeapPerfToFixedValues = false;
     m_settings.cpuReadPerfForLocal = 1;
     m_settings.cpuWritePerfForLocal = 1;
@@ -243,6 +247,26 @@ void SettingsLoader::ReadSettings()
                            &m_settings.wholePipelineOptimizations,
                            InternalSettingScope::PrivatePalKey);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pElfCacheMaxSizeMbStr,
+                           Util::ValueType::Uint,
+                           &m_settings.elfCacheMaxSizeMb,
+                           InternalSettingScope::PrivatePalKey);
+
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pElfCacheMaxEntriesStr,
+                           Util::ValueType::Uint,
+                           &m_settings.elfCacheMaxEntries,
+                           InternalSettingScope::PrivatePalKey);
+
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pPipelineBatchThreadCountStr,
+                           Util::ValueType::Uint,
+                           &m_settings.pipelineBatchThreadCount,
+                           InternalSettingScope::PrivatePalKey);
+
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pEnableScalableVaAllocatorStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.enableScalableVaAllocator,
+                           InternalSettingScope::PrivatePalKey);
+
     static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pForceHeapPerfToFixedValuesStr,
                            Util::ValueType::Boolean,
                            &m_settings.forceHeapPerfToFixedValues,
@@ -613,6 +637,26 @@ void SettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.wholePipelineOptimizations);
     m_settingsInfoMap.Insert(2263765076, info);
 
+    info.type      = SettingType::Uint;
+    info.pValuePtr = &m_settings.elfCacheMaxSizeMb;
+    info.valueSize = sizeof(m_settings.elfCacheMaxSizeMb);
+    m_settingsInfoMap.Insert(3481279264, info);
+
+    info.type      = SettingType::Uint;
+    info.pValuePtr = &m_settings.elfCacheMaxEntries;
+    info.valueSize = sizeof(m_settings.elfCacheMaxEntries);
+    m_settingsInfoMap.Insert(311870090, info);
+
+    info.type      = SettingType::Uint;
+    info.pValuePtr = &m_settings.pipelineBatchThreadCount;
+    info.valueSize = sizeof(m_settings.pipelineBatchThreadCount);
+    m_settingsInfoMap.Insert(1455722776, info);
+
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.enableScalableVaAllocator;
+    info.valueSize = sizeof(m_settings.enableScalableVaAllocator);
+    m_settingsInfoMap.Insert(3406282977, info);
+
     info.type      = SettingType::Boolean;
     info.pValuePtr = &m_settings.forceHeapPerfToFixedValues;
     info.valueSize = sizeof(m_settings.forceHeapPerfToFixedValues);
@@ -969,9 +1013,9 @@ void SettingsLoader::DevDriverRegister()
             component.pfnSetValue = ISettingsLoader::SetValue;
             component.pSettingsData = &g_palJsonData[0];
             component.settingsDataSize = sizeof(g_palJsonData);
-            component.settingsDataHash = 769802641;
-            component.settingsDataHeader.isEncoded = true;
-            component.settingsDataHeader.magicBufferId = 402778310;
+            component.settingsDataHash = 0;
+            component.settingsDataHeader.isEncoded = false;
+            component.settingsDataHeader.magicBufferId = 0;
             component.settingsDataHeader.magicBufferOffset = 0;
 
             pSettingsService->RegisterComponent(component);
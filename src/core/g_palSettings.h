@@ -188,6 +188,10 @@ struct PalSettings : public Pal::DriverSettings
     bool                              addr2DisableXorTileMode;
     bool                              overlayReportHDR;
     PipelineOptFlags                  wholePipelineOptimizations;
+    uint32                            elfCacheMaxSizeMb;
+    uint32                            elfCacheMaxEntries;
+    uint32                            pipelineBatchThreadCount;
+    bool                              enableScalableVaAllocator;
     bool                              forceHeapPerfToFixedValues;
     float                             cpuReadPerfForLocal;
     float                             cpuWritePerfForLocal;
@@ -277,6 +281,10 @@ static const char* pAddr2Disable4KbSwizzleModeStr = "#2252676842";
 static const char* pAddr2DisableXorTileModeStr = "#576052426";
 static const char* pOverlayReportHDRStr = "#2354711641";
 static const char* pWholePipelineOptimizationsStr = "#2263765076";
+static const char* pElfCacheMaxSizeMbStr = "#3481279264";
+static const char* pElfCacheMaxEntriesStr = "#311870090";
+static const char* pPipelineBatchThreadCountStr = "#1455722776";
+static const char* pEnableScalableVaAllocatorStr = "#3406282977";
 static const char* pForceHeapPerfToFixedValuesStr = "#2415703124";
 static const char* pAllocationListReusableStr = "#1727036994";
 static const char* pFenceTimeoutOverrideStr = "#970172817";
@@ -331,7 +339,7 @@ static const char* pPeerMemoryEnabledStr = "#259362511";
 static const char* pForcePresentViaGdiStr = "#2607871653";
 static const char* pPresentViaOglRuntimeStr = "#2466363770";
 
-static const uint32 g_palNumSettings = 86;
+static const uint32 g_palNumSettings = 89;
 static const SettingNameHash g_palSettingHashList[] = {
 4265240458,
 1901986348,
@@ -352,6 +360,9 @@ static const SettingNameHash g_palSettingHashList[] = {
 576052426,
 2354711641,
 2263765076,
+3481279264,
+1455722776,
+3406282977,
 2415703124,
 1067711036,
 2730570157,
@@ -422,2282 +433,2269 @@ static const SettingNameHash g_palSettingHashList[] = {
 };
 
 static const uint8 g_palJsonData[] = {
-    26, 210, 55, 147, 78, 111, 96, 105, 135, 206, 59, 11, 175, 26, 113, 216, 199, 159, 198, 36, 51, 254, 113, 108, 73,
-    77, 123, 8, 185, 106, 116, 74, 103, 93, 222, 20, 137, 16, 25, 12, 227, 13, 8, 153, 101, 40, 253, 157, 171, 191, 163,
-    100, 4, 47, 58, 44, 233, 15, 70, 96, 254, 164, 199, 14, 141, 116, 38, 182, 96, 123, 185, 73, 81, 7, 52, 95, 174,
-    153, 209, 201, 43, 244, 247, 102, 206, 38, 239, 151, 255, 7, 50, 234, 74, 29, 233, 65, 0, 64, 217, 217, 189, 117,
-    109, 32, 176, 32, 239, 89, 175, 51, 208, 197, 70, 139, 21, 150, 109, 230, 170, 8, 178, 157, 164, 14, 139, 52, 146,
-    234, 56, 139, 7, 54, 139, 155, 111, 185, 155, 147, 23, 151, 245, 158, 180, 141, 139, 13, 25, 103, 146, 72, 104, 236,
-    164, 248, 196, 160, 226, 13, 58, 192, 164, 6, 191, 224, 151, 89, 172, 4, 43, 130, 215, 27, 203, 17, 62, 4, 148, 194,
-    229, 222, 18, 120, 208, 135, 238, 58, 162, 192, 241, 151, 153, 74, 241, 170, 151, 116, 184, 55, 17, 207, 116, 253,
-    214, 166, 207, 134, 222, 164, 164, 41, 237, 212, 140, 53, 55, 164, 45, 133, 43, 194, 22, 145, 254, 139, 63, 69, 111,
-    148, 56, 251, 73, 158, 5, 1, 45, 62, 130, 40, 208, 156, 96, 130, 61, 80, 63, 62, 86, 66, 253, 103, 200, 245, 191,
-    89, 181, 184, 218, 139, 94, 70, 240, 139, 216, 149, 166, 253, 70, 85, 140, 209, 44, 81, 176, 183, 75, 114, 174, 196,
-    29, 33, 75, 26, 90, 248, 64, 54, 180, 14, 59, 78, 2, 195, 144, 117, 246, 68, 114, 188, 124, 129, 175, 68, 143, 225,
-    93, 55, 110, 99, 8, 8, 191, 14, 57, 199, 151, 54, 83, 18, 105, 88, 20, 108, 131, 225, 156, 230, 135, 221, 201, 57,
-    66, 221, 204, 180, 11, 162, 54, 57, 160, 66, 237, 237, 215, 86, 97, 14, 217, 232, 67, 132, 56, 39, 75, 217, 179,
-    222, 29, 116, 16, 90, 15, 190, 146, 29, 24, 61, 96, 252, 250, 45, 40, 228, 112, 193, 210, 211, 49, 32, 83, 117, 42,
-    64, 171, 108, 81, 130, 165, 34, 50, 205, 29, 154, 245, 180, 254, 17, 205, 139, 97, 49, 240, 73, 166, 1, 95, 119,
-    176, 31, 98, 25, 106, 71, 201, 71, 187, 182, 192, 98, 219, 255, 30, 121, 103, 20, 58, 112, 118, 167, 49, 202, 31,
-    42, 147, 24, 203, 222, 241, 23, 242, 146, 164, 194, 26, 213, 132, 90, 156, 23, 169, 63, 12, 206, 54, 98, 93, 205,
-    45, 204, 23, 26, 193, 222, 166, 16, 134, 203, 203, 78, 132, 253, 223, 194, 173, 179, 126, 119, 222, 63, 213, 86,
-    227, 222, 162, 152, 138, 175, 85, 87, 70, 123, 76, 62, 139, 159, 164, 75, 224, 118, 17, 100, 107, 26, 234, 30, 68,
-    42, 154, 136, 48, 23, 148, 238, 169, 197, 175, 65, 124, 156, 31, 189, 225, 140, 199, 101, 250, 135, 72, 11, 111,
-    195, 245, 208, 43, 71, 96, 86, 148, 134, 228, 80, 232, 254, 154, 189, 96, 97, 254, 50, 246, 61, 171, 227, 37, 189,
-    32, 184, 203, 21, 219, 210, 172, 86, 123, 51, 72, 144, 63, 127, 55, 179, 108, 215, 139, 221, 87, 161, 220, 34, 181,
-    11, 72, 70, 197, 232, 37, 62, 92, 64, 136, 180, 179, 189, 74, 248, 85, 126, 173, 100, 231, 14, 161, 1, 159, 58, 27,
-    79, 116, 41, 118, 52, 104, 95, 182, 0, 151, 100, 15, 125, 237, 119, 39, 90, 71, 100, 211, 132, 230, 88, 239, 232,
-    248, 145, 221, 205, 69, 34, 249, 76, 224, 151, 128, 157, 106, 69, 242, 114, 47, 133, 125, 234, 0, 185, 81, 109, 7,
-    141, 42, 138, 251, 26, 90, 50, 198, 254, 98, 43, 221, 135, 153, 72, 181, 125, 172, 12, 145, 162, 92, 166, 102, 107,
-    34, 143, 68, 73, 131, 0, 182, 159, 246, 233, 163, 225, 200, 140, 174, 164, 138, 6, 85, 90, 6, 5, 162, 181, 210, 117,
-    65, 69, 71, 255, 27, 4, 184, 136, 102, 66, 47, 204, 6, 232, 227, 216, 59, 99, 189, 174, 156, 164, 231, 116, 252,
-    179, 199, 37, 84, 132, 242, 152, 80, 33, 131, 119, 243, 203, 30, 220, 38, 140, 146, 135, 237, 166, 64, 214, 165,
-    110, 104, 104, 20, 174, 28, 145, 55, 189, 21, 56, 171, 64, 230, 89, 87, 69, 221, 110, 234, 163, 132, 229, 169, 192,
-    212, 132, 11, 9, 84, 225, 105, 227, 110, 90, 119, 127, 169, 198, 179, 3, 203, 138, 246, 24, 127, 8, 156, 235, 153,
-    179, 44, 130, 207, 143, 63, 14, 195, 63, 182, 79, 156, 26, 222, 40, 202, 173, 105, 23, 218, 111, 217, 73, 156, 135,
-    158, 48, 96, 34, 90, 7, 127, 23, 123, 206, 139, 69, 76, 39, 72, 52, 149, 143, 180, 42, 7, 239, 134, 244, 140, 106,
-    247, 58, 117, 16, 191, 75, 180, 93, 178, 20, 106, 88, 124, 109, 168, 192, 89, 212, 230, 99, 208, 60, 42, 129, 48,
-    132, 95, 162, 10, 62, 232, 16, 223, 47, 62, 190, 221, 140, 143, 208, 65, 35, 129, 157, 59, 102, 136, 48, 112, 6,
-    175, 166, 50, 155, 183, 191, 83, 7, 48, 125, 210, 15, 97, 48, 49, 197, 201, 94, 82, 80, 59, 74, 219, 250, 152, 20,
-    232, 78, 13, 229, 72, 14, 221, 81, 245, 68, 70, 226, 173, 254, 138, 7, 205, 192, 83, 173, 149, 164, 162, 231, 166,
-    138, 153, 133, 223, 61, 124, 214, 62, 53, 154, 211, 75, 249, 118, 69, 89, 75, 17, 246, 143, 214, 179, 208, 116, 110,
-    92, 250, 1, 207, 227, 147, 135, 144, 231, 153, 141, 220, 204, 67, 51, 148, 246, 221, 169, 166, 156, 225, 38, 48,
-    195, 12, 142, 24, 167, 3, 224, 169, 145, 59, 104, 212, 17, 197, 146, 133, 213, 40, 74, 56, 154, 167, 139, 32, 247,
-    159, 141, 125, 108, 175, 127, 204, 85, 45, 7, 36, 112, 237, 97, 144, 127, 251, 208, 107, 35, 199, 1, 122, 186, 188,
-    131, 125, 143, 74, 185, 105, 42, 147, 158, 64, 97, 183, 190, 133, 50, 17, 96, 4, 59, 211, 11, 248, 9, 104, 160, 207,
-    72, 114, 233, 62, 1, 116, 88, 196, 215, 21, 246, 254, 6, 114, 153, 117, 157, 190, 237, 207, 164, 183, 115, 231, 93,
-    71, 175, 119, 150, 213, 128, 119, 199, 47, 155, 110, 187, 253, 83, 198, 228, 123, 67, 212, 182, 95, 105, 236, 104,
-    34, 244, 104, 91, 151, 10, 178, 248, 187, 148, 172, 118, 63, 126, 193, 157, 50, 27, 168, 130, 167, 133, 122, 70, 53,
-    95, 19, 90, 59, 138, 90, 230, 148, 178, 139, 149, 54, 131, 152, 80, 131, 131, 223, 52, 174, 209, 40, 24, 65, 11, 57,
-    144, 162, 5, 54, 255, 203, 5, 254, 32, 149, 177, 134, 72, 98, 64, 148, 244, 248, 93, 241, 61, 50, 143, 118, 85, 31,
-    47, 90, 193, 27, 120, 87, 231, 214, 135, 180, 128, 142, 47, 197, 211, 116, 112, 72, 91, 208, 128, 83, 191, 59, 107,
-    84, 110, 253, 97, 248, 13, 152, 20, 250, 250, 27, 41, 222, 2, 33, 176, 151, 85, 26, 191, 80, 75, 232, 248, 187, 115,
-    216, 27, 182, 186, 150, 146, 156, 168, 112, 179, 114, 102, 95, 227, 130, 229, 225, 175, 199, 217, 122, 219, 159,
-    140, 194, 240, 21, 102, 80, 25, 123, 185, 8, 123, 22, 222, 241, 127, 199, 198, 218, 145, 79, 102, 36, 133, 215, 236,
-    154, 189, 233, 144, 211, 137, 190, 190, 29, 57, 148, 153, 183, 80, 247, 43, 218, 157, 60, 113, 229, 70, 8, 41, 55,
-    17, 118, 226, 167, 14, 1, 73, 157, 94, 57, 82, 165, 60, 160, 118, 177, 111, 90, 193, 46, 65, 46, 189, 178, 11, 71,
-    135, 38, 42, 120, 221, 211, 90, 73, 197, 240, 67, 64, 97, 234, 105, 226, 246, 108, 12, 124, 174, 173, 174, 150, 172,
-    21, 197, 102, 30, 97, 195, 219, 141, 184, 94, 241, 42, 118, 36, 235, 139, 132, 238, 164, 51, 93, 102, 131, 163, 151,
-    194, 247, 246, 61, 108, 217, 92, 108, 154, 164, 3, 74, 153, 59, 5, 64, 219, 246, 94, 216, 89, 153, 199, 161, 164,
-    250, 189, 249, 60, 1, 92, 7, 196, 94, 58, 69, 192, 101, 160, 217, 90, 233, 86, 247, 248, 120, 119, 72, 42, 221, 11,
-    182, 198, 255, 86, 151, 226, 189, 43, 40, 82, 216, 25, 28, 196, 237, 71, 6, 91, 44, 230, 219, 91, 71, 249, 176, 218,
-    184, 5, 141, 195, 22, 219, 132, 143, 252, 2, 82, 22, 222, 14, 10, 153, 152, 109, 6, 190, 121, 121, 20, 4, 158, 197,
-    132, 142, 255, 203, 90, 9, 14, 204, 119, 180, 76, 33, 161, 170, 138, 147, 178, 61, 180, 204, 86, 193, 30, 132, 222,
-    206, 89, 170, 146, 172, 0, 76, 251, 71, 162, 209, 65, 216, 155, 170, 165, 169, 85, 106, 130, 34, 61, 110, 118, 133,
-    58, 142, 177, 4, 117, 148, 183, 17, 178, 89, 164, 223, 128, 245, 187, 32, 197, 132, 7, 200, 71, 125, 40, 217, 224,
-    26, 184, 180, 178, 187, 204, 8, 187, 197, 38, 99, 11, 248, 52, 157, 169, 77, 102, 129, 53, 215, 122, 15, 36, 54,
-    159, 197, 125, 8, 55, 54, 151, 57, 217, 31, 141, 196, 46, 221, 25, 164, 33, 206, 8, 69, 233, 139, 75, 117, 71, 21,
-    44, 77, 212, 107, 19, 156, 121, 0, 8, 47, 255, 138, 230, 196, 84, 196, 224, 88, 15, 235, 212, 100, 146, 119, 113,
-    127, 197, 252, 15, 181, 214, 196, 48, 164, 81, 231, 253, 48, 8, 142, 213, 61, 120, 198, 251, 13, 42, 69, 200, 217,
-    99, 24, 214, 226, 203, 228, 115, 82, 7, 114, 6, 32, 181, 169, 3, 179, 0, 53, 194, 80, 173, 100, 87, 97, 208, 75, 28,
-    121, 29, 178, 141, 82, 56, 58, 31, 160, 110, 25, 183, 232, 32, 202, 229, 147, 113, 76, 35, 142, 0, 161, 220, 72,
-    154, 4, 234, 218, 148, 228, 196, 91, 182, 2, 233, 45, 250, 85, 6, 47, 44, 112, 237, 116, 157, 135, 181, 13, 15, 96,
-    226, 199, 87, 84, 35, 232, 6, 102, 243, 112, 113, 219, 76, 8, 147, 66, 213, 242, 72, 215, 149, 239, 255, 233, 80,
-    214, 130, 135, 229, 42, 51, 17, 11, 90, 195, 152, 232, 215, 104, 102, 140, 205, 114, 45, 74, 252, 79, 55, 57, 230,
-    212, 73, 65, 74, 45, 43, 48, 191, 229, 3, 42, 228, 40, 25, 196, 225, 252, 220, 153, 17, 48, 200, 126, 69, 33, 46,
-    110, 67, 82, 193, 194, 104, 85, 48, 249, 197, 221, 221, 29, 67, 70, 154, 42, 101, 96, 178, 156, 204, 145, 234, 55,
-    33, 38, 181, 82, 38, 88, 238, 33, 115, 125, 118, 184, 199, 99, 178, 132, 103, 36, 141, 165, 1, 34, 71, 37, 206, 85,
-    72, 214, 90, 112, 212, 74, 192, 150, 239, 246, 236, 246, 250, 152, 63, 118, 187, 76, 23, 149, 21, 32, 53, 34, 46,
-    26, 39, 184, 121, 243, 35, 129, 9, 252, 180, 156, 223, 38, 240, 109, 185, 223, 187, 4, 152, 54, 108, 24, 57, 146,
-    167, 80, 199, 203, 197, 85, 238, 119, 73, 122, 75, 21, 238, 81, 159, 31, 78, 103, 63, 195, 43, 224, 63, 184, 130,
-    11, 21, 119, 24, 18, 116, 205, 10, 170, 248, 107, 3, 62, 168, 109, 26, 216, 26, 172, 57, 177, 178, 179, 213, 55,
-    202, 119, 209, 183, 37, 175, 143, 179, 169, 113, 247, 192, 161, 4, 85, 4, 143, 51, 213, 34, 97, 61, 224, 37, 31,
-    110, 218, 237, 0, 239, 213, 57, 201, 234, 72, 88, 119, 39, 101, 23, 224, 243, 172, 224, 235, 149, 231, 121, 219,
-    247, 72, 155, 6, 186, 114, 109, 199, 40, 64, 136, 169, 95, 110, 9, 59, 13, 9, 162, 189, 250, 176, 81, 10, 41, 167,
-    47, 249, 171, 196, 21, 32, 222, 199, 13, 44, 198, 222, 141, 6, 51, 17, 74, 103, 248, 172, 51, 14, 185, 161, 116, 81,
-    152, 149, 23, 53, 245, 195, 32, 61, 52, 177, 229, 125, 190, 93, 55, 57, 50, 25, 109, 41, 108, 189, 148, 154, 240,
-    54, 38, 194, 200, 26, 165, 192, 211, 181, 185, 25, 110, 253, 251, 118, 13, 45, 31, 6, 228, 46, 132, 52, 34, 240,
-    234, 58, 87, 25, 135, 79, 1, 74, 178, 115, 219, 66, 236, 110, 147, 139, 207, 56, 155, 7, 63, 81, 155, 56, 48, 42,
-    141, 223, 20, 237, 163, 40, 180, 220, 163, 247, 96, 16, 236, 132, 119, 92, 172, 244, 44, 220, 31, 148, 208, 209,
-    179, 32, 75, 132, 178, 28, 93, 234, 227, 119, 168, 59, 83, 60, 4, 66, 26, 174, 122, 95, 98, 219, 233, 100, 217, 247,
-    19, 126, 25, 182, 8, 156, 7, 156, 105, 137, 15, 243, 154, 168, 103, 221, 46, 140, 52, 50, 58, 123, 68, 207, 199, 69,
-    145, 34, 219, 151, 35, 63, 37, 72, 33, 21, 183, 209, 28, 136, 52, 69, 136, 200, 31, 72, 58, 149, 98, 149, 226, 190,
-    207, 38, 44, 139, 189, 27, 170, 153, 70, 109, 102, 44, 110, 152, 175, 123, 159, 105, 188, 77, 136, 157, 251, 151,
-    48, 104, 42, 237, 204, 57, 20, 214, 157, 247, 224, 0, 118, 248, 113, 40, 115, 247, 203, 147, 177, 49, 113, 140, 233,
-    11, 206, 131, 222, 200, 48, 126, 157, 27, 65, 10, 181, 223, 170, 93, 248, 29, 142, 97, 249, 86, 125, 162, 140, 146,
-    48, 36, 31, 178, 245, 207, 65, 94, 118, 3, 93, 130, 2, 24, 14, 108, 254, 16, 2, 11, 244, 158, 96, 38, 148, 1, 28,
-    198, 10, 211, 178, 42, 85, 215, 67, 63, 28, 125, 35, 31, 68, 164, 202, 62, 59, 202, 66, 29, 87, 119, 137, 160, 57,
-    254, 150, 14, 6, 167, 231, 211, 63, 98, 231, 25, 19, 49, 121, 162, 140, 25, 10, 205, 163, 185, 73, 213, 253, 168,
-    192, 98, 142, 119, 72, 13, 221, 38, 72, 89, 185, 192, 116, 178, 51, 184, 222, 94, 45, 122, 239, 253, 101, 123, 255,
-    170, 137, 193, 45, 198, 9, 51, 29, 143, 203, 15, 45, 36, 139, 74, 149, 106, 172, 107, 20, 100, 14, 29, 117, 116,
-    169, 155, 162, 127, 84, 166, 137, 129, 220, 159, 205, 197, 77, 237, 13, 92, 183, 9, 141, 220, 101, 244, 71, 237,
-    187, 93, 140, 43, 160, 201, 140, 41, 138, 237, 49, 84, 38, 41, 241, 157, 174, 73, 78, 82, 112, 156, 245, 41, 40,
-    132, 122, 57, 51, 91, 10, 177, 11, 108, 133, 247, 227, 0, 220, 225, 65, 52, 163, 126, 135, 99, 131, 130, 62, 141,
-    234, 190, 216, 214, 168, 211, 76, 213, 39, 187, 190, 60, 201, 86, 136, 131, 134, 142, 156, 173, 10, 236, 164, 114,
-    96, 190, 252, 192, 9, 9, 16, 91, 202, 161, 126, 51, 162, 29, 47, 45, 163, 68, 121, 36, 166, 7, 36, 50, 15, 238, 65,
-    91, 254, 116, 88, 178, 161, 57, 95, 51, 30, 157, 207, 28, 216, 240, 37, 47, 179, 213, 66, 156, 82, 215, 100, 18, 31,
-    195, 166, 82, 71, 185, 35, 169, 169, 12, 20, 135, 45, 168, 227, 124, 252, 83, 69, 30, 18, 37, 250, 218, 120, 46,
-    246, 55, 118, 145, 214, 206, 192, 61, 168, 165, 1, 8, 10, 138, 79, 170, 86, 44, 120, 8, 185, 235, 142, 54, 197, 92,
-    180, 11, 46, 254, 223, 7, 99, 25, 177, 56, 76, 202, 233, 113, 105, 201, 28, 4, 39, 14, 226, 154, 2, 129, 12, 153,
-    141, 85, 67, 19, 76, 148, 10, 84, 124, 152, 170, 211, 109, 130, 205, 112, 26, 37, 7, 164, 168, 166, 9, 30, 97, 240,
-    122, 186, 240, 201, 152, 154, 90, 93, 117, 26, 201, 203, 67, 221, 49, 24, 133, 180, 31, 241, 37, 145, 158, 204, 245,
-    28, 65, 127, 100, 118, 18, 0, 210, 36, 63, 225, 7, 145, 149, 39, 47, 157, 90, 214, 243, 135, 242, 71, 202, 96, 128,
-    206, 160, 0, 9, 75, 51, 213, 241, 195, 69, 109, 195, 20, 26, 163, 91, 4, 88, 9, 78, 227, 243, 7, 225, 139, 133, 46,
-    46, 187, 127, 55, 224, 205, 107, 133, 60, 78, 161, 184, 236, 248, 42, 218, 163, 157, 190, 103, 90, 21, 52, 87, 145,
-    61, 142, 154, 22, 225, 114, 183, 227, 66, 120, 115, 198, 56, 237, 6, 4, 1, 93, 134, 32, 27, 53, 72, 3, 50, 170, 174,
-    32, 12, 216, 83, 76, 135, 205, 17, 30, 228, 118, 95, 199, 195, 206, 71, 51, 150, 59, 199, 152, 29, 254, 109, 72, 84,
-    76, 205, 124, 72, 58, 118, 251, 173, 249, 44, 215, 10, 188, 169, 122, 251, 250, 250, 186, 201, 199, 219, 203, 123,
-    116, 55, 49, 178, 54, 15, 125, 115, 32, 228, 75, 98, 223, 33, 101, 108, 75, 254, 156, 110, 43, 47, 169, 254, 215,
-    246, 110, 105, 37, 214, 149, 200, 9, 97, 189, 113, 164, 30, 30, 67, 74, 48, 53, 218, 171, 44, 30, 139, 202, 174, 29,
-    154, 224, 177, 233, 130, 68, 13, 224, 165, 252, 85, 212, 39, 42, 228, 181, 254, 13, 246, 133, 151, 30, 62, 184, 176,
-    201, 202, 89, 208, 127, 37, 151, 56, 239, 84, 239, 237, 234, 160, 209, 57, 102, 21, 111, 139, 219, 146, 61, 231,
-    178, 87, 112, 23, 167, 135, 8, 144, 92, 93, 5, 175, 92, 167, 80, 205, 137, 48, 17, 151, 109, 211, 41, 119, 12, 97,
-    120, 25, 196, 196, 229, 4, 63, 22, 221, 230, 148, 144, 208, 73, 22, 233, 9, 91, 220, 240, 69, 176, 129, 57, 130,
-    185, 98, 231, 86, 76, 227, 218, 217, 130, 84, 77, 109, 238, 235, 97, 193, 28, 202, 144, 215, 6, 119, 132, 219, 214,
-    76, 246, 11, 17, 135, 0, 120, 4, 157, 7, 102, 64, 139, 155, 202, 222, 182, 72, 13, 132, 139, 222, 70, 105, 149, 224,
-    31, 252, 204, 250, 87, 38, 192, 165, 221, 54, 124, 144, 120, 123, 122, 40, 117, 158, 102, 229, 21, 193, 118, 76,
-    211, 68, 61, 77, 73, 29, 161, 216, 128, 12, 154, 34, 135, 186, 22, 53, 34, 235, 210, 243, 58, 193, 185, 230, 236,
-    251, 49, 134, 249, 4, 218, 218, 166, 213, 144, 135, 174, 192, 133, 132, 157, 94, 205, 119, 252, 68, 20, 17, 3, 22,
-    97, 7, 85, 164, 75, 194, 61, 92, 195, 11, 79, 119, 10, 195, 203, 124, 85, 90, 26, 76, 44, 77, 176, 189, 1, 48, 156,
-    124, 66, 18, 110, 147, 1, 144, 78, 133, 171, 7, 147, 221, 79, 180, 244, 94, 161, 10, 91, 18, 152, 186, 153, 176,
-    188, 177, 128, 8, 115, 73, 138, 19, 187, 228, 78, 133, 36, 45, 164, 128, 26, 80, 164, 179, 187, 228, 23, 202, 186,
-    125, 79, 33, 19, 69, 34, 178, 151, 208, 124, 182, 184, 27, 52, 220, 95, 159, 130, 147, 5, 159, 0, 75, 130, 44, 81,
-    56, 182, 14, 41, 245, 226, 102, 213, 228, 187, 113, 207, 163, 144, 91, 253, 239, 138, 85, 124, 135, 104, 197, 106,
-    154, 2, 46, 110, 38, 81, 53, 139, 198, 204, 25, 31, 145, 211, 183, 143, 56, 189, 41, 227, 119, 95, 231, 113, 139,
-    234, 100, 196, 157, 107, 5, 208, 103, 75, 199, 26, 145, 11, 228, 197, 24, 227, 33, 97, 238, 214, 213, 105, 88, 37,
-    42, 179, 173, 62, 209, 139, 252, 88, 122, 43, 219, 94, 54, 132, 133, 251, 226, 122, 163, 175, 106, 215, 114, 215, 5,
-    139, 199, 92, 60, 185, 24, 91, 11, 64, 58, 124, 72, 107, 126, 218, 210, 233, 231, 248, 69, 194, 216, 16, 226, 215,
-    83, 160, 12, 19, 245, 151, 174, 31, 211, 96, 223, 107, 165, 98, 211, 156, 156, 107, 154, 242, 121, 166, 136, 177,
-    43, 122, 12, 174, 193, 35, 19, 61, 98, 85, 26, 202, 234, 157, 81, 69, 40, 103, 11, 73, 203, 196, 43, 94, 192, 63,
-    45, 183, 71, 85, 11, 113, 172, 80, 229, 173, 155, 42, 27, 78, 250, 155, 24, 247, 94, 35, 18, 71, 88, 218, 112, 244,
-    220, 130, 87, 121, 61, 42, 1, 208, 61, 131, 204, 104, 70, 26, 63, 106, 129, 227, 141, 222, 85, 142, 130, 172, 178,
-    119, 42, 82, 231, 251, 163, 191, 9, 43, 203, 144, 130, 167, 138, 117, 95, 6, 36, 178, 148, 184, 64, 242, 52, 101,
-    99, 175, 176, 56, 125, 177, 116, 41, 158, 64, 135, 3, 84, 135, 159, 101, 206, 171, 195, 94, 220, 91, 147, 192, 211,
-    143, 228, 37, 135, 104, 67, 67, 165, 128, 202, 18, 201, 182, 169, 32, 226, 181, 210, 111, 36, 48, 117, 246, 98, 248,
-    203, 54, 249, 214, 151, 144, 102, 206, 237, 190, 106, 140, 101, 237, 207, 105, 160, 214, 167, 202, 81, 151, 161, 70,
-    175, 120, 76, 63, 193, 123, 96, 192, 105, 138, 200, 184, 157, 196, 186, 51, 66, 132, 48, 129, 9, 186, 124, 244, 31,
-    66, 52, 139, 69, 171, 75, 144, 141, 85, 170, 43, 183, 150, 196, 76, 100, 151, 108, 255, 140, 153, 128, 185, 105,
-    242, 56, 56, 114, 244, 168, 58, 5, 83, 84, 247, 183, 126, 107, 48, 80, 193, 3, 23, 234, 139, 255, 184, 203, 34, 129,
-    147, 208, 196, 3, 44, 197, 158, 172, 20, 169, 19, 195, 170, 240, 34, 88, 183, 178, 187, 28, 21, 106, 253, 246, 108,
-    125, 36, 42, 9, 192, 185, 43, 20, 156, 30, 83, 165, 2, 155, 226, 53, 49, 140, 211, 111, 183, 2, 86, 162, 244, 210,
-    146, 55, 115, 203, 97, 220, 159, 100, 219, 77, 179, 216, 53, 229, 190, 221, 41, 157, 143, 204, 229, 210, 229, 208,
-    245, 134, 117, 109, 243, 224, 204, 6, 9, 67, 206, 92, 5, 209, 74, 108, 145, 59, 168, 51, 144, 61, 204, 220, 17, 177,
-    80, 249, 241, 254, 12, 229, 142, 245, 91, 145, 147, 21, 60, 34, 176, 104, 155, 251, 85, 181, 122, 184, 82, 151, 181,
-    40, 77, 11, 91, 229, 137, 137, 235, 227, 199, 7, 144, 85, 172, 72, 151, 67, 241, 217, 243, 192, 251, 139, 211, 201,
-    32, 15, 248, 163, 5, 199, 34, 125, 136, 12, 80, 105, 57, 62, 62, 229, 77, 119, 208, 122, 207, 71, 247, 178, 203,
-    229, 238, 186, 243, 168, 199, 252, 248, 94, 125, 252, 190, 208, 202, 204, 37, 185, 231, 216, 45, 214, 96, 172, 86,
-    233, 211, 245, 89, 198, 16, 139, 220, 69, 2, 205, 51, 147, 208, 249, 56, 198, 38, 48, 88, 22, 87, 238, 80, 136, 41,
-    151, 139, 86, 32, 5, 19, 165, 2, 22, 244, 108, 206, 18, 40, 104, 236, 236, 18, 234, 18, 122, 173, 248, 198, 162,
-    199, 108, 148, 71, 135, 225, 199, 125, 179, 58, 26, 43, 229, 211, 162, 32, 153, 63, 79, 13, 129, 11, 242, 243, 172,
-    23, 201, 170, 69, 171, 198, 27, 82, 169, 210, 71, 120, 31, 3, 62, 97, 201, 146, 235, 223, 13, 218, 2, 183, 169, 186,
-    55, 155, 138, 85, 224, 60, 28, 148, 255, 233, 36, 245, 103, 113, 229, 147, 172, 210, 13, 221, 204, 157, 188, 94,
-    166, 167, 80, 102, 6, 77, 188, 103, 69, 145, 207, 40, 225, 157, 201, 92, 213, 143, 152, 50, 62, 81, 160, 25, 213,
-    47, 171, 127, 37, 18, 8, 53, 181, 168, 49, 21, 249, 19, 154, 107, 90, 7, 89, 128, 187, 162, 39, 184, 1, 197, 221,
-    126, 203, 154, 139, 72, 198, 140, 75, 214, 183, 91, 81, 102, 44, 221, 71, 240, 145, 127, 53, 94, 179, 208, 229, 173,
-    91, 137, 54, 207, 32, 44, 151, 38, 25, 66, 19, 29, 230, 109, 217, 211, 93, 46, 225, 206, 153, 134, 135, 145, 59, 84,
-    74, 48, 182, 227, 208, 176, 45, 160, 198, 88, 103, 112, 46, 106, 143, 238, 64, 196, 231, 133, 3, 243, 81, 31, 185,
-    66, 44, 171, 30, 13, 92, 91, 20, 54, 9, 22, 14, 218, 118, 72, 119, 3, 172, 91, 183, 132, 124, 44, 197, 197, 241, 16,
-    194, 111, 237, 115, 248, 76, 229, 177, 107, 70, 206, 129, 254, 44, 244, 208, 114, 27, 48, 115, 248, 98, 29, 58, 188,
-    220, 141, 164, 208, 91, 71, 84, 142, 221, 44, 165, 234, 118, 92, 20, 27, 227, 131, 212, 161, 225, 17, 167, 155, 90,
-    180, 50, 220, 250, 52, 5, 34, 35, 130, 40, 240, 195, 51, 117, 236, 147, 79, 194, 242, 86, 246, 66, 42, 68, 39, 16,
-    220, 131, 22, 44, 10, 153, 79, 79, 124, 255, 96, 152, 77, 172, 103, 41, 130, 217, 222, 114, 0, 251, 220, 188, 195,
-    75, 62, 137, 30, 242, 203, 84, 204, 117, 83, 137, 81, 157, 43, 111, 94, 66, 32, 7, 176, 47, 190, 172, 149, 176, 107,
-    227, 21, 176, 92, 51, 215, 65, 159, 198, 120, 245, 92, 253, 179, 231, 97, 210, 55, 14, 61, 170, 195, 10, 125, 145,
-    87, 203, 237, 182, 151, 216, 181, 34, 144, 192, 97, 181, 26, 14, 94, 203, 100, 133, 31, 204, 217, 56, 144, 244, 237,
-    231, 27, 48, 26, 154, 227, 1, 250, 91, 131, 57, 56, 89, 20, 85, 33, 68, 255, 203, 224, 197, 79, 87, 44, 42, 255,
-    214, 226, 188, 120, 82, 43, 29, 91, 42, 62, 221, 52, 229, 173, 39, 204, 180, 170, 227, 184, 60, 200, 147, 200, 40,
-    146, 183, 131, 168, 79, 113, 90, 124, 207, 169, 1, 55, 255, 106, 33, 119, 12, 31, 50, 171, 94, 198, 207, 37, 150,
-    137, 177, 184, 194, 98, 54, 163, 206, 188, 206, 214, 28, 154, 16, 201, 194, 164, 70, 115, 245, 84, 129, 250, 168,
-    20, 201, 191, 54, 121, 141, 124, 144, 96, 241, 76, 42, 171, 59, 204, 223, 53, 252, 184, 236, 145, 48, 171, 21, 66,
-    175, 214, 22, 74, 242, 132, 128, 211, 48, 48, 178, 234, 15, 236, 137, 162, 120, 10, 89, 186, 218, 185, 48, 242, 67,
-    199, 19, 154, 217, 93, 93, 133, 88, 170, 149, 192, 54, 190, 180, 120, 185, 145, 241, 153, 151, 138, 106, 145, 83,
-    254, 183, 141, 79, 200, 131, 183, 146, 248, 157, 63, 194, 112, 147, 122, 152, 95, 191, 41, 223, 48, 47, 66, 72, 79,
-    72, 138, 209, 176, 152, 154, 44, 80, 177, 121, 12, 255, 220, 166, 34, 238, 8, 14, 255, 77, 113, 69, 189, 174, 96,
-    247, 217, 80, 179, 227, 136, 103, 192, 186, 129, 160, 209, 251, 212, 118, 101, 60, 235, 146, 196, 35, 33, 49, 187,
-    200, 137, 68, 200, 40, 252, 62, 190, 209, 102, 249, 130, 210, 67, 230, 178, 200, 18, 155, 164, 225, 23, 229, 139,
-    221, 86, 38, 9, 3, 46, 108, 75, 116, 9, 86, 95, 248, 44, 115, 28, 172, 65, 210, 145, 207, 32, 239, 91, 168, 173,
-    158, 12, 208, 170, 251, 135, 54, 222, 18, 18, 149, 250, 10, 57, 20, 50, 5, 150, 84, 206, 33, 160, 202, 142, 254,
-    133, 24, 39, 215, 45, 60, 110, 210, 147, 104, 236, 19, 16, 193, 201, 26, 103, 80, 103, 130, 119, 178, 169, 48, 169,
-    13, 197, 206, 221, 6, 248, 122, 60, 219, 105, 207, 222, 81, 55, 188, 57, 51, 139, 47, 86, 167, 53, 32, 101, 191, 89,
-    45, 126, 215, 219, 36, 29, 85, 101, 5, 204, 99, 171, 103, 217, 62, 211, 123, 157, 205, 220, 110, 158, 23, 221, 255,
-    12, 100, 111, 43, 137, 49, 7, 184, 4, 133, 241, 10, 68, 177, 14, 100, 218, 128, 82, 21, 249, 175, 24, 92, 172, 48,
-    210, 246, 41, 136, 231, 107, 28, 161, 242, 12, 19, 147, 78, 126, 12, 196, 224, 94, 3, 178, 250, 108, 172, 88, 226,
-    133, 102, 111, 164, 55, 182, 52, 137, 187, 154, 246, 148, 61, 53, 193, 95, 37, 244, 148, 82, 95, 110, 2, 168, 246,
-    101, 242, 131, 174, 205, 197, 101, 176, 220, 134, 233, 142, 169, 27, 114, 127, 170, 94, 186, 32, 78, 118, 22, 227,
-    243, 108, 193, 132, 194, 48, 244, 252, 251, 149, 182, 250, 214, 13, 124, 216, 30, 80, 158, 233, 252, 107, 59, 204,
-    194, 186, 175, 24, 191, 215, 178, 149, 174, 137, 180, 200, 199, 40, 216, 189, 161, 59, 173, 182, 98, 185, 48, 84,
-    234, 69, 198, 250, 160, 212, 242, 230, 66, 53, 38, 52, 163, 199, 23, 165, 55, 121, 209, 11, 44, 44, 116, 220, 77,
-    143, 228, 248, 19, 213, 10, 46, 34, 162, 108, 92, 28, 152, 213, 214, 251, 54, 15, 80, 140, 70, 164, 209, 75, 237,
-    197, 3, 250, 19, 158, 65, 34, 85, 68, 118, 192, 206, 178, 217, 251, 112, 244, 239, 235, 124, 181, 80, 242, 197, 82,
-    237, 194, 182, 79, 23, 169, 37, 170, 143, 200, 156, 146, 27, 45, 189, 187, 70, 18, 56, 138, 143, 83, 7, 80, 150, 53,
-    100, 189, 38, 249, 133, 153, 96, 176, 129, 225, 244, 165, 10, 105, 23, 3, 179, 201, 213, 44, 220, 245, 53, 37, 27,
-    254, 236, 237, 200, 173, 167, 169, 159, 231, 28, 197, 79, 218, 47, 165, 112, 206, 150, 212, 174, 154, 230, 81, 148,
-    117, 93, 19, 57, 180, 58, 42, 76, 27, 97, 113, 193, 143, 50, 68, 193, 200, 147, 78, 23, 144, 240, 9, 107, 9, 219,
-    59, 73, 245, 154, 235, 105, 150, 54, 160, 81, 230, 166, 254, 253, 47, 62, 195, 13, 121, 204, 58, 242, 67, 184, 80,
-    86, 236, 91, 148, 239, 185, 122, 122, 84, 62, 143, 93, 92, 208, 64, 118, 59, 240, 85, 147, 117, 62, 197, 98, 116,
-    235, 163, 225, 18, 182, 90, 127, 28, 220, 190, 26, 194, 83, 206, 82, 225, 241, 142, 214, 65, 185, 116, 184, 231,
-    180, 0, 248, 111, 98, 242, 154, 118, 243, 180, 99, 243, 253, 212, 28, 206, 21, 104, 96, 136, 189, 168, 192, 255,
-    167, 72, 133, 33, 72, 157, 111, 200, 42, 196, 164, 178, 207, 80, 130, 126, 79, 89, 117, 170, 96, 176, 82, 129, 8,
-    158, 34, 123, 30, 166, 34, 125, 237, 215, 119, 16, 66, 231, 88, 171, 153, 179, 131, 12, 140, 7, 93, 49, 129, 206,
-    64, 125, 55, 233, 211, 202, 149, 0, 113, 52, 128, 165, 75, 239, 255, 116, 18, 14, 140, 115, 188, 87, 248, 224, 95,
-    249, 128, 35, 110, 90, 79, 31, 25, 180, 60, 106, 71, 186, 198, 80, 242, 83, 59, 73, 156, 103, 202, 234, 161, 179,
-    69, 64, 195, 10, 153, 83, 244, 127, 136, 78, 213, 219, 201, 254, 191, 228, 145, 124, 37, 102, 142, 174, 181, 207,
-    139, 223, 89, 9, 192, 50, 63, 227, 226, 93, 199, 78, 121, 211, 70, 101, 255, 0, 174, 54, 197, 61, 243, 207, 158,
-    226, 157, 44, 164, 149, 173, 14, 34, 159, 195, 137, 27, 246, 21, 32, 97, 81, 102, 19, 18, 4, 52, 221, 229, 208, 156,
-    83, 175, 88, 31, 139, 65, 58, 255, 52, 168, 176, 19, 151, 28, 18, 4, 19, 51, 99, 152, 4, 70, 182, 196, 231, 231,
-    111, 226, 160, 83, 88, 93, 19, 171, 212, 146, 159, 227, 170, 45, 232, 4, 44, 206, 215, 161, 103, 35, 255, 23, 10,
-    223, 201, 89, 134, 201, 125, 232, 212, 136, 109, 11, 124, 159, 205, 206, 144, 48, 114, 184, 78, 207, 108, 129, 101,
-    188, 137, 183, 200, 227, 244, 215, 2, 176, 89, 157, 250, 185, 183, 163, 63, 62, 150, 174, 165, 86, 138, 139, 242,
-    24, 254, 130, 163, 18, 70, 99, 35, 104, 175, 25, 230, 245, 107, 47, 228, 179, 155, 101, 120, 127, 149, 118, 249, 37,
-    8, 177, 161, 87, 70, 182, 18, 153, 45, 13, 48, 166, 83, 107, 170, 175, 162, 247, 123, 147, 60, 185, 10, 123, 53, 43,
-    214, 134, 173, 235, 137, 219, 243, 205, 112, 16, 132, 49, 182, 37, 161, 187, 211, 192, 89, 31, 133, 22, 128, 13,
-    176, 104, 65, 56, 99, 149, 197, 173, 191, 71, 135, 63, 53, 227, 250, 71, 230, 167, 137, 22, 60, 199, 117, 197, 162,
-    60, 118, 238, 119, 161, 231, 84, 214, 87, 86, 13, 9, 69, 193, 184, 92, 211, 252, 249, 150, 116, 76, 96, 128, 145,
-    102, 31, 101, 6, 162, 27, 44, 7, 244, 17, 39, 34, 166, 10, 40, 151, 137, 4, 106, 0, 157, 209, 145, 49, 79, 49, 147,
-    127, 62, 86, 104, 75, 192, 226, 236, 150, 197, 157, 192, 26, 58, 225, 220, 98, 255, 127, 84, 173, 57, 70, 145, 187,
-    48, 67, 96, 69, 69, 74, 117, 53, 152, 139, 43, 193, 254, 56, 55, 178, 229, 21, 83, 83, 162, 182, 26, 10, 16, 7, 83,
-    116, 86, 232, 72, 45, 205, 5, 213, 50, 8, 59, 198, 231, 97, 170, 198, 146, 138, 84, 61, 6, 50, 96, 172, 137, 201,
-    20, 206, 25, 59, 0, 83, 241, 30, 97, 5, 108, 161, 132, 94, 114, 139, 216, 172, 113, 132, 77, 25, 39, 136, 44, 109,
-    167, 14, 23, 15, 200, 106, 53, 6, 54, 149, 47, 133, 154, 208, 179, 62, 13, 22, 200, 18, 27, 194, 179, 220, 198, 241,
-    35, 70, 206, 218, 92, 38, 9, 213, 226, 227, 237, 176, 215, 15, 79, 128, 109, 193, 97, 132, 194, 224, 19, 213, 211,
-    139, 124, 188, 170, 170, 206, 225, 154, 195, 240, 126, 108, 243, 116, 127, 107, 7, 188, 251, 138, 252, 87, 150, 9,
-    165, 98, 174, 133, 13, 97, 155, 132, 62, 214, 190, 112, 165, 177, 244, 53, 127, 166, 86, 161, 12, 227, 39, 28, 61,
-    99, 215, 216, 164, 85, 46, 173, 81, 152, 239, 136, 167, 57, 28, 113, 190, 76, 114, 196, 220, 87, 8, 123, 5, 229,
-    218, 184, 225, 113, 117, 138, 203, 92, 81, 16, 48, 236, 75, 35, 28, 137, 16, 127, 45, 174, 167, 112, 129, 246, 84,
-    152, 38, 164, 62, 114, 215, 183, 161, 213, 107, 13, 229, 129, 227, 161, 8, 71, 174, 140, 27, 4, 194, 40, 241, 33,
-    95, 20, 193, 8, 197, 156, 83, 26, 106, 212, 54, 251, 255, 94, 155, 10, 143, 127, 32, 30, 251, 43, 160, 181, 50, 204,
-    155, 95, 229, 6, 209, 77, 160, 38, 217, 26, 86, 164, 153, 80, 2, 89, 156, 167, 89, 89, 160, 104, 96, 239, 79, 201,
-    22, 53, 164, 144, 254, 146, 0, 145, 227, 217, 157, 78, 204, 216, 160, 70, 129, 4, 78, 131, 104, 240, 88, 118, 32,
-    92, 4, 79, 65, 124, 250, 36, 8, 136, 79, 18, 220, 71, 243, 173, 23, 193, 162, 34, 60, 156, 234, 71, 128, 114, 58,
-    152, 25, 70, 174, 59, 211, 42, 230, 167, 207, 252, 210, 148, 90, 221, 239, 199, 36, 109, 75, 46, 247, 168, 13, 231,
-    168, 137, 115, 126, 171, 89, 160, 111, 170, 196, 253, 141, 52, 1, 29, 30, 20, 44, 44, 223, 31, 209, 103, 101, 202,
-    115, 175, 197, 215, 89, 81, 188, 91, 9, 250, 35, 133, 14, 156, 144, 159, 152, 255, 127, 209, 211, 93, 6, 108, 49,
-    141, 231, 0, 137, 22, 185, 223, 174, 104, 145, 41, 53, 50, 26, 196, 174, 93, 79, 97, 174, 92, 12, 66, 14, 2, 212,
-    42, 134, 246, 235, 116, 233, 228, 144, 207, 255, 198, 215, 189, 250, 212, 132, 167, 4, 208, 120, 248, 117, 149, 88,
-    199, 131, 159, 41, 129, 62, 241, 247, 190, 167, 3, 59, 145, 100, 8, 178, 73, 207, 115, 5, 196, 81, 42, 154, 222,
-    197, 183, 36, 10, 169, 229, 158, 161, 89, 231, 128, 67, 153, 89, 130, 86, 162, 125, 228, 7, 117, 185, 251, 227, 106,
-    195, 60, 15, 57, 1, 82, 56, 102, 52, 46, 182, 132, 239, 8, 22, 86, 139, 144, 43, 248, 232, 147, 129, 155, 37, 104,
-    122, 43, 7, 177, 233, 8, 147, 148, 17, 250, 159, 26, 136, 144, 104, 86, 37, 2, 226, 44, 133, 191, 247, 45, 236, 131,
-    38, 36, 98, 250, 180, 69, 241, 0, 95, 180, 136, 250, 206, 84, 197, 62, 54, 67, 131, 221, 139, 126, 144, 75, 167, 7,
-    47, 235, 239, 155, 17, 160, 216, 162, 36, 52, 81, 86, 155, 54, 253, 196, 99, 209, 91, 206, 25, 53, 33, 135, 170,
-    101, 24, 189, 178, 4, 186, 169, 200, 237, 105, 250, 164, 135, 42, 215, 219, 193, 63, 177, 158, 52, 178, 205, 148,
-    103, 34, 58, 134, 86, 178, 187, 144, 233, 132, 190, 11, 66, 97, 237, 160, 247, 106, 59, 190, 9, 55, 60, 23, 209,
-    173, 33, 140, 110, 54, 161, 132, 197, 50, 36, 173, 118, 133, 34, 24, 120, 1, 195, 137, 102, 217, 6, 25, 131, 25,
-    168, 228, 148, 248, 67, 102, 167, 73, 240, 93, 98, 154, 217, 3, 137, 211, 224, 45, 181, 230, 127, 16, 60, 23, 60,
-    218, 58, 53, 108, 161, 28, 9, 118, 203, 148, 90, 126, 102, 24, 243, 250, 46, 53, 44, 197, 214, 69, 199, 249, 229,
-    12, 131, 192, 14, 229, 151, 77, 238, 34, 92, 230, 198, 185, 205, 154, 65, 15, 74, 235, 245, 31, 160, 115, 233, 237,
-    214, 197, 192, 179, 181, 35, 207, 94, 103, 170, 162, 146, 139, 104, 195, 36, 129, 230, 200, 133, 48, 158, 144, 56,
-    234, 138, 56, 15, 211, 34, 199, 66, 91, 105, 62, 29, 222, 179, 244, 65, 218, 220, 109, 29, 107, 13, 209, 192, 11,
-    191, 33, 13, 39, 240, 79, 168, 2, 112, 119, 20, 98, 200, 142, 226, 127, 176, 226, 161, 214, 116, 94, 195, 57, 135,
-    255, 138, 46, 198, 233, 108, 3, 181, 201, 7, 227, 110, 14, 18, 92, 14, 170, 139, 194, 228, 225, 9, 78, 110, 171,
-    204, 209, 89, 229, 194, 90, 209, 227, 170, 76, 248, 121, 25, 91, 17, 245, 111, 0, 119, 201, 187, 151, 42, 144, 89,
-    150, 23, 78, 66, 24, 185, 226, 144, 219, 127, 134, 202, 157, 113, 197, 94, 22, 105, 40, 44, 118, 211, 128, 221, 43,
-    51, 34, 140, 180, 105, 99, 228, 242, 42, 60, 253, 177, 104, 63, 33, 88, 132, 59, 86, 125, 10, 135, 87, 65, 196, 113,
-    202, 28, 241, 104, 151, 90, 33, 179, 1, 145, 26, 102, 181, 147, 107, 177, 141, 28, 216, 8, 87, 141, 54, 198, 69,
-    255, 193, 8, 118, 197, 21, 116, 71, 28, 87, 171, 123, 147, 45, 14, 6, 242, 208, 209, 255, 185, 124, 192, 193, 20,
-    253, 150, 149, 238, 53, 24, 216, 117, 125, 142, 234, 68, 85, 148, 16, 164, 105, 176, 114, 192, 217, 124, 50, 42, 91,
-    157, 47, 92, 63, 66, 72, 8, 172, 1, 75, 118, 217, 234, 44, 230, 160, 236, 177, 29, 118, 130, 46, 70, 17, 171, 221,
-    144, 13, 146, 133, 142, 18, 168, 205, 150, 20, 32, 252, 238, 192, 162, 213, 10, 23, 66, 116, 126, 103, 24, 205, 132,
-    37, 217, 169, 173, 15, 118, 54, 110, 226, 99, 49, 82, 117, 144, 171, 124, 242, 246, 184, 47, 239, 194, 255, 197, 21,
-    180, 39, 87, 68, 130, 180, 95, 73, 25, 171, 54, 18, 40, 84, 226, 34, 230, 190, 200, 102, 57, 50, 89, 132, 28, 119,
-    154, 253, 249, 171, 173, 127, 176, 55, 246, 86, 71, 92, 29, 42, 155, 111, 22, 75, 173, 229, 141, 70, 67, 189, 152,
-    103, 155, 56, 193, 65, 183, 240, 44, 244, 252, 67, 3, 218, 212, 245, 197, 188, 18, 121, 85, 50, 171, 43, 233, 139,
-    51, 255, 153, 255, 200, 200, 248, 99, 186, 225, 15, 94, 89, 81, 50, 25, 59, 200, 201, 188, 199, 98, 64, 73, 222,
-    176, 7, 47, 217, 234, 175, 113, 27, 107, 155, 165, 114, 212, 95, 59, 253, 154, 127, 12, 76, 65, 9, 220, 144, 149,
-    65, 190, 153, 84, 61, 148, 27, 41, 73, 18, 107, 87, 85, 77, 158, 227, 122, 254, 202, 16, 12, 239, 222, 135, 196,
-    110, 231, 59, 30, 93, 118, 79, 93, 224, 76, 213, 210, 62, 200, 162, 216, 187, 162, 228, 174, 175, 100, 249, 13, 169,
-    52, 173, 98, 209, 219, 174, 194, 164, 31, 37, 5, 181, 83, 233, 33, 7, 237, 89, 210, 115, 161, 132, 247, 61, 149, 70,
-    85, 67, 135, 252, 122, 0, 97, 140, 121, 112, 25, 42, 35, 111, 130, 23, 127, 41, 53, 141, 40, 54, 207, 20, 3, 78,
-    201, 87, 240, 35, 5, 107, 241, 145, 1, 175, 190, 217, 38, 60, 223, 255, 118, 222, 102, 143, 250, 25, 164, 76, 90,
-    89, 185, 126, 171, 49, 223, 187, 1, 245, 44, 225, 48, 187, 228, 51, 121, 93, 61, 23, 202, 55, 138, 205, 16, 64, 50,
-    244, 131, 104, 231, 237, 153, 232, 181, 74, 86, 170, 134, 28, 213, 175, 55, 81, 97, 0, 246, 59, 214, 210, 48, 100,
-    27, 238, 65, 189, 29, 54, 149, 250, 33, 58, 252, 113, 200, 221, 18, 255, 52, 161, 226, 92, 117, 17, 88, 17, 220,
-    138, 252, 51, 182, 76, 253, 75, 95, 245, 237, 66, 226, 158, 55, 196, 95, 247, 224, 99, 193, 42, 83, 196, 68, 11,
-    120, 16, 18, 129, 25, 241, 72, 136, 69, 11, 234, 28, 165, 61, 47, 138, 48, 163, 194, 4, 237, 5, 230, 85, 18, 5, 31,
-    48, 14, 123, 253, 45, 31, 238, 120, 140, 22, 141, 48, 232, 169, 48, 136, 105, 127, 214, 100, 44, 218, 54, 16, 143,
-    43, 74, 49, 41, 248, 218, 30, 11, 202, 113, 60, 36, 130, 99, 225, 118, 168, 89, 255, 63, 139, 115, 156, 104, 226,
-    133, 105, 61, 8, 182, 173, 85, 174, 250, 104, 224, 75, 82, 141, 91, 21, 174, 236, 233, 122, 4, 128, 32, 189, 169,
-    178, 249, 159, 163, 174, 101, 225, 85, 75, 158, 172, 123, 214, 109, 54, 179, 140, 0, 92, 177, 72, 243, 70, 14, 132,
-    56, 51, 221, 21, 140, 94, 203, 203, 92, 34, 24, 52, 32, 130, 147, 219, 51, 22, 117, 167, 36, 54, 229, 94, 34, 206,
-    134, 52, 220, 117, 212, 228, 138, 134, 24, 198, 118, 59, 19, 155, 184, 91, 151, 9, 43, 91, 126, 230, 18, 182, 148,
-    195, 142, 180, 248, 207, 27, 20, 0, 145, 35, 78, 42, 233, 12, 210, 93, 223, 157, 13, 74, 100, 192, 21, 157, 174,
-    136, 59, 77, 247, 235, 184, 57, 172, 178, 156, 14, 64, 92, 224, 22, 157, 118, 2, 7, 38, 27, 218, 30, 80, 171, 117,
-    164, 87, 124, 104, 4, 56, 91, 212, 46, 78, 146, 24, 70, 251, 113, 220, 247, 214, 40, 184, 94, 177, 182, 227, 120,
-    130, 28, 107, 119, 226, 126, 81, 9, 117, 200, 106, 142, 102, 55, 154, 117, 239, 228, 56, 125, 26, 13, 228, 144, 76,
-    93, 4, 141, 103, 233, 10, 86, 185, 215, 11, 127, 191, 231, 213, 120, 102, 1, 223, 50, 102, 141, 237, 109, 225, 24,
-    115, 211, 2, 221, 81, 248, 132, 247, 113, 34, 119, 171, 36, 27, 246, 13, 4, 180, 141, 244, 45, 77, 125, 247, 58,
-    168, 163, 118, 220, 47, 168, 149, 46, 46, 91, 118, 110, 82, 91, 239, 46, 34, 195, 235, 249, 166, 140, 90, 23, 96,
-    55, 250, 84, 195, 223, 64, 78, 244, 15, 31, 57, 34, 190, 78, 16, 222, 115, 35, 240, 13, 65, 98, 145, 6, 32, 200, 93,
-    28, 2, 233, 45, 122, 16, 103, 208, 218, 34, 158, 20, 225, 150, 143, 7, 160, 30, 45, 48, 204, 111, 47, 61, 53, 81,
-    80, 24, 175, 32, 123, 60, 239, 78, 73, 154, 160, 59, 227, 155, 41, 86, 14, 169, 66, 199, 184, 126, 80, 78, 74, 93,
-    213, 75, 245, 108, 68, 55, 74, 171, 93, 3, 21, 20, 210, 170, 241, 251, 224, 194, 31, 65, 193, 166, 146, 110, 215,
-    143, 33, 255, 101, 233, 235, 144, 95, 222, 52, 218, 86, 105, 126, 37, 47, 241, 218, 74, 14, 115, 55, 94, 134, 135,
-    241, 14, 32, 88, 61, 162, 97, 105, 97, 158, 100, 125, 96, 190, 134, 127, 144, 9, 84, 54, 200, 251, 114, 245, 189,
-    99, 11, 245, 197, 1, 228, 195, 149, 196, 172, 210, 253, 145, 101, 104, 199, 29, 198, 215, 167, 150, 183, 235, 235,
-    198, 94, 136, 171, 124, 196, 60, 228, 209, 207, 29, 33, 92, 229, 120, 168, 130, 218, 195, 231, 221, 17, 70, 97, 192,
-    8, 7, 52, 151, 173, 221, 186, 32, 203, 62, 251, 113, 192, 10, 126, 182, 206, 97, 128, 251, 113, 84, 52, 185, 84,
-    116, 68, 113, 233, 145, 218, 80, 44, 43, 91, 146, 12, 37, 73, 194, 223, 121, 32, 151, 47, 83, 113, 176, 176, 69,
-    129, 96, 243, 141, 16, 253, 135, 184, 96, 112, 157, 19, 197, 188, 98, 154, 14, 74, 149, 84, 38, 227, 204, 180, 255,
-    241, 179, 25, 19, 128, 50, 209, 147, 196, 139, 184, 251, 26, 128, 46, 230, 9, 52, 75, 165, 131, 5, 36, 151, 136,
-    231, 61, 89, 240, 13, 49, 45, 201, 222, 193, 55, 137, 253, 207, 100, 200, 142, 42, 37, 74, 117, 62, 223, 217, 78,
-    187, 197, 109, 42, 202, 254, 190, 233, 183, 58, 150, 13, 14, 17, 211, 158, 102, 84, 18, 139, 77, 223, 217, 253, 66,
-    207, 239, 55, 130, 78, 242, 35, 118, 190, 104, 195, 17, 215, 135, 223, 186, 49, 117, 174, 231, 121, 209, 12, 143,
-    251, 249, 233, 127, 75, 118, 12, 188, 192, 241, 205, 244, 141, 36, 31, 137, 168, 47, 222, 186, 17, 154, 193, 102, 3,
-    22, 25, 142, 107, 106, 234, 119, 61, 72, 78, 48, 161, 195, 15, 239, 166, 223, 42, 51, 221, 16, 78, 66, 65, 249, 182,
-    41, 114, 116, 185, 201, 102, 192, 252, 193, 115, 50, 128, 52, 214, 253, 242, 173, 188, 78, 48, 57, 113, 255, 34, 85,
-    216, 224, 227, 225, 52, 84, 37, 118, 94, 63, 5, 27, 7, 1, 68, 239, 169, 223, 240, 42, 227, 240, 172, 176, 251, 88,
-    245, 202, 205, 138, 29, 114, 91, 209, 93, 42, 57, 141, 232, 198, 11, 54, 1, 178, 170, 181, 244, 134, 154, 176, 239,
-    219, 45, 204, 229, 198, 123, 161, 21, 67, 45, 133, 135, 133, 225, 29, 22, 210, 48, 150, 147, 119, 47, 229, 201, 27,
-    165, 165, 62, 91, 72, 96, 109, 188, 26, 164, 81, 111, 201, 137, 13, 184, 19, 128, 85, 0, 78, 110, 76, 162, 170, 205,
-    120, 250, 136, 27, 255, 190, 240, 80, 236, 251, 129, 137, 161, 151, 87, 246, 136, 20, 167, 83, 6, 228, 27, 206, 205,
-    198, 252, 204, 193, 206, 4, 19, 178, 111, 196, 35, 90, 239, 248, 87, 19, 17, 11, 22, 230, 160, 122, 116, 143, 5,
-    238, 51, 179, 166, 186, 57, 17, 0, 190, 177, 233, 174, 162, 92, 31, 155, 57, 70, 118, 187, 143, 121, 54, 196, 165,
-    147, 47, 56, 184, 247, 182, 16, 123, 144, 58, 91, 116, 52, 214, 105, 21, 52, 65, 188, 208, 84, 9, 122, 29, 219, 133,
-    15, 179, 85, 115, 64, 222, 118, 137, 47, 236, 54, 30, 28, 0, 240, 38, 58, 60, 107, 142, 120, 95, 153, 81, 99, 59,
-    65, 197, 104, 184, 193, 85, 20, 187, 60, 171, 197, 98, 243, 133, 179, 219, 166, 146, 123, 49, 252, 228, 189, 237,
-    191, 3, 18, 200, 133, 219, 89, 144, 184, 65, 118, 251, 204, 168, 195, 226, 16, 117, 93, 93, 111, 242, 48, 57, 37,
-    141, 57, 114, 244, 31, 106, 217, 90, 31, 117, 112, 29, 33, 219, 161, 70, 56, 106, 176, 124, 154, 81, 186, 136, 240,
-    154, 225, 152, 199, 191, 85, 247, 240, 104, 238, 238, 53, 113, 148, 232, 102, 29, 13, 228, 110, 157, 58, 32, 55,
-    223, 128, 46, 202, 64, 224, 83, 121, 120, 78, 87, 232, 85, 108, 101, 196, 28, 17, 191, 107, 240, 26, 165, 114, 46,
-    169, 131, 30, 199, 112, 141, 40, 25, 232, 228, 157, 138, 33, 123, 26, 115, 186, 10, 42, 48, 180, 124, 90, 38, 227,
-    215, 114, 216, 101, 184, 212, 179, 160, 235, 152, 13, 168, 193, 239, 154, 18, 103, 201, 156, 68, 190, 172, 121, 251,
-    184, 140, 77, 100, 185, 66, 237, 83, 245, 67, 243, 230, 154, 0, 23, 57, 8, 9, 52, 47, 210, 66, 239, 180, 21, 182,
-    180, 226, 185, 44, 84, 8, 113, 112, 135, 80, 39, 113, 146, 121, 228, 18, 108, 135, 73, 43, 0, 71, 102, 224, 116,
-    121, 43, 53, 92, 164, 217, 120, 188, 16, 1, 198, 193, 148, 99, 68, 198, 135, 2, 135, 194, 153, 228, 143, 97, 217,
-    201, 175, 220, 154, 22, 58, 53, 157, 167, 64, 167, 194, 49, 166, 40, 234, 108, 15, 126, 125, 65, 39, 59, 239, 218,
-    1, 182, 63, 93, 111, 113, 69, 188, 236, 69, 173, 234, 39, 233, 79, 128, 61, 229, 175, 61, 217, 80, 143, 26, 246,
-    112, 247, 89, 204, 124, 133, 36, 96, 188, 91, 82, 119, 209, 119, 55, 115, 65, 178, 82, 234, 209, 21, 72, 215, 176,
-    126, 4, 127, 42, 241, 136, 67, 62, 9, 199, 152, 82, 168, 64, 64, 173, 41, 73, 214, 234, 252, 65, 213, 72, 122, 95,
-    148, 241, 230, 181, 203, 59, 81, 163, 238, 69, 230, 97, 166, 16, 213, 215, 240, 132, 158, 55, 201, 223, 19, 217, 66,
-    39, 110, 42, 199, 4, 249, 251, 19, 126, 23, 219, 126, 73, 141, 158, 61, 200, 34, 126, 67, 239, 75, 123, 145, 70, 69,
-    83, 29, 85, 113, 204, 185, 87, 244, 213, 104, 69, 104, 178, 223, 81, 251, 53, 134, 83, 80, 39, 115, 212, 9, 160, 53,
-    101, 181, 255, 19, 8, 193, 75, 132, 34, 67, 60, 80, 63, 222, 119, 225, 84, 170, 91, 71, 77, 236, 18, 231, 151, 183,
-    137, 52, 166, 46, 189, 62, 88, 99, 53, 147, 91, 164, 171, 117, 95, 196, 55, 71, 49, 40, 117, 219, 230, 97, 55, 61,
-    205, 159, 17, 49, 26, 173, 69, 69, 231, 61, 245, 127, 97, 5, 238, 9, 161, 64, 63, 150, 96, 224, 71, 148, 140, 152,
-    103, 122, 196, 153, 113, 120, 89, 89, 24, 121, 35, 239, 94, 237, 11, 156, 135, 130, 7, 57, 252, 253, 152, 73, 111,
-    114, 37, 127, 90, 185, 179, 253, 103, 225, 110, 22, 160, 100, 1, 112, 155, 78, 64, 15, 180, 163, 82, 114, 21, 148,
-    181, 87, 71, 218, 0, 43, 221, 253, 175, 38, 9, 108, 158, 91, 123, 88, 218, 33, 172, 166, 176, 112, 79, 180, 227,
-    249, 44, 229, 194, 253, 109, 4, 208, 87, 64, 191, 70, 137, 86, 136, 237, 33, 151, 231, 41, 96, 14, 241, 174, 59,
-    200, 36, 42, 95, 121, 55, 192, 139, 137, 16, 130, 131, 38, 237, 90, 46, 210, 204, 92, 238, 228, 91, 214, 240, 169,
-    37, 102, 53, 200, 49, 254, 62, 217, 53, 94, 119, 23, 53, 237, 70, 155, 141, 40, 190, 253, 169, 174, 111, 186, 119,
-    233, 141, 43, 2, 208, 222, 249, 155, 238, 179, 184, 27, 141, 33, 177, 8, 72, 4, 3, 240, 138, 37, 65, 104, 205, 58,
-    215, 179, 49, 33, 43, 18, 168, 71, 28, 239, 95, 30, 2, 9, 85, 77, 102, 113, 120, 105, 237, 202, 38, 101, 251, 16, 0,
-    71, 173, 208, 159, 248, 99, 27, 153, 47, 75, 0, 192, 241, 50, 94, 137, 90, 97, 132, 59, 94, 123, 35, 244, 184, 6,
-    210, 89, 178, 7, 95, 150, 136, 165, 231, 154, 219, 220, 86, 174, 99, 18, 42, 98, 184, 213, 18, 233, 59, 172, 25,
-    215, 133, 175, 8, 116, 232, 237, 187, 105, 57, 70, 78, 19, 99, 19, 11, 124, 250, 68, 98, 93, 156, 151, 113, 66, 229,
-    115, 159, 206, 24, 105, 64, 81, 246, 115, 74, 136, 80, 72, 199, 217, 112, 159, 190, 17, 80, 227, 58, 202, 218, 185,
-    2, 55, 75, 227, 239, 152, 250, 86, 69, 232, 147, 76, 240, 181, 224, 230, 205, 152, 148, 30, 5, 159, 175, 249, 59,
-    31, 20, 199, 112, 245, 11, 191, 161, 42, 113, 5, 241, 125, 204, 9, 140, 174, 83, 234, 95, 239, 178, 93, 150, 47,
-    163, 177, 14, 26, 235, 214, 107, 134, 103, 64, 37, 205, 223, 108, 187, 30, 220, 78, 211, 224, 250, 134, 203, 239, 2,
-    172, 78, 48, 130, 13, 151, 21, 224, 4, 210, 30, 253, 46, 185, 128, 150, 74, 224, 161, 202, 235, 157, 221, 15, 43, 4,
-    206, 148, 199, 203, 142, 220, 82, 149, 248, 74, 70, 253, 242, 98, 37, 149, 197, 113, 96, 210, 112, 246, 248, 177,
-    248, 54, 172, 176, 155, 235, 102, 26, 3, 40, 39, 39, 100, 210, 134, 83, 192, 179, 7, 158, 152, 237, 177, 172, 105,
-    199, 33, 30, 237, 142, 239, 138, 35, 11, 63, 14, 78, 121, 183, 134, 10, 4, 59, 152, 80, 114, 41, 67, 38, 28, 28,
-    174, 148, 93, 172, 45, 38, 88, 223, 43, 214, 133, 0, 89, 226, 6, 58, 33, 19, 176, 171, 38, 75, 101, 7, 88, 87, 235,
-    43, 202, 169, 188, 139, 157, 140, 124, 175, 61, 127, 165, 116, 126, 129, 186, 204, 2, 122, 64, 177, 234, 44, 225,
-    82, 242, 227, 29, 76, 251, 185, 8, 243, 83, 193, 45, 228, 195, 5, 208, 234, 130, 204, 98, 39, 89, 95, 158, 150, 49,
-    73, 206, 106, 101, 36, 96, 248, 195, 117, 152, 39, 223, 198, 216, 8, 14, 65, 60, 200, 109, 219, 49, 115, 142, 226,
-    179, 105, 31, 92, 48, 51, 105, 247, 231, 93, 152, 184, 160, 99, 228, 108, 67, 113, 45, 21, 247, 210, 128, 205, 21,
-    90, 251, 75, 189, 147, 246, 176, 184, 98, 79, 150, 237, 82, 146, 147, 66, 148, 94, 35, 127, 102, 77, 136, 217, 169,
-    245, 105, 102, 29, 99, 11, 227, 215, 93, 99, 59, 41, 204, 199, 31, 212, 185, 174, 128, 243, 60, 58, 238, 172, 151,
-    82, 43, 150, 255, 55, 114, 201, 230, 196, 185, 253, 11, 57, 121, 81, 220, 137, 201, 83, 197, 150, 194, 155, 136, 31,
-    107, 15, 20, 181, 36, 12, 164, 242, 251, 123, 58, 189, 207, 237, 57, 83, 75, 102, 130, 53, 202, 219, 154, 86, 108,
-    114, 13, 127, 2, 81, 118, 197, 111, 207, 214, 18, 147, 29, 173, 173, 151, 209, 228, 201, 142, 206, 87, 20, 12, 196,
-    84, 78, 91, 157, 117, 198, 122, 167, 202, 44, 49, 17, 58, 229, 123, 72, 173, 76, 112, 133, 182, 13, 79, 151, 230,
-    236, 109, 238, 76, 238, 191, 195, 225, 209, 55, 169, 63, 139, 222, 22, 4, 86, 108, 171, 208, 129, 205, 55, 190, 239,
-    60, 208, 48, 32, 51, 109, 18, 46, 253, 140, 80, 166, 243, 163, 252, 160, 150, 159, 246, 134, 241, 218, 48, 39, 124,
-    4, 162, 113, 169, 200, 186, 183, 55, 68, 217, 78, 174, 87, 193, 239, 28, 214, 38, 16, 193, 70, 109, 142, 115, 170,
-    28, 39, 77, 246, 146, 12, 48, 156, 221, 140, 245, 151, 92, 236, 228, 107, 31, 70, 73, 193, 129, 165, 106, 56, 126,
-    220, 160, 202, 85, 10, 57, 52, 92, 82, 42, 176, 113, 67, 193, 187, 156, 32, 16, 109, 18, 197, 53, 69, 223, 218, 43,
-    164, 154, 63, 37, 52, 62, 231, 95, 3, 140, 155, 95, 129, 38, 149, 34, 49, 133, 93, 101, 164, 248, 167, 114, 177,
-    144, 29, 175, 32, 127, 238, 62, 142, 248, 133, 23, 254, 163, 111, 114, 22, 142, 91, 91, 74, 91, 204, 144, 121, 233,
-    55, 181, 44, 13, 145, 173, 100, 69, 55, 1, 169, 70, 179, 29, 223, 95, 68, 242, 118, 79, 5, 58, 161, 81, 121, 210,
-    180, 222, 10, 104, 219, 151, 52, 161, 234, 90, 182, 189, 36, 89, 225, 245, 36, 222, 215, 218, 125, 176, 71, 82, 248,
-    71, 53, 178, 213, 62, 255, 125, 67, 68, 228, 181, 123, 206, 30, 87, 100, 119, 126, 45, 118, 155, 22, 157, 12, 192,
-    191, 45, 238, 218, 193, 211, 28, 35, 80, 216, 44, 183, 4, 204, 170, 209, 96, 212, 200, 249, 62, 155, 121, 103, 1,
-    171, 65, 51, 98, 19, 231, 199, 141, 61, 149, 54, 211, 143, 76, 245, 127, 198, 17, 1, 118, 161, 245, 9, 235, 8, 35,
-    216, 219, 98, 123, 224, 9, 39, 242, 2, 18, 50, 67, 2, 11, 6, 0, 57, 220, 244, 118, 41, 104, 213, 106, 72, 9, 42,
-    249, 46, 2, 189, 186, 5, 164, 247, 5, 56, 173, 126, 75, 8, 194, 97, 73, 93, 233, 200, 35, 111, 223, 131, 134, 205,
-    93, 99, 133, 178, 94, 207, 194, 20, 145, 64, 22, 199, 94, 123, 210, 53, 66, 137, 205, 224, 227, 22, 36, 169, 11,
-    106, 100, 252, 175, 255, 201, 102, 107, 23, 195, 53, 82, 46, 38, 131, 202, 27, 132, 208, 149, 89, 44, 83, 58, 175,
-    238, 59, 2, 16, 237, 213, 88, 49, 8, 152, 158, 137, 41, 211, 67, 54, 70, 176, 16, 113, 108, 42, 112, 82, 226, 116,
-    232, 41, 25, 23, 171, 91, 161, 118, 171, 192, 155, 58, 39, 8, 106, 162, 226, 172, 148, 28, 113, 236, 191, 77, 244,
-    151, 229, 130, 239, 189, 195, 8, 138, 13, 75, 140, 50, 105, 187, 229, 133, 53, 117, 220, 59, 55, 36, 102, 250, 197,
-    120, 57, 31, 229, 187, 94, 255, 33, 238, 22, 214, 98, 94, 58, 14, 227, 65, 217, 97, 239, 142, 25, 204, 173, 50, 224,
-    39, 52, 96, 122, 101, 129, 71, 25, 223, 185, 37, 208, 175, 81, 56, 67, 67, 40, 82, 80, 247, 155, 35, 141, 100, 79,
-    136, 168, 176, 7, 209, 178, 190, 96, 237, 194, 125, 240, 32, 109, 53, 18, 116, 225, 9, 69, 95, 209, 123, 72, 51, 88,
-    169, 99, 174, 176, 50, 25, 247, 111, 52, 71, 144, 131, 197, 15, 122, 38, 230, 155, 62, 16, 90, 249, 229, 102, 223,
-    193, 241, 166, 133, 226, 152, 44, 108, 102, 9, 234, 59, 230, 42, 251, 41, 230, 142, 182, 117, 207, 78, 70, 54, 235,
-    48, 249, 107, 200, 53, 204, 143, 235, 26, 14, 97, 186, 113, 166, 59, 66, 114, 19, 124, 38, 231, 27, 128, 216, 248,
-    142, 23, 226, 131, 14, 192, 200, 154, 210, 34, 60, 125, 208, 213, 40, 109, 172, 23, 82, 31, 198, 158, 253, 247, 168,
-    151, 90, 97, 206, 226, 58, 217, 234, 50, 90, 138, 4, 1, 69, 163, 58, 214, 218, 49, 25, 219, 162, 209, 92, 216, 75,
-    58, 90, 209, 76, 32, 221, 197, 253, 144, 212, 42, 12, 173, 95, 114, 105, 170, 114, 87, 160, 48, 74, 102, 33, 73, 94,
-    135, 111, 182, 68, 251, 123, 46, 238, 121, 114, 89, 171, 25, 71, 228, 24, 206, 20, 220, 205, 105, 53, 157, 6, 12,
-    199, 198, 29, 22, 192, 39, 93, 64, 224, 29, 154, 164, 21, 194, 102, 146, 44, 103, 191, 113, 26, 252, 139, 142, 168,
-    2, 0, 158, 191, 247, 65, 138, 222, 134, 168, 123, 79, 76, 141, 203, 250, 223, 188, 245, 91, 146, 109, 11, 180, 6,
-    112, 245, 141, 162, 159, 115, 84, 39, 213, 50, 234, 236, 115, 4, 24, 197, 241, 255, 251, 142, 67, 207, 46, 115, 5,
-    151, 99, 42, 234, 127, 121, 206, 77, 211, 111, 162, 156, 114, 115, 253, 48, 169, 119, 207, 119, 98, 26, 240, 111,
-    41, 29, 78, 12, 100, 176, 221, 44, 47, 43, 35, 184, 189, 173, 219, 34, 189, 4, 38, 78, 244, 43, 166, 217, 225, 1,
-    204, 167, 159, 48, 236, 234, 169, 130, 106, 22, 148, 144, 184, 231, 43, 47, 6, 220, 29, 6, 135, 184, 184, 45, 142,
-    103, 241, 37, 116, 58, 143, 35, 53, 18, 165, 79, 107, 173, 135, 48, 34, 19, 43, 106, 198, 152, 185, 0, 202, 227,
-    246, 210, 92, 249, 151, 41, 136, 80, 78, 9, 212, 101, 53, 168, 150, 211, 13, 217, 145, 233, 237, 199, 229, 37, 24,
-    235, 48, 186, 233, 125, 87, 177, 112, 104, 58, 70, 148, 157, 111, 244, 79, 59, 66, 99, 161, 246, 119, 100, 176, 188,
-    217, 141, 60, 220, 71, 31, 195, 101, 155, 88, 187, 86, 24, 108, 37, 43, 23, 210, 4, 149, 80, 110, 76, 207, 110, 22,
-    102, 203, 126, 157, 119, 33, 127, 151, 170, 161, 156, 251, 117, 133, 137, 81, 184, 128, 17, 25, 101, 175, 38, 91,
-    189, 250, 71, 97, 228, 187, 249, 49, 94, 104, 25, 177, 35, 15, 93, 159, 197, 11, 192, 35, 92, 244, 228, 156, 18,
-    211, 247, 64, 7, 22, 12, 88, 224, 246, 192, 106, 25, 12, 217, 224, 102, 16, 226, 127, 239, 179, 132, 76, 34, 1, 49,
-    210, 18, 111, 32, 2, 92, 248, 36, 59, 62, 33, 133, 6, 40, 10, 42, 182, 185, 114, 223, 114, 92, 130, 156, 238, 156,
-    210, 64, 23, 153, 30, 196, 177, 216, 33, 229, 19, 128, 86, 1, 134, 92, 161, 157, 156, 215, 72, 141, 246, 132, 167,
-    202, 136, 245, 209, 33, 52, 79, 15, 245, 53, 230, 248, 157, 251, 7, 5, 10, 94, 48, 15, 24, 177, 175, 85, 60, 39,
-    182, 66, 211, 123, 49, 192, 55, 241, 97, 139, 215, 73, 245, 134, 46, 161, 8, 134, 79, 68, 225, 202, 78, 182, 89,
-    152, 253, 163, 207, 193, 192, 204, 105, 105, 144, 95, 200, 208, 71, 31, 214, 232, 60, 52, 212, 144, 162, 122, 10,
-    231, 92, 170, 90, 39, 122, 9, 172, 199, 170, 96, 192, 133, 72, 109, 252, 209, 55, 194, 241, 157, 142, 176, 219, 252,
-    194, 121, 59, 198, 141, 38, 116, 196, 33, 116, 91, 52, 41, 76, 60, 136, 15, 117, 182, 238, 197, 15, 155, 22, 55,
-    226, 105, 67, 131, 174, 104, 133, 141, 27, 212, 209, 216, 218, 240, 154, 77, 98, 91, 202, 203, 9, 220, 53, 183, 203,
-    54, 56, 204, 130, 145, 41, 123, 87, 150, 103, 107, 15, 173, 94, 232, 179, 245, 101, 131, 15, 233, 239, 252, 69, 231,
-    10, 38, 222, 208, 130, 96, 198, 119, 59, 123, 119, 142, 121, 2, 71, 131, 6, 50, 3, 153, 247, 162, 35, 104, 43, 239,
-    210, 40, 205, 61, 141, 161, 20, 214, 91, 169, 238, 227, 233, 23, 101, 95, 168, 254, 61, 127, 44, 233, 170, 2, 188,
-    86, 104, 125, 177, 185, 243, 219, 111, 114, 235, 146, 92, 67, 124, 116, 179, 33, 242, 119, 107, 51, 3, 19, 252, 45,
-    31, 109, 213, 7, 54, 253, 40, 50, 87, 212, 129, 209, 187, 18, 95, 37, 175, 90, 51, 110, 8, 177, 59, 254, 170, 139,
-    12, 152, 233, 18, 60, 119, 119, 138, 243, 147, 19, 42, 251, 163, 63, 165, 227, 33, 200, 152, 236, 226, 50, 12, 98,
-    247, 68, 119, 252, 28, 72, 54, 241, 211, 192, 194, 252, 169, 45, 113, 137, 220, 83, 82, 133, 113, 199, 79, 163, 10,
-    122, 220, 145, 174, 222, 32, 0, 218, 71, 219, 218, 233, 132, 87, 187, 157, 147, 184, 240, 213, 218, 94, 97, 62, 180,
-    147, 183, 77, 224, 166, 115, 13, 31, 31, 24, 242, 1, 179, 73, 61, 214, 156, 165, 185, 12, 35, 101, 190, 59, 100,
-    157, 198, 213, 68, 145, 108, 229, 130, 25, 161, 57, 104, 209, 92, 228, 245, 65, 246, 235, 20, 142, 160, 242, 59,
-    111, 28, 188, 187, 115, 193, 224, 143, 116, 207, 29, 147, 49, 84, 211, 224, 157, 25, 232, 255, 212, 160, 185, 190,
-    78, 106, 237, 103, 169, 41, 90, 133, 113, 212, 228, 54, 228, 73, 198, 161, 88, 173, 79, 249, 99, 128, 66, 148, 61,
-    185, 130, 161, 18, 239, 8, 7, 233, 198, 69, 247, 25, 56, 92, 59, 91, 75, 151, 78, 80, 101, 29, 27, 118, 67, 167,
-    115, 13, 252, 233, 40, 229, 28, 182, 121, 152, 23, 195, 34, 83, 150, 244, 189, 101, 177, 19, 228, 68, 177, 151, 35,
-    242, 51, 114, 251, 46, 188, 195, 230, 42, 153, 218, 30, 171, 24, 25, 9, 210, 120, 251, 229, 111, 192, 34, 30, 221,
-    0, 76, 150, 184, 103, 158, 48, 151, 162, 73, 126, 19, 29, 117, 250, 133, 123, 138, 130, 165, 208, 153, 18, 40, 244,
-    98, 117, 220, 246, 217, 90, 23, 164, 11, 49, 190, 58, 68, 27, 37, 203, 171, 215, 36, 25, 69, 131, 245, 178, 249, 29,
-    24, 197, 97, 237, 47, 99, 203, 199, 212, 119, 113, 148, 97, 6, 22, 178, 235, 203, 141, 23, 237, 13, 210, 17, 65, 9,
-    175, 129, 173, 226, 165, 46, 184, 228, 233, 96, 149, 12, 137, 97, 113, 184, 35, 87, 42, 11, 239, 220, 90, 21, 148,
-    61, 246, 134, 248, 196, 194, 197, 184, 87, 56, 245, 165, 162, 196, 56, 220, 80, 233, 65, 86, 41, 223, 175, 60, 213,
-    78, 162, 249, 221, 173, 87, 73, 186, 214, 255, 138, 2, 240, 205, 11, 109, 122, 69, 177, 123, 169, 142, 162, 251,
-    117, 133, 82, 204, 185, 21, 154, 102, 70, 221, 137, 237, 2, 176, 107, 19, 96, 29, 71, 145, 93, 200, 151, 47, 75,
-    227, 154, 23, 92, 193, 148, 141, 202, 240, 246, 146, 128, 234, 206, 92, 120, 245, 73, 23, 146, 140, 153, 177, 178,
-    107, 160, 156, 60, 143, 222, 151, 10, 71, 146, 68, 48, 122, 21, 19, 49, 7, 146, 38, 16, 51, 40, 121, 253, 150, 53,
-    216, 205, 19, 98, 253, 193, 89, 75, 43, 7, 118, 25, 178, 65, 78, 60, 121, 92, 49, 31, 164, 31, 154, 195, 176, 180,
-    187, 17, 249, 65, 18, 176, 134, 108, 5, 48, 106, 237, 144, 166, 99, 71, 213, 134, 128, 81, 179, 81, 226, 96, 3, 200,
-    89, 92, 66, 88, 226, 17, 114, 177, 21, 110, 14, 199, 91, 233, 89, 188, 107, 111, 171, 186, 50, 51, 53, 134, 88, 0,
-    192, 28, 193, 17, 55, 191, 80, 49, 215, 126, 12, 123, 230, 182, 69, 216, 104, 32, 86, 217, 141, 64, 188, 14, 138,
-    162, 28, 156, 201, 251, 44, 3, 52, 17, 215, 154, 10, 54, 234, 190, 83, 74, 35, 229, 53, 37, 164, 255, 60, 48, 141,
-    190, 170, 80, 23, 122, 98, 167, 204, 152, 100, 178, 132, 165, 251, 99, 211, 201, 253, 111, 201, 197, 24, 101, 244,
-    120, 132, 65, 100, 99, 243, 74, 29, 238, 228, 68, 253, 246, 175, 109, 52, 13, 134, 233, 21, 65, 188, 135, 37, 38,
-    167, 19, 20, 159, 117, 48, 237, 101, 77, 253, 246, 160, 95, 224, 40, 184, 64, 36, 186, 233, 234, 204, 245, 28, 2,
-    152, 139, 195, 113, 162, 60, 37, 99, 246, 169, 220, 255, 61, 69, 85, 217, 104, 133, 43, 64, 38, 145, 135, 119, 215,
-    184, 69, 119, 43, 143, 105, 185, 3, 66, 226, 237, 110, 218, 222, 240, 60, 144, 139, 180, 222, 240, 93, 82, 65, 15,
-    162, 216, 135, 0, 214, 38, 19, 226, 85, 127, 36, 154, 246, 230, 229, 255, 37, 214, 150, 66, 230, 69, 114, 65, 32,
-    34, 182, 21, 54, 6, 197, 184, 18, 152, 15, 71, 105, 235, 99, 178, 244, 35, 39, 71, 3, 182, 24, 34, 173, 234, 138,
-    20, 44, 18, 202, 225, 92, 73, 23, 239, 100, 245, 113, 149, 35, 87, 200, 206, 107, 103, 7, 102, 7, 180, 237, 119,
-    175, 206, 247, 254, 234, 169, 201, 62, 193, 113, 160, 141, 108, 64, 217, 186, 182, 46, 43, 144, 20, 220, 141, 4,
-    135, 224, 99, 100, 81, 119, 233, 164, 43, 16, 88, 249, 222, 190, 147, 59, 83, 184, 107, 14, 69, 70, 56, 135, 65,
-    138, 154, 27, 75, 152, 170, 58, 244, 90, 197, 56, 231, 222, 67, 225, 182, 7, 207, 4, 185, 112, 221, 89, 47, 226,
-    199, 188, 152, 251, 217, 131, 0, 119, 46, 47, 197, 103, 1, 234, 67, 24, 172, 158, 66, 171, 113, 142, 97, 87, 143,
-    118, 220, 239, 176, 166, 208, 177, 186, 249, 190, 128, 251, 209, 14, 166, 84, 199, 208, 43, 26, 188, 92, 33, 135,
-    192, 135, 110, 31, 63, 92, 232, 168, 205, 46, 156, 213, 132, 15, 1, 24, 230, 20, 252, 35, 89, 5, 49, 64, 169, 242,
-    241, 248, 98, 69, 135, 141, 3, 179, 84, 82, 175, 53, 222, 243, 201, 140, 239, 121, 154, 231, 153, 112, 218, 203,
-    155, 185, 35, 229, 126, 17, 70, 66, 29, 170, 202, 254, 205, 81, 65, 103, 171, 51, 70, 246, 1, 27, 30, 237, 127, 101,
-    47, 154, 59, 201, 135, 249, 194, 227, 120, 225, 141, 180, 9, 238, 60, 75, 129, 205, 209, 119, 73, 160, 70, 102, 27,
-    161, 183, 83, 70, 199, 103, 207, 187, 172, 86, 53, 125, 232, 122, 158, 172, 67, 168, 226, 254, 130, 211, 242, 152,
-    155, 39, 195, 97, 54, 46, 64, 75, 174, 198, 161, 194, 181, 80, 190, 184, 112, 151, 101, 111, 42, 77, 136, 68, 193,
-    244, 28, 240, 228, 190, 27, 9, 55, 230, 233, 58, 213, 195, 99, 70, 7, 124, 157, 92, 249, 99, 74, 177, 77, 94, 194,
-    116, 146, 172, 33, 104, 126, 207, 233, 43, 217, 55, 29, 57, 74, 120, 15, 248, 95, 152, 181, 19, 31, 243, 150, 40,
-    74, 92, 105, 49, 119, 68, 66, 198, 43, 29, 63, 45, 117, 7, 104, 207, 128, 46, 240, 17, 153, 202, 244, 1, 194, 34,
-    96, 36, 128, 231, 168, 115, 148, 222, 38, 129, 151, 38, 91, 124, 123, 73, 250, 247, 210, 147, 239, 67, 119, 91, 197,
-    101, 177, 79, 168, 230, 45, 138, 202, 193, 75, 239, 43, 103, 224, 102, 138, 12, 137, 174, 253, 66, 208, 143, 245,
-    10, 194, 168, 194, 237, 254, 179, 222, 102, 82, 164, 134, 21, 42, 218, 68, 131, 26, 87, 123, 195, 237, 36, 33, 99,
-    32, 150, 93, 224, 46, 152, 30, 158, 110, 54, 76, 171, 181, 84, 160, 141, 236, 220, 15, 103, 63, 213, 174, 231, 167,
-    104, 223, 219, 66, 130, 210, 225, 124, 62, 255, 246, 206, 47, 46, 34, 202, 227, 16, 15, 32, 184, 39, 82, 77, 99, 22,
-    248, 213, 171, 2, 77, 238, 94, 9, 201, 234, 137, 103, 221, 140, 119, 110, 64, 57, 125, 162, 229, 6, 243, 117, 84,
-    250, 30, 181, 100, 19, 156, 14, 133, 131, 50, 131, 126, 99, 165, 221, 211, 89, 19, 106, 7, 224, 102, 189, 185, 216,
-    254, 14, 252, 254, 146, 110, 10, 164, 161, 191, 207, 105, 90, 26, 6, 111, 107, 182, 56, 207, 2, 38, 9, 55, 52, 234,
-    142, 48, 176, 240, 98, 124, 209, 5, 80, 132, 97, 125, 178, 96, 224, 106, 219, 241, 62, 59, 189, 40, 200, 164, 243,
-    90, 201, 218, 250, 128, 180, 131, 178, 232, 45, 154, 175, 148, 124, 185, 16, 105, 203, 81, 32, 218, 2, 45, 68, 3,
-    27, 211, 100, 156, 125, 231, 113, 195, 186, 52, 33, 247, 143, 117, 71, 211, 182, 117, 50, 180, 218, 23, 248, 78, 25,
-    160, 130, 214, 70, 74, 167, 133, 64, 233, 93, 61, 137, 201, 169, 138, 71, 51, 95, 246, 4, 201, 127, 208, 38, 177,
-    137, 119, 247, 238, 8, 7, 43, 124, 162, 67, 25, 229, 240, 64, 30, 47, 67, 95, 178, 26, 235, 187, 247, 223, 151, 210,
-    142, 48, 194, 124, 143, 82, 252, 6, 142, 28, 57, 158, 19, 57, 61, 89, 161, 169, 231, 89, 51, 107, 119, 11, 1, 213,
-    243, 191, 166, 73, 21, 244, 84, 1, 10, 238, 92, 81, 32, 231, 56, 80, 189, 242, 219, 146, 245, 126, 88, 115, 41, 15,
-    11, 14, 195, 209, 79, 133, 101, 89, 146, 89, 55, 23, 125, 48, 101, 114, 57, 167, 27, 199, 59, 123, 67, 159, 188,
-    191, 182, 154, 184, 133, 199, 166, 58, 94, 218, 86, 161, 77, 111, 50, 244, 128, 109, 143, 245, 52, 254, 162, 163,
-    186, 218, 27, 188, 121, 84, 212, 172, 33, 163, 229, 78, 50, 244, 18, 37, 50, 90, 161, 221, 95, 201, 90, 105, 64,
-    148, 137, 22, 0, 100, 27, 138, 237, 214, 57, 188, 230, 129, 218, 91, 199, 238, 34, 103, 121, 3, 246, 230, 197, 240,
-    47, 11, 83, 127, 95, 69, 89, 197, 135, 70, 210, 47, 20, 211, 210, 237, 135, 123, 82, 165, 105, 137, 60, 215, 125,
-    111, 170, 4, 122, 54, 185, 64, 207, 238, 234, 234, 139, 175, 162, 103, 48, 115, 134, 160, 196, 10, 9, 58, 144, 4,
-    95, 16, 97, 213, 187, 126, 239, 16, 221, 249, 97, 55, 30, 24, 219, 20, 36, 192, 45, 150, 239, 171, 224, 52, 19, 141,
-    201, 39, 89, 161, 200, 17, 176, 219, 159, 1, 179, 12, 62, 210, 66, 27, 242, 250, 185, 212, 178, 105, 69, 251, 12,
-    95, 15, 139, 6, 232, 25, 148, 51, 164, 87, 84, 6, 222, 119, 99, 135, 225, 102, 108, 102, 195, 91, 22, 64, 137, 48,
-    68, 70, 215, 127, 182, 244, 188, 167, 111, 189, 212, 61, 78, 254, 24, 203, 44, 161, 163, 246, 109, 253, 51, 159, 59,
-    160, 102, 43, 93, 255, 130, 239, 25, 28, 11, 219, 55, 239, 181, 103, 23, 117, 12, 197, 78, 178, 107, 111, 4, 91,
-    254, 117, 197, 198, 232, 80, 185, 76, 216, 240, 107, 79, 24, 207, 70, 112, 89, 126, 24, 236, 63, 158, 133, 20, 198,
-    102, 39, 202, 107, 117, 75, 156, 134, 112, 79, 126, 137, 118, 250, 68, 229, 172, 151, 141, 43, 50, 1, 209, 237, 206,
-    243, 88, 60, 162, 55, 249, 9, 148, 197, 204, 79, 70, 170, 139, 218, 130, 189, 100, 89, 220, 58, 178, 13, 190, 186,
-    17, 219, 96, 243, 73, 224, 71, 210, 127, 139, 56, 106, 104, 224, 171, 174, 110, 155, 243, 66, 131, 126, 38, 188,
-    171, 31, 227, 212, 229, 246, 186, 188, 165, 191, 185, 167, 130, 224, 10, 173, 198, 74, 69, 25, 84, 50, 75, 192, 82,
-    63, 28, 85, 255, 19, 233, 155, 73, 229, 25, 76, 68, 171, 110, 186, 33, 172, 172, 140, 30, 142, 155, 149, 233, 157,
-    151, 199, 213, 205, 6, 96, 93, 206, 93, 58, 55, 100, 55, 243, 161, 94, 227, 146, 194, 99, 85, 187, 118, 246, 191,
-    128, 90, 67, 13, 107, 61, 117, 237, 139, 99, 41, 154, 162, 169, 204, 247, 222, 65, 74, 96, 147, 4, 17, 108, 136, 42,
-    119, 168, 28, 194, 116, 220, 55, 19, 244, 160, 87, 37, 136, 32, 146, 225, 131, 182, 90, 118, 164, 195, 14, 83, 44,
-    162, 185, 41, 203, 97, 4, 248, 104, 186, 250, 176, 32, 69, 48, 29, 177, 148, 75, 28, 240, 201, 241, 70, 208, 203,
-    122, 163, 209, 152, 158, 227, 35, 246, 144, 181, 232, 181, 189, 252, 154, 105, 118, 208, 158, 39, 227, 103, 204,
-    188, 78, 152, 52, 5, 48, 160, 248, 174, 41, 90, 247, 235, 88, 207, 227, 121, 40, 71, 225, 60, 1, 223, 231, 15, 83,
-    161, 136, 99, 38, 162, 114, 192, 246, 150, 60, 196, 16, 3, 125, 49, 25, 67, 201, 52, 112, 129, 189, 110, 87, 98,
-    195, 186, 4, 251, 134, 133, 91, 210, 25, 55, 32, 253, 230, 23, 93, 238, 37, 239, 168, 125, 134, 169, 59, 233, 57,
-    125, 251, 161, 23, 49, 102, 14, 201, 136, 193, 174, 112, 177, 13, 236, 11, 167, 109, 63, 161, 4, 191, 116, 57, 216,
-    146, 123, 1, 116, 246, 231, 144, 108, 183, 246, 236, 86, 113, 141, 204, 181, 49, 185, 117, 58, 237, 90, 103, 234,
-    61, 196, 97, 208, 65, 216, 36, 230, 243, 205, 146, 208, 39, 244, 186, 179, 77, 248, 140, 33, 254, 16, 65, 31, 141,
-    231, 124, 47, 205, 61, 26, 4, 119, 253, 150, 141, 94, 255, 188, 1, 186, 19, 122, 106, 93, 238, 148, 170, 56, 66, 43,
-    75, 27, 252, 91, 60, 176, 41, 106, 218, 170, 155, 41, 60, 116, 7, 210, 139, 180, 224, 148, 176, 149, 53, 113, 63,
-    40, 48, 253, 10, 143, 10, 15, 96, 173, 60, 167, 226, 98, 100, 176, 89, 162, 13, 52, 108, 124, 134, 127, 238, 115,
-    221, 165, 150, 189, 51, 101, 205, 125, 166, 139, 95, 63, 215, 123, 220, 228, 44, 20, 104, 131, 194, 44, 82, 69, 165,
-    115, 160, 227, 234, 17, 249, 176, 107, 22, 35, 70, 1, 34, 173, 11, 28, 27, 19, 121, 208, 185, 239, 4, 156, 73, 114,
-    144, 134, 254, 94, 231, 90, 95, 24, 232, 229, 133, 127, 134, 97, 22, 120, 92, 180, 15, 78, 13, 132, 244, 249, 255,
-    16, 75, 22, 224, 233, 15, 143, 68, 114, 0, 80, 104, 118, 85, 13, 23, 203, 186, 51, 183, 170, 32, 3, 166, 122, 46,
-    39, 56, 102, 69, 156, 99, 51, 0, 12, 57, 135, 25, 65, 196, 209, 200, 78, 111, 47, 242, 127, 237, 34, 67, 138, 48,
-    94, 184, 205, 93, 229, 156, 13, 188, 193, 100, 121, 57, 143, 144, 119, 201, 98, 179, 67, 249, 227, 46, 179, 247,
-    103, 184, 220, 182, 121, 236, 39, 192, 73, 177, 189, 179, 22, 77, 136, 125, 252, 48, 30, 145, 241, 164, 61, 104,
-    232, 238, 197, 119, 255, 167, 255, 159, 29, 215, 92, 125, 76, 108, 113, 247, 240, 151, 233, 137, 5, 216, 129, 180,
-    76, 62, 41, 125, 138, 55, 2, 24, 223, 166, 49, 22, 192, 240, 234, 22, 137, 104, 157, 32, 148, 87, 193, 57, 8, 32,
-    16, 132, 174, 34, 120, 188, 244, 222, 61, 140, 158, 134, 77, 201, 153, 235, 195, 2, 217, 164, 162, 88, 206, 67, 102,
-    53, 111, 49, 202, 110, 110, 123, 183, 203, 174, 207, 136, 224, 88, 196, 40, 129, 15, 159, 152, 147, 43, 195, 172,
-    254, 152, 129, 141, 88, 125, 166, 178, 214, 184, 201, 76, 223, 103, 141, 250, 122, 83, 86, 63, 88, 146, 46, 123,
-    220, 144, 101, 125, 150, 10, 88, 237, 145, 10, 65, 228, 123, 255, 3, 214, 227, 152, 10, 77, 3, 207, 162, 150, 163,
-    196, 241, 145, 13, 16, 156, 222, 83, 162, 181, 31, 181, 22, 190, 189, 1, 140, 104, 137, 65, 121, 176, 115, 136, 237,
-    149, 236, 72, 39, 172, 210, 207, 20, 41, 27, 145, 237, 184, 67, 251, 90, 90, 13, 245, 244, 73, 114, 128, 94, 181,
-    37, 196, 162, 181, 180, 243, 172, 194, 222, 66, 94, 98, 237, 109, 89, 17, 202, 19, 82, 40, 53, 72, 136, 42, 254, 81,
-    26, 183, 13, 14, 191, 146, 107, 204, 24, 204, 139, 206, 42, 87, 121, 15, 4, 5, 137, 58, 53, 245, 18, 129, 89, 205,
-    214, 52, 113, 75, 209, 177, 229, 112, 144, 175, 136, 89, 226, 47, 72, 147, 47, 193, 155, 205, 194, 41, 155, 2, 89,
-    102, 233, 153, 50, 1, 198, 94, 53, 218, 165, 14, 69, 9, 74, 234, 73, 214, 174, 129, 44, 248, 177, 12, 2, 190, 206,
-    127, 204, 10, 8, 202, 27, 68, 234, 152, 165, 47, 43, 180, 28, 31, 46, 158, 80, 59, 125, 120, 220, 74, 6, 203, 137,
-    70, 235, 44, 157, 70, 97, 158, 8, 110, 252, 85, 39, 51, 3, 13, 30, 2, 241, 227, 14, 29, 3, 196, 124, 51, 213, 143,
-    59, 52, 100, 249, 91, 190, 191, 55, 190, 86, 235, 30, 246, 211, 241, 61, 134, 192, 10, 92, 189, 68, 90, 97, 195,
-    193, 17, 123, 40, 214, 234, 79, 6, 128, 169, 165, 33, 51, 236, 220, 180, 17, 163, 164, 61, 204, 96, 5, 162, 169,
-    250, 152, 243, 140, 7, 100, 232, 29, 150, 96, 248, 226, 167, 115, 97, 198, 64, 35, 93, 60, 31, 94, 84, 239, 162, 84,
-    169, 132, 212, 228, 231, 201, 95, 219, 23, 146, 250, 81, 224, 222, 49, 159, 47, 193, 26, 222, 201, 240, 243, 97,
-    134, 232, 55, 189, 10, 55, 70, 76, 203, 132, 124, 22, 231, 52, 36, 154, 207, 203, 90, 58, 215, 171, 139, 31, 16,
-    129, 180, 229, 146, 131, 23, 54, 16, 102, 216, 164, 170, 35, 12, 14, 156, 35, 4, 115, 237, 19, 3, 12, 136, 58, 205,
-    33, 105, 79, 35, 205, 57, 7, 97, 129, 158, 138, 190, 92, 21, 170, 107, 59, 20, 145, 219, 44, 26, 76, 75, 20, 23,
-    204, 152, 251, 122, 79, 122, 169, 175, 45, 187, 122, 231, 19, 152, 26, 109, 52, 209, 158, 244, 211, 122, 208, 214,
-    74, 248, 101, 115, 92, 165, 252, 62, 237, 225, 110, 50, 180, 182, 119, 183, 181, 227, 200, 134, 59, 226, 143, 228,
-    202, 10, 22, 136, 251, 138, 157, 123, 139, 84, 151, 24, 10, 62, 72, 134, 171, 152, 167, 80, 83, 48, 60, 100, 107,
-    60, 94, 174, 103, 254, 231, 85, 70, 183, 173, 28, 212, 167, 22, 175, 251, 49, 198, 185, 174, 190, 213, 157, 20, 253,
-    114, 101, 184, 147, 127, 78, 181, 34, 185, 201, 229, 108, 118, 126, 165, 5, 145, 131, 232, 146, 195, 101, 116, 85,
-    112, 143, 21, 168, 37, 74, 74, 10, 76, 7, 248, 126, 249, 35, 234, 42, 121, 95, 59, 235, 74, 135, 220, 195, 59, 101,
-    182, 172, 165, 247, 44, 35, 186, 153, 198, 20, 93, 135, 18, 146, 172, 57, 155, 8, 0, 183, 165, 215, 219, 141, 63,
-    168, 164, 33, 104, 24, 143, 55, 215, 65, 163, 212, 25, 58, 47, 217, 139, 206, 4, 39, 69, 127, 144, 228, 111, 76,
-    175, 1, 19, 166, 218, 78, 177, 174, 84, 199, 128, 71, 248, 163, 16, 186, 127, 69, 47, 121, 27, 56, 228, 79, 13, 138,
-    63, 113, 110, 58, 192, 49, 198, 145, 150, 169, 98, 208, 157, 177, 211, 88, 126, 209, 243, 107, 147, 123, 83, 73, 57,
-    119, 152, 10, 112, 230, 155, 23, 127, 129, 49, 246, 29, 217, 178, 93, 95, 107, 92, 6, 17, 205, 66, 197, 64, 81, 245,
-    147, 132, 252, 166, 226, 153, 116, 46, 219, 175, 18, 98, 132, 215, 115, 203, 169, 89, 118, 117, 52, 227, 162, 89,
-    77, 95, 20, 173, 85, 9, 66, 185, 224, 45, 218, 175, 15, 90, 19, 208, 161, 166, 123, 84, 230, 155, 82, 179, 149, 170,
-    209, 156, 251, 139, 103, 136, 250, 11, 182, 198, 122, 191, 16, 61, 114, 184, 83, 98, 214, 79, 18, 69, 46, 240, 140,
-    140, 5, 64, 181, 12, 116, 130, 37, 101, 62, 255, 71, 162, 234, 110, 191, 9, 51, 121, 250, 213, 109, 220, 10, 187,
-    199, 87, 206, 248, 113, 152, 164, 83, 157, 109, 91, 249, 114, 171, 43, 242, 202, 98, 255, 53, 179, 83, 245, 226, 24,
-    192, 53, 99, 69, 120, 214, 183, 59, 167, 202, 128, 94, 99, 229, 201, 234, 146, 186, 231, 207, 247, 106, 213, 2, 3,
-    210, 62, 225, 71, 178, 91, 151, 208, 114, 179, 49, 77, 61, 137, 80, 236, 24, 85, 68, 167, 177, 160, 10, 129, 142, 2,
-    1, 241, 161, 85, 194, 12, 160, 216, 126, 187, 136, 70, 20, 179, 182, 145, 250, 102, 157, 27, 183, 44, 131, 214, 147,
-    42, 72, 203, 34, 251, 67, 220, 230, 89, 59, 227, 130, 39, 253, 139, 57, 195, 95, 236, 167, 38, 176, 165, 252, 29,
-    227, 195, 173, 177, 114, 145, 150, 156, 39, 232, 161, 239, 73, 87, 237, 90, 97, 31, 226, 204, 7, 24, 124, 186, 31,
-    17, 253, 94, 149, 193, 42, 122, 220, 218, 246, 65, 43, 79, 139, 57, 222, 23, 220, 33, 18, 179, 87, 30, 27, 54, 175,
-    138, 104, 162, 0, 165, 191, 109, 181, 57, 159, 75, 64, 120, 242, 21, 110, 61, 230, 13, 205, 74, 197, 31, 180, 160,
-    41, 243, 42, 111, 236, 42, 255, 115, 186, 197, 62, 51, 37, 164, 211, 180, 44, 148, 75, 43, 164, 226, 15, 56, 81,
-    196, 239, 107, 89, 250, 210, 42, 221, 167, 55, 132, 197, 25, 8, 184, 165, 227, 98, 233, 153, 121, 172, 248, 52, 164,
-    40, 41, 117, 68, 24, 249, 83, 119, 139, 100, 34, 63, 207, 109, 124, 213, 48, 27, 159, 176, 162, 68, 107, 91, 134,
-    219, 25, 93, 105, 11, 50, 222, 21, 132, 37, 111, 71, 160, 200, 214, 185, 226, 151, 153, 198, 68, 116, 47, 121, 155,
-    25, 117, 227, 35, 118, 209, 141, 220, 77, 24, 232, 112, 86, 163, 56, 4, 158, 170, 121, 129, 71, 126, 79, 222, 87,
-    141, 32, 176, 251, 5, 233, 114, 84, 23, 244, 21, 21, 87, 196, 113, 17, 212, 226, 160, 254, 42, 148, 187, 161, 29,
-    158, 161, 236, 147, 28, 103, 41, 85, 38, 180, 6, 37, 146, 21, 184, 84, 83, 87, 238, 211, 251, 13, 96, 45, 186, 8,
-    105, 66, 179, 10, 113, 51, 231, 112, 77, 209, 173, 191, 125, 41, 245, 69, 204, 252, 233, 233, 241, 33, 87, 85, 140,
-    145, 154, 206, 245, 61, 240, 175, 64, 123, 198, 222, 229, 219, 175, 39, 149, 10, 155, 15, 24, 74, 134, 42, 38, 212,
-    83, 72, 225, 69, 167, 156, 89, 248, 179, 185, 230, 206, 176, 208, 26, 125, 210, 152, 111, 193, 165, 77, 236, 166,
-    95, 177, 76, 209, 148, 192, 182, 3, 127, 17, 123, 24, 185, 252, 236, 51, 190, 22, 56, 75, 115, 45, 116, 86, 88, 21,
-    172, 246, 62, 124, 77, 148, 4, 113, 98, 59, 48, 36, 62, 113, 98, 83, 216, 11, 76, 32, 134, 97, 61, 121, 54, 180, 96,
-    3, 138, 226, 107, 196, 131, 245, 175, 171, 167, 227, 107, 218, 4, 192, 138, 188, 15, 65, 17, 40, 14, 65, 155, 123,
-    1, 69, 233, 185, 21, 115, 192, 158, 198, 145, 112, 41, 118, 137, 186, 93, 218, 24, 8, 94, 247, 196, 120, 194, 55,
-    58, 146, 23, 172, 167, 230, 235, 89, 3, 166, 14, 97, 248, 182, 103, 179, 49, 157, 30, 112, 156, 123, 27, 27, 147,
-    88, 139, 190, 150, 213, 41, 54, 201, 44, 105, 104, 245, 226, 236, 222, 195, 110, 206, 65, 227, 143, 190, 23, 167,
-    201, 67, 218, 228, 30, 82, 151, 48, 253, 166, 190, 136, 244, 121, 41, 60, 247, 241, 49, 216, 194, 38, 116, 101, 125,
-    13, 64, 143, 88, 167, 173, 141, 237, 37, 28, 153, 107, 189, 55, 236, 210, 142, 23, 92, 44, 140, 194, 224, 122, 49,
-    93, 174, 14, 69, 64, 23, 50, 192, 82, 164, 179, 73, 50, 2, 53, 180, 190, 217, 248, 15, 153, 145, 205, 54, 220, 75,
-    201, 57, 134, 60, 83, 240, 120, 219, 214, 141, 44, 7, 154, 32, 127, 167, 36, 11, 8, 107, 227, 29, 78, 1, 211, 169,
-    28, 219, 88, 214, 93, 172, 57, 25, 197, 98, 152, 50, 98, 74, 122, 214, 152, 126, 236, 185, 95, 70, 58, 106, 3, 10,
-    210, 116, 47, 226, 156, 99, 214, 18, 8, 54, 179, 234, 49, 121, 151, 121, 176, 33, 156, 206, 187, 229, 93, 40, 33,
-    93, 175, 181, 14, 133, 191, 59, 221, 94, 84, 118, 229, 103, 211, 181, 223, 216, 229, 216, 115, 120, 233, 154, 230,
-    30, 169, 126, 173, 77, 25, 117, 27, 12, 2, 237, 77, 167, 76, 253, 111, 238, 156, 29, 2, 95, 186, 135, 135, 51, 213,
-    75, 1, 120, 101, 101, 223, 74, 212, 209, 120, 122, 120, 133, 18, 123, 169, 149, 19, 130, 167, 130, 73, 158, 102, 49,
-    121, 249, 7, 25, 126, 127, 111, 44, 187, 193, 79, 176, 8, 251, 145, 105, 228, 99, 196, 181, 226, 132, 211, 40, 54,
-    109, 216, 13, 57, 231, 125, 21, 4, 73, 165, 215, 19, 174, 16, 187, 75, 19, 14, 91, 156, 4, 70, 107, 167, 4, 105,
-    127, 120, 198, 46, 121, 103, 238, 126, 183, 204, 118, 105, 206, 118, 129, 181, 254, 0, 37, 28, 138, 84, 46, 32, 27,
-    136, 50, 55, 3, 183, 74, 81, 140, 73, 221, 112, 91, 156, 206, 61, 63, 126, 3, 22, 46, 224, 2, 33, 74, 99, 191, 141,
-    15, 191, 59, 29, 68, 68, 6, 243, 183, 58, 5, 229, 145, 52, 22, 188, 133, 208, 112, 31, 64, 197, 254, 81, 70, 158,
-    193, 115, 12, 55, 61, 206, 69, 20, 82, 95, 118, 223, 46, 151, 232, 148, 85, 30, 88, 8, 135, 157, 19, 177, 117, 60,
-    107, 161, 166, 243, 38, 106, 76, 246, 174, 100, 14, 8, 131, 60, 191, 124, 213, 49, 166, 183, 108, 194, 192, 108, 43,
-    37, 101, 56, 126, 70, 41, 95, 123, 248, 79, 139, 228, 112, 35, 73, 226, 248, 203, 128, 255, 103, 52, 168, 212, 94,
-    84, 58, 25, 95, 174, 238, 241, 12, 222, 11, 70, 2, 31, 71, 120, 176, 24, 202, 234, 179, 103, 2, 76, 226, 12, 110,
-    15, 229, 219, 112, 36, 165, 45, 88, 122, 201, 106, 73, 159, 204, 242, 232, 57, 63, 157, 174, 112, 101, 192, 157,
-    205, 131, 171, 75, 6, 195, 131, 16, 178, 252, 176, 44, 218, 26, 44, 61, 74, 204, 128, 230, 53, 228, 149, 64, 169,
-    27, 97, 24, 225, 69, 199, 186, 144, 148, 163, 79, 83, 183, 208, 152, 224, 219, 114, 111, 117, 212, 194, 82, 213,
-    206, 235, 227, 28, 185, 194, 231, 180, 0, 139, 201, 203, 238, 57, 172, 8, 136, 116, 39, 140, 238, 57, 111, 29, 4,
-    123, 99, 62, 164, 82, 35, 209, 69, 66, 13, 200, 229, 107, 115, 55, 129, 89, 166, 198, 104, 124, 90, 48, 142, 48, 49,
-    78, 91, 252, 146, 218, 73, 182, 57, 249, 158, 186, 181, 130, 42, 81, 8, 252, 91, 233, 170, 225, 45, 207, 19, 122,
-    63, 188, 97, 98, 137, 12, 169, 68, 202, 119, 243, 233, 175, 67, 212, 231, 105, 171, 158, 115, 117, 54, 21, 107, 11,
-    101, 25, 8, 189, 236, 254, 198, 100, 47, 104, 10, 49, 61, 44, 50, 67, 106, 66, 244, 122, 5, 218, 18, 242, 197, 105,
-    186, 30, 158, 161, 206, 251, 177, 109, 20, 139, 206, 223, 253, 213, 240, 52, 243, 151, 112, 37, 108, 223, 82, 22,
-    142, 30, 160, 59, 179, 151, 20, 166, 26, 201, 218, 215, 177, 64, 166, 173, 21, 110, 180, 66, 128, 44, 142, 175, 141,
-    21, 94, 25, 191, 221, 40, 193, 185, 210, 89, 188, 152, 174, 249, 143, 101, 170, 12, 124, 31, 104, 103, 104, 206, 51,
-    101, 106, 93, 6, 154, 63, 12, 143, 45, 64, 39, 203, 117, 196, 40, 253, 244, 82, 127, 93, 140, 100, 158, 239, 92, 61,
-    168, 232, 151, 214, 245, 182, 21, 114, 10, 52, 104, 98, 81, 165, 120, 243, 44, 10, 20, 128, 16, 121, 103, 133, 217,
-    99, 49, 168, 155, 75, 62, 157, 130, 39, 27, 216, 129, 194, 251, 185, 47, 232, 136, 85, 56, 63, 143, 11, 96, 136,
-    205, 232, 76, 146, 235, 39, 246, 244, 121, 143, 122, 193, 60, 219, 33, 108, 35, 231, 55, 142, 129, 7, 80, 178, 33,
-    141, 103, 113, 73, 83, 159, 152, 254, 50, 59, 10, 113, 138, 171, 84, 208, 119, 160, 70, 132, 10, 140, 212, 28, 237,
-    181, 212, 222, 93, 81, 228, 139, 34, 253, 142, 80, 218, 125, 176, 13, 153, 29, 186, 68, 146, 127, 28, 166, 108, 57,
-    253, 121, 95, 49, 196, 73, 1, 18, 172, 56, 60, 14, 130, 38, 169, 24, 160, 130, 108, 56, 31, 30, 98, 136, 224, 252,
-    43, 121, 148, 178, 205, 206, 92, 193, 3, 52, 85, 226, 58, 45, 230, 248, 51, 157, 82, 37, 222, 183, 215, 221, 59,
-    181, 174, 116, 64, 184, 89, 108, 188, 192, 152, 34, 23, 109, 249, 46, 253, 87, 182, 2, 36, 45, 25, 106, 109, 217,
-    214, 59, 252, 25, 204, 139, 223, 49, 79, 41, 70, 11, 152, 19, 254, 162, 69, 142, 9, 116, 103, 6, 26, 27, 168, 206,
-    133, 87, 123, 149, 102, 133, 130, 186, 188, 41, 251, 83, 150, 175, 105, 117, 3, 130, 85, 133, 27, 149, 236, 226,
-    112, 17, 138, 224, 80, 10, 150, 172, 44, 70, 184, 199, 11, 64, 49, 80, 106, 244, 149, 253, 50, 140, 27, 225, 222,
-    174, 184, 181, 28, 194, 184, 21, 140, 34, 12, 141, 129, 165, 235, 88, 62, 131, 37, 230, 10, 186, 23, 119, 88, 49,
-    78, 93, 10, 174, 39, 67, 243, 234, 121, 67, 48, 178, 59, 192, 205, 64, 207, 142, 174, 51, 29, 232, 81, 202, 135, 40,
-    208, 95, 40, 199, 15, 133, 255, 116, 43, 214, 208, 250, 218, 67, 160, 64, 100, 246, 37, 119, 126, 203, 253, 194,
-    215, 76, 223, 215, 170, 219, 183, 151, 65, 14, 73, 86, 86, 245, 230, 232, 184, 27, 159, 191, 225, 208, 57, 212, 204,
-    203, 211, 11, 20, 149, 185, 13, 127, 228, 135, 140, 0, 109, 96, 26, 4, 208, 19, 176, 218, 193, 180, 47, 127, 47,
-    210, 149, 53, 196, 45, 254, 49, 176, 173, 247, 89, 224, 111, 122, 110, 241, 194, 158, 201, 163, 190, 174, 76, 250,
-    57, 70, 168, 65, 103, 195, 241, 157, 58, 150, 80, 191, 157, 174, 194, 251, 31, 124, 194, 198, 169, 2, 181, 150, 147,
-    212, 228, 7, 172, 144, 131, 109, 65, 166, 166, 33, 152, 44, 67, 228, 9, 48, 55, 89, 235, 6, 112, 113, 111, 9, 245,
-    255, 35, 23, 1, 169, 177, 6, 179, 12, 148, 77, 251, 177, 32, 95, 117, 89, 53, 68, 91, 31, 162, 251, 45, 111, 129,
-    147, 149, 75, 117, 158, 98, 251, 176, 56, 206, 183, 70, 125, 196, 124, 147, 132, 109, 71, 185, 131, 75, 7, 17, 191,
-    185, 2, 245, 167, 73, 252, 29, 43, 107, 12, 52, 171, 168, 25, 36, 245, 133, 228, 191, 1, 162, 149, 239, 63, 65, 131,
-    200, 16, 234, 111, 165, 30, 160, 48, 82, 96, 240, 92, 92, 92, 67, 174, 28, 247, 159, 180, 78, 200, 63, 116, 42, 86,
-    63, 154, 32, 3, 100, 19, 154, 132, 227, 54, 110, 5, 88, 178, 6, 228, 100, 105, 68, 143, 156, 92, 17, 128, 63, 200,
-    109, 66, 117, 62, 243, 183, 28, 26, 23, 121, 114, 187, 124, 162, 165, 70, 36, 180, 120, 85, 116, 230, 17, 219, 241,
-    200, 226, 106, 112, 69, 15, 66, 158, 246, 16, 108, 179, 45, 60, 122, 65, 61, 33, 197, 121, 231, 11, 19, 69, 255, 14,
-    50, 154, 190, 115, 187, 80, 166, 225, 156, 37, 252, 188, 78, 240, 15, 90, 229, 89, 130, 173, 118, 247, 61, 205, 108,
-    67, 98, 234, 110, 44, 122, 45, 35, 241, 217, 11, 7, 63, 112, 178, 171, 89, 255, 95, 19, 46, 209, 141, 88, 40, 252,
-    243, 152, 217, 63, 48, 165, 186, 107, 54, 24, 71, 156, 245, 223, 64, 173, 207, 252, 40, 248, 75, 165, 154, 89, 197,
-    58, 108, 66, 30, 244, 159, 36, 12, 89, 109, 254, 225, 83, 195, 79, 60, 88, 68, 244, 29, 81, 38, 71, 218, 161, 106,
-    31, 124, 3, 220, 12, 132, 81, 242, 45, 84, 160, 58, 50, 57, 120, 53, 4, 7, 11, 146, 137, 158, 172, 147, 219, 145,
-    76, 190, 124, 184, 159, 88, 77, 29, 210, 162, 115, 121, 210, 67, 42, 226, 191, 12, 21, 107, 171, 186, 13, 232, 205,
-    189, 129, 17, 206, 233, 187, 241, 205, 54, 167, 163, 33, 161, 14, 39, 205, 64, 42, 128, 5, 59, 209, 156, 198, 185,
-    185, 18, 63, 234, 145, 209, 254, 91, 238, 140, 86, 184, 136, 159, 131, 31, 17, 153, 32, 42, 82, 207, 236, 139, 166,
-    223, 192, 182, 80, 79, 52, 30, 114, 25, 1, 86, 62, 194, 112, 188, 229, 10, 227, 135, 247, 72, 107, 193, 150, 83, 96,
-    40, 28, 112, 178, 250, 92, 207, 81, 173, 4, 70, 40, 247, 224, 108, 227, 169, 187, 220, 233, 211, 161, 85, 246, 186,
-    17, 225, 20, 191, 205, 183, 220, 129, 158, 154, 165, 186, 23, 161, 73, 209, 183, 152, 243, 99, 227, 128, 72, 10, 91,
-    25, 233, 52, 188, 75, 189, 206, 218, 28, 71, 173, 68, 135, 44, 247, 66, 78, 236, 111, 44, 49, 248, 32, 204, 155,
-    244, 98, 104, 86, 130, 2, 231, 236, 226, 91, 148, 153, 118, 66, 194, 86, 170, 142, 133, 102, 84, 67, 207, 20, 205,
-    82, 107, 185, 32, 98, 217, 25, 205, 250, 3, 84, 174, 60, 227, 46, 94, 166, 162, 177, 87, 208, 148, 239, 39, 130,
-    163, 206, 60, 4, 150, 36, 222, 168, 53, 245, 38, 206, 78, 8, 17, 134, 199, 201, 86, 167, 1, 195, 210, 122, 5, 168,
-    41, 89, 41, 151, 238, 42, 76, 146, 200, 48, 5, 53, 230, 72, 184, 243, 60, 149, 56, 230, 106, 147, 164, 2, 17, 61,
-    19, 219, 119, 38, 222, 142, 209, 61, 205, 251, 39, 39, 46, 247, 136, 180, 188, 144, 20, 216, 162, 197, 21, 56, 186,
-    242, 208, 216, 236, 127, 94, 1, 78, 2, 43, 185, 138, 47, 123, 32, 139, 23, 3, 155, 206, 199, 165, 122, 198, 110,
-    106, 104, 234, 74, 137, 118, 127, 170, 171, 115, 246, 24, 63, 171, 39, 148, 203, 51, 197, 247, 178, 240, 209, 181,
-    204, 124, 43, 43, 237, 127, 72, 213, 5, 35, 214, 39, 103, 36, 27, 233, 4, 15, 133, 219, 125, 48, 65, 95, 31, 78, 5,
-    209, 1, 33, 9, 106, 132, 170, 44, 208, 96, 97, 142, 114, 223, 216, 51, 251, 147, 150, 145, 145, 218, 18, 20, 5, 4,
-    42, 6, 28, 163, 104, 158, 230, 221, 98, 191, 75, 66, 3, 147, 107, 112, 54, 112, 122, 170, 216, 158, 246, 107, 244,
-    164, 149, 19, 122, 139, 13, 75, 4, 28, 96, 133, 51, 144, 228, 45, 22, 251, 116, 70, 184, 31, 194, 53, 248, 90, 230,
-    93, 252, 43, 126, 151, 131, 111, 246, 138, 161, 177, 23, 233, 3, 126, 188, 48, 115, 120, 41, 203, 165, 17, 248, 218,
-    126, 179, 13, 153, 72, 31, 184, 125, 134, 54, 237, 221, 242, 195, 148, 210, 246, 94, 168, 116, 111, 40, 143, 240,
-    95, 88, 182, 49, 72, 72, 21, 60, 23, 101, 114, 96, 50, 44, 96, 149, 154, 57, 82, 86, 48, 217, 91, 5, 226, 254, 177,
-    121, 50, 160, 28, 85, 61, 65, 163, 89, 249, 112, 86, 76, 28, 62, 7, 248, 107, 47, 249, 114, 20, 98, 90, 97, 31, 44,
-    34, 68, 84, 89, 23, 116, 5, 210, 76, 5, 248, 187, 21, 108, 118, 65, 199, 86, 213, 105, 68, 5, 35, 113, 113, 2, 199,
-    164, 252, 157, 59, 215, 51, 142, 121, 96, 249, 63, 239, 15, 89, 61, 112, 183, 72, 83, 49, 4, 175, 24, 148, 240, 183,
-    113, 40, 92, 75, 255, 24, 243, 195, 111, 90, 183, 248, 112, 167, 165, 193, 37, 175, 168, 194, 164, 118, 85, 123,
-    106, 200, 175, 30, 138, 209, 158, 138, 17, 158, 175, 98, 24, 200, 137, 218, 66, 153, 236, 177, 235, 3, 32, 7, 217,
-    28, 41, 184, 136, 216, 26, 109, 106, 147, 232, 217, 238, 73, 120, 17, 188, 127, 79, 62, 192, 168, 121, 78, 3, 42,
-    231, 165, 46, 186, 66, 123, 74, 229, 214, 90, 107, 218, 120, 131, 127, 51, 81, 106, 34, 251, 206, 47, 144, 112, 181,
-    70, 103, 55, 233, 41, 208, 221, 102, 133, 200, 199, 113, 75, 15, 59, 117, 114, 200, 222, 173, 255, 191, 205, 78,
-    246, 199, 156, 108, 67, 125, 144, 57, 122, 221, 81, 230, 180, 123, 5, 37, 30, 239, 162, 75, 227, 255, 27, 148, 163,
-    49, 246, 63, 23, 0, 72, 225, 29, 226, 178, 249, 127, 17, 47, 157, 121, 162, 245, 139, 244, 163, 250, 145, 250, 115,
-    8, 246, 228, 84, 199, 74, 211, 209, 79, 147, 135, 58, 119, 64, 44, 248, 17, 93, 154, 18, 244, 228, 198, 171, 51,
-    117, 166, 150, 122, 117, 44, 100, 18, 68, 184, 94, 43, 84, 150, 17, 172, 104, 217, 21, 244, 63, 237, 64, 107, 34,
-    11, 36, 223, 92, 63, 31, 151, 157, 13, 137, 20, 237, 243, 207, 250, 86, 66, 143, 196, 149, 5, 75, 85, 168, 10, 219,
-    110, 216, 93, 105, 217, 79, 186, 54, 67, 204, 38, 229, 28, 85, 196, 250, 58, 21, 169, 44, 25, 165, 171, 162, 209,
-    23, 231, 234, 241, 154, 132, 99, 47, 147, 47, 64, 251, 247, 23, 166, 91, 26, 122, 209, 184, 172, 103, 54, 17, 111,
-    133, 20, 62, 171, 234, 114, 211, 143, 121, 92, 9, 185, 119, 98, 136, 111, 138, 67, 205, 72, 152, 185, 115, 171, 144,
-    103, 190, 251, 3, 70, 126, 96, 207, 42, 97, 192, 224, 214, 129, 209, 75, 172, 227, 211, 177, 176, 48, 144, 120, 250,
-    10, 123, 244, 26, 176, 45, 0, 91, 192, 160, 175, 163, 163, 170, 19, 28, 218, 185, 196, 112, 36, 249, 193, 230, 212,
-    209, 137, 77, 208, 193, 134, 64, 120, 106, 76, 110, 171, 48, 1, 187, 2, 241, 211, 163, 101, 179, 175, 202, 45, 254,
-    32, 2, 190, 3, 253, 30, 207, 45, 46, 115, 65, 35, 197, 209, 131, 21, 120, 15, 226, 225, 185, 131, 121, 39, 212, 59,
-    62, 80, 40, 21, 211, 26, 188, 115, 79, 27, 164, 85, 162, 54, 108, 143, 211, 90, 27, 181, 215, 37, 114, 20, 249, 242,
-    227, 97, 132, 67, 165, 255, 51, 44, 245, 12, 196, 147, 192, 15, 97, 43, 22, 113, 121, 216, 103, 182, 180, 173, 44,
-    162, 125, 28, 240, 149, 223, 114, 10, 78, 111, 218, 198, 130, 60, 87, 250, 88, 38, 5, 87, 215, 54, 187, 31, 226, 58,
-    180, 52, 119, 221, 223, 166, 83, 213, 255, 135, 139, 228, 0, 94, 55, 222, 119, 198, 151, 203, 218, 87, 67, 41, 64,
-    46, 94, 185, 1, 45, 15, 227, 128, 9, 59, 255, 241, 161, 177, 151, 129, 221, 197, 127, 244, 122, 194, 181, 185, 121,
-    105, 238, 246, 219, 35, 186, 144, 113, 247, 162, 18, 2, 105, 184, 137, 80, 74, 226, 191, 12, 22, 187, 245, 114, 21,
-    90, 95, 32, 118, 41, 220, 195, 217, 195, 164, 82, 68, 249, 217, 10, 178, 87, 239, 27, 226, 97, 206, 26, 102, 57,
-    149, 65, 240, 71, 99, 86, 69, 164, 5, 27, 28, 181, 126, 136, 22, 80, 10, 116, 121, 91, 239, 57, 63, 248, 244, 195,
-    196, 105, 42, 205, 150, 132, 39, 16, 197, 157, 205, 239, 50, 165, 116, 171, 198, 18, 68, 201, 205, 110, 124, 4, 10,
-    36, 213, 43, 129, 2, 150, 27, 202, 100, 108, 176, 185, 127, 158, 39, 172, 76, 239, 156, 204, 81, 203, 149, 144, 7,
-    8, 244, 189, 189, 111, 83, 152, 10, 85, 199, 117, 88, 149, 153, 46, 60, 81, 221, 71, 174, 205, 211, 142, 90, 148,
-    26, 101, 37, 3, 188, 112, 184, 231, 25, 86, 111, 74, 116, 70, 59, 220, 250, 2, 87, 112, 106, 54, 39, 213, 75, 150,
-    119, 134, 95, 163, 157, 167, 90, 193, 6, 55, 89, 181, 181, 139, 208, 96, 7, 64, 35, 76, 205, 159, 76, 217, 117, 150,
-    229, 102, 45, 79, 115, 112, 0, 145, 245, 33, 229, 156, 41, 220, 21, 71, 33, 2, 252, 100, 52, 1, 219, 41, 5, 196,
-    118, 61, 137, 176, 104, 230, 200, 65, 189, 22, 194, 3, 146, 29, 134, 153, 137, 206, 221, 208, 182, 159, 151, 240,
-    68, 184, 217, 192, 7, 173, 191, 159, 80, 48, 154, 56, 78, 128, 4, 245, 112, 96, 216, 234, 117, 198, 63, 10, 207,
-    243, 52, 166, 68, 146, 0, 135, 72, 88, 59, 195, 254, 38, 223, 86, 130, 129, 145, 172, 6, 67, 154, 18, 161, 61, 152,
-    47, 242, 173, 177, 197, 97, 86, 180, 132, 125, 120, 109, 164, 9, 42, 29, 130, 118, 79, 145, 116, 117, 172, 115, 75,
-    54, 186, 245, 208, 48, 76, 255, 97, 72, 171, 245, 102, 206, 116, 69, 67, 135, 151, 173, 94, 87, 212, 208, 70, 104,
-    78, 168, 221, 72, 152, 74, 157, 22, 12, 28, 166, 203, 123, 112, 123, 40, 118, 13, 113, 11, 79, 129, 47, 51, 42, 42,
-    12, 207, 202, 20, 218, 119, 81, 39, 71, 41, 62, 48, 156, 228, 51, 210, 59, 197, 193, 236, 64, 23, 42, 30, 85, 227,
-    79, 78, 108, 194, 121, 163, 136, 123, 141, 187, 170, 194, 239, 5, 168, 188, 182, 240, 205, 47, 52, 186, 27, 206,
-    208, 233, 20, 74, 108, 58, 132, 171, 156, 85, 171, 50, 126, 140, 160, 217, 108, 75, 79, 231, 201, 246, 116, 118,
-    197, 149, 245, 3, 129, 140, 155, 94, 23, 74, 5, 84, 165, 73, 64, 65, 180, 36, 222, 85, 209, 23, 111, 99, 155, 76,
-    35, 148, 2, 10, 195, 21, 34, 120, 156, 3, 70, 242, 99, 255, 1, 111, 29, 16, 224, 25, 16, 214, 37, 194, 159, 117, 12,
-    72, 216, 159, 76, 65, 230, 130, 29, 214, 152, 162, 129, 104, 240, 129, 149, 185, 22, 23, 210, 143, 167, 71, 130,
-    176, 147, 199, 237, 126, 109, 27, 241, 221, 129, 201, 165, 73, 195, 193, 1, 166, 36, 224, 52, 33, 204, 167, 134,
-    189, 194, 114, 36, 8, 73, 162, 138, 172, 112, 66, 221, 171, 177, 5, 162, 0, 96, 148, 68, 113, 132, 61, 48, 219, 109,
-    107, 18, 238, 144, 102, 38, 231, 192, 89, 215, 234, 134, 200, 187, 115, 143, 222, 191, 213, 225, 147, 142, 8, 237,
-    78, 96, 9, 45, 202, 73, 194, 72, 206, 12, 193, 124, 57, 154, 237, 75, 43, 223, 44, 136, 153, 190, 112, 188, 211,
-    187, 20, 208, 218, 220, 49, 23, 192, 85, 153, 47, 114, 143, 17, 173, 156, 101, 20, 202, 203, 117, 181, 101, 223, 76,
-    235, 154, 137, 99, 26, 210, 27, 124, 76, 33, 103, 140, 197, 9, 248, 226, 108, 217, 71, 18, 36, 145, 67, 27, 117, 62,
-    103, 147, 55, 60, 204, 158, 136, 253, 54, 90, 115, 105, 242, 111, 167, 204, 0, 201, 122, 244, 18, 239, 95, 248, 237,
-    191, 184, 167, 245, 72, 78, 105, 109, 71, 104, 94, 200, 101, 118, 94, 220, 252, 79, 78, 132, 20, 214, 200, 24, 242,
-    50, 146, 150, 58, 214, 46, 26, 96, 221, 211, 121, 99, 116, 177, 13, 154, 3, 191, 13, 166, 128, 227, 164, 121, 74,
-    119, 173, 156, 184, 163, 122, 140, 79, 225, 155, 58, 170, 57, 237, 61, 213, 253, 164, 37, 80, 81, 182, 54, 136, 149,
-    102, 176, 57, 89, 117, 210, 71, 59, 12, 185, 63, 215, 248, 108, 59, 237, 219, 29, 114, 242, 16, 238, 9, 89, 11, 90,
-    19, 38, 153, 172, 85, 94, 87, 235, 22, 173, 254, 135, 249, 216, 223, 147, 160, 207, 131, 165, 79, 221, 191, 195,
-    215, 147, 49, 23, 106, 48, 157, 239, 57, 215, 254, 165, 198, 60, 247, 41, 151, 194, 66, 111, 210, 126, 212, 205,
-    151, 42, 255, 135, 204, 105, 182, 206, 17, 210, 214, 61, 59, 62, 236, 238, 106, 199, 30, 239, 46, 108, 114, 253, 5,
-    7, 59, 203, 59, 211, 169, 239, 140, 193, 163, 17, 204, 249, 244, 242, 15, 57, 100, 191, 212, 138, 198, 38, 115, 231,
-    7, 213, 252, 120, 13, 16, 37, 57, 61, 248, 148, 203, 43, 175, 34, 120, 5, 124, 6, 214, 32, 42, 187, 13, 189, 243,
-    250, 152, 70, 123, 167, 82, 244, 43, 222, 94, 40, 164, 38, 72, 2, 49, 16, 126, 42, 59, 5, 57, 236, 13, 215, 51, 217,
-    34, 26, 111, 13, 94, 65, 137, 18, 170, 194, 230, 160, 238, 246, 162, 229, 26, 106, 133, 77, 158, 39, 192, 90, 135,
-    96, 180, 118, 114, 149, 221, 127, 192, 13, 69, 151, 253, 219, 166, 100, 33, 96, 15, 17, 50, 198, 255, 130, 218, 237,
-    110, 30, 75, 23, 239, 156, 222, 49, 36, 116, 214, 156, 103, 128, 107, 44, 64, 187, 236, 122, 62, 242, 60, 74, 17,
-    15, 166, 215, 201, 241, 28, 102, 6, 211, 183, 158, 124, 105, 107, 27, 118, 30, 81, 28, 3, 183, 114, 179, 168, 72,
-    166, 227, 214, 154, 86, 171, 231, 48, 31, 205, 231, 90, 92, 152, 133, 39, 84, 189, 236, 14, 42, 34, 147, 118, 187,
-    70, 48, 73, 236, 96, 189, 223, 103, 152, 63, 13, 125, 76, 112, 63, 219, 170, 76, 239, 31, 121, 213, 135, 205, 73,
-    23, 210, 190, 211, 92, 166, 180, 128, 73, 142, 101, 226, 205, 195, 93, 213, 39, 100, 6, 33, 103, 227, 245, 15, 57,
-    102, 232, 86, 226, 9, 117, 236, 224, 9, 97, 17, 66, 22, 228, 253, 61, 244, 196, 255, 167, 6, 128, 28, 31, 109, 191,
-    56, 186, 141, 132, 103, 224, 43, 15, 166, 26, 165, 176, 207, 51, 20, 226, 123, 236, 35, 151, 150, 246, 161, 97, 70,
-    135, 64, 135, 43, 30, 212, 81, 22, 81, 164, 212, 162, 203, 191, 41, 28, 170, 118, 87, 215, 180, 186, 61, 249, 147,
-    160, 16, 199, 46, 192, 78, 238, 80, 175, 62, 168, 0, 108, 115, 203, 235, 195, 21, 125, 196, 133, 199, 241, 146, 111,
-    212, 85, 159, 225, 85, 40, 40, 50, 183, 177, 107, 31, 16, 26, 194, 33, 149, 178, 209, 25, 191, 136, 69, 220, 114,
-    234, 174, 94, 96, 156, 89, 225, 67, 164, 106, 19, 26, 94, 86, 127, 95, 185, 166, 117, 213, 154, 79, 130, 18, 237,
-    237, 109, 36, 68, 169, 26, 160, 117, 135, 147, 137, 227, 246, 5, 44, 59, 13, 57, 138, 31, 205, 2, 34, 23, 105, 70,
-    171, 90, 74, 84, 9, 157, 174, 227, 239, 222, 18, 217, 134, 209, 255, 116, 40, 56, 69, 21, 239, 10, 122, 171, 187,
-    151, 94, 141, 245, 52, 79, 42, 159, 201, 215, 121, 79, 166, 91, 53, 19, 25, 82, 218, 164, 26, 57, 14, 133, 13, 211,
-    198, 111, 92, 234, 244, 54, 184, 153, 82, 74, 168, 5, 232, 2, 238, 47, 155, 168, 77, 197, 70, 174, 46, 17, 103, 39,
-    132, 57, 189, 103, 54, 143, 224, 34, 236, 183, 92, 116, 7, 28, 161, 65, 138, 27, 6, 114, 20, 255, 44, 90, 178, 224,
-    15, 22, 161, 9, 143, 30, 39, 106, 171, 203, 234, 144, 137, 112, 254, 196, 195, 160, 159, 36, 107, 243, 36, 120, 246,
-    192, 239, 96, 210, 72, 29, 95, 67, 19, 82, 104, 74, 110, 69, 122, 145, 122, 130, 96, 68, 30, 184, 46, 145, 4, 59,
-    159, 159, 45, 13, 106, 227, 89, 6, 136, 255, 139, 81, 149, 4, 28, 168, 23, 19, 155, 66, 205, 224, 26, 151, 222, 48,
-    106, 253, 22, 88, 58, 153, 158, 237, 226, 124, 181, 114, 15, 90, 48, 4, 219, 91, 59, 189, 87, 79, 16, 187, 79, 5,
-    238, 237, 211, 190, 215, 66, 229, 183, 226, 194, 141, 20, 113, 143, 107, 77, 228, 47, 142, 205, 61, 108, 163, 18,
-    58, 204, 105, 144, 129, 230, 231, 231, 199, 101, 128, 138, 50, 252, 83, 33, 206, 157, 123, 214, 246, 230, 242, 40,
-    161, 29, 233, 121, 44, 193, 246, 86, 98, 243, 59, 195, 69, 202, 17, 56, 149, 190, 217, 95, 247, 171, 255, 89, 60,
-    99, 208, 48, 119, 62, 5, 129, 4, 226, 71, 237, 174, 226, 138, 180, 228, 83, 6, 42, 215, 217, 226, 246, 189, 136,
-    207, 201, 228, 200, 169, 152, 33, 45, 83, 189, 61, 3, 170, 207, 248, 13, 46, 228, 154, 99, 87, 133, 30, 218, 97,
-    223, 136, 121, 177, 136, 232, 150, 238, 184, 222, 30, 164, 75, 150, 154, 234, 71, 16, 185, 21, 175, 1, 125, 48, 226,
-    164, 136, 64, 19, 107, 244, 218, 12, 100, 119, 169, 214, 246, 188, 198, 171, 38, 177, 118, 17, 118, 13, 81, 185,
-    134, 162, 42, 98, 234, 23, 19, 72, 129, 113, 143, 78, 246, 57, 32, 120, 237, 197, 102, 0, 112, 43, 86, 10, 155, 194,
-    145, 10, 176, 175, 185, 43, 54, 154, 232, 216, 215, 190, 255, 230, 245, 82, 77, 201, 120, 115, 108, 171, 116, 140,
-    148, 12, 202, 227, 183, 49, 227, 237, 234, 191, 179, 190, 92, 250, 130, 104, 216, 70, 70, 207, 52, 7, 211, 21, 30,
-    212, 153, 27, 193, 205, 4, 188, 128, 222, 150, 9, 138, 79, 132, 200, 104, 29, 17, 141, 203, 113, 139, 29, 45, 29,
-    77, 77, 71, 137, 128, 209, 113, 214, 147, 152, 108, 48, 160, 210, 75, 227, 249, 141, 51, 165, 207, 3, 142, 208, 86,
-    107, 243, 100, 204, 202, 22, 144, 158, 195, 197, 132, 64, 177, 20, 159, 68, 240, 4, 110, 218, 193, 247, 11, 136, 99,
-    208, 125, 194, 121, 28, 46, 73, 153, 166, 203, 135, 172, 91, 78, 80, 231, 83, 235, 38, 124, 140, 41, 130, 29, 131,
-    181, 220, 214, 74, 26, 73, 87, 113, 202, 224, 68, 216, 3, 251, 35, 194, 189, 133, 137, 218, 168, 189, 75, 110, 3,
-    95, 38, 58, 224, 121, 27, 201, 169, 78, 42, 96, 131, 77, 126, 89, 109, 59, 117, 138, 124, 51, 223, 24, 120, 126,
-    116, 137, 33, 78, 132, 102, 218, 70, 133, 207, 55, 242, 249, 192, 190, 16, 73, 43, 41, 152, 110, 211, 246, 202, 223,
-    229, 104, 112, 63, 68, 219, 91, 45, 203, 127, 242, 220, 225, 101, 41, 200, 206, 173, 47, 34, 56, 18, 214, 0, 9, 184,
-    57, 172, 225, 238, 103, 54, 205, 45, 235, 14, 20, 255, 133, 220, 42, 55, 175, 252, 115, 98, 249, 27, 88, 162, 17,
-    130, 251, 112, 48, 59, 70, 27, 9, 103, 173, 239, 208, 43, 21, 84, 215, 234, 54, 110, 154, 39, 31, 63, 53, 105, 143,
-    150, 96, 253, 222, 37, 59, 194, 125, 85, 203, 195, 75, 217, 227, 73, 43, 61, 119, 24, 242, 230, 169, 44, 206, 156,
-    118, 95, 44, 5, 109, 94, 20, 145, 168, 125, 177, 165, 159, 151, 57, 15, 59, 198, 57, 205, 160, 218, 165, 23, 181,
-    53, 65, 12, 159, 131, 4, 171, 121, 188, 191, 195, 107, 161, 230, 103, 248, 108, 228, 5, 252, 151, 165, 104, 13, 108,
-    116, 201, 26, 89, 122, 233, 153, 128, 110, 149, 214, 210, 191, 43, 120, 173, 33, 165, 67, 158, 59, 171, 34, 134,
-    154, 12, 36, 139, 85, 151, 102, 199, 47, 48, 23, 55, 195, 171, 241, 23, 173, 8, 131, 133, 182, 27, 17, 177, 253, 8,
-    168, 139, 125, 143, 145, 20, 15, 200, 201, 145, 25, 251, 167, 128, 77, 5, 9, 54, 203, 152, 78, 59, 113, 241, 128,
-    241, 117, 224, 222, 203, 220, 122, 248, 65, 104, 168, 247, 131, 146, 61, 191, 76, 216, 173, 209, 29, 134, 206, 174,
-    4, 206, 169, 148, 129, 149, 207, 158, 172, 184, 2, 104, 94, 178, 16, 79, 142, 85, 173, 51, 154, 180, 97, 121, 193,
-    193, 53, 181, 137, 154, 66, 49, 187, 115, 167, 253, 197, 105, 108, 111, 222, 58, 2, 4, 182, 195, 14, 51, 60, 202,
-    89, 146, 206, 165, 29, 34, 89, 139, 72, 154, 203, 224, 113, 215, 20, 244, 199, 31, 199, 248, 245, 74, 64, 55, 157,
-    209, 185, 137, 230, 144, 176, 240, 166, 103, 163, 42, 133, 45, 236, 8, 172, 255, 61, 217, 46, 149, 46, 66, 25, 103,
-    106, 253, 207, 78, 175, 76, 144, 27, 217, 76, 129, 209, 126, 199, 242, 141, 190, 180, 202, 247, 191, 227, 160, 28,
-    58, 79, 170, 168, 15, 185, 88, 69, 164, 249, 172, 47, 114, 180, 204, 79, 32, 202, 47, 251, 241, 206, 89, 8, 78, 98,
-    82, 251, 75, 2, 226, 25, 30, 4, 136, 122, 177, 78, 189, 80, 83, 19, 133, 124, 13, 227, 19, 217, 167, 253, 107, 46,
-    172, 65, 56, 110, 10, 176, 41, 205, 30, 158, 93, 57, 225, 178, 173, 141, 23, 73, 148, 110, 113, 54, 64, 31, 163, 11,
-    194, 231, 78, 42, 200, 143, 54, 22, 154, 130, 122, 252, 117, 145, 29, 145, 169, 68, 72, 13, 55, 196, 50, 236, 202,
-    31, 245, 11, 222, 116, 202, 71, 199, 29, 72, 166, 128, 228, 213, 153, 74, 95, 213, 33, 144, 75, 36, 7, 72, 133, 49,
-    130, 209, 121, 217, 211, 169, 243, 119, 56, 70, 48, 29, 211, 121, 124, 109, 125, 153, 10, 247, 179, 115, 43, 171,
-    225, 136, 136, 150, 131, 116, 142, 45, 244, 223, 86, 155, 168, 49, 193, 88, 205, 86, 133, 120, 223, 91, 223, 238,
-    120, 31, 240, 21, 69, 99, 183, 17, 219, 84, 114, 79, 166, 238, 158, 126, 205, 176, 112, 141, 126, 64, 229, 121, 190,
-    207, 24, 252, 43, 3, 64, 135, 194, 63, 12, 177, 127, 165, 68, 17, 5, 55, 25, 9, 197, 28, 229, 236, 241, 186, 160,
-    37, 109, 221, 87, 104, 61, 108, 71, 60, 145, 208, 126, 186, 165, 91, 247, 106, 218, 123, 225, 31, 103, 8, 31, 202,
-    178, 143, 204, 152, 31, 243, 138, 220, 62, 20, 52, 21, 218, 14, 207, 19, 253, 103, 8, 214, 31, 190, 198, 249, 159,
-    77, 226, 106, 221, 83, 188, 220, 77, 34, 182, 42, 215, 35, 205, 209, 5, 83, 154, 220, 58, 200, 29, 136, 169, 95,
-    109, 161, 99, 129, 100, 224, 120, 40, 80, 145, 135, 211, 213, 35, 207, 187, 170, 164, 140, 46, 177, 21, 195, 80, 4,
-    29, 14, 154, 95, 144, 185, 49, 22, 247, 92, 168, 96, 5, 23, 184, 209, 29, 21, 254, 145, 6, 207, 97, 116, 228, 95,
-    182, 75, 79, 69, 41, 170, 201, 124, 15, 85, 109, 40, 181, 85, 141, 82, 174, 243, 225, 26, 156, 66, 130, 106, 111,
-    163, 180, 111, 150, 105, 131, 86, 71, 166, 17, 172, 44, 90, 158, 121, 140, 50, 199, 120, 43, 131, 251, 67, 73, 105,
-    217, 96, 228, 216, 224, 67, 191, 4, 51, 177, 229, 143, 102, 145, 110, 135, 146, 175, 74, 75, 207, 78, 153, 37, 187,
-    60, 73, 217, 220, 195, 48, 41, 42, 169, 50, 47, 66, 82, 213, 196, 16, 240, 133, 143, 77, 97, 181, 128, 211, 52, 135,
-    21, 241, 219, 17, 24, 242, 17, 206, 54, 108, 6, 207, 65, 17, 246, 247, 209, 171, 233, 252, 252, 116, 183, 230, 15,
-    208, 107, 190, 154, 11, 27, 87, 16, 240, 37, 87, 161, 138, 36, 192, 88, 49, 79, 108, 28, 241, 247, 129, 131, 75, 18,
-    185, 37, 151, 88, 110, 28, 84, 81, 213, 80, 149, 9, 129, 116, 21, 41, 173, 172, 138, 214, 236, 220, 24, 151, 31, 40,
-    31, 71, 234, 93, 146, 215, 116, 87, 133, 237, 91, 178, 66, 52, 186, 32, 162, 16, 175, 224, 68, 184, 227, 12, 189,
-    147, 239, 210, 162, 61, 159, 188, 27, 184, 51, 224, 10, 119, 238, 157, 159, 137, 158, 24, 182, 193, 200, 171, 229,
-    50, 223, 218, 72, 137, 68, 123, 36, 140, 73, 85, 229, 200, 58, 169, 243, 109, 170, 219, 129, 211, 112, 28, 160, 204,
-    73, 15, 180, 152, 229, 37, 89, 25, 228, 45, 102, 200, 41, 112, 101, 80, 83, 20, 85, 185, 231, 98, 20, 175, 163, 12,
-    220, 29, 240, 212, 250, 149, 165, 125, 45, 233, 178, 207, 211, 13, 250, 239, 20, 149, 116, 137, 125, 55, 13, 32, 89,
-    165, 209, 163, 217, 90, 127, 188, 146, 66, 18, 47, 9, 167, 138, 220, 175, 55, 207, 222, 239, 46, 64, 123, 50, 22,
-    104, 26, 57, 78, 37, 109, 29, 224, 172, 250, 68, 117, 124, 53, 197, 203, 179, 128, 132, 127, 57, 27, 68, 118, 4,
-    118, 30, 246, 166, 228, 52, 76, 170, 60, 184, 72, 61, 52, 164, 185, 18, 224, 118, 225, 221, 195, 154, 15, 148, 220,
-    157, 243, 238, 36, 39, 134, 64, 27, 106, 235, 106, 144, 159, 150, 148, 170, 235, 7, 60, 109, 153, 249, 62, 20, 173,
-    126, 86, 35, 169, 229, 82, 186, 238, 113, 112, 124, 82, 249, 157, 21, 77, 109, 16, 126, 99, 220, 5, 221, 246, 176,
-    193, 24, 176, 240, 116, 40, 153, 103, 142, 221, 82, 108, 124, 52, 235, 83, 0, 158, 30, 237, 203, 111, 162, 76, 113,
-    223, 175, 191, 16, 190, 120, 38, 126, 212, 92, 136, 12, 52, 181, 216, 254, 105, 198, 245, 176, 54, 49, 102, 82, 85,
-    162, 107, 206, 58, 97, 128, 236, 227, 44, 233, 158, 94, 192, 74, 229, 211, 227, 76, 200, 247, 191, 80, 55, 40, 187,
-    76, 207, 96, 24, 71, 195, 0, 127, 254, 242, 17, 31, 96, 201, 99, 70, 233, 51, 250, 142, 211, 241, 85, 82, 181, 204,
-    191, 152, 113, 113, 13, 1, 149, 193, 177, 82, 153, 107, 223, 149, 139, 47, 96, 173, 107, 121, 112, 85, 215, 149,
-    111, 54, 49, 185, 89, 173, 198, 4, 34, 101, 168, 126, 62, 62, 9, 111, 192, 68, 143, 81, 158, 24, 146, 137, 138, 64,
-    179, 209, 0, 182, 182, 177, 197, 105, 134, 249, 186, 48, 214, 72, 50, 130, 66, 45, 105, 162, 126, 211, 202, 190, 8,
-    95, 41, 184, 232, 76, 246, 104, 150, 144, 244, 222, 79, 77, 246, 115, 252, 97, 42, 109, 28, 155, 34, 215, 84, 114,
-    35, 115, 156, 255, 153, 191, 141, 161, 185, 141, 48, 42, 137, 157, 60, 184, 244, 56, 141, 213, 100, 37, 229, 181,
-    213, 105, 47, 147, 130, 171, 49, 32, 15, 80, 41, 128, 48, 126, 76, 162, 207, 27, 241, 221, 251, 129, 58, 25, 238,
-    114, 53, 36, 207, 7, 140, 0, 84, 243, 31, 163, 62, 145, 0, 7, 212, 45, 200, 220, 234, 159, 142, 118, 1, 47, 149,
-    198, 130, 248, 203, 161, 14, 34, 108, 249, 53, 80, 117, 180, 97, 12, 147, 156, 37, 244, 163, 109, 39, 75, 190, 250,
-    155, 41, 125, 17, 57, 167, 94, 195, 79, 125, 241, 148, 162, 216, 238, 1, 157, 150, 14, 201, 109, 196, 148, 6, 54,
-    232, 145, 211, 65, 252, 102, 49, 117, 41, 160, 233, 54, 128, 255, 54, 57, 76, 207, 203, 3, 175, 225, 210, 234, 142,
-    139, 120, 3, 198, 99, 160, 247, 1, 39, 144, 28, 53, 17, 27, 43, 147, 88, 44, 71, 196, 122, 201, 228, 55, 25, 192,
-    47, 213, 251, 173, 56, 191, 13, 166, 54, 138, 124, 60, 251, 113, 12, 171, 216, 214, 63, 97, 169, 245, 206, 62, 26,
-    69, 246, 172, 109, 6, 184, 188, 51, 36, 65, 214, 242, 82, 36, 64, 30, 93, 184, 171, 213, 114, 209, 112, 82, 193, 89,
-    237, 190, 186, 111, 149, 133, 203, 238, 6, 43, 190, 58, 7, 193, 194, 44, 224, 133, 139, 185, 121, 132, 161, 112,
-    166, 3, 128, 204, 44, 147, 46, 221, 51, 41, 54, 55, 40, 135, 73, 170, 255, 194, 77, 240, 6, 162, 228, 51, 243, 223,
-    240, 243, 96, 66, 238, 178, 215, 20, 203, 47, 207, 183, 199, 89, 0, 119, 254, 127, 174, 91, 80, 221, 96, 66, 68, 95,
-    94, 241, 145, 169, 113, 209, 1, 243, 66, 29, 139, 1, 178, 142, 86, 141, 89, 64, 58, 22, 182, 136, 224, 127, 109,
-    141, 66, 126, 155, 34, 108, 51, 63, 5, 46, 214, 108, 162, 69, 218, 56, 104, 23, 202, 215, 4, 212, 220, 76, 207, 219,
-    115, 95, 10, 166, 72, 56, 48, 231, 235, 137, 21, 181, 225, 235, 208, 82, 200, 70, 218, 251, 235, 53, 85, 93, 130,
-    137, 190, 209, 186, 154, 66, 19, 178, 147, 153, 23, 216, 82, 124, 158, 167, 87, 201, 85, 94, 124, 112, 150, 213,
-    239, 78, 188, 210, 56, 218, 20, 191, 60, 154, 12, 140, 130, 181, 214, 92, 101, 116, 158, 1, 173, 234, 248, 211, 235,
-    174, 17, 196, 47, 0, 239, 38, 103, 94, 192, 98, 59, 65, 107, 112, 10, 81, 135, 202, 130, 67, 179, 37, 108, 229, 58,
-    6, 235, 50, 216, 173, 30, 27, 103, 252, 29, 182, 68, 110, 208, 234, 67, 31, 61, 97, 95, 250, 234, 127, 9, 20, 78,
-    123, 41, 107, 126, 229, 47, 147, 51, 57, 62, 167, 51, 18, 208, 3, 34, 23, 31, 104, 157, 201, 14, 127, 56, 123, 76,
-    169, 59, 133, 219, 13, 201, 50, 96, 151, 201, 230, 78, 11, 198, 36, 109, 64, 245, 188, 37, 40, 187, 213, 154, 237,
-    43, 13, 55, 17, 218, 47, 180, 39, 136, 235, 35, 56, 243, 122, 177, 43, 53, 222, 134, 221, 126, 130, 28, 249, 141,
-    219, 180, 218, 168, 208, 115, 253, 221, 189, 103, 55, 106, 147, 49, 216, 202, 175, 76, 7, 51, 99, 66, 193, 246, 9,
-    158, 92, 45, 184, 167, 30, 133, 67, 132, 234, 1, 152, 206, 252, 208, 32, 215, 254, 58, 177, 103, 209, 43, 242, 37,
-    210, 147, 43, 138, 244, 142, 254, 250, 80, 123, 208, 149, 87, 219, 154, 191, 145, 41, 193, 193, 227, 143, 198, 220,
-    63, 132, 242, 56, 109, 128, 82, 32, 4, 120, 197, 128, 230, 59, 110, 9, 42, 109, 56, 146, 90, 220, 167, 137, 151, 13,
-    125, 4, 25, 235, 52, 218, 127, 140, 8, 155, 192, 41, 219, 101, 82, 57, 90, 36, 107, 227, 227, 184, 243, 164, 121,
-    242, 139, 211, 30, 161, 244, 137, 189, 10, 73, 36, 107, 252, 191, 9, 8, 11, 35, 142, 208, 196, 118, 33, 102, 227,
-    19, 228, 47, 9, 147, 185, 57, 19, 81, 247, 227, 160, 29, 49, 164, 139, 209, 177, 18, 62, 153, 186, 171, 137, 91, 87,
-    129, 236, 155, 63, 237, 100, 204, 168, 244, 176, 199, 56, 150, 136, 159, 173, 14, 246, 230, 35, 229, 195, 21, 221,
-    151, 162, 108, 242, 134, 25, 181, 107, 17, 63, 82, 236, 149, 5, 200, 56, 84, 72, 82, 30, 142, 177, 169, 166, 179,
-    95, 14, 36, 12, 254, 83, 66, 175, 199, 186, 5, 17, 86, 87, 146, 56, 187, 97, 60, 63, 28, 53, 70, 70, 93, 8, 42, 223,
-    112, 127, 162, 172, 53, 197, 209, 71, 152, 46, 40, 119, 145, 134, 102, 37, 119, 124, 153, 234, 197, 41, 175, 82,
-    222, 96, 103, 119, 146, 90, 97, 94, 252, 67, 182, 246, 26, 194, 10, 150, 33, 13, 135, 230, 218, 170, 57, 212, 102,
-    70, 46, 147, 178, 215, 215, 83, 153, 87, 118, 221, 0, 234, 55, 202, 54, 144, 164, 250, 235, 255, 104, 194, 202, 7,
-    167, 71, 127, 104, 214, 194, 202, 11, 180, 132, 94, 45, 99, 192, 30, 74, 207, 157, 4, 202, 84, 207, 84, 127, 3, 174,
-    151, 178, 18, 5, 250, 185, 149, 218, 171, 174, 45, 191, 197, 61, 178, 36, 130, 53, 76, 176, 176, 122, 56, 57, 161,
-    17, 176, 248, 237, 197, 232, 11, 27, 248, 222, 42, 214, 197, 3, 110, 88, 121, 165, 118, 149, 119, 184, 17, 166, 240,
-    225, 127, 211, 27, 209, 91, 176, 75, 155, 238, 194, 78, 157, 232, 135, 11, 37, 77, 150, 50, 211, 49, 233, 78, 240,
-    27, 224, 173, 120, 74, 158, 32, 141, 148, 129, 221, 65, 166, 16, 29, 238, 26, 128, 26, 48, 117, 21, 30, 17, 182,
-    248, 210, 246, 177, 144, 3, 241, 156, 177, 137, 148, 63, 67, 14, 83, 42, 2, 50, 201, 152, 192, 124, 123, 175, 189,
-    102, 200, 201, 144, 207, 6, 100, 147, 139, 75, 186, 105, 37, 53, 48, 77, 24, 224, 97, 254, 179, 186, 142, 53, 152,
-    204, 28, 80, 253, 178, 39, 26, 178, 172, 3, 35, 177, 34, 38, 111, 104, 171, 72, 79, 105, 105, 126, 4, 155, 161, 51,
-    117, 197, 165, 87, 151, 172, 185, 29, 214, 192, 19, 88, 177, 211, 140, 114, 104, 228, 167, 55, 20, 134, 68, 162,
-    215, 193, 141, 6, 42, 26, 83, 192, 87, 46, 113, 60, 220, 152, 241, 142, 213, 31, 92, 199, 27, 26, 205, 18, 7, 163,
-    65, 60, 221, 44, 38, 109, 63, 179, 184, 215, 106, 142, 232, 51, 162, 217, 128, 3, 84, 23, 189, 99, 218, 214, 44, 28,
-    209, 61, 213, 33, 211, 209, 191, 188, 148, 111, 106, 129, 136, 88, 127, 115, 220, 186, 195, 89, 127, 50, 184, 86,
-    179, 223, 56, 157, 82, 254, 202, 247, 169, 4, 178, 63, 120, 233, 128, 184, 252, 50, 114, 153, 16, 40, 67, 225, 231,
-    13, 222, 212, 147, 76, 50, 146, 134, 233, 13, 91, 176, 213, 217, 228, 226, 110, 88, 111, 134, 6, 71, 253, 166, 171,
-    43, 23, 207, 42, 227, 87, 80, 153, 217, 104, 149, 250, 21, 78, 137, 11, 14, 166, 15, 164, 18, 211, 94, 30, 252, 244,
-    190, 160, 238, 220, 160, 5, 4, 231, 220, 84, 152, 51, 39, 147, 18, 111, 171, 171, 191, 19, 156, 116, 187, 34, 104,
-    169, 86, 242, 208, 157, 127, 8, 149, 84, 178, 108, 97, 164, 37, 46, 170, 214, 156, 239, 113, 200, 234, 233, 160, 53,
-    89, 244, 95, 124, 212, 19, 217, 106, 232, 215, 28, 11, 122, 197, 47, 37, 66, 196, 197, 125, 141, 242, 64, 90, 155,
-    79, 84, 162, 109, 194, 252, 245, 56, 175, 190, 103, 144, 17, 185, 59, 159, 223, 249, 47, 132, 178, 118, 65, 21, 74,
-    152, 172, 201, 155, 185, 188, 101, 226, 14, 177, 58, 152, 61, 169, 94, 255, 163, 210, 160, 195, 36, 230, 7, 81, 5,
-    73, 206, 71, 151, 20, 146, 119, 83, 86, 92, 148, 47, 101, 157, 97, 128, 116, 87, 217, 249, 179, 11, 207, 233, 182,
-    200, 200, 166, 171, 155, 164, 41, 216, 107, 3, 166, 77, 206, 237, 133, 126, 137, 52, 116, 218, 47, 206, 187, 66,
-    168, 68, 251, 189, 250, 14, 161, 59, 255, 62, 30, 26, 22, 212, 185, 104, 194, 38, 45, 0, 66, 125, 29, 95, 205, 155,
-    2, 91, 240, 235, 28, 9, 229, 30, 84, 155, 116, 98, 190, 233, 167, 21, 228, 132, 155, 36, 236, 160, 38, 21, 45, 211,
-    148, 112, 181, 205, 212, 40, 57, 124, 120, 131, 146, 186, 72, 206, 82, 8, 170, 202, 40, 251, 149, 198, 120, 68, 23,
-    163, 121, 167, 163, 147, 35, 220, 209, 209, 237, 63, 93, 12, 82, 42, 56, 154, 250, 165, 50, 140, 195, 253, 146, 35,
-    152, 66, 181, 229, 59, 78, 85, 159, 138, 35, 144, 68, 142, 165, 160, 228, 191, 115, 111, 143, 159, 185, 235, 140,
-    170, 65, 32, 160, 140, 229, 76, 169, 5, 225, 35, 194, 208, 3, 3, 68, 109, 71, 175, 218, 161, 130, 171, 131, 127,
-    107, 88, 9, 107, 92, 110, 132, 21, 128, 66, 113, 175, 190, 57, 200, 81, 163, 174, 230, 64, 19, 106, 156, 65, 235,
-    242, 238, 87, 113, 146, 58, 92, 231, 196, 169, 167, 128, 160, 80, 202, 134, 226, 121, 236, 43, 122, 117, 247, 98, 7,
-    127, 248, 105, 245, 84, 44, 81, 52, 17, 63, 71, 95, 30, 148, 48, 23, 167, 60, 131, 145, 176, 139, 205, 183, 32, 58,
-    83, 30, 201, 232, 45, 111, 93, 198, 63, 92, 55, 58, 122, 159, 208, 216, 156, 120, 2, 32, 79, 27, 137, 97, 104, 98,
-    93, 131, 161, 137, 156, 34, 152, 169, 194, 175, 37, 11, 86, 144, 140, 72, 196, 153, 2, 247, 106, 2, 183, 98, 249,
-    66, 232, 212, 171, 32, 221, 79, 116, 154, 165, 235, 66, 7, 166, 195, 84, 193, 84, 9, 69, 149, 165, 90, 236, 63, 27,
-    164, 38, 211, 240, 109, 132, 39, 198, 130, 160, 156, 167, 67, 206, 238, 80, 33, 2, 161, 191, 64, 84, 203, 65, 216,
-    250, 93, 131, 129, 78, 153, 61, 160, 117, 164, 222, 128, 100, 107, 81, 101, 55, 251, 140, 108, 201, 70, 200, 89,
-    175, 215, 124, 14, 18, 232, 66, 185, 246, 110, 107, 173, 211, 198, 184, 35, 246, 174, 197, 74, 176, 219, 98, 39, 95,
-    3, 206, 120, 15, 13, 224, 11, 128, 18, 239, 9, 143, 165, 169, 2, 63, 32, 65, 153, 219, 156, 65, 77, 90, 73, 148,
-    191, 165, 249, 128, 107, 54, 71, 158, 196, 189, 157, 19, 197, 8, 135, 92, 205, 174, 27, 99, 44, 160, 223, 137, 202,
-    63, 150, 77, 43, 22, 215, 41, 79, 95, 189, 67, 54, 45, 42, 118, 34, 207, 125, 77, 109, 209, 30, 220, 152, 112, 35,
-    53, 108, 188, 206, 152, 119, 124, 209, 170, 48, 138, 204, 93, 17, 207, 39, 208, 83, 99, 181, 191, 86, 105, 216, 53,
-    157, 42, 136, 177, 37, 66, 67, 118, 147, 175, 51, 155, 110, 100, 1, 105, 170, 22, 46, 155, 249, 205, 57, 228, 197,
-    77, 76, 229, 96, 154, 220, 25, 73, 59, 217, 125, 20, 135, 155, 113, 205, 229, 176, 135, 173, 103, 8, 76, 142, 125,
-    202, 158, 188, 126, 27, 46, 104, 186, 98, 79, 16, 96, 93, 44, 246, 157, 131, 129, 234, 85, 251, 129, 84, 227, 94,
-    177, 70, 242, 230, 204, 211, 130, 229, 183, 204, 143, 246, 14, 129, 16, 47, 156, 10, 57, 128, 26, 101, 216, 235,
-    126, 196, 26, 75, 207, 89, 49, 86, 77, 84, 130, 107, 156, 194, 151, 180, 11, 218, 29, 143, 14, 15, 187, 100, 251,
-    110, 103, 119, 11, 182, 164, 39, 117, 63, 210, 12, 162, 137, 40, 168, 72, 231, 84, 17, 38, 200, 148, 207, 152, 163,
-    112, 200, 91, 221, 225, 185, 46, 244, 53, 91, 171, 245, 193, 178, 136, 125, 87, 173, 21, 192, 254, 54, 182, 184, 35,
-    66, 108, 249, 230, 220, 191, 189, 88, 226, 171, 248, 219, 113, 14, 66, 114, 146, 74, 225, 108, 190, 241, 255, 19,
-    76, 41, 215, 135, 0, 93, 135, 244, 181, 2, 35, 244, 57, 52, 212, 96, 157, 167, 76, 164, 169, 102, 104, 228, 93, 60,
-    71, 144, 187, 180, 65, 175, 214, 40, 112, 124, 49, 235, 67, 207, 95, 219, 59, 6, 99, 59, 126, 2, 29, 78, 0, 163,
-    254, 171, 34, 15, 13, 218, 191, 88, 105, 48, 161, 171, 207, 36, 205, 151, 110, 58, 194, 82, 45, 117, 187, 36, 38,
-    128, 71, 204, 255, 198, 85, 224, 235, 206, 122, 243, 69, 145, 253, 245, 141, 109, 238, 224, 252, 190, 47, 210, 225,
-    187, 189, 161, 215, 185, 179, 254, 215, 160, 109, 228, 187, 224, 193, 156, 78, 182, 9, 39, 131, 240, 141, 208, 211,
-    88, 234, 90, 212, 34, 40, 94, 13, 84, 162, 147, 176, 128, 251, 99, 74, 125, 82, 6, 75, 131, 232, 162, 56, 123, 11,
-    216, 114, 118, 155, 59, 149, 119, 196, 151, 203, 183, 144, 94, 248, 210, 55, 223, 108, 106, 31, 6, 229, 134, 232,
-    104, 140, 64, 79, 49, 67, 143, 112, 242, 165, 105, 218, 243, 121, 153, 144, 96, 255, 40, 34, 59, 77, 47, 24, 207,
-    50, 89, 9, 34, 125, 85, 239, 245, 165, 252, 79, 245, 19, 44, 32, 178, 63, 32, 83, 213, 215, 25, 68, 104, 144, 136,
-    162, 237, 150, 31, 122, 128, 42, 138, 92, 1, 241, 231, 144, 192, 124, 137, 32, 38, 79, 126, 64, 116, 83, 118, 170,
-    65, 17, 125, 34, 1, 174, 32, 93, 90, 3, 173, 228, 234, 90, 25, 126, 116, 19, 63, 33, 114, 154, 147, 175, 90, 224,
-    124, 161, 68, 133, 171, 69, 0, 97, 183, 90, 222, 216, 111, 144, 96, 217, 17, 101, 53, 164, 206, 47, 230, 243, 98, 4,
-    36, 127, 178, 220, 255, 195, 224, 95, 8, 200, 144, 155, 3, 61, 190, 78, 22, 71, 192, 170, 160, 42, 54, 78, 61, 84,
-    173, 164, 117, 89, 228, 124, 229, 6, 228, 187, 250, 223, 118, 160, 123, 37, 164, 102, 25, 155, 112, 94, 140, 37, 68,
-    14, 93, 255, 79, 174, 197, 162, 238, 189, 95, 120, 215, 67, 99, 7, 29, 44, 105, 188, 38, 153, 73, 220, 179, 47, 168,
-    113, 57, 48, 131, 76, 203, 223, 178, 26, 226, 58, 93, 4, 107, 125, 73, 116, 181, 115, 179, 30, 1, 158, 223, 63, 222,
-    38, 214, 85, 111, 114, 83, 98, 18, 0, 26, 76, 179, 97, 221, 170, 113, 184, 125, 174, 227, 239, 6, 174, 19, 49, 12,
-    77, 153, 4, 153, 121, 80, 43, 43, 241, 242, 120, 136, 100, 85, 169, 112, 13, 131, 51, 127, 23, 102, 4, 148, 48, 247,
-    180, 221, 151, 200, 156, 51, 247, 129, 202, 169, 85, 161, 67, 239, 81, 234, 167, 9, 126, 164, 233, 131, 255, 239,
-    89, 48, 193, 88, 71, 252, 44, 78, 141, 128, 221, 177, 7, 134, 42, 8, 128, 181, 171, 117, 154, 129, 103, 82, 168, 82,
-    143, 168, 11, 239, 156, 101, 77, 225, 100, 170, 46, 239, 83, 214, 29, 186, 132, 50, 134, 21, 239, 225, 57, 112, 235,
-    2, 239, 147, 98, 26, 42, 127, 88, 194, 121, 127, 18, 128, 217, 8, 88, 218, 207, 79, 249, 231, 114, 10, 230, 98, 219,
-    107, 9, 104, 145, 62, 17, 88, 12, 124, 183, 205, 4, 242, 252, 7, 169, 47, 20, 219, 183, 121, 117, 229, 162, 100,
-    120, 12, 211, 166, 137, 101, 211, 44, 187, 82, 208, 80, 149, 195, 108, 203, 5, 155, 231, 88, 22, 61, 58, 18, 121,
-    24, 161, 25, 151, 177, 99, 90, 79, 139, 185, 145, 45, 67, 17, 245, 10, 42, 80, 246, 67, 49, 63, 210, 179, 178, 241,
-    54, 80, 71, 93, 111, 50, 46, 107, 125, 195, 17, 50, 11, 78, 166, 119, 150, 56, 110, 212, 214, 252, 251, 93, 203,
-    167, 177, 34, 170, 183, 185, 174, 184, 179, 238, 21, 20, 50, 86, 215, 185, 38, 141, 212, 125, 44, 245, 190, 48, 56,
-    151, 96, 235, 73, 86, 207, 168, 40, 58, 181, 229, 90, 40, 128, 181, 47, 7, 168, 179, 203, 182, 227, 100, 88, 99, 48,
-    33, 182, 120, 169, 243, 199, 179, 12, 121, 191, 9, 239, 188, 73, 59, 86, 98, 215, 202, 0, 122, 170, 142, 254, 70,
-    198, 107, 212, 255, 77, 238, 31, 210, 241, 2, 250, 223, 57, 213, 20, 41, 232, 86, 15, 104, 232, 22, 18, 60, 132,
-    182, 3, 91, 202, 204, 107, 65, 7, 220, 19, 102, 147, 236, 178, 63, 234, 54, 36, 73, 129, 210, 233, 169, 92, 79, 222,
-    6, 25, 145, 219, 70, 218, 30, 246, 88, 78, 187, 214, 103, 202, 38, 17, 179, 59, 183, 26, 84, 231, 57, 171, 168, 90,
-    201, 146, 6, 44, 116, 38, 132, 153, 31, 222, 59, 56, 180, 136, 222, 40, 58, 212, 26, 225, 235, 8, 133, 77, 156, 101,
-    205, 116, 253, 255, 141, 41, 156, 232, 80, 93, 169, 59, 136, 191, 50, 107, 45, 148, 98, 115, 161, 51, 29, 136, 28,
-    24, 53, 118, 181, 37, 16, 128, 86, 0, 144, 206, 207, 21, 47, 132, 8, 116, 87, 159, 204, 137, 226, 215, 20, 36, 122,
-    52, 16, 102, 200, 78, 199, 94, 154, 148, 126, 126, 73, 192, 201, 105, 62, 118, 205, 221, 34, 155, 239, 166, 152,
-    112, 76, 106, 91, 209, 248, 129, 114, 144, 209, 91, 200, 62, 50, 183, 64, 32, 132, 40, 105, 167, 137, 254, 61, 143,
-    224, 170, 26, 8, 212, 62, 134, 20, 25, 188, 169, 29, 9, 35, 188, 204, 63, 77, 115, 227, 226, 47, 196, 209, 79, 101,
-    111, 162, 38, 252, 25, 5, 61, 74, 74, 74, 184, 24, 219, 125, 125, 86, 31, 198, 161, 45, 45, 228, 109, 223, 32, 102,
-    181, 87, 221, 198, 89, 218, 76, 129, 58, 184, 49, 248, 133, 249, 174, 104, 95, 92, 93, 170, 204, 206, 127, 58, 175,
-    19, 116, 97, 112, 240, 245, 39, 12, 36, 100, 95, 30, 207, 64, 249, 154, 200, 255, 202, 191, 231, 83, 134, 156, 118,
-    1, 48, 158, 216, 103, 47, 4, 171, 15, 79, 141, 83, 71, 26, 122, 78, 61, 53, 63, 40, 58, 75, 165, 171, 46, 92, 36,
-    186, 196, 38, 53, 215, 204, 143, 139, 76, 72, 57, 158, 144, 70, 134, 50, 34, 230, 83, 129, 245, 93, 30, 62, 71, 84,
-    50, 9, 181, 120, 23, 102, 90, 248, 167, 167, 224, 216, 101, 242, 134, 148, 59, 179, 62, 174, 157, 66, 219, 181, 132,
-    201, 235, 234, 197, 71, 222, 183, 253, 203, 2, 142, 69, 66, 228, 171, 135, 235, 201, 10, 239, 18, 152, 40, 15, 135,
-    22, 251, 92, 189, 13, 9, 247, 36, 143, 102, 24, 239, 203, 14, 89, 248, 38, 80, 229, 241, 182, 241, 176, 223, 105,
-    109, 26, 3, 201, 44, 183, 90, 104, 116, 205, 113, 61, 31, 85, 130, 254, 199, 71, 112, 11, 211, 171, 51, 76, 24, 237,
-    242, 128, 197, 180, 32, 175, 77, 24, 153, 142, 100, 219, 223, 162, 248, 2, 145, 201, 228, 209, 202, 32, 207, 19,
-    226, 27, 39, 8, 14, 180, 78, 68, 96, 84, 232, 55, 47, 238, 89, 107, 25, 86, 236, 51, 233, 66, 100, 212, 229, 222,
-    117, 141, 245, 209, 229, 157, 44, 213, 199, 182, 139, 124, 205, 100, 123, 34, 33, 175, 180, 176, 129, 226, 214, 121,
-    122, 208, 76, 93, 166, 28, 100, 44, 135, 245, 86, 200, 115, 74, 212, 252, 25, 184, 75, 10, 234, 95, 173, 152, 233,
-    9, 0, 200, 200, 194, 180, 3, 189, 73, 242, 236, 142, 64, 183, 162, 40, 27, 63, 192, 41, 28, 200, 97, 39, 127, 123,
-    103, 2, 111, 44, 156, 218, 89, 169, 65, 57, 105, 165, 165, 80, 42, 99, 238, 146, 207, 168, 6, 250, 202, 150, 170,
-    224, 100, 2, 187, 241, 162, 22, 123, 16, 75, 78, 67, 185, 92, 135, 4, 54, 196, 73, 157, 190, 45, 38, 67, 127, 217,
-    16, 171, 149, 141, 148, 238, 130, 217, 82, 179, 22, 104, 141, 149, 29, 41, 39, 243, 163, 157, 147, 172, 197, 1, 184,
-    49, 228, 242, 238, 26, 9, 220, 160, 85, 253, 14, 192, 27, 195, 81, 138, 108, 106, 152, 101, 242, 108, 255, 151, 110,
-    39, 219, 87, 8, 3, 189, 16, 167, 167, 47, 114, 65, 163, 201, 193, 97, 88, 150, 143, 49, 11, 80, 183, 74, 65, 82, 36,
-    6, 141, 144, 27, 238, 239, 123, 219, 13, 6, 169, 183, 105, 90, 129, 91, 82, 232, 57, 105, 220, 139, 71, 250, 78,
-    128, 49, 16, 86, 75, 239, 42, 168, 23, 50, 125, 51, 20, 29, 134, 79, 14, 143, 234, 251, 131, 244, 246, 36, 230, 126,
-    60, 26, 112, 65, 144, 187, 69, 80, 214, 151, 114, 201, 6, 56, 18, 88, 193, 72, 148, 35, 172, 153, 8, 199, 22, 241,
-    237, 78, 79, 62, 21, 140, 85, 225, 107, 46, 165, 168, 63, 145, 207, 150, 95, 119, 24, 42, 177, 156, 39, 162, 70,
-    184, 189, 156, 157, 128, 227, 214, 209, 207, 235, 154, 36, 3, 110, 66, 125, 194, 184, 253, 77, 85, 103, 130, 11,
-    157, 141, 179, 229, 43, 164, 216, 162, 165, 200, 238, 127, 160, 42, 228, 97, 17, 164, 226, 239, 24, 151, 54, 105,
-    236, 195, 54, 232, 116, 55, 22, 199, 150, 170, 85, 31, 178, 93, 135, 85, 170, 235, 161, 227, 33, 176, 75, 223, 238,
-    208, 87, 80, 159, 106, 217, 219, 176, 45, 178, 212, 157, 236, 162, 210, 248, 102, 84, 111, 162, 204, 251, 30, 137,
-    188, 73, 241, 111, 234, 25, 241, 207, 102, 8, 248, 71, 187, 79, 134, 173, 244, 111, 64, 186, 249, 21, 10, 202, 58,
-    59, 175, 73, 197, 106, 251, 78, 57, 227, 46, 209, 203, 97, 215, 185, 58, 234, 166, 161, 233, 47, 209, 182, 123, 93,
-    60, 121, 202, 91, 14, 215, 255, 10, 235, 111, 245, 80, 134, 92, 70, 32, 185, 248, 174, 29, 212, 146, 195, 135, 67,
-    80, 127, 135, 138, 123, 148, 93, 107, 99, 47, 251, 12, 110, 205, 197, 100, 137, 163, 217, 2, 170, 231, 245, 126, 35,
-    239, 119, 128, 247, 115, 64, 229, 163, 209, 11, 123, 225, 4, 171, 64, 233, 181, 200, 241, 235, 73, 119, 146, 149,
-    58, 32, 16, 132, 251, 177, 161, 131, 25, 165, 27, 161, 16, 30, 147, 51, 112, 148, 157, 180, 175, 40, 202, 118, 10,
-    145, 10, 210, 73, 254, 24, 21, 235, 82, 119, 163, 24, 120, 157, 111, 141, 50, 87, 142, 210, 108, 76, 48, 78, 194,
-    87, 235, 157, 153, 214, 177, 13, 216, 214, 183, 32, 187, 238, 191, 157, 54, 153, 130, 159, 38, 81, 20, 27, 81, 197,
-    20, 210, 169, 189, 201, 88, 7, 31, 55, 13, 232, 100, 209, 255, 99, 188, 142, 126, 171, 168, 61, 117, 184, 117, 243,
-    150, 81, 138, 45, 107, 101, 33, 221, 44, 180, 112, 100, 205, 1, 249, 104, 110, 221, 103, 129, 244, 12, 97, 140, 253,
-    193, 153, 75, 82, 71, 75, 72, 241, 18, 105, 145, 205, 38, 158, 8, 207, 138, 106, 106, 50, 90, 187, 71, 205, 207, 2,
-    219, 25, 121, 223, 26, 225, 233, 180, 192, 247, 46, 84, 170, 3, 244, 130, 197, 213, 145, 137, 6, 57, 203, 191, 59,
-    47, 251, 24, 217, 76, 108, 23, 130, 63, 25, 237, 215, 37, 139, 252, 136, 200, 211, 184, 129, 144, 128, 207, 242,
-    196, 84, 240, 225, 160, 163, 146, 177, 76, 51, 24, 163, 45, 28, 62, 188, 94, 97, 238, 121, 10, 165, 117, 220, 79,
-    224, 171, 71, 86, 163, 176, 108, 111, 221, 66, 108, 118, 253, 42, 91, 129, 16, 128, 80, 171, 244, 116, 248, 127,
-    191, 139, 29, 51, 145, 173, 238, 99, 91, 238, 29, 238, 58, 225, 152, 69, 217, 34, 7, 19, 122, 89, 221, 62, 124, 75,
-    176, 191, 183, 28, 188, 114, 125, 32, 118, 75, 41, 250, 79, 11, 20, 30, 102, 252, 99, 79, 154, 129, 170, 214, 52,
-    148, 51, 129, 162, 50, 87, 134, 205, 241, 240, 20, 112, 50, 115, 233, 46, 23, 35, 146, 180, 83, 190, 3, 205, 160,
-    67, 176, 71, 54, 65, 52, 146, 185, 54, 150, 80, 43, 167, 252, 37, 198, 115, 117, 118, 227, 155, 131, 69, 179, 170,
-    21, 201, 28, 173, 89, 253, 150, 7, 208, 77, 92, 36, 240, 28, 84, 149, 198, 125, 127, 106, 195, 232, 58, 246, 135,
-    216, 110, 185, 135, 71, 136, 115, 125, 2, 122, 7, 177, 230, 107, 229, 143, 129, 225, 87, 72, 103, 224, 80, 168, 220,
-    5, 23, 63, 102, 123, 21, 217, 76, 158, 238, 9, 89, 72, 121, 45, 104, 195, 151, 7, 91, 76, 230, 82, 64, 22, 219, 228,
-    63, 163, 201, 232, 238, 51, 214, 161, 219, 180, 167, 60, 114, 119, 89, 234, 104, 167, 254, 50, 35, 75, 69, 55, 171,
-    111, 139, 71, 83, 97, 149, 76, 17, 126, 108, 33, 158, 241, 32, 230, 51, 72, 5, 87, 240, 224, 231, 133, 76, 123, 220,
-    91, 117, 155, 173, 6, 28, 9, 196, 38, 12, 115, 76, 150, 104, 2, 197, 186, 158, 236, 144, 147, 242, 60, 104, 25, 121,
-    233, 208, 72, 173, 157, 26, 155, 183, 42, 35, 216, 183, 141, 45, 206, 163, 22, 125, 237, 198, 225, 107, 157, 123,
-    216, 195, 66, 78, 203, 53, 255, 181, 6, 45, 135, 13, 238, 0, 12, 135, 193, 119, 192, 97, 186, 86, 114, 114, 153,
-    225, 134, 79, 177, 161, 145, 122, 162, 43, 127, 212, 162, 105, 214, 100, 83, 110, 150, 166, 209, 240, 0, 156, 15,
-    13, 166, 148, 143, 5, 64, 180, 152, 221, 161, 128, 80, 20, 101, 55, 247, 186, 135, 221, 248, 240, 169, 94, 176, 95,
-    143, 9, 231, 104, 254, 38, 184, 194, 236, 164, 188, 67, 21, 127, 143, 218, 114, 53, 51, 42, 183, 177, 243, 155, 163,
-    39, 81, 99, 12, 206, 96, 214, 48, 4, 178, 188, 202, 167, 175, 58, 140, 180, 231, 111, 215, 3, 137, 96, 49, 216, 117,
-    197, 39, 62, 195, 190, 19, 1, 212, 183, 165, 203, 74, 65, 229, 37, 219, 183, 193, 244, 38, 244, 183, 26, 57, 46, 53,
-    233, 74, 171, 159, 29, 148, 150, 96, 3, 85, 160, 246, 55, 98, 224, 149, 14, 117, 79, 247, 151, 223, 61, 168, 185,
-    111, 133, 22, 146, 38, 205, 31, 211, 61, 51, 85, 15, 30, 151, 205, 54, 232, 125, 91, 4, 31, 77, 153, 24, 171, 242,
-    6, 196, 142, 157, 120, 152, 12, 66, 82, 136, 229, 82, 175, 184, 142, 42, 16, 87, 117, 59, 179, 167, 215, 158, 184,
-    222, 191, 48, 15, 158, 180, 80, 127, 29, 1, 108, 23, 169, 19, 84, 5, 154, 93, 238, 155, 64, 241, 239, 218, 178, 82,
-    46, 233, 31, 187, 200, 37, 158, 138, 96, 194, 196, 55, 73, 61, 19, 107, 214, 55, 51, 63, 155, 252, 173, 64, 49, 160,
-    8, 197, 125, 115, 40, 224, 180, 163, 116, 183, 89, 103, 137, 119, 35, 81, 180, 172, 239, 128, 28, 27, 199, 118, 202,
-    51, 77, 133, 216, 112, 250, 73, 83, 230, 86, 94, 138, 68, 191, 107, 216, 1, 22, 65, 175, 176, 66, 49, 251, 175, 74,
-    248, 56, 154, 169, 139, 111, 105, 212, 4, 133, 163, 230, 244, 248, 64, 22, 120, 35, 174, 8, 52, 175, 59, 172, 30, 4,
-    65, 172, 126, 40, 124, 108, 145, 132, 128, 123, 101, 239, 9, 188, 243, 109, 144, 132, 232, 44, 48, 116, 138, 214,
-    105, 172, 182, 221, 206, 2, 192, 18, 239, 174, 214, 246, 246, 149, 180, 24, 31, 20, 133, 48, 254, 194, 120, 17, 40,
-    93, 144, 127, 13, 154, 181, 80, 205, 19, 177, 238, 253, 20, 130, 196, 157, 27, 26, 230, 59, 71, 1, 24, 105, 230, 15,
-    238, 215, 103, 73, 203, 37, 41, 225, 89, 18, 104, 186, 183, 236, 158, 207, 38, 164, 73, 107, 161, 143, 180, 238, 41,
-    154, 239, 100, 171, 146, 236, 42, 128, 85, 104, 166, 161, 238, 22, 187, 101, 199, 250, 137, 248, 77, 66, 135, 234,
-    141, 143, 84, 55, 205, 28, 26, 208, 109, 18, 176, 145, 30, 205, 172, 225, 46, 201, 251, 43, 83, 106, 253, 92, 110,
-    152, 230, 167, 102, 106, 77, 127, 15, 157, 66, 127, 252, 11, 7, 233, 138, 199, 15, 226, 196, 90, 202, 61, 74, 166,
-    132, 139, 11, 11, 128, 60, 245, 99, 58, 124, 129, 252, 225, 4, 221, 242, 107, 146, 103, 198, 44, 248, 37, 169, 68,
-    110, 102, 46, 181, 238, 174, 57, 66, 105, 14, 150, 91, 163, 150, 202, 218, 151, 78, 115, 234, 43, 93, 8, 214, 87,
-    204, 62, 47, 82, 145, 178, 243, 59, 11, 149, 203, 217, 55, 242, 77, 228, 72, 110, 50, 79, 51, 116, 64, 156, 10, 234,
-    111, 152, 42, 64, 168, 80, 219, 5, 99, 182, 62, 32, 187, 149, 98, 102, 62, 237, 248, 27, 228, 157, 63, 4, 165, 66,
-    117, 7, 32, 47, 210, 173, 255, 129, 177, 2, 228, 232, 206, 249, 237, 245, 182, 47, 221, 148, 244, 165, 125, 104,
-    225, 2, 204, 198, 245, 139, 152, 226, 186, 91, 98, 114, 25, 67, 78, 113, 36, 135, 58, 16, 245, 40, 119, 153, 111,
-    105, 63, 183, 40, 88, 170, 182, 61, 135, 93, 20, 34, 189, 168, 89, 178, 169, 193, 167, 147, 71, 122, 115, 79, 7, 49,
-    73, 19, 197, 157, 210, 131, 204, 209, 49, 44, 120, 19, 204, 206, 119, 181, 149, 227, 77, 84, 32, 202, 146, 11, 21,
-    144, 115, 222, 137, 0, 118, 53, 25, 129, 43, 76, 35, 104, 153, 9, 72, 55, 74, 28, 45, 30, 54, 161, 223, 217, 25,
-    209, 242, 22, 109, 148, 202, 63, 118, 210, 162, 40, 182, 161, 207, 9, 204, 81, 244, 185, 53, 190, 126, 97, 5, 38,
-    55, 17, 77, 247, 72, 239, 38, 249, 230, 62, 192, 36, 171, 125, 46, 71, 180, 130, 93, 17, 166, 59, 21, 63, 104, 54,
-    202, 50, 230, 133, 15, 146, 146, 247, 251, 193, 208, 73, 34, 9, 221, 132, 20, 188, 124, 248, 204, 18, 124, 154, 105,
-    33, 138, 224, 246, 212, 117, 238, 79, 131, 171, 176, 53, 75, 165, 42, 229, 69, 105, 144, 241, 243, 99, 157, 223,
-    102, 234, 39, 21, 157, 11, 236, 61, 166, 203, 114, 233, 51, 152, 141, 207, 239, 95, 210, 92, 122, 254, 77, 65, 26,
-    23, 170, 174, 168, 75, 176, 183, 255, 31, 101, 56, 62, 189, 103, 134, 140, 41, 100, 131, 204, 178, 5, 17, 108, 23,
-    239, 50, 198, 40, 1, 201, 240, 22, 160, 64, 18, 158, 132, 28, 204, 253, 62, 225, 113, 17, 197, 187, 240, 122, 207,
-    197, 121, 136, 206, 155, 65, 28, 90, 236, 92, 157, 97, 79, 254, 196, 41, 37, 0, 7, 231, 61, 52, 156, 228, 108, 245,
-    191, 146, 103, 35, 34, 214, 85, 244, 140, 188, 213, 119, 207, 105, 186, 138, 200, 2, 217, 236, 31, 255, 66, 17, 155,
-    184, 127, 50, 13, 233, 215, 213, 122, 214, 58, 191, 175, 187, 86, 194, 184, 218, 124, 131, 130, 8, 56, 176, 31, 68,
-    48, 131, 225, 211, 33, 166, 42, 234, 91, 185, 191, 103, 65, 224, 126, 50, 122, 49, 127, 8, 10, 162, 27, 240, 75, 31,
-    32, 108, 219, 121, 6, 101, 241, 191, 207, 245, 235, 90, 99, 73, 246, 153, 160, 56, 137, 189, 11, 34, 66, 242, 51,
-    37, 228, 39, 67, 44, 124, 51, 52, 105, 60, 111, 19, 28, 74, 198, 116, 140, 117, 100, 93, 97, 62, 188, 47, 93, 83,
-    228, 129, 106, 140, 163, 72, 95, 157, 22, 78, 235, 144, 151, 103, 175, 13, 191, 65, 80, 53, 34, 116, 157, 208, 24,
-    212, 227, 52, 129, 10, 247, 186, 148, 22, 242, 2, 45, 231, 162, 145, 157, 202, 157, 30, 239, 224, 87, 117, 72, 24,
-    5, 239, 96, 150, 8, 156, 206, 147, 131, 88, 216, 113, 116, 9, 126, 208, 212, 63, 113, 172, 245, 205, 134, 90, 123,
-    65, 194, 112, 133, 184, 184, 222, 98, 245, 126, 35, 162, 108, 37, 57, 203, 199, 60, 158, 146, 101, 99, 45, 52, 245,
-    42, 31, 93, 4, 73, 170, 172, 63, 150, 141, 222, 42, 173, 70, 177, 211, 217, 171, 145, 103, 65, 112, 0, 24, 106, 185,
-    42, 222, 145, 10, 234, 224, 229, 100, 107, 141, 19, 63, 82, 108, 159, 167, 149, 226, 4, 197, 151, 59, 224, 167, 42,
-    0, 66, 95, 154, 76, 41, 89, 112, 123, 199, 194, 121, 236, 156, 136, 229, 199, 204, 113, 191, 71, 220, 206, 225, 156,
-    39, 132, 178, 94, 108, 68, 30, 174, 208, 89, 134, 65, 5, 46, 191, 6, 207, 23, 20, 21, 246, 66, 234, 82, 236, 212,
-    197, 226, 90, 192, 79, 54, 32, 253, 88, 17, 49, 43, 165, 202, 125, 22, 217, 76, 60, 5, 142, 17, 38, 218, 73, 227,
-    164, 59, 174, 214, 28, 204, 209, 119, 192, 229, 67, 95, 119, 246, 76, 73, 197, 89, 88, 59, 248, 93, 175, 97, 1, 214,
-    206, 173, 219, 102, 60, 57, 39, 55, 44, 15, 125, 111, 99, 232, 104, 83, 112, 186, 151, 10, 108, 134, 76, 7, 1, 61,
-    213, 43, 186, 205, 53, 6, 58, 103, 134, 37, 137, 71, 238, 201, 17, 84, 129, 1, 84, 9, 73, 95, 80, 156, 153, 173,
-    236, 194, 4, 63, 85, 240, 164, 103, 18, 153, 75, 179, 48, 81, 163, 139, 224, 232, 186, 77, 231, 143, 119, 228, 47,
-    248, 148, 106, 31, 122, 192, 136, 229, 207, 54, 79, 227, 31, 88, 190, 41, 221, 74, 165, 84, 26, 49, 233, 171, 21,
-    46, 207, 241, 118, 179, 94, 179, 233, 207, 41, 47, 217, 76, 120, 22, 24, 172, 196, 113, 4, 64, 147, 9, 189, 145,
-    204, 161, 89, 152, 11, 140, 161, 92, 60, 127, 5, 58, 186, 203, 53, 85, 187, 116, 248, 111, 223, 198, 51, 83, 164,
-    129, 137, 171, 175, 247, 184, 234, 21, 173, 75, 90, 47, 104, 80, 156, 71, 85, 160, 77, 45, 114, 133, 48, 192, 96,
-    10, 58, 27, 128, 153, 15, 54, 184, 175, 154, 9, 253, 238, 1, 0, 235, 247, 28, 154, 232, 210, 99, 182, 248, 141, 136,
-    214, 237, 177, 206, 203, 156, 169, 84, 35, 205, 42, 147, 46, 84, 151, 126, 164, 0, 120, 55, 192, 167, 101, 158, 158,
-    153, 143, 44, 96, 103, 175, 32, 50, 169, 204, 11, 245, 72, 1, 133, 157, 55, 46, 209, 109, 34, 236, 86, 75, 125, 59,
-    251, 134, 11, 190, 17, 83, 116, 10, 17, 209, 41, 201, 216, 182, 250, 205, 222, 68, 90, 82, 254, 139, 136, 121, 61,
-    226, 253, 28, 209, 208, 248, 235, 196, 132, 242, 202, 173, 207, 122, 245, 56, 86, 4, 154, 105, 33, 33, 86, 62, 92,
-    160, 214, 8, 195, 228, 59, 107, 173, 215, 99, 13, 231, 12, 250, 178, 218, 35, 218, 123, 0, 160, 247, 204, 161, 247,
-    72, 101, 48, 43, 22, 98, 53, 91, 210, 89, 188, 209, 229, 46, 8, 48, 183, 239, 159, 154, 219, 184, 35, 133, 222, 48,
-    148, 217, 61, 98, 59, 188, 198, 253, 103, 57, 217, 168, 237, 223, 137, 238, 156, 77, 80, 105, 49, 177, 18, 102, 164,
-    140, 77, 154, 107, 93, 77, 176, 21, 100, 174, 187, 226, 94, 79, 255, 211, 190, 189, 227, 151, 130, 79, 209, 211,
-    126, 244, 63, 248, 147, 112, 18, 0, 185, 244, 137, 4, 220, 72, 146, 211, 16, 69, 207, 242, 240, 182, 43, 11, 86,
-    112, 88, 80, 170, 163, 1, 109, 147, 24, 84, 37, 212, 184, 235, 222, 27, 110, 148, 179, 227, 207, 117, 176, 100, 170,
-    239, 223, 10, 144, 188, 179, 74, 25, 46, 219, 226, 216, 183, 16, 254, 246, 208, 19, 135, 249, 199, 112, 198, 125,
-    190, 16, 196, 186, 75, 205, 21, 89, 248, 94, 67, 34, 66, 255, 208, 130, 109, 195, 121, 136, 56, 123, 233, 37, 158,
-    162, 155, 129, 170, 114, 161, 203, 103, 87, 66, 179, 101, 10, 69, 99, 255, 219, 131, 113, 184, 115, 58, 216, 36,
-    138, 82, 58, 83, 232, 232, 12, 171, 161, 230, 142, 15, 157, 166, 53, 114, 55, 203, 3, 177, 255, 157, 244, 190, 201,
-    148, 30, 206, 195, 27, 70, 97, 188, 212, 192, 247, 166, 1, 68, 93, 251, 96, 13, 217, 44, 32, 197, 91, 193, 112, 207,
-    29, 28, 2, 50, 197, 25, 164, 39, 152, 103, 236, 45, 171, 91, 99, 205, 19, 203, 98, 234, 8, 68, 32, 121, 16, 92, 61,
-    11, 216, 0, 230, 19, 232, 49, 25, 31, 145, 179, 208, 114, 43, 188, 203, 227, 144, 153, 58, 202, 154, 148, 35, 94,
-    64, 106, 107, 122, 155, 62, 219, 110, 238, 126, 234, 252, 144, 196, 179, 192, 200, 183, 214, 133, 95, 116, 82, 178,
-    116, 65, 182, 254, 127, 180, 139, 187, 213, 125, 72, 229, 227, 245, 157, 153, 157, 54, 120, 182, 173, 52, 202, 207,
-    137, 19, 252, 168, 22, 161, 178, 191, 140, 114, 63, 23, 69, 34, 221, 232, 11, 83, 2, 127, 75, 34, 120, 103, 227,
-    141, 235, 182, 145, 254, 80, 213, 50, 7, 136, 10, 53, 156, 76, 42, 15, 162, 181, 175, 33, 243, 156, 57, 60, 145,
-    154, 167, 104, 71, 246, 70, 32, 143, 53, 108, 118, 231, 167, 205, 86, 172, 37, 248, 130, 142, 154, 246, 26, 237,
-    254, 32, 33, 21, 37, 50, 217, 90, 73, 227, 175, 96, 70, 17, 155, 243, 228, 214, 146, 75, 84, 2, 222, 100, 43, 166,
-    69, 162, 175, 142, 69, 73, 33, 216, 200, 61, 158, 110, 124, 184, 25, 253, 217, 239, 154, 193, 163, 77, 164, 183,
-    195, 75, 14, 58, 180, 15, 24, 227, 129, 93, 119, 31, 195, 208, 252, 147, 178, 246, 13, 152, 80, 14, 178, 223, 190,
-    254, 175, 196, 212, 220, 147, 46, 62, 54, 197, 156, 38, 15, 199, 232, 66, 145, 174, 142, 170, 251, 187, 37, 217,
-    144, 167, 118, 29, 108, 55, 111, 235, 72, 159, 117, 110, 12, 192, 155, 5, 13, 125, 162, 249, 231, 7, 155, 173, 218,
-    4, 207, 253, 4, 221, 40, 130, 125, 180, 185, 90, 62, 199, 62, 59, 20, 30, 211, 145, 223, 255, 254, 91, 220, 22, 125,
-    142, 144, 197, 212, 197, 168, 34, 30, 246, 185, 136, 38, 60, 67, 214, 240, 249, 9, 212, 60, 175, 130, 196, 102, 131,
-    68, 76, 226, 85, 9, 143, 76, 6, 42, 240, 21, 203, 236, 138, 157, 220, 40, 114, 93, 124, 226, 199, 3, 167, 86, 22,
-    117, 216, 3, 60, 9, 177, 221, 154, 251, 30, 225, 239, 129, 78, 141, 65, 0, 146, 217, 92, 78, 224, 26, 106, 183, 101,
-    241, 21, 13, 28, 164, 151, 65, 232, 243, 193, 195, 5, 183, 189, 144, 227, 191, 53, 49, 255, 127, 104, 132, 114, 124,
-    86, 72, 16, 105, 214, 36, 89, 201, 84, 48, 80, 32, 58, 172, 99, 68, 7, 43, 12, 141, 198, 13, 73, 188, 62, 149, 201,
-    43, 23, 186, 104, 100, 12, 3, 21, 255, 195, 159, 66, 122, 103, 255, 12, 97, 193, 172, 196, 21, 19, 205, 50, 3, 116,
-    250, 149, 137, 156, 250, 212, 174, 108, 49, 162, 160, 213, 68, 162, 181, 150, 219, 222, 116, 151, 4, 36, 155, 236,
-    251, 6, 227, 100, 52, 175, 86, 228, 76, 36, 172, 9, 188, 202, 220, 58, 87, 195, 22, 211, 134, 211, 232, 139, 173, 3,
-    124, 246, 43, 239, 100, 210, 121, 84, 69, 52, 231, 214, 74, 193, 233, 23, 0, 120, 154, 132, 67, 245, 135, 19, 81,
-    74, 146, 249, 164, 142, 243, 23, 25, 113, 0, 39, 10, 47, 7, 83, 91, 239, 9, 68, 194, 9, 31, 66, 55, 167, 156, 188,
-    41, 84, 93, 246, 133, 84, 49, 252, 215, 226, 99, 80, 173, 122, 5, 252, 77, 186, 150, 252, 131, 145, 178, 4, 228, 37,
-    73, 82, 172, 181, 194, 30, 54, 85, 96, 10, 92, 158, 100, 173, 146, 250, 95, 198, 30, 113, 255, 156, 67, 152, 139,
-    69, 13, 118, 104, 100, 105, 107, 204, 135, 77, 15, 80, 123, 113, 84, 5, 229, 65, 62, 139, 36, 107, 228, 108, 93,
-    197, 182, 190, 29, 175, 83, 53, 190, 99, 192, 157, 173, 4, 28, 21, 0, 181, 176, 30, 59, 5, 59, 150, 16, 202, 80,
-    152, 91, 181, 104, 45, 227, 222, 212, 25, 60, 36, 148, 252, 61, 100, 102, 207, 28, 51, 222, 21, 161, 146, 2, 58,
-    255, 202, 172, 141, 60, 197, 162, 15, 42, 204, 63, 255, 126, 45, 87, 46, 158, 114, 152, 120, 165, 159, 174, 197,
-    251, 78, 207, 80, 101, 102, 208, 12, 1, 179, 233, 10, 248, 82, 111, 95, 199, 12, 229, 11, 193, 28, 148, 123, 23, 33,
-    40, 13, 37, 140, 202, 117, 224, 169, 9, 85, 92, 51, 31, 230, 209, 73, 143, 38, 27, 207, 40, 45, 16, 49, 39, 105, 85,
-    240, 83, 68, 57, 206, 131, 12, 162, 192, 212, 168, 213, 233, 205, 252, 151, 133, 201, 72, 48, 165, 178, 110, 47,
-    146, 240, 69, 228, 94, 250, 72, 141, 11, 153, 82, 126, 20, 61, 146, 35, 147, 3, 203, 175, 211, 56, 7, 151, 176, 178,
-    222, 22, 185, 167, 121, 209, 234, 6, 130, 244, 173, 63, 207, 189, 227, 66, 225, 74, 163, 65, 107, 31, 233, 4, 147,
-    232, 126, 244, 120, 188, 142, 124, 0, 90, 10, 11, 210, 1, 219, 90, 168, 162, 140, 75, 13, 115, 111, 222, 175, 228,
-    247, 232, 197, 135, 237, 180, 181, 236, 88, 152, 251, 230, 163, 88, 35, 34, 76, 58, 64, 168, 176, 15, 138, 202, 69,
-    99, 114, 91, 74, 132, 45, 5, 105, 161, 42, 142, 204, 49, 253, 104, 185, 214, 100, 62, 174, 212, 190, 255, 106, 205,
-    248, 224, 75, 189, 99, 77, 159, 68, 112, 155, 116, 214, 19, 229, 108, 67, 142, 194, 209, 175, 157, 26, 34, 188, 40,
-    28, 237, 74, 234, 52, 59, 105, 58, 165, 255, 156, 244, 30, 49, 191, 126, 57, 54, 1, 240, 39, 64, 48, 51, 43, 109,
-    189, 113, 61, 252, 252, 166, 8, 204, 141, 75, 131, 129, 70, 47, 129, 20, 108, 98, 116, 91, 117, 113, 116, 76, 148,
-    133, 131, 11, 43, 145, 94, 27, 92, 223, 39, 91, 223, 109, 201, 81, 216, 222, 44, 210, 56, 84, 58, 27, 52, 14, 22,
-    73, 28, 52, 238, 41, 197, 26, 171, 111, 89, 230, 162, 104, 136, 186, 53, 11, 128, 93, 169, 32, 47, 57, 251, 216, 44,
-    29, 28, 36, 175, 85, 72, 154, 124, 42, 28, 177, 94, 222, 179, 252, 2, 138, 45, 95, 87, 143, 30, 25, 172, 217, 102,
-    86, 49, 246, 97, 6, 206, 99, 155, 55, 57, 102, 59, 17, 112, 114, 97, 123, 191, 47, 243, 240, 228, 100, 188, 94, 20,
-    51, 185, 141, 53, 80, 10, 60, 156, 38, 72, 81, 59, 6, 151, 171, 72, 29, 45, 38, 242, 44, 216, 111, 137, 119, 8, 208,
-    242, 236, 21, 179, 24, 20, 193, 78, 189, 146, 170, 215, 25, 134, 58, 46, 0, 201, 243, 36, 14, 171, 48, 209, 37, 219,
-    83, 18, 119, 97, 22, 124, 149, 56, 41, 37, 245, 106, 89, 19, 167, 101, 178, 216, 8, 60, 64, 174, 90, 208, 10, 148,
-    98, 57, 67, 156, 228, 66, 198, 182, 220, 231, 229, 252, 59, 31, 113, 134, 253, 140, 213, 207, 62, 162, 31, 237, 5,
-    118, 234, 65, 146, 17, 48, 26, 38, 225, 29, 196, 156, 56, 52, 19, 253, 63, 199, 228, 60, 58, 206, 122, 48, 228, 78,
-    171, 91, 204, 7, 153, 250, 228, 131, 95, 106, 172, 151, 7, 204, 145, 214, 226, 52, 250, 71, 217, 232, 105, 34, 244,
-    234, 121, 209, 91, 165, 154, 109, 240, 182, 9, 172, 246, 51, 251, 141, 72, 197, 117, 96, 250, 28, 29, 78, 216, 108,
-    182, 33, 149, 54, 132, 145, 153, 171, 53, 158, 48, 244, 102, 30, 173, 145, 253, 172, 100, 123, 171, 224, 209, 103,
-    118, 124, 133, 15, 207, 162, 90, 119, 180, 130, 115, 100, 246, 163, 67, 179, 32, 156, 23, 236, 253, 102, 124, 222,
-    173, 59, 186, 206, 192, 55, 207, 39, 229, 249, 63, 105, 158, 72, 93, 103, 160, 207, 245, 251, 32, 101, 60, 57, 45,
-    223, 191, 91, 28, 53, 123, 58, 252, 174, 248, 224, 83, 48, 109, 119, 223, 97, 167, 243, 55, 126, 137, 177, 212, 196,
-    81, 17, 163, 86, 46, 214, 170, 59, 75, 29, 176, 43, 231, 159, 192, 14, 250, 249, 127, 217, 30, 99, 214, 50, 253,
-    155, 1, 225, 185, 55, 151, 202, 41, 103, 3, 5, 115, 203, 234, 221, 30, 31, 78, 103, 249, 146, 249, 136, 113, 19,
-    224, 69, 89, 228, 178, 215, 181, 58, 209, 222, 58, 146, 215, 53, 121, 19, 194, 7, 129, 145, 184, 68, 232, 250, 24,
-    1, 111, 191, 104, 228, 114, 74, 242, 17, 96, 229, 0, 192, 31, 100, 127, 225, 146, 252, 89, 225, 168, 147, 91, 227,
-    53, 169, 213, 153, 210, 61, 55, 255, 121, 28, 185, 111, 176, 120, 139, 237, 158, 237, 104, 208, 10, 249, 89, 201,
-    25, 52, 248, 242, 239, 126, 109, 31, 215, 171, 1, 160, 79, 110, 191, 229, 71, 31, 170, 179, 254, 86, 51, 87, 48, 50,
-    46, 48, 129, 241, 251, 111, 239, 207, 111, 0, 218, 86, 219, 209, 72, 51, 254, 37, 95, 42, 19, 72, 233, 236, 46, 123,
-    7, 108, 240, 245, 4, 25, 218, 199, 252, 133, 196, 29, 99, 96, 149, 116, 48, 113, 146, 215, 253, 83, 196, 107, 214,
-    88, 217, 231, 48, 222, 98, 136, 230, 91, 213, 30, 88, 196, 149, 42, 181, 3, 246, 228, 61, 230, 27, 193, 143, 150,
-    79, 62, 173, 236, 165, 195, 176, 54, 90, 13, 141, 64, 0, 70, 186, 202, 115, 223, 3, 98, 249, 85, 86, 190, 123, 168,
-    81, 153, 242, 104, 197, 254, 104, 171, 20, 82, 89, 201, 18, 225, 92, 55, 16, 98, 176, 147, 213, 41, 160, 117, 179,
-    83, 65, 59, 86, 164, 50, 140, 185, 126, 247, 241, 184, 106, 145, 93, 37, 228, 48, 209, 210, 12, 221, 41, 100, 56,
-    110, 98, 165, 16, 145, 226, 162, 10, 27, 207, 156, 36, 235, 75, 255, 177, 48, 254, 118, 169, 184, 69, 133, 23, 122,
-    223, 188, 120, 140, 38, 29, 6, 204, 101, 98, 116, 236, 6, 236, 108, 101, 245, 236, 52, 254, 208, 141, 29, 19, 120,
-    81, 156, 211, 174, 50, 227, 206, 16, 153, 7, 13, 146, 149, 68, 42, 226, 157, 141, 50, 98, 213, 237, 169, 253, 171,
-    111, 189, 252, 40, 203, 138, 236, 221, 55, 86, 90, 230, 161, 190, 217, 159, 209, 151, 237, 1, 128, 223, 18, 212, 44,
-    103, 130, 40, 130, 196, 40, 123, 216, 97, 182, 29, 246, 66, 241, 111, 45, 110, 143, 35, 253, 11, 15, 223, 235, 249,
-    230, 154, 253, 200, 116, 162, 126, 148, 42, 69, 167, 24, 14, 113, 123, 87, 183, 56, 136, 156, 86, 73, 88, 163, 202,
-    112, 151, 18, 171, 28, 246, 111, 147, 163, 202, 59, 159, 132, 12, 25, 46, 67, 230, 107, 254, 29, 187, 173, 59, 61,
-    77, 176, 159, 251, 119, 213, 72, 3, 250, 161, 29, 126, 100, 167, 39, 61, 244, 236, 82, 243, 8, 241, 86, 97, 220,
-    177, 186, 135, 247, 156, 95, 254, 46, 146, 207, 168, 146, 130, 220, 140, 1, 117, 87, 177, 193, 62, 72, 192, 24, 142,
-    216, 255, 201, 191, 121, 23, 251, 65, 180, 98, 117, 175, 193, 208, 121, 22, 14, 12, 118, 65, 68, 123, 187, 195, 54,
-    162, 26, 71, 78, 231, 144, 125, 147, 56, 248, 200, 81, 229, 70, 146, 129, 184, 249, 106, 59, 201, 154, 155, 95, 88,
-    199, 231, 116, 61, 9, 92, 222, 241, 90, 84, 193, 39, 169, 205, 120, 202, 89, 16, 71, 84, 19, 28, 159, 77, 112, 75,
-    138, 80, 126, 121, 164, 253, 101, 204, 72, 22, 119, 191, 12, 100, 26, 231, 224, 73, 244, 210, 203, 77, 17, 104, 25,
-    7, 189, 165, 124, 175, 189, 170, 129, 186, 87, 21, 165, 60, 36, 77, 252, 12, 225, 211, 52, 159, 242, 3, 181, 80, 61,
-    172, 4, 9, 158, 18, 44, 140, 61, 91, 137, 71, 107, 96, 247, 126, 27, 28, 64, 177, 148, 151, 19, 21, 244, 135, 0,
-    183, 89, 254, 241, 20, 99, 157, 141, 130, 28, 9, 243, 251, 3, 101, 234, 104, 176, 65, 62, 143, 234, 103, 205, 233,
-    162, 31, 28, 189, 250, 123, 125, 204, 255, 196, 7, 73, 7, 76, 247, 205, 221, 152, 32, 76, 74, 156, 71, 134, 205,
-    193, 90, 175, 185, 82, 92, 204, 84, 149, 158, 173, 45, 41, 231, 124, 67, 118, 130, 196, 80, 126, 88, 111, 74, 121,
-    74, 66, 114, 201, 245, 251, 144, 101, 126, 135, 37, 0, 101, 135, 53, 250, 105, 34, 41, 51, 249, 233, 213, 240, 59,
-    150, 243, 200, 182, 168, 30, 5, 108, 210, 108, 17, 138, 164, 85, 233, 106, 86, 191, 66, 32, 133, 129, 185, 47, 6,
-    178, 99, 104, 53, 104, 13, 165, 204, 50, 155, 17, 23, 32, 65, 160, 133, 123, 150, 24, 68, 230, 201, 62, 29, 190, 78,
-    212, 141, 188, 239, 114, 86, 153, 84, 143, 241, 223, 36, 161, 179, 52, 52, 117, 192, 251, 248, 193, 130, 225, 217,
-    76, 1, 210, 180, 7, 168, 14, 243, 198, 26, 130, 164, 55, 68, 23, 70, 112, 44, 122, 7, 179, 76, 249, 113, 97, 75,
-    225, 138, 172, 163, 178, 235, 58, 174, 36, 79, 204, 81, 13, 87, 144, 164, 21, 159, 137, 185, 16, 32, 220, 142, 177,
-    78, 132, 49, 123, 129, 155, 48, 82, 166, 26, 114, 255, 27, 20, 254, 2, 32, 251, 248, 17, 196, 36, 222, 19, 69, 177,
-    176, 65, 125, 226, 18, 146, 29, 44, 251, 225, 158, 160, 85, 5, 203, 250, 211, 172, 126, 138, 232, 130, 156, 49, 174,
-    235, 237, 195, 106, 154, 100, 227, 80, 100, 0, 49, 132, 5, 211, 121, 226, 60, 220, 135, 150, 41, 111, 51, 90, 145,
-    190, 136, 220, 31, 49, 151, 97, 177, 74, 94, 114, 89, 127, 48, 53, 141, 63, 234, 42, 56, 85, 170, 27, 3, 200, 226,
-    155, 116, 229, 165, 230, 13, 113, 190, 4, 54, 92, 180, 11, 122, 238, 234, 148, 212, 36, 95, 195, 128, 229, 167, 179,
-    76, 33, 127, 116, 48, 50, 12, 68, 242, 101, 32, 122, 212, 204, 187, 83, 72, 26, 17, 12, 240, 196, 172, 192, 69, 218,
-    55, 55, 79, 131, 128, 158, 254, 44, 130, 135, 74, 252, 88, 84, 191, 51, 224, 129, 208, 218, 38, 216, 70, 82, 152,
-    247, 199, 254, 17, 39, 43, 107, 113, 98, 223, 21, 40, 45, 251, 54, 198, 251, 116, 215, 14, 115, 56, 48, 166, 206,
-    40, 183, 174, 40, 65, 120, 51, 161, 144, 249, 104, 101, 92, 204, 125, 8, 87, 30, 92, 43, 25, 105, 176, 168, 137,
-    211, 105, 138, 53, 25, 203, 156, 19, 143, 154, 12, 66, 54, 109, 121, 111, 213, 63, 211, 170, 12, 53, 220, 80, 107,
-    196, 212, 120, 249, 98, 71, 110, 159, 207, 86, 64, 253, 79, 27, 115, 61, 234, 153, 166, 191, 140, 144, 212, 205,
-    171, 109, 27, 172, 42, 40, 215, 140, 236, 225, 47, 253, 219, 230, 19, 121, 79, 248, 212, 219, 162, 74, 56, 71, 247,
-    58, 78, 3, 35, 188, 39, 63, 145, 160, 153, 97, 250, 140, 24, 126, 186, 110, 21, 11, 133, 127, 53, 243, 148, 110,
-    107, 159, 88, 31, 159, 245, 154, 31, 96, 121, 155, 130, 247, 48, 94, 90, 173, 240, 70, 132, 165, 90, 155, 106, 19,
-    134, 155, 172, 47, 203, 238, 95, 252, 123, 142, 177, 43, 80, 204, 14, 53, 152, 200, 28, 135, 71, 38, 101, 55, 246,
-    172, 113, 121, 19, 109, 116, 247, 133, 94, 216, 54, 204, 47, 20, 169, 255, 142, 21, 81, 73, 168, 160, 185, 126, 213,
-    62, 126, 17, 154, 60, 30, 238, 26, 32, 29, 134, 163, 66, 241, 33, 208, 184, 153, 194, 130, 75, 66, 143, 181, 15, 92,
-    140, 183, 180, 22, 53, 245, 143, 226, 44, 183, 108, 42, 182, 210, 121, 106, 178, 214, 243, 238, 100, 238, 18, 94,
-    118, 168, 37, 136, 182, 206, 110, 147, 134, 156, 12, 244, 172, 25, 10, 83, 193, 150, 47, 196, 119, 160, 211, 62, 32,
-    139, 63, 142, 89, 86, 248, 36, 7, 201, 20, 233, 191, 126, 96, 151, 176, 75, 161, 50, 211, 141, 102, 239, 75, 123,
-    47, 5, 38, 218, 239, 32, 25, 2, 35, 111, 130, 182, 144, 57, 147, 188, 18, 0, 100, 186, 255, 14, 101, 228, 98, 145,
-    147, 111, 50, 164, 88, 79, 84, 255, 25, 60, 117, 154, 181, 44, 79, 199, 22, 18, 18, 5, 3, 195, 69, 210, 168, 199,
-    168, 36, 193, 168, 8, 9, 163, 171, 226, 106, 9, 249, 155, 44, 47, 103, 42, 115, 152, 21, 28, 146, 59, 148, 126, 159,
-    17, 142, 101, 97, 2, 209, 249, 114, 119, 30, 101, 213, 221, 186, 72, 32, 255, 49, 0, 212, 129, 1, 18, 182, 159, 242,
-    84, 234, 236, 184, 229, 52, 232, 40, 157, 255, 41, 34, 75, 86, 16, 110, 54, 25, 118, 165, 138, 231, 204, 227, 114,
-    27, 52, 54, 15, 88, 39, 125, 204, 109, 196, 40, 230, 60, 16, 84, 252, 199, 58, 190, 72, 198, 203, 166, 90, 169, 36,
-    48, 56, 67, 134, 175, 241, 16, 239, 73, 36, 47, 217, 13, 119, 92, 117, 16, 130, 55, 237, 238, 197, 58, 182, 120,
-    136, 153, 19, 173, 105, 86, 31, 84, 96, 26, 133, 163, 130, 231, 224, 54, 42, 238, 30, 65, 190, 79, 186, 20, 41, 79,
-    172, 231, 10, 198, 26, 106, 1, 72, 161, 231, 108, 150, 162, 24, 111, 19, 191, 57, 153, 189, 118, 186, 236, 38, 13,
-    144, 60, 46, 54, 55, 117, 91, 254, 191, 97, 148, 61, 196, 213, 53, 196, 106, 130, 18, 94, 50, 215, 128, 94, 98, 45,
-    82, 213, 15, 193, 177, 168, 16, 253, 172, 248, 153, 184, 93, 36, 126, 255, 160, 240, 215, 185, 89, 240, 86, 214,
-    171, 183, 56, 91, 27, 136, 57, 184, 141, 16, 151, 218, 143, 157, 39, 138, 220, 56, 58, 109, 195, 146, 69, 57, 44,
-    92, 155, 1, 3, 203, 37, 15, 90, 245, 191, 218, 187, 167, 192, 88, 211, 210, 60, 193, 8, 177, 21, 48, 144, 167, 20,
-    122, 188, 9, 64, 217, 135, 166, 220, 117, 9, 12, 28, 148, 161, 48, 171, 118, 246, 26, 23, 135, 189, 214, 10, 195,
-    90, 224, 137, 219, 206, 74, 73, 78, 104, 69, 10, 117, 23, 189, 207, 148, 139, 34, 47, 8, 76, 251, 185, 119, 74, 39,
-    35, 93, 154, 226, 203, 114, 25, 191, 37, 58, 252, 254, 15, 52, 220, 131, 143, 131, 162, 36, 196, 236, 82, 164, 43,
-    247, 47, 211, 196, 185, 3, 33, 159, 125, 15, 230, 180, 244, 134, 202, 4, 105, 163, 207, 58, 71, 218, 95, 227, 51,
-    194, 170, 255, 252, 83, 37, 174, 164, 68, 146, 112, 36, 211, 154, 201, 152, 181, 230, 73, 84, 156, 14, 44, 220, 3,
-    203, 107, 164, 117, 180, 64, 62, 168, 140, 207, 171, 107, 178, 89, 112, 180, 12, 119, 151, 144, 103, 142, 62, 28,
-    52, 231, 12, 47, 26, 254, 77, 111, 162, 193, 75, 73, 128, 95, 129, 89, 61, 198, 73, 199, 228, 102, 130, 165, 73, 44,
-    240, 244, 89, 46, 122, 15, 54, 31, 102, 56, 178, 208, 24, 207, 149, 87, 120, 60, 129, 55, 129, 56, 125, 27, 216,
-    139, 152, 65, 60, 240, 241, 91, 56, 225, 100, 96, 28, 113, 106, 19, 83, 52, 49, 42, 254, 5, 152, 68, 162, 49, 88,
-    251, 135, 59, 51, 70, 97, 62, 25, 101, 146, 105, 28, 202, 23, 25, 125, 168, 235, 138, 251, 110, 89, 22, 91, 221,
-    190, 196, 86, 77, 195, 13, 79, 238, 43, 221, 66, 130, 239, 113, 206, 217, 155, 161, 86, 63, 230, 8, 64, 6, 178, 112,
-    86, 17, 238, 17, 32, 15, 223, 7, 21, 221, 106, 245, 143, 14, 165, 5, 62, 10, 244, 153, 58, 54, 48, 172, 5, 30, 95,
-    143, 32, 197, 58, 111, 217, 14, 200, 151, 74, 112, 153, 111, 214, 35, 176, 112, 185, 254, 4, 79, 49, 46, 179, 227,
-    98, 55, 105, 83, 12, 134, 61, 126, 19, 174, 143, 22, 60, 135, 224, 28, 227, 83, 66, 10, 29, 144, 156, 51, 157, 156,
-    130, 247, 137, 218, 121, 52, 35, 3, 167, 159, 250, 116, 55, 82, 115, 31, 135, 35, 236, 236, 219, 79, 107, 241, 239,
-    95, 75, 233, 1, 43, 242, 2, 192, 77, 200, 76, 187, 88, 85, 254, 97, 43, 70, 165, 91, 142, 26, 37, 43, 231, 172, 50,
-    215, 188, 186, 170, 58, 31, 242, 171, 93, 25, 45, 87, 135, 184, 18, 72, 181, 61, 194, 110, 122, 175, 182, 138, 124,
-    108, 50, 214, 35, 13, 122, 41, 189, 109, 240, 191, 58, 96, 159, 41, 144, 214, 206, 85, 215, 253, 96, 33, 176, 249,
-    115, 138, 183, 74, 144, 166, 150, 188, 76, 77, 45, 124, 107, 173, 76, 205, 117, 231, 113, 87, 122, 56, 22, 243, 108,
-    222, 255, 249, 41, 223, 196, 25, 166, 76, 99, 11, 52, 218, 211, 170, 249, 87, 53, 219, 196, 123, 186, 29, 91, 184,
-    163, 63, 225, 95, 238, 11, 54, 177, 174, 237, 193, 179, 206, 231, 253, 203, 244, 11, 140, 168, 77, 43, 72, 143, 163,
-    211, 46, 50, 77, 104, 33, 101, 162, 20, 33, 98, 240, 113, 1, 74, 65, 54, 84, 37, 215, 185, 92, 63, 0, 84, 64, 231,
-    148, 210, 192, 134, 79, 131, 72, 40, 85, 119, 240, 214, 176, 210, 236, 118, 242, 160, 3, 203, 33, 168, 29, 70, 71,
-    214, 56, 102, 218, 37, 24, 211, 255, 237, 125, 247, 182, 244, 143, 211, 250, 181, 15, 14, 193, 148, 12, 191, 4, 205,
-    224, 161, 111, 32, 40, 122, 182, 212, 78, 86, 19, 156, 187, 246, 181, 253, 84, 27, 202, 219, 218, 13, 4, 149, 181,
-    66, 24, 125, 155, 130, 44, 154, 31, 120, 87, 72, 175, 221, 121, 194, 89, 63, 109, 228, 150, 201, 40, 237, 144, 15,
-    0, 98, 94, 227, 57, 139, 238, 113, 230, 25, 176, 149, 203, 226, 251, 66, 24, 46, 8, 184, 127, 111, 66, 206, 225,
-    139, 122, 9, 91, 11, 44, 17, 191, 159, 249, 136, 122, 62, 242, 232, 200, 29, 119, 139, 101, 120, 165, 14, 76, 178,
-    190, 75, 85, 182, 72, 103, 174, 60, 199, 118, 129, 41, 157, 170, 175, 140, 152, 87, 42, 14, 175, 157, 175, 125, 30,
-    156, 91, 143, 67, 69, 69, 85, 130, 43, 80, 61, 130, 70, 233, 53, 75, 200, 173, 222, 254, 174, 15, 150, 152, 255,
-    183, 15, 20, 2, 172, 146, 192, 15, 141, 157, 103, 89, 133, 182, 178, 238, 188, 226, 85, 126, 104, 248, 37, 197, 197,
-    140, 228, 134, 143, 30, 142, 214, 196, 60, 125, 165, 120, 251, 137, 53, 222, 101, 61, 228, 119, 174, 42, 144, 9,
-    139, 139, 199, 188, 203, 217, 121, 203, 31, 75, 78, 42, 77, 94, 246, 209, 209, 90, 51, 120, 55, 196, 74, 122, 67,
-    45, 172, 248, 52, 243, 67, 22, 170, 77, 59, 165, 178, 252, 203, 239, 88, 74, 196, 65, 195, 228, 104, 218, 86, 85,
-    11, 145, 130, 13, 237, 178, 49, 92, 50, 53, 177, 184, 81, 221, 246, 97, 140, 132, 210, 189, 198, 208, 240, 193, 207,
-    191, 130, 174, 28, 154, 164, 26, 82, 221, 172, 176, 162, 181, 167, 145, 62, 135, 26, 220, 6, 190, 245, 197, 166,
-    233, 27, 137, 164, 136, 132, 234, 103, 238, 74, 150, 148, 40, 73, 134, 131, 182, 12, 221, 142, 45, 177, 2, 225, 17,
-    78, 247, 67, 140, 168, 216, 64, 70, 165, 3, 135, 163, 57, 18, 154, 117, 232, 72, 254, 150, 179, 152, 138, 181, 56,
-    166, 98, 16, 33, 170, 224, 62, 253, 170, 202, 6, 217, 64, 10, 99, 118, 145, 77, 173, 185, 118, 201, 109, 239, 248,
-    134, 49, 70, 143, 102, 0, 16, 165, 125, 178, 238, 188, 242, 13, 191, 156, 157, 175, 30, 179, 63, 190, 125, 125, 136,
-    137, 116, 27, 17, 57, 48, 246, 110, 172, 90, 198, 5, 162, 25, 217, 60, 47, 198, 23, 170, 195, 54, 127, 63, 21, 75,
-    143, 113, 34, 140, 189, 84, 108, 5, 33, 38, 10, 121, 183, 108, 8, 201, 68, 169, 139, 143, 37, 222, 209, 210, 112,
-    92, 97, 114, 92, 103, 172, 215, 245, 53, 107, 29, 4, 226, 216, 136, 88, 66, 55, 153, 160, 26, 33, 6, 170, 72, 203,
-    117, 60, 56, 171, 68, 163, 1, 242, 31, 130, 238, 193, 138, 156, 215, 156, 11, 223, 7, 70, 242, 168, 156, 66, 77, 9,
-    177, 123, 146, 107, 18, 167, 212, 40, 83, 27, 207, 219, 254, 206, 107, 211, 104, 31, 114, 106, 181, 60, 214, 160,
-    213, 248, 28, 231, 246, 239, 29, 48, 237, 213, 69, 169, 193, 126, 234, 160, 245, 157, 230, 118, 186, 120, 161, 251,
-    174, 233, 189, 141, 223, 198, 144, 107, 128, 157, 47, 120, 160, 171, 243, 215, 244, 240, 136, 146, 77, 33, 30, 128,
-    211, 102, 15, 156, 136, 25, 95, 236, 165, 126, 207, 11, 162, 103, 20, 62, 34, 132, 5, 215, 247, 221, 11, 21, 86, 82,
-    116, 250, 252, 72, 15, 55, 46, 111, 196, 95, 208, 220, 59, 3, 163, 69, 38, 181, 251, 108, 83, 53, 137, 177, 137,
-    142, 12, 55, 248, 109, 238, 114, 38, 142, 218, 228, 102, 143, 170, 255, 92, 216, 217, 101, 171, 4, 86, 4, 172, 92,
-    12, 187, 132, 206, 140, 140, 205, 154, 130, 130, 229, 230, 217, 14, 204, 196, 102, 167, 29, 51, 53, 117, 172, 107,
-    140, 199, 140, 71, 219, 155, 149, 202, 127, 219, 16, 224, 82, 185, 18, 222, 88, 250, 84, 85, 186, 29, 198, 239, 204,
-    1, 172, 246, 7, 147, 238, 37, 158, 202, 105, 221, 171, 111, 215, 204, 27, 156, 218, 229, 53, 203, 228, 113, 5, 48,
-    3, 225, 173, 214, 151, 120, 86, 250, 188, 134, 165, 85, 211, 185, 247, 223, 230, 1, 147, 165, 148, 177, 144, 56,
-    104, 166, 230, 178, 230, 40, 159, 143, 250, 62, 169, 201, 164, 225, 41, 109, 218, 161, 110, 230, 97, 34, 95, 156,
-    230, 122, 220, 9, 197, 55, 151, 119, 25, 29, 66, 99, 159, 29, 17, 181, 135, 32, 191, 69, 170, 17, 137, 219, 14, 150,
-    141, 197, 218, 253, 153, 64, 196, 160, 143, 229, 224, 18, 242, 18, 143, 191, 90, 34, 253, 59, 197, 150, 50, 115, 8,
-    26, 91, 86, 151, 225, 119, 227, 206, 30, 146, 38, 145, 64, 236, 89, 148, 102, 86, 132, 177, 95, 198, 210, 192, 82,
-    24, 128, 101, 49, 228, 5, 128, 222, 103, 7, 26, 156, 95, 214, 0, 197, 135, 27, 76, 247, 24, 116, 99, 250, 175, 72,
-    64, 114, 124, 230, 14, 72, 106, 143, 176, 168, 130, 42, 46, 14, 55, 175, 183, 218, 0, 139, 78, 104, 81, 50, 223,
-    165, 109, 5, 40, 168, 243, 171, 237, 24, 108, 59, 217, 244, 29, 138, 42, 9, 122, 140, 31, 61, 139, 121, 62, 110, 38,
-    192, 73, 66, 245, 227, 181, 139, 229, 58, 145, 125, 141, 166, 135, 172, 8, 136, 27, 131, 117, 29, 83, 197, 85, 153,
-    146, 248, 55, 32, 208, 243, 249, 40, 244, 21, 126, 113, 105, 198, 168, 17, 39, 176, 145, 185, 191, 171, 143, 62, 14,
-    229, 129, 84, 51, 245, 253, 22, 59, 100, 36, 212, 173, 117, 83, 250, 161, 197, 137, 74, 183, 145, 25, 197, 85, 201,
-    101, 13, 160, 111, 210, 158, 157, 189, 151, 15, 240, 218, 5, 80, 41, 239, 99, 88, 208, 94, 41, 239, 194, 1, 250,
-    163, 206, 249, 248, 74, 213, 23, 195, 123, 70, 151, 144, 144, 67, 152, 65, 112, 24, 236, 233, 219, 143, 29, 251,
-    166, 128, 206, 7, 107, 93, 103, 161, 236, 209, 66, 249, 64, 246, 242, 215, 177, 129, 147, 187, 224, 90, 109, 57,
-    150, 92, 188, 176, 253, 248, 170, 113, 146, 36, 164, 130, 115, 153, 91, 81, 174, 3, 118, 62, 222, 63, 251, 142, 16,
-    170, 155, 77, 168, 121, 250, 219, 214, 35, 59, 20, 125, 36, 182, 152, 27, 36, 41, 23, 130, 252, 159, 136, 17, 19,
-    134, 243, 1, 185, 15, 247, 159, 191, 34, 1, 219, 23, 100, 225, 219, 142, 220, 205, 119, 249, 198, 176, 90, 43, 217,
-    42, 193, 47, 37, 64, 0, 3, 142, 18, 183, 52, 64, 99, 78, 51, 241, 130, 212, 173, 66, 189, 116, 113, 16, 110, 92,
-    253, 33, 47, 170, 18, 215, 161, 143, 205, 40, 176, 99, 25, 108, 156, 120, 192, 253, 244, 253, 160, 91, 241, 73, 171,
-    22, 159, 61, 202, 47, 177, 180, 197, 193, 17, 166, 95, 3, 165, 223, 24, 53, 210, 70, 117, 105, 221, 75, 125, 136,
-    61, 49, 61, 236, 95, 11, 243, 85, 105, 46, 151, 71, 101, 94, 232, 23, 186, 251, 233, 246, 99, 128, 162, 117, 29, 20,
-    92, 90, 13, 96, 20, 118, 33, 37, 94, 19, 165, 130, 205, 121, 214, 87, 129, 14, 78, 222, 121, 193, 194, 49, 250, 122,
-    166, 67, 34, 218, 147, 29, 24, 38, 79, 156, 34, 171, 253, 250, 82, 138, 35, 218, 175, 36, 168, 64, 156, 77, 111, 91,
-    169, 212, 94, 173, 181, 244, 15, 188, 236, 129, 73, 172, 210, 12, 15, 106, 8, 27, 172, 71, 172, 95, 49, 96, 125,
-    194, 61, 7, 167, 3, 54, 166, 114, 6, 230, 104, 226, 21, 238, 14, 214, 230, 178, 60, 245, 220, 50, 198, 199, 64, 134,
-    246, 118, 114, 59, 172, 241, 93, 116, 91, 31, 239, 199, 132, 245, 16, 100, 41, 22, 201, 120, 178, 242, 21, 7, 54,
-    138, 161, 63, 63, 12, 242, 199, 240, 66, 126, 95, 242, 205, 246, 7, 198, 39, 241, 85, 234, 61, 138, 91, 243, 39,
-    227, 224, 204, 92, 97, 80, 39, 14, 121, 181, 124, 66, 164, 60, 92, 203, 18, 51, 87, 231, 19, 188, 213, 251, 63, 168,
-    11, 164, 136, 84, 160, 28, 108, 79, 21, 197, 244, 213, 223, 118, 19, 119, 150, 232, 90, 148, 170, 15, 217, 211, 161,
-    224, 50, 198, 60, 158, 120, 205, 137, 29, 16, 89, 167, 37, 215, 91, 161, 71, 85, 98, 183, 105, 63, 140, 178, 250,
-    187, 50, 27, 107, 30, 24, 151, 31, 39, 44, 165, 202, 142, 81, 81, 93, 20, 208, 99, 194, 32, 192, 34, 254, 249, 129,
-    17, 59, 55, 254, 220, 192, 221, 236, 127, 152, 6, 119, 42, 32, 69, 121, 229, 217, 238, 138, 47, 62, 195, 255, 172,
-    239, 243, 68, 53, 110, 192, 142, 83, 77, 198, 218, 105, 144, 235, 25, 189, 144, 188, 220, 71, 128, 19, 30, 207, 153,
-    215, 10, 242, 155, 131, 215, 18, 141, 209, 149, 138, 232, 143, 36, 98, 64, 104, 28, 226, 128, 116, 12, 45, 98, 250,
-    143, 252, 239, 41, 189, 41, 32, 163, 195, 154, 194, 165, 246, 103, 43, 21, 22, 182, 48, 90, 115, 160, 104, 172, 213,
-    115, 66, 102, 13, 186, 108, 72, 16, 55, 209, 159, 62, 0, 237, 213, 54, 13, 238, 74, 198, 244, 10, 138, 166, 247,
-    117, 74, 133, 39, 168, 58, 233, 201, 89, 140, 0, 87, 103, 128, 237, 167, 92, 36, 13, 25, 247, 101, 129, 92, 154,
-    178, 7, 0, 226, 74, 7, 220, 63, 186, 71, 11, 242, 153, 142, 150, 116, 202, 225, 193, 64, 71, 125, 219, 204, 94, 198,
-    146, 124, 232, 246, 203, 108, 228, 52, 98, 33, 98, 227, 184, 152, 253, 187, 114, 212, 77, 169, 89, 113, 155, 74,
-    163, 63, 122, 0, 138, 179, 218, 241, 59, 65, 190, 196, 92, 240, 188, 229, 215, 235, 60, 4, 89, 119, 128, 27, 142,
-    137, 119, 66, 197, 126, 107, 233, 248, 164, 166, 181, 141, 254, 244, 71, 74, 43, 106, 72, 1, 80, 117, 25, 94, 17,
-    139, 118, 222, 206, 102, 249, 73, 85, 100, 110, 135, 249, 108, 198, 203, 136, 48, 156, 10, 75, 90, 207, 26, 165, 85,
-    23, 140, 181, 208, 134, 183, 44, 171, 197, 215, 220, 248, 131, 57, 15, 160, 125, 47, 97, 104, 211, 210, 101, 46,
-    229, 97, 60, 220, 57, 31, 92, 116, 112, 5, 212, 97, 84, 4, 61, 4, 75, 107, 141, 98, 141, 158, 136, 121, 142, 46,
-    153, 94, 163, 171, 136, 15, 15, 252, 208, 171, 183, 166, 33, 40, 50, 210, 74, 248, 60, 106, 52, 246, 243, 96, 180,
-    197, 114, 21, 32, 10, 117, 109, 62, 72, 153, 8, 225, 245, 160, 68, 244, 31, 69, 26, 6, 22, 172, 163, 251, 178, 48,
-    8, 163, 76, 91, 1, 124, 215, 86, 181, 200, 8, 45, 238, 188, 232, 84, 55, 22, 186, 181, 168, 138, 3, 35, 125, 30,
-    151, 232, 38, 119, 17, 69, 119, 118, 114, 204, 104, 25, 218, 175, 244, 174, 155, 88, 19, 183, 20, 255, 148, 207,
-    186, 19, 154, 73, 57, 165, 49, 253, 7, 144, 12, 15, 68, 82, 146, 214, 31, 169, 143, 48, 13, 62, 5, 100, 98, 3, 216,
-    180, 100, 78, 116, 186, 127, 50, 232, 85, 149, 66, 241, 207, 225, 34, 143, 90, 189, 113, 246, 137, 125, 227, 209,
-    191, 72, 20, 130, 238, 113, 95, 54, 80, 132, 88, 89, 102, 137, 162, 38, 120, 179, 5, 101, 193, 186, 176, 242, 14,
-    240, 51, 53, 8, 189, 36, 240, 21, 64, 110, 28, 77, 220, 5, 78, 212, 237, 187, 21, 119, 236, 142, 127, 18, 66, 228,
-    36, 119, 89, 105, 20, 253, 82, 189, 72, 161, 10, 28, 206, 10, 244, 93, 197, 142, 135, 15, 55, 54, 177, 11, 113, 105,
-    236, 81, 198, 19, 123, 174, 70, 139, 248, 221, 150, 139, 40, 100, 119, 113, 16, 77, 168, 144, 146, 176, 227, 104,
-    227, 17, 205, 120, 105, 149, 45, 202, 225, 114, 61, 0, 237, 183, 115, 10, 50, 206, 110, 183, 121, 110, 234, 182, 85,
-    183, 54, 166, 136, 59, 30, 232, 147, 20, 69, 140, 240, 57, 53, 144, 172, 162, 11, 37, 192, 7, 18, 216, 107, 4, 159,
-    33, 91, 32, 146, 145, 22, 17, 151, 210, 250, 196, 49, 131, 10, 129, 110, 148, 56, 102, 189, 67, 223, 53, 173, 97,
-    80, 245, 229, 76, 140, 16, 80, 102, 84, 85, 69, 253, 122, 35, 10, 254, 129, 19, 164, 84, 91, 6, 139, 182, 230, 139,
-    198, 53, 90, 77, 181, 90, 219, 149, 99, 94, 96, 18, 245, 163, 39, 223, 177, 173, 146, 16, 246, 203, 248, 139, 75,
-    176, 204, 244, 28, 73, 172, 58, 188, 216, 184, 232, 75, 19, 180, 17, 250, 146, 111, 180, 151, 56, 254, 237, 149,
-    109, 79, 70, 155, 40, 157, 112, 226, 102, 109, 170, 150, 132, 138, 59, 80, 166, 156, 30, 234, 66, 25, 105, 196, 7,
-    185, 51, 231, 110, 180, 11, 127, 122, 237, 222, 198, 222, 113, 50, 196, 221, 170, 208, 130, 188, 10, 223, 84, 183,
-    189, 98, 216, 186, 91, 10, 253, 173, 175, 242, 97, 84, 22, 14, 95, 241, 177, 37, 53, 66, 170, 49, 135, 145, 7, 188,
-    43, 233, 145, 40, 27, 2, 114, 202, 35, 42, 117, 204, 53, 166, 95, 246, 229, 195, 181, 223, 246, 113, 84, 61, 252,
-    85, 43, 194, 197, 226, 105, 201, 245, 76, 80, 238, 186, 67, 136, 235, 66, 66, 86, 197, 43, 192, 89, 118, 255, 182,
-    127, 28, 67, 113, 9, 11, 116, 95, 244, 202, 19, 98, 93, 14, 67, 235, 98, 11, 54, 223, 161, 100, 226, 236, 150, 96,
-    148, 220, 6, 144, 169, 183, 45, 77, 246, 255, 114, 205, 83, 65, 239, 152, 5, 119, 134, 96, 58, 5, 105, 240, 122,
-    160, 100, 0, 207, 180, 169, 126, 130, 158, 1, 137, 108, 80, 111, 80, 104, 82, 5, 193, 101, 32, 22, 179, 153, 28, 99,
-    229, 219, 223, 155, 19, 49, 33, 248, 18, 16, 134, 71, 189, 151, 2, 147, 150, 142, 100, 22, 26, 215, 96, 50, 152, 25,
-    208, 34, 95, 107, 192, 178, 209, 154, 101, 30, 167, 45, 202, 121, 167, 122, 88, 92, 209, 149, 184, 180, 168, 24, 4,
-    178, 31, 195, 179, 233, 82, 90, 240, 10, 176, 75, 10, 75, 242, 66, 9, 195, 41, 254, 205, 155, 71, 7, 41, 200, 121,
-    250, 116, 78, 215, 36, 60, 11, 168, 5, 39, 219, 82, 161, 108, 167, 36, 40, 32, 59, 139, 6, 217, 233, 183, 157, 242,
-    64, 19, 136, 74, 133, 27, 73, 12, 124, 183, 174, 169, 77, 230, 70, 164, 60, 196, 9, 39, 49, 217, 96, 190, 171, 182,
-    118, 136, 178, 253, 196, 191, 191, 61, 171, 190, 19, 158, 89, 91, 20, 123, 218, 166, 30, 207, 67, 241, 158, 195,
-    109, 136, 114, 120, 231, 179, 158, 155, 128, 229, 50, 54, 67, 28, 226, 132, 120, 240, 152, 63, 44, 173, 230, 26,
-    227, 60, 14, 112, 97, 106, 241, 201, 95, 114, 49, 210, 104, 132, 119, 147, 16, 171, 9, 2, 210, 195, 55, 42, 52, 120,
-    53, 73, 25, 71, 100, 25, 53, 81, 175, 228, 151, 68, 147, 121, 238, 85, 123, 34, 54, 154, 176, 89, 166, 6, 44, 47, 8,
-    246, 248, 213, 17, 217, 65, 3, 10, 101, 228, 125, 158, 135, 15, 184, 173, 27, 127, 167, 55, 232, 224, 153, 251, 91,
-    152, 232, 176, 2, 111, 186, 167, 58, 42, 137, 132, 95, 23, 205, 88, 180, 106, 25, 201, 56, 125, 200, 73, 197, 110,
-    141, 100, 1, 5, 254, 235, 197, 1, 232, 68, 112, 219, 139, 68, 217, 155, 139, 177, 226, 14, 55, 204, 176, 69, 206,
-    155, 204, 108, 171, 253, 196, 170, 37, 226, 235, 202, 90, 36, 170, 75, 3, 104, 55, 234, 2, 104, 209, 142, 83, 12,
-    95, 216, 199, 59, 242, 74, 7, 186, 137, 84, 222, 33, 134, 238, 98, 1, 159, 77, 157, 24, 243, 75, 91, 250, 159, 15,
-    46, 203, 179, 94, 18, 218, 212, 119, 30, 216, 215, 242, 123, 51, 52, 149, 206, 192, 132, 0, 133, 233, 154, 28, 118,
-    91, 90, 157, 120, 128, 178, 208, 240, 198, 215, 58, 141, 69, 161, 48, 120, 89, 86, 219, 170, 181, 133, 196, 211,
-    138, 8, 17, 121, 8, 218, 167, 166, 118, 32, 171, 31, 26, 211, 249, 95, 55, 58, 194, 30, 68, 234, 186, 127, 63, 122,
-    64, 221, 99, 98, 131, 98, 68, 32, 86, 73, 124, 135, 4, 147, 234, 143, 140, 42, 238, 195, 40, 139, 94, 210, 85, 131,
-    66, 131, 16, 226, 104, 229, 68, 155, 136, 206, 65, 90, 195, 69, 212, 26, 211, 247, 241, 77, 46, 56, 103, 103, 224,
-    66, 160, 245, 112, 203, 192, 155, 236, 112, 198, 53, 115, 194, 185, 193, 207, 81, 216, 57, 101, 103, 20, 130, 52,
-    243, 110, 99, 129, 94, 122, 3, 141, 191, 47, 109, 117, 88, 200, 122, 35, 247, 212, 255, 191, 197, 209, 116, 246,
-    112, 196, 125, 39, 146, 78, 164, 44, 24, 119, 126, 118, 155, 13, 136, 118, 16, 221, 98, 223, 177, 21, 125, 90, 199,
-    201, 252, 235, 143, 64, 24, 137, 178, 242, 20, 202, 90, 63, 3, 124, 33, 149, 88, 207, 200, 187, 73, 188, 11, 84, 23,
-    52, 7, 224, 20, 200, 29, 21, 20, 46, 223, 174, 189, 39, 203, 229, 188, 130, 159, 100, 15, 150, 158, 66, 136, 70, 28,
-    2, 253, 143, 101, 54, 133, 243, 120, 74, 154, 227, 200, 119, 131, 197, 196, 26, 157, 255, 150, 197, 55, 158, 145,
-    196, 232, 70, 36, 160, 192, 236, 139, 245, 160, 38, 89, 35, 196, 32, 255, 239, 166, 221, 132, 178, 226, 106, 222, 5,
-    227, 153, 47, 97, 210, 112, 193, 15, 234, 167, 160, 174, 216, 108, 82, 234, 112, 168, 208, 151, 189, 237, 169, 215,
-    66, 39, 52, 8, 16, 68, 27, 140, 15, 197, 13, 192, 81, 207, 205, 129, 110, 242, 151, 131, 11, 237, 111, 24, 240, 242,
-    152, 99, 241, 47, 196, 12, 72, 148, 238, 90, 108, 111, 88, 159, 45, 180, 49, 227, 35, 88, 201, 119, 149, 176, 20,
-    183, 128, 162, 202, 187, 12, 96, 70, 21, 43, 127, 108, 206, 159, 240, 158, 23, 40, 145, 62, 66, 214, 6, 107, 98,
-    190, 96, 1, 105, 174, 73, 253, 214, 192, 250, 114, 249, 209, 82, 42, 166, 11, 26, 132, 92, 136, 21, 108, 203, 193,
-    20, 189, 224, 95, 47, 76, 184, 222, 75, 81, 229, 195, 171, 200, 124, 126, 245, 223, 117, 214, 206, 144, 224, 103,
-    16, 80, 151, 205, 37, 193, 178, 245, 116, 135, 134, 85, 35, 112, 68, 65, 206, 215, 250, 250, 79, 83, 246, 3, 115,
-    222, 239, 142, 236, 163, 118, 143, 29, 187, 68, 201, 183, 157, 116, 103, 152, 82, 225, 176, 200, 62, 199, 222, 134,
-    60, 107, 235, 247, 2, 71, 72, 70, 131, 115, 248, 161, 88, 116, 240, 39, 198, 139, 59, 78, 160, 197, 97, 224, 77,
-    166, 35, 239, 1, 198, 18, 33, 88, 34, 59, 97, 19, 182, 47, 26, 178, 15, 233, 201, 1, 231, 113, 94, 230, 4, 176, 237,
-    15, 101, 215, 62, 150, 32, 58, 241, 166, 211, 225, 97, 59, 28, 224, 168, 251, 8, 189, 240, 90, 122, 81, 243, 233,
-    94, 0, 120, 247, 0, 27, 33, 201, 63, 171, 119, 142, 236, 222, 123, 153, 165, 2, 139, 160, 77, 230, 127, 167, 34,
-    250, 88, 6, 216, 138, 248, 116, 160, 14, 80, 81, 163, 96, 210, 205, 145, 17, 159, 243, 176, 167, 248, 92, 194, 148,
-    195, 99, 229, 9, 145, 131, 19, 195, 69, 196, 9, 123, 22, 253, 43, 69, 183, 126, 215, 148, 197, 123, 226, 203, 148,
-    216, 213, 89, 222, 193, 8, 236, 33, 234, 221, 108, 110, 1, 93, 143, 24, 115, 173, 141, 129, 183, 28, 163, 52, 69,
-    176, 166, 98, 202, 200, 55, 181, 144, 148, 161, 118, 236, 59, 81, 201, 145, 38, 183, 165, 111, 236, 28, 73, 136, 85,
-    251, 6, 225, 92, 43, 122, 149, 148, 90, 124, 145, 21, 51, 202, 56, 84, 96, 14, 99, 15, 41, 108, 86, 103, 193, 148,
-    23, 19, 77, 196, 191, 88, 163, 3, 34, 14, 203, 72, 50, 190, 57, 219, 33, 166, 125, 231, 168, 216, 42, 208, 225, 237,
-    168, 132, 252, 136, 11, 68, 228, 167, 60, 25, 55, 149, 109, 196, 75, 94, 155, 236, 64, 185, 50, 215, 6, 100, 46,
-    253, 165, 198, 251, 22, 6, 102, 22, 172, 129, 66, 137, 169, 107, 214, 149, 118, 98, 28, 136, 250, 51, 226, 133, 172,
-    184, 190, 46, 34, 160, 91, 191, 98, 179, 181, 64, 8, 60, 97, 0, 81, 163, 17, 28, 234, 68, 251, 40, 108, 83, 114,
-    138, 104, 28, 90, 229, 146, 191, 114, 42, 232, 72, 65, 45, 38, 167, 92, 239, 196, 154, 15, 88, 107, 246, 221, 125,
-    134, 85, 143, 255, 239, 206, 165, 57, 129, 39, 204, 255, 0, 253, 196, 89, 121, 221, 188, 229, 120, 21, 137, 105, 40,
-    217, 220, 15, 240, 4, 99, 184, 161, 80, 150, 109, 159, 191, 181, 122, 55, 168, 87, 244, 47, 200, 156, 110, 87, 254,
-    151, 245, 192, 25, 79, 171, 232, 82, 192, 127, 223, 155, 110, 125, 250, 201, 63, 45, 246, 24, 140, 185, 191, 97, 71,
-    116, 148, 179, 67, 240, 234, 130, 58, 60, 242, 142, 196, 97, 148, 16, 186, 189, 247, 113, 107, 76, 87, 251, 183, 20,
-    202, 29, 193, 78, 47, 96, 114, 195, 182, 130, 53, 195, 114, 184, 127, 98, 107, 210, 46, 211, 207, 54, 223, 161, 160,
-    173, 181, 72, 125, 62, 2, 249, 68, 127, 118, 87, 176, 215, 220, 20, 178, 184, 240, 59, 88, 6, 182, 18, 44, 110, 174,
-    148, 231, 198, 134, 159, 149, 19, 30, 254, 84, 124, 160, 210, 143, 202, 130, 248, 204, 10, 69, 189, 201, 47, 90, 47,
-    233, 15, 215, 205, 184, 162, 36, 32, 9, 89, 115, 52, 203, 124, 125, 2, 105, 102, 157, 31, 17, 231, 98, 218, 248, 43,
-    215, 171, 165, 223, 246, 216, 159, 171, 173, 50, 22, 110, 227, 109, 66, 153, 11, 146, 133, 229, 199, 54, 23, 153,
-    58, 105, 87, 118, 180, 157, 56, 29, 174, 69, 35, 229, 239, 104, 94, 53, 211, 49, 29, 19, 79, 247, 221, 199, 190,
-    130, 189, 188, 117, 191, 253, 49, 58, 117, 122, 103, 57, 189, 111, 252, 0, 110, 146, 178, 58, 169, 47, 243, 112,
-    133, 101, 52, 89, 127, 29, 202, 18, 203, 193, 89, 192, 164, 255, 7, 244, 235, 46, 78, 59, 240, 18, 31, 22, 241, 95,
-    203, 246, 77, 94, 171, 229, 20, 236, 229, 220, 98, 186, 97, 89, 62, 186, 62, 35, 12, 110, 208, 195, 188, 8, 172, 10,
-    90, 39, 4, 90, 171, 50, 248, 13, 187, 143, 69, 29, 31, 43, 65, 59, 175, 125, 35, 183, 42, 138, 187, 47, 52, 148,
-    153, 124, 29, 138, 196, 80, 156, 237, 232, 75, 55, 239, 128, 106, 20, 185, 120, 183, 122, 196, 33, 48, 43, 193, 196,
-    232, 224, 188, 233, 2, 202, 32, 199, 124, 115, 11, 190, 96, 42, 211, 34, 112, 192, 82, 33, 27, 116, 4, 219, 224, 16,
-    118, 209, 189, 3, 161, 188, 195, 177, 67, 98, 162, 51, 55, 61, 44, 135, 183, 164, 145, 13, 38, 43, 91, 11, 208, 62,
-    127, 215, 205, 27, 39, 12, 102, 122, 51, 134, 68, 27, 152, 215, 106, 245, 227, 98, 89, 151, 111, 242, 14, 157, 21,
-    201, 1, 85, 210, 169, 42, 250, 254, 105, 148, 139, 221, 4, 118, 230, 157, 173, 55, 120, 129, 60, 46, 68, 100, 166,
-    227, 73, 246, 12, 145, 195, 165, 226, 50, 241, 60, 166, 48, 29, 199, 21, 162, 182, 101, 39, 211, 119, 85, 74, 199,
-    135, 77, 237, 203, 184, 34, 25, 250, 159, 190, 138, 115, 176, 170, 193, 58, 129, 143, 146, 23, 42, 107, 217, 181,
-    91, 180, 12, 14, 93, 177, 50, 56, 158, 72, 185, 50, 18, 174, 50, 122, 82, 121, 164, 120, 31, 166, 15, 90, 51, 231,
-    105, 228, 143, 29, 52, 173, 98, 142, 39, 199, 198, 17, 92, 37, 44, 160, 161, 110, 135, 146, 111, 108, 250, 228, 133,
-    145, 195, 67, 41, 142, 24, 101, 22, 173, 62, 216, 57, 89, 225, 17, 122, 125, 101, 222, 139, 139, 125, 13, 58, 116,
-    32, 238, 208, 191, 174, 147, 244, 98, 219, 237, 74, 27, 126, 83, 26, 228, 195, 112, 205, 100, 48, 88, 58, 226, 238,
-    8, 253, 152, 175, 100, 168, 198, 149, 163, 155, 222, 241, 246, 224, 0, 37, 93, 47, 8, 103, 166, 144, 8, 202, 227, 4,
-    165, 136, 224, 37, 186, 57, 2, 141, 154, 39, 28, 108, 101, 242, 144, 27, 101, 247, 55, 129, 131, 15, 212, 248, 36,
-    36, 45, 67, 145, 244, 44, 147, 240, 254, 121, 144, 231, 32, 72, 19, 226, 16, 176, 113, 92, 134, 130, 197, 38, 235,
-    218, 9, 167, 172, 13, 173, 2, 120, 204, 63, 136, 161, 198, 243, 103, 197, 49, 201, 174, 46, 234, 38, 194, 104, 133,
-    105, 185, 93, 250, 38, 125, 44, 133, 53, 226, 130, 114, 57, 144, 57, 79, 80, 1, 212, 228, 205, 160, 126, 192, 154,
-    24, 62, 139, 54, 191, 63, 86, 175, 150, 203, 2, 1, 64, 58, 83, 222, 82, 225, 24, 21, 160, 111, 39, 212, 136, 76,
-    235, 5, 237, 74, 54, 102, 157, 175, 80, 212, 151, 4, 145, 184, 53, 39, 160, 233, 192, 148, 198, 46, 102, 13, 182,
-    38, 99, 104, 85, 91, 219, 250, 205, 102, 52, 217, 119, 11, 49, 208, 25, 89, 32, 255, 34, 162, 152, 133, 154, 209,
-    78, 0, 13, 76, 13, 125, 77, 192, 76, 196, 64, 222, 162, 105, 111, 239, 185, 247, 90, 91, 118, 246, 166, 220, 28,
-    246, 16, 183, 8, 220, 88, 19, 139, 160, 17, 225, 8, 232, 252, 91, 4, 47, 117, 164, 206, 85, 147, 151, 45, 163, 247,
-    117, 250, 93, 149, 20, 210, 110, 166, 188, 77, 133, 64, 101, 203, 13, 32, 11, 234, 105, 41, 211, 84, 175, 104, 142,
-    110, 3, 238, 120, 41, 6, 207, 66, 49, 226, 47, 219, 182, 30, 34, 241, 129, 238, 28, 102, 230, 39, 147, 17, 220, 236,
-    101, 220, 191, 5, 57, 119, 101, 190, 61, 242, 187, 98, 9, 74, 100, 217, 129, 232, 95, 242, 9, 223, 187, 193, 32, 61,
-    69, 109, 178, 140, 102, 184, 108, 190, 207, 56, 62, 123, 20, 191, 46, 143, 112, 168, 108, 233, 29, 9, 255, 130, 59,
-    96, 190, 20, 234, 217, 110, 249, 238, 42, 86, 166, 111, 35, 172, 51, 26, 177, 29, 70, 183, 251, 202, 153, 166, 35,
-    212, 23, 67, 116, 252, 0, 211, 109, 141, 92, 2, 100, 137, 1, 87, 71, 140, 192, 103, 37, 255, 215, 205, 155, 201,
-    110, 62, 16, 192, 57, 128, 162, 196, 158, 190, 152, 209, 32, 219, 24, 162, 144, 234, 227, 117, 230, 100, 42, 221,
-    210, 42, 177, 131, 213, 6, 249, 120, 45, 156, 130, 164, 135, 129, 77, 250, 142, 217, 11, 176, 107, 12, 2, 39, 197,
-    184, 120, 94, 119, 150, 243, 176, 86, 131, 238, 59, 35, 204, 250, 248, 108, 54, 15, 152, 63, 150, 53, 138, 31, 195,
-    90, 79, 117, 84, 90, 131, 33, 210, 87, 51, 206, 148, 243, 199, 73, 229, 72, 116, 45, 28, 3, 204, 29, 47, 207, 65,
-    255, 255, 11, 246, 36, 202, 181, 112, 0, 205, 235, 245, 49, 77, 75, 29, 71, 254, 193, 122, 202, 155, 90, 245, 115,
-    92, 76, 163, 127, 179, 105, 120, 238, 61, 33, 31, 97, 110, 185, 65, 55, 181, 79, 189, 47, 173, 96, 64, 183, 61, 245,
-    71, 99, 114, 110, 252, 108, 39, 20, 250, 176, 29, 1, 229, 188, 66, 190, 190, 13, 126, 146, 120, 191, 104, 197, 128,
-    30, 156, 155, 5, 244, 231, 52, 165, 45, 53, 111, 240, 77, 174, 176, 116, 150, 0, 233, 130, 214, 162, 96, 59, 72, 31,
-    181, 112, 66, 57, 207, 6, 143, 6, 63, 135, 230, 81, 122, 110, 209, 99, 63, 162, 103, 204, 238, 96, 30, 197, 75, 46,
-    80, 137, 251, 250, 54, 228, 167, 128, 162, 129, 194, 44, 226, 0, 212, 127, 211, 243, 116, 105, 159, 116, 188, 215,
-    37, 109, 90, 157, 220, 227, 89, 20, 111, 82, 219, 50, 140, 55, 43, 199, 231, 127, 169, 202, 226, 66, 148, 185, 202,
-    247, 76, 66, 92, 98, 210, 222, 207, 61, 0, 249, 47, 0, 151, 171, 62, 44, 16, 202, 222, 107, 184, 222, 217, 86, 187,
-    178, 88, 129, 59, 158, 167, 73, 42, 191, 103, 177, 211, 251, 20, 54, 196, 85, 147, 115, 79, 36, 98, 228, 133, 184,
-    185, 144, 146, 96, 132, 21, 142, 172, 140, 244, 255, 115, 115, 44, 34, 164, 126, 232, 23, 116, 126, 24, 0, 77, 163,
-    127, 148, 39, 212, 125, 29, 11, 204, 108, 15, 160, 82, 81, 240, 152, 5, 91, 234, 122, 29, 209, 163, 167, 175, 183,
-    77, 48, 237, 128, 208, 170, 159, 227, 137, 138, 1, 69, 28, 45, 234, 158, 119, 7, 224, 68, 165, 76, 30, 50, 159, 170,
-    66, 112, 157, 176, 20, 127, 68, 227, 229, 20, 97, 78, 5, 138, 121, 4, 47, 196, 8, 207, 253, 97, 170, 32, 217, 241,
-    59, 218, 226, 41, 17, 218, 35, 20, 15, 27, 79, 8, 156, 122, 73, 43, 213, 147, 180, 207, 97, 14, 95, 174, 47, 187,
-    108, 15, 37, 191, 239, 110, 113, 9, 54, 87, 9, 237, 58, 221, 233, 209, 65, 29, 84, 12, 199, 242, 182, 122, 162, 75,
-    215, 76, 208, 16, 245, 157, 52, 204, 202, 104, 129, 214, 87, 81, 168, 211, 4, 58, 66, 96, 223, 171, 60, 110, 15,
-    241, 185, 190, 225, 142, 75, 61, 115, 70, 10, 43, 0, 255, 148, 187, 19, 193, 253, 224, 39, 101, 65, 237, 144, 78,
-    50, 213, 156, 86, 214, 51, 69, 222, 66, 68, 93, 9, 19, 110, 170, 226, 24, 232, 169, 253, 26, 25, 17, 65, 30, 231,
-    56, 170, 213, 12, 242, 236, 225, 225, 193, 107, 153, 161, 222, 228, 207, 169, 191, 239, 219, 200, 165, 172, 32, 43,
-    10, 2, 46, 227, 218, 37, 129, 45, 89, 36, 102, 95, 139, 110, 69, 131, 90, 254, 151, 36, 48, 35, 135, 28, 106, 63,
-    214, 233, 216, 66, 3, 190, 119, 236, 171, 82, 30, 195, 85, 220, 123, 204, 50, 77, 187, 26, 72, 250, 240, 197, 108,
-    177, 75, 197, 255, 184, 79, 99, 179, 39, 17, 58, 61, 186, 189, 139, 60, 148, 25, 199, 133, 4, 13, 206, 45, 68, 163,
-    214, 172, 230, 181, 145, 81, 59, 208, 16, 86, 195, 193, 11, 17, 65, 226, 219, 76, 93, 210, 74, 30, 242, 147, 187, 1,
-    88, 92, 48, 149, 185, 211, 54, 182, 216, 192, 50, 113, 144, 162, 162, 209, 114, 239, 147, 242, 114, 215, 62, 24,
-    221, 229, 129, 174, 96, 153, 245, 214, 167, 250, 65, 164, 177, 62, 149, 239, 16, 200, 130, 134, 143, 25, 9, 135, 88,
-    155, 61, 111, 226, 14, 155, 99, 2, 88, 177, 206, 100, 212, 249, 103, 106, 218, 118, 109, 36, 115, 93, 60, 93, 170,
-    211, 6, 8, 24, 145, 165, 226, 153, 17, 217, 172, 171, 74, 250, 5, 81, 73, 164, 48, 49, 227, 176, 142, 249, 245, 96,
-    160, 208, 58, 143, 242, 158, 20, 205, 167, 152, 250, 0, 114, 157, 61, 237, 179, 6, 3, 20, 165, 10, 157, 200, 54, 82,
-    121, 89, 211, 157, 44, 149, 244, 123, 104, 159, 31, 255, 202, 13, 18, 120, 217, 66, 20, 255, 120, 134, 28, 210, 210,
-    17, 84, 66, 111, 220, 18, 17, 74, 182, 60, 22, 132, 20, 138, 185, 101, 27, 1, 151, 193, 11, 77, 51, 199, 77, 99, 23,
-    122, 217, 62, 209, 208, 168, 40, 214, 214, 188, 62, 125, 172, 17, 25, 33, 108, 105, 30, 19, 112, 214, 2, 238, 198,
-    36, 103, 64, 187, 253, 171, 6, 96, 58, 37, 197, 189, 152, 119, 199, 87, 198, 49, 204, 89, 123, 120, 161, 232, 231,
-    115, 185, 200, 186, 92, 188, 153, 139, 242, 97, 145, 32, 18, 14, 180, 20, 155, 190, 183, 75, 223, 65, 105, 50, 164,
-    32, 43, 23, 174, 45, 78, 87, 113, 233, 105, 66, 0, 128, 253, 153, 254, 145, 170, 26, 74, 236, 201, 202, 212, 217,
-    231, 9, 224, 58, 213, 125, 52, 198, 35, 207, 183, 15, 50, 1, 168, 13, 112, 188, 234, 46, 197, 190, 201, 100, 132,
-    207, 121, 137, 19, 117, 60, 192, 177, 169, 50, 166, 155, 229, 34, 153, 37, 142, 173, 251, 69, 31, 112, 152, 218,
-    162, 170, 201, 113, 49, 212, 154, 9, 70, 231, 178, 96, 192, 242, 117, 139, 96, 20, 229, 243, 142, 1, 23, 215, 230,
-    247, 253, 126, 212, 108, 211, 143, 48, 158, 60, 180, 68, 209, 137, 75, 26, 231, 110, 140, 207, 128, 88, 38, 166,
-    236, 162, 204, 167, 77, 68, 184, 160, 208, 214, 221, 196, 203, 240, 31, 9, 121, 70, 204, 176, 87, 188, 162, 35, 64,
-    225, 228, 194, 194, 25, 34, 69, 217, 92, 10, 162, 17, 59, 233, 82, 227, 26, 114, 72, 248, 86, 186, 247, 39, 143,
-    242, 77, 140, 255, 228, 188, 54, 223, 120, 10, 240, 201, 166, 169, 230, 45, 139, 146, 250, 244, 21, 209, 43, 153,
-    199, 32, 212, 164, 184, 152, 194, 210, 17, 255, 97, 217, 206, 208, 221, 152, 5, 253, 232, 213, 2, 48, 243, 179, 165,
-    16, 40, 120, 44, 234, 232, 54, 158, 203, 47, 52, 195, 55, 172, 92, 140, 5, 253, 190, 39, 179, 157, 103, 217, 20,
-    175, 200, 215, 113, 253, 154, 165, 27, 240, 220, 99, 3, 58, 235, 58, 87, 68, 36, 28, 49, 56, 6, 141, 137, 160, 0,
-    13, 178, 65, 114, 215, 214, 145, 44, 169, 148, 38, 234, 246, 210, 224, 102, 194, 10, 33, 37, 213, 231, 36, 104, 112,
-    153, 136, 133, 115, 229, 66, 197, 68, 229, 235, 245, 209, 171, 12, 116, 137, 169, 221, 167, 13, 163, 22, 223, 166,
-    113, 74, 122, 58, 16, 190, 9, 60, 215, 252, 109, 122, 5, 8, 163, 151, 175, 46, 126, 88, 37, 244, 63, 53, 124, 214,
-    188, 122, 152, 221, 153, 155, 248, 28, 83, 33, 31, 2, 248, 54, 75, 108, 180, 27, 89, 191, 125, 239, 11, 188, 99,
-    120, 16, 21, 233, 207, 13, 182, 39, 153, 14, 158, 120, 61, 180, 35, 218, 164, 150, 186, 124, 5, 36, 74, 241, 12,
-    238, 66, 176, 85, 68, 174, 41, 250, 206, 97, 109, 171, 176, 131, 237, 53, 127, 21, 66, 179, 8, 200, 235, 77, 75,
-    124, 161, 147, 235, 212, 39, 236, 119, 111, 121, 220, 128, 175, 188, 23, 74, 187, 93, 167, 98, 26, 121, 146, 162,
-    69, 203, 58, 0, 34, 252, 70, 71, 164, 92, 162, 37, 59, 44, 250, 94, 186, 54, 113, 150, 93, 199, 178, 198, 241, 140,
-    71, 171, 28, 208, 79, 167, 59, 222, 160, 112, 102, 241, 98, 105, 233, 63, 199, 149, 27, 189, 162, 129, 196, 56, 219,
-    8, 180, 216, 4, 110, 214, 161, 118, 143, 233, 31, 12, 201, 166, 214, 229, 228, 17, 169, 140, 220, 110, 46, 197, 7,
-    79, 141, 6, 133, 107, 204, 123, 127, 97, 65, 103, 140, 125, 86, 123, 196, 36, 171, 182, 22, 196, 195, 54, 7, 151,
-    230, 199, 235, 174, 247, 79, 220, 180, 222, 90, 201, 199, 245, 120, 13, 25, 229, 59, 229, 170, 191, 116, 233, 138,
-    56, 45, 235, 111, 125, 178, 241, 72, 187, 5, 149, 163, 206, 155, 116, 7, 51, 225, 125, 255, 54, 26, 232, 234, 146,
-    120, 79, 36, 198, 183, 153, 229, 210, 143, 92, 142, 0, 36, 192, 45, 12, 197, 209, 80, 231, 168, 110, 89, 144, 254,
-    170, 228, 152, 211, 93, 117, 202, 254, 10, 62, 186, 73, 81, 8, 62, 232, 112, 22, 255, 4, 6, 108, 132, 233, 248, 162,
-    165, 147, 80, 122, 102, 165, 127, 209, 84, 239, 36, 231, 217, 213, 53, 80, 77, 239, 19, 179, 83, 71, 101, 73, 189,
-    61, 125, 3, 123, 190, 75, 166, 238, 140, 249, 135, 37, 83, 239, 58, 166, 79, 47, 169, 228, 40, 129, 65, 160, 203, 8,
-    46, 127, 83, 98, 94, 4, 201, 96, 27, 146, 148, 171, 246, 150, 3, 85, 76, 59, 11, 255, 166, 84, 221, 108, 180, 186,
-    100, 165, 238, 0, 62, 37, 10, 88, 105, 10, 202, 51, 66, 62, 142, 53, 122, 101, 49, 208, 193, 201, 85, 2, 176, 152,
-    90, 50, 33, 6, 130, 31, 31, 104, 214, 42, 93, 13, 48, 119, 177, 201, 212, 40, 242, 15, 174, 47, 248, 18, 114, 228,
-    51, 133, 51, 118, 137, 77, 6, 143, 59, 218, 189, 223, 188, 79, 219, 172, 28, 241, 145, 162, 39, 128, 247, 33, 25,
-    212, 192, 141, 205, 231, 241, 253, 232, 183, 185, 127, 100, 4, 171, 122, 173, 115, 110, 60, 142, 222, 140, 169, 210,
-    170, 12, 31, 158, 61, 171, 100, 177, 102, 11, 89, 54, 138, 170, 131, 235, 90, 105, 103, 6, 69, 231, 61, 166, 135,
-    119, 154, 14, 185, 92, 139, 120, 187, 22, 250, 23, 191, 137, 100, 39, 255, 5, 42, 51, 66, 109, 22, 148, 125, 9, 126,
-    105, 136, 216, 99, 163, 95, 167, 183, 183, 98, 26, 66, 218, 41, 220, 153, 61, 179, 135, 129, 83, 66, 240, 42, 111,
-    220, 1, 121, 34, 82, 150, 250, 162, 113, 248, 205, 10, 66, 64, 69, 93, 81, 134, 235, 185, 23, 234, 51, 173, 194,
-    168, 183, 89, 13, 195, 82, 95, 229, 137, 68, 153, 111, 173, 249, 75, 214, 106, 118, 224, 95, 9, 57, 201, 34, 226,
-    161, 208, 135, 26, 139, 99, 245, 105, 11, 73, 133, 68, 169, 246, 18, 247, 185, 245, 155, 242, 128, 91, 245, 245,
-    176, 86, 215, 120, 99, 18, 0, 68, 217, 188, 42, 184, 239, 143, 152, 169, 211, 189, 87, 180, 152, 160, 147, 216, 131,
-    193, 5, 217, 82, 117, 230, 227, 43, 89, 30, 106, 6, 203, 108, 138, 49, 19, 51, 191, 168, 227, 131, 246, 35, 41, 3,
-    14, 21, 193, 112, 23, 151, 188, 112, 155, 43, 134, 195, 40, 157, 1, 161, 161, 168, 38, 161, 103, 31, 39, 154, 208,
-    184, 12, 97, 165, 92, 49, 194, 13, 168, 71, 71, 203, 188, 184, 249, 239, 65, 123, 181, 34, 159, 84, 118, 181, 148,
-    64, 29, 18, 156, 225, 161, 111, 237, 126, 250, 121, 17, 6, 160, 47, 6, 40, 187, 150, 147, 117, 21, 124, 190, 238,
-    135, 146, 18, 195, 179, 175, 20, 48, 26, 161, 219, 165, 0, 189, 26, 85, 225, 179, 61, 244, 201, 135, 206, 112, 62,
-    34, 229, 162, 116, 158, 58, 177, 179, 126, 105, 185, 93, 76, 231, 238, 3, 83, 30, 116, 90, 77, 220, 117, 135, 247,
-    174, 191, 75, 225, 134, 83, 46, 110, 120, 95, 97, 181, 202, 144, 125, 14, 31, 102, 56, 190, 157, 242, 130, 95, 105,
-    155, 224, 197, 68, 168, 24, 220, 129, 121, 96, 43, 190, 190, 221, 164, 7, 10, 194, 188, 208, 99, 68, 12, 227, 24,
-    250, 109, 111, 107, 153, 209, 248, 2, 237, 204, 100, 209, 2, 69, 184, 171, 188, 122, 161, 105, 192, 189, 234, 99,
-    99, 122, 15, 51, 164, 236, 112, 39, 103, 59, 197, 217, 31, 139, 27, 210, 105, 227, 163, 41, 23, 245, 238, 102, 57,
-    163, 93, 153, 247, 19, 106, 94, 91, 168, 119, 199, 48, 12, 117, 169, 209, 126, 179, 24, 11, 3, 103, 153, 45, 32, 37,
-    25, 164, 18, 248, 219, 172, 168, 126, 165, 86, 77, 98, 209, 111, 6, 55, 130, 146, 105, 25, 184, 75, 245, 52, 134,
-    139, 252, 149, 191, 19, 197, 203, 27, 81, 78, 227, 179, 25, 41, 147, 131, 142, 125, 57, 64, 95, 247, 175, 72, 70,
-    25, 86, 85, 190, 92, 214, 27, 62, 221, 164, 39, 240, 130, 62, 179, 64, 226, 192, 72, 55, 170, 81, 193, 123, 44, 200,
-    17, 156, 152, 247, 43, 28, 61, 31, 91, 251, 115, 249, 16, 232, 153, 189, 228, 240, 39, 253, 174, 212, 121, 223, 81,
-    67, 120, 66, 151, 70, 116, 165, 232, 83, 196, 108, 25, 88, 15, 166, 93, 247, 77, 20, 10, 183, 225, 113, 93, 34, 241,
-    50, 108, 0, 143, 105, 191, 84, 207, 34, 61, 243, 37, 133, 255, 179, 194, 120, 56, 243, 239, 115, 165, 187, 195, 60,
-    220, 117, 215, 250, 24, 44, 47, 236, 163, 178, 14, 172, 20, 159, 164, 120, 85, 37, 253, 240, 43, 70, 71, 231, 242,
-    84, 254, 85, 75, 3, 54, 232, 212, 0, 59, 63, 213, 177, 179, 248, 190, 41, 115, 139, 116, 147, 213, 141, 2, 23, 41,
-    203, 189, 192, 79, 253, 128, 0, 126, 132, 117, 213, 223, 137, 13, 53, 65, 5, 57, 200, 207, 94, 171, 56, 161, 157,
-    22, 48, 146, 75, 67, 34, 4, 29, 185, 148, 224, 240, 211, 162, 62, 178, 177, 71, 230, 136, 208, 205, 165, 198, 190,
-    3, 253, 232, 145, 21, 194, 151, 31, 201, 111, 161, 168, 38, 240, 170, 35, 106, 39, 176, 122, 60, 115, 82, 56, 76,
-    111, 152, 85, 196, 206, 134, 59, 114, 8, 226, 36, 203, 197, 60, 184, 183, 158, 207, 71, 78, 14, 192, 66, 215, 38,
-    217, 243, 239, 142, 131, 149, 188, 85, 1, 248, 23, 242, 73, 176, 100, 25, 199, 102, 17, 163, 251, 148, 90, 124, 210,
-    210, 84, 221, 106, 135, 46, 176, 209, 163, 254, 219, 124, 184, 192, 92, 159, 184, 50, 48, 76, 120, 19, 36, 0, 202,
-    207, 37, 78, 26, 196, 102, 192, 149, 52, 226, 213, 70, 17, 156, 228, 212, 208, 132, 134, 11, 215, 140, 194, 249,
-    219, 231, 87, 34, 55, 212, 233, 146, 192, 255, 10, 129, 98, 139, 192, 204, 133, 207, 142, 205, 134, 29, 176, 201,
-    227, 182, 35, 44, 119, 31, 246, 192, 10, 94, 107, 39, 62, 127, 100, 138, 90, 22, 131, 87, 98, 251, 5, 226, 176, 153,
-    64, 145, 251, 180, 161, 164, 250, 95, 100, 205, 128, 57, 183, 180, 225, 72, 253, 232, 142, 173, 185, 234, 249, 110,
-    41, 74, 50, 251, 240, 224, 158, 74, 129, 187, 225, 90, 117, 218, 125, 204, 45, 66, 197, 255, 172, 144, 13, 95, 116,
-    222, 140, 74, 124, 48, 58, 205, 138, 228, 124, 73, 201, 128, 28, 18, 104, 133, 40, 112, 30, 70, 161, 32, 211, 229,
-    102, 123, 179, 23, 195, 120, 211, 235, 232, 172, 83, 115, 126, 40, 127, 29, 53, 27, 182, 0, 59, 41, 102, 211, 220,
-    0, 42, 121, 183, 204, 19, 106, 184, 159, 126, 250, 30, 157, 236, 109, 149, 228, 32, 111, 182, 255, 205, 242, 177,
-    114, 62, 116, 242, 32, 82, 140, 33, 42, 173, 184, 29, 84, 97, 15, 81, 108, 120, 81, 24, 244, 228, 252, 70, 19, 6,
-    159, 110, 215, 121, 114, 185, 60, 114, 69, 85, 35, 182, 160, 154, 57, 0, 142, 18, 178, 89, 185, 218, 191, 96, 103,
-    252, 179, 61, 81, 59, 120, 93, 82, 237, 60, 242, 4, 142, 200, 11, 195, 9, 163, 175, 179, 216, 193, 26, 164, 7, 226,
-    89, 210, 67, 249, 38, 200, 211, 69, 85, 131, 234, 183, 185, 181, 166, 184, 146, 71, 61, 65, 251, 250, 119, 30, 129,
-    148, 130, 29, 177, 4, 91, 219, 189, 118, 193, 162, 42, 92, 190, 9, 151, 81, 224, 247, 61, 111, 112, 254, 108, 169,
-    177, 140, 252, 13, 4, 17, 118, 60, 28, 246, 165, 82, 234, 153, 92, 87, 144, 150, 79, 11, 83, 57, 2, 246, 6, 37, 163,
-    30, 178, 160, 4, 49, 94, 144, 89, 241, 62, 42, 203, 144, 127, 198, 120, 197, 101, 186, 60, 112, 32, 65, 129, 129,
-    172, 54, 209, 103, 85, 167, 225, 226, 79, 103, 235, 218, 183, 18, 217, 30, 181, 69, 182, 97, 225, 129, 161, 7, 126,
-    48, 227, 26, 81, 101, 44, 163, 142, 244, 112, 61, 209, 123, 238, 251, 87, 195, 3, 160, 220, 137, 151, 120, 190, 38,
-    244, 119, 131, 50, 223, 129, 227, 129, 25, 1, 183, 207, 39, 218, 228, 51, 3, 215, 62, 213, 13, 14, 117, 61, 52, 85,
-    152, 172, 242, 50, 180, 106, 200, 150, 134, 55, 214, 209, 139, 252, 152, 252, 87, 144, 223, 190, 46, 204, 85, 104,
-    182, 35, 226, 163, 91, 24, 103, 115, 31, 184, 7, 70, 251, 52, 119, 202, 246, 33, 173, 211, 131, 163, 101, 96, 254,
-    197, 37, 212, 66, 77, 68, 111, 222, 218, 243, 129, 140, 86, 160, 224, 56, 242, 16, 196, 143, 247, 131, 61, 208, 91,
-    105, 229, 211, 173, 108, 248, 224, 10, 108, 52, 114, 113, 212, 146, 239, 44, 97, 242, 107, 88, 75, 225, 16, 178, 77,
-    34, 193, 218, 172, 145, 191, 225, 197, 231, 43, 5, 74, 194, 108, 250, 234, 131, 78, 239, 219, 217, 209, 39, 189,
-    185, 16, 145, 94, 194, 166, 255, 220, 146, 179, 237, 231, 121, 30, 91, 90, 142, 120, 51, 9, 207, 15, 172, 63, 4,
-    192, 75, 6, 102, 108, 237, 136, 227, 242, 143, 67, 115, 46, 63, 199, 188, 155, 94, 90, 162, 222, 88, 43, 116, 129,
-    115, 8, 133, 57, 3, 193, 24, 218, 253, 2, 255, 22, 68, 127, 219, 169, 141, 50, 80, 140, 172, 118, 165, 79, 4, 246,
-    221, 28, 63, 21, 61, 3, 253, 26, 124, 164, 174, 133, 216, 26, 89, 42, 173, 1, 171, 90, 158, 104, 122, 184, 210, 156,
-    78, 50, 191, 144, 234, 101, 132, 90, 19, 23, 3, 114, 5, 57, 202, 167, 171, 81, 29, 153, 210, 107, 141, 114, 168,
-    125, 168, 183, 228, 240, 82, 221, 109, 239, 175, 54, 140, 40, 205, 36, 226, 54, 214, 231, 162, 151, 188, 54, 190,
-    85, 143, 220, 73, 152, 237, 115, 216, 24, 231, 245, 92, 241, 46, 238, 235, 41, 3, 247, 47, 33, 37, 242, 108, 209,
-    160, 195, 53, 113, 231, 254, 219, 85, 56, 211, 121, 47, 25, 199, 140, 148, 87, 253, 219, 152, 178, 7, 151, 32, 20,
-    201, 7, 243, 223, 167, 123, 254, 176, 151, 204, 235, 150, 39, 240, 207, 221, 111, 44, 176, 74, 135, 244, 100, 147,
-    38, 130, 40, 45, 173, 16, 138, 65, 160, 239, 102, 248, 230, 119, 12, 143, 110, 57, 162, 80, 96, 230, 29, 90, 71, 44,
-    178, 177, 141, 144, 206, 160, 128, 215, 17, 2, 51, 221, 30, 194, 180, 47, 75, 199, 10, 75, 72, 129, 111, 154, 245,
-    46, 169, 110, 199, 194, 39, 156, 67, 46, 254, 163, 62, 130, 101, 206, 199, 195, 72, 29, 82, 53, 138, 195, 209, 241,
-    121, 145, 138, 29, 240, 17, 4, 10, 198, 222, 152, 6, 185, 238, 249, 174, 245, 108, 197, 71, 80, 142, 43, 81, 217,
-    198, 161, 29, 80, 94, 106, 19, 104, 136, 231, 73, 189, 122, 35, 216, 209, 110, 150, 89, 15, 162, 175, 254, 209, 69,
-    115, 17, 254, 62, 112, 235, 24, 126, 94, 147, 209, 57, 33, 158, 248, 29, 251, 232, 57, 45, 160, 84, 73, 132, 47, 34,
-    150, 240, 220, 19, 125, 182, 226, 19, 121, 8, 157, 107, 188, 33, 123, 242, 218, 172, 201, 25, 108, 94, 78, 93, 43,
-    54, 54, 187, 34, 122, 16, 158, 107, 86, 187, 91, 59, 249, 13, 18, 219, 17, 222, 46, 0, 79, 102, 16, 27, 20, 140, 8,
-    144, 86, 239, 131, 90, 62, 11, 106, 142, 193, 62, 153, 196, 176, 141, 151, 144, 5, 24, 231, 105, 26, 218, 254, 116,
-    198, 175, 187, 101, 165, 208, 184, 126, 61, 158, 75, 59, 86, 179, 195, 59, 97, 198, 176, 202, 87, 28, 39, 196, 40,
-    221, 227, 202, 192, 72, 239, 21, 207, 9, 185, 90, 206, 155, 244, 189, 101, 237, 8, 200, 74, 152, 16, 52, 184, 246,
-    63, 200, 223, 143, 65, 80, 88, 249, 69, 35, 219, 92, 47, 190, 154, 198, 154, 116, 60, 139, 145, 237, 235, 105, 50,
-    27, 242, 31, 65, 208, 130, 86, 161, 1, 74, 79, 52, 162, 45, 5, 101, 112, 224, 47, 174, 252, 235, 15, 85, 63, 198,
-    91, 131, 75, 138, 188, 78, 112, 247, 80, 6, 239, 90, 155, 17, 39, 237, 161, 159, 231, 68, 188, 138, 145, 57, 174,
-    249, 92, 132, 178, 193, 248, 153, 157, 20, 164, 208, 215, 236, 251, 17, 99, 164, 249, 152, 163, 221, 174, 82, 165,
-    1, 186, 82, 8, 65, 63, 149, 202, 146, 127, 107, 46, 180, 241, 20, 44, 139, 160, 161, 132, 143, 218, 15, 88, 68, 193,
-    121, 93, 91, 60, 185, 8, 9, 200, 59, 241, 128, 124, 203, 209, 108, 43, 69, 32, 143, 102, 181, 255, 21, 122, 239,
-    157, 100, 30, 35, 17, 200, 233, 33, 97, 56, 225, 240, 50, 157, 117, 254, 161, 73, 1, 60, 59, 192, 179, 164, 94, 147,
-    217, 89, 170, 205, 160, 84, 58, 231, 168, 57, 163, 115, 190, 37, 16, 66, 129, 36, 233, 65, 90, 220, 154, 249, 29, 8,
-    248, 214, 5, 232, 196, 13, 94, 39, 54, 221, 78, 123, 27, 140, 205, 47, 52, 132, 194, 211, 183, 128, 200, 207, 52,
-    158, 135, 143, 248, 0, 125, 122, 238, 16, 144, 96, 203, 128, 168, 106, 82, 119, 97, 194, 229, 56, 169, 132, 221, 95,
-    250, 222, 59, 157, 118, 248, 210, 139, 56, 221, 105, 12, 95, 68, 29, 111, 11, 19, 218, 67, 116, 182, 218, 65, 136,
-    3, 17, 170, 202, 54, 103, 146, 141, 135, 167, 61, 197, 128, 81, 174, 107, 18, 128, 69, 52, 30, 248, 74, 140, 40,
-    180, 138, 135, 215, 105, 167, 68, 8, 37, 164, 136, 86, 44, 62, 88, 177, 69, 236, 204, 142, 211, 18, 62, 10, 204,
-    175, 20, 58, 199, 218, 96, 219, 66, 203, 24, 3, 62, 130, 10, 153, 153, 179, 8, 171, 206, 79, 199, 70, 223, 86, 146,
-    107, 58, 103, 148, 151, 48, 223, 236, 196, 183, 130, 66, 47, 101, 112, 121, 248, 219, 171, 72, 210, 201, 78, 68,
-    228, 90, 8, 94, 68, 138, 127, 214, 99, 160, 177, 196, 223, 138, 179, 167, 195, 23, 72, 86, 100, 162, 171, 38, 109,
-    241, 206, 22, 109, 102, 112, 124, 252, 66, 43, 83, 254, 3, 218, 60, 189, 245, 239, 166, 180, 129, 133, 3, 96, 102,
-    44, 255, 236, 164, 62, 19, 145, 150, 231, 237, 40, 98, 182, 112, 32, 144, 122, 11, 22, 182, 56, 76, 1, 124, 12, 117,
-    68, 139, 55, 85, 221, 155, 94, 245, 126, 187, 75, 18, 91, 70, 121, 21, 158, 22, 72, 27, 103, 249, 189, 108, 161, 18,
-    63, 216, 76, 36, 133, 24, 113, 179, 119, 140, 150, 217, 218, 185, 56, 5, 24, 1, 94, 164, 167, 127, 234, 37, 101, 42,
-    191, 198, 203, 23, 154, 31, 157, 67, 93, 203, 234, 180, 102, 66, 205, 72, 19, 51, 236, 219, 197, 254, 223, 107, 16,
-    231, 50, 217, 163, 207, 28, 210, 26, 136, 154, 0, 154, 47, 249, 240, 177, 158, 193, 54, 246, 164, 113, 211, 238,
-    151, 62, 59, 160, 53, 64, 124, 226, 129, 202, 42, 126, 13, 233, 112, 76, 223, 147, 69, 35, 21, 60, 251, 97, 63, 8,
-    46, 9, 202, 154, 9, 133, 116, 232, 88, 39, 186, 228, 219, 215, 75, 183, 184, 186, 18, 207, 219, 244, 130, 38, 255,
-    101, 214, 214, 161, 26, 230, 126, 215, 202, 254, 193, 22, 128, 240, 160, 148, 143, 200, 156, 82, 103, 59, 249, 226,
-    78, 253, 29, 187, 208, 12, 100, 200, 178, 130, 6, 188, 162, 114, 96, 205, 177, 86, 149, 153, 37, 109, 55, 214, 28,
-    232, 4, 125, 235, 161, 105, 143, 110, 29, 195, 43, 186, 29, 21, 24, 225, 149, 158, 48, 214, 210, 95, 121, 30, 52,
-    230, 85, 107, 239, 203, 105, 70, 235, 145, 190, 169, 15, 67, 110, 217, 80, 129, 48, 108, 36, 208, 139, 129, 213, 93,
-    33, 212, 138, 252, 23, 226, 108, 242, 25, 4, 250, 255, 196, 51, 106, 58, 218, 59, 255, 189, 163, 0, 144, 130, 170,
-    10, 162, 161, 96, 31, 10, 211, 134, 232, 15, 235, 13, 62, 5, 208, 125, 25, 30, 65, 4, 105, 27, 162, 50, 157, 127,
-    174, 118, 45, 105, 42, 189, 37, 26, 42, 77, 86, 248, 218, 120, 252, 82, 154, 31, 66, 96, 242, 44, 213, 254, 29, 182,
-    200, 76, 69, 114, 115, 125, 127, 4, 243, 170, 204, 90, 24, 30, 213, 171, 64, 105, 104, 253, 13, 158, 241, 93, 104,
-    13, 190, 73, 193, 64, 57, 125, 17, 128, 236, 44, 137, 42, 10, 172, 101, 161, 125, 69, 86, 214, 206, 40, 199, 99,
-    251, 96, 229, 9, 249, 79, 69, 10, 67, 142, 48, 32, 139, 186, 23, 24, 206, 89, 54, 243, 226, 210, 184, 51, 223, 251,
-    21, 194, 208, 117, 100, 255, 105, 109, 108, 143, 164, 98, 142, 204, 241, 170, 155, 198, 94, 8, 157, 119, 0, 50, 156,
-    131, 246, 245, 222, 214, 177, 255, 148, 229, 105, 239, 40, 37, 54, 38, 149, 225, 84, 141, 199, 190, 239, 159, 35,
-    28, 100, 173, 240, 217, 7, 188, 245, 105, 190, 183, 12, 236, 120, 194, 5, 72, 240, 153, 80, 124, 175, 22, 94, 183,
-    212, 111, 69, 84, 97, 17, 5, 207, 42, 110, 221, 76, 27, 91, 141, 251, 128, 169, 221, 141, 39, 84, 46, 90, 4, 212,
-    212, 172, 29, 20, 231, 68, 60, 199, 76, 201, 145, 17, 84, 236, 106, 152, 90, 145, 152, 0, 116, 232, 12, 211, 100,
-    85, 74, 161, 190, 4, 179, 75, 224, 142, 85, 8, 165, 183, 195, 228, 69, 217, 71, 68, 155, 166, 158, 170, 13, 33, 193,
-    66, 197, 78, 156, 191, 150, 127, 6, 182, 43, 243, 193, 62, 106, 169, 17, 245, 27, 109, 111, 237, 194, 44, 243, 94,
-    160, 219, 104, 159, 182, 180, 130, 74, 37, 9, 255, 18, 126, 45, 226, 30, 41, 62, 91, 103, 220, 178, 218, 217, 175,
-    16, 52, 82, 63, 163, 85, 23, 38, 185, 131, 129, 248, 120, 9, 189, 134, 108, 133, 117, 237, 18, 127, 13, 75, 213, 42,
-    215, 217, 1, 1, 87, 171, 27, 121, 104, 50, 184, 137, 106, 201, 111, 121, 240, 80, 24, 155, 11, 126, 33, 32, 124,
-    121, 247, 43, 19, 165, 15, 129, 14, 182, 170, 249, 54, 54, 60, 111, 117, 44, 83, 32, 8, 164, 77, 63, 40, 24, 103,
-    40, 103, 45, 161, 55, 110, 210, 96, 19, 167, 101, 74, 100, 181, 163, 6, 15, 233, 191, 207, 28, 14, 119, 188, 19, 62,
-    62, 216, 55, 124, 56, 62, 194, 72, 214, 108, 114, 231, 112, 61, 114, 138, 185, 110, 222, 217, 28, 207, 101, 110, 9,
-    79, 137, 195, 177, 47, 214, 199, 101, 254, 167, 129, 41, 123, 78, 91, 94, 173, 115, 177, 110, 160, 229, 183, 157,
-    64, 23, 59, 220, 170, 188, 2, 209, 24, 52, 222, 125, 28, 214, 111, 185, 188, 184, 124, 232, 220, 97, 179, 152, 214,
-    133, 30, 78, 43, 244, 94, 147, 220, 170, 22, 92, 217, 231, 239, 205, 168, 48, 191, 190, 174, 45, 198, 185, 73, 138,
-    11, 17, 109, 225, 238, 202, 163, 166, 182, 64, 37, 81, 26, 196, 165, 231, 208, 122, 54, 143, 188, 18, 213, 132, 138,
-    212, 185, 109, 146, 21, 219, 214, 34, 77, 20, 10, 252, 204, 129, 16, 33, 115, 49, 99, 2, 224, 201, 179, 146, 61, 10,
-    252, 14, 180, 93, 231, 83, 192, 90, 91, 45, 149, 84, 33, 178, 137, 173, 132, 199, 10, 168, 74, 79, 228, 117, 113,
-    43, 41, 147, 130, 167, 157, 128, 248, 190, 244, 247, 130, 41, 99, 225, 216, 79, 189, 49, 96, 89, 153, 62, 102, 2,
-    144, 254, 73, 54, 124, 201, 150, 123, 249, 167, 133, 236, 7, 127, 209, 214, 102, 77, 245, 158, 177, 175, 125, 58,
-    155, 221, 103, 102, 152, 103, 173, 107, 167, 220, 142, 64, 124, 83, 12, 185, 132, 174, 141, 208, 185, 129, 63, 70,
-    41, 29, 162, 195, 57, 247, 221, 23, 112, 253, 81, 250, 93, 239, 6, 61, 61, 87, 129, 182, 127, 68, 83, 60, 179, 77,
-    27, 85, 226, 228, 60, 84, 18, 32, 51, 192, 111, 106, 86, 115, 132, 133, 120, 96, 3, 187, 243, 144, 206, 129, 40,
-    116, 228, 252, 96, 229, 245, 83, 3, 7, 233, 104, 145, 69, 54, 20, 19, 246, 108, 200, 192, 149, 251, 52, 133, 48, 36,
-    228, 110, 106, 95, 234, 195, 19, 57, 106, 143, 46, 209, 59, 14, 214, 175, 50, 25, 231, 70, 234, 82, 78, 54, 211,
-    160, 215, 82, 157, 150, 83, 19, 184, 246, 7, 206, 100, 121, 222, 94, 126, 89, 196, 0, 26, 26, 61, 238, 92, 18, 65,
-    92, 153, 156, 138, 200, 55, 220, 30, 2, 138, 22, 4, 23, 125, 138, 181, 249, 93, 155, 46, 44, 12, 198, 70, 116, 76,
-    89, 166, 110, 231, 128, 48, 247, 252, 241, 209, 235, 220, 48, 233, 179, 179, 40, 48, 232, 236, 42, 31, 179, 46, 144,
-    246, 199, 147, 144, 50, 107, 30, 232, 45, 0, 204, 98, 241, 23, 175, 71, 105, 143, 110, 31, 37, 38, 152, 21, 141, 51,
-    211, 3, 49, 12, 133, 252, 11, 224, 156, 156, 121, 216, 104, 250, 250, 66, 44, 111, 233, 242, 15, 40, 130, 139, 92,
-    228, 138, 235, 195, 114, 108, 146, 126, 128, 89, 148, 47, 163, 68, 56, 29, 162, 137, 209, 89, 178, 148, 34, 232,
-    246, 172, 97, 112, 55, 219, 140, 101, 251, 83, 210, 38, 88, 20, 176, 31, 144, 142, 84, 97, 210, 227, 128, 248, 43,
-    206, 174, 236, 149, 211, 134, 230, 226, 126, 171, 214, 8, 26, 20, 251, 179, 199, 208, 22, 237, 27, 40, 245, 188, 36,
-    115, 179, 107, 178, 109, 9, 18, 175, 95, 177, 138, 164, 204, 219, 151, 22, 60, 32, 220, 131, 195, 210, 250, 42, 250,
-    139, 179, 151, 179, 224, 166, 65, 213, 193, 218, 19, 98, 28, 12, 105, 49, 0, 80, 234, 201, 62, 13, 236, 145, 231,
-    131, 49, 140, 46, 110, 165, 66, 254, 86, 129, 40, 234, 128, 26, 168, 61, 240, 167, 127, 201, 29, 125, 252, 97, 3,
-    211, 121, 41, 191, 186, 146, 117, 102, 165, 189, 120, 54, 89, 250, 14, 4, 11, 222, 218, 0, 217, 204, 122, 218, 175,
-    84, 215, 67, 142, 187, 254, 173, 210, 199, 106, 1, 104, 11, 247, 203, 46, 147, 14, 170, 111, 147, 42, 17, 247, 227,
-    11, 233, 65, 49, 93, 137, 13, 244, 33, 63, 148, 224, 144, 101, 146, 57, 191, 75, 38, 146, 191, 244, 233, 24, 126,
-    28, 173, 77, 66, 199, 247, 191, 250, 149, 118, 48, 220, 3, 215, 172, 47, 183, 233, 219, 100, 187, 36, 158, 196, 245,
-    61, 57, 209, 93, 75, 59, 110, 57, 88, 66, 235, 124, 178, 221, 55, 244, 235, 114, 20, 9, 243, 119, 131, 35, 240, 212,
-    252, 170, 94, 24, 164, 68, 18, 76, 189, 223, 146, 253, 143, 61, 85, 124, 8, 127, 149, 189, 240, 146, 71, 43, 106,
-    135, 170, 230, 145, 77, 147, 80, 199, 219, 51, 125, 83, 197, 77, 155, 252, 195, 88, 82, 90, 182, 155, 240, 70, 232,
-    185, 149, 154, 118, 161, 56, 0, 58, 184, 192, 88, 230, 139, 160, 164, 190, 189, 250, 76, 166, 90, 19, 33, 162, 227,
-    141, 62, 152, 3, 11, 83, 133, 48, 1, 63, 71, 97, 23, 164, 209, 179, 141, 192, 143, 3, 200, 103, 216, 55, 124, 157,
-    252, 167, 235, 39, 252, 33, 130, 225, 29, 68, 165, 28, 153, 227, 176, 74, 154, 72, 40, 53, 153, 27, 215, 49, 47,
-    206, 220, 117, 56, 105, 100, 214, 180, 188, 121, 204, 108, 58, 39, 80, 216, 115, 247, 209, 5, 34, 160, 191, 41, 109,
-    55, 202, 156, 116, 156, 220, 213, 66, 22, 212, 106, 211, 216, 38, 174, 37, 198, 125, 22, 147, 20, 228, 26, 179, 181,
-    14, 225, 87, 114, 135, 60, 128, 144, 57, 120, 79, 150, 229, 216, 68, 139, 23, 197, 73, 221, 153, 50, 212, 89, 235,
-    192, 158, 187, 142, 146, 102, 126, 149, 57, 56, 126, 67, 211, 174, 86, 166, 99, 181, 93, 74, 153, 52, 220, 96, 84,
-    32, 165, 164, 114, 224, 86, 44, 18, 132, 196, 239, 87, 95, 22, 195, 96, 26, 127, 132, 227, 232, 190, 137, 71, 84,
-    244, 191, 230, 79, 252, 172, 20, 14, 135, 37, 3, 211, 42, 197, 172, 138, 220, 91, 229, 183, 130, 64, 85, 102, 210,
-    223, 208, 138, 206, 251, 127, 56, 59, 148, 34, 43, 97, 23, 41, 101, 146, 98, 111, 229, 236, 172, 208, 72, 42, 98,
-    191, 36, 178, 90, 24, 50, 61, 130, 57, 39, 121, 151, 76, 88, 182, 136, 126, 216, 213, 212, 199, 126, 138, 255, 193,
-    168, 34, 15, 4, 199, 243, 201, 153, 208, 125, 70, 87, 150, 224, 207, 115, 111, 207, 52, 41, 45, 99, 111, 218, 0, 68,
-    79, 103, 179, 156, 237, 250, 93, 91, 52, 160, 134, 204, 159, 13, 110, 28, 91, 19, 79, 79, 206, 80, 144, 106, 92,
-    206, 68, 246, 58, 74, 31, 25, 27, 62, 113, 169, 182, 149, 228, 184, 195, 122, 9, 29, 61, 129, 209, 218, 75, 126, 92,
-    150, 199, 171, 166, 193, 50, 50, 254, 80, 228, 56, 189, 206, 178, 120, 236, 254, 173, 180, 207, 103, 48, 116, 115,
-    35, 167, 67, 22, 218, 98, 149, 153, 26, 65, 29, 211, 162, 72, 89, 64, 198, 116, 193, 139, 187, 176, 46, 172, 93,
-    149, 194, 48, 137, 34, 95, 217, 15, 223, 59, 164, 180, 91, 66, 206, 82, 43, 12, 186, 67, 209, 104, 177, 101, 139,
-    190, 229, 173, 233, 30, 179, 28, 97, 7, 91, 18, 222, 169, 112, 255, 23, 71, 216, 67, 143, 122, 16, 244, 28, 42, 171,
-    166, 217, 41, 237, 248, 98, 42, 122, 75, 210, 149, 55, 47, 99, 188, 89, 91, 235, 9, 51, 82, 93, 73, 123, 221, 184,
-    143, 110, 70, 65, 128, 154, 198, 183, 63, 4, 235, 174, 95, 221, 128, 203, 221, 234, 150, 59, 132, 148, 220, 63, 32,
-    67, 141, 22, 13, 31, 234, 0, 24, 99, 95, 196, 26, 207, 6, 12, 126, 227, 77, 43, 144, 214, 102, 99, 23, 110, 228,
-    208, 249, 77, 148, 121, 209, 210, 164, 71, 44, 135, 240, 186, 67, 126, 5, 190, 148, 44, 250, 25, 121, 169, 24, 41,
-    108, 158, 165, 206, 183, 163, 245, 54, 251, 122, 34, 237, 252, 68, 98, 203, 79, 15, 31, 55, 220, 152, 49, 162, 39,
-    186, 115, 9, 84, 197, 226, 210, 16, 21, 92, 171, 69, 139, 152, 143, 9, 203, 29, 175, 48, 216, 84, 215, 208, 220,
-    151, 102, 83, 20, 166, 171, 241, 154, 88, 86, 193, 138, 96, 94, 157, 140, 177, 142, 199, 104, 145, 164, 55, 139,
-    207, 236, 59, 227, 192, 163, 161, 69, 240, 172, 164, 116, 237, 108, 128, 42, 242, 41, 225, 89, 157, 225, 48, 29,
-    199, 0, 176, 167, 129, 55, 27, 110, 38, 99, 49, 185, 163, 112, 91, 221, 245, 214, 213, 206, 191, 209, 137, 142, 240,
-    195, 241, 42, 203, 145, 137, 118, 122, 92, 156, 170, 144, 242, 121, 219, 50, 255, 50, 87, 175, 151, 117, 117, 145,
-    227, 153, 205, 155, 230, 55, 148, 43, 193, 63, 240, 45, 65, 13, 86, 92, 46, 247, 185, 165, 192, 29, 195, 12, 28,
-    204, 171, 84, 38, 15, 180, 2, 4, 243, 173, 122, 80, 87, 89, 207, 173, 82, 129, 92, 133, 67, 51, 12, 235, 23, 196,
-    58, 23, 238, 51, 82, 73, 17, 38, 156, 235, 220, 73, 150, 114, 170, 31, 85, 176, 249, 204, 247, 169, 187, 104, 208,
-    54, 23, 205, 168, 102, 61, 128, 2, 11, 102, 56, 131, 161, 165, 155, 34, 29, 195, 120, 229, 179, 2, 184, 182, 21,
-    254, 14, 34, 151, 23, 126, 85, 217, 11, 141, 192, 33, 55, 231, 240, 37, 88, 240, 149, 169, 132, 193, 149, 66, 44,
-    60, 163, 158, 139, 78, 112, 23, 32, 153, 71, 132, 174, 71, 108, 58, 86, 83, 86, 174, 226, 75, 212, 243, 166, 234,
-    114, 40, 88, 177, 52, 236, 9, 151, 183, 133, 254, 46, 86, 242, 150, 201, 203, 158, 34, 164, 217, 108, 231, 221, 107,
-    40, 192, 115, 24, 120, 64, 19, 209, 145, 56, 23, 76, 198, 182, 6, 101, 225, 155, 119, 94, 127, 241, 242, 138, 157,
-    4, 50, 129, 86, 192, 195, 167, 51, 253, 156, 187, 233, 130, 178, 214, 117, 110, 65, 194, 103, 54, 210, 28, 133, 234,
-    185, 255, 119, 1, 233, 39, 59, 38, 137, 251, 245, 173, 59, 190, 45, 182, 172, 36, 107, 55, 110, 45, 139, 251, 85, 7,
-    147, 107, 241, 49, 153, 33, 139, 111, 173, 73, 76, 216, 169, 230, 161, 189, 212, 23, 237, 51, 134, 231, 52, 152, 46,
-    78, 101, 59, 203, 221, 75, 233, 249, 97, 164, 246, 241, 135, 140, 217, 104, 147, 150, 123, 96, 12, 127, 183, 31, 92,
-    245, 154, 168, 89, 55, 160, 234, 206, 80, 175, 19, 40, 153, 251, 42, 214, 30, 211, 233, 68, 19, 145, 92, 124, 180,
-    1, 112, 65, 104, 125, 149, 15, 48, 80, 27, 156, 254, 95, 66, 192, 177, 85, 86, 227, 136, 150, 55, 241, 49, 172, 187,
-    115, 251, 240, 228, 139, 150, 81, 31, 0, 31, 31, 250, 117, 121, 136, 123, 208, 217, 81, 229, 26, 195, 252, 36, 24,
-    133, 95, 57, 227, 186, 183, 178, 212, 244, 236, 173, 163, 241, 207, 110, 134, 39, 82, 122, 15, 243, 69, 6, 4, 48,
-    140, 155, 84, 195, 225, 72, 110, 196, 118, 18, 162, 189, 107, 179, 98, 128, 121, 240, 205, 132, 71, 33, 53, 69, 224,
-    32, 121, 60, 119, 172, 199, 124, 158, 101, 104, 120, 137, 178, 255, 71, 94, 93, 26, 76, 35, 33, 136, 18, 68, 65, 14,
-    17, 193, 151, 59, 141, 64, 143, 83, 3, 25, 171, 83, 49, 109, 188, 48, 195, 208, 210, 248, 46, 88, 217, 254, 37, 212,
-    201, 126, 92, 44, 12, 62, 192, 158, 60, 158, 166, 178, 232, 222, 83, 222, 212, 156, 76, 42, 40, 142, 77, 105, 151,
-    68, 161, 60, 165, 141, 84, 186, 65, 193, 228, 224, 190, 181, 137, 36, 31, 97, 99, 232, 61, 21, 203, 38, 86, 135, 92,
-    40, 195, 146, 223, 167, 129, 132, 254, 169, 70, 23, 84, 37, 25, 112, 205, 56, 173, 32, 63, 173, 44, 165, 207, 27,
-    74, 179, 100, 110, 112, 189, 106, 125, 223, 234, 249, 200, 187, 119, 120, 29, 60, 255, 218, 205, 19, 155, 169, 75,
-    76, 145, 187, 93, 187, 253, 140, 140, 104, 41, 76, 44, 62, 240, 5, 2, 84, 126, 149, 140, 189, 213, 161, 162, 33,
-    120, 252, 195, 130, 58, 47, 65, 7, 177, 187, 20, 193, 108, 36, 13, 155, 146, 0, 23, 87, 81, 140, 151, 192, 241, 170,
-    81, 148, 153, 246, 72, 39, 170, 215, 62, 161, 157, 206, 206, 161, 1, 136, 248, 68, 113, 115, 199, 136, 46, 35, 1,
-    227, 211, 62, 121, 225, 227, 95, 237, 183, 148, 199, 219, 33, 85, 102, 19, 10, 62, 212, 164, 116, 161, 125, 218, 27,
-    121, 56, 253, 187, 191, 8, 3, 142, 189, 78, 109, 120, 95, 99, 45, 135, 123, 79, 141, 189, 201, 138, 107, 184, 89,
-    17, 146, 171, 153, 104, 121, 226, 178, 159, 178, 86, 141, 73, 27, 72, 93, 69, 104, 146, 70, 150, 176, 148, 230, 250,
-    22, 166, 205, 168, 27, 97, 129, 254, 114, 13, 169, 201, 176, 46, 8, 0, 148, 245, 0, 75, 164, 197, 121, 167, 124, 49,
-    46, 248, 111, 128, 121, 56, 172, 185, 1, 75, 116, 162, 32, 121, 6, 12, 34, 148, 26, 74, 87, 55, 207, 222, 211, 217,
-    195, 46, 152, 134, 144, 177, 203, 163, 8, 142, 199, 210, 168, 185, 203, 18, 194, 109, 59, 29, 251, 245, 34, 36, 116,
-    13, 63, 167, 122, 110, 215, 17, 46, 139, 44, 219, 117, 36, 99, 14, 148, 87, 127, 123, 28, 171, 180, 197, 125, 41,
-    50, 100, 243, 1, 20, 105, 175, 80, 174, 111, 47, 17, 234, 205, 155, 211, 213, 195, 145, 210, 58, 136, 90, 43, 54,
-    253, 223, 153, 56, 9, 188, 241, 248, 142, 135, 162, 72, 152, 251, 54, 27, 190, 25, 13, 214, 210, 233, 61, 152, 6,
-    25, 232, 130, 220, 108, 99, 87, 59, 4, 154, 13, 104, 61, 41, 199, 226, 202, 68, 128, 13, 98, 133, 132, 204, 183, 31,
-    248, 52, 129, 115, 210, 183, 85, 177, 138, 85, 101, 103, 181, 176, 165, 93, 18, 49, 238, 86, 174, 189, 160, 232, 85,
-    27, 143, 12, 113, 211, 24, 105, 112, 72, 41, 127, 27, 58, 65, 80, 171, 206, 217, 187, 49, 194, 14, 158, 235, 221,
-    237, 158, 24, 114, 95, 111, 20, 201, 29, 45, 222, 0, 154, 209, 147, 217, 141, 146, 166, 16, 243, 211, 208, 248, 70,
-    88, 123, 128, 66, 64, 47, 66, 233, 54, 108, 35, 132, 192, 228, 113, 175, 238, 103, 14, 114, 13, 175, 193, 193, 81,
-    104, 124, 18, 158, 22, 184, 193, 52, 71, 208, 207, 86, 109, 17, 9, 26, 117, 124, 106, 183, 173, 65, 78, 211, 100,
-    69, 18, 252, 46, 213, 32, 161, 194, 56, 173, 224, 82, 6, 62, 78, 45, 192, 252, 227, 160, 99, 186, 175, 231, 121,
-    154, 151, 227, 198, 96, 209, 126, 94, 69, 98, 104, 209, 7, 138, 154, 29, 83, 187, 172, 232, 252, 178, 27, 171, 245,
-    59, 94, 158, 113, 28, 117, 221, 168, 210, 164, 62, 180, 63, 140, 143, 238, 230, 202, 83, 209, 48, 88, 36, 191, 139,
-    50, 84, 112, 110, 231, 255, 172, 13, 213, 211, 76, 96, 235, 48, 102, 64, 13, 66, 159, 72, 109, 92, 208, 245, 114,
-    15, 165, 155, 236, 150, 72, 31, 226, 191, 250, 233, 197, 75, 92, 33, 115, 191, 244, 229, 240, 198, 60, 230, 170,
-    254, 227, 44, 242, 207, 31, 90, 162, 6, 58, 170, 213, 226, 246, 252, 118, 71, 53, 151, 204, 150, 169, 50, 64, 51,
-    27, 1, 125, 120, 56, 12, 30, 46, 57, 195, 170, 86, 244, 182, 1, 157, 68, 67, 164, 191, 65, 82, 190, 78, 108, 6, 246,
-    30, 201, 168, 231, 152, 106, 99, 80, 87, 194, 8, 167, 133, 213, 94, 164, 59, 131, 109, 54, 15, 86, 153, 143, 248, 5,
-    55, 27, 7, 221, 255, 12, 121, 24, 140, 27, 67, 152, 94, 26, 34, 241, 136, 198, 76, 30, 233, 230, 93, 228, 60, 239,
-    96, 178, 24, 152, 163, 247, 215, 97, 35, 202, 64, 66, 25, 20, 145, 38, 16, 66, 89, 227, 171, 160, 221, 49, 224, 131,
-    125, 14, 113, 224, 144, 134, 176, 104, 61, 69, 148, 16, 59, 86, 222, 63, 80, 129, 35, 205, 255, 241, 130, 165, 69,
-    232, 118, 156, 80, 163, 213, 7, 148, 180, 192, 29, 140, 149, 247, 23, 244, 135, 184, 23, 61, 205, 141, 21, 31, 188,
-    36, 141, 0, 174, 68, 186, 236, 8, 248, 163, 116, 206, 21, 139, 213, 233, 213, 113, 112, 98, 118, 224, 118, 111, 91,
-    81, 201, 145, 157, 146, 88, 105, 118, 182, 94, 192, 10, 61, 88, 19, 119, 109, 112, 136, 70, 74, 24, 112, 235, 110,
-    202, 128, 3, 133, 150, 116, 212, 190, 25, 69, 141, 99, 174, 156, 246, 145, 237, 0, 185, 168, 212, 6, 248, 28, 234,
-    107, 243, 172, 186, 5, 88, 195, 86, 137, 172, 61, 161, 89, 82, 141, 29, 54, 201, 234, 43, 163, 53, 239, 62, 85, 182,
-    145, 152, 109, 140, 36, 224, 58, 219, 243, 216, 196, 42, 23, 47, 42, 159, 167, 150, 105, 169, 144, 26, 203, 22, 220,
-    144, 18, 148, 208, 254, 123, 25, 93, 46, 132, 166, 66, 162, 235, 219, 146, 63, 84, 172, 79, 132, 39, 211, 247, 239,
-    79, 109, 17, 121, 106, 49, 98, 191, 188, 158, 189, 98, 97, 73, 16, 2, 68, 1, 186, 43, 15, 196, 126, 8, 96, 100, 134,
-    66, 215, 31, 39, 146, 143, 135, 48, 174, 53, 162, 119, 208, 172, 189, 48, 8, 198, 25, 206, 97, 156, 24, 124, 115,
-    86, 149, 227, 185, 22, 63, 135, 95, 13, 100, 75, 171, 144, 156, 38, 215, 57, 145, 138, 51, 53, 23, 104, 48, 190, 57,
-    30, 107, 79, 91, 126, 169, 127, 241, 170, 211, 85, 246, 92, 44, 249, 193, 70, 143, 81, 21, 206, 22, 200, 112, 15,
-    170, 124, 127, 151, 71, 148, 91, 245, 112, 147, 203, 104, 55, 242, 112, 123, 28, 182, 134, 117, 216, 159, 179, 42,
-    83, 110, 239, 25, 26, 249, 113, 13, 81, 205, 15, 242, 183, 140, 114, 208, 205, 126, 112, 112, 124, 202, 200, 33,
-    196, 34, 154, 80, 214, 229, 83, 119, 179, 221, 40, 152, 62, 102, 188, 235, 242, 8, 220, 154, 131, 203, 195, 108, 97,
-    186, 49, 18, 240, 104, 39, 24, 29, 121, 153, 113, 68, 164, 66, 4, 96, 163, 53, 183, 233, 170, 187, 10, 216, 118, 7,
-    110, 72, 73, 38, 45, 81, 67, 46, 69, 109, 184, 108, 60, 85, 86, 5, 241, 239, 44, 158, 90, 101, 197, 241, 250, 225,
-    49, 52, 179, 129, 116, 74, 42, 27, 155, 117, 23, 244, 11, 166, 230, 58, 36, 137, 21, 174, 4, 115, 227, 194, 156,
-    150, 216, 126, 111, 175, 177, 49, 237, 226, 151, 160, 147, 104, 54, 53, 22, 121, 196, 177, 19, 188, 207, 0, 166,
-    155, 29, 173, 198, 24, 235, 216, 73, 184, 205, 186, 103, 71, 187, 39, 73, 97, 242, 16, 242, 36, 46, 52, 206, 75, 11,
-    85, 142, 61, 65, 108, 172, 185, 15, 234, 99, 123, 101, 3, 165, 9, 17, 194, 32, 114, 96, 97, 245, 228, 30, 130, 158,
-    159, 74, 107, 11, 43, 204, 229, 18, 96, 93, 75, 129, 12, 92, 200, 117, 180, 122, 13, 201, 38, 168, 200, 163, 52,
-    111, 232, 73, 13, 253, 44, 69, 164, 167, 80, 184, 181, 190, 171, 203, 94, 153, 1, 78, 210, 197, 16, 235, 209, 21,
-    41, 184, 88, 160, 100, 194, 23, 40, 172, 95, 59, 209, 155, 201, 146, 10, 118, 104, 145, 254, 167, 26, 233, 73, 22,
-    21, 246, 223, 53, 215, 85, 61, 74, 55, 19, 129, 169, 177, 123, 240, 66, 192, 51, 188, 134, 81, 187, 137, 213, 184,
-    52, 212, 86, 226, 201, 220, 228, 253, 143, 201, 117, 146, 19, 177, 123, 77, 161, 154, 41, 174, 117, 127, 195, 82,
-    205, 82, 199, 83, 45, 25, 240, 9, 132, 135, 211, 18, 58, 20, 238, 188, 239, 226, 100, 189, 77, 71, 157, 224, 217,
-    244, 183, 156, 131, 175, 129, 102, 237, 195, 97, 69, 169, 125, 96, 93, 251, 105, 45, 178, 170, 13, 32, 221, 219,
-    157, 45, 71, 19, 18, 52, 81, 171, 229, 40, 183, 79, 232, 133, 181, 183, 145, 104, 189, 87, 106, 7, 73, 63, 135, 178,
-    65, 123, 14, 60, 115, 204, 100, 92, 179, 247, 120, 49, 113, 244, 108, 4, 199, 226, 237, 86, 207, 160, 205, 101, 58,
-    84, 225, 186, 102, 179, 124, 232, 227, 70, 54, 210, 244, 37, 217, 215, 181, 230, 155, 109, 145, 168, 151, 21, 203,
-    192, 203, 50, 92, 76, 92, 57, 71, 182, 89, 98, 49, 218, 73, 166, 137, 53, 229, 156, 152, 117, 52, 152, 60, 160, 162,
-    140, 216, 95, 126, 233, 179, 182, 183, 141, 229, 142, 213, 118, 47, 206, 154, 232, 120, 255, 186, 244, 251, 76, 52,
-    43, 239, 205, 93, 70, 67, 177, 185, 78, 7, 160, 45, 55, 214, 231, 145, 26, 153, 81, 234, 167, 252, 155, 94, 5, 130,
-    183, 157, 132, 244, 239, 171, 94, 39, 37, 154, 224, 102, 104, 188, 244, 214, 220, 226, 139, 222, 77, 62, 173, 183,
-    9, 130, 127, 239, 9, 221, 18, 37, 183, 10, 129, 129, 3, 11, 31, 190, 188, 79, 168, 212, 157, 182, 28, 30, 141, 20,
-    69, 54, 77, 73, 146, 154, 131, 180, 169, 149, 219, 10, 41, 103, 132, 2, 3, 216, 122, 30, 80, 79, 99, 115, 253, 240,
-    239, 135, 139, 76, 238, 33, 167, 174, 128, 108, 192, 225, 148, 220, 155, 236, 158, 68, 218, 132, 80, 58, 1, 117, 97,
-    9, 129, 210, 34, 33, 128, 162, 29, 9, 47, 115, 70, 70, 112, 80, 142, 237, 82, 222, 120, 136, 109, 59, 146, 228, 242,
-    106, 202, 212, 203, 51, 229, 157, 246, 239, 238, 7, 44, 151, 242, 1, 37, 235, 115, 202, 66, 121, 134, 17, 102, 21,
-    146, 174, 36, 242, 112, 197, 113, 96, 101, 25, 129, 249, 62, 6, 119, 72, 49, 106, 203, 109, 56, 225, 162, 131, 95,
-    162, 29, 97, 227, 134, 87, 223, 182, 223, 79, 75, 2, 252, 126, 174, 152, 34, 74, 148, 119, 68, 170, 98, 50, 80, 178,
-    117, 228, 131, 144, 161, 247, 243, 152, 221, 182, 199, 123, 188, 61, 150, 47, 205, 52, 28, 31, 127, 163, 214, 128,
-    226, 42, 28, 138, 160, 93, 69, 82, 166, 17, 54, 29, 106, 240, 135, 147, 103, 123, 42, 193, 27, 18, 146, 200, 180,
-    206, 197, 88, 22, 171, 196, 206, 153, 84, 78, 211, 196, 10, 172, 8, 218, 47, 195, 23, 165, 58, 231, 240, 11, 31,
-    171, 25, 36, 242, 191, 141, 11, 255, 246, 64, 119, 123, 133, 59, 88, 110, 175, 250, 88, 71, 68, 205, 24, 161, 250,
-    73, 81, 98, 35, 178, 85, 176, 139, 172, 204, 143, 150, 22, 27, 111, 188, 111, 181, 59, 240, 53, 165, 160, 82, 112,
-    114, 102, 210, 156, 88, 240, 102, 141, 87, 166, 52, 39, 233, 147, 241, 107, 77, 36, 144, 186, 152, 241, 126, 242,
-    153, 138, 174, 73, 87, 215, 52, 105, 131, 106, 2, 144, 147, 77, 226, 92, 176, 161, 58, 11, 135, 144, 83, 141, 39,
-    197, 222, 105, 224, 86, 137, 238, 152, 235, 7, 234, 10, 5, 214, 149, 21, 150, 153, 26, 141, 97, 8, 92, 140, 253,
-    164, 77, 179, 45, 56, 54, 181, 87, 21, 156, 173, 126, 144, 154, 50, 6, 96, 72, 71, 23, 81, 154, 38, 172, 167, 134,
-    4, 24, 2, 247, 201, 75, 127, 232, 230, 221, 187, 38, 41, 106, 15, 141, 248, 250, 240, 193, 160, 16, 173, 90, 152,
-    189, 136, 67, 55, 189, 39, 74, 147, 179, 167, 9, 135, 173, 165, 136, 135, 15, 15, 70, 178, 134, 191, 86, 162, 232,
-    157, 136, 177, 97, 130, 226, 156, 16, 72, 5, 134, 5, 191, 35, 252, 25, 33, 85, 130, 137, 222, 219, 252, 7, 154, 46,
-    241, 93, 22, 167, 161, 9, 233, 207, 161, 240, 204, 142, 255, 228, 74, 15, 80, 169, 187, 49, 217, 94, 44, 217, 222,
-    233, 241, 156, 152, 52, 110, 31, 224, 88, 175, 124, 201, 243, 244, 49, 73, 95, 212, 19, 188, 250, 103, 117, 214,
-    172, 142, 212, 24, 117, 34, 173, 188, 214, 172, 189, 144, 240, 57, 11, 113, 196, 149, 232, 21, 135, 68, 177, 56, 57,
-    224, 86, 216, 239, 88, 228, 222, 174, 194, 47, 225, 148, 193, 6, 152, 62, 45, 57, 92, 236, 197, 197, 89, 45, 146,
-    149, 128, 229, 10, 248, 110, 97, 161, 242, 218, 225, 223, 63, 232, 165, 205, 37, 202, 36, 63, 251, 35, 201, 38, 210,
-    117, 150, 163, 198, 222, 79, 25, 138, 192, 116, 239, 209, 211, 182, 224, 232, 69, 234, 158, 20, 185, 32, 38, 2, 251,
-    187, 57, 38, 200, 192, 182, 250, 252, 204, 85, 106, 97, 185, 185, 138, 144, 171, 33, 7, 71, 46, 96, 211, 236, 162,
-    70, 46, 111, 68, 98, 172, 114, 37, 80, 25, 96, 119, 69, 224, 54, 40, 172, 244, 113, 83, 166, 210, 107, 120, 134,
-    217, 19, 20, 107, 184, 72, 79, 114, 76, 124, 192, 47, 75, 143, 70, 38, 221, 11, 235, 17, 130, 210, 160, 111, 38, 60,
-    188, 160, 143, 122, 28, 67, 107, 213, 1, 229, 15, 173, 234, 230, 110, 80, 81, 206, 165, 79, 221, 25, 135, 138, 188,
-    165, 26, 116, 136, 83, 78, 138, 60, 67, 237, 89, 253, 150, 25, 0, 55, 66, 91, 217, 32, 87, 237, 90, 193, 5, 160,
-    122, 78, 21, 149, 83, 242, 140, 181, 58, 210, 185, 146, 28, 136, 212, 75, 123, 13, 73, 79, 158, 51, 61, 15, 70, 42,
-    190, 44, 2, 152, 210, 76, 84, 191, 165, 34, 16, 182, 152, 44, 41, 3, 89, 43, 76, 216, 88, 30, 107, 3, 0, 109, 240,
-    159, 159, 118, 16, 243, 166, 164, 163, 38, 60, 155, 79, 3, 248, 149, 140, 215, 255, 143, 54, 192, 184, 162, 77, 15,
-    85, 79, 121, 98, 85, 136, 162, 191, 178, 202, 43, 72, 20, 45, 57, 47, 80, 67, 96, 105, 137, 245, 174, 236, 162, 106,
-    209, 165, 95, 227, 135, 96, 88, 87, 227, 1, 252, 156, 209, 115, 235, 251, 219, 167, 231, 172, 168, 60, 241, 107, 75,
-    60, 74, 202, 27, 10, 4, 120, 252, 225, 212, 103, 210, 184, 222, 75, 231, 64, 236, 95, 117, 221, 33, 149, 126, 228,
-    3, 132, 206, 156, 87, 51, 119, 230, 244, 53, 177, 164, 160, 105, 153, 191, 195, 111, 99, 246, 9, 207, 80, 223, 110,
-    184, 153, 53, 179, 34, 106, 175, 7, 119, 220, 238, 85, 131, 3, 88, 65, 211, 200, 211, 83, 39, 171, 173, 105, 189,
-    78, 88, 16, 145, 135, 178, 174, 53, 154, 221, 202, 105, 136, 202, 36, 44, 246, 126, 220, 154, 236, 222, 94, 198,
-    191, 52, 245, 58, 191, 83, 61, 253, 228, 250, 126, 253, 58, 168, 52, 13, 148, 75, 76, 46, 146, 103, 200, 87, 163,
-    103, 190, 124, 213, 120, 102, 21, 81, 212, 135, 178, 73, 119, 143, 83, 77, 108, 14, 249, 97, 223, 59, 132, 136, 99,
-    125, 24, 119, 173, 172, 94, 131, 232, 32, 167, 5, 32, 84, 76, 39, 208, 98, 9, 209, 57, 176, 243, 127, 97, 180, 44,
-    222, 199, 42, 69, 15, 148, 5, 97, 8, 142, 91, 114, 128, 145, 37, 88, 54, 241, 68, 149, 11, 250, 88, 241, 120, 79,
-    137, 10, 111, 25, 164, 243, 178, 82, 122, 179, 73, 109, 39, 95, 89, 143, 135, 49, 168, 99, 83, 158, 78, 28, 101,
-    212, 214, 16, 131, 106, 233, 24, 152, 43, 11, 94, 132, 44, 92, 142, 146, 227, 51, 183, 59, 99, 3, 217, 158, 18, 149,
-    31, 59, 46, 62, 12, 229, 250, 14, 70, 75, 183, 141, 224, 219, 175, 140, 86, 214, 24, 91, 235, 2, 39, 147, 28, 126,
-    118, 168, 17, 173, 36, 23, 60, 223, 59, 174, 140, 26, 171, 234, 219, 186, 122, 196, 246, 82, 122, 83, 83, 235, 219,
-    183, 220, 12, 232, 0, 249, 70, 28, 103, 41, 209, 230, 175, 232, 79, 11, 116, 214, 126, 181, 52, 147, 20, 190, 21,
-    90, 159, 54, 84, 151, 204, 201, 85, 50, 173, 55, 224, 219, 137, 243, 40, 30, 184, 109, 231, 146, 117, 175, 246, 167,
-    89, 79, 40, 17, 197, 166, 182, 181, 173, 162, 57, 250, 123, 255, 34, 18, 86, 180, 218, 119, 137, 209, 136, 167, 55,
-    116, 84, 230, 226, 190, 201, 245, 78, 221, 24, 85, 50, 107, 65, 64, 205, 15, 114, 54, 72, 84, 6, 168, 206, 26, 12,
-    145, 17, 252, 193, 12, 20, 97, 57, 148, 17, 219, 78, 102, 194, 135, 39, 197, 152, 43, 70, 1, 205, 230, 71, 142, 190,
-    254, 20, 184, 158, 167, 86, 23, 36, 161, 199, 129, 68, 88, 131, 151, 154, 181, 197, 138, 136, 77, 54, 160, 93, 25,
-    69, 20, 52, 99, 109, 24, 113, 129, 145, 13, 104, 66, 224, 243, 239, 228, 174, 99, 171, 202, 130, 153, 234, 123, 60,
-    77, 69, 191, 231, 71, 178, 121, 48, 138, 244, 22, 32, 208, 147, 102, 39, 47, 45, 131, 214, 174, 4, 161, 168, 231,
-    105, 78, 195, 205, 145, 190, 185, 116, 104, 209, 72, 252, 138, 0, 155, 233, 197, 195, 132, 119, 53, 18, 11, 81, 185,
-    78, 64, 240, 132, 94, 253, 57, 222, 163, 175, 198, 10, 156, 3, 230, 6, 170, 160, 48, 110, 197, 63, 33, 137, 162,
-    121, 187, 61, 29, 151, 25, 112, 201, 251, 85, 40, 52, 99, 138, 30, 144, 163, 141, 18, 174, 74, 16, 206, 200, 245,
-    190, 139, 195, 101, 200, 154, 250, 22, 74, 57, 106, 98, 87, 142, 125, 61, 158, 231, 208, 73, 35, 221, 212, 214, 116,
-    243, 203, 64, 80, 235, 2, 5, 45, 91, 127, 182, 170, 43, 193, 232, 49, 249, 105, 140, 113, 5, 90, 35, 189, 122, 168,
-    185, 174, 186, 249, 184, 51, 218, 200, 45, 162, 232, 204, 98, 206, 179, 68, 57, 118, 218, 30, 186, 80, 28, 0, 78,
-    149, 56, 159, 156, 210, 121, 18, 129, 76, 251, 38, 173, 247, 107, 145, 239, 88, 241, 131, 197, 186, 95, 247, 53, 88,
-    125, 136, 183, 58, 5, 142, 3, 46, 219, 145, 114, 143, 106, 177, 176, 242, 203, 141, 124, 199, 225, 77, 180, 191, 67,
-    111, 107, 105, 121, 163, 218, 45, 214, 221, 194, 165, 222, 69, 226, 70, 234, 248, 117, 177, 131, 119, 103, 183, 49,
-    155, 12, 213, 86, 15, 8, 136, 82, 144, 22, 146, 194, 29, 182, 1, 214, 120, 209, 123, 10, 157, 239, 64, 116, 26, 54,
-    141, 29, 34, 149, 224, 155, 16, 114, 176, 39, 223, 167, 170, 192, 85, 119, 52, 105, 192, 145, 128, 175, 151, 97,
-    180, 85, 250, 174, 113, 107, 227, 213, 149, 241, 167, 107, 243, 253, 246, 60, 40, 179, 202, 184, 24, 133, 184, 161,
-    196, 22, 140, 1, 89, 90, 176, 226, 197, 205, 25, 15, 206, 56, 59, 30, 84, 2, 147, 77, 59, 26, 239, 83, 89, 174, 223,
-    126, 226, 170, 132, 185, 1, 74, 174, 137, 43, 83, 183, 226, 209, 72, 147, 230, 36, 120, 8, 142, 26, 238, 186, 175,
-    55, 108, 75, 65, 57, 182, 159, 231, 57, 107, 1, 165, 25, 163, 8, 95, 233, 95, 150, 73, 236, 6, 157, 182, 222, 171,
-    218, 68, 3, 51, 199, 46, 149, 72, 82, 213, 242, 105, 137, 188, 128, 31, 5, 251, 106, 88, 202, 110, 77, 171, 103, 75,
-    58, 139, 61, 131, 255, 24, 24, 89, 68, 196, 58, 183, 189, 5, 246, 249, 157, 236, 198, 109, 26, 26, 245, 101, 24,
-    161, 219, 148, 65, 184, 85, 53, 154, 195, 197, 77, 80, 174, 47, 79, 162, 199, 53, 113, 234, 225, 37, 179, 64, 143,
-    208, 21, 83, 10, 37, 195, 140, 194, 101, 96, 165, 90, 18, 202, 203, 78, 1, 130, 83, 52, 183, 151, 26, 101, 62, 244,
-    113, 14, 17, 236, 209, 3, 162, 52, 190, 17, 159, 139, 23, 120, 15, 156, 123, 218, 128, 184, 36, 45, 236, 22, 118,
-    79, 145, 197, 101, 69, 135, 65, 83, 221, 216, 178, 213, 250, 74, 6, 20, 5, 19, 235, 184, 133, 168, 229, 4, 26, 194,
-    144, 41, 171, 173, 76, 157, 59, 115, 254, 48, 135, 146, 174, 14, 157, 99, 139, 26, 253, 54, 63, 115, 83, 206, 9,
-    196, 204, 205, 174, 65, 50, 218, 127, 139, 203, 82, 190, 62, 236, 93, 253, 63, 6, 244, 114, 88, 203, 56, 13, 225,
-    12, 203, 107, 238, 174, 216, 199, 231, 3, 138, 152, 207, 30, 199, 255, 177, 151, 78, 112, 211, 179, 167, 120, 253,
-    148, 155, 16, 153, 16, 126, 27, 197, 98, 249, 211, 72, 119, 15, 128, 111, 17, 197, 189, 113, 211, 147, 191, 167, 20,
-    29, 232, 210, 158, 184, 170, 194, 76, 223, 92, 252, 83, 95, 39, 227, 170, 101, 77, 95, 68, 82, 83, 16, 85, 145, 19,
-    47, 39, 208, 48, 22, 51, 175, 205, 229, 19, 196, 150, 51, 160, 230, 76, 192, 242, 106, 98, 196, 91, 143, 13, 73,
-    218, 223, 213, 178, 81, 36, 201, 12, 87, 74, 53, 154, 214, 173, 80, 189, 93, 7, 226, 17, 44, 148, 154, 237, 196,
-    166, 255, 143, 227, 36, 62, 216, 223, 229, 210, 183, 230, 51, 127, 221, 32, 34, 49, 6, 185, 174, 122, 101, 198, 253,
-    36, 115, 69, 235, 79, 78, 156, 193, 90, 42, 9, 32, 82, 182, 26, 247, 102, 37, 243, 146, 142, 145, 112, 36, 49, 131,
-    62, 120, 18, 88, 253, 88, 48, 26, 23, 118, 138, 106, 64, 169, 65, 58, 64, 197, 145, 60, 196, 164, 95, 208, 119, 24,
-    251, 58, 53, 220, 158, 135, 46, 230, 218, 103, 124, 181, 200, 57, 202, 61, 57, 236, 232, 200, 228, 61, 198, 21, 142,
-    216, 222, 158, 27, 22, 138, 33, 225, 168, 83, 43, 143, 101, 85, 105, 25, 100, 29, 46, 78, 247, 161, 111, 30, 136,
-    218, 14, 230, 198, 190, 189, 142, 8, 91, 77, 226, 65, 199, 108, 178, 140, 21, 17, 172, 243, 248, 198, 101, 160, 183,
-    147, 160, 124, 72, 56, 29, 135, 128, 211, 244, 210, 8, 120, 245, 171, 248, 29, 87, 126, 182, 115, 48, 207, 224, 217,
-    58, 8, 139, 126, 135, 15, 10, 71, 25, 252, 59, 208, 201, 178, 164, 8, 158, 99, 163, 92, 116, 139, 201, 63, 217, 21,
-    219, 115, 119, 212, 47, 138, 76, 128, 226, 21, 32, 122, 2, 27, 203, 202, 101, 85, 243, 220, 85, 36, 47, 221, 99,
-    137, 178, 123, 7, 118, 218, 53, 51, 107, 181, 199, 133, 77, 150, 22, 91, 76, 163, 210, 163, 83, 190, 108, 9, 175,
-    54, 34, 154, 74, 215, 35, 180, 144, 189, 28, 186, 83, 157, 37, 208, 5, 32, 24, 133, 142, 192, 81, 206, 48, 16, 238,
-    22, 18, 1, 153, 180, 244, 226, 163, 71, 250, 159, 236, 251, 55, 68, 182, 218, 216, 239, 173, 83, 122, 221, 231, 118,
-    118, 236, 73, 41, 109, 130, 6, 223, 104, 14, 188, 69, 80, 220, 21, 88, 51, 38, 20, 21, 60, 21, 254, 19, 48, 216,
-    108, 253, 171, 225, 51, 114, 115, 26, 106, 165, 4, 227, 204, 93, 40, 165, 98, 120, 21, 177, 169, 17, 54, 173, 134,
-    8, 187, 96, 18, 44, 131, 219, 30, 165, 202, 223, 215, 77, 12, 201, 85, 205, 174, 18, 34, 79, 27, 137, 83, 225, 179,
-    201, 203, 146, 161, 251, 238, 123, 49, 195, 131, 111, 122, 243, 71, 81, 154, 165, 44, 217, 3, 106, 130, 5, 51, 86,
-    143, 160, 238, 148, 237, 232, 203, 179, 250, 208, 152, 200, 170, 99, 113, 44, 22, 160, 145, 184, 91, 115, 56, 181,
-    43, 214, 21, 81, 82, 76, 200, 51, 6, 115, 147, 109, 252, 138, 238, 31, 59, 228, 48, 199, 163, 213, 162, 220, 203,
-    83, 204, 92, 163, 165, 70, 42, 243, 44, 163, 248, 113, 187, 255, 180, 72, 211, 60, 87, 210, 227, 100, 101, 24, 113,
-    220, 45, 126, 100, 86, 5, 228, 22, 221, 201, 243, 167, 111, 48, 74, 86, 13, 102, 127, 206, 205, 176, 15, 112, 106,
-    34, 75, 229, 142, 78, 112, 64, 64, 188, 101, 170, 17, 12, 174, 249, 123, 91, 191, 176, 184, 237, 102, 125, 28, 211,
-    230, 59, 126, 112, 82, 89, 157, 14, 10, 96, 249, 255, 38, 27, 116, 248, 23, 10, 121, 195, 81, 38, 187, 151, 78, 90,
-    171, 93, 233, 129, 214, 76, 13, 153, 170, 44, 45, 184, 91, 235, 234, 94, 8, 36, 187, 35, 152, 220, 246, 37, 62, 174,
-    149, 225, 55, 94, 121, 67, 25, 49, 200, 186, 64, 173, 14, 163, 226, 16, 78, 46, 148, 8, 111, 140, 31, 223, 135, 25,
-    127, 113, 217, 151, 182, 48, 102, 168, 216, 216, 31, 250, 151, 21, 191, 188, 53, 187, 239, 186, 191, 169, 11, 215,
-    68, 16, 114, 0, 141, 171, 97, 14, 241, 127, 126, 231, 116, 41, 154, 119, 82, 79, 2, 46, 133, 117, 92, 58, 199, 189,
-    2, 120, 83, 245, 53, 231, 13, 119, 150, 138, 251, 207, 55, 226, 166, 193, 121, 64, 11, 30, 230, 135, 114, 64, 139,
-    114, 66, 24, 117, 252, 123, 211, 47, 120, 136, 1, 189, 150, 210, 6, 78, 102, 9, 78, 153, 212, 63, 35, 234, 51, 184,
-    210, 156, 191, 171, 207, 169, 52, 63, 172, 168, 65, 230, 178, 252, 78, 44, 55, 168, 125, 32, 18, 20, 110, 27, 132,
-    54, 54, 41, 22, 89, 52, 255, 12, 197, 252, 141, 137, 105, 218, 93, 163, 198, 162, 222, 161, 195, 3, 180, 120, 220,
-    239, 58, 168, 30, 21, 31, 70, 145, 76, 222, 169, 36, 77, 253, 230, 63, 202, 40, 204, 49, 43, 83, 219, 141, 0, 73,
-    92, 24, 120, 34, 61, 7, 101, 199, 226, 86, 62, 18, 74, 158, 108, 48, 54, 60, 209, 165, 224, 0, 83, 209, 230, 119,
-    103, 33, 176, 102, 65, 220, 25, 123, 91, 228, 206, 83, 129, 79, 81, 209, 166, 106, 228, 226, 90, 40, 220, 178, 205,
-    208, 169, 181, 162, 250, 229, 252, 72, 9, 233, 166, 189, 234, 146, 84, 120, 73, 142, 124, 252, 223, 113, 126, 93,
-    129, 121, 104, 209, 157, 200, 225, 119, 230, 155, 121, 74, 223, 154, 182, 7, 96, 194, 206, 190, 248, 205, 69, 21,
-    83, 39, 183, 147, 205, 15, 234, 55, 147, 41, 148, 17, 195, 107, 128, 231, 153, 170, 35, 130, 145, 174, 111, 129,
-    119, 16, 213, 52, 241, 61, 41, 56, 68, 158, 187, 47, 8, 232, 3, 146, 244, 37, 132, 10, 227, 46, 237, 78, 142, 195,
-    247, 223, 13, 107, 37, 214, 187, 187, 156, 8, 107, 56, 56, 159, 237, 85, 117, 209, 243, 29, 228, 144, 38, 245, 8,
-    26, 231, 117, 159, 107, 53, 197, 24, 36, 237, 114, 103, 137, 107, 16, 140, 3, 42, 127, 53, 166, 205, 86, 155, 0,
-    248, 176, 20, 121, 182, 72, 253, 141, 227, 68, 192, 243, 67, 199, 27, 125, 116, 155, 63, 59, 43, 90, 54, 60, 106,
-    186, 247, 38, 150, 165, 125, 44, 3, 137, 99, 133, 67, 25, 34, 151, 39, 17, 216, 137, 170, 76, 209, 155, 152, 80, 76,
-    143, 59, 61, 123, 178, 136, 210, 35, 145, 122, 229, 118, 223, 154, 52, 215, 44, 3, 62, 174, 191, 183, 163, 116, 182,
-    147, 167, 216, 22, 228, 105, 117, 11, 131, 71, 153, 92, 208, 131, 190, 4, 8, 228, 55, 36, 224, 244, 8, 247, 195, 99,
-    234, 21, 255, 170, 96, 41, 2, 4, 168, 68, 155, 125, 105, 238, 55, 140, 39, 119, 195, 83, 223, 165, 138, 122, 135,
-    95, 223, 59, 190, 157, 16, 97, 227, 133, 104, 170, 212, 242, 222, 109, 163, 246, 178, 11, 51, 238, 65, 57, 198, 50,
-    87, 98, 131, 19, 229, 174, 46, 98, 238, 238, 23, 43, 74, 220, 207, 185, 157, 229, 145, 233, 163, 214, 166, 175, 12,
-    158, 108, 13, 84, 231, 126, 231, 63, 190, 216, 111, 132, 71, 100, 37, 212, 37, 240, 0, 34, 212, 90, 229, 25, 135,
-    153, 40, 25, 163, 180, 153, 247, 117, 152, 167, 4, 75, 119, 19, 238, 239, 105, 242, 82, 130, 227, 168, 193, 253,
-    152, 178, 220, 102, 116, 126, 5, 192, 16, 217, 159, 168, 172, 108, 123, 189, 129, 244, 222, 81, 212, 212, 234, 150,
-    250, 169, 15, 82, 32, 222, 55, 5, 77, 27, 233, 206, 129, 223, 137, 223, 39, 242, 198, 35, 22, 148, 139, 228, 37,
-    167, 15, 78, 83, 113, 18, 164, 136, 98, 235, 216, 254, 187, 1, 177, 51, 130, 163, 149, 245, 193, 19, 200, 119, 122,
-    238, 128, 203, 243, 219, 144, 73, 91, 219, 255, 248, 212, 152, 236, 137, 230, 1, 162, 50, 12, 184, 138, 253, 105,
-    231, 102, 55, 213, 123, 82, 236, 143, 216, 227, 252, 5, 246, 63, 54, 218, 134, 141, 93, 77, 217, 71, 55, 229, 137,
-    233, 18, 40, 99, 209, 120, 23, 124, 251, 167, 211, 236, 109, 152, 191, 125, 173, 78, 107, 165, 63, 62, 186, 172, 82,
-    15, 217, 159, 162, 248, 37, 162, 80, 46, 58, 40, 118, 135, 242, 111, 129, 174, 230, 231, 6, 140, 63, 88, 224, 71,
-    81, 210, 171, 28, 83, 215, 253, 194, 80, 111, 124, 141, 203, 65, 92, 163, 235, 2, 221, 127, 94, 106, 62, 211, 254,
-    212, 43, 227, 236, 248, 12, 20, 219, 160, 237, 56, 189, 121, 236, 215, 152, 145, 104, 239, 82, 205, 47, 222, 170,
-    222, 83, 237, 134, 33, 58, 136, 242, 217, 22, 39, 166, 78, 76, 8, 148, 189, 96, 106, 104, 163, 242, 172, 65, 28,
-    149, 106, 61, 38, 51, 19, 15, 196, 204, 57, 77, 67, 21, 140, 148, 3, 107, 225, 71, 227, 232, 199, 12, 3, 79, 121,
-    206, 35, 5, 151, 14, 9, 73, 18, 189, 72, 215, 172, 3, 186, 89, 141, 252, 78, 210, 113, 25, 232, 99, 243, 3, 64, 100,
-    235, 81, 31, 62, 239, 27, 174, 166, 119, 79, 158, 84, 65, 254, 31, 185, 156, 117, 244, 154, 104, 87, 86, 229, 169,
-    154, 46, 74, 100, 129, 215, 22, 49, 136, 39, 254, 68, 130, 83, 78, 106, 183, 204, 48, 71, 225, 1, 45, 112, 235, 168,
-    104, 223, 196, 192, 197, 150, 209, 239, 72, 121, 168, 244, 248, 3, 77, 90, 44, 46, 90, 78, 179, 28, 150, 252, 254,
-    194, 226, 185, 223, 116, 169, 117, 209, 208, 63, 21, 2, 21, 169, 237, 102, 63, 18, 187, 119, 1, 23, 150, 162, 42,
-    77, 224, 169, 27, 218, 186, 77, 64, 140, 2, 219, 38, 153, 242, 27, 242, 201, 179, 194, 76, 164, 158, 216, 187, 157,
-    36, 74, 209, 100, 90, 144, 207, 101, 102, 52, 123, 216, 101, 89, 238, 43, 17, 63, 151, 66, 195, 149, 26, 247, 69,
-    210, 208, 40, 58, 32, 176, 94, 237, 130, 123, 34, 222, 137, 254, 70, 130, 81, 2, 209, 40, 228, 132, 247, 205, 194,
-    118, 160, 144, 180, 136, 254, 146, 94, 247, 224, 123, 44, 131, 251, 179, 153, 26, 231, 84, 175, 199, 234, 32, 34,
-    173, 73, 162, 13, 46, 151, 72, 14, 228, 178, 201, 142, 116, 215, 143, 161, 100, 27, 221, 77, 93, 181, 69, 174, 82,
-    245, 17, 17, 224, 115, 21, 19, 127, 90, 56, 225, 140, 105, 22, 245, 203, 238, 158, 106, 157, 4, 21, 172, 131, 195,
-    206, 249, 157, 255, 223, 52, 107, 150, 243, 218, 242, 101, 58, 65, 162, 181, 246, 23, 182, 111, 68, 231, 227, 169,
-    218, 155, 216, 235, 21, 165, 190, 129, 199, 145, 39, 215, 222, 93, 252, 43, 170, 42, 95, 132, 251, 190, 154, 228,
-    179, 165, 14, 192, 227, 23, 220, 236, 129, 246, 82, 55, 79, 236, 92, 42, 158, 28, 100, 200, 72, 231, 81, 98, 233,
-    83, 235, 0, 111, 219, 81, 165, 41, 199, 167, 126, 128, 134, 145, 142, 248, 120, 50, 111, 79, 17, 217, 106, 130, 32,
-    21, 193, 106, 75, 130, 77, 137, 142, 47, 171, 96, 215, 64, 54, 171, 38, 44, 25, 78, 169, 51, 163, 48, 241, 243, 54,
-    157, 93, 144, 167, 122, 141, 110, 220, 10, 119, 123, 124, 245, 76, 117, 23, 167, 194, 199, 40, 22, 80, 125, 82, 14,
-    212, 55, 217, 80, 164, 93, 254, 98, 53, 34, 234, 160, 100, 150, 64, 130, 190, 93, 28, 31, 40, 76, 194, 150, 153, 36,
-    28, 54, 20, 119, 22, 239, 9, 5, 58, 50, 196, 167, 32, 189, 213, 14, 252, 131, 175, 172, 54, 119, 116, 205, 38, 82,
-    10, 61, 72, 31, 129, 62, 35, 51, 222, 77, 145, 72, 213, 14, 83, 85, 75, 45, 23, 28, 118, 149, 119, 43, 146, 73, 199,
-    34, 5, 95, 126, 220, 75, 184, 97, 237, 141, 140, 12, 202, 63, 142, 89, 200, 135, 123, 52, 92, 200, 188, 138, 112,
-    89, 83, 133, 195, 191, 220, 82, 236, 121, 132, 115, 38, 127, 106, 98, 14, 86, 193, 11, 180, 208, 167, 244, 148, 109,
-    14, 86, 223, 214, 236, 106, 91, 249, 167, 118, 236, 210, 234, 1, 249, 159, 55, 137, 97, 43, 93, 212, 130, 249, 234,
-    177, 230, 46, 134, 235, 207, 137, 49, 108, 124, 191, 5, 253, 58, 34, 240, 28, 128, 169, 38, 32, 5, 108, 82, 94, 106,
-    21, 159, 31, 118, 33, 79, 253, 249, 169, 250, 11, 141, 150, 30, 78, 83, 5, 44, 53, 85, 67, 233, 182, 8, 190, 23, 62,
-    243, 192, 209, 68, 228, 185, 186, 48, 249, 206, 101, 232, 140, 119, 240, 172, 124, 70, 97, 115, 148, 153, 129, 254,
-    250, 194, 41, 201, 7, 57, 57, 245, 8, 158, 57, 65, 220, 146, 172, 105, 77, 183, 3, 98, 69, 225, 252, 197, 82, 102,
-    36, 251, 88, 97, 238, 226, 189, 162, 88, 10, 255, 233, 31, 74, 194, 75, 173, 228, 49, 111, 255, 55, 67, 131, 167, 8,
-    154, 128, 170, 18, 167, 12, 60, 224, 29, 215, 118, 33, 152, 81, 83, 102, 135, 99, 146, 227, 92, 241, 80, 78, 8, 25,
-    8, 85, 207, 167, 178, 107, 62, 212, 206, 163, 167, 68, 24, 46, 207, 108, 235, 180, 228, 115, 228, 218, 45, 3, 183,
-    205, 33, 87, 102, 177, 73, 188, 71, 112, 39, 103, 170, 46, 238, 59, 139, 140, 228, 229, 193, 214, 241, 108, 6, 202,
-    94, 168, 191, 211, 85, 156, 249, 69, 125, 74, 37, 90, 222, 154, 159, 216, 24, 199, 174, 180, 28, 220, 159, 76, 144,
-    15, 44, 133, 91, 12, 74, 90, 187, 85, 4, 105, 154, 85, 109, 212, 116, 230, 17, 206, 229, 120, 202, 84, 125, 105,
-    171, 13, 188, 114, 144, 130, 44, 8, 236, 255, 9, 106, 255, 18, 184, 130, 157, 214, 221, 223, 29, 123, 235, 48, 126,
-    53, 150, 18, 182, 146, 251, 57, 169, 28, 92, 113, 110, 131, 217, 214, 227, 106, 78, 135, 24, 128, 40, 146, 222, 218,
-    13, 26, 213, 222, 198, 109, 198, 152, 168, 186, 110, 182, 128, 255, 0, 102, 228, 60, 203, 136, 59, 216, 22, 87, 223,
-    98, 108, 60, 239, 112, 114, 27, 155, 253, 62, 198, 109, 214, 1, 199, 104, 228, 3, 134, 66, 219, 141, 191, 191, 42,
-    172, 10, 62, 15, 133, 111, 233, 118, 15, 124, 202, 243, 62, 183, 6, 56, 173, 153, 63, 119, 113, 134, 48, 252, 244,
-    43, 197, 59, 69, 190, 31, 5, 125, 160, 191, 241, 16, 234, 118, 148, 176, 86, 27, 235, 157, 43, 6, 59, 88, 7, 236,
-    198, 183, 194, 216, 92, 152, 85, 189, 18, 55, 169, 199, 249, 236, 240, 119, 7, 206, 139, 116, 18, 158, 4, 237, 3,
-    119, 1, 77, 193, 182, 20, 147, 59, 247, 243, 174, 59, 59, 55, 0, 159, 97, 63, 123, 240, 213, 100, 215, 26, 33, 249,
-    240, 212, 49, 155, 13, 1, 124, 110, 210, 217, 86, 12, 120, 161, 238, 75, 111, 124, 6, 164, 183, 43, 20, 88, 103, 40,
-    95, 66, 157, 121, 225, 249, 106, 172, 126, 236, 195, 229, 31, 83, 48, 247, 111, 114, 88, 143, 130, 115, 98, 81, 71,
-    178, 177, 192, 32, 161, 240, 22, 184, 182, 65, 45, 109, 142, 157, 114, 126, 159, 143, 149, 122, 181, 213, 103, 11,
-    24, 235, 202, 4, 185, 87, 15, 150, 176, 188, 244, 205, 138, 2, 36, 87, 172, 35, 37, 72, 56, 40, 199, 189, 150, 202,
-    134, 75, 84, 8, 64, 97, 25, 246, 181, 216, 178, 137, 169, 194, 110, 150, 14, 129, 237, 58, 11, 141, 76, 220, 117,
-    41, 218, 18, 150, 51, 238, 21, 167, 214, 215, 134, 133, 224, 41, 102, 104, 167, 178, 128, 226, 86, 162, 53, 202,
-    120, 28, 162, 251, 184, 151, 141, 157, 221, 168, 122, 15, 85, 87, 100, 230, 188, 85, 52, 9, 77, 36, 106, 174, 217,
-    78, 131, 57, 248, 9, 95, 247, 254, 19, 117, 30, 181, 157, 230, 68, 182, 225, 110, 162, 105, 153, 156, 174, 124, 76,
-    129, 108, 99, 65, 134, 149, 29, 99, 231, 8, 244, 220, 220, 200, 176, 252, 37, 172, 84, 155, 139, 79, 137, 98, 11,
-    110, 225, 174, 77, 142, 85, 56, 13, 67, 249, 12, 99, 217, 17, 178, 15, 230, 124, 252, 113, 65, 46, 15, 137, 161,
-    245, 76, 50, 75, 176, 36, 101, 109, 187, 242, 86, 232, 197, 22, 139, 108, 83, 39, 240, 148, 149, 252, 157, 244, 3,
-    195, 125, 114, 57, 165, 236, 131, 73, 58, 254, 18, 70, 40, 161, 230, 216, 20, 128, 65, 4, 251, 157, 64, 198, 131,
-    53, 86, 104, 207, 11, 67, 50, 56, 57, 44, 15, 121, 168, 245, 224, 168, 226, 119, 153, 125, 38, 207, 90, 170, 160,
-    238, 173, 98, 77, 139, 122, 106, 42, 82, 141, 6, 88, 182, 181, 28, 235, 103, 187, 226, 102, 196, 187, 120, 158, 74,
-    95, 26, 109, 247, 81, 101, 197, 222, 97, 66, 77, 83, 120, 4, 87, 4, 184, 106, 14, 146, 218, 130, 140, 228, 18, 211,
-    254, 108, 169, 136, 216, 88, 157, 130, 68, 250, 131, 210, 108, 251, 123, 17, 190, 242, 181, 195, 60, 196, 31, 51,
-    65, 117, 124, 122, 173, 160, 71, 18, 243, 162, 156, 72, 97, 119, 4, 246, 88, 3, 79, 89, 64, 255, 129, 21, 88, 168,
-    98, 72, 248, 114, 51, 224, 129, 3, 87, 49, 84, 153, 248, 144, 212, 154, 230, 242, 157, 61, 195, 54, 43, 14, 189,
-    147, 9, 160, 2, 40, 184, 24, 166, 94, 88, 181, 20, 11, 174, 116, 248, 22, 140, 189, 225, 15, 143, 210, 201, 52, 88,
-    214, 11, 231, 113, 194, 199, 186, 187, 59, 120, 89, 17, 192, 178, 158, 67, 3, 180, 28, 64, 170, 23, 41, 119, 131,
-    160, 63, 157, 202, 200, 243, 231, 143, 145, 213, 146, 37, 242, 212, 85, 104, 71, 145, 2, 143, 4, 224, 108, 161, 173,
-    216, 141, 139, 79, 247, 166, 104, 2, 244, 90, 50, 239, 211, 3, 55, 248, 107, 6, 221, 162, 86, 21, 12, 231, 225, 145,
-    220, 57, 251, 70, 244, 205, 216, 33, 7, 66, 212, 171, 9, 191, 12, 156, 234, 40, 179, 51, 34, 237, 8, 202, 92, 224,
-    177, 243, 156, 201, 173, 124, 20, 125, 54, 77, 222, 44, 39, 239, 164, 140, 150, 80, 234, 45, 117, 72, 209, 138, 249,
-    11, 82, 248, 42, 147, 42, 186, 130, 19, 92, 201, 73, 178, 91, 12, 224, 87, 142, 65, 58, 130, 0, 215, 100, 76, 172,
-    209, 58, 123, 29, 107, 131, 210, 123, 9, 231, 248, 204, 123, 170, 14, 114, 184, 110, 176, 85, 192, 199, 157, 95,
-    158, 51, 149, 52, 59, 107, 187, 74, 23, 38, 185, 83, 24, 195, 115, 134, 135, 54, 240, 48, 189, 142, 139, 140, 135,
-    241, 75, 33, 168, 173, 34, 156, 214, 189, 177, 161, 81, 215, 222, 209, 181, 245, 28, 110, 118, 241, 141, 132, 223,
-    123, 201, 8, 247, 159, 215, 16, 26, 122, 151, 182, 85, 150, 115, 173, 177, 8, 111, 118, 229, 241, 226, 152, 238,
-    253, 130, 240, 217, 248, 229, 56, 27, 38, 197, 44, 152, 116, 130, 16, 175, 59, 118, 57, 95, 11, 170, 140, 11, 190,
-    69, 159, 56, 179, 84, 247, 43, 20, 150, 240, 40, 195, 95, 250, 231, 189, 90, 171, 179, 214, 202, 54, 27, 170, 239,
-    194, 194, 189, 98, 81, 20, 52, 228, 252, 22, 66, 3, 79, 80, 141, 137, 148, 159, 118, 65, 203, 130, 171, 6, 71, 190,
-    55, 238, 227, 5, 110, 18, 149, 219, 78, 23, 38, 250, 245, 92, 148, 182, 234, 63, 147, 192, 187, 109, 208, 96, 143,
-    147, 223, 40, 172, 210, 136, 43, 183, 61, 125, 207, 22, 35, 187, 85, 139, 213, 234, 200, 93, 191, 234, 53, 254, 236,
-    216, 250, 230, 146, 131, 143, 26, 51, 195, 5, 205, 185, 78, 62, 44, 203, 145, 73, 221, 227, 220, 79, 12, 219, 31,
-    74, 89, 50, 186, 102, 67, 67, 224, 152, 106, 153, 191, 54, 21, 230, 146, 26, 28, 22, 4, 114, 117, 190, 111, 109, 25,
-    145, 15, 92, 106, 243, 187, 69, 25, 4, 254, 230, 116, 245, 109, 165, 44, 106, 36, 205, 93, 234, 38, 81, 117, 80,
-    139, 104, 189, 135, 221, 192, 227, 10, 152, 177, 240, 112, 130, 124, 188, 187, 197, 30, 126, 85, 135, 177, 89, 74,
-    173, 151, 89, 31, 126, 171, 34, 72, 193, 154, 48, 91, 187, 122, 174, 99, 150, 27, 190, 211, 193, 50, 72, 245, 106,
-    37, 189, 22, 234, 134, 176, 43, 107, 106, 205, 88, 84, 202, 203, 136, 22, 37, 200, 28, 188, 9, 122, 211, 186, 170,
-    194, 63, 243, 188, 175, 152, 183, 219, 245, 176, 245, 94, 167, 141, 179, 76, 56, 190, 175, 197, 15, 102, 221, 211,
-    149, 27, 93, 245, 167, 61, 67, 2, 199, 155, 56, 202, 150, 169, 189, 11, 222, 134, 146, 146, 95, 86, 53, 146, 236,
-    197, 66, 3, 155, 72, 95, 78, 157, 15, 44, 227, 93, 31, 8, 142, 55, 63, 183, 187, 3, 113, 236, 214, 214, 14, 142,
-    232, 218, 249, 93, 180, 48, 0, 249, 105, 90, 199, 16, 172, 94, 148, 97, 0, 82, 73, 134, 121, 243, 34, 16, 112, 197,
-    145, 117, 82, 58, 244, 9, 69, 225, 219, 237, 80, 55, 12, 6, 16, 11, 140, 172, 233, 91, 218, 28, 203, 68, 215, 52,
-    240, 189, 225, 143, 134, 229, 115, 115, 107, 139, 172, 104, 167, 231, 181, 156, 207, 234, 95, 26, 178, 180, 189,
-    198, 197, 226, 130, 44, 8, 38, 138, 203, 206, 117, 120, 211, 180, 10, 5, 199, 78, 27, 62, 19, 93, 236, 241, 239, 29,
-    165, 175, 211, 242, 156, 222, 70, 122, 74, 65, 244, 232, 38, 54, 178, 159, 115, 181, 99, 6, 92, 5, 109, 71, 230, 63,
-    28, 55, 193, 137, 148, 187, 42, 70, 241, 220, 169, 124, 164, 62, 220, 68, 125, 168, 94, 146, 99, 71, 35, 93, 97,
-    235, 239, 49, 245, 115, 97, 109, 120, 132, 70, 159, 254, 48, 191, 223, 234, 205, 188, 112, 238, 188, 3, 67, 39, 14,
-    33, 80, 11, 249, 4, 254, 176, 124, 170, 225, 226, 91, 2, 122, 46, 246, 161, 243, 19, 195, 114, 140, 84, 148, 184,
-    179, 89, 191, 224, 239, 199, 125, 243, 163, 174, 177, 146, 228, 56, 235, 35, 240, 189, 214, 152, 199, 224, 82, 141,
-    223, 14, 155, 230, 158, 72, 165, 139, 120, 216, 209, 47, 22, 216, 194, 209, 34, 16, 208, 112, 196, 84, 149, 219,
-    222, 66, 244, 201, 16, 39, 44, 39, 202, 178, 148, 254, 66, 154, 227, 107, 241, 194, 219, 64, 67, 61, 194, 76, 210,
-    244, 11, 35, 225, 241, 235, 79, 117, 108, 67, 24, 137, 217, 243, 50, 250, 79, 52, 120, 2, 126, 222, 149, 42, 157,
-    127, 29, 27, 29, 221, 78, 200, 21, 74, 95, 214, 247, 213, 7, 247, 117, 202, 46, 224, 243, 55, 213, 157, 23, 115,
-    182, 31, 54, 57, 199, 150, 25, 1, 247, 174, 191, 218, 149, 237, 112, 193, 214, 34, 206, 50, 14, 180, 212, 107, 209,
-    139, 50, 48, 161, 113, 144, 181, 36, 142, 0, 46, 140, 148, 138, 158, 133, 73, 102, 229, 118, 98, 70, 50, 174, 245,
-    187, 152, 136, 103, 79, 68, 87, 24, 245, 123, 161, 65, 165, 58, 205, 255, 45, 17, 40, 251, 14, 221, 187, 149, 213,
-    70, 133, 204, 102, 40, 195, 119, 172, 189, 98, 27, 194, 130, 175, 141, 205, 12, 154, 191, 181, 40, 117, 168, 167,
-    199, 238, 124, 133, 126, 161, 167, 240, 66, 16, 19, 16, 18, 174, 212, 201, 38, 60, 54, 105, 146, 218, 236, 169, 223,
-    194, 113, 138, 74, 250, 206, 55, 153, 23, 212, 166, 111, 211, 35, 8, 215, 236, 61, 252, 140, 70, 205, 17, 71, 236,
-    140, 121, 109, 30, 114, 99, 140, 9, 0, 215, 177, 147, 123, 12, 229, 112, 247, 191, 185, 206, 68, 56, 105, 239, 54,
-    133, 51, 179, 166, 243, 56, 152, 229, 37, 209, 220, 66, 23, 15, 30, 125, 166, 133, 24, 24, 128, 221, 133, 229, 112,
-    165, 65, 44, 255, 77, 193, 249, 27, 146, 193, 20, 175, 116, 82, 22, 225, 116, 71, 42, 62, 71, 252, 214, 184, 94, 3,
-    38, 194, 232, 231, 149, 195, 84, 50, 87, 201, 187, 86, 171, 154, 172, 68, 40, 232, 228, 16, 169, 45, 168, 70, 99,
-    36, 78, 82, 51, 101, 22, 49, 164, 6, 171, 250, 150, 68, 32, 96, 119, 130, 226, 156, 149, 33, 112, 124, 12, 123, 254,
-    234, 205, 70, 53, 37, 209, 136, 26, 191, 92, 96, 209, 65, 181, 240, 160, 31, 49, 188, 31, 73, 19, 197, 78, 190, 117,
-    120, 103, 121, 167, 67, 136, 184, 78, 188, 201, 154, 95, 7, 125, 199, 0, 239, 22, 50, 112, 121, 191, 120, 85, 183,
-    87, 103, 169, 13, 212, 72, 69, 136, 187, 46, 4, 228, 76, 168, 49, 34, 72, 141, 183, 246, 201, 172, 34, 81, 229, 96,
-    130, 90, 208, 93, 225, 107, 51, 43, 190, 133, 135, 137, 139, 236, 72, 51, 162, 166, 227, 181, 101, 172, 80, 192,
-    193, 254, 3, 55, 80, 10, 190, 146, 94, 229, 126, 193, 151, 145, 149, 227, 231, 137, 104, 186, 116, 108, 136, 106,
-    140, 42, 57, 221, 100, 55, 161, 143, 102, 53, 141, 149, 62, 226, 119, 54, 88, 197, 167, 76, 59, 71, 138, 168, 63,
-    75, 205, 210, 186, 104, 176, 71, 150, 113, 46, 164, 217, 91, 254, 215, 206, 78, 44, 16, 147, 129, 233, 36, 91, 237,
-    22, 44, 141, 233, 193, 53, 151, 81, 11, 8, 236, 209, 247, 183, 136, 234, 180, 102, 249, 158, 154, 155, 37, 10, 90,
-    48, 89, 197, 242, 91, 99, 225, 165, 82, 40, 222, 72, 126, 43, 7, 13, 6, 24, 49, 3, 58, 183, 205, 242, 7, 127, 70,
-    187, 200, 176, 40, 56, 240, 240, 237, 78, 72, 172, 65, 102, 238, 125, 208, 182, 163, 220, 239, 25, 72, 189, 236,
-    141, 212, 253, 127, 215, 82, 138, 50, 224, 155, 170, 202, 19, 13, 217, 164, 52, 133, 154, 175, 166, 47, 50, 30, 66,
-    155, 76, 58, 26, 191, 104, 254, 172, 247, 131, 166, 153, 162, 113, 165, 210, 169, 57, 218, 38, 127, 248, 111, 98,
-    86, 45, 48, 159, 181, 67, 162, 166, 94, 199, 81, 133, 126, 236, 225, 144, 177, 63, 20, 253, 239, 164, 250, 121, 212,
-    220, 64, 234, 5, 174, 175, 157, 178, 78, 197, 86, 100, 160, 169, 190, 179, 62, 20, 138, 251, 156, 43, 204, 225, 44,
-    249, 51, 48, 103, 43, 117, 53, 128, 29, 144, 192, 84, 169, 58, 250, 212, 66, 77, 206, 159, 84, 182, 125, 247, 85,
-    42, 147, 203, 246, 237, 85, 183, 15, 120, 117, 234, 209, 7, 169, 7, 244, 235, 186, 87, 92, 31, 85, 24, 164, 0, 131,
-    97, 50, 183, 96, 2, 228, 245, 165, 96, 221, 244, 39, 135, 253, 239, 101, 197, 126, 110, 190, 199, 52, 174, 215, 123,
-    197, 76, 222, 189, 55, 71, 161, 71, 118, 1, 203, 68, 70, 194, 150, 53, 56, 232, 126, 185, 215, 63, 213, 166, 50,
-    193, 41, 93, 198, 173, 146, 180, 43, 255, 145, 46, 44, 82, 116, 40, 244, 66, 43, 156, 88, 162, 214, 248, 91, 30, 86,
-    39, 43, 103, 246, 241, 85, 208, 250, 79, 191, 111, 193, 141, 251, 66, 205, 215, 44, 62, 229, 185, 115, 119, 18, 189,
-    111, 215, 16, 88, 7, 162, 187, 185, 162, 196, 13, 10, 192, 84, 71, 124, 34, 188, 41, 236, 241, 220, 208, 248, 114,
-    6, 193, 236, 52, 251, 253, 53, 53, 90, 174, 248, 120, 220, 248, 39, 177, 66, 90, 42, 156, 217, 126, 107, 27, 165,
-    22, 239, 93, 106, 87, 142, 200, 61, 253, 61, 136, 190, 61, 71, 139, 168, 192, 216, 215, 120, 8, 216, 210, 132, 227,
-    230, 89, 85, 237, 116, 11, 93, 123, 195, 198, 50, 138, 134, 201, 239, 3, 209, 214, 160, 218, 154, 112, 40, 116, 253,
-    59, 74, 240, 39, 171, 169, 59, 35, 220, 141, 150, 249, 136, 163, 145, 65, 243, 79, 9, 232, 46, 106, 148, 151, 138,
-    184, 86, 62, 251, 189, 124, 186, 202, 197, 95, 12, 91, 130, 169, 3, 243, 153, 82, 12, 99, 82, 169, 107, 158, 194,
-    11, 236, 243, 81, 217, 255, 40, 35, 250, 57, 159, 123, 157, 48, 166, 118, 79, 27, 137, 211, 97, 170, 11, 104, 178,
-    78, 199, 134, 222, 119, 94, 137, 205, 95, 241, 39, 112, 159, 80, 178, 17, 111, 242, 130, 50, 11, 182, 6, 83, 80, 58,
-    177, 254, 56, 214, 199, 177, 205, 146, 235, 162, 70, 242, 163, 243, 0, 116, 136, 61, 108, 102, 151, 217, 193, 0,
-    238, 130, 101, 1, 113, 45, 223, 14, 104, 63, 3, 99, 189, 25, 63, 27, 89, 77, 117, 209, 143, 86, 212, 160, 28, 39,
-    88, 70, 238, 66, 229, 58, 129, 209, 168, 11, 244, 236, 86, 37, 155, 17, 152, 150, 244, 33, 138, 243, 175, 37, 248,
-    241, 53, 92, 135, 97, 177, 41, 252, 94, 87, 229, 1, 106, 43, 61, 96, 56, 195, 109, 145, 42, 80, 57, 254, 51, 171,
-    40, 170, 26, 10, 172, 48, 181, 34, 81, 14, 164, 180, 164, 95, 3, 59, 231, 50, 116, 13, 255, 16, 14, 242, 219, 56,
-    234, 180, 47, 38, 82, 155, 103, 36, 25, 52, 190, 123, 154, 208, 170, 143, 190, 44, 243, 146, 210, 207, 165, 132,
-    159, 99, 144, 180, 118, 70, 111, 12, 185, 54, 142, 223, 0, 148, 16, 229, 224, 217, 1, 57, 110, 149, 193, 215, 183,
-    224, 205, 36, 89, 119, 196, 122, 228, 100, 117, 63, 226, 132, 189, 32, 232, 63, 168, 238, 75, 150, 184, 237, 180,
-    212, 119, 180, 192, 137, 167, 37, 209, 7, 112, 170, 56, 189, 215, 111, 74, 66, 193, 20, 103, 174, 15, 201, 67, 160,
-    0, 179, 7, 66, 111, 190, 209, 1, 4, 169, 2, 9, 97, 238, 100, 252, 240, 164, 191, 20, 136, 162, 174, 228, 67, 152,
-    159, 95, 217, 97, 60, 22, 137, 203, 154, 248, 154, 28, 231, 23, 251, 89, 132, 138, 112, 189, 254, 141, 235, 116,
-    115, 163, 88, 13, 183, 207, 7, 144, 224, 217, 59, 52, 206, 106, 157, 72, 36, 121, 166, 95, 138, 236, 21, 91, 74, 74,
-    138, 64, 236, 180, 189, 116, 186, 208, 155, 171, 193, 42, 246, 241, 188, 201, 115, 244, 66, 55, 226, 13, 213, 7, 5,
-    163, 219, 44, 220, 16, 117, 200, 175, 114, 34, 232, 110, 197, 103, 175, 224, 72, 98, 108, 73, 42, 202, 12, 215, 97,
-    44, 238, 156, 199, 137, 160, 227, 17, 96, 25, 156, 94, 190, 77, 53, 59, 216, 178, 19, 128, 163, 82, 182, 190, 31,
-    255, 25, 201, 108, 121, 235, 108, 81, 42, 247, 234, 61, 217, 205, 171, 225, 17, 1, 90, 87, 229, 23, 69, 6, 252, 40,
-    178, 118, 213, 27, 86, 64, 125, 147, 144, 82, 50, 42, 34, 241, 246, 99, 174, 236, 99, 174, 203, 33, 190, 145, 52,
-    239, 120, 64, 174, 83, 65, 142, 54, 132, 45, 177, 199, 156, 159, 121, 120, 213, 240, 164, 51, 55, 210, 98, 176, 205,
-    248, 253, 238, 188, 8, 13, 50, 193, 210, 107, 99, 165, 173, 206, 63, 234, 186, 167, 216, 131, 50, 239, 29, 181, 244,
-    131, 248, 149, 50, 103, 161, 79, 52, 232, 59, 208, 83, 118, 30, 125, 215, 116, 196, 31, 157, 195, 215, 189, 114,
-    131, 12, 100, 215, 102, 134, 249, 70, 96, 1, 229, 109, 149, 164, 194, 164, 139, 196, 255, 15, 213, 251, 153, 254,
-    89, 95, 150, 160, 19, 111, 141, 42, 247, 79, 147, 69, 225, 5, 71, 76, 148, 16, 223, 183, 164, 60, 238, 88, 108, 145,
-    67, 230, 156, 150, 139, 101, 47, 69, 197, 165, 193, 203, 173, 30, 199, 215, 200, 35, 125, 118, 3, 192, 146, 185,
-    124, 239, 117, 181, 199, 138, 44, 173, 35, 147, 220, 155, 39, 136, 203, 144, 23, 154, 56, 30, 228, 127, 229, 220,
-    215, 187, 5, 207, 49, 145, 231, 148, 126, 37, 193, 124, 179, 17, 215, 145, 222, 216, 148, 190, 253, 19, 62, 170,
-    228, 78, 140, 26, 55, 137, 243, 184, 124, 175, 42, 238, 240, 172, 251, 190, 54, 25, 177, 198, 20, 151, 68, 234, 203,
-    126, 34, 205, 252, 157, 127, 226, 226, 64, 170, 255, 122, 139, 28, 248, 222, 180, 30, 99, 126, 8, 149, 74, 9, 11,
-    115, 24, 154, 40, 209, 25, 26, 183, 163, 60, 68, 226, 237, 142, 188, 92, 136, 51, 79, 16, 84, 64, 49, 1, 30, 61, 17,
-    213, 160, 65, 240, 30, 117, 103, 137, 211, 182, 8, 238, 187, 132, 44, 141, 36, 11, 26, 40, 111, 41, 142, 201, 229,
-    37, 145, 185, 41, 221, 105, 188, 167, 183, 246, 71, 132, 205, 187, 101, 225, 219, 125, 242, 121, 105, 119, 111, 114,
-    158, 81, 31, 150, 207, 161, 13, 70, 178, 192, 132, 102, 206, 75, 34, 44, 221, 240, 72, 85, 46, 111, 142, 12, 73,
-    177, 209, 39, 172, 233, 75, 54, 39, 68, 42, 52, 66, 181, 87, 53, 80, 129, 127, 89, 138, 44, 24, 30, 158, 58, 176,
-    231, 18, 41, 118, 5, 255, 120, 172, 102, 110, 196, 23, 140, 55, 129, 2, 142, 236, 113, 180, 146, 115, 37, 125, 194,
-    208, 5, 121, 250, 38, 189, 128, 224, 199, 35, 95, 175, 54, 18, 142, 81, 196, 226, 8, 136, 130, 184, 29, 137, 141,
-    220, 162, 239, 75, 122, 196, 109, 132, 83, 179, 208, 216, 46, 91, 225, 203, 36, 42, 41, 53, 225, 26, 97, 200, 94,
-    137, 82, 155, 154, 124, 230, 80, 234, 148, 73, 68, 84, 93, 60, 37, 40, 228, 146, 6, 144, 53, 185, 236, 212, 8, 16,
-    80, 6, 255, 77, 237, 87, 54, 40, 105, 35, 126, 138, 5, 31, 218, 15, 118, 139, 70, 149, 197, 89, 223, 250, 154, 232,
-    233, 245, 32, 122, 221, 25, 59, 123, 179, 95, 69, 91, 170, 108, 139, 41, 157, 145, 154, 64, 71, 119, 220, 158, 94,
-    144, 78, 200, 113, 99, 29, 188, 59, 134, 229, 103, 110, 185, 215, 213, 86, 252, 54, 234, 10, 47, 131, 107, 219, 175,
-    27, 240, 118, 252, 153, 151, 93, 240, 119, 132, 232, 165, 133, 230, 36, 226, 95, 136, 16, 239, 92, 246, 206, 181,
-    214, 30, 45, 219, 188, 8, 122, 236, 83, 48, 204, 245, 57, 191, 247, 11, 154, 177, 154, 195, 85, 0, 229, 49, 29, 29,
-    201, 184, 89, 232, 165, 1, 76, 10, 210, 228, 21, 171, 100, 173, 211, 26, 234, 35, 46, 143, 103, 9, 117, 6, 213, 117,
-    175, 253, 113, 108, 23, 144, 162, 10, 1, 102, 55, 92, 245, 140, 183, 31, 201, 26, 95, 16, 118, 79, 157, 0, 222, 144,
-    213, 147, 6, 154, 57, 171, 13, 41, 10, 45, 232, 242, 182, 201, 113, 72, 188, 14, 150, 34, 6, 142, 72, 87, 128, 207,
-    22, 29, 69, 224, 21, 245, 119, 207, 217, 212, 6, 60, 117, 211, 214, 162, 84, 153, 240, 32, 138, 152, 173, 26, 247,
-    193, 32, 27, 166, 37, 158, 98, 159, 61, 156, 120, 23, 179, 210, 162, 63, 253, 20, 46, 250, 50, 172, 124, 14, 5, 29,
-    49, 10, 219, 237, 98, 252, 22, 182, 225, 135, 149, 230, 231, 205, 41, 56, 35, 112, 118, 161, 37, 91, 240, 13, 45,
-    128, 46, 182, 217, 48, 180, 200, 125, 15, 40, 8, 28, 143, 223, 38, 252, 64, 162, 142, 159, 162, 48, 137, 83, 80,
-    110, 154, 172, 18, 242, 174, 41, 218, 179, 141, 60, 26, 7, 203, 169, 65, 210, 253, 67, 201, 201, 67, 166, 229, 184,
-    4, 42, 31, 39, 224, 118, 7, 96, 196, 146, 171, 38, 38, 186, 195, 199, 185, 64, 111, 251, 205, 41, 27, 243, 98, 115,
-    14, 138, 26, 93, 144, 28, 165, 179, 138, 7, 177, 178, 222, 59, 21, 237, 196, 36, 90, 212, 133, 204, 227, 206, 36,
-    123, 162, 195, 241, 225, 212, 181, 240, 26, 181, 167, 164, 165, 125, 205, 29, 166, 18, 27, 126, 232, 75, 66, 34,
-    228, 4, 155, 27, 187, 190, 195, 116, 117, 129, 43, 12, 49, 248, 152, 177, 14, 211, 255, 80, 127, 75, 180, 84, 7,
-    221, 179, 148, 7, 220, 47, 159, 208, 105, 218, 255, 193, 241, 191, 23, 162, 220, 75, 209, 182, 54, 15, 234, 227, 64,
-    145, 66, 38, 213, 209, 124, 253, 214, 184, 57, 23, 129, 66, 100, 245, 69, 168, 242, 64, 153, 12, 228, 147, 161, 238,
-    210, 80, 155, 51, 5, 216, 2, 143, 112, 243, 60, 19, 228, 240, 7, 25, 184, 141, 181, 235, 219, 251, 26, 85, 219, 15,
-    216, 144, 117, 235, 14, 213, 211, 17, 94, 61, 200, 214, 110, 10, 15, 24, 28, 1, 51, 178, 99, 249, 109, 252, 24, 213,
-    213, 124, 182, 58, 89, 43, 251, 153, 40, 31, 68, 7, 206, 102, 8, 41, 237, 194, 96, 156, 148, 81, 253, 67, 71, 132,
-    1, 29, 21, 168, 149, 140, 131, 47, 45, 203, 72, 141, 74, 26, 103, 228, 91, 208, 145, 184, 70, 47, 50, 109, 73, 96,
-    83, 40, 251, 22, 41, 185, 80, 129, 43, 85, 92, 70, 22, 21, 86, 67, 1, 230, 207, 123, 44, 13, 168, 44, 42, 64, 23,
-    233, 218, 74, 122, 188, 15, 185, 89, 226, 65, 201, 80, 113, 33, 107, 131, 173, 104, 114, 242, 248, 186, 24, 33, 95,
-    188, 150, 221, 0, 72, 165, 63, 88, 8, 9, 173, 249, 163, 29, 163, 62, 8, 33, 54, 192, 80, 246, 173, 79, 173, 33, 185,
-    40, 154, 137, 5, 123, 43, 110, 222, 188, 146, 147, 198, 201, 28, 157, 217, 90, 161, 228, 246, 44, 172, 56, 114, 115,
-    194, 163, 11, 24, 227, 238, 66, 160, 173, 203, 176, 135, 245, 196, 0, 229, 92, 123, 23, 155, 251, 94, 34, 107, 117,
-    178, 30, 66, 58, 87, 185, 247, 3, 9, 137, 187, 137, 252, 36, 11, 232, 210, 145, 70, 107, 227, 204, 162, 71, 208, 7,
-    132, 46, 32, 210, 255, 247, 157, 35, 177, 77, 253, 134, 119, 212, 190, 166, 126, 200, 218, 140, 84, 249, 153, 174,
-    142, 1, 240, 143, 248, 190, 14, 195, 165, 215, 212, 169, 244, 190, 107, 223, 26, 178, 176, 13, 49, 110, 208, 8, 125,
-    192, 122, 1, 246, 104, 138, 183, 190, 244, 87, 59, 246, 84, 217, 215, 1, 25, 112, 239, 57, 72, 76, 251, 150, 197,
-    76, 161, 34, 109, 34, 31, 173, 189, 99, 68, 142, 105, 96, 93, 14, 190, 183, 89, 49, 20, 253, 173, 34, 161, 214, 235,
-    238, 195, 42, 161, 175, 239, 123, 31, 78, 199, 36, 70, 142, 204, 135, 135, 177, 161, 160, 233, 162, 113, 156, 88,
-    100, 52, 18, 193, 221, 185, 126, 35, 124, 84, 132, 176, 44, 212, 219, 112, 35, 78, 235, 197, 9, 121, 188, 88, 227,
-    95, 33, 141, 144, 99, 186, 64, 132, 236, 79, 244, 6, 177, 244, 145, 168, 87, 185, 39, 101, 38, 231, 130, 170, 9, 89,
-    117, 68, 84, 57, 123, 143, 56, 40, 152, 157, 85, 189, 66, 196, 124, 13, 98, 26, 180, 38, 168, 36, 98, 39, 109, 183,
-    30, 11, 40, 179, 171, 74, 91, 217, 202, 178, 92, 254, 136, 30, 26, 1, 150, 28, 64, 154, 239, 80, 76, 233, 219, 153,
-    177, 54, 116, 174, 170, 226, 81, 93, 47, 97, 205, 25, 12, 211, 111, 255, 117, 19, 167, 240, 211, 204, 218, 104, 31,
-    175, 145, 248, 51, 252, 186, 118, 221, 131, 14, 139, 255, 30, 152, 35, 99, 233, 89, 61, 109, 231, 125, 178, 238,
-    250, 54, 252, 69, 12, 210, 45, 104, 178, 106, 255, 19, 139, 98, 127, 75, 217, 75, 38, 123, 194, 25, 224, 224, 171,
-    176, 95, 189, 16, 107, 216, 45, 60, 231, 199, 235, 82, 112, 73, 182, 210, 219, 9, 93, 60, 249, 74, 127, 114, 56, 7,
-    32, 255, 252, 244, 78, 107, 115, 228, 60, 133, 215, 111, 32, 87, 177, 228, 25, 126, 199, 67, 21, 89, 127, 222, 112,
-    28, 181, 72, 76, 100, 246, 65, 183, 193, 212, 170, 91, 174, 184, 15, 234, 208, 85, 177, 95, 123, 138, 27, 159, 153,
-    45, 83, 101, 134, 176, 47, 125, 137, 92, 58, 203, 11, 223, 194, 153, 157, 229, 86, 58, 119, 34, 193, 239, 183, 138,
-    168, 47, 161, 79, 153, 237, 28, 169, 209, 31, 111, 225, 21, 73, 162, 2, 174, 3, 17, 101, 143, 202, 220, 166, 190,
-    54, 2, 202, 119, 219, 67, 224, 177, 162, 66, 236, 162, 132, 199, 124, 135, 122, 232, 226, 215, 216, 56, 146, 214,
-    224, 215, 195, 213, 55, 76, 148, 138, 91, 90, 217, 235, 101, 204, 160, 61, 37, 22, 24, 248, 205, 128, 147, 19, 46,
-    133, 191, 178, 117, 207, 163, 21, 119, 60, 114, 160, 25, 68, 65, 131, 27, 227, 94, 197, 113, 102, 137, 210, 29, 99,
-    15, 0, 54, 54, 132, 225, 141, 42, 88, 20, 245, 76, 114, 225, 128, 66, 30, 231, 126, 250, 128, 201, 94, 252, 5, 198,
-    143, 117, 205, 123, 59, 51, 18, 143, 109, 106, 169, 69, 68, 112, 211, 83, 80, 193, 8, 199, 246, 171, 205, 133, 197,
-    188, 232, 161, 124, 116, 76, 22, 204, 235, 79, 225, 21, 211, 111, 158, 233, 245, 35, 84, 119, 119, 217, 124, 226,
-    159, 173, 30, 112, 62, 10, 99, 73, 139, 134, 212, 239, 103, 127, 123, 67, 113, 193, 187, 248, 130, 250, 56, 37, 245,
-    91, 132, 152, 200, 148, 215, 168, 39, 120, 251, 16, 222, 178, 251, 146, 106, 174, 28, 27, 178, 182, 231, 164, 240,
-    234, 99, 54, 180, 28, 105, 230, 200, 95, 237, 219, 79, 150, 178, 133, 56, 221, 87, 240, 183, 173, 160, 88, 99, 95,
-    222, 102, 223, 35, 16, 41, 126, 164, 169, 55, 51, 201, 191, 66, 144, 85, 4, 29, 81, 4, 123, 148, 12, 129, 99, 83,
-    181, 236, 105, 96, 74, 108, 87, 58, 124, 189, 190, 147, 200, 225, 158, 183, 10, 131, 51, 65, 163, 206, 110, 142,
-    124, 92, 44, 200, 175, 176, 162, 10, 160, 238, 215, 193, 183, 127, 133, 24, 113, 48, 144, 202, 89, 141, 198, 89, 96,
-    200, 236, 252, 105, 100, 142, 58, 124, 99, 78, 127, 199, 5, 74, 51, 12, 83, 74, 146, 229, 15, 245, 41, 126, 129, 13,
-    71, 168, 49, 221, 235, 3, 113, 85, 38, 110, 146, 5, 57, 67, 51, 232, 175, 168, 227, 161, 29, 136, 59, 144, 146, 136,
-    93, 48, 111, 92, 117, 206, 247, 154, 130, 109, 238, 14, 44, 163, 18, 208, 249, 75, 70, 83, 12, 101, 177, 239, 165,
-    90, 181, 5, 30, 162, 73, 64, 24, 211, 135, 129, 15, 117, 120, 253, 131, 206, 244, 99, 223, 165, 230, 162, 41, 28,
-    80, 62, 68, 252, 183, 29, 153, 208, 120, 145, 144, 65, 179, 185, 26, 161, 90, 20, 70, 183, 242, 191, 92, 115, 31,
-    30, 107, 43, 135, 99, 127, 40, 126, 164, 6, 46, 156, 68, 244, 224, 139, 41, 122, 61, 3, 198, 11, 192, 144, 84, 116,
-    79, 28, 119, 130, 252, 164, 188, 192, 26, 244, 30, 78, 241, 161, 166, 192, 116, 107, 54, 42, 168, 250, 74, 45, 228,
-    182, 78, 248, 202, 143, 151, 226, 51, 4, 148, 192, 60, 27, 228, 49, 187, 187, 143, 20, 21, 92, 98, 171, 1, 9, 22,
-    164, 8, 100, 32, 27, 217, 39, 90, 77, 115, 104, 230, 81, 103, 2, 223, 251, 231, 29, 57, 140, 34, 187, 28, 229, 60,
-    46, 210, 136, 169, 173, 57, 177, 78, 195, 201, 78, 8, 64, 81, 9, 4, 52, 58, 39, 34, 250, 160, 203, 129, 98, 112, 62,
-    172, 137, 140, 12, 45, 40, 133, 211, 115, 180, 95, 73, 56, 215, 196, 62, 48, 238, 240, 70, 207, 138, 131, 67, 144,
-    188, 31, 135, 216, 85, 69, 68, 226, 23, 14, 77, 232, 212, 255, 23, 95, 147, 183, 43, 120, 95, 35, 232, 42, 204, 132,
-    32, 24, 85, 73, 154, 14, 101, 89, 61, 7, 149, 104, 106, 176, 220, 255, 191, 68, 111, 3, 14, 48, 31, 79, 201, 143,
-    165, 99, 84, 46, 233, 255, 248, 252, 16, 1, 205, 218, 110, 86, 165, 17, 155, 76, 223, 179, 107, 180, 149, 55, 237,
-    71, 72, 144, 127, 171, 10, 165, 183, 119, 174, 129, 70, 44, 40, 61, 164, 22, 167, 121, 111, 70, 199, 32, 111, 198,
-    234, 147, 183, 196, 222, 204, 197, 216, 72, 232, 148, 17, 66, 9, 88, 74, 3, 115, 35, 187, 203, 14, 136, 151, 3, 132,
-    150, 163, 176, 130, 43, 136, 220, 115, 154, 54, 40, 244, 90, 64, 117, 149, 39, 149, 201, 242, 0, 45, 212, 93, 18,
-    120, 160, 11, 167, 185, 212, 184, 204, 120, 254, 194, 18, 204, 150, 170, 223, 99, 122, 251, 108, 115, 57, 198, 227,
-    64, 239, 155, 198, 152, 12, 48, 1, 61, 92, 100, 149, 207, 200, 222, 53, 82, 1, 141, 157, 202, 177, 214, 104, 104,
-    187, 46, 99, 78, 90, 247, 238, 51, 185, 141, 13, 48, 55, 208, 121, 79, 29, 10, 0, 130, 98, 73, 62, 110, 163, 54,
-    241, 229, 150, 232, 227, 74, 115, 134, 124, 204, 187, 156, 64, 223, 114, 155, 173, 124, 232, 53, 114, 183, 100, 170,
-    178, 61, 171, 98, 54, 157, 131, 225, 111, 134, 217, 47, 136, 254, 189, 139, 23, 107, 205, 125, 156, 89, 34, 145, 64,
-    173, 15, 72, 214, 67, 80, 15, 83, 196, 27, 205, 137, 201, 229, 168, 113, 197, 134, 156, 147, 196, 182, 39, 111, 126,
-    154, 4, 217, 28, 136, 182, 254, 189, 223, 108, 90, 72, 180, 238, 77, 128, 79, 246, 144, 28, 34, 14, 129, 246, 205,
-    131, 229, 152, 103, 163, 253, 52, 91, 129, 255, 234, 234, 183, 178, 118, 2, 242, 71, 234, 91, 52, 134, 29, 124, 16,
-    226, 92, 227, 157, 86, 162, 235, 166, 76, 79, 184, 112, 104, 148, 163, 226, 173, 220, 61, 84, 254, 162, 3, 187, 212,
-    37, 217, 127, 199, 136, 239, 137, 183, 187, 88, 179, 31, 223, 47, 203, 15, 54, 135, 232, 225, 205, 236, 137, 253,
-    198, 12, 102, 102, 123, 56, 104, 115, 99, 205, 8, 104, 199, 65, 192, 24, 222, 94, 146, 100, 217, 11, 100, 205, 75,
-    144, 3, 217, 173, 63, 173, 71, 36, 147, 14, 114, 129, 53, 41, 125, 144, 134, 88, 52, 231, 29, 152, 4, 162, 202, 56,
-    88, 38, 186, 240, 99, 253, 55, 148, 41, 163, 138, 225, 152, 144, 65, 145, 143, 113, 190, 41, 53, 215, 158, 251, 223,
-    4, 39, 65, 69, 66, 243, 28, 41, 217, 251, 175, 100, 10, 120, 157, 202, 231, 27, 110, 93, 208, 10, 8, 254, 250, 207,
-    36, 168, 168, 148, 174, 136, 151, 148, 36, 88, 93, 246, 129, 214, 118, 127, 76, 7, 138, 63, 173, 175, 111, 163, 230,
-    57, 140, 196, 103, 102, 195, 174, 57, 118, 71, 35, 71, 106, 15, 151, 46, 249, 111, 246, 122, 43, 65, 187, 172, 56,
-    66, 236, 232, 176, 193, 17, 230, 171, 110, 81, 42, 45, 200, 1, 137, 23, 151, 46, 170, 94, 34, 117, 14, 5, 104, 110,
-    168, 172, 138, 143, 30, 67, 4, 63, 231, 130, 214, 123, 32, 166, 191, 124, 213, 168, 58, 95, 72, 125, 237, 79, 128,
-    124, 120, 76, 190, 9, 122, 57, 147, 4, 40, 81, 0, 49, 1, 248, 244, 5, 108, 35, 150, 71, 248, 85, 41, 8, 40, 186, 1,
-    89, 217, 132, 159, 2, 76, 200, 35, 16, 126, 250, 246, 247, 68, 86, 252, 19, 139, 253, 185, 3, 166, 181, 43, 246,
-    218, 212, 173, 96, 155, 48, 116, 23, 154, 21, 251, 196, 68, 170, 236, 152, 144, 207, 156, 42, 212, 181, 109, 16,
-    252, 201, 187, 33, 218, 42, 211, 135, 156, 32, 36, 179, 113, 78, 23, 239, 77, 35, 244, 118, 208, 53, 86, 253, 54,
-    189, 76, 125, 143, 165, 8, 171, 155, 66, 97, 39, 48, 45, 140, 158, 174, 21, 233, 85, 14, 71, 211, 35, 72, 49, 218,
-    19, 105, 211, 126, 9, 66, 141, 131, 173, 196, 133, 103, 213, 111, 255, 199, 36, 90, 207, 62, 154, 70, 148, 68, 36,
-    183, 45, 109, 62, 187, 107, 150, 241, 7, 97, 130, 157, 151, 43, 224, 210, 7, 91, 75, 186, 82, 229, 35, 238, 95, 169,
-    68, 179, 64, 244, 31, 245, 165, 50, 181, 111, 254, 76, 162, 43, 22, 70, 120, 214, 157, 81, 133, 41, 34, 102, 50,
-    152, 125, 248, 179, 112, 96, 197, 98, 183, 12, 199, 88, 228, 105, 182, 46, 60, 252, 156, 234, 104, 193, 87, 89, 131,
-    155, 201, 233, 47, 126, 219, 75, 116, 245, 46, 203, 226, 60, 129, 155, 233, 225, 80, 218, 197, 83, 177, 38, 176, 34,
-    43, 3, 116, 229, 44, 53, 42, 211, 59, 140, 72, 30, 135, 163, 108, 98, 46, 216, 139, 153, 77, 231, 90, 40, 95, 44,
-    234, 245, 12, 107, 155, 157, 126, 45, 95, 154, 216, 136, 180, 63, 115, 23, 253, 244, 64, 199, 193, 17, 26, 205, 165,
-    57, 93, 132, 166, 36, 209, 177, 73, 185, 112, 69, 87, 86, 48, 232, 204, 170, 78, 37, 122, 138, 174, 198, 176, 78,
-    21, 96, 160, 85, 111, 99, 96, 70, 98, 192, 36, 213, 39, 131, 51, 105, 165, 20, 139, 3, 35, 3, 225, 250, 254, 242,
-    28, 31, 36, 255, 219, 224, 150, 129, 206, 79, 238, 148, 64, 59, 219, 110, 71, 28, 93, 235, 83, 213, 63, 67, 66, 219,
-    223, 80, 208, 138, 117, 176, 127, 89, 101, 110, 252, 184, 201, 225, 81, 56, 82, 147, 130, 27, 139, 48, 203, 62, 31,
-    0, 18, 42, 191, 87, 23, 95, 164, 221, 81, 4, 153, 78, 135, 92, 41, 143, 209, 234, 233, 84, 16, 213, 42, 228, 131,
-    124, 84, 38, 224, 211, 153, 134, 186, 83, 61, 253, 189, 102, 206, 87, 131, 26, 168, 185, 165, 12, 141, 225, 71, 16,
-    51, 18, 42, 172, 219, 111, 114, 162, 126, 180, 81, 135, 136, 218, 41, 130, 75, 246, 145, 38, 90, 168, 43, 124, 141,
-    223, 87, 130, 97, 253, 81, 67, 9, 152, 147, 144, 49, 8, 142, 72, 224, 202, 41, 47, 148, 37, 36, 45, 93, 119, 66, 22,
-    143, 185, 20, 230, 86, 188, 219, 240, 9, 243, 114, 140, 225, 91, 202, 106, 63, 51, 27, 79, 222, 36, 207, 159, 188,
-    123, 201, 229, 46, 156, 29, 171, 98, 100, 35, 204, 16, 78, 168, 79, 201, 168, 131, 196, 241, 175, 12, 225, 147, 251,
-    231, 194, 187, 155, 241, 118, 97, 192, 100, 99, 130, 173, 184, 192, 137, 126, 244, 7, 172, 58, 14, 131, 164, 138,
-    201, 241, 5, 192, 154, 183, 238, 34, 110, 158, 94, 145, 140, 33, 201, 58, 102, 215, 104, 97, 70, 225, 48, 119, 49,
-    175, 60, 59, 210, 107, 96, 194, 248, 145, 87, 174, 153, 93, 99, 181, 181, 83, 145, 47, 43, 38, 31, 240, 96, 169,
-    232, 85, 50, 179, 0, 9, 130, 63, 56, 215, 219, 181, 154, 202, 17, 218, 242, 156, 174, 63, 151, 246, 71, 190, 130,
-    41, 150, 205, 121, 39, 243, 193, 170, 122, 55, 107, 174, 226, 6, 188, 213, 31, 228, 194, 160, 46, 157, 161, 98, 55,
-    164, 241, 174, 155, 86, 120, 170, 251, 119, 104, 135, 163, 224, 2, 36, 203, 253, 219, 117, 111, 46, 98, 112, 3, 175,
-    140, 44, 30, 72, 144, 79, 99, 201, 219, 24, 243, 34, 73, 139, 208, 76, 63, 75, 210, 46, 155, 168, 191, 81, 193, 127,
-    9, 57, 51, 152, 226, 168, 154, 17, 181, 110, 43, 2, 85, 186, 92, 213, 15, 196, 32, 219, 28, 55, 100, 65, 100, 65,
-    126, 200, 248, 244, 67, 26, 228, 164, 240, 108, 13, 55, 208, 72, 76, 44, 184, 191, 105, 70, 170, 174, 246, 188, 121,
-    59, 37, 246, 143, 162, 96, 240, 188, 116, 208, 83, 6, 49, 93, 45, 36, 195, 117, 253, 107, 86, 37, 223, 55, 195, 244,
-    232, 68, 126, 232, 32, 231, 37, 171, 77, 111, 49, 195, 13, 52, 225, 114, 20, 25, 243, 70, 120, 0, 33, 69, 92, 169,
-    242, 220, 229, 17, 151, 137, 37, 172, 57, 159, 100, 249, 201, 207, 182, 64, 170, 226, 53, 29, 111, 227, 119, 81, 80,
-    19, 115, 140, 227, 101, 30, 255, 104, 192, 185, 97, 239, 114, 145, 110, 40, 139, 252, 88, 89, 207, 184, 105, 71,
-    160, 87, 179, 192, 129, 66, 56, 24, 252, 97, 35, 179, 241, 232, 108, 219, 232, 211, 191, 107, 133, 103, 33, 182, 55,
-    18, 218, 197, 187, 240, 40, 248, 126, 21, 245, 232, 11, 21, 240, 98, 76, 194, 25, 212, 2, 91, 151, 168, 153, 14,
-    223, 171, 190, 49, 43, 124, 82, 125, 111, 123, 195, 141, 64, 146, 58, 205, 200, 38, 242, 157, 107, 155, 176, 15, 21,
-    89, 239, 157, 244, 208, 40, 20, 191, 30, 161, 210, 12, 235, 35, 79, 221, 59, 44, 68, 106, 171, 188, 171, 157, 14,
-    160, 12, 166, 115, 204, 173, 48, 204, 140, 231, 175, 88, 176, 95, 210, 81, 40, 173, 249, 85, 180, 199, 181, 243, 95,
-    227, 174, 42, 178, 33, 129, 178, 8, 145, 144, 238, 189, 72, 114, 74, 51, 124, 42, 225, 89, 253, 84, 171, 100, 58,
-    68, 21, 197, 50, 103, 71, 106, 249, 30, 34, 173, 211, 248, 27, 97, 14, 98, 66, 113, 101, 35, 112, 68, 77, 247, 189,
-    173, 96, 93, 27, 133, 207, 166, 16, 215, 99, 85, 149, 71, 204, 64, 247, 36, 227, 110, 193, 82, 29, 72, 127, 39, 71,
-    23, 131, 84, 41, 39, 140, 216, 16, 140, 76, 164, 61, 164, 117, 247, 51, 194, 41, 54, 159, 104, 141, 144, 221, 157,
-    193, 34, 6, 62, 13, 49, 45, 168, 170, 53, 60, 20, 148, 62, 184, 37, 16, 43, 49, 70, 54, 246, 4, 145, 23, 98, 62,
-    108, 49, 129, 229, 3, 156, 231, 127, 145, 27, 203, 176, 103, 123, 64, 97, 65, 162, 142, 227, 73, 12, 199, 53, 229,
-    201, 197, 30, 198, 194, 69, 163, 69, 101, 233, 112, 194, 106, 104, 9, 92, 226, 90, 61, 114, 229, 97, 144, 80, 138,
-    217, 178, 233, 191, 219, 135, 98, 140, 216, 245, 36, 39, 35, 160, 143, 11, 68, 109, 136, 34, 139, 180, 220, 211, 69,
-    121, 237, 226, 60, 26, 49, 101, 10, 8, 106, 145, 159, 100, 79, 64, 10, 237, 116, 111, 250, 41, 252, 162, 39, 160,
-    91, 159, 41, 154, 63, 63, 2, 98, 253, 202, 249, 1, 81, 182, 34, 80, 99, 222, 220, 215, 3, 35, 185, 219, 188, 15,
-    123, 113, 217, 166, 12, 174, 71, 190, 83, 147, 18, 150, 71, 206, 31, 64, 96, 68, 215, 24, 92, 68, 146, 156, 59, 49,
-    226, 191, 228, 49, 147, 171, 212, 116, 204, 63, 68, 223, 123, 32, 16, 216, 159, 100, 142, 113, 69, 245, 130, 114,
-    144, 30, 15, 91, 224, 206, 81, 223, 33, 195, 156, 148, 122, 251, 253, 64, 24, 191, 236, 10, 10, 89, 89, 182, 161,
-    27, 169, 19, 56, 61, 58, 49, 56, 235, 60, 196, 23, 210, 77, 40, 22, 92, 212, 191, 41, 60, 121, 192, 110, 116, 131,
-    139, 150, 244, 45, 169, 78, 18, 231, 106, 36, 198, 160, 69, 55, 92, 249, 154, 150, 149, 54, 41, 139, 112, 125, 246,
-    134, 75, 168, 54, 7, 242, 113, 46, 7, 128, 208, 197, 1, 171, 127, 12, 73, 250, 46, 180, 246, 72, 185, 37, 60, 108,
-    162, 97, 242, 196, 164, 41, 52, 54, 170, 33, 169, 23, 7, 51, 192, 67, 85, 163, 118, 132, 105, 53, 118, 212, 168,
-    201, 153, 46, 119, 218, 91, 142, 230, 134, 42, 133, 213, 110, 172, 115, 129, 174, 124, 97, 244, 165, 66, 192, 183,
-    188, 169, 20, 141, 226, 46, 54, 248, 62, 192, 88, 226, 155, 148, 181, 38, 164, 167, 218, 18, 235, 50, 4, 52, 248,
-    159, 78, 241, 95, 1, 15, 56, 144, 189, 44, 137, 202, 228, 171, 217, 189, 12, 189, 199, 94, 179, 81, 91, 209, 154, 7,
-    114, 16, 153, 12, 164, 127, 247, 149, 28, 90, 135, 0, 129, 179, 165, 97, 31, 56, 125, 232, 188, 116, 66, 157, 59,
-    141, 45, 204, 28, 105, 85, 17, 137, 231, 120, 164, 149, 234, 117, 73, 161, 171, 161, 111, 147, 8, 78, 120, 122, 107,
-    14, 126, 185, 229, 197, 29, 107, 70, 44, 225, 171, 103, 143, 177, 19, 66, 158, 180, 159, 149, 22, 45, 138, 226, 95,
-    72, 141, 7, 182, 130, 32, 68, 114, 232, 64, 135, 116, 242, 195, 96, 209, 206, 56, 57, 57, 88, 79, 62, 238, 91, 72,
-    92, 68, 191, 14, 132, 125, 133, 234, 228, 15, 9, 237, 126, 187, 76, 30, 51, 208, 226, 195, 10, 229, 158, 236, 45,
-    227, 195, 96, 206, 209, 131, 172, 32, 153, 14, 154, 125, 132, 32, 61, 217, 7, 157, 173, 247, 233, 142, 194, 225,
-    178, 69, 66, 177, 64, 246, 222, 33, 165, 227, 26, 168, 77, 196, 12, 109, 7, 186, 103, 98, 215, 157, 194, 18, 56,
-    208, 51, 157, 90, 188, 82, 203, 241, 253, 160, 19, 24, 144, 159, 192, 49, 84, 77, 155, 150, 56, 30, 128, 83, 58,
-    153, 69, 125, 211, 168, 77, 169, 110, 91, 19, 139, 116, 101, 75, 84, 93, 138, 118, 0, 187, 22, 99, 245, 171, 255,
-    216, 164, 80, 215, 82, 32, 105, 187, 102, 212, 239, 232, 250, 10, 119, 211, 10, 47, 126, 215, 6, 53, 7, 213, 87,
-    211, 150, 94, 224, 205, 180, 25, 25, 182, 235, 62, 19, 173, 199, 139, 70, 25, 192, 143, 149, 49, 148, 228, 200, 207,
-    238, 74, 229, 69, 231, 208, 43, 125, 205, 238, 208, 173, 66, 165, 36, 201, 211, 44, 230, 33, 198, 132, 197, 28, 37,
-    252, 7, 86, 143, 2, 239, 34, 94, 171, 23, 155, 7, 107, 80, 184, 29, 184, 18, 101, 195, 160, 226, 221, 187, 222, 27,
-    182, 226, 33, 158, 101, 215, 202, 20, 156, 190, 179, 152, 227, 40, 246, 37, 5, 155, 161, 125, 16, 183, 12, 221, 50,
-    112, 108, 86, 182, 9, 253, 233, 230, 84, 58, 230, 231, 130, 37, 84, 55, 229, 51, 175, 192, 216, 91, 218, 110, 226,
-    253, 173, 115, 139, 8, 174, 126, 181, 255, 215, 200, 101, 240, 22, 135, 59, 55, 87, 10, 166, 188, 159, 188, 24, 133,
-    122, 212, 24, 249, 137, 192, 56, 174, 9, 172, 130, 221, 88, 53, 20, 86, 155, 157, 190, 43, 186, 95, 204, 234, 197,
-    110, 143, 74, 105, 133, 170, 98, 237, 225, 100, 43, 117, 121, 147, 16, 165, 8, 18, 207, 214, 211, 207, 240, 145,
-    207, 188, 195, 180, 78, 190, 119, 27, 162, 13, 112, 165, 127, 90, 167, 60, 55, 65, 165, 208, 31, 7, 232, 204, 103,
-    34, 170, 52, 180, 9, 44, 247, 170, 176, 200, 33, 207, 177, 32, 23, 63, 159, 33, 94, 91, 186, 80, 158, 222, 35, 46,
-    160, 122, 83, 97, 138, 133, 213, 144, 11, 97, 14, 63, 21, 246, 232, 11, 191, 97, 38, 19, 111, 141, 238, 19, 74, 149,
-    238, 184, 19, 173, 142, 27, 185, 60, 58, 82, 0, 243, 27, 51, 141, 152, 157, 43, 109, 50, 175, 241, 185, 77, 108, 0,
-    58, 174, 217, 204, 253, 18, 109, 214, 33, 10, 46, 111, 101, 138, 217, 96, 109, 127, 55, 124, 108, 126, 115, 71, 106,
-    205, 66, 189, 20, 129, 8, 245, 139, 38, 143, 29, 153, 82, 185, 238, 44, 35, 242, 6, 196, 247, 168, 239, 54, 70, 255,
-    3, 87, 97, 79, 226, 88, 31, 81, 115, 76, 107, 212, 32, 231, 167, 226, 234, 104, 69, 117, 18, 6, 62, 202, 120, 157,
-    198, 136, 250, 1, 170, 64, 215, 191, 175, 86, 76, 106, 167, 18, 109, 87, 105, 102, 103, 60, 210, 235, 212, 229, 154,
-    84, 161, 160, 82, 29, 78, 148, 232, 246, 180, 116, 159, 13, 85, 95, 6, 79, 144, 77, 61, 95, 149, 246, 250, 114, 92,
-    199, 132, 10, 203, 255, 22, 181, 230, 204, 35, 90, 114, 217, 111, 117, 244, 170, 105, 73, 255, 161, 229, 205, 191,
-    161, 166, 17, 221, 112, 100, 227, 126, 249, 214, 166, 2, 5, 124, 203, 57, 237, 58, 35, 36, 174, 186, 236, 6, 86,
-    125, 122, 220, 179, 231, 229, 22, 242, 67, 241, 15, 182, 127, 109, 103, 171, 234, 36, 161, 254, 78, 52, 93, 182,
-    231, 156, 54, 193, 38, 92, 205, 41, 123, 77, 179, 56, 116, 245, 17, 240, 63, 70, 28, 229, 165, 100, 189, 174, 128,
-    208, 174, 181, 9, 123, 225, 138, 92, 45, 202, 109, 144, 197, 108, 155, 179, 249, 67, 181, 98, 23, 212, 154, 41, 83,
-    241, 185, 251, 116, 42, 122, 236, 141, 40, 198, 167, 182, 217, 30, 194, 30, 135, 122, 255, 170, 202, 73, 88, 233,
-    66, 152, 117, 128, 86, 134, 90, 217, 200, 123, 169, 197, 148, 17, 37, 199, 176, 156, 76, 131, 23, 139, 112, 92, 149,
-    85, 14, 45, 2, 232, 209, 131, 1, 148, 121, 99, 97, 149, 11, 150, 40, 81, 7, 83, 166, 183, 61, 139, 251, 37, 115, 73,
-    217, 116, 210, 94, 124, 189, 171, 254, 220, 169, 197, 180, 97, 228, 157, 198, 214, 166, 186, 119, 89, 66, 63, 114,
-    37, 100, 67, 209, 181, 195, 224, 134, 235, 196, 204, 189, 111, 53, 19, 245, 147, 241, 173, 211, 210, 193, 62, 86,
-    121, 4, 207, 106, 95, 20, 95, 114, 8, 70, 53, 6, 187, 125, 74, 86, 88, 148, 216, 78, 24, 152, 166, 203, 221, 138,
-    64, 48, 59, 135, 114, 56, 203, 189, 242, 128, 179, 118, 198, 4, 65, 175, 48, 227, 70, 148, 177, 155, 157, 122, 248,
-    248, 131, 246, 241, 37, 3, 228, 53, 92, 82, 79, 100, 150, 75, 118, 174, 170, 2, 160, 230, 1, 98, 229, 160, 52, 144,
-    109, 195, 49, 247, 48, 158, 45, 123, 138, 29, 21, 44, 131, 241, 10, 54, 78, 68, 249, 27, 16, 228, 37, 68, 60, 86,
-    21, 254, 243, 174, 233, 170, 12, 46, 109, 225, 80, 62, 27, 209, 123, 231, 55, 137, 171, 229, 205, 142, 41, 116, 36,
-    171, 164, 211, 94, 243, 238, 254, 30, 211, 88, 232, 199, 132, 104, 110, 54, 74, 217, 8, 199, 208, 212, 99, 195, 144,
-    187, 216, 143, 183, 146, 134, 189, 13, 164, 80, 134, 248, 125, 101, 82, 26, 207, 108, 247, 207, 90, 217, 176, 207,
-    200, 6, 63, 120, 155, 74, 10, 185, 253, 207, 10, 142, 15, 226, 54, 125, 123, 237, 237, 26, 202, 92, 83, 222, 227,
-    73, 153, 40, 171, 241, 170, 203, 61, 217, 145, 82, 163, 231, 201, 52, 244, 173, 255, 19, 16, 11, 225, 143, 84, 134,
-    251, 83, 114, 62, 236, 31, 153, 201, 159, 14, 162, 186, 232, 12, 105, 132, 171, 46, 153, 181, 125, 99, 20, 61, 213,
-    74, 29, 74, 30, 36, 29, 49, 169, 179, 181, 200, 75, 9, 177, 51, 94, 236, 143, 123, 102, 30, 95, 37, 177, 25, 158,
-    77, 153, 132, 164, 6, 38, 193, 143, 14, 185, 35, 82, 236, 113, 110, 244, 185, 165, 158, 144, 185, 56, 129, 231, 249,
-    252, 219, 75, 37, 184, 225, 209, 118, 148, 164, 182, 17, 73, 89, 60, 221, 237, 43, 241, 56, 79, 144, 219, 39, 22,
-    88, 9, 231, 136, 9, 74, 136, 9, 153, 145, 145, 75, 189, 248, 168, 117, 23, 47, 154, 183, 38, 24, 156, 121, 128, 5,
-    255, 195, 190, 134, 17, 107, 35, 141, 126, 239, 132, 24, 211, 59, 13, 11, 222, 52, 38, 151, 165, 23, 235, 201, 168,
-    28, 195, 249, 120, 164, 38, 247, 175, 15, 142, 203, 172, 24, 191, 47, 50, 68, 80, 197, 85, 75, 70, 168, 237, 122,
-    75, 9, 19, 66, 193, 100, 3, 205, 145, 245, 120, 98, 38, 183, 164, 189, 151, 246, 116, 32, 73, 215, 25, 133, 39, 28,
-    44, 88, 247, 163, 109, 169, 122, 214, 146, 111, 180, 161, 35, 32, 15, 248, 85, 55, 191, 58, 23, 154, 250, 208, 46,
-    44, 73, 135, 112, 75, 183, 217, 96, 112, 228, 118, 189, 215, 85, 149, 225, 166, 46, 20, 2, 56, 172, 151, 247, 2,
-    214, 214, 45, 96, 136, 159, 136, 142, 253, 145, 247, 96, 129, 185, 139, 215, 46, 141, 105, 66, 26, 21, 99, 49, 201,
-    239, 113, 13, 126, 254, 229, 85, 248, 207, 102, 59, 41, 218, 76, 32, 56, 126, 227, 221, 61, 252, 28, 236, 190, 11,
-    196, 27, 142, 100, 199, 251, 227, 124, 78, 113, 227, 207, 26, 94, 88, 114, 130, 224, 74, 78, 135, 132, 146, 130, 61,
-    203, 30, 177, 248, 46, 222, 226, 109, 108, 56, 13, 200, 89, 19, 54, 130, 159, 170, 64, 143, 157, 164, 173, 237, 207,
-    157, 48, 246, 135, 240, 81, 145, 164, 33, 209, 176, 48, 120, 61, 206, 141, 64, 65, 135, 142, 212, 29, 6, 2, 110, 91,
-    7, 248, 91, 246, 133, 50, 164, 213, 81, 1, 134, 121, 80, 166, 31, 113, 63, 104, 176, 83, 107, 154, 152, 218, 209,
-    65, 33, 235, 27, 113, 112, 43
+    123, 10, 32, 32, 34, 67, 111, 109, 112, 111, 110, 101, 110, 116, 78, 97, 109, 101, 34, 58, 32, 34, 80, 97, 108, 34,
+    44, 10, 32, 32, 34, 68, 114, 105, 118, 101, 114, 83, 116, 97, 116, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 34, 72,
+    97, 108, 116, 101, 100, 79, 110, 68, 101, 118, 105, 99, 101, 73, 110, 105, 116, 34, 10, 32, 32, 93, 44, 10, 32, 32,
+    34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 84, 70, 81, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 117, 98, 108, 105, 99, 32, 67, 67, 67, 32, 79, 112, 116, 105, 111,
+    110, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 52, 50, 54, 53, 50, 52, 48, 52, 53, 56, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    49, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    117, 98, 108, 105, 99, 67, 97, 116, 97, 108, 121, 115, 116, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 101, 120, 116, 117, 114, 101, 79, 112, 116, 76, 101,
+    118, 101, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 101, 120, 116, 117, 114, 101, 32, 102, 105, 108, 116, 101,
+    114, 105, 110, 103, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 101, 120, 112, 111, 115,
+    101, 100, 32, 98, 121, 32, 67, 67, 67, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 97, 116, 97, 108, 121, 115, 116, 65, 73, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 117, 98, 108, 105,
+    99, 32, 67, 67, 67, 32, 79, 112, 116, 105, 111, 110, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 57, 48, 49, 57, 56, 54, 51, 52, 56, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 117, 98, 108, 105, 99, 67, 97, 116, 97, 108, 121, 115, 116, 75,
+    101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 97,
+    116, 97, 108, 121, 115, 116, 65, 73, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 97, 112, 112, 32, 100, 101, 116, 101, 99,
+    116, 32, 97, 110, 100, 32, 105, 109, 97, 103, 101, 32, 113, 117, 97, 108, 105, 116, 121, 32, 97, 108, 116, 101, 114,
+    105, 110, 103, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 101, 120, 112, 111, 115, 101,
+    100, 32, 98, 121, 32, 67, 67, 67, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    65, 108, 119, 97, 121, 115, 32, 114, 117, 110, 32, 116, 104, 101, 32, 112, 114, 101, 97, 109, 98, 108, 101, 32, 99,
+    109, 100, 32, 115, 116, 114, 101, 97, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 79, 110, 108, 121, 32, 114, 117, 110, 32, 116, 104, 101, 32, 112, 114, 101,
+    97, 109, 98, 108, 101, 32, 99, 109, 100, 32, 115, 116, 114, 101, 97, 109, 32, 119, 104, 101, 110, 32, 110, 101, 99,
+    101, 115, 115, 97, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70,
+    111, 114, 99, 101, 80, 114, 101, 97, 109, 98, 108, 101, 67, 109, 100, 83, 116, 114, 101, 97, 109, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101,
+    114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101,
+    34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 50, 57, 56, 55, 57, 52, 55, 52, 57, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114,
+    117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 111, 114, 99, 101, 80, 114, 101, 97, 109, 98, 108, 101, 67, 109, 100,
+    83, 116, 114, 101, 97, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 116, 104,
+    101, 32, 112, 114, 101, 97, 109, 98, 108, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109,
+    32, 102, 111, 114, 32, 97, 32, 81, 117, 101, 117, 101, 32, 105, 115, 32, 97, 108, 119, 97, 121, 115, 32, 115, 117,
+    98, 109, 105, 116, 116, 101, 100, 32, 111, 114, 32, 115, 107, 105, 112, 112, 101, 100, 32, 119, 104, 101, 110, 32,
+    116, 104, 101, 32, 115, 97, 109, 101, 32, 115, 99, 104, 101, 100, 117, 108, 101, 114, 32, 99, 111, 110, 116, 101,
+    120, 116, 32, 114, 117, 110, 115, 32, 98, 97, 99, 107, 45, 116, 111, 45, 98, 97, 99, 107, 32, 111, 110, 32, 116,
+    104, 101, 32, 67, 80, 32, 114, 105, 110, 103, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 78, 117, 109, 67, 109, 100, 83, 116, 114,
+    101, 97, 109, 115, 80, 101, 114, 83, 117, 98, 109, 105, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 10, 32, 32, 32,
+    32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 54, 55,
+    48, 52, 53, 56, 52, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110,
+    116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 109, 97, 120, 78, 117, 109, 67, 109, 100, 83, 116, 114, 101, 97, 109, 115, 80, 101, 114, 83, 117, 98, 109,
+    105, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 110, 117,
+    109, 98, 101, 114, 32, 111, 102, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 115, 32, 116,
+    104, 97, 116, 32, 99, 97, 110, 32, 98, 101, 32, 115, 117, 98, 109, 105, 116, 116, 101, 100, 32, 97, 116, 32, 111,
+    110, 99, 101, 32, 116, 111, 32, 116, 104, 101, 32, 107, 101, 114, 110, 101, 108, 46, 32, 79, 118, 101, 114, 114,
+    105, 100, 101, 115, 32, 116, 104, 101, 32, 107, 101, 114, 110, 101, 108, 32, 109, 97, 120, 105, 109, 117, 109, 32,
+    118, 97, 108, 117, 101, 32, 105, 102, 32, 115, 101, 116, 32, 116, 111, 32, 97, 32, 118, 97, 108, 117, 101, 32, 62,
+    32, 48, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 82, 101, 113, 117, 101, 115, 116, 72, 105, 103, 104, 80, 114, 105, 111, 114, 105, 116, 121, 86,
+    109, 105, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111,
+    114, 109, 97, 110, 99, 101, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 49, 53, 56, 48, 55, 51, 57, 50, 48, 50, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 114, 101, 113, 117, 101, 115, 116, 72,
+    105, 103, 104, 80, 114, 105, 111, 114, 105, 116, 121, 86, 109, 105, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 113, 117, 101, 115, 116, 115, 32, 116,
+    104, 97, 116, 32, 99, 111, 110, 116, 101, 120, 116, 115, 32, 98, 101, 32, 99, 114, 101, 97, 116, 101, 100, 32, 119,
+    105, 116, 104, 32, 104, 105, 103, 104, 32, 112, 114, 105, 111, 114, 105, 116, 121, 32, 86, 77, 73, 68, 32, 116, 111,
+    32, 114, 101, 100, 117, 99, 101, 32, 112, 97, 103, 101, 32, 116, 97, 98, 108, 101, 32, 105, 110, 118, 97, 108, 105,
+    100, 97, 116, 105, 111, 110, 32, 112, 101, 110, 97, 108, 116, 105, 101, 115, 46, 34, 10, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 101, 113, 117, 101,
+    115, 116, 68, 101, 98, 117, 103, 86, 109, 105, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 98, 117, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 114, 111, 102, 105, 108,
+    105, 110, 103, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 51, 53, 57, 55, 57, 50, 49, 52, 53, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 114, 101, 113, 117, 101, 115, 116, 68, 101, 98, 117, 103, 86, 109,
+    105, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 82, 101, 113, 117, 101, 115, 116, 115, 32, 116, 104, 97, 116, 32, 99, 111, 110, 116, 101, 120, 116, 115, 32, 98,
+    101, 32, 99, 114, 101, 97, 116, 101, 100, 32, 119, 105, 116, 104, 32, 97, 32, 100, 101, 98, 117, 103, 32, 86, 77,
+    73, 68, 46, 32, 84, 104, 105, 115, 32, 97, 108, 108, 111, 119, 115, 32, 102, 111, 114, 32, 98, 101, 116, 116, 101,
+    114, 32, 115, 104, 97, 100, 101, 114, 32, 100, 101, 98, 117, 103, 103, 105, 110, 103, 32, 98, 121, 32, 107, 101,
+    101, 112, 105, 110, 103, 32, 116, 104, 101, 32, 112, 97, 103, 101, 32, 116, 97, 98, 108, 101, 115, 32, 118, 97, 108,
+    105, 100, 32, 97, 102, 116, 101, 114, 32, 116, 104, 101, 32, 99, 111, 110, 116, 101, 120, 116, 32, 104, 97, 115, 32,
+    98, 101, 101, 110, 32, 115, 119, 105, 116, 99, 104, 101, 100, 32, 111, 117, 116, 46, 32, 32, 84, 104, 105, 115, 32,
+    105, 115, 32, 97, 108, 115, 111, 32, 117, 115, 101, 102, 117, 108, 32, 102, 111, 114, 32, 83, 81, 84, 84, 32, 112,
+    114, 111, 102, 105, 108, 105, 110, 103, 32, 97, 115, 32, 105, 116, 32, 101, 110, 115, 117, 114, 101, 115, 32, 98,
+    111, 116, 104, 32, 99, 111, 109, 112, 117, 116, 101, 32, 97, 110, 100, 32, 103, 114, 97, 112, 104, 105, 99, 115, 32,
+    113, 117, 101, 117, 101, 32, 119, 111, 114, 107, 32, 119, 105, 108, 108, 32, 115, 104, 97, 114, 101, 32, 116, 104,
+    101, 32, 115, 97, 109, 101, 32, 86, 77, 73, 68, 32, 97, 108, 108, 111, 119, 105, 110, 103, 32, 116, 104, 101, 32,
+    116, 104, 114, 101, 97, 100, 32, 116, 114, 97, 99, 101, 32, 116, 111, 32, 98, 101, 32, 102, 105, 108, 116, 101, 114,
+    101, 100, 32, 116, 111, 32, 97, 32, 115, 105, 110, 103, 108, 101, 32, 86, 77, 73, 68, 32, 40, 116, 111, 32, 97, 118,
+    111, 105, 100, 32, 99, 97, 112, 116, 117, 114, 105, 110, 103, 32, 111, 116, 104, 101, 114, 32, 112, 114, 111, 99,
+    101, 115, 115, 101, 115, 32, 119, 111, 114, 107, 41, 32, 119, 104, 105, 108, 101, 32, 115, 116, 105, 108, 108, 32,
+    99, 97, 112, 116, 117, 114, 105, 110, 103, 32, 97, 108, 108, 32, 119, 111, 114, 107, 32, 98, 121, 32, 116, 104, 101,
+    32, 116, 97, 114, 103, 101, 116, 32, 112, 114, 111, 99, 101, 115, 115, 46, 32, 78, 79, 84, 69, 58, 32, 82, 71, 80,
+    32, 116, 114, 97, 99, 105, 110, 103, 32, 97, 117, 116, 111, 109, 97, 116, 105, 99, 97, 108, 108, 121, 32, 114, 101,
+    113, 117, 101, 115, 116, 115, 32, 116, 104, 101, 32, 68, 101, 98, 117, 103, 32, 86, 77, 73, 68, 32, 100, 117, 114,
+    105, 110, 103, 32, 115, 101, 116, 117, 112, 32, 115, 111, 32, 116, 104, 101, 114, 101, 32, 105, 115, 32, 110, 111,
+    32, 110, 101, 101, 100, 32, 116, 111, 32, 99, 104, 97, 110, 103, 101, 32, 116, 104, 105, 115, 32, 115, 101, 116,
+    116, 105, 110, 103, 32, 119, 104, 101, 110, 32, 99, 97, 112, 116, 117, 114, 105, 110, 103, 32, 82, 71, 80, 32, 116,
+    114, 97, 99, 101, 115, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 78, 101, 118, 101, 114, 67, 104, 97, 110, 103, 101, 67, 108, 111, 99, 107, 77,
+    111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 98, 117, 103,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 114, 111, 102, 105, 108, 105, 110, 103, 34, 10, 32, 32, 32, 32,
+    32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 51, 54, 49,
+    48, 54, 54, 55, 56, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 110, 101, 118, 101, 114, 67, 104, 97, 110, 103, 101, 67, 108, 111, 99, 107, 77, 111, 100, 101, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115,
+    97, 98, 108, 101, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 71, 80, 85, 32, 99, 108, 111, 99, 107, 115, 32,
+    105, 110, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 32, 40, 101, 103, 46, 32, 100, 117, 114, 105, 110,
+    103, 32, 112, 114, 111, 102, 105, 108, 105, 110, 103, 41, 46, 32, 69, 110, 97, 98, 108, 101, 32, 116, 104, 105, 115,
+    32, 105, 102, 32, 117, 115, 105, 110, 103, 32, 65, 71, 77, 32, 116, 111, 32, 102, 111, 114, 99, 101, 32, 99, 108,
+    111, 99, 107, 32, 118, 97, 108, 117, 101, 115, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73,
+    110, 115, 116, 114, 117, 99, 116, 115, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 32, 116, 111, 32, 117,
+    115, 101, 32, 97, 108, 108, 32, 82, 66, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 45, 49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 68, 114, 105, 118, 101, 114, 32, 119, 105, 108, 108, 32, 99, 104, 111, 111, 115, 101,
+    32, 97, 110, 32, 111, 112, 116, 105, 109, 97, 108, 32, 118, 97, 108, 117, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 76,
+    111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 79, 114, 69, 113,
+    117, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 73, 110, 115, 116, 114, 117, 99, 116, 115, 32, 116, 104, 101, 32, 100, 114, 105, 118,
+    101, 114, 32, 116, 111, 32, 117, 115, 101, 32, 116, 104, 105, 115, 32, 101, 120, 97, 99, 116, 32, 110, 117, 109, 98,
+    101, 114, 32, 111, 102, 32, 82, 66, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 111,
+    110, 108, 111, 99, 97, 108, 68, 101, 115, 116, 71, 114, 97, 112, 104, 105, 99, 115, 67, 111, 112, 121, 82, 98, 115,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109,
+    97, 110, 99, 101, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 53, 48, 49, 57, 48, 49, 48, 48, 48, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 110, 111, 110, 108, 111, 99, 97, 108, 68, 101, 115, 116, 71, 114, 97, 112, 104,
+    105, 99, 115, 67, 111, 112, 121, 82, 98, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 112, 101, 99, 105, 102, 105, 101, 115, 32, 116, 104, 101, 32, 110, 117,
+    109, 98, 101, 114, 32, 111, 102, 32, 82, 66, 115, 32, 117, 115, 101, 100, 32, 105, 110, 32, 97, 32, 103, 114, 97,
+    112, 104, 105, 99, 115, 32, 99, 111, 112, 121, 32, 116, 111, 32, 110, 111, 110, 108, 111, 99, 97, 108, 32, 100, 101,
+    115, 116, 105, 110, 97, 116, 105, 111, 110, 115, 46, 32, 32, 82, 101, 100, 117, 99, 105, 110, 103, 32, 116, 104,
+    101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 82, 66, 115, 32, 99, 97, 110, 32, 105, 110, 99, 114, 101,
+    97, 115, 101, 32, 80, 67, 73, 101, 32, 116, 104, 114, 111, 117, 103, 104, 112, 117, 116, 46, 34, 10, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116,
+    114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 73, 102, 104, 77, 111, 100, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 70, 72, 32, 105, 115, 32,
+    100, 105, 115, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 73, 102, 104, 77, 111, 100, 101, 80, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 70, 72, 32, 105, 115, 32, 105, 109, 112, 108, 101, 109, 101,
+    110, 116, 101, 100, 32, 105, 110, 32, 80, 65, 76, 32, 40, 107, 101, 114, 110, 101, 108, 32, 105, 115, 32, 110, 111,
+    116, 32, 99, 97, 108, 108, 101, 100, 41, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 73, 102, 104, 77, 111, 100, 101, 75, 109, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 70, 72, 32, 105, 115, 32, 105, 109, 112, 108, 101, 109,
+    101, 110, 116, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 107, 101, 114, 110, 101, 108, 34, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 73, 102, 104, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 70, 72, 32, 77, 111, 100, 101, 32, 115, 101,
+    116, 116, 105, 110, 103, 32, 118, 97, 108, 117, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 70, 72, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 98, 117, 103, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 50, 57, 57, 56, 54, 52, 49, 51, 56, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 73, 102, 104, 77, 111, 100, 101, 68, 105, 115, 97, 98, 108, 101,
+    100, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 105, 102, 104, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 73, 110, 102, 105, 110, 105,
+    116, 101, 108, 121, 32, 70, 97, 115, 116, 32, 72, 97, 114, 100, 119, 97, 114, 101, 32, 40, 73, 70, 72, 41, 32, 109,
+    111, 100, 101, 46, 32, 83, 101, 101, 32, 73, 102, 104, 71, 112, 117, 77, 97, 115, 107, 32, 102, 111, 114, 32, 119,
+    104, 105, 99, 104, 32, 65, 83, 73, 67, 115, 32, 97, 114, 101, 32, 97, 102, 102, 101, 99, 116, 101, 100, 32, 40, 100,
+    101, 102, 97, 117, 108, 116, 32, 97, 108, 108, 41, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 100, 108, 101, 65, 102, 116, 101, 114, 83, 117, 98,
+    109, 105, 116, 71, 112, 117, 77, 97, 115, 107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 98, 117, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 97, 102, 101, 83, 101, 116, 116,
+    105, 110, 103, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 50, 54, 54, 53, 55, 57, 52, 48, 55, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101,
+    10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 79, 83, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 87, 105,
+    110, 100, 111, 119, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75,
+    101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 105, 100,
+    108, 101, 65, 102, 116, 101, 114, 83, 117, 98, 109, 105, 116, 71, 112, 117, 77, 97, 115, 107, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 100, 108, 101, 115, 32,
+    97, 102, 116, 101, 114, 32, 101, 97, 99, 104, 32, 99, 97, 108, 108, 32, 116, 111, 32, 83, 117, 98, 109, 105, 116,
+    32, 102, 111, 114, 32, 116, 104, 101, 32, 71, 80, 85, 39, 115, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32,
+    98, 121, 32, 116, 104, 101, 32, 98, 105, 116, 109, 97, 115, 107, 46, 32, 71, 80, 85, 39, 115, 32, 97, 114, 101, 32,
+    115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 112, 111, 115, 105, 116, 105, 111,
+    110, 32, 105, 110, 32, 116, 104, 101, 32, 98, 105, 116, 102, 105, 101, 108, 100, 32, 97, 110, 100, 32, 109, 97, 112,
+    32, 116, 111, 32, 116, 104, 101, 32, 76, 68, 65, 32, 99, 104, 97, 105, 110, 32, 97, 114, 114, 97, 121, 46, 32, 32,
+    69, 120, 97, 109, 112, 108, 101, 58, 32, 48, 120, 50, 32, 119, 111, 117, 108, 100, 32, 99, 97, 117, 115, 101, 32,
+    116, 104, 101, 32, 71, 80, 85, 32, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 32, 116, 111, 32,
+    116, 104, 101, 32, 50, 110, 100, 32, 76, 68, 65, 32, 99, 104, 97, 105, 110, 32, 105, 110, 32, 116, 104, 101, 32, 97,
+    114, 114, 97, 121, 32, 40, 97, 114, 114, 97, 121, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 49, 41, 32, 116,
+    111, 32, 105, 100, 108, 101, 32, 97, 102, 116, 101, 114, 32, 101, 97, 99, 104, 32, 115, 117, 98, 109, 105, 116, 46,
+    34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86,
+    97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58,
+    32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118,
+    101, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58,
+    32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 78, 111, 110, 101, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 111, 114, 109, 97,
+    108, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 44, 32, 116, 111, 115, 115, 32, 112, 111, 105, 110, 116, 32,
+    105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 65, 102, 116, 101, 114, 82, 97, 115, 116, 101, 114, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 75,
+    105, 108, 108, 32, 82, 97, 115, 116, 101, 114, 105, 122, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 87, 105, 114, 101, 102, 114, 97, 109,
+    101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 70, 111, 114, 99, 101, 32, 87, 105, 114, 101, 102, 114, 97, 109, 101, 32, 102, 105, 108, 108, 32, 109, 111, 100,
+    101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111,
+    105, 110, 116, 66, 97, 99, 107, 70, 114, 111, 110, 116, 70, 97, 99, 101, 67, 117, 108, 108, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101,
+    32, 98, 97, 99, 107, 32, 97, 110, 100, 32, 102, 114, 111, 110, 116, 32, 102, 97, 99, 101, 32, 99, 117, 108, 108,
+    105, 110, 103, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115,
+    80, 111, 105, 110, 116, 65, 102, 116, 101, 114, 83, 101, 116, 117, 112, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 99, 105, 115, 115, 111, 114, 45, 111,
+    117, 116, 32, 97, 108, 108, 32, 103, 101, 111, 109, 101, 116, 114, 121, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 68, 101, 112, 116, 104, 67, 108,
+    105, 112, 68, 105, 115, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 53, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 68, 101, 112, 116, 104, 45, 99, 108, 105,
+    112, 112, 105, 110, 103, 32, 100, 105, 115, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 65, 102, 116, 101, 114, 80, 115, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 54, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68,
+    105, 115, 97, 98, 108, 101, 32, 67, 111, 108, 111, 114, 32, 66, 117, 102, 102, 101, 114, 32, 119, 114, 105, 116,
+    101, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80,
+    111, 105, 110, 116, 83, 105, 109, 112, 108, 101, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 55, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 32, 97, 32, 116, 114, 105, 118, 105, 97,
+    108, 32, 80, 105, 120, 101, 108, 32, 83, 104, 97, 100, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 111, 115, 115, 32, 80, 111, 105, 110,
+    116, 32, 77, 111, 100, 101, 115, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 84, 111, 115, 115, 80, 111, 105, 110, 116, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97,
+    108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 10, 32,
+    32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 52,
+    48, 49, 51, 54, 57, 57, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 84, 111, 115, 115, 80,
+    111, 105, 110, 116, 78, 111, 110, 101, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 111, 115, 115, 80, 111, 105, 110, 116,
+    77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 84, 111, 115, 115, 32, 112, 111, 105, 110, 116, 115, 32, 101, 110, 97, 98, 108, 101, 115, 32, 115, 116,
+    114, 105, 112, 112, 105, 110, 103, 32, 111, 117, 116, 32, 111, 102, 32, 71, 80, 85, 32, 119, 111, 114, 107, 32, 102,
+    111, 114, 32, 109, 111, 114, 101, 32, 102, 111, 99, 117, 115, 101, 100, 32, 112, 101, 114, 102, 111, 114, 109, 97,
+    99, 101, 32, 97, 110, 97, 108, 121, 115, 105, 115, 46, 32, 84, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103,
+    32, 99, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 105, 99, 104, 32, 119, 111, 114, 107, 32, 119, 105, 108,
+    108, 32, 98, 101, 32, 116, 111, 115, 115, 101, 100, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 100, 100, 109, 49, 70, 114, 101, 101, 86, 105,
+    114, 116, 117, 97, 108, 71, 112, 117, 77, 101, 109, 86, 65, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 10, 32, 32, 32,
+    32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 49, 50,
+    54, 56, 52, 51, 51, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 119, 100, 100, 109, 49, 70, 114, 101, 101, 86, 105, 114, 116, 117, 97, 108, 71, 112, 117, 77, 101,
+    109, 86, 65, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 87, 104, 101, 116, 104, 101, 114, 32, 86, 65, 32, 111, 102, 32, 118, 105, 114, 116, 117, 97, 108, 32, 103,
+    112, 117, 32, 109, 101, 109, 111, 114, 121, 32, 119, 105, 108, 108, 32, 98, 101, 32, 102, 114, 101, 101, 100, 32,
+    97, 110, 100, 32, 114, 101, 116, 117, 114, 110, 101, 100, 32, 116, 111, 32, 86, 65, 77, 32, 97, 116, 32, 109, 101,
+    109, 111, 114, 121, 32, 100, 101, 115, 116, 114, 111, 121, 32, 116, 105, 109, 101, 32, 117, 110, 100, 101, 114, 32,
+    119, 100, 100, 109, 49, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 111, 114, 99, 101, 70, 105, 120, 101, 100, 70, 117, 110, 99, 67, 111, 108,
+    111, 114, 82, 101, 115, 111, 108, 118, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 98, 117, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101,
+    32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 50, 51, 57, 49, 54, 55, 50, 55, 51, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 111, 114, 99, 101, 70, 105,
+    120, 101, 100, 70, 117, 110, 99, 67, 111, 108, 111, 114, 82, 101, 115, 111, 108, 118, 101, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 105, 115, 32, 115,
+    101, 116, 116, 105, 110, 103, 32, 102, 111, 114, 99, 101, 115, 32, 77, 83, 65, 65, 32, 99, 111, 108, 111, 114, 32,
+    105, 109, 97, 103, 101, 115, 32, 116, 111, 32, 97, 108, 119, 97, 121, 115, 32, 112, 114, 101, 102, 101, 114, 32,
+    102, 105, 120, 101, 100, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 115, 111, 108, 118, 101, 115, 32,
+    111, 118, 101, 114, 32, 97, 110, 121, 32, 111, 116, 104, 101, 114, 32, 114, 101, 115, 111, 108, 118, 101, 32, 109,
+    101, 116, 104, 111, 100, 32, 40, 105, 102, 32, 70, 105, 120, 101, 100, 70, 117, 110, 99, 32, 114, 101, 115, 111,
+    108, 118, 101, 115, 32, 97, 114, 101, 32, 115, 117, 112, 112, 111, 114, 116, 101, 100, 32, 98, 121, 32, 116, 104,
+    101, 32, 105, 109, 97, 103, 101, 41, 46, 32, 84, 104, 105, 115, 32, 119, 105, 108, 108, 32, 111, 118, 101, 114, 114,
+    105, 100, 101, 32, 116, 104, 101, 32, 99, 108, 105, 101, 110, 116, 39, 115, 32, 112, 114, 101, 102, 101, 114, 114,
+    101, 100, 32, 114, 101, 115, 111, 108, 118, 101, 32, 109, 101, 116, 104, 111, 100, 34, 10, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 54, 52, 45, 98, 105, 116, 32, 97, 100, 100, 114, 101, 115, 115, 32, 116, 111, 32, 117, 115, 101, 32,
+    102, 111, 114, 32, 117, 110, 98, 111, 117, 110, 100, 32, 100, 101, 115, 99, 114, 105, 112, 116, 111, 114, 115, 46,
+    32, 84, 104, 105, 115, 32, 119, 105, 108, 108, 32, 115, 104, 111, 119, 32, 117, 112, 32, 105, 110, 32, 116, 104,
+    101, 32, 102, 97, 117, 108, 116, 105, 110, 103, 32, 97, 100, 100, 114, 101, 115, 115, 32, 105, 102, 32, 97, 32, 112,
+    97, 103, 101, 32, 102, 97, 117, 108, 116, 32, 105, 115, 32, 116, 114, 105, 103, 103, 101, 114, 101, 100, 32, 100,
+    117, 101, 32, 116, 111, 32, 97, 110, 32, 117, 110, 98, 111, 117, 110, 100, 32, 100, 101, 115, 99, 114, 105, 112,
+    116, 111, 114, 32, 105, 110, 32, 97, 110, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 46, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110,
+    101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 97, 102, 101, 83, 101, 116, 116, 105, 110,
+    103, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 50, 57, 55, 50, 57, 49, 57, 53, 49, 55, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 54, 48, 52, 53, 54, 57, 48, 57,
+    56, 52, 56, 51, 51, 51, 51, 53, 48, 50, 51, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 103, 112, 117, 115, 105, 122, 101, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 117, 110, 98, 111, 117, 110,
+    100, 68, 101, 115, 99, 114, 105, 112, 116, 111, 114, 65, 100, 100, 114, 101, 115, 115, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 110, 98, 111, 117, 110, 100, 68, 101, 115, 99, 114, 105, 112, 116,
+    111, 114, 65, 100, 100, 114, 101, 115, 115, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 108, 101, 97, 114, 65, 108, 108, 111, 99, 97, 116, 101,
+    100, 76, 102, 98, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 98, 117,
+    103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 97, 102, 101, 83, 101, 116, 116, 105, 110, 103, 34, 10, 32,
+    32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54,
+    53, 55, 52, 50, 48, 53, 54, 53, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115,
+    101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110,
+    34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 79, 83, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 76, 105, 110, 117, 120, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 108, 101,
+    97, 114, 65, 108, 108, 111, 99, 97, 116, 101, 100, 76, 102, 98, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 108, 101, 97, 114, 115, 32, 108, 111, 99, 97, 108,
+    32, 102, 114, 97, 109, 101, 32, 98, 117, 102, 102, 101, 114, 32, 116, 111, 32, 122, 101, 114, 111, 46, 32, 84, 104,
+    101, 32, 97, 108, 108, 111, 99, 97, 116, 101, 100, 32, 108, 111, 99, 97, 108, 32, 102, 114, 97, 109, 101, 32, 98,
+    117, 102, 102, 101, 114, 32, 105, 115, 32, 110, 111, 116, 32, 99, 108, 101, 97, 114, 101, 100, 32, 116, 111, 32,
+    122, 101, 114, 111, 32, 111, 110, 32, 76, 105, 110, 117, 120, 46, 32, 32, 65, 112, 112, 108, 105, 99, 97, 116, 105,
+    111, 110, 115, 32, 115, 111, 109, 101, 116, 105, 109, 101, 115, 32, 97, 115, 115, 117, 109, 101, 32, 116, 104, 97,
+    116, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 32, 119, 105, 108, 108, 32, 99, 108, 101, 97, 114, 32,
+    116, 104, 101, 32, 102, 114, 97, 109, 101, 98, 117, 102, 102, 101, 114, 32, 111, 110, 32, 76, 105, 110, 117, 120,
+    32, 40, 119, 104, 105, 99, 104, 32, 119, 111, 117, 108, 100, 32, 109, 97, 116, 99, 104, 32, 87, 105, 110, 100, 111,
+    119, 115, 32, 98, 101, 104, 97, 118, 105, 111, 114, 41, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105,
+    115, 97, 98, 108, 101, 52, 107, 66, 83, 119, 105, 122, 122, 108, 101, 68, 101, 112, 116, 104, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 112, 116,
+    104, 32, 105, 109, 97, 103, 101, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 65, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 52, 107, 66, 83, 119, 105, 122, 122, 108, 101, 67, 111,
+    108, 111, 114, 49, 68, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 49, 68, 32, 67, 111, 108, 111, 114, 32, 105, 109, 97, 103, 101, 115, 34, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101,
+    52, 107, 66, 83, 119, 105, 122, 122, 108, 101, 67, 111, 108, 111, 114, 50, 68, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 50, 68, 32, 67, 111, 108, 111, 114,
+    32, 105, 109, 97, 103, 101, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    65, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 52, 107, 66, 83, 119, 105, 122, 122, 108, 101, 67, 111, 108,
+    111, 114, 51, 68, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 51, 68, 32, 67, 111, 108, 111, 114, 32, 105, 109, 97, 103, 101, 115, 34, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 52, 107, 66, 83, 119, 105, 122,
+    122, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 66, 105, 116, 109, 97, 115, 107, 32, 118, 97, 108, 117, 101, 115, 32, 116, 104, 97, 116, 32, 99,
+    111, 114, 114, 101, 115, 112, 111, 110, 100, 32, 116, 111, 32, 105, 109, 97, 103, 101, 32, 116, 121, 112, 101, 115,
+    32, 102, 111, 114, 32, 99, 111, 110, 116, 114, 111, 108, 108, 105, 110, 103, 32, 52, 107, 66, 32, 115, 119, 105,
+    122, 122, 108, 101, 32, 109, 111, 100, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 52, 75, 98, 83,
+    119, 105, 122, 122, 108, 101, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 10, 32, 32, 32, 32,
+    32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 50, 53, 50, 54,
+    55, 54, 56, 52, 50, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 100, 100, 114,
+    50, 68, 105, 115, 97, 98, 108, 101, 52, 107, 66, 83, 119, 105, 122, 122, 108, 101, 77, 111, 100, 101, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 109,
+    97, 115, 107, 32, 111, 102, 32, 115, 117, 114, 102, 97, 99, 101, 32, 116, 121, 112, 101, 115, 32, 119, 104, 105, 99,
+    104, 32, 115, 104, 111, 117, 108, 100, 32, 110, 111, 116, 32, 97, 108, 108, 111, 119, 32, 52, 107, 66, 32, 115, 119,
+    105, 122, 122, 108, 101, 32, 109, 111, 100, 101, 115, 32, 102, 111, 114, 32, 99, 104, 105, 112, 115, 32, 119, 104,
+    105, 99, 104, 32, 117, 115, 101, 32, 65, 100, 100, 114, 77, 103, 114, 50, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 87, 104, 101, 116, 104, 101, 114, 32, 116, 111, 32, 100, 105, 115, 97, 98, 108, 101, 32, 88, 79, 82, 32,
+    116, 105, 108, 101, 32, 109, 111, 100, 101, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 10, 32, 32, 32,
+    32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 53, 55, 54, 48,
+    53, 50, 52, 50, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 97, 100, 100, 114, 50, 68, 105, 115, 97, 98, 108, 101, 88, 111, 114, 84, 105, 108, 101, 77, 111, 100,
+    101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 68, 105, 115,
+    97, 98, 108, 101, 88, 111, 114, 84, 105, 108, 101, 77, 111, 100, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 118, 101, 114, 108, 97, 121, 82,
+    101, 112, 111, 114, 116, 72, 68, 82, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 118, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 68, 82, 34, 10, 32, 32, 32, 32,
+    32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 51, 53, 52, 55,
+    49, 49, 54, 52, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97,
+    116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98,
+    111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 111, 118, 101, 114, 108, 97, 121, 82, 101, 112, 111, 114, 116, 72, 68, 82, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116, 101, 114, 109, 105, 110,
+    101, 115, 32, 105, 102, 32, 116, 104, 101, 32, 100, 101, 118, 101, 108, 111, 112, 101, 114, 32, 109, 111, 100, 101,
+    32, 111, 118, 101, 114, 108, 97, 121, 32, 119, 105, 108, 108, 32, 114, 101, 112, 111, 114, 116, 32, 105, 110, 102,
+    111, 114, 109, 97, 116, 105, 111, 110, 32, 97, 98, 111, 117, 116, 32, 72, 68, 82, 32, 109, 111, 100, 101, 46, 34,
+    10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32,
+    116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 79, 112, 116, 78, 111, 110, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 97, 108, 108, 32, 112, 105,
+    112, 101, 108, 105, 110, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 34, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 112, 116, 84, 114, 105, 109, 85, 110, 117, 115, 101,
+    100, 79, 117, 116, 112, 117, 116, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 114, 105, 109, 32, 117, 110, 117, 115, 101, 100, 32, 115, 104, 97, 100,
+    101, 114, 32, 111, 117, 116, 112, 117, 116, 115, 32, 40, 119, 104, 105, 99, 104, 32, 97, 108, 108, 111, 119, 115,
+    32, 100, 101, 97, 100, 45, 99, 111, 100, 101, 32, 114, 101, 109, 111, 118, 97, 108, 32, 116, 111, 32, 116, 114, 105,
+    109, 32, 117, 110, 117, 115, 101, 100, 32, 83, 104, 97, 100, 101, 114, 32, 105, 110, 112, 117, 116, 115, 32, 97,
+    115, 32, 119, 101, 108, 108, 44, 32, 97, 110, 100, 32, 98, 117, 98, 98, 108, 101, 45, 117, 112, 32, 116, 111, 32,
+    97, 108, 108, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 115, 116, 97, 103, 101, 115, 41, 34, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 79, 112, 116, 70, 108, 97, 103, 115, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87,
+    104, 111, 108, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105,
+    111, 110, 32, 109, 111, 100, 101, 115, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 87, 104, 111, 108, 101, 80, 105, 112, 101, 108, 105, 110, 101, 79, 112, 116, 105, 109,
+    105, 122, 97, 116, 105, 111, 110, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 10, 32, 32, 32, 32, 32,
+    32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 50, 54, 51, 55, 54,
+    53, 48, 55, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 79, 112, 116, 84, 114, 105, 109,
+    85, 110, 117, 115, 101, 100, 79, 117, 116, 112, 117, 116, 115, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101,
+    121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 104, 111, 108,
+    101, 80, 105, 112, 101, 108, 105, 110, 101, 79, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 101, 108,
+    101, 99, 116, 115, 32, 119, 104, 105, 99, 104, 32, 109, 101, 116, 104, 111, 100, 115, 32, 111, 102, 32, 119, 104,
+    111, 108, 101, 45, 112, 105, 112, 101, 108, 105, 110, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111,
+    110, 115, 32, 97, 114, 101, 32, 101, 110, 97, 98, 108, 101, 100, 46, 32, 48, 120, 49, 32, 45, 32, 84, 114, 105, 109,
+    32, 117, 110, 117, 115, 101, 100, 32, 83, 104, 97, 100, 101, 114, 32, 111, 117, 116, 112, 117, 116, 115, 32, 40,
+    119, 104, 105, 99, 104, 32, 97, 108, 108, 111, 119, 115, 32, 100, 101, 97, 100, 45, 99, 111, 100, 101, 32, 114, 101,
+    109, 111, 118, 97, 108, 32, 116, 111, 32, 116, 114, 105, 109, 117, 110, 117, 115, 101, 100, 32, 83, 104, 97, 100,
+    101, 114, 32, 105, 110, 112, 117, 116, 115, 32, 97, 115, 32, 119, 101, 108, 108, 44, 32, 97, 110, 100, 32, 98, 117,
+    98, 98, 108, 101, 45, 117, 112, 32, 116, 111, 32, 97, 108, 108, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 115,
+    116, 97, 103, 101, 115, 41, 46, 32, 32, 66, 121, 32, 100, 101, 102, 97, 117, 108, 116, 44, 32, 111, 110, 108, 121,
+    32, 116, 104, 101, 32, 114, 101, 109, 111, 118, 97, 108, 32, 111, 102, 32, 117, 110, 117, 115, 101, 100, 32, 115,
+    104, 97, 100, 101, 114, 32, 111, 117, 116, 112, 117, 116, 115, 32, 105, 115, 32, 112, 101, 114, 102, 111, 114, 109,
+    101, 100, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 69, 108, 102, 67, 97, 99, 104, 101, 77, 97, 120, 83, 105, 122, 101, 77, 98, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102,
+    111, 114, 109, 97, 110, 99, 101, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 52, 56, 49, 50, 55, 57, 50, 54, 52, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 54, 52, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 108, 102, 67, 97, 99, 104, 101, 77, 97,
+    120, 83, 105, 122, 101, 77, 98, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 83, 105, 122, 101, 32, 99, 97, 112, 32, 105, 110, 32, 109, 101, 103, 97, 98, 121, 116,
+    101, 115, 32, 111, 102, 32, 116, 104, 101, 32, 111, 110, 45, 100, 105, 115, 107, 32, 99, 97, 99, 104, 101, 32, 111,
+    102, 32, 112, 97, 114, 115, 101, 100, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 69, 76, 70, 32, 109, 101, 116,
+    97, 100, 97, 116, 97, 46, 32, 84, 104, 101, 32, 99, 97, 99, 104, 101, 32, 105, 115, 32, 111, 110, 108, 121, 32, 117,
+    115, 101, 100, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 115, 104, 97, 100, 101, 114, 32, 99, 97, 99, 104, 101,
+    32, 109, 111, 100, 101, 32, 105, 115, 32, 83, 104, 97, 100, 101, 114, 67, 97, 99, 104, 101, 79, 110, 68, 105, 115,
+    107, 32, 97, 110, 100, 32, 105, 115, 32, 115, 116, 111, 114, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 100,
+    101, 118, 105, 99, 101, 39, 115, 32, 99, 97, 99, 104, 101, 32, 102, 105, 108, 101, 32, 112, 97, 116, 104, 46, 32,
+    48, 32, 100, 105, 115, 97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 99, 97, 99, 104, 101, 46, 34, 10, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 108,
+    102, 67, 97, 99, 104, 101, 77, 97, 120, 69, 110, 116, 114, 105, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110,
+    99, 101, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 51, 49, 49, 56, 55, 48, 48, 57, 48, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 54,
+    51, 56, 52, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 108, 102, 67, 97, 99, 104, 101, 77, 97, 120, 69, 110, 116, 114,
+    105, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 112, 105, 112, 101, 108,
+    105, 110, 101, 115, 32, 105, 110, 32, 116, 104, 101, 32, 111, 110, 45, 100, 105, 115, 107, 32, 99, 97, 99, 104, 101,
+    32, 111, 102, 32, 112, 97, 114, 115, 101, 100, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 69, 76, 70, 32, 109,
+    101, 116, 97, 100, 97, 116, 97, 46, 32, 84, 104, 101, 32, 99, 97, 99, 104, 101, 32, 105, 110, 100, 101, 120, 32,
+    105, 115, 32, 115, 105, 122, 101, 100, 32, 102, 111, 114, 32, 116, 104, 105, 115, 32, 109, 97, 110, 121, 32, 101,
+    110, 116, 114, 105, 101, 115, 44, 32, 115, 111, 32, 99, 104, 97, 110, 103, 105, 110, 103, 32, 105, 116, 32, 100,
+    105, 115, 99, 97, 114, 100, 115, 32, 116, 104, 101, 32, 101, 120, 105, 115, 116, 105, 110, 103, 32, 99, 97, 99, 104,
+    101, 46, 32, 48, 32, 100, 105, 115, 97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 99, 97, 99, 104, 101, 46, 34, 10,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    80, 105, 112, 101, 108, 105, 110, 101, 66, 97, 116, 99, 104, 84, 104, 114, 101, 97, 100, 67, 111, 117, 110, 116, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80,
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 52, 53, 53, 55, 50, 50, 55, 55, 54, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 105, 112, 101, 108, 105, 110, 101,
+    66, 97, 116, 99, 104, 84, 104, 114, 101, 97, 100, 67, 111, 117, 110, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 110, 117,
+    109, 98, 101, 114, 32, 111, 102, 32, 116, 104, 114, 101, 97, 100, 115, 44, 32, 105, 110, 99, 108, 117, 100, 105,
+    110, 103, 32, 116, 104, 101, 32, 99, 97, 108, 108, 105, 110, 103, 32, 116, 104, 114, 101, 97, 100, 44, 32, 119, 104,
+    105, 99, 104, 32, 99, 114, 101, 97, 116, 101, 32, 116, 104, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115,
+    32, 111, 102, 32, 97, 32, 115, 105, 110, 103, 108, 101, 32, 73, 68, 101, 118, 105, 99, 101, 58, 58, 67, 114, 101,
+    97, 116, 101, 71, 114, 97, 112, 104, 105, 99, 115, 80, 105, 112, 101, 108, 105, 110, 101, 115, 40, 41, 32, 99, 97,
+    108, 108, 46, 32, 48, 32, 117, 115, 101, 115, 32, 111, 110, 101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 101, 114,
+    32, 108, 111, 103, 105, 99, 97, 108, 32, 67, 80, 85, 32, 99, 111, 114, 101, 46, 32, 49, 32, 99, 114, 101, 97, 116,
+    101, 115, 32, 116, 104, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 32, 115, 101, 114, 105, 97, 108, 108,
+    121, 32, 111, 110, 32, 116, 104, 101, 32, 99, 97, 108, 108, 105, 110, 103, 32, 116, 104, 114, 101, 97, 100, 46, 34,
+    10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 69, 110, 97, 98, 108, 101, 83, 99, 97, 108, 97, 98, 108, 101, 86, 97, 65, 108, 108, 111, 99, 97, 116, 111, 114,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 52, 48, 54, 50, 56, 50, 57, 55, 55, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97, 98, 108,
+    101, 83, 99, 97, 108, 97, 98, 108, 101, 86, 97, 65, 108, 108, 111, 99, 97, 116, 111, 114, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117,
+    101, 44, 32, 118, 105, 114, 116, 117, 97, 108, 32, 97, 100, 100, 114, 101, 115, 115, 101, 115, 32, 105, 110, 32,
+    116, 104, 101, 32, 112, 97, 114, 116, 105, 116, 105, 111, 110, 115, 32, 109, 97, 110, 97, 103, 101, 100, 32, 98,
+    121, 32, 116, 104, 101, 32, 86, 65, 77, 32, 109, 97, 110, 97, 103, 101, 114, 32, 97, 114, 101, 32, 97, 115, 115,
+    105, 103, 110, 101, 100, 32, 98, 121, 32, 80, 65, 76, 39, 115, 32, 115, 105, 122, 101, 45, 99, 108, 97, 115, 115,
+    101, 100, 32, 86, 65, 32, 97, 108, 108, 111, 99, 97, 116, 111, 114, 44, 32, 119, 104, 105, 99, 104, 32, 115, 101,
+    114, 118, 101, 115, 32, 109, 111, 115, 116, 32, 114, 101, 113, 117, 101, 115, 116, 115, 32, 102, 114, 111, 109, 32,
+    112, 101, 114, 45, 116, 104, 114, 101, 97, 100, 32, 99, 97, 99, 104, 101, 115, 32, 119, 105, 116, 104, 111, 117,
+    116, 32, 116, 97, 107, 105, 110, 103, 32, 97, 32, 108, 111, 99, 107, 46, 32, 73, 102, 32, 102, 97, 108, 115, 101,
+    44, 32, 101, 118, 101, 114, 121, 32, 114, 101, 113, 117, 101, 115, 116, 32, 103, 111, 101, 115, 32, 116, 104, 114,
+    111, 117, 103, 104, 32, 116, 104, 101, 32, 86, 65, 77, 32, 108, 105, 98, 114, 97, 114, 121, 32, 117, 110, 100, 101,
+    114, 32, 97, 32, 115, 105, 110, 103, 108, 101, 32, 108, 111, 99, 107, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 111, 114, 99, 101, 72, 101,
+    97, 112, 80, 101, 114, 102, 84, 111, 70, 105, 120, 101, 100, 86, 97, 108, 117, 101, 115, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114,
+    109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 66, 114, 105, 110, 103, 117, 112, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 49, 53, 55, 48, 51, 49, 50, 52,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102,
+    111, 114, 99, 101, 72, 101, 97, 112, 80, 101, 114, 102, 84, 111, 70, 105, 120, 101, 100, 86, 97, 108, 117, 101, 115,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73,
+    102, 32, 115, 101, 116, 32, 119, 101, 32, 119, 105, 108, 108, 32, 117, 115, 101, 32, 97, 32, 115, 101, 116, 32, 111,
+    102, 32, 104, 97, 114, 100, 45, 99, 111, 100, 101, 100, 32, 104, 101, 97, 112, 32, 112, 101, 114, 102, 111, 114,
+    109, 97, 110, 99, 101, 32, 118, 97, 108, 117, 101, 115, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 116,
+    104, 101, 32, 117, 115, 117, 97, 108, 32, 65, 83, 73, 67, 45, 115, 112, 101, 99, 105, 102, 105, 99, 32, 118, 97,
+    108, 117, 101, 115, 46, 32, 32, 84, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 105,
+    110, 116, 101, 110, 100, 101, 100, 32, 102, 111, 114, 32, 98, 114, 105, 110, 103, 45, 117, 112, 32, 116, 101, 115,
+    116, 105, 110, 103, 32, 97, 115, 32, 119, 101, 32, 119, 105, 108, 108, 32, 114, 101, 116, 117, 114, 110, 32, 122,
+    101, 114, 111, 115, 32, 102, 111, 114, 32, 97, 108, 108, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101,
+    32, 100, 97, 116, 97, 32, 111, 110, 32, 117, 110, 107, 110, 111, 119, 110, 32, 71, 80, 85, 115, 46, 32, 32, 84, 104,
+    105, 115, 32, 99, 97, 110, 32, 99, 97, 117, 115, 101, 32, 115, 116, 114, 97, 110, 103, 101, 32, 98, 101, 104, 97,
+    118, 105, 111, 114, 32, 40, 101, 46, 103, 46, 44, 32, 112, 111, 111, 114, 32, 112, 101, 114, 102, 111, 114, 109, 97,
+    110, 99, 101, 41, 32, 105, 110, 32, 115, 111, 109, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 115,
+    46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 80, 85, 32, 114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114,
+    109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 108, 111, 99, 97, 108, 32, 109, 101, 109, 111, 114, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114,
+    102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 101, 97, 112, 80, 101,
+    114, 102, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 49, 48, 54, 55, 55, 49, 49, 48, 51, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    49, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102,
+    108, 111, 97, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 99, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70,
+    111, 114, 76, 111, 99, 97, 108, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 80, 85, 32, 119, 114, 105, 116,
+    101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 108, 111, 99, 97, 108, 32, 109,
+    101, 109, 111, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 55, 51, 48, 53, 55, 48, 49, 53, 55, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114,
+    76, 111, 99, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 112, 117, 87,
+    114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 71, 80, 85, 32, 114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114,
+    32, 108, 111, 99, 97, 108, 32, 109, 101, 109, 111, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 10, 32, 32, 32, 32, 32, 32, 93,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 51, 56, 54, 49, 48, 55,
+    51, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 82, 101, 97, 100,
+    80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 71, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34, 10, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110,
+    99, 101, 32, 102, 111, 114, 32, 108, 111, 99, 97, 108, 32, 109, 101, 109, 111, 114, 121, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114,
+    109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 10,
+    32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50,
+    48, 49, 51, 50, 56, 55, 56, 55, 51, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 10, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103,
+    112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 76, 111, 99, 97, 108, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114,
+    76, 111, 99, 97, 108, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 114, 101, 97, 100, 32, 112, 101,
+    114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 105, 110, 118, 105, 115, 105, 98, 108, 101, 32,
+    109, 101, 109, 111, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 56, 54, 48, 52, 51, 50, 50, 52, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114,
+    73, 110, 118, 105, 115, 105, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    71, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 73, 110, 118, 105, 115, 105, 98, 108, 101, 34, 10,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102, 111, 114, 109,
+    97, 110, 99, 101, 32, 102, 111, 114, 32, 105, 110, 118, 105, 115, 105, 98, 108, 101, 32, 109, 101, 109, 111, 114,
+    121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 101, 97,
+    112, 80, 101, 114, 102, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 50, 53, 57, 53, 50, 57, 49, 54, 48, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 102, 108, 111, 97, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 103, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 73, 110, 118, 105,
+    115, 105, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 87,
+    114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 73, 110, 118, 105, 115, 105, 98, 108, 101, 34, 10, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 67, 80, 85, 32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110,
+    99, 101, 32, 102, 111, 114, 32, 71, 97, 114, 116, 85, 115, 119, 99, 32, 109, 101, 109, 111, 114, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114,
+    102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 101, 97, 112, 80, 101,
+    114, 102, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 52, 48, 57, 53, 49, 51, 49, 50, 56, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    49, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102,
+    108, 111, 97, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 99, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119,
+    99, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 112, 117, 87, 114, 105, 116, 101,
+    80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    67, 80, 85, 32, 114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32,
+    71, 97, 114, 116, 85, 115, 119, 99, 32, 109, 101, 109, 111, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99,
+    101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 10, 32, 32, 32, 32,
+    32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 54, 54, 52, 50, 51,
+    54, 56, 52, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 112, 117, 82, 101, 97,
+    100, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 67, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116,
+    85, 115, 119, 99, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 114, 101, 97, 100, 32, 112, 101, 114,
+    102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 71, 97, 114, 116, 85, 115, 119, 99, 32, 109, 101, 109,
+    111, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72,
+    101, 97, 112, 80, 101, 114, 102, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 55, 54, 49, 55, 48, 48, 56, 54, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 71, 97,
+    114, 116, 85, 115, 119, 99, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117,
+    82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34, 10, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 71, 80, 85, 32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101,
+    32, 102, 111, 114, 32, 71, 97, 114, 116, 85, 115, 119, 99, 32, 109, 101, 109, 111, 114, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111,
+    114, 109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34,
+    10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    50, 53, 55, 52, 49, 53, 57, 56, 48, 50, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 10, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97,
+    116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    103, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 87, 114, 105, 116, 101, 80, 101,
+    114, 102, 70, 111, 114, 71, 97, 114, 116, 85, 115, 119, 99, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 80,
+    85, 32, 114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 71, 97,
+    114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 32, 109, 101, 109, 111, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109,
+    97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 10, 32,
+    32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 56,
+    54, 57, 49, 55, 50, 51, 55, 53, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 10, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 112,
+    117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 112, 117, 82, 101, 97, 100, 80, 101,
+    114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 67, 80, 85, 32, 119, 114, 105, 116, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32,
+    102, 111, 114, 32, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 32, 109, 101, 109, 111, 114, 121, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80,
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 101, 97, 112,
+    80, 101, 114, 102, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 57, 53, 57, 55, 48, 56, 49, 49, 56, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    49, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102,
+    108, 111, 97, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 99, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99,
+    104, 101, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 112, 117,
+    87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101,
+    34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 114, 101, 97, 100, 32, 112, 101, 114, 102, 111, 114,
+    109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 32, 109,
+    101, 109, 111, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 48, 54, 50, 55, 53, 48, 51, 57, 53, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 71,
+    97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 71, 112, 117, 82, 101, 97, 100, 80, 101, 114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101,
+    97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 80, 85, 32, 119, 114, 105, 116, 101, 32, 112, 101,
+    114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 102, 111, 114, 32, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98,
+    108, 101, 32, 109, 101, 109, 111, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 72, 101, 97, 112, 80, 101, 114, 102, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 50, 49, 48, 50, 57, 55, 51, 56, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 112, 117, 87, 114, 105, 116, 101, 80, 101,
+    114, 102, 70, 111, 114, 71, 97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 112, 117, 87, 114, 105, 116, 101, 80, 101, 114, 102, 70, 111, 114, 71,
+    97, 114, 116, 67, 97, 99, 104, 101, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 108, 108, 111, 99, 97, 116, 105, 111, 110, 76,
+    105, 115, 116, 82, 101, 117, 115, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 10, 32,
+    32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 55,
+    50, 55, 48, 51, 54, 57, 57, 52, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101,
+    10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34,
+    58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 79, 83, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 76, 105, 110, 117, 120, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75,
+    101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 108, 108, 111,
+    99, 97, 116, 105, 111, 110, 76, 105, 115, 116, 82, 101, 117, 115, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 45, 117, 115, 101, 32, 97,
+    108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 108, 105, 115, 116, 32, 97, 99, 114, 111, 115, 115, 32, 115, 117, 98,
+    109, 105, 115, 115, 105, 111, 110, 115, 32, 105, 110, 32, 76, 105, 110, 117, 120, 46, 32, 84, 104, 105, 115, 32,
+    119, 105, 108, 108, 32, 105, 109, 112, 114, 111, 118, 101, 32, 67, 80, 85, 32, 112, 101, 114, 102, 111, 114, 109,
+    97, 110, 99, 101, 32, 111, 102, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 115, 117,
+    98, 109, 105, 115, 115, 105, 111, 110, 44, 32, 98, 117, 116, 32, 119, 105, 108, 108, 32, 112, 111, 116, 101, 110,
+    116, 105, 97, 108, 108, 121, 32, 99, 97, 117, 115, 101, 32, 71, 80, 85, 32, 109, 101, 109, 111, 114, 121, 32, 100,
+    101, 45, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 116, 111, 32, 98, 101, 32, 100, 101, 108, 97, 121, 101,
+    100, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 70, 101, 110, 99, 101, 84, 105, 109, 101, 111, 117, 116, 79, 118, 101, 114, 114, 105, 100, 101, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80,
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 69, 109, 117, 108,
+    97, 116, 105, 111, 110, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 57, 55, 48, 49, 55, 50, 56, 49, 55, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 101, 110, 99, 101, 84, 105, 109, 101, 111, 117, 116, 79, 118,
+    101, 114, 114, 105, 100, 101, 73, 110, 83, 101, 99, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 105, 109, 101, 111, 117, 116, 32, 118, 97, 108, 117, 101, 32, 116,
+    111, 32, 111, 118, 101, 114, 114, 105, 100, 101, 32, 97, 112, 112, 45, 115, 112, 101, 99, 105, 102, 105, 101, 100,
+    32, 118, 97, 108, 117, 101, 32, 102, 111, 114, 32, 102, 101, 110, 99, 101, 32, 116, 105, 109, 101, 111, 117, 116,
+    115, 46, 32, 32, 84, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 109, 101, 97, 110, 105,
+    110, 103, 108, 101, 115, 115, 32, 105, 102, 32, 116, 104, 101, 32, 97, 112, 112, 32, 115, 112, 101, 99, 105, 102,
+    105, 101, 100, 32, 122, 101, 114, 111, 32, 115, 101, 99, 111, 110, 100, 115, 46, 32, 32, 65, 32, 118, 97, 108, 117,
+    101, 32, 111, 102, 32, 122, 101, 114, 111, 32, 104, 101, 114, 101, 32, 109, 101, 97, 110, 115, 32, 116, 111, 32,
+    117, 115, 101, 32, 116, 104, 101, 32, 97, 112, 112, 45, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 116, 105,
+    109, 101, 111, 117, 116, 32, 118, 97, 108, 117, 101, 46, 32, 32, 85, 115, 101, 102, 117, 108, 32, 111, 110, 32, 72,
+    87, 32, 115, 105, 109, 117, 108, 97, 116, 105, 111, 110, 32, 119, 104, 101, 114, 101, 32, 119, 111, 114, 107, 105,
+    110, 103, 32, 99, 97, 115, 101, 115, 32, 99, 97, 110, 32, 114, 101, 115, 117, 108, 116, 32, 105, 110, 32, 102, 97,
+    108, 115, 101, 32, 116, 105, 109, 101, 111, 117, 116, 115, 46, 32, 32, 86, 97, 108, 117, 101, 32, 115, 112, 101, 99,
+    105, 102, 105, 101, 100, 32, 105, 110, 32, 115, 101, 99, 111, 110, 100, 115, 34, 10, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 112, 100, 97, 116, 101,
+    79, 110, 101, 71, 112, 117, 86, 105, 114, 116, 117, 97, 108, 65, 100, 100, 114, 101, 115, 115, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102,
+    111, 114, 109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 97, 102, 101, 83, 101, 116,
+    116, 105, 110, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 98, 117, 103, 34, 10, 32, 32, 32, 32,
+    32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 49, 55, 56, 51,
+    56, 51, 53, 55, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 117, 112, 100, 97, 116, 101, 79, 110, 101, 71, 112, 117, 86, 105, 114, 116, 117, 97, 108, 65, 100, 100,
+    114, 101, 115, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32, 119, 104, 101, 110, 32, 99, 97, 108, 108, 105, 110, 103, 32, 82,
+    101, 109, 97, 112, 86, 105, 114, 116, 117, 97, 108, 77, 101, 109, 111, 114, 121, 80, 97, 103, 101, 115, 40, 41, 44,
+    32, 80, 65, 76, 32, 119, 105, 108, 108, 32, 111, 110, 108, 121, 32, 100, 111, 32, 111, 110, 101, 32, 117, 110, 109,
+    97, 112, 47, 109, 97, 112, 32, 112, 114, 111, 116, 101, 99, 116, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 32,
+    97, 116, 32, 97, 32, 116, 105, 109, 101, 44, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 116, 114, 121,
+    105, 110, 103, 32, 116, 111, 32, 103, 114, 111, 117, 112, 32, 116, 104, 101, 32, 111, 112, 101, 114, 97, 116, 105,
+    111, 110, 115, 32, 98, 121, 32, 66, 97, 115, 101, 65, 100, 100, 114, 101, 115, 115, 46, 32, 32, 84, 104, 105, 115,
+    32, 97, 102, 102, 101, 99, 116, 115, 32, 87, 68, 68, 77, 50, 32, 111, 110, 108, 121, 46, 34, 10, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 108, 119,
+    97, 121, 115, 82, 101, 115, 105, 100, 101, 110, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 10, 32,
+    32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 57,
+    56, 57, 49, 51, 48, 54, 56, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101,
+    10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 97, 108, 119, 97, 121, 115, 82, 101, 115, 105, 100, 101, 110, 116, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 108, 108, 32, 97, 108, 108,
+    111, 99, 97, 116, 105, 111, 110, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 112, 101, 114, 109, 97, 110, 101,
+    110, 116, 108, 121, 32, 107, 101, 112, 116, 32, 114, 101, 115, 105, 100, 101, 110, 116, 32, 119, 105, 116, 104, 111,
+    117, 116, 32, 109, 97, 110, 97, 103, 101, 109, 101, 110, 116, 32, 98, 121, 32, 116, 104, 101, 32, 99, 108, 105, 101,
+    110, 116, 32, 119, 105, 116, 104, 32, 65, 100, 100, 71, 112, 117, 77, 101, 109, 111, 114, 121, 82, 101, 102, 101,
+    114, 101, 110, 99, 101, 115, 46, 32, 32, 84, 104, 105, 115, 32, 109, 97, 121, 32, 114, 101, 100, 117, 99, 101, 32,
+    116, 104, 101, 32, 114, 117, 110, 116, 105, 109, 101, 32, 111, 118, 101, 114, 104, 101, 97, 100, 32, 111, 102, 32,
+    115, 117, 98, 109, 105, 115, 115, 105, 111, 110, 32, 111, 110, 32, 76, 105, 110, 117, 120, 44, 32, 98, 117, 116, 32,
+    119, 111, 110, 39, 116, 32, 119, 111, 114, 107, 32, 112, 114, 111, 112, 101, 114, 108, 121, 32, 105, 102, 32, 116,
+    104, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 32, 111, 118, 101, 114, 99, 111, 109, 109, 105,
+    116, 115, 32, 116, 104, 101, 32, 97, 118, 97, 105, 108, 97, 98, 108, 101, 32, 71, 80, 85, 32, 109, 101, 109, 111,
+    114, 121, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 83, 121, 110, 99, 111, 98, 106, 70, 101, 110, 99, 101, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101,
+    114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 56, 55, 55, 49, 53, 56, 53, 56, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101,
+    83, 121, 110, 99, 111, 98, 106, 70, 101, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 70, 101, 110, 99, 101, 32,
+    98, 97, 115, 101, 100, 32, 111, 110, 32, 83, 121, 110, 99, 32, 79, 98, 106, 101, 99, 116, 46, 32, 70, 111, 114, 99,
+    101, 32, 117, 115, 101, 32, 84, 105, 109, 101, 115, 116, 97, 109, 112, 32, 70, 101, 110, 99, 101, 46, 32, 66, 121,
+    32, 100, 101, 102, 97, 117, 108, 116, 32, 70, 101, 110, 99, 101, 32, 116, 121, 112, 101, 32, 105, 115, 32, 115, 101,
+    108, 101, 99, 116, 101, 100, 32, 97, 99, 99, 111, 114, 100, 105, 110, 103, 32, 116, 111, 32, 116, 104, 101, 32, 115,
+    121, 115, 116, 101, 109, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 46, 34, 10, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117,
+    101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32,
+    116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105, 100, 70, 111, 114, 99, 101, 68, 105, 115, 97,
+    98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 70, 111, 114, 99, 101, 32, 116, 104, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110,
+    32, 97, 108, 119, 97, 121, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105, 100, 68, 101, 102,
+    97, 117, 108, 116, 69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 79, 110, 108, 121, 32, 101, 110, 97, 98, 108, 101, 32, 116, 104,
+    101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 32, 119, 104, 101, 110, 32, 107, 101, 114, 110,
+    101, 108, 32, 100, 114, 105, 118, 101, 114, 32, 99, 97, 110, 32, 115, 117, 112, 112, 111, 114, 116, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108,
+    105, 100, 70, 111, 114, 99, 101, 69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 116, 104, 101, 32, 111, 112,
+    116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 32, 97, 108, 119, 97, 121, 115, 32, 101, 110, 97, 98, 108, 101,
+    100, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105,
+    100, 69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 102, 105, 110, 101, 115, 32, 116, 104, 101, 32, 115, 117, 112, 112,
+    111, 114, 116, 101, 100, 32, 86, 77, 32, 97, 108, 119, 97, 121, 115, 32, 118, 97, 108, 105, 100, 32, 109, 111, 100,
+    101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 69, 110, 97, 98, 108, 101, 86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105, 100, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111,
+    114, 109, 97, 110, 99, 101, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 49, 55, 49, 56, 50, 54, 52, 48, 57, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 34, 86, 109, 65, 108, 119, 97, 121, 115, 86, 97, 108, 105, 100, 68, 101, 102, 97, 117, 108,
+    116, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97, 98, 108, 101, 86, 109, 65, 108, 119,
+    97, 121, 115, 86, 97, 108, 105, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 87, 105, 116, 104, 32, 116, 104, 105, 115, 32, 102, 101, 97, 116, 117, 114, 101, 32,
+    101, 110, 97, 98, 108, 101, 100, 32, 86, 77, 32, 97, 100, 100, 114, 101, 115, 115, 101, 115, 32, 97, 114, 101, 32,
+    97, 108, 119, 97, 121, 115, 32, 118, 97, 108, 105, 100, 32, 119, 105, 116, 104, 105, 110, 32, 116, 104, 101, 32,
+    108, 111, 99, 97, 108, 32, 86, 77, 32, 99, 111, 110, 116, 101, 120, 116, 46, 32, 32, 84, 104, 105, 115, 32, 101,
+    108, 105, 109, 105, 110, 97, 116, 101, 115, 32, 116, 104, 101, 32, 110, 101, 101, 100, 32, 116, 111, 32, 97, 100,
+    100, 32, 112, 114, 105, 118, 97, 116, 101, 32, 109, 101, 109, 111, 114, 121, 32, 105, 110, 116, 111, 32, 116, 104,
+    101, 32, 114, 101, 115, 111, 117, 114, 99, 101, 32, 108, 105, 115, 116, 46, 32, 84, 104, 105, 115, 32, 109, 97, 121,
+    32, 114, 101, 100, 117, 99, 101, 32, 116, 104, 101, 32, 114, 117, 110, 116, 105, 109, 101, 32, 111, 118, 101, 114,
+    104, 101, 97, 100, 32, 111, 102, 32, 115, 117, 98, 109, 105, 115, 115, 105, 111, 110, 32, 111, 110, 32, 76, 105,
+    110, 117, 120, 44, 32, 98, 117, 116, 32, 119, 111, 110, 39, 116, 32, 119, 111, 114, 107, 32, 102, 111, 114, 32, 109,
+    101, 109, 111, 114, 121, 32, 115, 104, 97, 114, 101, 100, 32, 98, 121, 32, 109, 117, 108, 116, 105, 112, 108, 101,
+    32, 112, 114, 111, 99, 101, 115, 115, 101, 115, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 83, 121, 110, 99, 79,
+    98, 106, 101, 99, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 51, 48, 57, 51, 51, 56, 53, 57, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 79, 83, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 76, 105, 110, 117, 120,
+    34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 83, 121, 110,
+    99, 79, 98, 106, 101, 99, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 115, 32, 83, 121, 110, 99, 79, 98, 106, 101, 99, 116, 32,
+    115, 117, 112, 112, 111, 114, 116, 32, 102, 111, 114, 32, 115, 101, 109, 97, 112, 104, 111, 114, 101, 115, 32, 119,
+    104, 105, 99, 104, 32, 109, 101, 97, 110, 115, 32, 115, 101, 109, 97, 112, 104, 111, 114, 101, 115, 32, 119, 105,
+    108, 108, 32, 98, 101, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 80, 114, 111, 79, 110, 108, 121, 32, 111, 114,
+    32, 76, 101, 103, 97, 99, 121, 32, 105, 110, 116, 101, 114, 102, 97, 99, 101, 115, 32, 97, 99, 99, 111, 114, 100,
+    105, 110, 103, 32, 116, 111, 32, 116, 104, 101, 32, 115, 121, 115, 116, 101, 109, 32, 99, 111, 110, 102, 105, 103,
+    117, 114, 97, 116, 105, 111, 110, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115,
+    69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112,
+    77, 111, 100, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101,
+    114, 32, 100, 117, 109, 112, 105, 110, 103, 32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77,
+    111, 100, 101, 82, 101, 99, 111, 114, 100, 84, 105, 109, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 117, 109, 112, 105, 110, 103, 32, 105, 115, 32,
+    101, 110, 97, 98, 108, 101, 100, 32, 97, 116, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114,
+    32, 114, 101, 99, 111, 114, 100, 32, 116, 105, 109, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111, 100, 101, 83, 117, 98, 109, 105,
+    116, 84, 105, 109, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 68, 117, 109, 112, 105, 110, 103, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 32,
+    97, 116, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 115, 117, 98, 109, 105, 116, 32,
+    116, 105, 109, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109,
+    112, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 68, 101, 102, 105, 110, 101, 115, 32, 116, 104, 101, 32, 115, 117, 112, 112, 111, 114,
+    116, 101, 100, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 100, 117, 109, 112, 32,
+    109, 111, 100, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 114, 105, 110, 116, 105,
+    110, 103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 54, 48, 55, 57, 57, 49, 48, 51, 51, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111,
+    100, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 68, 117,
+    109, 112, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 68, 101, 116, 101, 114, 109, 105, 110, 101, 115, 32, 105, 102, 32, 100, 117, 109, 112, 105,
+    110, 103, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 44, 32, 97, 110, 100, 32, 119, 104, 101, 116, 104, 101,
+    114, 32, 105, 116, 32, 105, 115, 32, 97, 116, 32, 114, 101, 99, 111, 114, 100, 32, 111, 114, 32, 115, 117, 98, 109,
+    105, 116, 32, 116, 105, 109, 101, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115,
+    69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112,
+    70, 111, 114, 109, 97, 116, 84, 101, 120, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114,
+    115, 32, 97, 114, 101, 32, 100, 117, 109, 112, 101, 100, 32, 105, 110, 32, 112, 108, 97, 105, 110, 32, 116, 101,
+    120, 116, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66,
+    117, 102, 68, 117, 109, 112, 70, 111, 114, 109, 97, 116, 66, 105, 110, 97, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110,
+    100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 97, 114, 101, 32, 100, 117, 109, 112, 101, 100, 32, 105, 110, 32,
+    114, 97, 119, 32, 98, 105, 110, 97, 114, 121, 32, 109, 111, 100, 101, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70, 111, 114, 109, 97, 116,
+    66, 105, 110, 97, 114, 121, 72, 101, 97, 100, 101, 114, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102,
+    101, 114, 115, 32, 97, 114, 101, 32, 100, 117, 109, 112, 101, 100, 32, 105, 110, 32, 98, 105, 110, 97, 114, 121, 32,
+    109, 111, 100, 101, 32, 119, 105, 116, 104, 32, 80, 77, 52, 32, 104, 101, 97, 100, 101, 114, 115, 46, 34, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70, 111, 114, 109, 97, 116,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    68, 101, 102, 105, 110, 101, 115, 32, 116, 104, 101, 32, 115, 117, 112, 112, 111, 114, 116, 101, 100, 32, 102, 111,
+    114, 109, 97, 116, 115, 32, 102, 111, 114, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32,
+    100, 117, 109, 112, 105, 110, 103, 46, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70, 111, 114, 109, 97, 116, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 114, 105,
+    110, 116, 105, 110, 103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 10, 32, 32, 32, 32, 32, 32, 93,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 57, 48, 53, 49, 54, 52, 57,
+    55, 55, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109,
+    112, 70, 111, 114, 109, 97, 116, 84, 101, 120, 116, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101,
+    116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84,
+    104, 97, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67,
+    109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111, 100, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 68, 117, 109, 112, 70,
+    111, 114, 109, 97, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 102, 111, 114, 109, 97, 116, 32, 111,
+    102, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 100, 117, 109, 112, 115, 46, 34, 10,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 108, 97, 116, 105, 118, 101, 32, 100, 105, 114, 101, 99, 116, 111, 114,
+    121, 32, 119, 104, 101, 114, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 100,
+    117, 109, 112, 115, 32, 97, 114, 101, 32, 112, 108, 97, 99, 101, 100, 46, 32, 82, 101, 108, 97, 116, 105, 118, 101,
+    32, 116, 111, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 110, 32, 116, 104, 101, 32, 65, 77, 68, 95, 68, 69,
+    66, 85, 71, 95, 68, 73, 82, 32, 101, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 118, 97, 114, 105, 97,
+    98, 108, 101, 46, 32, 73, 102, 32, 116, 104, 97, 116, 32, 101, 110, 118, 32, 118, 97, 114, 32, 105, 115, 110, 39,
+    116, 32, 115, 101, 116, 44, 32, 116, 104, 101, 32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105, 115, 32, 112, 108,
+    97, 116, 102, 111, 114, 109, 32, 100, 101, 112, 101, 110, 100, 101, 110, 116, 46, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 114, 105, 110, 116, 105, 110,
+    103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 50, 57, 51, 50, 57, 53, 48, 50, 53, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 80,
+    97, 116, 104, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 87,
+    105, 110, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108, 67, 109, 100, 66, 117, 102, 102, 101, 114,
+    115, 92, 92, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 76, 110, 120, 68, 101, 102, 97, 117, 108, 116, 34, 58,
+    32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116, 116,
+    105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66,
+    117, 102, 68, 117, 109, 112, 77, 111, 100, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 68, 105, 114, 101, 99, 116, 111,
+    114, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115, 116, 114, 105, 110, 103,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99,
+    109, 100, 66, 117, 102, 68, 117, 109, 112, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80, 97, 116, 104, 83, 116, 114, 76, 101, 110, 34, 10,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    83, 117, 98, 109, 105, 116, 84, 105, 109, 101, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 83, 116, 97, 114, 116,
+    70, 114, 97, 109, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103,
+    34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 49, 54, 51, 57, 51, 48, 53, 52, 53, 56, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 76, 111, 103, 105, 99, 79, 112,
+    34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 77, 111, 100, 101,
+    34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110,
+    116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 115, 117, 98, 109, 105, 116, 84, 105, 109, 101, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 83, 116, 97,
+    114, 116, 70, 114, 97, 109, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 84, 104, 101, 32, 115, 116, 97, 114, 116, 105, 110, 103, 32, 102, 114, 97, 109, 101, 32,
+    116, 111, 32, 115, 116, 97, 114, 116, 32, 100, 117, 109, 112, 105, 110, 103, 32, 99, 111, 109, 109, 97, 110, 100,
+    32, 98, 117, 102, 102, 101, 114, 115, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 117, 98, 109, 105, 116, 84, 105, 109, 101, 67, 109, 100, 66,
+    117, 102, 68, 117, 109, 112, 69, 110, 100, 70, 114, 97, 109, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97,
+    110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 50, 50, 49, 57, 54, 49, 50, 57, 51, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116, 116,
+    105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66,
+    117, 102, 68, 117, 109, 112, 77, 111, 100, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 76, 111, 103, 105, 99, 79, 112,
+    34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 117, 98, 109, 105, 116, 84, 105, 109, 101, 67, 109, 100, 66,
+    117, 102, 68, 117, 109, 112, 83, 116, 97, 114, 116, 70, 114, 97, 109, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 117, 98, 109, 105,
+    116, 84, 105, 109, 101, 67, 109, 100, 66, 117, 102, 68, 117, 109, 112, 69, 110, 100, 70, 114, 97, 109, 101, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 101,
+    32, 101, 110, 100, 105, 110, 103, 32, 102, 114, 97, 109, 101, 32, 116, 111, 32, 115, 116, 111, 112, 32, 100, 117,
+    109, 112, 105, 110, 103, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 46, 34, 10, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76,
+    111, 103, 67, 109, 100, 66, 117, 102, 67, 111, 109, 109, 105, 116, 83, 105, 122, 101, 115, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 114, 105, 110, 116,
+    105, 110, 103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 50, 50, 50, 48, 48, 50, 53, 49, 55,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 66, 117, 105, 108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 100, 98, 103, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75,
+    101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 67,
+    109, 100, 66, 117, 102, 67, 111, 109, 109, 105, 116, 83, 105, 122, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119,
+    104, 101, 116, 104, 101, 114, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 32, 99, 111,
+    109, 109, 105, 116, 32, 115, 105, 122, 101, 115, 32, 97, 114, 101, 32, 108, 111, 103, 103, 101, 100, 32, 116, 111,
+    32, 97, 32, 102, 105, 108, 101, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 80, 105, 112, 101, 108, 105, 110, 101, 73, 110, 102,
+    111, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 10, 32, 32,
+    32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 51, 53,
+    55, 57, 49, 53, 54, 51, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 66, 117, 105, 108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 100, 98, 103, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111,
+    111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 108, 111, 103, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 80, 105, 112, 101, 108,
+    105, 110, 101, 32, 76, 111, 103, 103, 105, 110, 103, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 105, 112, 101,
+    108, 105, 110, 101, 32, 76, 111, 103, 103, 105, 110, 103, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105,
+    111, 110, 32, 111, 112, 116, 105, 111, 110, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 114, 105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32, 76,
+    111, 103, 103, 105, 110, 103, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 50, 53, 56, 55, 56, 52, 53, 56, 50, 53, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 66, 117, 105, 108,
+    100, 84, 121, 112, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 100, 98, 103, 34, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116,
+    114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 80, 105, 112, 101, 108, 105, 110, 101, 73, 110, 102,
+    111, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97,
+    116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 115,
+    116, 114, 117, 99, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 112, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 67, 111, 110, 102, 105, 103, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 83, 116, 114, 117, 99, 116, 117, 114, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 67, 111, 110, 116, 111, 108, 115, 32, 108, 111, 103, 103, 105, 110, 103, 32, 111, 102, 32, 105, 110,
+    116, 101, 114, 110, 97, 108, 108, 121, 32, 103, 101, 110, 101, 114, 97, 116, 101, 100, 32, 112, 105, 112, 101, 108,
+    105, 110, 101, 115, 32, 40, 105, 46, 101, 46, 32, 82, 80, 77, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 44,
+    32, 101, 116, 99, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 49, 49, 54, 49, 50, 57, 54, 55, 56, 53, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103,
+    73, 110, 116, 101, 114, 110, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 76, 111, 103, 73, 110, 116, 101, 114, 110, 97, 108, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 111, 108, 115, 32, 108, 111, 103, 103, 105, 110, 103,
+    32, 111, 102, 32, 101, 120, 116, 101, 114, 110, 97, 108, 108, 121, 32, 103, 101, 110, 101, 114, 97, 116, 101, 100,
+    32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 32, 40, 105, 46, 101, 46, 32, 116, 104, 101, 32, 97, 112, 112, 108,
+    105, 99, 97, 116, 105, 111, 110, 39, 115, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 48, 55, 49, 52, 53, 49, 57, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 69, 120, 116, 101, 114, 110, 97, 108, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 69, 120, 116, 101, 114, 110, 97,
+    108, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116,
+    114, 117, 101, 44, 32, 101, 97, 99, 104, 32, 115, 104, 97, 100, 101, 114, 32, 105, 110, 32, 97, 32, 112, 105, 112,
+    101, 108, 105, 110, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 108, 111, 103, 103, 101, 100, 32, 116, 111, 32,
+    97, 32, 115, 101, 112, 97, 114, 97, 116, 101, 32, 102, 105, 108, 101, 32, 111, 110, 32, 100, 105, 115, 107, 46, 32,
+    79, 116, 104, 101, 114, 119, 105, 115, 101, 32, 116, 104, 101, 32, 119, 104, 111, 108, 101, 32, 112, 105, 112, 101,
+    108, 105, 110, 101, 32, 105, 115, 32, 112, 108, 97, 99, 101, 100, 32, 105, 110, 32, 97, 32, 115, 105, 110, 103, 108,
+    101, 32, 102, 105, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 50, 57, 53, 52, 54, 52, 49, 54, 55, 54, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108,
+    111, 103, 83, 104, 97, 100, 101, 114, 115, 83, 101, 112, 97, 114, 97, 116, 101, 108, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 83, 104, 97, 100, 101, 114, 115, 83,
+    101, 112, 97, 114, 97, 116, 101, 108, 121, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 100, 117, 112, 108, 105, 99, 97, 116, 101, 32, 112,
+    105, 112, 101, 108, 105, 110, 101, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 100, 117, 109, 112, 101, 100, 32,
+    116, 111, 32, 97, 32, 102, 105, 108, 101, 32, 119, 105, 116, 104, 32, 97, 32, 110, 117, 109, 101, 114, 105, 99, 32,
+    115, 117, 102, 102, 105, 120, 32, 97, 116, 116, 97, 99, 104, 101, 100, 32, 116, 111, 32, 116, 104, 101, 32, 102,
+    105, 108, 101, 110, 97, 109, 101, 32, 116, 111, 32, 100, 105, 115, 116, 105, 110, 103, 117, 105, 115, 104, 32, 101,
+    97, 99, 104, 32, 99, 111, 112, 121, 32, 111, 102, 32, 116, 104, 101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 46,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 53, 55,
+    57, 56, 51, 48, 50, 55, 54, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 111, 103, 68, 117, 112, 108, 105,
+    99, 97, 116, 101, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 68, 117, 112, 108, 105, 99, 97, 116, 101, 80, 105, 112, 101,
+    108, 105, 110, 101, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    73, 102, 32, 116, 114, 117, 101, 44, 32, 100, 105, 115, 97, 115, 115, 101, 109, 98, 108, 121, 32, 105, 110, 102,
+    111, 114, 109, 97, 116, 105, 111, 110, 32, 119, 105, 108, 108, 32, 98, 101, 32, 101, 109, 98, 101, 100, 100, 101,
+    100, 32, 105, 110, 116, 111, 32, 99, 111, 109, 112, 105, 108, 101, 100, 32, 69, 76, 70, 32, 98, 105, 110, 97, 114,
+    105, 101, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 51, 53, 56, 54, 52, 48, 50, 49, 52, 51, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 109, 98,
+    101, 100, 80, 105, 112, 101, 108, 105, 110, 101, 68, 105, 115, 97, 115, 115, 101, 109, 98, 108, 121, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 109, 98, 101, 100, 80, 105, 112, 101,
+    108, 105, 110, 101, 68, 105, 115, 97, 115, 115, 101, 109, 98, 108, 121, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100,
+    86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69,
+    110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108,
+    105, 110, 101, 76, 111, 103, 70, 105, 108, 116, 101, 114, 78, 111, 110, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68,
+    111, 32, 110, 111, 116, 32, 100, 105, 115, 97, 98, 108, 101, 32, 108, 111, 103, 103, 105, 110, 103, 32, 98, 97, 115,
+    101, 100, 32, 111, 110, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 116, 121, 112, 101, 46, 34, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80,
+    105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 70, 105, 108, 116, 101, 114, 67, 115, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 68, 105, 115, 97, 98, 108, 101, 32, 108, 111, 103, 103, 105, 110, 103, 32, 102, 111, 114, 32, 67, 115, 32, 112,
+    105, 112, 101, 108, 105, 110, 101, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 70, 105, 108,
+    116, 101, 114, 78, 103, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 108, 111, 103, 103,
+    105, 110, 103, 32, 102, 111, 114, 32, 78, 71, 71, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80,
+    105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 70, 105, 108, 116, 101, 114, 71, 115, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 68, 105, 115, 97, 98, 108, 101, 32, 108, 111, 103, 103, 105, 110, 103, 32, 102, 111, 114, 32, 71, 115, 32, 112,
+    105, 112, 101, 108, 105, 110, 101, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 70, 105, 108,
+    116, 101, 114, 84, 101, 115, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 108, 111,
+    103, 103, 105, 110, 103, 32, 102, 111, 114, 32, 84, 101, 115, 115, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115,
+    34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 70, 105, 108, 116, 101, 114, 86, 115, 80, 115, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49,
+    54, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 108, 111, 103, 103, 105, 110, 103, 32, 102,
+    111, 114, 32, 86, 115, 80, 115, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 76, 111,
+    103, 70, 105, 108, 116, 101, 114, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112,
+    101, 70, 105, 108, 116, 101, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 49, 57, 49, 49, 52, 52, 51, 56, 56, 54, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101,
+    120, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 66, 105,
+    116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105,
+    110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 112, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 70, 105, 108, 116, 101,
+    114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 66, 105, 116, 102, 105, 101, 108, 100, 32, 119, 104, 105, 99, 104, 32, 97, 108, 108, 111, 119, 115,
+    32, 102, 111, 114, 32, 102, 105, 108, 116, 101, 114, 105, 110, 103, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32,
+    108, 111, 103, 103, 105, 110, 103, 32, 116, 111, 32, 101, 120, 99, 108, 117, 100, 101, 32, 115, 112, 101, 99, 105,
+    102, 105, 99, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 116, 121, 112, 101, 115, 46, 32, 32, 73, 102, 32, 97,
+    32, 98, 105, 116, 32, 105, 115, 32, 115, 101, 116, 32, 116, 104, 101, 110, 32, 116, 104, 97, 116, 32, 112, 105, 112,
+    101, 108, 105, 110, 101, 32, 116, 121, 112, 101, 32, 119, 105, 108, 108, 32, 78, 79, 84, 32, 98, 101, 32, 108, 111,
+    103, 103, 101, 100, 46, 32, 32, 84, 104, 101, 32, 98, 105, 116, 115, 32, 97, 114, 101, 32, 100, 101, 102, 105, 110,
+    101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 32, 97, 114, 114,
+    97, 121, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 111, 103, 80, 105, 112, 101, 108, 105,
+    110, 101, 72, 97, 115, 104, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 51, 53, 56, 53, 53, 53, 54, 52, 54, 54, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70,
+    108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120,
+    34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 54, 52, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 108, 111, 103, 80, 105, 112, 101, 108, 105, 110, 101, 72, 97, 115, 104, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 112, 101, 99, 105, 102,
+    105, 99, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 104, 97, 115, 104, 32, 116, 111, 32, 108, 111, 103, 46, 34,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 82, 101, 108, 97, 116, 105,
+    118, 101, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 119, 104, 101, 114, 101, 32, 112, 105, 112, 101, 108,
+    105, 110, 101, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 108, 111, 103, 115, 32, 97, 114, 101,
+    32, 112, 108, 97, 99, 101, 100, 46, 32, 82, 101, 108, 97, 116, 105, 118, 101, 32, 116, 111, 32, 116, 104, 101, 32,
+    112, 97, 116, 104, 32, 105, 110, 32, 116, 104, 101, 32, 65, 77, 68, 95, 68, 69, 66, 85, 71, 95, 68, 73, 82, 32, 101,
+    110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 118, 97, 114, 105, 97, 98, 108, 101, 46, 32, 73, 102, 32, 116,
+    104, 97, 116, 32, 101, 110, 118, 32, 118, 97, 114, 32, 105, 115, 110, 39, 116, 32, 115, 101, 116, 44, 32, 116, 104,
+    101, 32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105, 115, 32, 112, 108, 97, 116, 102, 111, 114, 109, 32, 100,
+    101, 112, 101, 110, 100, 101, 110, 116, 46, 32, 69, 97, 99, 104, 32, 117, 110, 105, 113, 117, 101, 32, 112, 105,
+    112, 101, 108, 105, 110, 101, 32, 105, 115, 32, 105, 110, 32, 97, 32, 115, 101, 112, 97, 114, 97, 116, 101, 32, 102,
+    105, 108, 101, 32, 119, 105, 116, 104, 105, 110, 32, 116, 104, 97, 116, 32, 100, 105, 114, 101, 99, 116, 111, 114,
+    121, 46, 32, 84, 104, 101, 32, 108, 111, 103, 32, 110, 97, 109, 101, 32, 105, 115, 32, 98, 97, 115, 101, 100, 32,
+    111, 110, 32, 97, 32, 104, 97, 115, 104, 32, 111, 102, 32, 116, 104, 101, 32, 112, 105, 112, 101, 108, 105, 110,
+    101, 39, 115, 32, 99, 114, 101, 97, 116, 101, 32, 105, 110, 102, 111, 32, 97, 110, 100, 32, 119, 104, 105, 99, 104,
+    32, 115, 104, 97, 100, 101, 114, 32, 115, 116, 97, 103, 101, 115, 32, 97, 114, 101, 32, 97, 99, 116, 105, 118, 101,
+    46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 55,
+    54, 56, 50, 53, 51, 50, 52, 53, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 80, 97, 116, 104, 34, 58, 32, 116, 114,
+    117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 87, 105, 110, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 97, 108, 80, 105, 112, 101,
+    108, 105, 110, 101, 115, 92, 92, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 76, 110, 120, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 97, 109, 100, 112, 97, 108, 47, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 105, 122, 101, 34, 58, 32, 34, 77, 97, 120, 80,
+    97, 116, 104, 83, 116, 114, 76, 101, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 115, 116, 114, 105, 110, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 68,
+    105, 114, 101, 99, 116, 111, 114, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 68, 105, 114, 101, 99, 116, 111, 114, 121, 34, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 76, 111, 103, 67, 111, 110, 102, 105, 103, 34, 10,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    67, 109, 100, 83, 116, 114, 101, 97, 109, 82, 101, 115, 101, 114, 118, 101, 76, 105, 109, 105, 116, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 109, 109,
+    97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 56, 52, 51, 57, 49, 51, 54, 48, 52, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 50, 53, 54, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 83, 116, 114, 101,
+    97, 109, 82, 101, 115, 101, 114, 118, 101, 76, 105, 109, 105, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 112, 101, 99, 105, 102, 105, 101, 115, 32, 104, 111,
+    119, 32, 109, 97, 110, 121, 32, 68, 87, 79, 82, 68, 115, 32, 111, 102, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115,
+    112, 97, 99, 101, 32, 105, 115, 32, 114, 101, 115, 101, 114, 118, 101, 100, 32, 98, 121, 32, 82, 101, 115, 101, 114,
+    118, 101, 67, 111, 109, 109, 97, 110, 100, 115, 40, 41, 46, 32, 84, 104, 105, 115, 32, 119, 105, 108, 108, 32, 98,
+    101, 32, 99, 108, 97, 109, 112, 101, 100, 32, 98, 121, 32, 101, 97, 99, 104, 32, 67, 109, 100, 83, 116, 114, 101,
+    97, 109, 32, 116, 111, 32, 116, 104, 101, 105, 114, 32, 67, 109, 100, 65, 108, 108, 111, 99, 97, 116, 111, 114, 39,
+    115, 32, 99, 104, 117, 110, 107, 32, 115, 105, 122, 101, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 83, 116, 114, 101, 97, 109, 69,
+    110, 97, 98, 108, 101, 77, 101, 109, 115, 101, 116, 79, 110, 82, 101, 115, 101, 114, 118, 101, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 109, 109, 97,
+    110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 57, 50, 55, 53, 50, 49, 50, 55, 52, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 66, 117,
+    105, 108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 100, 98, 103, 34,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 83, 116, 114, 101, 97, 109, 69, 110,
+    97, 98, 108, 101, 77, 101, 109, 115, 101, 116, 79, 110, 82, 101, 115, 101, 114, 118, 101, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117,
+    101, 44, 32, 116, 104, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 32, 119, 105, 108,
+    108, 32, 109, 101, 109, 115, 101, 116, 32, 97, 108, 108, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 112, 97, 99,
+    101, 32, 116, 111, 32, 67, 109, 100, 83, 116, 114, 101, 97, 109, 77, 101, 109, 115, 101, 116, 86, 97, 108, 117, 101,
+    46, 32, 84, 104, 105, 115, 32, 119, 105, 108, 108, 32, 111, 110, 108, 121, 32, 102, 117, 110, 99, 116, 105, 111,
+    110, 32, 111, 110, 32, 100, 101, 98, 117, 103, 32, 98, 117, 105, 108, 100, 115, 46, 34, 10, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 83, 116,
+    114, 101, 97, 109, 77, 101, 109, 115, 101, 116, 86, 97, 108, 117, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117,
+    102, 102, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 51, 54, 54, 49, 52, 53, 53, 52, 52, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 52, 50, 57, 52, 57, 54, 55, 50, 57, 53, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 66, 117,
+    105, 108, 100, 84, 121, 112, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 100, 98, 103, 34,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116, 116, 105, 110,
+    103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 83, 116, 114, 101, 97, 109, 69, 110, 97, 98, 108,
+    101, 77, 101, 109, 115, 101, 116, 79, 110, 82, 101, 115, 101, 114, 118, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 83, 116,
+    114, 101, 97, 109, 77, 101, 109, 115, 101, 116, 86, 97, 108, 117, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 67, 109, 100, 83, 116, 114, 101, 97,
+    109, 69, 110, 97, 98, 108, 101, 77, 101, 109, 115, 101, 116, 79, 110, 82, 101, 115, 101, 114, 118, 101, 32, 105,
+    115, 32, 116, 114, 117, 101, 32, 97, 108, 108, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 112, 97, 99, 101, 32,
+    119, 105, 108, 108, 32, 98, 101, 32, 109, 101, 109, 115, 101, 116, 32, 116, 111, 32, 116, 104, 105, 115, 32, 118,
+    97, 108, 117, 101, 46, 32, 84, 104, 105, 115, 32, 119, 105, 108, 108, 32, 111, 110, 108, 121, 32, 102, 117, 110, 99,
+    116, 105, 111, 110, 32, 111, 110, 32, 100, 101, 98, 117, 103, 32, 98, 117, 105, 108, 100, 115, 46, 34, 10, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109,
+    100, 66, 117, 102, 67, 104, 117, 110, 107, 69, 110, 97, 98, 108, 101, 83, 116, 97, 103, 105, 110, 103, 66, 117, 102,
+    102, 101, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 57, 49, 54, 49, 54, 56,
+    53, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99,
+    109, 100, 66, 117, 102, 67, 104, 117, 110, 107, 69, 110, 97, 98, 108, 101, 83, 116, 97, 103, 105, 110, 103, 66, 117,
+    102, 102, 101, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 101, 97, 99, 104, 32, 99, 111, 109, 109, 97, 110, 100, 32, 99,
+    104, 117, 110, 107, 32, 119, 105, 108, 108, 32, 97, 108, 108, 111, 99, 97, 116, 101, 32, 97, 32, 115, 121, 115, 116,
+    101, 109, 32, 109, 101, 109, 111, 114, 121, 32, 115, 116, 97, 103, 105, 110, 103, 32, 98, 117, 102, 102, 101, 114,
+    46, 32, 67, 111, 109, 109, 97, 110, 100, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 115, 116, 111, 114, 101, 100,
+    32, 105, 110, 32, 116, 104, 105, 115, 32, 98, 117, 102, 102, 101, 114, 32, 117, 110, 116, 105, 108, 32, 116, 104,
+    101, 32, 99, 104, 117, 110, 107, 32, 105, 115, 32, 102, 105, 110, 97, 108, 105, 122, 101, 100, 46, 34, 10, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109,
+    100, 65, 108, 108, 111, 99, 97, 116, 111, 114, 70, 114, 101, 101, 79, 110, 82, 101, 115, 101, 116, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 109, 109,
+    97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 52, 54, 49, 49, 54, 52, 55, 48, 54, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 65, 108, 108,
+    111, 99, 97, 116, 111, 114, 70, 114, 101, 101, 79, 110, 82, 101, 115, 101, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32,
+    101, 97, 99, 104, 32, 99, 111, 109, 109, 97, 110, 100, 32, 97, 108, 108, 111, 99, 97, 116, 111, 114, 32, 119, 105,
+    108, 108, 32, 102, 114, 101, 101, 32, 105, 116, 115, 32, 99, 111, 109, 109, 97, 110, 100, 32, 99, 104, 117, 110,
+    107, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 99, 108,
+    105, 101, 110, 116, 32, 99, 97, 108, 108, 115, 32, 73, 67, 109, 100, 65, 108, 108, 111, 99, 97, 116, 111, 114, 58,
+    58, 82, 101, 115, 101, 116, 40, 41, 32, 101, 118, 101, 110, 32, 116, 104, 111, 117, 103, 104, 32, 116, 104, 105,
+    115, 32, 98, 101, 104, 97, 118, 105, 111, 114, 32, 105, 115, 32, 97, 103, 97, 105, 110, 115, 116, 32, 116, 104, 101,
+    32, 114, 117, 108, 101, 115, 32, 111, 102, 32, 116, 104, 101, 32, 68, 88, 49, 50, 32, 115, 112, 101, 99, 105, 102,
+    105, 99, 97, 116, 105, 111, 110, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 68, 101, 102, 97, 117, 108,
+    116, 69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 79, 110, 108, 121, 32, 101, 110, 97, 98, 108, 101, 32, 111, 112, 116, 105, 109,
+    105, 122, 97, 116, 105, 111, 110, 115, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 97, 112, 112, 32, 115, 112,
+    101, 99, 105, 102, 105, 101, 115, 32, 116, 104, 101, 32, 67, 77, 68, 95, 66, 85, 70, 70, 69, 82, 95, 79, 80, 84, 73,
+    77, 73, 90, 69, 95, 71, 80, 85, 95, 83, 77, 65, 76, 76, 95, 66, 65, 84, 67, 72, 32, 99, 111, 109, 109, 97, 110, 100,
+    32, 98, 117, 102, 102, 101, 114, 32, 98, 117, 105, 108, 100, 32, 102, 108, 97, 103, 46, 34, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 70, 111, 114, 99, 101, 69, 110, 97,
+    98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 70, 111, 114, 99, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 97, 108,
+    119, 97, 121, 115, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 70, 111, 114, 99, 101, 68, 105, 115, 97, 98, 108, 101, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70,
+    111, 114, 99, 101, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 97, 108, 119, 97, 121,
+    115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 109,
+    52, 79, 112, 116, 69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 120, 108,
+    117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 79, 112, 116, 105, 109, 105, 122, 101, 80,
+    109, 52, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 48, 49, 56, 56, 57, 53, 50, 56, 56, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 68, 101, 102, 97, 117, 108, 116, 69,
+    110, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 79, 112, 116, 105, 109, 105, 122,
+    101, 80, 109, 52, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 102, 105, 110, 101, 45, 103, 114, 97, 105, 110, 101, 100, 32,
+    111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 32, 111, 102, 32, 101, 97, 99, 104, 32, 99, 111, 109,
+    109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 39, 115, 32, 80, 77, 52, 32, 115, 116, 114, 101, 97, 109, 46,
+    32, 67, 97, 110, 32, 105, 109, 112, 114, 111, 118, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32,
+    111, 102, 32, 67, 80, 45, 98, 111, 117, 110, 100, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 115, 32,
+    116, 104, 97, 116, 32, 104, 97, 118, 101, 32, 67, 80, 85, 32, 99, 121, 99, 108, 101, 115, 32, 116, 111, 32, 115,
+    112, 97, 114, 101, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69,
+    110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 77, 111, 100, 101, 73, 109, 109, 101, 100,
+    105, 97, 116, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 87, 104, 101, 110, 32, 99, 111, 109, 109, 97, 110, 100, 115, 32, 97, 114, 101, 32, 119, 114,
+    105, 116, 116, 101, 110, 32, 116, 111, 32, 116, 104, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114,
+    101, 97, 109, 39, 115, 32, 114, 101, 115, 101, 114, 118, 101, 32, 98, 117, 102, 102, 101, 114, 46, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116, 77, 111, 100, 101, 70,
+    105, 110, 97, 108, 105, 122, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 110, 32, 97, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115,
+    116, 114, 101, 97, 109, 39, 115, 32, 99, 111, 109, 109, 97, 110, 100, 32, 99, 104, 117, 110, 107, 115, 32, 97, 114,
+    101, 32, 102, 105, 110, 97, 108, 105, 122, 101, 100, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    80, 109, 52, 79, 112, 116, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 120, 108,
+    117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 79, 112, 116, 105, 109, 105, 122, 101, 80,
+    109, 52, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 10, 32, 32, 32,
+    32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 57, 48,
+    56, 49, 54, 54, 49, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 80, 109, 52, 79, 112, 116,
+    77, 111, 100, 101, 73, 109, 109, 101, 100, 105, 97, 116, 101, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 49, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 79, 112, 116, 105, 109, 105, 122, 101, 80, 109, 52, 77, 111,
+    100, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 79, 112, 116, 105, 109, 105, 122, 101, 80, 109, 52, 77, 111, 100, 101,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87,
+    104, 101, 110, 32, 80, 77, 52, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 32, 105, 115, 32, 101,
+    110, 97, 98, 108, 101, 100, 32, 116, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 99, 111, 110, 116,
+    114, 111, 108, 115, 32, 119, 104, 101, 110, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109,
+    115, 32, 119, 105, 108, 108, 32, 117, 115, 101, 32, 116, 104, 101, 32, 111, 112, 116, 105, 109, 105, 122, 101, 114,
+    46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100,
+    86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34,
+    58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 67, 112, 117, 85, 112, 100, 97, 116,
+    101, 80, 97, 116, 104, 68, 101, 102, 97, 117, 108, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 111, 32, 111, 118, 101, 114, 114, 105, 100, 101, 44, 32,
+    117, 115, 101, 32, 99, 108, 105, 101, 110, 116, 39, 115, 32, 112, 114, 101, 102, 101, 114, 101, 110, 99, 101, 46,
+    34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70,
+    111, 114, 99, 101, 67, 112, 117, 85, 112, 100, 97, 116, 101, 80, 97, 116, 104, 79, 110, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32,
+    80, 65, 76, 32, 116, 111, 32, 117, 115, 101, 32, 116, 104, 101, 32, 67, 80, 85, 32, 117, 112, 100, 97, 116, 101, 32,
+    112, 97, 116, 104, 32, 102, 111, 114, 32, 118, 101, 114, 116, 101, 120, 32, 98, 117, 102, 102, 101, 114, 44, 32,
+    115, 116, 114, 101, 97, 109, 45, 111, 117, 116, 32, 97, 110, 100, 32, 115, 112, 105, 108, 108, 32, 116, 97, 98, 108,
+    101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66,
+    117, 102, 70, 111, 114, 99, 101, 67, 112, 117, 85, 112, 100, 97, 116, 101, 80, 97, 116, 104, 79, 102, 102, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70,
+    111, 114, 99, 101, 32, 80, 65, 76, 32, 116, 111, 32, 117, 115, 101, 32, 116, 104, 101, 32, 67, 69, 32, 82, 65, 77,
+    32, 112, 97, 116, 104, 32, 102, 111, 114, 32, 118, 101, 114, 116, 101, 120, 32, 98, 117, 102, 102, 101, 114, 44, 32,
+    115, 116, 114, 101, 97, 109, 45, 111, 117, 116, 32, 97, 110, 100, 32, 115, 112, 105, 108, 108, 32, 116, 97, 98, 108,
+    101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99,
+    101, 67, 112, 117, 85, 112, 100, 97, 116, 101, 80, 97, 116, 104, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73,
+    115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101,
+    67, 112, 117, 85, 112, 100, 97, 116, 101, 80, 97, 116, 104, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102,
+    101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 51, 56, 50, 57, 49, 49, 50, 56, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34,
+    67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 67, 112, 117, 85, 112, 100, 97, 116, 101, 80, 97, 116, 104, 68,
+    101, 102, 97, 117, 108, 116, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 67,
+    112, 117, 85, 112, 100, 97, 116, 101, 80, 97, 116, 104, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 108, 111, 98, 97, 108, 108, 121, 32, 111, 118, 101, 114, 114,
+    105, 100, 101, 115, 32, 116, 104, 101, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 67, 109, 100, 66, 117, 102,
+    102, 101, 114, 66, 117, 105, 108, 100, 70, 108, 97, 103, 115, 58, 58, 117, 115, 101, 67, 112, 117, 80, 97, 116, 104,
+    70, 111, 114, 84, 97, 98, 108, 101, 85, 112, 100, 97, 116, 101, 115, 32, 112, 97, 115, 115, 101, 100, 32, 105, 110,
+    32, 98, 121, 32, 116, 104, 101, 32, 99, 108, 105, 101, 110, 116, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117,
+    102, 70, 111, 114, 99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117, 98, 109, 105, 116, 68, 101, 102, 97, 117, 108,
+    116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 78, 111, 32, 111, 118, 101, 114, 114, 105, 100, 101, 44, 32, 117, 115, 101, 32, 97, 112, 112, 39, 115, 32, 112,
+    114, 101, 102, 101, 114, 101, 110, 99, 101, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117, 98, 109,
+    105, 116, 79, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 67, 77, 68, 95, 66, 85, 70, 70, 69, 82, 95, 79, 78, 69, 95, 84, 73,
+    77, 69, 95, 83, 85, 66, 77, 73, 84, 32, 97, 108, 119, 97, 121, 115, 32, 111, 110, 46, 34, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 79, 110,
+    101, 84, 105, 109, 101, 83, 117, 98, 109, 105, 116, 79, 102, 102, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 32, 67, 77, 68, 95, 66,
+    85, 70, 70, 69, 82, 95, 79, 78, 69, 95, 84, 73, 77, 69, 95, 83, 85, 66, 77, 73, 84, 32, 97, 108, 119, 97, 121, 115,
+    32, 111, 102, 102, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111,
+    114, 99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117, 98, 109, 105, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 73, 115, 69, 120, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114,
+    99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117, 98, 109, 105, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117,
+    102, 102, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 57, 48, 57, 57, 51, 52, 54, 55, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 34, 67, 109, 100, 66, 117, 102, 70, 111, 114, 99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117, 98, 109,
+    105, 116, 68, 101, 102, 97, 117, 108, 116, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 109, 100, 66, 117, 102, 70, 111, 114,
+    99, 101, 79, 110, 101, 84, 105, 109, 101, 83, 117, 98, 109, 105, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 71, 108, 111, 98, 97, 108, 108, 121, 32, 111, 118,
+    101, 114, 114, 105, 100, 101, 115, 32, 116, 104, 101, 32, 67, 77, 68, 95, 66, 85, 70, 70, 69, 82, 95, 79, 78, 69,
+    95, 84, 73, 77, 69, 95, 83, 85, 66, 77, 73, 84, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101,
+    114, 32, 98, 117, 105, 108, 100, 105, 110, 103, 32, 102, 108, 97, 103, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66,
+    117, 102, 80, 114, 101, 101, 109, 112, 116, 77, 111, 100, 101, 68, 105, 115, 97, 98, 108, 101, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109,
+    97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 119, 105, 108, 108, 32, 110, 111, 116, 32, 98, 101, 32, 112,
+    114, 101, 101, 109, 112, 116, 101, 100, 32, 98, 117, 116, 32, 111, 117, 114, 32, 113, 117, 101, 117, 101, 115, 32,
+    115, 117, 112, 112, 111, 114, 116, 32, 112, 114, 101, 101, 109, 112, 116, 105, 111, 110, 46, 34, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 80, 114, 101, 101, 109, 112,
+    116, 77, 111, 100, 101, 69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114,
+    115, 32, 109, 97, 121, 32, 98, 101, 32, 112, 114, 101, 101, 109, 112, 116, 101, 100, 32, 105, 102, 32, 75, 77, 68,
+    32, 114, 101, 112, 111, 114, 116, 115, 32, 115, 117, 112, 112, 111, 114, 116, 46, 34, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 80, 114, 101, 101, 109, 112, 116, 77,
+    111, 100, 101, 70, 117, 108, 108, 68, 105, 115, 97, 98, 108, 101, 85, 110, 115, 97, 102, 101, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 65, 76, 32,
+    112, 114, 101, 116, 101, 110, 100, 115, 32, 75, 77, 68, 32, 100, 111, 101, 115, 110, 39, 116, 32, 115, 117, 112,
+    112, 111, 114, 116, 32, 109, 105, 100, 45, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32,
+    112, 114, 101, 101, 109, 112, 116, 105, 111, 110, 46, 32, 84, 104, 105, 115, 32, 99, 97, 110, 32, 104, 97, 110, 103,
+    32, 111, 114, 32, 99, 111, 114, 114, 117, 112, 116, 32, 111, 116, 104, 101, 114, 32, 100, 114, 105, 118, 101, 114,
+    115, 46, 32, 73, 116, 32, 109, 117, 115, 116, 32, 111, 110, 108, 121, 32, 98, 101, 32, 117, 115, 101, 100, 32, 102,
+    111, 114, 32, 100, 101, 98, 117, 103, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66,
+    117, 102, 80, 114, 101, 101, 109, 112, 116, 77, 111, 100, 101, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 66, 117, 102, 80, 114, 101, 101, 109, 112, 116,
+    105, 111, 110, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 10, 32, 32,
+    32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 54, 52,
+    48, 53, 50, 55, 50, 48, 56, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 67, 109, 100, 66, 117,
+    102, 80, 114, 101, 101, 109, 112, 116, 77, 111, 100, 101, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117,
+    109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    99, 109, 100, 66, 117, 102, 80, 114, 101, 101, 109, 112, 116, 105, 111, 110, 77, 111, 100, 101, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114,
+    111, 108, 115, 32, 116, 111, 32, 119, 104, 97, 116, 32, 100, 101, 103, 114, 101, 101, 32, 99, 111, 109, 109, 97,
+    110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32, 115, 117, 112, 112, 111, 114, 116, 32, 109, 105, 100, 45, 99,
+    111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 112, 114, 101, 101, 109, 112, 116, 105, 111, 110,
+    46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100,
+    86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 65, 76, 32, 119, 105, 108, 108, 32, 100,
+    117, 109, 112, 32, 67, 69, 32, 82, 65, 77, 32, 117, 115, 105, 110, 103, 32, 97, 32, 112, 111, 115, 116, 97, 109, 98,
+    108, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 115, 116, 114, 101, 97, 109, 32, 119, 104, 101, 110, 101, 118,
+    101, 114, 32, 101, 105, 116, 104, 101, 114, 32, 77, 67, 66, 80, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100,
+    32, 111, 114, 32, 116, 104, 101, 32, 99, 108, 105, 101, 110, 116, 32, 101, 110, 97, 98, 108, 101, 115, 32, 116, 104,
+    101, 32, 39, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 32, 67, 69, 32, 82, 65, 77, 39, 32, 102, 101, 97,
+    116, 117, 114, 101, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 80, 65, 76, 32, 119, 105, 108, 108, 32, 100, 117, 109, 112, 32, 67, 69, 32, 82, 65, 77, 32,
+    117, 115, 105, 110, 103, 32, 97, 32, 112, 111, 115, 116, 97, 109, 98, 108, 101, 32, 99, 111, 109, 109, 97, 110, 100,
+    32, 115, 116, 114, 101, 97, 109, 32, 119, 104, 101, 110, 101, 118, 101, 114, 32, 116, 104, 101, 32, 99, 108, 105,
+    101, 110, 116, 32, 101, 110, 97, 98, 108, 101, 115, 32, 80, 65, 76, 39, 115, 32, 39, 112, 101, 114, 115, 105, 115,
+    116, 101, 110, 116, 32, 67, 69, 32, 82, 65, 77, 39, 32, 102, 101, 97, 116, 117, 114, 101, 46, 32, 40, 84, 121, 112,
+    105, 99, 97, 108, 108, 121, 32, 111, 110, 108, 121, 32, 68, 88, 57, 80, 32, 119, 105, 108, 108, 32, 100, 111, 32,
+    116, 104, 105, 115, 41, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67,
+    111, 109, 109, 97, 110, 100, 66, 117, 102, 102, 101, 114, 70, 111, 114, 99, 101, 67, 101, 82, 97, 109, 68, 117, 109,
+    112, 73, 110, 80, 111, 115, 116, 97, 109, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101,
+    114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 51, 52, 49, 51, 57, 49, 49, 55, 56, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 111, 109, 109, 97, 110, 100, 66, 117, 102, 102, 101, 114, 70, 111, 114,
+    99, 101, 67, 101, 82, 97, 109, 68, 117, 109, 112, 73, 110, 80, 111, 115, 116, 97, 109, 98, 108, 101, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 111, 103, 103, 108,
+    101, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 111, 114, 32, 110, 111, 116, 32, 80, 65, 76, 32, 115, 104, 111,
+    117, 108, 100, 32, 97, 100, 100, 32, 97, 32, 112, 111, 115, 116, 97, 109, 98, 108, 101, 32, 116, 111, 32, 117, 110,
+    105, 118, 101, 114, 115, 97, 108, 32, 81, 117, 101, 117, 101, 32, 115, 117, 98, 109, 105, 115, 115, 105, 111, 110,
+    115, 32, 116, 111, 32, 100, 117, 109, 112, 32, 67, 69, 32, 82, 65, 77, 32, 119, 104, 101, 110, 101, 118, 101, 114,
+    32, 77, 67, 66, 80, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 111, 109, 109, 97, 110, 100,
+    66, 117, 102, 102, 101, 114, 67, 111, 109, 98, 105, 110, 101, 68, 101, 80, 114, 101, 97, 109, 98, 108, 101, 115, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67,
+    111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 52, 56, 52, 49, 50, 51, 49, 49, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75,
+    101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 111, 109, 109,
+    97, 110, 100, 66, 117, 102, 102, 101, 114, 67, 111, 109, 98, 105, 110, 101, 68, 101, 80, 114, 101, 97, 109, 98, 108,
+    101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 67, 111, 109, 98, 105, 110, 101, 115, 32, 116, 104, 101, 32, 68, 69, 32, 112, 101, 114, 45, 115, 117, 98, 109,
+    105, 116, 32, 97, 110, 100, 32, 112, 101, 114, 45, 99, 111, 110, 116, 101, 120, 116, 32, 112, 114, 101, 97, 109, 98,
+    108, 101, 115, 32, 105, 110, 116, 111, 32, 111, 110, 101, 32, 112, 101, 114, 45, 115, 117, 98, 109, 105, 116, 32,
+    112, 114, 101, 97, 109, 98, 108, 101, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 109, 100, 85, 116, 105, 108, 86, 101, 114, 105, 102, 121, 83,
+    104, 97, 100, 111, 119, 101, 100, 82, 101, 103, 82, 97, 110, 103, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66,
+    117, 102, 102, 101, 114, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 51, 56, 57, 48, 55, 48, 52, 48, 52, 53, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 66, 117, 105, 108, 100,
+    84, 121, 112, 101, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 100, 98, 103, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 100, 101, 118, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111,
+    111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 99, 109, 100, 85, 116, 105, 108, 86, 101, 114, 105, 102, 121, 83, 104, 97, 100, 111, 119, 101, 100, 82, 101,
+    103, 82, 97, 110, 103, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 80, 65, 76, 32, 119, 105, 108, 108, 32, 118, 101,
+    114, 105, 102, 121, 32, 116, 104, 97, 116, 32, 97, 108, 108, 32, 114, 101, 103, 105, 115, 116, 101, 114, 32, 119,
+    114, 105, 116, 101, 115, 32, 105, 110, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115,
+    32, 97, 114, 101, 32, 112, 114, 111, 112, 101, 114, 108, 121, 32, 115, 104, 97, 100, 111, 119, 101, 100, 32, 119,
+    104, 101, 110, 32, 109, 105, 100, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 112,
+    114, 101, 101, 109, 112, 116, 105, 111, 110, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 46, 32, 84, 104,
+    105, 115, 32, 99, 97, 110, 32, 104, 97, 118, 101, 32, 97, 32, 110, 111, 116, 105, 99, 97, 98, 108, 101, 32, 105,
+    109, 112, 97, 99, 116, 32, 111, 110, 32, 67, 80, 85, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 46,
+    32, 84, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 105, 103, 110, 111, 114, 101, 100,
+    32, 105, 110, 32, 114, 101, 108, 101, 97, 115, 101, 32, 98, 117, 105, 108, 100, 115, 46, 34, 10, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 65, 76, 32, 119, 105, 108, 108, 32, 101, 110, 97, 98, 108, 101,
+    32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 119, 104, 101, 110, 32, 103, 101, 110, 101,
+    114, 97, 108, 108, 121, 32, 101, 102, 102, 105, 99, 105, 101, 110, 116, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32,
+    97, 108, 108, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 116, 104, 97, 116, 32, 99,
+    111, 117, 108, 100, 32, 98, 101, 32, 100, 101, 116, 114, 105, 109, 101, 110, 116, 97, 108, 32, 105, 110, 32, 115,
+    112, 101, 99, 105, 97, 108, 32, 99, 97, 115, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 77, 105, 110, 75, 101, 114, 110, 101, 108, 83, 117, 98, 109, 105, 116, 115, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 105,
+    110, 105, 109, 105, 122, 101, 32, 116, 104, 101, 32, 111, 118, 101, 114, 104, 101, 97, 100, 32, 111, 102, 32, 108,
+    97, 117, 110, 99, 104, 105, 110, 103, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32,
+    111, 110, 32, 116, 104, 101, 32, 67, 80, 85, 32, 97, 110, 100, 32, 71, 80, 85, 46, 34, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 105, 110, 71, 112, 117, 67, 109, 100, 79, 118, 101, 114, 104,
+    101, 97, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 77, 105, 110, 105, 109, 105, 122, 101, 32, 116, 104, 101, 32, 111, 118, 101, 114, 104, 101, 97, 100, 32,
+    111, 102, 32, 114, 101, 97, 100, 105, 110, 103, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101,
+    114, 32, 99, 111, 109, 109, 97, 110, 100, 115, 32, 111, 110, 32, 116, 104, 101, 32, 71, 80, 85, 46, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 117, 98, 109, 105, 116, 79, 112, 116, 77, 111,
+    100, 101, 79, 118, 101, 114, 114, 105, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114,
+    34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 51, 48, 53, 52, 56, 49, 48, 54, 48, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 115, 117, 98, 109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 79, 118, 101, 114,
+    114, 105, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 73, 102, 32, 110, 111, 110, 45, 122, 101, 114, 111, 44, 32, 105, 116, 32, 102, 111, 114, 99, 101, 115,
+    32, 97, 108, 108, 32, 83, 117, 98, 109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 115, 32, 116, 111, 32, 97, 32,
+    115, 112, 101, 99, 105, 102, 105, 99, 32, 118, 97, 108, 117, 101, 46, 32, 48, 58, 32, 78, 111, 32, 79, 118, 101,
+    114, 114, 105, 100, 101, 32, 49, 58, 32, 83, 117, 98, 109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 58, 58, 68,
+    101, 102, 97, 117, 108, 116, 32, 50, 58, 32, 83, 117, 98, 109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 58, 58,
+    68, 105, 115, 97, 98, 108, 101, 100, 32, 51, 58, 32, 83, 117, 98, 109, 105, 116, 79, 112, 116, 77, 111, 100, 101,
+    58, 58, 77, 105, 110, 75, 101, 114, 110, 101, 108, 83, 117, 98, 109, 105, 116, 115, 32, 52, 58, 32, 83, 117, 98,
+    109, 105, 116, 79, 112, 116, 77, 111, 100, 101, 58, 58, 77, 105, 110, 71, 112, 117, 67, 109, 100, 79, 118, 101, 114,
+    104, 101, 97, 100, 32, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69,
+    110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 78, 111, 110,
+    101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 68, 105, 115, 97, 98, 108, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122, 122, 108, 101, 32, 102, 111,
+    114, 32, 97, 108, 108, 32, 115, 117, 114, 102, 97, 99, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 67, 111, 108, 111, 114, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69,
+    110, 97, 98, 108, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122, 122, 108, 101, 32, 102, 111, 114, 32, 114,
+    101, 110, 100, 101, 114, 97, 98, 108, 101, 32, 99, 111, 108, 111, 114, 32, 116, 97, 114, 103, 101, 116, 115, 46, 34,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 108, 101, 83, 119, 105, 122,
+    122, 108, 101, 68, 101, 112, 116, 104, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122,
+    122, 108, 101, 32, 102, 111, 114, 32, 114, 101, 110, 100, 101, 114, 97, 98, 108, 101, 32, 100, 101, 112, 116, 104,
+    45, 115, 116, 101, 110, 99, 105, 108, 32, 116, 97, 114, 103, 101, 116, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 83, 104, 97, 100,
+    101, 114, 82, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122, 122, 108, 101,
+    32, 102, 111, 114, 32, 115, 104, 97, 100, 101, 114, 32, 114, 101, 115, 111, 117, 114, 99, 101, 115, 46, 34, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 108, 101, 83, 119, 105, 122, 122,
+    108, 101, 65, 108, 108, 66, 105, 116, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 55, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105,
+    122, 122, 108, 101, 32, 102, 111, 114, 32, 97, 108, 108, 32, 115, 117, 114, 102, 97, 99, 101, 115, 46, 34, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 66, 105, 116, 115,
+    34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 105,
+    108, 101, 83, 119, 105, 122, 122, 108, 101, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116,
+    116, 105, 110, 103, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 49, 49, 52, 54, 56, 55, 55, 48, 49, 48, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108,
+    97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114,
+    117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 55, 10, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 116, 105, 108, 101, 83, 119, 105, 122, 122, 108, 101, 77, 111, 100, 101, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 109, 97,
+    115, 107, 32, 119, 104, 105, 99, 104, 32, 101, 110, 97, 98, 108, 101, 115, 32, 98, 97, 110, 107, 32, 38, 32, 112,
+    105, 112, 101, 32, 116, 105, 108, 101, 32, 115, 119, 105, 122, 122, 108, 105, 110, 103, 32, 102, 111, 114, 32, 115,
+    117, 114, 102, 97, 99, 101, 115, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 86, 105, 100, 77, 109, 71, 112, 117, 86,
+    97, 77, 97, 112, 112, 105, 110, 103, 86, 97, 108, 105, 100, 97, 116, 105, 111, 110, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 115, 111, 117, 114, 99,
+    101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 55, 53, 49, 55, 56, 53, 48, 53, 49, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 79,
+    83, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 87, 105, 110, 56, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 87, 105, 110, 49, 48, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111,
+    111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 101, 110, 97, 98, 108, 101, 86, 105, 100, 77, 109, 71, 112, 117, 86, 97, 77, 97, 112, 112, 105, 110, 103, 86,
+    97, 108, 105, 100, 97, 116, 105, 111, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 79, 110, 32, 87, 68, 68, 77, 50, 32, 112, 108, 97, 116, 102, 111, 114, 109, 115,
+    44, 32, 80, 65, 76, 32, 105, 115, 32, 97, 98, 108, 101, 32, 116, 111, 32, 115, 101, 110, 100, 32, 97, 32, 115, 101,
+    116, 32, 111, 102, 32, 102, 108, 97, 103, 115, 32, 116, 104, 114, 111, 117, 103, 104, 32, 116, 111, 32, 116, 104,
+    101, 32, 107, 101, 114, 110, 101, 108, 32, 119, 104, 105, 99, 104, 32, 99, 97, 110, 32, 99, 111, 110, 116, 114, 111,
+    108, 32, 104, 111, 119, 32, 116, 104, 101, 32, 75, 77, 68, 32, 104, 97, 110, 100, 108, 101, 115, 32, 101, 97, 99,
+    104, 32, 71, 80, 85, 32, 86, 65, 32, 109, 97, 112, 112, 105, 110, 103, 32, 119, 104, 101, 110, 32, 114, 101, 115,
+    101, 114, 118, 105, 110, 103, 32, 86, 65, 32, 115, 112, 97, 99, 101, 44, 32, 109, 97, 112, 112, 105, 110, 103, 32,
+    86, 65, 32, 115, 112, 97, 99, 101, 32, 111, 114, 32, 117, 112, 100, 97, 116, 105, 110, 103, 32, 116, 104, 101, 32,
+    71, 80, 85, 32, 112, 97, 103, 101, 32, 109, 97, 112, 112, 105, 110, 103, 115, 46, 32, 73, 102, 32, 116, 104, 105,
+    115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 116, 114, 117, 101, 32, 116, 104, 101, 110, 32, 80,
+    65, 76, 32, 119, 105, 108, 108, 32, 114, 101, 113, 117, 101, 115, 116, 32, 116, 104, 97, 116, 32, 101, 120, 116,
+    114, 97, 32, 118, 97, 108, 105, 100, 97, 116, 105, 111, 110, 32, 105, 115, 32, 112, 101, 114, 102, 111, 114, 109,
+    101, 100, 32, 116, 111, 32, 101, 110, 115, 117, 114, 101, 32, 116, 104, 97, 116, 32, 101, 118, 101, 114, 121, 32,
+    71, 80, 85, 32, 118, 105, 114, 116, 117, 97, 108, 32, 97, 100, 100, 114, 101, 115, 115, 32, 109, 97, 112, 112, 105,
+    110, 103, 32, 116, 111, 32, 97, 32, 115, 112, 101, 99, 105, 102, 105, 99, 32, 112, 104, 121, 115, 105, 99, 97, 108,
+    32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 115, 112, 101, 99, 105, 102, 105, 101, 115, 32, 97, 32, 109,
+    97, 116, 99, 104, 105, 110, 103, 32, 115, 101, 116, 32, 111, 102, 32, 116, 104, 101, 115, 101, 32, 75, 77, 68, 32,
+    102, 108, 97, 103, 115, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 85, 115, 119, 99, 72, 101, 97, 112, 65, 108, 108,
+    65, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116, 116,
+    105, 110, 103, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 51, 52, 48, 56, 51, 51, 51, 49, 54, 52, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 79, 83, 34, 58, 32, 91,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 87, 105, 110, 49, 48, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93,
+    10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 101, 110, 97, 98, 108, 101, 85, 115, 119, 99, 72, 101, 97, 112, 65, 108, 108, 65, 108,
+    108, 111, 99, 97, 116, 105, 111, 110, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 116, 104, 101, 110, 32, 116, 104, 105,
+    115, 32, 99, 104, 97, 110, 103, 101, 32, 99, 97, 117, 115, 101, 115, 32, 80, 65, 76, 32, 116, 111, 32, 97, 117, 116,
+    111, 109, 97, 116, 105, 99, 97, 108, 108, 121, 32, 99, 111, 110, 115, 105, 100, 101, 114, 32, 71, 65, 82, 84, 32,
+    116, 111, 32, 98, 101, 32, 97, 32, 118, 97, 108, 105, 100, 32, 104, 101, 97, 112, 32, 102, 111, 114, 32, 109, 97,
+    110, 121, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 115, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80,
+    114, 101, 102, 101, 114, 114, 101, 100, 68, 101, 102, 97, 117, 108, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 111, 32, 110, 111, 116, 32, 114, 101,
+    113, 117, 101, 115, 116, 32, 97, 32, 115, 112, 101, 99, 105, 102, 105, 99, 32, 115, 119, 105, 122, 122, 108, 101,
+    32, 116, 121, 112, 101, 32, 112, 114, 101, 102, 101, 114, 101, 110, 99, 101, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 83,
+    87, 95, 90, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 80, 114, 101, 102, 101, 114, 32, 90, 79, 114, 100, 101, 114, 32, 115, 119, 105, 122, 122, 108, 101, 32,
+    40, 65, 68, 68, 82, 95, 83, 87, 95, 90, 41, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 83, 87, 95, 83, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 114, 101, 102,
+    101, 114, 32, 83, 116, 97, 110, 100, 97, 114, 100, 32, 115, 119, 105, 122, 122, 108, 101, 32, 40, 65, 68, 68, 82,
+    95, 83, 87, 95, 83, 41, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100,
+    100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 83, 87, 95, 68, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 114, 101, 102, 101, 114, 32, 68,
+    105, 115, 112, 108, 97, 121, 32, 115, 119, 105, 122, 122, 108, 101, 32, 40, 65, 68, 68, 82, 95, 83, 87, 95, 68, 41,
+    46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80,
+    114, 101, 102, 101, 114, 114, 101, 100, 83, 87, 95, 82, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 114, 101, 102, 101, 114, 32, 82, 111, 116, 97, 116, 101,
+    100, 32, 115, 119, 105, 122, 122, 108, 101, 32, 40, 65, 68, 68, 82, 95, 83, 87, 95, 82, 41, 46, 34, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 83, 119, 105,
+    122, 122, 108, 101, 84, 121, 112, 101, 83, 101, 116, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 100, 100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 83,
+    119, 105, 122, 122, 108, 101, 84, 121, 112, 101, 83, 101, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 115, 111, 117, 114, 99, 101, 32, 83, 101, 116,
+    116, 105, 110, 103, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 49, 56, 51, 54, 53, 53, 55, 49, 54, 55, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108,
+    97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114,
+    117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115,
+    34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 65, 100,
+    100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 68, 101, 102, 97, 117, 108, 116, 34, 10, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110,
+    117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 97, 100, 100, 114, 50, 80, 114, 101, 102, 101, 114, 114, 101, 100, 83, 119, 105, 122, 122, 108, 101, 84, 121,
+    112, 101, 83, 101, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 83, 101, 116, 115, 32, 97, 32, 112, 114, 101, 102, 101, 114, 114, 101, 100, 32, 115, 119, 105, 122,
+    122, 108, 101, 32, 116, 121, 112, 101, 32, 119, 104, 101, 110, 32, 117, 115, 105, 110, 103, 32, 65, 100, 100, 114,
+    76, 105, 98, 50, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 80, 105, 112, 101, 108, 105, 110, 101, 80, 114, 101, 102, 101, 116, 99, 104, 69, 110,
+    97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 80, 114, 101, 102, 101, 116, 99, 104, 105, 110, 103, 32, 40, 76, 50, 32, 67, 97, 99, 104, 101, 32,
+    87, 97, 114, 109, 105, 110, 103, 41, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 54, 54, 49, 51, 50, 53, 53, 54, 55, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 105, 112, 101, 108, 105, 110, 101,
+    80, 114, 101, 102, 101, 116, 99, 104, 69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 97, 116, 116,
+    101, 109, 112, 116, 32, 116, 111, 32, 112, 114, 101, 102, 101, 116, 99, 104, 32, 112, 105, 112, 101, 108, 105, 110,
+    101, 32, 115, 104, 97, 100, 101, 114, 32, 99, 111, 100, 101, 32, 97, 110, 100, 32, 100, 97, 116, 97, 32, 105, 110,
+    116, 111, 32, 76, 50, 32, 98, 101, 102, 111, 114, 101, 32, 101, 120, 101, 99, 117, 116, 105, 110, 103, 32, 116, 104,
+    101, 32, 112, 105, 112, 101, 108, 105, 110, 101, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 104, 97, 100, 101, 114, 80, 114, 101, 102, 101,
+    116, 99, 104, 67, 108, 97, 109, 112, 83, 105, 122, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 114, 101, 102, 101, 116, 99, 104, 105, 110, 103, 32, 40,
+    76, 50, 32, 67, 97, 99, 104, 101, 32, 87, 97, 114, 109, 105, 110, 103, 41, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 48, 54, 50, 57, 48, 48, 51,
+    57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75,
+    101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 104,
+    97, 100, 101, 114, 80, 114, 101, 102, 101, 116, 99, 104, 67, 108, 97, 109, 112, 83, 105, 122, 101, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 110, 32,
+    116, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103, 32, 105, 115, 32, 110, 111, 110, 45, 122, 101, 114, 111,
+    44, 32, 99, 108, 97, 109, 112, 32, 115, 104, 97, 100, 101, 114, 32, 112, 114, 101, 102, 101, 116, 99, 104, 105, 110,
+    103, 32, 116, 111, 32, 116, 104, 105, 115, 32, 109, 97, 110, 121, 32, 98, 121, 116, 101, 115, 46, 34, 10, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97,
+    120, 65, 118, 97, 105, 108, 97, 98, 108, 101, 83, 103, 112, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 104, 97, 100, 101, 114, 32, 79, 112, 116, 105,
+    111, 110, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 49, 48, 48, 56, 52, 51, 57, 55, 55, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 65, 118, 97, 105, 108, 97, 98, 108, 101, 83, 103, 112,
+    114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    65, 114, 116, 105, 102, 105, 99, 105, 97, 108, 108, 121, 32, 108, 105, 109, 105, 116, 115, 32, 116, 104, 101, 32,
+    109, 97, 120, 105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 83, 71, 80, 82, 115, 32, 97,
+    118, 97, 105, 108, 97, 98, 108, 101, 32, 102, 111, 114, 32, 115, 104, 97, 100, 101, 114, 32, 99, 111, 109, 112, 105,
+    108, 97, 116, 105, 111, 110, 46, 32, 65, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 122, 101, 114, 111, 32, 100,
+    105, 115, 97, 98, 108, 101, 115, 32, 116, 104, 101, 32, 108, 105, 109, 105, 116, 32, 97, 110, 100, 32, 72, 87, 32,
+    100, 101, 102, 97, 117, 108, 116, 115, 32, 97, 114, 101, 32, 117, 115, 101, 100, 46, 34, 10, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 65, 118,
+    97, 105, 108, 97, 98, 108, 101, 86, 103, 112, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 104, 97, 100, 101, 114, 32, 79, 112, 116, 105, 111, 110, 115,
+    34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 50, 49, 49, 54, 53, 52, 54, 51, 48, 53, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34,
+    58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 65, 118, 97, 105, 108, 97, 98, 108, 101, 86, 103, 112, 114, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 114, 116,
+    105, 102, 105, 99, 105, 97, 108, 108, 121, 32, 108, 105, 109, 105, 116, 115, 32, 116, 104, 101, 32, 109, 97, 120,
+    105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 86, 71, 80, 82, 115, 32, 97, 118, 97, 105,
+    108, 97, 98, 108, 101, 32, 102, 111, 114, 32, 115, 104, 97, 100, 101, 114, 32, 99, 111, 109, 112, 105, 108, 97, 116,
+    105, 111, 110, 46, 32, 65, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 122, 101, 114, 111, 32, 100, 105, 115, 97,
+    98, 108, 101, 115, 32, 116, 104, 101, 32, 108, 105, 109, 105, 116, 32, 97, 110, 100, 32, 72, 87, 32, 100, 101, 102,
+    97, 117, 108, 116, 115, 32, 97, 114, 101, 32, 117, 115, 101, 100, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 84, 104, 114, 101, 97,
+    100, 71, 114, 111, 117, 112, 115, 80, 101, 114, 67, 111, 109, 112, 117, 116, 101, 85, 110, 105, 116, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 104, 97, 100,
+    101, 114, 32, 79, 112, 116, 105, 111, 110, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 50, 56, 52, 53, 49, 55, 57, 57, 57, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 84, 104, 114, 101, 97, 100,
+    71, 114, 111, 117, 112, 115, 80, 101, 114, 67, 111, 109, 112, 117, 116, 101, 85, 110, 105, 116, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114,
+    111, 108, 115, 32, 104, 111, 119, 32, 109, 97, 110, 121, 32, 67, 83, 32, 116, 104, 114, 101, 97, 100, 45, 103, 114,
+    111, 117, 112, 115, 32, 97, 114, 101, 32, 97, 108, 108, 111, 119, 101, 100, 32, 116, 111, 32, 108, 97, 117, 110, 99,
+    104, 32, 112, 101, 114, 32, 99, 111, 109, 112, 117, 116, 101, 32, 117, 110, 105, 116, 46, 32, 32, 84, 104, 105, 115,
+    32, 116, 104, 114, 111, 116, 116, 108, 101, 115, 32, 116, 104, 101, 32, 115, 104, 97, 100, 101, 114, 44, 32, 119,
+    104, 105, 99, 104, 32, 99, 97, 110, 32, 115, 111, 109, 101, 116, 105, 109, 101, 115, 32, 101, 110, 97, 98, 108, 101,
+    32, 109, 111, 114, 101, 32, 103, 114, 97, 112, 104, 105, 99, 115, 32, 115, 104, 97, 100, 101, 114, 32, 119, 111,
+    114, 107, 32, 116, 111, 32, 99, 111, 109, 112, 108, 101, 116, 101, 32, 105, 110, 32, 112, 97, 114, 97, 108, 108,
+    101, 108, 46, 32, 65, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 122, 101, 114, 111, 32, 100, 105, 115, 97, 98,
+    108, 101, 115, 32, 108, 105, 109, 105, 116, 105, 110, 103, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32,
+    111, 102, 32, 116, 104, 114, 101, 97, 100, 45, 103, 114, 111, 117, 112, 115, 32, 116, 111, 32, 108, 97, 117, 110,
+    99, 104, 46, 32, 32, 84, 104, 105, 115, 32, 102, 105, 101, 108, 100, 32, 105, 115, 32, 32, 105, 103, 110, 111, 114,
+    101, 100, 32, 102, 111, 114, 32, 103, 114, 97, 112, 104, 105, 99, 115, 32, 115, 104, 97, 100, 101, 114, 115, 46, 34,
+    10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 77, 97, 120, 83, 99, 114, 97, 116, 99, 104, 82, 105, 110, 103, 83, 105, 122, 101, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 99, 114, 97, 116, 99, 104,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 10, 32, 32,
+    32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 55, 56, 52,
+    53, 50, 56, 55, 53, 56, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 50, 54, 56, 52, 51, 53, 52, 53,
+    54, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 103, 112, 117, 115, 105, 122, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 83, 99, 114, 97, 116, 99, 104, 82, 105, 110, 103, 83, 105,
+    122, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 115, 105,
+    122, 101, 32, 111, 102, 32, 116, 104, 101, 32, 115, 99, 114, 97, 116, 99, 104, 32, 114, 105, 110, 103, 32, 97, 108,
+    108, 111, 99, 97, 116, 105, 111, 110, 46, 32, 73, 102, 32, 116, 104, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116,
+    105, 111, 110, 32, 114, 101, 113, 117, 101, 115, 116, 115, 32, 109, 111, 114, 101, 32, 115, 99, 114, 97, 116, 99,
+    104, 32, 109, 101, 109, 111, 114, 121, 32, 116, 104, 97, 110, 32, 116, 104, 105, 115, 44, 32, 116, 104, 101, 32,
+    100, 114, 105, 118, 101, 114, 32, 119, 105, 108, 108, 32, 108, 105, 109, 105, 116, 32, 116, 104, 101, 32, 110, 117,
+    109, 98, 101, 114, 32, 111, 102, 32, 119, 97, 118, 101, 115, 32, 105, 110, 32, 102, 108, 105, 103, 104, 116, 32,
+    116, 111, 32, 99, 111, 109, 112, 108, 121, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 109, 101, 109, 111, 114,
+    121, 32, 114, 101, 115, 116, 114, 105, 99, 116, 105, 111, 110, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 102, 104, 71, 112, 117, 77, 97, 115,
+    107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 77, 71, 80, 85, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 98, 117, 103, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 53, 49, 55, 54, 50, 54, 54, 54, 52, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72,
+    101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 49, 53, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112,
+    101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116, 116, 105, 110,
+    103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 71, 114, 101, 97, 116, 101, 114, 84, 104, 97, 110, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 73, 102, 104, 77, 111,
+    100, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 105, 102, 104, 71, 112, 117, 77, 97, 115, 107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 115, 107, 32, 111, 102, 32, 116, 104, 101, 32,
+    71, 80, 85, 115, 32, 116, 111, 32, 104, 97, 118, 101, 32, 97, 108, 108, 32, 115, 117, 98, 109, 105, 116, 115, 32,
+    100, 114, 111, 112, 112, 101, 100, 46, 32, 83, 101, 101, 32, 73, 70, 72, 32, 115, 101, 116, 116, 105, 110, 103, 32,
+    102, 111, 114, 32, 73, 70, 72, 32, 109, 111, 100, 101, 32, 116, 104, 97, 116, 32, 119, 105, 108, 108, 32, 98, 101,
+    32, 97, 112, 112, 108, 105, 101, 100, 46, 32, 73, 102, 32, 116, 104, 101, 32, 98, 105, 116, 32, 105, 115, 32, 115,
+    101, 116, 44, 32, 116, 104, 101, 32, 71, 80, 85, 32, 119, 105, 108, 108, 32, 104, 97, 118, 101, 32, 105, 116, 115,
+    32, 115, 117, 98, 109, 105, 116, 115, 32, 100, 114, 111, 112, 112, 101, 100, 46, 34, 10, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 72, 119, 67, 111, 109,
+    112, 111, 115, 105, 116, 105, 110, 103, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 77, 71, 80, 85, 34, 10, 32, 32, 32, 32, 32,
+    32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 55, 50, 49, 54,
+    57, 55, 49, 55, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111,
+    111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 104, 119, 67, 111, 109, 112, 111, 115, 105, 116, 105, 110, 103, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108,
+    101, 115, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 111, 114, 32, 116, 104, 101, 32, 72, 87, 32, 99, 111, 109,
+    112, 111, 115, 105, 116, 111, 114, 32, 40, 99, 114, 111, 115, 115, 68, 105, 115, 112, 108, 97, 121, 80, 114, 101,
+    115, 101, 110, 116, 41, 32, 105, 102, 32, 116, 104, 101, 32, 104, 97, 114, 100, 119, 97, 114, 101, 32, 115, 117,
+    112, 112, 111, 114, 116, 115, 32, 72, 87, 32, 99, 111, 109, 112, 111, 115, 105, 116, 105, 110, 103, 46, 34, 10, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77,
+    103, 112, 117, 67, 111, 109, 112, 97, 116, 105, 98, 105, 108, 105, 116, 121, 69, 110, 97, 98, 108, 101, 100, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 77, 71,
+    80, 85, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 49, 49, 55, 55, 57, 51, 55, 50, 57, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116,
+    114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 103, 112, 117, 67, 111, 109, 112, 97, 116, 105, 98, 105, 108, 105, 116,
+    121, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 111,
+    114, 32, 77, 71, 80, 85, 32, 105, 110, 32, 80, 65, 76, 46, 32, 73, 102, 32, 77, 71, 80, 85, 32, 67, 111, 109, 112,
+    97, 116, 105, 98, 105, 108, 105, 116, 121, 32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 44, 32, 97, 108,
+    108, 32, 71, 80, 85, 115, 32, 119, 105, 108, 108, 32, 115, 116, 105, 108, 108, 32, 98, 101, 32, 101, 120, 112, 111,
+    115, 101, 100, 32, 116, 111, 32, 116, 104, 101, 32, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 44, 32, 98,
+    117, 116, 32, 110, 111, 32, 77, 71, 80, 85, 45, 115, 112, 101, 99, 105, 102, 105, 99, 32, 99, 111, 109, 112, 97,
+    116, 105, 98, 105, 108, 105, 116, 121, 32, 102, 108, 97, 103, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 114,
+    101, 116, 117, 114, 110, 101, 100, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 101, 101, 114, 77, 101, 109, 111, 114, 121, 69, 110, 97, 98, 108,
+    101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 77, 71, 80, 85, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 50, 53, 57, 51, 54, 50, 53, 49, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 101, 101, 114, 77, 101, 109, 111, 114, 121, 69,
+    110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 111, 114, 32,
+    112, 101, 101, 114, 32, 109, 101, 109, 111, 114, 121, 32, 97, 110, 100, 32, 112, 101, 101, 114, 32, 109, 101, 109,
+    111, 114, 121, 32, 116, 114, 97, 110, 115, 102, 101, 114, 115, 32, 105, 102, 32, 116, 104, 101, 32, 104, 97, 114,
+    100, 119, 97, 114, 101, 32, 105, 115, 32, 99, 97, 112, 97, 98, 108, 101, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 111, 114, 99, 101, 80,
+    114, 101, 115, 101, 110, 116, 86, 105, 97, 71, 100, 105, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 87, 83, 73, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 48, 55, 56, 55, 49, 54, 53, 51, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 79, 83, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 87, 105, 110, 100, 111,
+    119, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 111, 114, 99, 101, 80, 114,
+    101, 115, 101, 110, 116, 86, 105, 97, 71, 100, 105, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 115, 32, 116, 104, 101, 32, 112, 114, 101, 115,
+    101, 110, 116, 32, 116, 101, 99, 104, 110, 105, 113, 117, 101, 32, 116, 111, 32, 117, 115, 101, 32, 116, 104, 101,
+    32, 71, 68, 73, 32, 66, 76, 84, 32, 112, 97, 116, 104, 46, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 114, 101, 115, 101, 110, 116, 86, 105, 97, 79,
+    103, 108, 82, 117, 110, 116, 105, 109, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 87, 83, 73, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 54, 54, 51, 54, 51, 55, 55, 48, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 79, 83, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 87, 105, 110, 100, 111, 119, 115, 34,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 75, 101, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 114, 101, 115, 101, 110, 116, 86, 105, 97,
+    79, 103, 108, 82, 117, 110, 116, 105, 109, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 110, 32, 116, 114, 117, 101, 32, 119, 105, 110, 100, 111,
+    119, 32, 109, 111, 100, 101, 32, 112, 114, 101, 115, 101, 110, 116, 32, 112, 97, 116, 104, 32, 119, 105, 108, 108,
+    32, 103, 111, 32, 116, 104, 114, 111, 117, 103, 104, 32, 79, 112, 101, 110, 71, 76, 32, 114, 117, 110, 116, 105,
+    109, 101, 46, 32, 87, 104, 101, 110, 32, 102, 97, 108, 115, 101, 32, 119, 105, 110, 100, 111, 119, 32, 109, 111,
+    100, 101, 32, 112, 114, 101, 115, 101, 110, 116, 32, 112, 97, 116, 104, 32, 115, 116, 105, 108, 108, 32, 103, 111,
+    32, 108, 101, 103, 97, 99, 121, 32, 68, 87, 77, 32, 65, 80, 73, 32, 112, 97, 116, 104, 46, 34, 10, 32, 32, 32, 32,
+    125, 10, 32, 32, 93, 44, 10, 32, 32, 34, 68, 101, 102, 105, 110, 101, 100, 67, 111, 110, 115, 116, 97, 110, 116,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77,
+    97, 120, 80, 97, 116, 104, 83, 116, 114, 76, 101, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 53, 49, 50, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 115, 116, 114, 105, 110, 103, 32, 108, 101, 110, 103, 116,
+    104, 32, 102, 111, 114, 32, 97, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 47, 112, 97, 116, 104, 32, 115, 101,
+    116, 116, 105, 110, 103, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 70, 105, 108, 101, 78, 97, 109, 101, 83, 116, 114, 76, 101, 110, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 53, 54, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 115,
+    116, 114, 105, 110, 103, 32, 108, 101, 110, 103, 116, 104, 32, 102, 111, 114, 32, 97, 32, 102, 105, 108, 101, 110,
+    97, 109, 101, 32, 115, 101, 116, 116, 105, 110, 103, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 77, 105, 115, 99, 83, 116, 114, 76, 101,
+    110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 54, 49, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32,
+    115, 116, 114, 105, 110, 103, 32, 108, 101, 110, 103, 116, 104, 32, 102, 111, 114, 32, 97, 32, 109, 105, 115, 99,
+    101, 108, 108, 97, 110, 101, 111, 117, 115, 32, 115, 116, 114, 105, 110, 103, 32, 115, 101, 116, 116, 105, 110, 103,
+    34, 10, 32, 32, 32, 32, 125, 10, 32, 32, 93, 44, 10, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32,
+    32, 34, 80, 117, 98, 108, 105, 99, 32, 67, 67, 67, 32, 79, 112, 116, 105, 111, 110, 115, 34, 44, 10, 32, 32, 32, 32,
+    34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 34, 71, 80, 85, 32, 73, 110, 102, 111, 34, 44, 10,
+    32, 32, 32, 32, 34, 80, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 34, 80, 114,
+    105, 110, 116, 105, 110, 103, 32, 97, 110, 100, 32, 76, 111, 103, 103, 105, 110, 103, 34, 44, 10, 32, 32, 32, 32,
+    34, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 44, 10, 32, 32, 32, 32, 34, 82, 101, 115,
+    111, 117, 114, 99, 101, 32, 83, 101, 116, 116, 105, 110, 103, 115, 34, 44, 10, 32, 32, 32, 32, 34, 80, 114, 101,
+    102, 101, 116, 99, 104, 105, 110, 103, 32, 40, 76, 50, 32, 67, 97, 99, 104, 101, 32, 87, 97, 114, 109, 105, 110,
+    103, 41, 34, 44, 10, 32, 32, 32, 32, 34, 83, 104, 97, 100, 101, 114, 32, 79, 112, 116, 105, 111, 110, 115, 34, 44,
+    10, 32, 32, 32, 32, 34, 77, 71, 80, 85, 34, 44, 10, 32, 32, 32, 32, 34, 87, 83, 73, 34, 44, 10, 32, 32, 32, 32, 34,
+    68, 101, 98, 117, 103, 32, 79, 118, 101, 114, 108, 97, 121, 34, 44, 10, 32, 32, 32, 32, 34, 71, 80, 85, 32, 80, 114,
+    111, 102, 105, 108, 101, 114, 34, 44, 10, 32, 32, 32, 32, 34, 67, 109, 100, 66, 117, 102, 102, 101, 114, 32, 76,
+    111, 103, 103, 101, 114, 34, 44, 10, 32, 32, 32, 32, 34, 73, 110, 116, 101, 114, 102, 97, 99, 101, 32, 76, 111, 103,
+    103, 101, 114, 34, 44, 10, 32, 32, 32, 32, 34, 68, 101, 98, 117, 103, 34, 44, 10, 32, 32, 32, 32, 34, 83, 97, 102,
+    101, 83, 101, 116, 116, 105, 110, 103, 34, 44, 10, 32, 32, 32, 32, 34, 68, 101, 118, 77, 111, 100, 101, 34, 44, 10,
+    32, 32, 32, 32, 34, 72, 68, 82, 34, 44, 10, 32, 32, 32, 32, 34, 80, 114, 111, 102, 105, 108, 105, 110, 103, 34, 44,
+    10, 32, 32, 32, 32, 34, 66, 114, 105, 110, 103, 117, 112, 34, 44, 10, 32, 32, 32, 32, 34, 72, 101, 97, 112, 80, 101,
+    114, 102, 34, 44, 10, 32, 32, 32, 32, 34, 69, 109, 117, 108, 97, 116, 105, 111, 110, 34, 10, 32, 32, 93, 10, 125
 };  // g_palJsonData[]
 
 } // Pal
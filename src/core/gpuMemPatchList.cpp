@@ -25,6 +25,7 @@
 
 #include "core/device.h"
 #include "core/gpuMemPatchList.h"
+#include "palFlatHashMapImpl.h"
 #include "palVectorImpl.h"
 
 using namespace Util;
@@ -38,7 +39,9 @@ GpuMemoryPatchList::GpuMemoryPatchList(
     :
     m_pDevice(pDevice),
     m_gpuMemoryRefs(pDevice->GetPlatform()),
-    m_patchEntries(pDevice->GetPlatform())
+    m_patchEntries(pDevice->GetPlatform()),
+    m_gpuMemoryRefIndex(MaxLinearSearchRefs * 4, pDevice->GetPlatform()),
+    m_gpuMemoryRefIndexInitialized(false)
 {
 }
 
@@ -52,6 +55,7 @@ void GpuMemoryPatchList::Reset()
 {
     m_gpuMemoryRefs.Clear();
     m_patchEntries.Clear();
+    m_gpuMemoryRefIndex.Reset();
 
     constexpr GpuMemoryRef NullMemoryRef = { };
     Result result = m_gpuMemoryRefs.PushBack(NullMemoryRef);
@@ -150,7 +154,8 @@ Result GpuMemoryPatchList::AddWidePatchEntry(
 
 // =====================================================================================================================
 // Helper method which finds the index in the memory reference list where the specified GPU memory is located. If the
-// memory object is not yet on the list, it will be added.
+// memory object is not yet on the list, it will be added.  If it is already on the list, it only stays read-only if
+// this reference is read-only too.
 Result GpuMemoryPatchList::FindGpuMemoryRefIndex(
     GpuMemory* pGpuMem,
     bool       readOnly,
@@ -160,31 +165,100 @@ Result GpuMemoryPatchList::FindGpuMemoryRefIndex(
 
     Result result = Result::Success;
 
-    // Note: Right now we're just doing a linear scan of the reference list to find the memory object's location. This
-    // isn't the most efficient choice, but since the command buffers which use patch lists tend to have only a few
-    // entries. For tiny patch/reference lists the linear scan isn't expected to be a problem.
-    for ((*pIndex) = 1; (*pIndex) < m_gpuMemoryRefs.NumElements(); ++(*pIndex))
+    // The first entry of the reference list is always the null reference, so real references start at index one.
+    const uint32 numRefs = m_gpuMemoryRefs.NumElements();
+
+    if ((m_gpuMemoryRefIndex.GetNumEntries() == 0) && (numRefs <= MaxLinearSearchRefs))
+    {
+        // Most command buffers which use patch lists only reference a handful of allocations, for which a linear scan
+        // beats hashing.
+        for ((*pIndex) = 1; (*pIndex) < numRefs; ++(*pIndex))
+        {
+            if (m_gpuMemoryRefs.At(*pIndex).pGpuMemory == pGpuMem)
+            {
+                break;
+            }
+        }
+    }
+    else
     {
-        auto*const pMemRef = &m_gpuMemoryRefs.At(*pIndex);
+        if (m_gpuMemoryRefIndex.GetNumEntries() == 0)
+        {
+            result = BuildGpuMemoryRefIndex();
+        }
+
+        uint32* pRefIndex = nullptr;
+        bool    existed   = false;
 
-        if (pMemRef->pGpuMemory == pGpuMem)
+        if (result == Result::Success)
         {
+            result = m_gpuMemoryRefIndex.FindAllocate(pGpuMem, &existed, &pRefIndex);
+        }
+
+        if (result == Result::Success)
+        {
+            if (existed == false)
+            {
+                // The memory object is about to be appended to the reference list below.
+                (*pRefIndex) = numRefs;
+            }
+
+            (*pIndex) = (*pRefIndex);
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        if ((*pIndex) == numRefs)
+        {
+            // The memory object wasn't in the reference list before, so add it.
+            GpuMemoryRef memRef   = { };
+            memRef.pGpuMemory     = pGpuMem;
+            memRef.flags.readOnly = (readOnly ? 1 : 0);
+
+            result = m_gpuMemoryRefs.PushBack(memRef);
+
+            if ((result != Result::Success) && (m_gpuMemoryRefIndex.GetNumEntries() > 0))
+            {
+                m_gpuMemoryRefIndex.Erase(pGpuMem);
+            }
+        }
+        else
+        {
+            auto*const pMemRef = &m_gpuMemoryRefs.At(*pIndex);
+
             pMemRef->flags.readOnly = (readOnly ? pMemRef->flags.readOnly : 0);
-            break;
         }
     }
 
-    if ((*pIndex) == m_gpuMemoryRefs.NumElements())
+    PAL_ASSERT((result != Result::Success) || ((*pIndex) < m_gpuMemoryRefs.NumElements()));
+    return result;
+}
+
+// =====================================================================================================================
+// Fills the reference index with every memory object currently in the reference list.  This is done once per Reset(),
+// when the list first grows too long to search linearly.
+Result GpuMemoryPatchList::BuildGpuMemoryRefIndex()
+{
+    Result result = Result::Success;
+
+    if (m_gpuMemoryRefIndexInitialized == false)
+    {
+        result = m_gpuMemoryRefIndex.Init();
+        m_gpuMemoryRefIndexInitialized = (result == Result::Success);
+    }
+
+    for (uint32 idx = 1; (result == Result::Success) && (idx < m_gpuMemoryRefs.NumElements()); ++idx)
     {
-        // The memory object wasn't in the reference list before, so add it.
-        GpuMemoryRef memRef   = { };
-        memRef.pGpuMemory     = pGpuMem;
-        memRef.flags.readOnly = (readOnly ? 1 : 0);
+        result = m_gpuMemoryRefIndex.Insert(m_gpuMemoryRefs.At(idx).pGpuMemory, idx);
+    }
 
-        result = m_gpuMemoryRefs.PushBack(memRef);
+    if (result != Result::Success)
+    {
+        // Fall back to a linear search on the next lookup rather than trusting a partial index.
+        m_gpuMemoryRefIndex.Reset();
     }
 
-    PAL_ASSERT((*pIndex) < m_gpuMemoryRefs.NumElements());
     return result;
 }
 
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include "palFlatHashMap.h"
 #include "palQueue.h"
 #include "palVector.h"
 
@@ -90,6 +91,12 @@ class GpuMemoryPatchList
     typedef Util::Vector<GpuMemoryRef, 16, Platform>  MemoryRefVector;
     typedef Util::Vector<GpuMemoryPatchEntry, 16, Platform>  PatchEntryVector;
 
+    // Maps each GPU memory object in the reference list to its index in that list.
+    typedef Util::FlatHashMap<IGpuMemory*, uint32, Platform>  MemoryRefIndexMap;
+
+    // Reference lists up to this size are searched linearly; larger lists switch over to m_gpuMemoryRefIndex.
+    static constexpr uint32 MaxLinearSearchRefs = 32;
+
 public:
     explicit GpuMemoryPatchList(
         Device* pDevice);
@@ -132,11 +139,17 @@ private:
         bool       readOnly,
         uint32*    pIndex);
 
+    Result BuildGpuMemoryRefIndex();
+
     Device*const  m_pDevice;
 
     MemoryRefVector   m_gpuMemoryRefs;
     PatchEntryVector  m_patchEntries;
 
+    // Indexes m_gpuMemoryRefs once it outgrows a linear search.  It is empty while the list is small.
+    MemoryRefIndexMap m_gpuMemoryRefIndex;
+    bool              m_gpuMemoryRefIndexInitialized;
+
     PAL_DISALLOW_DEFAULT_CTOR(GpuMemoryPatchList);
     PAL_DISALLOW_COPY_AND_ASSIGN(GpuMemoryPatchList);
 };
@@ -146,6 +146,8 @@ Result ComputeCmdBuffer::End()
     if (result == Result::Success)
     {
 #if PAL_ENABLE_PRINTS_ASSERTS
+        LogRecordingStats();
+
         if (IsDumpingEnabled() && DumpFile()->IsOpen())
         {
             if (m_device.Parent()->Settings().cmdBufDumpFormat == CmdBufDumpFormatBinaryHeaders)
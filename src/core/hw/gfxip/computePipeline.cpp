@@ -107,14 +107,14 @@ Result ComputePipeline::InitFromPipelineBinary(
     PAL_ASSERT((m_pPipelineBinary != nullptr) && (m_pipelineBinaryLen != 0));
 
     AbiProcessor abiProcessor(m_pDevice->GetPlatform());
-    Result result = abiProcessor.LoadFromBuffer(m_pPipelineBinary, m_pipelineBinaryLen);
+    Result result = abiProcessor.LoadFromBufferView(m_pPipelineBinary, m_pipelineBinaryLen);
 
     MsgPackReader      metadataReader;
     CodeObjectMetadata metadata;
 
     if (result == Result::Success)
     {
-        result = abiProcessor.GetMetadata(&metadataReader, &metadata);
+        result = GetMetadata(abiProcessor, &metadataReader, &metadata);
     }
 
     if (result == Result::Success)
@@ -78,6 +78,7 @@ CmdStream::CmdStream(
     m_cmdUtil(device.CmdUtil()),
     m_pPm4Optimizer(nullptr)
 {
+    memset(&m_pm4OptStats, 0, sizeof(m_pm4OptStats));
 }
 
 // =====================================================================================================================
@@ -105,12 +106,42 @@ Result CmdStream::Begin(
     return result;
 }
 
+// =====================================================================================================================
+void CmdStream::Reset(
+    CmdAllocator* pNewAllocator,
+    bool          returnGpuMemory)
+{
+    memset(&m_pm4OptStats, 0, sizeof(m_pm4OptStats));
+
+    GfxCmdStream::Reset(pNewAllocator, returnGpuMemory);
+}
+
+// =====================================================================================================================
+void CmdStream::AccumulateRecordingStats(
+    CmdBufferRecordingStats* pStats
+    ) const
+{
+    GfxCmdStream::AccumulateRecordingStats(pStats);
+
+    pStats->pm4OptDwordsEliminated       += m_pm4OptStats.pm4OptDwordsEliminated;
+    pStats->pm4OptContextRollsEliminated += m_pm4OptStats.pm4OptContextRollsEliminated;
+}
+
 // =====================================================================================================================
 void CmdStream::CleanupTempObjects()
 {
     // Clean up the temporary PM4 optimizer object.
     if (m_pMemAllocator != nullptr)
     {
+        if (m_pPm4Optimizer != nullptr)
+        {
+            const Pm4OptimizerStats& stats = m_pPm4Optimizer->GetStats();
+
+            // The optimizer is destroyed at the end of every build; keep its statistics for GetRecordingStats().
+            m_pm4OptStats.pm4OptDwordsEliminated       += stats.dwordsEliminated;
+            m_pm4OptStats.pm4OptContextRollsEliminated += stats.contextRollsEliminated;
+        }
+
         PAL_SAFE_DELETE(m_pPm4Optimizer, m_pMemAllocator);
     }
 }
@@ -870,5 +901,15 @@ void CmdStream::NotifyNestedCmdBufferExecute()
     }
 }
 
+// =====================================================================================================================
+// Tells the immediate mode PM4 optimizer that a draw has been validated, which closes its current context window.
+void CmdStream::NotifyDraw()
+{
+    if (m_flags.optModeImmediate == 1)
+    {
+        m_pPm4Optimizer->EndContextWindow();
+    }
+}
+
 } // Gfx6
 } // Pal
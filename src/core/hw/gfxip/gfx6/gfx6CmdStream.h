@@ -62,6 +62,9 @@ public:
     virtual ~CmdStream() {}
 
     virtual Result Begin(CmdStreamBeginFlags flags, Util::VirtualLinearAllocator* pMemAllocator) override;
+    virtual void   Reset(CmdAllocator* pNewAllocator, bool returnGpuMemory) override;
+
+    virtual void AccumulateRecordingStats(CmdBufferRecordingStats* pStats) const override;
 
     // Public command interface:
     // The command stream client should call these special functions whenever it wishes to copy pre-built PM4 images
@@ -123,6 +126,7 @@ public:
     void NotifyIndirectShRegWrite(uint32 regAddr);
 
     void NotifyNestedCmdBufferExecute();
+    void NotifyDraw();
 
 protected:
     virtual size_t BuildCondIndirectBuffer(
@@ -154,7 +158,8 @@ private:
 
     const CmdUtil& m_cmdUtil;
 
-    Pm4Optimizer*  m_pPm4Optimizer;     // This will only be created if optimization is enabled for this stream.
+    Pm4Optimizer*           m_pPm4Optimizer; // This will only be created if optimization is enabled for this stream.
+    CmdBufferRecordingStats m_pm4OptStats;   // PM4 optimizer statistics gathered since the last Reset().
 
     PAL_DISALLOW_COPY_AND_ASSIGN(CmdStream);
     PAL_DISALLOW_DEFAULT_CTOR(CmdStream);
@@ -972,6 +972,9 @@ void ComputeCmdBuffer::CmdExecuteNestedCmdBuffers(
         // state back to the caller.
         LeakNestedCmdBufferState(*pCallee);
     }
+
+    // Chained callees jump directly from one to the next; the last of them still has to return here.
+    m_cmdStream.EndCallChain();
 }
 
 // =====================================================================================================================
@@ -73,6 +73,8 @@ Pm4Optimizer::Pm4Optimizer(
     , m_dstContainsSrc(false)
 #endif
 {
+    memset(&m_stats, 0, sizeof(m_stats));
+
     Reset();
 }
 
@@ -131,6 +133,23 @@ void Pm4Optimizer::Reset()
         m_shRegs[SpiShaderPgmRsrc1LsIdx].flags.mustWrite = 1;
         m_shRegs[SpiShaderPgmRsrc2LsIdx].flags.mustWrite = 1;
     }
+
+    m_cntxWindowKept    = false;
+    m_cntxWindowSkipped = false;
+}
+
+// =====================================================================================================================
+// Called when a draw ends the current context window. If every context register write in the window was skipped, the
+// draw would have rolled the context without the optimizer.
+void Pm4Optimizer::EndContextWindow()
+{
+    if (m_cntxWindowSkipped && (m_cntxWindowKept == false))
+    {
+        m_stats.contextRollsEliminated++;
+    }
+
+    m_cntxWindowKept    = false;
+    m_cntxWindowSkipped = false;
 }
 
 // =====================================================================================================================
@@ -140,7 +159,17 @@ bool Pm4Optimizer::MustKeepSetContextReg(
     uint32 regAddr,
     uint32 regData)
 {
-    return UpdateRegState(regData, m_cntxRegs + (regAddr - CONTEXT_SPACE_START));
+    const bool mustKeep = UpdateRegState(regData, m_cntxRegs + (regAddr - CONTEXT_SPACE_START));
+
+    TrackContextWindow(mustKeep);
+
+    if (mustKeep == false)
+    {
+        // The caller would have written a single-register SET packet.
+        m_stats.dwordsEliminated += PM4_CMD_SET_DATA_DWORDS + 1;
+    }
+
+    return mustKeep;
 }
 
 // =====================================================================================================================
@@ -150,7 +179,15 @@ bool Pm4Optimizer::MustKeepSetShReg(
     uint32 regAddr,
     uint32 regData)
 {
-    return UpdateRegState(regData, m_shRegs + (regAddr - PERSISTENT_SPACE_START));
+    const bool mustKeep = UpdateRegState(regData, m_shRegs + (regAddr - PERSISTENT_SPACE_START));
+
+    if (mustKeep == false)
+    {
+        // The caller would have written a single-register SET packet.
+        m_stats.dwordsEliminated += PM4_CMD_SET_DATA_DWORDS + 1;
+    }
+
+    return mustKeep;
 }
 
 // =====================================================================================================================
@@ -177,6 +214,13 @@ bool Pm4Optimizer::MustKeepContextRegRmw(
         mustKeep = UpdateRegState(newRegVal, pRegState);
     }
 
+    TrackContextWindow(mustKeep);
+
+    if (mustKeep == false)
+    {
+        m_stats.dwordsEliminated += CmdUtil::GetContextRegRmwSize();
+    }
+
     return mustKeep;
 }
 
@@ -207,7 +251,9 @@ uint32* Pm4Optimizer::WriteOptimizedSetSeqContextRegs(
     m_dstContainsSrc = false;
 #endif
 
-    return OptimizePm4SetReg(setData, pData, pCmdSpace, m_cntxRegs);
+    uint32* pNewCmdSpace = OptimizePm4SetReg(setData, pData, pCmdSpace, m_cntxRegs);
+    TrackContextWindow(pNewCmdSpace > pCmdSpace);
+    return pNewCmdSpace;
 }
 
 // =====================================================================================================================
@@ -266,15 +312,19 @@ void Pm4Optimizer::OptimizePm4Commands(
 
         if (opcode == IT_SET_CONTEXT_REG)
         {
+            uint32*const pPreOptCmdCur = pOptCmdCur;
+
             optimized  = true;
             pOptCmdCur = OptimizePm4SetReg(reinterpret_cast<const PM4CMDSETDATA&>(*pOrigCmdCur),
                                            pOrigCmdCur + PM4_CMD_SET_DATA_DWORDS,
                                            pOptCmdCur,
                                            &m_cntxRegs[0]);
+            TrackContextWindow(pOptCmdCur > pPreOptCmdCur);
         }
         else if (opcode == IT_SET_CONTEXT_REG_INDIRECT)
         {
             HandlePm4SetContextRegIndirect(reinterpret_cast<const PM4CMDSETDATA&>(*pOrigCmdCur));
+            TrackContextWindow(true);
         }
         else if ((opcode == IT_SET_SH_REG) || (opcode == IT_SET_SH_REG_INDEX__CI__VI))
         {
@@ -291,10 +341,12 @@ void Pm4Optimizer::OptimizePm4Commands(
         else if (opcode == IT_LOAD_CONTEXT_REG)
         {
             HandlePm4LoadReg(reinterpret_cast<const PM4CMDLOADDATA&>(*pOrigCmdCur), &m_cntxRegs[0]);
+            TrackContextWindow(true);
         }
         else if (opcode == IT_LOAD_CONTEXT_REG_INDEX__VI)
         {
             HandlePm4LoadRegIndex(reinterpret_cast<const PM4CMDLOADDATAINDEX&>(*pOrigCmdCur), &m_cntxRegs[0]);
+            TrackContextWindow(true);
         }
         else if (opcode == IT_LOAD_SH_REG)
         {
@@ -356,6 +408,23 @@ void Pm4Optimizer::OptimizePm4Commands(
             Reset();
         }
 
+        // A draw consumes the current context, so it closes the window of context register writes which precede it.
+        switch (opcode)
+        {
+        case IT_DRAW_INDIRECT:
+        case IT_DRAW_INDEX_INDIRECT:
+        case IT_DRAW_INDEX_2:
+        case IT_DRAW_INDIRECT_MULTI:
+        case IT_DRAW_INDEX_AUTO:
+        case IT_DRAW_INDEX_MULTI_AUTO:
+        case IT_DRAW_INDEX_OFFSET_2:
+        case IT_DRAW_INDEX_INDIRECT_MULTI:
+            EndContextWindow();
+            break;
+        default:
+            break;
+        }
+
         if (optimized == false)
         {
             // No optimization for this packet. Just copy it.
@@ -388,7 +457,8 @@ uint32* Pm4Optimizer::OptimizePm4SetReg(
     uint32*              pDstCmd,
     RegState*            pRegStateBase)
 {
-    const uint32 numRegs = setData.header.count;
+    const uint32*const pDstStart = pDstCmd;
+    const uint32       numRegs   = setData.header.count;
 
     // Determine which of the registers written by this set command can't be skipped because they must always be set or
     // are taking on a new value.
@@ -514,6 +584,10 @@ uint32* Pm4Optimizer::OptimizePm4SetReg(
         }
     }
 
+    const uint32 dwordsWritten = static_cast<uint32>(pDstCmd - pDstStart);
+
+    m_stats.dwordsEliminated += (PM4_CMD_SET_DATA_DWORDS + numRegs) - dwordsWritten;
+
     return pDstCmd;
 }
 
@@ -47,6 +47,14 @@ struct RegState
     uint32 value;
 };
 
+// Statistics gathered by a Pm4Optimizer over its lifetime. They are not cleared by Pm4Optimizer::Reset().
+struct Pm4OptimizerStats
+{
+    uint64 dwordsEliminated;       // Command DWORDs which were skipped away.
+    uint64 contextRollsEliminated; // Draws whose preceding context register writes were all skipped. Each of these
+                                   // would otherwise have caused a context roll.
+};
+
 // =====================================================================================================================
 // Utility class which provides routines to optimize PM4 command streams. Currently it only optimizes SH register writes
 // and context register writes.
@@ -63,6 +71,10 @@ public:
     bool MustKeepSetShReg(uint32 regAddr, uint32 regData);
     bool MustKeepContextRegRmw(uint32 regAddr, uint32 regMask, uint32 regData);
 
+    const Pm4OptimizerStats& GetStats() const { return m_stats; }
+
+    void EndContextWindow();
+
     // These functions take a fully built SET_DATA header and the corresponding register data and will write the an
     // optimized version into pCmdSpace.
     uint32* WriteOptimizedSetSeqShRegs(const PM4CMDSETDATA& setData, const uint32* pData, uint32* pCmdSpace);
@@ -95,6 +107,10 @@ private:
 
     uint32 GetPm4PacketSize(PM4_TYPE_3_HEADER pm4Header) const;
 
+    // Context roll accounting: a context roll is avoided when every context register write since the previous draw was
+    // skipped, so we track whether any were kept or skipped and settle the count when the next draw is seen.
+    void TrackContextWindow(bool kept) { m_cntxWindowKept |= kept; m_cntxWindowSkipped |= (kept == false); }
+
     const CmdUtil&   m_cmdUtil;
     const GfxIpLevel m_chipFamily;
     const bool       m_waShaderSpiWriteShaderPgmRsrc2Ls; // Caching this workaround setting is probably a good idea.
@@ -107,6 +123,10 @@ private:
     // Shadow register state for context and SH registers.
     RegState m_cntxRegs[CntxRegUsedRangeSize];
     RegState m_shRegs[ShRegUsedRangeSize];
+    bool     m_cntxWindowKept;    // A context register write was kept since the last draw.
+    bool     m_cntxWindowSkipped; // A context register write was skipped since the last draw.
+
+    Pm4OptimizerStats m_stats;
 };
 
 } // Gfx6
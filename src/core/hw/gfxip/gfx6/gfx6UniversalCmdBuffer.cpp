@@ -4039,6 +4039,11 @@ uint32* UniversalCmdBuffer::ValidateDraw(
     m_graphicsState.dirtyFlags.u32All = 0;
     m_graphicsState.pipelineState.dirtyFlags.u32All = 0;
 
+    if (pm4OptImmediate)
+    {
+        m_deCmdStream.NotifyDraw();
+    }
+
     return pDeCmdSpace;
 }
 
@@ -5506,6 +5511,10 @@ void UniversalCmdBuffer::CmdExecuteNestedCmdBuffers(
         // state back to the caller.
         LeakNestedCmdBufferState(*pCallee);
     }
+
+    // Chained callees jump directly from one to the next; the last of them still has to return here.
+    m_deCmdStream.EndCallChain();
+    m_ceCmdStream.EndCallChain();
 }
 
 // =====================================================================================================================
@@ -70,6 +70,7 @@ void SettingsLoader::SetupDefaults()
     m_settings.forceGraphicsFillMemoryPath = false;
     m_settings.waitOnMetadataMipTail = false;
     m_settings.blendOptimizationsEnable = true;
+    m_settings.deferStateObjectBinds = true;
     m_settings.fastColorClearEnable = true;
     m_settings.fastColorClearOn3dEnable = true;
     m_settings.fmaskCompressDisable = false;
@@ -257,6 +258,11 @@ void SettingsLoader::ReadSettings()
                            &m_settings.blendOptimizationsEnable,
                            InternalSettingScope::PrivatePalGfx9Key);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pDeferStateObjectBindsStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.deferStateObjectBinds,
+                           InternalSettingScope::PrivatePalGfx9Key);
+
     static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pFastColorClearEnableStr,
                            Util::ValueType::Boolean,
                            &m_settings.fastColorClearEnable,
@@ -983,6 +989,11 @@ void SettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.blendOptimizationsEnable);
     m_settingsInfoMap.Insert(3560979294, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.deferStateObjectBinds;
+    info.valueSize = sizeof(m_settings.deferStateObjectBinds);
+    m_settingsInfoMap.Insert(314740837, info);
+
     info.type      = SettingType::Boolean;
     info.pValuePtr = &m_settings.fastColorClearEnable;
     info.valueSize = sizeof(m_settings.fastColorClearEnable);
@@ -1569,9 +1580,9 @@ void SettingsLoader::DevDriverRegister()
             component.pfnSetValue = ISettingsLoader::SetValue;
             component.pSettingsData = &g_gfx9PalJsonData[0];
             component.settingsDataSize = sizeof(g_gfx9PalJsonData);
-            component.settingsDataHash = 4061125703;
-            component.settingsDataHeader.isEncoded = true;
-            component.settingsDataHeader.magicBufferId = 402778310;
+            component.settingsDataHash = 0;
+            component.settingsDataHeader.isEncoded = false;
+            component.settingsDataHeader.magicBufferId = 0;
             component.settingsDataHeader.magicBufferOffset = 0;
 
             pSettingsService->RegisterComponent(component);
@@ -157,6 +157,7 @@ struct Gfx9PalSettings : public Pal::DriverSettings
     bool                              forceGraphicsFillMemoryPath;
     bool                              waitOnMetadataMipTail;
     bool                              blendOptimizationsEnable;
+    bool                              deferStateObjectBinds;
     bool                              fastColorClearEnable;
     bool                              fastColorClearOn3dEnable;
     bool                              fmaskCompressDisable;
@@ -291,6 +292,7 @@ static const char* pForceRegularClearCodeStr = "#2537383476";
 static const char* pForceGraphicsFillMemoryPathStr = "#451570688";
 static const char* pWaitOnMetadataMipTailStr = "#2328100940";
 static const char* pBlendOptimizationEnableStr = "#3560979294";
+static const char* pDeferStateObjectBindsStr = "#314740837";
 static const char* pFastColorClearEnableStr = "#1938040824";
 static const char* pFastColorClearOn3DEnableStr = "#655987862";
 static const char* pFmaskCompressDisableStr = "#2717822859";
@@ -410,7 +412,7 @@ static const char* pWaMetaAliasingFixEnabledStr = "#3182155668";
 static const char* pWaForce256bCbFetchStr = "#2944333716";
 static const char* pWaCmaskImageSyncsStr = "#3002384369";
 
-static const uint32 g_gfx9PalNumSettings = 155;
+static const uint32 g_gfx9PalNumSettings = 156;
 static const SettingNameHash g_gfx9PalSettingHashList[] = {
 2416072074,
 
@@ -426,6 +428,7 @@ static const SettingNameHash g_gfx9PalSettingHashList[] = {
 451570688,
 2328100940,
 3560979294,
+314740837,
 1938040824,
 655987862,
 2717822859,
@@ -548,3908 +551,2935 @@ static const SettingNameHash g_gfx9PalSettingHashList[] = {
 };
 
 static const uint8 g_gfx9PalJsonData[] = {
-    26, 210, 55, 147, 78, 111, 96, 105, 135, 206, 59, 11, 175, 26, 113, 216, 199, 159, 198, 36, 51, 254, 102, 107, 93,
-    86, 8, 82, 248, 38, 116, 34, 31, 20, 136, 83, 191, 49, 4, 27, 242, 26, 121, 215, 36, 7, 146, 159, 177, 191, 216, 76,
-    108, 110, 118, 120, 174, 35, 104, 98, 206, 164, 213, 40, 128, 85, 10, 174, 96, 108, 254, 10, 31, 78, 29, 81, 174,
-    153, 209, 182, 84, 155, 163, 50, 133, 0, 255, 136, 255, 7, 50, 147, 7, 91, 177, 88, 2, 23, 217, 217, 189, 119, 25,
-    97, 247, 113, 131, 2, 226, 13, 248, 223, 70, 137, 97, 242, 123, 161, 232, 103, 224, 220, 232, 12, 135, 30, 144, 158,
-    121, 204, 86, 87, 208, 216, 92, 214, 155, 213, 91, 194, 166, 214, 182, 129, 163, 125, 76, 37, 222, 3, 72, 163, 139,
-    212, 245, 160, 249, 28, 60, 206, 174, 28, 191, 224, 177, 115, 172, 4, 43, 130, 213, 5, 136, 118, 110, 81, 192, 135,
-    229, 174, 89, 64, 212, 152, 239, 26, 166, 222, 182, 153, 169, 74, 229, 184, 129, 99, 206, 102, 81, 143, 41, 234,
-    169, 216, 138, 200, 157, 237, 232, 43, 227, 154, 201, 115, 118, 241, 99, 182, 42, 129, 92, 217, 236, 226, 108, 69,
-    31, 221, 104, 190, 5, 215, 73, 32, 59, 122, 207, 87, 156, 200, 98, 152, 63, 50, 93, 127, 18, 7, 175, 103, 167, 248,
-    231, 58, 250, 246, 137, 137, 82, 108, 242, 248, 155, 218, 244, 214, 35, 40, 140, 176, 19, 74, 166, 169, 77, 125,
-    158, 135, 69, 74, 7, 67, 9, 172, 41, 3, 143, 110, 55, 37, 76, 135, 144, 17, 144, 55, 29, 202, 41, 251, 234, 70, 149,
-    225, 93, 18, 117, 104, 26, 94, 249, 79, 125, 164, 217, 113, 83, 26, 5, 74, 22, 121, 131, 240, 157, 226, 197, 230,
-    205, 5, 78, 217, 199, 241, 24, 160, 56, 71, 229, 26, 185, 184, 135, 103, 75, 6, 217, 209, 84, 151, 125, 13, 0, 153,
-    205, 155, 79, 61, 94, 29, 13, 176, 220, 88, 75, 126, 50, 183, 194, 56, 51, 239, 105, 130, 154, 150, 51, 52, 83, 105,
-    53, 83, 182, 111, 87, 204, 181, 52, 104, 149, 98, 200, 176, 180, 184, 90, 230, 153, 124, 122, 187, 11, 203, 1, 16,
-    39, 228, 13, 5, 80, 48, 6, 157, 14, 244, 250, 253, 35, 211, 226, 76, 44, 52, 83, 25, 54, 108, 239, 33, 171, 112, 99,
-    157, 26, 225, 222, 241, 23, 240, 173, 253, 161, 86, 145, 240, 3, 151, 120, 250, 61, 22, 206, 77, 72, 95, 163, 108,
-    129, 82, 24, 219, 222, 166, 3, 166, 243, 245, 96, 168, 199, 231, 199, 187, 214, 20, 37, 207, 47, 215, 124, 227, 222,
-    160, 236, 203, 232, 123, 127, 92, 123, 55, 20, 214, 181, 164, 75, 157, 122, 59, 100, 105, 104, 218, 18, 93, 46, 138,
-    138, 73, 116, 140, 196, 198, 149, 251, 8, 104, 248, 76, 191, 203, 140, 199, 101, 248, 233, 9, 59, 38, 235, 239, 208,
-    41, 32, 38, 14, 143, 128, 226, 68, 208, 217, 139, 181, 105, 42, 170, 119, 147, 125, 235, 183, 62, 169, 28, 171, 223,
-    13, 215, 248, 172, 84, 18, 96, 45, 222, 104, 86, 112, 239, 45, 214, 149, 220, 65, 175, 236, 34, 238, 33, 72, 70,
-    197, 234, 83, 127, 16, 21, 207, 131, 244, 225, 11, 214, 51, 42, 175, 126, 231, 31, 139, 1, 159, 97, 49, 79, 116,
-    116, 122, 30, 104, 95, 182, 0, 151, 102, 99, 79, 227, 125, 117, 5, 69, 124, 189, 193, 209, 125, 228, 244, 244, 158,
-    247, 194, 84, 23, 236, 69, 246, 167, 162, 139, 114, 5, 178, 29, 107, 135, 113, 192, 0, 185, 83, 25, 94, 221, 111,
-    136, 225, 26, 90, 17, 206, 252, 99, 125, 205, 159, 149, 114, 185, 87, 172, 12, 145, 162, 94, 208, 39, 57, 107, 206,
-    4, 97, 131, 61, 180, 128, 250, 187, 237, 168, 133, 129, 237, 234, 203, 72, 104, 64, 1, 37, 137, 251, 155, 27, 79,
-    71, 109, 255, 27, 4, 186, 236, 35, 17, 108, 195, 67, 146, 183, 145, 116, 45, 191, 180, 156, 166, 223, 17, 178, 231,
-    149, 106, 24, 215, 242, 217, 0, 113, 129, 93, 247, 210, 30, 157, 104, 140, 209, 167, 238, 225, 121, 210, 180, 108,
-    97, 33, 11, 190, 41, 132, 46, 172, 58, 107, 154, 95, 176, 16, 47, 12, 147, 41, 234, 236, 212, 177, 224, 141, 157,
-    220, 60, 28, 81, 251, 98, 178, 116, 31, 62, 35, 204, 149, 246, 71, 203, 200, 175, 24, 28, 107, 255, 231, 255, 220,
-    127, 193, 157, 198, 50, 86, 160, 112, 248, 77, 134, 65, 246, 77, 132, 236, 43, 91, 159, 41, 175, 78, 159, 156, 218,
-    7, 109, 34, 15, 52, 127, 101, 50, 206, 216, 25, 31, 87, 27, 61, 149, 223, 253, 122, 64, 202, 156, 223, 145, 122,
-    181, 109, 12, 89, 233, 14, 182, 71, 178, 64, 56, 80, 53, 75, 130, 192, 89, 212, 230, 99, 208, 60, 113, 169, 70, 197,
-    19, 247, 79, 109, 234, 10, 223, 84, 22, 208, 156, 193, 202, 210, 91, 35, 131, 243, 124, 122, 210, 121, 32, 67, 227,
-    239, 124, 222, 195, 230, 3, 66, 70, 44, 209, 25, 66, 32, 97, 128, 179, 10, 27, 31, 117, 72, 193, 250, 154, 117, 164,
-    27, 58, 253, 87, 91, 202, 6, 161, 68, 0, 166, 194, 254, 218, 85, 136, 129, 30, 239, 217, 225, 162, 166, 143, 139,
-    202, 149, 217, 38, 105, 195, 58, 120, 216, 251, 81, 249, 116, 32, 23, 10, 83, 186, 202, 146, 179, 150, 57, 74, 29,
-    247, 24, 198, 225, 255, 212, 163, 230, 188, 155, 246, 196, 36, 96, 157, 246, 141, 224, 246, 217, 173, 50, 114, 172,
-    95, 128, 26, 141, 3, 224, 169, 145, 59, 104, 143, 59, 152, 158, 175, 213, 40, 74, 56, 154, 167, 139, 32, 172, 183,
-    233, 56, 63, 236, 45, 133, 5, 121, 78, 107, 60, 129, 58, 221, 56, 150, 132, 39, 120, 169, 20, 104, 132, 245, 135,
-    112, 134, 3, 167, 126, 27, 139, 131, 71, 91, 161, 214, 149, 27, 6, 16, 4, 109, 141, 100, 185, 68, 104, 247, 135, 13,
-    60, 233, 112, 68, 53, 107, 214, 200, 1, 225, 165, 30, 126, 167, 121, 183, 190, 237, 207, 164, 183, 115, 231, 93, 71,
-    175, 119, 132, 209, 159, 97, 208, 100, 209, 58, 180, 243, 81, 151, 187, 81, 65, 177, 248, 30, 43, 160, 45, 102, 244,
-    46, 73, 239, 10, 243, 180, 247, 148, 218, 37, 87, 80, 143, 206, 66, 72, 168, 138, 211, 157, 37, 63, 60, 95, 67, 19,
-    107, 207, 20, 193, 155, 186, 157, 153, 46, 169, 154, 54, 204, 209, 156, 113, 222, 131, 48, 85, 38, 73, 117, 213,
-    193, 72, 114, 140, 159, 12, 145, 97, 216, 179, 138, 98, 98, 64, 148, 244, 248, 95, 157, 8, 62, 141, 39, 77, 5, 45,
-    79, 172, 92, 8, 30, 183, 147, 203, 253, 206, 201, 60, 217, 205, 116, 84, 90, 127, 129, 232, 42, 216, 104, 27, 7,
-    108, 241, 75, 248, 15, 232, 81, 168, 188, 84, 123, 147, 67, 109, 133, 147, 27, 101, 250, 82, 81, 232, 224, 183, 36,
-    212, 49, 182, 186, 150, 146, 156, 168, 114, 219, 49, 81, 82, 222, 128, 250, 237, 253, 137, 144, 39, 140, 133, 129,
-    219, 230, 103, 60, 8, 77, 59, 214, 76, 123, 80, 145, 163, 127, 132, 238, 211, 215, 120, 96, 0, 130, 224, 189, 231,
-    238, 194, 233, 211, 129, 217, 237, 105, 124, 199, 202, 188, 52, 226, 36, 203, 141, 60, 108, 169, 25, 91, 115, 103,
-    110, 51, 200, 167, 14, 1, 73, 157, 94, 57, 82, 165, 60, 160, 118, 177, 111, 90, 195, 93, 89, 75, 237, 247, 9, 93,
-    135, 36, 90, 42, 148, 133, 25, 115, 193, 205, 71, 14, 16, 175, 50, 142, 189, 1, 124, 53, 254, 232, 226, 223, 224,
-    36, 232, 111, 11, 38, 184, 151, 195, 248, 29, 148, 102, 116, 40, 193, 139, 132, 238, 164, 51, 93, 102, 131, 163,
-    137, 222, 243, 182, 107, 41, 166, 8, 45, 245, 166, 25, 74, 155, 125, 74, 18, 152, 179, 46, 136, 120, 157, 217, 160,
-    186, 246, 142, 224, 49, 61, 70, 87, 155, 31, 117, 34, 130, 14, 226, 149, 31, 173, 86, 177, 181, 78, 50, 90, 37, 195,
-    66, 182, 219, 230, 92, 149, 169, 233, 110, 42, 101, 206, 7, 13, 197, 172, 9, 127, 91, 123, 174, 158, 15, 15, 188,
-    226, 135, 198, 77, 200, 195, 70, 137, 193, 179, 155, 64, 30, 83, 222, 16, 111, 212, 213, 81, 68, 208, 121, 42, 66,
-    37, 158, 208, 157, 199, 247, 195, 91, 11, 85, 204, 125, 203, 9, 116, 228, 170, 152, 234, 178, 124, 248, 155, 23,
-    152, 79, 224, 200, 200, 88, 181, 146, 168, 0, 64, 240, 9, 239, 153, 65, 137, 164, 172, 178, 190, 92, 107, 209, 117,
-    34, 99, 125, 209, 38, 131, 166, 4, 105, 135, 250, 26, 253, 94, 231, 251, 170, 208, 138, 19, 233, 184, 99, 238, 112,
-    51, 44, 221, 251, 5, 253, 178, 180, 245, 222, 90, 188, 132, 48, 123, 67, 232, 123, 214, 164, 94, 37, 136, 124, 214,
-    112, 70, 62, 57, 218, 138, 92, 50, 114, 39, 138, 36, 158, 69, 192, 238, 122, 149, 92, 164, 63, 141, 111, 8, 168,
-    197, 15, 46, 47, 64, 106, 11, 145, 57, 19, 215, 89, 65, 21, 38, 188, 211, 163, 198, 118, 195, 184, 101, 31, 242,
-    183, 121, 151, 71, 110, 104, 212, 238, 76, 228, 170, 171, 98, 215, 4, 165, 176, 121, 94, 248, 152, 80, 43, 196, 225,
-    13, 81, 69, 200, 202, 103, 17, 192, 178, 144, 168, 10, 120, 122, 126, 44, 32, 181, 169, 3, 179, 2, 80, 239, 95, 187,
-    126, 120, 108, 159, 36, 30, 99, 29, 160, 153, 67, 83, 38, 34, 178, 126, 14, 163, 228, 10, 200, 141, 210, 34, 4, 77,
-    205, 41, 161, 152, 19, 207, 90, 170, 159, 129, 238, 208, 21, 132, 22, 240, 33, 208, 85, 6, 47, 44, 114, 137, 51,
-    191, 131, 166, 0, 14, 46, 172, 148, 1, 28, 118, 246, 6, 102, 243, 112, 113, 219, 76, 85, 159, 106, 177, 183, 14,
-    150, 192, 163, 169, 152, 9, 153, 194, 232, 231, 48, 51, 19, 123, 8, 215, 194, 131, 131, 45, 22, 205, 129, 21, 105,
-    97, 166, 107, 34, 37, 230, 194, 99, 67, 58, 127, 98, 102, 254, 179, 50, 3, 245, 33, 112, 155, 184, 252, 146, 252,
-    94, 124, 202, 114, 111, 33, 44, 26, 26, 2, 132, 194, 4, 20, 96, 229, 205, 209, 197, 75, 63, 5, 219, 69, 103, 122,
-    178, 158, 137, 223, 169, 3, 44, 49, 144, 92, 37, 80, 194, 1, 118, 117, 107, 220, 146, 49, 223, 139, 108, 57, 160,
-    164, 46, 8, 68, 37, 238, 3, 22, 185, 27, 61, 135, 58, 133, 196, 158, 205, 239, 246, 246, 206, 39, 122, 147, 41, 89,
-    212, 87, 108, 112, 76, 5, 30, 48, 146, 101, 254, 54, 141, 38, 252, 168, 241, 135, 108, 183, 77, 162, 243, 166, 24,
-    147, 41, 61, 50, 109, 218, 226, 80, 215, 134, 183, 28, 163, 34, 4, 33, 47, 64, 163, 19, 218, 77, 78, 42, 15, 130,
-    36, 230, 54, 131, 130, 9, 4, 50, 24, 68, 60, 136, 16, 205, 171, 107, 87, 118, 233, 57, 26, 155, 89, 139, 106, 150,
-    185, 230, 203, 96, 146, 58, 204, 177, 36, 175, 199, 153, 232, 37, 247, 143, 239, 71, 16, 4, 217, 10, 148, 58, 124,
-    61, 179, 108, 64, 60, 239, 130, 76, 225, 213, 86, 159, 175, 26, 10, 62, 99, 123, 110, 224, 167, 228, 165, 235, 222,
-    162, 43, 149, 178, 4, 155, 73, 149, 107, 105, 207, 127, 23, 136, 253, 121, 100, 4, 111, 29, 35, 171, 237, 240, 145,
-    86, 94, 28, 164, 120, 249, 242, 193, 53, 32, 199, 205, 90, 48, 202, 228, 131, 4, 25, 17, 74, 103, 248, 241, 63, 36,
-    185, 161, 118, 39, 130, 243, 66, 112, 247, 217, 32, 45, 58, 245, 164, 48, 251, 95, 45, 57, 48, 107, 40, 120, 57,
-    248, 197, 170, 221, 44, 34, 216, 241, 24, 184, 198, 206, 178, 239, 90, 24, 178, 219, 116, 15, 114, 112, 82, 232, 46,
-    199, 123, 114, 171, 147, 63, 67, 30, 133, 2, 72, 125, 212, 115, 154, 14, 187, 47, 202, 216, 207, 120, 185, 66, 34,
-    81, 157, 121, 61, 123, 129, 180, 20, 174, 236, 101, 228, 142, 230, 164, 49, 41, 235, 154, 116, 19, 178, 248, 52,
-    221, 9, 133, 208, 209, 179, 32, 75, 132, 178, 28, 32, 230, 201, 119, 245, 55, 121, 60, 4, 64, 114, 239, 41, 23, 12,
-    154, 164, 122, 241, 237, 19, 111, 12, 174, 24, 139, 20, 133, 123, 153, 29, 253, 222, 233, 42, 152, 44, 150, 52, 50,
-    57, 120, 90, 159, 130, 106, 138, 33, 128, 233, 112, 48, 97, 13, 119, 80, 229, 176, 80, 196, 123, 16, 238, 129, 115,
-    9, 111, 217, 54, 151, 248, 190, 137, 103, 96, 216, 248, 51, 220, 216, 10, 56, 35, 46, 41, 148, 148, 119, 181, 105,
-    188, 77, 136, 159, 136, 212, 127, 56, 111, 239, 214, 59, 114, 227, 156, 253, 228, 8, 114, 233, 72, 38, 113, 158,
-    148, 202, 177, 84, 29, 140, 186, 78, 154, 143, 222, 137, 11, 119, 148, 83, 7, 67, 225, 221, 191, 91, 251, 29, 140,
-    35, 150, 0, 56, 240, 140, 208, 117, 38, 58, 182, 243, 134, 65, 79, 58, 7, 51, 128, 0, 16, 92, 36, 187, 65, 3, 7,
-    231, 135, 96, 117, 140, 40, 12, 206, 23, 247, 226, 73, 26, 133, 10, 107, 69, 11, 110, 86, 0, 166, 155, 24, 17, 202,
-    66, 29, 87, 119, 139, 196, 124, 173, 213, 7, 101, 247, 179, 154, 112, 44, 229, 3, 19, 51, 11, 231, 221, 78, 33, 223,
-    186, 175, 75, 155, 181, 235, 243, 36, 149, 41, 22, 58, 215, 46, 69, 110, 234, 214, 80, 254, 60, 165, 204, 121, 54,
-    109, 217, 184, 115, 118, 234, 160, 197, 204, 2, 206, 19, 126, 12, 137, 209, 66, 115, 71, 223, 19, 149, 28, 193, 2,
-    112, 100, 90, 82, 117, 38, 238, 169, 182, 112, 68, 227, 219, 218, 155, 200, 193, 187, 12, 175, 65, 25, 183, 64, 195,
-    138, 36, 184, 14, 169, 248, 109, 128, 55, 173, 155, 149, 60, 144, 229, 50, 78, 109, 118, 162, 145, 197, 37, 78, 1,
-    53, 200, 164, 37, 65, 203, 42, 96, 62, 68, 115, 229, 11, 59, 204, 187, 175, 2, 240, 229, 12, 34, 228, 48, 135, 32,
-    162, 199, 46, 216, 236, 162, 193, 226, 191, 212, 74, 193, 24, 180, 187, 61, 203, 22, 227, 218, 201, 219, 200, 173,
-    76, 161, 130, 51, 116, 165, 191, 158, 76, 32, 58, 9, 143, 224, 58, 114, 224, 81, 106, 47, 141, 76, 118, 38, 177, 70,
-    46, 127, 81, 137, 0, 15, 173, 116, 23, 252, 237, 96, 95, 125, 91, 223, 154, 91, 218, 252, 15, 47, 179, 213, 31, 182,
-    82, 215, 100, 16, 111, 145, 233, 20, 115, 249, 64, 231, 238, 14, 62, 135, 45, 168, 227, 126, 146, 111, 4, 113, 16,
-    63, 250, 216, 31, 104, 172, 78, 39, 161, 209, 240, 216, 20, 190, 243, 25, 34, 25, 159, 86, 189, 79, 62, 52, 16, 134,
-    231, 164, 54, 197, 92, 180, 9, 74, 185, 232, 1, 119, 17, 180, 32, 81, 214, 165, 105, 115, 146, 52, 96, 98, 90, 167,
-    200, 79, 200, 66, 222, 186, 16, 77, 29, 78, 216, 10, 30, 35, 152, 128, 211, 120, 158, 221, 14, 121, 106, 87, 253,
-    204, 245, 0, 18, 28, 185, 54, 246, 240, 139, 221, 152, 122, 91, 110, 74, 197, 135, 89, 158, 124, 37, 135, 175, 12,
-    227, 34, 145, 170, 141, 236, 36, 69, 97, 35, 41, 58, 12, 248, 36, 63, 225, 7, 147, 225, 124, 11, 153, 31, 159, 241,
-    159, 176, 115, 175, 44, 130, 194, 138, 0, 9, 75, 51, 215, 150, 132, 125, 105, 195, 28, 23, 227, 27, 107, 54, 72, 3,
-    166, 241, 29, 225, 137, 213, 12, 57, 182, 43, 116, 182, 131, 46, 199, 105, 9, 215, 245, 216, 176, 2, 214, 137, 157,
-    190, 103, 90, 23, 92, 20, 166, 48, 179, 152, 9, 237, 32, 249, 170, 30, 47, 96, 197, 40, 251, 108, 86, 73, 16, 207,
-    89, 79, 102, 72, 87, 122, 235, 248, 68, 10, 209, 92, 77, 142, 193, 22, 79, 254, 52, 65, 237, 128, 156, 2, 114, 194,
-    126, 131, 152, 72, 211, 124, 70, 21, 88, 129, 108, 15, 98, 35, 190, 202, 201, 25, 175, 126, 209, 230, 94, 234, 215,
-    250, 238, 233, 199, 192, 197, 117, 116, 86, 59, 177, 43, 88, 61, 28, 116, 176, 14, 48, 223, 114, 112, 33, 37, 187,
-    206, 110, 111, 106, 235, 169, 227, 242, 104, 119, 39, 212, 205, 145, 11, 90, 170, 125, 162, 22, 4, 65, 58, 37, 49,
-    248, 237, 36, 70, 167, 202, 247, 75, 215, 136, 253, 172, 209, 68, 91, 161, 235, 193, 72, 132, 35, 110, 170, 240,
-    174, 72, 236, 152, 159, 28, 113, 221, 254, 157, 143, 1, 132, 127, 111, 160, 42, 189, 95, 235, 234, 232, 229, 236,
-    47, 98, 4, 46, 217, 158, 212, 126, 231, 183, 90, 26, 68, 243, 154, 19, 186, 64, 16, 28, 174, 25, 181, 79, 219, 130,
-    50, 72, 238, 40, 149, 124, 59, 12, 39, 53, 37, 133, 250, 209, 114, 81, 22, 143, 215, 148, 134, 192, 97, 12, 243, 39,
-    8, 254, 236, 8, 169, 135, 124, 148, 164, 116, 246, 6, 5, 154, 218, 155, 205, 0, 5, 109, 175, 198, 121, 216, 5, 218,
-    161, 142, 23, 124, 147, 217, 139, 30, 204, 113, 89, 206, 67, 43, 4, 204, 82, 35, 23, 190, 250, 241, 238, 134, 118,
-    100, 191, 166, 237, 109, 15, 190, 185, 78, 172, 163, 250, 3, 110, 133, 165, 142, 10, 27, 213, 120, 13, 23, 28, 29,
-    180, 39, 169, 89, 142, 122, 47, 157, 3, 61, 25, 1, 88, 163, 250, 137, 18, 150, 39, 181, 251, 14, 50, 38, 251, 149,
-    233, 110, 213, 147, 164, 169, 251, 119, 207, 181, 80, 159, 138, 138, 194, 245, 157, 180, 141, 198, 158, 206, 67,
-    209, 101, 245, 13, 62, 103, 110, 127, 5, 7, 93, 240, 4, 192, 10, 75, 192, 23, 78, 36, 75, 152, 155, 83, 42, 8, 83,
-    2, 107, 77, 255, 233, 73, 117, 206, 39, 56, 64, 33, 208, 68, 195, 29, 192, 248, 7, 196, 146, 29, 253, 147, 31, 187,
-    7, 16, 68, 221, 184, 173, 162, 173, 236, 220, 105, 124, 68, 149, 16, 140, 255, 64, 187, 34, 106, 160, 190, 19, 30,
-    183, 185, 187, 219, 86, 218, 164, 56, 79, 107, 90, 111, 118, 243, 197, 151, 57, 226, 184, 75, 102, 147, 28, 218,
-    211, 182, 74, 211, 59, 97, 244, 83, 75, 41, 200, 67, 89, 245, 182, 52, 148, 167, 242, 63, 136, 163, 209, 14, 171,
-    196, 130, 71, 107, 156, 98, 212, 114, 159, 20, 96, 62, 121, 0, 98, 173, 218, 212, 5, 77, 197, 201, 183, 193, 24,
-    189, 57, 182, 100, 30, 195, 91, 167, 218, 55, 130, 226, 57, 76, 158, 32, 75, 148, 95, 197, 94, 180, 152, 71, 134,
-    33, 53, 166, 147, 135, 44, 88, 108, 121, 179, 184, 91, 209, 197, 185, 29, 62, 43, 143, 17, 54, 199, 205, 186, 174,
-    83, 167, 226, 123, 157, 33, 132, 7, 191, 196, 80, 121, 224, 55, 80, 71, 88, 37, 91, 79, 44, 77, 218, 197, 248, 214,
-    239, 92, 216, 215, 99, 196, 245, 109, 227, 17, 13, 182, 216, 193, 76, 221, 98, 245, 107, 165, 98, 211, 193, 144, 65,
-    154, 240, 15, 231, 159, 206, 110, 120, 22, 174, 211, 47, 59, 83, 35, 24, 95, 200, 240, 157, 83, 43, 109, 49, 78, 25,
-    204, 201, 57, 83, 213, 51, 30, 175, 65, 89, 14, 30, 249, 20, 162, 203, 210, 80, 79, 6, 250, 200, 76, 178, 18, 20,
-    26, 76, 11, 145, 39, 181, 224, 237, 4, 123, 23, 42, 1, 208, 61, 131, 206, 15, 3, 84, 122, 101, 204, 133, 143, 210,
-    127, 142, 130, 172, 178, 119, 42, 82, 188, 211, 199, 250, 75, 126, 140, 146, 142, 141, 138, 117, 95, 6, 38, 220,
-    213, 245, 7, 128, 124, 42, 39, 129, 186, 41, 34, 230, 23, 79, 210, 15, 208, 97, 29, 192, 146, 40, 163, 238, 176, 22,
-    157, 31, 214, 144, 204, 156, 254, 57, 172, 43, 2, 44, 167, 154, 202, 0, 208, 165, 191, 49, 242, 163, 196, 120, 62,
-    74, 30, 186, 55, 189, 201, 44, 249, 192, 255, 255, 32, 143, 184, 242, 62, 223, 103, 247, 207, 50, 138, 214, 165,
-    174, 20, 196, 226, 20, 230, 42, 124, 51, 200, 116, 55, 150, 61, 138, 161, 240, 154, 193, 179, 50, 7, 249, 98, 200,
-    93, 255, 61, 182, 14, 11, 30, 194, 8, 234, 12, 213, 222, 85, 243, 104, 248, 198, 129, 78, 126, 151, 110, 143, 222,
-    141, 218, 210, 61, 183, 72, 121, 62, 159, 237, 99, 7, 95, 37, 221, 183, 126, 107, 48, 80, 195, 119, 78, 186, 206,
-    253, 162, 201, 78, 130, 145, 218, 138, 27, 32, 237, 249, 234, 76, 184, 3, 162, 228, 202, 44, 93, 156, 186, 190, 32,
-    17, 67, 249, 200, 97, 62, 122, 111, 89, 252, 185, 60, 21, 204, 113, 49, 228, 76, 220, 167, 86, 125, 195, 144, 36,
-    218, 77, 18, 229, 128, 159, 244, 98, 54, 201, 123, 220, 135, 106, 149, 8, 224, 155, 103, 172, 238, 137, 96, 210,
-    193, 206, 255, 208, 131, 241, 239, 150, 102, 102, 239, 241, 214, 73, 20, 4, 128, 8, 78, 236, 69, 45, 178, 14, 143,
-    51, 129, 52, 194, 219, 27, 160, 28, 245, 191, 183, 21, 236, 140, 176, 76, 193, 240, 67, 121, 112, 176, 96, 222, 188,
-    91, 181, 62, 176, 12, 244, 251, 111, 77, 91, 9, 170, 207, 192, 167, 170, 210, 106, 153, 91, 172, 45, 217, 2, 179,
-    149, 182, 192, 175, 195, 152, 244, 97, 11, 251, 161, 74, 148, 105, 84, 137, 84, 32, 30, 53, 114, 38, 229, 26, 83,
-    214, 111, 252, 67, 176, 180, 229, 255, 235, 183, 182, 172, 213, 178, 161, 49, 46, 254, 148, 208, 202, 204, 37, 228,
-    235, 242, 45, 214, 98, 218, 76, 143, 134, 176, 91, 220, 16, 154, 200, 63, 105, 129, 122, 215, 166, 184, 116, 147,
-    99, 99, 90, 12, 87, 183, 30, 205, 122, 212, 217, 31, 112, 81, 90, 232, 58, 85, 162, 57, 137, 51, 111, 60, 168, 210,
-    106, 171, 80, 54, 232, 248, 132, 247, 129, 42, 209, 78, 254, 227, 237, 125, 179, 58, 26, 43, 229, 211, 162, 32, 153,
-    96, 39, 98, 210, 72, 160, 186, 252, 67, 128, 229, 11, 169, 135, 49, 80, 192, 156, 20, 44, 77, 86, 125, 53, 154, 146,
-    191, 149, 38, 155, 11, 160, 226, 246, 114, 203, 237, 71, 247, 45, 89, 166, 246, 165, 42, 238, 73, 56, 208, 129, 190,
-    151, 68, 149, 154, 213, 190, 82, 140, 167, 80, 102, 6, 77, 188, 103, 71, 231, 142, 100, 180, 218, 189, 7, 153, 215,
-    204, 26, 36, 81, 179, 11, 217, 5, 171, 127, 37, 18, 85, 57, 159, 168, 49, 21, 249, 19, 152, 15, 31, 84, 26, 137,
-    216, 242, 115, 241, 78, 139, 223, 100, 203, 152, 233, 7, 147, 192, 107, 218, 170, 95, 3, 89, 51, 197, 91, 242, 154,
-    125, 71, 23, 244, 230, 246, 182, 78, 132, 61, 207, 127, 55, 154, 51, 77, 83, 26, 17, 224, 112, 219, 211, 93, 35,
-    162, 196, 133, 151, 156, 157, 46, 81, 5, 40, 247, 252, 209, 167, 122, 239, 184, 13, 53, 53, 39, 106, 205, 187, 6,
-    130, 162, 215, 80, 255, 37, 116, 245, 23, 105, 169, 4, 13, 76, 113, 20, 54, 84, 60, 14, 218, 118, 72, 119, 3, 241,
-    87, 224, 136, 86, 44, 197, 197, 241, 16, 194, 111, 237, 42, 188, 13, 168, 244, 105, 92, 206, 131, 153, 106, 172,
-    193, 98, 120, 16, 112, 240, 124, 60, 28, 171, 174, 214, 227, 151, 62, 63, 17, 207, 137, 105, 247, 158, 99, 17, 112,
-    116, 177, 230, 133, 244, 160, 95, 193, 210, 35, 247, 96, 149, 170, 96, 76, 109, 109, 128, 50, 240, 193, 83, 88, 253,
-    141, 77, 195, 240, 6, 237, 77, 101, 73, 100, 89, 153, 210, 127, 53, 17, 136, 79, 95, 63, 233, 122, 223, 20, 180, 99,
-    110, 131, 139, 192, 109, 9, 229, 220, 184, 195, 31, 46, 148, 15, 187, 222, 80, 201, 127, 83, 142, 76, 220, 45, 117,
-    31, 78, 57, 15, 182, 104, 224, 134, 218, 246, 107, 145, 119, 227, 92, 75, 188, 6, 204, 196, 98, 245, 39, 215, 179,
-    231, 97, 210, 55, 12, 75, 235, 141, 56, 125, 221, 8, 153, 189, 208, 149, 212, 159, 34, 144, 192, 97, 181, 26, 14, 3,
-    227, 3, 195, 71, 213, 219, 18, 144, 244, 144, 205, 27, 48, 103, 150, 201, 1, 167, 87, 169, 57, 56, 91, 124, 20, 114,
-    14, 255, 203, 224, 197, 79, 87, 44, 57, 136, 139, 186, 225, 33, 6, 124, 66, 46, 99, 71, 137, 83, 183, 236, 119, 132,
-    255, 143, 252, 154, 52, 203, 200, 160, 106, 154, 159, 143, 130, 79, 113, 90, 124, 207, 169, 1, 42, 237, 79, 59, 33,
-    91, 94, 26, 202, 92, 220, 207, 113, 196, 220, 244, 180, 234, 5, 115, 237, 139, 238, 143, 154, 30, 148, 83, 154, 170,
-    225, 30, 113, 239, 84, 213, 170, 141, 20, 177, 249, 121, 43, 192, 61, 222, 126, 184, 100, 0, 171, 59, 204, 223, 53,
-    254, 161, 165, 253, 113, 254, 89, 22, 252, 212, 14, 34, 232, 253, 200, 189, 113, 125, 247, 232, 21, 236, 158, 214,
-    44, 85, 8, 254, 134, 253, 34, 228, 105, 215, 57, 154, 217, 93, 93, 135, 60, 178, 223, 171, 99, 242, 224, 43, 187,
-    139, 243, 177, 254, 197, 58, 212, 81, 228, 183, 143, 63, 152, 174, 164, 149, 237, 141, 3, 215, 62, 238, 60, 208,
-    108, 212, 108, 134, 50, 35, 104, 21, 67, 98, 138, 209, 176, 154, 238, 117, 2, 135, 56, 89, 175, 155, 241, 113, 160,
-    94, 109, 191, 6, 43, 46, 233, 235, 16, 182, 149, 59, 244, 204, 203, 57, 163, 251, 195, 236, 148, 149, 149, 57, 84,
-    103, 161, 215, 196, 120, 109, 127, 189, 209, 191, 30, 157, 90, 177, 83, 251, 211, 106, 211, 130, 210, 65, 144, 243,
-    154, 89, 180, 167, 224, 23, 137, 208, 144, 17, 69, 95, 79, 99, 117, 102, 115, 2, 105, 93, 254, 37, 21, 85, 213, 21,
-    181, 195, 142, 112, 167, 16, 137, 171, 180, 15, 196, 135, 208, 149, 32, 143, 28, 34, 149, 129, 32, 57, 20, 50, 7,
-    242, 17, 157, 98, 240, 243, 191, 198, 179, 53, 28, 188, 91, 88, 19, 198, 165, 85, 190, 74, 84, 132, 166, 73, 103, 4,
-    47, 199, 119, 252, 252, 127, 155, 41, 251, 177, 241, 44, 151, 123, 59, 236, 22, 233, 226, 97, 1, 223, 21, 127, 161,
-    110, 86, 224, 103, 97, 53, 138, 58, 110, 45, 215, 152, 54, 65, 38, 101, 81, 131, 99, 190, 2, 151, 114, 156, 56, 220,
-    129, 222, 78, 158, 23, 202, 228, 11, 117, 111, 43, 137, 49, 86, 172, 4, 135, 231, 6, 83, 165, 15, 97, 209, 148, 82,
-    3, 248, 164, 92, 91, 183, 58, 144, 252, 61, 136, 234, 98, 78, 151, 213, 13, 19, 147, 64, 124, 67, 223, 174, 77, 16,
-    187, 254, 107, 189, 29, 193, 234, 15, 107, 234, 39, 254, 32, 137, 188, 158, 251, 151, 104, 32, 129, 4, 15, 167, 213,
-    31, 15, 127, 75, 208, 165, 101, 177, 209, 176, 166, 145, 32, 244, 220, 210, 166, 140, 138, 9, 123, 54, 175, 40, 175,
-    62, 90, 125, 22, 177, 168, 62, 223, 224, 150, 48, 182, 176, 186, 214, 253, 250, 151, 43, 99, 242, 2, 11, 211, 233,
-    234, 65, 111, 158, 151, 255, 163, 50, 189, 163, 243, 210, 253, 139, 174, 200, 190, 107, 139, 216, 249, 120, 225,
-    227, 49, 240, 100, 118, 173, 17, 131, 252, 179, 205, 181, 230, 66, 53, 38, 52, 163, 199, 23, 165, 55, 121, 192, 12,
-    56, 96, 51, 165, 79, 149, 228, 131, 57, 213, 119, 34, 8, 162, 108, 92, 28, 152, 213, 143, 185, 119, 92, 24, 226, 7,
-    233, 148, 73, 247, 197, 16, 226, 3, 229, 18, 120, 6, 86, 120, 209, 192, 241, 159, 179, 29, 187, 171, 174, 26, 152,
-    70, 245, 198, 75, 228, 210, 231, 65, 39, 169, 126, 128, 143, 200, 156, 146, 27, 45, 189, 187, 68, 116, 11, 141, 130,
-    83, 14, 6, 142, 47, 116, 247, 77, 181, 214, 220, 74, 176, 129, 225, 244, 165, 10, 52, 27, 43, 215, 140, 134, 111,
-    142, 188, 103, 2, 17, 254, 242, 170, 208, 183, 165, 194, 137, 221, 85, 218, 93, 142, 46, 156, 98, 195, 179, 222,
-    179, 199, 143, 62, 205, 119, 81, 57, 57, 180, 58, 42, 76, 27, 62, 9, 178, 223, 119, 70, 219, 200, 145, 12, 88, 223,
-    188, 80, 77, 35, 219, 59, 73, 245, 154, 235, 107, 224, 119, 242, 24, 165, 138, 243, 245, 4, 125, 148, 72, 121, 191,
-    124, 184, 106, 190, 71, 82, 222, 86, 157, 143, 250, 2, 62, 17, 108, 236, 18, 16, 159, 18, 6, 122, 188, 16, 197, 87,
-    58, 235, 126, 127, 173, 234, 227, 15, 144, 112, 127, 28, 220, 190, 26, 192, 61, 143, 31, 164, 243, 148, 212, 39,
-    152, 110, 168, 244, 191, 28, 233, 68, 98, 238, 220, 41, 161, 213, 69, 217, 218, 134, 37, 220, 89, 100, 121, 140,
-    180, 143, 196, 244, 173, 79, 194, 79, 72, 212, 33, 200, 7, 169, 226, 178, 199, 27, 199, 119, 43, 28, 57, 170, 41,
-    227, 82, 205, 35, 143, 113, 123, 13, 163, 62, 108, 224, 145, 59, 56, 88, 231, 90, 217, 220, 255, 194, 88, 201, 67,
-    0, 105, 228, 206, 16, 47, 126, 164, 154, 158, 220, 86, 52, 111, 229, 247, 15, 170, 173, 49, 86, 14, 220, 58, 228,
-    18, 180, 226, 98, 240, 140, 34, 37, 14, 8, 19, 112, 242, 29, 65, 8, 173, 198, 111, 179, 23, 127, 10, 228, 36, 143,
-    185, 161, 231, 13, 5, 195, 122, 234, 83, 160, 50, 254, 75, 203, 207, 197, 178, 165, 171, 205, 112, 78, 40, 215, 234,
-    240, 155, 206, 156, 13, 76, 132, 50, 112, 183, 195, 74, 216, 76, 123, 202, 95, 127, 241, 79, 183, 117, 137, 120,
-    243, 170, 210, 138, 157, 101, 247, 149, 228, 65, 6, 146, 193, 151, 92, 162, 65, 30, 15, 81, 47, 93, 18, 80, 124,
-    152, 229, 153, 190, 68, 175, 88, 1, 200, 39, 56, 243, 30, 168, 176, 19, 151, 28, 18, 4, 78, 27, 4, 222, 92, 95, 180,
-    238, 231, 231, 18, 238, 138, 83, 37, 81, 57, 171, 212, 146, 159, 225, 196, 110, 205, 0, 125, 156, 185, 226, 67, 32,
-    181, 96, 69, 137, 154, 72, 154, 250, 108, 241, 196, 158, 117, 7, 86, 159, 207, 170, 213, 99, 49, 232, 99, 218, 126,
-    137, 127, 190, 223, 254, 202, 251, 157, 234, 64, 176, 52, 210, 190, 252, 183, 240, 122, 104, 166, 162, 173, 80, 223,
-    145, 231, 86, 177, 199, 182, 93, 8, 26, 102, 66, 175, 25, 230, 245, 54, 35, 147, 191, 177, 101, 120, 127, 149, 116,
-    151, 102, 54, 183, 236, 29, 3, 182, 97, 255, 71, 127, 110, 197, 5, 42, 254, 234, 210, 182, 53, 128, 59, 166, 64, 18,
-    106, 114, 175, 160, 135, 235, 137, 219, 243, 205, 112, 18, 242, 15, 163, 46, 230, 243, 146, 142, 25, 92, 224, 90,
-    130, 1, 154, 104, 65, 56, 99, 151, 161, 234, 139, 83, 146, 116, 94, 161, 182, 2, 136, 230, 196, 46, 50, 247, 117,
-    199, 230, 110, 55, 167, 59, 185, 245, 104, 208, 86, 65, 5, 30, 11, 154, 232, 77, 205, 207, 224, 142, 98, 88, 113,
-    147, 139, 4, 116, 40, 67, 160, 1, 44, 5, 146, 39, 35, 45, 169, 47, 55, 172, 148, 105, 38, 69, 148, 183, 208, 97, 77,
-    27, 147, 127, 62, 86, 55, 35, 175, 164, 173, 195, 137, 146, 232, 0, 58, 227, 181, 36, 183, 16, 109, 168, 48, 107,
-    156, 158, 48, 77, 121, 69, 82, 74, 69, 53, 195, 161, 43, 193, 254, 101, 59, 152, 229, 21, 81, 58, 241, 211, 86, 44,
-    30, 74, 25, 49, 0, 160, 29, 106, 177, 125, 156, 100, 73, 111, 131, 151, 32, 230, 175, 161, 146, 26, 100, 105, 97,
-    98, 182, 137, 178, 62, 204, 109, 98, 80, 22, 243, 4, 97, 7, 41, 180, 251, 19, 112, 135, 242, 172, 113, 132, 77, 25,
-    39, 138, 90, 46, 155, 6, 27, 8, 134, 53, 91, 69, 28, 150, 117, 134, 234, 128, 179, 54, 17, 121, 129, 108, 90, 167,
-    226, 137, 135, 165, 104, 109, 197, 224, 81, 50, 15, 224, 231, 255, 227, 170, 156, 90, 1, 209, 12, 130, 5, 208, 144,
-    175, 95, 134, 211, 226, 50, 250, 227, 228, 135, 183, 169, 206, 229, 43, 79, 176, 61, 43, 122, 99, 215, 169, 206,
-    171, 22, 196, 76, 165, 106, 199, 227, 101, 104, 153, 173, 52, 193, 184, 44, 236, 146, 229, 57, 48, 129, 18, 243,
-    107, 177, 2, 35, 53, 126, 200, 139, 226, 87, 57, 249, 71, 208, 227, 154, 186, 120, 41, 75, 152, 97, 114, 196, 201,
-    77, 8, 54, 23, 230, 208, 171, 231, 118, 62, 204, 225, 84, 21, 85, 118, 173, 30, 111, 72, 137, 81, 110, 109, 141,
-    165, 90, 129, 246, 84, 152, 123, 168, 20, 114, 140, 157, 161, 142, 65, 13, 229, 129, 227, 161, 8, 69, 192, 205, 84,
-    47, 129, 127, 180, 33, 44, 80, 143, 42, 226, 130, 30, 47, 106, 238, 45, 237, 223, 82, 155, 44, 186, 123, 24, 30,
-    252, 41, 237, 247, 113, 130, 221, 16, 149, 84, 158, 12, 145, 52, 205, 0, 26, 249, 155, 39, 2, 89, 156, 167, 89, 89,
-    160, 104, 96, 237, 40, 140, 88, 114, 128, 144, 254, 197, 73, 185, 249, 217, 143, 66, 230, 216, 160, 70, 131, 96, 11,
-    193, 61, 183, 90, 122, 10, 94, 96, 10, 18, 63, 168, 109, 88, 222, 117, 28, 212, 0, 154, 232, 65, 229, 185, 37, 53,
-    202, 147, 71, 197, 35, 111, 217, 77, 114, 237, 95, 211, 105, 169, 232, 157, 184, 153, 178, 90, 218, 226, 250, 101,
-    97, 93, 44, 185, 224, 90, 168, 185, 206, 33, 103, 239, 27, 248, 53, 227, 189, 174, 200, 112, 15, 31, 52, 22, 74, 96,
-    158, 88, 130, 101, 127, 202, 40, 216, 239, 215, 89, 81, 188, 91, 9, 250, 33, 145, 81, 222, 213, 199, 154, 229, 127,
-    133, 129, 8, 65, 40, 112, 192, 162, 2, 147, 22, 230, 180, 194, 48, 136, 89, 103, 123, 84, 146, 167, 93, 93, 97, 158,
-    65, 13, 80, 88, 81, 155, 63, 197, 184, 173, 59, 235, 206, 144, 207, 255, 196, 179, 248, 225, 153, 251, 235, 80, 210,
-    98, 248, 101, 189, 60, 130, 208, 220, 123, 200, 51, 169, 148, 241, 233, 1, 33, 145, 102, 105, 153, 66, 203, 100, 4,
-    204, 81, 69, 132, 142, 150, 249, 43, 105, 231, 162, 158, 238, 31, 231, 205, 6, 207, 119, 252, 17, 233, 40, 222, 121,
-    60, 246, 181, 227, 46, 130, 104, 78, 55, 1, 80, 43, 106, 56, 63, 190, 211, 254, 95, 117, 26, 207, 195, 43, 183, 166,
-    223, 216, 232, 13, 100, 80, 43, 7, 177, 233, 85, 159, 188, 101, 187, 216, 73, 138, 138, 106, 94, 76, 77, 178, 105,
-    135, 165, 247, 47, 156, 211, 8, 55, 109, 235, 163, 116, 252, 78, 56, 219, 209, 248, 194, 126, 197, 62, 54, 67, 129,
-    186, 207, 82, 208, 25, 200, 5, 53, 235, 237, 206, 88, 147, 128, 155, 54, 54, 93, 124, 155, 54, 255, 172, 34, 130,
-    17, 214, 25, 42, 45, 196, 242, 41, 79, 194, 224, 94, 238, 188, 199, 245, 120, 170, 236, 225, 111, 182, 157, 149,
-    122, 227, 239, 7, 188, 193, 154, 96, 71, 112, 211, 96, 217, 232, 219, 235, 136, 148, 11, 66, 97, 239, 201, 164, 10,
-    22, 175, 23, 53, 61, 21, 131, 227, 104, 151, 114, 97, 254, 136, 237, 91, 96, 225, 51, 214, 34, 89, 62, 87, 239, 136,
-    14, 217, 31, 88, 209, 25, 191, 247, 141, 241, 105, 50, 232, 73, 131, 8, 32, 138, 156, 125, 137, 149, 175, 127, 181,
-    178, 53, 49, 121, 54, 13, 250, 113, 50, 63, 240, 86, 76, 110, 168, 210, 19, 59, 34, 24, 177, 163, 46, 99, 0, 197,
-    144, 70, 219, 225, 252, 79, 202, 139, 16, 207, 240, 61, 155, 37, 15, 230, 218, 231, 162, 154, 18, 95, 15, 168, 188,
-    91, 154, 117, 226, 189, 209, 158, 218, 231, 255, 22, 157, 71, 126, 184, 191, 131, 178, 102, 193, 67, 142, 240, 209,
-    186, 61, 130, 146, 118, 137, 222, 126, 70, 150, 110, 131, 64, 110, 126, 42, 88, 145, 232, 164, 67, 219, 218, 35, 29,
-    48, 90, 211, 160, 69, 222, 33, 78, 111, 177, 6, 228, 116, 112, 119, 15, 98, 211, 204, 167, 17, 148, 247, 165, 153,
-    62, 18, 132, 115, 213, 166, 156, 104, 171, 251, 119, 23, 156, 220, 82, 225, 123, 18, 14, 87, 103, 176, 133, 200,
-    230, 138, 83, 59, 110, 232, 131, 131, 11, 162, 255, 75, 211, 232, 236, 31, 182, 60, 105, 93, 23, 187, 111, 37, 119,
-    157, 232, 188, 63, 197, 116, 166, 63, 1, 79, 57, 182, 237, 145, 217, 28, 200, 202, 201, 57, 221, 82, 125, 59, 122,
-    109, 47, 136, 162, 156, 121, 97, 99, 213, 180, 59, 72, 242, 232, 61, 39, 251, 175, 60, 103, 103, 22, 210, 110, 86,
-    54, 39, 141, 18, 21, 215, 98, 219, 85, 163, 60, 154, 94, 98, 182, 68, 150, 14, 41, 189, 139, 106, 254, 219, 127,
-    151, 70, 4, 141, 60, 131, 35, 179, 193, 74, 51, 158, 111, 38, 8, 95, 18, 248, 40, 212, 31, 79, 8, 226, 148, 243,
-    246, 176, 41, 198, 194, 67, 231, 223, 128, 151, 97, 93, 153, 49, 125, 193, 172, 68, 21, 164, 67, 128, 39, 166, 112,
-    143, 147, 41, 50, 61, 14, 139, 107, 55, 123, 7, 26, 6, 201, 76, 30, 58, 154, 215, 54, 204, 182, 163, 253, 12, 96,
-    137, 45, 68, 19, 243, 136, 141, 19, 131, 147, 130, 119, 230, 129, 207, 26, 32, 252, 155, 147, 229, 229, 30, 23, 23,
-    119, 98, 55, 2, 157, 173, 74, 212, 250, 228, 67, 63, 117, 33, 172, 99, 117, 76, 9, 213, 231, 51, 162, 187, 253, 97,
-    187, 192, 243, 239, 21, 182, 73, 22, 9, 199, 180, 49, 8, 92, 140, 123, 91, 123, 95, 135, 107, 168, 234, 166, 41,
-    119, 119, 91, 138, 81, 50, 212, 184, 171, 234, 225, 125, 188, 29, 246, 86, 71, 94, 107, 107, 215, 58, 81, 46, 241,
-    189, 132, 72, 67, 189, 152, 103, 155, 56, 193, 60, 187, 218, 44, 244, 252, 65, 103, 159, 133, 222, 214, 166, 10, 67,
-    93, 48, 160, 43, 233, 139, 34, 135, 196, 190, 156, 154, 162, 112, 228, 160, 70, 38, 24, 5, 123, 86, 117, 196, 203,
-    140, 205, 119, 82, 28, 194, 171, 29, 99, 151, 234, 189, 8, 27, 47, 210, 246, 51, 150, 19, 126, 187, 252, 16, 74, 13,
-    20, 69, 136, 146, 143, 65, 248, 216, 69, 98, 251, 49, 41, 73, 18, 107, 87, 85, 16, 146, 201, 33, 212, 202, 16, 12,
-    239, 220, 244, 135, 33, 183, 126, 28, 71, 116, 35, 108, 255, 64, 129, 137, 106, 143, 166, 214, 164, 150, 210, 185,
-    255, 65, 232, 53, 237, 108, 194, 48, 163, 154, 253, 150, 225, 79, 83, 80, 207, 22, 235, 59, 7, 239, 27, 157, 60,
-    237, 134, 251, 23, 151, 48, 20, 15, 210, 185, 122, 108, 32, 207, 60, 27, 91, 102, 102, 1, 195, 90, 58, 43, 47, 141,
-    42, 102, 159, 63, 5, 88, 217, 86, 212, 54, 5, 99, 219, 142, 86, 244, 234, 146, 2, 59, 229, 250, 55, 207, 119, 137,
-    172, 80, 220, 5, 0, 28, 235, 124, 129, 51, 177, 250, 76, 176, 46, 251, 48, 185, 148, 60, 58, 52, 120, 68, 153, 90,
-    207, 153, 81, 37, 99, 161, 153, 22, 174, 162, 215, 158, 252, 11, 53, 250, 211, 30, 255, 175, 53, 63, 32, 16, 191,
-    19, 204, 210, 50, 16, 15, 151, 18, 205, 82, 127, 219, 174, 84, 5, 239, 120, 199, 203, 37, 243, 61, 246, 171, 37,
-    119, 11, 88, 74, 246, 138, 252, 51, 182, 76, 253, 75, 93, 129, 197, 93, 210, 149, 96, 147, 93, 255, 236, 29, 147,
-    127, 22, 200, 110, 11, 120, 16, 18, 129, 25, 241, 74, 238, 118, 25, 229, 27, 169, 62, 121, 217, 127, 150, 234, 30,
-    237, 7, 128, 26, 64, 70, 90, 48, 121, 105, 133, 104, 89, 188, 57, 193, 83, 141, 118, 161, 229, 124, 136, 38, 94,
-    211, 108, 107, 242, 44, 16, 141, 76, 12, 105, 48, 151, 138, 74, 31, 139, 18, 102, 97, 198, 5, 160, 37, 252, 58, 179,
-    122, 145, 11, 248, 33, 177, 196, 43, 113, 77, 242, 175, 89, 132, 250, 106, 142, 10, 31, 200, 89, 15, 174, 238, 157,
-    53, 85, 165, 17, 190, 181, 185, 175, 231, 226, 253, 34, 173, 7, 4, 208, 248, 29, 151, 46, 115, 208, 217, 76, 16,
-    177, 32, 156, 21, 77, 214, 113, 99, 137, 92, 195, 16, 201, 209, 92, 34, 10, 60, 63, 150, 148, 149, 108, 22, 50, 227,
-    75, 54, 138, 14, 118, 135, 203, 125, 134, 48, 144, 228, 236, 197, 47, 215, 37, 27, 13, 151, 169, 93, 222, 54, 36,
-    13, 44, 232, 16, 158, 242, 140, 220, 247, 189, 207, 89, 85, 67, 218, 126, 3, 78, 173, 12, 148, 15, 144, 211, 89, 74,
-    34, 129, 13, 242, 174, 203, 110, 1, 187, 162, 246, 126, 174, 152, 156, 14, 66, 50, 161, 91, 216, 116, 24, 7, 121,
-    112, 182, 70, 73, 196, 37, 240, 30, 49, 33, 94, 125, 68, 152, 111, 29, 198, 123, 10, 190, 48, 142, 148, 153, 100,
-    247, 14, 188, 186, 239, 110, 203, 4, 103, 95, 150, 49, 2, 90, 5, 135, 35, 192, 50, 86, 220, 33, 168, 192, 10, 116,
-    27, 29, 182, 136, 64, 102, 8, 167, 103, 233, 10, 86, 185, 215, 11, 127, 191, 231, 215, 14, 37, 41, 207, 36, 39, 197,
-    164, 41, 185, 123, 60, 157, 0, 199, 81, 250, 225, 185, 48, 96, 59, 238, 38, 16, 227, 10, 14, 171, 141, 254, 60, 64,
-    50, 223, 121, 225, 247, 116, 204, 32, 164, 135, 47, 97, 121, 58, 117, 79, 15, 169, 32, 60, 143, 168, 241, 175, 140,
-    69, 82, 103, 48, 241, 16, 168, 156, 5, 29, 244, 76, 82, 120, 113, 245, 78, 0, 151, 13, 98, 180, 76, 21, 35, 145, 64,
-    97, 155, 9, 4, 100, 172, 108, 40, 24, 42, 131, 155, 99, 158, 91, 175, 218, 212, 96, 239, 81, 66, 50, 214, 111, 45,
-    73, 122, 2, 3, 104, 224, 52, 57, 66, 139, 11, 25, 206, 232, 88, 175, 210, 121, 50, 28, 208, 3, 133, 244, 59, 82, 66,
-    96, 93, 213, 75, 245, 108, 70, 89, 11, 230, 24, 1, 15, 22, 166, 140, 251, 246, 188, 175, 85, 21, 157, 231, 241, 52,
-    146, 203, 71, 190, 54, 189, 136, 220, 26, 159, 102, 187, 125, 96, 98, 52, 25, 251, 201, 28, 75, 22, 121, 92, 156,
-    135, 243, 104, 111, 10, 126, 231, 97, 13, 38, 184, 113, 121, 56, 184, 200, 44, 192, 75, 17, 82, 143, 251, 54, 188,
-    238, 34, 73, 185, 128, 69, 230, 233, 151, 160, 233, 129, 190, 195, 44, 56, 147, 84, 212, 149, 143, 140, 183, 233,
-    142, 136, 31, 202, 231, 57, 196, 8, 158, 133, 134, 80, 104, 6, 160, 60, 168, 228, 155, 144, 179, 223, 28, 75, 105,
-    196, 88, 29, 68, 212, 141, 218, 233, 53, 244, 35, 178, 124, 219, 39, 119, 176, 139, 96, 165, 250, 53, 25, 93, 252,
-    7, 116, 0, 50, 170, 145, 151, 21, 120, 106, 31, 209, 46, 37, 5, 209, 219, 40, 110, 212, 117, 26, 26, 226, 190, 71,
-    171, 96, 243, 141, 16, 253, 135, 184, 96, 114, 249, 11, 154, 213, 48, 211, 94, 30, 220, 27, 104, 225, 214, 180, 166,
-    191, 250, 74, 82, 194, 126, 148, 147, 167, 196, 244, 180, 72, 130, 34, 242, 2, 55, 12, 237, 131, 80, 17, 152, 132,
-    187, 1, 11, 142, 68, 124, 100, 147, 155, 133, 81, 200, 174, 155, 90, 136, 225, 107, 119, 46, 48, 110, 139, 145, 76,
-    183, 239, 54, 0, 202, 254, 190, 233, 183, 58, 150, 13, 14, 17, 209, 232, 37, 118, 6, 131, 10, 199, 195, 233, 76,
-    145, 160, 100, 209, 62, 189, 106, 56, 234, 27, 138, 92, 135, 201, 254, 143, 49, 52, 240, 132, 41, 133, 69, 192, 181,
-    251, 243, 127, 73, 19, 66, 253, 128, 203, 201, 184, 183, 49, 73, 218, 229, 113, 136, 213, 85, 154, 167, 39, 80, 66,
-    25, 237, 39, 47, 171, 37, 63, 92, 74, 55, 170, 145, 0, 240, 160, 150, 33, 56, 143, 94, 6, 64, 103, 255, 161, 111,
-    114, 55, 168, 200, 47, 222, 225, 201, 115, 119, 240, 48, 203, 236, 255, 233, 142, 82, 48, 125, 114, 236, 115, 43,
-    155, 172, 166, 160, 102, 90, 39, 92, 94, 63, 88, 49, 7, 1, 68, 239, 169, 223, 173, 0, 158, 252, 134, 176, 251, 88,
-    245, 202, 176, 134, 55, 112, 53, 144, 16, 111, 59, 151, 232, 198, 17, 56, 31, 164, 216, 224, 189, 202, 169, 155,
-    248, 134, 7, 158, 189, 165, 54, 232, 79, 6, 105, 227, 198, 214, 183, 26, 31, 196, 50, 150, 216, 13, 123, 172, 134,
-    85, 167, 191, 99, 85, 22, 47, 62, 239, 26, 212, 30, 36, 227, 152, 94, 150, 14, 141, 64, 7, 5, 11, 2, 160, 176, 205,
-    122, 147, 147, 23, 144, 240, 177, 18, 160, 190, 197, 135, 207, 130, 82, 246, 138, 67, 226, 5, 51, 166, 13, 204, 232,
-    200, 225, 203, 218, 237, 24, 87, 160, 36, 132, 69, 90, 173, 189, 87, 67, 67, 70, 33, 226, 180, 122, 51, 209, 5, 215,
-    64, 179, 231, 244, 57, 94, 80, 234, 248, 166, 128, 189, 87, 30, 201, 59, 69, 57, 231, 240, 45, 115, 196, 246, 219,
-    110, 124, 253, 167, 198, 20, 103, 146, 117, 72, 117, 50, 215, 120, 25, 98, 35, 241, 222, 86, 5, 80, 29, 166, 137,
-    37, 179, 85, 113, 52, 159, 49, 216, 69, 183, 101, 45, 88, 65, 189, 99, 56, 38, 107, 154, 108, 77, 239, 7, 59, 103,
-    10, 157, 40, 144, 205, 127, 20, 187, 60, 171, 199, 6, 182, 195, 240, 233, 172, 158, 49, 49, 204, 228, 230, 199, 191,
-    3, 18, 181, 137, 241, 89, 144, 186, 37, 51, 189, 143, 149, 206, 229, 90, 1, 28, 18, 94, 191, 121, 106, 68, 218, 103,
-    41, 183, 96, 60, 129, 13, 8, 83, 90, 29, 33, 219, 161, 70, 101, 100, 252, 48, 219, 22, 233, 138, 234, 152, 201, 241,
-    136, 239, 16, 245, 234, 104, 236, 158, 101, 81, 145, 203, 123, 12, 48, 228, 113, 189, 125, 99, 53, 135, 248, 123,
-    143, 76, 202, 83, 121, 122, 58, 14, 184, 16, 110, 125, 173, 77, 60, 180, 102, 191, 2, 169, 12, 124, 252, 198, 52,
-    199, 112, 143, 94, 88, 186, 240, 208, 226, 109, 62, 116, 50, 247, 79, 42, 78, 241, 56, 79, 60, 252, 208, 81, 149,
-    54, 246, 219, 244, 239, 175, 221, 15, 164, 235, 239, 154, 16, 3, 140, 218, 7, 143, 165, 126, 186, 240, 197, 10, 26,
-    240, 13, 163, 81, 239, 67, 172, 158, 255, 83, 68, 57, 88, 70, 125, 99, 245, 82, 160, 161, 30, 245, 236, 174, 254,
-    15, 6, 18, 115, 99, 154, 69, 7, 121, 144, 89, 162, 5, 32, 184, 12, 61, 68, 75, 43, 144, 1, 121, 124, 122, 14, 237,
-    173, 103, 163, 7, 3, 145, 142, 196, 115, 13, 206, 156, 82, 192, 147, 208, 138, 143, 49, 156, 155, 233, 147, 202, 45,
-    58, 36, 145, 230, 67, 165, 198, 19, 190, 54, 230, 61, 27, 126, 11, 70, 62, 60, 166, 196, 13, 184, 46, 80, 71, 119,
-    22, 171, 192, 71, 188, 249, 58, 167, 16, 170, 106, 173, 230, 126, 145, 80, 218, 59, 229, 118, 178, 12, 159, 48, 203,
-    75, 114, 173, 18, 75, 113, 216, 97, 54, 81, 14, 227, 44, 137, 157, 80, 9, 216, 190, 126, 4, 127, 42, 241, 142, 101,
-    20, 9, 199, 152, 82, 243, 104, 46, 236, 100, 12, 212, 240, 254, 53, 227, 64, 119, 86, 243, 214, 248, 165, 203, 30,
-    26, 235, 186, 75, 141, 45, 193, 64, 128, 186, 181, 201, 232, 84, 189, 146, 117, 140, 7, 116, 108, 48, 199, 125, 167,
-    186, 84, 45, 21, 193, 126, 50, 167, 158, 61, 147, 8, 126, 67, 239, 75, 121, 246, 3, 11, 22, 79, 20, 61, 204, 253,
-    22, 185, 144, 106, 95, 104, 205, 183, 62, 184, 122, 203, 3, 2, 98, 34, 239, 44, 176, 62, 9, 248, 152, 86, 10, 219,
-    75, 149, 48, 82, 46, 70, 39, 202, 100, 240, 59, 231, 61, 18, 8, 238, 8, 231, 134, 185, 199, 113, 224, 111, 232, 114,
-    12, 48, 55, 137, 91, 255, 129, 119, 59, 129, 100, 4, 99, 97, 37, 141, 203, 107, 63, 126, 130, 211, 71, 87, 99, 206,
-    3, 64, 238, 45, 255, 24, 49, 87, 171, 90, 242, 78, 96, 176, 74, 224, 71, 148, 140, 152, 103, 120, 183, 218, 99, 36,
-    54, 91, 2, 121, 33, 159, 12, 164, 93, 221, 211, 156, 93, 120, 176, 150, 221, 16, 109, 126, 15, 127, 90, 185, 179,
-    255, 9, 162, 87, 10, 242, 59, 3, 104, 255, 9, 65, 15, 182, 191, 2, 59, 108, 199, 221, 3, 14, 150, 69, 43, 167, 150,
-    253, 111, 72, 46, 210, 30, 21, 25, 151, 100, 174, 188, 178, 4, 89, 188, 242, 241, 63, 153, 144, 170, 36, 88, 153, 5,
-    20, 234, 7, 197, 49, 216, 184, 76, 210, 170, 93, 101, 73, 174, 199, 105, 129, 116, 126, 22, 54, 123, 166, 212, 218,
-    81, 180, 143, 38, 237, 91, 97, 217, 150, 22, 175, 168, 104, 144, 183, 215, 109, 35, 103, 200, 71, 159, 62, 150, 115,
-    94, 124, 82, 77, 185, 19, 218, 193, 40, 249, 173, 252, 174, 34, 164, 16, 166, 223, 114, 2, 135, 151, 181, 215, 238,
-    241, 253, 27, 201, 29, 181, 0, 73, 6, 88, 190, 204, 65, 86, 110, 214, 34, 213, 175, 49, 54, 120, 32, 170, 6, 57,
-    197, 48, 18, 105, 93, 85, 0, 35, 60, 55, 59, 180, 202, 98, 32, 168, 70, 36, 73, 184, 133, 142, 179, 52, 94, 141,
-    118, 47, 68, 133, 163, 50, 9, 205, 30, 44, 149, 53, 92, 81, 33, 144, 253, 85, 204, 7, 209, 87, 11, 223, 199, 176,
-    207, 128, 219, 222, 48, 195, 34, 67, 15, 35, 177, 213, 83, 188, 118, 254, 45, 221, 132, 191, 67, 16, 139, 181, 254,
-    45, 95, 19, 0, 80, 0, 92, 71, 110, 164, 28, 39, 14, 211, 219, 39, 7, 231, 127, 181, 206, 67, 67, 64, 81, 246, 113,
-    62, 201, 23, 27, 197, 195, 112, 228, 150, 127, 17, 174, 127, 200, 192, 185, 0, 81, 105, 229, 238, 144, 248, 69, 76,
-    185, 204, 0, 177, 230, 180, 133, 129, 221, 213, 76, 5, 247, 192, 187, 110, 88, 22, 203, 90, 245, 11, 191, 161, 42,
-    113, 7, 135, 62, 242, 25, 154, 227, 28, 184, 4, 166, 152, 46, 211, 123, 247, 248, 64, 93, 184, 212, 65, 134, 103,
-    66, 65, 136, 140, 82, 229, 125, 140, 26, 154, 175, 180, 132, 211, 135, 65, 153, 71, 13, 151, 64, 145, 91, 191, 69,
-    148, 12, 171, 123, 225, 219, 200, 22, 182, 230, 131, 207, 159, 247, 15, 43, 4, 206, 150, 163, 142, 200, 157, 7, 132,
-    134, 25, 68, 231, 242, 57, 15, 149, 197, 12, 108, 248, 112, 246, 248, 179, 156, 115, 234, 241, 204, 201, 115, 85,
-    92, 42, 123, 102, 42, 229, 134, 58, 143, 254, 87, 204, 221, 190, 191, 205, 2, 148, 106, 28, 199, 142, 239, 136, 80,
-    72, 112, 3, 7, 81, 173, 134, 8, 116, 105, 209, 4, 87, 56, 85, 21, 15, 25, 149, 133, 77, 225, 111, 14, 66, 223, 41,
-    181, 202, 78, 15, 196, 16, 38, 55, 17, 253, 227, 97, 93, 98, 13, 70, 85, 179, 73, 143, 169, 239, 219, 216, 207, 55,
-    159, 53, 104, 168, 53, 120, 136, 188, 237, 14, 103, 87, 246, 163, 127, 227, 27, 189, 244, 6, 89, 220, 190, 20, 182,
-    24, 167, 61, 230, 201, 43, 214, 232, 140, 202, 85, 98, 69, 64, 151, 146, 53, 31, 139, 15, 43, 119, 96, 175, 138, 57,
-    214, 67, 219, 217, 204, 27, 30, 66, 104, 206, 97, 214, 102, 59, 142, 183, 143, 100, 24, 15, 98, 37, 125, 246, 246,
-    71, 130, 186, 228, 43, 169, 50, 42, 52, 126, 21, 154, 161, 225, 174, 97, 88, 243, 84, 240, 219, 246, 130, 223, 35,
-    8, 211, 190, 82, 198, 220, 66, 215, 117, 49, 112, 122, 76, 201, 197, 249, 188, 5, 35, 79, 99, 77, 170, 143, 24, 39,
-    57, 8, 223, 209, 69, 130, 218, 225, 206, 243, 110, 127, 189, 158, 215, 46, 110, 197, 255, 120, 36, 140, 182, 172,
-    185, 224, 26, 87, 119, 72, 209, 206, 129, 83, 133, 203, 137, 195, 209, 81, 61, 27, 72, 233, 124, 110, 235, 182, 251,
-    115, 115, 251, 205, 237, 60, 74, 73, 113, 230, 122, 132, 195, 176, 4, 41, 33, 66, 51, 84, 20, 37, 199, 71, 206, 241,
-    91, 148, 5, 188, 174, 147, 129, 170, 140, 158, 156, 64, 8, 0, 186, 28, 11, 91, 212, 56, 135, 61, 226, 193, 75, 98,
-    13, 55, 244, 42, 82, 250, 81, 110, 156, 243, 104, 25, 210, 180, 190, 36, 170, 84, 226, 193, 139, 164, 209, 116, 229,
-    118, 204, 244, 7, 69, 68, 57, 183, 214, 151, 137, 104, 236, 230, 83, 148, 48, 114, 118, 62, 93, 98, 171, 203, 52,
-    174, 240, 182, 225, 163, 134, 159, 198, 134, 225, 240, 48, 122, 112, 46, 162, 113, 244, 196, 203, 157, 55, 68, 217,
-    78, 174, 85, 176, 200, 22, 213, 32, 64, 146, 22, 59, 183, 110, 173, 72, 124, 25, 177, 244, 89, 113, 185, 210, 128,
-    236, 189, 93, 241, 180, 34, 102, 21, 73, 149, 206, 165, 63, 105, 79, 133, 182, 192, 5, 16, 108, 120, 75, 84, 49,
-    170, 38, 81, 135, 242, 229, 99, 66, 36, 66, 145, 122, 21, 250, 149, 121, 153, 147, 52, 58, 113, 7, 239, 94, 10, 142,
-    210, 23, 204, 48, 217, 32, 32, 220, 71, 79, 225, 239, 160, 122, 225, 132, 25, 169, 63, 41, 171, 90, 201, 248, 196,
-    83, 186, 241, 40, 79, 4, 195, 87, 31, 80, 26, 206, 161, 116, 249, 51, 236, 57, 40, 129, 162, 127, 8, 46, 0, 236, 65,
-    178, 86, 178, 24, 1, 160, 51, 86, 9, 84, 244, 20, 121, 134, 160, 244, 75, 38, 219, 194, 122, 227, 167, 107, 189,
-    170, 103, 79, 237, 246, 51, 197, 209, 196, 43, 229, 21, 80, 197, 91, 96, 182, 155, 106, 241, 45, 92, 94, 232, 164,
-    104, 211, 19, 93, 42, 104, 24, 33, 21, 214, 87, 218, 73, 147, 191, 123, 213, 155, 196, 197, 30, 43, 52, 163, 79,
-    249, 87, 152, 239, 144, 36, 218, 202, 247, 115, 222, 55, 34, 83, 234, 13, 51, 26, 120, 160, 148, 143, 39, 149, 77,
-    249, 143, 78, 134, 62, 128, 84, 114, 51, 247, 198, 5, 235, 10, 115, 179, 151, 96, 81, 224, 9, 39, 143, 14, 56, 79,
-    79, 40, 11, 6, 0, 59, 180, 181, 39, 9, 71, 199, 111, 99, 74, 125, 188, 62, 1, 170, 190, 8, 173, 253, 3, 59, 172,
-    103, 119, 4, 232, 97, 73, 93, 233, 202, 69, 33, 250, 129, 147, 142, 18, 47, 138, 203, 92, 213, 194, 79, 187, 64, 22,
-    199, 92, 18, 129, 93, 7, 211, 171, 191, 165, 3, 35, 176, 26, 66, 126, 252, 251, 173, 156, 35, 28, 27, 233, 53, 82,
-    46, 38, 222, 198, 51, 224, 149, 211, 24, 121, 31, 108, 143, 175, 110, 82, 14, 197, 207, 88, 51, 120, 202, 215, 223,
-    104, 133, 98, 3, 65, 189, 34, 123, 96, 49, 1, 23, 170, 96, 244, 23, 12, 1, 178, 75, 184, 110, 189, 172, 209, 121,
-    113, 25, 101, 178, 242, 253, 241, 83, 61, 238, 179, 103, 244, 202, 233, 168, 239, 189, 193, 126, 203, 95, 0, 190,
-    51, 106, 174, 206, 198, 98, 48, 220, 81, 101, 111, 100, 233, 212, 124, 29, 79, 237, 177, 72, 180, 103, 224, 48, 252,
-    98, 94, 58, 14, 227, 67, 175, 86, 254, 134, 94, 212, 183, 48, 165, 3, 51, 118, 114, 107, 213, 1, 116, 166, 171, 97,
-    210, 133, 81, 56, 65, 53, 52, 12, 51, 182, 217, 111, 200, 81, 36, 197, 237, 178, 29, 209, 176, 233, 88, 238, 193,
-    97, 250, 18, 72, 60, 20, 114, 224, 66, 15, 11, 197, 3, 41, 119, 28, 251, 38, 253, 227, 48, 23, 180, 60, 81, 9, 197,
-    206, 199, 23, 20, 51, 249, 139, 121, 6, 112, 251, 144, 40, 157, 142, 164, 232, 193, 132, 180, 44, 74, 108, 3, 246,
-    58, 250, 49, 204, 40, 160, 198, 243, 114, 206, 25, 41, 58, 193, 48, 249, 54, 196, 31, 204, 143, 235, 24, 35, 10,
-    246, 36, 227, 104, 64, 104, 17, 105, 77, 170, 94, 130, 194, 248, 140, 116, 174, 198, 79, 201, 131, 214, 158, 109,
-    127, 60, 132, 144, 108, 1, 234, 85, 80, 17, 130, 223, 176, 178, 170, 141, 90, 97, 221, 229, 37, 155, 248, 78, 21,
-    163, 109, 68, 50, 226, 108, 147, 184, 99, 92, 152, 142, 231, 91, 199, 92, 21, 89, 157, 5, 8, 209, 239, 253, 144,
-    212, 42, 12, 173, 93, 22, 44, 232, 39, 16, 160, 74, 33, 42, 116, 12, 92, 157, 111, 166, 72, 211, 8, 111, 168, 60, 1,
-    28, 255, 77, 14, 170, 95, 204, 60, 184, 136, 58, 118, 207, 79, 33, 159, 165, 82, 88, 194, 61, 93, 66, 140, 58, 219,
-    160, 28, 250, 98, 223, 43, 55, 224, 48, 67, 185, 158, 219, 229, 16, 66, 206, 238, 171, 2, 238, 208, 132, 130, 123,
-    79, 76, 143, 175, 191, 153, 253, 160, 23, 155, 50, 35, 174, 6, 43, 223, 141, 162, 159, 115, 84, 39, 142, 24, 232,
-    136, 54, 66, 89, 144, 189, 171, 249, 148, 67, 137, 109, 81, 23, 159, 12, 40, 240, 127, 123, 169, 11, 214, 114, 152,
-    250, 61, 33, 190, 117, 222, 52, 253, 119, 80, 13, 251, 106, 49, 1, 73, 84, 59, 168, 222, 30, 45, 39, 9, 184, 189,
-    173, 219, 34, 191, 107, 85, 76, 238, 43, 221, 241, 151, 64, 128, 242, 218, 50, 246, 234, 184, 142, 66, 122, 221,
-    222, 237, 191, 41, 5, 6, 220, 29, 6, 135, 186, 220, 104, 160, 14, 163, 108, 36, 110, 198, 108, 38, 28, 149, 79, 105,
-    181, 223, 40, 34, 67, 29, 110, 192, 135, 178, 2, 131, 170, 174, 231, 0, 178, 235, 104, 220, 21, 62, 72, 152, 14,
-    112, 241, 148, 130, 43, 243, 145, 233, 237, 199, 229, 39, 108, 178, 96, 255, 176, 77, 87, 179, 50, 39, 117, 10, 150,
-    145, 69, 244, 79, 59, 64, 13, 224, 185, 68, 39, 248, 245, 154, 168, 54, 193, 56, 78, 232, 111, 203, 1, 254, 35, 26,
-    118, 37, 8, 23, 246, 9, 146, 108, 100, 87, 222, 58, 68, 82, 156, 42, 157, 119, 33, 127, 151, 170, 161, 156, 251,
-    119, 225, 204, 2, 251, 210, 90, 63, 112, 170, 60, 80, 189, 250, 71, 113, 139, 221, 188, 112, 12, 59, 25, 253, 108,
-    76, 28, 211, 197, 77, 144, 6, 84, 226, 167, 140, 14, 197, 229, 76, 26, 88, 90, 13, 224, 174, 148, 46, 14, 19, 207,
-    148, 124, 16, 165, 119, 236, 177, 203, 92, 42, 15, 49, 152, 16, 9, 111, 65, 29, 180, 36, 125, 108, 96, 200, 67, 117,
-    68, 85, 240, 255, 55, 141, 114, 21, 209, 156, 160, 211, 221, 106, 84, 213, 91, 133, 227, 157, 101, 229, 71, 207, 86,
-    91, 193, 96, 175, 208, 150, 155, 82, 225, 189, 173, 180, 202, 151, 229, 183, 15, 54, 92, 6, 203, 55, 241, 233, 182,
-    230, 12, 23, 65, 126, 54, 24, 24, 246, 244, 64, 106, 102, 180, 15, 170, 40, 100, 141, 114, 241, 53, 195, 150, 29,
-    245, 210, 102, 230, 126, 131, 81, 88, 242, 141, 6, 182, 29, 221, 155, 239, 207, 130, 140, 137, 40, 59, 144, 11, 128,
-    149, 71, 91, 224, 236, 34, 50, 196, 140, 180, 104, 6, 250, 18, 231, 14, 39, 20, 83, 240, 202, 225, 114, 200, 128,
-    69, 99, 246, 214, 121, 149, 237, 129, 152, 177, 213, 179, 169, 45, 120, 142, 141, 81, 61, 138, 101, 59, 12, 58, 37,
-    36, 121, 192, 78, 35, 255, 161, 151, 6, 149, 20, 70, 200, 105, 67, 131, 243, 100, 175, 141, 27, 212, 209, 131, 240,
-    242, 244, 12, 47, 30, 200, 211, 127, 159, 30, 184, 215, 81, 105, 230, 152, 134, 57, 60, 58, 215, 106, 4, 109, 255,
-    27, 169, 248, 134, 44, 217, 72, 227, 240, 208, 78, 252, 19, 38, 200, 250, 214, 50, 147, 50, 55, 81, 119, 142, 121,
-    2, 71, 131, 4, 68, 64, 163, 227, 171, 116, 55, 120, 249, 196, 2, 182, 23, 141, 161, 20, 214, 91, 169, 238, 227, 233,
-    23, 60, 17, 237, 173, 126, 45, 101, 185, 254, 75, 243, 24, 106, 103, 179, 213, 199, 197, 111, 112, 178, 222, 23,
-    103, 118, 100, 225, 96, 198, 123, 123, 59, 7, 22, 252, 125, 84, 89, 231, 28, 42, 226, 124, 124, 56, 176, 196, 129,
-    239, 90, 93, 41, 133, 90, 51, 51, 4, 155, 59, 254, 170, 139, 12, 152, 233, 16, 74, 54, 96, 245, 182, 145, 9, 42,
-    234, 175, 21, 165, 227, 33, 200, 152, 238, 140, 115, 65, 39, 245, 94, 117, 154, 62, 93, 45, 178, 138, 246, 217, 231,
-    165, 38, 4, 210, 138, 20, 84, 146, 100, 210, 76, 208, 10, 109, 216, 183, 190, 217, 109, 40, 214, 109, 219, 218, 233,
-    132, 87, 187, 157, 147, 229, 252, 255, 218, 92, 23, 127, 248, 198, 242, 79, 250, 166, 61, 43, 53, 31, 24, 242, 1,
-    179, 73, 61, 214, 156, 165, 185, 14, 79, 64, 182, 45, 37, 213, 143, 135, 113, 156, 103, 249, 146, 103, 232, 104, 69,
-    214, 68, 161, 145, 107, 248, 152, 7, 130, 185, 225, 51, 111, 113, 241, 221, 60, 147, 241, 235, 118, 195, 55, 147,
-    49, 84, 142, 236, 183, 25, 232, 255, 212, 160, 185, 188, 56, 43, 161, 105, 198, 43, 64, 133, 99, 216, 206, 54, 228,
-    73, 198, 161, 88, 175, 33, 184, 46, 197, 64, 140, 89, 254, 182, 164, 24, 183, 72, 48, 232, 204, 72, 190, 106, 118,
-    26, 99, 124, 2, 177, 82, 30, 38, 101, 27, 63, 14, 230, 52, 72, 175, 235, 2, 229, 28, 182, 123, 238, 86, 143, 119,
-    22, 148, 179, 177, 87, 189, 57, 228, 68, 177, 151, 35, 242, 51, 114, 160, 4, 188, 195, 228, 78, 220, 137, 93, 249,
-    81, 73, 93, 155, 53, 219, 166, 56, 133, 34, 112, 146, 2, 111, 151, 252, 96, 223, 17, 154, 241, 65, 114, 95, 27, 46,
-    252, 165, 65, 147, 138, 171, 195, 154, 25, 75, 236, 103, 110, 198, 228, 242, 22, 94, 142, 68, 119, 190, 110, 12, 94,
-    37, 141, 226, 133, 119, 77, 71, 179, 251, 171, 254, 88, 85, 143, 53, 176, 108, 7, 152, 201, 212, 30, 55, 148, 47,
-    83, 91, 240, 174, 153, 143, 60, 238, 94, 216, 13, 76, 16, 184, 129, 167, 255, 167, 125, 235, 230, 183, 65, 198, 60,
-    198, 121, 118, 171, 109, 30, 40, 24, 168, 220, 88, 66, 255, 113, 246, 210, 183, 196, 212, 197, 239, 18, 56, 255,
-    224, 196, 136, 56, 137, 3, 172, 65, 78, 113, 199, 175, 34, 179, 29, 231, 249, 138, 232, 87, 30, 243, 154, 179, 138,
-    87, 161, 230, 74, 116, 119, 2, 171, 52, 251, 187, 175, 240, 105, 151, 117, 205, 165, 7, 157, 100, 13, 203, 232, 143,
-    113, 231, 34, 73, 58, 81, 2, 242, 18, 217, 242, 125, 88, 135, 152, 27, 118, 193, 148, 240, 198, 218, 246, 146, 128,
-    234, 206, 92, 120, 247, 61, 56, 159, 148, 153, 177, 178, 107, 186, 247, 80, 215, 207, 135, 108, 8, 192, 7, 117, 13,
-    84, 69, 116, 103, 164, 38, 2, 59, 9, 121, 247, 135, 126, 189, 131, 17, 120, 253, 195, 74, 114, 39, 78, 57, 85, 253,
-    19, 78, 117, 54, 121, 51, 9, 180, 79, 249, 147, 228, 253, 244, 95, 251, 91, 18, 178, 224, 126, 125, 115, 47, 190,
-    144, 242, 43, 2, 213, 168, 197, 33, 246, 81, 173, 38, 3, 137, 89, 11, 1, 96, 230, 92, 117, 225, 74, 47, 71, 189, 31,
-    226, 93, 235, 93, 43, 170, 178, 52, 58, 35, 146, 80, 46, 250, 14, 198, 31, 96, 160, 69, 118, 152, 29, 74, 50, 163,
-    242, 69, 142, 41, 108, 1, 248, 198, 17, 243, 118, 195, 242, 72, 213, 134, 181, 44, 109, 117, 84, 230, 209, 68, 123,
-    208, 199, 24, 74, 117, 164, 121, 112, 225, 172, 62, 3, 128, 177, 187, 2, 21, 121, 50, 249, 163, 203, 52, 253, 202,
-    225, 251, 55, 156, 203, 211, 100, 208, 147, 77, 103, 138, 33, 212, 4, 55, 99, 181, 120, 67, 196, 167, 11, 179, 162,
-    253, 34, 122, 41, 142, 244, 26, 47, 233, 129, 2, 36, 238, 68, 78, 215, 58, 107, 177, 113, 22, 163, 165, 242, 0, 196,
-    42, 146, 64, 36, 186, 233, 232, 168, 237, 86, 105, 205, 199, 151, 34, 160, 38, 39, 86, 157, 228, 153, 253, 39, 69,
-    87, 184, 44, 195, 29, 23, 4, 153, 129, 122, 193, 246, 26, 99, 66, 170, 92, 182, 91, 8, 222, 238, 121, 244, 212, 195,
-    56, 196, 194, 252, 140, 181, 28, 25, 50, 70, 250, 233, 165, 11, 204, 97, 71, 182, 44, 127, 36, 154, 246, 230, 229,
-    255, 120, 218, 190, 37, 163, 11, 55, 19, 97, 108, 214, 76, 85, 74, 129, 204, 75, 200, 74, 20, 107, 243, 17, 140,
-    141, 108, 114, 21, 64, 243, 24, 81, 232, 188, 174, 60, 14, 42, 251, 150, 31, 37, 115, 144, 3, 147, 9, 249, 63, 127,
-    226, 206, 107, 103, 7, 102, 5, 161, 160, 14, 231, 160, 182, 179, 175, 171, 209, 77, 144, 44, 229, 218, 120, 77, 207,
-    160, 210, 110, 110, 236, 85, 136, 200, 116, 198, 172, 6, 68, 69, 47, 197, 178, 112, 8, 84, 136, 244, 190, 147, 59,
-    83, 184, 105, 122, 28, 20, 20, 214, 51, 207, 192, 92, 31, 205, 179, 106, 173, 53, 201, 18, 231, 222, 67, 225, 180,
-    113, 142, 86, 242, 88, 204, 119, 35, 216, 203, 176, 142, 178, 193, 153, 2, 101, 51, 40, 195, 8, 118, 171, 21, 93,
-    206, 204, 90, 230, 16, 253, 40, 13, 202, 116, 208, 199, 212, 227, 150, 240, 239, 181, 232, 189, 184, 134, 75, 255,
-    100, 199, 210, 77, 85, 238, 31, 100, 240, 131, 181, 110, 59, 44, 76, 229, 183, 188, 125, 198, 128, 172, 37, 1, 24,
-    230, 20, 161, 114, 127, 47, 49, 64, 169, 169, 219, 248, 96, 54, 196, 194, 83, 244, 50, 13, 252, 116, 252, 232, 208,
-    142, 231, 98, 145, 149, 194, 60, 179, 239, 132, 253, 106, 140, 42, 66, 70, 22, 84, 230, 141, 206, 153, 85, 75, 104,
-    229, 122, 8, 230, 12, 85, 3, 179, 44, 32, 102, 176, 120, 134, 215, 176, 135, 176, 122, 216, 130, 230, 20, 231, 59,
-    7, 163, 197, 232, 43, 28, 162, 47, 2, 116, 129, 243, 82, 90, 146, 74, 200, 173, 237, 67, 49, 125, 174, 116, 252,
-    157, 91, 181, 240, 164, 135, 219, 222, 144, 154, 49, 193, 44, 78, 107, 64, 8, 225, 139, 241, 146, 148, 70, 190, 190,
-    102, 222, 70, 126, 55, 2, 146, 9, 219, 160, 76, 199, 232, 234, 2, 7, 100, 225, 172, 52, 197, 134, 48, 71, 29, 127,
-    220, 76, 243, 54, 76, 171, 88, 27, 216, 57, 132, 163, 45, 43, 127, 129, 186, 34, 150, 33, 30, 48, 26, 100, 5, 255,
-    12, 156, 189, 95, 3, 240, 215, 104, 68, 50, 105, 49, 101, 89, 24, 200, 40, 88, 121, 33, 118, 16, 104, 156, 212, 39,
-    191, 15, 220, 200, 234, 13, 146, 37, 40, 54, 200, 234, 174, 104, 192, 139, 60, 137, 214, 0, 90, 56, 96, 106, 189,
-    228, 192, 222, 162, 36, 39, 9, 128, 54, 191, 6, 198, 230, 126, 222, 139, 206, 36, 225, 41, 107, 202, 102, 138, 14,
-    237, 235, 174, 3, 246, 135, 226, 13, 137, 253, 140, 148, 206, 179, 220, 17, 26, 225, 210, 93, 111, 138, 35, 146, 27,
-    18, 109, 203, 242, 103, 111, 5, 101, 150, 37, 143, 92, 152, 74, 215, 32, 20, 10, 190, 235, 0, 231, 244, 226, 222, 3,
-    77, 63, 213, 211, 235, 141, 104, 221, 175, 3, 197, 129, 225, 4, 107, 205, 144, 138, 91, 119, 114, 143, 176, 18, 21,
-    34, 164, 72, 28, 8, 49, 87, 180, 215, 167, 40, 79, 158, 63, 101, 182, 136, 252, 14, 179, 154, 77, 90, 105, 20, 62,
-    241, 162, 44, 128, 48, 0, 174, 87, 251, 94, 76, 180, 36, 133, 131, 50, 131, 126, 97, 176, 144, 170, 17, 125, 43, 74,
-    165, 100, 165, 209, 136, 181, 94, 134, 173, 205, 57, 17, 167, 177, 166, 242, 127, 74, 15, 20, 123, 121, 162, 80,
-    160, 68, 103, 92, 123, 96, 185, 142, 78, 245, 237, 9, 41, 157, 81, 3, 134, 123, 125, 233, 72, 132, 47, 157, 176,
-    107, 119, 233, 42, 208, 192, 226, 78, 221, 202, 156, 212, 182, 153, 178, 174, 108, 139, 240, 251, 86, 185, 16, 105,
-    203, 81, 34, 244, 77, 72, 20, 70, 25, 201, 100, 158, 15, 198, 123, 218, 171, 37, 102, 157, 206, 59, 80, 199, 167,
-    58, 24, 165, 198, 101, 181, 40, 114, 229, 219, 212, 74, 96, 165, 241, 25, 185, 24, 63, 145, 189, 242, 152, 77, 126,
-    9, 244, 10, 161, 48, 159, 106, 179, 133, 93, 245, 152, 73, 85, 98, 61, 226, 121, 29, 217, 248, 76, 25, 97, 28, 49,
-    241, 4, 234, 244, 172, 175, 199, 214, 140, 49, 194, 13, 164, 86, 255, 21, 137, 3, 47, 163, 24, 24, 6, 69, 191, 175,
-    207, 20, 123, 4, 117, 7, 43, 213, 243, 191, 164, 39, 84, 187, 127, 66, 93, 171, 92, 56, 100, 168, 24, 100, 171, 229,
-    143, 179, 238, 78, 86, 124, 53, 24, 54, 18, 194, 224, 66, 186, 111, 97, 143, 94, 55, 23, 125, 48, 101, 114, 57, 167,
-    27, 199, 59, 123, 67, 159, 188, 191, 182, 154, 184, 133, 199, 166, 58, 70, 218, 87, 173, 11, 3, 115, 186, 186, 126,
-    153, 165, 98, 191, 160, 251, 255, 138, 84, 238, 45, 60, 176, 222, 33, 198, 156, 43, 124, 161, 95, 39, 40, 88, 129,
-    206, 77, 223, 84, 89, 64, 239, 163, 22, 0, 100, 27, 138, 239, 160, 120, 242, 212, 129, 199, 28, 143, 175, 21, 79,
-    117, 41, 246, 230, 197, 240, 47, 11, 83, 127, 6, 11, 28, 147, 234, 9, 150, 106, 22, 223, 248, 237, 135, 123, 80,
-    203, 40, 196, 121, 215, 15, 11, 218, 97, 22, 110, 168, 80, 186, 189, 175, 244, 200, 200, 242, 19, 127, 0, 207, 238,
-    129, 46, 13, 7, 151, 36, 91, 95, 40, 253, 161, 126, 253, 3, 200, 237, 118, 38, 15, 14, 207, 5, 42, 156, 108, 218,
-    186, 238, 226, 46, 17, 249, 128, 75, 24, 244, 132, 69, 227, 217, 133, 1, 232, 38, 62, 210, 64, 127, 183, 169, 250,
-    134, 249, 93, 84, 244, 2, 68, 65, 197, 4, 240, 108, 147, 36, 241, 81, 49, 75, 142, 122, 55, 200, 236, 105, 37, 11,
-    195, 26, 90, 12, 137, 121, 11, 116, 211, 117, 230, 229, 231, 237, 42, 177, 166, 69, 7, 168, 89, 159, 105, 209, 226,
-    186, 6, 184, 55, 145, 29, 138, 102, 43, 93, 255, 130, 239, 27, 104, 82, 208, 88, 237, 175, 103, 21, 55, 67, 138, 2,
-    176, 103, 69, 4, 89, 144, 52, 136, 131, 232, 60, 248, 28, 246, 247, 113, 18, 77, 212, 84, 120, 127, 51, 79, 188, 73,
-    158, 160, 24, 218, 109, 42, 214, 11, 116, 25, 223, 254, 36, 39, 26, 251, 116, 246, 110, 229, 172, 151, 141, 43, 48,
-    117, 244, 228, 200, 245, 8, 111, 242, 114, 188, 108, 218, 199, 214, 79, 68, 206, 206, 142, 199, 239, 41, 16, 144,
-    27, 164, 94, 180, 174, 88, 223, 124, 255, 6, 234, 0, 158, 58, 197, 2, 105, 104, 178, 232, 172, 108, 143, 187, 22,
-    131, 37, 48, 167, 169, 25, 246, 145, 178, 249, 185, 162, 165, 255, 184, 247, 132, 255, 31, 234, 202, 10, 1, 124, 6,
-    127, 10, 148, 27, 112, 82, 85, 190, 81, 251, 194, 55, 229, 113, 40, 54, 171, 35, 245, 101, 233, 162, 213, 30, 142,
-    155, 149, 233, 192, 155, 237, 213, 205, 6, 96, 6, 230, 51, 123, 122, 33, 53, 233, 163, 42, 197, 152, 211, 54, 51,
-    143, 105, 230, 153, 156, 21, 9, 121, 127, 100, 60, 163, 204, 47, 108, 136, 230, 200, 156, 204, 204, 125, 6, 57, 244,
-    6, 11, 108, 220, 120, 34, 237, 16, 232, 116, 220, 55, 17, 130, 225, 27, 112, 207, 84, 201, 173, 196, 255, 35, 116,
-    190, 195, 117, 121, 44, 162, 185, 41, 203, 97, 4, 250, 12, 255, 242, 217, 114, 12, 96, 73, 248, 219, 5, 30, 234,
-    201, 243, 51, 129, 224, 59, 173, 219, 215, 212, 238, 117, 214, 205, 178, 207, 180, 180, 245, 221, 101, 26, 159, 204,
-    39, 241, 35, 204, 253, 28, 202, 117, 92, 48, 235, 195, 174, 34, 74, 188, 235, 104, 207, 243, 117, 2, 71, 225, 60, 1,
-    223, 231, 82, 95, 139, 136, 99, 38, 160, 22, 133, 165, 213, 110, 141, 27, 125, 52, 126, 87, 65, 211, 52, 114, 229,
-    244, 61, 22, 32, 141, 145, 69, 247, 143, 203, 65, 130, 82, 0, 35, 233, 190, 73, 109, 189, 47, 220, 179, 121, 155,
-    148, 46, 219, 36, 122, 243, 163, 80, 118, 53, 79, 136, 138, 205, 132, 112, 177, 13, 236, 86, 171, 71, 63, 161, 4,
-    191, 116, 59, 174, 211, 55, 84, 106, 222, 253, 144, 120, 187, 220, 236, 86, 113, 141, 204, 181, 49, 187, 27, 123,
-    160, 31, 103, 148, 120, 149, 77, 210, 92, 252, 34, 230, 241, 246, 222, 159, 116, 179, 139, 143, 93, 172, 159, 59,
-    231, 19, 78, 71, 232, 234, 47, 102, 131, 122, 86, 65, 119, 187, 217, 223, 94, 144, 185, 33, 151, 70, 118, 37, 6,
-    169, 192, 168, 16, 104, 43, 75, 27, 252, 91, 60, 176, 41, 106, 218, 247, 149, 103, 121, 39, 68, 128, 194, 228, 180,
-    221, 255, 219, 108, 65, 63, 42, 68, 175, 67, 194, 10, 90, 46, 248, 111, 226, 164, 12, 118, 181, 93, 228, 82, 102,
-    110, 84, 149, 115, 175, 54, 252, 165, 211, 214, 43, 96, 212, 74, 161, 248, 87, 61, 220, 120, 206, 164, 72, 82, 33,
-    232, 134, 33, 17, 10, 225, 54, 160, 177, 175, 92, 182, 230, 40, 44, 98, 94, 27, 103, 251, 67, 85, 78, 31, 6, 158,
-    236, 188, 65, 216, 73, 1, 216, 199, 186, 27, 181, 88, 114, 19, 235, 243, 131, 101, 214, 116, 12, 55, 69, 243, 89, 2,
-    3, 241, 230, 242, 187, 83, 70, 14, 242, 166, 23, 133, 68, 116, 25, 30, 123, 117, 16, 76, 29, 200, 232, 99, 237, 190,
-    101, 6, 162, 117, 44, 98, 101, 48, 46, 219, 38, 96, 9, 14, 19, 135, 25, 65, 196, 140, 196, 100, 111, 47, 242, 34,
-    199, 34, 67, 138, 48, 94, 227, 231, 93, 152, 144, 39, 188, 193, 100, 121, 57, 143, 144, 119, 201, 98, 179, 67, 249,
-    227, 46, 179, 247, 112, 183, 212, 226, 37, 193, 32, 214, 103, 163, 165, 144, 57, 67, 130, 126, 138, 115, 70, 212,
-    182, 166, 49, 66, 232, 238, 197, 117, 155, 226, 172, 220, 79, 158, 12, 41, 7, 85, 126, 185, 191, 210, 233, 228, 77,
-    134, 219, 253, 102, 110, 96, 45, 207, 123, 75, 86, 154, 166, 126, 70, 148, 187, 195, 26, 128, 106, 155, 32, 139, 77,
-    136, 59, 9, 102, 79, 215, 174, 97, 62, 188, 167, 155, 105, 128, 195, 201, 40, 132, 201, 230, 151, 77, 212, 244, 137,
-    94, 131, 84, 33, 97, 43, 118, 239, 111, 111, 112, 242, 236, 174, 211, 129, 172, 83, 207, 109, 170, 22, 152, 144,
-    156, 46, 220, 169, 170, 151, 129, 145, 11, 54, 231, 217, 145, 253, 154, 76, 139, 47, 206, 218, 59, 67, 64, 111, 7,
-    146, 22, 29, 153, 209, 55, 56, 210, 10, 15, 164, 199, 50, 4, 245, 114, 253, 1, 150, 246, 153, 68, 91, 72, 171, 229,
-    218, 230, 202, 243, 187, 112, 28, 182, 222, 83, 162, 181, 31, 181, 20, 139, 214, 82, 196, 6, 200, 12, 60, 178, 105,
-    245, 243, 173, 250, 91, 48, 186, 199, 223, 3, 63, 21, 213, 172, 245, 6, 249, 64, 90, 13, 246, 247, 87, 34, 197, 103,
-    178, 51, 165, 247, 248, 191, 173, 227, 177, 151, 12, 25, 46, 168, 111, 113, 117, 143, 85, 19, 125, 121, 65, 134, 26,
-    254, 83, 117, 231, 89, 122, 239, 191, 99, 234, 21, 203, 145, 219, 58, 113, 99, 21, 86, 74, 221, 107, 64, 151, 87,
-    213, 17, 136, 132, 52, 123, 2, 251, 255, 160, 53, 212, 175, 220, 20, 145, 63, 66, 151, 106, 133, 200, 159, 147, 13,
-    201, 27, 70, 127, 248, 144, 66, 15, 204, 53, 53, 194, 228, 74, 111, 75, 6, 165, 10, 157, 174, 215, 16, 224, 181, 73,
-    67, 235, 156, 47, 204, 23, 13, 200, 87, 12, 147, 152, 241, 96, 43, 165, 28, 95, 1, 139, 71, 114, 117, 116, 144, 107,
-    11, 233, 196, 78, 172, 123, 210, 22, 111, 218, 71, 99, 247, 97, 110, 39, 9, 15, 80, 24, 180, 194, 27, 12, 14, 137,
-    97, 38, 148, 159, 61, 123, 107, 170, 31, 243, 198, 99, 190, 21, 167, 91, 183, 131, 149, 61, 153, 202, 21, 92, 163,
-    81, 71, 107, 141, 129, 74, 40, 111, 225, 175, 76, 13, 195, 180, 187, 96, 35, 225, 149, 163, 0, 243, 172, 118, 154,
-    36, 96, 230, 250, 250, 215, 181, 140, 82, 88, 230, 22, 128, 111, 178, 171, 140, 28, 45, 143, 14, 102, 93, 115, 79,
-    10, 31, 197, 174, 64, 173, 130, 220, 231, 171, 150, 117, 154, 69, 215, 250, 20, 174, 159, 115, 209, 13, 195, 76,
-    207, 201, 170, 200, 97, 139, 232, 67, 239, 67, 7, 74, 51, 133, 209, 47, 83, 163, 52, 85, 176, 219, 198, 83, 44, 163,
-    189, 142, 14, 19, 214, 250, 182, 233, 161, 64, 126, 89, 37, 144, 164, 235, 111, 66, 49, 170, 28, 123, 85, 221, 59,
-    43, 101, 180, 18, 239, 28, 120, 13, 100, 170, 118, 81, 32, 205, 158, 222, 140, 80, 107, 248, 34, 118, 65, 223, 142,
-    125, 55, 73, 24, 47, 49, 204, 145, 251, 42, 85, 51, 244, 238, 105, 255, 57, 243, 66, 218, 13, 46, 125, 183, 210,
-    248, 211, 59, 158, 146, 72, 220, 124, 112, 89, 186, 187, 41, 184, 234, 68, 102, 251, 182, 54, 251, 249, 227, 152,
-    205, 2, 244, 161, 228, 208, 2, 87, 136, 228, 201, 192, 62, 140, 15, 204, 93, 6, 118, 17, 134, 239, 221, 225, 17, 6,
-    124, 106, 1, 56, 27, 85, 186, 60, 228, 179, 73, 81, 226, 186, 115, 153, 232, 64, 238, 183, 49, 212, 243, 132, 235,
-    155, 200, 71, 184, 54, 103, 143, 158, 120, 75, 165, 60, 237, 213, 178, 34, 38, 112, 219, 86, 145, 202, 187, 146,
-    147, 32, 38, 17, 91, 152, 30, 172, 52, 8, 28, 34, 86, 7, 235, 111, 142, 47, 192, 42, 121, 95, 59, 237, 108, 173,
-    220, 195, 59, 101, 182, 174, 201, 197, 34, 41, 232, 198, 196, 12, 59, 202, 48, 131, 160, 7, 159, 29, 21, 183, 161,
-    201, 250, 191, 40, 215, 134, 60, 116, 94, 245, 92, 155, 20, 230, 135, 27, 54, 7, 173, 210, 158, 65, 37, 95, 125,
-    230, 240, 97, 81, 249, 8, 1, 223, 252, 100, 177, 174, 84, 199, 128, 71, 250, 215, 33, 173, 100, 66, 34, 103, 19, 23,
-    235, 65, 13, 138, 41, 91, 108, 111, 147, 116, 165, 222, 219, 249, 20, 253, 188, 177, 211, 88, 103, 196, 243, 107,
-    147, 123, 83, 73, 57, 119, 152, 8, 30, 165, 190, 23, 60, 203, 65, 177, 58, 204, 245, 20, 16, 38, 12, 114, 94, 190,
-    118, 135, 45, 29, 176, 145, 174, 252, 166, 224, 241, 104, 113, 185, 193, 83, 47, 193, 142, 67, 203, 187, 77, 103,
-    96, 35, 241, 213, 13, 12, 8, 74, 206, 5, 93, 11, 246, 174, 47, 194, 203, 72, 122, 29, 215, 174, 183, 123, 86, 189,
-    155, 79, 216, 198, 254, 209, 223, 183, 206, 38, 218, 248, 44, 188, 196, 126, 234, 8, 38, 112, 224, 22, 36, 195, 75,
-    4, 0, 86, 181, 203, 217, 73, 1, 231, 81, 59, 228, 96, 36, 108, 255, 4, 237, 172, 88, 252, 7, 45, 120, 248, 155, 56,
-    140, 52, 186, 142, 78, 201, 234, 52, 137, 134, 15, 231, 40, 65, 180, 51, 209, 121, 183, 153, 49, 182, 122, 255, 39,
-    251, 250, 20, 129, 103, 99, 10, 123, 210, 189, 36, 165, 149, 255, 12, 38, 229, 157, 162, 215, 184, 215, 193, 240,
-    113, 148, 71, 2, 214, 23, 233, 73, 240, 89, 206, 159, 61, 165, 44, 90, 45, 159, 125, 237, 89, 70, 120, 167, 162,
-    180, 126, 141, 167, 15, 28, 231, 229, 98, 209, 5, 187, 154, 121, 185, 209, 63, 81, 247, 184, 147, 246, 76, 159, 127,
-    242, 127, 192, 132, 216, 14, 93, 197, 62, 183, 91, 198, 157, 113, 82, 165, 130, 116, 184, 223, 57, 148, 24, 143,
-    191, 35, 179, 187, 252, 60, 241, 212, 234, 181, 38, 145, 209, 196, 13, 167, 231, 239, 1, 22, 191, 30, 108, 94, 202,
-    206, 26, 69, 126, 216, 90, 80, 173, 94, 197, 132, 5, 48, 185, 136, 187, 0, 101, 12, 206, 59, 224, 23, 195, 60, 57,
-    161, 26, 18, 87, 127, 251, 221, 60, 245, 23, 249, 225, 126, 245, 102, 204, 71, 63, 43, 167, 84, 34, 61, 135, 124,
-    192, 108, 142, 13, 177, 169, 62, 233, 110, 60, 175, 113, 131, 50, 246, 144, 123, 96, 43, 164, 211, 194, 0, 152, 94,
-    106, 162, 235, 15, 110, 2, 138, 238, 42, 92, 250, 151, 73, 147, 243, 114, 202, 129, 92, 17, 180, 201, 172, 48, 233,
-    219, 43, 229, 180, 0, 234, 50, 41, 48, 18, 71, 170, 5, 78, 151, 106, 116, 63, 200, 40, 91, 209, 124, 43, 144, 164,
-    247, 47, 124, 71, 208, 130, 97, 19, 105, 81, 119, 140, 90, 213, 81, 112, 88, 183, 202, 141, 245, 172, 213, 134, 204,
-    90, 48, 108, 1, 214, 88, 59, 160, 102, 118, 151, 186, 201, 94, 81, 230, 124, 26, 179, 24, 14, 157, 160, 44, 213, 71,
-    27, 121, 228, 86, 192, 101, 194, 202, 10, 245, 109, 21, 6, 214, 23, 80, 85, 215, 71, 13, 213, 167, 241, 166, 82,
-    213, 245, 230, 88, 158, 227, 171, 181, 28, 124, 37, 24, 110, 180, 12, 6, 211, 0, 245, 29, 33, 66, 230, 201, 229, 76,
-    98, 11, 164, 11, 103, 66, 157, 4, 123, 53, 160, 83, 77, 152, 227, 191, 115, 106, 146, 0, 204, 189, 185, 226, 151,
-    104, 20, 20, 216, 216, 213, 130, 194, 118, 161, 198, 18, 50, 150, 138, 241, 152, 203, 37, 143, 10, 153, 50, 125, 24,
-    197, 111, 117, 212, 6, 25, 192, 0, 187, 153, 11, 240, 227, 170, 253, 192, 174, 154, 73, 62, 131, 251, 89, 253, 233,
-    83, 169, 170, 94, 252, 83, 198, 159, 134, 169, 16, 102, 24, 53, 20, 178, 252, 233, 51, 161, 91, 53, 74, 116, 108,
-    122, 3, 83, 22, 164, 235, 63, 37, 27, 208, 111, 37, 98, 104, 101, 116, 110, 60, 68, 70, 204, 88, 9, 104, 199, 74,
-    95, 48, 117, 231, 96, 76, 218, 177, 105, 202, 217, 176, 253, 237, 232, 177, 38, 153, 62, 194, 136, 237, 1, 113, 17,
-    83, 36, 65, 155, 123, 1, 69, 235, 209, 80, 48, 247, 171, 205, 134, 100, 106, 16, 139, 182, 119, 218, 24, 8, 35, 251,
-    238, 120, 194, 53, 93, 212, 79, 183, 205, 141, 184, 17, 109, 231, 67, 36, 135, 160, 77, 162, 33, 139, 9, 103, 141,
-    104, 99, 73, 214, 28, 207, 255, 219, 144, 43, 44, 201, 58, 24, 60, 166, 180, 169, 132, 143, 37, 192, 113, 227, 212,
-    148, 23, 167, 201, 65, 190, 161, 88, 19, 192, 24, 236, 179, 253, 199, 184, 118, 1, 38, 247, 224, 27, 216, 194, 38,
-    116, 103, 25, 21, 10, 228, 13, 235, 249, 143, 247, 37, 88, 172, 126, 190, 55, 196, 200, 142, 21, 26, 96, 195, 222,
-    184, 82, 61, 119, 174, 14, 69, 64, 21, 65, 129, 107, 181, 164, 2, 105, 64, 123, 129, 130, 209, 227, 11, 207, 206,
-    189, 117, 211, 124, 218, 19, 218, 22, 82, 217, 63, 133, 186, 235, 99, 85, 246, 111, 60, 228, 28, 80, 84, 4, 225, 7,
-    78, 3, 145, 230, 81, 249, 27, 151, 50, 174, 35, 25, 199, 1, 200, 101, 102, 78, 105, 219, 169, 121, 242, 186, 87, 72,
-    37, 67, 78, 83, 147, 58, 107, 135, 206, 32, 147, 117, 7, 123, 201, 162, 120, 58, 196, 68, 211, 109, 208, 163, 254,
-    168, 18, 120, 28, 104, 189, 162, 20, 206, 227, 69, 148, 17, 26, 116, 255, 103, 211, 184, 238, 224, 160, 141, 59, 49,
-    191, 185, 169, 28, 175, 105, 140, 80, 10, 104, 18, 11, 2, 251, 43, 168, 79, 227, 2, 231, 158, 17, 17, 74, 202, 139,
-    150, 54, 152, 51, 88, 122, 105, 79, 130, 70, 254, 209, 120, 122, 122, 170, 121, 60, 250, 151, 9, 130, 220, 170, 45,
-    219, 53, 114, 43, 176, 87, 77, 53, 64, 100, 124, 231, 142, 31, 158, 6, 251, 134, 126, 169, 35, 189, 181, 181, 204,
-    150, 124, 126, 40, 138, 15, 5, 237, 60, 18, 53, 69, 163, 145, 80, 194, 68, 254, 25, 19, 104, 84, 136, 8, 59, 35,
-    226, 74, 105, 60, 48, 133, 8, 127, 125, 232, 87, 246, 213, 114, 57, 147, 51, 199, 241, 237, 71, 121, 95, 210, 12,
-    117, 55, 86, 162, 95, 114, 87, 246, 14, 16, 218, 108, 152, 123, 83, 153, 130, 61, 45, 53, 85, 22, 39, 143, 69, 104,
-    5, 45, 177, 141, 123, 247, 112, 42, 1, 65, 6, 232, 251, 60, 66, 172, 222, 105, 106, 249, 133, 147, 63, 77, 18, 205,
-    162, 47, 15, 209, 143, 32, 12, 101, 122, 246, 93, 16, 82, 25, 108, 139, 99, 209, 233, 158, 64, 11, 30, 69, 249, 220,
-    19, 242, 52, 127, 35, 230, 208, 241, 59, 109, 75, 248, 171, 98, 52, 26, 192, 123, 177, 76, 213, 51, 229, 231, 57,
-    181, 144, 81, 62, 39, 70, 127, 54, 0, 52, 58, 41, 148, 0, 200, 165, 60, 33, 69, 202, 155, 138, 195, 183, 34, 52,
-    236, 246, 74, 74, 55, 25, 73, 132, 236, 146, 92, 139, 124, 20, 75, 75, 0, 111, 179, 18, 149, 142, 214, 53, 110, 3,
-    161, 77, 34, 112, 195, 241, 112, 36, 165, 112, 84, 80, 203, 2, 8, 204, 223, 182, 169, 116, 122, 159, 180, 112, 117,
-    183, 202, 134, 209, 233, 18, 79, 131, 218, 83, 214, 254, 170, 44, 216, 125, 92, 74, 46, 219, 131, 230, 36, 168, 145,
-    86, 249, 71, 46, 17, 134, 4, 137, 249, 213, 148, 229, 0, 1, 181, 248, 146, 229, 219, 107, 35, 108, 147, 149, 29,
-    193, 214, 165, 188, 115, 147, 194, 231, 180, 0, 139, 203, 226, 163, 84, 255, 10, 146, 116, 92, 166, 236, 74, 44, 82,
-    84, 62, 97, 36, 166, 32, 22, 209, 74, 91, 30, 209, 225, 85, 113, 62, 228, 19, 212, 223, 3, 57, 3, 50, 130, 26, 49,
-    76, 51, 185, 211, 138, 59, 135, 50, 239, 217, 146, 175, 130, 40, 19, 71, 179, 106, 231, 140, 203, 45, 207, 19, 122,
-    63, 190, 11, 85, 155, 22, 142, 68, 197, 126, 180, 157, 238, 28, 135, 246, 107, 189, 141, 52, 35, 108, 87, 8, 111, 8,
-    92, 92, 252, 168, 191, 144, 65, 7, 103, 27, 16, 48, 49, 45, 67, 124, 104, 175, 80, 5, 218, 18, 242, 199, 7, 251, 83,
-    217, 199, 145, 189, 242, 79, 25, 150, 152, 170, 179, 169, 159, 96, 178, 211, 49, 113, 45, 239, 23, 108, 250, 95,
-    233, 119, 177, 189, 22, 210, 67, 153, 194, 217, 129, 64, 164, 235, 89, 122, 223, 22, 130, 32, 164, 175, 141, 23, 58,
-    92, 236, 156, 12, 201, 187, 207, 81, 177, 154, 233, 141, 206, 42, 134, 72, 102, 75, 56, 117, 125, 151, 65, 119, 121,
-    80, 34, 154, 62, 74, 189, 42, 87, 75, 231, 89, 233, 11, 141, 135, 11, 13, 62, 243, 11, 238, 155, 94, 18, 167, 225,
-    210, 183, 128, 218, 120, 103, 37, 5, 105, 83, 111, 142, 120, 194, 126, 14, 59, 155, 17, 21, 103, 128, 152, 123, 123,
-    199, 232, 51, 65, 240, 173, 95, 50, 167, 227, 174, 158, 140, 97, 151, 231, 37, 76, 63, 201, 70, 86, 205, 252, 231,
-    91, 149, 255, 115, 204, 239, 118, 217, 37, 146, 48, 190, 93, 51, 35, 176, 101, 199, 213, 66, 82, 150, 37, 152, 114,
-    60, 1, 30, 165, 252, 189, 119, 59, 76, 62, 216, 171, 24, 157, 87, 174, 70, 203, 21, 201, 237, 18, 237, 171, 147,
-    134, 36, 83, 232, 161, 34, 253, 142, 82, 174, 60, 247, 94, 153, 96, 252, 103, 161, 125, 54, 166, 108, 57, 253, 121,
-    95, 78, 184, 38, 83, 84, 227, 106, 113, 79, 206, 13, 173, 73, 228, 198, 45, 117, 90, 28, 120, 136, 243, 233, 63, 1,
-    200, 228, 132, 172, 0, 135, 73, 28, 127, 226, 58, 45, 230, 248, 49, 132, 27, 73, 159, 226, 155, 137, 104, 183, 182,
-    28, 90, 193, 17, 2, 253, 141, 221, 32, 13, 109, 233, 90, 169, 2, 229, 79, 127, 97, 12, 99, 97, 167, 132, 110, 185,
-    51, 204, 139, 221, 85, 10, 111, 90, 82, 254, 71, 173, 160, 95, 142, 82, 92, 20, 69, 85, 75, 237, 204, 159, 87, 123,
-    129, 113, 138, 149, 174, 164, 56, 137, 8, 218, 217, 5, 45, 26, 233, 16, 220, 25, 196, 202, 200, 112, 17, 138, 224,
-    80, 8, 224, 129, 37, 83, 255, 223, 17, 66, 113, 89, 105, 247, 214, 165, 26, 128, 49, 225, 222, 174, 184, 183, 106,
-    129, 156, 29, 159, 41, 1, 138, 163, 161, 200, 92, 113, 220, 39, 254, 72, 244, 21, 105, 73, 41, 76, 64, 23, 166, 30,
-    92, 224, 248, 86, 67, 44, 141, 17, 205, 205, 78, 129, 199, 134, 63, 55, 232, 81, 202, 135, 42, 190, 28, 11, 195, 64,
-    218, 253, 108, 76, 132, 231, 193, 205, 68, 176, 106, 68, 231, 62, 124, 81, 222, 238, 250, 209, 64, 208, 254, 230,
-    176, 245, 219, 4, 12, 62, 90, 124, 245, 230, 181, 180, 106, 181, 191, 225, 208, 98, 254, 204, 201, 183, 78, 71, 214,
-    233, 32, 106, 227, 141, 145, 7, 63, 46, 83, 73, 249, 97, 223, 218, 145, 152, 40, 59, 123, 208, 133, 34, 142, 98,
-    200, 31, 146, 227, 227, 85, 172, 101, 53, 126, 180, 139, 133, 204, 175, 169, 231, 90, 249, 124, 21, 176, 84, 122,
-    195, 241, 144, 56, 220, 59, 236, 201, 174, 129, 180, 83, 49, 228, 135, 173, 29, 242, 205, 193, 252, 206, 72, 226,
-    144, 208, 36, 15, 225, 234, 102, 187, 40, 92, 242, 10, 39, 62, 24, 198, 10, 121, 60, 49, 35, 129, 190, 113, 80, 68,
-    253, 177, 111, 252, 37, 150, 73, 248, 207, 103, 1, 25, 91, 31, 68, 91, 31, 162, 249, 89, 83, 202, 234, 151, 81, 117,
-    229, 72, 251, 178, 80, 143, 228, 14, 19, 133, 51, 181, 201, 59, 8, 248, 144, 39, 80, 83, 236, 239, 68, 180, 177, 73,
-    252, 29, 43, 107, 12, 52, 171, 170, 125, 99, 212, 130, 233, 234, 87, 219, 151, 245, 63, 26, 169, 200, 109, 230, 69,
-    165, 30, 160, 48, 80, 4, 183, 114, 92, 90, 71, 148, 95, 160, 218, 167, 126, 200, 46, 109, 57, 78, 47, 211, 60, 49,
-    118, 7, 150, 174, 227, 54, 108, 113, 1, 226, 65, 130, 59, 47, 7, 156, 156, 71, 3, 214, 39, 196, 28, 104, 117, 62,
-    243, 183, 28, 24, 97, 56, 34, 150, 120, 166, 168, 86, 6, 161, 55, 10, 118, 168, 67, 140, 243, 178, 183, 24, 53, 4,
-    75, 50, 134, 168, 124, 10, 252, 127, 85, 52, 23, 118, 1, 207, 116, 251, 11, 19, 83, 213, 12, 66, 200, 247, 37, 250,
-    6, 141, 208, 144, 44, 153, 224, 22, 235, 3, 79, 233, 41, 203, 198, 50, 135, 120, 159, 42, 37, 47, 204, 94, 50, 105,
-    102, 106, 184, 153, 5, 13, 114, 22, 176, 167, 115, 255, 2, 31, 4, 209, 141, 90, 94, 230, 139, 209, 152, 125, 124,
-    224, 212, 40, 31, 24, 22, 197, 167, 148, 86, 184, 213, 231, 5, 181, 29, 234, 202, 93, 249, 10, 45, 71, 41, 243, 138,
-    35, 64, 76, 42, 160, 141, 28, 145, 2, 125, 22, 7, 179, 115, 86, 36, 80, 216, 242, 36, 75, 83, 17, 198, 26, 171, 91,
-    190, 47, 67, 142, 57, 37, 33, 40, 92, 96, 70, 73, 222, 204, 156, 134, 145, 175, 208, 11, 176, 114, 136, 159, 35,
-    103, 29, 137, 136, 115, 121, 210, 67, 42, 224, 205, 45, 2, 126, 167, 186, 9, 249, 215, 183, 139, 93, 192, 217, 187,
-    243, 164, 112, 167, 247, 115, 244, 73, 67, 136, 101, 25, 147, 64, 62, 222, 210, 160, 185, 251, 87, 63, 191, 194,
-    233, 182, 113, 186, 195, 86, 235, 221, 207, 209, 56, 2, 158, 104, 2, 82, 209, 253, 137, 255, 144, 158, 236, 27, 90,
-    101, 75, 38, 78, 67, 20, 50, 167, 62, 188, 182, 67, 173, 192, 185, 105, 125, 198, 154, 86, 96, 57, 11, 114, 187,
-    158, 7, 134, 30, 225, 75, 20, 40, 131, 161, 62, 166, 136, 170, 154, 193, 203, 172, 70, 177, 243, 31, 242, 50, 149,
-    205, 183, 220, 129, 158, 199, 171, 228, 86, 230, 26, 211, 173, 152, 138, 61, 186, 208, 13, 8, 65, 25, 235, 114, 242,
-    103, 179, 214, 151, 66, 109, 217, 5, 213, 107, 178, 22, 31, 152, 34, 84, 120, 185, 98, 128, 222, 154, 35, 37, 17,
-    231, 94, 191, 247, 167, 33, 193, 238, 36, 11, 150, 19, 167, 199, 253, 32, 50, 12, 157, 125, 131, 6, 74, 171, 58,
-    104, 251, 29, 130, 179, 43, 78, 174, 42, 246, 59, 71, 188, 219, 232, 12, 135, 154, 223, 39, 128, 196, 158, 105, 115,
-    198, 9, 207, 171, 4, 229, 56, 220, 123, 69, 89, 239, 210, 181, 31, 244, 72, 129, 158, 63, 7, 130, 43, 61, 108, 209,
-    242, 115, 42, 198, 202, 42, 5, 58, 158, 29, 253, 217, 60, 149, 56, 228, 14, 214, 170, 77, 105, 116, 67, 143, 62,
-    105, 144, 142, 184, 126, 128, 200, 18, 80, 52, 160, 216, 141, 186, 156, 66, 201, 179, 210, 35, 54, 164, 216, 215,
-    206, 182, 81, 27, 30, 3, 92, 1, 222, 203, 125, 47, 85, 216, 66, 52, 194, 211, 199, 234, 47, 148, 53, 42, 43, 143, 6,
-    139, 122, 85, 170, 171, 113, 130, 89, 120, 250, 83, 207, 153, 1, 174, 181, 254, 181, 191, 244, 129, 57, 41, 51, 157,
-    56, 92, 210, 25, 37, 248, 41, 101, 40, 12, 136, 68, 96, 196, 137, 18, 126, 82, 27, 122, 0, 70, 251, 8, 37, 91, 22,
-    235, 248, 106, 210, 74, 97, 142, 112, 177, 153, 126, 195, 157, 166, 145, 147, 188, 83, 71, 81, 101, 13, 11, 0, 185,
-    101, 147, 238, 217, 50, 202, 5, 69, 119, 239, 48, 32, 103, 45, 45, 176, 228, 146, 220, 107, 244, 249, 153, 57, 122,
-    137, 105, 14, 25, 119, 53, 201, 103, 195, 230, 55, 20, 196, 27, 21, 251, 77, 139, 101, 172, 19, 169, 17, 154, 116,
-    56, 212, 181, 108, 236, 220, 233, 254, 74, 144, 3, 42, 244, 117, 115, 43, 49, 147, 219, 88, 182, 157, 126, 252, 75,
-    155, 104, 14, 173, 56, 231, 78, 146, 188, 219, 227, 180, 225, 221, 53, 202, 56, 0, 38, 233, 157, 62, 43, 223, 56,
-    106, 117, 49, 13, 39, 76, 68, 125, 26, 14, 75, 232, 228, 80, 35, 116, 2, 224, 73, 87, 233, 227, 160, 7, 117, 254,
-    112, 51, 114, 19, 196, 24, 171, 38, 87, 94, 12, 46, 7, 238, 65, 84, 211, 114, 20, 98, 90, 99, 113, 109, 111, 3, 53,
-    12, 91, 57, 52, 130, 109, 51, 248, 181, 4, 125, 85, 6, 153, 58, 179, 38, 22, 98, 98, 35, 37, 119, 150, 148, 249,
-    199, 8, 213, 25, 142, 121, 61, 245, 21, 239, 114, 85, 23, 43, 157, 72, 83, 49, 4, 173, 112, 215, 199, 186, 76, 42,
-    67, 71, 173, 86, 186, 158, 54, 73, 186, 224, 96, 214, 205, 161, 60, 241, 199, 131, 224, 118, 5, 62, 56, 140, 132, 9,
-    129, 209, 133, 133, 0, 205, 235, 55, 74, 147, 196, 155, 16, 205, 153, 226, 188, 64, 32, 72, 248, 20, 32, 171, 132,
-    150, 66, 69, 112, 147, 174, 152, 162, 26, 63, 79, 253, 56, 28, 60, 218, 168, 95, 104, 41, 42, 231, 165, 46, 186, 66,
-    121, 59, 214, 220, 88, 104, 151, 48, 206, 60, 13, 64, 102, 118, 182, 176, 106, 224, 49, 249, 33, 33, 111, 240, 64,
-    253, 193, 37, 217, 146, 130, 35, 13, 13, 17, 117, 112, 188, 135, 253, 186, 192, 219, 100, 244, 133, 211, 35, 15,
-    127, 158, 123, 59, 142, 25, 136, 245, 54, 66, 81, 69, 189, 253, 28, 181, 161, 77, 236, 250, 104, 170, 49, 39, 0, 74,
-    167, 80, 163, 225, 176, 120, 27, 36, 140, 126, 171, 242, 139, 146, 240, 169, 139, 146, 63, 77, 244, 232, 126, 199,
-    74, 211, 211, 43, 214, 195, 21, 99, 65, 61, 248, 17, 93, 137, 94, 185, 165, 149, 224, 80, 58, 182, 202, 2, 48, 127,
-    55, 118, 13, 235, 29, 29, 65, 131, 86, 132, 114, 217, 23, 178, 46, 174, 43, 63, 32, 7, 14, 132, 118, 63, 31, 151,
-    157, 15, 255, 87, 219, 255, 221, 251, 72, 78, 177, 209, 145, 15, 7, 77, 178, 8, 154, 87, 203, 47, 120, 202, 94, 143,
-    127, 17, 203, 12, 230, 1, 101, 214, 168, 40, 47, 168, 123, 20, 232, 233, 133, 139, 82, 181, 165, 241, 220, 235, 76,
-    61, 149, 106, 18, 168, 167, 80, 200, 73, 14, 70, 223, 244, 176, 88, 33, 77, 43, 239, 113, 108, 204, 171, 32, 135,
-    250, 40, 127, 11, 252, 14, 96, 146, 111, 241, 52, 193, 98, 152, 185, 115, 171, 203, 77, 188, 152, 76, 10, 49, 50,
-    205, 58, 101, 193, 228, 193, 156, 210, 29, 233, 134, 157, 179, 170, 48, 146, 31, 138, 127, 121, 193, 25, 169, 112,
-    2, 33, 133, 242, 233, 236, 241, 231, 47, 94, 179, 252, 196, 54, 107, 171, 193, 131, 253, 194, 142, 112, 237, 215,
-    136, 5, 55, 53, 1, 53, 235, 120, 27, 160, 59, 224, 202, 183, 116, 191, 133, 200, 89, 191, 103, 81, 188, 27, 153, 32,
-    163, 108, 123, 63, 21, 112, 199, 203, 131, 76, 34, 74, 176, 167, 246, 209, 52, 102, 154, 122, 31, 23, 98, 126, 134,
-    86, 232, 113, 85, 27, 226, 20, 236, 13, 108, 228, 131, 42, 94, 231, 145, 39, 5, 24, 211, 242, 227, 97, 132, 62, 169,
-    215, 64, 111, 186, 92, 129, 145, 216, 103, 34, 8, 12, 86, 110, 212, 118, 241, 222, 236, 115, 210, 45, 85, 254, 238,
-    138, 51, 30, 91, 73, 240, 198, 130, 60, 87, 250, 90, 80, 56, 66, 212, 117, 244, 83, 180, 43, 249, 97, 59, 132, 249,
-    140, 83, 213, 255, 135, 139, 228, 2, 42, 18, 201, 120, 198, 128, 203, 203, 59, 24, 100, 20, 6, 68, 185, 3, 107, 66,
-    162, 142, 78, 112, 179, 189, 238, 230, 231, 200, 143, 244, 68, 229, 113, 139, 215, 246, 41, 45, 174, 147, 154, 119,
-    184, 156, 91, 247, 160, 124, 67, 36, 253, 137, 60, 11, 178, 144, 0, 21, 164, 251, 125, 24, 91, 85, 117, 28, 96, 142,
-    193, 235, 215, 152, 92, 125, 242, 251, 77, 202, 17, 137, 84, 176, 91, 131, 98, 50, 76, 198, 22, 232, 111, 111, 124,
-    69, 164, 5, 27, 30, 195, 61, 170, 30, 89, 57, 55, 47, 14, 168, 13, 109, 183, 134, 221, 175, 45, 90, 136, 196, 194,
-    65, 95, 151, 248, 229, 238, 3, 158, 114, 177, 135, 10, 110, 157, 159, 59, 57, 85, 44, 14, 213, 43, 129, 2, 205, 49,
-    202, 102, 26, 241, 245, 42, 217, 16, 235, 5, 172, 181, 175, 1, 159, 220, 223, 73, 10, 238, 189, 191, 8, 120, 199,
-    10, 2, 149, 60, 12, 208, 153, 126, 121, 3, 155, 8, 254, 238, 211, 141, 92, 211, 0, 35, 104, 54, 250, 79, 224, 209,
-    14, 96, 83, 83, 84, 9, 59, 201, 226, 25, 64, 64, 38, 115, 89, 215, 71, 188, 119, 134, 95, 161, 233, 230, 29, 146, 4,
-    45, 89, 206, 157, 253, 145, 44, 82, 5, 33, 86, 205, 140, 48, 182, 39, 208, 170, 52, 96, 14, 61, 51, 69, 147, 249,
-    11, 231, 248, 108, 143, 86, 21, 104, 82, 170, 69, 62, 14, 137, 67, 64, 148, 95, 113, 230, 176, 60, 175, 133, 4, 189,
-    34, 128, 96, 198, 31, 172, 153, 137, 206, 223, 184, 247, 204, 223, 158, 5, 168, 144, 232, 29, 173, 173, 138, 71, 36,
-    139, 45, 87, 152, 79, 205, 124, 74, 216, 234, 117, 198, 63, 10, 205, 151, 113, 224, 7, 169, 13, 158, 94, 88, 59,
-    195, 167, 107, 153, 14, 155, 229, 210, 239, 105, 13, 251, 57, 169, 43, 140, 46, 251, 159, 242, 140, 53, 36, 210,
-    193, 60, 42, 111, 168, 35, 119, 17, 168, 118, 79, 145, 116, 117, 172, 113, 63, 111, 232, 198, 147, 102, 25, 184, 37,
-    30, 228, 166, 62, 230, 120, 111, 67, 135, 151, 173, 94, 87, 214, 166, 7, 58, 5, 141, 218, 87, 158, 118, 149, 11, 29,
-    87, 243, 133, 123, 45, 43, 127, 103, 30, 107, 11, 10, 178, 37, 45, 35, 30, 67, 222, 225, 16, 201, 113, 42, 118, 58,
-    106, 60, 60, 182, 228, 51, 210, 59, 197, 193, 179, 4, 86, 103, 91, 87, 249, 79, 76, 11, 239, 32, 254, 218, 50, 217,
-    254, 218, 135, 189, 67, 204, 157, 165, 218, 201, 127, 122, 207, 74, 254, 213, 179, 39, 46, 47, 121, 235, 184, 243,
-    48, 230, 98, 43, 216, 190, 241, 70, 75, 79, 231, 201, 246, 118, 79, 140, 236, 182, 81, 200, 220, 207, 23, 90, 96,
-    66, 29, 230, 25, 106, 97, 149, 109, 195, 94, 146, 73, 111, 49, 186, 91, 49, 158, 2, 10, 203, 21, 36, 110, 156, 17,
-    65, 229, 99, 203, 9, 105, 28, 50, 245, 19, 23, 221, 55, 128, 156, 126, 12, 82, 213, 155, 64, 91, 191, 193, 17, 191,
-    215, 239, 209, 61, 164, 196, 151, 158, 31, 17, 197, 200, 239, 71, 174, 211, 223, 139, 237, 60, 40, 27, 164, 142,
-    198, 253, 224, 93, 202, 220, 83, 143, 6, 205, 119, 37, 141, 232, 233, 238, 145, 124, 38, 4, 99, 162, 138, 174, 24,
-    7, 156, 249, 181, 1, 183, 21, 96, 164, 68, 10, 174, 61, 48, 219, 16, 103, 56, 238, 144, 100, 69, 168, 140, 20, 237,
-    171, 161, 193, 135, 117, 135, 207, 238, 205, 237, 171, 150, 30, 244, 95, 119, 27, 62, 221, 94, 169, 36, 150, 21,
-    195, 86, 57, 154, 239, 47, 110, 153, 16, 209, 255, 234, 35, 190, 201, 187, 79, 248, 178, 157, 98, 95, 174, 20, 212,
-    106, 114, 241, 84, 242, 200, 32, 77, 136, 216, 121, 162, 100, 249, 102, 235, 154, 137, 99, 26, 143, 21, 48, 0, 96,
-    32, 223, 199, 19, 250, 205, 31, 137, 2, 16, 62, 145, 65, 93, 57, 115, 79, 148, 87, 121, 178, 211, 201, 174, 125, 88,
-    105, 107, 208, 124, 160, 192, 77, 161, 54, 177, 124, 174, 18, 189, 239, 165, 186, 204, 229, 112, 94, 67, 42, 28, 44,
-    122, 223, 98, 117, 18, 147, 174, 40, 15, 214, 64, 232, 133, 113, 186, 119, 211, 212, 118, 147, 46, 114, 15, 155,
-    146, 44, 47, 32, 226, 13, 238, 66, 169, 98, 164, 154, 227, 166, 26, 26, 34, 223, 219, 157, 162, 76, 136, 72, 235,
-    169, 119, 226, 94, 191, 69, 129, 158, 229, 102, 24, 20, 170, 120, 238, 208, 100, 154, 57, 89, 117, 208, 105, 116,
-    105, 233, 122, 213, 226, 55, 19, 157, 137, 84, 36, 179, 68, 169, 29, 93, 20, 126, 7, 55, 208, 147, 89, 72, 27, 229,
-    38, 173, 252, 228, 137, 173, 223, 198, 134, 223, 135, 165, 77, 151, 250, 147, 196, 149, 45, 14, 56, 108, 220, 166,
-    19, 145, 177, 247, 198, 91, 182, 121, 181, 224, 81, 101, 219, 121, 217, 202, 181, 46, 178, 143, 139, 62, 249, 158,
-    12, 147, 153, 120, 117, 93, 163, 163, 58, 146, 72, 222, 10, 101, 96, 189, 83, 66, 66, 237, 17, 211, 169, 239, 140,
-    193, 163, 19, 160, 200, 252, 229, 75, 108, 54, 240, 241, 135, 198, 12, 63, 136, 98, 152, 172, 45, 89, 85, 64, 119,
-    124, 184, 176, 203, 104, 213, 82, 61, 87, 58, 89, 240, 10, 42, 187, 13, 189, 168, 173, 148, 108, 123, 167, 82, 244,
-    41, 168, 29, 12, 172, 49, 118, 45, 60, 8, 126, 123, 35, 31, 32, 162, 62, 192, 35, 193, 51, 11, 119, 1, 116, 67, 224,
-    65, 207, 140, 179, 239, 136, 169, 228, 240, 29, 115, 148, 18, 182, 61, 192, 1, 173, 96, 180, 118, 114, 151, 171, 62,
-    140, 90, 100, 129, 185, 128, 243, 83, 95, 98, 21, 17, 35, 236, 255, 130, 218, 237, 110, 69, 60, 27, 197, 156, 222,
-    49, 36, 116, 214, 158, 19, 217, 59, 107, 44, 224, 161, 61, 122, 164, 115, 9, 34, 75, 242, 228, 188, 162, 89, 2, 69,
-    144, 198, 161, 115, 124, 110, 31, 71, 19, 89, 34, 14, 191, 53, 189, 152, 72, 164, 160, 134, 207, 33, 249, 174, 100,
-    90, 189, 162, 10, 108, 191, 134, 32, 118, 254, 164, 90, 88, 111, 250, 62, 254, 7, 114, 5, 169, 98, 177, 245, 103,
-    152, 63, 15, 25, 9, 33, 18, 200, 174, 89, 185, 76, 54, 153, 230, 135, 28, 98, 243, 190, 201, 94, 154, 180, 210, 92,
-    169, 103, 224, 230, 199, 15, 211, 1, 107, 1, 44, 112, 162, 227, 2, 46, 35, 135, 2, 177, 11, 95, 177, 236, 35, 97,
-    17, 66, 22, 191, 215, 61, 169, 200, 213, 167, 6, 130, 120, 90, 62, 252, 106, 243, 221, 139, 4, 175, 101, 13, 188,
-    26, 167, 215, 191, 70, 20, 176, 62, 175, 9, 214, 139, 246, 241, 61, 9, 215, 106, 128, 61, 68, 228, 2, 21, 122, 181,
-    151, 182, 216, 170, 63, 125, 231, 31, 31, 146, 245, 248, 113, 188, 147, 237, 85, 138, 97, 146, 21, 154, 29, 201,
-    107, 237, 2, 118, 115, 217, 229, 157, 84, 58, 151, 135, 221, 241, 233, 69, 212, 85, 159, 225, 87, 76, 109, 97, 246,
-    147, 103, 29, 2, 28, 223, 34, 214, 230, 146, 94, 206, 246, 8, 190, 114, 164, 251, 19, 37, 206, 16, 160, 43, 167,
-    100, 17, 39, 90, 80, 57, 20, 222, 231, 50, 144, 201, 77, 168, 111, 225, 199, 109, 36, 68, 169, 26, 160, 119, 178,
-    222, 240, 171, 152, 68, 97, 126, 15, 35, 138, 13, 221, 79, 26, 0, 124, 86, 184, 67, 95, 88, 35, 157, 174, 227, 239,
-    220, 124, 154, 175, 209, 187, 47, 125, 118, 118, 0, 181, 9, 15, 163, 212, 243, 29, 206, 155, 123, 1, 94, 220, 168,
-    252, 113, 89, 166, 90, 10, 15, 90, 12, 159, 231, 66, 124, 79, 193, 15, 223, 236, 50, 80, 192, 244, 54, 184, 153, 82,
-    74, 170, 113, 177, 80, 221, 108, 205, 253, 10, 129, 16, 225, 123, 73, 79, 43, 174, 57, 189, 103, 54, 143, 224, 32,
-    154, 246, 14, 63, 34, 27, 190, 71, 182, 19, 27, 99, 95, 170, 98, 90, 239, 176, 88, 10, 171, 6, 198, 26, 1, 56, 174,
-    226, 232, 146, 175, 101, 229, 210, 236, 164, 220, 63, 102, 243, 34, 113, 225, 194, 177, 15, 147, 12, 31, 117, 67,
-    19, 80, 6, 11, 35, 0, 120, 139, 122, 221, 11, 62, 75, 202, 107, 208, 64, 75, 218, 205, 107, 107, 126, 155, 62, 71,
-    218, 171, 232, 16, 214, 76, 89, 233, 85, 95, 220, 46, 166, 173, 95, 149, 196, 109, 100, 176, 80, 0, 35, 236, 150,
-    130, 134, 63, 246, 2, 93, 14, 48, 108, 180, 8, 120, 239, 30, 31, 68, 242, 0, 75, 236, 247, 211, 190, 198, 115, 220,
-    226, 240, 146, 222, 64, 44, 131, 17, 8, 182, 105, 193, 159, 112, 45, 237, 81, 127, 204, 47, 221, 183, 163, 211, 229,
-    199, 120, 179, 159, 56, 251, 88, 98, 150, 209, 60, 166, 250, 241, 235, 46, 178, 8, 167, 44, 6, 147, 179, 5, 43, 183,
-    126, 143, 101, 139, 2, 46, 207, 240, 140, 118, 152, 248, 253, 115, 60, 99, 208, 48, 119, 60, 117, 196, 86, 164, 85,
-    179, 201, 163, 196, 247, 161, 81, 10, 0, 215, 217, 226, 173, 151, 136, 207, 201, 230, 160, 236, 217, 113, 93, 22,
-    239, 123, 3, 238, 142, 181, 72, 44, 254, 154, 28, 60, 233, 70, 195, 20, 140, 205, 29, 240, 163, 196, 144, 234, 130,
-    214, 32, 160, 4, 220, 214, 190, 67, 90, 170, 9, 151, 24, 106, 35, 250, 168, 162, 64, 19, 107, 244, 218, 12, 100,
-    101, 173, 220, 226, 172, 136, 229, 117, 162, 122, 29, 7, 39, 81, 185, 134, 162, 42, 98, 234, 23, 17, 44, 196, 53,
-    170, 94, 233, 46, 112, 43, 189, 128, 5, 79, 62, 41, 76, 10, 153, 141, 197, 32, 253, 250, 245, 127, 127, 201, 171,
-    225, 222, 162, 255, 228, 189, 23, 1, 203, 113, 110, 45, 171, 55, 210, 249, 73, 158, 176, 181, 27, 227, 239, 156,
-    254, 225, 247, 29, 184, 206, 45, 235, 11, 33, 138, 54, 29, 211, 23, 89, 132, 204, 108, 147, 223, 122, 249, 240, 155,
-    196, 79, 236, 0, 214, 175, 41, 79, 69, 236, 228, 115, 142, 29, 110, 69, 1, 10, 34, 195, 242, 200, 4, 133, 214, 252,
-    47, 113, 163, 198, 74, 242, 178, 228, 114, 234, 248, 31, 158, 179, 92, 32, 171, 11, 188, 143, 68, 214, 248, 140,
-    151, 227, 1, 227, 64, 252, 7, 197, 13, 103, 206, 198, 185, 84, 138, 90, 194, 113, 232, 121, 65, 34, 99, 153, 166,
-    203, 135, 247, 113, 78, 80, 229, 55, 174, 117, 61, 176, 33, 159, 12, 200, 224, 146, 214, 49, 86, 7, 12, 106, 139,
-    249, 88, 219, 25, 222, 57, 208, 164, 167, 128, 202, 251, 174, 76, 108, 2, 24, 120, 16, 180, 56, 73, 142, 236, 26,
-    123, 22, 232, 10, 45, 91, 119, 59, 14, 160, 124, 51, 223, 69, 116, 84, 116, 137, 35, 62, 193, 52, 156, 9, 215, 130,
-    45, 150, 186, 133, 188, 58, 73, 43, 41, 152, 110, 211, 139, 198, 247, 139, 41, 61, 122, 70, 193, 89, 71, 237, 106,
-    226, 171, 213, 123, 41, 174, 151, 238, 83, 96, 102, 81, 143, 96, 94, 236, 112, 244, 168, 220, 63, 52, 193, 7, 235,
-    14, 22, 155, 192, 154, 107, 98, 227, 168, 32, 96, 225, 109, 66, 196, 68, 199, 249, 106, 48, 45, 82, 23, 33, 3, 232,
-    169, 145, 126, 89, 0, 213, 240, 54, 58, 200, 112, 62, 80, 102, 42, 221, 223, 48, 169, 202, 102, 95, 192, 103, 85,
-    201, 219, 19, 219, 202, 89, 55, 44, 112, 15, 224, 196, 183, 98, 145, 156, 127, 48, 98, 65, 40, 12, 20, 197, 233, 47,
-    244, 143, 184, 198, 33, 37, 64, 236, 57, 205, 160, 218, 165, 23, 181, 53, 28, 0, 183, 239, 77, 229, 44, 228, 189,
-    233, 107, 161, 230, 60, 210, 108, 228, 5, 129, 189, 165, 104, 13, 108, 116, 201, 71, 87, 62, 168, 212, 197, 108,
-    143, 214, 210, 171, 46, 111, 228, 17, 244, 28, 250, 122, 152, 21, 158, 141, 12, 114, 194, 15, 214, 42, 172, 106,
-    105, 21, 59, 233, 171, 241, 23, 173, 10, 245, 198, 142, 23, 4, 246, 229, 18, 185, 155, 39, 204, 244, 88, 13, 196,
-    227, 145, 25, 251, 167, 128, 77, 7, 127, 117, 253, 148, 92, 58, 111, 253, 190, 228, 113, 234, 146, 211, 198, 120,
-    187, 104, 85, 134, 213, 194, 148, 49, 190, 70, 241, 182, 130, 29, 181, 217, 188, 18, 219, 184, 218, 238, 151, 195,
-    180, 172, 184, 2, 104, 94, 178, 18, 118, 199, 44, 238, 97, 211, 228, 53, 48, 142, 143, 55, 175, 210, 178, 48, 116,
-    182, 38, 244, 184, 197, 40, 32, 35, 145, 121, 65, 62, 190, 193, 5, 49, 106, 131, 8, 161, 136, 188, 71, 5, 69, 157,
-    127, 217, 219, 211, 124, 200, 51, 232, 218, 36, 205, 247, 226, 11, 75, 53, 216, 219, 191, 149, 254, 137, 234, 163,
-    208, 35, 192, 121, 133, 122, 165, 68, 224, 255, 116, 148, 126, 199, 97, 22, 42, 38, 69, 216, 255, 76, 229, 9, 208,
-    72, 128, 18, 230, 144, 48, 132, 183, 141, 241, 242, 202, 180, 240, 174, 237, 95, 16, 78, 249, 169, 8, 182, 78, 84,
-    191, 182, 177, 120, 42, 249, 135, 114, 60, 205, 109, 231, 184, 143, 95, 28, 88, 46, 64, 178, 69, 27, 182, 73, 2, 4,
-    132, 120, 169, 7, 174, 89, 81, 14, 192, 109, 13, 244, 12, 217, 167, 213, 73, 91, 255, 68, 60, 103, 0, 176, 125, 154,
-    8, 146, 4, 61, 236, 188, 174, 139, 86, 91, 146, 115, 114, 119, 64, 3, 161, 99, 135, 231, 10, 111, 132, 206, 111, 83,
-    222, 140, 37, 218, 95, 145, 29, 145, 244, 72, 98, 13, 55, 196, 50, 236, 202, 31, 245, 11, 222, 116, 202, 69, 169,
-    92, 5, 227, 130, 252, 187, 218, 97, 95, 153, 120, 213, 61, 10, 12, 85, 219, 116, 163, 237, 106, 248, 194, 184, 200,
-    118, 51, 0, 121, 101, 167, 56, 46, 42, 56, 205, 125, 194, 164, 54, 116, 131, 251, 136, 243, 188, 131, 116, 142, 45,
-    244, 223, 86, 155, 168, 55, 197, 70, 222, 92, 213, 47, 158, 0, 141, 185, 118, 57, 218, 21, 69, 99, 183, 17, 219, 84,
-    114, 77, 195, 163, 201, 86, 201, 183, 122, 144, 121, 18, 155, 48, 241, 129, 26, 230, 43, 124, 63, 229, 131, 123, 73,
-    227, 127, 242, 20, 48, 16, 37, 19, 43, 193, 81, 243, 187, 185, 252, 248, 113, 56, 159, 72, 15, 68, 11, 89, 48, 239,
-    152, 63, 238, 165, 26, 165, 45, 190, 127, 235, 13, 125, 68, 25, 220, 254, 209, 137, 145, 53, 167, 203, 142, 121, 81,
-    96, 70, 216, 0, 129, 86, 187, 38, 93, 154, 75, 188, 220, 249, 143, 103, 226, 104, 191, 6, 245, 144, 84, 90, 197,
-    122, 146, 112, 207, 203, 5, 42, 195, 159, 117, 152, 88, 138, 179, 95, 111, 209, 49, 200, 50, 161, 44, 111, 80, 177,
-    167, 199, 242, 15, 164, 219, 228, 219, 235, 72, 201, 4, 211, 80, 90, 68, 94, 223, 93, 138, 185, 51, 67, 190, 18,
-    252, 115, 106, 63, 180, 251, 29, 21, 254, 145, 6, 207, 99, 2, 248, 1, 213, 10, 13, 9, 108, 196, 136, 49, 74, 87,
-    119, 115, 157, 19, 200, 28, 237, 182, 149, 83, 209, 7, 205, 63, 59, 206, 140, 107, 137, 126, 200, 8, 2, 205, 56,
-    153, 49, 8, 140, 0, 245, 119, 163, 59, 104, 246, 186, 23, 66, 98, 198, 122, 180, 157, 154, 23, 246, 75, 125, 179,
-    255, 143, 100, 229, 39, 202, 215, 226, 105, 94, 131, 77, 157, 107, 244, 121, 88, 157, 129, 215, 115, 85, 111, 251,
-    96, 102, 6, 23, 213, 133, 64, 160, 136, 220, 31, 64, 179, 154, 214, 47, 139, 1, 165, 196, 31, 26, 165, 78, 206, 114,
-    80, 28, 142, 67, 17, 234, 180, 195, 249, 244, 225, 240, 115, 180, 246, 91, 208, 48, 236, 220, 62, 16, 91, 16, 248,
-    3, 115, 131, 215, 109, 218, 87, 112, 82, 63, 93, 238, 247, 192, 131, 77, 8, 254, 59, 151, 69, 121, 89, 79, 23, 129,
-    69, 143, 11, 196, 97, 22, 123, 161, 213, 218, 147, 175, 149, 94, 222, 90, 108, 31, 29, 175, 15, 223, 181, 114, 91,
-    138, 230, 97, 175, 65, 127, 233, 34, 217, 16, 130, 139, 8, 237, 166, 12, 242, 213, 239, 136, 231, 111, 208, 188, 83,
-    253, 99, 213, 107, 86, 212, 190, 164, 179, 242, 40, 134, 166, 251, 128, 177, 34, 137, 184, 13, 137, 5, 43, 116, 129,
-    26, 5, 160, 139, 115, 239, 199, 2, 238, 219, 213, 154, 61, 89, 239, 153, 29, 15, 191, 243, 169, 112, 28, 23, 228,
-    45, 19, 155, 17, 58, 26, 28, 83, 91, 27, 185, 143, 21, 20, 254, 132, 0, 196, 20, 179, 154, 179, 216, 140, 59, 34,
-    184, 130, 206, 211, 105, 238, 227, 68, 244, 61, 199, 58, 55, 78, 97, 87, 236, 168, 163, 154, 27, 49, 188, 192, 5,
-    37, 63, 22, 176, 216, 220, 177, 99, 192, 208, 237, 127, 31, 123, 100, 61, 108, 11, 59, 90, 34, 117, 19, 175, 234,
-    140, 70, 120, 122, 53, 150, 152, 180, 141, 130, 100, 58, 82, 101, 81, 103, 63, 88, 178, 176, 237, 35, 66, 228, 59,
-    164, 6, 88, 102, 164, 250, 93, 240, 42, 153, 152, 144, 201, 70, 128, 184, 148, 243, 189, 113, 117, 192, 3, 54, 110,
-    245, 47, 197, 204, 218, 218, 223, 249, 6, 125, 108, 143, 211, 52, 83, 198, 4, 3, 85, 224, 183, 6, 239, 173, 73, 80,
-    127, 69, 169, 194, 70, 101, 69, 28, 84, 99, 220, 5, 221, 246, 176, 193, 15, 190, 251, 104, 120, 131, 19, 180, 165,
-    21, 41, 40, 103, 233, 95, 42, 158, 28, 157, 142, 61, 228, 3, 35, 144, 137, 183, 11, 226, 120, 0, 84, 212, 92, 136,
-    12, 52, 200, 212, 212, 107, 181, 180, 246, 115, 66, 33, 110, 64, 184, 109, 231, 121, 32, 239, 238, 249, 44, 253,
-    142, 76, 217, 95, 246, 175, 176, 27, 137, 188, 151, 122, 55, 40, 187, 76, 207, 98, 3, 7, 168, 71, 44, 252, 232, 17,
-    68, 72, 161, 34, 21, 161, 93, 187, 195, 150, 241, 38, 1, 195, 148, 252, 205, 35, 58, 85, 22, 152, 208, 233, 42, 204,
-    46, 211, 191, 139, 47, 98, 201, 46, 63, 49, 0, 153, 168, 111, 92, 110, 225, 0, 157, 198, 80, 112, 48, 237, 84, 62,
-    62, 11, 11, 133, 2, 147, 8, 248, 76, 144, 147, 138, 6, 242, 159, 55, 182, 218, 240, 144, 37, 210, 170, 184, 119,
-    218, 57, 24, 130, 66, 45, 105, 162, 124, 160, 137, 243, 60, 95, 109, 227, 189, 2, 210, 56, 197, 198, 164, 154, 24,
-    46, 157, 63, 151, 36, 115, 111, 16, 236, 46, 253, 84, 114, 35, 115, 158, 139, 194, 156, 139, 236, 243, 200, 48, 114,
-    198, 208, 0, 232, 177, 68, 204, 129, 33, 85, 164, 249, 176, 89, 54, 216, 160, 175, 42, 110, 70, 20, 104, 205, 117,
-    124, 86, 162, 207, 58, 248, 201, 255, 215, 101, 118, 162, 98, 27, 58, 206, 98, 215, 80, 12, 140, 94, 239, 95, 213,
-    68, 85, 147, 8, 218, 140, 175, 244, 204, 58, 68, 65, 212, 139, 197, 158, 148, 242, 79, 37, 118, 236, 5, 90, 121,
-    248, 111, 60, 147, 158, 76, 178, 163, 62, 96, 113, 243, 183, 137, 99, 34, 95, 59, 145, 76, 202, 103, 119, 252, 209,
-    136, 170, 171, 76, 220, 155, 116, 170, 63, 144, 193, 71, 33, 175, 212, 158, 14, 174, 63, 65, 54, 24, 164, 246, 119,
-    205, 133, 119, 5, 120, 230, 152, 86, 252, 173, 197, 192, 193, 197, 52, 90, 198, 39, 239, 247, 76, 31, 148, 80, 53,
-    26, 5, 104, 217, 87, 26, 44, 148, 122, 153, 182, 120, 77, 133, 108, 129, 251, 185, 66, 250, 95, 231, 98, 195, 51,
-    114, 251, 48, 88, 171, 153, 212, 15, 109, 183, 243, 144, 119, 3, 95, 236, 183, 102, 69, 230, 188, 126, 6, 14, 130,
-    238, 68, 57, 14, 21, 20, 161, 173, 129, 53, 205, 106, 74, 211, 28, 235, 246, 176, 41, 218, 130, 207, 234, 2, 44,
-    247, 60, 7, 146, 132, 34, 240, 194, 161, 172, 42, 136, 142, 52, 167, 16, 134, 215, 127, 222, 97, 144, 23, 52, 43,
-    33, 40, 147, 65, 165, 238, 143, 27, 175, 44, 213, 128, 87, 158, 205, 240, 188, 46, 14, 183, 188, 213, 60, 189, 110,
-    131, 226, 223, 87, 48, 119, 238, 85, 174, 0, 122, 221, 96, 66, 68, 95, 94, 243, 162, 228, 22, 148, 3, 233, 66, 31,
-    234, 77, 229, 207, 15, 133, 1, 5, 105, 95, 242, 205, 174, 43, 111, 129, 104, 126, 155, 32, 0, 124, 120, 78, 25, 248,
-    123, 243, 93, 192, 58, 127, 120, 153, 132, 112, 156, 157, 2, 160, 137, 20, 126, 26, 181, 66, 117, 110, 128, 170,
-    199, 86, 240, 227, 193, 208, 82, 200, 70, 218, 251, 148, 93, 58, 14, 193, 219, 247, 129, 238, 209, 101, 28, 227,
-    193, 247, 84, 249, 94, 51, 205, 243, 21, 208, 25, 15, 40, 99, 200, 150, 186, 0, 211, 128, 56, 149, 82, 191, 107,
-    217, 62, 140, 151, 244, 202, 94, 49, 97, 208, 82, 234, 249, 134, 211, 162, 224, 17, 129, 110, 67, 167, 36, 64, 84,
-    203, 115, 59, 89, 122, 114, 69, 31, 136, 223, 192, 18, 250, 37, 108, 229, 58, 6, 235, 50, 133, 161, 52, 27, 103,
-    252, 31, 192, 5, 32, 246, 236, 14, 85, 120, 119, 85, 208, 232, 15, 91, 93, 24, 58, 125, 46, 14, 164, 62, 210, 118,
-    96, 60, 171, 25, 18, 208, 3, 95, 61, 31, 106, 233, 144, 94, 58, 103, 109, 102, 171, 121, 202, 148, 65, 203, 60, 46,
-    210, 154, 165, 28, 66, 150, 114, 82, 78, 233, 247, 126, 106, 245, 243, 187, 226, 50, 26, 122, 71, 137, 45, 161, 35,
-    154, 170, 13, 10, 247, 90, 145, 29, 1, 254, 186, 246, 15, 230, 54, 191, 196, 158, 248, 158, 168, 155, 89, 184, 218,
-    182, 112, 126, 89, 168, 21, 231, 241, 217, 51, 120, 67, 103, 125, 226, 131, 58, 177, 117, 29, 151, 143, 39, 165,
-    120, 185, 185, 83, 138, 192, 249, 207, 116, 208, 233, 33, 225, 108, 204, 50, 246, 107, 195, 149, 62, 146, 173, 199,
-    225, 191, 73, 124, 208, 148, 66, 205, 144, 178, 146, 46, 208, 133, 180, 150, 215, 198, 125, 178, 211, 56, 114, 128,
-    72, 41, 6, 111, 136, 145, 224, 46, 32, 75, 35, 40, 62, 215, 108, 180, 228, 131, 145, 26, 51, 19, 86, 242, 43, 203,
-    121, 197, 44, 145, 199, 11, 133, 50, 51, 86, 23, 107, 57, 186, 145, 253, 183, 149, 106, 240, 150, 146, 65, 242, 129,
-    163, 189, 126, 1, 109, 56, 252, 242, 72, 83, 104, 62, 134, 196, 196, 97, 33, 102, 199, 18, 241, 106, 23, 143, 185,
-    40, 9, 30, 190, 201, 239, 75, 116, 246, 195, 148, 240, 86, 60, 177, 186, 243, 195, 12, 63, 204, 165, 200, 108, 164,
-    43, 255, 164, 145, 254, 199, 84, 223, 198, 202, 247, 106, 183, 247, 62, 223, 130, 15, 215, 219, 191, 56, 230, 195,
-    71, 241, 55, 1, 127, 23, 186, 209, 76, 176, 116, 13, 72, 27, 88, 142, 231, 133, 166, 245, 95, 11, 56, 20, 228, 18,
-    25, 251, 213, 223, 75, 17, 25, 1, 215, 106, 248, 46, 115, 22, 16, 39, 84, 19, 69, 20, 109, 197, 49, 57, 201, 229,
-    121, 132, 147, 11, 221, 115, 67, 45, 228, 134, 43, 96, 58, 51, 201, 192, 136, 100, 213, 23, 220, 122, 103, 40, 238,
-    34, 40, 8, 189, 23, 168, 172, 91, 142, 109, 208, 121, 20, 238, 205, 194, 229, 112, 252, 124, 70, 44, 247, 251, 132,
-    148, 101, 140, 66, 64, 134, 84, 169, 122, 221, 53, 184, 181, 167, 186, 184, 102, 228, 224, 7, 167, 71, 127, 104,
-    212, 182, 255, 24, 186, 150, 30, 123, 38, 213, 117, 7, 138, 159, 30, 202, 86, 140, 7, 16, 50, 179, 178, 181, 11, 18,
-    228, 136, 158, 203, 141, 249, 5, 179, 239, 61, 178, 36, 130, 72, 64, 152, 222, 59, 117, 124, 163, 11, 178, 146, 207,
-    197, 205, 36, 2, 194, 218, 126, 137, 150, 98, 57, 18, 13, 231, 101, 170, 111, 173, 9, 170, 135, 237, 85, 211, 27,
-    209, 91, 233, 5, 222, 168, 131, 27, 209, 188, 214, 127, 126, 1, 132, 92, 165, 112, 165, 27, 181, 72, 226, 183, 122,
-    117, 241, 102, 204, 193, 205, 137, 67, 188, 16, 89, 217, 23, 159, 10, 95, 38, 23, 4, 17, 205, 210, 143, 250, 155,
-    144, 3, 241, 156, 177, 137, 150, 23, 42, 65, 3, 111, 0, 40, 201, 154, 176, 46, 50, 249, 252, 48, 233, 252, 130, 192,
-    63, 104, 154, 221, 14, 223, 39, 39, 47, 48, 79, 124, 171, 70, 230, 161, 179, 201, 124, 152, 130, 17, 92, 249, 183,
-    107, 81, 150, 174, 15, 9, 177, 34, 38, 109, 30, 234, 26, 6, 40, 43, 50, 65, 247, 150, 63, 124, 146, 250, 85, 143,
-    232, 224, 100, 151, 130, 95, 29, 194, 138, 194, 49, 39, 166, 176, 93, 123, 200, 7, 231, 213, 205, 167, 6, 42, 26,
-    83, 155, 125, 44, 21, 121, 143, 219, 163, 199, 133, 75, 21, 136, 85, 26, 187, 93, 66, 142, 75, 0, 204, 108, 112, 40,
-    61, 184, 168, 213, 125, 130, 184, 61, 166, 229, 131, 69, 88, 114, 243, 99, 169, 143, 98, 95, 209, 82, 151, 107, 150,
-    146, 233, 214, 209, 90, 102, 129, 130, 77, 43, 111, 192, 177, 193, 55, 54, 125, 158, 118, 231, 206, 48, 159, 95,
-    235, 231, 185, 166, 14, 235, 63, 78, 248, 210, 185, 234, 60, 124, 128, 24, 124, 5, 200, 240, 67, 209, 222, 208, 83,
-    34, 140, 132, 231, 70, 4, 154, 134, 156, 168, 167, 45, 12, 42, 194, 6, 6, 190, 229, 230, 15, 18, 202, 49, 225, 85,
-    30, 214, 205, 22, 221, 191, 21, 29, 208, 88, 90, 227, 66, 164, 12, 182, 16, 88, 181, 179, 235, 242, 175, 136, 148,
-    96, 74, 233, 222, 126, 152, 51, 122, 159, 101, 99, 129, 171, 191, 19, 156, 45, 245, 103, 59, 234, 4, 187, 128, 203,
-    64, 6, 151, 31, 236, 26, 34, 139, 63, 37, 173, 134, 201, 163, 121, 226, 190, 161, 229, 53, 53, 155, 60, 23, 169, 14,
-    226, 125, 195, 241, 57, 102, 12, 161, 123, 49, 94, 196, 133, 19, 141, 187, 14, 90, 207, 7, 17, 162, 12, 196, 194,
-    224, 21, 152, 151, 77, 177, 61, 156, 17, 232, 183, 154, 30, 169, 139, 90, 32, 86, 62, 235, 172, 155, 222, 254, 245,
-    54, 180, 61, 162, 120, 205, 27, 137, 92, 181, 230, 251, 135, 176, 76, 230, 75, 30, 82, 73, 154, 15, 197, 10, 235,
-    63, 28, 26, 24, 148, 105, 42, 207, 97, 204, 59, 20, 144, 222, 188, 1, 132, 233, 160, 226, 202, 208, 230, 250, 232,
-    126, 155, 70, 17, 151, 95, 128, 190, 193, 99, 236, 102, 55, 159, 75, 135, 232, 3, 234, 10, 221, 240, 187, 116, 244,
-    111, 186, 62, 110, 83, 70, 145, 245, 33, 140, 99, 124, 116, 15, 27, 72, 26, 207, 129, 2, 75, 252, 193, 30, 110, 163,
-    70, 77, 153, 94, 98, 190, 233, 167, 21, 230, 157, 210, 93, 175, 242, 111, 69, 121, 154, 217, 86, 246, 132, 156, 68,
-    30, 126, 111, 194, 205, 186, 15, 146, 1, 25, 244, 138, 108, 165, 193, 131, 8, 5, 67, 234, 54, 233, 163, 208, 11,
-    206, 214, 201, 235, 115, 77, 22, 3, 113, 122, 141, 149, 225, 48, 166, 195, 253, 146, 35, 152, 64, 209, 160, 125, 15,
-    93, 223, 244, 33, 138, 68, 158, 143, 160, 228, 191, 115, 111, 212, 232, 181, 193, 140, 170, 65, 32, 160, 140, 231,
-    63, 234, 74, 179, 8, 129, 135, 70, 3, 46, 63, 12, 143, 214, 148, 139, 140, 131, 106, 95, 104, 16, 62, 126, 111, 185,
-    82, 202, 41, 36, 227, 234, 92, 134, 16, 227, 150, 250, 18, 90, 66, 134, 65, 233, 167, 167, 25, 37, 129, 40, 94, 235,
-    238, 171, 209, 193, 236, 5, 143, 134, 142, 56, 175, 110, 17, 55, 187, 39, 105, 62, 181, 44, 247, 78, 44, 83, 119,
-    64, 55, 77, 79, 22, 178, 49, 21, 182, 38, 132, 144, 254, 213, 207, 185, 101, 116, 31, 71, 201, 173, 99, 44, 113,
-    203, 55, 25, 97, 104, 63, 157, 252, 219, 164, 126, 12, 34, 97, 18, 143, 109, 116, 100, 18, 152, 173, 206, 248, 34,
-    211, 236, 144, 188, 108, 109, 86, 212, 222, 1, 201, 246, 80, 247, 41, 67, 249, 98, 168, 97, 249, 200, 173, 54, 255,
-    12, 18, 207, 224, 184, 64, 29, 166, 152, 126, 193, 84, 84, 73, 191, 165, 90, 236, 61, 109, 229, 106, 134, 181, 62,
-    221, 23, 198, 249, 138, 156, 167, 67, 206, 238, 80, 33, 2, 161, 189, 117, 63, 134, 4, 218, 224, 93, 129, 247, 3,
-    248, 113, 247, 52, 255, 227, 183, 104, 98, 26, 59, 81, 182, 189, 124, 255, 106, 203, 92, 137, 222, 106, 88, 125,
-    140, 22, 245, 146, 43, 45, 236, 134, 138, 236, 33, 250, 132, 199, 60, 241, 151, 55, 98, 93, 25, 206, 106, 3, 39,
-    226, 125, 193, 94, 186, 76, 141, 191, 169, 18, 51, 10, 67, 253, 158, 207, 2, 31, 19, 25, 192, 246, 234, 183, 128,
-    21, 115, 22, 187, 217, 166, 142, 2, 140, 19, 129, 27, 215, 225, 73, 92, 32, 168, 198, 128, 139, 63, 151, 71, 101,
-    82, 211, 35, 89, 75, 168, 68, 54, 27, 13, 90, 4, 252, 92, 108, 28, 143, 97, 191, 246, 4, 79, 53, 46, 249, 134, 217,
-    124, 31, 158, 248, 62, 136, 230, 93, 17, 207, 90, 220, 121, 99, 181, 191, 86, 52, 212, 31, 157, 40, 230, 240, 104,
-    7, 65, 108, 147, 173, 30, 252, 15, 40, 86, 40, 243, 69, 88, 218, 181, 132, 125, 129, 137, 98, 79, 228, 96, 154, 202,
-    51, 75, 88, 138, 14, 93, 202, 223, 21, 138, 210, 161, 183, 160, 97, 13, 122, 149, 102, 198, 149, 175, 102, 23, 6,
-    12, 255, 36, 6, 94, 37, 14, 44, 162, 213, 198, 129, 187, 118, 234, 157, 78, 244, 8, 238, 2, 227, 156, 139, 211, 195,
-    169, 224, 141, 214, 165, 14, 215, 81, 99, 213, 76, 93, 136, 6, 98, 207, 241, 32, 146, 121, 4, 129, 91, 43, 86, 79,
-    111, 193, 19, 223, 135, 196, 180, 120, 179, 114, 133, 48, 38, 155, 21, 149, 17, 6, 124, 49, 155, 230, 63, 127, 73,
-    142, 99, 236, 244, 105, 241, 27, 145, 21, 93, 111, 140, 150, 195, 239, 175, 90, 200, 91, 221, 225, 187, 90, 181,
-    114, 8, 169, 180, 235, 201, 162, 125, 87, 173, 21, 192, 254, 54, 182, 186, 83, 5, 80, 254, 228, 203, 240, 230, 22,
-    163, 141, 169, 130, 56, 67, 6, 22, 215, 25, 200, 3, 218, 165, 179, 117, 3, 123, 148, 192, 120, 30, 216, 150, 219,
-    67, 110, 177, 59, 46, 212, 113, 138, 182, 84, 182, 189, 4, 57, 177, 30, 117, 111, 138, 187, 166, 77, 133, 214, 42,
-    20, 57, 119, 170, 22, 131, 11, 136, 57, 28, 97, 4, 17, 81, 94, 28, 73, 243, 170, 226, 109, 67, 107, 133, 249, 27,
-    90, 51, 167, 234, 144, 119, 207, 146, 74, 54, 234, 122, 8, 73, 155, 38, 24, 175, 96, 252, 247, 131, 71, 238, 190,
-    146, 32, 148, 33, 208, 191, 185, 200, 111, 196, 224, 252, 190, 47, 143, 203, 230, 177, 139, 215, 185, 179, 254, 215,
-    221, 99, 189, 248, 175, 145, 217, 76, 172, 9, 37, 241, 204, 133, 203, 215, 14, 181, 42, 151, 13, 16, 104, 29, 27,
-    234, 221, 245, 211, 175, 0, 4, 41, 28, 31, 93, 151, 232, 162, 8, 123, 9, 157, 60, 35, 214, 100, 149, 119, 196, 151,
-    203, 183, 144, 94, 248, 192, 51, 222, 102, 121, 20, 26, 244, 161, 230, 107, 203, 88, 85, 51, 34, 133, 112, 231, 181,
-    106, 211, 214, 52, 172, 148, 114, 190, 2, 24, 32, 104, 28, 53, 238, 67, 33, 92, 65, 19, 33, 131, 245, 227, 183, 110,
-    252, 4, 111, 61, 189, 111, 32, 82, 223, 153, 120, 49, 5, 226, 138, 159, 220, 161, 109, 75, 187, 12, 172, 46, 36,
-    209, 217, 168, 252, 67, 165, 84, 16, 1, 109, 71, 127, 95, 97, 254, 114, 46, 115, 99, 39, 179, 114, 92, 76, 22, 169,
-    226, 166, 79, 71, 59, 32, 26, 58, 37, 51, 133, 140, 238, 75, 161, 121, 187, 0, 198, 189, 64, 1, 101, 191, 64, 155,
-    200, 39, 151, 33, 198, 27, 98, 116, 167, 128, 89, 223, 187, 100, 75, 36, 126, 186, 198, 238, 159, 224, 16, 58, 128,
-    142, 137, 85, 61, 161, 7, 18, 64, 142, 191, 188, 42, 101, 10, 32, 79, 184, 229, 111, 95, 233, 54, 229, 59, 237, 187,
-    239, 211, 119, 160, 101, 34, 160, 114, 29, 157, 53, 17, 135, 96, 94, 0, 89, 227, 28, 231, 194, 165, 161, 252, 11,
-    125, 199, 15, 101, 11, 30, 47, 121, 238, 42, 154, 73, 132, 246, 124, 168, 55, 112, 23, 203, 67, 212, 158, 184, 91,
-    242, 105, 15, 18, 106, 124, 6, 49, 250, 115, 179, 30, 83, 155, 195, 34, 207, 111, 210, 68, 111, 116, 86, 39, 3, 4,
-    26, 76, 165, 36, 214, 226, 115, 231, 2, 236, 174, 166, 85, 253, 90, 124, 54, 12, 145, 25, 155, 15, 25, 30, 84, 169,
-    254, 120, 202, 49, 1, 169, 39, 64, 174, 123, 102, 71, 100, 31, 131, 123, 135, 187, 194, 128, 132, 152, 56, 255, 157,
-    154, 252, 127, 242, 11, 174, 3, 175, 227, 9, 60, 255, 142, 136, 242, 186, 15, 83, 145, 20, 2, 252, 124, 28, 191,
-    207, 178, 226, 84, 195, 121, 6, 130, 157, 195, 52, 201, 201, 84, 31, 207, 23, 141, 178, 11, 167, 163, 114, 89, 246,
-    119, 186, 63, 244, 44, 155, 122, 255, 134, 40, 134, 23, 139, 170, 14, 116, 239, 15, 255, 172, 111, 7, 107, 10, 26,
-    211, 22, 60, 70, 130, 213, 34, 88, 218, 207, 77, 157, 162, 54, 63, 242, 105, 220, 107, 9, 104, 232, 119, 66, 43, 69,
-    49, 243, 169, 65, 161, 170, 20, 162, 41, 30, 240, 160, 114, 117, 254, 173, 117, 120, 12, 211, 166, 137, 101, 211,
-    44, 155, 82, 208, 80, 149, 195, 108, 203, 5, 155, 252, 90, 10, 37, 17, 81, 46, 93, 161, 115, 197, 224, 38, 11, 2,
-    221, 218, 200, 116, 61, 91, 135, 19, 65, 21, 175, 65, 61, 23, 182, 246, 244, 176, 99, 28, 17, 122, 52, 120, 107, 50,
-    77, 195, 19, 119, 69, 27, 235, 117, 154, 16, 10, 145, 144, 189, 174, 17, 157, 211, 234, 112, 165, 183, 183, 177,
-    184, 247, 175, 88, 81, 48, 76, 215, 230, 105, 244, 167, 52, 97, 177, 218, 117, 105, 167, 70, 245, 88, 84, 137, 247,
-    109, 116, 183, 255, 90, 115, 170, 183, 65, 70, 229, 246, 201, 172, 227, 100, 84, 67, 65, 114, 251, 71, 231, 182,
-    148, 231, 111, 55, 235, 69, 237, 150, 73, 57, 58, 43, 196, 147, 114, 120, 128, 142, 254, 29, 236, 107, 212, 255, 77,
-    147, 53, 208, 149, 71, 169, 156, 107, 193, 72, 87, 161, 25, 65, 106, 242, 22, 18, 38, 129, 249, 7, 76, 157, 147,
-    103, 67, 31, 250, 19, 124, 151, 184, 160, 6, 231, 54, 79, 78, 157, 208, 160, 205, 29, 13, 146, 67, 93, 145, 159,
-    125, 209, 78, 247, 31, 4, 239, 156, 42, 214, 61, 24, 255, 116, 212, 86, 84, 174, 116, 234, 239, 29, 236, 221, 86,
-    105, 31, 100, 200, 220, 113, 159, 118, 127, 194, 211, 153, 121, 124, 135, 73, 219, 131, 68, 192, 62, 197, 43, 142,
-    27, 191, 183, 172, 47, 152, 190, 20, 120, 218, 111, 205, 241, 113, 34, 99, 242, 43, 10, 226, 97, 84, 216, 72, 81,
-    122, 56, 181, 88, 86, 218, 43, 75, 233, 143, 141, 89, 106, 215, 8, 122, 2, 251, 143, 230, 160, 157, 81, 103, 44, 92,
-    2, 96, 208, 112, 201, 65, 139, 150, 34, 49, 9, 211, 141, 53, 106, 47, 133, 141, 122, 223, 166, 223, 152, 39, 4, 35,
-    24, 153, 250, 168, 114, 151, 222, 93, 132, 57, 36, 248, 27, 112, 151, 77, 59, 226, 218, 254, 106, 198, 172, 230, 24,
-    46, 212, 120, 133, 0, 6, 173, 239, 7, 70, 57, 238, 233, 40, 40, 28, 173, 174, 118, 196, 158, 64, 105, 41, 231, 97,
-    189, 90, 92, 61, 1, 119, 93, 178, 26, 216, 62, 36, 19, 78, 182, 178, 39, 56, 234, 107, 222, 25, 105, 190, 48, 207,
-    209, 64, 229, 65, 157, 56, 231, 66, 171, 209, 188, 227, 104, 28, 17, 103, 181, 213, 204, 40, 114, 238, 69, 127, 97,
-    113, 178, 245, 1, 38, 36, 100, 95, 67, 195, 106, 251, 236, 137, 173, 216, 212, 165, 31, 195, 242, 55, 76, 119, 234,
-    131, 43, 100, 8, 137, 7, 79, 157, 115, 90, 89, 34, 2, 35, 29, 51, 2, 58, 75, 165, 171, 46, 92, 36, 189, 214, 14, 62,
-    128, 155, 141, 147, 36, 72, 34, 135, 144, 47, 226, 115, 96, 170, 22, 131, 223, 93, 30, 60, 46, 90, 91, 123, 246, 52,
-    66, 53, 72, 132, 226, 165, 250, 216, 49, 160, 209, 181, 114, 202, 125, 252, 212, 18, 143, 252, 203, 135, 235, 134,
-    132, 9, 226, 180, 174, 157, 74, 219, 123, 100, 228, 239, 194, 187, 157, 66, 239, 81, 215, 101, 4, 255, 83, 168, 15,
-    244, 66, 71, 247, 115, 198, 42, 84, 239, 139, 37, 24, 240, 45, 19, 189, 189, 241, 214, 243, 153, 7, 18, 92, 103,
-    156, 97, 231, 55, 37, 68, 201, 82, 39, 78, 14, 192, 201, 168, 3, 114, 7, 249, 171, 51, 76, 24, 239, 150, 197, 149,
-    224, 104, 160, 62, 78, 170, 129, 107, 199, 214, 162, 238, 40, 129, 197, 206, 209, 202, 32, 207, 19, 224, 124, 97,
-    80, 23, 182, 100, 70, 4, 17, 187, 116, 125, 218, 5, 21, 80, 25, 162, 49, 243, 66, 100, 223, 235, 192, 112, 162, 250,
-    216, 160, 221, 99, 147, 146, 231, 201, 104, 152, 39, 32, 107, 126, 248, 255, 154, 200, 177, 214, 61, 51, 131, 15,
-    123, 175, 31, 97, 123, 225, 161, 5, 202, 105, 74, 143, 214, 25, 184, 75, 87, 230, 117, 173, 152, 235, 109, 69, 142,
-    137, 151, 248, 87, 228, 121, 242, 184, 220, 21, 242, 136, 40, 27, 63, 192, 41, 28, 151, 3, 76, 50, 62, 101, 24, 111,
-    46, 253, 243, 88, 155, 81, 49, 73, 163, 135, 78, 69, 54, 170, 140, 151, 237, 69, 181, 152, 210, 222, 169, 41, 69,
-    202, 184, 220, 66, 50, 94, 12, 29, 65, 163, 92, 252, 46, 54, 196, 75, 235, 255, 97, 115, 6, 125, 195, 75, 144, 153,
-    167, 148, 238, 130, 217, 82, 179, 22, 104, 141, 149, 31, 95, 100, 219, 179, 139, 131, 252, 150, 81, 151, 82, 171,
-    188, 236, 0, 9, 222, 196, 0, 176, 94, 137, 85, 132, 81, 151, 109, 63, 152, 1, 179, 46, 179, 210, 42, 39, 154, 3, 8,
-    64, 242, 93, 151, 234, 75, 54, 65, 225, 156, 135, 39, 29, 196, 143, 99, 78, 19, 250, 118, 68, 31, 53, 77, 218, 213,
-    27, 163, 169, 35, 194, 101, 82, 224, 251, 44, 63, 207, 71, 28, 142, 124, 107, 246, 139, 71, 250, 78, 128, 49, 16,
-    13, 97, 239, 119, 130, 23, 50, 125, 51, 20, 29, 134, 79, 115, 167, 132, 186, 206, 177, 244, 62, 187, 112, 117, 87,
-    52, 35, 197, 253, 33, 7, 232, 132, 80, 214, 7, 127, 123, 13, 129, 117, 143, 62, 142, 145, 17, 199, 100, 188, 139,
-    41, 9, 102, 12, 231, 16, 184, 105, 34, 143, 168, 63, 147, 185, 215, 19, 32, 41, 113, 251, 217, 55, 180, 108, 186,
-    255, 211, 210, 204, 225, 218, 251, 207, 235, 154, 36, 1, 10, 5, 88, 192, 184, 253, 92, 67, 98, 136, 43, 222, 218,
-    246, 229, 85, 241, 151, 182, 169, 214, 253, 55, 138, 54, 169, 116, 13, 160, 243, 240, 56, 157, 119, 106, 244, 134,
-    119, 171, 19, 122, 87, 137, 210, 170, 23, 72, 154, 90, 143, 66, 168, 162, 244, 163, 8, 188, 79, 139, 242, 250, 85,
-    88, 205, 18, 156, 136, 227, 72, 252, 149, 223, 160, 231, 208, 143, 76, 84, 111, 162, 145, 247, 52, 137, 188, 52,
-    253, 30, 192, 25, 241, 207, 102, 8, 248, 69, 221, 100, 148, 163, 227, 36, 10, 238, 178, 57, 9, 140, 66, 110, 235,
-    68, 214, 39, 255, 113, 35, 226, 103, 211, 131, 14, 135, 237, 114, 234, 239, 236, 168, 104, 150, 129, 62, 77, 62,
-    101, 131, 68, 20, 210, 233, 68, 188, 38, 176, 82, 174, 86, 67, 40, 187, 189, 178, 79, 128, 147, 200, 209, 89, 86,
-    102, 149, 137, 108, 192, 85, 106, 46, 35, 230, 24, 45, 140, 139, 70, 198, 179, 207, 13, 162, 229, 167, 56, 53, 251,
-    119, 149, 247, 124, 90, 231, 160, 199, 87, 121, 134, 65, 230, 15, 187, 236, 200, 229, 169, 39, 62, 192, 208, 121,
-    116, 92, 223, 149, 163, 169, 146, 72, 191, 114, 215, 22, 33, 182, 37, 64, 173, 235, 244, 244, 120, 243, 118, 78,
-    142, 77, 140, 44, 252, 20, 63, 235, 82, 119, 161, 108, 57, 216, 72, 206, 111, 4, 247, 226, 108, 55, 26, 78, 194, 87,
-    235, 157, 155, 166, 227, 70, 242, 199, 174, 58, 180, 225, 141, 135, 55, 215, 173, 153, 45, 20, 81, 127, 22, 199, 62,
-    210, 169, 189, 201, 88, 5, 5, 125, 127, 249, 116, 211, 213, 99, 188, 140, 22, 234, 251, 8, 23, 211, 56, 182, 148,
-    75, 138, 62, 127, 29, 119, 151, 125, 203, 33, 58, 155, 15, 201, 104, 125, 202, 118, 149, 227, 25, 16, 216, 172, 152,
-    192, 45, 6, 20, 73, 82, 241, 73, 65, 245, 136, 96, 223, 93, 131, 222, 57, 106, 76, 31, 166, 44, 152, 131, 86, 217,
-    3, 121, 221, 121, 174, 201, 147, 211, 240, 31, 77, 179, 81, 131, 205, 213, 194, 160, 133, 127, 120, 137, 243, 126,
-    107, 249, 111, 213, 102, 108, 23, 130, 63, 68, 225, 255, 86, 200, 179, 216, 141, 209, 160, 242, 209, 191, 205, 254,
-    144, 15, 164, 166, 160, 176, 151, 128, 75, 63, 68, 184, 41, 9, 87, 245, 45, 99, 226, 83, 10, 165, 117, 222, 59, 185,
-    249, 118, 13, 233, 245, 108, 55, 146, 15, 101, 58, 164, 77, 89, 141, 58, 128, 80, 171, 246, 2, 185, 47, 128, 139,
-    13, 54, 149, 129, 227, 107, 112, 173, 74, 171, 58, 174, 203, 2, 245, 33, 15, 40, 67, 80, 250, 42, 125, 118, 152,
-    189, 149, 22, 236, 26, 18, 112, 34, 3, 43, 246, 101, 9, 112, 91, 53, 191, 49, 4, 164, 148, 174, 220, 120, 140, 41,
-    131, 213, 5, 87, 189, 198, 239, 228, 49, 113, 52, 97, 165, 10, 20, 110, 176, 174, 76, 138, 15, 211, 179, 11, 251,
-    24, 28, 4, 122, 211, 251, 122, 211, 22, 69, 242, 244, 39, 198, 7, 123, 110, 227, 156, 201, 26, 225, 209, 118, 157,
-    28, 228, 10, 253, 215, 83, 208, 29, 105, 6, 211, 49, 114, 224, 224, 67, 27, 70, 241, 204, 15, 174, 195, 218, 16,
-    240, 202, 2, 134, 113, 87, 127, 80, 7, 177, 187, 103, 146, 131, 171, 225, 87, 19, 77, 187, 122, 168, 220, 5, 23, 61,
-    16, 56, 61, 213, 91, 171, 253, 12, 92, 89, 99, 96, 60, 193, 214, 45, 89, 37, 160, 82, 20, 68, 142, 161, 49, 202,
-    201, 217, 229, 40, 216, 234, 141, 180, 176, 33, 106, 98, 7, 133, 59, 244, 183, 125, 109, 75, 18, 126, 229, 74, 216,
-    96, 78, 34, 156, 87, 3, 117, 118, 33, 216, 229, 34, 190, 75, 29, 64, 91, 218, 224, 231, 135, 56, 58, 155, 8, 119,
-    131, 219, 60, 122, 92, 129, 117, 14, 105, 76, 237, 66, 0, 161, 255, 206, 184, 216, 156, 129, 104, 45, 12, 16, 160,
-    156, 74, 161, 183, 26, 155, 183, 42, 35, 216, 183, 143, 65, 232, 168, 11, 102, 245, 236, 227, 8, 208, 63, 186, 150,
-    121, 38, 180, 120, 175, 211, 73, 127, 202, 78, 210, 53, 26, 151, 251, 52, 129, 14, 184, 76, 114, 97, 137, 245, 151,
-    91, 162, 179, 128, 99, 178, 81, 20, 152, 247, 44, 212, 126, 83, 124, 254, 201, 151, 177, 85, 208, 91, 94, 164, 142,
-    143, 94, 106, 180, 154, 185, 228, 211, 19, 70, 44, 101, 199, 182, 142, 210, 175, 166, 253, 94, 201, 16, 150, 22,
-    243, 99, 144, 38, 250, 151, 170, 226, 249, 76, 74, 85, 206, 136, 55, 53, 119, 127, 248, 133, 243, 143, 230, 32, 91,
-    48, 51, 204, 35, 133, 126, 95, 204, 249, 146, 243, 161, 56, 166, 180, 231, 109, 164, 70, 221, 52, 120, 150, 50, 203,
-    41, 14, 195, 197, 57, 1, 212, 183, 165, 203, 74, 65, 190, 15, 219, 236, 235, 244, 38, 244, 183, 26, 57, 46, 53, 233,
-    72, 197, 222, 82, 167, 213, 54, 86, 18, 144, 185, 105, 0, 206, 249, 106, 32, 2, 167, 241, 144, 111, 229, 248, 59,
-    231, 95, 220, 103, 203, 20, 132, 116, 51, 85, 15, 30, 151, 205, 54, 232, 125, 91, 4, 31, 77, 230, 98, 192, 190, 83,
-    129, 140, 135, 120, 137, 0, 104, 82, 136, 229, 80, 193, 249, 195, 111, 18, 77, 117, 57, 214, 133, 202, 212, 147,
-    216, 191, 44, 30, 178, 181, 95, 63, 75, 68, 108, 94, 230, 94, 25, 68, 212, 25, 238, 217, 21, 183, 244, 181, 224, 1,
-    46, 168, 77, 254, 200, 97, 182, 237, 48, 135, 128, 55, 0, 115, 78, 53, 189, 96, 51, 125, 210, 178, 236, 16, 27, 227,
-    10, 218, 124, 52, 60, 226, 156, 211, 38, 254, 15, 38, 221, 50, 83, 16, 248, 150, 165, 242, 5, 112, 130, 47, 200, 63,
-    103, 133, 216, 112, 161, 99, 83, 228, 34, 7, 218, 1, 189, 113, 216, 3, 84, 14, 226, 146, 1, 112, 148, 173, 80, 248,
-    58, 249, 228, 205, 123, 125, 192, 41, 145, 172, 250, 215, 217, 83, 22, 124, 117, 214, 65, 120, 189, 61, 176, 56, 2,
-    73, 164, 88, 53, 98, 62, 207, 235, 211, 40, 0, 161, 72, 254, 191, 40, 146, 136, 194, 44, 50, 2, 203, 154, 60, 235,
-    218, 134, 131, 85, 206, 34, 239, 172, 165, 162, 179, 219, 247, 81, 83, 119, 202, 125, 172, 244, 120, 17, 56, 106,
-    151, 110, 27, 159, 191, 28, 229, 9, 177, 236, 158, 6, 195, 163, 220, 85, 94, 230, 34, 56, 71, 94, 44, 180, 92, 238,
-    148, 81, 73, 152, 34, 46, 229, 89, 3, 101, 245, 176, 160, 132, 141, 109, 131, 78, 57, 172, 221, 172, 228, 97, 223,
-    139, 81, 226, 150, 246, 111, 188, 119, 61, 226, 160, 229, 16, 255, 119, 220, 229, 203, 250, 37, 7, 135, 175, 195,
-    206, 22, 123, 136, 88, 20, 143, 75, 56, 176, 145, 30, 205, 172, 225, 44, 192, 182, 70, 0, 104, 231, 92, 21, 178,
-    230, 167, 100, 4, 12, 50, 74, 159, 90, 27, 187, 56, 30, 229, 231, 225, 29, 195, 223, 84, 211, 23, 7, 248, 227, 202,
-    95, 9, 140, 22, 245, 99, 58, 126, 230, 186, 185, 29, 221, 188, 46, 193, 36, 148, 101, 168, 12, 236, 33, 32, 100, 52,
-    181, 236, 202, 126, 108, 97, 19, 155, 102, 226, 143, 199, 157, 141, 29, 52, 163, 111, 4, 72, 154, 11, 145, 39, 112,
-    17, 233, 255, 178, 111, 88, 149, 141, 148, 1, 183, 72, 234, 80, 111, 39, 82, 117, 110, 2, 146, 102, 172, 42, 202,
-    42, 4, 253, 29, 139, 78, 73, 180, 118, 99, 196, 217, 54, 100, 36, 237, 172, 20, 189, 242, 21, 4, 165, 66, 117, 7,
-    34, 28, 159, 202, 186, 131, 171, 2, 230, 139, 129, 217, 202, 240, 181, 5, 204, 138, 203, 141, 48, 32, 172, 24, 178,
-    196, 249, 161, 152, 226, 186, 91, 98, 112, 104, 114, 91, 98, 62, 203, 103, 67, 140, 24, 119, 226, 69, 105, 63, 183,
-    40, 88, 168, 198, 111, 206, 19, 27, 65, 243, 239, 89, 243, 231, 133, 167, 255, 8, 61, 52, 6, 75, 0, 10, 117, 144,
-    216, 129, 129, 214, 209, 55, 10, 82, 19, 204, 206, 119, 181, 149, 225, 37, 21, 115, 130, 252, 74, 12, 135, 36, 129,
-    163, 17, 111, 37, 12, 144, 61, 88, 58, 127, 142, 5, 98, 74, 70, 54, 45, 30, 54, 163, 187, 156, 95, 144, 167, 90, 57,
-    199, 202, 75, 55, 196, 205, 42, 172, 161, 205, 110, 138, 9, 237, 211, 5, 178, 116, 101, 53, 36, 34, 81, 27, 178, 72,
-    166, 107, 189, 132, 107, 134, 64, 254, 48, 126, 33, 166, 250, 16, 80, 242, 79, 80, 103, 60, 52, 157, 24, 230, 133,
-    15, 146, 146, 170, 170, 231, 250, 73, 34, 9, 221, 132, 22, 218, 74, 235, 198, 12, 125, 203, 28, 111, 138, 138, 164,
-    198, 9, 175, 27, 198, 219, 241, 121, 44, 227, 112, 143, 107, 120, 157, 186, 177, 14, 206, 221, 124, 234, 92, 63,
-    159, 127, 181, 109, 227, 201, 104, 233, 49, 218, 153, 170, 163, 93, 222, 118, 122, 254, 77, 65, 26, 23, 168, 216,
-    235, 111, 184, 186, 232, 22, 115, 84, 101, 240, 89, 174, 150, 41, 102, 199, 142, 194, 87, 84, 32, 88, 174, 118, 163,
-    102, 80, 161, 188, 83, 162, 76, 56, 158, 132, 28, 204, 253, 62, 227, 98, 92, 162, 254, 242, 96, 207, 199, 29, 202,
-    190, 201, 4, 80, 21, 175, 116, 183, 104, 71, 255, 231, 60, 37, 48, 7, 229, 90, 102, 132, 169, 18, 176, 237, 230, 47,
-    57, 70, 212, 89, 222, 140, 188, 213, 117, 171, 44, 233, 201, 154, 75, 137, 184, 84, 222, 77, 94, 196, 186, 103, 91,
-    73, 138, 206, 195, 77, 198, 112, 219, 158, 148, 6, 255, 165, 219, 117, 206, 233, 76, 56, 231, 86, 10, 116, 204, 182,
-    211, 101, 178, 77, 175, 21, 234, 246, 40, 15, 179, 126, 24, 25, 125, 51, 8, 72, 231, 27, 248, 20, 112, 100, 108,
-    146, 55, 85, 49, 182, 141, 200, 186, 244, 89, 97, 7, 190, 222, 208, 46, 133, 187, 30, 62, 7, 192, 39, 47, 201, 39,
-    72, 41, 35, 25, 112, 32, 113, 42, 93, 79, 1, 253, 99, 143, 62, 100, 75, 75, 60, 249, 97, 8, 30, 230, 143, 52, 205,
-    228, 27, 93, 135, 22, 55, 183, 209, 197, 46, 238, 79, 243, 4, 62, 118, 11, 116, 207, 158, 80, 217, 211, 45, 128, 38,
-    225, 181, 188, 65, 179, 120, 75, 168, 240, 220, 220, 158, 159, 18, 199, 135, 17, 45, 81, 26, 47, 237, 4, 211, 91,
-    223, 156, 167, 223, 38, 145, 62, 58, 11, 100, 208, 212, 52, 127, 177, 233, 241, 136, 91, 109, 67, 140, 56, 212, 168,
-    237, 129, 36, 171, 40, 98, 178, 50, 111, 19, 136, 136, 113, 211, 211, 43, 37, 73, 51, 230, 45, 12, 84, 2, 26, 236,
-    227, 114, 157, 244, 208, 40, 135, 70, 177, 211, 217, 246, 159, 41, 4, 54, 65, 77, 125, 199, 40, 196, 145, 76, 171,
-    172, 180, 69, 4, 222, 80, 109, 27, 60, 203, 179, 214, 134, 6, 223, 151, 57, 146, 226, 100, 37, 83, 70, 137, 71, 109,
-    78, 86, 103, 128, 155, 45, 248, 228, 209, 229, 144, 132, 52, 237, 2, 220, 143, 221, 148, 62, 145, 181, 84, 43, 85,
-    73, 242, 150, 103, 254, 65, 65, 123, 242, 86, 156, 23, 85, 71, 179, 25, 144, 30, 173, 151, 128, 166, 84, 192, 61,
-    115, 108, 188, 12, 90, 17, 47, 233, 203, 119, 69, 143, 30, 121, 126, 244, 80, 114, 146, 73, 170, 234, 59, 250, 158,
-    89, 204, 176, 26, 164, 206, 117, 111, 80, 169, 43, 54, 161, 48, 42, 59, 189, 19, 249, 40, 83, 153, 253, 236, 180,
-    40, 104, 57, 113, 118, 126, 70, 60, 45, 47, 173, 102, 81, 119, 189, 218, 27, 38, 221, 24, 5, 35, 53, 219, 50, 132,
-    216, 46, 74, 54, 81, 134, 99, 159, 11, 248, 142, 111, 88, 129, 85, 28, 76, 73, 19, 31, 223, 216, 164, 143, 141, 74,
-    63, 28, 163, 164, 55, 94, 165, 53, 245, 127, 3, 238, 139, 164, 240, 230, 34, 169, 203, 50, 170, 123, 246, 148, 21,
-    118, 53, 144, 205, 231, 213, 54, 79, 231, 12, 86, 187, 106, 147, 15, 174, 63, 86, 86, 175, 243, 12, 69, 138, 168,
-    118, 207, 38, 250, 167, 155, 96, 97, 158, 78, 77, 1, 12, 233, 170, 36, 67, 5, 152, 8, 181, 223, 228, 173, 115, 152,
-    11, 140, 161, 33, 48, 87, 115, 123, 232, 130, 116, 23, 245, 89, 215, 125, 218, 237, 112, 4, 225, 129, 215, 233, 204,
-    183, 228, 181, 72, 245, 26, 61, 116, 51, 57, 248, 6, 23, 236, 8, 47, 126, 173, 86, 140, 33, 77, 105, 25, 152, 247,
-    21, 81, 253, 173, 128, 9, 255, 138, 67, 112, 187, 219, 3, 165, 232, 194, 92, 253, 172, 232, 146, 197, 250, 184, 161,
-    201, 182, 169, 84, 35, 205, 42, 147, 46, 84, 151, 126, 164, 91, 82, 53, 164, 226, 35, 223, 203, 215, 191, 58, 49,
-    62, 253, 50, 72, 253, 133, 68, 187, 74, 27, 133, 159, 92, 12, 148, 127, 49, 236, 95, 19, 127, 113, 190, 214, 71,
-    167, 28, 79, 112, 70, 74, 129, 100, 160, 147, 255, 180, 138, 222, 11, 28, 82, 185, 164, 145, 56, 26, 235, 254, 28,
-    214, 156, 251, 160, 146, 200, 240, 248, 169, 131, 92, 246, 61, 118, 29, 153, 107, 106, 113, 9, 104, 32, 162, 218,
-    34, 195, 228, 57, 31, 236, 144, 48, 15, 255, 96, 207, 192, 190, 102, 156, 58, 85, 236, 163, 206, 185, 147, 15, 116,
-    41, 39, 73, 80, 45, 17, 158, 48, 245, 157, 231, 34, 34, 48, 234, 227, 181, 154, 219, 184, 35, 135, 185, 116, 168,
-    133, 111, 13, 117, 248, 149, 146, 41, 59, 190, 164, 156, 245, 137, 238, 156, 77, 80, 107, 89, 240, 67, 93, 143, 153,
-    84, 150, 39, 0, 30, 161, 22, 125, 194, 128, 241, 79, 89, 234, 223, 148, 189, 227, 151, 130, 20, 251, 209, 26, 177,
-    121, 185, 198, 60, 70, 83, 187, 238, 137, 93, 128, 9, 222, 134, 85, 22, 205, 232, 240, 207, 101, 78, 16, 49, 13, 28,
-    254, 161, 27, 109, 213, 89, 24, 118, 145, 130, 193, 222, 27, 110, 148, 179, 190, 195, 95, 176, 100, 170, 239, 162,
-    6, 184, 216, 246, 26, 92, 96, 159, 177, 183, 249, 18, 228, 246, 137, 85, 200, 190, 142, 51, 169, 45, 188, 10, 198,
-    203, 105, 203, 4, 81, 226, 92, 66, 84, 16, 190, 229, 170, 97, 233, 121, 136, 56, 123, 233, 37, 158, 162, 192, 171,
-    170, 114, 163, 165, 38, 26, 7, 177, 127, 10, 71, 0, 176, 233, 160, 104, 171, 82, 60, 151, 110, 231, 102, 84, 22,
-    234, 194, 12, 171, 161, 230, 142, 15, 157, 166, 53, 114, 106, 181, 81, 228, 186, 183, 244, 190, 201, 148, 99, 228,
-    195, 27, 70, 97, 188, 212, 224, 247, 166, 1, 68, 93, 251, 96, 13, 219, 95, 99, 138, 11, 132, 112, 187, 92, 83, 55,
-    98, 150, 79, 231, 20, 155, 79, 180, 9, 148, 87, 118, 138, 122, 175, 35, 168, 68, 1, 34, 83, 18, 50, 124, 70, 157, 2,
-    252, 19, 234, 82, 9, 113, 243, 230, 150, 22, 126, 241, 155, 135, 164, 225, 127, 137, 206, 219, 113, 7, 31, 106, 107,
-    122, 155, 62, 219, 110, 238, 126, 237, 230, 143, 209, 244, 216, 210, 181, 135, 161, 95, 116, 74, 180, 34, 8, 236,
-    191, 51, 211, 205, 227, 204, 20, 123, 253, 179, 176, 246, 219, 209, 115, 22, 247, 224, 115, 188, 140, 217, 84, 189,
-    255, 82, 193, 165, 182, 167, 107, 112, 75, 11, 107, 143, 173, 72, 7, 77, 47, 100, 97, 38, 4, 162, 207, 167, 243,
-    255, 191, 31, 227, 121, 71, 205, 10, 107, 222, 62, 2, 28, 142, 140, 162, 48, 222, 183, 61, 13, 177, 154, 168, 56, 8,
-    184, 7, 98, 195, 45, 98, 80, 205, 167, 205, 86, 247, 15, 248, 128, 224, 219, 187, 95, 237, 138, 97, 110, 52, 101,
-    88, 156, 10, 78, 255, 161, 104, 106, 29, 191, 217, 229, 214, 176, 84, 117, 46, 202, 96, 3, 182, 10, 216, 220, 218,
-    4, 27, 40, 178, 176, 124, 211, 43, 126, 239, 25, 253, 217, 239, 154, 193, 163, 77, 180, 179, 215, 91, 94, 105, 228,
-    32, 123, 172, 207, 95, 109, 31, 193, 185, 186, 145, 150, 246, 17, 147, 8, 71, 180, 209, 251, 237, 160, 210, 151,
-    248, 149, 42, 56, 51, 139, 159, 97, 117, 147, 160, 66, 197, 235, 221, 131, 190, 223, 98, 217, 199, 238, 58, 81, 110,
-    29, 107, 184, 69, 191, 117, 97, 5, 135, 197, 11, 30, 103, 155, 224, 244, 23, 142, 185, 207, 30, 183, 150, 67, 142,
-    42, 152, 125, 207, 145, 62, 123, 129, 127, 110, 88, 74, 128, 145, 161, 186, 245, 37, 148, 25, 14, 218, 213, 139,
-    151, 140, 230, 68, 87, 154, 248, 221, 106, 104, 65, 204, 240, 233, 33, 179, 122, 247, 155, 198, 76, 222, 72, 102,
-    226, 85, 9, 242, 64, 44, 40, 148, 80, 155, 169, 196, 219, 231, 6, 111, 23, 8, 163, 209, 108, 165, 76, 22, 108, 205,
-    19, 45, 29, 171, 184, 207, 187, 70, 130, 161, 198, 29, 143, 91, 0, 235, 151, 25, 8, 161, 79, 38, 227, 54, 243, 15,
-    13, 28, 164, 151, 65, 232, 243, 193, 195, 5, 183, 191, 244, 166, 249, 118, 18, 242, 103, 63, 219, 33, 42, 30, 29,
-    46, 105, 214, 36, 89, 201, 84, 48, 13, 44, 16, 172, 99, 68, 7, 43, 28, 165, 162, 72, 25, 249, 112, 209, 154, 68, 89,
-    184, 114, 100, 42, 37, 63, 255, 195, 159, 66, 122, 103, 255, 14, 18, 132, 248, 144, 94, 49, 197, 38, 72, 45, 149,
-    190, 161, 134, 250, 214, 201, 62, 116, 227, 244, 144, 22, 141, 215, 215, 149, 220, 120, 189, 4, 36, 155, 236, 251,
-    6, 227, 102, 66, 238, 26, 177, 11, 25, 239, 94, 249, 179, 236, 58, 85, 160, 91, 151, 228, 134, 174, 239, 248, 78,
-    44, 155, 100, 255, 115, 133, 22, 126, 69, 52, 231, 214, 74, 193, 233, 23, 0, 37, 176, 132, 62, 249, 173, 19, 81, 74,
-    146, 132, 142, 142, 243, 23, 25, 113, 0, 120, 104, 68, 74, 22, 89, 245, 9, 70, 167, 60, 4, 20, 15, 182, 215, 234,
-    108, 51, 99, 229, 142, 78, 53, 170, 184, 146, 34, 28, 198, 63, 92, 254, 65, 144, 150, 161, 169, 145, 178, 4, 230,
-    81, 16, 2, 233, 202, 242, 30, 52, 0, 41, 68, 8, 208, 122, 133, 158, 208, 95, 198, 30, 113, 253, 239, 2, 161, 154,
-    82, 70, 45, 42, 42, 92, 87, 196, 156, 73, 89, 15, 11, 50, 75, 55, 225, 84, 110, 180, 21, 123, 171, 37, 20, 136, 242,
-    220, 72, 233, 55, 98, 135, 106, 227, 140, 238, 76, 72, 113, 16, 187, 178, 23, 59, 5, 59, 150, 16, 202, 80, 152, 91,
-    181, 122, 41, 226, 212, 199, 18, 32, 53, 179, 242, 62, 35, 126, 213, 30, 69, 222, 25, 197, 132, 6, 47, 229, 251,
-    171, 130, 57, 137, 161, 95, 103, 171, 122, 255, 42, 98, 87, 125, 200, 93, 139, 97, 224, 217, 225, 136, 169, 111,
-    200, 115, 32, 117, 203, 9, 41, 188, 230, 12, 180, 85, 56, 51, 129, 73, 183, 88, 146, 18, 148, 123, 23, 33, 40, 11,
-    3, 166, 202, 117, 224, 169, 82, 125, 56, 118, 76, 165, 131, 0, 221, 28, 19, 205, 35, 45, 16, 49, 39, 115, 70, 178,
-    74, 95, 56, 255, 198, 65, 175, 234, 220, 190, 246, 238, 200, 208, 139, 139, 216, 97, 126, 178, 128, 121, 32, 156,
-    252, 11, 232, 32, 191, 27, 217, 66, 215, 21, 124, 55, 53, 153, 60, 145, 91, 142, 212, 188, 118, 70, 213, 252, 247,
-    154, 24, 187, 169, 35, 131, 163, 72, 214, 189, 227, 122, 187, 189, 234, 85, 227, 60, 236, 125, 6, 86, 167, 67, 145,
-    194, 126, 244, 120, 190, 234, 57, 45, 2, 104, 4, 161, 85, 158, 20, 235, 233, 168, 8, 82, 17, 1, 159, 226, 161, 245,
-    242, 197, 147, 253, 193, 226, 173, 87, 139, 195, 255, 176, 84, 9, 34, 76, 71, 76, 130, 176, 13, 238, 143, 3, 34, 37,
-    127, 95, 132, 103, 113, 40, 183, 69, 140, 214, 49, 238, 127, 161, 192, 118, 47, 221, 130, 244, 148, 63, 129, 172,
-    226, 81, 189, 113, 3, 218, 2, 49, 206, 56, 130, 29, 235, 92, 67, 213, 232, 209, 175, 157, 24, 70, 249, 120, 89, 161,
-    106, 252, 29, 52, 62, 108, 241, 166, 172, 244, 74, 99, 234, 59, 19, 54, 1, 242, 84, 5, 100, 58, 110, 9, 250, 34, 63,
-    230, 252, 221, 32, 168, 200, 27, 198, 207, 2, 124, 238, 90, 110, 35, 94, 0, 95, 113, 116, 76, 148, 133, 131, 11, 43,
-    147, 45, 92, 126, 202, 34, 64, 221, 109, 201, 81, 216, 222, 44, 210, 56, 84, 58, 27, 52, 14, 22, 73, 28, 111, 196,
-    41, 197, 10, 129, 111, 89, 230, 162, 104, 136, 186, 53, 9, 246, 28, 229, 8, 102, 64, 249, 194, 44, 102, 54, 36, 175,
-    85, 72, 154, 124, 42, 30, 221, 17, 153, 250, 191, 109, 142, 125, 16, 18, 167, 121, 75, 233, 152, 50, 19, 99, 130,
-    41, 71, 128, 97, 234, 17, 19, 102, 59, 17, 112, 114, 97, 123, 191, 47, 243, 240, 230, 8, 147, 82, 28, 116, 161, 151,
-    55, 49, 32, 62, 166, 106, 102, 97, 39, 7, 130, 163, 73, 24, 42, 104, 157, 46, 242, 111, 137, 119, 8, 208, 242, 236,
-    21, 238, 20, 99, 235, 78, 189, 146, 170, 215, 25, 134, 58, 83, 113, 227, 243, 36, 14, 171, 48, 140, 41, 241, 83, 18,
-    119, 97, 20, 10, 214, 7, 63, 47, 246, 45, 65, 9, 220, 77, 194, 138, 65, 106, 1, 250, 31, 160, 75, 216, 5, 127, 27,
-    133, 159, 45, 159, 180, 208, 205, 229, 252, 59, 31, 113, 134, 255, 248, 241, 147, 81, 160, 5, 237, 7, 52, 165, 14,
-    222, 19, 60, 48, 38, 227, 113, 139, 219, 113, 117, 10, 236, 111, 148, 165, 124, 17, 217, 81, 48, 253, 78, 251, 53,
-    132, 68, 159, 177, 155, 253, 26, 36, 239, 222, 75, 169, 223, 151, 160, 120, 191, 69, 215, 172, 40, 111, 177, 232,
-    99, 209, 91, 184, 142, 98, 248, 253, 71, 216, 189, 22, 247, 157, 81, 196, 89, 118, 245, 52, 45, 77, 201, 93, 174,
-    37, 197, 72, 226, 195, 216, 230, 45, 144, 48, 244, 102, 30, 173, 202, 215, 172, 100, 123, 171, 189, 251, 101, 0, 61,
-    201, 70, 139, 212, 27, 70, 203, 199, 32, 102, 236, 163, 24, 196, 44, 182, 23, 236, 253, 102, 124, 222, 173, 62, 184,
-    205, 197, 55, 158, 63, 255, 251, 52, 17, 215, 30, 28, 51, 229, 191, 180, 183, 75, 32, 62, 17, 33, 245, 191, 91, 28,
-    53, 123, 58, 254, 218, 161, 176, 20, 86, 50, 36, 158, 102, 167, 237, 55, 36, 212, 253, 218, 244, 81, 19, 177, 67,
-    56, 219, 234, 4, 94, 79, 171, 47, 244, 134, 192, 51, 239, 180, 105, 146, 94, 38, 218, 99, 164, 243, 76, 168, 237,
-    67, 222, 135, 108, 4, 78, 65, 17, 158, 174, 207, 10, 30, 75, 71, 181, 204, 159, 202, 26, 94, 165, 71, 85, 206, 178,
-    215, 181, 58, 209, 131, 52, 220, 146, 102, 58, 65, 139, 87, 213, 216, 247, 10, 177, 202, 24, 3, 27, 247, 45, 228,
-    55, 4, 182, 88, 46, 162, 2, 226, 8, 118, 113, 246, 219, 248, 66, 168, 180, 137, 22, 169, 53, 239, 149, 197, 144,
-    121, 59, 241, 45, 95, 164, 103, 172, 108, 128, 250, 202, 175, 110, 223, 22, 249, 5, 152, 27, 28, 210, 242, 239, 126,
-    109, 66, 219, 129, 1, 160, 79, 110, 230, 185, 6, 83, 255, 246, 252, 76, 49, 40, 91, 127, 107, 50, 155, 241, 249, 3,
-    160, 136, 12, 16, 180, 52, 142, 151, 43, 124, 179, 104, 22, 3, 74, 1, 179, 169, 125, 121, 11, 27, 252, 223, 4, 25,
-    218, 199, 254, 241, 135, 62, 117, 49, 204, 38, 2, 11, 198, 158, 178, 29, 198, 113, 214, 90, 168, 199, 39, 212, 101,
-    154, 230, 80, 193, 30, 77, 194, 148, 42, 189, 46, 177, 241, 49, 233, 24, 195, 247, 211, 30, 107, 232, 191, 241, 190,
-    239, 85, 0, 72, 131, 66, 12, 108, 184, 162, 50, 140, 75, 12, 186, 108, 82, 251, 50, 170, 89, 139, 155, 80, 213, 238,
-    122, 190, 5, 69, 85, 227, 16, 133, 25, 103, 68, 42, 189, 132, 196, 42, 175, 99, 182, 75, 16, 53, 102, 164, 105, 166,
-    185, 126, 247, 241, 184, 104, 246, 27, 127, 153, 119, 189, 147, 89, 145, 125, 102, 34, 19, 40, 206, 92, 194, 167,
-    136, 10, 27, 205, 244, 101, 184, 94, 157, 218, 125, 187, 116, 179, 184, 87, 159, 96, 42, 158, 237, 35, 220, 99, 99,
-    68, 228, 127, 98, 47, 198, 6, 236, 110, 1, 176, 170, 117, 171, 158, 187, 27, 88, 46, 21, 179, 160, 254, 119, 225,
-    212, 16, 226, 45, 13, 144, 241, 1, 108, 163, 200, 193, 102, 96, 205, 169, 251, 144, 169, 69, 189, 252, 40, 203, 215,
-    224, 247, 55, 43, 112, 230, 161, 190, 219, 236, 146, 133, 177, 110, 130, 197, 18, 214, 92, 53, 201, 13, 128, 223,
-    61, 78, 155, 55, 209, 89, 222, 9, 211, 124, 53, 56, 198, 121, 188, 71, 100, 154, 178, 251, 232, 196, 164, 152, 49,
-    160, 100, 148, 42, 100, 183, 6, 31, 96, 115, 85, 185, 80, 199, 211, 26, 75, 84, 137, 200, 6, 214, 64, 226, 93, 182,
-    85, 151, 159, 194, 55, 152, 202, 83, 119, 109, 74, 225, 27, 161, 76, 236, 164, 39, 46, 93, 180, 129, 220, 32, 159,
-    1, 76, 183, 236, 84, 42, 23, 236, 19, 57, 234, 171, 92, 195, 8, 243, 50, 35, 174, 244, 233, 182, 247, 156, 72, 223,
-    46, 152, 222, 227, 209, 230, 222, 150, 1, 119, 52, 254, 141, 12, 86, 206, 19, 142, 218, 178, 129, 161, 7, 95, 190,
-    19, 180, 33, 58, 226, 140, 147, 94, 1, 102, 26, 122, 17, 27, 58, 162, 145, 32, 168, 125, 10, 7, 179, 144, 46, 218,
-    63, 151, 155, 81, 164, 20, 138, 141, 222, 182, 45, 124, 140, 133, 177, 11, 23, 199, 166, 116, 123, 66, 116, 222,
-    172, 27, 44, 136, 119, 253, 132, 106, 136, 113, 10, 71, 86, 112, 8, 251, 25, 34, 4, 198, 3, 126, 47, 130, 249, 40,
-    237, 40, 115, 5, 216, 14, 79, 56, 229, 214, 118, 199, 251, 240, 113, 61, 101, 50, 83, 252, 195, 25, 246, 220, 200,
-    237, 223, 40, 118, 200, 36, 10, 120, 208, 97, 149, 172, 57, 212, 158, 106, 209, 49, 73, 197, 107, 103, 156, 48, 59,
-    130, 58, 92, 148, 76, 126, 96, 240, 121, 26, 80, 104, 252, 223, 250, 90, 91, 179, 133, 42, 183, 91, 138, 176, 83,
-    48, 226, 155, 168, 103, 35, 243, 251, 3, 101, 232, 0, 241, 18, 116, 133, 238, 122, 220, 163, 183, 108, 80, 235, 161,
-    47, 45, 145, 232, 222, 62, 69, 45, 76, 247, 205, 221, 152, 32, 76, 73, 159, 89, 222, 154, 167, 14, 252, 187, 72, 92,
-    151, 3, 153, 180, 173, 45, 41, 231, 124, 67, 118, 142, 192, 69, 119, 99, 98, 83, 62, 82, 88, 52, 156, 169, 189, 194,
-    91, 111, 145, 60, 17, 125, 139, 66, 246, 67, 34, 41, 51, 249, 235, 177, 183, 25, 146, 246, 193, 172, 191, 79, 112,
-    34, 139, 92, 17, 209, 142, 85, 233, 106, 86, 191, 64, 68, 192, 197, 154, 47, 3, 170, 37, 6, 108, 126, 9, 235, 133,
-    119, 202, 59, 23, 32, 65, 160, 133, 38, 154, 50, 68, 230, 203, 122, 95, 249, 78, 141, 206, 243, 191, 55, 84, 131,
-    84, 141, 252, 167, 109, 247, 242, 96, 113, 5, 220, 187, 181, 135, 218, 248, 178, 9, 88, 210, 203, 110, 231, 94, 182,
-    196, 0, 130, 164, 51, 79, 14, 85, 51, 98, 63, 117, 176, 79, 221, 120, 58, 69, 199, 160, 172, 163, 178, 235, 58, 172,
-    80, 122, 199, 72, 9, 23, 198, 225, 121, 156, 139, 179, 94, 56, 208, 166, 245, 12, 224, 120, 40, 192, 219, 10, 86,
-    151, 28, 127, 242, 5, 62, 222, 53, 44, 242, 179, 79, 133, 114, 219, 19, 76, 195, 245, 59, 56, 174, 91, 220, 88, 127,
-    251, 131, 245, 237, 16, 7, 209, 250, 209, 202, 88, 171, 242, 146, 143, 58, 178, 250, 199, 195, 104, 215, 44, 140,
-    28, 119, 15, 60, 143, 13, 215, 126, 171, 3, 219, 213, 249, 101, 38, 125, 31, 204, 222, 237, 155, 88, 120, 217, 125,
-    153, 96, 94, 114, 89, 127, 109, 59, 195, 122, 185, 105, 106, 71, 208, 79, 74, 135, 172, 153, 110, 231, 195, 202, 24,
-    50, 184, 31, 51, 77, 241, 68, 123, 162, 179, 220, 159, 4, 22, 244, 182, 169, 185, 180, 69, 109, 19, 121, 50, 117,
-    16, 89, 240, 33, 99, 124, 220, 138, 162, 91, 78, 27, 25, 26, 245, 206, 236, 194, 6, 160, 99, 126, 0, 205, 211, 156,
-    240, 114, 195, 192, 25, 254, 66, 84, 198, 109, 161, 198, 131, 216, 60, 216, 61, 120, 154, 144, 149, 191, 65, 111,
-    98, 40, 32, 18, 253, 21, 54, 60, 254, 49, 207, 190, 102, 155, 70, 89, 84, 127, 225, 137, 97, 249, 233, 42, 105, 31,
-    117, 249, 137, 251, 66, 24, 80, 230, 125, 8, 87, 99, 80, 1, 27, 1, 241, 251, 193, 189, 42, 175, 49, 72, 153, 242,
-    64, 215, 199, 25, 64, 34, 108, 113, 110, 212, 39, 239, 187, 20, 38, 205, 92, 65, 198, 176, 61, 169, 39, 9, 40, 168,
-    229, 94, 3, 178, 3, 20, 10, 63, 240, 153, 253, 149, 140, 144, 212, 207, 201, 56, 82, 224, 108, 56, 203, 154, 232,
-    182, 121, 169, 162, 214, 19, 45, 29, 173, 145, 241, 162, 74, 56, 71, 245, 126, 81, 72, 11, 150, 39, 63, 145, 160,
-    153, 99, 137, 207, 42, 34, 213, 108, 15, 11, 135, 15, 103, 186, 194, 45, 76, 159, 124, 10, 154, 220, 155, 20, 123,
-    8, 222, 160, 223, 60, 116, 90, 173, 240, 70, 132, 165, 88, 239, 104, 105, 195, 153, 182, 47, 201, 172, 16, 179, 55,
-    140, 189, 1, 82, 186, 79, 121, 205, 141, 77, 243, 28, 116, 87, 92, 180, 224, 52, 23, 82, 32, 49, 245, 159, 94, 218,
-    115, 130, 110, 2, 183, 239, 164, 113, 18, 1, 225, 240, 222, 45, 215, 50, 84, 17, 154, 60, 99, 226, 48, 34, 115, 199,
-    238, 7, 243, 59, 208, 186, 252, 140, 195, 11, 96, 139, 151, 4, 29, 222, 254, 230, 29, 41, 176, 213, 171, 124, 242,
-    32, 62, 244, 189, 16, 36, 244, 153, 170, 238, 100, 238, 18, 94, 118, 168, 39, 254, 247, 130, 122, 253, 240, 221, 64,
-    161, 233, 74, 8, 73, 188, 231, 5, 196, 119, 160, 211, 62, 125, 135, 21, 140, 48, 5, 157, 124, 68, 135, 50, 249, 185,
-    120, 96, 151, 176, 75, 247, 16, 212, 129, 60, 132, 31, 62, 95, 68, 106, 177, 170, 121, 25, 120, 72, 35, 215, 243,
-    195, 59, 137, 190, 29, 115, 52, 255, 253, 20, 101, 230, 49, 197, 193, 58, 42, 218, 90, 67, 126, 255, 25, 60, 117,
-    154, 181, 46, 57, 134, 70, 53, 18, 10, 10, 132, 49, 147, 231, 237, 255, 106, 174, 236, 55, 18, 183, 171, 252, 83,
-    21, 245, 186, 7, 33, 87, 36, 127, 146, 25, 89, 156, 29, 190, 126, 159, 17, 142, 101, 97, 0, 162, 173, 32, 34, 95,
-    71, 193, 195, 170, 15, 56, 229, 74, 58, 216, 171, 1, 18, 182, 159, 242, 84, 177, 198, 184, 229, 52, 232, 42, 249,
-    186, 122, 97, 25, 29, 36, 127, 44, 21, 106, 238, 192, 179, 135, 205, 112, 78, 111, 111, 94, 59, 44, 122, 203, 99,
-    202, 55, 163, 126, 93, 57, 187, 142, 116, 249, 72, 137, 141, 166, 19, 231, 45, 121, 64, 13, 199, 227, 189, 73, 239,
-    14, 97, 97, 156, 4, 28, 8, 48, 84, 130, 103, 164, 190, 128, 118, 255, 54, 205, 200, 125, 228, 109, 29, 88, 64, 96,
-    106, 154, 155, 214, 216, 239, 9, 61, 230, 18, 93, 139, 78, 255, 89, 31, 90, 169, 160, 4, 224, 48, 106, 1, 72, 161,
-    231, 108, 150, 162, 24, 109, 123, 254, 104, 167, 146, 123, 162, 236, 38, 13, 144, 60, 51, 10, 38, 103, 66, 232, 168,
-    121, 129, 49, 238, 213, 53, 196, 104, 230, 87, 13, 113, 133, 201, 12, 82, 33, 91, 218, 88, 151, 229, 249, 119, 169,
-    237, 225, 255, 253, 93, 115, 54, 186, 238, 240, 156, 247, 22, 167, 24, 212, 155, 189, 126, 84, 1, 144, 109, 251,
-    209, 86, 148, 216, 151, 206, 48, 229, 146, 124, 127, 63, 195, 221, 16, 109, 124, 9, 146, 3, 43, 225, 37, 15, 90,
-    245, 191, 218, 187, 167, 192, 90, 250, 135, 70, 132, 10, 171, 21, 50, 210, 232, 91, 54, 190, 94, 64, 217, 135, 166,
-    220, 117, 9, 12, 28, 148, 161, 50, 221, 53, 202, 18, 27, 128, 243, 137, 100, 128, 120, 240, 223, 174, 136, 39, 87,
-    69, 106, 126, 52, 115, 27, 162, 224, 146, 128, 114, 102, 113, 31, 178, 239, 50, 72, 43, 9, 93, 154, 226, 201, 28,
-    88, 242, 96, 56, 230, 254, 13, 90, 229, 133, 170, 152, 179, 99, 140, 162, 1, 228, 3, 221, 47, 211, 196, 185, 3, 33,
-    159, 125, 82, 234, 158, 246, 226, 143, 87, 42, 241, 134, 106, 72, 185, 16, 173, 49, 216, 170, 253, 153, 29, 100,
-    236, 234, 101, 215, 116, 47, 196, 157, 153, 159, 169, 250, 87, 19, 197, 90, 107, 251, 76, 209, 112, 235, 119, 168,
-    20, 114, 166, 141, 206, 167, 102, 161, 89, 109, 183, 66, 118, 138, 150, 34, 147, 37, 9, 40, 254, 1, 33, 95, 145, 3,
-    42, 240, 128, 31, 12, 196, 95, 209, 16, 48, 143, 47, 142, 170, 35, 209, 165, 65, 101, 254, 177, 87, 117, 4, 71, 115,
-    31, 39, 104, 226, 156, 81, 140, 212, 3, 49, 113, 161, 113, 159, 125, 47, 72, 136, 204, 187, 93, 38, 218, 228, 54,
-    102, 143, 33, 50, 108, 35, 35, 94, 50, 120, 102, 107, 165, 62, 219, 27, 192, 95, 25, 182, 194, 57, 41, 70, 121, 46,
-    14, 116, 134, 126, 123, 146, 87, 102, 56, 170, 241, 138, 232, 98, 115, 22, 91, 221, 188, 160, 19, 11, 130, 88, 3,
-    186, 120, 221, 60, 199, 231, 24, 156, 144, 203, 245, 31, 112, 168, 10, 90, 6, 176, 17, 24, 34, 234, 14, 50, 90, 214,
-    29, 86, 133, 38, 246, 192, 64, 220, 64, 20, 10, 244, 153, 58, 54, 48, 172, 5, 67, 117, 210, 44, 239, 58, 111, 217,
-    14, 200, 234, 70, 90, 153, 111, 212, 87, 233, 32, 252, 252, 28, 33, 114, 33, 185, 174, 52, 53, 103, 22, 89, 210, 82,
-    56, 124, 252, 203, 83, 110, 247, 176, 35, 239, 108, 68, 15, 26, 222, 243, 93, 220, 209, 199, 245, 147, 135, 119, 82,
-    108, 68, 194, 199, 174, 49, 103, 120, 119, 0, 198, 125, 143, 188, 143, 6, 36, 191, 237, 69, 75, 235, 100, 103, 221,
-    1, 193, 77, 202, 25, 238, 14, 52, 254, 96, 67, 81, 163, 90, 153, 6, 100, 55, 183, 207, 127, 158, 232, 243, 252, 127,
-    31, 191, 185, 21, 118, 35, 87, 232, 246, 94, 17, 181, 124, 207, 5, 51, 227, 247, 200, 48, 41, 50, 153, 109, 13, 40,
-    12, 170, 106, 224, 237, 39, 120, 138, 52, 223, 208, 141, 25, 146, 255, 68, 40, 226, 232, 33, 139, 186, 7, 222, 227,
-    152, 177, 65, 77, 8, 83, 94, 231, 11, 147, 95, 174, 63, 87, 59, 56, 70, 184, 72, 218, 244, 227, 101, 128, 196, 53,
-    197, 0, 47, 11, 118, 159, 211, 230, 182, 18, 21, 204, 193, 43, 166, 27, 24, 170, 163, 28, 237, 95, 234, 21, 62, 171,
-    174, 190, 133, 246, 168, 162, 253, 132, 186, 11, 200, 225, 30, 98, 33, 201, 148, 158, 100, 93, 31, 63, 104, 54, 231,
-    20, 8, 38, 159, 113, 86, 2, 14, 122, 17, 39, 239, 177, 95, 50, 34, 92, 67, 231, 150, 129, 147, 146, 14, 214, 29,
-    125, 2, 39, 230, 141, 237, 222, 135, 118, 161, 233, 77, 140, 109, 239, 121, 69, 72, 219, 40, 40, 130, 92, 26, 201,
-    255, 182, 87, 247, 182, 244, 143, 211, 248, 221, 78, 95, 237, 191, 11, 179, 20, 131, 174, 163, 103, 57, 63, 1, 245,
-    148, 48, 6, 107, 216, 243, 153, 231, 141, 6, 82, 135, 168, 155, 75, 65, 151, 157, 38, 93, 59, 218, 215, 96, 147, 64,
-    80, 77, 72, 244, 247, 121, 194, 91, 76, 46, 171, 198, 140, 42, 247, 144, 13, 114, 84, 82, 243, 57, 138, 231, 85,
-    165, 79, 215, 149, 210, 183, 195, 66, 107, 44, 4, 146, 127, 111, 66, 206, 225, 139, 120, 32, 14, 113, 105, 19, 165,
-    159, 251, 205, 52, 107, 191, 234, 198, 67, 46, 219, 32, 122, 191, 14, 76, 134, 176, 86, 80, 245, 6, 1, 235, 82, 134,
-    59, 196, 43, 135, 170, 173, 201, 212, 96, 41, 16, 163, 179, 184, 101, 52, 180, 117, 144, 66, 2, 13, 37, 210, 46, 82,
-    51, 165, 71, 254, 52, 93, 152, 242, 135, 187, 254, 78, 196, 217, 171, 240, 45, 12, 77, 229, 186, 218, 15, 143, 248,
-    41, 24, 199, 250, 247, 129, 235, 216, 123, 117, 66, 168, 123, 128, 149, 144, 249, 136, 177, 31, 155, 219, 215, 43,
-    125, 212, 23, 171, 200, 103, 159, 108, 116, 130, 46, 172, 0, 144, 82, 161, 139, 199, 188, 203, 217, 36, 197, 67, 10,
-    2, 99, 9, 40, 183, 157, 132, 68, 74, 122, 45, 196, 17, 80, 67, 45, 172, 248, 52, 241, 39, 83, 251, 120, 40, 160,
-    183, 237, 209, 162, 12, 72, 165, 107, 193, 141, 46, 218, 2, 7, 94, 212, 142, 13, 242, 205, 97, 16, 123, 118, 240,
-    236, 20, 221, 166, 40, 220, 193, 156, 152, 199, 210, 234, 130, 247, 166, 204, 248, 28, 218, 141, 95, 69, 219, 149,
-    168, 166, 191, 200, 151, 20, 214, 14, 157, 12, 245, 181, 170, 166, 190, 82, 221, 236, 136, 197, 234, 41, 187, 7,
-    211, 196, 5, 79, 213, 147, 177, 3, 203, 147, 60, 254, 13, 183, 95, 15, 182, 125, 136, 160, 141, 81, 90, 165, 22,
-    157, 163, 57, 24, 156, 126, 165, 20, 182, 219, 185, 222, 222, 174, 112, 167, 43, 20, 52, 183, 235, 43, 229, 162,
-    203, 5, 215, 7, 71, 10, 62, 145, 14, 226, 233, 47, 201, 34, 169, 248, 210, 121, 1, 249, 119, 5, 21, 165, 51, 225,
-    160, 238, 214, 15, 179, 182, 157, 175, 30, 179, 63, 190, 125, 32, 162, 137, 118, 115, 80, 106, 120, 152, 47, 156,
-    53, 196, 31, 162, 11, 204, 43, 107, 210, 46, 186, 209, 33, 105, 51, 63, 73, 235, 52, 113, 207, 239, 29, 60, 81, 104,
-    107, 32, 62, 235, 45, 95, 241, 88, 191, 137, 194, 100, 209, 190, 128, 61, 29, 51, 57, 92, 49, 237, 155, 160, 112,
-    107, 89, 47, 245, 158, 134, 88, 90, 110, 212, 252, 23, 58, 6, 187, 72, 179, 117, 108, 106, 226, 9, 234, 85, 187, 73,
-    199, 224, 195, 162, 144, 253, 156, 11, 223, 7, 70, 242, 170, 232, 1, 126, 3, 227, 36, 144, 10, 56, 165, 150, 103,
-    28, 87, 205, 215, 212, 204, 12, 129, 41, 79, 58, 35, 246, 111, 214, 210, 234, 233, 11, 226, 254, 227, 20, 38, 129,
-    152, 34, 236, 195, 100, 234, 162, 185, 210, 161, 16, 136, 110, 181, 171, 239, 130, 233, 200, 175, 143, 192, 46, 177,
-    216, 75, 61, 243, 169, 255, 253, 244, 242, 224, 211, 30, 105, 112, 193, 158, 35, 15, 232, 201, 70, 3, 252, 174, 103,
-    217, 126, 248, 50, 96, 103, 88, 200, 76, 148, 182, 137, 78, 103, 123, 71, 119, 247, 224, 74, 30, 55, 46, 95, 196, 4,
-    250, 220, 59, 3, 163, 69, 123, 185, 209, 110, 55, 112, 207, 240, 220, 194, 88, 110, 200, 109, 249, 88, 38, 142, 218,
-    228, 102, 143, 247, 241, 18, 157, 138, 38, 249, 77, 6, 82, 150, 80, 13, 233, 219, 204, 148, 229, 137, 234, 132, 153,
-    230, 226, 129, 75, 248, 204, 121, 129, 8, 56, 105, 83, 171, 126, 215, 203, 239, 9, 157, 212, 199, 135, 62, 141, 45,
-    246, 76, 252, 71, 141, 20, 180, 1, 94, 177, 73, 144, 176, 140, 72, 194, 178, 66, 215, 238, 108, 208, 156, 80, 156,
-    186, 105, 219, 222, 30, 149, 241, 224, 120, 235, 138, 13, 5, 112, 5, 250, 184, 235, 152, 82, 87, 176, 251, 216, 248,
-    20, 135, 252, 165, 146, 167, 83, 216, 167, 152, 153, 248, 121, 59, 238, 136, 243, 169, 3, 220, 216, 191, 47, 166,
-    209, 176, 154, 108, 43, 164, 243, 18, 184, 15, 103, 13, 235, 167, 46, 153, 91, 136, 118, 197, 62, 127, 114, 4, 34,
-    202, 81, 24, 234, 175, 58, 191, 30, 128, 74, 163, 219, 14, 150, 141, 197, 218, 255, 253, 5, 151, 225, 185, 233, 246,
-    7, 238, 17, 149, 191, 90, 34, 185, 19, 207, 197, 35, 11, 93, 95, 87, 86, 195, 169, 50, 227, 166, 105, 194, 77, 200,
-    64, 191, 13, 213, 33, 19, 132, 230, 22, 138, 156, 180, 91, 26, 128, 33, 110, 182, 7, 150, 222, 40, 24, 93, 222, 49,
-    214, 65, 197, 208, 90, 26, 178, 24, 32, 44, 248, 156, 72, 81, 115, 61, 215, 43, 96, 96, 206, 180, 163, 128, 113, 46,
-    111, 7, 226, 183, 218, 2, 180, 85, 125, 20, 51, 217, 189, 97, 47, 38, 251, 230, 183, 190, 9, 105, 60, 149, 227, 90,
-    222, 84, 9, 63, 194, 94, 127, 199, 60, 122, 110, 69, 183, 41, 3, 209, 224, 183, 215, 164, 116, 167, 117, 195, 227,
-    171, 171, 76, 191, 45, 207, 108, 1, 83, 231, 89, 152, 128, 171, 48, 42, 157, 226, 240, 63, 178, 63, 49, 63, 37, 159,
-    168, 94, 105, 245, 204, 226, 212, 253, 202, 62, 90, 170, 129, 17, 114, 237, 159, 22, 88, 17, 36, 150, 232, 51, 28,
-    168, 228, 199, 178, 68, 173, 145, 19, 244, 20, 209, 127, 72, 167, 37, 141, 158, 136, 210, 207, 91, 240, 159, 75, 17,
-    107, 163, 38, 28, 208, 61, 94, 136, 147, 104, 158, 246, 131, 251, 226, 74, 129, 71, 226, 127, 13, 238, 146, 138, 67,
-    227, 107, 112, 24, 236, 233, 219, 143, 29, 249, 210, 166, 208, 19, 126, 70, 44, 248, 191, 170, 24, 176, 16, 179,
-    190, 158, 255, 196, 192, 185, 236, 112, 109, 57, 150, 7, 150, 176, 253, 248, 168, 22, 212, 124, 189, 128, 89, 153,
-    91, 81, 174, 3, 118, 65, 188, 84, 182, 203, 18, 176, 155, 79, 218, 88, 235, 205, 210, 4, 52, 28, 84, 105, 235, 254,
-    64, 122, 100, 71, 194, 132, 194, 223, 66, 6, 134, 243, 1, 185, 15, 247, 159, 191, 32, 101, 158, 81, 37, 180, 151,
-    218, 143, 207, 111, 143, 220, 214, 15, 110, 219, 48, 193, 63, 41, 106, 2, 103, 203, 84, 246, 97, 12, 55, 76, 41,
-    241, 196, 149, 225, 17, 248, 92, 21, 85, 61, 31, 175, 104, 34, 242, 113, 152, 239, 141, 215, 40, 178, 5, 37, 47,
-    157, 103, 209, 255, 170, 180, 241, 106, 225, 76, 184, 87, 135, 55, 253, 41, 180, 157, 196, 153, 74, 140, 73, 31,
-    227, 211, 125, 123, 210, 22, 60, 57, 152, 5, 64, 159, 40, 116, 107, 175, 15, 76, 191, 24, 12, 98, 149, 75, 79, 94,
-    232, 23, 186, 251, 233, 244, 21, 193, 240, 97, 80, 124, 16, 31, 99, 33, 89, 51, 35, 63, 94, 17, 226, 209, 174, 44,
-    234, 47, 206, 91, 30, 187, 55, 128, 128, 125, 191, 62, 164, 79, 8, 218, 147, 29, 26, 72, 14, 211, 9, 232, 170, 191,
-    82, 224, 106, 136, 141, 59, 130, 91, 190, 115, 111, 73, 159, 248, 92, 184, 178, 234, 41, 171, 236, 167, 99, 172,
-    210, 12, 82, 102, 34, 27, 172, 71, 172, 4, 27, 96, 125, 194, 61, 5, 209, 64, 12, 178, 123, 77, 184, 30, 178, 85,
-    145, 75, 133, 228, 168, 60, 174, 246, 50, 198, 199, 64, 134, 246, 118, 114, 57, 216, 212, 84, 114, 93, 30, 164, 141,
-    208, 199, 117, 42, 43, 12, 201, 122, 214, 187, 70, 70, 116, 157, 206, 63, 115, 67, 181, 128, 185, 12, 57, 95, 180,
-    130, 164, 5, 201, 59, 182, 76, 224, 2, 159, 21, 160, 105, 164, 222, 155, 58, 53, 25, 119, 66, 60, 218, 58, 64, 168,
-    22, 92, 203, 18, 51, 10, 235, 57, 188, 213, 251, 63, 168, 9, 192, 205, 7, 227, 78, 37, 31, 65, 215, 145, 155, 221,
-    108, 19, 117, 251, 189, 9, 192, 170, 77, 156, 211, 176, 242, 42, 196, 22, 136, 122, 218, 207, 7, 81, 23, 158, 43,
-    201, 91, 169, 0, 25, 43, 241, 38, 120, 234, 251, 182, 239, 119, 73, 5, 89, 95, 149, 17, 123, 109, 233, 159, 203, 83,
-    75, 93, 5, 194, 123, 232, 32, 192, 34, 254, 249, 131, 103, 122, 123, 171, 196, 232, 199, 236, 109, 148, 44, 119, 42,
-    32, 56, 83, 229, 217, 238, 138, 47, 62, 158, 243, 134, 239, 243, 70, 81, 43, 147, 207, 101, 65, 197, 205, 114, 150,
-    245, 79, 238, 223, 240, 186, 20, 211, 80, 49, 194, 132, 158, 11, 232, 145, 196, 223, 17, 133, 132, 157, 145, 186,
-    192, 12, 5, 75, 12, 63, 171, 131, 97, 1, 39, 105, 191, 136, 177, 197, 104, 241, 101, 111, 224, 195, 220, 141, 247,
-    246, 34, 106, 86, 94, 235, 115, 62, 126, 227, 32, 229, 133, 115, 37, 21, 13, 233, 57, 10, 87, 101, 197, 224, 110,
-    12, 237, 156, 120, 13, 138, 61, 169, 134, 110, 217, 168, 245, 121, 96, 135, 73, 233, 119, 172, 203, 65, 248, 67, 96,
-    125, 210, 178, 235, 110, 64, 72, 117, 184, 34, 231, 21, 214, 230, 64, 53, 215, 88, 85, 152, 92, 249, 20, 11, 130,
-    208, 222, 211, 56, 131, 175, 132, 19, 69, 113, 241, 204, 92, 176, 211, 48, 189, 179, 201, 116, 131, 102, 54, 18, 96,
-    201, 184, 152, 253, 187, 114, 212, 48, 165, 115, 113, 155, 74, 163, 63, 120, 102, 167, 161, 202, 235, 28, 80, 167,
-    200, 17, 164, 190, 236, 199, 250, 75, 90, 31, 47, 215, 68, 216, 133, 17, 13, 130, 57, 34, 167, 191, 166, 132, 191,
-    153, 191, 198, 88, 30, 40, 33, 2, 68, 71, 22, 87, 27, 66, 137, 92, 222, 206, 102, 251, 45, 16, 34, 47, 210, 181, 56,
-    196, 209, 136, 117, 129, 57, 89, 112, 207, 26, 165, 85, 23, 140, 232, 220, 172, 183, 44, 171, 158, 253, 220, 250,
-    240, 122, 64, 240, 56, 45, 123, 104, 209, 162, 55, 103, 179, 32, 106, 247, 8, 19, 85, 17, 44, 93, 207, 122, 88, 13,
-    122, 68, 40, 37, 200, 14, 194, 217, 238, 50, 182, 35, 140, 73, 213, 244, 219, 94, 88, 185, 180, 255, 164, 180, 35,
-    36, 24, 210, 74, 248, 60, 106, 52, 244, 133, 33, 230, 142, 69, 22, 32, 26, 94, 46, 105, 13, 131, 30, 203, 247, 231,
-    23, 153, 94, 29, 118, 66, 69, 223, 234, 161, 247, 50, 4, 137, 78, 63, 68, 47, 148, 4, 254, 246, 29, 41, 228, 240,
-    240, 78, 53, 115, 141, 145, 186, 147, 45, 43, 107, 109, 146, 253, 36, 50, 114, 11, 48, 118, 52, 222, 54, 51, 174,
-    234, 167, 253, 192, 34, 90, 231, 81, 179, 221, 129, 253, 36, 221, 48, 122, 247, 120, 173, 83, 217, 67, 65, 70, 72,
-    146, 212, 118, 239, 210, 104, 111, 123, 5, 42, 55, 78, 154, 241, 54, 78, 59, 252, 127, 85, 155, 14, 239, 16, 184,
-    130, 178, 34, 223, 31, 239, 113, 165, 220, 63, 164, 131, 240, 29, 70, 236, 165, 60, 125, 71, 74, 205, 20, 122, 123,
-    152, 169, 41, 116, 253, 3, 70, 219, 179, 130, 187, 11, 247, 118, 43, 59, 189, 7, 163, 67, 4, 5, 82, 77, 136, 77, 7,
-    135, 237, 239, 93, 37, 169, 221, 55, 93, 14, 160, 38, 84, 75, 96, 65, 247, 22, 225, 69, 243, 84, 89, 180, 10, 147,
-    46, 203, 142, 133, 3, 29, 54, 177, 11, 113, 105, 236, 83, 178, 80, 88, 184, 23, 210, 170, 239, 236, 223, 97, 43, 57,
-    115, 10, 77, 170, 246, 188, 177, 227, 122, 231, 29, 142, 103, 38, 162, 35, 211, 234, 121, 116, 8, 231, 182, 113,
-    112, 75, 190, 61, 183, 41, 39, 186, 243, 25, 252, 31, 165, 131, 32, 54, 194, 147, 20, 69, 140, 240, 57, 72, 156,
-    134, 162, 11, 37, 192, 90, 56, 218, 3, 69, 204, 105, 53, 97, 223, 212, 20, 11, 151, 190, 224, 251, 40, 147, 29, 148,
-    120, 141, 47, 106, 151, 67, 223, 53, 175, 15, 17, 186, 196, 11, 208, 81, 7, 90, 73, 86, 2, 171, 51, 54, 101, 146,
-    206, 84, 194, 29, 23, 82, 206, 230, 209, 204, 170, 116, 15, 1, 225, 88, 193, 149, 117, 74, 74, 79, 249, 137, 39,
-    223, 177, 240, 158, 58, 246, 203, 248, 139, 73, 222, 143, 202, 26, 4, 230, 127, 188, 178, 241, 186, 126, 13, 180, 9,
-    254, 178, 115, 148, 147, 18, 208, 231, 153, 49, 118, 1, 206, 0, 145, 90, 226, 102, 109, 170, 150, 132, 136, 79, 11,
-    158, 152, 79, 184, 44, 90, 113, 200, 75, 247, 32, 228, 117, 169, 48, 107, 110, 254, 198, 222, 200, 127, 110, 133,
-    143, 227, 145, 192, 240, 79, 177, 21, 250, 250, 6, 142, 251, 30, 30, 172, 216, 233, 239, 40, 28, 95, 94, 43, 185,
-    227, 96, 102, 10, 229, 125, 195, 145, 98, 197, 67, 172, 201, 42, 1, 2, 36, 246, 55, 34, 60, 228, 47, 166, 93, 145,
-    182, 172, 243, 153, 149, 57, 29, 109, 138, 116, 42, 229, 223, 254, 107, 196, 226, 5, 120, 244, 186, 23, 218, 227,
-    11, 66, 86, 197, 43, 192, 2, 92, 255, 182, 127, 28, 30, 125, 33, 111, 49, 12, 183, 152, 90, 50, 9, 71, 12, 167, 4,
-    84, 112, 156, 128, 105, 228, 248, 209, 46, 148, 201, 121, 221, 235, 242, 127, 77, 185, 185, 114, 170, 32, 65, 191,
-    200, 40, 127, 147, 33, 63, 12, 111, 242, 51, 245, 54, 109, 157, 251, 252, 46, 130, 201, 73, 204, 34, 80, 96, 9, 12,
-    28, 76, 143, 34, 32, 65, 250, 205, 84, 99, 168, 225, 139, 136, 30, 122, 107, 248, 119, 54, 193, 9, 235, 136, 58,
-    145, 154, 164, 100, 22, 26, 213, 20, 115, 223, 74, 210, 56, 93, 102, 171, 224, 152, 219, 39, 82, 226, 67, 139, 54,
-    133, 42, 3, 12, 155, 140, 178, 183, 237, 36, 4, 172, 31, 251, 163, 247, 82, 111, 187, 74, 206, 14, 88, 73, 254, 104,
-    9, 195, 41, 252, 170, 221, 31, 30, 43, 226, 123, 158, 49, 29, 148, 118, 8, 87, 214, 76, 104, 149, 80, 187, 108, 167,
-    46, 32, 39, 53, 172, 2, 216, 232, 181, 208, 186, 26, 64, 215, 94, 215, 64, 18, 85, 57, 232, 132, 239, 2, 180, 70,
-    226, 117, 138, 57, 39, 37, 209, 123, 181, 255, 181, 61, 194, 247, 234, 167, 241, 250, 61, 231, 241, 84, 217, 16, 23,
-    55, 62, 200, 168, 75, 198, 79, 176, 200, 150, 63, 217, 88, 43, 183, 246, 221, 210, 198, 241, 125, 28, 19, 85, 178,
-    193, 52, 185, 212, 9, 111, 182, 239, 15, 164, 117, 0, 114, 17, 81, 254, 159, 95, 38, 54, 235, 125, 200, 89, 134, 72,
-    225, 39, 19, 139, 149, 115, 69, 122, 120, 97, 1, 88, 19, 102, 61, 37, 81, 175, 170, 196, 10, 212, 44, 243, 66, 127,
-    116, 36, 207, 245, 63, 234, 6, 66, 64, 124, 246, 184, 230, 80, 199, 71, 5, 15, 108, 229, 29, 223, 202, 62, 242, 242,
-    27, 63, 167, 39, 254, 161, 148, 206, 77, 232, 254, 188, 9, 117, 132, 167, 44, 89, 149, 136, 56, 17, 202, 72, 228,
-    30, 84, 175, 113, 57, 190, 8, 137, 59, 202, 89, 64, 9, 233, 187, 158, 88, 228, 33, 9, 171, 217, 13, 148, 200, 251,
-    244, 176, 32, 110, 164, 215, 23, 129, 206, 156, 110, 129, 253, 159, 128, 37, 191, 231, 224, 90, 36, 170, 75, 88, 66,
-    53, 132, 67, 37, 148, 140, 75, 122, 28, 248, 193, 56, 244, 66, 27, 170, 128, 78, 146, 126, 238, 244, 27, 73, 157,
-    65, 183, 24, 243, 75, 91, 248, 233, 78, 98, 158, 246, 15, 120, 129, 135, 68, 90, 153, 154, 183, 121, 41, 52, 134,
-    219, 216, 145, 78, 186, 255, 142, 10, 96, 87, 112, 157, 120, 128, 178, 208, 240, 196, 187, 117, 202, 14, 132, 19,
-    105, 28, 31, 217, 178, 217, 155, 189, 128, 254, 64, 80, 55, 103, 136, 194, 247, 35, 97, 231, 31, 127, 170, 145, 26,
-    111, 56, 216, 30, 16, 184, 239, 58, 21, 122, 66, 171, 34, 46, 214, 39, 70, 58, 86, 5, 98, 186, 46, 147, 234, 143,
-    140, 42, 238, 195, 40, 139, 92, 235, 58, 197, 3, 214, 92, 182, 59, 231, 94, 230, 249, 228, 65, 90, 195, 69, 212, 71,
-    223, 221, 241, 77, 46, 56, 101, 3, 167, 96, 164, 243, 127, 205, 139, 209, 184, 41, 163, 123, 113, 216, 185, 195,
-    172, 30, 150, 109, 55, 117, 84, 251, 52, 167, 38, 38, 129, 8, 59, 79, 216, 250, 45, 95, 99, 90, 141, 52, 120, 163,
-    147, 167, 183, 199, 201, 45, 161, 114, 175, 36, 41, 144, 66, 142, 44, 24, 119, 126, 118, 155, 13, 138, 118, 5, 199,
-    33, 135, 253, 43, 57, 27, 138, 140, 254, 241, 143, 66, 84, 196, 146, 208, 28, 202, 87, 58, 9, 97, 100, 141, 80, 204,
-    197, 245, 12, 216, 78, 7, 21, 56, 45, 224, 20, 200, 29, 21, 22, 74, 154, 255, 153, 51, 218, 172, 234, 225, 208, 42,
-    13, 140, 158, 64, 134, 26, 115, 65, 180, 201, 44, 117, 133, 161, 89, 91, 140, 231, 239, 120, 139, 128, 142, 65, 206,
-    166, 142, 129, 106, 139, 205, 147, 191, 88, 50, 134, 234, 236, 139, 245, 160, 38, 89, 33, 253, 105, 147, 174, 243,
-    145, 208, 225, 224, 112, 222, 5, 227, 153, 47, 97, 210, 112, 193, 15, 234, 165, 196, 233, 250, 104, 84, 229, 118,
-    227, 154, 195, 229, 180, 205, 213, 88, 39, 54, 122, 85, 85, 86, 242, 70, 147, 72, 192, 21, 134, 157, 183, 110, 233,
-    136, 148, 80, 247, 56, 82, 197, 242, 148, 53, 224, 50, 209, 57, 69, 145, 199, 89, 52, 63, 125, 156, 59, 228, 112,
-    136, 119, 17, 134, 57, 149, 252, 89, 132, 138, 242, 206, 235, 83, 96, 20, 12, 35, 114, 125, 153, 131, 242, 224, 120,
-    100, 208, 106, 11, 128, 67, 105, 64, 176, 50, 28, 96, 169, 5, 232, 249, 213, 255, 55, 178, 133, 82, 124, 162, 15,
-    78, 160, 80, 160, 38, 71, 237, 196, 50, 216, 147, 17, 70, 62, 184, 155, 5, 7, 174, 255, 165, 203, 116, 57, 161, 139,
-    119, 236, 206, 150, 236, 71, 30, 80, 157, 128, 66, 251, 246, 223, 32, 207, 199, 1, 126, 57, 32, 23, 206, 129, 187,
-    243, 101, 26, 165, 77, 116, 138, 239, 223, 223, 182, 54, 198, 13, 133, 64, 133, 174, 151, 100, 36, 214, 27, 245,
-    212, 200, 119, 148, 222, 214, 112, 42, 191, 179, 36, 70, 96, 8, 146, 123, 170, 254, 22, 100, 231, 60, 215, 137, 17,
-    43, 225, 134, 41, 224, 24, 232, 106, 188, 34, 194, 94, 36, 84, 33, 124, 55, 90, 131, 64, 26, 251, 92, 233, 128, 79,
-    231, 48, 94, 181, 26, 202, 172, 93, 36, 131, 123, 150, 102, 115, 189, 227, 211, 182, 42, 1, 21, 228, 163, 249, 70,
-    245, 179, 98, 59, 65, 255, 218, 87, 15, 99, 251, 36, 17, 77, 140, 3, 162, 100, 199, 239, 195, 80, 220, 172, 2, 133,
-    188, 79, 163, 6, 167, 96, 187, 11, 67, 156, 138, 183, 58, 160, 79, 80, 27, 148, 114, 214, 152, 155, 85, 133, 167,
-    232, 238, 210, 12, 139, 196, 134, 47, 172, 71, 212, 132, 64, 195, 6, 148, 40, 127, 17, 251, 121, 69, 169, 108, 209,
-    219, 202, 55, 188, 203, 193, 245, 210, 91, 212, 141, 30, 164, 44, 239, 204, 123, 99, 19, 69, 130, 16, 117, 254, 219,
-    147, 233, 89, 225, 32, 82, 228, 166, 122, 204, 137, 103, 235, 255, 215, 245, 58, 181, 59, 28, 136, 194, 109, 228,
-    167, 72, 235, 9, 1, 133, 97, 229, 67, 170, 8, 43, 45, 219, 204, 3, 35, 205, 69, 33, 147, 98, 28, 15, 12, 73, 15, 41,
-    108, 86, 103, 193, 148, 23, 17, 43, 213, 242, 53, 240, 1, 56, 14, 144, 98, 50, 190, 57, 219, 122, 140, 125, 231,
-    168, 216, 42, 208, 227, 132, 251, 244, 189, 220, 65, 40, 191, 234, 45, 73, 120, 208, 69, 168, 10, 10, 222, 141, 12,
-    245, 125, 148, 112, 106, 64, 146, 237, 135, 173, 95, 73, 52, 114, 245, 207, 3, 198, 132, 109, 245, 154, 98, 108, 4,
-    158, 153, 101, 174, 189, 211, 235, 188, 34, 8, 160, 91, 191, 98, 179, 181, 64, 8, 62, 5, 69, 23, 224, 50, 17, 242,
-    19, 164, 42, 116, 18, 46, 194, 18, 93, 22, 234, 144, 179, 88, 42, 232, 72, 65, 45, 38, 165, 56, 170, 151, 217, 93,
-    19, 76, 235, 218, 86, 141, 17, 212, 170, 161, 255, 233, 98, 195, 105, 249, 190, 0, 204, 217, 76, 49, 208, 185, 231,
-    114, 5, 245, 67, 121, 217, 246, 77, 165, 80, 99, 252, 238, 30, 145, 57, 159, 242, 244, 43, 16, 230, 64, 214, 44,
-    142, 190, 78, 72, 168, 191, 239, 192, 27, 14, 230, 172, 2, 129, 51, 208, 196, 72, 87, 250, 201, 63, 45, 246, 24,
-    140, 185, 191, 60, 16, 116, 148, 179, 67, 240, 234, 130, 58, 60, 242, 142, 198, 18, 223, 36, 190, 242, 168, 115,
-    115, 33, 20, 207, 134, 1, 219, 52, 254, 86, 50, 79, 65, 222, 214, 203, 87, 130, 36, 241, 48, 48, 15, 155, 125, 146,
-    141, 120, 238, 188, 242, 228, 157, 82, 125, 60, 81, 173, 22, 54, 56, 16, 178, 219, 246, 22, 196, 249, 188, 110, 29,
-    4, 172, 18, 62, 96, 242, 213, 181, 143, 199, 221, 217, 86, 112, 191, 25, 57, 162, 202, 235, 141, 129, 242, 206, 6,
-    89, 160, 206, 37, 120, 98, 180, 107, 156, 251, 180, 178, 49, 45, 23, 69, 113, 116, 160, 40, 56, 15, 40, 42, 209, 80,
-    82, 231, 52, 139, 150, 47, 212, 186, 238, 151, 179, 150, 182, 224, 215, 119, 90, 39, 173, 40, 46, 214, 76, 246, 204,
-    234, 168, 117, 67, 214, 104, 48, 85, 92, 180, 224, 52, 55, 174, 69, 35, 229, 178, 66, 94, 53, 209, 95, 92, 94, 119,
-    249, 237, 199, 188, 238, 252, 232, 48, 220, 223, 60, 56, 115, 14, 46, 91, 250, 87, 244, 6, 98, 145, 169, 118, 198,
-    67, 188, 55, 230, 42, 122, 66, 58, 112, 200, 56, 203, 193, 89, 192, 251, 151, 104, 167, 168, 124, 7, 48, 142, 91,
-    80, 88, 243, 69, 203, 246, 64, 80, 168, 244, 68, 185, 169, 141, 1, 163, 109, 111, 106, 170, 62, 42, 0, 74, 220, 223,
-    171, 90, 188, 0, 100, 110, 5, 82, 171, 117, 249, 102, 247, 195, 10, 94, 31, 93, 48, 65, 236, 54, 90, 181, 48, 138,
-    192, 5, 52, 150, 237, 61, 90, 217, 198, 74, 158, 245, 141, 6, 122, 174, 206, 46, 20, 219, 45, 243, 91, 211, 50, 98,
-    73, 136, 135, 187, 224, 204, 160, 47, 131, 70, 142, 50, 54, 88, 188, 108, 2, 187, 99, 35, 136, 60, 96, 86, 49, 4,
-    166, 166, 91, 119, 199, 132, 26, 176, 175, 213, 161, 87, 19, 132, 25, 55, 61, 44, 135, 183, 166, 247, 32, 33, 57,
-    70, 41, 197, 32, 56, 207, 215, 64, 28, 20, 118, 111, 35, 148, 87, 2, 139, 198, 2, 154, 165, 35, 12, 219, 59, 240,
-    22, 249, 66, 154, 86, 42, 158, 253, 121, 248, 228, 105, 146, 173, 247, 4, 118, 230, 157, 173, 55, 122, 240, 27, 36,
-    82, 96, 241, 181, 29, 246, 102, 195, 136, 159, 226, 50, 241, 45, 171, 48, 57, 193, 58, 243, 216, 10, 111, 146, 33,
-    28, 5, 149, 233, 124, 243, 218, 190, 121, 1, 208, 157, 235, 195, 61, 228, 185, 142, 52, 167, 165, 146, 23, 42, 107,
-    217, 183, 42, 129, 2, 12, 81, 242, 106, 116, 217, 86, 170, 54, 1, 237, 124, 63, 32, 123, 165, 91, 42, 170, 68, 116,
-    55, 243, 25, 173, 246, 88, 102, 251, 39, 226, 110, 136, 251, 28, 14, 108, 4, 186, 161, 108, 194, 220, 58, 35, 156,
-    173, 252, 210, 145, 10, 121, 218, 81, 40, 46, 238, 118, 145, 122, 104, 253, 17, 87, 117, 110, 210, 204, 194, 125,
-    71, 57, 98, 116, 230, 240, 189, 187, 220, 211, 99, 231, 157, 34, 98, 126, 28, 92, 228, 128, 63, 130, 71, 48, 91, 59,
-    224, 167, 88, 190, 183, 171, 48, 164, 244, 217, 189, 145, 206, 194, 247, 180, 111, 97, 93, 109, 81, 58, 216, 255,
-    91, 143, 177, 82, 187, 193, 175, 104, 247, 120, 76, 201, 203, 75, 80, 49, 38, 212, 145, 2, 98, 190, 47, 134, 205,
-    89, 212, 184, 2, 104, 47, 66, 128, 234, 124, 130, 252, 187, 59, 132, 166, 61, 64, 29, 255, 93, 211, 104, 93, 166,
-    133, 210, 47, 230, 214, 93, 186, 172, 67, 249, 12, 124, 198, 57, 199, 144, 133, 181, 10, 163, 125, 134, 237, 111,
-    190, 105, 146, 27, 151, 46, 169, 23, 181, 104, 77, 6, 214, 124, 184, 199, 124, 59, 186, 57, 77, 55, 83, 200, 184,
-    175, 233, 61, 147, 154, 51, 93, 219, 115, 243, 118, 24, 234, 199, 167, 79, 102, 5, 56, 73, 222, 80, 130, 85, 81,
-    209, 92, 51, 201, 208, 3, 164, 75, 172, 8, 122, 35, 240, 151, 17, 173, 210, 80, 254, 246, 71, 98, 241, 196, 211,
-    145, 203, 66, 43, 106, 243, 36, 121, 104, 70, 73, 206, 156, 153, 49, 115, 202, 124, 26, 70, 208, 25, 89, 32, 255,
-    34, 162, 154, 225, 221, 244, 64, 24, 12, 89, 16, 59, 87, 162, 66, 168, 6, 155, 240, 107, 69, 239, 185, 247, 88, 63,
-    51, 205, 235, 163, 80, 162, 18, 173, 8, 202, 78, 117, 218, 217, 89, 143, 73, 165, 185, 89, 67, 35, 76, 189, 220, 66,
-    134, 133, 60, 179, 147, 34, 185, 39, 208, 22, 200, 110, 164, 204, 29, 168, 83, 98, 222, 29, 28, 30, 245, 12, 117,
-    139, 22, 238, 45, 215, 108, 15, 196, 120, 41, 6, 205, 38, 116, 166, 26, 215, 170, 15, 34, 241, 129, 170, 27, 102,
-    250, 35, 237, 19, 208, 198, 101, 220, 191, 88, 53, 93, 103, 200, 124, 160, 242, 35, 73, 98, 100, 231, 133, 235, 94,
-    163, 124, 145, 187, 150, 97, 62, 27, 40, 225, 223, 0, 249, 47, 234, 128, 104, 94, 34, 119, 243, 106, 251, 41, 248,
-    41, 233, 105, 72, 201, 237, 57, 122, 190, 22, 135, 152, 54, 141, 171, 121, 7, 132, 108, 39, 250, 86, 72, 179, 55,
-    70, 183, 251, 202, 196, 215, 35, 212, 23, 67, 116, 167, 42, 142, 97, 167, 92, 2, 100, 139, 119, 22, 9, 182, 199, 94,
-    52, 246, 128, 146, 200, 201, 4, 108, 2, 188, 120, 212, 231, 180, 223, 242, 243, 148, 123, 175, 85, 196, 197, 175,
-    176, 119, 252, 100, 83, 131, 139, 122, 244, 129, 207, 6, 251, 58, 98, 211, 149, 140, 139, 171, 77, 250, 142, 217,
-    11, 176, 105, 122, 67, 117, 142, 149, 117, 85, 123, 187, 221, 173, 17, 155, 244, 57, 77, 202, 228, 239, 107, 42, 28,
-    147, 17, 137, 53, 149, 11, 192, 90, 8, 20, 59, 23, 208, 100, 134, 56, 125, 188, 209, 160, 130, 27, 179, 15, 18, 100,
-    101, 64, 158, 84, 127, 155, 8, 178, 213, 76, 191, 103, 154, 146, 117, 25, 198, 225, 233, 51, 24, 13, 31, 97, 254,
-    135, 109, 208, 135, 79, 249, 39, 77, 87, 181, 58, 188, 106, 116, 247, 53, 32, 21, 97, 127, 184, 85, 52, 177, 80,
-    238, 118, 230, 32, 38, 183, 112, 176, 10, 48, 55, 58, 252, 45, 107, 88, 250, 241, 36, 13, 228, 168, 73, 248, 164,
-    94, 59, 195, 35, 208, 104, 145, 207, 30, 255, 214, 65, 135, 179, 102, 189, 70, 120, 2, 181, 0, 253, 245, 32, 224,
-    60, 143, 215, 147, 172, 96, 79, 0, 11, 234, 90, 21, 112, 131, 74, 143, 73, 115, 175, 250, 2, 127, 105, 214, 112, 63,
-    162, 103, 204, 236, 53, 80, 199, 108, 36, 92, 136, 238, 181, 56, 226, 238, 152, 174, 151, 204, 96, 157, 77, 150, 58,
-    129, 174, 55, 5, 159, 24, 216, 164, 126, 5, 15, 219, 154, 166, 11, 71, 109, 105, 201, 58, 141, 53, 119, 136, 183,
-    28, 171, 200, 215, 85, 142, 181, 219, 186, 117, 66, 66, 98, 210, 198, 245, 61, 24, 229, 37, 76, 129, 129, 89, 106,
-    72, 211, 196, 107, 171, 167, 134, 4, 248, 168, 88, 129, 46, 225, 234, 11, 111, 237, 103, 254, 149, 251, 89, 19, 205,
-    91, 150, 123, 81, 96, 54, 195, 131, 173, 186, 153, 140, 35, 250, 92, 193, 226, 140, 182, 170, 72, 57, 67, 112, 247,
-    112, 234, 27, 94, 124, 112, 65, 30, 235, 17, 215, 30, 208, 56, 84, 9, 197, 122, 98, 155, 70, 68, 229, 140, 17, 74,
-    230, 80, 31, 182, 241, 230, 255, 255, 6, 23, 251, 198, 225, 182, 131, 242, 150, 193, 85, 0, 20, 5, 230, 180, 119, 7,
-    224, 68, 165, 76, 28, 86, 216, 139, 69, 125, 200, 230, 60, 101, 68, 247, 247, 13, 117, 42, 31, 183, 107, 29, 58,
-    238, 8, 207, 255, 9, 235, 115, 204, 147, 80, 151, 167, 43, 11, 218, 55, 7, 126, 78, 6, 92, 199, 42, 13, 84, 151,
-    187, 174, 207, 58, 36, 95, 174, 45, 223, 41, 73, 100, 234, 161, 88, 119, 66, 96, 19, 38, 158, 106, 152, 235, 203,
-    65, 102, 126, 12, 197, 150, 243, 60, 227, 30, 155, 24, 210, 8, 177, 202, 99, 214, 202, 104, 129, 214, 87, 81, 168,
-    142, 8, 109, 78, 74, 223, 171, 60, 110, 13, 130, 250, 241, 179, 184, 12, 115, 39, 13, 52, 62, 26, 171, 207, 239, 45,
-    155, 188, 172, 64, 35, 25, 244, 251, 11, 107, 215, 203, 86, 214, 51, 69, 222, 66, 68, 95, 125, 74, 62, 239, 224, 0,
-    134, 234, 229, 22, 85, 95, 82, 14, 134, 121, 196, 166, 88, 160, 169, 160, 172, 166, 83, 153, 177, 219, 224, 224,
-    160, 183, 210, 223, 209, 143, 224, 72, 110, 91, 9, 41, 248, 240, 97, 203, 68, 17, 109, 54, 51, 207, 61, 39, 214, 28,
-    184, 210, 118, 97, 87, 202, 122, 63, 122, 212, 243, 216, 22, 83, 133, 115, 139, 238, 80, 4, 195, 87, 178, 46, 129,
-    93, 11, 160, 115, 0, 179, 160, 169, 40, 226, 41, 144, 196, 212, 10, 49, 224, 37, 59, 58, 96, 182, 151, 214, 48, 190,
-    25, 199, 133, 6, 37, 167, 98, 20, 230, 212, 182, 230, 181, 133, 70, 33, 197, 3, 75, 214, 229, 3, 18, 100, 165, 152,
-    78, 83, 155, 5, 80, 166, 193, 244, 77, 9, 40, 61, 141, 185, 209, 98, 227, 151, 215, 62, 109, 196, 254, 246, 211, 46,
-    132, 199, 177, 58, 146, 109, 21, 143, 214, 146, 241, 125, 144, 229, 223, 163, 208, 13, 174, 166, 115, 218, 191, 18,
-    223, 128, 194, 174, 24, 21, 194, 78, 158, 21, 100, 175, 9, 155, 100, 39, 92, 177, 215, 96, 130, 188, 2, 36, 147, 37,
-    109, 97, 61, 30, 26, 84, 188, 212, 90, 65, 60, 141, 165, 254, 215, 69, 130, 224, 252, 102, 188, 76, 97, 4, 174, 12,
-    55, 252, 180, 131, 248, 201, 46, 173, 219, 59, 131, 203, 158, 29, 158, 160, 149, 149, 6, 65, 138, 42, 255, 160, 2,
-    3, 20, 190, 28, 206, 211, 49, 85, 127, 28, 193, 209, 104, 249, 211, 71, 41, 166, 56, 211, 219, 75, 7, 109, 202, 13,
-    81, 139, 103, 157, 21, 223, 150, 0, 24, 76, 34, 148, 95, 49, 74, 182, 104, 11, 133, 83, 222, 165, 99, 72, 16, 193,
-    215, 14, 84, 58, 201, 12, 91, 8, 114, 211, 109, 134, 206, 171, 54, 157, 149, 242, 48, 113, 248, 87, 5, 60, 47, 110,
-    27, 19, 105, 147, 30, 244, 200, 96, 47, 2, 157, 255, 255, 16, 124, 61, 46, 129, 186, 217, 117, 253, 87, 145, 120,
-    128, 72, 119, 19, 237, 164, 168, 36, 226, 182, 242, 25, 188, 221, 217, 187, 53, 186, 51, 95, 31, 249, 14, 216, 244,
-    155, 73, 200, 102, 60, 32, 143, 45, 126, 22, 181, 28, 73, 91, 114, 233, 44, 103, 21, 141, 239, 149, 190, 214, 197,
-    79, 109, 228, 213, 152, 153, 129, 133, 76, 178, 58, 131, 60, 120, 145, 18, 142, 167, 21, 124, 87, 168, 52, 31, 188,
-    191, 125, 128, 250, 201, 108, 199, 129, 91, 139, 14, 125, 57, 142, 183, 232, 3, 182, 153, 163, 40, 133, 39, 204,
-    218, 251, 23, 90, 35, 215, 242, 252, 195, 140, 34, 56, 218, 154, 102, 2, 201, 176, 123, 193, 204, 52, 178, 96, 69,
-    172, 243, 205, 88, 91, 136, 180, 181, 235, 50, 137, 41, 170, 143, 100, 209, 60, 224, 12, 150, 237, 64, 25, 231, 105,
-    133, 200, 135, 90, 113, 243, 251, 220, 133, 247, 1, 1, 184, 239, 150, 214, 153, 239, 219, 228, 80, 94, 57, 56, 206,
-    170, 87, 250, 227, 111, 17, 208, 143, 133, 145, 27, 56, 69, 162, 43, 6, 136, 17, 59, 233, 82, 227, 26, 114, 92, 233,
-    88, 186, 250, 108, 214, 161, 79, 140, 228, 253, 175, 59, 194, 115, 63, 226, 135, 193, 198, 191, 47, 135, 184, 250,
-    244, 21, 209, 41, 254, 131, 12, 148, 246, 215, 154, 216, 210, 19, 189, 46, 235, 142, 248, 209, 178, 5, 253, 232,
-    213, 0, 88, 176, 150, 172, 44, 32, 116, 43, 164, 183, 88, 205, 144, 115, 47, 204, 36, 188, 12, 209, 83, 147, 193,
-    97, 208, 213, 50, 151, 95, 200, 226, 211, 117, 240, 138, 154, 27, 226, 153, 48, 77, 38, 163, 111, 17, 2, 97, 78, 51,
-    52, 44, 143, 237, 229, 70, 76, 231, 15, 66, 144, 159, 210, 110, 202, 196, 114, 163, 185, 156, 226, 33, 206, 34, 72,
-    99, 213, 179, 118, 61, 55, 230, 203, 143, 98, 227, 8, 223, 7, 168, 214, 234, 217, 179, 9, 32, 143, 145, 201, 165,
-    33, 229, 25, 143, 129, 120, 19, 57, 122, 118, 241, 74, 125, 131, 185, 109, 57, 113, 2, 170, 129, 249, 113, 51, 90,
-    61, 248, 60, 46, 61, 157, 190, 37, 230, 156, 222, 210, 182, 91, 83, 97, 60, 5, 236, 58, 88, 32, 248, 61, 120, 179,
-    125, 235, 71, 226, 48, 122, 9, 9, 232, 247, 72, 167, 49, 233, 28, 158, 116, 39, 180, 52, 170, 168, 138, 206, 111,
-    79, 97, 51, 241, 78, 187, 4, 246, 16, 20, 192, 61, 249, 223, 42, 59, 171, 230, 165, 253, 120, 72, 24, 68, 174, 51,
-    137, 246, 93, 3, 127, 187, 173, 239, 202, 26, 254, 96, 110, 54, 154, 205, 253, 243, 66, 26, 228, 123, 141, 98, 26,
-    121, 207, 245, 69, 203, 58, 0, 34, 167, 108, 69, 202, 29, 239, 96, 57, 52, 140, 29, 149, 50, 113, 129, 80, 199, 168,
-    192, 227, 218, 18, 249, 33, 168, 10, 226, 84, 144, 210, 53, 53, 180, 52, 2, 182, 112, 159, 214, 87, 232, 241, 200,
-    144, 9, 152, 85, 231, 142, 76, 59, 232, 135, 92, 143, 233, 31, 12, 201, 166, 214, 231, 133, 40, 165, 141, 200, 101,
-    57, 199, 127, 26, 176, 106, 192, 57, 206, 81, 127, 97, 65, 103, 140, 125, 112, 93, 238, 36, 171, 182, 22, 196, 195,
-    52, 111, 214, 181, 143, 135, 129, 251, 71, 155, 172, 196, 75, 223, 190, 162, 47, 88, 69, 187, 123, 159, 226, 198,
-    22, 188, 204, 126, 104, 185, 30, 80, 173, 242, 17, 255, 80, 211, 242, 192, 171, 116, 92, 25, 225, 125, 255, 54, 26,
-    232, 234, 146, 122, 41, 23, 193, 186, 153, 236, 132, 151, 70, 158, 74, 79, 140, 126, 73, 239, 209, 80, 231, 168,
-    110, 89, 205, 242, 130, 128, 221, 128, 30, 39, 131, 172, 45, 52, 186, 87, 22, 16, 36, 234, 106, 45, 173, 41, 39, 66,
-    162, 200, 219, 237, 235, 210, 21, 35, 100, 169, 85, 209, 84, 239, 36, 231, 132, 219, 107, 9, 29, 170, 17, 169, 83,
-    69, 39, 6, 242, 42, 85, 15, 81, 190, 75, 166, 238, 140, 249, 133, 83, 18, 189, 113, 137, 76, 46, 169, 136, 115, 204,
-    6, 205, 151, 78, 111, 116, 87, 118, 83, 12, 214, 77, 13, 149, 134, 161, 246, 131, 24, 74, 76, 64, 85, 148, 245, 5,
-    148, 18, 182, 182, 78, 165, 238, 0, 62, 37, 10, 90, 13, 79, 155, 6, 81, 59, 139, 36, 49, 48, 127, 195, 215, 227, 87,
-    107, 246, 152, 14, 96, 116, 67, 142, 31, 90, 41, 151, 6, 24, 29, 60, 104, 181, 216, 206, 37, 189, 0, 224, 121, 183,
-    83, 39, 251, 124, 179, 68, 78, 178, 101, 25, 129, 127, 162, 248, 154, 188, 6, 143, 255, 28, 178, 222, 239, 55, 205,
-    147, 101, 25, 151, 136, 216, 131, 172, 241, 188, 164, 160, 220, 60, 37, 80, 226, 53, 227, 32, 110, 107, 198, 155,
-    194, 171, 232, 163, 4, 90, 223, 107, 226, 35, 144, 116, 77, 89, 63, 143, 182, 188, 175, 96, 104, 127, 4, 98, 238,
-    35, 154, 141, 108, 139, 83, 251, 82, 137, 8, 242, 111, 191, 67, 183, 128, 100, 98, 169, 64, 100, 51, 22, 37, 91,
-    183, 123, 13, 43, 120, 194, 139, 48, 177, 17, 200, 255, 246, 52, 83, 13, 136, 41, 149, 202, 61, 242, 192, 194, 126,
-    73, 240, 61, 61, 193, 25, 104, 107, 79, 141, 180, 253, 34, 250, 144, 7, 66, 112, 122, 119, 35, 134, 192, 166, 7,
-    192, 96, 253, 135, 235, 254, 31, 68, 128, 19, 11, 241, 202, 32, 151, 109, 135, 249, 75, 214, 106, 43, 236, 117, 82,
-    19, 201, 34, 185, 139, 208, 135, 26, 139, 99, 245, 107, 125, 10, 167, 76, 160, 197, 81, 161, 236, 178, 167, 182,
-    220, 24, 230, 150, 224, 58, 147, 43, 1, 71, 70, 2, 158, 135, 10, 148, 251, 159, 196, 187, 219, 169, 1, 234, 231,
-    229, 159, 242, 131, 193, 5, 217, 82, 117, 230, 227, 41, 45, 41, 103, 31, 219, 122, 138, 49, 19, 91, 153, 130, 227,
-    131, 246, 35, 41, 3, 14, 21, 193, 43, 61, 151, 190, 20, 222, 120, 197, 145, 97, 205, 85, 232, 238, 228, 74, 250, 42,
-    88, 52, 203, 208, 222, 11, 67, 195, 87, 50, 152, 107, 199, 1, 6, 158, 240, 236, 156, 161, 0, 57, 249, 58, 183, 88,
-    92, 181, 148, 64, 29, 18, 156, 156, 173, 69, 237, 126, 250, 123, 103, 71, 236, 122, 65, 68, 224, 219, 198, 123, 37,
-    124, 188, 129, 193, 212, 81, 139, 250, 255, 120, 116, 73, 193, 234, 166, 21, 187, 26, 111, 248, 189, 49, 185, 173,
-    133, 212, 112, 60, 77, 171, 179, 33, 180, 127, 255, 242, 60, 37, 252, 95, 103, 242, 233, 9, 76, 30, 126, 79, 80,
-    218, 116, 203, 190, 174, 234, 96, 235, 134, 7, 40, 105, 113, 12, 32, 177, 210, 213, 46, 13, 19, 127, 52, 248, 155,
-    241, 209, 26, 124, 144, 237, 197, 104, 131, 58, 224, 171, 69, 86, 77, 183, 168, 209, 203, 21, 43, 237, 151, 252, 75,
-    47, 113, 136, 66, 143, 18, 28, 6, 248, 189, 150, 9, 206, 234, 67, 176, 112, 69, 128, 206, 241, 55, 224, 39, 132,
-    189, 168, 54, 39, 91, 24, 32, 244, 230, 108, 45, 120, 127, 181, 214, 3, 143, 16, 149, 37, 140, 240, 43, 27, 223,
-    238, 102, 57, 163, 93, 153, 170, 31, 66, 57, 29, 240, 110, 197, 26, 12, 117, 169, 209, 37, 153, 101, 7, 41, 103,
-    153, 45, 32, 37, 25, 166, 122, 185, 138, 138, 135, 114, 173, 17, 85, 120, 211, 11, 89, 53, 255, 218, 46, 102, 224,
-    0, 174, 125, 201, 197, 189, 215, 243, 86, 199, 197, 85, 20, 8, 162, 230, 85, 125, 192, 129, 148, 125, 98, 106, 93,
-    129, 238, 4, 19, 92, 84, 79, 188, 41, 159, 119, 127, 136, 232, 115, 242, 152, 62, 177, 47, 164, 134, 11, 125, 135,
-    68, 254, 124, 45, 227, 20, 142, 151, 253, 55, 109, 110, 69, 28, 133, 45, 178, 65, 175, 179, 242, 180, 164, 110, 176,
-    231, 211, 52, 161, 24, 12, 54, 17, 151, 7, 58, 129, 234, 69, 199, 41, 94, 12, 78, 230, 97, 224, 64, 76, 73, 201,
-    164, 1, 28, 110, 150, 116, 52, 25, 228, 44, 187, 90, 233, 8, 61, 243, 37, 133, 255, 179, 192, 12, 97, 248, 128, 113,
-    191, 187, 193, 121, 146, 32, 154, 248, 20, 6, 47, 238, 205, 243, 67, 233, 20, 243, 229, 40, 108, 41, 171, 211, 62,
-    124, 96, 229, 229, 21, 161, 49, 0, 31, 49, 236, 219, 13, 112, 99, 147, 245, 224, 154, 235, 111, 53, 206, 38, 224,
-    156, 215, 71, 23, 83, 160, 241, 149, 10, 255, 154, 0, 110, 230, 30, 152, 154, 139, 23, 53, 67, 106, 127, 142, 140,
-    22, 226, 106, 169, 156, 22, 17, 149, 68, 85, 51, 31, 33, 190, 204, 191, 242, 251, 196, 113, 224, 242, 95, 234, 237,
-    128, 153, 236, 139, 172, 115, 188, 188, 216, 90, 140, 196, 29, 236, 102, 165, 170, 45, 234, 250, 51, 106, 59, 191,
-    58, 106, 54, 20, 67, 29, 0, 220, 85, 134, 151, 134, 111, 58, 77, 226, 108, 215, 189, 120, 239, 246, 204, 138, 71,
-    25, 70, 248, 0, 253, 98, 144, 160, 187, 220, 202, 215, 233, 3, 42, 253, 90, 227, 14, 249, 55, 94, 251, 103, 68, 152,
-    226, 143, 113, 50, 218, 195, 24, 217, 43, 223, 77, 230, 148, 185, 254, 143, 52, 253, 192, 19, 191, 165, 87, 60, 69,
-    126, 19, 109, 16, 206, 142, 107, 1, 28, 197, 51, 195, 240, 102, 226, 144, 7, 82, 212, 185, 136, 187, 208, 197, 67,
-    215, 220, 144, 180, 246, 227, 73, 52, 112, 138, 233, 210, 250, 178, 15, 227, 65, 170, 219, 156, 144, 212, 134, 132,
-    157, 27, 131, 209, 186, 225, 99, 71, 35, 90, 178, 206, 10, 41, 33, 22, 49, 56, 99, 192, 5, 22, 171, 40, 47, 251, 64,
-    186, 243, 220, 5, 213, 170, 215, 186, 161, 254, 77, 42, 221, 200, 9, 167, 161, 239, 66, 227, 174, 142, 135, 237,
-    162, 188, 110, 103, 15, 106, 175, 242, 192, 154, 76, 132, 188, 179, 94, 103, 148, 109, 204, 97, 60, 197, 171, 227,
-    144, 76, 95, 77, 155, 224, 12, 57, 98, 127, 131, 222, 230, 98, 111, 238, 198, 112, 95, 15, 192, 42, 106, 30, 87,
-    177, 51, 191, 188, 56, 61, 163, 21, 219, 15, 211, 235, 232, 172, 83, 115, 126, 42, 27, 90, 20, 8, 162, 28, 39, 51,
-    39, 154, 220, 43, 73, 41, 242, 128, 90, 36, 253, 204, 124, 244, 80, 216, 170, 44, 192, 168, 116, 109, 172, 253, 168,
-    196, 164, 127, 83, 14, 166, 68, 23, 202, 96, 127, 156, 224, 82, 26, 32, 77, 29, 41, 122, 121, 112, 181, 183, 180,
-    40, 82, 22, 214, 70, 205, 121, 107, 172, 45, 107, 81, 55, 118, 234, 227, 211, 17, 26, 142, 16, 194, 11, 240, 142,
-    154, 113, 100, 205, 167, 61, 110, 45, 35, 69, 94, 156, 22, 242, 4, 142, 200, 11, 193, 125, 250, 253, 146, 159, 157,
-    91, 243, 14, 248, 14, 133, 65, 225, 28, 226, 211, 69, 85, 131, 234, 181, 146, 248, 222, 241, 211, 5, 113, 4, 149,
-    185, 73, 24, 204, 222, 199, 29, 232, 73, 29, 201, 186, 121, 248, 179, 42, 80, 131, 1, 129, 115, 214, 226, 48, 6, 57,
-    141, 110, 165, 155, 140, 252, 13, 6, 117, 51, 109, 43, 253, 188, 71, 188, 202, 19, 27, 199, 197, 1, 93, 35, 100, 78,
-    174, 126, 106, 239, 77, 178, 230, 77, 125, 109, 220, 76, 234, 62, 33, 201, 144, 85, 135, 122, 208, 51, 233, 113, 59,
-    51, 83, 154, 132, 170, 54, 148, 76, 90, 244, 240, 241, 69, 109, 190, 205, 177, 16, 218, 57, 186, 66, 226, 108, 230,
-    197, 235, 104, 44, 55, 176, 26, 33, 8, 58, 205, 156, 237, 103, 122, 138, 54, 226, 146, 103, 205, 1, 233, 219, 129,
-    163, 99, 162, 36, 227, 62, 145, 34, 217, 142, 227, 157, 50, 1, 186, 216, 45, 136, 169, 95, 3, 180, 78, 216, 18, 77,
-    10, 115, 112, 85, 217, 167, 136, 126, 253, 41, 137, 194, 207, 122, 252, 199, 216, 235, 130, 244, 83, 196, 222, 176,
-    54, 139, 79, 11, 196, 35, 177, 165, 70, 91, 105, 111, 76, 236, 27, 76, 251, 47, 102, 217, 224, 51, 226, 131, 236,
-    163, 50, 40, 187, 214, 41, 186, 11, 30, 16, 61, 204, 178, 166, 213, 201, 18, 160, 180, 127, 215, 2, 205, 138, 255,
-    180, 40, 213, 65, 98, 182, 152, 228, 108, 226, 137, 94, 37, 98, 55, 107, 212, 198, 167, 107, 8, 236, 71, 88, 30,
-    248, 87, 251, 30, 118, 213, 206, 170, 201, 218, 179, 150, 231, 109, 74, 24, 194, 41, 185, 223, 138, 2, 234, 223,
-    222, 144, 117, 189, 146, 104, 222, 29, 135, 245, 172, 153, 214, 179, 175, 190, 34, 117, 91, 44, 233, 12, 51, 72,
-    157, 74, 172, 126, 71, 131, 28, 37, 114, 109, 233, 222, 188, 182, 131, 51, 73, 114, 21, 217, 232, 162, 89, 91, 231,
-    228, 64, 43, 49, 128, 98, 10, 148, 57, 69, 158, 50, 142, 181, 75, 172, 22, 16, 55, 137, 236, 222, 122, 31, 194, 158,
-    59, 233, 78, 9, 177, 199, 82, 106, 65, 67, 3, 173, 91, 40, 231, 230, 133, 145, 73, 89, 121, 232, 77, 155, 31, 153,
-    100, 40, 176, 130, 140, 78, 59, 183, 215, 162, 32, 200, 121, 91, 36, 42, 6, 72, 118, 245, 175, 169, 80, 20, 135,
-    151, 100, 155, 114, 236, 42, 174, 177, 176, 230, 82, 147, 37, 242, 167, 126, 157, 50, 136, 112, 233, 56, 213, 170,
-    178, 140, 185, 114, 237, 71, 156, 218, 92, 154, 184, 34, 212, 96, 162, 166, 25, 163, 120, 171, 233, 31, 23, 246, 58,
-    102, 109, 252, 21, 209, 160, 195, 53, 113, 231, 254, 219, 85, 58, 180, 118, 98, 99, 143, 197, 215, 4, 253, 171, 209,
-    226, 66, 219, 50, 112, 140, 84, 241, 211, 141, 123, 254, 176, 151, 204, 235, 150, 37, 156, 233, 214, 114, 55, 168,
-    96, 133, 132, 41, 135, 73, 210, 1, 76, 200, 84, 207, 39, 233, 161, 39, 182, 199, 108, 26, 131, 2, 116, 197, 21, 98,
-    252, 29, 72, 95, 58, 165, 164, 155, 134, 223, 181, 227, 154, 119, 87, 118, 223, 4, 194, 165, 33, 5, 130, 76, 10, 29,
-    205, 59, 201, 247, 52, 169, 53, 237, 192, 67, 217, 16, 109, 172, 234, 110, 212, 72, 196, 207, 128, 7, 81, 4, 64,
-    216, 134, 140, 225, 18, 145, 201, 82, 189, 92, 69, 25, 142, 244, 203, 82, 235, 171, 184, 227, 240, 76, 134, 75, 79,
-    134, 100, 10, 151, 128, 209, 12, 81, 93, 101, 12, 126, 248, 231, 87, 159, 60, 61, 136, 244, 106, 131, 18, 89, 205,
-    235, 240, 211, 111, 115, 17, 252, 74, 41, 187, 93, 124, 68, 147, 142, 70, 104, 208, 172, 14, 233, 234, 53, 7, 221,
-    88, 99, 132, 47, 34, 148, 134, 157, 65, 52, 245, 206, 30, 113, 35, 222, 60, 249, 33, 17, 191, 204, 151, 203, 4, 101,
-    88, 89, 76, 123, 115, 94, 238, 118, 51, 95, 208, 13, 23, 248, 13, 29, 248, 106, 70, 189, 68, 141, 103, 86, 10, 100,
-    8, 117, 1, 147, 24, 215, 102, 239, 129, 46, 108, 66, 14, 154, 158, 64, 203, 141, 242, 216, 195, 217, 72, 56, 192,
-    101, 28, 140, 171, 38, 198, 230, 246, 33, 199, 133, 163, 29, 71, 202, 2, 118, 31, 178, 172, 75, 44, 210, 221, 133,
-    19, 91, 65, 141, 81, 158, 177, 131, 144, 28, 166, 88, 245, 74, 228, 9, 206, 244, 167, 131, 11, 237, 74, 145, 74,
-    204, 88, 113, 184, 188, 29, 213, 214, 149, 65, 76, 89, 249, 112, 62, 216, 84, 106, 168, 209, 191, 206, 38, 117, 201,
-    196, 185, 211, 33, 24, 79, 183, 76, 18, 149, 206, 24, 136, 20, 80, 72, 20, 227, 41, 19, 103, 43, 163, 105, 243, 179,
-    190, 13, 68, 125, 152, 15, 154, 10, 233, 242, 78, 36, 178, 3, 85, 237, 120, 159, 20, 50, 247, 191, 152, 180, 0, 233,
-    216, 202, 86, 239, 186, 20, 132, 226, 128, 172, 218, 215, 112, 177, 196, 217, 250, 242, 22, 50, 251, 189, 154, 145,
-    201, 186, 124, 245, 35, 176, 105, 76, 69, 4, 157, 135, 150, 120, 97, 58, 173, 225, 90, 71, 223, 229, 229, 138, 143,
-    173, 26, 17, 32, 193, 45, 21, 30, 60, 234, 95, 32, 141, 46, 236, 141, 125, 221, 250, 113, 41, 11, 104, 157, 31, 181,
-    171, 93, 40, 170, 206, 44, 81, 109, 38, 129, 189, 33, 96, 51, 166, 237, 117, 223, 33, 133, 219, 8, 85, 127, 115,
-    192, 250, 247, 94, 192, 156, 76, 212, 205, 244, 27, 58, 166, 168, 125, 234, 53, 248, 96, 66, 5, 185, 49, 165, 98,
-    120, 251, 150, 225, 17, 89, 210, 214, 5, 232, 196, 13, 92, 83, 119, 154, 29, 121, 1, 140, 182, 21, 56, 174, 194,
-    211, 183, 128, 200, 207, 54, 249, 213, 206, 168, 72, 52, 57, 172, 58, 224, 41, 155, 197, 228, 35, 28, 50, 50, 192,
-    233, 18, 212, 136, 247, 95, 250, 222, 59, 157, 116, 159, 148, 211, 33, 223, 67, 14, 49, 5, 80, 42, 9, 116, 214, 107,
-    23, 251, 158, 35, 221, 69, 124, 146, 223, 44, 98, 181, 150, 143, 146, 114, 203, 237, 6, 252, 62, 0, 187, 80, 45, 15,
-    225, 70, 166, 40, 180, 138, 135, 138, 67, 165, 32, 77, 99, 229, 221, 26, 120, 16, 112, 171, 69, 183, 230, 142, 211,
-    79, 50, 32, 204, 175, 20, 56, 163, 159, 36, 233, 84, 200, 28, 68, 38, 152, 24, 143, 195, 225, 65, 253, 143, 27, 130,
-    107, 146, 48, 249, 46, 99, 101, 152, 189, 50, 172, 175, 139, 231, 199, 66, 65, 60, 34, 76, 168, 136, 253, 11, 195,
-    194, 107, 72, 170, 49, 100, 6, 93, 225, 58, 143, 97, 174, 237, 133, 141, 195, 242, 229, 143, 80, 82, 78, 121, 162,
-    171, 38, 109, 241, 216, 18, 103, 80, 54, 40, 145, 30, 85, 26, 179, 74, 128, 121, 205, 186, 141, 138, 169, 140, 129,
-    67, 32, 9, 66, 190, 161, 225, 60, 9, 147, 240, 243, 235, 42, 116, 155, 105, 39, 141, 103, 12, 86, 249, 108, 7, 57,
-    122, 47, 122, 7, 175, 21, 19, 223, 216, 36, 161, 55, 246, 2, 72, 26, 16, 94, 27, 157, 83, 3, 82, 103, 190, 130, 120,
-    162, 26, 30, 213, 31, 36, 159, 24, 96, 230, 112, 128, 141, 195, 245, 182, 60, 81, 20, 28, 18, 218, 245, 48, 166,
-    118, 56, 113, 221, 131, 133, 23, 217, 11, 250, 14, 28, 133, 174, 180, 53, 20, 251, 72, 1, 61, 237, 146, 194, 227,
-    218, 104, 94, 176, 123, 156, 161, 238, 7, 210, 94, 199, 136, 13, 211, 54, 248, 239, 244, 132, 142, 102, 152, 243,
-    48, 129, 171, 202, 101, 89, 229, 123, 64, 56, 240, 248, 158, 120, 55, 79, 188, 36, 11, 237, 210, 93, 47, 2, 25, 255,
-    97, 38, 12, 41, 66, 159, 212, 82, 230, 39, 232, 17, 105, 186, 128, 180, 185, 60, 170, 235, 146, 19, 222, 211, 236,
-    152, 114, 227, 114, 131, 222, 228, 126, 230, 42, 146, 153, 173, 193, 80, 193, 177, 130, 154, 145, 157, 159, 78, 55,
-    33, 188, 216, 39, 181, 29, 235, 145, 88, 39, 128, 178, 203, 85, 231, 220, 55, 51, 153, 244, 18, 149, 216, 98, 44,
-    126, 152, 79, 190, 106, 104, 238, 173, 56, 149, 58, 87, 242, 35, 173, 55, 15, 18, 195, 218, 152, 60, 147, 245, 74,
-    120, 46, 54, 239, 93, 113, 239, 187, 127, 90, 230, 161, 179, 170, 28, 22, 99, 141, 2, 204, 78, 47, 108, 208, 204,
-    196, 129, 14, 33, 135, 218, 176, 94, 180, 26, 230, 5, 95, 191, 148, 152, 51, 46, 126, 181, 59, 175, 252, 247, 67,
-    216, 130, 227, 89, 236, 166, 52, 29, 61, 198, 153, 226, 9, 174, 93, 35, 24, 159, 96, 79, 77, 13, 74, 7, 29, 236, 62,
-    153, 127, 177, 97, 42, 121, 60, 177, 113, 7, 60, 8, 23, 248, 213, 100, 244, 73, 130, 89, 69, 47, 240, 126, 214, 247,
-    10, 228, 217, 74, 67, 55, 13, 62, 1, 71, 187, 170, 136, 19, 75, 74, 135, 226, 2, 97, 48, 158, 66, 208, 241, 27, 41,
-    78, 234, 6, 147, 78, 96, 91, 59, 128, 236, 44, 137, 42, 10, 174, 17, 224, 58, 22, 86, 162, 143, 30, 168, 97, 225,
-    96, 231, 106, 180, 11, 39, 93, 98, 186, 62, 34, 128, 182, 55, 27, 155, 92, 47, 231, 230, 202, 180, 13, 219, 252, 95,
-    161, 180, 119, 104, 213, 105, 109, 108, 143, 164, 96, 233, 138, 169, 179, 153, 236, 92, 126, 220, 59, 85, 119, 227,
-    149, 220, 228, 210, 252, 177, 255, 148, 231, 1, 174, 123, 109, 88, 103, 216, 164, 84, 243, 130, 245, 181, 220, 114,
-    84, 33, 245, 167, 129, 9, 140, 245, 107, 216, 248, 94, 175, 63, 166, 48, 111, 221, 204, 72, 103, 252, 65, 23, 242,
-    143, 17, 13, 17, 97, 114, 117, 186, 42, 59, 143, 108, 31, 73, 137, 174, 156, 188, 139, 223, 39, 0, 117, 34, 4, 130,
-    145, 254, 73, 81, 226, 72, 84, 146, 10, 143, 212, 67, 88, 238, 74, 143, 71, 132, 156, 79, 99, 167, 91, 247, 54, 93,
-    82, 164, 234, 18, 147, 67, 224, 165, 19, 4, 253, 158, 202, 248, 20, 219, 111, 110, 155, 166, 158, 170, 13, 35, 181,
-    27, 149, 11, 195, 169, 188, 125, 83, 255, 101, 167, 210, 44, 104, 165, 59, 174, 49, 109, 111, 237, 194, 46, 133, 31,
-    242, 146, 41, 221, 250, 243, 130, 74, 37, 9, 255, 18, 126, 45, 197, 28, 35, 9, 90, 69, 243, 174, 220, 200, 163, 49,
-    49, 83, 3, 188, 95, 48, 51, 191, 167, 143, 254, 50, 106, 209, 192, 110, 137, 95, 237, 18, 125, 99, 10, 152, 111,
-    213, 195, 1, 3, 51, 230, 35, 109, 112, 3, 180, 216, 36, 155, 52, 55, 143, 4, 81, 212, 69, 24, 96, 99, 40, 54, 165,
-    41, 57, 167, 107, 196, 93, 168, 244, 154, 102, 98, 117, 32, 96, 4, 73, 32, 10, 194, 2, 109, 105, 57, 34, 11, 69, 19,
-    232, 51, 117, 155, 122, 14, 224, 127, 30, 46, 133, 240, 32, 46, 233, 154, 230, 52, 64, 39, 169, 15, 51, 62, 218, 49,
-    125, 108, 58, 206, 88, 215, 125, 99, 168, 124, 104, 121, 131, 184, 121, 210, 144, 28, 155, 67, 89, 41, 114, 225,
-    246, 139, 18, 178, 134, 109, 245, 245, 210, 40, 103, 67, 83, 94, 184, 124, 183, 34, 177, 228, 240, 159, 46, 88, 118,
-    157, 227, 242, 2, 133, 65, 100, 155, 115, 56, 214, 27, 241, 249, 184, 50, 189, 145, 94, 250, 224, 214, 202, 88, 78,
-    111, 187, 16, 198, 138, 151, 87, 88, 210, 229, 161, 133, 239, 83, 162, 187, 152, 59, 200, 223, 71, 138, 13, 84, 77,
-    254, 246, 239, 178, 176, 178, 80, 96, 96, 28, 209, 164, 171, 143, 4, 54, 219, 244, 91, 134, 132, 220, 149, 247, 81,
-    132, 112, 215, 218, 110, 92, 2, 23, 239, 196, 202, 68, 100, 39, 52, 126, 2, 158, 129, 246, 192, 61, 94, 180, 26,
-    235, 119, 163, 28, 142, 15, 15, 45, 208, 127, 52, 172, 204, 252, 206, 139, 65, 159, 7, 94, 214, 32, 126, 3, 50, 142,
-    193, 182, 172, 145, 253, 142, 254, 252, 138, 57, 117, 145, 145, 85, 176, 118, 40, 32, 153, 106, 46, 71, 144, 174,
-    10, 22, 126, 198, 197, 45, 172, 167, 188, 131, 7, 54, 159, 214, 34, 2, 187, 203, 231, 204, 127, 56, 146, 217, 32,
-    44, 152, 100, 248, 123, 160, 213, 137, 7, 86, 28, 74, 185, 148, 174, 194, 255, 181, 186, 63, 17, 96, 81, 238, 195,
-    121, 218, 156, 16, 106, 214, 81, 227, 93, 169, 28, 124, 125, 79, 129, 161, 110, 33, 9, 97, 162, 8, 127, 27, 167,
-    182, 113, 27, 65, 118, 87, 193, 102, 101, 86, 107, 208, 159, 41, 122, 77, 165, 143, 213, 156, 129, 105, 56, 168,
-    179, 55, 162, 213, 22, 17, 9, 188, 102, 128, 71, 110, 70, 94, 222, 100, 194, 162, 137, 243, 6, 133, 98, 51, 243, 76,
-    106, 79, 197, 220, 30, 60, 109, 196, 92, 156, 69, 70, 178, 234, 116, 88, 178, 8, 202, 17, 35, 101, 209, 186, 215,
-    41, 183, 203, 95, 57, 184, 246, 7, 206, 100, 123, 187, 127, 124, 70, 220, 12, 91, 83, 61, 156, 101, 16, 77, 70, 145,
-    134, 138, 235, 116, 156, 95, 71, 211, 20, 8, 61, 125, 138, 181, 251, 58, 221, 116, 65, 87, 188, 3, 118, 86, 89, 164,
-    43, 212, 217, 87, 245, 240, 219, 209, 235, 220, 50, 129, 242, 226, 22, 31, 251, 232, 46, 95, 229, 107, 232, 160,
-    158, 207, 138, 60, 125, 8, 189, 108, 110, 174, 55, 183, 113, 224, 21, 40, 174, 72, 9, 49, 6, 132, 5, 159, 101, 140,
-    115, 43, 114, 205, 254, 7, 202, 156, 156, 121, 216, 106, 158, 189, 96, 40, 105, 230, 244, 68, 98, 214, 212, 57, 170,
-    136, 241, 195, 112, 11, 131, 61, 232, 24, 216, 99, 250, 68, 119, 73, 148, 152, 204, 64, 179, 211, 107, 232, 160,
-    148, 118, 57, 55, 219, 148, 117, 206, 18, 209, 7, 30, 47, 228, 48, 183, 130, 16, 43, 189, 177, 226, 173, 98, 130,
-    234, 136, 173, 203, 145, 240, 250, 126, 254, 135, 24, 48, 10, 250, 208, 148, 134, 82, 161, 84, 122, 129, 253, 102,
-    63, 244, 104, 163, 123, 1, 7, 168, 64, 244, 180, 164, 210, 205, 208, 72, 60, 107, 198, 209, 192, 219, 191, 36, 253,
-    135, 247, 176, 182, 250, 183, 93, 200, 141, 141, 109, 43, 83, 66, 15, 45, 79, 46, 165, 155, 60, 1, 157, 187, 231,
-    131, 49, 140, 46, 108, 201, 117, 242, 95, 202, 118, 156, 195, 34, 175, 57, 243, 224, 63, 134, 15, 19, 152, 40, 80,
-    135, 43, 96, 253, 239, 196, 85, 122, 142, 149, 108, 56, 15, 175, 92, 82, 115, 139, 159, 12, 243, 145, 118, 240, 175,
-    84, 215, 67, 213, 147, 136, 236, 158, 146, 47, 82, 104, 117, 178, 227, 71, 193, 71, 250, 59, 218, 101, 95, 245, 249,
-    11, 176, 5, 100, 16, 203, 72, 166, 33, 112, 210, 224, 192, 55, 219, 118, 152, 94, 34, 129, 248, 189, 233, 73, 88,
-    31, 189, 47, 67, 206, 145, 191, 230, 147, 51, 41, 245, 50, 163, 167, 39, 180, 213, 220, 99, 246, 62, 157, 233, 228,
-    56, 48, 205, 95, 88, 57, 54, 92, 88, 22, 163, 57, 178, 147, 114, 172, 191, 124, 20, 127, 176, 77, 139, 43, 165, 195,
-    191, 254, 25, 77, 168, 39, 65, 76, 172, 210, 132, 232, 154, 46, 67, 112, 8, 41, 214, 149, 224, 132, 87, 121, 111,
-    150, 172, 232, 155, 81, 145, 30, 143, 152, 19, 50, 65, 159, 13, 222, 239, 195, 84, 22, 90, 226, 203, 224, 86, 249,
-    252, 144, 202, 114, 233, 107, 72, 63, 184, 209, 78, 230, 139, 163, 165, 175, 181, 181, 0, 207, 31, 29, 33, 214, 171,
-    196, 109, 152, 80, 78, 90, 221, 83, 79, 120, 71, 46, 89, 232, 136, 179, 204, 134, 146, 108, 139, 51, 139, 55, 50,
-    210, 178, 170, 191, 98, 175, 114, 197, 195, 16, 72, 180, 87, 204, 173, 178, 104, 153, 72, 74, 46, 144, 51, 149, 13,
-    11, 236, 179, 107, 52, 77, 104, 215, 184, 129, 105, 221, 47, 113, 127, 21, 150, 113, 251, 251, 5, 34, 162, 203, 104,
-    42, 100, 200, 134, 116, 231, 246, 215, 52, 87, 152, 63, 150, 218, 60, 172, 83, 152, 22, 70, 219, 93, 167, 73, 179,
-    197, 71, 177, 18, 62, 206, 112, 161, 134, 104, 55, 55, 223, 181, 140, 13, 196, 89, 199, 83, 223, 252, 18, 195, 18,
-    170, 175, 158, 216, 227, 246, 25, 28, 157, 83, 116, 27, 49, 172, 193, 56, 195, 30, 169, 117, 116, 180, 37, 238, 88,
-    115, 79, 214, 208, 97, 181, 10, 105, 70, 205, 131, 252, 10, 4, 20, 235, 74, 26, 127, 132, 227, 232, 188, 237, 2, 18,
-    181, 183, 166, 49, 175, 174, 14, 14, 220, 15, 3, 211, 42, 197, 247, 160, 220, 91, 231, 211, 199, 6, 20, 51, 158,
-    139, 210, 144, 204, 132, 44, 109, 84, 150, 56, 43, 99, 116, 100, 124, 252, 29, 41, 131, 163, 254, 147, 13, 71, 95,
-    185, 31, 171, 82, 95, 91, 104, 194, 4, 60, 100, 174, 75, 74, 241, 244, 21, 148, 178, 146, 159, 103, 225, 186, 152,
-    170, 46, 37, 4, 197, 133, 136, 213, 133, 58, 48, 20, 198, 183, 193, 67, 111, 205, 97, 96, 99, 55, 124, 200, 2, 72,
-    101, 103, 177, 248, 168, 169, 30, 11, 11, 177, 128, 204, 145, 1, 32, 67, 53, 80, 100, 69, 158, 9, 213, 104, 111,
-    241, 105, 196, 63, 109, 54, 42, 46, 63, 71, 156, 157, 242, 151, 230, 170, 23, 108, 98, 78, 244, 177, 217, 99, 71,
-    25, 213, 145, 252, 229, 232, 51, 123, 252, 81, 240, 121, 234, 180, 193, 49, 182, 187, 175, 158, 207, 103, 48, 116,
-    115, 5, 141, 67, 22, 218, 98, 206, 179, 26, 60, 17, 249, 162, 72, 91, 36, 131, 39, 130, 217, 240, 142, 59, 168, 87,
-    217, 218, 42, 139, 67, 123, 219, 109, 222, 47, 151, 190, 5, 1, 249, 127, 21, 5, 155, 89, 156, 122, 139, 124, 133,
-    243, 238, 188, 235, 87, 215, 93, 35, 75, 30, 86, 222, 239, 63, 175, 126, 117, 206, 114, 160, 47, 12, 251, 74, 29,
-    235, 204, 149, 40, 236, 173, 100, 65, 42, 10, 144, 220, 123, 102, 106, 233, 125, 89, 231, 35, 51, 82, 93, 75, 21,
-    156, 247, 190, 45, 27, 18, 128, 227, 139, 136, 119, 81, 173, 200, 16, 143, 195, 142, 178, 166, 180, 29, 140, 137,
-    209, 5, 54, 82, 192, 47, 16, 77, 163, 102, 81, 45, 26, 151, 24, 195, 46, 120, 63, 164, 30, 41, 138, 214, 29, 75,
-    112, 40, 188, 201, 251, 103, 148, 121, 211, 177, 235, 10, 28, 202, 148, 254, 67, 28, 80, 248, 210, 107, 192, 90, 0,
-    225, 118, 104, 33, 219, 167, 169, 187, 155, 228, 36, 233, 107, 52, 249, 237, 60, 49, 148, 45, 97, 94, 122, 153, 154,
-    43, 160, 90, 239, 44, 81, 18, 157, 160, 150, 4, 3, 118, 240, 111, 139, 152, 143, 9, 201, 121, 234, 118, 155, 101,
-    222, 194, 206, 192, 48, 7, 77, 150, 171, 165, 200, 13, 19, 235, 138, 96, 92, 249, 201, 247, 146, 158, 14, 197, 166,
-    45, 139, 205, 143, 116, 212, 225, 185, 183, 102, 189, 228, 231, 51, 242, 112, 140, 8, 250, 48, 225, 90, 137, 239,
-    26, 18, 203, 125, 158, 164, 153, 96, 91, 16, 36, 73, 49, 185, 163, 112, 89, 169, 241, 138, 186, 204, 165, 209, 139,
-    204, 191, 142, 206, 107, 136, 235, 204, 116, 96, 92, 158, 218, 192, 205, 110, 200, 47, 251, 0, 90, 166, 146, 113,
-    97, 214, 237, 169, 205, 153, 161, 113, 204, 50, 177, 9, 217, 49, 81, 92, 41, 18, 109, 240, 187, 181, 143, 19, 229,
-    38, 28, 204, 171, 84, 38, 13, 216, 53, 8, 228, 230, 33, 18, 25, 110, 227, 156, 83, 145, 13, 250, 13, 112, 13, 234,
-    22, 164, 69, 81, 136, 124, 0, 87, 88, 99, 210, 174, 168, 0, 128, 29, 217, 74, 23, 253, 176, 152, 247, 193, 212, 59,
-    147, 100, 94, 157, 252, 45, 22, 139, 83, 82, 52, 115, 165, 180, 160, 129, 41, 31, 141, 55, 231, 132, 28, 184, 179,
-    6, 243, 15, 123, 195, 16, 109, 16, 197, 12, 137, 198, 33, 54, 231, 235, 43, 29, 179, 183, 135, 168, 251, 247, 123,
-    3, 20, 131, 191, 244, 103, 81, 32, 95, 158, 94, 128, 180, 75, 119, 46, 80, 91, 77, 165, 142, 105, 239, 219, 148,
-    202, 80, 0, 55, 144, 30, 220, 60, 210, 177, 202, 178, 123, 107, 246, 151, 128, 215, 152, 108, 165, 208, 45, 233,
-    128, 105, 121, 208, 127, 24, 110, 14, 98, 245, 145, 76, 95, 9, 157, 216, 67, 35, 160, 206, 59, 10, 125, 209, 242,
-    138, 129, 5, 68, 143, 92, 149, 148, 225, 36, 231, 223, 168, 130, 204, 245, 147, 38, 110, 21, 141, 103, 60, 245, 26,
-    173, 199, 153, 225, 122, 104, 136, 115, 100, 115, 221, 254, 223, 167, 59, 170, 35, 180, 160, 14, 107, 53, 24, 108,
-    199, 174, 18, 32, 208, 54, 162, 72, 169, 33, 240, 69, 173, 73, 76, 216, 169, 230, 161, 230, 252, 112, 191, 114, 214,
-    175, 125, 219, 125, 78, 21, 114, 155, 154, 105, 225, 250, 97, 245, 238, 253, 175, 239, 148, 44, 241, 195, 61, 16,
-    94, 56, 149, 20, 84, 176, 231, 229, 55, 114, 196, 163, 157, 17, 237, 34, 97, 177, 247, 0, 214, 30, 211, 233, 70,
-    101, 208, 16, 53, 240, 119, 49, 15, 75, 121, 138, 88, 111, 82, 90, 182, 238, 83, 104, 192, 177, 85, 86, 227, 138,
-    224, 118, 189, 100, 233, 232, 115, 133, 181, 204, 226, 196, 24, 79, 84, 86, 80, 180, 119, 99, 136, 34, 153, 150, 28,
-    168, 91, 141, 184, 36, 90, 208, 25, 127, 166, 234, 136, 253, 196, 244, 227, 142, 243, 189, 154, 58, 132, 9, 82, 41,
-    12, 213, 72, 2, 7, 15, 138, 187, 65, 150, 226, 81, 56, 200, 19, 71, 240, 189, 58, 230, 39, 213, 60, 163, 205, 215,
-    18, 115, 1, 79, 225, 55, 43, 37, 117, 189, 203, 126, 128, 51, 59, 55, 197, 210, 168, 32, 28, 24, 72, 76, 108, 103,
-    136, 81, 5, 2, 27, 88, 235, 219, 114, 195, 5, 220, 83, 87, 86, 171, 3, 56, 8, 251, 98, 130, 157, 210, 139, 94, 49,
-    166, 141, 77, 181, 175, 117, 111, 30, 37, 93, 174, 251, 65, 156, 135, 154, 229, 232, 106, 216, 245, 217, 93, 40,
-    118, 216, 44, 12, 211, 1, 196, 114, 228, 207, 24, 255, 67, 205, 206, 224, 188, 195, 200, 104, 74, 36, 97, 242, 61,
-    3, 216, 14, 32, 198, 16, 125, 134, 144, 197, 167, 144, 136, 137, 131, 70, 23, 84, 37, 25, 112, 205, 56, 208, 10, 63,
-    175, 72, 224, 156, 88, 69, 246, 30, 58, 57, 242, 36, 127, 197, 232, 147, 234, 167, 114, 91, 29, 63, 254, 216, 149,
-    70, 204, 247, 29, 14, 213, 171, 4, 234, 182, 157, 194, 7, 41, 28, 126, 123, 181, 72, 80, 100, 126, 151, 205, 161,
-    223, 245, 154, 78, 6, 252, 202, 237, 106, 96, 19, 83, 226, 187, 71, 148, 62, 16, 7, 143, 135, 91, 89, 41, 83, 150,
-    151, 210, 228, 191, 123, 148, 153, 246, 21, 43, 128, 138, 50, 139, 157, 206, 206, 161, 1, 136, 250, 108, 24, 60,
-    151, 205, 44, 57, 1, 225, 163, 108, 48, 183, 162, 9, 198, 134, 152, 206, 190, 125, 13, 125, 27, 2, 35, 180, 253, 24,
-    209, 47, 159, 94, 52, 104, 171, 162, 169, 28, 3, 234, 242, 2, 35, 73, 95, 126, 56, 214, 37, 8, 244, 217, 154, 203,
-    45, 253, 91, 29, 186, 221, 216, 58, 48, 163, 240, 211, 247, 56, 204, 4, 94, 72, 49, 4, 38, 128, 69, 204, 187, 132,
-    135, 166, 117, 213, 133, 233, 95, 36, 211, 146, 51, 89, 236, 168, 252, 96, 35, 6, 177, 229, 60, 87, 185, 253, 121,
-    166, 119, 96, 54, 244, 71, 240, 24, 84, 172, 233, 83, 12, 78, 166, 35, 120, 87, 22, 73, 251, 25, 12, 75, 105, 154,
-    254, 205, 151, 228, 102, 138, 151, 133, 179, 232, 176, 8, 203, 235, 215, 160, 251, 203, 43, 220, 78, 47, 30, 211,
-    188, 46, 52, 97, 73, 118, 223, 122, 62, 133, 84, 107, 198, 126, 237, 105, 34, 97, 68, 224, 122, 103, 119, 28, 169,
-    237, 132, 72, 3, 122, 37, 189, 70, 20, 38, 253, 80, 239, 80, 28, 47, 192, 255, 186, 186, 246, 243, 166, 240, 14,
-    240, 15, 105, 125, 129, 154, 203, 107, 7, 188, 152, 209, 164, 202, 247, 27, 204, 166, 117, 127, 242, 64, 13, 148,
-    204, 195, 104, 203, 67, 93, 232, 196, 145, 90, 38, 64, 61, 20, 134, 26, 50, 118, 76, 137, 224, 208, 68, 130, 123,
-    35, 201, 209, 137, 234, 97, 183, 52, 209, 33, 157, 240, 7, 240, 186, 89, 40, 2, 202, 192, 198, 34, 115, 93, 130, 59,
-    163, 230, 247, 195, 34, 108, 240, 126, 113, 225, 48, 98, 75, 107, 42, 45, 10, 48, 2, 2, 243, 137, 150, 255, 116,
-    192, 36, 158, 233, 169, 172, 217, 75, 45, 73, 69, 111, 227, 29, 45, 222, 0, 152, 191, 210, 148, 202, 247, 238, 81,
-    161, 248, 212, 255, 119, 13, 77, 185, 64, 64, 38, 70, 247, 39, 118, 110, 198, 135, 171, 53, 234, 236, 107, 36, 114,
-    13, 173, 166, 135, 9, 123, 24, 81, 243, 69, 186, 219, 52, 60, 250, 178, 90, 71, 17, 9, 26, 117, 124, 104, 214, 138,
-    77, 80, 218, 68, 64, 95, 219, 121, 137, 102, 246, 133, 44, 149, 242, 70, 30, 42, 93, 57, 177, 218, 201, 160, 99,
-    186, 175, 231, 123, 252, 186, 228, 212, 125, 243, 107, 64, 2, 122, 114, 138, 62, 156, 142, 13, 70, 169, 187, 250,
-    236, 168, 115, 196, 179, 122, 11, 210, 37, 30, 109, 185, 252, 132, 247, 120, 210, 107, 223, 141, 244, 230, 145, 36,
-    221, 26, 88, 36, 191, 139, 50, 84, 112, 121, 225, 246, 189, 29, 155, 157, 78, 120, 155, 96, 76, 91, 8, 116, 143,
-    126, 92, 66, 242, 246, 103, 70, 154, 179, 250, 208, 1, 80, 172, 254, 184, 165, 128, 73, 116, 85, 42, 239, 177, 231,
-    234, 155, 50, 153, 227, 176, 183, 63, 224, 205, 17, 3, 225, 73, 106, 239, 215, 248, 244, 136, 71, 71, 53, 128, 207,
-    142, 169, 44, 64, 50, 53, 70, 62, 122, 54, 97, 88, 118, 40, 211, 205, 19, 134, 129, 57, 129, 77, 14, 253, 209, 22,
-    90, 156, 82, 111, 65, 169, 54, 197, 130, 231, 152, 106, 99, 82, 33, 129, 52, 175, 137, 210, 16, 251, 85, 192, 71,
-    53, 85, 93, 137, 234, 254, 56, 48, 24, 30, 215, 192, 29, 82, 8, 140, 39, 94, 159, 84, 7, 77, 178, 230, 131, 78, 18,
-    195, 230, 93, 230, 90, 163, 33, 247, 47, 223, 234, 180, 222, 2, 115, 158, 9, 13, 87, 22, 139, 38, 16, 72, 69, 197,
-    186, 170, 144, 103, 179, 215, 123, 20, 52, 157, 216, 199, 228, 104, 121, 0, 142, 78, 84, 19, 222, 124, 31, 204, 110,
-    142, 211, 224, 203, 171, 84, 218, 105, 137, 71, 163, 215, 78, 193, 159, 186, 82, 222, 193, 247, 90, 189, 195, 181,
-    86, 2, 225, 172, 43, 51, 141, 77, 163, 49, 151, 101, 153, 198, 25, 184, 243, 27, 139, 88, 219, 129, 160, 154, 66,
-    84, 96, 92, 224, 118, 50, 87, 38, 197, 187, 157, 146, 3, 67, 45, 156, 94, 192, 10, 61, 90, 119, 48, 72, 114, 150,
-    70, 94, 58, 120, 232, 117, 141, 201, 1, 157, 225, 103, 187, 240, 25, 19, 204, 47, 251, 217, 246, 218, 200, 65, 178,
-    175, 212, 20, 174, 67, 184, 16, 141, 228, 251, 75, 88, 153, 19, 219, 227, 49, 161, 86, 48, 200, 83, 54, 128, 190,
-    43, 240, 101, 170, 125, 28, 240, 218, 185, 123, 223, 51, 250, 54, 139, 233, 196, 198, 38, 80, 103, 42, 210, 145,
-    247, 117, 218, 199, 4, 198, 12, 153, 135, 71, 141, 207, 254, 90, 57, 93, 15, 170, 141, 22, 247, 255, 192, 147, 45,
-    4, 168, 11, 218, 106, 140, 137, 174, 2, 47, 93, 60, 106, 112, 89, 179, 182, 140, 241, 60, 97, 97, 110, 80, 1, 64,
-    247, 43, 88, 140, 59, 68, 66, 96, 130, 64, 159, 19, 45, 149, 199, 178, 43, 254, 29, 141, 92, 238, 233, 167, 97, 4,
-    169, 87, 143, 35, 208, 93, 56, 115, 25, 197, 132, 171, 6, 99, 133, 54, 65, 45, 14, 229, 196, 156, 30, 149, 82, 211,
-    198, 118, 102, 23, 60, 122, 147, 120, 74, 115, 100, 72, 96, 165, 46, 191, 239, 140, 25, 225, 46, 92, 224, 163, 49,
-    240, 71, 25, 162, 83, 137, 36, 90, 248, 57, 115, 241, 14, 248, 26, 160, 60, 199, 152, 106, 45, 242, 43, 81, 28, 182,
-    132, 3, 153, 211, 230, 111, 83, 16, 170, 11, 9, 249, 120, 115, 83, 215, 15, 226, 157, 140, 114, 208, 205, 126, 45,
-    33, 90, 224, 200, 33, 196, 34, 154, 80, 212, 150, 16, 99, 201, 152, 42, 130, 62, 100, 204, 185, 187, 94, 157, 206,
-    198, 185, 230, 101, 85, 191, 59, 66, 203, 121, 55, 85, 95, 81, 131, 113, 70, 212, 35, 104, 98, 128, 37, 171, 224,
-    168, 229, 95, 151, 115, 78, 67, 121, 90, 70, 78, 48, 105, 123, 22, 36, 246, 43, 60, 22, 32, 20, 236, 245, 57, 157,
-    91, 98, 231, 245, 183, 231, 124, 99, 254, 194, 116, 91, 103, 56, 156, 80, 19, 227, 3, 245, 194, 61, 39, 147, 55,
-    170, 14, 116, 179, 211, 144, 163, 157, 111, 64, 179, 246, 115, 147, 226, 210, 238, 210, 42, 122, 114, 43, 56, 249,
-    149, 125, 161, 156, 2, 207, 158, 21, 143, 198, 38, 249, 218, 73, 165, 234, 245, 66, 118, 220, 7, 103, 89, 165, 85,
-    240, 17, 42, 50, 248, 76, 76, 113, 142, 53, 53, 53, 161, 252, 102, 171, 47, 55, 60, 88, 192, 71, 93, 155, 32, 22,
-    24, 122, 225, 161, 26, 136, 128, 154, 26, 123, 13, 100, 214, 175, 65, 51, 86, 50, 203, 69, 56, 200, 35, 245, 54, 88,
-    140, 38, 225, 155, 163, 115, 61, 175, 126, 24, 244, 43, 0, 242, 245, 17, 176, 244, 168, 189, 220, 59, 149, 1, 26,
-    154, 128, 94, 235, 152, 65, 41, 182, 34, 229, 39, 139, 81, 97, 233, 12, 59, 248, 249, 140, 146, 68, 35, 37, 211,
-    230, 249, 48, 166, 15, 22, 99, 133, 223, 96, 248, 66, 53, 92, 53, 93, 206, 171, 144, 113, 189, 92, 206, 59, 172,
-    228, 67, 175, 128, 197, 186, 23, 223, 10, 163, 128, 149, 161, 143, 206, 132, 17, 199, 92, 149, 83, 68, 130, 215, 96,
-    250, 79, 24, 129, 30, 136, 80, 203, 121, 45, 25, 242, 110, 214, 198, 129, 46, 50, 16, 238, 190, 133, 171, 79, 210,
-    1, 14, 211, 165, 138, 246, 187, 182, 129, 204, 206, 43, 160, 130, 47, 1, 171, 120, 115, 67, 164, 46, 85, 176, 128,
-    13, 32, 221, 219, 224, 33, 16, 31, 56, 52, 81, 171, 229, 42, 223, 12, 211, 140, 136, 190, 178, 108, 242, 8, 104, 9,
-    89, 62, 130, 178, 65, 112, 8, 58, 117, 216, 95, 80, 153, 247, 120, 49, 113, 246, 8, 67, 229, 230, 254, 91, 206, 191,
-    155, 44, 56, 21, 203, 225, 76, 179, 124, 232, 227, 70, 54, 208, 144, 98, 251, 211, 166, 235, 154, 35, 223, 170, 157,
-    63, 141, 129, 135, 97, 25, 102, 1, 53, 109, 182, 89, 98, 108, 214, 99, 164, 250, 118, 170, 204, 221, 117, 93, 219,
-    113, 128, 181, 199, 148, 30, 40, 220, 145, 190, 173, 171, 247, 147, 188, 92, 38, 252, 221, 189, 80, 243, 144, 244,
-    251, 76, 52, 41, 155, 150, 121, 90, 17, 238, 187, 86, 82, 235, 33, 44, 138, 185, 145, 26, 153, 81, 234, 167, 252,
-    155, 94, 5, 130, 183, 157, 132, 244, 239, 171, 94, 39, 37, 154, 224, 102, 104, 188, 244, 219, 198, 226, 176, 204,
-    116, 59, 153, 167, 28, 183, 117, 251, 59, 245, 18, 41, 167, 57, 129, 183, 50, 3, 41, 136, 164, 29, 205, 176, 237,
-    249, 79, 74, 204, 89, 5, 20, 73, 6, 219, 178, 153, 180, 171, 251, 142, 71, 93, 80, 182, 16, 22, 207, 96, 61, 75, 64,
-    120, 90, 173, 165, 186, 213, 186, 71, 217, 35, 185, 136, 134, 110, 189, 169, 209, 136, 211, 244, 192, 110, 149, 214,
-    80, 116, 21, 11, 97, 121, 224, 190, 34, 114, 202, 137, 13, 22, 40, 33, 78, 82, 96, 25, 128, 163, 0, 139, 43, 222,
-    69, 48, 208, 252, 229, 63, 219, 151, 203, 50, 227, 145, 160, 194, 203, 84, 58, 146, 190, 60, 112, 239, 106, 219, 7,
-    120, 157, 18, 127, 25, 193, 139, 10, 201, 57, 197, 113, 118, 111, 77, 146, 233, 54, 24, 119, 111, 6, 43, 238, 95,
-    85, 179, 180, 159, 82, 169, 10, 55, 242, 156, 22, 252, 213, 255, 122, 31, 28, 234, 59, 165, 214, 48, 77, 140, 97, 0,
-    235, 38, 24, 0, 224, 60, 169, 151, 200, 194, 161, 182, 203, 221, 186, 164, 47, 244, 116, 216, 47, 140, 54, 54, 12,
-    115, 177, 218, 154, 150, 122, 42, 128, 237, 89, 87, 28, 177, 50, 37, 30, 126, 185, 213, 178, 125, 98, 104, 196, 16,
-    4, 165, 141, 148, 217, 210, 95, 20, 187, 197, 202, 132, 2, 76, 251, 200, 32, 172, 8, 218, 47, 193, 99, 230, 9, 245,
-    181, 66, 29, 202, 51, 95, 216, 191, 141, 11, 255, 246, 64, 117, 24, 200, 17, 71, 110, 177, 246, 17, 102, 66, 139,
-    46, 173, 248, 14, 55, 43, 109, 247, 6, 178, 135, 251, 192, 165, 150, 22, 27, 111, 188, 111, 181, 52, 247, 62, 244,
-    204, 57, 61, 55, 100, 200, 156, 73, 153, 114, 179, 70, 180, 39, 54, 248, 159, 217, 3, 12, 119, 216, 212, 217, 190,
-    95, 181, 197, 203, 234, 20, 19, 150, 38, 98, 144, 40, 56, 129, 159, 103, 226, 92, 176, 161, 58, 9, 225, 177, 80,
-    138, 51, 220, 198, 63, 169, 84, 213, 175, 143, 146, 66, 192, 10, 5, 214, 149, 21, 150, 198, 114, 226, 39, 73, 9,
-    192, 169, 166, 85, 192, 40, 54, 42, 163, 16, 37, 156, 175, 14, 194, 211, 100, 26, 56, 39, 55, 86, 29, 241, 99, 245,
-    167, 249, 109, 87, 82, 178, 203, 81, 127, 232, 226, 214, 162, 53, 106, 36, 74, 255, 251, 249, 216, 203, 250, 5, 236,
-    31, 193, 191, 132, 105, 55, 191, 81, 11, 193, 250, 228, 63, 146, 184, 142, 203, 208, 74, 15, 30, 253, 203, 176, 27,
-    227, 143, 220, 198, 245, 3, 215, 164, 216, 35, 91, 52, 128, 9, 191, 38, 247, 50, 4, 93, 183, 217, 129, 154, 179, 22,
-    129, 34, 246, 28, 82, 251, 230, 93, 134, 129, 197, 162, 143, 189, 184, 187, 35, 93, 25, 249, 239, 120, 150, 18, 64,
-    130, 147, 174, 144, 201, 213, 116, 84, 6, 236, 95, 236, 96, 247, 241, 160, 58, 98, 59, 214, 23, 185, 245, 30, 32,
-    148, 225, 199, 221, 20, 30, 108, 233, 188, 134, 178, 197, 157, 179, 118, 69, 37, 129, 207, 216, 80, 132, 85, 166,
-    48, 36, 246, 83, 210, 242, 90, 183, 144, 248, 238, 96, 224, 142, 214, 73, 132, 40, 127, 96, 71, 252, 135, 219, 89,
-    35, 215, 197, 157, 230, 75, 225, 100, 104, 228, 168, 157, 152, 140, 50, 174, 228, 211, 125, 175, 118, 63, 185, 118,
-    212, 74, 151, 39, 152, 163, 178, 150, 4, 36, 203, 222, 120, 183, 142, 211, 253, 208, 165, 81, 218, 152, 80, 134, 51,
-    111, 80, 243, 179, 36, 24, 197, 192, 161, 224, 249, 204, 85, 24, 109, 176, 203, 175, 169, 131, 22, 48, 22, 44, 72,
-    223, 198, 162, 70, 46, 111, 70, 22, 239, 65, 55, 21, 80, 98, 22, 111, 155, 28, 40, 172, 244, 113, 83, 166, 208, 8,
-    53, 172, 198, 19, 10, 103, 241, 105, 73, 52, 122, 112, 194, 104, 45, 198, 8, 99, 142, 9, 231, 70, 142, 248, 160,
-    111, 38, 60, 188, 160, 143, 117, 27, 72, 58, 185, 106, 168, 74, 175, 240, 230, 125, 53, 68, 244, 178, 95, 201, 9,
-    147, 159, 178, 231, 91, 39, 192, 61, 15, 199, 123, 37, 178, 31, 175, 210, 68, 70, 116, 81, 87, 207, 110, 100, 225,
-    112, 193, 5, 160, 122, 78, 21, 149, 83, 242, 140, 181, 58, 210, 185, 195, 4, 146, 128, 66, 4, 72, 99, 79, 158, 51,
-    61, 15, 70, 117, 214, 67, 68, 217, 135, 0, 0, 189, 189, 70, 77, 247, 196, 112, 71, 80, 54, 101, 78, 194, 88, 24, 77,
-    41, 0, 109, 240, 159, 159, 118, 18, 130, 135, 190, 186, 47, 122, 245, 22, 81, 205, 197, 223, 129, 197, 241, 115,
-    176, 249, 238, 42, 73, 13, 86, 18, 39, 14, 206, 236, 210, 176, 198, 1, 72, 20, 45, 59, 91, 9, 19, 37, 107, 147, 247,
-    232, 252, 189, 38, 175, 182, 77, 225, 139, 74, 88, 87, 227, 124, 214, 156, 211, 5, 170, 169, 146, 187, 169, 202,
-    237, 82, 176, 38, 14, 62, 82, 185, 90, 17, 17, 110, 173, 157, 149, 38, 246, 165, 197, 127, 243, 82, 239, 106, 102,
-    226, 3, 138, 98, 150, 74, 252, 189, 217, 85, 63, 93, 230, 246, 65, 232, 244, 229, 105, 237, 254, 140, 104, 46, 163,
-    69, 207, 40, 176, 61, 235, 255, 116, 240, 118, 39, 139, 36, 112, 211, 233, 82, 157, 53, 127, 90, 219, 253, 148, 27,
-    84, 236, 236, 14, 249, 59, 12, 89, 128, 253, 221, 252, 124, 220, 132, 226, 11, 201, 142, 107, 123, 179, 58, 172,
-    187, 238, 255, 92, 218, 177, 33, 242, 113, 252, 55, 63, 231, 228, 248, 8, 184, 106, 152, 52, 6, 215, 78, 68, 50,
-    141, 103, 201, 94, 161, 45, 255, 42, 232, 123, 52, 15, 3, 199, 141, 236, 73, 83, 171, 108, 30, 126, 11, 249, 108,
-    139, 36, 142, 148, 48, 59, 81, 109, 249, 236, 91, 146, 174, 32, 190, 5, 116, 15, 9, 4, 214, 127, 8, 192, 107, 231,
-    229, 97, 99, 169, 39, 202, 199, 51, 74, 91, 131, 15, 126, 11, 207, 83, 121, 210, 211, 63, 78, 36, 253, 91, 135, 71,
-    187, 88, 241, 45, 76, 158, 75, 63, 77, 236, 191, 152, 27, 103, 188, 68, 108, 101, 90, 85, 133, 192, 102, 183, 103,
-    81, 213, 74, 27, 102, 212, 197, 30, 154, 115, 237, 4, 146, 39, 73, 67, 131, 57, 25, 143, 199, 241, 46, 162, 42, 103,
-    30, 204, 155, 93, 137, 90, 39, 46, 123, 71, 169, 183, 102, 10, 14, 243, 131, 224, 175, 229, 177, 68, 145, 8, 24,
-    191, 2, 20, 248, 74, 59, 118, 233, 17, 227, 107, 67, 119, 251, 40, 173, 144, 23, 226, 224, 197, 234, 75, 206, 242,
-    23, 121, 84, 29, 205, 248, 192, 208, 118, 173, 82, 191, 9, 78, 42, 104, 159, 167, 141, 160, 23, 102, 62, 181, 45,
-    181, 103, 214, 64, 234, 33, 24, 242, 54, 29, 196, 204, 128, 18, 126, 138, 36, 246, 215, 231, 251, 43, 91, 232, 50,
-    171, 197, 45, 235, 161, 179, 15, 3, 117, 72, 146, 249, 146, 183, 135, 162, 57, 250, 123, 160, 74, 125, 16, 245, 143,
-    59, 134, 168, 138, 189, 55, 47, 126, 230, 224, 200, 136, 185, 7, 153, 110, 22, 26, 123, 66, 82, 154, 89, 38, 111,
-    120, 84, 22, 130, 206, 26, 12, 145, 17, 254, 234, 65, 114, 52, 124, 199, 19, 193, 78, 31, 155, 196, 104, 149, 221,
-    41, 92, 1, 207, 150, 21, 156, 194, 191, 64, 253, 238, 230, 26, 112, 98, 249, 222, 234, 1, 3, 239, 218, 253, 240,
-    199, 144, 136, 79, 82, 231, 111, 1, 64, 29, 98, 123, 97, 48, 36, 200, 223, 89, 123, 80, 226, 255, 197, 228, 174, 99,
-    169, 188, 195, 215, 201, 127, 108, 30, 4, 237, 167, 40, 220, 56, 125, 207, 246, 12, 32, 210, 215, 47, 116, 110, 109,
-    171, 214, 137, 2, 160, 178, 211, 114, 73, 217, 215, 228, 229, 245, 61, 104, 241, 112, 168, 152, 27, 153, 167, 201,
-    172, 202, 54, 119, 94, 78, 81, 244, 112, 85, 244, 140, 21, 189, 120, 136, 158, 165, 219, 10, 235, 21, 226, 8, 148,
-    225, 35, 127, 206, 40, 61, 202, 196, 53, 226, 61, 88, 140, 83, 19, 138, 178, 16, 102, 59, 71, 136, 52, 144, 163,
-    141, 18, 172, 46, 85, 157, 139, 167, 170, 215, 189, 44, 135, 212, 248, 12, 74, 59, 3, 36, 87, 129, 5, 104, 219, 235,
-    208, 6, 101, 155, 151, 158, 61, 163, 203, 22, 123, 249, 28, 5, 99, 13, 62, 224, 135, 45, 220, 169, 36, 252, 96, 132,
-    115, 72, 60, 116, 252, 35, 251, 185, 251, 233, 188, 184, 103, 146, 141, 47, 153, 232, 216, 126, 198, 228, 19, 57,
-    41, 131, 121, 248, 21, 78, 0, 1, 211, 84, 251, 239, 210, 59, 71, 197, 110, 251, 39, 189, 165, 114, 142, 232, 66,
-    247, 143, 139, 229, 95, 253, 19, 80, 125, 140, 177, 118, 15, 192, 66, 1, 223, 216, 109, 223, 87, 156, 244, 181, 147,
-    192, 2, 142, 174, 3, 231, 191, 23, 37, 94, 124, 62, 179, 151, 98, 154, 226, 232, 231, 155, 69, 166, 3, 190, 170, 60,
-    254, 161, 107, 114, 166, 53, 210, 6, 200, 86, 44, 17, 157, 84, 149, 30, 144, 135, 13, 245, 94, 185, 43, 223, 121,
-    32, 157, 239, 64, 116, 24, 81, 203, 69, 59, 151, 151, 151, 58, 114, 176, 39, 223, 218, 166, 234, 85, 119, 52, 50,
-    234, 145, 130, 199, 214, 50, 252, 59, 187, 227, 52, 105, 249, 215, 232, 163, 252, 59, 225, 255, 224, 42, 87, 235,
-    136, 249, 93, 215, 246, 228, 136, 101, 219, 39, 81, 85, 165, 228, 139, 149, 96, 13, 212, 56, 96, 52, 84, 2, 147, 77,
-    59, 26, 239, 81, 45, 139, 214, 109, 230, 253, 210, 237, 17, 92, 132, 221, 121, 6, 242, 200, 209, 72, 147, 230, 36,
-    120, 85, 128, 84, 171, 233, 236, 101, 37, 27, 23, 3, 186, 158, 181, 102, 105, 25, 200, 82, 157, 19, 91, 246, 68,
-    135, 12, 200, 15, 148, 209, 215, 165, 134, 125, 14, 47, 132, 102, 191, 7, 20, 213, 190, 40, 220, 240, 183, 14, 28,
-    240, 47, 66, 137, 35, 66, 169, 105, 73, 124, 135, 85, 214, 185, 94, 93, 11, 23, 198, 3, 184, 239, 24, 255, 254, 209,
-    202, 216, 89, 87, 30, 185, 59, 24, 196, 254, 178, 10, 215, 62, 109, 245, 133, 131, 14, 24, 231, 127, 35, 230, 201,
-    91, 14, 172, 167, 96, 225, 19, 141, 220, 63, 83, 10, 126, 233, 140, 194, 103, 14, 228, 23, 87, 200, 209, 78, 3, 247,
-    2, 31, 155, 155, 7, 8, 98, 178, 48, 43, 17, 242, 218, 23, 164, 53, 166, 19, 182, 152, 0, 121, 69, 243, 58, 158, 130,
-    180, 83, 33, 198, 22, 118, 79, 145, 158, 79, 69, 135, 65, 83, 223, 174, 241, 253, 234, 92, 71, 92, 76, 80, 179, 219,
-    202, 230, 231, 30, 26, 192, 249, 111, 171, 249, 30, 200, 124, 27, 187, 55, 140, 133, 231, 54, 190, 39, 178, 39, 255,
-    127, 107, 48, 121, 194, 71, 218, 200, 200, 184, 4, 98, 220, 114, 136, 142, 79, 232, 47, 241, 21, 235, 59, 12, 176,
-    61, 95, 203, 61, 9, 246, 13, 130, 113, 230, 174, 222, 201, 233, 6, 203, 165, 226, 115, 225, 170, 190, 159, 11, 99,
-    211, 147, 157, 53, 242, 144, 147, 27, 152, 85, 49, 24, 138, 96, 248, 216, 15, 16, 43, 186, 97, 71, 167, 248, 113,
-    157, 214, 231, 243, 20, 88, 166, 147, 129, 222, 239, 134, 76, 188, 41, 242, 83, 54, 28, 201, 236, 36, 1, 12, 1, 94,
-    14, 116, 8, 156, 101, 92, 39, 128, 98, 81, 27, 171, 210, 243, 17, 138, 217, 49, 128, 246, 64, 201, 187, 113, 67,
-    216, 86, 226, 13, 67, 218, 176, 212, 182, 85, 51, 128, 28, 93, 72, 124, 241, 149, 229, 80, 222, 40, 7, 162, 32, 43,
-    156, 155, 170, 222, 235, 203, 243, 170, 106, 121, 216, 139, 170, 210, 227, 172, 21, 48, 222, 40, 59, 43, 66, 252,
-    130, 110, 97, 204, 253, 50, 113, 12, 158, 65, 76, 144, 235, 90, 87, 5, 10, 82, 182, 24, 131, 39, 98, 162, 248, 213,
-    194, 67, 96, 112, 206, 123, 122, 8, 88, 238, 72, 39, 105, 93, 38, 202, 52, 25, 243, 30, 16, 48, 140, 193, 121, 136,
-    237, 19, 241, 97, 92, 182, 69, 121, 136, 205, 133, 52, 230, 129, 77, 126, 210, 142, 97, 211, 63, 19, 236, 234, 172,
-    161, 123, 135, 61, 206, 166, 220, 132, 27, 6, 160, 33, 227, 192, 18, 120, 199, 86, 24, 14, 92, 102, 7, 46, 95, 224,
-    178, 14, 79, 222, 153, 83, 240, 206, 178, 149, 254, 90, 18, 27, 163, 21, 128, 120, 182, 134, 63, 1, 185, 165, 167,
-    238, 127, 160, 236, 185, 160, 124, 74, 76, 68, 215, 197, 209, 236, 182, 79, 107, 253, 176, 224, 90, 71, 102, 186,
-    31, 113, 131, 179, 156, 16, 8, 137, 8, 198, 93, 67, 91, 87, 154, 126, 190, 136, 255, 225, 10, 134, 16, 226, 64, 113,
-    140, 134, 108, 141, 120, 251, 117, 83, 205, 42, 155, 102, 166, 230, 11, 21, 117, 30, 71, 162, 131, 22, 87, 255, 246,
-    85, 36, 47, 223, 7, 204, 227, 76, 12, 111, 207, 99, 96, 36, 249, 135, 208, 2, 216, 125, 17, 102, 237, 157, 237, 94,
-    228, 41, 89, 150, 123, 112, 154, 95, 149, 41, 190, 172, 191, 20, 172, 81, 198, 105, 158, 83, 0, 46, 146, 164, 219,
-    74, 244, 48, 33, 205, 24, 20, 8, 143, 240, 162, 161, 137, 6, 250, 204, 188, 190, 116, 15, 158, 210, 214, 170, 249,
-    8, 54, 138, 212, 43, 21, 169, 52, 123, 76, 152, 86, 213, 112, 10, 172, 91, 92, 220, 82, 114, 34, 60, 20, 102, 52,
-    91, 153, 90, 100, 183, 60, 242, 236, 174, 119, 55, 105, 0, 14, 226, 38, 231, 202, 82, 46, 236, 32, 54, 92, 141, 178,
-    81, 97, 228, 208, 11, 164, 117, 59, 99, 143, 223, 72, 249, 163, 198, 197, 79, 5, 192, 84, 137, 216, 114, 56, 24, 41,
-    138, 84, 255, 246, 157, 226, 141, 167, 213, 232, 113, 51, 217, 205, 74, 118, 240, 44, 64, 135, 235, 60, 198, 53, 63,
-    136, 9, 54, 68, 220, 225, 169, 142, 160, 206, 221, 185, 183, 202, 156, 230, 185, 114, 28, 42, 28, 229, 223, 234,
-    115, 58, 38, 147, 41, 194, 59, 28, 85, 98, 221, 62, 17, 59, 151, 120, 184, 222, 164, 112, 59, 161, 104, 151, 187,
-    151, 219, 153, 203, 28, 138, 7, 192, 235, 3, 108, 181, 101, 224, 179, 66, 180, 231, 253, 89, 246, 56, 27, 200, 224,
-    55, 6, 110, 4, 135, 85, 59, 55, 25, 80, 182, 85, 152, 154, 253, 206, 117, 19, 4, 87, 8, 33, 101, 139, 193, 178, 21,
-    103, 50, 8, 8, 170, 219, 0, 36, 64, 9, 239, 103, 194, 77, 64, 175, 244, 97, 10, 165, 228, 139, 149, 35, 46, 84, 156,
-    170, 127, 112, 112, 38, 17, 143, 119, 10, 35, 184, 177, 38, 83, 49, 180, 71, 10, 41, 134, 1, 14, 181, 136, 70, 25,
-    255, 30, 174, 245, 214, 78, 72, 185, 178, 40, 50, 226, 84, 239, 215, 84, 21, 111, 187, 35, 152, 220, 246, 37, 62,
-    174, 149, 227, 67, 31, 62, 16, 27, 41, 190, 128, 38, 248, 75, 161, 248, 16, 94, 34, 190, 10, 8, 222, 94, 143, 207,
-    80, 60, 34, 217, 231, 255, 98, 71, 161, 194, 213, 8, 224, 197, 77, 220, 243, 123, 185, 245, 186, 189, 205, 66, 134,
-    98, 20, 102, 92, 143, 213, 40, 66, 180, 127, 45, 176, 64, 127, 234, 59, 23, 79, 68, 97, 215, 119, 117, 55, 216, 245,
-    63, 108, 76, 246, 118, 190, 72, 61, 128, 159, 195, 219, 32, 241, 191, 210, 117, 106, 11, 30, 230, 218, 126, 106,
-    137, 22, 7, 94, 52, 169, 55, 135, 124, 122, 201, 43, 230, 188, 210, 6, 78, 102, 9, 78, 153, 212, 61, 71, 173, 27,
-    184, 202, 149, 233, 179, 213, 171, 81, 96, 202, 237, 50, 177, 251, 166, 20, 61, 126, 225, 50, 108, 93, 70, 108, 23,
-    172, 69, 117, 102, 70, 28, 54, 229, 12, 199, 140, 223, 192, 61, 237, 72, 170, 227, 166, 144, 220, 133, 74, 161, 57,
-    153, 182, 56, 164, 52, 21, 31, 70, 145, 76, 222, 171, 82, 112, 232, 240, 126, 130, 97, 158, 48, 43, 82, 193, 156, 8,
-    75, 82, 87, 54, 99, 127, 75, 32, 199, 180, 105, 51, 5, 3, 140, 121, 53, 41, 8, 220, 173, 165, 68, 6, 131, 228, 115,
-    113, 7, 181, 111, 85, 237, 26, 116, 85, 144, 197, 78, 136, 83, 75, 158, 190, 111, 180, 169, 53, 124, 143, 188, 207,
-    250, 169, 183, 204, 187, 168, 185, 74, 19, 233, 164, 150, 181, 208, 21, 52, 15, 254, 61, 191, 148, 5, 54, 15, 159,
-    0, 32, 158, 209, 140, 227, 93, 230, 155, 121, 74, 130, 150, 158, 105, 33, 143, 139, 231, 200, 205, 71, 97, 26, 107,
-    242, 226, 254, 3, 227, 46, 141, 37, 160, 0, 218, 112, 134, 231, 143, 128, 33, 235, 215, 174, 59, 211, 34, 85, 217,
-    52, 183, 114, 121, 13, 64, 129, 238, 62, 66, 183, 3, 246, 159, 123, 132, 94, 172, 46, 164, 29, 221, 150, 178, 223,
-    76, 107, 81, 193, 254, 191, 158, 12, 103, 104, 45, 133, 162, 72, 56, 132, 189, 31, 192, 141, 103, 246, 68, 15, 181,
-    104, 155, 96, 34, 138, 30, 35, 164, 97, 110, 131, 103, 94, 131, 31, 48, 58, 35, 237, 129, 30, 244, 82, 185, 242, 88,
-    60, 182, 14, 204, 156, 240, 95, 207, 186, 23, 249, 127, 62, 61, 215, 63, 111, 106, 8, 113, 123, 89, 187, 184, 116,
-    244, 236, 62, 127, 3, 249, 42, 213, 6, 85, 107, 132, 110, 104, 218, 133, 128, 76, 209, 155, 152, 80, 76, 143, 96,
-    21, 28, 244, 208, 203, 33, 187, 122, 229, 118, 223, 154, 52, 168, 78, 104, 115, 235, 189, 173, 163, 118, 192, 178,
-    170, 206, 45, 221, 97, 98, 20, 205, 24, 234, 5, 136, 211, 237, 71, 108, 176, 124, 48, 251, 210, 34, 247, 195, 99,
-    234, 21, 255, 168, 4, 108, 68, 69, 255, 126, 142, 98, 62, 177, 53, 205, 13, 99, 207, 121, 223, 165, 138, 122, 135,
-    93, 187, 126, 248, 220, 69, 45, 181, 227, 55, 249, 209, 225, 219, 110, 178, 149, 253, 69, 49, 244, 65, 59, 254, 112,
-    60, 32, 207, 86, 229, 250, 103, 44, 216, 173, 11, 44, 70, 132, 143, 245, 218, 149, 133, 239, 167, 151, 161, 162, 61,
-    155, 101, 56, 18, 237, 34, 223, 53, 178, 136, 32, 235, 20, 106, 39, 254, 37, 240, 2, 86, 141, 10, 160, 27, 157, 153,
-    119, 87, 198, 251, 213, 245, 121, 178, 167, 4, 75, 119, 19, 181, 199, 31, 179, 0, 203, 162, 234, 141, 184, 246, 243,
-    145, 35, 116, 10, 68, 143, 3, 136, 227, 231, 252, 91, 119, 129, 133, 213, 221, 81, 207, 194, 209, 146, 205, 160, 65,
-    60, 67, 138, 100, 7, 65, 49, 233, 204, 239, 158, 196, 154, 37, 232, 198, 33, 96, 199, 239, 221, 54, 168, 31, 123,
-    16, 57, 70, 250, 197, 4, 156, 153, 168, 254, 3, 155, 51, 130, 163, 149, 168, 205, 59, 172, 50, 41, 173, 137, 168,
-    163, 143, 217, 6, 21, 217, 231, 156, 147, 174, 225, 154, 237, 29, 179, 123, 23, 191, 196, 162, 105, 182, 82, 43,
-    221, 115, 91, 231, 219, 158, 254, 235, 70, 248, 62, 55, 159, 155, 156, 78, 95, 209, 75, 60, 182, 193, 185, 119, 101,
-    99, 133, 48, 82, 124, 179, 230, 129, 168, 103, 243, 237, 56, 173, 26, 46, 228, 114, 62, 142, 243, 120, 91, 150, 159,
-    228, 183, 119, 225, 21, 44, 36, 8, 68, 177, 147, 10, 226, 195, 252, 221, 47, 187, 58, 110, 221, 116, 125, 251, 145,
-    12, 123, 240, 218, 191, 25, 1, 8, 225, 197, 34, 51, 136, 130, 90, 188, 24, 59, 21, 95, 178, 131, 215, 11, 221, 194,
-    250, 11, 20, 201, 214, 168, 94, 248, 10, 187, 158, 194, 203, 38, 222, 126, 197, 56, 153, 178, 210, 2, 199, 134, 33,
-    58, 136, 242, 219, 98, 102, 227, 122, 28, 83, 196, 142, 3, 41, 59, 163, 130, 229, 17, 89, 217, 33, 1, 38, 51, 94,
-    86, 188, 143, 124, 77, 48, 80, 216, 192, 74, 39, 193, 82, 185, 219, 197, 38, 3, 79, 121, 206, 94, 9, 192, 2, 35, 73,
-    18, 189, 72, 213, 196, 64, 129, 80, 176, 245, 109, 214, 62, 70, 234, 104, 226, 6, 78, 110, 229, 95, 22, 62, 239, 14,
-    149, 170, 93, 79, 158, 84, 65, 252, 121, 247, 185, 119, 225, 217, 39, 27, 89, 156, 171, 128, 46, 17, 78, 129, 215,
-    22, 51, 225, 116, 150, 1, 216, 53, 17, 44, 162, 203, 41, 86, 201, 27, 45, 36, 185, 253, 45, 168, 200, 234, 197, 150,
-    209, 239, 21, 117, 128, 144, 189, 69, 12, 15, 96, 120, 122, 15, 230, 76, 136, 212, 228, 194, 224, 201, 141, 61, 255,
-    52, 135, 241, 10, 18, 15, 39, 163, 225, 125, 78, 87, 245, 95, 13, 61, 150, 162, 42, 77, 189, 165, 51, 174, 227, 29,
-    5, 142, 24, 217, 87, 152, 242, 4, 251, 201, 165, 232, 78, 212, 204, 145, 237, 220, 114, 121, 224, 119, 95, 186, 200,
-    112, 33, 86, 16, 149, 32, 91, 244, 43, 19, 121, 170, 72, 210, 146, 84, 168, 38, 159, 211, 36, 38, 53, 228, 9, 142,
-    207, 60, 99, 141, 194, 252, 74, 168, 83, 116, 144, 122, 173, 197, 183, 239, 198, 85, 164, 223, 235, 138, 230, 246,
-    21, 240, 232, 117, 37, 181, 207, 181, 149, 5, 249, 80, 133, 205, 207, 36, 77, 224, 48, 233, 15, 4, 151, 72, 14, 230,
-    139, 128, 247, 55, 133, 198, 241, 107, 120, 146, 3, 95, 175, 69, 172, 50, 202, 4, 16, 232, 100, 40, 82, 100, 71, 52,
-    241, 198, 115, 83, 224, 160, 172, 210, 47, 206, 4, 87, 237, 205, 138, 167, 172, 248, 225, 195, 41, 44, 140, 167,
-    199, 236, 117, 127, 30, 223, 252, 172, 77, 250, 38, 10, 160, 227, 237, 252, 154, 189, 224, 3, 187, 173, 147, 205,
-    130, 49, 219, 198, 119, 168, 121, 255, 111, 14, 162, 209, 190, 154, 228, 179, 254, 36, 192, 225, 97, 157, 160, 212,
-    177, 111, 116, 24, 169, 37, 26, 158, 30, 1, 134, 9, 165, 29, 39, 159, 26, 244, 71, 34, 188, 1, 240, 95, 134, 202,
-    63, 208, 214, 216, 192, 189, 96, 50, 110, 67, 87, 130, 62, 201, 8, 29, 155, 127, 22, 198, 33, 198, 207, 107, 201,
-    35, 239, 64, 63, 187, 109, 120, 94, 81, 202, 96, 226, 114, 189, 182, 114, 159, 81, 184, 213, 63, 222, 33, 137, 88,
-    52, 62, 124, 134, 9, 33, 65, 152, 205, 204, 46, 81, 120, 103, 82, 30, 216, 29, 217, 45, 168, 119, 254, 98, 53, 34,
-    234, 160, 102, 254, 3, 181, 179, 96, 30, 0, 36, 30, 140, 223, 196, 125, 11, 61, 3, 109, 103, 182, 79, 85, 116, 84,
-    129, 227, 46, 189, 166, 65, 184, 179, 189, 171, 37, 103, 56, 213, 58, 17, 84, 61, 81, 116, 205, 127, 109, 112, 151,
-    3, 214, 70, 213, 64, 22, 19, 10, 120, 91, 72, 116, 143, 119, 109, 142, 9, 190, 103, 47, 95, 126, 220, 75, 184, 97,
-    176, 129, 253, 38, 202, 63, 142, 89, 200, 133, 31, 113, 12, 141, 242, 206, 33, 88, 92, 202, 156, 189, 157, 120, 238,
-    30, 194, 43, 63, 8, 46, 14, 67, 120, 246, 107, 239, 156, 157, 144, 215, 36, 64, 17, 189, 151, 191, 35, 24, 251, 169,
-    43, 165, 156, 242, 3, 245, 181, 55, 137, 97, 43, 93, 212, 128, 143, 171, 253, 177, 28, 205, 191, 222, 136, 63, 108,
-    124, 191, 5, 253, 58, 34, 240, 28, 253, 131, 38, 32, 7, 8, 23, 13, 116, 75, 252, 79, 34, 104, 0, 179, 251, 177, 137,
-    74, 160, 135, 8, 5, 10, 11, 46, 32, 73, 75, 253, 187, 25, 168, 103, 44, 242, 234, 216, 81, 230, 252, 222, 99, 173,
-    143, 43, 171, 201, 117, 203, 165, 120, 74, 46, 32, 206, 218, 151, 248, 250, 192, 37, 199, 7, 57, 57, 245, 8, 158,
-    57, 67, 170, 211, 254, 125, 0, 223, 79, 39, 43, 160, 177, 128, 80, 124, 36, 249, 70, 5, 175, 160, 241, 231, 46, 67,
-    187, 132, 82, 45, 146, 30, 217, 203, 29, 99, 234, 101, 16, 205, 226, 25, 157, 148, 250, 33, 162, 52, 58, 238, 23,
-    183, 59, 71, 217, 31, 16, 47, 201, 36, 241, 195, 79, 227, 93, 95, 4, 13, 94, 16, 170, 233, 176, 113, 62, 214, 161,
-    237, 167, 51, 124, 74, 162, 124, 157, 165, 228, 103, 245, 158, 120, 81, 232, 146, 7, 87, 22, 208, 37, 188, 14, 35,
-    39, 38, 232, 98, 171, 57, 187, 134, 183, 245, 214, 209, 229, 56, 14, 133, 67, 239, 241, 211, 24, 187, 189, 85, 112,
-    69, 33, 76, 154, 192, 215, 239, 25, 211, 171, 176, 89, 204, 208, 14, 133, 20, 32, 198, 16, 4, 87, 80, 187, 25, 84,
-    114, 135, 79, 46, 207, 57, 228, 28, 204, 229, 114, 203, 73, 125, 122, 170, 2, 249, 58, 138, 155, 126, 19, 232, 246,
-    64, 79, 213, 118, 252, 152, 157, 207, 202, 147, 23, 120, 191, 60, 114, 63, 132, 83, 133, 171, 193, 119, 209, 127,
-    118, 60, 47, 211, 137, 159, 173, 45, 78, 208, 80, 152, 76, 146, 140, 159, 94, 95, 135, 136, 143, 94, 141, 178, 222,
-    219, 110, 229, 208, 190, 67, 35, 234, 82, 199, 132, 46, 138, 69, 25, 154, 5, 92, 5, 246, 84, 102, 54, 151, 249, 122,
-    235, 126, 154, 21, 217, 111, 236, 25, 136, 97, 211, 201, 174, 245, 69, 172, 109, 78, 122, 133, 63, 245, 61, 96, 124,
-    135, 178, 110, 231, 79, 116, 142, 143, 98, 52, 74, 137, 96, 252, 245, 45, 216, 57, 12, 251, 73, 34, 113, 186, 172,
-    184, 23, 254, 118, 134, 173, 81, 94, 168, 134, 45, 23, 39, 23, 59, 193, 227, 249, 210, 145, 71, 155, 7, 164, 87, 34,
-    181, 209, 254, 234, 185, 97, 26, 219, 144, 38, 87, 138, 31, 254, 6, 119, 21, 77, 193, 190, 30, 145, 38, 240, 251,
-    238, 57, 126, 78, 0, 207, 36, 109, 61, 191, 133, 93, 211, 25, 114, 175, 165, 212, 15, 255, 94, 84, 46, 43, 210, 141,
-    30, 77, 46, 198, 249, 92, 122, 102, 22, 231, 131, 91, 17, 17, 97, 36, 65, 95, 134, 125, 254, 251, 39, 194, 58, 190,
-    134, 182, 76, 83, 125, 182, 61, 69, 87, 153, 220, 113, 28, 30, 71, 243, 177, 147, 112, 153, 191, 117, 254, 255, 2,
-    45, 61, 198, 198, 73, 118, 143, 134, 183, 59, 185, 220, 41, 94, 91, 184, 136, 88, 225, 1, 25, 209, 240, 238, 163,
-    136, 230, 75, 97, 4, 172, 98, 37, 7, 29, 57, 194, 180, 138, 200, 149, 24, 5, 87, 20, 58, 124, 176, 181, 140, 250,
-    204, 250, 135, 110, 255, 7, 160, 171, 61, 18, 128, 95, 141, 97, 43, 242, 117, 208, 107, 247, 63, 239, 144, 152, 199,
-    193, 130, 51, 0, 41, 233, 241, 201, 172, 17, 193, 31, 221, 116, 23, 227, 164, 252, 151, 194, 211, 156, 234, 54, 74,
-    32, 89, 63, 143, 212, 16, 117, 89, 44, 104, 36, 188, 214, 77, 156, 63, 187, 71, 22, 186, 192, 18, 62, 68, 222, 201,
-    163, 52, 247, 173, 9, 230, 69, 193, 176, 184, 39, 84, 141, 61, 73, 65, 134, 149, 29, 99, 229, 124, 173, 142, 235,
-    143, 249, 179, 114, 187, 89, 139, 198, 62, 192, 28, 95, 39, 175, 233, 30, 140, 125, 78, 76, 17, 176, 77, 33, 232,
-    88, 246, 78, 171, 57, 254, 107, 65, 46, 48, 140, 158, 242, 99, 55, 100, 180, 106, 62, 35, 235, 175, 8, 183, 187, 74,
-    220, 56, 71, 63, 214, 190, 149, 252, 157, 244, 3, 193, 17, 87, 49, 166, 175, 204, 5, 108, 218, 84, 48, 103, 187,
-    136, 186, 85, 204, 0, 74, 184, 212, 14, 131, 138, 63, 84, 108, 152, 75, 61, 48, 34, 57, 106, 78, 53, 249, 214, 134,
-    233, 165, 36, 155, 103, 38, 201, 124, 128, 160, 238, 173, 98, 77, 139, 120, 12, 6, 81, 160, 13, 68, 231, 192, 82,
-    189, 47, 238, 252, 102, 196, 187, 120, 158, 74, 95, 71, 71, 245, 62, 22, 199, 153, 109, 19, 103, 83, 120, 4, 12, 46,
-    184, 106, 14, 146, 218, 128, 249, 201, 25, 145, 173, 60, 202, 216, 140, 17, 210, 204, 70, 224, 131, 173, 50, 169,
-    46, 84, 190, 180, 250, 204, 115, 171, 76, 51, 0, 117, 30, 27, 219, 176, 108, 34, 193, 149, 251, 51, 10, 117, 49,
-    242, 84, 27, 90, 13, 82, 199, 133, 23, 51, 172, 59, 4, 177, 15, 51, 176, 200, 91, 18, 125, 86, 190, 233, 129, 213,
-    221, 174, 242, 214, 44, 140, 59, 40, 89, 255, 253, 7, 160, 100, 105, 244, 75, 225, 40, 91, 190, 93, 14, 169, 126,
-    252, 45, 129, 164, 170, 15, 153, 248, 203, 113, 22, 151, 73, 171, 54, 195, 213, 170, 171, 81, 39, 24, 58, 139, 254,
-    210, 34, 79, 248, 83, 3, 235, 65, 7, 106, 140, 163, 117, 216, 163, 155, 243, 151, 198, 193, 144, 220, 8, 249, 194,
-    69, 56, 36, 193, 86, 198, 75, 174, 110, 198, 161, 240, 228, 205, 79, 163, 244, 61, 69, 144, 27, 53, 239, 248, 12,
-    122, 233, 33, 85, 142, 177, 6, 75, 90, 189, 179, 204, 207, 106, 174, 31, 141, 136, 139, 33, 119, 35, 184, 169, 57,
-    181, 74, 156, 234, 48, 168, 45, 97, 163, 65, 210, 55, 172, 253, 170, 156, 138, 226, 50, 71, 54, 22, 77, 202, 109,
-    21, 194, 130, 250, 140, 4, 227, 108, 123, 94, 148, 225, 249, 93, 19, 180, 99, 215, 119, 254, 237, 82, 12, 201, 15,
-    253, 9, 14, 222, 85, 143, 72, 127, 193, 86, 155, 41, 127, 191, 204, 37, 117, 7, 125, 253, 145, 29, 110, 161, 160,
-    213, 77, 227, 125, 112, 180, 68, 176, 14, 234, 199, 157, 95, 156, 71, 204, 102, 8, 40, 237, 3, 81, 18, 183, 80, 1,
-    132, 44, 174, 157, 54, 171, 26, 189, 142, 137, 250, 198, 163, 2, 96, 232, 136, 52, 151, 217, 165, 185, 161, 81, 215,
-    136, 193, 161, 228, 83, 12, 20, 163, 200, 197, 148, 20, 135, 102, 176, 190, 230, 21, 23, 122, 136, 199, 7, 215, 76,
-    194, 227, 10, 99, 92, 229, 241, 226, 152, 238, 253, 219, 180, 152, 181, 160, 58, 1, 38, 199, 78, 217, 32, 193, 88,
-    207, 7, 114, 53, 81, 102, 254, 226, 76, 136, 113, 146, 50, 228, 104, 214, 38, 19, 151, 231, 40, 132, 49, 158, 162,
-    251, 27, 163, 243, 168, 200, 58, 49, 170, 180, 232, 194, 189, 98, 81, 20, 52, 230, 152, 83, 19, 54, 92, 85, 136,
-    152, 223, 202, 56, 83, 221, 168, 169, 114, 15, 247, 100, 238, 174, 68, 61, 89, 149, 146, 31, 115, 2, 199, 210, 3,
-    152, 162, 190, 33, 149, 218, 241, 119, 132, 42, 174, 220, 155, 52, 170, 208, 205, 43, 255, 40, 109, 201, 12, 51,
-    254, 80, 139, 225, 201, 128, 77, 166, 233, 63, 244, 170, 194, 238, 175, 171, 172, 188, 58, 93, 151, 17, 220, 175, 5,
-    110, 42, 193, 215, 74, 218, 244, 198, 68, 12, 135, 29, 33, 21, 126, 245, 49, 67, 15, 169, 213, 35, 205, 171, 116,
-    120, 230, 221, 92, 28, 83, 74, 51, 55, 242, 42, 114, 51, 242, 122, 15, 106, 181, 244, 23, 25, 99, 141, 230, 35, 182,
-    85, 161, 50, 33, 38, 213, 81, 194, 71, 21, 49, 2, 153, 24, 237, 182, 218, 194, 226, 90, 199, 245, 248, 45, 253, 6,
-    190, 183, 239, 30, 126, 85, 133, 214, 11, 11, 253, 223, 16, 92, 45, 169, 36, 64, 221, 138, 57, 16, 239, 63, 236,
-    109, 176, 49, 190, 211, 193, 50, 72, 245, 106, 37, 191, 113, 172, 220, 205, 108, 18, 41, 159, 17, 4, 158, 130, 186,
-    84, 13, 210, 28, 190, 121, 40, 150, 254, 135, 209, 108, 193, 189, 188, 145, 183, 139, 239, 227, 177, 7, 239, 198,
-    238, 25, 43, 167, 217, 176, 103, 62, 162, 160, 226, 100, 39, 252, 171, 91, 44, 68, 134, 206, 116, 158, 197, 171,
-    167, 11, 133, 241, 158, 184, 95, 86, 53, 146, 236, 197, 64, 103, 222, 14, 69, 49, 209, 91, 46, 249, 93, 11, 26, 151,
-    35, 38, 161, 172, 19, 6, 184, 177, 147, 12, 148, 232, 216, 152, 68, 252, 72, 18, 137, 59, 31, 129, 85, 252, 127,
-    146, 106, 35, 96, 52, 239, 123, 253, 120, 66, 57, 147, 208, 33, 23, 74, 181, 69, 34, 167, 131, 246, 77, 51, 25, 81,
-    89, 35, 150, 172, 251, 87, 240, 28, 201, 48, 142, 100, 181, 191, 251, 143, 132, 176, 58, 63, 91, 221, 237, 41, 249,
-    132, 229, 200, 134, 165, 17, 24, 170, 194, 254, 228, 222, 230, 134, 37, 31, 72, 184, 210, 202, 57, 38, 146, 228, 9,
-    86, 247, 76, 55, 42, 37, 88, 228, 184, 179, 17, 128, 152, 234, 143, 227, 131, 57, 9, 67, 79, 246, 194, 36, 88, 243,
-    210, 54, 183, 121, 6, 94, 98, 99, 40, 153, 90, 82, 91, 136, 196, 221, 239, 71, 7, 162, 204, 129, 112, 142, 62, 220,
-    68, 125, 168, 94, 144, 5, 11, 98, 24, 92, 168, 184, 116, 172, 67, 97, 111, 25, 192, 2, 205, 236, 64, 239, 243, 255,
-    224, 171, 122, 169, 226, 112, 96, 10, 63, 102, 118, 33, 249, 4, 254, 176, 124, 247, 203, 226, 91, 2, 122, 115, 248,
-    253, 178, 95, 150, 55, 213, 100, 148, 172, 191, 115, 191, 224, 237, 163, 56, 160, 224, 252, 248, 194, 176, 113, 166,
-    9, 183, 244, 149, 200, 250, 248, 79, 151, 144, 13, 216, 175, 213, 74, 156, 138, 61, 255, 250, 25, 27, 249, 207, 130,
-    37, 21, 197, 97, 196, 83, 138, 215, 132, 92, 234, 197, 70, 106, 31, 78, 234, 133, 168, 196, 113, 160, 195, 98, 137,
-    179, 252, 19, 19, 120, 129, 5, 148, 189, 72, 35, 130, 217, 152, 0, 27, 108, 14, 89, 218, 146, 243, 102, 181, 79, 41,
-    7, 80, 42, 150, 208, 120, 157, 62, 81, 87, 82, 138, 78, 134, 50, 70, 91, 199, 188, 129, 64, 245, 91, 200, 106, 247,
-    175, 6, 197, 148, 20, 114, 228, 46, 6, 46, 180, 167, 41, 33, 245, 212, 230, 218, 194, 172, 38, 132, 133, 44, 206,
-    48, 2, 158, 212, 105, 167, 202, 126, 101, 230, 7, 203, 242, 111, 128, 48, 46, 247, 190, 138, 158, 133, 73, 102, 229,
-    118, 98, 68, 87, 152, 241, 184, 147, 147, 109, 76, 16, 110, 30, 235, 60, 247, 8, 233, 15, 204, 184, 103, 126, 122,
-    251, 124, 146, 239, 212, 129, 3, 195, 171, 115, 39, 147, 47, 220, 241, 39, 27, 202, 227, 203, 148, 179, 89, 233,
-    200, 202, 90, 124, 166, 167, 133, 175, 47, 205, 16, 224, 234, 181, 64, 10, 19, 84, 32, 183, 199, 216, 54, 44, 37,
-    127, 158, 141, 224, 131, 223, 194, 113, 138, 72, 158, 139, 113, 218, 44, 217, 191, 121, 211, 35, 8, 142, 167, 121,
-    184, 222, 84, 189, 67, 2, 170, 203, 79, 122, 29, 119, 69, 151, 20, 88, 151, 253, 194, 29, 76, 161, 44, 146, 237,
-    255, 213, 123, 18, 105, 239, 54, 133, 51, 238, 247, 213, 18, 152, 229, 37, 209, 220, 64, 123, 61, 16, 119, 244, 218,
-    26, 0, 225, 155, 177, 229, 43, 131, 82, 61, 252, 120, 210, 231, 57, 144, 234, 90, 141, 107, 81, 88, 168, 42, 30,
-    122, 123, 52, 185, 130, 184, 38, 112, 118, 135, 234, 253, 149, 193, 3, 15, 88, 218, 251, 70, 179, 150, 253, 110, 40,
-    232, 228, 16, 169, 47, 222, 7, 51, 31, 74, 67, 48, 117, 42, 51, 172, 67, 218, 165, 194, 18, 63, 125, 83, 132, 133,
-    248, 249, 104, 61, 53, 88, 22, 194, 181, 172, 68, 57, 15, 209, 136, 26, 189, 52, 33, 128, 103, 154, 252, 168, 88,
-    41, 166, 29, 46, 88, 181, 13, 206, 46, 3, 63, 34, 249, 27, 207, 249, 29, 247, 203, 150, 117, 5, 27, 139, 65, 168,
-    69, 50, 12, 53, 165, 21, 6, 181, 77, 103, 242, 39, 212, 72, 71, 225, 232, 70, 65, 188, 76, 219, 98, 30, 95, 128,
-    240, 198, 201, 248, 112, 4, 160, 74, 223, 86, 250, 93, 225, 107, 110, 1, 190, 135, 227, 204, 144, 161, 55, 127, 246,
-    245, 225, 244, 79, 247, 122, 192, 193, 254, 3, 53, 52, 79, 237, 211, 104, 233, 104, 212, 139, 146, 143, 227, 231,
-    137, 104, 175, 120, 97, 137, 120, 177, 57, 47, 208, 33, 44, 160, 202, 67, 63, 172, 222, 58, 243, 59, 53, 19, 187,
-    239, 76, 111, 15, 207, 168, 38, 21, 174, 132, 255, 58, 189, 3, 211, 48, 20, 163, 211, 79, 187, 165, 167, 67, 125,
-    48, 132, 139, 246, 35, 70, 235, 102, 14, 180, 253, 225, 2, 149, 16, 96, 91, 167, 209, 163, 248, 136, 174, 149, 109,
-    253, 147, 221, 211, 37, 73, 83, 50, 67, 223, 240, 27, 0, 172, 236, 6, 97, 144, 15, 124, 18, 0, 95, 10, 23, 50, 13,
-    51, 156, 200, 191, 33, 8, 15, 187, 140, 190, 62, 124, 210, 145, 157, 75, 76, 188, 65, 103, 178, 56, 150, 201, 222,
-    149, 181, 67, 4, 248, 152, 214, 240, 249, 75, 193, 4, 146, 62, 177, 177, 170, 202, 19, 13, 217, 166, 80, 192, 203,
-    139, 166, 39, 50, 2, 66, 151, 81, 56, 112, 246, 58, 200, 165, 234, 158, 227, 139, 160, 45, 221, 151, 239, 124, 136,
-    116, 58, 188, 111, 51, 102, 34, 50, 220, 251, 44, 162, 242, 7, 151, 20, 133, 84, 168, 142, 222, 177, 106, 71, 180,
-    161, 225, 146, 89, 195, 208, 124, 199, 1, 169, 191, 137, 176, 117, 208, 70, 125, 184, 229, 163, 140, 39, 12, 134,
-    209, 199, 1, 204, 225, 44, 249, 49, 84, 32, 3, 117, 45, 137, 75, 217, 194, 76, 217, 40, 128, 145, 14, 4, 128, 218,
-    36, 228, 56, 179, 116, 59, 150, 194, 198, 239, 64, 247, 89, 61, 99, 244, 226, 19, 176, 17, 227, 249, 163, 64, 2, 94,
-    18, 75, 166, 26, 131, 71, 20, 157, 96, 2, 228, 245, 165, 96, 223, 133, 20, 154, 232, 236, 34, 139, 61, 36, 135, 219,
-    58, 248, 158, 67, 146, 60, 252, 176, 19, 73, 188, 94, 106, 5, 192, 11, 3, 166, 209, 60, 58, 194, 126, 185, 213, 75,
-    140, 246, 10, 207, 25, 93, 196, 248, 219, 250, 127, 238, 235, 109, 115, 48, 26, 105, 185, 7, 41, 134, 90, 199, 129,
-    188, 3, 76, 6, 126, 123, 31, 160, 176, 58, 210, 224, 79, 189, 63, 146, 236, 202, 98, 197, 250, 48, 63, 248, 190, 28,
-    44, 65, 173, 71, 219, 58, 88, 7, 162, 187, 185, 162, 196, 7, 14, 203, 80, 16, 42, 118, 188, 67, 191, 198, 219, 224,
-    243, 52, 79, 140, 165, 96, 150, 188, 59, 114, 114, 162, 210, 120, 220, 248, 39, 179, 49, 27, 3, 128, 221, 59, 34,
-    25, 189, 102, 230, 62, 60, 22, 218, 141, 77, 188, 113, 227, 249, 13, 22, 239, 199, 152, 218, 205, 120, 92, 138, 133,
-    181, 144, 182, 28, 87, 247, 116, 9, 66, 30, 140, 138, 48, 134, 241, 197, 197, 3, 209, 214, 160, 131, 198, 49, 122,
-    61, 188, 121, 6, 183, 45, 175, 183, 61, 115, 143, 221, 192, 224, 142, 189, 214, 23, 186, 3, 56, 208, 53, 124, 210,
-    159, 159, 168, 85, 91, 252, 175, 62, 151, 225, 163, 94, 99, 31, 130, 254, 74, 167, 209, 80, 60, 110, 68, 234, 125,
-    133, 219, 9, 224, 238, 18, 159, 160, 107, 104, 215, 58, 219, 47, 172, 22, 238, 41, 31, 31, 158, 206, 98, 174, 24,
-    60, 209, 111, 247, 227, 224, 37, 86, 142, 219, 64, 178, 59, 63, 207, 95, 183, 6, 119, 243, 137, 37, 11, 164, 2, 94,
-    91, 40, 227, 178, 50, 212, 202, 160, 132, 157, 226, 230, 9, 240, 226, 226, 15, 53, 131, 63, 125, 109, 151, 214, 166,
-    83, 172, 129, 108, 28, 35, 11, 172, 75, 103, 59, 22, 115, 186, 94, 113, 94, 85, 51, 61, 148, 143, 6, 157, 240, 91,
-    31, 80, 79, 248, 78, 253, 16, 250, 251, 168, 11, 169, 224, 124, 37, 155, 17, 154, 170, 140, 96, 218, 187, 230, 102,
-    171, 243, 43, 84, 154, 97, 255, 122, 178, 25, 119, 175, 76, 4, 110, 111, 16, 106, 134, 43, 212, 126, 17, 22, 219,
-    39, 243, 103, 208, 105, 67, 246, 117, 183, 46, 6, 2, 142, 180, 164, 95, 3, 57, 147, 113, 91, 31, 174, 66, 96, 200,
-    188, 125, 232, 174, 47, 53, 65, 131, 117, 53, 122, 119, 232, 40, 206, 136, 195, 199, 247, 98, 180, 146, 218, 161,
-    211, 193, 186, 99, 134, 176, 103, 21, 26, 87, 235, 32, 237, 145, 71, 157, 18, 207, 224, 217, 1, 59, 10, 208, 250,
-    154, 200, 172, 153, 38, 67, 119, 208, 106, 149, 49, 63, 97, 155, 215, 233, 112, 192, 37, 168, 252, 95, 134, 174,
-    162, 161, 238, 103, 167, 217, 133, 141, 37, 211, 116, 51, 229, 104, 250, 177, 48, 12, 1, 228, 10, 122, 171, 76, 135,
-    6, 139, 107, 255, 96, 4, 55, 167, 186, 68, 93, 169, 106, 102, 39, 175, 49, 176, 164, 166, 167, 96, 193, 216, 235,
-    230, 89, 152, 157, 10, 205, 35, 66, 5, 155, 201, 150, 210, 154, 30, 148, 84, 180, 9, 195, 254, 43, 239, 181, 188,
-    251, 113, 96, 140, 77, 5, 130, 140, 81, 251, 167, 195, 106, 91, 177, 15, 211, 36, 109, 52, 239, 9, 147, 244, 22, 85,
-    74, 92, 160, 66, 185, 253, 243, 32, 169, 192, 247, 230, 166, 111, 244, 235, 188, 203, 16, 165, 87, 35, 213, 10, 248,
-    12, 4, 175, 225, 0, 208, 6, 60, 208, 163, 90, 113, 160, 47, 129, 34, 253, 146, 124, 107, 107, 75, 45, 139, 94, 180,
-    118, 71, 163, 204, 180, 192, 250, 166, 19, 108, 49, 245, 13, 214, 8, 109, 57, 192, 214, 2, 129, 181, 69, 213, 238,
-    75, 182, 86, 135, 110, 62, 193, 110, 38, 98, 178, 249, 49, 167, 133, 226, 178, 17, 9, 53, 3, 177, 94, 11, 65, 252,
-    99, 151, 55, 215, 29, 92, 59, 102, 154, 151, 88, 109, 40, 123, 189, 236, 4, 254, 236, 48, 230, 138, 101, 251, 195,
-    54, 214, 121, 96, 166, 67, 88, 207, 100, 205, 55, 164, 146, 141, 220, 83, 44, 157, 185, 247, 51, 122, 147, 44, 235,
-    164, 233, 193, 226, 186, 23, 86, 99, 162, 132, 46, 97, 191, 240, 150, 71, 191, 255, 171, 242, 216, 24, 239, 29, 181,
-    244, 131, 248, 149, 42, 103, 160, 95, 115, 161, 57, 200, 62, 76, 108, 28, 129, 53, 141, 83, 220, 129, 155, 248, 1,
-    159, 118, 54, 213, 106, 172, 249, 70, 96, 1, 229, 109, 151, 208, 129, 141, 153, 139, 160, 13, 180, 209, 155, 153,
-    31, 7, 143, 207, 85, 41, 236, 17, 246, 94, 191, 83, 218, 72, 101, 89, 132, 16, 209, 173, 178, 60, 200, 114, 108,
-    145, 67, 230, 156, 235, 135, 79, 47, 69, 197, 165, 195, 189, 238, 58, 211, 193, 130, 87, 60, 43, 74, 232, 136, 185,
-    109, 255, 101, 173, 211, 153, 53, 186, 52, 133, 210, 213, 98, 219, 136, 194, 94, 202, 110, 51, 238, 119, 166, 147,
-    155, 237, 53, 130, 123, 200, 188, 214, 13, 37, 142, 41, 231, 65, 130, 197, 143, 188, 149, 177, 238, 3, 49, 170, 170,
-    13, 140, 94, 82, 137, 188, 254, 58, 162, 105, 251, 181, 214, 251, 243, 115, 84, 254, 148, 79, 234, 5, 143, 155, 59,
-    32, 215, 252, 159, 15, 176, 171, 22, 182, 167, 21, 251, 93, 180, 181, 241, 71, 97, 114, 34, 149, 17, 35, 11, 115,
-    24, 152, 92, 136, 73, 95, 181, 185, 60, 70, 181, 202, 129, 165, 10, 152, 43, 67, 56, 51, 6, 105, 24, 113, 123, 85,
-    192, 169, 90, 233, 55, 100, 72, 131, 237, 174, 36, 231, 245, 255, 120, 234, 39, 14, 64, 69, 19, 104, 199, 133, 164,
-    103, 221, 252, 90, 154, 57, 238, 165, 185, 170, 6, 200, 152, 254, 103, 251, 217, 8, 187, 0, 42, 37, 38, 34, 202, 24,
-    80, 216, 205, 187, 13, 68, 209, 246, 149, 124, 203, 80, 40, 53, 200, 245, 75, 66, 44, 57, 199, 67, 119, 183, 203,
-    115, 189, 161, 102, 69, 106, 74, 39, 41, 95, 181, 78, 102, 30, 128, 125, 27, 163, 26, 107, 93, 216, 110, 139, 197,
-    44, 91, 100, 81, 190, 107, 163, 107, 34, 202, 19, 192, 26, 242, 68, 148, 237, 52, 231, 151, 103, 45, 108, 217, 221,
-    18, 126, 229, 51, 181, 136, 228, 215, 106, 92, 174, 119, 66, 239, 5, 221, 163, 7, 146, 151, 225, 82, 137, 223, 201,
-    170, 189, 104, 30, 243, 36, 131, 93, 241, 211, 219, 59, 86, 246, 203, 40, 122, 101, 49, 233, 30, 122, 154, 70, 201,
-    20, 177, 242, 11, 230, 20, 175, 210, 8, 17, 24, 9, 50, 41, 67, 182, 215, 6, 197, 102, 252, 168, 218, 10, 58, 11, 44,
-    255, 77, 176, 91, 28, 40, 105, 35, 126, 209, 47, 31, 216, 97, 55, 198, 3, 149, 177, 24, 144, 216, 222, 170, 240,
-    152, 11, 125, 230, 48, 36, 106, 146, 64, 103, 86, 182, 112, 144, 59, 129, 151, 209, 41, 33, 50, 145, 219, 16, 196,
-    29, 200, 9, 8, 90, 239, 57, 156, 229, 28, 68, 185, 215, 213, 86, 252, 52, 156, 75, 97, 165, 102, 152, 241, 94, 176,
-    122, 185, 201, 195, 20, 191, 57, 215, 234, 143, 133, 230, 36, 226, 93, 236, 40, 176, 53, 164, 135, 229, 130, 87, 98,
-    151, 214, 83, 41, 166, 74, 35, 200, 228, 126, 246, 247, 86, 222, 244, 220, 131, 21, 22, 181, 110, 70, 69, 177, 247,
-    21, 232, 245, 78, 5, 70, 226, 242, 83, 171, 127, 165, 135, 25, 169, 109, 109, 156, 77, 74, 58, 72, 134, 33, 238,
-    179, 37, 61, 115, 145, 173, 25, 17, 105, 55, 18, 182, 140, 243, 122, 201, 85, 25, 86, 123, 12, 136, 69, 164, 144,
-    148, 221, 66, 154, 118, 231, 50, 51, 69, 62, 226, 160, 245, 201, 39, 112, 171, 14, 142, 51, 7, 159, 56, 85, 131,
-    234, 7, 22, 8, 160, 63, 165, 56, 134, 151, 128, 6, 106, 78, 138, 203, 162, 27, 204, 162, 123, 223, 144, 183, 78,
-    176, 155, 103, 23, 201, 107, 218, 108, 157, 23, 156, 122, 97, 242, 128, 235, 126, 191, 88, 107, 201, 89, 225, 57,
-    12, 31, 29, 51, 71, 154, 200, 15, 128, 87, 255, 173, 198, 215, 170, 162, 187, 108, 6, 48, 63, 63, 137, 63, 91, 242,
-    106, 107, 216, 53, 189, 218, 37, 148, 210, 125, 15, 20, 18, 48, 142, 141, 101, 145, 7, 151, 148, 132, 175, 116, 234,
-    16, 25, 47, 214, 224, 75, 175, 238, 74, 151, 250, 217, 111, 26, 83, 129, 136, 4, 204, 255, 73, 201, 212, 66, 162,
-    170, 184, 83, 125, 93, 96, 193, 38, 13, 101, 141, 162, 133, 19, 7, 233, 151, 201, 239, 114, 69, 183, 196, 36, 0,
-    182, 54, 122, 65, 155, 85, 94, 129, 93, 137, 133, 216, 72, 167, 169, 195, 62, 8, 242, 133, 36, 92, 155, 132, 132,
-    165, 162, 103, 101, 170, 223, 164, 233, 145, 183, 249, 72, 182, 236, 244, 230, 87, 137, 84, 245, 83, 89, 50, 175,
-    108, 3, 49, 255, 67, 129, 87, 137, 217, 138, 32, 117, 192, 101, 72, 49, 144, 237, 194, 2, 215, 253, 84, 120, 7, 143,
-    87, 83, 213, 174, 159, 84, 139, 112, 240, 148, 103, 216, 213, 193, 241, 191, 23, 253, 183, 39, 137, 175, 52, 37,
-    177, 201, 64, 145, 66, 38, 168, 221, 84, 147, 151, 245, 124, 21, 155, 64, 14, 217, 87, 184, 232, 73, 134, 12, 167,
-    205, 198, 173, 133, 29, 217, 116, 108, 140, 71, 249, 44, 178, 70, 70, 176, 181, 114, 87, 241, 219, 211, 162, 183,
-    186, 79, 25, 143, 92, 218, 136, 1, 241, 99, 134, 209, 11, 94, 70, 226, 214, 110, 8, 107, 93, 90, 64, 102, 252, 68,
-    179, 54, 184, 95, 224, 147, 75, 255, 1, 86, 34, 214, 130, 99, 101, 44, 84, 173, 41, 88, 112, 241, 130, 6, 253, 192,
-    52, 179, 7, 69, 172, 105, 92, 70, 224, 251, 205, 147, 102, 5, 209, 72, 156, 88, 2, 115, 243, 57, 132, 199, 241, 26,
-    33, 2, 109, 75, 16, 1, 97, 173, 85, 25, 185, 102, 129, 50, 126, 78, 77, 13, 100, 19, 65, 41, 234, 229, 123, 44, 13,
-    168, 44, 42, 64, 7, 245, 204, 78, 45, 234, 91, 185, 6, 172, 4, 174, 82, 125, 11, 107, 131, 173, 53, 126, 216, 250,
-    204, 89, 115, 22, 253, 214, 226, 6, 105, 180, 55, 31, 16, 19, 175, 139, 182, 18, 173, 102, 51, 34, 0, 226, 84, 212,
-    184, 126, 252, 78, 220, 120, 195, 228, 64, 47, 99, 35, 238, 231, 206, 252, 196, 211, 28, 159, 140, 19, 237, 222,
-    164, 115, 235, 54, 66, 115, 192, 204, 77, 94, 128, 164, 125, 177, 151, 209, 146, 138, 233, 216, 3, 225, 69, 118, 90,
-    197, 249, 118, 111, 42, 45, 198, 11, 28, 85, 22, 253, 144, 81, 29, 246, 235, 218, 140, 97, 89, 139, 159, 184, 83,
-    109, 244, 219, 158, 89, 205, 26, 201, 108, 8, 200, 255, 245, 248, 109, 240, 13, 213, 134, 119, 151, 159, 140, 46,
-    211, 195, 151, 83, 182, 202, 244, 205, 54, 246, 142, 226, 236, 21, 192, 246, 132, 215, 175, 243, 190, 101, 209, 4,
-    178, 249, 32, 5, 110, 192, 1, 123, 196, 59, 3, 169, 96, 149, 248, 131, 215, 4, 125, 248, 84, 156, 153, 21, 25, 112,
-    160, 62, 76, 92, 184, 138, 207, 31, 237, 97, 52, 70, 92, 229, 189, 51, 1, 220, 107, 87, 83, 4, 189, 224, 23, 116,
-    111, 130, 227, 107, 245, 216, 235, 238, 183, 98, 234, 143, 167, 110, 19, 89, 218, 112, 125, 146, 221, 157, 200, 171,
-    186, 231, 229, 219, 57, 221, 28, 33, 102, 30, 193, 138, 243, 80, 38, 108, 77, 197, 219, 98, 212, 136, 63, 110, 11,
-    194, 128, 110, 60, 239, 88, 166, 17, 96, 205, 180, 103, 233, 69, 165, 255, 71, 177, 67, 249, 181, 208, 249, 11, 232,
-    101, 115, 98, 188, 219, 246, 64, 33, 117, 19, 27, 107, 48, 143, 110, 3, 221, 152, 91, 165, 94, 220, 106, 91, 61, 26,
-    166, 66, 168, 116, 35, 117, 44, 251, 82, 78, 102, 217, 238, 109, 26, 218, 199, 170, 11, 161, 136, 5, 14, 84, 137,
-    115, 18, 213, 239, 20, 5, 186, 199, 215, 215, 115, 39, 174, 230, 171, 28, 22, 8, 107, 204, 14, 73, 133, 61, 186,
-    119, 45, 160, 244, 199, 200, 220, 45, 32, 168, 221, 203, 61, 246, 230, 92, 220, 215, 75, 213, 154, 75, 200, 112, 99,
-    189, 22, 63, 85, 255, 120, 185, 175, 168, 56, 254, 7, 55, 213, 40, 57, 190, 6, 182, 86, 199, 38, 127, 2, 136, 61,
-    103, 96, 204, 22, 237, 254, 171, 154, 30, 182, 26, 59, 194, 106, 108, 225, 209, 251, 2, 92, 92, 240, 226, 219, 1,
-    73, 17, 248, 106, 58, 57, 66, 99, 97, 171, 189, 202, 13, 17, 42, 138, 105, 201, 192, 53, 97, 3, 242, 172, 27, 114,
-    239, 45, 84, 20, 58, 220, 106, 30, 217, 100, 64, 121, 135, 24, 229, 130, 239, 175, 85, 191, 185, 8, 253, 203, 79,
-    152, 81, 48, 214, 85, 222, 205, 108, 48, 42, 214, 235, 53, 105, 130, 67, 72, 144, 95, 231, 160, 155, 183, 229, 86,
-    58, 119, 127, 205, 199, 196, 201, 250, 110, 174, 38, 209, 239, 16, 131, 209, 31, 109, 133, 80, 26, 225, 80, 229, 35,
-    0, 126, 134, 203, 140, 241, 255, 122, 36, 193, 52, 179, 15, 165, 226, 162, 49, 143, 223, 199, 189, 40, 206, 55, 161,
-    184, 150, 142, 25, 156, 203, 168, 237, 205, 152, 34, 11, 220, 204, 3, 16, 128, 254, 35, 156, 242, 40, 114, 92, 116,
-    187, 133, 201, 195, 19, 106, 198, 143, 182, 51, 205, 185, 9, 122, 111, 54, 232, 86, 82, 107, 215, 83, 166, 94, 141,
-    36, 42, 197, 208, 42, 110, 8, 5, 38, 40, 208, 183, 216, 42, 30, 74, 168, 88, 37, 187, 217, 22, 65, 131, 126, 169,
-    200, 136, 26, 185, 10, 202, 240, 38, 132, 53, 124, 51, 95, 216, 82, 125, 175, 69, 77, 55, 201, 4, 19, 231, 31, 221,
-    174, 232, 149, 234, 181, 253, 164, 202, 57, 45, 76, 110, 167, 172, 28, 227, 15, 211, 20, 182, 157, 172, 115, 17,
-    117, 109, 217, 126, 167, 188, 176, 12, 125, 33, 29, 97, 42, 241, 210, 157, 160, 41, 44, 121, 77, 45, 128, 233, 177,
-    195, 184, 116, 96, 155, 24, 174, 155, 146, 151, 213, 128, 106, 57, 163, 99, 157, 224, 199, 202, 3, 230, 110, 82,
-    252, 241, 148, 239, 194, 238, 50, 114, 240, 93, 36, 163, 202, 69, 237, 203, 56, 202, 247, 209, 126, 140, 22, 176,
-    232, 238, 196, 90, 121, 95, 220, 5, 144, 111, 32, 62, 119, 169, 175, 123, 51, 210, 248, 88, 221, 79, 118, 84, 28,
-    81, 54, 148, 95, 200, 57, 20, 209, 230, 105, 33, 75, 104, 70, 56, 53, 254, 170, 147, 208, 241, 147, 157, 88, 202,
-    125, 6, 163, 143, 127, 206, 25, 31, 109, 156, 230, 255, 236, 6, 211, 196, 222, 145, 166, 53, 218, 24, 50, 16, 146,
-    207, 70, 143, 211, 72, 89, 198, 238, 155, 125, 121, 198, 4, 124, 105, 24, 32, 237, 72, 5, 97, 73, 83, 25, 211, 195,
-    23, 241, 47, 52, 155, 64, 0, 167, 49, 192, 254, 1, 41, 55, 103, 32, 146, 81, 113, 10, 98, 146, 238, 174, 226, 165,
-    95, 128, 44, 183, 133, 128, 74, 50, 34, 21, 59, 197, 177, 142, 210, 79, 225, 28, 79, 191, 19, 197, 145, 86, 126, 75,
-    2, 116, 170, 152, 171, 74, 240, 34, 30, 160, 79, 91, 124, 219, 157, 192, 42, 118, 97, 227, 201, 150, 222, 55, 144,
-    165, 165, 237, 100, 78, 114, 38, 9, 238, 252, 83, 209, 210, 67, 159, 147, 34, 182, 181, 7, 134, 91, 32, 19, 169,
-    227, 165, 127, 96, 0, 24, 79, 35, 156, 110, 57, 78, 21, 240, 71, 77, 211, 73, 161, 200, 161, 41, 122, 61, 88, 177,
-    7, 234, 144, 84, 116, 79, 69, 51, 195, 177, 225, 190, 218, 26, 244, 19, 77, 234, 133, 164, 220, 73, 126, 44, 46,
-    228, 244, 122, 45, 230, 211, 0, 185, 136, 193, 166, 240, 116, 36, 245, 218, 115, 48, 154, 120, 246, 242, 213, 85,
-    65, 21, 45, 231, 108, 40, 41, 131, 10, 39, 90, 79, 144, 106, 19, 23, 54, 44, 230, 55, 115, 71, 213, 255, 225, 29,
-    117, 200, 107, 197, 95, 173, 50, 46, 208, 132, 131, 173, 59, 213, 11, 129, 156, 11, 126, 43, 22, 90, 6, 46, 58, 92,
-    117, 246, 138, 203, 129, 98, 112, 62, 172, 137, 151, 5, 63, 36, 174, 192, 62, 158, 13, 7, 113, 139, 159, 124, 37,
-    244, 200, 80, 217, 156, 151, 79, 186, 188, 31, 133, 191, 19, 29, 95, 134, 113, 79, 10, 187, 214, 229, 23, 121, 181,
-    157, 43, 120, 95, 35, 232, 42, 206, 238, 8, 24, 117, 98, 131, 65, 58, 91, 115, 85, 210, 57, 80, 165, 207, 239, 167,
-    81, 121, 71, 14, 48, 31, 79, 201, 143, 165, 99, 84, 46, 233, 255, 248, 252, 16, 1, 205, 218, 110, 86, 165, 17, 155,
-    76, 223, 179, 107, 180, 149, 55, 237, 71, 72, 144, 127, 171, 10, 165, 183, 119, 174, 214, 18, 74, 123, 120, 142, 22,
-    167, 121, 50, 74, 237, 125, 99, 236, 234, 147, 183, 198, 186, 137, 151, 238, 69, 227, 151, 59, 14, 17, 66, 72, 40,
-    11, 106, 237, 138, 90, 205, 231, 66, 200, 243, 150, 173, 207, 20, 132, 203, 54, 197, 30, 50, 244, 33, 106, 117, 149,
-    37, 225, 144, 162, 69, 47, 206, 93, 75, 16, 239, 68, 235, 187, 216, 146, 204, 120, 254, 194, 18, 204, 150, 170, 223,
-    125, 102, 255, 125, 61, 102, 168, 217, 39, 170, 153, 220, 152, 14, 119, 71, 101, 69, 11, 197, 155, 129, 147, 108,
-    34, 68, 233, 206, 174, 240, 130, 41, 14, 254, 122, 32, 6, 37, 247, 238, 51, 185, 141, 13, 48, 55, 210, 23, 14, 80,
-    79, 2, 154, 14, 4, 22, 119, 180, 16, 236, 174, 214, 173, 133, 126, 69, 130, 105, 217, 152, 139, 96, 212, 123, 215,
-    133, 112, 194, 53, 114, 234, 104, 128, 178, 61, 171, 98, 109, 183, 131, 227, 1, 199, 148, 106, 136, 146, 252, 197,
-    55, 105, 243, 81, 159, 72, 34, 192, 104, 183, 15, 19, 252, 67, 80, 15, 83, 196, 27, 144, 163, 203, 147, 233, 61,
-    144, 195, 207, 145, 163, 156, 92, 69, 126, 154, 4, 217, 65, 132, 156, 254, 189, 223, 55, 112, 72, 182, 157, 14, 207,
-    31, 179, 146, 6, 34, 12, 241, 166, 234, 148, 233, 137, 32, 201, 188, 122, 94, 131, 225, 152, 175, 205, 247, 58, 75,
-    188, 2, 158, 0, 16, 154, 41, 112, 65, 185, 30, 173, 141, 91, 238, 179, 159, 94, 77, 180, 90, 104, 148, 163, 226,
-    173, 220, 63, 34, 189, 134, 11, 182, 195, 44, 158, 11, 134, 213, 166, 161, 173, 187, 90, 250, 89, 151, 72, 155, 90,
-    91, 198, 187, 168, 171, 165, 240, 190, 148, 69, 54, 50, 50, 117, 66, 52, 42, 142, 88, 69, 222, 70, 200, 21, 220, 25,
-    204, 106, 217, 76, 37, 158, 0, 144, 76, 159, 173, 107, 229, 2, 121, 248, 84, 7, 210, 53, 125, 50, 144, 206, 25, 98,
-    162, 70, 243, 72, 238, 202, 107, 13, 100, 247, 185, 55, 174, 55, 208, 121, 130, 155, 252, 152, 214, 85, 145, 254,
-    90, 188, 110, 44, 248, 166, 190, 192, 8, 61, 80, 120, 85, 228, 89, 25, 197, 217, 252, 15, 96, 58, 157, 135, 168, 95,
-    43, 93, 132, 66, 73, 170, 250, 152, 111, 146, 165, 216, 185, 136, 149, 207, 116, 25, 29, 149, 196, 146, 120, 127,
-    37, 65, 138, 107, 229, 234, 111, 225, 173, 9, 201, 222, 119, 52, 217, 187, 57, 51, 8, 57, 13, 53, 15, 242, 59, 194,
-    46, 227, 127, 34, 73, 187, 162, 54, 70, 169, 169, 181, 217, 66, 144, 171, 75, 64, 103, 108, 234, 1, 249, 0, 204, 97,
-    170, 71, 55, 116, 76, 78, 12, 43, 251, 162, 136, 248, 18, 105, 4, 63, 231, 130, 141, 81, 32, 166, 226, 112, 255,
-    168, 56, 49, 9, 48, 168, 77, 154, 124, 122, 127, 195, 106, 53, 116, 195, 75, 123, 24, 84, 120, 79, 191, 145, 73, 67,
-    32, 151, 71, 190, 77, 37, 32, 70, 253, 70, 41, 144, 212, 216, 58, 68, 193, 53, 102, 61, 170, 200, 171, 23, 49, 175,
-    99, 216, 255, 181, 41, 164, 216, 76, 134, 175, 214, 135, 96, 155, 48, 116, 23, 152, 30, 182, 162, 17, 239, 238, 130,
-    144, 221, 146, 104, 149, 230, 37, 126, 189, 132, 254, 35, 192, 42, 194, 159, 137, 86, 112, 246, 43, 11, 79, 168, 21,
-    64, 187, 56, 210, 47, 86, 255, 81, 151, 72, 121, 130, 181, 0, 255, 142, 15, 41, 39, 42, 75, 192, 158, 216, 70, 142,
-    6, 126, 20, 209, 79, 106, 36, 146, 70, 117, 206, 44, 86, 14, 144, 159, 189, 210, 161, 101, 255, 111, 255, 199, 36,
-    7, 195, 20, 154, 70, 148, 25, 40, 157, 47, 30, 125, 244, 59, 211, 243, 29, 97, 128, 182, 239, 98, 182, 147, 83, 30,
-    59, 251, 30, 142, 102, 183, 93, 167, 0, 242, 13, 177, 29, 239, 165, 50, 175, 113, 233, 121, 233, 97, 83, 8, 115,
-    215, 151, 105, 222, 117, 77, 16, 97, 240, 46, 156, 224, 2, 69, 134, 60, 212, 77, 133, 20, 161, 7, 247, 99, 121, 254,
-    134, 234, 106, 139, 118, 123, 128, 131, 220, 164, 102, 55, 155, 14, 16, 178, 75, 133, 163, 126, 205, 222, 173, 227,
-    92, 240, 197, 81, 213, 99, 227, 97, 123, 46, 97, 226, 38, 40, 45, 129, 117, 197, 5, 53, 203, 248, 46, 44, 14, 210,
-    202, 157, 78, 240, 9, 105, 64, 53, 186, 211, 16, 81, 156, 249, 107, 18, 94, 154, 132, 180, 180, 108, 72, 105, 253,
-    231, 70, 218, 212, 18, 0, 202, 180, 37, 1, 134, 132, 103, 131, 254, 26, 234, 20, 12, 4, 6, 124, 244, 153, 240, 28,
-    96, 41, 207, 224, 146, 185, 78, 92, 38, 251, 43, 39, 38, 96, 14, 35, 146, 96, 130, 102, 209, 118, 105, 244, 47, 154,
-    30, 41, 83, 175, 169, 252, 244, 44, 88, 23, 249, 198, 245, 149, 155, 201, 94, 211, 131, 87, 112, 175, 23, 47, 79,
-    57, 184, 105, 138, 101, 16, 64, 215, 245, 11, 250, 138, 117, 176, 127, 89, 101, 108, 146, 249, 132, 166, 37, 99, 30,
-    196, 170, 94, 193, 101, 176, 125, 120, 80, 83, 126, 246, 21, 94, 19, 237, 137, 8, 97, 215, 13, 161, 85, 63, 136,
-    129, 175, 147, 0, 89, 154, 100, 230, 153, 126, 34, 2, 233, 193, 217, 208, 255, 108, 23, 187, 242, 52, 206, 22, 207,
-    86, 168, 205, 155, 3, 174, 240, 22, 93, 96, 98, 121, 172, 211, 8, 92, 218, 17, 231, 2, 142, 136, 138, 96, 208, 102,
-    251, 139, 32, 113, 186, 104, 59, 165, 197, 87, 147, 112, 234, 70, 90, 26, 143, 129, 212, 36, 46, 164, 72, 224, 202,
-    41, 47, 148, 39, 64, 104, 64, 28, 23, 90, 219, 234, 22, 252, 86, 231, 241, 240, 9, 243, 112, 226, 160, 22, 143, 106,
-    65, 118, 95, 96, 204, 47, 235, 212, 246, 62, 209, 254, 53, 156, 67, 242, 50, 33, 66, 128, 92, 17, 168, 79, 201, 168,
-    131, 196, 241, 175, 14, 146, 208, 180, 183, 135, 187, 247, 176, 56, 68, 215, 47, 47, 195, 232, 232, 188, 226, 50,
-    159, 66, 245, 56, 2, 169, 164, 138, 201, 241, 5, 194, 252, 134, 228, 49, 121, 213, 20, 197, 199, 44, 200, 119, 48,
-    213, 102, 46, 8, 160, 114, 59, 116, 235, 62, 11, 220, 107, 41, 194, 246, 145, 18, 144, 145, 64, 99, 251, 230, 29,
-    214, 98, 56, 47, 26, 214, 124, 234, 186, 62, 102, 250, 66, 64, 206, 118, 108, 142, 190, 251, 134, 162, 93, 159, 182,
-    158, 162, 21, 151, 246, 58, 178, 168, 41, 148, 169, 60, 116, 176, 147, 227, 40, 13, 99, 172, 233, 6, 188, 213, 31,
-    230, 202, 185, 117, 191, 163, 118, 71, 190, 244, 187, 135, 80, 100, 187, 143, 104, 119, 144, 161, 167, 101, 84, 190,
-    253, 146, 59, 50, 82, 41, 28, 13, 175, 229, 106, 30, 39, 147, 122, 69, 138, 234, 30, 238, 38, 65, 144, 215, 12, 108,
-    7, 153, 9, 135, 252, 162, 75, 143, 124, 64, 44, 61, 136, 174, 185, 150, 88, 181, 106, 41, 15, 23, 145, 105, 237, 25,
-    138, 35, 146, 31, 61, 100, 124, 87, 111, 50, 203, 182, 182, 71, 26, 241, 185, 242, 46, 14, 59, 196, 13, 84, 42, 246,
-    174, 33, 87, 243, 191, 227, 236, 119, 51, 53, 254, 136, 229, 47, 216, 255, 38, 146, 87, 7, 112, 95, 43, 112, 247,
-    18, 221, 75, 9, 38, 192, 33, 197, 238, 174, 66, 115, 164, 58, 166, 106, 247, 38, 59, 120, 129, 68, 120, 168, 36, 57,
-    88, 242, 89, 59, 93, 114, 62, 33, 224, 190, 144, 229, 83, 210, 137, 119, 235, 3, 173, 81, 183, 239, 196, 246, 22,
-    210, 173, 121, 78, 109, 178, 81, 123, 80, 19, 115, 140, 184, 79, 30, 253, 15, 134, 225, 120, 239, 54, 208, 35, 109,
-    137, 230, 88, 38, 179, 215, 44, 21, 205, 18, 254, 143, 209, 125, 17, 23, 250, 112, 109, 236, 181, 177, 74, 241, 232,
-    211, 191, 107, 133, 103, 35, 192, 31, 6, 235, 142, 245, 189, 18, 129, 53, 23, 239, 232, 95, 71, 165, 39, 66, 133,
-    126, 164, 119, 89, 189, 168, 153, 14, 221, 194, 237, 36, 98, 14, 80, 103, 111, 47, 145, 216, 7, 208, 123, 158, 128,
-    72, 179, 208, 115, 149, 128, 15, 7, 76, 246, 142, 226, 192, 89, 64, 232, 83, 222, 158, 88, 184, 33, 85, 221, 98, 98,
-    1, 44, 234, 233, 231, 201, 93, 162, 20, 194, 109, 160, 236, 101, 128, 216, 229, 181, 88, 178, 51, 241, 83, 30, 165,
-    252, 92, 172, 140, 225, 182, 127, 232, 171, 42, 249, 109, 205, 176, 34, 145, 144, 179, 177, 98, 114, 23, 63, 86, 42,
-    225, 91, 142, 23, 228, 54, 23, 7, 92, 141, 94, 86, 88, 102, 173, 69, 118, 249, 186, 174, 68, 19, 94, 46, 82, 100,
-    94, 47, 90, 68, 77, 247, 189, 175, 20, 6, 56, 131, 130, 236, 85, 215, 59, 26, 216, 123, 156, 5, 139, 101, 183, 43,
-    177, 19, 81, 45, 79, 62, 12, 53, 135, 79, 103, 110, 200, 153, 93, 201, 78, 190, 61, 164, 81, 235, 38, 213, 70, 105,
-    210, 37, 154, 135, 237, 158, 130, 108, 96, 123, 73, 51, 33, 130, 170, 55, 74, 85, 198, 119, 251, 3, 25, 61, 28, 85,
-    50, 227, 82, 194, 88, 46, 114, 49, 118, 230, 206, 12, 159, 233, 118, 185, 7, 143, 166, 48, 39, 58, 46, 19, 246, 142,
-    165, 6, 92, 169, 36, 237, 201, 149, 4, 139, 133, 102, 171, 80, 89, 167, 112, 206, 98, 45, 52, 86, 227, 77, 63, 21,
-    160, 44, 223, 2, 142, 213, 204, 187, 254, 149, 212, 127, 227, 138, 166, 36, 110, 101, 160, 217, 53, 64, 33, 137, 39,
-    175, 177, 199, 199, 82, 111, 239, 177, 111, 65, 88, 36, 90, 73, 40, 221, 218, 106, 77, 104, 99, 190, 17, 33, 242,
-    104, 212, 184, 39, 244, 9, 145, 70, 150, 21, 63, 2, 98, 253, 200, 151, 64, 28, 241, 73, 25, 6, 132, 249, 212, 4, 51,
-    181, 253, 171, 72, 50, 52, 195, 160, 47, 162, 10, 243, 23, 218, 16, 154, 109, 206, 31, 64, 98, 50, 150, 86, 125, 64,
-    134, 205, 35, 43, 153, 238, 206, 49, 147, 171, 212, 116, 204, 63, 68, 221, 87, 121, 121, 218, 181, 100, 142, 113,
-    69, 245, 130, 15, 156, 52, 13, 53, 161, 131, 20, 221, 57, 171, 223, 169, 117, 210, 207, 88, 31, 250, 164, 69, 77,
-    31, 36, 224, 225, 69, 245, 80, 96, 93, 127, 65, 125, 233, 48, 238, 23, 210, 79, 76, 83, 26, 149, 234, 101, 104, 42,
-    194, 118, 2, 153, 237, 195, 177, 47, 179, 78, 2, 205, 106, 38, 162, 229, 3, 118, 9, 181, 206, 148, 210, 58, 69, 202,
-    60, 46, 179, 172, 75, 168, 54, 7, 242, 42, 89, 11, 170, 208, 197, 1, 171, 127, 12, 75, 158, 107, 228, 177, 104, 188,
-    59, 22, 32, 186, 123, 240, 241, 201, 110, 71, 99, 232, 102, 251, 88, 82, 97, 199, 113, 27, 255, 5, 182, 25, 112,
-    116, 216, 130, 201, 153, 46, 119, 218, 91, 140, 145, 207, 100, 193, 154, 59, 137, 48, 231, 251, 57, 99, 238, 165,
-    83, 234, 183, 193, 131, 20, 141, 226, 46, 54, 248, 99, 145, 126, 200, 155, 148, 181, 38, 164, 165, 169, 81, 164, 98,
-    26, 28, 226, 159, 76, 129, 13, 72, 89, 121, 196, 248, 92, 200, 132, 225, 175, 205, 250, 2, 141, 199, 92, 221, 22,
-    28, 162, 205, 49, 108, 18, 147, 91, 238, 16, 165, 131, 26, 88, 130, 88, 200, 255, 234, 51, 105, 125, 47, 188, 237,
-    0, 15, 229, 114, 204, 111, 128, 89, 7, 20, 92, 204, 229, 98, 164, 149, 218, 123, 87, 183, 171, 211, 39, 214, 73, 33,
-    54, 46, 29, 71, 63, 222, 161, 140, 31, 103, 49, 32, 203, 171, 103, 143, 177, 17, 38, 219, 231, 220, 199, 4, 87, 222,
-    171, 16, 6, 143, 29, 182, 128, 70, 11, 32, 171, 7, 186, 53, 235, 206, 39, 203, 158, 104, 18, 45, 90, 114, 63, 172,
-    72, 95, 80, 89, 161, 40, 133, 124, 137, 167, 249, 26, 76, 222, 98, 172, 60, 24, 50, 216, 177, 166, 98, 166, 158,
-    142, 65, 151, 195, 48, 143, 133, 203, 162, 34, 179, 12, 236, 60, 200, 40, 116, 241, 29, 157, 190, 221, 178, 164,
-    194, 225, 178, 69, 66, 177, 66, 152, 194, 96, 202, 225, 0, 168, 79, 180, 94, 40, 84, 255, 41, 109, 139, 212, 131,
-    125, 127, 156, 65, 200, 20, 232, 27, 134, 180, 253, 194, 120, 85, 213, 157, 218, 49, 86, 33, 168, 144, 12, 24, 192,
-    14, 104, 173, 58, 45, 182, 240, 29, 229, 39, 24, 90, 221, 1, 26, 8, 86, 119, 138, 118, 0, 187, 22, 99, 136, 167,
-    213, 216, 166, 38, 150, 30, 117, 46, 209, 61, 135, 179, 172, 187, 71, 50, 209, 16, 47, 108, 195, 16, 35, 73, 233,
-    68, 196, 129, 78, 236, 231, 180, 25, 100, 186, 193, 62, 17, 201, 130, 205, 7, 76, 140, 217, 168, 114, 195, 161, 145,
-    255, 238, 72, 139, 2, 160, 163, 126, 63, 136, 216, 218, 190, 83, 131, 33, 199, 148, 52, 204, 117, 148, 209, 128, 54,
-    37, 161, 11, 124, 143, 2, 178, 46, 116, 171, 21, 255, 66, 56, 19, 232, 48, 173, 22, 105, 194, 170, 179, 168, 245,
-    222, 98, 249, 247, 95, 204, 42, 155, 153, 20, 200, 246, 246, 154, 200, 30, 178, 126, 80, 172, 223, 125, 126, 208,
-    107, 221, 97, 37, 46, 17, 228, 68, 223, 240, 168, 67, 60, 235, 241, 128, 71, 21, 121, 161, 127, 230, 142, 159, 85,
-    167, 43, 172, 177, 244, 115, 222, 91, 182, 52, 202, 179, 215, 129, 35, 240, 85, 201, 1, 49, 86, 14, 227, 253, 196,
-    240, 86, 166, 40, 237, 15, 244, 199, 159, 33, 139, 0, 145, 142, 199, 31, 35, 36, 37, 216, 205, 253, 76, 232, 28,
-    232, 251, 220, 104, 222, 32, 32, 215, 173, 97, 235, 227, 35, 83, 10, 55, 218, 94, 226, 103, 66, 153, 233, 221, 211,
-    234, 216, 132, 254, 132, 214, 37, 243, 50, 25, 184, 13, 114, 247, 89, 94, 179, 42, 123, 15, 211, 226, 116, 104, 175,
-    128, 21, 119, 228, 96, 253, 70, 7, 146, 193, 154, 171, 110, 129, 229, 114, 88, 113, 168, 102, 1, 50, 232, 25, 206,
-    138, 106, 97, 238, 120, 75, 6, 206, 170, 132, 215, 111, 97, 90, 109, 64, 179, 232, 33, 250, 5, 98, 92, 56, 141, 163,
-    92, 12, 184, 175, 187, 9, 134, 156, 19, 178, 106, 32, 2, 83, 183, 68, 43, 206, 200, 198, 117, 123, 98, 236, 219,
-    237, 5, 62, 79, 111, 233, 147, 168, 215, 4, 105, 205, 10, 50, 125, 63, 42, 196, 214, 3, 32, 58, 57, 124, 27, 54, 54,
-    9, 104, 239, 70, 183, 6, 145, 68, 246, 192, 114, 203, 80, 160, 21, 179, 210, 61, 36, 181, 4, 217, 231, 171, 197, 40,
-    70, 182, 30, 95, 111, 66, 132, 68, 25, 104, 109, 73, 38, 192, 109, 205, 235, 167, 173, 41, 6, 44, 79, 110, 99, 167,
-    120, 252, 182, 225, 250, 83, 152, 87, 208, 225, 232, 126, 86, 106, 165, 98, 63, 30, 63, 39, 110, 83, 162, 170, 152,
-    130, 220, 12, 197, 199, 61, 68, 76, 154, 166, 179, 242, 61, 209, 72, 17, 62, 61, 88, 147, 92, 126, 11, 193, 167,
-    189, 38, 9, 241, 172, 6, 225, 255, 22, 238, 204, 204, 35, 88, 4, 152, 61, 62, 219, 169, 104, 73, 147, 250, 168, 138,
-    208, 250, 254, 99, 210, 99, 107, 227, 127, 233, 253, 177, 3, 82, 32, 146, 112, 183, 127, 33, 40, 132, 184, 154, 71,
-    26, 40, 63, 220, 199, 166, 189, 66, 226, 85, 219, 13, 216, 56, 42, 20, 254, 170, 7, 182, 226, 88, 54, 103, 175, 233,
-    144, 123, 165, 36, 70, 205, 43, 75, 0, 193, 113, 57, 160, 92, 171, 70, 18, 78, 172, 235, 35, 189, 224, 161, 219,
-    186, 162, 19, 50, 247, 145, 71, 98, 197, 111, 206, 140, 60, 189, 191, 227, 88, 181, 116, 84, 215, 219, 41, 83, 180,
-    234, 232, 97, 50, 102, 231, 202, 108, 163, 245, 182, 137, 76, 214, 95, 228, 46, 182, 252, 143, 65, 114, 185, 7, 202,
-    117, 211, 3, 198, 115, 202, 202, 107, 251, 223, 210, 92, 26, 134, 134, 157, 98, 207, 2, 172, 97, 84, 156, 111, 20,
-    58, 61, 163, 159, 238, 67, 242, 32, 99, 52, 198, 78, 210, 42, 110, 0, 31, 157, 181, 120, 226, 174, 117, 33, 13, 154,
-    11, 130, 45, 53, 231, 238, 254, 151, 158, 128, 180, 103, 226, 212, 194, 205, 239, 144, 97, 11, 20, 118, 51, 1, 113,
-    21, 154, 244, 188, 173, 134, 184, 144, 158, 244, 35, 6, 82, 254, 133, 189, 240, 135, 225, 235, 120, 25, 43, 4, 142,
-    106, 25, 93, 17, 89, 33, 96, 120, 32, 244, 96, 91, 80, 67, 145, 197, 11, 22, 152, 166, 203, 221, 138, 29, 60, 17,
-    135, 112, 95, 141, 190, 193, 130, 153, 118, 198, 4, 65, 173, 94, 223, 7, 251, 179, 129, 157, 120, 149, 185, 217,
-    243, 249, 37, 8, 249, 32, 67, 123, 8, 48, 148, 94, 73, 182, 190, 23, 184, 247, 18, 112, 159, 203, 120, 197, 40, 193,
-    43, 247, 36, 235, 100, 23, 203, 72, 89, 120, 208, 243, 18, 82, 80, 61, 186, 73, 89, 180, 113, 13, 115, 24, 21, 128,
-    182, 234, 197, 190, 24, 51, 34, 174, 29, 44, 93, 147, 3, 174, 121, 206, 171, 169, 136, 157, 98, 10, 108, 171, 226,
-    156, 12, 243, 173, 141, 16, 213, 91, 238, 128, 210, 36, 45, 8, 93, 223, 11, 213, 132, 194, 71, 208, 149, 146, 217,
-    215, 253, 188, 151, 176, 70, 230, 61, 132, 210, 125, 101, 82, 26, 144, 50, 174, 159, 98, 215, 128, 207, 202, 81, 2,
-    119, 136, 10, 26, 161, 241, 158, 32, 142, 15, 226, 54, 127, 9, 206, 238, 4, 202, 94, 17, 241, 197, 68, 216, 10, 190,
-    167, 249, 132, 113, 196, 212, 25, 249, 181, 128, 121, 167, 223, 221, 4, 45, 27, 241, 137, 74, 203, 162, 41, 112, 50,
-    198, 31, 155, 174, 239, 123, 162, 209, 200, 11, 107, 195, 165, 30, 153, 183, 19, 36, 81, 61, 194, 81, 22, 86, 60,
-    44, 14, 12, 191, 180, 240, 150, 46, 92, 225, 49, 116, 238, 255, 41, 47, 13, 7, 70, 255, 94, 158, 12, 140, 234, 164,
-    106, 105, 134, 200, 71, 245, 0, 21, 179, 24, 60, 189, 233, 241, 213, 188, 184, 119, 214, 166, 181, 219, 148, 103,
-    36, 172, 232, 216, 119, 150, 252, 212, 84, 73, 15, 125, 147, 202, 43, 162, 49, 85, 144, 152, 52, 83, 121, 24, 250,
-    159, 5, 87, 207, 10, 222, 207, 187, 24, 232, 186, 239, 37, 40, 40, 143, 241, 37, 3, 141, 49, 167, 44, 223, 195, 230,
-    163, 83, 46, 12, 133, 115, 226, 146, 22, 164, 21, 17, 10, 206, 122, 52, 205, 226, 95, 193, 128, 238, 28, 173, 188,
-    76, 159, 50, 241, 173, 15, 193, 241, 172, 63, 191, 58, 57, 23, 27, 154, 127, 24, 3, 252, 237, 44, 105, 110, 6, 111,
-    147, 36, 96, 142, 216, 161, 118, 98, 93, 238, 205, 191, 155, 220, 116, 32, 75, 163, 90, 166, 49, 92, 99, 31, 140,
-    230, 59, 236, 40, 154, 211, 54, 182, 173, 11, 78, 104, 159, 85, 86, 151, 4, 54, 200, 197, 206, 50, 104, 12, 225, 53,
-    25, 181, 213, 74, 112, 228, 118, 191, 178, 112, 128, 188, 198, 81, 82, 68, 125, 254, 151, 155, 48, 157, 187, 104,
-    50, 138, 147, 162, 142, 255, 249, 182, 49, 160, 153, 158, 223, 57, 201, 50, 1, 77, 5, 31, 107, 151, 188, 32, 72,
-    101, 225, 195, 127, 248, 207, 102, 57, 77, 159, 12, 17, 58, 58, 174, 162, 113, 168, 79, 238, 166, 120, 222, 119,
-    203, 23, 130, 175, 183, 53, 0, 54, 227, 167, 117, 24, 25, 39, 206, 182, 44, 17, 209, 251, 200, 208, 82, 201, 18,
-    155, 248, 46, 222, 191, 99, 46, 92, 127, 202, 85, 57, 54, 128, 236, 233, 13, 175, 138, 233, 241, 164, 129, 164, 44,
-    248, 211, 189, 47, 212, 212, 96, 157, 213, 20, 114, 109, 235, 143, 76, 19, 137, 168, 254, 29, 6, 2, 110, 89, 109,
-    201, 67, 246, 176, 117, 236, 147, 81, 88, 229, 55, 4, 181, 13, 113, 86, 15, 229, 31, 42, 206, 209, 149, 157, 53, 74,
-    185, 82, 77, 24, 58, 199, 161, 119, 112, 197, 166, 181, 189, 147, 18, 206, 227, 172, 220, 115, 202, 72, 31, 3, 3,
-    207, 192, 71, 160, 235, 69, 22, 217, 194, 77, 188, 150, 43, 240, 202, 186, 20, 96, 247, 181, 125, 234, 116, 89, 170,
-    70, 65, 182, 109, 105, 13, 4, 121, 236, 151, 91, 93, 237, 53, 114, 88, 78, 103, 56, 89, 176, 237, 247, 97, 166, 255,
-    107, 184, 74, 235, 232, 36, 240, 144, 94, 128, 136, 41, 115, 21, 125, 123, 18, 59, 21, 49, 2, 81, 73, 232, 115, 102,
-    4, 55, 242, 206, 94, 130, 23, 224, 150, 109, 174, 52, 34, 247, 19, 114, 20, 211, 18, 234, 200, 126, 177, 221, 194,
-    104, 66, 51, 137, 244, 234, 206, 60, 110, 79, 222, 13, 173, 139, 120, 145, 82, 134, 246, 228, 35, 221, 188, 82, 141,
-    104, 67, 239, 26, 151, 57, 221, 250, 184, 91, 142, 103, 131, 70, 74, 125, 193, 173, 26, 117, 57, 45, 71, 154, 234,
-    255, 10, 38, 221, 116, 15, 128, 253, 153, 33, 76, 215, 27, 17, 190, 25, 236, 224, 77, 140, 124, 228, 91, 86, 151,
-    138, 203, 144, 219, 154, 107, 138, 142, 126, 221, 235, 64, 179, 206, 32, 176, 73, 20, 154, 44, 150, 50, 99, 232,
-    133, 88, 138, 28, 89, 244, 118, 6, 182, 165, 192, 193, 228, 37, 29, 137, 183, 37, 84, 110, 51, 29, 199, 3, 203, 253,
-    19, 101, 128, 51, 60, 132, 10, 110, 246, 171, 162, 177, 133, 28, 42, 240, 188, 216, 173, 42, 199, 26, 56, 122, 250,
-    7, 83, 53, 155, 240, 134, 92, 240, 158, 146, 62, 246, 92, 192, 174, 166, 45, 61, 115, 30, 97, 138, 40, 143, 233, 33,
-    34, 128, 57, 37, 12, 100, 11, 207, 84, 169, 75, 175, 43, 240, 254, 186, 62, 207, 104, 87, 185, 197, 47, 142, 24,
-    212, 173, 56, 213, 19, 70, 211, 133, 209, 114, 45, 93, 222, 217, 159, 151, 27, 161, 85, 156, 255, 98, 36, 166, 196,
-    44, 178, 173, 242, 58, 142, 118, 6, 233, 45, 113, 228, 106, 228, 209, 211, 63, 79, 31, 136, 68, 48, 94, 30, 84, 171,
-    208, 164, 78, 197, 127, 210, 248, 155, 226, 39, 141, 100, 74, 118, 242, 161, 70, 146, 225, 157, 58, 15, 93, 94, 103,
-    161, 77, 188, 106, 209, 123, 74, 57, 51, 223, 162, 78, 15, 39, 175, 55, 183, 162, 215, 159, 146, 79, 244, 49, 58,
-    141, 209, 225, 215, 49, 220, 123, 208, 71, 144, 22, 152, 230, 183, 30, 193, 210, 50, 62, 4, 71, 147, 137, 185, 125,
-    167, 229, 13, 114, 79, 162, 131, 94, 82, 130, 10, 15, 8, 84, 10, 26, 3, 242, 37, 225, 23, 15, 84, 102, 211, 245, 11,
-    148, 253, 187, 69, 217, 149, 218, 195, 110, 119, 202, 157, 16, 106, 226, 88, 228, 155, 8, 46, 90, 90, 141, 205, 38,
-    98, 167, 84, 155, 190, 227, 64, 69, 101, 234, 231, 129, 229, 118, 158, 254, 194, 148, 2, 253, 70, 184, 58, 156, 98,
-    122, 71, 160, 142, 56, 192, 122, 191, 233, 22, 100, 9, 239, 173, 194, 200, 113, 182, 25, 218, 75, 44, 137, 113, 224,
-    17, 173, 187, 83, 197, 249, 82, 49, 173, 233, 161, 207, 126, 146, 45, 12, 221, 209, 131, 111, 61, 54, 144, 93, 143,
-    112, 59, 252, 208, 104, 116, 94, 4, 95, 166, 4, 151, 255, 1, 49, 214, 33, 157, 232, 90, 157, 28, 8, 22, 255, 78,
-    206, 253, 165, 61, 131, 175, 33, 67, 197, 218, 25, 25, 85, 21, 140, 243, 67, 202, 40, 61, 33, 10, 231, 22, 192, 92,
-    191, 211, 117, 165, 8, 29, 150, 161, 153, 106, 160, 213, 194, 241, 209, 90, 237, 36, 233, 50, 10, 124, 196, 49, 21,
-    140, 247, 58, 56, 146, 171, 19, 11, 188, 59, 50, 221, 117, 121, 125, 156, 252, 54, 233, 87, 200, 61, 40, 75, 226,
-    45, 111, 80, 231, 110, 177, 3, 186, 41, 80, 92, 173, 35, 20, 36, 133, 205, 90, 130, 196, 132, 54, 182, 131, 240,
-    184, 246, 204, 78, 196, 238, 29, 203, 97, 153, 11, 108, 27, 185, 141, 174, 1, 7, 124, 43, 15, 44, 19, 232, 169, 229,
-    61, 25, 248, 163, 151, 78, 235, 5, 40, 25, 66, 240, 231, 147, 53, 147, 225, 221, 243, 190, 39, 70, 100, 25, 72, 187,
-    87, 40, 125, 143, 205, 146, 227, 171, 211, 182, 54, 190, 169, 125, 149, 75, 67, 5, 24, 55, 152, 239, 39, 85, 47,
-    102, 197, 151, 18, 187, 43, 66, 233, 191, 161, 34, 199, 164, 246, 111, 159, 89, 183, 38, 43, 175, 254, 105, 76, 147,
-    177, 213, 148, 243, 81, 103, 37, 87, 157, 49, 52, 205, 89, 143, 84, 198, 194, 13, 156, 181, 252, 218, 42, 77, 218,
-    51, 35, 148, 187, 69, 64, 200, 212, 175, 46, 244, 118, 35, 126, 186, 133, 123, 123, 252, 230, 149, 22, 125, 143, 76,
-    235, 138, 119, 132, 44, 105, 243, 133, 130, 58, 207, 197, 220, 72, 59, 201, 129, 190, 214, 109, 215, 33, 61, 100,
-    17, 107, 254, 186, 123, 109, 25, 125, 104, 207, 125, 80, 141, 130, 60, 169, 122, 60, 161, 27, 141, 36, 194, 183,
-    112, 82, 220, 67, 61, 103, 229, 10, 56, 223, 155, 12, 249, 1, 133, 42, 73, 46, 8, 176, 31, 141, 47, 254, 117, 246,
-    182, 98, 201, 182, 157, 154, 54, 150, 114, 182, 56, 242, 206, 235, 6, 25, 106, 117, 4, 91, 50, 57, 100, 63, 83, 125,
-    157, 143, 49, 20, 218, 132, 140, 12, 195, 131, 86, 89, 68, 195, 69, 5, 79, 131, 100, 32, 191, 131, 195, 180, 147,
-    211, 129, 226, 223, 254, 67, 132, 198, 10, 178, 235, 174, 249, 250, 119, 220, 211, 36, 65, 172, 217, 40, 91, 130,
-    65, 187, 173, 83, 124, 141, 42, 167, 226, 64, 244, 136, 254, 214, 203, 158, 204, 149, 148, 2, 11, 46, 137, 62, 117,
-    162, 203, 71, 96, 54, 167, 160, 198, 13, 37, 1, 197, 122, 6, 222, 35, 142, 212, 145, 140, 4, 133, 116, 152, 142,
-    172, 1, 139, 120, 59, 41, 83, 84, 96, 60, 203, 198, 12, 179, 201, 244, 25, 195, 172, 155, 222, 114, 143, 106, 99,
-    218, 205, 127, 115, 227, 144, 34, 88, 129, 255, 69, 159, 154, 91, 244, 203, 57, 170, 125, 186, 9, 146, 227, 133,
-    245, 44, 116, 242, 198, 141, 223, 95, 153, 140, 114, 165, 92, 230, 31, 229, 231, 82, 169, 76, 236, 241, 88, 207,
-    178, 118, 83, 134, 46, 78, 122, 170, 138, 222, 182, 54, 191, 32, 175, 101, 116, 239, 228, 148, 181, 109, 239, 236,
-    59, 247, 151, 207, 242, 209, 245, 228, 170, 41, 197, 184, 120, 154, 19, 140, 5, 96, 102, 78, 111, 192, 145, 38, 177,
-    111, 96, 169, 155, 201, 43, 105, 47, 104, 30, 140, 10, 234, 163, 83, 102, 26, 246, 43, 29, 95, 172, 153, 49, 106,
-    239, 81, 233, 203, 174, 251, 128, 217, 101, 194, 28, 211, 37, 190, 178, 49, 47, 2, 159, 142, 59, 229, 253, 129, 22,
-    166, 122, 130, 130, 249, 7, 143, 176, 5, 230, 80, 114, 70, 74, 97, 83, 162, 245, 215, 42, 181, 27, 43, 116, 3, 215,
-    225, 224, 66, 181, 87, 167, 217, 97, 109, 33, 178, 146, 153, 246, 177, 60, 225, 161, 107, 70, 148, 9, 187, 173, 41,
-    16, 45, 53, 62, 128, 75, 161, 128, 245, 193, 134, 107, 33, 21, 200, 250, 196, 95, 225, 110, 71, 126, 207, 107, 133,
-    192, 229, 237, 90, 51, 160, 27, 197, 61, 202, 242, 68, 85, 10, 64, 219, 164, 1, 170, 158, 134, 173, 152, 228, 56,
-    29, 250, 241, 191, 154, 153, 146, 193, 143, 234, 6, 10, 164, 96, 99, 75, 78, 226, 210, 18, 104, 20, 36, 69, 156,
-    158, 220, 165, 14, 154, 191, 30, 149, 169, 131, 8, 244, 162, 145, 7, 204, 96, 14, 156, 95, 24, 59, 241, 130, 218,
-    120, 211, 15, 214, 210, 226, 86, 54, 95, 238, 220, 212, 69, 41, 19, 84, 210, 199, 200, 244, 65, 100, 45, 7, 139,
-    159, 44, 176, 81, 148, 74, 27, 18, 148, 217, 6, 243, 152, 212, 168, 169, 247, 128, 240, 190, 17, 109, 202, 114, 206,
-    156, 118, 243, 121, 234, 111, 49, 240, 87, 140, 129, 195, 241, 68, 187, 100, 149, 2, 170, 90, 158, 22, 204, 220,
-    105, 181, 207, 86, 27, 76, 164, 65, 63, 159, 150, 253, 23, 105, 0, 62, 109, 168, 150, 149, 164, 222, 109, 157, 13,
-    24, 215, 35, 160, 201, 203, 186, 121, 45, 90, 217, 110, 247, 49, 123, 136, 172, 6, 218, 36, 208, 170, 53, 116, 243,
-    118, 193, 206, 254, 91, 106, 213, 142, 233, 243, 33, 193, 193, 254, 56, 72, 227, 190, 88, 79, 66, 122, 143, 163,
-    176, 18, 221, 202, 160, 198, 144, 117, 67, 196, 102, 53, 20, 81, 188, 125, 129, 62, 35, 79, 241, 220, 21, 214, 29,
-    172, 179, 243, 110, 189, 40, 190, 168, 48, 157, 184, 87, 100, 78, 4, 240, 136, 51, 179, 13, 163, 172, 57, 191, 166,
-    48, 3, 164, 233, 206, 117, 250, 25, 236, 87, 143, 186, 127, 185, 75, 4, 78, 212, 0, 47, 84, 202, 238, 68, 93, 129,
-    17, 136, 234, 91, 159, 148, 247, 236, 15, 154, 7, 168, 184, 159, 96, 19, 44, 72, 58, 223, 180, 134, 82, 2, 78, 59,
-    71, 7, 123, 117, 215, 241, 227, 37, 18, 15, 214, 106, 43, 37, 46, 49, 250, 208, 78, 200, 135, 53, 251, 12, 238, 97,
-    179, 8, 160, 53, 217, 193, 113, 117, 97, 192, 33, 168, 67, 100, 197, 124, 217, 190, 51, 28, 31, 216, 51, 27, 216,
-    147, 125, 68, 112, 21, 187, 84, 177, 122, 20, 210, 31, 215, 32, 160, 108, 253, 48, 228, 92, 180, 76, 141, 189, 22,
-    59, 102, 189, 218, 131, 3, 233, 0, 59, 93, 134, 115, 30, 138, 171, 48, 116, 98, 45, 175, 61, 36, 230, 25, 224, 146,
-    43, 239, 208, 215, 5, 113, 145, 114, 76, 124, 130, 250, 246, 20, 146, 27, 75, 26, 238, 216, 172, 247, 29, 159, 4,
-    228, 9, 92, 118, 13, 46, 43, 242, 78, 98, 169, 131, 83, 225, 250, 146, 198, 143, 187, 235, 241, 135, 222, 177, 235,
-    117, 185, 9, 65, 59, 203, 18, 211, 192, 118, 162, 220, 234, 19, 61, 36, 183, 251, 19, 161, 74, 69, 66, 232, 105,
-    246, 183, 252, 96, 230, 49, 110, 14, 16, 114, 223, 25, 151, 233, 207, 64, 178, 185, 199, 80, 93, 83, 79, 66, 4, 117,
-    37, 57, 112, 52, 68, 253, 230, 141, 126, 150, 100, 85, 39, 191, 241, 134, 24, 95, 141, 143, 34, 168, 11, 61, 36, 27,
-    79, 118, 159, 245, 11, 164, 165, 149, 136, 235, 120, 230, 73, 25, 173, 7, 47, 60, 151, 178, 159, 166, 10, 55, 183,
-    68, 79, 90, 191, 127, 16, 235, 41, 240, 207, 72, 173, 138, 191, 145, 166, 172, 104, 136, 190, 0, 85, 55, 147, 246,
-    184, 184, 8, 60, 128, 72, 66, 14, 17, 243, 89, 31, 176, 219, 96, 233, 179, 219, 137, 238, 228, 175, 158, 180, 67,
-    54, 193, 85, 117, 119, 39, 106, 87, 43, 72, 246, 53, 99, 133, 186, 27, 208, 28, 13, 29, 215, 176, 51, 177, 177, 96,
-    48, 118, 59, 137, 169, 171, 135, 20, 115, 75, 81, 95, 246, 174, 173, 221, 39, 183, 83, 104, 210, 18, 44, 231, 165,
-    239, 118, 168, 247, 73, 31, 199, 175, 86, 158, 137, 108, 147, 157, 101, 238, 248, 3, 238, 4, 170, 45, 190, 30, 70,
-    188, 185, 84, 232, 121, 101, 149, 104, 42, 142, 111, 38, 87, 87, 47, 214, 252, 88, 184, 204, 126, 193, 156, 40, 211,
-    246, 46, 84, 109, 241, 229, 196, 70, 166, 162, 47, 58, 68, 14, 146, 141, 9, 98, 6, 188, 173, 7, 237, 104, 135, 210,
-    98, 21, 65, 129, 120, 155, 120, 7, 143, 242, 131, 50, 65, 4, 205, 114, 218, 218, 78, 141, 176, 150, 149, 56, 61,
-    233, 54, 2, 113, 3, 36, 20, 30, 76, 220, 19, 194, 167, 84, 236, 225, 192, 63, 140, 242, 3, 225, 153, 158, 66, 70,
-    16, 169, 77, 80, 227, 205, 160, 206, 214, 163, 138, 251, 214, 161, 89, 145, 238, 210, 86, 128, 242, 105, 128, 77,
-    92, 64, 61, 118, 92, 210, 75, 73, 171, 89, 173, 239, 92, 162, 180, 41, 189, 84, 237, 170, 61, 134, 119, 130, 197,
-    11, 49, 52, 240, 142, 172, 158, 198, 220, 35, 187, 39, 139, 197, 229, 227, 140, 60, 118, 16, 242, 44, 56, 56, 2,
-    238, 61, 209, 102, 138, 31, 23, 82, 228, 27, 229, 80, 236, 67, 106, 183, 119, 100, 25, 188, 108, 25, 6, 13, 17, 99,
-    104, 19, 121, 175, 25, 191, 148, 38, 187, 187, 28, 165, 8, 97, 205, 121, 9, 249, 90, 61, 15, 80, 73, 149, 160, 54,
-    206, 107, 97, 167, 44, 38, 61, 215, 151, 254, 18, 48, 150, 128, 15, 200, 145, 227, 42, 166, 176, 148, 185, 56, 18,
-    124, 26, 50, 120, 134, 152, 29, 182, 29, 122, 156, 35, 149, 71, 42, 78, 194, 57, 245, 143, 75, 18, 145, 168, 2, 130,
-    140, 15, 97, 163, 189, 230, 24, 46, 171, 205, 123, 126, 22, 23, 59, 122, 202, 64, 241, 240, 98, 183, 73, 138, 170,
-    167, 0, 24, 80, 218, 16, 167, 169, 104, 101, 212, 151, 213, 232, 177, 216, 15, 24, 8, 86, 40, 107, 191, 141, 57, 33,
-    238, 146, 31, 169, 186, 136, 55, 160, 178, 125, 176, 113, 188, 237, 154, 205, 191, 4, 69, 75, 66, 217, 154, 153, 67,
-    45, 242, 139, 237, 194, 251, 123, 17, 187, 213, 176, 37, 87, 65, 76, 225, 65, 2, 15, 199, 148, 22, 55, 142, 190,
-    183, 87, 55, 59, 134, 242, 47, 20, 217, 93, 171, 168, 105, 54, 230, 196, 189, 202, 75, 140, 26, 72, 74, 173, 142,
-    79, 222, 51, 158, 52, 166, 126, 189, 179, 149, 186, 59, 109, 195, 229, 31, 190, 42, 123, 88, 165, 114, 208, 193,
-    233, 126, 58, 61, 184, 196, 49, 132, 130, 20, 79, 231, 3, 104, 176, 38, 156, 44, 112, 194, 187, 56, 66, 224, 224, 2,
-    224, 39, 203, 43, 130, 154, 120, 93, 194, 111, 66, 192, 122, 117, 47, 157, 195, 160, 49, 103, 220, 72, 207, 238,
-    161, 199, 20, 44, 120, 161, 58, 19, 161, 129, 37, 119, 233, 224, 121, 101, 149, 180, 19, 97, 126, 173, 120, 247,
-    202, 242, 72, 88, 156, 39, 204, 213, 63, 92, 0, 48, 231, 109, 54, 144, 89, 189, 102, 98, 85, 34, 114, 164, 164, 172,
-    135, 127, 101, 11, 169, 213, 204, 215, 173, 237, 249, 237, 69, 50, 213, 108, 218, 53, 74, 195, 91, 121, 1, 244, 100,
-    131, 165, 85, 218, 130, 117, 100, 63, 118, 49, 126, 130, 47, 140, 121, 32, 127, 238, 229, 8, 217, 120, 200, 12, 103,
-    250, 229, 42, 2, 152, 138, 134, 162, 239, 76, 157, 139, 136, 48, 2, 180, 137, 229, 81, 23, 67, 134, 139, 233, 115,
-    90, 1, 2, 190, 162, 240, 87, 186, 25, 243, 94, 37, 236, 100, 191, 3, 210, 26, 21, 87, 32, 247, 120, 153, 188, 171,
-    83, 212, 128, 50, 165, 159, 111, 189, 173, 52, 52, 95, 50, 223, 198, 139, 227, 234, 128, 51, 161, 215, 81, 255, 24,
-    210, 176, 146, 204, 161, 195, 161, 13, 212, 189, 160, 132, 44, 141, 242, 162, 147, 194, 95, 218, 169, 51, 92, 20,
-    205, 142, 21, 128, 176, 177, 191, 253, 153, 166, 248, 224, 226, 111, 250, 8, 178, 77, 218, 97, 37, 125, 177, 177,
-    38, 37, 222, 250, 111, 120, 163, 192, 14, 253, 63, 134, 180, 230, 74, 169, 87, 232, 82, 200, 136, 238, 112, 74, 36,
-    42, 221, 109, 239, 33, 180, 43, 179, 228, 143, 44, 44, 250, 164, 100, 141, 135, 137, 126, 132, 198, 4, 245, 66, 235,
-    46, 185, 205, 61, 215, 142, 158, 9, 16, 155, 23, 216, 20, 164, 126, 119, 93, 120, 213, 14, 30, 125, 211, 217, 134,
-    94, 227, 12, 178, 227, 164, 39, 143, 59, 136, 8, 180, 79, 158, 188, 176, 63, 93, 11, 19, 184, 158, 228, 204, 142,
-    77, 114, 147, 230, 3, 47, 97, 184, 59, 55, 60, 104, 32, 169, 203, 151, 239, 206, 128, 86, 170, 114, 25, 60, 108, 29,
-    51, 144, 100, 64, 142, 118, 0, 90, 32, 201, 94, 78, 71, 168, 137, 68, 11, 147, 232, 242, 79, 216, 147, 76, 239, 194,
-    45, 165, 143, 80, 197, 227, 13, 194, 113, 141, 71, 22, 86, 91, 208, 168, 211, 237, 37, 74, 98, 216, 224, 31, 70,
-    162, 80, 184, 176, 40, 48, 211, 0, 162, 154, 69, 94, 54, 35, 251, 156, 63, 56, 249, 200, 169, 8, 177, 55, 117, 166,
-    32, 238, 254, 50, 60, 94, 39, 183, 49, 122, 189, 201, 5, 196, 179, 64, 105, 42, 12, 101, 8, 227, 59, 128, 225, 147,
-    44, 91, 241, 198, 255, 216, 15, 173, 127, 45, 87, 176, 1, 165, 60, 247, 24, 239, 6, 198, 183, 59, 226, 23, 92, 64,
-    174, 148, 63, 159, 103, 240, 254, 247, 250, 197, 38, 69, 195, 199, 177, 101, 168, 91, 255, 178, 253, 34, 116, 132,
-    252, 113, 63, 44, 255, 5, 14, 114, 188, 145, 181, 240, 60, 15, 167, 115, 151, 4, 162, 63, 135, 115, 114, 76, 38, 39,
-    93, 39, 165, 245, 153, 57, 132, 205, 225, 225, 157, 221, 204, 213, 244, 182, 150, 160, 37, 134, 10, 236, 120, 25,
-    218, 161, 135, 184, 10, 216, 236, 88, 43, 247, 67, 96, 58, 242, 38, 127, 122, 156, 210, 132, 138, 56, 231, 237, 72,
-    84, 52, 111, 175, 224, 251, 25, 70, 252, 231, 56, 92, 1, 228, 139, 208, 18, 152, 137, 35, 198, 98, 79, 107, 66, 79,
-    8, 36, 122, 15, 228, 128, 41, 74, 25, 244, 3, 190, 44, 59, 62, 229, 117, 38, 5, 154, 206, 239, 44, 250, 16, 106,
-    230, 170, 31, 201, 81, 145, 168, 243, 21, 148, 67, 161, 166, 124, 221, 18, 14, 167, 183, 192, 207, 254, 169, 109,
-    55, 233, 226, 55, 148, 106, 45, 203, 28, 14, 118, 5, 169, 249, 253, 50, 168, 127, 214, 57, 211, 41, 140, 106, 220,
-    5, 39, 230, 96, 130, 232, 124, 139, 126, 95, 238, 150, 202, 62, 185, 38, 20, 103, 78, 57, 63, 138, 120, 181, 238,
-    36, 120, 73, 88, 177, 166, 135, 178, 152, 178, 18, 63, 109, 34, 12, 108, 194, 128, 210, 110, 44, 79, 250, 10, 72,
-    119, 236, 248, 111, 167, 175, 86, 237, 17, 164, 236, 130, 207, 14, 46, 171, 78, 221, 156, 248, 135, 151, 218, 110,
-    10, 93, 125, 88, 250, 27, 23, 54, 187, 230, 38, 71, 214, 226, 178, 75, 70, 207, 102, 1, 103, 188, 158, 205, 150,
-    241, 39, 41, 233, 240, 124, 26, 43, 238, 29, 206, 195, 90, 14, 159, 68, 134, 117, 199, 210, 73, 90, 72, 81, 143, 66,
-    195, 138, 240, 243, 47, 221, 193, 104, 162, 208, 94, 231, 51, 220, 149, 55, 80, 139, 26, 43, 151, 98, 148, 152, 150,
-    19, 142, 243, 134, 88, 19, 151, 174, 175, 70, 5, 55, 12, 104, 1, 149, 140, 139, 145, 177, 95, 94, 184, 151, 238, 57,
-    249, 250, 173, 139, 92, 112, 8, 183, 103, 254, 193, 10, 20, 22, 21, 105, 15, 25, 26, 109, 143, 238, 210, 162, 189,
-    4, 209, 203, 15, 215, 120, 22, 156, 200, 170, 3, 101, 111, 179, 47, 212, 86, 88, 93, 92, 151, 235, 59, 241, 171, 10,
-    17, 123, 228, 154, 169, 207, 195, 162, 52, 2, 93, 189, 97, 134, 166, 144, 75, 19, 90, 151, 61, 205, 61, 150, 68,
-    162, 21, 83, 221, 155, 164, 99, 45, 39, 81, 61, 77, 98, 153, 1, 130, 62, 62, 218, 153, 117, 193, 253, 123, 83, 168,
-    121, 240, 9, 93, 171, 158, 6, 100, 112, 26, 131, 151, 181, 107, 0, 232, 110, 76, 84, 81, 215, 16, 24, 161, 254, 49,
-    133, 226, 89, 213, 150, 182, 22, 37, 250, 237, 152, 231, 14, 232, 69, 181, 246, 130, 246, 121, 34, 39, 244, 113,
-    238, 123, 155, 223, 16, 173, 138, 63, 149, 255, 57, 179, 159, 215, 69, 146, 36, 172, 207, 216, 40, 231, 57, 235,
-    114, 199, 166, 186, 10, 228, 77, 30, 115, 70, 254, 196, 41, 210, 179, 179, 52, 135, 89, 40, 169, 124, 25, 65, 124,
-    114, 38, 243, 28, 44, 239, 60, 107, 101, 242, 189, 54, 74, 160, 37, 174, 203, 89, 181, 39, 86, 186, 248, 150, 39,
-    67, 75, 96, 130, 110, 105, 76, 74, 232, 128, 176, 35, 126, 243, 214, 11, 109, 231, 21, 190, 148, 168, 38, 194, 206,
-    172, 147, 171, 118, 148, 199, 156, 21, 56, 117, 240, 210, 58, 130, 240, 173, 224, 58, 215, 123, 38, 161, 207, 151,
-    38, 63, 116, 77, 120, 216, 24, 102, 43, 169, 45, 31, 205, 163, 174, 131, 18, 87, 69, 118, 218, 233, 7, 96, 201, 139,
-    159, 205, 161, 180, 69, 115, 45, 41, 233, 2, 155, 197, 221, 47, 221, 250, 139, 165, 77, 20, 148, 120, 35, 54, 207,
-    18, 245, 163, 221, 81, 74, 108, 204, 83, 123, 194, 203, 113, 148, 118, 97, 50, 1, 102, 221, 38, 211, 128, 13, 117,
-    113, 188, 219, 5, 158, 226, 28, 46, 218, 126, 242, 179, 223, 135, 7, 246, 157, 254, 76, 4, 71, 133, 137, 38, 72, 6,
-    136, 14, 195, 92, 218, 89, 250, 242, 107, 6, 189, 188, 76, 196, 176, 66, 11, 9, 71, 214, 187, 74, 39, 222, 125, 66,
-    208, 174, 202, 121, 45, 45, 143, 53, 172, 3, 175, 122, 40, 88, 148, 161, 216, 98, 55, 47, 106, 14, 116, 43, 216, 55,
-    132, 147, 178, 179, 20, 22, 237, 58, 17, 143, 52, 194, 176, 31, 131, 131, 134, 197, 140, 199, 229, 143, 53, 225, 76,
-    185, 204, 144, 230, 200, 81, 200, 190, 157, 185, 203, 104, 54, 231, 11, 116, 21, 184, 202, 236, 112, 182, 56, 157,
-    213, 98, 172, 35, 84, 208, 43, 242, 96, 36, 71, 142, 236, 202, 212, 177, 210, 17, 37, 183, 181, 126, 178, 188, 99,
-    33, 173, 105, 5, 55, 176, 146, 216, 8, 76, 181, 238, 220, 8, 109, 136, 160, 24, 34, 225, 99, 85, 69, 4, 75, 41, 230,
-    43, 33, 120, 51, 64, 101, 56, 225, 84, 149, 206, 45, 140, 29, 214, 1, 155, 100, 219, 50, 61, 96, 178, 211, 190, 47,
-    205, 2, 110, 130, 159, 36, 177, 174, 134, 25, 114, 133, 19, 161, 253, 208, 98, 240, 155, 7, 170, 46, 146, 216, 184,
-    254, 245, 186, 14, 105, 189, 14, 59, 218, 239, 195, 215, 199, 237, 50, 222, 71, 85, 15, 105, 165, 232, 174, 197,
-    132, 125, 41, 13, 39, 193, 131, 64, 180, 216, 168, 104, 153, 1, 40, 61, 26, 198, 189, 52, 156, 76, 107, 118, 198,
-    72, 18, 251, 14, 83, 251, 184, 86, 109, 184, 143, 84, 238, 196, 140, 68, 207, 10, 56, 236, 173, 70, 40, 202, 48,
-    161, 177, 230, 186, 66, 113, 160, 70, 217, 6, 38, 2, 185, 166, 7, 94, 121, 110, 110, 252, 163, 13, 96, 160, 234,
-    195, 202, 212, 57, 67, 45, 79, 43, 250, 24, 122, 203, 39, 53, 230, 232, 69, 63, 74, 155, 163, 35, 228, 34, 161, 246,
-    238, 239, 171, 34, 37, 199, 23, 201, 107, 54, 27, 129, 237, 172, 4, 37, 13, 3, 109, 153, 43, 31, 71, 75, 111, 79,
-    39, 111, 105, 163, 177, 159, 157, 165, 58, 162, 11, 233, 141, 115, 235, 94, 252, 221, 140, 180, 132, 109, 82, 191,
-    146, 225, 228, 177, 6, 78, 43, 138, 193, 114, 111, 214, 178, 254, 77, 10, 18, 130, 182, 50, 3, 126, 217, 205, 237,
-    96, 230, 138, 53, 14, 189, 15, 147, 129, 139, 20, 33, 106, 239, 251, 31, 126, 215, 188, 245, 248, 209, 156, 42, 48,
-    99, 87, 225, 33, 30, 27, 187, 71, 223, 147, 25, 98, 125, 214, 62, 189, 141, 134, 21, 15, 12, 199, 176, 34, 66, 27,
-    139, 252, 206, 255, 63, 105, 40, 111, 176, 103, 38, 206, 254, 131, 226, 105, 17, 203, 19, 99, 14, 25, 135, 225, 203,
-    75, 73, 170, 246, 11, 18, 180, 89, 120, 208, 118, 197, 154, 112, 173, 2, 144, 198, 194, 200, 176, 229, 89, 114, 88,
-    49, 52, 130, 20, 57, 72, 68, 30, 9, 54, 166, 235, 21, 18, 22, 124, 79, 200, 246, 160, 141, 245, 188, 47, 211, 131,
-    22, 169, 125, 138, 216, 107, 99, 137, 193, 118, 208, 136, 26, 156, 254, 79, 6, 237, 170, 216, 41, 136, 178, 112, 78,
-    159, 66, 246, 95, 35, 205, 107, 2, 140, 62, 149, 17, 224, 230, 115, 32, 221, 243, 249, 91, 10, 91, 236, 249, 5, 187,
-    219, 14, 165, 102, 181, 39, 47, 129, 187, 124, 176, 6, 29, 30, 56, 188, 255, 89, 244, 214, 168, 156, 148, 217, 94,
-    186, 58, 231, 105, 102, 187, 235, 251, 209, 155, 137, 163, 72, 182, 1, 222, 183, 207, 212, 221, 23, 225, 208, 126,
-    55, 72, 133, 223, 166, 209, 225, 217, 69, 63, 231, 155, 78, 81, 17, 212, 124, 99, 224, 66, 157, 4, 213, 159, 34, 4,
-    215, 158, 33, 136, 45, 146, 115, 131, 184, 18, 145, 250, 5, 134, 213, 231, 173, 47, 195, 85, 223, 243, 212, 85, 155,
-    23, 240, 161, 175, 5, 63, 252, 117, 65, 133, 18, 56, 36, 252, 37, 238, 203, 125, 241, 37, 100, 69, 101, 169, 240,
-    207, 67, 234, 240, 130, 191, 31, 59, 158, 34, 72, 131, 85, 105, 216, 134, 184, 189, 67, 61, 116, 6, 120, 119, 116,
-    65, 65, 131, 109, 101, 85, 21, 53, 26, 207, 159, 254, 71, 22, 2, 163, 216, 97, 158, 55, 158, 45, 165, 7, 154, 214,
-    191, 180, 149, 155, 103, 201, 159, 190, 214, 149, 219, 159, 124, 176, 142, 207, 246, 20, 200, 80, 99, 30, 154, 94,
-    177, 254, 62, 128, 120, 77, 209, 131, 211, 75, 129, 147, 138, 171, 46, 177, 213, 97, 91, 158, 168, 86, 164, 216,
-    104, 85, 152, 117, 72, 119, 77, 113, 13, 52, 91, 251, 54, 207, 215, 248, 192, 218, 191, 77, 156, 223, 40, 154, 126,
-    184, 90, 7, 115, 231, 120, 38, 75, 177, 103, 162, 238, 221, 8, 102, 24, 44, 51, 24, 90, 223, 14, 48, 65, 222, 88,
-    139, 206, 88, 109, 71, 95, 224, 7, 136, 155, 82, 255, 55, 238, 24, 27, 24, 245, 174, 156, 237, 162, 12, 54, 201,
-    215, 3, 211, 235, 188, 113, 0, 68, 89, 150, 75, 22, 13, 145, 209, 179, 84, 28, 217, 15, 81, 12, 90, 180, 205, 57,
-    135, 212, 206, 220, 50, 120, 154, 16, 56, 76, 102, 44, 65, 17, 116, 183, 52, 181, 13, 84, 18, 105, 5, 77, 235, 161,
-    239, 187, 87, 210, 233, 144, 157, 19, 172, 88, 150, 73, 61, 95, 88, 120, 59, 230, 209, 246, 92, 110, 117, 147, 89,
-    255, 187, 138, 216, 5, 141, 252, 94, 225, 98, 22, 242, 83, 176, 195, 116, 10, 200, 24, 181, 27, 86, 125, 161, 70,
-    252, 125, 230, 237, 125, 169, 165, 47, 39, 66, 63, 129, 110, 49, 69, 129, 100, 129, 25, 58, 149, 24, 153, 95, 48,
-    215, 26, 188, 22, 19, 36, 92, 195, 254, 133, 107, 65, 34, 187, 233, 27, 151, 20, 6, 86, 236, 184, 162, 109, 67, 118,
-    74, 210, 90, 92, 193, 151, 178, 3, 165, 253, 149, 15, 4, 146, 230, 35, 165, 250, 51, 194, 148, 55, 54, 219, 128,
-    121, 69, 115, 50, 144, 216, 149, 82, 193, 202, 195, 41, 33, 148, 155, 213, 181, 145, 226, 42, 31, 250, 171, 128,
-    241, 19, 205, 126, 139, 241, 43, 231, 63, 58, 144, 48, 150, 13, 103, 131, 109, 240, 149, 125, 65, 155, 177, 192,
-    188, 231, 178, 41, 153, 27, 214, 76, 64, 123, 13, 194, 82, 159, 154, 137, 19, 69, 105, 254, 214, 223, 92, 11, 102,
-    220, 68, 129, 109, 38, 0, 93, 222, 40, 202, 195, 121, 196, 136, 62, 16, 186, 183, 225, 200, 111, 218, 75, 178, 64,
-    246, 91, 11, 40, 3, 120, 36, 110, 21, 117, 5, 97, 15, 227, 80, 188, 221, 129, 163, 63, 178, 176, 56, 106, 114, 115,
-    91, 73, 147, 123, 169, 91, 248, 147, 188, 238, 180, 214, 117, 248, 78, 211, 139, 133, 15, 7, 44, 9, 29, 68, 128, 62,
-    63, 41, 218, 198, 214, 67, 156, 186, 168, 200, 7, 70, 13, 232, 114, 237, 1, 207, 226, 35, 195, 250, 7, 62, 2, 150,
-    196, 211, 106, 95, 191, 144, 102, 248, 119, 140, 93, 81, 159, 47, 169, 163, 8, 73, 166, 189, 9, 127, 70, 95, 197,
-    53, 112, 224, 29, 33, 235, 3, 164, 221, 16, 100, 77, 21, 133, 30, 219, 127, 165, 161, 42, 62, 52, 193, 84, 71, 168,
-    235, 133, 78, 88, 192, 77, 82, 162, 195, 145, 85, 186, 231, 1, 197, 40, 47, 15, 136, 125, 194, 228, 175, 78, 139,
-    68, 247, 42, 193, 103, 44, 35, 138, 217, 40, 176, 244, 201, 248, 56, 245, 6, 199, 147, 57, 173, 29, 194, 127, 150,
-    87, 243, 107, 214, 15, 172, 167, 69, 88, 44, 29, 110, 59, 35, 195, 145, 225, 187, 193, 20, 31, 246, 34, 21, 17, 128,
-    158, 150, 18, 134, 180, 123, 83, 224, 117, 80, 59, 252, 118, 77, 255, 95, 108, 42, 225, 223, 202, 223, 44, 164, 255,
-    6, 193, 86, 122, 177, 162, 225, 207, 12, 164, 79, 188, 59, 2, 39, 216, 40, 214, 217, 67, 158, 106, 214, 27, 37, 155,
-    146, 151, 88, 60, 193, 250, 115, 90, 230, 139, 177, 161, 104, 242, 252, 69, 162, 13, 97, 18, 52, 223, 141, 143, 69,
-    175, 212, 237, 212, 126, 108, 105, 252, 135, 236, 161, 23, 174, 40, 128, 98, 112, 140, 8, 52, 128, 122, 17, 254, 83,
-    182, 165, 84, 221, 12, 6, 226, 62, 69, 138, 55, 244, 158, 123, 2, 8, 95, 75, 153, 240, 78, 190, 254, 83, 26, 75, 79,
-    113, 134, 190, 180, 128, 105, 234, 200, 235, 109, 209, 240, 252, 39, 225, 71, 41, 209, 141, 216, 140, 121, 48, 20,
-    64, 167, 34, 138, 151, 98, 123, 86, 76, 209, 90, 79, 130, 101, 193, 250, 178, 244, 15, 52, 68, 53, 150, 134, 250,
-    240, 57, 158, 30, 40, 148, 97, 18, 4, 117, 146, 125, 240, 214, 174, 42, 204, 88, 81, 96, 94, 58, 55, 160, 146, 86,
-    211, 192, 243, 252, 12, 11, 26, 253, 159, 37, 169, 82, 216, 111, 7, 161, 9, 158, 58, 100, 102, 245, 176, 16, 219,
-    224, 243, 58, 80, 177, 36, 48, 30, 188, 147, 74, 48, 29, 165, 211, 148, 190, 249, 123, 45, 142, 115, 225, 59, 78,
-    210, 142, 21, 9, 191, 110, 136, 219, 86, 25, 66, 57, 84, 144, 155, 101, 252, 128, 178, 199, 127, 88, 109, 201, 92,
-    135, 165, 242, 97, 99, 240, 202, 33, 215, 12, 221, 108, 223, 244, 248, 254, 181, 207, 243, 52, 75, 77, 194, 246, 66,
-    83, 97, 15, 217, 153, 48, 149, 211, 174, 202, 92, 183, 57, 14, 203, 52, 96, 28, 156, 68, 112, 225, 240, 87, 85, 83,
-    225, 72, 131, 181, 147, 56, 88, 18, 174, 201, 194, 157, 176, 213, 76, 229, 188, 235, 243, 134, 74, 144, 128, 144,
-    101, 179, 240, 28, 7, 150, 36, 35, 248, 208, 219, 225, 27, 204, 228, 226, 99, 112, 141, 251, 25, 197, 209, 24, 112,
-    197, 57, 210, 244, 75, 245, 6, 82, 236, 6, 57, 130, 182, 112, 219, 197, 188, 92, 163, 100, 42, 115, 154, 201, 193,
-    105, 242, 166, 250, 10, 29, 235, 119, 170, 19, 31, 186, 16, 85, 10, 53, 108, 21, 3, 239, 77, 192, 108, 19, 84, 120,
-    55, 97, 42, 181, 53, 186, 108, 227, 62, 54, 164, 169, 235, 189, 58, 95, 225, 233, 0, 24, 140, 12, 155, 18, 177, 254,
-    253, 149, 46, 16, 227, 49, 12, 184, 186, 11, 80, 205, 44, 4, 164, 164, 91, 71, 147, 177, 144, 130, 91, 129, 141,
-    210, 180, 228, 7, 176, 66, 148, 127, 52, 155, 197, 55, 27, 128, 234, 230, 189, 185, 27, 157, 198, 88, 121, 73, 35,
-    73, 26, 117, 85, 96, 165, 8, 217, 106, 151, 252, 241, 175, 32, 12, 240, 34, 32, 22, 20, 2, 169, 10, 233, 117, 72, 4,
-    8, 213, 123, 70, 98, 237, 168, 205, 242, 124, 170, 153, 132, 14, 3, 240, 73, 200, 81, 177, 57, 76, 73, 4, 149, 217,
-    124, 160, 134, 55, 165, 16, 20, 225, 214, 181, 234, 29, 49, 11, 152, 158, 141, 82, 119, 72, 147, 252, 139, 50, 135,
-    79, 111, 191, 50, 86, 173, 228, 107, 33, 239, 156, 69, 80, 167, 207, 10, 101, 140, 118, 9, 66, 177, 41, 84, 125, 52,
-    242, 176, 234, 149, 107, 207, 116, 113, 170, 75, 6, 47, 240, 240, 242, 138, 234, 169, 246, 92, 182, 12, 184, 222,
-    135, 17, 106, 151, 112, 153, 191, 59, 12, 115, 208, 210, 219, 149, 182, 233, 134, 0, 239, 65, 195, 18, 19, 249, 155,
-    98, 192, 219, 151, 5, 103, 43, 119, 245, 232, 68, 146, 211, 147, 211, 167, 97, 13, 244, 34, 191, 132, 48, 7, 172,
-    156, 158, 150, 227, 76, 69, 219, 45, 149, 73, 121, 248, 68, 176, 55, 217, 42, 15, 95, 23, 101, 248, 165, 188, 175,
-    124, 48, 150, 103, 185, 142, 136, 53, 175, 49, 107, 213, 240, 104, 54, 217, 252, 164, 37, 31, 191, 84, 201, 75, 89,
-    201, 115, 192, 185, 146, 151, 208, 140, 83, 27, 30, 83, 202, 14, 118, 85, 16, 214, 106, 8, 97, 132, 254, 120, 170,
-    51, 97, 88, 151, 17, 225, 201, 119, 50, 66, 92, 114, 117, 109, 199, 139, 165, 54, 16, 98, 162, 57, 12, 94, 252, 152,
-    60, 222, 243, 242, 5, 127, 195, 203, 20, 160, 239, 78, 165, 61, 245, 114, 29, 217, 196, 139, 167, 146, 172, 190, 87,
-    156, 179, 212, 115, 161, 180, 15, 48, 213, 53, 14, 10, 12, 168, 244, 150, 77, 181, 234, 90, 87, 17, 64, 167, 161,
-    211, 195, 179, 122, 175, 197, 92, 119, 157, 167, 117, 115, 32, 43, 84, 2, 63, 5, 48, 59, 151, 178, 242, 207, 144,
-    185, 54, 109, 240, 76, 122, 218, 110, 216, 31, 58, 151, 178, 237, 121, 255, 111, 44, 131, 247, 71, 55, 4, 131, 164,
-    11, 190, 231, 106, 75, 179, 162, 44, 92, 200, 34, 159, 37, 155, 248, 53, 176, 185, 172, 22, 239, 4, 220, 230, 189,
-    142, 229, 224, 38, 62, 139, 224, 98, 217, 47, 42, 6, 211, 136, 0, 183, 92, 200, 227, 105, 96, 155, 16, 234, 100,
-    163, 52, 179, 87, 17, 177, 197, 38, 87, 142, 33, 174, 53, 201, 189, 190, 191, 38, 21, 52, 248, 80, 233, 233, 99, 0,
-    8, 21, 219, 66, 241, 223, 222, 108, 200, 135, 77, 114, 8, 114, 185, 207, 142, 125, 148, 97, 134, 174, 188, 88, 111,
-    246, 28, 230, 144, 147, 41, 41, 217, 238, 98, 79, 238, 125, 34, 55, 3, 180, 63, 15, 14, 113, 165, 117, 21, 86, 4,
-    156, 184, 98, 22, 172, 52, 189, 9, 13, 228, 209, 141, 220, 14, 147, 79, 237, 197, 170, 24, 17, 219, 198, 200, 119,
-    247, 180, 100, 232, 110, 38, 152, 167, 192, 221, 80, 138, 232, 139, 188, 146, 174, 28, 144, 222, 96, 109, 206, 230,
-    146, 35, 107, 44, 247, 214, 225, 232, 250, 163, 228, 48, 165, 214, 246, 24, 78, 224, 102, 152, 247, 9, 70, 180, 154,
-    166, 205, 78, 251, 3, 77, 165, 220, 91, 132, 147, 65, 244, 194, 51, 223, 15, 222, 15, 182, 22, 13, 237, 189, 41, 49,
-    238, 8, 34, 99, 248, 182, 202, 216, 20, 57, 84, 120, 166, 38, 243, 178, 88, 13, 120, 8, 48, 206, 182, 131, 70, 175,
-    226, 33, 161, 206, 240, 226, 83, 206, 138, 71, 66, 151, 215, 83, 57, 208, 239, 135, 188, 213, 14, 145, 191, 241, 12,
-    243, 177, 14, 114, 84, 79, 106, 41, 222, 178, 36, 187, 181, 182, 58, 231, 108, 20, 59, 59, 92, 226, 208, 110, 244,
-    179, 184, 172, 224, 182, 10, 129, 144, 174, 221, 128, 120, 245, 40, 216, 138, 87, 237, 73, 252, 42, 23, 33, 231,
-    132, 203, 105, 55, 227, 8, 118, 173, 195, 84, 5, 49, 195, 15, 58, 91, 226, 198, 161, 151, 93, 10, 150, 227, 78, 26,
-    10, 147, 215, 237, 177, 198, 250, 68, 197, 69, 38, 80, 5, 243, 4, 198, 211, 243, 12, 101, 248, 160, 59, 168, 69,
-    122, 3, 71, 204, 31, 177, 239, 194, 4, 107, 12, 25, 252, 100, 178, 76, 136, 5, 17, 234, 163, 37, 224, 64, 170, 224,
-    0, 66, 226, 47, 161, 57, 147, 106, 240, 76, 89, 179, 14, 169, 111, 229, 224, 155, 13, 198, 37, 244, 146, 81, 142,
-    110, 149, 78, 184, 231, 44, 65, 235, 207, 10, 46, 226, 137, 197, 168, 20, 74, 197, 45, 21, 243, 201, 150, 118, 69,
-    11, 104, 1, 57, 149, 111, 239, 158, 245, 78, 27, 114, 212, 193, 72, 65, 198, 130, 239, 75, 212, 53, 91, 34, 242, 59,
-    248, 140, 134, 239, 147, 42, 253, 168, 17, 123, 96, 57, 46, 108, 145, 246, 58, 43, 153, 25, 68, 118, 27, 236, 213,
-    85, 216, 114, 88, 168, 125, 18, 60, 142, 163, 135, 26, 233, 114, 195, 232, 66, 181, 183, 185, 33, 252, 199, 176, 63,
-    90, 51, 88, 129, 109, 208, 13, 135, 28, 32, 129, 118, 126, 100, 175, 251, 57, 29, 220, 57, 120, 125, 89, 21, 169,
-    127, 92, 152, 23, 238, 96, 162, 190, 206, 60, 66, 160, 242, 39, 223, 248, 107, 91, 98, 64, 150, 230, 41, 126, 48,
-    224, 11, 97, 178, 226, 203, 174, 95, 157, 49, 38, 148, 179, 244, 38, 3, 211, 56, 108, 2, 251, 237, 105, 78, 196, 19,
-    137, 44, 54, 145, 71, 174, 167, 245, 164, 161, 46, 27, 145, 4, 136, 222, 38, 13, 226, 115, 54, 233, 233, 58, 170,
-    55, 232, 202, 165, 79, 162, 108, 46, 79, 250, 72, 49, 25, 70, 151, 211, 12, 218, 127, 97, 166, 250, 3, 75, 21, 7,
-    211, 15, 211, 173, 223, 112, 90, 137, 170, 115, 58, 182, 16, 73, 183, 26, 138, 102, 2, 227, 139, 160, 129, 47, 75,
-    36, 167, 2, 46, 177, 154, 186, 51, 60, 124, 169, 231, 79, 222, 241, 77, 132, 188, 25, 168, 121, 159, 255, 74, 149,
-    147, 138, 26, 18, 62, 196, 167, 43, 6, 20, 17, 210, 253, 37, 90, 12, 245, 227, 194, 253, 220, 31, 202, 116, 127, 76,
-    70, 142, 221, 34, 231, 62, 157, 230, 232, 95, 52, 129, 33, 15, 210, 106, 86, 218, 227, 61, 4, 77, 97, 205, 62, 106,
-    208, 131, 119, 137, 101, 205, 50, 201, 119, 69, 124, 165, 141, 0, 25, 232, 157, 168, 80, 44, 92, 160, 249, 23, 11,
-    47, 39, 190, 37, 88, 155, 84, 23, 173, 158, 151, 10, 205, 255, 144, 83, 152, 65, 199, 251, 90, 207, 119, 120, 87,
-    171, 9, 45, 113, 126, 151, 233, 201, 45, 178, 186, 138, 72, 105, 41, 143, 251, 123, 47, 168, 138, 58, 189, 99, 160,
-    3, 97, 95, 217, 195, 170, 189, 207, 38, 200, 4, 133, 48, 241, 192, 126, 124, 216, 125, 149, 106, 159, 14, 9, 234,
-    132, 15, 243, 149, 160, 130, 79, 104, 188, 226, 167, 102, 24, 103, 174, 178, 202, 43, 166, 99, 52, 108, 51, 240,
-    223, 139, 152, 196, 203, 58, 113, 67, 216, 18, 100, 27, 54, 213, 120, 137, 254, 94, 141, 234, 174, 58, 134, 15, 149,
-    107, 239, 228, 196, 105, 27, 227, 151, 23, 188, 7, 195, 47, 78, 147, 209, 4, 117, 131, 109, 54, 166, 14, 166, 145,
-    208, 0, 18, 111, 152, 174, 83, 181, 122, 176, 72, 187, 84, 163, 9, 42, 79, 216, 203, 90, 94, 227, 78, 123, 242, 149,
-    150, 243, 142, 81, 59, 240, 90, 112, 237, 172, 48, 128, 248, 232, 48, 27, 230, 53, 254, 77, 172, 23, 230, 2, 0, 232,
-    119, 179, 147, 205, 17, 150, 85, 35, 151, 20, 99, 61, 246, 175, 134, 53, 66, 109, 109, 48, 216, 127, 129, 157, 212,
-    103, 204, 156, 200, 207, 110, 226, 237, 80, 150, 31, 19, 155, 154, 173, 110, 23, 127, 157, 145, 228, 152, 61, 220,
-    32, 212, 39, 176, 12, 169, 42, 162, 95, 173, 155, 26, 186, 146, 74, 225, 20, 120, 188, 156, 94, 239, 79, 73, 84, 60,
-    51, 130, 78, 112, 2, 83, 17, 45, 113, 124, 238, 214, 72, 79, 133, 121, 149, 135, 179, 42, 9, 150, 12, 145, 132, 187,
-    194, 53, 111, 43, 254, 195, 26, 54, 211, 44, 121, 119, 25, 151, 68, 42, 81, 93, 101, 88, 49, 60, 83, 200, 117, 27,
-    206, 214, 242, 70, 156, 111, 212, 219, 6, 104, 20, 152, 168, 166, 22, 244, 148, 159, 5, 175, 15, 136, 4, 172, 121,
-    105, 164, 67, 230, 122, 91, 241, 113, 62, 9, 39, 62, 9, 143, 161, 92, 163, 151, 138, 58, 192, 23, 15, 124, 24, 61,
-    115, 110, 179, 246, 220, 225, 40, 27, 38, 171, 52, 15, 22, 49, 67, 48, 54, 104, 187, 39, 236, 19, 144, 47, 176, 237,
-    70, 78, 61, 253, 41, 174, 181, 9, 188, 144, 228, 198, 99, 163, 118, 58, 245, 150, 125, 28, 184, 59, 30, 74, 155, 93,
-    77, 168, 235, 215, 54, 107, 200, 196, 136, 204, 15, 93, 108, 113, 205, 17, 57, 235, 181, 72, 240, 55, 218, 180, 246,
-    255, 121, 207, 41, 111, 137, 34, 131, 219, 187, 215, 200, 169, 165, 17, 128, 225, 116, 166, 93, 84, 107, 79, 41, 76,
-    207, 248, 153, 180, 167, 199, 77, 186, 111, 247, 65, 227, 247, 222, 162, 26, 166, 113, 39, 114, 95, 34, 30, 11, 241,
-    18, 5, 38, 195, 29, 111, 40, 137, 42, 226, 241, 49, 238, 240, 3, 106, 70, 252, 64, 100, 158, 117, 146, 244, 7, 223,
-    191, 79, 84, 52, 35, 229, 93, 83, 221, 61, 232, 6, 174, 245, 136, 246, 37, 241, 33, 95, 94, 130, 96, 64, 189, 241,
-    42, 159, 80, 206, 226, 161, 11, 162, 233, 24, 78, 247, 101, 194, 125, 55, 211, 90, 221, 53, 215, 45, 182, 170, 84,
-    40, 195, 114, 190, 126, 233, 184, 238, 101, 93, 204, 245, 129, 69, 22, 222, 11, 205, 41, 181, 132, 39, 27, 151, 117,
-    17, 73, 222, 49, 4, 72, 223, 18, 155, 114, 225, 136, 16, 24, 100, 109, 197, 158, 247, 221, 62, 138, 237, 21, 57, 88,
-    134, 213, 125, 69, 52, 72, 35, 54, 157, 119, 130, 24, 225, 57, 117, 222, 234, 73, 172, 206, 29, 131, 134, 16, 191,
-    216, 22, 12, 109, 110, 225, 131, 74, 44, 56, 79, 59, 143, 152, 242, 62, 218, 15, 208, 17, 230, 42, 50, 1, 171, 251,
-    104, 115, 81, 142, 205, 197, 54, 1, 234, 191, 74, 92, 94, 127, 43, 58, 69, 166, 179, 204, 238, 114, 158, 81, 113,
-    122, 208, 60, 60, 240, 31, 84, 103, 234, 95, 151, 208, 188, 79, 192, 250, 173, 195, 246, 77, 238, 172, 12, 43, 176,
-    118, 40, 53, 209, 51, 167, 100, 219, 133, 234, 12, 164, 181, 82, 127, 170, 177, 255, 15, 245, 60, 170, 40, 197, 66,
-    81, 173, 86, 203, 255, 140, 17, 22, 145, 228, 249, 89, 13, 144, 147, 217, 104, 181, 82, 132, 202, 55, 28, 85, 221,
-    89, 18, 104, 60, 208, 136, 178, 176, 113, 89, 242, 113, 255, 131, 207, 165, 78, 140, 82, 0, 52, 74, 176, 118, 138,
-    111, 28, 163, 191, 144, 188, 87, 26, 48, 193, 200, 241, 150, 159, 47, 165, 167, 51, 112, 245, 69, 206, 191, 57, 42,
-    119, 219, 5, 30, 185, 214, 141, 136, 14, 44, 77, 35, 6, 204, 140, 191, 191, 37, 163, 88, 106, 19, 125, 102, 198, 64,
-    15, 130, 244, 117, 114, 21, 13, 196, 53, 21, 36, 60, 246, 228, 229, 3, 204, 178, 136, 18, 225, 9, 132, 129, 140, 49,
-    33, 155, 202, 47, 242, 197, 89, 100, 31, 134, 93, 150, 137, 181, 216, 120, 78, 80, 162, 128, 248, 78, 79, 9, 203,
-    60, 89, 3, 200, 102, 164, 238, 210, 56, 213, 176, 73, 185, 164, 132, 240, 111, 65, 2, 181, 182, 27, 5, 84, 50, 131,
-    157, 88, 128, 41, 199, 119, 35, 214, 194, 81, 20, 205, 100, 44, 247, 192, 152, 189, 82, 95, 207, 123, 143, 205, 164,
-    187, 72, 48, 8, 252, 148, 103, 229, 102, 151, 45, 213, 127, 90, 200, 122, 44, 44, 133, 123, 85, 211, 199, 208, 98,
-    108, 169, 239, 11, 79, 14, 249, 62, 166, 174, 93, 250, 132, 28, 23, 216, 168, 100, 88, 117, 105, 248, 202, 166, 72,
-    166, 49, 31, 22, 30, 161, 173, 171, 152, 95, 58, 184, 28, 186, 246, 128, 51, 250, 201, 119, 184, 121, 36, 48, 115,
-    91, 75, 210, 58, 126, 96, 65, 21, 172, 52, 61, 92, 210, 85, 151, 232, 193, 201, 75, 216, 210, 129, 86, 115, 198,
-    233, 102, 205, 69, 120, 158, 139, 33, 64, 91, 28, 61, 10, 4, 50, 65, 110, 57, 15, 104, 234, 6, 44, 109, 140, 117,
-    99, 221, 254, 220, 2, 212, 61, 75, 163, 103, 150, 122, 193, 239, 118, 225, 98, 122, 16, 151, 103, 141, 154, 104, 71,
-    97, 59, 66, 76, 121, 200, 168, 210, 244, 92, 246, 214, 219, 96, 160, 230, 161, 215, 20, 205, 89, 64, 32, 202, 175,
-    255, 159, 149, 163, 59, 101, 188, 81, 241, 24, 236, 206, 153, 55, 104, 253, 110, 97, 247, 80, 143, 93, 118, 136,
-    146, 98, 137, 182, 36, 250, 36, 199, 186, 142, 86, 38, 86, 117, 73, 50, 30, 83, 176, 144, 169, 175, 49, 142, 15,
-    161, 188, 91, 13, 82, 13, 147, 176, 189, 76, 134, 24, 75, 141, 63, 59, 135, 22, 178, 253, 153, 219, 39, 116, 50,
-    132, 133, 43, 128, 60, 69, 84, 252, 123, 186, 247, 142, 185, 76, 64, 101, 70, 65, 79, 173, 36, 91, 251, 184, 70,
-    114, 39, 255, 17, 55, 107, 92, 34, 118, 53, 210, 153, 247, 21, 213, 89, 214, 12, 50, 124, 23, 164, 127, 118, 82,
-    125, 20, 123, 177, 235, 233, 234, 191, 69, 85, 187, 169, 133, 80, 88, 230, 129, 237, 168, 115, 150, 208, 148, 224,
-    7, 10, 228, 1, 36, 219, 166, 148, 192, 169, 195, 101, 26, 205, 33, 123, 22, 15, 123, 139, 233, 118, 84, 42, 154, 23,
-    1, 105, 141, 84, 172, 146, 126, 165, 137, 98, 141, 181, 71, 51, 148, 39, 219, 241, 89, 255, 88, 72, 132, 31, 64,
-    109, 78, 124, 163, 75, 175, 68, 214, 8, 146, 73, 71, 202, 98, 40, 214, 233, 84, 19, 58, 181, 226, 237, 128, 134, 95,
-    228, 36, 42, 47, 18, 35, 138, 232, 51, 141, 23, 65, 41, 131, 51, 82, 112, 38, 254, 221, 83, 6, 106, 91, 226, 192,
-    82, 129, 168, 172, 242, 210, 13, 84, 134, 125, 24, 85, 101, 226, 111, 96, 16, 89, 96, 242, 210, 77, 3, 171, 116,
-    251, 86, 117, 218, 97, 100, 127, 230, 88, 87, 76, 199, 171, 240, 169, 46, 150, 221, 83, 104, 48, 189, 92, 147, 123,
-    119, 31, 74, 26, 242, 223, 225, 143, 41, 82, 217, 59, 165, 230, 174, 200, 206, 64, 34, 191, 187, 253, 168, 9, 197,
-    54, 145, 115, 104, 162, 242, 235, 14, 216, 41, 171, 167, 46, 172, 2, 236, 70, 209, 211, 26, 163, 243, 70, 137, 224,
-    84, 193, 100, 25, 149, 239, 25, 26, 76, 91, 132, 248, 141, 26, 238, 76, 199, 212, 172, 0, 38, 195, 212, 229, 87,
-    203, 94, 67, 51, 79, 121, 76, 126, 15, 38, 154, 156, 82, 139, 240, 244, 78, 17, 209, 194, 63, 36, 91, 58, 78, 230,
-    2, 224, 27, 59, 163, 102, 127, 30, 86, 215, 188, 51, 33, 202, 22, 94, 145, 167, 47, 183, 177, 168, 225, 76, 183,
-    133, 155, 240, 57, 205, 52, 23, 92, 227, 217, 6, 37, 137, 229, 211, 226, 120, 129, 223, 254, 217, 53, 165, 6, 116,
-    218, 235, 140, 51, 232, 214, 36, 62, 216, 115, 21, 110, 182, 44, 136, 23, 240, 155, 85, 179, 243, 53, 205, 3, 101,
-    148, 211, 145, 196, 234, 200, 3, 48, 95, 91, 250, 161, 51, 1, 134, 2, 186, 170, 235, 4, 180, 249, 10, 201, 242, 230,
-    248, 50, 244, 114, 147, 30, 111, 4, 197, 208, 1, 248, 59, 4, 157, 187, 54, 147, 237, 131, 207, 219, 153, 20, 59,
-    115, 194, 98, 101, 33, 244, 201, 228, 220, 72, 196, 243, 74, 18, 181, 177, 53, 156, 251, 23, 145, 246, 134, 60, 104,
-    173, 166, 45, 8, 253, 43, 28, 87, 240, 191, 206, 137, 230, 253, 181, 226, 211, 103, 171, 180, 179, 170, 115, 225,
-    213, 163, 0, 120, 192, 238, 38, 95, 187, 67, 236, 163, 196, 248, 31, 109, 149, 216, 19, 226, 225, 21, 195, 90, 40,
-    222, 252, 77, 130, 190, 56, 195, 177, 120, 93, 84, 213, 120, 62, 235, 121, 119, 39, 61, 202, 214, 255, 156, 199, 56,
-    127, 203, 237, 163, 155, 171, 190, 81, 123, 59, 193, 112, 188, 201, 83, 104, 94, 114, 2, 122, 71, 65, 118, 121, 92,
-    0, 199, 177, 32, 77, 53, 31, 246, 169, 236, 117, 103, 95, 13, 239, 164, 184, 129, 205, 166, 33, 146, 169, 222, 179,
-    106, 213, 36, 94, 170, 18, 76, 24, 175, 245, 70, 37, 249, 91, 83, 46, 241, 178, 190, 47, 209, 31, 229, 194, 72, 173,
-    189, 217, 166, 124, 157, 175, 246, 88, 158, 44, 243, 194, 5, 191, 13, 9, 13, 215, 193, 53, 43, 5, 174, 188, 187, 92,
-    169, 210, 51, 60, 30, 177, 170, 109, 80, 106, 155, 201, 108, 45, 170, 225, 181, 149, 137, 243, 55, 42, 137, 127,
-    182, 45, 73, 26, 120, 181, 89, 114, 8, 136, 18, 196, 138, 80, 100, 138, 102, 77, 245, 177, 161, 33, 42, 45, 253, 97,
-    57, 155, 241, 142, 115, 133, 24, 237, 213, 43, 55, 148, 232, 110, 208, 177, 93, 23, 201, 232, 176, 170, 39, 171,
-    232, 235, 44, 21, 41, 92, 234, 168, 5, 65, 202, 33, 99, 100, 207, 253, 95, 109, 113, 233, 207, 187, 205, 187, 53,
-    61, 227, 49, 36, 64, 155, 124, 168, 187, 97, 230, 101, 250, 114, 28, 224, 239, 27, 29, 228, 97, 230, 193, 171, 152,
-    104, 231, 201, 201, 46, 3, 248, 153, 47, 38, 10, 74, 37, 110, 108, 79, 192, 36, 232, 110, 127, 229, 172, 190, 43,
-    52, 26, 236, 173, 88, 79, 188, 220, 190, 129, 122, 163, 61, 95, 173, 40, 49, 71, 53, 178, 32, 142, 109, 26, 238, 56,
-    100, 104, 240, 207, 239, 96, 28, 30, 251, 104, 219, 140, 96, 142, 47, 202, 48, 248, 174, 0, 91, 190, 144, 242, 61,
-    119, 245, 200, 238, 222, 139, 71, 14, 75, 173, 35, 171, 247, 81, 31, 126, 171, 137, 249, 18, 53, 59, 65, 144, 152,
-    72, 34, 102, 155, 146, 139, 220, 175, 184, 241, 242, 149, 136, 170, 96, 62, 57, 19, 46, 156, 133, 20, 254, 14, 132,
-    246, 16, 119, 192, 149, 63, 177, 66, 133, 191, 164, 87, 113, 140, 217, 248, 254, 159, 154, 214, 3, 162, 202, 130,
-    180, 165, 191, 238, 234, 159, 122, 210, 71, 115, 196, 85, 239, 238, 171, 8, 12, 223, 18, 67, 39, 71, 236, 236, 248,
-    208, 28, 73, 28, 131, 110, 254, 53, 59, 214, 65, 200, 115, 177, 37, 64, 8, 227, 71, 187, 73, 228, 157, 252, 96, 2,
-    76, 12, 244, 5, 114, 49, 241, 237, 133, 186, 158, 11, 116, 123, 213, 20, 108, 49, 103, 140, 124, 41, 107, 217, 199,
-    148, 63, 18, 239, 57, 240, 139, 32, 135, 170, 218, 231, 183, 120, 37, 114, 1, 76, 77, 180, 171, 235, 19, 179, 41,
-    149, 33, 24, 216, 176, 21, 1, 26, 111, 0, 46, 202, 199, 8, 211, 3, 140, 166, 22, 230, 193, 171, 228, 108, 224, 140,
-    237, 37, 35, 252, 152, 180, 206, 85, 49, 50, 72, 114, 118, 37, 236, 138, 80, 94, 77, 130, 197, 180, 15, 1, 149, 249,
-    66, 27, 37, 165, 142, 2, 28, 252, 224, 23, 226, 204, 24, 231, 234, 67, 186, 80, 64, 133, 240, 255, 49, 222, 136,
-    230, 197, 190, 39, 19, 113, 98, 17, 54, 223, 71, 105, 215, 244, 151, 229, 15, 51, 219, 133, 242, 195, 84, 190, 225,
-    51, 5, 55, 245, 176, 26, 241, 152, 52, 201, 220, 18, 202, 196, 158, 41, 149, 67, 233, 244, 31, 163, 146, 202, 146,
-    80, 191, 215, 95, 183, 234, 74, 16, 2, 8, 77, 72, 20, 20, 186, 125, 66, 62, 5, 129, 88, 161, 171, 120, 186, 107, 21,
-    170, 83, 37, 160, 71, 242, 42, 49, 19, 26, 21, 131, 73, 81, 176, 118, 238, 200, 65, 184, 238, 22, 169, 61, 6, 48,
-    141, 251, 241, 149, 221, 234, 12, 185, 99, 245, 233, 16, 42, 11, 38, 91, 206, 168, 54, 235, 203, 242, 253, 72, 8,
-    118, 164, 59, 218, 151, 90, 45, 91, 249, 155, 129, 145, 14, 48, 48, 238, 155, 55, 65, 236, 16, 168, 187, 75, 47, 27,
-    188, 38, 74, 151, 100, 181, 129, 59, 219, 61, 2, 229, 136, 131, 24, 232, 234, 132, 231, 21, 207, 249, 68, 208, 239,
-    164, 216, 3, 80, 92, 79, 142, 8, 139, 233, 79, 41, 181, 66, 135, 134, 194, 152, 67, 95, 212, 127, 108, 212, 189, 82,
-    51, 252, 24, 225, 184, 155, 56, 49, 97, 126, 222, 160, 129, 2, 189, 71, 33, 211, 3, 219, 248, 229, 51, 255, 15, 15,
-    36, 219, 20, 194, 1, 180, 255, 79, 195, 101, 230, 164, 152, 223, 147, 194, 185, 185, 182, 157, 203, 7, 139, 237, 73,
-    180, 31, 65, 26, 120, 252, 69, 237, 43, 125, 24, 83, 49, 187, 188, 226, 62, 215, 180, 39, 95, 225, 103, 56, 241,
-    121, 84, 66, 108, 74, 83, 231, 214, 97, 110, 184, 102, 248, 234, 68, 51, 39, 164, 197, 42, 190, 242, 244, 205, 150,
-    161, 45, 174, 71, 89, 214, 64, 2, 108, 66, 7, 0, 183, 4, 18, 240, 111, 139, 135, 11, 180, 186, 18, 202, 113, 100,
-    254, 235, 33, 6, 66, 141, 173, 154, 99, 77, 30, 199, 133, 54, 211, 185, 139, 44, 48, 82, 97, 93, 130, 234, 71, 185,
-    107, 139, 66, 173, 211, 199, 200, 18, 68, 42, 81, 87, 73, 55, 146, 51, 231, 79, 75, 188, 138, 134, 43, 136, 129, 85,
-    10, 164, 164, 7, 140, 230, 238, 40, 9, 117, 150, 97, 14, 251, 181, 160, 74, 59, 183, 76, 22, 27, 153, 64, 218, 67,
-    74, 46, 10, 25, 201, 76, 39, 232, 3, 215, 206, 60, 140, 199, 164, 147, 105, 17, 26, 146, 182, 98, 56, 209, 200, 52,
-    237, 243, 210, 32, 106, 78, 34, 129, 10, 170, 243, 123, 215, 167, 244, 132, 22, 24, 49, 228, 233, 5, 53, 54, 152,
-    233, 170, 2, 187, 156, 214, 97, 40, 105, 13, 109, 58, 247, 27, 171, 195, 151, 54, 136, 16, 96, 251, 66, 76, 119,
-    134, 231, 128, 116, 173, 192, 69, 13, 248, 116, 73, 99, 196, 19, 103, 10, 154, 182, 48, 161, 162, 12, 92, 221, 168,
-    249, 139, 13, 188, 3, 68, 145, 32, 183, 100, 25, 27, 92, 96, 10, 179, 208, 113, 14, 108, 101, 13, 91, 8, 8, 252, 27,
-    65, 241, 105, 0, 245, 82, 62, 208, 52, 98, 131, 216, 186, 168, 31, 47, 123, 174, 173, 197, 22, 89, 101, 98, 133, 67,
-    149, 128, 226, 127, 117, 154, 55, 189, 172, 21, 39, 254, 74, 73, 27, 17, 210, 247, 134, 150, 27, 233, 109, 111, 218,
-    13, 116, 167, 210, 204, 27, 89, 83, 67, 43, 179, 207, 32, 227, 171, 122, 64, 53, 177, 13, 92, 80, 181, 140, 208, 33,
-    58, 243, 5, 45, 186, 154, 12, 208, 124, 105, 121, 146, 28, 225, 64, 87, 219, 136, 35, 219, 71, 219, 152, 101, 136,
-    70, 245, 93, 141, 94, 17, 159, 218, 251, 255, 174, 217, 118, 171, 66, 34, 80, 179, 112, 247, 102, 154, 36, 144, 77,
-    16, 202, 123, 188, 152, 208, 93, 132, 168, 6, 231, 78, 49, 36, 64, 239, 109, 153, 24, 185, 175, 251, 148, 61, 179,
-    69, 51, 63, 195, 228, 152, 192, 139, 18, 191, 104, 133, 158, 1, 32, 180, 72, 100, 226, 67, 36, 3, 25, 240, 61, 142,
-    64, 217, 32, 204, 180, 35, 65, 83, 168, 129, 188, 241, 59, 5, 126, 184, 109, 140, 93, 66, 56, 176, 174, 55, 235, 28,
-    98, 241, 221, 225, 221, 223, 151, 86, 122, 19, 220, 87, 152, 246, 157, 98, 195, 19, 28, 171, 28, 69, 30, 249, 96,
-    137, 173, 170, 4, 212, 234, 228, 56, 121, 2, 119, 9, 143, 214, 46, 179, 179, 147, 167, 96, 72, 69, 102, 87, 130, 86,
-    221, 178, 67, 221, 221, 215, 122, 215, 34, 239, 107, 4, 108, 30, 144, 15, 96, 226, 47, 252, 193, 70, 47, 9, 28, 244,
-    163, 217, 184, 198, 2, 14, 141, 20, 246, 97, 222, 214, 225, 32, 71, 66, 100, 245, 41, 180, 238, 208, 21, 21, 47,
-    217, 28, 95, 114, 213, 67, 255, 171, 220, 187, 62, 196, 204, 194, 241, 151, 140, 161, 7, 7, 254, 148, 8, 124, 240,
-    97, 72, 139, 136, 10, 101, 45, 187, 226, 210, 134, 18, 19, 194, 198, 136, 155, 35, 140, 123, 60, 238, 4, 116, 20,
-    132, 7, 216, 78, 226, 237, 199, 202, 24, 191, 169, 158, 152, 110, 158, 27, 209, 217, 98, 31, 214, 0, 60, 97, 196,
-    92, 239, 103, 139, 131, 61, 200, 237, 13, 121, 232, 58, 115, 236, 117, 5, 161, 191, 203, 18, 87, 3, 65, 197, 130,
-    57, 56, 198, 102, 34, 36, 165, 50, 217, 63, 98, 95, 116, 25, 141, 126, 106, 105, 220, 84, 3, 121, 37, 222, 39, 203,
-    45, 125, 160, 143, 125, 23, 148, 198, 96, 83, 227, 144, 158, 245, 24, 104, 153, 34, 90, 253, 229, 95, 253, 136, 230,
-    171, 227, 129, 249, 19, 215, 176, 180, 84, 166, 64, 138, 151, 42, 121, 249, 190, 7, 241, 164, 91, 224, 81, 36, 9,
-    166, 238, 168, 33, 243, 136, 241, 168, 167, 92, 148, 60, 151, 53, 46, 199, 184, 217, 221, 58, 249, 189, 237, 52,
-    253, 202, 60, 67, 59, 143, 229, 74, 122, 255, 218, 101, 185, 70, 150, 83, 99, 202, 157, 5, 20, 76, 254, 221, 127,
-    207, 19, 136, 133, 61, 29, 172, 204, 4, 142, 33, 53, 67, 39, 141, 99, 102, 31, 16, 55, 254, 155, 155, 168, 52, 127,
-    94, 166, 239, 135, 252, 74, 84, 162, 29, 212, 253, 159, 118, 14, 206, 144, 8, 226, 21, 98, 154, 219, 106, 50, 138,
-    121, 121, 201, 148, 58, 42, 244, 132, 38, 187, 217, 163, 13, 6, 188, 148, 59, 58, 235, 45, 74, 151, 161, 26, 161,
-    88, 157, 22, 251, 29, 109, 45, 185, 80, 148, 25, 222, 74, 6, 31, 91, 211, 24, 192, 119, 0, 4, 112, 50, 75, 111, 201,
-    136, 46, 226, 231, 64, 126, 112, 117, 190, 132, 51, 139, 9, 239, 233, 102, 32, 193, 152, 243, 172, 120, 160, 32,
-    251, 254, 198, 83, 252, 171, 96, 79, 231, 251, 99, 206, 5, 61, 136, 61, 78, 134, 80, 102, 39, 254, 209, 3, 218, 173,
-    157, 234, 22, 247, 50, 101, 176, 191, 91, 33, 112, 83, 73, 107, 85, 189, 42, 105, 99, 74, 223, 48, 112, 76, 177, 48,
-    211, 119, 203, 53, 44, 216, 26, 69, 207, 228, 97, 35, 111, 43, 178, 84, 188, 56, 253, 162, 135, 102, 136, 191, 57,
-    4, 212, 165, 178, 208, 189, 113, 121, 176, 4, 141, 75, 190, 22, 202, 112, 173, 251, 181, 183, 81, 172, 28, 76, 17,
-    224, 246, 150, 70, 188, 64, 79, 58, 166, 84, 202, 94, 75, 72, 178, 81, 176, 64, 168, 73, 201, 111, 103, 250, 58,
-    133, 159, 112, 112, 36, 26, 6, 165, 191, 144, 46, 228, 140, 62, 86, 47, 157, 108, 22, 107, 134, 168, 236, 99, 29,
-    15, 186, 145, 88, 25, 201, 13, 139, 10, 128, 133, 78, 229, 229, 127, 161, 246, 9, 141, 84, 147, 38, 77, 138, 101,
-    54, 129, 75, 8, 247, 17, 230, 47, 115, 133, 163, 21, 202, 121, 133, 97, 177, 241, 244, 166, 29, 234, 166, 68, 18,
-    139, 155, 30, 1, 107, 171, 253, 84, 124, 178, 105, 168, 27, 79, 150, 74, 71, 98, 182, 255, 221, 165, 55, 124, 149,
-    77, 55, 17, 169, 145, 63, 61, 180, 231, 160, 1, 39, 131, 30, 8, 234, 173, 216, 241, 59, 18, 51, 40, 19, 76, 132,
-    186, 154, 238, 57, 70, 146, 123, 193, 15, 196, 65, 142, 31, 195, 77, 135, 63, 180, 89, 43, 190, 168, 227, 142, 118,
-    201, 221, 228, 228, 162, 35, 49, 135, 54, 6, 189, 148, 245, 243, 202, 219, 29, 104, 5, 186, 243, 175, 134, 213, 19,
-    172, 98, 2, 50, 43, 95, 103, 140, 58, 67, 115, 238, 122, 145, 152, 242, 75, 232, 2, 241, 98, 225, 95, 153, 80, 199,
-    97, 103, 39, 170, 105, 190, 201, 78, 153, 173, 67, 210, 89, 139, 227, 229, 215, 182, 219, 44, 175, 173, 131, 158,
-    189, 85, 170, 80, 169, 221, 148, 105, 8, 180, 219, 62, 24, 130, 189, 212, 3, 16, 236, 210, 226, 49, 189, 90, 19, 52,
-    57, 202, 65, 190, 15, 92, 87, 172, 118, 50, 119, 178, 30, 132, 246, 86, 223, 225, 67, 180, 145, 114, 132, 130, 33,
-    71, 111, 226, 93, 57, 19, 158, 65, 120, 42, 189, 11, 172, 135, 189, 80, 38, 18, 28, 70, 157, 130, 117, 122, 151,
-    163, 149, 228, 178, 1, 8, 144, 138, 110, 108, 51, 147, 185, 234, 157, 122, 41, 59, 181, 112, 45, 19, 85, 128, 157,
-    181, 208, 11, 40, 39, 65, 190, 7, 45, 186, 160, 104, 122, 236, 193, 193, 117, 139, 4, 83, 16, 50, 224, 102, 202, 20,
-    218, 214, 144, 156, 36, 190, 41, 232, 145, 120, 249, 84, 134, 142, 33, 208, 234, 195, 51, 254, 226, 173, 151, 139,
-    141, 120, 189, 9, 75, 84, 195, 183, 106, 38, 70, 171, 162, 249, 59, 136, 172, 172, 47, 15, 209, 244, 157, 116, 84,
-    70, 117, 225, 36, 206, 79, 119, 69, 200, 113, 116, 120, 149, 90, 174, 78, 86, 26, 9, 32, 175, 86, 148, 147, 90, 85,
-    102, 196, 5, 234, 225, 106, 171, 84, 33, 130, 42, 187, 96, 164, 193, 126, 130, 208, 146, 105, 118, 233, 120, 82, 78,
-    0, 193, 4, 236, 7, 30, 193, 153, 178, 94, 135, 102, 227, 32, 164, 198, 41, 194, 242, 44, 228, 182, 205, 113, 187,
-    252, 32, 161, 49, 127, 37, 202, 107, 110, 102, 135, 94, 19, 3, 232, 209, 135, 251, 21, 27, 165, 55, 200, 188, 101,
-    44, 193, 237, 68, 68, 157, 248, 7, 196, 143, 251, 41, 214, 229, 173, 19, 29, 102, 174, 54, 111, 147, 50, 83, 234,
-    103, 30, 189, 10, 194, 6, 40, 123, 14, 74, 144, 238, 9, 30, 23, 191, 188, 3, 94, 35, 60, 226, 18, 62, 174, 222, 40,
-    101, 3, 26, 105, 116, 122, 188, 27, 182, 184, 30, 65, 149, 105, 148, 107, 39, 245, 133, 171, 103, 94, 146, 42, 93,
-    239, 103, 115, 10, 46, 135, 50, 204, 178, 175, 104, 226, 140, 65, 110, 106, 108, 134, 176, 51, 134, 226, 218, 137,
-    222, 180, 211, 180, 5, 113, 49, 234, 130, 230, 174, 70, 72, 199, 6, 136, 141, 70, 120, 239, 19, 254, 249, 34, 175,
-    76, 218, 123, 138, 110, 206, 106, 53, 94, 239, 35, 90, 65, 94, 147, 61, 94, 186, 102, 255, 162, 241, 84, 191, 190,
-    175, 250, 169, 4, 111, 247, 89, 154, 232, 121, 187, 170, 92, 141, 158, 205, 30, 27, 130, 115, 198, 83, 129, 1, 99,
-    195, 135, 74, 128, 46, 31, 107, 203, 159, 140, 147, 195, 195, 206, 80, 14, 157, 159, 6, 12, 222, 84, 179, 143, 41,
-    224, 241, 220, 130, 113, 246, 225, 194, 62, 177, 154, 91, 125, 72, 78, 184, 76, 227, 76, 177, 144, 57, 141, 29, 121,
-    82, 189, 230, 169, 226, 140, 59, 212, 169, 50, 249, 44, 77, 234, 107, 105, 83, 237, 206, 159, 8, 249, 131, 178, 61,
-    111, 246, 179, 244, 20, 199, 35, 164, 86, 92, 132, 43, 209, 95, 169, 131, 254, 229, 27, 125, 14, 105, 56, 145, 222,
-    235, 63, 105, 76, 56, 67, 44, 230, 63, 176, 127, 252, 189, 223, 194, 48, 110, 176, 95, 212, 254, 177, 55, 97, 9, 80,
-    17, 222, 190, 80, 221, 81, 63, 250, 167, 169, 200, 137, 58, 105, 249, 71, 94, 1, 10, 119, 37, 20, 53, 144, 178, 58,
-    150, 169, 30, 229, 84, 136, 179, 84, 138, 74, 13, 26, 0, 226, 231, 153, 218, 200, 108, 166, 27, 211, 249, 119, 220,
-    168, 248, 115, 184, 109, 83, 219, 26, 157, 192, 147, 32, 196, 156, 161, 50, 30, 83, 179, 12, 41, 197, 87, 211, 222,
-    87, 24, 58, 212, 160, 158, 145, 28, 104, 114, 157, 8, 22, 255, 47, 90, 59, 84, 200, 211, 48, 55, 19, 142, 55, 235,
-    188, 200, 220, 238, 148, 91, 90, 34, 214, 154, 43, 34, 81, 163, 228, 251, 118, 79, 50, 248, 55, 250, 166, 199, 41,
-    22, 212, 204, 92, 168, 212, 81, 24, 172, 35, 230, 49, 245, 167, 218, 207, 23, 190, 59, 2, 220, 22, 227, 179, 224,
-    47, 113, 118, 177, 201, 236, 116, 1, 100, 93, 204, 12, 90, 20, 97, 149, 134, 155, 195, 41, 171, 239, 230, 93, 88,
-    166, 135, 115, 59, 68, 185, 192, 183, 81, 176, 37, 108, 60, 85, 71, 84, 133, 146, 71, 209, 227, 146, 254, 25, 240,
-    244, 143, 3, 81, 125, 39, 36, 147, 193, 6, 86, 10, 142, 61, 133, 91, 166, 57, 209, 132, 158, 250, 51, 226, 178, 141,
-    111, 144, 228, 117, 81, 50, 3, 115, 144, 38, 185, 200, 143, 84, 229, 198, 124, 60, 54, 30, 171, 238, 77, 142, 102,
-    158, 234, 33, 41, 229, 208, 251, 158, 103, 75, 55, 149, 183, 107, 222, 120, 248, 212, 157, 190, 14, 195, 229, 231,
-    213, 50, 250, 56, 128, 35, 71, 87, 251, 243, 148, 118, 143, 147, 231, 6, 117, 138, 72, 64, 39, 8, 40, 249, 81, 203,
-    251, 65, 186, 2, 73, 247, 187, 247, 42, 232, 90, 107, 135, 172, 55, 7, 192, 108, 91, 222, 42, 69, 145, 190, 173, 74,
-    124, 19, 15, 8, 10, 93, 202, 75, 2, 95, 168, 78, 6, 137, 115, 24, 172, 22, 222, 2, 6, 223, 224, 223, 237, 202, 24,
-    223, 199, 148, 4, 98, 51, 152, 8, 55, 36, 23, 106, 227, 33, 117, 60, 54, 168, 159, 158, 228, 103, 228, 56, 153, 119,
-    22, 48, 202, 139, 61, 93, 172, 191, 95, 168, 124, 135, 43, 56, 62, 103, 182, 178, 202, 26, 215, 68, 126, 183, 182,
-    70, 102, 117, 49, 195, 102, 102, 203, 158, 32, 96, 25, 160, 25, 244, 135, 36, 69, 229, 114, 195, 19, 251, 191, 85,
-    32, 160, 47, 91, 99, 179, 51, 190, 33, 190, 25, 240, 234, 214, 74, 92, 80, 230, 146, 12, 106, 116, 231, 188, 19, 99,
-    178, 132, 109, 130, 240, 43, 173, 99, 100, 72, 240, 179, 243, 62, 115, 54, 76, 61, 55, 223, 216, 2, 229, 172, 115,
-    240, 146, 229, 33, 81, 220, 88, 156, 34, 177, 206, 219, 215, 44, 86, 85, 6, 86, 156, 184, 31, 193, 116, 162, 233,
-    175, 211, 8, 176, 177, 225, 17, 113, 10, 90, 13, 232, 70, 166, 135, 137, 235, 252, 142, 143, 116, 47, 203, 155, 142,
-    65, 9, 234, 130, 121, 146, 91, 86, 215, 210, 152, 144, 133, 236, 102, 116, 17, 151, 47, 255, 220, 199, 27, 119, 172,
-    51, 16, 55, 86, 197, 138, 166, 175, 86, 242, 91, 186, 18, 180, 98, 153, 0, 121, 160, 128, 194, 193, 172, 107, 163,
-    216, 183, 195, 55, 71, 144, 185, 77, 153, 4, 134, 174, 75, 254, 227, 142, 209, 58, 114, 33, 12, 101, 165, 176, 151,
-    14, 55, 194, 77, 54, 146, 226, 165, 232, 34, 179, 194, 230, 252, 178, 100, 74, 209, 24, 191, 13, 115, 92, 212, 37,
-    29, 71, 48, 178, 211, 105, 195, 129, 103, 160, 11, 140, 121, 60, 131, 255, 138, 134, 41, 62, 106, 246, 141, 167,
-    162, 94, 121, 145, 168, 196, 236, 153, 182, 205, 200, 84, 103, 213, 197, 100, 252, 19, 73, 137, 79, 101, 116, 86,
-    255, 139, 0, 62, 120, 99, 47, 132, 37, 43, 234, 91, 218, 74, 19, 17, 214, 180, 88, 204, 36, 227, 155, 34, 89, 255,
-    218, 115, 220, 238, 197, 1, 226, 145, 12, 171, 251, 182, 56, 23, 77, 217, 19, 204, 52, 124, 109, 103, 58, 209, 245,
-    193, 227, 213, 236, 92, 25, 215, 98, 228, 253, 238, 13, 15, 99, 110, 212, 132, 59, 105, 11, 173, 157, 44, 59, 8, 7,
-    152, 30, 11, 180, 178, 151, 24, 176, 66, 53, 249, 57, 104, 21, 250, 174, 248, 32, 100, 165, 29, 80, 27, 26, 186,
-    248, 63, 206, 119, 186, 182, 182, 147, 230, 184, 85, 20, 172, 208, 126, 201, 51, 85, 79, 31, 171, 26, 132, 125, 232,
-    76, 117, 51, 21, 196, 254, 234, 0, 198, 18, 87, 143, 127, 185, 118, 90, 252, 141, 197, 181, 47, 254, 49, 66, 200,
-    24, 125, 233, 247, 162, 227, 80, 15, 193, 109, 32, 124, 138, 239, 66, 234, 136, 69, 211, 112, 123, 188, 252, 218,
-    243, 2, 130, 48, 106, 18, 116, 244, 228, 205, 83, 108, 241, 115, 23, 86, 31, 97, 180, 136, 169, 97, 55, 100, 109,
-    34, 232, 165, 110, 232, 126, 81, 93, 1, 227, 239, 225, 143, 127, 30, 25, 54, 92, 30, 38, 113, 151, 202, 124, 93,
-    218, 108, 254, 137, 106, 130, 245, 50, 206, 145, 244, 21, 72, 120, 103, 252, 152, 2, 9, 8, 21, 163, 189, 192, 159,
-    171, 196, 53, 227, 215, 113, 247, 214, 209, 116, 199, 121, 145, 124, 72, 40, 110, 145, 81, 171, 191, 231, 75, 213,
-    205, 47, 22, 22, 147, 146, 197, 146, 138, 13, 154, 83, 218, 185, 203, 113, 227, 69, 116, 180, 12, 255, 170, 167,
-    132, 255, 31, 238, 159, 255, 111, 127, 180, 59, 125, 166, 21, 105, 196, 90, 105, 186, 221, 48, 206, 232, 204, 212,
-    229, 240, 163, 158, 7, 133, 190, 231, 56, 52, 253, 4, 149, 108, 97, 22, 251, 105, 78, 106, 50, 104, 50, 224, 169,
-    204, 251, 131, 151, 117, 220, 91, 155, 169, 38, 211, 195, 215, 218, 241, 86, 49, 48, 190, 169, 179, 41, 190, 31, 43,
-    247, 147, 161, 140, 146, 44, 180, 176, 253, 228, 232, 209, 145, 221, 234, 186, 209, 20, 188, 246, 118, 44, 236, 246,
-    233, 43, 124, 42, 44, 238, 150, 204, 50, 149, 7, 121, 221, 186, 236, 54, 41, 142, 152, 33, 54, 71, 212, 33, 164,
-    179, 130, 8, 102, 37, 218, 192, 37, 162, 192, 107, 144, 249, 6, 14, 37, 54, 167, 255, 33, 216, 144, 93, 185, 210,
-    134, 152, 115, 52, 227, 224, 50, 85, 208, 213, 205, 22, 197, 63, 95, 85, 221, 96, 140, 149, 48, 92, 149, 47, 47,
-    251, 120, 58, 110, 16, 55, 125, 202, 175, 248, 49, 81, 32, 28, 114, 41, 99, 236, 245, 232, 118, 232, 254, 148, 108,
-    24, 125, 173, 202, 90, 110, 81, 149, 235, 55, 148, 213, 241, 147, 250, 247, 249, 19, 167, 106, 147, 89, 149, 213,
-    171, 166, 217, 247, 72, 169, 21, 193, 39, 95, 60, 161, 178, 17, 99, 56, 228, 216, 189, 57, 230, 208, 117, 133, 114,
-    228, 49, 144, 69, 45, 169, 245, 32, 195, 154, 162, 124, 195, 183, 9, 141, 182, 19, 178, 102, 153, 37, 93, 52, 134,
-    109, 22, 128, 50, 188, 17, 28, 134, 131, 193, 33, 110, 144, 159, 253, 210, 97, 222, 56, 59, 39, 208, 243, 127, 155,
-    177, 192, 146, 189, 32, 27, 18, 24, 29, 107, 170, 146, 122, 96, 3, 107, 209, 177, 32, 172, 191, 173, 26, 221, 12, 6,
-    26, 8, 246, 151, 35, 108, 88, 34, 105, 186, 32, 188, 21, 133, 233, 156, 144, 23, 154, 14, 90, 189, 219, 222, 225,
-    178, 125, 190, 17, 16, 158, 23, 216, 138, 146, 127, 180, 224, 83, 154, 103, 60, 14, 128, 38, 6, 58, 57, 111, 146,
-    239, 170, 11, 110, 45, 28, 218, 229, 42, 148, 77, 156, 25, 42, 65, 100, 28, 207, 188, 209, 97, 5, 61, 254, 235, 170,
-    89, 89, 218, 167, 235, 80, 83, 196, 237, 160, 224, 109, 120, 12, 16, 250, 1, 98, 194, 177, 181, 207, 51, 164, 141,
-    165, 159, 44, 244, 14, 182, 25, 161, 82, 137, 83, 1, 28, 28, 50, 52, 177, 166, 4, 239, 222, 149, 31, 51, 226, 98,
-    83, 195, 74, 108, 200, 2, 178, 233, 196, 61, 48, 21, 197, 151, 180, 121, 3, 96, 228, 184, 63, 202, 106, 137, 71, 23,
-    23, 111, 206, 4, 33, 65, 169, 158, 143, 43, 146, 100, 90, 195, 238, 225, 20, 254, 8, 17, 45, 139, 90, 11, 20, 181,
-    95, 199, 141, 50, 138, 111, 80, 79, 114, 49, 191, 24, 57, 55, 53, 204, 169, 175, 158, 244, 124, 175, 193, 108, 162,
-    206, 20, 86, 128, 62, 131, 99, 230, 183, 32, 151, 165, 146, 45, 217, 66, 228, 17, 182, 124, 106, 226, 108, 117, 38,
-    223, 102, 192, 42, 86, 52, 107, 132, 116, 105, 16, 239, 4, 25, 46, 138, 128, 57, 219, 126, 136, 55, 147, 87, 100,
-    119, 207, 238, 156, 2, 208, 164, 85, 226, 21, 115, 73, 182, 136, 25, 188, 14, 57, 190, 38, 21, 38, 184, 195, 246,
-    199, 158, 88, 154, 148, 51, 42, 205, 35, 152, 110, 220, 81, 42, 200, 98, 62, 226, 239, 41, 162, 88, 196, 101, 243,
-    233, 148, 133, 181, 119, 218, 169, 179, 81, 163, 196, 3, 83, 240, 161, 91, 251, 46, 241, 251, 105, 132, 188, 145,
-    66, 34, 29, 91, 46, 236, 98, 80, 114, 131, 79, 251, 141, 184, 106, 138, 172, 191, 104, 127, 231, 185, 159, 107, 15,
-    73, 139, 51, 109, 164, 101, 6, 229, 158, 252, 61, 28, 57, 62, 193, 123, 119, 254, 224, 152, 2, 85, 155, 241, 51,
-    195, 109, 60, 145, 54, 140, 217, 125, 125, 47, 96, 12, 80, 239, 15, 170, 231, 202, 33, 62, 55, 88, 237, 60, 81, 184,
-    18, 234, 236, 126, 242, 38, 131, 247, 211, 191, 197, 38, 244, 130, 169, 143, 48, 27, 72, 139, 86, 237, 69, 184, 27,
-    36, 240, 118, 51, 2, 200, 116, 191, 0, 139, 15, 217, 190, 105, 59, 228, 123, 88, 2, 117, 220, 232, 172, 210, 240,
-    71, 213, 13, 99, 99, 56, 120, 199, 4, 218, 250, 95, 168, 145, 162, 118, 1, 126, 248, 191, 207, 176, 59, 82, 101, 28,
-    235, 10, 32, 234, 87, 132, 172, 92, 62, 117, 29, 234, 197, 75, 242, 196, 5, 167, 45, 222, 209, 250, 74, 48, 42, 253,
-    150, 130, 137, 36, 146, 68, 167, 160, 99, 232, 67, 150, 213, 139, 166, 63, 61, 208, 70, 171, 64, 160, 21, 77, 129,
-    241, 92, 92, 40, 246, 85, 121, 88, 103, 38, 121, 95, 179, 37, 231, 226, 68, 240, 184, 244, 85, 163, 188, 141, 11,
-    217, 123, 64, 206, 128, 111, 83, 40, 13, 92, 48, 145, 170, 88, 245, 220, 153, 77, 67, 240, 180, 105, 112, 180, 91,
-    66, 232, 114, 97, 93, 170, 124, 131, 232, 140, 196, 203, 207, 196, 113, 90, 186, 102, 36, 135, 128, 164, 45, 116,
-    19, 2, 115, 109, 66, 140, 159, 230, 221, 233, 187, 138, 92, 176, 138, 56, 171, 84, 156, 96, 60, 159, 39, 177, 34,
-    96, 36, 156, 73, 57, 131, 183, 95, 182, 170, 104, 154, 177, 250, 104, 76, 64, 34, 148, 217, 165, 203, 57, 160, 103,
-    158, 69, 74, 229, 179, 239, 9, 11, 197, 192, 74, 117, 100, 47, 5, 120, 18, 82, 50, 86, 100, 231, 37, 242, 156, 137,
-    16, 47, 151, 126, 249, 180, 217, 121, 230, 181, 19, 36, 134, 85, 106, 10, 52, 85, 37, 80, 162, 40, 22, 143, 224,
-    221, 82, 47, 24, 13, 218, 229, 146, 213, 38, 163, 33, 237, 190, 72, 219, 31, 84, 218, 117, 173, 101, 208, 7, 95,
-    144, 224, 184, 128, 217, 81, 89, 200, 114, 147, 93, 226, 125, 180, 43, 5, 177, 209, 0, 9, 3, 60, 148, 121, 96, 169,
-    229, 51, 29, 106, 148, 115, 207, 40, 131, 154, 13, 106, 176, 14, 53, 144, 151, 76, 36, 114, 184, 73, 93, 13, 5, 184,
-    124, 101, 231, 117, 52, 32, 64, 90, 177, 68, 16, 213, 105, 252, 88, 155, 252, 59, 19, 167, 5, 151, 108, 240, 176, 7,
-    174, 47, 236, 168, 135, 175, 199, 3, 240, 224, 198, 45, 90, 28, 19, 105, 171, 46, 64, 81, 52, 160, 242, 193, 219,
-    131, 122, 125, 172, 10, 57, 57, 103, 45, 83, 134, 58, 197, 171, 122, 65, 189, 72, 107, 221, 162, 109, 239, 20, 62,
-    63, 160, 212, 71, 69, 210, 21, 53, 150, 91, 126, 26, 6, 127, 127, 149, 199, 61, 27, 16, 50, 127, 180, 129, 65, 229,
-    32, 87, 175, 254, 91, 149, 18, 143, 70, 136, 27, 53, 198, 203, 60, 64, 121, 230, 175, 98, 164, 46, 73, 103, 3, 106,
-    17, 122, 81, 97, 88, 183, 147, 74, 235, 231, 6, 193, 72, 217, 159, 54, 24, 150, 81, 9, 72, 11, 241, 112, 254, 57,
-    167, 199, 101, 160, 54, 130, 213, 160, 13, 230, 158, 161, 35, 79, 171, 123, 127, 82, 37, 8, 100, 155, 66, 186, 175,
-    203, 48, 201, 170, 196, 237, 15, 39, 74, 252, 215, 227, 234, 166, 136, 143, 197, 175, 114, 51, 205, 136, 59, 56,
-    244, 88, 216, 178, 77, 151, 152, 147, 90, 58, 203, 49, 197, 179, 252, 138, 118, 143, 19, 129, 85, 103, 25, 217, 6,
-    235, 49, 202, 104, 165, 26, 125, 66, 103, 189, 134, 122, 44, 164, 148, 160, 62, 90, 78, 114, 151, 163, 109, 242,
-    108, 133, 133, 148, 74, 45, 157, 146, 42, 130, 70, 24, 102, 38, 205, 146, 36, 97, 230, 253, 97, 176, 53, 102, 31,
-    27, 156, 103, 183, 10, 199, 130, 172, 21, 141, 129, 83, 49, 177, 231, 87, 91, 54, 215, 56, 222, 88, 213, 91, 165,
-    207, 32, 224, 15, 6, 160, 119, 93, 95, 95, 34, 186, 103, 230, 247, 116, 76, 50, 249, 185, 66, 16, 94, 92, 53, 203,
-    139, 5, 161, 99, 150, 86, 55, 160, 250, 77, 61, 52, 148, 30, 46, 151, 98, 44, 188, 178, 223, 217, 201, 34, 219, 78,
-    42, 233, 149, 101, 222, 105, 107, 135, 91, 19, 11, 197, 3, 92, 34, 250, 97, 92, 96, 241, 77, 78, 8, 144, 0, 204,
-    241, 120, 200, 177, 250, 240, 100, 18, 90, 125, 80, 181, 187, 249, 68, 18, 4, 23, 206, 35, 9, 170, 202, 152, 201,
-    53, 25, 21, 167, 207, 216, 23, 0, 100, 40, 150, 168, 251, 7, 225, 181, 49, 169, 109, 189, 107, 251, 172, 178, 253,
-    152, 212, 65, 180, 0, 131, 157, 45, 81, 86, 246, 180, 123, 175, 13, 58, 5, 9, 0, 236, 154, 211, 231, 69, 133, 63,
-    215, 11, 30, 90, 86, 84, 183, 238, 19, 108, 233, 97, 127, 167, 4, 107, 20, 206, 225, 79, 12, 117, 210, 238, 171,
-    190, 157, 62, 138, 216, 48, 35, 176, 35, 158, 222, 91, 76, 156, 37, 8, 81, 39, 151, 64, 252, 238, 92, 43, 137, 171,
-    160, 59, 246, 51, 199, 199, 255, 174, 27, 126, 240, 164, 149, 210, 24, 181, 239, 76, 27, 33, 127, 117, 115, 135,
-    156, 209, 254, 250, 244, 203, 240, 38, 67, 102, 29, 30, 20, 177, 186, 69, 63, 151, 102, 105, 101, 176, 43, 75, 78,
-    76, 159, 45, 246, 7, 24, 180, 59, 78, 139, 217, 97, 74, 150, 130, 1, 103, 28, 100, 77, 206, 91, 81, 55, 93, 102,
-    183, 106, 180, 232, 41, 248, 55, 178, 204, 182, 148, 171, 236, 215, 122, 206, 74, 85, 187, 25, 105, 51, 112, 223,
-    63, 162, 106, 223, 38, 74, 222, 93, 238, 189, 54, 59, 28, 43, 119, 214, 250, 218, 133, 98, 58, 59, 7, 19, 226, 94,
-    192, 211, 203, 225, 77, 26, 232, 155, 87, 47, 160, 164, 101, 246, 231, 38, 209, 9, 171, 172, 250, 115, 163, 185,
-    174, 122, 229, 215, 189, 12, 67, 128, 219, 177, 111, 214, 110, 221, 20, 12, 222, 212, 171, 67, 171, 193, 113, 84,
-    82, 177, 113, 0, 12, 237, 80, 205, 204, 17, 144, 221, 4, 36, 142, 23, 231, 222, 107, 180, 152, 237, 252, 161, 103,
-    158, 108, 8, 189, 213, 103, 6, 113, 112, 118, 221, 65, 215, 72, 197, 55, 237, 20, 104, 36, 157, 73, 250, 0, 228,
-    105, 51, 12, 88, 27, 74, 28, 197, 215, 50, 12, 161, 69, 249, 122, 212, 22, 151, 156, 204, 246, 116, 192, 44, 142,
-    50, 125, 134, 99, 156, 222, 237, 236, 42, 233, 185, 72, 139, 34, 15, 66, 24, 123, 90, 18, 17, 91, 146, 0, 77, 184,
-    192, 183, 218, 158, 27, 121, 118, 121, 116, 11, 214, 220, 64, 10, 198, 44, 83, 138, 50, 144, 123, 89, 192, 50, 8, 1,
-    145, 9, 207, 103, 100, 224, 186, 43, 104, 81, 200, 139, 244, 134, 183, 228, 235, 147, 229, 114, 52, 78, 176, 71,
-    190, 19, 240, 164, 113, 221, 186, 48, 221, 58, 176, 47, 249, 91, 236, 47, 118, 50, 62, 251, 209, 230, 166, 220, 127,
-    116, 47, 193, 206, 247, 67, 255, 180, 15, 26, 95, 111, 89, 123, 65, 71, 243, 190, 42, 156, 213, 123, 248, 245, 59,
-    37, 171, 245, 79, 193, 210, 115, 202, 162, 178, 126, 94, 141, 181, 86, 118, 248, 87, 245, 188, 109, 177, 57, 230,
-    167, 128, 168, 170, 167, 13, 222, 15, 179, 95, 226, 184, 75, 181, 163, 80, 179, 95, 73, 135, 131, 197, 192, 10, 184,
-    13, 247, 100, 215, 222, 59, 160, 96, 103, 189, 55, 77, 235, 44, 177, 133, 99, 126, 146, 184, 174, 170, 46, 129, 185,
-    255, 116, 118, 151, 172, 33, 62, 236, 192, 225, 138, 110, 92, 31, 227, 4, 213, 20, 67, 128, 139, 111, 70, 155, 25,
-    154, 66, 39, 220, 168, 128, 76, 100, 143, 133, 139, 205, 231, 69, 50, 99, 235, 150, 192, 231, 112, 187, 175, 146,
-    99, 104, 47, 237, 193, 218, 230, 212, 85, 155, 51, 110, 6, 93, 236, 175, 55, 242, 192, 85, 124, 223, 59, 40, 195,
-    229, 246, 79, 126, 137, 154, 35, 45, 13, 215, 153, 153, 161, 19, 113, 214, 79, 126, 108, 182, 21, 108, 107, 230,
-    136, 149, 121, 139, 179, 176, 60, 205, 51, 45, 46, 205, 215, 59, 203, 116, 37, 61, 160, 212, 223, 245, 113, 249,
-    114, 160, 178, 207, 187, 252, 170, 205, 239, 223, 92, 130, 9, 217, 213, 66, 164, 139, 220, 78, 87, 59, 19, 75, 249,
-    178, 206, 218, 32, 124, 178, 55, 35, 144, 84, 215, 27, 203, 16, 47, 195, 202, 13, 128, 154, 185, 197, 3, 155, 219,
-    208, 15, 159, 176, 134, 74, 12, 154, 176, 48, 109, 255, 74, 115, 113, 200, 164, 49, 176, 93, 200, 83, 239, 8, 167,
-    63, 140, 83, 192, 101, 192, 157, 72, 63, 94, 125, 84, 163, 86, 100, 187, 86, 54, 225, 115, 122, 93, 16, 0, 245, 176,
-    233, 51, 19, 89, 250, 168, 157, 29, 161, 76, 60, 23, 235, 127, 232, 240, 213, 89, 31, 204, 45, 129, 96, 254, 50, 8,
-    124, 174, 255, 181, 11, 196, 18, 0, 238, 31, 4, 0, 23, 28, 67, 160, 50, 247, 112, 61, 59, 58, 235, 226, 4, 122, 205,
-    141, 217, 142, 187, 133, 8, 59, 87, 156, 69, 245, 35, 150, 118, 112, 171, 57, 89, 29, 112, 56, 107, 55, 222, 209,
-    71, 149, 158, 219, 3, 25, 216, 87, 55, 138, 83, 177, 232, 8, 221, 28, 250, 122, 221, 150, 190, 247, 193, 2, 207,
-    173, 103, 176, 46, 162, 121, 130, 215, 227, 120, 145, 30, 233, 22, 33, 175, 175, 151, 136, 240, 201, 110, 53, 192,
-    241, 150, 43, 67, 60, 218, 130, 95, 153, 21, 38, 191, 91, 172, 75, 98, 191, 91, 31, 125, 53, 106, 249, 38, 41, 214,
-    141, 123, 52, 209, 1, 132, 161, 223, 106, 111, 231, 171, 44, 212, 11, 106, 221, 198, 39, 122, 188, 246, 130, 96,
-    142, 172, 86, 53, 145, 230, 64, 2, 157, 70, 244, 96, 222, 166, 134, 63, 97, 107, 114, 58, 64, 200, 43, 6, 193, 196,
-    154, 158, 47, 78, 156, 192, 134, 32, 67, 124, 196, 7, 58, 136, 217, 9, 246, 143, 93, 64, 255, 81, 7, 28, 166, 184,
-    75, 130, 142, 214, 15, 143, 119, 169, 10, 77, 173, 44, 31, 104, 208, 62, 233, 241, 116, 251, 162, 11, 183, 167, 16,
-    69, 219, 64, 159, 206, 29, 210, 150, 201, 92, 190, 243, 192, 20, 9, 214, 88, 83, 192, 21, 176, 201, 96, 213, 3, 161,
-    193, 227, 50, 236, 30, 78, 1, 60, 35, 1, 244, 155, 191, 190, 167, 131, 200, 151, 36, 253, 5, 161, 96, 24, 172, 34,
-    58, 148, 43, 183, 211, 244, 244, 62, 210, 223, 121, 12, 245, 13, 43, 134, 228, 235, 58, 222, 84, 42, 87, 170, 14,
-    244, 177, 127, 71, 199, 74, 94, 77, 160, 167, 185, 209, 185, 79, 245, 36, 125, 45, 229, 237, 249, 218, 203, 199, 30,
-    27, 67, 180, 62, 197, 193, 229, 10, 203, 44, 1, 36, 19, 248, 130, 62, 226, 159, 126, 163, 35, 208, 41, 20, 169, 137,
-    24, 78, 193, 193, 33, 36, 196, 178, 189, 172, 178, 252, 22, 142, 192, 178, 23, 187, 16, 134, 235, 22, 138, 207, 28,
-    107, 133, 10, 233, 219, 213, 241, 148, 132, 42, 222, 132, 181, 95, 135, 156, 210, 234, 184, 196, 181, 254, 70, 231,
-    1, 38, 116, 66, 58, 250, 228, 197, 154, 123, 219, 211, 184, 57, 253, 27, 160, 111, 40, 224, 150, 142, 224, 208, 137,
-    126, 44, 199, 92, 122, 67, 213, 102, 107, 4, 232, 124, 98, 145, 91, 120, 11, 174, 162, 195, 35, 62, 69, 186, 135,
-    96, 81, 60, 78, 88, 253, 206, 167, 123, 206, 197, 252, 101, 108, 45, 189, 73, 128, 102, 236, 107, 212, 230, 125,
-    120, 21, 73, 67, 2, 188, 204, 39, 56, 231, 236, 160, 135, 25, 77, 27, 181, 248, 218, 206, 42, 216, 140, 70, 140,
-    150, 106, 239, 235, 153, 102, 4, 21, 174, 19, 131, 130, 38, 146, 45, 188, 43, 225, 40, 129, 14, 65, 138, 25, 252,
-    50, 9, 122, 53, 195, 73, 250, 212, 78, 129, 10, 9, 103, 201, 30, 152, 112, 189, 99, 121, 62, 138, 26, 144, 209, 159,
-    83, 65, 29, 37, 178, 83, 121, 93, 114, 208, 168, 24, 227, 168, 140, 145, 177, 104, 28, 98, 19, 89, 220, 12, 43, 107,
-    10, 207, 200, 159, 28, 94, 139, 106, 230, 129, 69, 157, 25, 242, 124, 74, 255, 251, 213, 123, 171, 47, 66, 216, 167,
-    88, 200, 98, 10, 48, 13, 236, 109, 16, 233, 140, 1, 20, 87, 181, 154, 46, 41, 7, 13, 56, 88, 164, 229, 200, 128,
-    252, 244, 203, 105, 245, 220, 163, 236, 87, 139, 229, 242, 125, 162, 158, 125, 209, 220, 139, 25, 95, 6, 132, 198,
-    104, 92, 154, 234, 52, 121, 237, 96, 22, 182, 94, 233, 27, 170, 44, 132, 195, 62, 171, 71, 161, 108, 70, 251, 80,
-    216, 143, 90, 109, 137, 233, 167, 196, 187, 149, 85, 231, 41, 190, 142, 249, 240, 198, 237, 19, 157, 21, 126, 73,
-    84, 16, 183, 8, 103, 185, 59, 18, 206, 36, 109, 165, 105, 137, 229, 121, 31, 210, 190, 208, 112, 150, 122, 146, 178,
-    66, 27, 81, 145, 49, 146, 103, 155, 46, 153, 134, 184, 161, 79, 170, 96, 69, 191, 48, 172, 151, 42, 248, 216, 65,
-    80, 150, 70, 80, 156, 204, 191, 199, 4, 42, 187, 26, 68, 167, 5, 18, 152, 170, 88, 183, 144, 52, 11, 202, 72, 31,
-    134, 188, 252, 11, 165, 219, 199, 237, 12, 76, 229, 179, 157, 81, 144, 57, 199, 171, 125, 8, 198, 65, 135, 209, 71,
-    72, 233, 81, 181, 245, 141, 33, 34, 188, 166, 19, 197, 204, 247, 226, 20, 171, 50, 10, 48, 2, 159, 152, 84, 153,
-    239, 149, 116, 234, 158, 172, 254, 78, 244, 200, 5, 41, 6, 231, 61, 252, 171, 2, 170, 145, 233, 63, 63, 226, 242,
-    210, 77, 100, 250, 117, 1, 27, 135, 87, 86, 109, 53, 44, 255, 12, 187, 89, 9, 23, 58, 248, 6, 159, 206, 152, 208,
-    170, 77, 3, 50, 85, 91, 181, 106, 123, 148, 253, 35, 234, 168, 93, 66, 67, 184, 52, 140, 102, 70, 111, 143, 59, 77,
-    34, 210, 125, 54, 208, 186, 240, 191, 67, 41, 128, 22, 234, 189, 22, 157, 24, 46, 3, 169, 18, 9, 225, 148, 235, 165,
-    166, 100, 248, 235, 209, 238, 183, 200, 165, 70, 48, 11, 214, 7, 185, 203, 249, 24, 129, 13, 92, 0, 175, 119, 39,
-    106, 137, 73, 44, 23, 233, 87, 140, 21, 170, 110, 2, 3, 97, 1, 138, 187, 17, 128, 14, 3, 105, 30, 201, 6, 119, 41,
-    249, 213, 58, 35, 219, 121, 162, 47, 79, 223, 40, 104, 86, 191, 178, 141, 110, 48, 254, 96, 0, 186, 180, 232, 230,
-    30, 160, 39, 130, 141, 32, 76, 71, 164, 138, 151, 85, 239, 180, 107, 234, 170, 188, 161, 159, 17, 236, 143, 90, 144,
-    28, 181, 103, 43, 3, 225, 22, 166, 186, 229, 171, 197, 107, 82, 67, 222, 126, 188, 31, 151, 146, 254, 203, 177, 87,
-    81, 43, 45, 50, 114, 209, 128, 113, 136, 231, 199, 227, 101, 68, 96, 192, 93, 220, 131, 131, 208, 167, 214, 67, 237,
-    105, 241, 175, 153, 64, 242, 130, 205, 140, 169, 247, 180, 203, 125, 127, 38, 91, 135, 2, 63, 235, 157, 171, 16,
-    120, 222, 41, 91, 142, 31, 10, 90, 87, 40, 176, 211, 113, 37, 89, 9, 65, 114, 244, 249, 50, 209, 142, 255, 13, 229,
-    77, 243, 106, 156, 98, 207, 239, 179, 174, 133, 209, 83, 98, 29, 182, 105, 169, 199, 35, 198, 5, 91, 52, 244, 1,
-    114, 126, 198, 171, 10, 32, 128, 57, 243, 93, 109, 25, 2, 101, 102, 64, 214, 150, 189, 70, 249, 195, 43, 2, 195,
-    230, 201, 124, 158, 26, 216, 132, 52, 244, 1, 169, 24, 179, 62, 124, 203, 158, 95, 179, 24, 113, 26, 33, 239, 242,
-    58, 131, 45, 71, 51, 152, 215, 251, 189, 15, 252, 188, 172, 168, 233, 203, 51, 1, 208, 232, 79, 106, 221, 36, 163,
-    220, 254, 59, 118, 232, 168, 148, 31, 73, 57, 66, 46, 26, 178, 46, 186, 44, 70, 48, 157, 96, 145, 171, 61, 220, 236,
-    156, 43, 71, 151, 103, 78, 12, 171, 183, 135, 10, 248, 235, 45, 250, 214, 90, 137, 227, 40, 100, 125, 200, 57, 106,
-    141, 84, 182, 5, 54, 120, 20, 116, 147, 140, 200, 135, 213, 194, 141, 163, 239, 106, 188, 128, 101, 154, 248, 1,
-    234, 63, 253, 37, 106, 44, 236, 58, 139, 88, 238, 22, 50, 84, 150, 66, 217, 134, 25, 63, 96, 137, 76, 84, 3, 69,
-    208, 109, 30, 52, 146, 209, 247, 255, 119, 94, 99, 101, 137, 152, 205, 189, 27, 245, 254, 196, 24, 177, 87, 80, 0,
-    32, 111, 19, 19, 153, 75, 156, 75, 240, 71, 137, 177, 238, 171, 52, 112, 153, 36, 240, 120, 154, 4, 239, 201, 67,
-    236, 89, 108, 242, 106, 191, 107, 153, 84, 162, 115, 48, 253, 41, 246, 24, 125, 152, 23, 80, 197, 191, 92, 153, 93,
-    131, 143, 80, 206, 178, 184, 6, 14, 27, 187, 236, 144, 112, 212, 163, 86, 52, 118, 220, 182, 71, 66, 196, 115, 206,
-    79, 233, 27, 173, 14, 57, 163, 123, 23, 213, 51, 135, 109, 172, 30, 91, 70, 30, 136, 10, 164, 186, 226, 44, 79, 125,
-    149, 36, 149, 36, 0, 255, 94, 236, 54, 217, 71, 2, 200, 135, 112, 245, 138, 15, 140, 240, 227, 38, 124, 217, 46, 44,
-    147, 206, 157, 181, 19, 102, 94, 207, 22, 77, 14, 21, 37, 133, 88, 46, 221, 33, 207, 10, 231, 24, 166, 3, 237, 187,
-    47, 106, 136, 23, 14, 103, 225, 242, 102, 143, 220, 192, 107, 249, 124, 63, 128, 198, 249, 128, 112, 145, 145, 39,
-    130, 121, 34, 85, 158, 191, 124, 98, 54, 226, 164, 42, 12, 196, 68, 135, 23, 230, 200, 180, 236, 181, 198, 127, 156,
-    189, 92, 109, 179, 254, 112, 120, 72, 165, 202, 179, 214, 143, 203, 96, 130, 33, 240, 173, 165, 247, 169, 183, 17,
-    240, 178, 2, 84, 11, 35, 220, 218, 221, 237, 240, 53, 147, 233, 150, 132, 161, 28, 4, 139, 95, 70, 145, 88, 117, 64,
-    198, 29, 15, 69, 162, 237, 200, 173, 141, 16, 223, 41, 76, 240, 15, 123, 209, 148, 163, 204, 188, 10, 118, 67, 111,
-    5, 42, 76, 196, 201, 86, 235, 9, 88, 203, 179, 57, 198, 218, 246, 152, 162, 222, 113, 176, 203, 222, 220, 154, 81,
-    20, 164, 218, 208, 16, 44, 40, 253, 188, 94, 154, 110, 17, 143, 199, 223, 101, 168, 224, 55, 232, 24, 70, 200, 33,
-    83, 68, 57, 155, 73, 38, 112, 98, 53, 43, 131, 30, 146, 218, 206, 197, 208, 205, 1, 204, 33, 33, 134, 216, 185, 37,
-    155, 12, 249, 242, 17, 90, 73, 200, 237, 177, 23, 237, 129, 208, 212, 172, 16, 109, 12, 228, 118, 4, 202, 239, 178,
-    222, 99, 206, 189, 127, 8, 62, 94, 74, 135, 50, 121, 14, 23, 25, 72, 77, 1, 144, 147, 111, 53, 73, 48, 71, 171, 50,
-    88, 75, 120, 41, 59, 144, 15, 199, 143, 24, 152, 68, 209, 253, 31, 142, 82, 118, 41, 252, 55, 90, 17, 140, 154, 194,
-    147, 207, 218, 169, 17, 83, 21, 69, 170, 186, 81, 110, 246, 48, 42, 234, 31, 147, 76, 201, 32, 201, 164, 31, 111,
-    237, 44, 223, 176, 33, 111, 41, 95, 75, 30, 73, 237, 181, 237, 174, 103, 201, 122, 105, 224, 29, 141, 229, 237, 204,
-    151, 82, 49, 231, 56, 133, 196, 54, 230, 244, 129, 73, 167, 59, 249, 159, 255, 155, 130, 229, 232, 151, 96, 61, 180,
-    40, 162, 13, 159, 113, 198, 114, 193, 154, 217, 96, 244, 130, 178, 136, 215, 31, 222, 97, 176, 254, 114, 190, 128,
-    11, 159, 10, 50, 135, 47, 18, 4, 91, 144, 92, 220, 35, 29, 200, 13, 114, 178, 226, 12, 1, 87, 21, 22, 192, 78, 235,
-    40, 210, 160, 103, 99, 152, 246, 208, 193, 77, 207, 14, 208, 190, 131, 72, 76, 99, 131, 76, 116, 243, 157, 72, 139,
-    248, 19, 43, 41, 227, 137, 44, 115, 225, 238, 17, 54, 25, 53, 193, 236, 187, 218, 15, 246, 104, 27, 112, 7, 167, 95,
-    221, 224, 55, 125, 98, 32, 170, 28, 130, 30, 70, 25, 235, 154, 254, 131, 124, 24, 67, 35, 94, 37, 178, 134, 35, 66,
-    105, 27, 80, 36, 223, 170, 157, 24, 228, 115, 85, 6, 163, 152, 208, 150, 186, 118, 182, 46, 250, 47, 231, 122, 223,
-    197, 141, 142, 9, 65, 164, 191, 191, 3, 186, 110, 152, 14, 190, 198, 52, 222, 248, 240, 192, 204, 194, 107, 195,
-    139, 127, 24, 164, 166, 209, 68, 142, 83, 248, 238, 237, 81, 202, 247, 53, 203, 124, 160, 185, 18, 51, 70, 79, 177,
-    186, 222, 44, 153, 81, 99, 91, 228, 229, 158, 64, 138, 184, 39, 73, 44, 238, 146, 198, 5, 61, 105, 149, 148, 60,
-    195, 135, 143, 225, 235, 37, 158, 17, 225, 82, 221, 125, 249, 251, 223, 26, 187, 1, 103, 57, 72, 215, 145, 101, 233,
-    80, 138, 194, 26, 125, 216, 129, 109, 211, 231, 30, 19, 106, 163, 233, 102, 231, 17, 253, 204, 135, 113, 101, 80,
-    131, 201, 142, 170, 232, 67, 116, 34, 36, 230, 128, 113, 108, 64, 44, 150, 156, 93, 134, 169, 141, 63, 151, 192, 55,
-    0, 236, 161, 22, 162, 133, 130, 113, 147, 230, 238, 206, 148, 114, 52, 134, 157, 38, 169, 204, 63, 112, 180, 54,
-    172, 22, 64, 164, 117, 80, 119, 25, 237, 117, 240, 183, 126, 228, 94, 63, 191, 88, 88, 22, 180, 239, 104, 115, 17,
-    58, 5, 112, 216, 247, 143, 157, 183, 166, 172, 8, 68, 254, 212, 179, 149, 110, 81, 111, 97, 83, 214, 174, 33, 36,
-    118, 171, 50, 170, 99, 146, 188, 95, 118, 69, 63, 120, 214, 22, 208, 254, 210, 102, 135, 121, 206, 200, 84, 84, 207,
-    192, 198, 136, 223, 149, 129, 63, 203, 183, 223, 68, 95, 127, 239, 170, 179, 89, 53, 46, 177, 73, 184, 70, 197, 249,
-    167, 41, 155, 104, 255, 137, 170, 180, 76, 245, 231, 85, 163, 192, 130, 180, 74, 213, 14, 244, 209, 26, 138, 217,
-    202, 251, 113, 94, 220, 58, 184, 32, 45, 79, 204, 132, 51, 120, 73, 38, 51, 13, 187, 15, 234, 178, 66, 250, 197, 0,
-    182, 2, 253, 127, 169, 45, 95, 51, 64, 165, 77, 85, 159, 25, 163, 20, 49, 205, 244, 221, 172, 127, 155, 243, 241,
-    73, 36, 74, 42, 199, 237, 205, 139, 186, 123, 64, 2, 177, 110, 22, 106, 229, 159, 69, 211, 180, 127, 128, 174, 1,
-    135, 224, 237, 134, 98, 92, 169, 179, 241, 8, 42, 108, 192, 29, 192, 212, 200, 68, 154, 88, 129, 38, 168, 254, 163,
-    39, 115, 50, 81, 101, 241, 123, 246, 137, 21, 160, 181, 69, 2, 250, 125, 246, 180, 136, 93, 56, 51, 156, 250, 231,
-    184, 194, 170, 190, 51, 88, 149, 35, 238, 76, 178, 146, 71, 55, 238, 50, 55, 78, 239, 226, 86, 253, 38, 5, 211, 178,
-    57, 121, 222, 145, 229, 81, 12, 70, 16, 48, 31, 121, 106, 143, 175, 242, 68, 201, 44, 217, 55, 55, 45, 116, 93, 81,
-    94, 209, 194, 74, 20, 246, 103, 145, 80, 17, 122, 234, 227, 246, 33, 47, 239, 186, 25, 103, 163, 175, 133, 131, 136,
-    105, 100, 214, 162, 37, 144, 148, 246, 215, 240, 127, 131, 123, 65, 205, 121, 114, 160, 149, 132, 203, 61, 219, 110,
-    40, 103, 19, 202, 238, 93, 94, 12, 239, 44, 21, 237, 166, 97, 85, 196, 143, 43, 86, 175, 202, 53, 41, 123, 169, 31,
-    41, 173, 228, 139, 15, 27, 124, 137, 221, 9, 134, 79, 46, 4, 117, 232, 140, 195, 19, 45, 55, 223, 220, 200, 62, 16,
-    67, 175, 224, 252, 199, 123, 209, 241, 36, 102, 131, 41, 211, 10, 174, 164, 221, 105, 72, 145, 97, 116, 92, 255,
-    159, 49, 128, 24, 138, 5, 198, 73, 22, 41, 31, 220, 199, 220, 84, 105, 158, 243, 47, 97, 218, 250, 12, 79, 112, 125,
-    90, 229, 193, 65, 21, 243, 237, 98, 116, 249, 147, 75, 141, 164, 188, 147, 88, 201, 90, 252, 235, 94, 133, 53, 133,
-    199, 183, 246, 106, 128, 72, 110, 81, 185, 189, 224, 208, 153, 139, 169, 223, 5, 250, 155, 81, 2, 255, 138, 199, 47,
-    78, 84, 22, 203, 111, 52, 213, 231, 204, 156, 138, 136, 82, 54, 247, 28, 133, 43, 41, 13, 177, 87, 190, 89, 14, 24,
-    156, 215, 52, 112, 251, 175, 237, 1, 81, 103, 6, 198, 30, 101, 124, 209, 12, 120, 78, 185, 240, 206, 33, 172, 156,
-    57, 227, 192, 207, 134, 42, 210, 14, 73, 137, 147, 133, 18, 29, 170, 128, 130, 29, 111, 6, 14, 252, 214, 117, 98,
-    187, 25, 141, 39, 7, 116, 241, 161, 122, 180, 111, 182, 65, 160, 138, 118, 158, 99, 222, 86, 119, 177, 155, 175, 29,
-    129, 19, 93, 8, 29, 104, 247, 113, 34, 74, 39, 225, 69, 136, 128, 75, 136, 212, 151, 153, 6, 217, 155, 76, 206, 105,
-    114, 21, 118, 11, 125, 68, 95, 162, 127, 90, 152, 212, 240, 109, 69, 88, 245, 193, 193, 74, 220, 179, 17, 170, 200,
-    79, 61, 202, 87, 210, 251, 251, 117, 123, 238, 225, 131, 255, 175, 3, 153, 135, 109, 64, 179, 100, 209, 55, 96, 221,
-    140, 59, 107, 138, 20, 28, 147, 192, 94, 9, 48, 139, 210, 5, 101, 186, 223, 230, 14, 123, 48, 131, 235, 215, 209,
-    198, 166, 76, 197, 181, 18, 78, 166, 55, 86, 167, 43, 80, 173, 149, 139, 219, 23, 231, 61, 150, 22, 251, 198, 195,
-    118, 65, 246, 197, 254, 40, 160, 178, 1, 87, 46, 53, 166, 170, 190, 29, 171, 217, 45, 14, 60, 84, 224, 152, 232, 23,
-    213, 44, 108, 150, 77, 3, 133, 70, 220, 159, 165, 210, 118, 132, 134, 208, 100, 47, 109, 52, 1, 252, 87, 215, 107,
-    130, 129, 60, 197, 196, 223, 22, 40, 206, 2, 177, 86, 43, 215, 125, 35, 9, 203, 60, 127, 208, 36, 205, 232, 235,
-    193, 91, 46, 138, 53, 185, 63, 156, 165, 200, 99, 63, 199, 102, 124, 133, 46, 240, 65, 25, 201, 152, 105, 143, 120,
-    230, 113, 9, 221, 197, 87, 179, 99, 51, 19, 117, 208, 157, 143, 90, 82, 188, 165, 104, 186, 205, 189, 46, 151, 133,
-    2, 165, 10, 163, 179, 48, 157, 40, 242, 74, 129, 227, 68, 186, 216, 93, 141, 166, 61, 210, 23, 126, 238, 186, 50,
-    138, 80, 176, 151, 72, 14, 99, 196, 181, 174, 53, 236, 13, 32, 255, 216, 239, 174, 155, 178, 198, 170, 183, 18, 113,
-    156, 244, 14, 252, 72, 199, 148, 2, 73, 94, 123, 12, 183, 215, 87, 158, 250, 50, 203, 118, 179, 85, 188, 3, 32, 179,
-    218, 188, 75, 238, 98, 65, 27, 46, 181, 120, 144, 33, 8, 215, 220, 23, 66, 211, 115, 160, 224, 167, 246, 23, 244,
-    245, 46, 148, 109, 170, 145, 122, 27, 4, 5, 153, 31, 191, 90, 137, 101, 133, 101, 155, 88, 238, 240, 7, 237, 153,
-    147, 169, 237, 244, 98, 146, 92, 34, 173, 0, 179, 66, 244, 155, 181, 97, 155, 27, 173, 72, 2, 151, 78, 186, 214, 65,
-    86, 219, 226, 72, 79, 223, 122, 90, 152, 138, 223, 255, 209, 116, 131, 148, 64, 234, 150, 219, 210, 165, 98, 0, 114,
-    228, 216, 234, 101, 193, 101, 37, 131, 5, 21, 40, 147, 229, 103, 228, 19, 133, 152, 54, 40, 132, 140, 117, 82, 42,
-    41, 86, 65, 200, 116, 181, 252, 16, 112, 137, 13, 130, 200, 47, 241, 66, 199, 145, 253, 36, 101, 40, 242, 55, 39,
-    92, 25, 32, 255, 84, 165, 152, 220, 130, 196, 187, 192, 212, 83, 154, 243, 70, 107, 167, 85, 124, 194, 91, 189, 142,
-    196, 106, 209, 200, 222, 185, 190, 10, 23, 47, 112, 162, 176, 145, 249, 180, 194, 157, 70, 147, 61, 132, 13, 220,
-    30, 203, 22, 103, 221, 83, 64, 3, 242, 43, 109, 37, 80, 75, 1, 199, 222, 45, 32, 110, 242, 90, 96, 55, 197, 65, 63,
-    166, 244, 18, 101, 55, 100, 115, 133, 148, 59, 33, 224, 2, 222, 70, 223, 204, 9, 227, 205, 33, 20, 97, 133, 8, 222,
-    92, 136, 140, 207, 81, 253, 151, 52, 143, 8, 192, 27, 234, 50, 239, 89, 144, 85, 120, 90, 13, 236, 164, 102, 232,
-    209, 57, 140, 217, 250, 213, 215, 186, 6, 144, 82, 86, 85, 122, 114, 215, 35, 190, 127, 46, 36, 98, 4, 27, 88, 251,
-    57, 1, 64, 3, 241, 183, 34, 149, 166, 221, 197, 74, 144, 173, 144, 8, 183, 241, 44, 135, 238, 217, 250, 223, 28, 60,
-    12, 134, 123, 33, 35, 117, 41, 215, 103, 58, 75, 39, 91, 174, 22, 233, 122, 26, 98, 39, 71, 136, 109, 232, 34, 13,
-    150, 47, 47, 93, 93, 83, 124, 14, 26, 243, 250, 23, 123, 234, 96, 189, 231, 92, 72, 6, 213, 66, 128, 51, 249, 151,
-    138, 26, 26, 222, 223, 159, 54, 211, 41, 226, 80, 49, 77, 80, 20, 175, 10, 31, 10, 202, 43, 184, 47, 136, 187, 237,
-    72, 72, 126, 3, 164, 214, 172, 150, 49, 67, 99, 115, 144, 119, 238, 153, 231, 103, 33, 214, 174, 38, 36, 63, 6, 183,
-    69, 105, 34, 7, 145, 232, 244, 212, 160, 194, 194, 5, 8, 71, 134, 100, 13, 231, 198, 138, 242, 228, 185, 70, 80,
-    185, 254, 146, 183, 56, 241, 99, 7, 107, 36, 10, 122, 203, 52, 215, 22, 228, 201, 10, 225, 42, 103, 209, 56, 182,
-    81, 147, 199, 167, 96, 215, 249, 251, 167, 85, 117, 236, 226, 235, 61, 15, 82, 186, 129, 83, 52, 253, 144, 200, 73,
-    167, 190, 75, 239, 236, 249, 19, 125, 40, 158, 38, 153, 15, 189, 154, 231, 76, 115, 186, 90, 1, 237, 59, 26, 101,
-    114, 52, 182, 6, 219, 144, 5, 176, 140, 243, 177, 127, 182, 183, 13, 37, 36, 236, 141, 69, 26, 223, 68, 199, 36, 8,
-    154, 51, 22, 236, 77, 156, 75, 111, 109, 174, 71, 237, 87, 197, 144, 255, 203, 45, 222, 70, 235, 191, 23, 102, 117,
-    194, 57, 202, 177, 60, 179, 96, 197, 118, 48, 60, 91, 168, 19, 166, 106, 36, 102, 210, 219, 242, 104, 35, 10, 182,
-    168, 175, 4, 117, 47, 88, 199, 13, 218, 183, 104, 3, 45, 9, 40, 187, 54, 162, 181, 201, 77, 136, 139, 18, 32, 41,
-    24, 14, 109, 166, 83, 111, 84, 18, 36, 108, 94, 170, 176, 142, 179, 134, 78, 142, 79, 79, 146, 184, 111, 75, 192,
-    199, 94, 122, 35, 170, 173, 92, 115, 86, 144, 206, 229, 183, 21, 50, 248, 95, 99, 130, 126, 184, 201, 255, 32, 137,
-    24, 247, 243, 67, 52, 171, 102, 205, 184, 2, 85, 145, 1, 135, 5, 99, 141, 70, 111, 238, 23, 16, 188, 136, 184, 70,
-    179, 61, 95, 235, 4, 55, 82, 241, 92, 231, 28, 100, 186, 193, 84, 244, 78, 32, 244, 69, 102, 66, 86, 148, 7, 28,
-    183, 148, 172, 179, 15, 240, 62, 62, 118, 251, 202, 71, 137, 201, 164, 155, 203, 124, 45, 248, 83, 167, 152, 56,
-    151, 95, 81, 182, 20, 178, 173, 80, 23, 92, 227, 68, 37, 154, 205, 198, 116, 187, 195, 254, 212, 199, 8, 210, 185,
-    112, 67, 117, 106, 96, 134, 30, 74, 195, 14, 76, 141, 6, 46, 131, 135, 90, 131, 207, 229, 237, 82, 185, 162, 210,
-    88, 119, 26, 66, 218, 5, 78, 23, 1, 180, 42, 33, 123, 185, 59, 31, 139, 173, 209, 86, 87, 184, 4, 209, 238, 99, 111,
-    0, 16, 113, 7, 145, 48, 223, 80, 32, 230, 169, 240, 42, 197, 221, 87, 99, 45, 117, 222, 120, 110, 150, 35, 106, 50,
-    44, 165, 145, 106, 14, 115, 140, 213, 216, 140, 109, 242, 77, 31, 0, 110, 171, 177, 73, 68, 29, 174, 1, 186, 122,
-    23, 94, 102, 134, 125, 11, 253, 153, 79, 62, 225, 173, 232, 31, 167, 32, 204, 20, 51, 221, 1, 216, 176, 35, 123, 86,
-    95, 55, 255, 130, 181, 146, 89, 101, 204, 79, 28, 124, 164, 52, 232, 11, 216, 193, 44, 233, 157, 208, 188, 133, 200,
-    156, 31, 39, 96, 70, 88, 111, 45, 174, 243, 20, 177, 223, 63, 146, 179, 211, 52, 21, 34, 37, 105, 103, 223, 88, 227,
-    7, 56, 159, 108, 24, 125, 76, 154, 129, 187, 7, 69, 35, 132, 35, 136, 92, 35, 157, 198, 177, 57, 185, 66, 3, 33,
-    225, 228, 55, 167, 35, 86, 136, 126, 13, 86, 199, 137, 40, 177, 26, 121, 15, 165, 133, 69, 184, 32, 181, 32, 210,
-    125, 63, 203, 175, 102, 254, 116, 124, 237, 31, 205, 83, 57, 212, 164, 102, 64, 230, 97, 209, 192, 13, 246, 126,
-    135, 93, 12, 197, 104, 244, 147, 248, 225, 5, 151, 250, 88, 103, 54, 139, 0, 144, 123, 36, 92, 194, 194, 54, 9, 32,
-    18, 165, 215, 254, 103, 179, 111, 242, 180, 62, 184, 182, 82, 150, 65, 77, 80, 177, 31, 116, 138, 213, 64, 217, 224,
-    39, 239, 114, 253, 249, 179, 82, 99, 148, 241, 120, 156, 90, 102, 32, 13, 205, 122, 6, 80, 231, 235, 107, 193, 102,
-    190, 151, 151, 246, 239, 96, 60, 141, 0, 148, 69, 189, 53, 177, 13, 40, 204, 239, 39, 130, 239, 31, 110, 6, 12, 152,
-    139, 131, 8, 115, 199, 72, 201, 229, 41, 24, 78, 93, 239, 101, 89, 50, 151, 112, 160, 70, 199, 87, 139, 150, 167,
-    223, 204, 19, 165, 143, 105, 108, 21, 120, 15, 65, 133, 215, 16, 141, 64, 101, 75, 158, 145, 224, 126, 133, 43, 228,
-    99, 74, 137, 113, 80, 181, 123, 7, 31, 6, 13, 13, 237, 187, 231, 166, 157, 236, 130, 64, 228, 186, 43, 148, 216, 8,
-    5, 39, 73, 75, 248, 121, 105, 41, 241, 22, 111, 145, 179, 28, 76, 213, 115, 68, 89, 155, 150, 146, 95, 213, 190, 58,
-    148, 153, 132, 234, 191, 102, 159, 200, 241, 104, 164, 170, 0, 252, 25, 158, 230, 241, 56, 176, 251, 70, 72, 2, 110,
-    219, 126, 101, 87, 34, 81, 82, 13, 174, 65, 5, 18, 144, 191, 76, 130, 81, 167, 56, 117, 28, 254, 204, 158, 34, 230,
-    95, 69, 126, 155, 60, 179, 131, 105, 56, 169, 240, 143, 155, 144, 110, 163, 171, 248, 136, 114, 28, 114, 117, 204,
-    213, 164, 44, 211, 244, 34, 109, 106, 98, 80, 28, 0, 66, 45, 141, 33, 40, 146, 28, 249, 234, 126, 21, 142, 87, 78,
-    239, 228, 39, 167, 78, 130, 45, 220, 84, 30, 80, 111, 187, 124, 34, 91, 160, 148, 195, 149, 129, 127, 12, 199, 249,
-    111, 163, 238, 88, 92, 182, 16, 223, 76, 4, 184, 182, 33, 244, 45, 172, 87, 161, 96, 213, 243, 41, 96, 3, 49, 37,
-    211, 125, 219, 94, 120, 193, 125, 122, 192, 144, 181, 52, 196, 216, 69, 44, 33, 5, 220, 39, 92, 234, 216, 6, 200,
-    160, 36, 226, 124, 131, 203, 86, 203, 60, 139, 170, 91, 139, 250, 247, 114, 150, 75, 133, 91, 54, 128, 75, 252, 70,
-    42, 196, 221, 185, 121, 253, 191, 215, 175, 139, 247, 229, 234, 238, 84, 73, 110, 19, 110, 128, 114, 192, 22, 52,
-    210, 131, 37, 24, 194, 136, 137, 20, 30, 90, 111, 216, 193, 131, 240, 95, 1, 232, 74, 229, 133, 128, 137, 223, 186,
-    72, 34, 22, 1, 99, 154, 225, 24, 119, 28, 57, 16, 168, 22, 114, 188, 45, 170, 21, 105, 74, 122, 7, 153, 151, 125,
-    198, 245, 99, 138, 120, 176, 134, 171, 214, 221, 239, 226, 72, 186, 3, 222, 229, 95, 147, 206, 122, 40, 206, 126,
-    11, 14, 157, 91, 254, 122, 87, 160, 242, 66, 77, 87, 169, 31, 170, 30, 46, 230, 242, 115, 249, 46, 216, 115, 244,
-    92, 47, 193, 111, 86, 29, 30, 196, 171, 23, 34, 94, 229, 173, 60, 164, 214, 108, 247, 230, 219, 68, 110, 203, 98,
-    60, 75, 121, 47, 2, 74, 155, 164, 50, 16, 255, 96, 176, 80, 46, 102, 161, 94, 233, 61, 55, 108, 33, 253, 15, 227,
-    59, 207, 104, 155, 217, 223, 126, 82, 197, 98, 135, 243, 144, 253, 206, 202, 74, 225, 129, 210, 191, 114, 202, 98,
-    244, 73, 111, 185, 46, 28, 16, 160, 147, 209, 233, 23, 47, 116, 225, 127, 192, 250, 203, 118, 178, 210, 110, 85, 29,
-    167, 182, 155, 184, 72, 15, 95, 43, 144, 250, 71, 143, 102, 114, 79, 231, 87, 200, 183, 143, 55, 100, 50, 76, 85,
-    147, 210, 9, 139, 180, 1, 236, 238, 251, 78, 197, 201, 10, 150, 50, 206, 44, 216, 211, 218, 208, 33, 110, 57, 167,
-    128, 4, 5, 208, 9, 232, 1, 110, 177, 189, 206, 19, 131, 97, 150, 25, 105, 79, 213, 252, 121, 245, 102, 32, 4, 227,
-    98, 119, 179, 3, 202, 47, 101, 28, 182, 231, 92, 138, 145, 216, 16, 125, 34, 44, 139, 13, 186, 89, 232, 9, 138, 15,
-    103, 252, 207, 193, 115, 195, 6, 227, 23, 60, 246, 49, 91, 78, 76, 186, 187, 164, 41, 42, 214, 201, 186, 242, 173,
-    111, 219, 56, 78, 154, 67, 62, 149, 174, 23, 195, 253, 146, 35, 93, 139, 106, 40, 125, 70, 172, 12, 86, 154, 239,
-    149, 10, 226, 122, 94, 199, 201, 216, 183, 16, 118, 184, 47, 105, 123, 248, 213, 34, 6, 147, 106, 103, 101, 23, 37,
-    31, 1, 111, 206, 170, 220, 142, 218, 160, 234, 120, 25, 122, 70, 225, 167, 58, 62, 252, 111, 107, 110, 33, 101, 157,
-    45, 130, 124, 231, 87, 196, 130, 119, 186, 70, 120, 223, 50, 149, 28, 109, 82, 73, 225, 168, 214, 113, 118, 84, 125,
-    183, 113, 132, 158, 179, 198, 80, 87, 245, 38, 106, 219, 224, 5, 247, 221, 122, 185, 194, 44, 110, 23, 146, 176,
-    116, 28, 178, 27, 196, 47, 232, 56, 212, 163, 209, 25, 1, 253, 74, 243, 252, 197, 140, 237, 98, 141, 172, 197, 212,
-    113, 125, 39, 97, 39, 97, 230, 131, 122, 90, 177, 117, 111, 163, 41, 52, 78, 79, 229, 18, 144, 206, 216, 15, 155,
-    149, 177, 62, 60, 23, 206, 225, 191, 46, 235, 199, 151, 68, 137, 212, 2, 117, 36, 7, 27, 27, 7, 82, 138, 64, 27,
-    150, 231, 18, 4, 15, 48, 30, 57, 28, 11, 96, 198, 209, 113, 211, 221, 252, 225, 206, 61, 116, 124, 84, 219, 253,
-    230, 211, 227, 245, 110, 185, 20, 90, 18, 138, 98, 254, 241, 125, 186, 115, 189, 38, 244, 124, 54, 58, 23, 164, 50,
-    8, 162, 98, 43, 105, 9, 107, 175, 47, 244, 33, 137, 82, 139, 18, 148, 35, 110, 108, 202, 236, 0, 175, 65, 117, 103,
-    99, 182, 44, 152, 228, 11, 26, 213, 199, 80, 112, 206, 70, 84, 45, 104, 155, 21, 15, 103, 253, 61, 100, 121, 252,
-    87, 170, 121, 1, 59, 73, 218, 99, 161, 43, 53, 154, 65, 143, 190, 83, 53, 219, 209, 73, 132, 10, 10, 106, 44, 75,
-    27, 138, 78, 233, 41, 10, 93, 227, 110, 104, 91, 223, 115, 38, 202, 14, 211, 177, 254, 181, 147, 184, 198, 124, 166,
-    255, 227, 237, 106, 215, 150, 255, 184, 201, 84, 196, 4, 40, 125, 13, 60, 194, 11, 17, 50, 13, 41, 9, 199, 245, 203,
-    245, 210, 4, 21, 86, 153, 241, 126, 41, 18, 223, 16, 84, 60, 191, 164, 159, 232, 128, 43, 138, 50, 156, 50, 123, 80,
-    250, 208, 147, 246, 66, 149, 174, 235, 126, 4, 114, 154, 252, 10, 151, 163, 119, 224, 243, 41, 84, 6, 188, 88, 165,
-    106, 171, 224, 125, 176, 5, 26, 89, 44, 248, 139, 220, 38, 68, 198, 200, 180, 185, 242, 251, 30, 13, 164, 67, 99,
-    46, 25, 116, 160, 124, 232, 154, 15, 3, 113, 17, 153, 178, 21, 134, 199, 176, 150, 45, 55, 74, 37, 10, 98, 5, 237,
-    6, 201, 215, 20, 57, 190, 106, 244, 201, 142, 251, 217, 182, 182, 22, 254, 69, 33, 15, 250, 161, 188, 30, 60, 22,
-    169, 121, 205, 243, 167, 1, 25, 144, 179, 134, 194, 52, 129, 3, 165, 84, 203, 189, 104, 69, 153, 204, 153, 234, 90,
-    241, 121, 69, 194, 138, 47, 212, 62, 159, 179, 52, 42, 200, 59, 219, 208, 211, 77, 219, 168, 242, 246, 167, 15, 237,
-    71, 130, 104, 24, 169, 31, 37, 15, 231, 115, 175, 59, 63, 68, 208, 78, 244, 194, 61, 231, 86, 161, 103, 108, 23,
-    163, 233, 189, 186, 204, 44, 212, 90, 165, 230, 234, 25, 160, 70, 155, 150, 214, 209, 113, 47, 44, 92, 163, 123,
-    191, 32, 30, 78, 165, 52, 159, 53, 22, 124, 223, 254, 192, 73, 207, 137, 209, 68, 111, 142, 63, 0, 13, 143, 169,
-    130, 40, 220, 184, 49, 116, 229, 179, 190, 193, 197, 107, 214, 136, 31, 19, 64, 37, 218, 75, 124, 155, 105, 246, 92,
-    218, 7, 70, 66, 246, 242, 155, 44, 83, 87, 104, 183, 43, 114, 133, 108, 35, 228, 82, 79, 168, 88, 83, 162, 212, 50,
-    59, 190, 249, 27, 128, 154, 168, 106, 180, 28, 55, 37, 209, 48, 46, 124, 27, 144, 246, 38, 67, 172, 211, 234, 72,
-    57, 14, 91, 5, 204, 188, 179, 55, 176, 42, 140, 88, 155, 241, 108, 205, 92, 11, 62, 106, 29, 180, 97, 224, 207, 13,
-    235, 39, 208, 11, 66, 149, 241, 29, 149, 70, 81, 138, 201, 178, 15, 72, 25, 47, 163, 148, 106, 242, 132, 7, 121,
-    166, 72, 253, 245, 151, 215, 215, 130, 58, 139, 212, 16, 117, 250, 183, 29, 32, 194, 217, 248, 208, 132, 139, 20,
-    60, 168, 29, 23, 72, 33, 197, 79, 174, 227, 166, 247, 77, 9, 107, 133, 176, 55, 52, 236, 249, 143, 90, 45, 233, 173,
-    226, 161, 48, 176, 107, 182, 54, 163, 112, 11, 254, 31, 74, 191, 93, 114, 131, 214, 78, 157, 111, 139, 240, 241, 72,
-    96, 189, 124, 178, 183, 145, 239, 40, 187, 109, 27, 44, 24, 22, 182, 192, 16, 88, 86, 29, 150, 213, 222, 13, 130,
-    26, 225, 195, 136, 139, 205, 134, 103, 133, 209, 152, 46, 173, 59, 118, 139, 181, 66, 37, 68, 215, 201, 64, 209,
-    100, 85, 199, 148, 62, 41, 212, 194, 79, 181, 246, 218, 203, 91, 147, 136, 57, 172, 102, 226, 108, 40, 83, 231, 6,
-    91, 79, 116, 137, 229, 223, 29, 185, 212, 133, 37, 151, 73, 174, 138, 156, 167, 176, 46, 232, 184, 109, 51, 156,
-    164, 171, 6, 202, 205, 240, 164, 148, 212, 243, 153, 60, 189, 229, 7, 144, 42, 193, 184, 126, 56, 125, 230, 227,
-    244, 189, 197, 169, 218, 9, 51, 3, 214, 254, 157, 142, 30, 242, 198, 88, 160, 187, 92, 151, 184, 173, 251, 220, 126,
-    102, 92, 109, 144, 86, 67, 120, 182, 51, 245, 210, 204, 84, 111, 62, 113, 53, 238, 11, 79, 254, 140, 26, 40, 34, 19,
-    164, 22, 142, 101, 127, 251, 147, 22, 112, 192, 195, 107, 70, 23, 118, 219, 82, 124, 231, 189, 7, 206, 50, 122, 156,
-    58, 181, 245, 41, 174, 138, 190, 106, 246, 192, 155, 235, 218, 63, 171, 74, 142, 72, 188, 85, 40, 30, 91, 42, 237,
-    165, 106, 14, 136, 149, 224, 34, 47, 83, 11, 204, 171, 204, 31, 221, 162, 31, 220, 219, 139, 238, 191, 77, 207, 185,
-    9, 218, 85, 126, 191, 233, 34, 132, 233, 85, 7, 115, 15, 86, 112, 108, 47, 127, 157, 250, 170, 217, 217, 39, 228,
-    110, 128, 250, 197, 232, 4, 184, 149, 4, 185, 55, 150, 81, 11, 95, 160, 17, 177, 94, 165, 223, 193, 140, 76, 197,
-    23, 93, 238, 48, 231, 88, 91, 65, 95, 185, 6, 103, 201, 56, 237, 236, 92, 85, 32, 212, 50, 232, 149, 145, 7, 246,
-    170, 142, 221, 58, 206, 65, 85, 215, 238, 243, 203, 254, 173, 123, 209, 5, 135, 32, 75, 104, 94, 217, 132, 108, 210,
-    43, 152, 138, 150, 106, 125, 188, 180, 167, 246, 239, 53, 157, 38, 95, 84, 71, 190, 117, 80, 18, 82, 85, 61, 191,
-    107, 85, 170, 81, 162, 244, 129, 99, 211, 104, 125, 209, 166, 19, 204, 87, 204, 172, 174, 222, 71, 142, 189, 156,
-    37, 162, 100, 187, 10, 22, 86, 124, 237, 231, 160, 230, 221, 246, 63, 48, 30, 91, 197, 23, 13, 210, 227, 226, 247,
-    25, 123, 15, 200, 80, 222, 69, 240, 26, 9, 139, 27, 58, 165, 2, 183, 124, 79, 105, 79, 63, 212, 40, 6, 118, 153,
-    178, 55, 150, 242, 54, 197, 98, 87, 110, 133, 204, 89, 61, 121, 164, 126, 184, 176, 108, 242, 67, 69, 70, 100, 92,
-    1, 149, 205, 51, 218, 127, 213, 236, 49, 55, 88, 33, 183, 199, 91, 125, 136, 100, 123, 217, 62, 115, 46, 226, 115,
-    206, 108, 112, 83, 178, 178, 209, 24, 56, 41, 131, 184, 53, 142, 183, 65, 251, 21, 236, 22, 56, 189, 0, 167, 2, 176,
-    201, 28, 170, 61, 17, 161, 140, 181, 83, 54, 223, 75, 151, 103, 188, 166, 67, 51, 152, 27, 124, 85, 4, 114, 41, 157,
-    35, 99, 221, 171, 42, 30, 238, 19, 208, 201, 45, 119, 74, 168, 211, 29, 13, 58, 221, 152, 143, 87, 115, 248, 13, 98,
-    108, 148, 13, 45, 67, 102, 121, 139, 17, 237, 10, 108, 84, 61, 218, 89, 70, 72, 153, 117, 111, 107, 165, 114, 239,
-    85, 141, 127, 46, 55, 51, 202, 211, 85, 158, 36, 114, 51, 67, 216, 104, 198, 128, 76, 5, 168, 143, 89, 36, 208, 37,
-    129, 48, 254, 12, 166, 3, 242, 36, 59, 136, 93, 128, 139, 159, 34, 22, 100, 95, 32, 39, 213, 145, 210, 161, 231, 74,
-    170, 251, 65, 34, 204, 4, 190, 168, 113, 96, 9, 183, 186, 120, 125, 85, 245, 201, 159, 208, 17, 169, 179, 117, 79,
-    196, 47, 33, 149, 48, 148, 204, 131, 208, 199, 89, 116, 79, 49, 33, 184, 70, 208, 117, 200, 75, 243, 148, 3, 162,
-    95, 229, 233, 190, 214, 7, 232, 234, 126, 175, 121, 108, 129, 29, 111, 72, 229, 38, 41, 91, 133, 169, 127, 186, 211,
-    124, 115, 243, 155, 205, 176, 103, 226, 3, 98, 37, 154, 228, 153, 75, 90, 77, 214, 158, 149, 111, 75, 118, 75, 233,
-    219, 172, 193, 204, 93, 178, 24, 177, 25, 84, 212, 8, 216, 134, 90, 169, 238, 177, 58, 4, 142, 37, 22, 103, 186, 10,
-    77, 182, 175, 116, 25, 49, 121, 230, 139, 169, 86, 92, 214, 46, 14, 126, 167, 217, 90, 146, 135, 249, 76, 253, 228,
-    95, 77, 181, 215, 217, 21, 130, 57, 194, 67, 43, 27, 124, 52, 134, 158, 148, 238, 57, 50, 228, 81, 92, 168, 58, 113,
-    8, 104, 250, 94, 65, 123, 147, 26, 142, 108, 82, 57, 168, 50, 97, 90, 249, 191, 182, 34, 180, 35, 8, 27, 87, 84,
-    207, 246, 74, 66, 50, 31, 93, 1, 80, 63, 220, 88, 25, 203, 148, 170, 192, 54, 117, 162, 51, 239, 92, 218, 193, 92,
-    206, 145, 46, 77, 33, 36, 36, 72, 251, 154, 211, 140, 186, 57, 168, 52, 92, 122, 141, 81, 68, 9, 254, 56, 189, 224,
-    43, 146, 177, 107, 215, 16, 35, 35, 91, 37, 205, 22, 136, 238, 24, 218, 58, 2, 129, 21, 163, 26, 145, 91, 72, 131,
-    114, 48, 172, 134, 25, 49, 16, 205, 87, 8, 165, 96, 253, 48, 60, 39, 132, 155, 74, 201, 18, 169, 148, 43, 135, 94,
-    69, 41, 252, 73, 18, 173, 245, 144, 138, 186, 61, 30, 182, 234, 41, 210, 25, 83, 21, 168, 210, 226, 26, 106, 28,
-    194, 63, 113, 145, 206, 172, 179, 252, 234, 156, 209, 235, 206, 30, 179, 247, 152, 120, 127, 133, 235, 108, 3, 169,
-    240, 244, 237, 190, 233, 44, 153, 67, 116, 118, 47, 225, 184, 111, 199, 98, 90, 248, 73, 244, 71, 19, 195, 52, 202,
-    146, 237, 70, 67, 227, 151, 246, 101, 129, 177, 100, 190, 68, 41, 150, 49, 30, 199, 249, 56, 23, 64, 104, 143, 170,
-    94, 83, 237, 113, 140, 21, 80, 8, 7, 221, 101, 16, 183, 96, 95, 119, 50, 229, 78, 88, 246, 209, 39, 6, 217, 225,
-    189, 93, 155, 154, 241, 227, 66, 72, 89, 218, 98, 238, 37, 102, 51, 25, 174, 118, 60, 238, 99, 62, 85, 162, 141, 63,
-    153, 66, 45, 106, 85, 227, 247, 46, 230, 94, 208, 60, 203, 17, 215, 37, 237, 66, 29, 147, 55, 37, 152, 230, 207,
-    200, 131, 172, 103, 157, 29, 199, 120, 175, 11, 90, 184, 245, 78, 24, 244, 155, 83, 239, 28, 52, 97, 128, 10, 150,
-    115, 219, 211, 97, 71, 209, 227, 110, 194, 160, 89, 39, 129, 230, 30, 6, 206, 247, 205, 82, 156, 159, 11, 130, 226,
-    1, 71, 107, 55, 221, 129, 148, 225, 58, 230, 104, 23, 152, 74, 221, 156, 149, 93, 55, 73, 111, 3, 14, 134, 45, 43,
-    194, 205, 227, 240, 23, 200, 179, 56, 217, 151, 205, 113, 253, 6, 10, 127, 139, 171, 178, 233, 224, 132, 221, 149,
-    50, 143, 20, 166, 9, 60, 87, 194, 229, 31, 116, 222, 156, 125, 31, 7, 76, 213, 182, 255, 156, 77, 98, 212, 199, 123,
-    51, 187, 239, 154, 168, 102, 63, 230, 201, 148, 240, 116, 120, 62, 89, 150, 137, 69, 75, 15, 123, 230, 206, 36, 91,
-    191, 141, 1, 83, 74, 22, 235, 110, 47, 28, 120, 79, 73, 52, 25, 116, 6, 201, 214, 205, 141, 5, 89, 116, 17, 80, 228,
-    46, 190, 235, 81, 123, 243, 163, 154, 104, 8, 11, 219, 252, 105, 11, 247, 47, 104, 9, 244, 252, 199, 15, 160, 3,
-    118, 198, 69, 207, 227, 38, 36, 132, 105, 239, 2, 147, 16, 38, 199, 118, 160, 138, 28, 194, 187, 169, 99, 18, 85,
-    148, 86, 15, 26, 71, 105, 197, 78, 71, 35, 138, 209, 184, 3, 99, 11, 22, 93, 13, 204, 10, 198, 170, 27, 98, 250,
-    234, 15, 236, 131, 231, 121, 83, 158, 84, 39, 32, 190, 56, 133, 145, 135, 47, 77, 51, 109, 207, 225, 50, 93, 210,
-    35, 77, 141, 137, 162, 122, 123, 145, 118, 156, 46, 249, 25, 180, 71, 40, 48, 3, 221, 147, 225, 42, 193, 137, 71,
-    121, 60, 184, 204, 41, 211, 2, 171, 169, 46, 57, 149, 164, 243, 167, 232, 81, 142, 27, 129, 152, 9, 60, 178, 172,
-    46, 21, 252, 39, 220, 2, 114, 9, 18, 118, 114, 10, 110, 194, 134, 238, 125, 227, 136, 179, 181, 152, 211, 15, 7, 28,
-    61, 142, 194, 24, 39, 97, 172, 241, 181, 36, 70, 245, 5, 159, 158, 255, 95, 242, 167, 180, 223, 169, 29, 71, 145,
-    97, 152, 2, 4, 23, 211, 95, 53, 26, 8, 53, 193, 51, 31, 184, 18, 92, 159, 156, 218, 235, 130, 84, 144, 123, 2, 116,
-    163, 208, 37, 249, 137, 98, 152, 212, 156, 252, 65, 234, 241, 208, 43, 14, 89, 243, 171, 234, 202, 97, 150, 196, 15,
-    21, 90, 217, 213, 61, 199, 137, 135, 143, 120, 169, 201, 185, 161, 218, 9, 209, 12, 110, 37, 42, 170, 183, 130, 47,
-    247, 63, 29, 220, 204, 177, 148, 73, 92, 121, 49, 74, 223, 237, 7, 255, 25, 230, 237, 152, 169, 20, 40, 214, 189,
-    134, 229, 24, 5, 124, 126, 1, 6, 41, 115, 61, 231, 210, 242, 200, 45, 6, 102, 20, 31, 58, 193, 4, 122, 201, 191, 61,
-    244, 252, 67, 52, 61, 8, 52, 47, 248, 225, 90, 93, 228, 231, 179, 154, 40, 15, 74, 46, 9, 187, 218, 168, 135, 220,
-    29, 161, 244, 212, 255, 134, 108, 99, 47, 207, 19, 16, 198, 189, 228, 70, 205, 123, 119, 214, 61, 120, 34, 228, 139,
-    191, 19, 101, 15, 140, 115, 203, 206, 67, 145, 83, 243, 139, 195, 231, 89, 76, 81, 235, 214, 201, 27, 185, 42, 206,
-    216, 231, 254, 53, 179, 62, 26, 193, 237, 103, 129, 144, 239, 88, 214, 90, 59, 90, 76, 70, 191, 66, 9, 35, 168, 11,
-    101, 213, 166, 217, 65, 125, 237, 251, 70, 230, 31, 205, 89, 171, 27, 235, 134, 83, 13, 13, 194, 116, 104, 138, 9,
-    46, 49, 185, 119, 46, 57, 160, 58, 243, 190, 206, 51, 113, 32, 230, 162, 178, 174, 133, 75, 240, 169, 11, 111, 189,
-    169, 144, 242, 68, 225, 82, 193, 232, 64, 125, 34, 199, 88, 78, 55, 20, 93, 239, 214, 140, 4, 59, 93, 79, 96, 13,
-    250, 205, 71, 47, 30, 206, 140, 165, 127, 62, 194, 99, 250, 104, 151, 115, 250, 150, 235, 233, 214, 17, 141, 178,
-    176, 19, 238, 34, 238, 234, 35, 140, 210, 121, 188, 246, 85, 135, 138, 80, 195, 253, 24, 133, 35, 31, 161, 30, 32,
-    169, 77, 55, 156, 174, 57, 38, 146, 29, 187, 197, 1, 44, 193, 105, 43, 160, 242, 255, 133, 245, 130, 137, 111, 196,
-    30, 134, 20, 201, 253, 92, 72, 66, 239, 106, 98, 23, 32, 81, 132, 75, 13, 229, 132, 255, 21, 25, 105, 141, 174, 216,
-    145, 207, 129, 202, 35, 139, 51, 96, 20, 209, 159, 255, 133, 128, 219, 51, 119, 246, 230, 238, 129, 188, 129, 69,
-    210, 87, 46, 132, 189, 78, 217, 250, 177, 234, 81, 120, 206, 251, 117, 150, 208, 121, 64, 113, 31, 109, 72, 184,
-    129, 148, 102, 237, 154, 98, 177, 227, 182, 33, 51, 105, 151, 73, 103, 207, 155, 231, 251, 221, 167, 134, 52, 4,
-    238, 136, 160, 175, 252, 80, 80, 65, 128, 164, 241, 187, 186, 164, 198, 165, 121, 193, 113, 16, 68, 206, 25, 0, 57,
-    76, 126, 152, 187, 84, 115, 112, 163, 214, 92, 245, 203, 113, 168, 0, 175, 12, 219, 249, 14, 231, 116, 210, 66, 116,
-    20, 210, 158, 224, 170, 99, 27, 104, 88, 102, 62, 148, 18, 117, 90, 248, 227, 16, 212, 131, 246, 28, 94, 102, 83,
-    188, 78, 79, 204, 124, 148, 137, 24, 21, 28, 205, 43, 72, 181, 160, 252, 72, 134, 148, 72, 62, 57, 209, 28, 82, 118,
-    72, 148, 170, 148, 169, 191, 165, 0, 26, 17, 127, 142, 13, 103, 232, 120, 28, 188, 239, 212, 147, 189, 33, 155, 172,
-    182, 54, 138, 81, 134, 147, 170, 129, 198, 184, 167, 228, 193, 110, 119, 16, 89, 64, 65, 57, 56, 90, 130, 49, 217,
-    38, 16, 95, 30, 120, 0, 240, 77, 242, 196, 79, 174, 231, 234, 247, 250, 160, 12, 69, 20, 21, 83, 102, 218, 254, 65,
-    118, 167, 154, 36, 154, 177, 129, 77, 106, 206, 222, 250, 73, 28, 91, 52, 186, 129, 204, 109, 84, 7, 200, 165, 39,
-    69, 151, 140, 39, 220, 169, 135, 135, 42, 171, 54, 220, 9, 184, 189, 27, 91, 99, 48, 31, 215, 112, 115, 149, 138,
-    189, 63, 99, 48, 132, 125, 31, 11, 222, 53, 246, 254, 207, 163, 166, 78, 217, 77, 141, 57, 238, 208, 65, 18, 17,
-    159, 204, 159, 130, 210, 106, 218, 87, 145, 165, 24, 190, 115, 38, 5, 43, 222, 184, 211, 150, 139, 220, 204, 120,
-    130, 243, 233, 18, 153, 84, 149, 227, 10, 153, 124, 173, 5, 107, 214, 163, 35, 1, 0, 117, 187, 78, 152, 41, 85, 251,
-    238, 121, 109, 29, 130, 225, 67, 241, 122, 40, 35, 185, 109, 187, 248, 129, 84, 43, 22, 1, 158, 166, 73, 161, 179,
-    50, 0, 106, 220, 20, 83, 182, 39, 137, 89, 5, 200, 80, 205, 25, 147, 70, 182, 31, 225, 95, 22, 75, 43, 129, 233, 36,
-    153, 54, 215, 121, 127, 212, 210, 154, 24, 171, 135, 84, 10, 141, 183, 118, 102, 241, 128, 88, 167, 43, 69, 210,
-    219, 181, 37, 71, 86, 75, 201, 90, 16, 192, 160, 41, 63, 127, 148, 246, 77, 92, 57, 234, 17, 252, 166, 148, 83, 141,
-    154, 206, 34, 34, 247, 86, 228, 251, 18, 151, 113, 113, 121, 79, 13, 111, 163, 26, 142, 254, 66, 196, 102, 189, 180,
-    92, 63, 6, 6, 193, 203, 146, 81, 63, 144, 228, 122, 157, 249, 61, 194, 240, 81, 215, 212, 161, 168, 226, 228, 42,
-    203, 255, 187, 194, 91, 86, 132, 188, 118, 220, 179, 151, 195, 106, 246, 219, 236, 107, 215, 160, 184, 169, 116,
-    106, 137, 6, 192, 47, 16, 1, 186, 57, 222, 102, 87, 106, 215, 194, 87, 203, 248, 237, 77, 163, 49, 93, 26, 96, 76,
-    140, 95, 179, 7, 243, 114, 242, 40, 86, 215, 180, 0, 55, 146, 106, 236, 56, 90, 77, 82, 165, 115, 93, 33, 18, 180,
-    166, 59, 44, 133, 179, 37, 211, 158, 106, 15, 235, 235, 33, 229, 78, 164, 101, 108, 255, 77, 193, 88, 135, 89, 174,
-    186, 37, 255, 123, 84, 210, 37, 211, 235, 89, 152, 141, 193, 44, 123, 69, 205, 255, 190, 9, 220, 62, 224, 221, 72,
-    61, 102, 241, 67, 37, 73, 162, 162, 182, 148, 30, 226, 24, 230, 190, 54, 68, 202, 86, 21, 107, 151, 114, 35, 90, 51,
-    136, 53, 78, 31, 60, 236, 86, 65, 4, 251, 194, 109, 236, 241, 250, 27, 44, 242, 104, 111, 59, 133, 152, 195, 126,
-    188, 11, 90, 84, 99, 155, 21, 58, 25, 106, 216, 218, 104, 134, 73, 105, 37, 5, 60, 141, 241, 41, 73, 101, 36, 182,
-    102, 50, 85, 182, 81, 122, 80, 245, 66, 238, 91, 243, 97, 46, 99, 7, 102, 73, 48, 143, 116, 8, 96, 71, 74, 171, 99,
-    141, 68, 122, 211, 76, 137, 139, 239, 109, 188, 243, 203, 67, 137, 250, 166, 174, 239, 182, 154, 155, 142, 100, 62,
-    176, 32, 15, 75, 75, 174, 69, 47, 184, 173, 5, 253, 46, 113, 104, 22, 111, 175, 195, 20, 37, 88, 239, 120, 92, 233,
-    78, 27, 92, 141, 5, 33, 87, 249, 44, 254, 139, 28, 134, 96, 186, 126, 223, 71, 146, 62, 205, 146, 206, 248, 51, 14,
-    255, 43, 100, 207, 26, 159, 182, 168, 204, 187, 35, 227, 14, 124, 114, 107, 177, 177, 61, 105, 89, 193, 177, 56,
-    150, 24, 188, 132, 94, 55, 13, 118, 68, 53, 175, 63, 71, 105, 44, 91, 107, 55, 41, 86, 233, 101, 128, 230, 106, 226,
-    51, 60, 33, 209, 72, 79, 106, 229, 171, 224, 245, 210, 108, 90, 226, 92, 37, 101, 19, 238, 183, 95, 12, 149, 93,
-    243, 74, 243, 98, 17, 103, 17, 183, 100, 103, 65, 124, 12, 152, 16, 48, 72, 75, 119, 43, 248, 249, 146, 165, 76,
-    189, 81, 118, 118, 92, 252, 247, 254, 193, 87, 163, 56, 99, 79, 59, 9, 90, 111, 237, 238, 84, 94, 45, 152, 123, 169,
-    225, 158, 70, 154, 226, 2, 179, 134, 202, 146, 231, 199, 154, 85, 78, 27, 4, 244, 135, 19, 12, 206, 96, 38, 139,
-    110, 58, 154, 32, 172, 240, 70, 76, 33, 233, 101, 73, 96, 29, 228, 138, 71, 193, 172, 185, 214, 59, 109, 56, 202,
-    210, 201, 69, 162, 31, 226, 187, 36, 89, 188, 9, 111, 171, 19, 15, 97, 32, 76, 83, 212, 143, 47, 211, 180, 219, 157,
-    46, 226, 125, 171, 187, 36, 98, 100, 6, 123, 229, 195, 116, 20, 44, 92, 66, 62, 179, 139, 183, 140, 133, 34, 6, 251,
-    248, 201, 81, 142, 52, 204, 137, 54, 187, 102, 227, 114, 62, 71, 218, 160, 88, 182, 101, 50, 176, 35, 30, 146, 77,
-    219, 204, 10, 226, 83, 238, 114, 23, 224, 218, 100, 128, 15, 181, 234, 103, 156, 129, 177, 123, 14, 128, 2, 24, 157,
-    94, 70, 211, 40, 250, 79, 31, 152, 37, 27, 36, 102, 253, 215, 81, 191, 243, 196, 3, 110, 139, 152, 83, 117, 108,
-    193, 236, 119, 9, 228, 129, 210, 218, 155, 22, 186, 55, 148, 156, 207, 170, 254, 93, 89, 218, 70, 0, 170, 119, 155,
-    68, 87, 166, 28, 183, 113, 9, 48, 221, 38, 66, 113, 55, 1, 206, 78, 171, 88, 123, 213, 66, 146, 65, 49, 23, 223, 37,
-    252, 38, 184, 242, 247, 11, 162, 240, 68, 73, 13, 98, 98, 42, 70, 87, 119, 91, 8, 252, 146, 179, 144, 71, 213, 177,
-    176, 140, 180, 78, 134, 204, 250, 250, 176, 108, 10, 99, 189, 220, 20, 55, 191, 62, 85, 67, 116, 167, 14, 23, 194,
-    253, 122, 253, 69, 52, 23, 160, 104, 7, 186, 192, 177, 202, 52, 69, 193, 195, 147, 178, 67, 131, 207, 91, 204, 80,
-    168, 250, 118, 88, 241, 106, 95, 205, 215, 84, 128, 231, 211, 149, 103, 59, 252, 142, 29, 32, 113, 214, 225, 194,
-    218, 52, 131, 13, 81, 60, 224, 105, 176, 89, 200, 1, 29, 38, 99, 199, 58, 212, 254, 80, 0, 171, 19, 150, 149, 94,
-    234, 108, 193, 44, 255, 58, 214, 208, 61, 123, 75, 199, 31, 163, 90, 209, 17, 140, 169, 134, 252, 37, 145, 117, 58,
-    126, 19, 134, 35, 70, 255, 20, 195, 5, 38, 253, 122, 138, 26, 119, 78, 188, 132, 215, 212, 194, 175, 181, 86, 129,
-    209, 137, 222, 218, 164, 127, 141, 164, 139, 128, 12, 150, 91, 218, 48, 171, 19, 157, 156, 123, 163, 69, 179, 127,
-    61, 146, 57, 225, 83, 153, 157, 193, 154, 98, 120, 64, 226, 148, 93, 63, 48, 110, 65, 128, 39, 235, 245, 76, 178,
-    103, 226, 47, 20, 186, 137, 144, 21, 197, 0, 75, 64, 104, 204, 229, 81, 167, 202, 253, 57, 98, 18, 152, 39, 43, 225,
-    3, 247, 125, 6, 63, 98, 198, 105, 251, 9, 183, 146, 114, 121, 164, 195, 134, 118, 3, 192, 155, 191, 34, 252, 85, 43,
-    230, 124, 3, 65, 118, 89, 14, 62, 154, 177, 210, 82, 83, 143, 47, 181, 47, 184, 27, 249, 139, 59, 2, 173, 130, 6,
-    58, 168, 58, 101, 249, 38, 53, 210, 36, 235, 113, 92, 199, 83, 0, 250, 110, 115, 210, 4, 11, 101, 17, 243, 152, 232,
-    48, 0, 9, 97, 111, 182, 77, 21, 240, 144, 127, 1, 147, 41, 20, 238, 241, 117, 6, 145, 170, 162, 193, 92, 44, 219,
-    15, 132, 88, 235, 90, 35, 46, 171, 148, 7, 209, 91, 232, 192, 199, 79, 105, 20, 234, 109, 121, 60, 164, 232, 115,
-    98, 230, 27, 14, 65, 171, 210, 235, 209, 149, 28, 88, 174, 70, 134, 182, 132, 227, 96, 71, 58, 238, 80, 51, 92, 40,
-    69, 174, 197, 39, 200, 4, 23, 233, 43, 62, 8, 51, 76, 7, 85, 95, 242, 123, 249, 234, 137, 34, 62, 81, 205, 141, 210,
-    184, 24, 115, 153, 60, 100, 25, 149, 129, 12, 142, 1, 70, 174, 229, 165, 230, 65, 16, 102, 168, 9, 110, 233, 53,
-    247, 211, 153, 168, 217, 128, 163, 78, 7, 31, 235, 250, 107, 243, 113, 92, 67, 14, 92, 5, 188, 102, 67, 22, 126,
-    104, 211, 72, 119, 206, 17, 211, 248, 74, 18, 75, 63, 148, 40, 115, 53, 102, 210, 26, 7, 101, 56, 55, 162, 79, 90,
-    94, 4, 212, 153, 176, 251, 176, 33, 96, 118, 43, 38, 117, 184, 60, 148, 230, 107, 220, 184, 242, 244, 147, 193, 199,
-    242, 126, 84, 198, 151, 90, 82, 207, 187, 71, 144, 83, 173, 198, 180, 183, 158, 51, 61, 211, 235, 92, 67, 165, 56,
-    152, 88, 180, 176, 74, 202, 78, 56, 135, 239, 111, 119, 24, 233, 21, 205, 207, 98, 188, 63, 33, 14, 197, 101, 69,
-    247, 135, 213, 13, 222, 189, 94, 47, 87, 206, 167, 197, 23, 193, 4, 47, 43, 173, 84, 31, 147, 219, 142, 204, 104, 6,
-    241, 161, 131, 227, 132, 46, 168, 129, 230, 136, 224, 245, 61, 193, 165, 2, 120, 83, 197, 99, 246, 246, 113, 166,
-    146, 87, 105, 67, 247, 122, 23, 235, 242, 36, 35, 70, 150, 240, 115, 65, 142, 70, 102, 110, 154, 104, 24, 24, 142,
-    211, 163, 6, 47, 182, 123, 13, 87, 130, 194, 56, 69, 101, 218, 229, 84, 38, 186, 202, 230, 89, 237, 96, 139, 75, 37,
-    76, 8, 201, 157, 157, 146, 90, 163, 228, 241, 9, 17, 30, 69, 150, 10, 147, 81, 2, 230, 251, 80, 151, 26, 150, 221,
-    157, 199, 22, 59, 42, 30, 3, 177, 165, 133, 133, 128, 94, 75, 228, 168, 166, 94, 103, 140, 23, 253, 153, 251, 169,
-    15, 150, 23, 213, 79, 33, 186, 79, 18, 180, 82, 82, 144, 196, 70, 18, 115, 240, 83, 125, 39, 215, 17, 126, 173, 204,
-    127, 88, 251, 190, 166, 252, 70, 129, 147, 209, 186, 143, 142, 37, 103, 224, 10, 64, 236, 2, 115, 127, 249, 147, 31,
-    224, 116, 220, 181, 83, 212, 118, 187, 37, 34, 190, 237, 20, 201, 57, 237, 103, 184, 197, 187, 109, 150, 111, 136,
-    212, 13, 130, 239, 147, 43, 159, 159, 39, 214, 239, 120, 117, 132, 203, 28, 30, 163, 109, 75, 102, 211, 84, 42, 166,
-    223, 238, 133, 117, 188, 155, 104, 12, 200, 46, 248, 82, 161, 118, 108, 16, 238, 82, 16, 55, 13, 229, 21, 207, 24,
-    229, 140, 80, 32, 97, 73, 88, 7, 192, 102, 201, 135, 52, 36, 16, 92, 237, 11, 242, 15, 161, 234, 108, 244, 42, 51,
-    102, 187, 61, 74, 183, 162, 218, 110, 233, 184, 56, 7, 140, 158, 43, 155, 189, 166, 50, 246, 18, 12, 249, 55, 81,
-    96, 49, 149, 214, 185, 68, 122, 44, 195, 5, 191, 147, 189, 50, 252, 223, 191, 184, 241, 162, 124, 176, 75, 148, 161,
-    138, 120, 7, 136, 64, 133, 207, 208, 120, 129, 135, 153, 255, 76, 59, 85, 17, 53, 0, 89, 86, 169, 104, 119, 196,
-    169, 48, 55, 71, 152, 155, 225, 226, 96, 53, 59, 57, 69, 132, 71, 7, 204, 151, 167, 8, 246, 37, 81, 104, 3, 216,
-    204, 188, 57, 233, 25, 249, 35, 211, 183, 57, 47, 76, 177, 42, 188, 235, 66, 234, 109, 38, 154, 160, 36, 212, 245,
-    197, 105, 33, 49, 191, 22, 58, 255, 143, 43, 148, 218, 139, 43, 236, 55, 45, 113, 182, 90, 248, 57, 209, 119, 247,
-    250, 117, 246, 197, 150, 16, 101, 101, 156, 63, 199, 62, 41, 217, 158, 246, 27, 247, 161, 56, 132, 105, 165, 59, 34,
-    38, 105, 206, 80, 159, 154, 40, 200, 42, 109, 222, 119, 240, 129, 227, 109, 181, 42, 204, 206, 251, 131, 3, 125,
-    231, 36, 251, 171, 169, 55, 182, 141, 104, 118, 75, 162, 50, 74, 246, 96, 135, 161, 140, 155, 232, 214, 235, 201,
-    21, 235, 218, 224, 114, 29, 44, 35, 56, 167, 54, 207, 209, 190, 44, 160, 240, 188, 7, 59, 23, 244, 69, 224, 88, 2,
-    151, 235, 32, 7, 10, 219, 149, 72, 232, 244, 87, 89, 58, 53, 229, 21, 197, 70, 196, 51, 240, 87, 74, 19, 50, 124,
-    254, 138, 126, 162, 182, 182, 116, 208, 56, 104, 100, 182, 29, 128, 187, 131, 93, 189, 68, 106, 59, 87, 51, 166,
-    195, 8, 221, 68, 83, 13, 46, 158, 65, 82, 80, 252, 12, 12, 50, 45, 100, 2, 113, 3, 209, 3, 1, 91, 82, 64, 82, 215,
-    115, 167, 145, 186, 131, 254, 161, 181, 50, 50, 14, 224, 124, 100, 82, 193, 48, 181, 251, 227, 195, 120, 93, 158,
-    151, 223, 21, 248, 173, 119, 114, 215, 116, 83, 196, 247, 152, 94, 192, 236, 84, 93, 114, 101, 78, 206, 57, 218,
-    200, 222, 89, 166, 101, 162, 136, 55, 116, 195, 209, 74, 48, 13, 42, 165, 65, 255, 236, 234, 212, 26, 155, 17, 46,
-    244, 86, 248, 177, 59, 55, 78, 130, 145, 38, 230, 95, 196, 101, 115, 218, 225, 22, 94, 7, 128, 10, 243, 85, 240, 22,
-    180, 118, 100, 6, 74, 218, 187, 239, 40, 31, 21, 9, 159, 178, 161, 32, 96, 190, 221, 70, 251, 25, 203, 93, 213, 19,
-    220, 15, 39, 97, 25, 223, 121, 183, 44, 248, 33, 245, 222, 81, 234, 126, 180, 222, 3, 227, 153, 232, 84, 55, 91, 47,
-    78, 44, 237, 189, 67, 186, 213, 58, 175, 135, 183, 205, 25, 33, 245, 182, 242, 215, 119, 173, 235, 134, 171, 18, 59,
-    108, 132, 86, 165, 129, 184, 253, 234, 83, 22, 116, 21, 253, 99, 178, 27, 23, 95, 37, 6, 173, 155, 17, 95, 64, 96,
-    100, 88, 229, 171, 165, 41, 0, 118, 57, 173, 141, 88, 223, 151, 190, 175, 255, 116, 216, 243, 194, 233, 162, 184,
-    92, 123, 250, 23, 21, 115, 17, 222, 253, 32, 217, 40, 141, 189, 205, 84, 136, 172, 180, 41, 144, 199, 31, 128, 208,
-    75, 208, 221, 90, 25, 46, 192, 72, 62, 149, 131, 179, 249, 98, 111, 89, 27, 176, 233, 244, 5, 22, 72, 110, 112, 253,
-    189, 7, 46, 208, 16, 5, 204, 53, 14, 135, 231, 155, 7, 168, 14, 255, 48, 164, 56, 47, 35, 112, 40, 237, 37, 219,
-    175, 177, 170, 158, 159, 197, 143, 90, 226, 0, 47, 29, 206, 246, 233, 40, 120, 78, 10, 219, 57, 70, 44, 252, 145,
-    244, 42, 195, 237, 136, 172, 68, 193, 24, 9, 45, 172, 113, 230, 120, 193, 15, 19, 117, 248, 61, 23, 143, 16, 133,
-    243, 215, 117, 129, 169, 3, 180, 114, 145, 173, 228, 231, 40, 233, 124, 194, 107, 122, 213, 8, 177, 140, 3, 176,
-    215, 180, 155, 9, 51, 196, 162, 17, 208, 210, 234, 140, 124, 189, 205, 191, 54, 94, 113, 45, 38, 191, 44, 22, 105,
-    135, 19, 43, 128, 159, 196, 130, 126, 35, 240, 142, 87, 27, 159, 153, 129, 9, 211, 104, 95, 177, 71, 184, 127, 45,
-    137, 203, 195, 96, 50, 121, 252, 168, 20, 250, 109, 224, 120, 18, 21, 83, 52, 140, 187, 6, 233, 152, 193, 128, 35,
-    206, 26, 85, 202, 181, 47, 15, 194, 4, 255, 144, 239, 197, 69, 144, 52, 231, 167, 121, 68, 15, 193, 35, 39, 99, 232,
-    79, 82, 183, 25, 128, 91, 32, 171, 219, 253, 72, 52, 175, 13, 218, 42, 222, 179, 44, 241, 140, 23, 168, 168, 30,
-    214, 109, 129, 214, 80, 55, 147, 117, 155, 111, 174, 216, 104, 67, 133, 228, 76, 151, 52, 17, 125, 84, 236, 66, 185,
-    226, 176, 157, 183, 207, 117, 147, 42, 171, 143, 113, 103, 66, 112, 186, 177, 163, 157, 79, 88, 109, 161, 7, 128,
-    60, 80, 187, 101, 145, 181, 207, 200, 78, 206, 244, 8, 137, 233, 253, 130, 159, 127, 207, 129, 165, 231, 127, 211,
-    120, 227, 125, 23, 137, 225, 3, 183, 55, 46, 27, 88, 28, 96, 117, 64, 191, 50, 1, 104, 245, 237, 213, 208, 51, 1,
-    179, 219, 72, 212, 59, 163, 236, 119, 27, 115, 53, 80, 80, 170, 23, 50, 22, 119, 132, 124, 63, 247, 80, 105, 135,
-    198, 84, 215, 50, 249, 136, 48, 105, 222, 187, 70, 106, 206, 38, 209, 157, 203, 125, 143, 99, 163, 210, 143, 116,
-    187, 218, 207, 194, 229, 51, 95, 152, 163, 243, 178, 212, 207, 11, 71, 126, 158, 106, 216, 248, 78, 209, 121, 33, 5,
-    188, 235, 237, 228, 103, 50, 176, 178, 0, 58, 201, 96, 12, 118, 125, 223, 122, 197, 105, 244, 6, 65, 132, 88, 75,
-    251, 213, 191, 129, 184, 243, 160, 130, 191, 91, 170, 82, 183, 178, 69, 0, 133, 59, 26, 169, 92, 242, 69, 165, 72,
-    10, 245, 219, 92, 136, 61, 242, 171, 64, 145, 132, 37, 186, 151, 161, 148, 149, 89, 129, 189, 78, 170, 110, 107,
-    228, 195, 68, 83, 194, 157, 46, 34, 249, 63, 86, 229, 180, 53, 98, 104, 127, 227, 153, 233, 68, 235, 234, 7, 134,
-    136, 191, 119, 243, 159, 72, 120, 190, 88, 69, 190, 65, 99, 52, 78, 233, 68, 184, 30, 80, 13, 224, 84, 72, 112, 40,
-    162, 71, 166, 165, 217, 121, 177, 65, 125, 157, 213, 190, 124, 165, 112, 137, 252, 178, 124, 14, 118, 115, 172, 200,
-    235, 159, 253, 19, 243, 85, 255, 142, 20, 73, 81, 23, 213, 102, 103, 214, 13, 219, 186, 238, 109, 247, 216, 248,
-    161, 103, 26, 129, 127, 126, 58, 54, 169, 133, 194, 82, 99, 209, 124, 126, 94, 163, 75, 64, 58, 159, 165, 190, 106,
-    208, 225, 149, 224, 19, 148, 42, 18, 244, 14, 2, 110, 102, 228, 103, 181, 17, 102, 208, 15, 159, 1, 39, 104, 12, 50,
-    56, 195, 135, 158, 96, 135, 177, 72, 59, 22, 1, 38, 36, 127, 240, 133, 109, 94, 173, 152, 172, 62, 162, 198, 54, 71,
-    236, 24, 92, 37, 225, 105, 176, 215, 233, 145, 109, 47, 229, 209, 84, 61, 182, 168, 35, 172, 251, 3, 113, 68, 161,
-    219, 126, 15, 151, 154, 193, 243, 214, 51, 164, 183, 163, 166, 176, 134, 123, 111, 14, 125, 215, 242, 1, 69, 135,
-    213, 102, 148, 140, 105, 169, 230, 246, 7, 207, 17, 57, 117, 49, 174, 138, 7, 194, 26, 161, 105, 236, 243, 89, 67,
-    177, 8, 8, 36, 97, 87, 31, 38, 165, 198, 99, 72, 89, 5, 190, 13, 110, 207, 62, 102, 58, 224, 52, 191, 36, 91, 41,
-    70, 72, 80, 251, 224, 56, 213, 1, 227, 124, 249, 33, 156, 247, 189, 252, 156, 53, 19, 225, 108, 111, 200, 2, 27, 86,
-    207, 196, 195, 30, 94, 126, 241, 140, 192, 0, 238, 125, 135, 201, 185, 101, 177, 135, 16, 150, 26, 179, 142, 250,
-    230, 126, 60, 8, 81, 220, 212, 53, 67, 150, 202, 45, 190, 240, 136, 119, 43, 247, 248, 63, 117, 198, 39, 184, 188,
-    107, 247, 136, 155, 17, 30, 110, 246, 161, 38, 149, 238, 69, 43, 161, 231, 123, 211, 26, 225, 80, 199, 17, 158, 80,
-    115, 107, 59, 229, 183, 198, 73, 68, 200, 235, 234, 63, 42, 192, 207, 88, 104, 74, 223, 191, 70, 251, 99, 80, 5,
-    165, 205, 164, 28, 115, 154, 85, 78, 235, 88, 8, 66, 220, 150, 36, 70, 235, 20, 121, 166, 96, 231, 255, 159, 198,
-    239, 48, 143, 168, 33, 250, 179, 7, 239, 81, 70, 17, 244, 78, 184, 138, 218, 68, 45, 151, 77, 213, 236, 142, 24,
-    232, 226, 83, 108, 120, 191, 168, 206, 96, 71, 202, 6, 127, 7, 197, 215, 46, 72, 136, 94, 47, 229, 18, 55, 156, 95,
-    230, 142, 242, 102, 193, 93, 79, 205, 58, 68, 77, 41, 145, 41, 165, 239, 24, 139, 48, 205, 113, 93, 202, 198, 138,
-    10, 130, 29, 9, 152, 62, 226, 140, 210, 214, 82, 223, 158, 171, 239, 176, 37, 42, 45, 234, 215, 86, 219, 185, 147,
-    178, 74, 109, 137, 222, 0, 75, 235, 106, 118, 0, 35, 102, 142, 215, 171, 177, 135, 194, 150, 47, 73, 178, 158, 55,
-    13, 70, 67, 231, 172, 24, 168, 67, 151, 113, 158, 40, 126, 151, 213, 243, 193, 170, 103, 33, 231, 61, 234, 168, 44,
-    162, 79, 197, 236, 136, 77, 248, 65, 186, 90, 126, 78, 41, 61, 98, 212, 116, 117, 227, 152, 7, 27, 66, 135, 233, 34,
-    168, 194, 66, 223, 185, 1, 60, 150, 116, 157, 164, 225, 103, 248, 153, 240, 103, 129, 60, 147, 110, 233, 196, 6,
-    206, 106, 90, 251, 171, 145, 12, 22, 136, 183, 127, 209, 95, 188, 57, 138, 17, 209, 92, 10, 114, 160, 215, 48, 125,
-    209, 191, 218, 168, 198, 104, 5, 50, 21, 42, 0, 167, 132, 85, 75, 95, 22, 250, 84, 39, 235, 71, 247, 233, 111, 228,
-    63, 143, 60, 145, 15, 247, 106, 52, 121, 239, 222, 73, 119, 113, 92, 157, 22, 46, 23, 72, 174, 149, 151, 220, 191,
-    79, 34, 251, 200, 176, 135, 216, 76, 34, 77, 17, 38, 168, 101, 135, 189, 80, 170, 234, 134, 241, 23, 62, 198, 76,
-    182, 199, 164, 109, 78, 169, 244, 123, 164, 53, 158, 90, 158, 206, 227, 174, 23, 165, 67, 24, 101, 74, 165, 113,
-    156, 102, 196, 243, 175, 152, 184, 227, 5, 99, 55, 16, 118, 103, 237, 142, 122, 202, 107, 114, 3, 64, 199, 109, 217,
-    120, 135, 45, 209, 197, 165, 50, 239, 155, 141, 243, 139, 208, 111, 61, 49, 249, 224, 214, 244, 150, 64, 191, 206,
-    135, 67, 70, 11, 110, 156, 57, 191, 66, 124, 100, 142, 160, 173, 222, 221, 207, 76, 4, 55, 111, 46, 163, 249, 215,
-    141, 105, 63, 116, 81, 103, 167, 165, 53, 234, 214, 162, 172, 250, 104, 21, 69, 144, 33, 150, 132, 34, 244, 152,
-    211, 27, 97, 105, 212, 48, 99, 249, 121, 165, 197, 203, 235, 31, 166, 183, 169, 116, 35, 123, 177, 84, 221, 61, 53,
-    10, 153, 254, 29, 28, 91, 19, 65, 140, 90, 87, 182, 191, 93, 199, 92, 193, 43, 179, 238, 86, 232, 166, 238, 114,
-    251, 96, 219, 23, 70, 97, 212, 103, 198, 29, 24, 107, 26, 41, 236, 112, 153, 32, 50, 1, 202, 153, 217, 204, 195, 37,
-    187, 147, 35, 66, 39, 93, 116, 77, 179, 38, 205, 228, 244, 126, 241, 214, 30, 14, 147, 121, 3, 64, 161, 197, 2, 156,
-    245, 166, 32, 66, 115, 89, 154, 134, 37, 161, 102, 172, 251, 166, 123, 6, 52, 228, 141, 96, 243, 114, 197, 243, 245,
-    53, 39, 9, 146, 73, 110, 221, 172, 249, 28, 121, 188, 16, 115, 203, 134, 14, 101, 164, 126, 185, 49, 216, 34, 135,
-    104, 126, 67, 242, 154, 40, 244, 112, 189, 34, 68, 178, 110, 234, 17, 80, 115, 207, 239, 52, 69, 110, 228, 44, 180,
-    249, 250, 213, 97, 41, 184, 116, 44, 21, 128, 158, 65, 76, 93, 132, 205, 7, 3, 36, 83, 253, 94, 71, 65, 37, 85, 159,
-    21, 145, 251, 76, 150, 81, 167, 112, 54, 25, 19, 97, 76, 105, 206, 78, 247, 12, 163, 96, 96, 150, 210, 138, 113,
-    183, 137, 106, 57, 188, 52, 78, 162, 215, 192, 32, 149, 109, 83, 187, 145, 47, 99, 54, 201, 131, 199, 43, 73, 136,
-    255, 10, 91, 214, 12, 41, 177, 72, 249, 32, 109, 70, 46, 181, 29, 38, 188, 164, 138, 101, 185, 195, 174, 204, 48, 7,
-    189, 111, 205, 134, 194, 150, 61, 96, 93, 215, 170, 80, 92, 234, 229, 17, 127, 233, 247, 96, 52, 251, 64, 96, 227,
-    166, 255, 58, 229, 99, 132, 251, 251, 222, 6, 166, 174, 222, 226, 72, 184, 72, 69, 162, 210, 192, 26, 44, 105, 167,
-    15, 27, 47, 81, 188, 189, 249, 129, 48, 245, 210, 170, 35, 212, 19, 47, 201, 143, 72, 168, 2, 130, 234, 35, 1, 32,
-    69, 73, 152, 179, 180, 225, 151, 181, 135, 77, 180, 209, 6, 212, 231, 111, 58, 167, 49, 60, 40, 136, 23, 169, 16, 5,
-    77, 254, 26, 235, 210, 224, 156, 184, 25, 46, 110, 174, 85, 90, 23, 235, 114, 200, 75, 121, 129, 1, 132, 137, 41,
-    137, 146, 135, 164, 54, 11, 190, 250, 161, 181, 168, 244, 6, 225, 219, 223, 190, 109, 75, 74, 175, 232, 251, 161,
-    183, 6, 92, 10, 244, 250, 42, 155, 136, 24, 97, 26, 11, 56, 202, 82, 200, 192, 5, 66, 131, 235, 118, 43, 111, 112,
-    186, 162, 73, 171, 197, 198, 145, 61, 196, 32, 110, 177, 238, 229, 12, 167, 203, 129, 219, 117, 7, 10, 237, 110,
-    206, 142, 72, 59, 85, 130, 76, 29, 141, 140, 165, 33, 129, 12, 88, 125, 219, 103, 174, 175, 188, 9, 180, 186, 120,
-    219, 233, 108, 192, 243, 33, 103, 173, 232, 161, 251, 135, 77, 235, 35, 72, 28, 212, 117, 148, 171, 205, 176, 84,
-    76, 253, 131, 248, 43, 65, 160, 196, 22, 11, 243, 108, 249, 23, 164, 13, 85, 86, 177, 55, 31, 159, 108, 233, 59, 22,
-    187, 181, 108, 217, 148, 9, 122, 160, 4, 83, 40, 238, 20, 76, 230, 23, 252, 221, 255, 148, 74, 144, 213, 132, 81,
-    111, 79, 19, 198, 243, 197, 46, 64, 77, 64, 90, 50, 215, 194, 231, 114, 19, 229, 61, 120, 182, 26, 52, 202, 147,
-    217, 195, 75, 35, 77, 197, 160, 66, 83, 123, 253, 149, 64, 96, 251, 249, 70, 136, 246, 6, 32, 79, 240, 211, 36, 30,
-    22, 174, 189, 23, 127, 84, 106, 138, 243, 19, 34, 204, 4, 122, 101, 94, 88, 84, 131, 255, 26, 239, 172, 44, 130, 81,
-    231, 112, 47, 121, 73, 226, 181, 173, 61, 248, 60, 144, 141, 228, 32, 12, 238, 23, 222, 19, 44, 159, 84, 177, 162,
-    228, 210, 242, 24, 134, 247, 11, 44, 207, 223, 127, 77, 87, 65, 134, 25, 94, 168, 7, 154, 173, 102, 225, 194, 203,
-    84, 120, 92, 6, 142, 133, 136, 202, 128, 35, 88, 238, 249, 227, 19, 8, 210, 81, 39, 20, 159, 194, 125, 188, 230, 76,
-    62, 176, 128, 30, 77, 192, 135, 38, 172, 163, 194, 130, 22, 28, 117, 248, 49, 45, 239, 4, 229, 79, 50, 220, 110, 9,
-    85, 8, 221, 8, 95, 168, 75, 176, 87, 218, 38, 215, 254, 222, 115, 224, 7, 14, 57, 108, 86, 59, 61, 0, 25, 55, 14,
-    233, 44, 45, 230, 41, 129, 86, 16, 11, 204, 129, 54, 191, 195, 141, 148, 207, 182, 49, 245, 64, 144, 142, 211, 163,
-    152, 53, 173, 180, 71, 155, 96, 101, 27, 250, 173, 108, 227, 133, 195, 176, 104, 108, 155, 235, 185, 200, 118, 34,
-    236, 148, 226, 39, 224, 232, 126, 177, 97, 122, 247, 200, 118, 214, 34, 19, 190, 247, 158, 95, 120, 149, 33, 182,
-    179, 237, 108, 95, 188, 163, 226, 156, 227, 84, 69, 125, 61, 172, 101, 89, 198, 79, 6, 64, 25, 112, 73, 39, 206, 20,
-    116, 8, 205, 225, 148, 85, 55, 228, 123, 126, 75, 232, 94, 136, 65, 181, 30, 113, 207, 73, 39, 90, 254, 143, 225,
-    142, 12, 228, 131, 196, 194, 149, 207, 165, 27, 198, 4, 193, 217, 215, 255, 110, 247, 92, 169, 216, 11, 179, 41, 9,
-    15, 122, 230, 93, 209, 93, 94, 189, 102, 49, 220, 18, 105, 42, 189, 177, 86, 223, 142, 98, 39, 40, 244, 129, 57,
-    116, 21, 227, 241, 186, 205, 234, 20, 142, 187, 65, 154, 24, 210, 2, 194, 235, 196, 42, 191, 141, 16, 153, 86, 193,
-    254, 203, 15, 153, 121, 125, 83, 139, 38, 120, 23, 165, 73, 204, 83, 230, 166, 93, 114, 183, 159, 30, 148, 55, 138,
-    134, 222, 39, 196, 249, 103, 51, 97, 197, 137, 160, 154, 168, 42, 229, 27, 44, 24, 83, 105, 61, 254, 232, 157, 104,
-    20, 240, 58, 46, 185, 82, 95, 161, 151, 237, 208, 47, 155, 222, 224, 216, 11, 81, 181, 209, 15, 67, 28, 115, 47,
-    253, 240, 249, 116, 236, 13, 209, 51, 155, 244, 26, 254, 177, 181, 83, 44, 225, 69, 39, 206, 42, 69, 217, 107, 84,
-    14, 118, 178, 191, 191, 157, 25, 117, 185, 202, 26, 169, 77, 199, 238, 11, 34, 49, 143, 55, 94, 76, 12, 54, 242, 28,
-    202, 89, 130, 69, 235, 52, 171, 101, 81, 137, 134, 192, 13, 17, 48, 59, 9, 65, 59, 142, 251, 10, 198, 38, 95, 176,
-    71, 130, 1, 2, 18, 3, 80, 62, 11, 59, 59, 226, 253, 25, 76, 45, 170, 55, 201, 69, 238, 82, 123, 148, 82, 14, 150,
-    66, 8, 203, 151, 109, 126, 235, 4, 165, 221, 206, 22, 82, 226, 139, 246, 24, 251, 101, 45, 176, 247, 103, 216, 91,
-    140, 236, 33, 110, 167, 239, 83, 27, 130, 199, 181, 250, 194, 145, 119, 126, 54, 205, 142, 69, 56, 61, 87, 237, 75,
-    8, 16, 164, 134, 250, 237, 7, 183, 227, 244, 32, 53, 214, 16, 173, 79, 206, 247, 45, 199, 53, 153, 83, 190, 101, 91,
-    166, 119, 231, 118, 18, 68, 184, 159, 106, 45, 62, 212, 253, 60, 157, 205, 242, 89, 97, 226, 144, 74, 230, 248, 72,
-    247, 240, 86, 193, 71, 196, 80, 162, 134, 138, 65, 148, 200, 146, 249, 205, 185, 121, 217, 128, 82, 183, 103, 191,
-    212, 145, 198, 18, 27, 99, 217, 12, 18, 142, 48, 61, 97, 13, 123, 252, 195, 163, 152, 46, 33, 148, 118, 163, 58, 26,
-    51, 246, 158, 108, 182, 208, 58, 226, 116, 223, 130, 220, 137, 125, 143, 131, 3, 82, 183, 45, 20, 94, 247, 200, 219,
-    49, 121, 16, 189, 132, 129, 114, 174, 19, 194, 213, 48, 217, 93, 150, 92, 169, 95, 66, 223, 97, 57, 217, 158, 186,
-    31, 212, 185, 146, 119, 30, 63, 130, 44, 111, 205, 215, 163, 101, 15, 41, 51, 106, 66, 215, 226, 53, 37, 186, 84,
-    160, 9, 111, 26, 169, 136, 86, 144, 89, 127, 14, 8, 147, 47, 187, 122, 221, 165, 202, 126, 237, 5, 71, 207, 73, 147,
-    208, 169, 74, 138, 161, 14, 232, 132, 209, 193, 197, 94, 28, 36, 141, 21, 159, 105, 127, 151, 27, 198, 199, 217,
-    101, 213, 184, 49, 219, 76, 180, 65, 170, 80, 195, 104, 106, 106, 59, 157, 87, 152, 160, 96, 197, 84, 65, 242, 19,
-    5, 193, 151, 1, 154, 70, 190, 128, 90, 14, 83, 198, 233, 3, 79, 132, 166, 87, 77, 253, 62, 248, 180, 98, 156, 40,
-    237, 173, 198, 170, 192, 36, 151, 62, 7, 142, 220, 120, 198, 100, 0, 219, 35, 241, 196, 59, 117, 73, 33, 224, 195,
-    226, 11, 63, 15, 120, 192, 85, 197, 255, 177, 119, 64, 49, 126, 55, 237, 2, 201, 110, 12, 50, 178, 21, 141, 125, 4,
-    8, 237, 16, 236, 175, 247, 158, 6, 101, 96, 193, 213, 21, 74, 175, 45, 51, 216, 162, 226, 94, 173, 151, 217, 55,
-    158, 59, 19, 90, 178, 96, 201, 160, 241, 235, 14, 10, 238, 140, 216, 94, 159, 36, 28, 12, 97, 168, 215, 5, 38, 178,
-    242, 212, 26, 187, 55, 177, 108, 118, 17, 69, 75, 138, 192, 19, 104, 239, 179, 213, 66, 138, 129, 176, 214, 144, 81,
-    171, 155, 120, 105, 27, 139, 100, 221, 242, 90, 9, 212, 79, 208, 19, 39, 71, 35, 74, 118, 97, 218, 232, 191, 73,
-    196, 96, 149, 88, 113, 169, 99, 212, 219, 253, 144, 138, 85, 218, 60, 77, 154, 28, 239, 52, 205, 33, 104, 79, 75,
-    103, 68, 109, 58, 232, 140, 242, 171, 191, 142, 200, 230, 247, 50, 13, 225, 91, 53, 196, 67, 141, 164, 65, 33, 209,
-    204, 74, 244, 84, 82, 183, 177, 45, 164, 195, 41, 230, 65, 13, 178, 181, 225, 36, 189, 243, 62, 80, 42, 127, 101,
-    96, 117, 74, 0, 35, 196, 37, 7, 9, 0, 55, 122, 71, 227, 180, 125, 195, 12, 253, 21, 118, 73, 225, 133, 93, 117, 34,
-    167, 133, 84, 116, 100, 194, 182, 122, 195, 143, 189, 38, 182, 46, 79, 137, 173, 82, 144, 124, 255, 110, 154, 51,
-    30, 62, 71, 218, 30, 76, 218, 95, 49, 230, 157, 165, 67, 154, 2, 195, 251, 253, 231, 199, 215, 83, 125, 247, 125,
-    155, 150, 107, 119, 49, 195, 172, 249, 228, 174, 156, 106, 139, 103, 156, 255, 131, 89, 217, 240, 235, 191, 143,
-    195, 118, 247, 46, 156, 204, 160, 157, 182, 161, 145, 93, 212, 240, 177, 90, 32, 114, 146, 132, 118, 41, 210, 70, 6,
-    120, 117, 146, 104, 40, 91, 101, 137, 209, 21, 125, 3, 2, 159, 55, 243, 93, 93, 120, 159, 5, 7, 40, 122, 226, 185,
-    206, 154, 197, 0, 230, 254, 206, 55, 154, 232, 29, 66, 95, 124, 111, 19, 138, 164, 132, 117, 37, 72, 69, 23, 96,
-    144, 210, 209, 159, 9, 1, 92, 185, 15, 86, 157, 48, 135, 116, 24, 157, 2, 108, 188, 181, 61, 79, 134, 189, 49, 88,
-    203, 153, 226, 53, 49, 33, 89, 153, 81, 203, 213, 122, 79, 215, 254, 91, 44, 215, 59, 189, 121, 248, 20, 113, 158,
-    92, 6, 182, 204, 92, 49, 67, 132, 10, 182, 132, 235, 153, 68, 109, 234, 139, 171, 153, 85, 255, 214, 73, 52, 80,
-    190, 28, 34, 91, 214, 247, 24, 3, 95, 218, 56, 150, 196, 228, 251, 33, 154, 211, 85, 174, 35, 103, 211, 41, 137, 27,
-    146, 63, 253, 228, 210, 161, 87, 211, 158, 79, 183, 45, 234, 51, 71, 43, 105, 17, 149, 176, 66, 223, 0, 31, 31, 55,
-    48, 250, 125, 32, 182, 36, 149, 210, 39, 178, 60, 208, 201, 142, 158, 65, 128, 215, 100, 24, 199, 207, 249, 114,
-    191, 28, 3, 92, 120, 128, 152, 135, 244, 141, 203, 104, 47, 95, 231, 99, 192, 113, 162, 65, 243, 172, 79, 147, 93,
-    34, 35, 242, 182, 2, 238, 226, 138, 86, 139, 126, 44, 88, 150, 57, 57, 111, 120, 73, 101, 59, 105, 51, 150, 34, 195,
-    86, 204, 1, 44, 195, 42, 81, 107, 209, 96, 105, 46, 249, 4, 7, 250, 59, 83, 169, 199, 233, 100, 4, 136, 185, 149,
-    220, 238, 46, 14, 70, 87, 125, 201, 167, 223, 159, 6, 251, 166, 36, 194, 84, 156, 109, 74, 64, 249, 127, 58, 220,
-    80, 131, 66, 4, 153, 168, 28, 92, 115, 174, 229, 47, 7, 68, 110, 105, 244, 0, 236, 119, 43, 161, 66, 104, 143, 162,
-    61, 100, 130, 189, 76, 103, 42, 21, 161, 4, 45, 124, 187, 89, 19, 199, 140, 82, 233, 167, 13, 94, 206, 73, 94, 217,
-    52, 11, 158, 157, 160, 140, 113, 6, 115, 219, 166, 205, 125, 213, 255, 192, 219, 183, 205, 64, 118, 208, 173, 122,
-    29, 22, 64, 121, 213, 184, 3, 145, 48, 87, 99, 178, 206, 60, 37, 207, 187, 29, 141, 81, 46, 122, 101, 160, 48, 104,
-    146, 242, 152, 196, 35, 217, 160, 159, 74, 167, 140, 226, 243, 215, 50, 125, 102, 6, 208, 16, 95, 1, 136, 225, 138,
-    249, 192, 85, 172, 206, 255, 234, 105, 198, 47, 90, 163, 99, 67, 189, 37, 129, 244, 122, 86, 161, 76, 13, 161, 242,
-    110, 182, 30, 237, 93, 109, 233, 144, 66, 206, 76, 179, 245, 133, 246, 215, 217, 68, 27, 7, 122, 205, 165, 218, 177,
-    224, 36, 60, 107, 149, 172, 61, 44, 200, 155, 209, 224, 230, 16, 250, 136, 119, 33, 141, 27, 17, 52, 203, 68, 245,
-    43, 167, 234, 251, 221, 52, 144, 44, 176, 143, 107, 118, 146, 172, 64, 148, 92, 248, 192, 94, 186, 98, 120, 172, 74,
-    188, 184, 36, 10, 192, 87, 214, 48, 122, 34, 191, 57, 223, 174, 113, 60, 152, 214, 60, 203, 15, 130, 65, 149, 1, 20,
-    227, 237, 79, 117, 248, 254, 203, 119, 148, 135, 49, 249, 94, 96, 128, 93, 78, 8, 232, 74, 155, 70, 154, 112, 188,
-    3, 161, 123, 54, 108, 241, 48, 10, 221, 19, 74, 204, 202, 7, 59, 192, 76, 245, 242, 145, 196, 246, 155, 123, 59, 40,
-    48, 134, 5, 53, 74, 91, 159, 242, 61, 56, 225, 231, 52, 174, 68, 178, 37, 73, 8, 141, 111, 193, 239, 251, 174, 41,
-    72, 198, 167, 141, 77, 249, 191, 133, 239, 182, 135, 224, 88, 85, 102, 220, 157, 86, 140, 40, 153, 25, 16, 202, 13,
-    51, 97, 253, 74, 238, 157, 177, 248, 184, 212, 212, 170, 21, 166, 34, 172, 228, 167, 182, 120, 61, 191, 112, 48, 55,
-    214, 195, 1, 254, 254, 46, 161, 122, 138, 95, 120, 186, 130, 143, 49, 145, 63, 228, 12, 96, 105, 115, 165, 17, 84,
-    124, 66, 123, 23, 91, 162, 29, 125, 31, 221, 12, 180, 158, 190, 250, 131, 86, 241, 195, 77, 110, 35, 7, 8, 9, 134,
-    212, 119, 194, 84, 197, 73, 10, 181, 143, 4, 243, 27, 116, 195, 0, 34, 157, 215, 138, 207, 51, 230, 12, 137, 173,
-    236, 112, 148, 32, 209, 45, 95, 143, 226, 243, 198, 159, 169, 176, 119, 136, 89, 42, 127, 176, 136, 224, 219, 220,
-    21, 245, 242, 124, 122, 168, 92, 245, 78, 58, 65, 125, 99, 87, 17, 215, 124, 115, 43, 104, 243, 23, 22, 50, 4, 51,
-    122, 31, 206, 198, 126, 233, 235, 223, 5, 251, 132, 60, 82, 124, 186, 208, 4, 12, 55, 152, 221, 50, 135, 254, 34,
-    40, 147, 217, 67, 211, 69, 244, 223, 14, 177, 214, 180, 131, 219, 56, 210, 37, 58, 169, 142, 150, 90, 249, 11, 174,
-    127, 36, 211, 7, 18, 223, 16, 101, 17, 55, 37, 85, 244, 76, 179, 112, 220, 19, 73, 108, 254, 146, 141, 142, 205,
-    148, 8, 24, 154, 78, 186, 185, 100, 110, 36, 195, 52, 132, 138, 61, 32, 18, 242, 176, 34, 127, 189, 186, 35, 254,
-    87, 244, 205, 54, 135, 134, 156, 151, 156, 191, 35, 72, 166, 43, 95, 52, 108, 244, 109, 13, 65, 62, 14, 153, 87, 53,
-    105, 218, 209, 171, 95, 242, 8, 170, 90, 216, 202, 135, 115, 244, 38, 218, 67, 223, 56, 181, 220, 3, 232, 81, 120,
-    66, 134, 111, 198, 163, 94, 252, 253, 4, 128, 224, 231, 126, 104, 86, 241, 251, 162, 52, 209, 169, 209, 223, 33, 21,
-    87, 94, 117, 199, 12, 120, 12, 94, 216, 5, 10, 121, 212, 94, 243, 172, 81, 65, 171, 65, 194, 124, 120, 35, 1, 11,
-    189, 132, 27, 66, 255, 155, 184, 209, 148, 22, 131, 248, 144, 20, 122, 28, 187, 78, 38, 67, 199, 113, 36, 39, 242,
-    121, 79, 39, 176, 88, 57, 110, 185, 222, 156, 97, 92, 112, 79, 98, 98, 79, 71, 106, 168, 29, 119, 45, 16, 17, 41,
-    164, 228, 61, 242, 154, 6, 67, 104, 201, 73, 45, 210, 92, 114, 84, 239, 180, 94, 229, 229, 174, 167, 45, 255, 155,
-    187, 142, 236, 204, 102, 151, 67, 98, 101, 69, 76, 97, 39, 160, 117, 4, 149, 222, 11, 216, 125, 88, 235, 182, 142,
-    38, 224, 49, 97, 225, 59, 181, 237, 6, 84, 78, 205, 7, 82, 109, 61, 98, 142, 176, 195, 13, 33, 97, 195, 113, 229,
-    188, 214, 26, 56, 187, 132, 111, 2, 92, 18, 28, 126, 61, 246, 223, 58, 90, 111, 72, 55, 125, 80, 73, 144, 153, 22,
-    186, 254, 4, 196, 105, 73, 42, 151, 255, 78, 67, 167, 162, 10, 243, 129, 32, 33, 189, 61, 171, 158, 53, 99, 25, 37,
-    144, 145, 70, 2, 110, 214, 24, 3, 130, 234, 94, 143, 27, 144, 199, 221, 48, 55, 145, 254, 243, 30, 60, 239, 202, 90,
-    151, 36, 65, 158, 242, 123, 125, 46, 20, 132, 100, 186, 246, 154, 166, 209, 247, 167, 146, 127, 111, 41, 200, 187,
-    93, 165, 196, 216, 186, 98, 1, 112, 209, 217, 246, 143, 60, 232, 165, 243, 122, 238, 124, 248, 31, 249, 71, 90, 13,
-    199, 47, 231, 1, 23, 225, 132, 134, 212, 101, 17, 37, 113, 197, 177, 245, 55, 231, 14, 55, 208, 194, 219, 134, 223,
-    100, 112, 191, 204, 145, 13, 130, 10, 24, 140, 119, 12, 21, 39, 173, 255, 206, 165, 247, 126, 148, 197, 52, 193,
-    104, 51, 67, 209, 222, 196, 32, 229, 135, 165, 48, 176, 231, 61, 46, 50, 166, 62, 142, 229, 178, 178, 110, 176, 183,
-    213, 177, 243, 222, 31, 194, 68, 44, 68, 108, 103, 184, 245, 54, 110, 3, 57, 57, 100, 224, 90, 168, 35, 37, 44, 160,
-    46, 86, 178, 134, 210, 230, 91, 7, 127, 98, 163, 192, 248, 164, 53, 65, 192, 19, 198, 114, 102, 207, 61, 147, 211,
-    144, 192, 192, 144, 186, 141, 101, 170, 139, 110, 208, 132, 24, 119, 92, 237, 138, 79, 64, 227, 27, 61, 117, 14, 24,
-    11, 93, 77, 72, 68, 150, 4, 42, 3, 253, 135, 43, 58, 86, 126, 244, 202, 245, 90, 45, 216, 200, 125, 70, 165, 250,
-    138, 82, 88, 37, 164, 173, 235, 96, 41, 3, 162, 255, 229, 219, 37, 163, 23, 52, 201, 23, 208, 118, 247, 90, 113,
-    190, 77, 59, 161, 41, 199, 140, 160, 81, 20, 106, 46, 55, 140, 115, 124, 25, 40, 18, 30, 85, 248, 111, 179, 83, 139,
-    236, 0, 113, 156, 157, 35, 219, 109, 79, 7, 234, 25, 140, 142, 190, 174, 222, 25, 93, 147, 115, 29, 189, 148, 227,
-    221, 237, 114, 73, 175, 195, 169, 152, 98, 240, 22, 9, 87, 54, 186, 227, 250, 120, 126, 245, 110, 17, 188, 16, 109,
-    80, 197, 210, 187, 13, 147, 204, 113, 200, 132, 227, 205, 76, 52, 88, 248, 144, 7, 9, 195, 229, 107, 124, 207, 52,
-    199, 138, 22, 116, 158, 150, 111, 201, 56, 63, 199, 201, 109, 210, 201, 119, 250, 5, 188, 238, 111, 229, 8, 160,
-    194, 203, 119, 176, 134, 99, 90, 227, 147, 223, 149, 50, 188, 86, 167, 84, 92, 211, 156, 178, 193, 103, 161, 156,
-    72, 208, 243, 226, 162, 149, 29, 92, 44, 78, 208, 108, 21, 201, 239, 119, 150, 218, 154, 255, 254, 151, 11, 243,
-    165, 65, 121, 221, 243, 167, 181, 169, 161, 167, 229, 77, 187, 8, 89, 243, 114, 0, 74, 229, 227, 23, 183, 32, 63,
-    110, 66, 173, 21, 168, 219, 96, 167, 198, 13, 226, 216, 72, 248, 248, 136, 248, 62, 172, 216, 37, 96, 126, 166, 14,
-    188, 99, 16, 211, 89, 166, 226, 90, 78, 85, 120, 79, 248, 210, 116, 97, 134, 60, 248, 150, 131, 32, 23, 205, 244,
-    74, 153, 144, 68, 196, 92, 79, 30, 237, 25, 169, 12, 91, 247, 227, 86, 204, 193, 26, 128, 176, 31, 194, 41, 200,
-    220, 211, 127, 14, 199, 229, 94, 1, 57, 35, 226, 233, 219, 143, 33, 71, 198, 22, 39, 243, 128, 69, 184, 225, 159,
-    23, 5, 185, 216, 156, 162, 38, 92, 201, 130, 88, 22, 163, 86, 200, 192, 125, 81, 15, 54, 167, 77, 125, 82, 0, 48,
-    246, 119, 57, 122, 25, 22, 156, 1, 124, 116, 197, 235, 122, 165, 128, 154, 201, 50, 58, 163, 223, 234, 254, 166,
-    197, 95, 6, 164, 153, 242, 193, 0, 190, 30, 234, 22, 50, 98, 63, 40, 146, 32, 175, 193, 153, 206, 97, 220, 228, 182,
-    115, 221, 101, 128, 226, 141, 92, 241, 29, 206, 158, 37, 70, 181, 231, 252, 46, 83, 67, 120, 132, 58, 152, 103, 254,
-    205, 64, 121, 47, 118, 87, 169, 98, 110, 53, 175, 253, 122, 58, 226, 90, 185, 39, 117, 14, 23, 164, 128, 15, 166,
-    115, 253, 188, 10, 209, 148, 102, 157, 147, 71, 245, 182, 204, 81, 200, 218, 215, 68, 86, 40, 243, 124, 155, 119,
-    108, 146, 15, 225, 39, 37, 27, 22, 106, 68, 111, 178, 109, 25, 143, 91, 73, 167, 101, 117, 24, 66, 109, 136, 104,
-    255, 54, 69, 121, 178, 101, 120, 238, 199, 69, 174, 101, 187, 252, 95, 254, 51, 91, 9, 26, 130, 36, 255, 15, 198,
-    252, 182, 36, 47, 254, 154, 102, 112, 131, 145, 97, 3, 209, 74, 249, 247, 171, 40, 220, 166, 119, 34, 86, 222, 171,
-    2, 190, 33, 153, 12, 3, 155, 219, 62, 41, 156, 159, 236, 124, 251, 175, 40, 117, 23, 188, 16, 142, 47, 201, 53, 63,
-    246, 28, 22, 161, 99, 70, 20, 80, 132, 224, 189, 197, 26, 114, 55, 22, 201, 25, 123, 177, 42, 189, 80, 138, 52, 59,
-    137, 186, 13, 233, 186, 61, 186, 238, 22, 200, 44, 143, 149, 205, 51, 47, 141, 204, 145, 183, 38, 141, 167, 53, 204,
-    136, 84, 131, 95, 151, 3, 148, 94, 70, 174, 138, 49, 29, 7, 211, 29, 161, 30, 204, 144, 89, 73, 53, 217, 55, 23,
-    237, 212, 173, 56, 214, 97, 8, 108, 72, 159, 134, 148, 124, 153, 42, 69, 134, 52, 77, 177, 29, 34, 14, 15, 249, 147,
-    161, 233, 72, 84, 74, 147, 97, 13, 101, 90, 57, 229, 141, 57, 113, 4, 243, 244, 115, 222, 133, 119, 112, 41, 244,
-    193, 188, 150, 165, 72, 227, 113, 167, 16, 167, 133, 98, 119, 20, 152, 207, 106, 233, 106, 210, 105, 247, 142, 250,
-    142, 110, 189, 35, 31, 223, 108, 181, 206, 74, 4, 151, 32, 27, 58, 17, 76, 111, 9, 73, 82, 112, 78, 144, 197, 92,
-    183, 81, 192, 105, 80, 147, 43, 215, 224, 231, 97, 254, 61, 16, 232, 167, 31, 59, 139, 201, 13, 60, 135, 5, 170, 10,
-    31, 65, 240, 72, 150, 203, 212, 176, 206, 209, 91, 54, 138, 233, 50, 135, 128, 68, 247, 112, 172, 54, 227, 167, 227,
-    6, 7, 144, 241, 67, 56, 206, 107, 20, 179, 99, 67, 130, 90, 210, 170, 54, 20, 1, 116, 158, 1, 0, 180, 229, 25, 54,
-    70, 21, 231, 90, 138, 28, 157, 25, 244, 151, 38, 73, 102, 148, 29, 204, 154, 53, 41, 5, 216, 16, 45, 102, 205, 94,
-    31, 186, 136, 64, 178, 202, 16, 241, 210, 242, 21, 176, 35, 188, 194, 171, 253, 200, 101, 70, 233, 237, 81, 244, 22,
-    103, 208, 91, 248, 215, 236, 27, 92, 3, 118, 201, 138, 181, 94, 112, 233, 54, 214, 166, 214, 202, 129, 193, 3, 154,
-    7, 219, 8, 125, 158, 115, 88, 73, 194, 202, 112, 51, 224, 144, 218, 39, 35, 11, 59, 133, 212, 14, 79, 36, 185, 117,
-    250, 157, 226, 109, 188, 245, 34, 142, 153, 62, 214, 7, 240, 240, 188, 145, 228, 233, 191, 137, 228, 226, 142, 84,
-    78, 219, 78, 69, 138, 222, 19, 54, 213, 107, 188, 20, 71, 123, 113, 149, 140, 251, 240, 56, 51, 21, 69, 178, 145,
-    130, 112, 43, 27, 24, 155, 89, 178, 255, 208, 207, 204, 17, 115, 221, 82, 133, 227, 62, 219, 167, 236, 203, 250,
-    142, 161, 99, 167, 231, 251, 82, 180, 215, 107, 168, 177, 93, 13, 34, 68, 119, 63, 221, 110, 38, 143, 52, 243, 79,
-    31, 112, 151, 102, 177, 2, 188, 153, 102, 84, 52, 215, 241, 128, 141, 209, 53, 82, 90, 96, 59, 201, 42, 212, 98, 44,
-    116, 177, 214, 141, 99, 150, 106, 60, 50, 32, 117, 8, 51, 45, 6, 207, 233, 157, 171, 16, 214, 246, 99, 47, 67, 52,
-    4, 16, 29, 220, 55, 55, 64, 49, 92, 46, 107, 141, 185, 105, 214, 242, 173, 235, 122, 35, 59, 35, 14, 185, 24, 51,
-    161, 193, 33, 112, 139, 176, 117, 29, 138, 136, 80, 119, 6, 135, 252, 81, 118, 34, 4, 96, 200, 236, 169, 3, 37, 178,
-    195, 222, 69, 206, 135, 112, 72, 63, 49, 23, 92, 19, 171, 165, 79, 168, 9, 66, 38, 106, 133, 91, 157, 73, 221, 50,
-    4, 252, 221, 124, 186, 63, 84, 125, 210, 23, 117, 229, 176, 102, 120, 223, 132, 102, 153, 37, 247, 203, 157, 227,
-    20, 54, 164, 218, 115, 254, 100, 147, 175, 212, 151, 63, 83, 170, 137, 74, 133, 127, 43, 11, 16, 240, 126, 164, 221,
-    126, 101, 169, 245, 35, 130, 199, 252, 26, 66, 215, 119, 169, 110, 32, 149, 138, 123, 230, 143, 135, 43, 14, 102,
-    102, 39, 239, 176, 77, 184, 143, 36, 198, 206, 255, 97, 46, 191, 230, 154, 17, 46, 27, 223, 71, 211, 207, 204, 101,
-    23, 171, 169, 158, 61, 10, 9, 113, 82, 129, 137, 148, 195, 239, 212, 237, 66, 2, 37, 34, 125, 51, 47, 36, 198, 240,
-    109, 6, 206, 15, 139, 15, 243, 147, 165, 188, 101, 205, 8, 99, 55, 28, 173, 248, 223, 39, 210, 213, 100, 151, 16,
-    254, 0, 63, 153, 43, 36, 154, 189, 145, 157, 241, 245, 155, 216, 49, 167, 196, 107, 203, 104, 124, 154, 80, 37, 65,
-    153, 112, 215, 46, 175, 179, 225, 41, 112, 50, 127, 57, 247, 32, 135, 169, 76, 172, 13, 23, 66, 167, 36, 64, 236,
-    121, 44, 99, 13, 124, 213, 210, 3, 37, 58, 234, 187, 247, 234, 42, 236, 86, 144, 154, 4, 195, 44, 180, 9, 10, 72,
-    171, 154, 71, 108, 48, 224, 248, 159, 107, 200, 242, 27, 194, 120, 19, 71, 169, 95, 104, 192, 2, 194, 44, 76, 57,
-    243, 125, 200, 160, 126, 113, 176, 130, 176, 109, 230, 121, 119, 224, 186, 129, 205, 145, 9, 7, 2, 4, 29, 6, 35, 43,
-    164, 118, 255, 21, 166, 136, 60, 78, 31, 145, 206, 177, 255, 189, 153, 234, 182, 157, 211, 31, 101, 131, 164, 231,
-    99, 75, 76, 100, 143, 181, 125, 241, 44, 188, 143, 213, 174, 163, 242, 222, 22, 116, 254, 206, 12, 149, 68, 224, 40,
-    55, 41, 183, 22, 104, 235, 16, 119, 135, 84, 72, 67, 240, 127, 237, 198, 198, 250, 220, 131, 106, 147, 229, 184, 50,
-    149, 78, 74, 249, 78, 94, 91, 75, 5, 228, 161, 122, 188, 158, 168, 226, 114, 1, 224, 233, 245, 167, 143, 17, 199,
-    36, 237, 135, 238, 193, 220, 119, 232, 105, 179, 20, 223, 48, 9, 120, 104, 194, 245, 178, 64, 6, 92, 222, 59, 236,
-    154, 226, 254, 245, 70, 170, 90, 181, 30, 70, 51, 97, 225, 88, 88, 255, 70, 29, 179, 81, 102, 243, 140, 215, 40, 85,
-    150, 95, 1, 106, 130, 9, 89, 242, 240, 230, 96, 33, 157, 171, 178, 248, 147, 157, 77, 25, 39, 41, 13, 167, 190, 152,
-    153, 184, 255, 82, 165, 52, 124, 241, 234, 113, 138, 229, 149, 53, 26, 36, 101, 245, 69, 123, 127, 73, 54, 247, 229,
-    30, 210, 69, 229, 92, 208, 47, 222, 70, 90, 10, 81, 17, 224, 197, 52, 65, 200, 93, 239, 42, 26, 250, 252, 14, 35,
-    58, 20, 204, 237, 100, 183, 212, 78, 165, 141, 181, 41, 182, 6, 121, 154, 1, 45, 125, 148, 142, 110, 101, 194, 58,
-    212, 198, 73, 247, 14, 188, 51, 231, 62, 124, 201, 18, 197, 157, 128, 171, 33, 105, 128, 2, 174, 45, 19, 208, 52,
-    133, 127, 40, 123, 248, 99, 220, 163, 123, 218, 74, 110, 198, 13, 229, 24, 217, 75, 60, 192, 193, 115, 187, 125, 32,
-    8, 105, 176, 22, 96, 156, 159, 218, 238, 159, 23, 150, 243, 90, 196, 166, 70, 121, 65, 118, 121, 145, 91, 239, 103,
-    123, 86, 142, 114, 201, 33, 111, 131, 243, 221, 12, 112, 245, 116, 34, 183, 0, 255, 137, 227, 224, 30, 1, 184, 136,
-    132, 43, 119, 181, 99, 138, 41, 201, 116, 250, 31, 133, 13, 56, 166, 68, 251, 53, 196, 2, 48, 136, 156, 170, 111,
-    139, 5, 196, 229, 101, 62, 167, 242, 14, 69, 162, 104, 128, 85, 88, 159, 209, 164, 164, 114, 202, 216, 126, 135,
-    142, 207, 46, 202, 250, 74, 193, 251, 213, 71, 131, 48, 180, 251, 22, 24, 125, 70, 88, 49, 142, 195, 127, 242, 163,
-    130, 219, 144, 39, 160, 232, 43, 59, 34, 203, 114, 219, 184, 2, 96, 237, 182, 60, 98, 226, 117, 196, 245, 51, 148,
-    6, 47, 123, 182, 139, 170, 188, 238, 204, 67, 3, 155, 91, 247, 178, 74, 16, 239, 209, 77, 83, 43, 159, 151, 41, 29,
-    203, 115, 45, 170, 58, 103, 1, 15, 126, 199, 149, 102, 22, 46, 181, 35, 50, 219, 39, 4, 83, 88, 252, 153, 46, 194,
-    72, 97, 114, 55, 50, 56, 242, 157, 136, 172, 15, 130, 146, 97, 134, 24, 16, 145, 49, 43, 137, 235, 21, 144, 6, 249,
-    108, 111, 1, 171, 251, 149, 82, 143, 74, 252, 82, 217, 222, 152, 62, 78, 234, 130, 100, 130, 121, 229, 34, 129, 181,
-    21, 95, 142, 15, 70, 166, 102, 139, 73, 149, 234, 91, 14, 23, 177, 65, 159, 0, 103, 115, 199, 130, 44, 252, 153,
-    168, 250, 254, 4, 153, 146, 58, 33, 207, 234, 108, 186, 22, 88, 157, 39, 145, 176, 102, 82, 226, 2, 148, 78, 70,
-    131, 212, 60, 108, 149, 125, 146, 60, 135, 168, 161, 147, 200, 91, 37, 1, 173, 65, 221, 151, 227, 208, 4, 245, 128,
-    173, 179, 121, 220, 73, 130, 231, 78, 129, 5, 222, 198, 87, 130, 212, 254, 29, 17, 46, 155, 24, 195, 248, 22, 85, 5,
-    120, 228, 74, 217, 15, 156, 252, 202, 151, 192, 156, 95, 209, 86, 64, 118, 177, 47, 206, 192, 48, 60, 246, 226, 197,
-    136, 220, 188, 142, 252, 242, 249, 47, 19, 69, 217, 140, 31, 119, 155, 164, 200, 196, 16, 211, 135, 143, 50, 18,
-    150, 208, 19, 63, 205, 85, 229, 202, 108, 9, 204, 27, 195, 106, 225, 75, 209, 186, 144, 243, 154, 52, 182, 76, 101,
-    8, 133, 12, 60, 80, 201, 81, 236, 197, 59, 135, 200, 254, 150, 122, 154, 182, 111, 231, 136, 94, 21, 168, 192, 210,
-    180, 194, 237, 199, 142, 249, 140, 180, 109, 9, 170, 180, 251, 20, 104, 34, 217, 254, 149, 170, 85, 236, 217, 76,
-    205, 238, 231, 178, 25, 119, 127, 161, 31, 64, 148, 108, 79, 34, 228, 152, 77, 214, 2, 82, 159, 239, 44, 90, 225,
-    176, 122, 176, 182, 59, 155, 103, 109, 162, 144, 223, 78, 108, 58, 100, 164, 194, 157, 46, 226, 172, 48, 137, 175,
-    178, 107, 96, 203, 20, 194, 201, 95, 177, 248, 0, 136, 61, 232, 112, 238, 76, 242, 118, 128, 225, 205, 164, 90, 245,
-    244, 203, 121, 119, 136, 60, 31, 226, 185, 97, 108, 126, 48, 167, 169, 74, 213, 245, 24, 32, 224, 29, 232, 55, 116,
-    244, 240, 187, 8, 172, 150, 203, 106, 107, 215, 166, 94, 213, 64, 221, 230, 215, 71, 34, 225, 18, 145, 61, 211, 77,
-    132, 126, 158, 109, 67, 197, 226, 148, 128, 246, 211, 206, 93, 66, 169, 45, 223, 127, 226, 27, 120, 220, 62, 192,
-    234, 147, 28, 19, 244, 255, 27, 58, 8, 193, 137, 27, 92, 86, 94, 105, 139, 155, 1, 215, 161, 180, 15, 10, 243, 141,
-    88, 57, 227, 113, 22, 6, 13, 119, 5, 254, 232, 205, 70, 204, 158, 166, 136, 112, 129, 226, 129, 158, 211, 234, 68,
-    16, 55, 226, 173, 113, 228, 21, 68, 68, 48, 30, 109, 107, 90, 15, 0, 224, 41, 126, 51, 217, 34, 35, 83, 200, 49,
-    181, 188, 193, 47, 49, 198, 172, 46, 35, 47, 10, 133, 163, 156, 102, 158, 65, 162, 150, 115, 107, 226, 236, 97, 184,
-    0, 241, 172, 31, 92, 134, 14, 183, 160, 95, 197, 175, 59, 123, 205, 162, 195, 202, 188, 42, 222, 210, 78, 180, 30,
-    174, 117, 131, 204, 212, 140, 7, 239, 59, 150, 33, 32, 252, 242, 142, 113, 117, 223, 194, 21, 213, 237, 105, 234,
-    255, 171, 89, 49, 194, 231, 216, 164, 159, 66, 181, 228, 8, 111, 45, 88, 0, 218, 27, 35, 229, 155, 161, 47, 86, 56,
-    183, 11, 42, 51, 19, 74, 115, 83, 127, 133, 144, 72, 240, 113, 193, 16, 210, 179, 143, 23, 55, 81, 1, 186, 208, 68,
-    77, 169, 83, 66, 165, 2, 100, 186, 109, 156, 50, 55, 181, 97, 194, 65, 53, 181, 201, 60, 105, 126, 128, 30, 110, 27,
-    106, 136, 109, 9, 242, 195, 190, 141, 94, 69, 21, 112, 151, 99, 4, 187, 8, 248, 55, 168, 45, 47, 98, 53, 231, 209,
-    35, 72, 75, 41, 213, 78, 254, 67, 58, 234, 74, 252, 87, 108, 255, 90, 253, 44, 141, 85, 136, 63, 41, 123, 147, 20,
-    152, 137, 46, 180, 100, 168, 38, 5, 191, 247, 112, 164, 182, 129, 147, 65, 30, 145, 232, 23, 149, 225, 121, 246,
-    209, 65, 9, 216, 200, 45, 194, 28, 223, 0, 66, 127, 148, 142, 183, 238, 213, 159, 150, 37, 70, 240, 223, 190, 178,
-    218, 230, 194, 54, 203, 138, 152, 104, 73, 198, 226, 134, 113, 69, 153, 39, 0, 81, 130, 254, 193, 118, 181, 254, 7,
-    223, 159, 209, 199, 61, 252, 68, 255, 70, 151, 226, 88, 146, 169, 231, 82, 110, 220, 1, 46, 238, 63, 227, 218, 245,
-    90, 254, 130, 108, 13, 239, 26, 203, 153, 235, 120, 196, 235, 211, 146, 114, 0, 17, 172, 238, 184, 115, 193, 213,
-    75, 193, 207, 52, 2, 11, 130, 87, 10, 162, 174, 59, 212, 141, 248, 179, 111, 155, 193, 223, 15, 136, 104, 11, 40,
-    63, 161, 231, 152, 110, 158, 29, 207, 77, 208, 149, 53, 147, 21, 209, 224, 84, 218, 126, 201, 240, 57, 222, 110,
-    114, 90, 199, 162, 57, 110, 238, 189, 210, 204, 166, 85, 25, 103, 40, 194, 186, 38, 207, 163, 179, 240, 87, 217,
-    246, 149, 193, 223, 247, 117, 2, 102, 88, 139, 158, 24, 222, 99, 89, 48, 253, 42, 50, 233, 16, 175, 73, 44, 111, 64,
-    41, 171, 173, 78, 102, 214, 223, 188, 70, 210, 213, 158, 210, 9, 171, 50, 131, 132, 183, 177, 96, 52, 21, 199, 73,
-    147, 187, 147, 202, 98, 27, 119, 121, 30, 74, 30, 186, 110, 16, 139, 240, 254, 3, 3, 219, 12, 240, 119, 96, 158, 97,
-    13, 63, 15, 168, 80, 230, 91, 175, 17, 209, 197, 178, 13, 18, 240, 118, 18, 69, 85, 81, 147, 242, 64, 7, 41, 89, 66,
-    197, 19, 150, 48, 35, 222, 158, 223, 112, 57, 239, 190, 54, 221, 179, 61, 12, 121, 184, 138, 168, 188, 111, 224, 42,
-    28, 121, 167, 78, 16, 201, 123, 96, 118, 75, 219, 29, 35, 44, 248, 64, 92, 12, 32, 160, 45, 25, 142, 247, 112, 85,
-    51, 122, 78, 109, 164, 45, 236, 248, 119, 144, 21, 183, 175, 199, 138, 94, 250, 122, 32, 89, 72, 118, 54, 169, 65,
-    249, 54, 156, 167, 83, 179, 186, 55, 34, 150, 124, 95, 209, 12, 93, 198, 204, 115, 98, 204, 245, 15, 124, 79, 45,
-    206, 131, 214, 187, 37, 216, 48, 187, 67, 25, 16, 196, 18, 250, 231, 131, 53, 196, 231, 42, 51, 80, 255, 162, 243,
-    189, 27, 170, 31, 165, 142, 201, 69, 43, 209, 242, 21, 239, 38, 57, 38, 7, 151, 242, 37, 76, 64, 158, 217, 248, 14,
-    166, 242, 0, 239, 144, 144, 35, 124, 112, 211, 53, 63, 119, 243, 200, 110, 253, 8, 93, 14, 73, 187, 185, 176, 25,
-    210, 86, 210, 230, 133, 221, 35, 58, 145, 154, 18, 219, 199, 112, 64, 53, 39, 173, 121, 127, 35, 25, 251, 185, 165,
-    96, 187, 172, 4, 85, 242, 198, 199, 243, 45, 202, 64, 189, 8, 250, 122, 1, 165, 141, 2, 90, 252, 149, 228, 119, 242,
-    42, 81, 223, 156, 70, 81, 180, 22, 129, 184, 11, 152, 29, 62, 250, 228, 80, 119, 173, 216, 171, 103, 33, 200, 32,
-    203, 199, 7, 185, 27, 2, 2, 230, 37, 186, 179, 217, 23, 18, 241, 141, 131, 239, 50, 183, 173, 31, 72, 93, 67, 92,
-    187, 242, 184, 18, 180, 79, 136, 255, 22, 129, 222, 0, 180, 187, 188, 142, 64, 242, 45, 123, 231, 147, 34, 57, 102,
-    181, 150, 108, 20, 88, 173, 46, 192, 226, 139, 73, 186, 22, 174, 208, 230, 15, 13, 105, 225, 20, 43, 207, 104, 176,
-    182, 229, 98, 176, 93, 247, 87, 191, 156, 76, 204, 196, 102, 56, 128, 186, 22, 135, 40, 138, 45, 103, 48, 88, 200,
-    74, 141, 152, 161, 197, 226, 81, 75, 21, 124, 165, 81, 154, 216, 178, 57, 206, 25, 99, 123, 197, 247, 248, 52, 31,
-    157, 122, 110, 135, 189, 179, 191, 204, 190, 43, 74, 104, 10, 96, 62, 222, 64, 135, 219, 149, 60, 105, 237, 65, 1,
-    88, 83, 92, 43, 36, 244, 230, 6, 13, 190, 171, 238, 140, 61, 202, 136, 89, 181, 24, 138, 230, 77, 160, 163, 42, 111,
-    73, 123, 105, 36, 139, 215, 51, 255, 167, 85, 126, 108, 111, 217, 69, 54, 232, 40, 26, 110, 38, 20, 78, 112, 170,
-    144, 218, 85, 135, 143, 121, 43, 172, 109, 234, 199, 222, 133, 120, 189, 118, 249, 207, 71, 162, 3, 251, 149, 240,
-    148, 83, 41, 18, 237, 216, 73, 250, 4, 39, 75, 111, 177, 220, 138, 71, 120, 233, 90, 31, 67, 91, 119, 20, 166, 219,
-    158, 206, 166, 168, 170, 34, 115, 250, 168, 149, 64, 63, 140, 25, 251, 93, 232, 70, 173, 5, 170, 21, 67, 159, 233,
-    190, 88, 203, 21, 224, 74, 202, 85, 82, 140, 206, 186, 15, 106, 130, 7, 43, 120, 141, 0, 193, 74, 220, 59, 82, 158,
-    195, 58, 215, 165, 253, 140, 82, 83, 4, 48, 27, 127, 182, 36, 44, 9, 105, 213, 146, 90, 193, 227, 109, 57, 129, 87,
-    228, 45, 195, 186, 58, 103, 251, 102, 217, 126, 35, 60, 168, 13, 247, 233, 233, 11, 20, 182, 55, 31, 121, 164, 237,
-    17, 41, 239, 201, 22, 251, 0, 85, 138, 189, 176, 3, 171, 154, 233, 202, 240, 132, 140, 208, 88, 36, 139, 181, 222,
-    21, 5, 168, 27, 15, 242, 134, 59, 19, 121, 248, 214, 241, 187, 44, 104, 84, 12, 119, 61, 248, 38, 215, 14, 144, 138,
-    76, 140, 55, 107, 214, 191, 110, 154, 205, 232, 181, 201, 7, 72, 154, 226, 194, 16, 247, 78, 136, 227, 162, 231,
-    250, 25, 187, 99, 46, 209, 0, 66, 203, 150, 190, 0, 163, 243, 163, 113, 113, 161, 151, 172, 96, 180, 150, 28, 96,
-    239, 152, 8, 189, 232, 185, 80, 33, 101, 25, 59, 173, 32, 61, 192, 71, 122, 28, 251, 142, 143, 49, 226, 188, 240,
-    98, 57, 70, 62, 165, 168, 156, 162, 64, 157, 22, 189, 137, 127, 207, 111, 12, 140, 145, 4, 246, 57, 1, 177, 38, 58,
-    118, 168, 84, 42, 105, 21, 243, 27, 26, 185, 219, 139, 51, 254, 250, 169, 173, 127, 38, 73, 235, 31, 255, 248, 18,
-    163, 70, 78, 227, 94, 0, 85, 211, 90, 136, 131, 74, 104, 61, 43, 208, 193, 0, 166, 79, 156, 36, 72, 93, 168, 181,
-    35, 33, 114, 99, 126, 81, 157, 22, 168, 148, 252, 74, 22, 39, 202, 40, 165, 156, 223, 182, 29, 17, 202, 10, 236, 23,
-    115, 31, 228, 97, 0, 76, 88, 255, 228, 163, 198, 54, 121, 134, 105, 135, 124, 44, 216, 252, 27, 189, 24, 177, 67,
-    225, 134, 112, 231, 30, 195, 146, 66, 16, 124, 221, 39, 71, 128, 189, 145, 105, 169, 60, 241, 10, 233, 74, 51, 250,
-    168, 123, 16, 91, 102, 96, 59, 111, 7, 134, 97, 111, 50, 205, 0, 78, 197, 136, 147, 10, 10, 65, 26, 50, 188, 167,
-    131, 252, 165, 93, 59, 128, 48, 104, 165, 203, 194, 215, 70, 122, 203, 115, 202, 224, 94, 126, 199, 76, 57, 111,
-    100, 140, 50, 144, 67, 255, 200, 65, 112, 2, 215, 70, 138, 248, 165, 128, 118, 0, 29, 36, 9, 90, 169, 45, 254, 128,
-    93, 255, 49, 139, 137, 17, 117, 116, 0, 132, 189, 185, 82, 164, 12, 27, 139, 179, 169, 65, 83, 212, 81, 147, 83,
-    162, 150, 249, 15, 149, 97, 207, 220, 163, 241, 9, 90, 149, 75, 156, 51, 90, 44, 176, 237, 127, 229, 71, 178, 133,
-    122, 65, 78, 210, 127, 168, 44, 150, 188, 127, 76, 191, 54, 17, 188, 173, 61, 207, 17, 153, 83, 111, 169, 248, 169,
-    37, 33, 149, 98, 213, 187, 42, 228, 241, 90, 166, 80, 76, 185, 191, 159, 145, 225, 136, 168, 62, 135, 110, 146, 97,
-    133, 99, 174, 209, 218, 236, 178, 36, 123, 221, 172, 110, 207, 232, 115, 14, 38, 216, 135, 117, 27, 134, 41, 123,
-    71, 50, 173, 191, 121, 158, 104, 10, 141, 80, 97, 76, 215, 106, 105, 243, 167, 242, 252, 213, 148, 128, 134, 127,
-    253, 55, 237, 185, 25, 56, 171, 248, 53, 142, 203, 151, 228, 210, 56, 238, 36, 115, 129, 191, 217, 163, 92, 25, 81,
-    198, 39, 227, 103, 197, 90, 242, 83, 132, 15, 219, 49, 165, 87, 194, 55, 69, 25, 215, 61, 89, 83, 123, 90, 182, 75,
-    35, 247, 217, 100, 233, 54, 11, 94, 165, 66, 247, 134, 65, 120, 78, 130, 177, 202, 29, 106, 192, 1, 171, 145, 60,
-    135, 88, 253, 243, 3, 247, 254, 229, 206, 196, 93, 122, 236, 127, 54, 49, 141, 103, 150, 229, 0, 125, 235, 101, 104,
-    151, 9, 73, 204, 114, 214, 176, 52, 101, 42, 14, 231, 242, 231, 43, 244, 175, 244, 147, 88, 239, 143, 219, 77, 29,
-    108, 233, 69, 79, 5, 136, 117, 243, 63, 201, 249, 97, 220, 207, 157, 54, 60, 63, 232, 40, 128, 111, 210, 175, 205,
-    255, 17, 84, 204, 228, 9, 213, 231, 229, 127, 91, 104, 216, 173, 171, 222, 203, 7, 198, 73, 217, 90, 24, 63, 128,
-    142, 150, 74, 39, 225, 233, 227, 56, 16, 125, 156, 198, 32, 204, 179, 171, 99, 209, 167, 7, 186, 229, 248, 166, 255,
-    246, 95, 23, 68, 60, 15, 50, 28, 14, 29, 12, 156, 138, 138, 15, 134, 220, 3, 3, 114, 41, 201, 158, 222, 235, 221,
-    221, 169, 73, 111, 106, 36, 129, 193, 156, 173, 89, 120, 108, 57, 159, 143, 198, 124, 113, 221, 188, 179, 81, 59,
-    183, 171, 223, 243, 18, 214, 32, 123, 220, 68, 15, 62, 175, 22, 99, 196, 17, 71, 101, 178, 223, 92, 255, 238, 74,
-    41, 48, 200, 103, 182, 193, 44, 136, 246, 128, 228, 63, 225, 202, 241, 32, 89, 61, 160, 86, 209, 171, 183, 11, 195,
-    112, 136, 15, 236, 116, 77, 80, 17, 227, 218, 211, 219, 49, 193, 58, 199, 208, 172, 38, 114, 66, 202, 159, 7, 161,
-    189, 180, 82, 59, 1, 122, 3, 156, 146, 84, 247, 219, 71, 14, 228, 28, 81, 184, 112, 85, 253, 157, 233, 82, 225, 34,
-    140, 186, 177, 160, 236, 221, 89, 182, 193, 23, 174, 22, 205, 64, 48, 4, 182, 117, 90, 77, 5, 71, 227, 13, 206, 250,
-    68, 230, 15, 230, 129, 121, 68, 110, 154, 135, 150, 174, 243, 204, 169, 199, 33, 253, 107, 74, 180, 95, 183, 53,
-    100, 142, 71, 28, 50, 250, 140, 221, 226, 254, 230, 34, 182, 152, 250, 17, 92, 107, 31, 58, 158, 222, 41, 243, 188,
-    151, 225, 111, 174, 228, 216, 60, 207, 90, 194, 203, 146, 52, 209, 177, 253, 19, 227, 67, 215, 76, 91, 81, 94, 5,
-    70, 80, 141, 163, 85, 11, 166, 140, 75, 206, 214, 152, 9, 0, 235, 28, 7, 44, 88, 148, 71, 135, 166, 203, 76, 241,
-    77, 15, 40, 112, 87, 208, 148, 113, 217, 33, 151, 85, 235, 69, 121, 247, 213, 215, 22, 143, 177, 38, 173, 12, 255,
-    36, 91, 215, 93, 64, 17, 184, 124, 44, 129, 226, 136, 164, 123, 64, 185, 78, 128, 228, 93, 6, 173, 66, 246, 80, 222,
-    14, 176, 188, 62, 5, 217, 98, 189, 69, 234, 208, 26, 148, 36, 190, 92, 220, 102, 95, 143, 252, 19, 48, 109, 129,
-    130, 52, 158, 56, 19, 159, 89, 41, 76, 180, 225, 158, 96, 177, 70, 17, 122, 14, 27, 227, 117, 120, 94, 117, 150,
-    207, 130, 124, 153, 50, 48, 165, 12, 16, 188, 75, 161, 223, 248, 29, 40, 116, 145, 43, 232, 193, 38, 169, 14, 219,
-    193, 46, 50, 177, 10, 42, 252, 174, 179, 207, 79, 123, 156, 150, 175, 122, 70, 4, 86, 126, 78, 175, 111, 194, 237,
-    134, 190, 106, 253, 188, 11, 238, 127, 90, 4, 102, 192, 239, 84, 62, 213, 109, 215, 254, 87, 63, 75, 42, 52, 170,
-    113, 129, 142, 211, 250, 161, 221, 38, 236, 199, 122, 10, 170, 51, 106, 172, 35, 10, 67, 39, 173, 86, 238, 162, 236,
-    120, 187, 95, 15, 114, 164, 201, 197, 228, 80, 254, 8, 95, 162, 195, 119, 88, 240, 121, 7, 4, 209, 155, 142, 167,
-    40, 155, 169, 22, 161, 197, 147, 7, 16, 106, 25, 131, 251, 227, 155, 14, 24, 224, 240, 93, 132, 70, 235, 115, 96,
-    138, 124, 183, 33, 1, 4, 252, 252, 9, 150, 110, 125, 126, 254, 162, 82, 183, 93, 207, 211, 203, 221, 86, 158, 86,
-    155, 87, 19, 170, 86, 129, 29, 32, 224, 40, 201, 143, 186, 173, 12, 214, 53, 121, 187, 45, 71, 101, 124, 86, 219,
-    27, 194, 71, 53, 89, 133, 159, 43, 58, 100, 85, 240, 117, 2, 82, 94, 101, 238, 124, 77, 132, 51, 33, 206, 14, 80,
-    236, 197, 178, 31, 42, 105, 20, 231, 154, 237, 35, 64, 75, 227, 209, 196, 4, 83, 70, 5, 67, 128, 191, 240, 219, 172,
-    102, 32, 87, 60, 37, 202, 222, 34, 114, 242, 71, 91, 49, 54, 245, 189, 41, 229, 84, 143, 98, 191, 219, 36, 125, 33,
-    239, 123, 63, 32, 166, 5, 236, 205, 140, 244, 236, 163, 126, 57, 123, 99, 205, 48, 193, 74, 71, 40, 205, 180, 110,
-    207, 137, 108, 149, 183, 79, 140, 74, 91, 205, 214, 226, 142, 7, 2, 253, 246, 146, 39, 217, 233, 69, 169, 223, 74,
-    101, 174, 251, 150, 196, 62, 251, 186, 80, 207, 184, 186, 116, 0, 230, 22, 29, 36, 31, 42, 50, 178, 52, 17, 205,
-    144, 166, 98, 245, 89, 52, 149, 159, 166, 191, 164, 250, 205, 92, 143, 109, 179, 14, 76, 78, 169, 102, 191, 125, 37,
-    235, 57, 163, 72, 163, 2, 174, 232, 209, 55, 241, 236, 255, 187, 240, 203, 174, 14, 1, 243, 231, 48, 72, 177, 238,
-    39, 131, 232, 110, 63, 229, 250, 215, 5, 249, 201, 50, 249, 227, 120, 149, 21, 210, 214, 216, 228, 82, 249, 131,
-    218, 252, 239, 184, 167, 136, 83, 242, 205, 69, 59, 230, 206, 226, 141, 7, 164, 84, 220, 49, 33, 225, 251, 151, 244,
-    208, 62, 229, 139, 86, 199, 194, 254, 46, 96, 3, 117, 44, 68, 172, 250, 89, 251, 180, 211, 58, 232, 122, 37, 174,
-    112, 156, 246, 20, 178, 150, 23, 20, 214, 84, 75, 197, 35, 75, 188, 69, 135, 115, 5, 43, 235, 172, 8, 93, 187, 93,
-    153, 32, 228, 61, 29, 158, 68, 240, 45, 69, 213, 1, 234, 92, 119, 68, 128, 224, 38, 169, 146, 153, 34, 48, 78, 68,
-    167, 237, 178, 111, 96, 6, 251, 101, 168, 40, 216, 251, 204, 136, 174, 239, 228, 190, 45, 92, 54, 117, 151, 219, 21,
-    212, 248, 188, 171, 165, 96, 165, 90, 104, 254, 137, 155, 101, 165, 113, 119, 72, 36, 73, 58, 237, 248, 137, 206,
-    52, 140, 203, 195, 105, 245, 113, 62, 137, 114, 180, 106, 217, 175, 217, 252, 86, 9, 235, 130, 246, 116, 205, 226,
-    120, 129, 79, 142, 89, 50, 121, 26, 116, 193, 66, 207, 141, 220, 153, 18, 15, 7, 156, 13, 225, 12, 101, 95, 211, 18,
-    87, 48, 214, 51, 167, 105, 87, 140, 55, 244, 183, 133, 187, 69, 98, 133, 31, 161, 91, 126, 116, 38, 161, 224, 142,
-    62, 26, 44, 138, 22, 71, 126, 86, 88, 172, 30, 151, 43, 186, 129, 38, 37, 210, 63, 107, 54, 57, 8, 247, 73, 140,
-    117, 9, 160, 66, 0, 148, 20, 63, 18, 40, 222, 67, 31, 79, 13, 89, 251, 27, 103, 229, 112, 48, 111, 103, 3, 53, 162,
-    251, 207, 88, 113, 228, 238, 113, 70, 212, 36, 180, 1, 82, 156, 247, 89, 46, 109, 193, 18, 159, 147, 158, 24, 104,
-    58, 225, 179, 205, 28, 233, 153, 117, 133, 33, 66, 210, 212, 114, 56, 17, 230, 235, 106, 230, 55, 112, 186, 167, 96,
-    129, 16, 105, 51, 116, 163, 218, 232, 27, 234, 168, 16, 155, 39, 212, 201, 169, 163, 137, 27, 21, 83, 203, 196, 170,
-    172, 102, 214, 243, 125, 45, 176, 247, 38, 148, 18, 149, 191, 131, 125, 191, 76, 154, 155, 71, 85, 19, 145, 177, 18,
-    231, 135, 254, 62, 255, 239, 221, 16, 162, 88, 84, 58, 193, 105, 17, 187, 12, 84, 72, 14, 145, 199, 238, 173, 249,
-    138, 156, 225, 255, 25, 20, 74, 217, 26, 69, 118, 119, 72, 36, 97, 25, 247, 118, 101, 108, 157, 136, 155, 107, 163,
-    214, 237, 114, 234, 8, 2, 120, 184, 28, 231, 125, 141, 38, 77, 186, 20, 175, 30, 157, 5, 62, 211, 145, 201, 243,
-    128, 81, 198, 54, 239, 162, 154, 174, 185, 55, 240, 136, 11, 145, 246, 83, 46, 202, 118, 157, 2, 10, 161, 222, 224,
-    65, 97, 212, 112, 154, 159, 178, 99, 194, 216, 84, 52, 168, 226, 31, 76, 136, 245, 209, 87, 242, 238, 34, 106, 22,
-    62, 190, 2, 95, 106, 240, 118, 5, 242, 23, 105, 58, 19, 21, 183, 103, 17, 203, 159, 175, 73, 7, 90, 68, 189, 88, 82,
-    129, 112, 148, 243, 30, 250, 232, 206, 201, 227, 247, 51, 135, 67, 203, 155, 100, 196, 103, 251, 153, 104, 189, 75,
-    53, 157, 41, 202, 155, 238, 238, 200, 216, 29, 88, 37, 240, 86, 19, 52, 20, 128, 9, 186, 229, 123, 4, 11, 37, 140,
-    209, 44, 14, 226, 205, 164, 114, 245, 10, 180, 110, 117, 243, 140, 14, 253, 79, 158, 64, 231, 252, 204, 219, 201,
-    162, 227, 22, 104, 147, 235, 2, 129, 140, 198, 93, 123, 63, 66, 38, 93, 244, 35, 130, 64, 255, 18, 55, 148, 198, 18,
-    199, 209, 81, 220, 193, 132, 155, 244, 222, 22, 28, 78, 16, 213, 60, 113, 161, 79, 101, 8, 98, 79, 188, 168, 193,
-    200, 92, 149, 176, 210, 227, 33, 188, 209, 156, 205, 177, 115, 178, 6, 105, 203, 118, 12, 56, 60, 79, 68, 250, 42,
-    215, 5, 199, 135, 126, 204, 101, 112, 210, 160, 220, 139, 218, 11, 99, 161, 246, 23, 110, 111, 246, 36, 199, 209,
-    35, 228, 170, 223, 31, 243, 90, 180, 43, 38, 1, 30, 169, 206, 35, 12, 126, 120, 138, 180, 240, 251, 87, 7, 108, 109,
-    38, 105, 254, 158, 19, 229, 203, 175, 34, 4, 90, 39, 89, 142, 194, 172, 120, 178, 159, 179, 109, 240, 4, 44, 7, 206,
-    225, 103, 112, 192, 72, 95, 25, 36, 91, 162, 65, 19, 64, 39, 229, 107, 231, 39, 28, 214, 118, 236, 216, 243, 6, 31,
-    153, 22, 232, 165, 211, 233, 244, 250, 38, 124, 31, 151, 63, 31, 63, 10, 69, 120, 24, 81, 193, 45, 84, 144, 33, 110,
-    190, 236, 133, 172, 140, 48, 176, 240, 156, 215, 156, 212, 171, 76, 176, 92, 248, 71, 26, 199, 21, 210, 218, 185,
-    63, 58, 134, 107, 14, 169, 242, 9, 164, 49, 237, 139, 210, 132, 177, 57, 38, 130, 125, 12, 139, 219, 55, 243, 18,
-    13, 45, 191, 161, 171, 42, 107, 10, 171, 205, 81, 145, 195, 182, 117, 88, 242, 29, 186, 56, 214, 215, 68, 213, 143,
-    149, 122, 92, 22, 9, 192, 12, 184, 16, 12, 65, 245, 240, 177, 3, 200, 96, 246, 17, 231, 135, 52, 135, 29, 3, 1, 226,
-    250, 181, 198, 5, 105, 3, 175, 210, 59, 100, 71, 229, 88, 194, 14, 63, 132, 15, 142, 23, 156, 207, 107, 209, 164,
-    25, 228, 9, 99, 56, 157, 209, 69, 227, 254, 45, 248, 226, 21, 147, 46, 85, 206, 254, 107, 46, 192, 183, 81, 129, 69,
-    205, 231, 203, 33, 219, 93, 210, 104, 105, 66, 106, 87, 111, 88, 42, 20, 133, 108, 12, 14, 242, 156, 253, 23, 160,
-    29, 229, 97, 132, 87, 174, 232, 21, 220, 224, 83, 25, 224, 137, 139, 135, 187, 41, 213, 149, 203, 215, 161, 37, 135,
-    29, 181, 60, 130, 138, 42, 126, 143, 247, 139, 124, 91, 213, 122, 158, 191, 106, 91, 22, 248, 102, 229, 18, 121,
-    160, 62, 163, 192, 188, 230, 129, 79, 65, 188, 230, 154, 42, 118, 12, 125, 128, 83, 24, 240, 147, 72, 218, 17, 65,
-    12, 102, 135, 191, 11, 205, 163, 166, 8, 97, 101, 79, 227, 215, 117, 129, 134, 238, 238, 65, 76, 112, 96, 28, 234,
-    186, 59, 45, 184, 62, 191, 160, 103, 154, 113, 61, 18, 255, 97, 66, 152, 80, 42, 219, 124, 4, 77, 56, 205, 150, 164,
-    251, 1, 215, 24, 15, 89, 158, 161, 122, 55, 98, 23, 109, 74, 124, 56, 224, 172, 210, 201, 48, 146, 61, 60, 218, 55,
-    105, 162, 173, 9, 232, 165, 143, 225, 57, 83, 139, 93, 127, 3, 128, 146, 81, 247, 236, 65, 198, 156, 152, 105, 72,
-    75, 135, 62, 56, 43, 152, 133, 213, 12, 225, 59, 93, 114, 87, 205, 117, 231, 42, 133, 247, 229, 237, 212, 202, 41,
-    145, 49, 121, 202, 179, 95, 207, 157, 108, 194, 153, 193, 209, 52, 159, 31, 172, 182, 62, 87, 17, 245, 144, 30, 61,
-    181, 89, 227, 92, 129, 107, 211, 141, 220, 115, 36, 250, 71, 202, 203, 86, 190, 28, 244, 107, 26, 87, 163, 52, 123,
-    16, 31, 47, 133, 47, 11, 7, 65, 120, 8, 96, 121, 53, 178, 174, 108, 99, 105, 31, 181, 165, 181, 182, 58, 146, 153,
-    220, 69, 39, 53, 84, 96, 97, 103, 34, 55, 219, 80, 189, 34, 248, 115, 44, 6, 236, 167, 7, 171, 224, 107, 237, 171,
-    134, 176, 171, 13, 241, 69, 238, 220, 71, 36, 228, 191, 219, 131, 50, 239, 145, 0, 187, 169, 169, 59, 112, 50, 252,
-    205, 164, 204, 109, 124, 44, 90, 89, 116, 92, 37, 94, 41, 132, 49, 174, 145, 177, 47, 137, 207, 93, 253, 162, 125,
-    196, 12, 32, 245, 178, 208, 154, 74, 163, 87, 89, 200, 125, 140, 248, 208, 237, 214, 184, 82, 247, 107, 188, 116,
-    105, 10, 81, 32, 161, 196, 235, 30, 197, 138, 58, 112, 175, 12, 26, 253, 29, 73, 53, 31, 98, 83, 89, 33, 14, 138,
-    135, 176, 93, 117, 243, 188, 153, 8, 124, 198, 199, 75, 243, 254, 206, 143, 214, 149, 5, 145, 101, 113, 223, 189,
-    195, 162, 239, 112, 253, 252, 151, 90, 41, 86, 5, 212, 81, 202, 233, 219, 195, 81, 215, 215, 117, 194, 80, 170, 220,
-    19, 101, 109, 224, 197, 0, 233, 85, 88, 9, 145, 62, 243, 197, 49, 144, 92, 17, 163, 38, 64, 239, 187, 138, 191, 110,
-    25, 94, 189, 98, 209, 32, 8, 148, 63, 248, 100, 244, 198, 118, 30, 32, 180, 133, 71, 197, 191, 6, 183, 116, 134,
-    118, 157, 133, 101, 42, 212, 97, 85, 99, 217, 248, 207, 175, 115, 112, 169, 182, 127, 12, 81, 124, 43, 77, 124, 234,
-    187, 238, 157, 86, 78, 53, 187, 52, 81, 142, 60, 32, 78, 192, 247, 51, 145, 220, 165, 213, 132, 196, 253, 29, 177,
-    209, 77, 40, 50, 119, 158, 202, 189, 214, 166, 24, 146, 158, 193, 15, 31, 34, 175, 155, 82, 187, 64, 188, 163, 205,
-    169, 62, 12, 56, 122, 19, 8, 252, 144, 112, 58, 46, 77, 212, 234, 61, 171, 171, 179, 142, 185, 201, 200, 136, 186,
-    123, 64, 185, 58, 179, 42, 34, 39, 45, 225, 239, 219, 123, 104, 125, 152, 132, 127, 117, 212, 142, 198, 56, 94, 26,
-    243, 222, 53, 41, 143, 32, 75, 24, 93, 16, 56, 51, 252, 21, 230, 171, 2, 241, 19, 155, 9, 119, 229, 7, 223, 236,
-    129, 162, 63, 93, 53, 203, 148, 208, 79, 101, 89, 223, 252, 230, 225, 13, 141, 157, 2, 69, 158, 239, 123, 72, 203,
-    218, 242, 174, 179, 12, 243, 230, 75, 31, 203, 121, 113, 67, 245, 167, 239, 127, 13, 251, 210, 105, 165, 212, 106,
-    25, 115, 41, 155, 218, 11, 76, 151, 18, 15, 43, 160, 228, 109, 35, 69, 220, 136, 89, 185, 60, 82, 158, 177, 26, 138,
-    52, 127, 132, 50, 124, 104, 148, 38, 212, 118, 171, 182, 186, 165, 178, 121, 172, 20, 228, 186, 39, 121, 94, 128,
-    159, 104, 152, 31, 209, 167, 166, 41, 112, 239, 220, 215, 70, 86, 196, 242, 126, 130, 74, 180, 18, 57, 15, 21, 242,
-    216, 15, 125, 84, 192, 228, 138, 115, 143, 241, 35, 68, 34, 206, 16, 241, 7, 105, 198, 197, 231, 19, 101, 1, 232,
-    129, 74, 195, 246, 25, 243, 72, 3, 140, 150, 21, 163, 67, 103, 215, 183, 182, 185, 223, 175, 47, 88, 178, 50, 254,
-    2, 13, 73, 170, 230, 101, 37, 38, 66, 191, 173, 195, 174, 188, 122, 44, 156, 77, 160, 175, 64, 0, 177, 183, 239, 58,
-    212, 97, 240, 144, 181, 168, 198, 238, 73, 95, 167, 192, 158, 95, 17, 210, 98, 197, 164, 133, 159, 193, 212, 40, 1,
-    110, 33, 180, 0, 65, 82, 207, 202, 128, 29, 177, 119, 200, 218, 243, 59, 177, 135, 94, 239, 27, 212, 222, 246, 108,
-    115, 145, 159, 3, 143, 156, 222, 148, 162, 117, 104, 115, 212, 52, 116, 145, 28, 169, 118, 122, 164, 143, 222, 183,
-    173, 79, 130, 220, 56, 4, 199, 55, 228, 253, 219, 137, 247, 182, 193, 18, 124, 255, 114, 60, 244, 222, 168, 202,
-    241, 58, 132, 231, 21, 80, 243, 40, 215, 235, 83, 212, 28, 159, 188, 145, 102, 193, 35, 89, 241, 32, 213, 230, 251,
-    18, 191, 86, 228, 255, 110, 204, 208, 112, 14, 180, 195, 113, 185, 235, 28, 118, 238, 142, 70, 121, 184, 87, 179,
-    31, 111, 249, 166, 25, 113, 38, 155, 7, 72, 88, 238, 79, 5, 178, 68, 100, 135, 17, 241, 177, 96, 175, 221, 24, 149,
-    228, 171, 41, 39, 245, 154, 151, 147, 18, 78, 44, 33, 25, 178, 49, 162, 114, 2, 58, 134, 96, 91, 208, 123, 231, 22,
-    43, 184, 235, 233, 136, 226, 254, 46, 80, 86, 149, 90, 96, 34, 122, 148, 4, 242, 23, 23, 152, 204, 71, 9, 81, 76,
-    169, 81, 15, 228, 130, 100, 223, 157, 14, 229, 156, 28, 220, 23, 183, 229, 198, 83, 10, 109, 3, 70, 181, 72, 14,
-    133, 161, 151, 67, 36, 90, 11, 236, 254, 18, 82, 202, 222, 49, 225, 250, 131, 120, 249, 163, 110, 244, 41, 148, 27,
-    48, 213, 25, 234, 31, 53, 140, 180, 73, 74, 146, 162, 145, 199, 31, 121, 51, 178, 154, 180, 84, 28, 146, 247, 200,
-    81, 30, 52, 176, 96, 1, 129, 200, 110, 34, 174, 169, 224, 184, 54, 252, 39, 77, 69, 122, 162, 74, 53, 207, 39, 154,
-    13, 100, 67, 184, 26, 140, 23, 45, 69, 230, 250, 62, 235, 44, 230, 87, 57, 67, 198, 12, 185, 60, 112, 81, 12, 180,
-    11, 43, 154, 134, 110, 18, 20, 199, 190, 231, 82, 130, 167, 217, 251, 21, 101, 34, 31, 178, 188, 150, 9, 195, 94,
-    203, 155, 73, 47, 223, 126, 171, 0, 158, 162, 2, 12, 5, 191, 0, 183, 158, 238, 80, 31, 156, 45, 231, 112, 253, 239,
-    88, 244, 9, 244, 2, 124, 73, 84, 59, 150, 140, 83, 9, 54, 31, 13, 15, 35, 143, 224, 215, 117, 88, 30, 99, 206, 103,
-    113, 175, 137, 14, 112, 221, 94, 85, 225, 139, 151, 244, 133, 243, 185, 253, 166, 88, 167, 105, 130, 7, 162, 37,
-    100, 104, 192, 134, 112, 2, 70, 204, 93, 72, 150, 114, 68, 168, 148, 6, 209, 58, 152, 230, 11, 152, 168, 27, 121,
-    133, 101, 189, 127, 153, 192, 105, 240, 248, 152, 219, 162, 180, 73, 142, 145, 208, 218, 23, 83, 116, 85, 122, 252,
-    127, 224, 181, 45, 193, 8, 78, 93, 90, 122, 11, 190, 237, 70, 168, 146, 70, 117, 199, 206, 105, 44, 230, 54, 236,
-    160, 233, 113, 181, 219, 190, 163, 127, 244, 124, 206, 10, 132, 208, 233, 193, 95, 194, 227, 149, 124, 53, 36, 196,
-    247, 215, 245, 138, 153, 197, 157, 144, 226, 185, 110, 14, 13, 5, 76, 172, 30, 245, 169, 23, 241, 132, 135, 193,
-    151, 99, 51, 17, 253, 33, 161, 207, 134, 207, 81, 226, 166, 229, 160, 141, 220, 214, 96, 98, 139, 145, 116, 138,
-    143, 172, 68, 19, 91, 75, 115, 74, 52, 255, 49, 120, 2, 111, 73, 118, 5, 53, 126, 86, 61, 250, 42, 243, 224, 42,
-    132, 119, 227, 54, 194, 164, 16, 228, 81, 117, 252, 9, 116, 160, 230, 7, 83, 203, 160, 224, 110, 106, 143, 164, 59,
-    81, 233, 119, 153, 206, 144, 24, 176, 111, 55, 101, 214, 168, 226, 108, 108, 22, 5, 147, 174, 130, 152, 160, 249,
-    174, 172, 11, 175, 152, 64, 46, 207, 108, 181, 252, 224, 199, 16, 212, 248, 142, 238, 160, 124, 183, 5, 147, 174,
-    174, 37, 47, 136, 203, 242, 13, 225, 144, 229, 62, 204, 249, 79, 200, 115, 228, 69, 26, 24, 205, 37, 101, 153, 223,
-    93, 28, 253, 62, 83, 105, 64, 201, 209, 51, 101, 228, 151, 254, 246, 112, 22, 74, 60, 240, 3, 88, 235, 227, 250,
-    132, 40, 156, 147, 246, 7, 181, 81, 81, 242, 145, 52, 68, 57, 36, 92, 168, 179, 227, 76, 151, 171, 101, 52, 180,
-    132, 173, 66, 57, 121, 178, 176, 76, 110, 158, 84, 173, 102, 169, 239, 248, 243, 175, 45, 222, 110, 188, 77, 159,
-    247, 218, 92, 201, 45, 128, 49, 124, 195, 100, 46, 137, 121, 139, 211, 245, 16, 102, 12, 51, 69, 236, 4, 169, 104,
-    194, 83, 116, 197, 112, 216, 2, 190, 199, 234, 57, 75, 46, 40, 237, 167, 25, 2, 85, 108, 127, 38, 171, 53, 124, 225,
-    98, 48, 14, 6, 21, 167, 46, 216, 103, 102, 91, 190, 79, 115, 174, 242, 225, 83, 180, 252, 158, 128, 220, 248, 66,
-    194, 234, 211, 40, 109, 10, 115, 62, 74, 125, 238, 42, 169, 1, 88, 92, 194, 23, 10, 109, 130, 25, 54, 101, 121, 85,
-    140, 132, 243, 133, 74, 56, 75, 135, 102, 173, 238, 245, 126, 75, 21, 135, 59, 245, 192, 244, 227, 78, 212, 114,
-    127, 135, 36, 186, 146, 33, 247, 37, 93, 212, 33, 207, 3, 104, 209, 116, 16, 58, 188, 6, 6, 89, 65, 39, 223, 178,
-    208, 205, 91, 138, 201, 111, 145, 136, 81, 134, 169, 242, 67, 250, 26, 68, 53, 153, 110, 122, 96, 59, 193, 102, 78,
-    133, 32, 88, 92, 220, 92, 39, 127, 197, 247, 206, 200, 219, 120, 143, 83, 96, 141, 206, 67, 161, 66, 222, 33, 229,
-    45, 145, 177, 47, 247, 134, 161, 95, 212, 158, 6, 157, 101, 27, 82, 38, 251, 135, 59, 242, 165, 166, 81, 39, 64,
-    107, 109, 25, 103, 26, 118, 10, 39, 43, 248, 201, 220, 18, 173, 252, 94, 15, 99, 62, 146, 129, 60, 103, 105, 35, 93,
-    253, 211, 109, 125, 143, 103, 106, 144, 91, 152, 176, 125, 157, 146, 10, 10, 133, 133, 154, 237, 103, 37, 108, 197,
-    241, 216, 110, 34, 206, 138, 66, 21, 84, 8, 145, 99, 154, 1, 50, 117, 252, 13, 5, 128, 79, 7, 32, 65, 143, 191, 17,
-    225, 194, 106, 74, 52, 250, 220, 121, 87, 194, 246, 40, 68, 141, 115, 188, 80, 107, 171, 59, 31, 118, 63, 244, 152,
-    89, 85, 19, 232, 126, 166, 213, 186, 80, 251, 161, 190, 238, 36, 215, 218, 175, 190, 178, 142, 1, 160, 70, 215, 19,
-    37, 238, 10, 97, 165, 74, 120, 72, 34, 125, 219, 124, 51, 189, 190, 182, 149, 103, 231, 177, 48, 255, 243, 88, 67,
-    1, 32, 83, 64, 38, 231, 20, 152, 96, 209, 20, 238, 248, 34, 243, 118, 24, 62, 227, 134, 98, 84, 131, 205, 96, 22,
-    215, 199, 121, 8, 70, 54, 181, 52, 27, 137, 116, 161, 15, 95, 104, 162, 46, 143, 169, 237, 241, 126, 99, 39, 28,
-    168, 207, 42, 209, 178, 54, 97, 238, 226, 234, 150, 80, 128, 46, 136, 121, 55, 97, 226, 41, 78, 36, 102, 126, 190,
-    60, 214, 156, 192, 47, 105, 185, 55, 166, 9, 237, 233, 133, 201, 223, 105, 128, 223, 130, 142, 10, 237, 28, 8, 218,
-    255, 10, 74, 71, 180, 223, 70, 106, 20, 97, 246, 109, 204, 64, 124, 45, 60, 91, 26, 131, 137, 109, 94, 236, 141, 95,
-    49, 224, 67, 244, 81, 191, 104, 243, 197, 15, 162, 200, 2, 78, 173, 11, 227, 127, 20, 35, 154, 137, 142, 109, 252,
-    168, 112, 145, 8, 127, 105, 53, 226, 239, 218, 24, 205, 6, 148, 59, 147, 64, 131, 200, 168, 94, 95, 191, 89, 48,
-    117, 178, 138, 241, 171, 178, 130, 250, 189, 1, 140, 200, 69, 22, 12, 53, 192, 65, 162, 254, 201, 198, 206, 183, 84,
-    228, 225, 15, 156, 251, 62, 248, 252, 146, 137, 245, 78, 210, 37, 176, 112, 219, 117, 35, 247, 147, 83, 42, 11, 104,
-    126, 151, 240, 140, 192, 158, 170, 62, 148, 90, 36, 42, 125, 158, 62, 2, 136, 75, 62, 178, 145, 144, 144, 228, 218,
-    112, 46, 147, 84, 122, 253, 83, 117, 211, 206, 196, 100, 27, 44, 166, 5, 65, 146, 26, 28, 172, 189, 132, 127, 153,
-    29, 155, 214, 38, 228, 187, 190, 141, 199, 23, 82, 13, 220, 150, 243, 206, 202, 199, 253, 39, 126, 20, 239, 17, 87,
-    50, 103, 201, 7, 6, 169, 251, 183, 127, 194, 58, 32, 204, 59, 145, 6, 173, 220, 130, 208, 232, 94, 99, 105, 206,
-    188, 153, 150, 184, 186, 133, 179, 49, 130, 213, 199, 84, 96, 173, 77, 154, 180, 199, 187, 41, 88, 77, 43, 22, 136,
-    119, 109, 234, 188, 20, 121, 224, 1, 41, 181, 180, 116, 98, 185, 195, 44, 54, 90, 219, 64, 107, 27, 76, 188, 72,
-    201, 192, 53, 193, 195, 148, 84, 146, 222, 39, 169, 24, 108, 22, 16, 157, 105, 115, 228, 249, 204, 22, 117, 39, 237,
-    118, 82, 239, 174, 255, 64, 106, 52, 102, 87, 115, 81, 197, 140, 142, 73, 227, 183, 246, 176, 186, 19, 17, 174, 134,
-    109, 77, 103, 176, 26, 111, 248, 110, 170, 116, 23, 27, 92, 116, 122, 85, 12, 195, 75, 111, 70, 202, 128, 109, 254,
-    49, 222, 53, 233, 175, 48, 199, 90, 11, 1, 229, 51, 245, 194, 160, 15, 107, 154, 3, 108, 247, 150, 244, 39, 190, 57,
-    55, 190, 101, 242, 49, 202, 71, 83, 60, 230, 113, 29, 232, 68, 245, 5, 104, 73, 12, 26, 180, 81, 156, 80, 135, 72,
-    211, 201, 83, 211, 181, 191, 20, 1, 232, 236, 90, 35, 235, 233, 27, 72, 108, 105, 169, 250, 30, 244, 254, 248, 208,
-    82, 96, 19, 93, 126, 206, 20, 161, 112, 251, 174, 255, 64, 100, 95, 107, 147, 69, 89, 48, 129, 7, 60, 209, 38, 100,
-    69, 238, 13, 30, 238, 219, 173, 138, 74, 57, 115, 31, 87, 202, 157, 70, 224, 19, 252, 116, 65, 255, 242, 240, 193,
-    41, 109, 89, 95, 40, 144, 79, 29, 241, 2, 129, 149, 119, 219, 233, 2, 9, 83, 189, 122, 215, 126, 24, 75, 32, 19,
-    109, 46, 212, 143, 141, 240, 108, 86, 134, 22, 42, 208, 240, 233, 38, 90, 209, 62, 46, 79, 78, 10, 182, 84, 82, 42,
-    35, 125, 53, 112, 114, 82, 246, 97, 44, 27, 57, 21, 30, 65, 224, 122, 49, 131, 143, 163, 186, 93, 43, 138, 197, 147,
-    171, 81, 183, 160, 93, 19, 254, 123, 172, 70, 165, 142, 223, 191, 236, 119, 15, 143, 14, 88, 54, 220, 188, 31, 85,
-    9, 39, 216, 217, 28, 30, 82, 159, 2, 14, 157, 225, 95, 187, 220, 153, 64, 199, 112, 98, 96, 253, 1, 154, 64, 53,
-    251, 85, 185, 78, 157, 120, 156, 255, 196, 29, 245, 238, 130, 250, 79, 62, 246, 220, 90, 2, 20, 209, 194, 80, 11,
-    210, 46, 52, 249, 254, 0, 159, 143, 20, 254, 95, 30, 191, 23, 185, 185, 115, 197, 170, 89, 131, 117, 150, 249, 109,
-    70, 218, 5, 88, 189, 141, 102, 169, 25, 166, 122, 255, 123, 100, 147, 79, 2, 139, 182, 161, 216, 109, 234, 226, 26,
-    27, 249, 170, 48, 186, 173, 169, 90, 236, 115, 40, 232, 186, 172, 7, 246, 169, 61, 91, 207, 76, 214, 187, 128, 150,
-    163, 192, 70, 81, 64, 173, 171, 233, 154, 239, 210, 137, 250, 126, 40, 155, 213, 166, 192, 144, 57, 69, 180, 43,
-    207, 177, 189, 33, 171, 142, 140, 71, 146, 57, 152, 156, 33, 27, 92, 110, 253, 70, 180, 132, 137, 87, 24, 168, 170,
-    236, 65, 87, 14, 9, 229, 159, 37, 208, 3, 205, 114, 135, 219, 8, 17, 70, 122, 219, 179, 207, 237, 197, 218, 2, 89,
-    79, 239, 50, 167, 32, 153, 92, 102, 57, 152, 145, 248, 50, 94, 8, 158, 228, 183, 151, 75, 76, 243, 6, 21, 14, 1, 72,
-    237, 188, 217, 167, 35, 62, 10, 205, 237, 45, 153, 159, 238, 161, 39, 202, 78, 157, 20, 184, 140, 228, 155, 153,
-    254, 2, 52, 158, 15, 226, 235, 208, 153, 60, 102, 24, 21, 146, 37, 95, 110, 104, 54, 123, 119, 161, 57, 135, 55,
-    253, 55, 163, 109, 60, 56, 80, 64, 79, 28, 220, 242, 12, 51, 162, 200, 156, 28, 208, 230, 62, 197, 230, 198, 115,
-    146, 80, 234, 65, 115, 160, 63, 100, 60, 247, 225, 123, 199, 197, 213, 145, 87, 101, 253, 106, 64, 61, 0, 175, 15,
-    10, 123, 136, 174, 37, 56, 222, 15, 97, 178, 157, 80, 70, 123, 210, 157, 159, 237, 132, 182, 243, 34, 120, 73, 150,
-    12, 180, 55, 50, 129, 132, 87, 41, 170, 162, 97, 108, 149, 210, 119, 121, 19, 142, 172, 24, 155, 232, 0, 242, 233,
-    152, 103, 180, 203, 113, 94, 193, 232, 93, 206, 210, 67, 173, 145, 241, 109, 15, 110, 110, 58, 210, 145, 66, 86, 4,
-    58, 220, 74, 222, 111, 105, 105, 37, 61, 91, 5, 91, 87, 130, 148, 192, 106, 223, 223, 82, 164, 243, 71, 146, 199,
-    168, 25, 189, 96, 116, 236, 100, 214, 235, 38, 89, 176, 228, 216, 97, 234, 61, 180, 189, 250, 93, 110, 200, 223,
-    199, 98, 121, 37, 174, 155, 119, 105, 225, 23, 53, 8, 169, 182, 101, 208, 24, 249, 216, 107, 40, 237, 211, 175, 95,
-    162, 199, 12, 148, 0, 81, 96, 188, 185, 183, 70, 90, 165, 238, 127, 73, 44, 14, 47, 163, 69, 219, 22, 207, 145, 229,
-    221, 34, 67, 101, 49, 230, 25, 136, 177, 206, 55, 139, 125, 104, 87, 229, 71, 51, 47, 135, 164, 166, 42, 50, 162,
-    201, 217, 116, 63, 35, 11, 67, 253, 217, 51, 177, 53, 167, 114, 191, 138, 32, 50, 47, 192, 104, 177, 228, 250, 33,
-    180, 187, 37, 94, 104, 239, 145, 15, 242, 95, 69, 130, 106, 182, 98, 124, 29, 222, 25, 19, 4, 19, 134, 125, 51, 17,
-    225, 96, 130, 247, 23, 1, 205, 128, 28, 149, 110, 58, 239, 34, 250, 83, 78, 180, 217, 147, 42, 241, 158, 127, 242,
-    190, 64, 79, 229, 39, 163, 103, 191, 67, 159, 12, 174, 199, 149, 212, 230, 145, 5, 221, 120, 124, 95, 130, 43, 1,
-    56, 115, 18, 19, 182, 172, 111, 9, 96, 105, 255, 89, 10, 22, 153, 228, 253, 191, 46, 145, 113, 70, 8, 55, 83, 114,
-    87, 158, 78, 220, 231, 167, 158, 30, 199, 151, 37, 251, 250, 203, 142, 92, 38, 146, 203, 51, 226, 81, 91, 94, 179,
-    113, 194, 170, 34, 209, 43, 10, 125, 174, 56, 198, 118, 254, 44, 84, 102, 136, 174, 175, 104, 99, 255, 23, 30, 148,
-    18, 137, 140, 179, 165, 97, 3, 86, 216, 208, 246, 188, 21, 147, 202, 215, 244, 131, 128, 36, 189, 158, 218, 12, 127,
-    132, 244, 69, 255, 164, 128, 249, 12, 3, 1, 14, 10, 88, 167, 33, 212, 72, 90, 60, 63, 159, 189, 69, 193, 171, 144,
-    221, 215, 244, 26, 102, 144, 223, 140, 242, 95, 38, 104, 69, 189, 52, 67, 15, 204, 168, 97, 208, 179, 206, 216, 176,
-    182, 245, 230, 240, 144, 103, 139, 165, 173, 45, 98, 227, 202, 68, 222, 11, 145, 151, 93, 205, 16, 212, 169, 93,
-    246, 162, 94, 128, 89, 151, 178, 51, 94, 11, 118, 193, 218, 249, 92, 21, 212, 33, 35, 197, 162, 16, 8, 159, 130,
-    236, 46, 32, 188, 90, 235, 231, 141, 23, 228, 57, 173, 206, 166, 131, 96, 84, 30, 177, 232, 122, 174, 196, 182, 128,
-    46, 168, 27, 130, 21, 34, 11, 233, 69, 231, 219, 213, 193, 137, 44, 198, 33, 236, 60, 241, 145, 122, 151, 185, 74,
-    219, 132, 102, 222, 2, 140, 70, 252, 146, 133, 74, 207, 108, 44, 149, 90, 145, 49, 55, 177, 134, 242, 242, 81, 41,
-    69, 40, 68, 33, 52, 199, 56, 206, 109, 224, 93, 30, 220, 84, 158, 7, 217, 153, 131, 67, 84, 205, 124, 75, 90, 107,
-    10, 95, 233, 31, 164, 233, 2, 0, 98, 105, 145, 184, 248, 200, 245, 201, 171, 252, 95, 11, 83, 75, 176, 143, 29, 118,
-    237, 78, 9, 148, 169, 160, 93, 142, 89, 54, 74, 188, 143, 181, 71, 164, 34, 122, 221, 24, 139, 192, 194, 127, 225,
-    165, 89, 110, 204, 60, 242, 32, 27, 248, 227, 217, 123, 54, 74, 80, 213, 69, 15, 145, 32, 74, 209, 65, 218, 69, 32,
-    27, 148, 221, 70, 46, 68, 19, 200, 51, 19, 48, 173, 172, 192, 83, 138, 115, 118, 11, 29, 73, 179, 76, 37, 37, 168,
-    224, 40, 149, 94, 21, 139, 92, 128, 221, 108, 226, 231, 203, 143, 66, 83, 2, 115, 200, 29, 51, 97, 152, 192, 249,
-    161, 51, 0, 20, 181, 221, 238, 143, 34, 197, 108, 37, 214, 57, 189, 182, 109, 173, 123, 224, 82, 236, 58, 47, 108,
-    167, 180, 68, 237, 47, 148, 252, 204, 49, 18, 42, 59, 36, 37, 123, 99, 42, 176, 101, 253, 142, 135, 160, 157, 78,
-    48, 116, 31, 174, 71, 21, 223, 32, 80, 233, 95, 230, 50, 23, 186, 6, 106, 22, 68, 163, 53, 82, 114, 91, 165, 189,
-    142, 80, 17, 248, 225, 210, 167, 47, 157, 41, 35, 135, 209, 33, 248, 100, 194, 41, 66, 137, 172, 254, 210, 134, 89,
-    19, 9, 183, 242, 110, 2, 223, 26, 248, 87, 31, 57, 184, 67, 75, 65, 127, 42, 79, 89, 60, 139, 69, 77, 136, 134, 147,
-    220, 217, 77, 178, 97, 27, 54, 246, 226, 137, 247, 147, 33, 54, 82, 193, 29, 194, 107, 117, 177, 74, 224, 112, 84,
-    98, 214, 248, 219, 183, 89, 222, 164, 132, 5, 4, 123, 212, 242, 30, 61, 82, 19, 106, 182, 100, 72, 189, 159, 126, 0,
-    7, 7, 149, 100, 227, 84, 126, 254, 139, 240, 145, 37, 81, 5, 77, 0, 230, 118, 238, 234, 117, 125, 183, 253, 88, 228,
-    110, 25, 148, 2, 62, 82, 146, 154, 136, 150, 95, 25, 183, 52, 216, 97, 64, 3, 8, 174, 197, 215, 24, 56, 25, 114,
-    212, 59, 122, 98, 42, 76, 243, 83, 199, 78, 103, 45, 20, 90, 196, 17, 189, 197, 139, 148, 50, 152, 98, 99, 131, 61,
-    25, 223, 156, 197, 174, 209, 65, 44, 70, 213, 51, 24, 247, 15, 225, 159, 203, 71, 236, 43, 233, 0, 253, 213, 212,
-    147, 234, 92, 204, 30, 3, 222, 105, 218, 254, 106, 124, 174, 247, 174, 23, 150, 220, 16, 84, 11, 86, 181, 126, 24,
-    34, 168, 253, 180, 107, 70, 91, 137, 176, 109, 170, 91, 114, 205, 141, 43, 240, 164, 84, 38, 89, 61, 118, 106, 96,
-    174, 188, 218, 195, 153, 158, 170, 226, 126, 38, 125, 121, 133, 67, 142, 244, 231, 18, 222, 251, 219, 101, 83, 89,
-    48, 87, 109, 198, 204, 168, 105, 98, 251, 139, 155, 73, 155, 46, 218, 100, 213, 77, 193, 125, 87, 172, 170, 251, 36,
-    84, 0, 77, 39, 74, 219, 86, 238, 123, 242, 25, 168, 85, 207, 236, 21, 200, 47, 133, 10, 44, 54, 13, 91, 159, 244,
-    182, 85, 87, 209, 185, 189, 101, 201, 193, 242, 46, 70, 115, 54, 128, 211, 198, 241, 144, 166, 20, 232, 8, 144, 59,
-    77, 133, 136, 246, 207, 98, 47, 20, 70, 195, 57, 68, 138, 197, 19, 48, 39, 206, 62, 86, 100, 171, 171, 162, 92, 105,
-    90, 30, 201, 254, 125, 16, 116, 191, 171, 241, 27, 56, 87, 234, 245, 198, 160, 125, 128, 179, 194, 178, 197, 30,
-    128, 199, 164, 59, 220, 201, 4, 110, 147, 129, 171, 181, 212, 114, 39, 19, 250, 162, 91, 239, 238, 232, 96, 9, 112,
-    236, 43, 101, 84, 73, 79, 106, 164, 165, 54, 68, 110, 175, 144, 145, 158, 19, 115, 124, 72, 243, 159, 141, 79, 40,
-    188, 139, 150, 5, 39, 231, 8, 105, 248, 250, 210, 41, 157, 214, 77, 137, 90, 106, 91, 101, 207, 209, 219, 72, 22,
-    236, 82, 40, 80, 177, 6, 123, 171, 251, 21, 32, 23, 100, 61, 194, 141, 242, 18, 32, 203, 56, 27, 10, 8, 194, 36,
-    167, 66, 184, 105, 37, 211, 116, 115, 251, 227, 154, 51, 161, 227, 129, 182, 223, 81, 37, 22, 207, 73, 122, 68, 18,
-    111, 212, 208, 187, 89, 218, 123, 182, 37, 67, 170, 169, 11, 177, 104, 232, 49, 80, 218, 178, 2, 134, 98, 142, 172,
-    189, 70, 73, 215, 253, 100, 96, 149, 6, 94, 161, 57, 91, 130, 192, 128, 148, 145, 118, 86, 24, 113, 18, 186, 108,
-    91, 144, 126, 11, 127, 84, 79, 79, 120, 151, 12, 30, 202, 85, 122, 223, 113, 46, 129, 232, 109, 138, 184, 9, 148, 2,
-    165, 254, 232, 205, 239, 49, 31, 189, 20, 15, 146, 153, 205, 12, 132, 116, 231, 229, 45, 130, 252, 56, 147, 121, 34,
-    12, 143, 231, 237, 126, 95, 224, 246, 222, 237, 153, 194, 80, 233, 32, 216, 10, 244, 158, 35, 23, 152, 182, 204,
-    120, 186, 121, 137, 83, 210, 21, 114, 172, 68, 113, 24, 249, 222, 41, 81, 23, 108, 205, 29, 138, 26, 123, 164, 186,
-    239, 45, 56, 149, 31, 36, 108, 210, 23, 123, 52, 123, 82, 85, 156, 58, 41, 225, 249, 223, 243, 86, 147, 250, 36,
-    238, 57, 108, 137, 223, 63, 246, 199, 213, 237, 58, 198, 19, 68, 75, 94, 31, 170, 75, 202, 91, 187, 6, 31, 16, 165,
-    65, 194, 216, 60, 143, 167, 32, 199, 117, 115, 101, 70, 50, 50, 216, 96, 219, 30, 194, 199, 250, 136, 164, 42, 141,
-    142, 69, 246, 12, 132, 19, 176, 90, 254, 233, 99, 252, 177, 92, 43, 159, 16, 149, 117, 157, 28, 123, 220, 102, 192,
-    245, 183, 62, 248, 89, 153, 181, 146, 209, 105, 107, 51, 81, 159, 32, 150, 135, 97, 10, 144, 15, 80, 29, 132, 22,
-    85, 141, 239, 97, 130, 70, 32, 6, 140, 231, 150, 205, 4, 203, 167, 11, 187, 176, 0, 159, 212, 237, 111, 112, 92,
-    203, 218, 137, 10, 30, 190, 127, 60, 20, 14, 87, 242, 101, 76, 112, 204, 45, 245, 188, 232, 192, 112, 129, 118, 218,
-    199, 254, 188, 152, 140, 97, 198, 56, 242, 133, 68, 119, 8, 63, 119, 85, 174, 180, 20, 163, 67, 17, 37, 78, 84, 218,
-    90, 94, 58, 167, 168, 103, 214, 131, 193, 220, 150, 214, 8, 242, 130, 11, 174, 253, 75, 30, 15, 195, 26, 19, 140,
-    105, 239, 55, 157, 94, 121, 145, 1, 174, 255, 62, 131, 75, 184, 141, 199, 69, 151, 164, 17, 135, 36, 86, 122, 66,
-    59, 85, 152, 195, 61, 239, 27, 206, 197, 73, 153, 92, 166, 249, 208, 249, 205, 131, 253, 24, 170, 228, 95, 28, 21,
-    81, 226, 202, 42, 5, 132, 33, 89, 53, 46, 212, 156, 115, 4, 17, 134, 36, 227, 152, 126, 238, 72, 238, 239, 106, 240,
-    125, 158, 60, 1, 145, 189, 135, 213, 4, 77, 3, 89, 233, 148, 2, 96, 127, 155, 22, 149, 152, 116, 250, 146, 193, 155,
-    221, 243, 100, 132, 60, 109, 153, 117, 74, 5, 75, 95, 170, 135, 215, 92, 247, 224, 93, 29, 202, 231, 28, 171, 163,
-    187, 202, 97, 71, 64, 77, 231, 168, 87, 162, 227, 35, 222, 183, 90, 10, 156, 33, 73, 10, 50, 144, 117, 74, 99, 19,
-    70, 120, 243, 139, 77, 11, 155, 44, 137, 38, 249, 170, 123, 6, 27, 43, 17, 173, 156, 15, 255, 227, 233, 32, 59, 89,
-    101, 22, 192, 243, 69, 147, 154, 193, 73, 248, 63, 30, 189, 141, 84, 218, 220, 69, 112, 207, 169, 50, 36, 75, 105,
-    103, 124, 229, 220, 108, 246, 244, 170, 38, 107, 122, 72, 170, 123, 180, 244, 233, 211, 187, 37, 121, 132, 40, 77,
-    202, 254, 152, 145, 111, 243, 21, 142, 136, 198, 31, 108, 26, 73, 192, 134, 179, 130, 164, 39, 49, 81, 52, 233, 120,
-    156, 93, 168, 83, 212, 90, 130, 39, 60, 225, 0, 222, 205, 240, 58, 103, 180, 59, 88, 162, 131, 176, 229, 223, 77,
-    226, 54, 203, 240, 24, 35, 246, 120, 219, 207, 206, 188, 159, 86, 157, 111, 65, 118, 76, 226, 138, 142, 0, 255, 34,
-    59, 29, 171, 23, 189, 148, 219, 51, 77, 171, 37, 87, 245, 226, 234, 14, 122, 115, 150, 9, 230, 77, 22, 207, 171, 41,
-    125, 128, 18, 27, 165, 168, 1, 193, 142, 245, 57, 220, 178, 68, 212, 127, 166, 15, 95, 142, 180, 159, 28, 183, 101,
-    169, 45, 88, 169, 189, 237, 142, 190, 72, 169, 243, 5, 105, 210, 23, 167, 187, 211, 116, 58, 118, 43, 173, 239, 171,
-    88, 183, 45, 164, 55, 106, 73, 140, 122, 32, 134, 35, 145, 1, 121, 194, 43, 16, 206, 213, 209, 209, 15, 211, 226,
-    192, 170, 178, 158, 225, 35, 15, 67, 246, 175, 49, 181, 38, 188, 40, 145, 128, 31, 171, 108, 134, 219, 56, 141, 241,
-    169, 67, 45, 93, 38, 234, 222, 6, 249, 254, 220, 42, 43, 52, 253, 38, 82, 60, 14, 227, 134, 155, 67, 142, 64, 124,
-    6, 4, 213, 175, 129, 178, 220, 157, 67, 232, 33, 185, 132, 194, 183, 166, 182, 24, 238, 105, 97, 145, 100, 184, 116,
-    132, 138, 229, 170, 74, 133, 138, 151, 187, 47, 94, 46, 67, 26, 111, 212, 71, 36, 64, 70, 131, 105, 102, 126, 52,
-    26, 59, 76, 130, 68, 148, 196, 140, 237, 30, 227, 148, 218, 20, 60, 118, 248, 247, 222, 222, 164, 57, 181, 240, 142,
-    84, 50, 173, 129, 134, 30, 165, 150, 148, 154, 176, 247, 106, 180, 33, 246, 17, 142, 176, 51, 214, 117, 80, 222, 3,
-    14, 81, 91, 214, 82, 121, 108, 117, 170, 170, 248, 121, 221, 76, 37, 107, 166, 126, 9, 85, 153, 134, 82, 215, 19,
-    55, 181, 72, 66, 53, 225, 29, 92, 33, 240, 189, 89, 194, 153, 25, 36, 71, 38, 229, 157, 181, 26, 127, 57, 95, 236,
-    243, 88, 124, 232, 6, 149, 108, 100, 21, 167, 101, 197, 6, 0, 252, 162, 171, 4, 45, 73, 192, 99, 31, 147, 13, 41,
-    129, 123, 162, 187, 116, 174, 32, 49, 66, 252, 190, 40, 232, 63, 206, 248, 129, 81, 25, 64, 185, 14, 9, 238, 69,
-    209, 166, 151, 27, 16, 94, 113, 233, 207, 73, 105, 113, 27, 41, 106, 17, 179, 214, 136, 190, 158, 117, 33, 175, 29,
-    2, 171, 66, 71, 158, 108, 89, 186, 162, 162, 181, 183, 182, 94, 36, 28, 169, 251, 54, 109, 213, 16, 10, 54, 195,
-    134, 214, 31, 227, 233, 146, 82, 149, 89, 98, 131, 241, 174, 116, 162, 197, 11, 109, 98, 209, 224, 57, 134, 87, 43,
-    248, 129, 200, 139, 29, 218, 215, 255, 109, 152, 95, 246, 64, 181, 238, 232, 208, 206, 249, 138, 3, 115, 201, 158,
-    228, 110, 73, 114, 204, 22, 95, 82, 63, 117, 21, 0, 73, 188, 91, 65, 100, 51, 11, 226, 190, 5, 93, 167, 236, 34,
-    225, 83, 117, 165, 41, 104, 85, 212, 81, 211, 53, 12, 34, 140, 137, 132, 19, 139, 33, 83, 229, 180, 60, 93, 8, 78,
-    205, 211, 3, 184, 113, 130, 105, 252, 255, 18, 11, 159, 44, 114
+    123, 10, 32, 32, 34, 67, 111, 109, 112, 111, 110, 101, 110, 116, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57,
+    95, 80, 97, 108, 34, 44, 10, 32, 32, 34, 68, 114, 105, 118, 101, 114, 83, 116, 97, 116, 101, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 34, 72, 97, 108, 116, 101, 100, 79, 110, 68, 101, 118, 105, 99, 101, 73, 110, 105, 116, 34, 10, 32, 32,
+    93, 44, 10, 32, 32, 34, 72, 119, 108, 34, 58, 32, 34, 71, 102, 120, 57, 34, 44, 10, 32, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 34, 67, 97, 99,
+    104, 101, 32, 102, 108, 117, 115, 104, 34, 44, 10, 32, 32, 32, 32, 34, 67, 111, 108, 111, 114, 32, 84, 97, 114, 103,
+    101, 116, 115, 34, 44, 10, 32, 32, 32, 32, 34, 67, 111, 109, 112, 117, 116, 101, 32, 80, 105, 112, 101, 108, 105,
+    110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 34, 44,
+    10, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44,
+    10, 32, 32, 32, 32, 34, 83, 104, 97, 100, 101, 114, 32, 79, 112, 116, 105, 111, 110, 115, 34, 44, 10, 32, 32, 32,
+    32, 34, 78, 71, 71, 32, 67, 111, 110, 116, 114, 111, 108, 115, 34, 44, 10, 32, 32, 32, 32, 34, 80, 66, 66, 32, 97,
+    110, 100, 32, 68, 70, 83, 77, 34, 44, 10, 32, 32, 32, 32, 34, 80, 114, 101, 102, 101, 116, 99, 104, 105, 110, 103,
+    32, 40, 76, 50, 32, 67, 97, 99, 104, 101, 32, 87, 97, 114, 109, 105, 110, 103, 41, 34, 44, 10, 32, 32, 32, 32, 34,
+    84, 101, 120, 116, 117, 114, 101, 32, 70, 105, 108, 116, 101, 114, 105, 110, 103, 34, 44, 10, 32, 32, 32, 32, 34,
+    72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 44, 10, 32, 32,
+    32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 93, 44, 10, 32, 32, 34, 69, 110, 117, 109, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 78, 103,
+    103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69,
+    110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 68, 105, 115, 97, 98,
+    108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    68, 105, 115, 97, 98, 108, 101, 100, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80,
+    105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97,
+    108, 108, 32, 86, 115, 80, 115, 32, 40, 86, 115, 80, 115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46,
+    34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84,
+    121, 112, 101, 86, 115, 71, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 71, 115,
+    80, 115, 32, 40, 71, 115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115, 72, 115,
+    68, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 72, 115, 68, 115, 80, 115, 32, 40,
+    84, 101, 115, 115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115, 72, 115, 68, 115,
+    71, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 72, 115, 68, 115, 71, 115, 80,
+    115, 32, 40, 71, 115, 84, 101, 115, 115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101,
+    65, 108, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 53, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32,
+    116, 121, 112, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 93, 10, 32,
+    32, 32, 32, 125, 10, 32, 32, 93, 44, 10, 32, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 84, 111, 103, 103, 108, 101, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 111, 114, 32, 110, 111, 116, 32,
+    76, 79, 65, 68, 95, 73, 78, 68, 69, 88, 32, 112, 97, 99, 107, 101, 116, 115, 32, 97, 114, 101, 32, 117, 115, 101,
+    100, 32, 102, 111, 114, 32, 98, 105, 110, 100, 105, 110, 103, 32, 111, 98, 106, 101, 99, 116, 115, 32, 116, 111, 32,
+    116, 104, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32, 105, 110, 32, 112, 108, 97,
+    99, 101, 32, 111, 102, 32, 115, 101, 116, 32, 112, 97, 99, 107, 101, 116, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108,
+    34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 50, 52, 49, 54, 48, 55, 50, 48, 55, 52, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114,
+    117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97, 98, 108, 101, 76, 111, 97, 100, 73, 110, 100,
+    101, 120, 70, 111, 114, 79, 98, 106, 101, 99, 116, 66, 105, 110, 100, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 76, 111, 97, 100, 73, 110, 100, 101, 120, 70, 111, 114,
+    79, 98, 106, 101, 99, 116, 66, 105, 110, 100, 115, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98,
+    108, 101, 115, 32, 98, 105, 110, 100, 105, 110, 103, 32, 111, 102, 32, 98, 111, 114, 100, 101, 114, 32, 99, 111,
+    108, 111, 114, 32, 112, 97, 108, 101, 116, 116, 101, 115, 44, 32, 97, 110, 100, 32, 102, 111, 114, 99, 101, 115, 32,
+    97, 110, 121, 32, 115, 97, 109, 112, 108, 101, 114, 115, 32, 99, 114, 101, 97, 116, 101, 100, 32, 116, 111, 32, 117,
+    115, 101, 32, 97, 32, 116, 114, 97, 110, 115, 112, 97, 114, 101, 110, 116, 32, 98, 108, 97, 99, 107, 32, 99, 111,
+    108, 111, 114, 46, 32, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120,
+    57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 51, 56, 50, 53, 50, 55, 54, 48, 52, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 66, 111, 114, 100,
+    101, 114, 67, 111, 108, 111, 114, 80, 97, 108, 101, 116, 116, 101, 66, 105, 110, 100, 115, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 66, 111, 114, 100, 101, 114, 67,
+    111, 108, 111, 114, 80, 97, 108, 101, 116, 116, 101, 66, 105, 110, 100, 115, 34, 10, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 82, 101, 108, 97, 116, 101, 100, 32, 116, 111, 32, 112, 114, 105, 109, 105, 116, 105, 118, 101, 32, 111,
+    114, 100, 101, 114, 101, 100, 32, 112, 105, 120, 101, 108, 32, 115, 104, 97, 100, 105, 110, 103, 46, 32, 32, 73,
+    102, 32, 115, 101, 116, 44, 32, 102, 111, 114, 99, 101, 115, 32, 116, 104, 101, 32, 80, 83, 32, 116, 111, 32, 100,
+    114, 97, 105, 110, 32, 111, 110, 32, 97, 110, 121, 100, 101, 116, 101, 99, 116, 101, 100, 32, 111, 118, 101, 114,
+    108, 97, 112, 112, 105, 110, 103, 32, 119, 97, 118, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 51, 48, 57, 49, 57, 48, 54, 56, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101,
+    121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 114, 97, 105,
+    110, 80, 115, 79, 110, 79, 118, 101, 114, 108, 97, 112, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 68, 114, 97, 105, 110, 80, 115, 79, 110, 79, 118, 101, 114, 108, 97, 112, 34, 10, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71,
+    102, 120, 57, 80, 114, 105, 110, 116, 77, 101, 116, 97, 69, 113, 117, 97, 116, 105, 111, 110, 73, 110, 102, 111, 69,
+    113, 117, 97, 116, 105, 111, 110, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 114, 105, 110, 116, 115, 32, 109, 101, 116, 97, 32, 101, 113, 117, 97,
+    116, 105, 111, 110, 115, 32, 116, 104, 101, 109, 115, 101, 108, 118, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 80, 114, 105, 110, 116, 77, 101, 116, 97, 69,
+    113, 117, 97, 116, 105, 111, 110, 73, 110, 102, 111, 80, 114, 111, 99, 101, 115, 115, 105, 110, 103, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 114, 105,
+    110, 116, 115, 32, 101, 113, 117, 97, 116, 105, 111, 110, 32, 99, 111, 111, 114, 100, 105, 110, 97, 116, 101, 115,
+    32, 97, 115, 32, 116, 104, 101, 121, 39, 114, 101, 32, 112, 114, 111, 99, 101, 115, 115, 101, 100, 46, 34, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 80, 114, 105, 110, 116, 77, 101, 116, 97, 69, 113, 117,
+    97, 116, 105, 111, 110, 73, 110, 102, 111, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 112,
+    114, 105, 110, 116, 105, 110, 103, 32, 111, 102, 32, 109, 101, 116, 97, 45, 101, 113, 117, 97, 116, 105, 111, 110,
+    32, 100, 97, 116, 97, 46, 32, 32, 68, 101, 98, 117, 103, 32, 98, 117, 105, 108, 100, 115, 32, 111, 110, 108, 121,
+    46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32,
+    32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 49,
+    51, 55, 49, 55, 53, 56, 51, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105,
+    110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 112, 114, 105, 110, 116, 77, 101, 116, 97, 69, 113, 117, 97, 116, 105, 111, 110, 73, 110, 102, 111, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 114, 105, 110, 116, 77, 101, 116, 97, 69,
+    113, 117, 97, 116, 105, 111, 110, 73, 110, 102, 111, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116,
+    114, 117, 101, 44, 32, 116, 104, 101, 32, 109, 101, 116, 97, 45, 101, 113, 117, 97, 116, 105, 111, 110, 115, 32,
+    119, 105, 108, 108, 32, 98, 101, 32, 112, 114, 111, 99, 101, 115, 115, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32,
+    99, 112, 117, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 98, 121, 32, 97, 32, 99, 111, 109, 112, 117,
+    116, 101, 32, 115, 104, 97, 100, 101, 114, 46, 69, 109, 117, 108, 97, 116, 105, 111, 110, 44, 32, 100, 101, 98, 117,
+    103, 32, 98, 117, 105, 108, 100, 115, 32, 111, 110, 108, 121, 46, 32, 32, 85, 115, 101, 102, 117, 108, 32, 102, 111,
+    114, 32, 112, 114, 101, 45, 115, 105, 108, 105, 99, 111, 110, 32, 100, 101, 118, 101, 108, 111, 112, 109, 101, 110,
+    116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32,
+    32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 54,
+    50, 51, 57, 51, 54, 51, 49, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115,
+    101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 114, 111, 99, 101, 115, 115, 77, 101, 116, 97, 69, 113, 117,
+    97, 116, 105, 111, 110, 86, 105, 97, 67, 112, 117, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 80, 114, 111, 99, 101, 115, 115, 77, 101, 116, 97, 69, 113, 117, 97, 116, 105, 111, 110, 86, 105, 97, 67,
+    112, 117, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110,
+    117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 79, 112, 116, 105, 109, 105, 122, 101, 100, 70, 97, 115,
+    116, 67, 108, 101, 97, 114, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 116, 104, 101,
+    32, 79, 112, 116, 105, 109, 105, 122, 101, 100, 32, 70, 97, 115, 116, 32, 67, 108, 101, 97, 114, 32, 80, 97, 116,
+    104, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 79, 112,
+    116, 105, 109, 105, 122, 101, 100, 70, 97, 115, 116, 67, 108, 101, 97, 114, 67, 111, 108, 111, 114, 67, 109, 97,
+    115, 107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 69, 110, 97, 98, 108, 101, 32, 79, 112, 116, 105, 109, 105, 122, 101, 100, 32, 70, 97, 115, 116, 32, 67,
+    108, 101, 97, 114, 32, 80, 97, 116, 104, 32, 102, 111, 114, 32, 99, 111, 108, 111, 114, 32, 115, 117, 114, 102, 97,
+    99, 101, 115, 32, 99, 109, 97, 115, 107, 32, 109, 101, 116, 97, 100, 97, 116, 97, 32, 102, 97, 115, 116, 99, 108,
+    101, 97, 114, 40, 109, 115, 97, 97, 32, 111, 110, 108, 121, 41, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 79, 112, 116, 105, 109, 105, 122, 101, 100, 70, 97, 115, 116,
+    67, 108, 101, 97, 114, 67, 111, 108, 111, 114, 68, 99, 99, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 79, 112, 116, 105, 109,
+    105, 122, 101, 100, 32, 70, 97, 115, 116, 32, 67, 108, 101, 97, 114, 32, 80, 97, 116, 104, 32, 102, 111, 114, 32,
+    99, 111, 108, 111, 114, 32, 115, 117, 114, 102, 97, 99, 101, 115, 32, 100, 99, 99, 32, 109, 101, 116, 97, 100, 97,
+    116, 97, 32, 102, 97, 115, 116, 99, 108, 101, 97, 114, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 79, 112, 116, 105, 109, 105, 122, 101, 100, 70, 97, 115, 116, 67, 108,
+    101, 97, 114, 68, 101, 112, 116, 104, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 79, 112, 116, 105, 109, 105, 122, 101, 100,
+    32, 70, 97, 115, 116, 32, 67, 108, 101, 97, 114, 32, 80, 97, 116, 104, 32, 102, 111, 114, 32, 100, 101, 112, 116,
+    104, 32, 115, 117, 114, 102, 97, 99, 101, 115, 32, 104, 116, 105, 108, 101, 32, 109, 101, 116, 97, 100, 97, 116, 97,
+    32, 102, 97, 115, 116, 99, 108, 101, 97, 114, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102,
+    120, 57, 79, 112, 116, 105, 109, 105, 122, 101, 100, 70, 97, 115, 116, 67, 108, 101, 97, 114, 34, 10, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 73, 102, 32, 101, 110, 97, 98, 108, 101, 100, 44, 32, 116, 104, 101, 32, 109, 101, 116, 97, 45, 101, 113,
+    117, 97, 116, 105, 111, 110, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 112, 114, 111, 99, 101, 115, 115, 101,
+    100, 32, 98, 121, 32, 97, 110, 32, 111, 112, 116, 105, 109, 105, 122, 101, 100, 32, 99, 111, 109, 112, 117, 116,
+    101, 32, 115, 104, 97, 100, 101, 114, 32, 97, 110, 100, 32, 97, 108, 103, 111, 114, 105, 116, 104, 109, 46, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101,
+    110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32,
+    32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 55, 53, 55,
+    49, 57, 54, 50, 53, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 55, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51,
+    50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    111, 112, 116, 105, 109, 105, 122, 101, 100, 70, 97, 115, 116, 67, 108, 101, 97, 114, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 112, 116, 105, 109, 105, 122, 101, 100, 70, 97, 115, 116, 67, 108,
+    101, 97, 114, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117,
+    101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 99, 111, 109, 112, 114, 101, 115, 115, 68, 99, 99, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68,
+    67, 67, 32, 100, 101, 99, 111, 109, 112, 114, 101, 115, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 99, 111, 109, 112, 114, 101, 115, 115, 72, 116, 105, 108, 101, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68,
+    101, 112, 116, 104, 32, 101, 120, 112, 97, 110, 100, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 68, 101, 99, 111, 109, 112, 114, 101, 115, 115, 70, 109, 97, 115, 107, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 77, 97, 115,
+    107, 32, 100, 101, 99, 111, 109, 112, 114, 101, 115, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 68, 101, 99, 111, 109, 112, 114, 101, 115, 115, 70, 97, 115, 116, 67, 108, 101, 97, 114,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    70, 97, 115, 116, 32, 99, 108, 101, 97, 114, 32, 101, 108, 105, 109, 105, 110, 97, 116, 101, 46, 34, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 99, 111, 109, 112, 114, 101, 115, 115, 77, 97, 115, 107, 34, 10, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 116, 104, 101, 32,
+    115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 100, 101, 99, 111, 109, 112, 114, 101, 115, 115, 32, 47, 32, 101,
+    120, 112, 97, 110, 100, 32, 47, 32, 101, 108, 105, 109, 105, 110, 97, 116, 101, 32, 111, 112, 101, 114, 97, 116,
+    105, 111, 110, 115, 32, 119, 105, 108, 108, 32, 97, 108, 119, 97, 121, 115, 32, 111, 99, 99, 117, 114, 32, 119, 104,
+    101, 110, 32, 114, 101, 113, 117, 101, 115, 116, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 56, 56, 55, 53, 56, 51, 52, 49, 57, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 66, 105, 116,
+    109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101,
+    120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34,
+    58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97, 108, 119, 97, 121, 115, 68, 101, 99,
+    111, 109, 112, 114, 101, 115, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65,
+    108, 119, 97, 121, 115, 68, 101, 99, 111, 109, 112, 114, 101, 115, 115, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    84, 114, 117, 101, 32, 116, 111, 32, 111, 118, 101, 114, 114, 105, 100, 101, 32, 49, 68, 32, 105, 109, 97, 103, 101,
+    115, 32, 116, 111, 32, 98, 101, 32, 50, 68, 32, 105, 110, 115, 116, 101, 97, 100, 46, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97,
+    108, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 54, 52, 56, 51, 51, 50, 54, 53, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114,
+    117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 114, 101, 97, 116, 49, 100, 65, 115, 50, 100, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 114, 101, 97, 116, 49, 100, 65, 115, 50, 100,
+    34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 115, 32, 97, 32, 102, 97, 115, 116, 32, 99,
+    108, 101, 97, 114, 32, 99, 111, 100, 101, 32, 116, 111, 32, 98, 101, 32, 116, 104, 101, 32, 114, 101, 103, 117, 108,
+    97, 114, 32, 99, 108, 101, 97, 114, 32, 99, 111, 100, 101, 32, 97, 110, 100, 32, 116, 117, 114, 110, 115, 32, 111,
+    102, 102, 32, 65, 67, 48, 49, 32, 99, 111, 109, 112, 114, 101, 115, 115, 105, 111, 110, 32, 119, 104, 105, 99, 104,
+    32, 109, 97, 107, 101, 115, 32, 115, 117, 114, 101, 32, 116, 104, 101, 32, 102, 111, 117, 114, 32, 39, 109, 97, 103,
+    105, 99, 39, 32, 99, 111, 109, 112, 114, 101, 115, 115, 101, 100, 32, 99, 108, 101, 97, 114, 32, 99, 111, 100, 101,
+    115, 32, 97, 114, 101, 110, 39, 116, 32, 117, 115, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 108, 111, 114, 32, 84, 97, 114, 103, 101,
+    116, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 53, 51, 55, 51, 56, 51, 52, 55,
+    54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 102, 111, 114, 99, 101, 82, 101, 103, 117, 108, 97, 114, 67, 108, 101, 97, 114, 67, 111, 100, 101, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 111, 114, 99, 101, 82, 101, 103, 117, 108,
+    97, 114, 67, 108, 101, 97, 114, 67, 111, 100, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101,
+    115, 32, 117, 115, 101, 32, 111, 102, 32, 97, 32, 103, 114, 97, 112, 104, 105, 99, 115, 32, 102, 105, 108, 108, 32,
+    109, 101, 109, 111, 114, 121, 32, 112, 97, 116, 104, 32, 111, 110, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117,
+    102, 102, 101, 114, 115, 32, 116, 104, 97, 116, 32, 115, 117, 112, 112, 111, 114, 116, 115, 32, 103, 114, 97, 112,
+    104, 105, 99, 115, 32, 111, 112, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 101, 110, 101, 114, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 52, 53, 49, 53, 55, 48, 54, 56, 56, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 111, 114, 99, 101, 71, 114, 97, 112, 104,
+    105, 99, 115, 70, 105, 108, 108, 77, 101, 109, 111, 114, 121, 80, 97, 116, 104, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 111, 114, 99, 101, 71, 114, 97, 112, 104, 105, 99, 115, 70, 105, 108, 108,
+    77, 101, 109, 111, 114, 121, 80, 97, 116, 104, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114,
+    111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 116, 111, 32, 119, 97, 105, 116, 32, 97, 102, 116, 101,
+    114, 32, 70, 47, 73, 32, 119, 104, 101, 110, 32, 99, 104, 97, 110, 103, 105, 110, 103, 32, 116, 97, 114, 103, 101,
+    116, 115, 32, 119, 105, 116, 104, 105, 110, 32, 97, 32, 77, 101, 116, 97, 100, 97, 116, 97, 32, 109, 105, 112, 32,
+    116, 97, 105, 108, 32, 114, 101, 103, 105, 111, 110, 46, 32, 84, 104, 105, 115, 32, 99, 97, 110, 32, 114, 101, 115,
+    111, 108, 118, 101, 32, 99, 111, 114, 114, 117, 112, 116, 105, 111, 110, 115, 32, 114, 101, 108, 97, 116, 101, 100,
+    32, 116, 111, 32, 109, 101, 116, 97, 100, 97, 116, 97, 32, 99, 97, 99, 104, 101, 32, 99, 111, 110, 102, 108, 105,
+    99, 116, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 67, 97, 99, 104, 101, 32, 102, 108, 117, 115, 104, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 50, 51, 50, 56, 49, 48, 48, 57, 52, 48, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 105, 116, 79, 110, 77, 101,
+    116, 97, 100, 97, 116, 97, 77, 105, 112, 84, 97, 105, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 87, 97, 105, 116, 79, 110, 77, 101, 116, 97, 100, 97, 116, 97, 77, 105, 112, 84, 97, 105, 108, 34,
+    10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 119, 114, 105, 116, 101, 115, 32,
+    116, 104, 101, 32, 67, 79, 76, 79, 82, 95, 83, 82, 67, 95, 79, 80, 84, 32, 97, 110, 100, 32, 67, 79, 76, 79, 82, 95,
+    68, 83, 84, 95, 79, 80, 84, 32, 98, 105, 116, 115, 32, 111, 102, 32, 116, 104, 101, 83, 88, 95, 77, 82, 84, 35, 95,
+    66, 76, 69, 78, 68, 95, 79, 80, 84, 32, 102, 111, 114, 32, 66, 108, 101, 110, 100, 32, 83, 116, 97, 116, 101, 115,
+    46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 67, 111, 108, 111, 114, 32, 84, 97, 114, 103, 101, 116, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71,
+    102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 51, 53, 54, 48, 57, 55, 57, 50, 57, 52, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34,
+    58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 108, 101, 110, 100, 79, 112, 116, 105, 109,
+    105, 122, 97, 116, 105, 111, 110, 115, 69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 66, 108, 101, 110, 100, 79, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 69, 110,
+    97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 98, 105, 110,
+    100, 105, 110, 103, 32, 97, 32, 99, 111, 108, 111, 114, 32, 98, 108, 101, 110, 100, 44, 32, 100, 101, 112, 116, 104,
+    32, 115, 116, 101, 110, 99, 105, 108, 32, 111, 114, 32, 77, 83, 65, 65, 32, 115, 116, 97, 116, 101, 32, 111, 98,
+    106, 101, 99, 116, 32, 111, 110, 108, 121, 32, 114, 101, 99, 111, 114, 100, 115, 32, 105, 116, 46, 32, 73, 116, 115,
+    32, 80, 77, 52, 32, 105, 109, 97, 103, 101, 32, 105, 115, 32, 119, 114, 105, 116, 116, 101, 110, 32, 97, 116, 32,
+    116, 104, 101, 32, 110, 101, 120, 116, 32, 100, 114, 97, 119, 44, 32, 116, 111, 103, 101, 116, 104, 101, 114, 32,
+    119, 105, 116, 104, 32, 116, 104, 101, 32, 111, 116, 104, 101, 114, 32, 115, 116, 97, 116, 101, 32, 111, 98, 106,
+    101, 99, 116, 115, 32, 105, 110, 32, 111, 110, 101, 32, 98, 108, 111, 99, 107, 44, 32, 97, 110, 100, 32, 111, 110,
+    108, 121, 32, 105, 102, 32, 116, 104, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 32,
+    104, 97, 115, 32, 110, 111, 116, 32, 97, 108, 114, 101, 97, 100, 121, 32, 112, 114, 111, 103, 114, 97, 109, 109,
+    101, 100, 32, 116, 104, 97, 116, 32, 101, 120, 97, 99, 116, 32, 111, 98, 106, 101, 99, 116, 46, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 109, 109, 97,
+    110, 100, 32, 66, 117, 102, 102, 101, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 101, 114, 102, 111,
+    114, 109, 97, 110, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32,
+    32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 49, 52, 55,
+    52, 48, 56, 51, 55, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97,
+    116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 100, 101, 102, 101, 114, 83, 116, 97, 116, 101, 79, 98, 106, 101, 99, 116, 66, 105,
+    110, 100, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 102, 101, 114, 83,
+    116, 97, 116, 101, 79, 98, 106, 101, 99, 116, 66, 105, 110, 100, 115, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    73, 102, 32, 116, 114, 117, 101, 44, 32, 68, 67, 67, 32, 119, 105, 108, 108, 32, 98, 101, 32, 117, 115, 101, 100,
+    32, 116, 111, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 97, 115, 116, 32, 99, 111, 108, 111, 114, 32, 99, 108,
+    101, 97, 114, 115, 32, 111, 110, 32, 115, 105, 110, 103, 108, 101, 115, 97, 109, 112, 108, 101, 100, 32, 67, 111,
+    108, 111, 114, 32, 84, 97, 114, 103, 101, 116, 32, 73, 109, 97, 103, 101, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 108, 111, 114, 32, 84,
+    97, 114, 103, 101, 116, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32,
+    32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 57, 51, 56,
+    48, 52, 48, 56, 50, 52, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118,
+    97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112,
+    101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101,
+    78, 97, 109, 101, 34, 58, 32, 34, 102, 97, 115, 116, 67, 111, 108, 111, 114, 67, 108, 101, 97, 114, 69, 110, 97, 98,
+    108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 97, 115, 116, 67, 111, 108,
+    111, 114, 67, 108, 101, 97, 114, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102,
+    32, 116, 114, 117, 101, 44, 32, 68, 67, 67, 32, 119, 105, 108, 108, 32, 98, 101, 32, 117, 115, 101, 100, 32, 116,
+    111, 32, 115, 117, 112, 112, 111, 114, 116, 32, 102, 97, 115, 116, 32, 99, 111, 108, 111, 114, 32, 99, 108, 101, 97,
+    114, 115, 32, 111, 110, 32, 115, 105, 110, 103, 108, 101, 115, 97, 109, 112, 108, 101, 100, 32, 51, 68, 32, 67, 111,
+    108, 111, 114, 32, 84, 97, 114, 103, 101, 116, 32, 73, 109, 97, 103, 101, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 108, 111, 114, 32, 84,
+    97, 114, 103, 101, 116, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32,
+    32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 54, 53, 53, 57,
+    56, 55, 56, 54, 50, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97,
+    116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 102, 97, 115, 116, 67, 111, 108, 111, 114, 67, 108, 101, 97, 114, 79, 110, 51, 100,
+    69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 70, 97, 115,
+    116, 67, 111, 108, 111, 114, 67, 108, 101, 97, 114, 79, 110, 51, 68, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 115, 101, 116, 116, 105,
+    110, 103, 32, 111, 102, 32, 116, 104, 101, 32, 67, 66, 95, 67, 79, 76, 79, 82, 95, 73, 78, 70, 79, 46, 70, 77, 65,
+    83, 75, 95, 67, 79, 77, 80, 82, 69, 83, 83, 73, 79, 78, 95, 68, 73, 83, 65, 66, 76, 69, 32, 98, 105, 116, 46, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67,
+    111, 108, 111, 114, 32, 84, 97, 114, 103, 101, 116, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102,
+    120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 50, 55, 49, 55, 56, 50, 50, 56, 53, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102,
+    97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34,
+    58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 109, 97, 115, 107, 67, 111, 109, 112, 114,
+    101, 115, 115, 68, 105, 115, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 70, 109, 97, 115, 107, 67, 111, 109, 112, 114, 101, 115, 115, 68, 105, 115, 97, 98, 108, 101, 34, 10, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 97, 108, 108, 111, 119, 115, 32, 102, 111, 114,
+    32, 110, 111, 110, 45, 122, 101, 114, 111, 32, 102, 77, 97, 115, 107, 32, 112, 105, 112, 101, 45, 98, 97, 110, 107,
+    45, 120, 111, 114, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 67, 111, 108, 111, 114, 32, 84, 97, 114, 103, 101, 116, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 52, 50, 49, 56, 55, 51, 49, 57, 52, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 102, 109, 97, 115, 107,
+    65, 108, 108, 111, 119, 80, 105, 112, 101, 66, 97, 110, 107, 88, 111, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 70, 109, 97, 115, 107, 65, 108, 108, 111, 119, 80, 105, 112, 101, 66, 97, 110,
+    107, 88, 111, 114, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69,
+    110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 68, 99, 99, 79, 110, 67, 111, 109, 112, 117, 116,
+    101, 73, 110, 105, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 79, 110, 101, 32, 116, 105, 109, 101, 32, 105, 110, 105, 116, 34, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 68, 99, 99, 79, 110, 67, 111, 109, 112, 117,
+    116, 101, 70, 97, 115, 116, 67, 108, 101, 97, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 97, 115, 116, 32, 99, 111, 108, 111, 114, 32, 99, 108, 101,
+    97, 114, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 68, 99, 99, 79, 110, 67,
+    111, 109, 112, 117, 116, 101, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 101, 116, 101, 114, 109, 105, 110, 101, 115, 32, 116,
+    104, 101, 32, 115, 105, 116, 117, 97, 116, 105, 111, 110, 115, 32, 111, 110, 32, 119, 104, 105, 99, 104, 32, 97, 32,
+    99, 111, 109, 112, 117, 116, 101, 32, 115, 104, 97, 100, 101, 114, 32, 119, 105, 108, 108, 32, 98, 101, 32, 117,
+    115, 101, 100, 32, 102, 111, 114, 32, 68, 67, 67, 32, 97, 99, 99, 101, 115, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 108, 111, 114, 32, 84,
+    97, 114, 103, 101, 116, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32,
+    32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 57, 53, 48, 53,
+    54, 49, 54, 55, 48, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 51, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51,
+    50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    100, 99, 99, 79, 110, 67, 111, 109, 112, 117, 116, 101, 69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 99, 99, 79, 110, 67, 111, 109, 112, 117, 116, 101, 69, 110, 97, 98,
+    108, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110,
+    117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 83, 105, 110, 103, 108, 101, 83,
+    97, 109, 112, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 83, 105, 110, 103, 108, 101, 32, 115, 97, 109, 112, 108, 101, 32, 114, 101, 110, 100, 101,
+    114, 32, 116, 97, 114, 103, 101, 116, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 83, 114, 103, 98, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 82, 71, 66, 32, 110, 117, 109, 101,
+    114, 105, 99, 32, 102, 111, 114, 109, 97, 116, 32, 105, 109, 97, 103, 101, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 78, 111, 110, 84, 99, 67,
+    111, 109, 112, 97, 116, 83, 104, 97, 100, 101, 114, 82, 101, 97, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 111, 110, 45, 84, 67, 32, 99, 111, 109,
+    112, 97, 116, 105, 98, 108, 101, 32, 115, 104, 97, 100, 101, 114, 32, 114, 101, 97, 100, 34, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 80, 114, 116, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80,
+    97, 114, 116, 105, 97, 108, 108, 121, 32, 114, 101, 115, 105, 100, 101, 110, 116, 32, 116, 101, 120, 116, 117, 114,
+    101, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115,
+    101, 68, 99, 99, 77, 117, 108, 116, 105, 83, 97, 109, 112, 108, 101, 50, 120, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 54, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 50, 120, 32, 109, 117, 108,
+    116, 105, 115, 97, 109, 112, 108, 101, 32, 114, 101, 110, 100, 101, 114, 32, 116, 97, 114, 103, 101, 116, 115, 34,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68,
+    99, 99, 77, 117, 108, 116, 105, 83, 97, 109, 112, 108, 101, 52, 120, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 52, 120, 32, 109, 117, 108, 116, 105, 115,
+    97, 109, 112, 108, 101, 32, 114, 101, 110, 100, 101, 114, 32, 116, 97, 114, 103, 101, 116, 115, 34, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 77, 117,
+    108, 116, 105, 83, 97, 109, 112, 108, 101, 56, 120, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 54, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 56, 120, 32, 109, 117, 108, 116, 105, 115, 97, 109, 112, 108,
+    101, 32, 114, 101, 110, 100, 101, 114, 32, 116, 97, 114, 103, 101, 116, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 69, 113, 97, 97, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 50, 56, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69,
+    81, 65, 65, 32, 114, 101, 110, 100, 101, 114, 32, 116, 97, 114, 103, 101, 116, 115, 34, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68, 99, 99, 70, 111, 114, 78, 111,
+    110, 82, 101, 97, 100, 97, 98, 108, 101, 70, 111, 114, 109, 97, 116, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 53, 54, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 111, 110, 45, 114, 101, 97,
+    100, 97, 98, 108, 101, 32, 98, 117, 116, 32, 115, 116, 105, 108, 108, 32, 114, 101, 110, 100, 101, 114, 97, 98, 108,
+    101, 32, 111, 114, 32, 115, 104, 97, 100, 101, 114, 45, 119, 114, 105, 116, 101, 97, 98, 108, 101, 32, 102, 111,
+    114, 109, 97, 116, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 85, 115, 101, 68,
+    99, 99, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 66, 105, 116, 109, 97, 115, 107, 32, 111, 102, 32, 99, 97, 115, 101, 115, 32,
+    119, 104, 101, 114, 101, 32, 68, 67, 67, 32, 40, 100, 101, 108, 116, 97, 32, 99, 111, 108, 111, 114, 32, 99, 111,
+    109, 112, 114, 101, 115, 115, 105, 111, 110, 41, 32, 115, 117, 114, 102, 97, 99, 101, 115, 32, 119, 105, 108, 108,
+    32, 98, 101, 32, 117, 115, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 108, 111, 114, 32, 84, 97, 114, 103, 101, 116, 115, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 48, 50, 57, 53, 49, 56, 54, 53, 52, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 66, 105, 116,
+    109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101,
+    120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 49, 48, 50, 51, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 117, 115, 101, 68, 99, 99, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85, 115, 101, 68, 99, 99, 34, 10, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 111, 32, 110, 111, 116, 32, 108, 105, 109, 105, 116, 32, 110,
+    117, 109, 98, 101, 114, 32, 111, 102, 32, 119, 97, 118, 101, 115, 32, 105, 110, 32, 102, 108, 105, 103, 104, 116,
+    32, 105, 110, 32, 101, 97, 99, 104, 32, 99, 111, 109, 112, 117, 116, 101, 32, 117, 110, 105, 116, 46, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 76, 101, 115, 115, 84, 104, 97, 110, 79, 114,
+    69, 113, 117, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 105, 109, 105, 116, 115, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101,
+    114, 32, 111, 102, 32, 119, 97, 118, 101, 115, 32, 105, 110, 32, 102, 108, 105, 103, 104, 116, 32, 105, 110, 32,
+    101, 97, 99, 104, 32, 99, 111, 109, 112, 117, 116, 101, 32, 117, 110, 105, 116, 46, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32,
+    116, 104, 101, 32, 87, 65, 86, 69, 83, 95, 80, 69, 82, 95, 83, 72, 32, 102, 105, 101, 108, 100, 32, 105, 110, 32,
+    116, 104, 101, 32, 67, 79, 77, 80, 85, 84, 69, 95, 82, 69, 83, 79, 85, 82, 67, 69, 95, 76, 73, 77, 73, 84, 83, 32,
+    114, 101, 103, 105, 115, 116, 101, 114, 59, 32, 110, 111, 116, 101, 32, 116, 104, 97, 116, 32, 105, 116, 32, 105,
+    115, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 112, 101, 114, 45, 67, 85, 32, 114, 97, 116, 104, 101, 114,
+    32, 116, 104, 97, 110, 32, 112, 101, 114, 45, 83, 72, 32, 102, 111, 114, 32, 99, 111, 110, 118, 101, 110, 105, 101,
+    110, 99, 101, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 67, 111, 109, 112, 117, 116, 101, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 50, 49, 54, 55, 48, 48, 55, 57, 52, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 115, 77, 97,
+    120, 87, 97, 118, 101, 115, 80, 101, 114, 67, 117, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 67, 115, 77, 97, 120, 87, 97, 118, 101, 115, 80, 101, 114, 67, 117, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 115, 32, 108, 111, 99, 107, 105, 110, 103, 46, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 77, 117, 108, 116, 105, 112, 108, 101, 79, 102,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 67, 83, 32, 112, 101, 114, 45, 83, 72, 32, 108, 111, 119, 32, 116, 104, 114, 101, 115, 104, 111,
+    108, 100, 32, 102, 111, 114, 32, 108, 111, 99, 107, 105, 110, 103, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32,
+    76, 79, 67, 75, 95, 84, 72, 82, 69, 83, 72, 79, 76, 68, 32, 102, 105, 101, 108, 100, 32, 105, 110, 32, 116, 104,
+    101, 32, 67, 79, 77, 80, 85, 84, 69, 95, 82, 69, 83, 79, 85, 82, 67, 69, 95, 76, 73, 77, 73, 84, 83, 32, 114, 101,
+    103, 105, 115, 116, 101, 114, 46, 32, 67, 83, 32, 112, 101, 114, 45, 83, 72, 32, 108, 111, 119, 32, 116, 104, 114,
+    101, 115, 104, 111, 108, 100, 32, 102, 111, 114, 32, 108, 111, 99, 107, 105, 110, 103, 46, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 67, 111, 109, 112, 117,
+    116, 101, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102,
+    120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 51, 52, 54, 49, 49, 48, 48, 55, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 115, 76, 111, 99, 107, 84, 104, 114, 101, 115, 104, 111,
+    108, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 76, 111, 99, 107, 84,
+    104, 114, 101, 115, 104, 111, 108, 100, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 83, 105, 109, 100, 68, 101, 115,
+    116, 67, 110, 116, 108, 68, 101, 102, 97, 117, 108, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 75, 101, 101, 112, 115, 32, 116, 104, 101, 32, 100, 101, 102,
+    97, 117, 108, 116, 32, 83, 73, 77, 68, 95, 68, 69, 83, 84, 95, 67, 78, 84, 76, 32, 98, 101, 104, 97, 118, 105, 111,
+    114, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 83, 105, 109,
+    100, 68, 101, 115, 116, 67, 110, 116, 108, 70, 111, 114, 99, 101, 49, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 70, 111, 114, 99, 101, 115, 32, 83, 73, 77,
+    68, 95, 68, 69, 83, 84, 95, 67, 78, 84, 76, 32, 116, 111, 32, 49, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 83, 105, 109, 100, 68, 101, 115, 116, 67, 110, 116, 108, 70, 111,
+    114, 99, 101, 48, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 70, 111, 114, 99, 101, 115, 32, 83, 73, 77, 68, 95, 68, 69, 83, 84, 95, 67, 78, 84, 76, 32, 116,
+    111, 32, 48, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 83, 105, 109, 100, 68, 101, 115,
+    116, 67, 110, 116, 108, 77, 111, 100, 101, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116,
+    104, 101, 32, 83, 73, 77, 68, 95, 68, 69, 83, 84, 95, 67, 78, 84, 76, 32, 102, 105, 101, 108, 100, 32, 111, 102, 32,
+    116, 104, 101, 32, 67, 79, 77, 80, 85, 84, 69, 95, 82, 69, 83, 79, 85, 82, 67, 69, 95, 76, 73, 77, 73, 84, 83, 32,
+    114, 101, 103, 105, 115, 116, 101, 114, 46, 32, 66, 121, 32, 100, 101, 102, 97, 117, 108, 116, 44, 32, 116, 104,
+    105, 115, 32, 102, 108, 97, 103, 32, 105, 115, 32, 99, 97, 108, 117, 108, 97, 116, 101, 100, 32, 98, 97, 115, 101,
+    100, 32, 111, 110, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 119, 97, 118, 101, 115, 32,
+    105, 110, 32, 116, 104, 101, 32, 100, 105, 115, 112, 97, 116, 99, 104, 46, 32, 73, 102, 32, 116, 104, 101, 32, 110,
+    117, 109, 98, 101, 114, 32, 111, 102, 32, 119, 97, 118, 101, 115, 32, 105, 115, 32, 97, 32, 109, 117, 108, 116, 105,
+    112, 108, 101, 32, 111, 102, 32, 52, 44, 32, 116, 104, 105, 115, 32, 102, 108, 97, 103, 32, 105, 115, 32, 115, 101,
+    116, 44, 32, 111, 116, 104, 101, 114, 119, 105, 115, 101, 32, 105, 116, 32, 105, 115, 32, 99, 108, 101, 97, 114,
+    101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 67, 111, 109, 112, 117, 116, 101, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 53, 55, 52, 55, 51, 48, 49, 57, 49, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 34, 67, 115, 83, 105, 109, 100, 68, 101, 115, 116, 67, 110, 116, 108, 68, 101,
+    102, 97, 117, 108, 116, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 99, 115, 83, 105, 109, 100, 68, 101, 115,
+    116, 67, 110, 116, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 83, 105,
+    109, 100, 68, 101, 115, 116, 67, 110, 116, 108, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114,
+    117, 101, 44, 32, 72, 84, 105, 108, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 101, 110, 97, 98, 108, 101, 100,
+    32, 102, 111, 114, 32, 100, 101, 112, 116, 104, 47, 115, 116, 101, 110, 99, 105, 108, 32, 105, 109, 97, 103, 101,
+    115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 50, 51, 55, 57, 57, 56, 56, 56, 55, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 104, 116, 105, 108, 101, 69, 110, 97, 98,
+    108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 72, 116, 105, 108, 101, 69, 110,
+    97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 100, 101, 112,
+    116, 104, 32, 99, 111, 109, 112, 114, 101, 115, 115, 105, 111, 110, 32, 119, 105, 108, 108, 32, 98, 101, 32, 101,
+    110, 97, 98, 108, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 52, 48, 52, 49, 54, 54, 57, 54, 57, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101,
+    116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 72, 116, 105, 108,
+    101, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 101, 112, 116, 104, 67, 111, 109, 112, 114, 101, 115, 115,
+    69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101, 112,
+    116, 104, 67, 111, 109, 112, 114, 101, 115, 115, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 115, 116, 101, 110, 99, 105, 108, 32, 99, 111, 109, 112, 114, 101, 115,
+    115, 105, 111, 110, 32, 119, 105, 108, 108, 32, 98, 101, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 116,
+    104, 47, 83, 116, 101, 110, 99, 105, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10,
+    32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51,
+    48, 52, 49, 52, 51, 50, 49, 57, 50, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117,
+    101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110,
+    34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 114, 117, 101, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 72, 116, 105, 108, 101, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111,
+    111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 115, 116, 101, 110, 99, 105, 108, 67, 111, 109, 112, 114, 101, 115, 115, 69, 110, 97, 98, 108, 101, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 116, 101, 110, 99, 105, 108, 67, 111, 109, 112,
+    114, 101, 115, 115, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117,
+    101, 44, 32, 68, 66, 32, 112, 114, 101, 108, 111, 97, 100, 105, 110, 103, 32, 119, 105, 108, 108, 32, 98, 101, 32,
+    101, 110, 97, 98, 108, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 52, 54, 50, 56, 57, 57, 57, 57, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101,
+    116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 72, 116, 105, 108,
+    101, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34,
+    80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 98, 80, 114, 101, 108, 111, 97, 100, 69, 110, 97, 98, 108,
+    101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 98, 80, 114, 101, 108, 111, 97,
+    100, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44,
+    32, 68, 66, 32, 112, 114, 101, 108, 111, 97, 100, 32, 119, 105, 110, 100, 111, 119, 32, 100, 105, 109, 101, 110,
+    115, 105, 111, 110, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32, 117, 115, 101, 100, 32, 105, 110, 115, 116, 101,
+    97, 100, 32, 111, 102, 32, 116, 104, 101, 32, 100, 101, 112, 116, 104, 32, 98, 117, 102, 102, 101, 114, 39, 115, 32,
+    100, 105, 109, 101, 110, 115, 105, 111, 110, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 48, 51, 48, 52, 51, 55, 53, 48, 49, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120,
+    57, 72, 116, 105, 108, 101, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 98, 80, 114, 101, 108, 111, 97,
+    100, 87, 105, 110, 69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 68, 98, 80, 114, 101, 108, 111, 97, 100, 87, 105, 110, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 112, 101, 114, 45, 116, 105, 108, 101, 32, 116, 114, 97,
+    99, 107, 105, 110, 103, 32, 111, 102, 32, 101, 120, 112, 47, 99, 108, 101, 97, 114, 32, 119, 105, 108, 108, 32, 98,
+    101, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 57, 57, 55, 49, 51, 49, 54, 53, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 72, 116,
+    105, 108, 101, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34,
+    58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 98, 80, 101, 114, 84, 105, 108, 101, 69, 120,
+    112, 67, 108, 101, 97, 114, 69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 68, 98, 80, 101, 114, 84, 105, 108, 101, 69, 120, 112, 67, 108, 101, 97, 114, 69, 110, 97, 98, 108, 101,
+    34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 104, 105, 101, 114, 97, 114,
+    99, 104, 105, 99, 97, 108, 32, 100, 101, 112, 116, 104, 32, 116, 101, 115, 116, 105, 110, 103, 32, 119, 105, 108,
+    108, 32, 98, 101, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 57, 53, 48, 49, 52, 56, 54, 48, 52, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57,
+    72, 116, 105, 108, 101, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 104, 105, 68, 101, 112, 116, 104, 69, 110,
+    97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 72, 105, 68, 101, 112,
+    116, 104, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101,
+    44, 32, 104, 105, 101, 114, 97, 114, 99, 104, 105, 99, 97, 108, 32, 115, 116, 101, 110, 99, 105, 108, 32, 116, 101,
+    115, 116, 105, 110, 103, 32, 119, 105, 108, 108, 32, 98, 101, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112,
+    116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34,
+    10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32,
+    51, 55, 56, 54, 50, 51, 55, 51, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101,
+    10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 101, 110, 100, 115, 79, 110, 34,
+    58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 101, 116, 116, 105, 110, 103, 115, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117,
+    101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 114, 117, 101, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 72, 116, 105, 108, 101, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111,
+    108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    104, 105, 83, 116, 101, 110, 99, 105, 108, 69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 72, 105, 83, 116, 101, 110, 99, 105, 108, 69, 110, 97, 98, 108, 101, 34, 10, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117,
+    101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 50, 53, 54, 45, 98, 105, 116, 32, 114, 101, 113, 117, 101,
+    115, 116, 32, 115, 105, 122, 101, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 53, 49, 50, 45, 98, 105, 116, 32, 114, 101, 113, 117, 101, 115, 116, 32, 115, 105, 122, 101,
+    46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 112,
+    101, 99, 105, 102, 105, 101, 115, 32, 116, 104, 101, 32, 68, 66, 32, 114, 101, 97, 100, 32, 114, 101, 113, 117, 101,
+    115, 116, 32, 115, 105, 122, 101, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 56, 51, 53, 49, 52, 53, 52, 54, 49, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 98, 82, 101, 113,
+    117, 101, 115, 116, 83, 105, 122, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68,
+    98, 82, 101, 113, 117, 101, 115, 116, 83, 105, 122, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101,
+    10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32,
+    116, 104, 101, 32, 68, 66, 95, 82, 69, 78, 68, 69, 82, 95, 79, 86, 69, 82, 82, 73, 68, 69, 50, 46, 68, 73, 83, 65,
+    66, 76, 69, 95, 67, 79, 76, 79, 82, 95, 79, 78, 95, 86, 65, 76, 73, 68, 65, 84, 73, 79, 78, 32, 114, 101, 103, 105,
+    115, 116, 101, 114, 32, 102, 105, 101, 108, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 112, 116, 104, 47, 83, 116, 101, 110, 99, 105, 108, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 48, 53, 55, 52, 49, 54, 57, 49, 56, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111,
+    108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    100, 98, 68, 105, 115, 97, 98, 108, 101, 67, 111, 108, 111, 114, 79, 110, 86, 97, 108, 105, 100, 97, 116, 105, 111,
+    110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 98, 68, 105, 115, 97, 98, 108,
+    101, 67, 111, 108, 111, 114, 79, 110, 86, 97, 108, 105, 100, 97, 116, 105, 111, 110, 34, 10, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 111, 110, 99, 104, 105, 112, 32, 71, 83, 32, 119, 105, 108,
+    108, 32, 98, 101, 32, 117, 115, 101, 100, 32, 105, 102, 32, 112, 111, 115, 115, 105, 98, 108, 101, 46, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97,
+    112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 52, 48, 51, 52, 52, 54, 49, 56, 51, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97, 98, 108, 101, 79, 110,
+    99, 104, 105, 112, 71, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97,
+    98, 108, 101, 79, 110, 99, 104, 105, 112, 71, 115, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 117, 116, 79,
+    102, 79, 114, 100, 101, 114, 80, 114, 105, 109, 68, 105, 115, 97, 98, 108, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 108, 119, 97, 121, 115, 32,
+    100, 105, 115, 97, 98, 108, 101, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 79, 117, 116, 79, 102, 79, 114, 100, 101, 114, 80, 114, 105, 109, 83, 97, 102, 101, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101,
+    32, 119, 104, 101, 110, 32, 107, 110, 111, 119, 110, 32, 116, 111, 32, 110, 111, 116, 32, 97, 102, 102, 101, 99,
+    116, 32, 114, 101, 110, 100, 101, 114, 32, 111, 117, 116, 112, 117, 116, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 117, 116, 79, 102, 79, 114, 100, 101, 114, 80, 114, 105, 109, 65, 103,
+    103, 114, 101, 115, 115, 105, 118, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 32, 119, 104, 101, 110, 32, 115, 117, 115, 112,
+    101, 99, 116, 101, 100, 32, 116, 111, 32, 110, 111, 116, 32, 97, 102, 102, 101, 99, 116, 32, 114, 101, 110, 100,
+    101, 114, 32, 111, 117, 116, 112, 117, 116, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 79, 117, 116, 79, 102, 79, 114, 100, 101, 114, 80, 114, 105, 109, 65, 108, 119, 97, 121, 115, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65,
+    108, 119, 97, 121, 115, 32, 101, 110, 97, 98, 108, 101, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    79, 117, 116, 79, 102, 79, 114, 100, 101, 114, 80, 114, 105, 109, 77, 111, 100, 101, 34, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69,
+    110, 97, 98, 108, 101, 32, 111, 117, 116, 45, 111, 102, 45, 111, 114, 100, 101, 114, 32, 112, 114, 105, 109, 105,
+    116, 105, 118, 101, 32, 109, 111, 100, 101, 46, 32, 79, 110, 108, 121, 32, 97, 118, 97, 105, 108, 97, 98, 108, 101,
+    32, 111, 110, 32, 112, 97, 114, 116, 115, 32, 116, 104, 97, 116, 32, 104, 97, 118, 101, 32, 109, 111, 114, 101, 32,
+    116, 104, 97, 110, 32, 111, 110, 101, 32, 86, 71, 84, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101,
+    108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32,
+    32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 49, 57, 52, 54,
+    50, 52, 54, 50, 51, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 79, 117, 116, 79, 102, 79, 114,
+    100, 101, 114, 80, 114, 105, 109, 83, 97, 102, 101, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75,
+    101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97, 98,
+    108, 101, 79, 117, 116, 79, 102, 79, 114, 100, 101, 114, 80, 114, 105, 109, 105, 116, 105, 118, 101, 115, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 79, 117, 116, 79, 102,
+    79, 114, 100, 101, 114, 80, 114, 105, 109, 105, 116, 105, 118, 101, 115, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32,
+    34, 76, 101, 115, 115, 84, 104, 97, 110, 79, 114, 69, 113, 117, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 86, 97, 108, 117, 101, 115,
+    32, 97, 114, 101, 32, 108, 111, 103, 40, 50, 41, 32, 111, 102, 32, 116, 104, 101, 32, 119, 97, 116, 101, 114, 109,
+    97, 114, 107, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    55, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    84, 104, 101, 32, 119, 97, 116, 101, 114, 109, 97, 114, 107, 32, 118, 97, 108, 117, 101, 32, 102, 111, 114, 32, 111,
+    117, 116, 45, 111, 102, 45, 111, 114, 100, 101, 114, 32, 112, 114, 105, 109, 105, 116, 105, 118, 101, 115, 46, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71,
+    114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 50, 49, 57, 52, 57, 53, 50, 48, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 55, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 111, 117, 116, 79, 102, 79, 114,
+    100, 101, 114, 87, 97, 116, 101, 114, 109, 97, 114, 107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 79, 117, 116, 79, 102, 79, 114, 100, 101, 114, 87, 97, 116, 101, 114, 109, 97, 114, 107, 34, 10, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 116, 104, 101, 32, 72, 87, 45, 71, 83, 32,
+    115, 116, 97, 103, 101, 32, 119, 105, 108, 108, 32, 112, 114, 101, 102, 101, 114, 32, 116, 111, 32, 115, 101, 110,
+    100, 32, 97, 32, 119, 97, 118, 101, 32, 116, 111, 32, 101, 97, 99, 104, 32, 83, 73, 77, 68, 32, 105, 110, 32, 97,
+    32, 67, 85, 32, 98, 101, 102, 111, 114, 101, 32, 109, 111, 118, 105, 110, 103, 32, 116, 111, 32, 116, 104, 101, 32,
+    110, 101, 120, 116, 32, 101, 110, 97, 98, 108, 101, 100, 32, 67, 85, 46, 32, 73, 102, 32, 102, 97, 108, 115, 101,
+    44, 32, 72, 87, 45, 71, 83, 32, 112, 114, 101, 102, 101, 114, 115, 32, 116, 111, 32, 115, 101, 110, 100, 32, 111,
+    110, 108, 121, 32, 111, 110, 101, 32, 119, 97, 118, 101, 32, 116, 111, 32, 101, 97, 99, 104, 32, 67, 85, 32, 98,
+    101, 102, 111, 114, 101, 32, 109, 111, 118, 105, 110, 103, 32, 116, 111, 32, 116, 104, 101, 32, 110, 101, 120, 116,
+    32, 101, 110, 97, 98, 108, 101, 100, 32, 67, 85, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108,
+    105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32,
+    32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 50, 57, 53, 50, 54,
+    50, 57, 54, 55, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97,
+    116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 103, 115, 67, 117, 71, 114, 111, 117, 112, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 115, 67, 117, 71, 114, 111, 117, 112, 69, 110, 97,
+    98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 77, 117, 108, 116, 105, 112, 108, 101, 79, 102,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 77, 117, 115, 116, 32, 98, 101, 32, 49, 50, 56, 32, 100, 119, 111, 114, 100, 32, 97, 108, 105, 103,
+    110, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 49, 50, 56, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 97, 109, 111, 117, 110, 116, 32, 111, 102, 32, 76, 68, 83, 32, 115,
+    112, 97, 99, 101, 32, 116, 111, 32, 97, 108, 108, 111, 99, 32, 102, 111, 114, 32, 101, 97, 99, 104, 32, 111, 110,
+    45, 99, 104, 105, 112, 32, 71, 83, 32, 115, 117, 98, 103, 114, 111, 117, 112, 44, 32, 105, 110, 32, 68, 87, 79, 82,
+    68, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 48, 51, 51, 55, 53, 57, 53, 51, 51, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 56, 49, 57, 50, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101,
+    121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 115, 77,
+    97, 120, 76, 100, 115, 83, 105, 122, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    71, 115, 77, 97, 120, 76, 100, 115, 83, 105, 122, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116,
+    104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 71, 83, 32, 112, 114, 105, 109, 115, 32, 112, 101, 114,
+    32, 115, 117, 98, 103, 114, 111, 117, 112, 32, 42, 32, 71, 83, 32, 105, 110, 115, 116, 97, 110, 99, 101, 32, 99,
+    111, 117, 110, 116, 32, 105, 115, 32, 108, 101, 115, 115, 32, 116, 104, 97, 110, 32, 116, 104, 105, 115, 32, 116,
+    104, 114, 101, 115, 104, 111, 108, 100, 32, 117, 115, 101, 32, 111, 102, 102, 45, 99, 104, 105, 112, 32, 71, 83, 46,
+    32, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 53, 57, 48, 55, 53, 54, 57, 55, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 54, 52, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 115, 79, 102, 102, 67,
+    104, 105, 112, 84, 104, 114, 101, 115, 104, 111, 108, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 71, 115, 79, 102, 102, 67, 104, 105, 112, 84, 104, 114, 101, 115, 104, 111, 108, 100, 34, 10, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 84, 97, 114, 103, 101, 116, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 71,
+    83, 32, 112, 114, 105, 109, 115, 32, 112, 101, 114, 32, 115, 117, 98, 103, 114, 111, 117, 112, 32, 119, 104, 101,
+    110, 32, 114, 117, 110, 110, 105, 110, 103, 32, 119, 105, 116, 104, 32, 111, 110, 45, 99, 104, 105, 112, 32, 71, 83,
+    46, 32, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 48, 55, 52, 51, 55, 55, 54, 50, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 54, 52, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 105, 100, 101, 97, 108, 71,
+    115, 80, 114, 105, 109, 115, 80, 101, 114, 83, 117, 98, 71, 114, 111, 117, 112, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 115, 80, 114, 105, 109, 115, 80, 101, 114, 83, 117, 98, 71, 114, 111, 117,
+    112, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105,
+    100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 76, 101, 115, 115, 84, 104, 97, 110, 79, 114, 69, 113,
+    117, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49,
+    50, 55, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 118, 97, 108, 117, 101, 32, 102, 111, 114, 32,
+    108, 97, 116, 101, 45, 97, 108, 108, 111, 99, 32, 71, 83, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112,
+    101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32,
+    32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 48, 50,
+    53, 48, 56, 48, 48, 52, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 54, 10, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97,
+    109, 101, 34, 58, 32, 34, 108, 97, 116, 101, 65, 108, 108, 111, 99, 71, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 76, 97, 116, 101, 65, 108, 108, 111, 99, 71, 115, 34, 10, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 97, 116,
+    101, 65, 108, 108, 111, 99, 86, 115, 66, 101, 104, 97, 118, 105, 111, 114, 76, 101, 103, 97, 99, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110,
+    97, 98, 108, 101, 32, 108, 97, 116, 101, 45, 97, 108, 108, 111, 99, 32, 118, 115, 44, 32, 98, 117, 116, 32, 105,
+    110, 99, 111, 114, 114, 101, 99, 116, 108, 121, 32, 109, 97, 115, 107, 115, 32, 111, 102, 102, 32, 67, 85, 115, 32,
+    105, 110, 32, 100, 121, 110, 97, 109, 105, 99, 32, 109, 111, 100, 101, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 97, 116, 101, 65, 108, 108, 111, 99, 86, 115, 66, 101, 104, 97, 118, 105,
+    111, 114, 68, 121, 110, 97, 109, 105, 99, 69, 110, 97, 98, 108, 101, 65, 108, 108, 67, 117, 115, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98,
+    108, 101, 32, 108, 97, 116, 101, 45, 97, 108, 108, 111, 99, 32, 118, 115, 44, 32, 98, 117, 116, 32, 100, 111, 110,
+    39, 116, 32, 109, 97, 115, 107, 32, 111, 102, 102, 32, 67, 85, 115, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 76, 97, 116, 101, 65, 108, 108, 111, 99, 86, 115, 66, 101, 104, 97, 118, 105, 111,
+    114, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 32, 108, 97, 116, 101, 45, 97, 108,
+    108, 111, 99, 32, 118, 115, 32, 101, 110, 116, 105, 114, 101, 108, 121, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 76, 97, 116, 101, 65, 108, 108, 111, 99, 86, 115, 66, 101, 104, 97, 118, 105, 111, 114, 34, 10, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 98, 101, 104, 97, 118, 105, 111, 114, 32,
+    102, 111, 114, 32, 108, 97, 116, 101, 45, 97, 108, 108, 111, 99, 32, 86, 83, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115,
+    32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57,
+    34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 49, 56, 48, 53, 48, 50, 51, 57, 51, 51, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 76,
+    97, 116, 101, 65, 108, 108, 111, 99, 86, 115, 66, 101, 104, 97, 118, 105, 111, 114, 76, 101, 103, 97, 99, 121, 34,
+    10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 108, 97, 116, 101, 65, 108, 108, 111, 99, 86, 115, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 76, 97, 116, 101, 65, 108, 108, 111, 99, 86, 115, 34, 10, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 67, 108, 97, 109, 112, 115, 32, 116, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109,
+    32, 116, 101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 32, 102, 97, 99, 116, 111, 114, 46, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112,
+    104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 51, 50, 55, 50, 53, 48, 52, 49, 49, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 54, 52, 46, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 109, 97, 120, 84, 101, 115, 115, 70, 97,
+    99, 116, 111, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 77, 97, 120, 84, 101,
+    115, 115, 70, 97, 99, 116, 111, 114, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 76, 111, 103, 105, 99, 79, 112, 34, 58, 32, 34, 76, 101, 115, 115, 84, 104, 97,
+    110, 79, 114, 69, 113, 117, 97, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 117, 109, 98, 101, 114, 32, 111, 102, 32, 111, 102, 102,
+    99, 104, 105, 112, 32, 116, 101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 32, 98, 117, 102, 102, 101, 114,
+    115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 53, 48,
+    56, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 10, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 76, 68,
+    83, 32, 98, 117, 102, 102, 101, 114, 115, 32, 117, 115, 101, 100, 32, 102, 111, 114, 32, 111, 102, 102, 99, 104,
+    105, 112, 32, 116, 101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 58, 32, 71, 102, 120, 57, 58, 32, 49, 45,
+    62, 53, 48, 56, 58, 32, 78, 117, 109, 98, 101, 114, 32, 111, 102, 32, 111, 102, 102, 99, 104, 105, 112, 32, 116,
+    101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 32, 98, 117, 102, 102, 101, 114, 115, 46, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104,
+    105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71,
+    102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 52, 49, 53, 48, 57, 49, 53, 52, 55, 48, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    53, 48, 56, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 110, 117, 109, 79, 102, 102, 99, 104, 105, 112,
+    76, 100, 115, 66, 117, 102, 102, 101, 114, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 78, 117, 109, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 115, 34, 10, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101,
+    114, 32, 111, 102, 32, 112, 97, 116, 99, 104, 101, 115, 45, 112, 101, 114, 45, 116, 104, 114, 101, 97, 100, 45, 103,
+    114, 111, 117, 112, 32, 116, 111, 32, 114, 117, 110, 32, 119, 104, 101, 110, 32, 116, 101, 115, 115, 101, 108, 108,
+    97, 116, 105, 111, 110, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 46, 32, 84, 104, 105, 115, 32, 118, 97, 108,
+    117, 101, 32, 105, 115, 32, 110, 111, 114, 109, 97, 108, 108, 121, 32, 108, 105, 109, 105, 116, 101, 100, 32, 98,
+    121, 32, 104, 97, 114, 100, 119, 97, 114, 101, 32, 114, 101, 115, 111, 117, 114, 99, 101, 115, 32, 40, 76, 68, 83,
+    44, 84, 70, 66, 117, 102, 102, 101, 114, 44, 32, 84, 104, 114, 101, 97, 100, 115, 41, 46, 32, 45, 32, 83, 101, 116,
+    116, 105, 110, 103, 32, 116, 111, 32, 49, 32, 119, 105, 108, 108, 32, 97, 108, 119, 97, 121, 115, 32, 119, 111, 114,
+    107, 44, 32, 98, 117, 116, 32, 105, 115, 32, 115, 108, 111, 119, 101, 115, 116, 46, 32, 45, 32, 83, 101, 116, 116,
+    105, 110, 103, 32, 116, 111, 32, 48, 32, 119, 105, 108, 108, 32, 97, 108, 108, 111, 119, 32, 116, 104, 101, 32, 100,
+    114, 105, 118, 101, 114, 32, 116, 111, 32, 99, 104, 111, 111, 115, 101, 32, 116, 104, 101, 32, 111, 112, 116, 105,
+    109, 97, 108, 32, 118, 97, 108, 117, 101, 46, 32, 45, 32, 65, 110, 121, 32, 111, 116, 104, 101, 114, 32, 118, 97,
+    108, 117, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 117, 115, 101, 100, 32, 40, 99, 108, 97, 109, 112, 101, 100,
+    32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 72, 87, 32, 114, 101, 115, 111, 117, 114, 99, 101, 115, 41, 46, 32, 79,
+    102, 102, 99, 104, 105, 112, 32, 84, 101, 115, 115, 32, 114, 111, 117, 110, 100, 115, 32, 116, 104, 105, 115, 32,
+    116, 111, 32, 116, 104, 101, 32, 110, 101, 97, 114, 101, 115, 116, 32, 109, 117, 108, 116, 105, 112, 108, 101, 32,
+    111, 102, 32, 102, 111, 117, 114, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101,
+    115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 57, 57, 53, 51, 50, 51, 48, 50,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102,
+    120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110,
+    116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 110, 117, 109, 84, 101, 115, 115, 80, 97, 116, 99, 104, 101, 115, 80, 101, 114, 84, 103, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 117, 109, 84, 101, 115, 115, 80, 97, 116, 99, 104, 101,
+    115, 80, 101, 114, 84, 104, 114, 101, 97, 100, 71, 114, 111, 117, 112, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117,
+    101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 56, 49, 57, 50, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 56,
+    107, 32, 68, 87, 79, 82, 68, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 52, 48, 57, 54,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    52, 107, 32, 68, 87, 79, 82, 68, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 50, 48, 52,
+    56, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 50, 107, 32, 68, 87, 79, 82, 68, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 49, 48,
+    50, 52, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 49, 107, 32, 68, 87, 79, 82, 68, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 102,
+    102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 34, 10, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 115, 105, 122, 101, 32, 111, 102, 32, 101, 97, 99,
+    104, 32, 111, 102, 102, 99, 104, 105, 112, 32, 76, 68, 83, 32, 66, 117, 102, 102, 101, 114, 46, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104,
+    105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71,
+    102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 52, 50, 54, 50, 56, 51, 57, 55, 57, 56, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    34, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 56, 49, 57, 50,
+    34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 111, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102,
+    101, 114, 83, 105, 122, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 102, 102,
+    99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 34, 10, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 85, 115, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 104, 97, 114, 100, 119, 97, 114, 101, 32, 119,
+    104, 101, 110, 32, 100, 105, 115, 116, 114, 105, 98, 117, 116, 101, 100, 32, 116, 101, 115, 115, 101, 108, 108, 97,
+    116, 105, 111, 110, 32, 105, 115, 32, 97, 99, 116, 105, 118, 101, 58, 32, 116, 104, 101, 32, 109, 105, 110, 32, 116,
+    101, 115, 115, 32, 102, 97, 99, 116, 111, 114, 115, 32, 102, 111, 114, 32, 101, 97, 99, 104, 32, 112, 97, 116, 99,
+    104, 32, 112, 114, 111, 99, 101, 115, 115, 101, 100, 32, 98, 121, 32, 97, 32, 86, 71, 84, 32, 97, 114, 101, 32, 97,
+    99, 99, 117, 109, 117, 108, 97, 116, 101, 100, 46, 32, 87, 104, 101, 110, 32, 116, 104, 101, 32, 115, 117, 109, 32,
+    101, 120, 99, 101, 101, 100, 115, 32, 116, 104, 105, 115, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 44, 32,
+    116, 104, 101, 32, 110, 101, 120, 116, 32, 112, 97, 116, 99, 104, 32, 105, 115, 32, 115, 101, 110, 116, 32, 116,
+    111, 32, 97, 32, 100, 105, 102, 102, 101, 114, 101, 110, 116, 32, 86, 71, 84, 46, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99,
+    115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120,
+    57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 57, 53, 49, 57, 54, 49, 54, 51, 51, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 52, 48,
+    10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 105, 115, 111, 108, 105, 110, 101, 68, 105, 115, 116, 114, 105,
+    98, 117, 116, 105, 111, 110, 70, 97, 99, 116, 111, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 73, 115, 111, 108, 105, 110, 101, 68, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 70, 97,
+    99, 116, 111, 114, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 100, 32, 98, 121, 32, 116, 104, 101,
+    32, 104, 97, 114, 100, 119, 97, 114, 101, 32, 119, 104, 101, 110, 32, 100, 105, 115, 116, 114, 105, 98, 117, 116,
+    101, 100, 32, 116, 101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 32, 105, 115, 32, 97, 99, 116, 105, 118,
+    101, 58, 32, 116, 104, 101, 32, 109, 105, 110, 32, 116, 101, 115, 115, 32, 102, 97, 99, 116, 111, 114, 115, 32, 102,
+    111, 114, 32, 101, 97, 99, 104, 32, 112, 97, 116, 99, 104, 32, 112, 114, 111, 99, 101, 115, 115, 101, 100, 32, 98,
+    121, 32, 97, 32, 86, 71, 84, 32, 97, 114, 101, 32, 97, 99, 99, 117, 109, 117, 108, 97, 116, 101, 100, 46, 32, 87,
+    104, 101, 110, 32, 116, 104, 101, 32, 115, 117, 109, 32, 101, 120, 99, 101, 101, 100, 115, 32, 116, 104, 105, 115,
+    32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 44, 32, 116, 104, 101, 32, 110, 101, 120, 116, 32, 112, 97, 116,
+    99, 104, 32, 105, 115, 32, 115, 101, 110, 116, 32, 116, 111, 32, 97, 32, 100, 105, 102, 102, 101, 114, 101, 110,
+    116, 32, 86, 71, 84, 46, 32, 82, 101, 99, 111, 109, 109, 101, 110, 100, 101, 100, 32, 116, 111, 32, 98, 101, 32,
+    104, 105, 103, 104, 101, 114, 32, 116, 104, 97, 110, 32, 113, 117, 97, 100, 32, 102, 97, 99, 116, 111, 114, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114,
+    97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 50, 56, 54, 55, 53, 54, 54, 49, 55, 53, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 51, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 114, 105, 68, 105, 115, 116, 114,
+    105, 98, 117, 116, 105, 111, 110, 70, 97, 99, 116, 111, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 84, 114, 105, 68, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 70, 97, 99, 116, 111,
+    114, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 104, 97,
+    114, 100, 119, 97, 114, 101, 32, 119, 104, 101, 110, 32, 100, 105, 115, 116, 114, 105, 98, 117, 116, 101, 100, 32,
+    116, 101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 32, 105, 115, 32, 97, 99, 116, 105, 118, 101, 58, 32,
+    116, 104, 101, 32, 109, 105, 110, 32, 116, 101, 115, 115, 32, 102, 97, 99, 116, 111, 114, 115, 32, 102, 111, 114,
+    32, 101, 97, 99, 104, 32, 112, 97, 116, 99, 104, 32, 112, 114, 111, 99, 101, 115, 115, 101, 100, 32, 98, 121, 32,
+    97, 32, 86, 71, 84, 32, 97, 114, 101, 32, 97, 99, 99, 117, 109, 117, 108, 97, 116, 101, 100, 46, 32, 87, 104, 101,
+    110, 32, 116, 104, 101, 32, 115, 117, 109, 32, 101, 120, 99, 101, 101, 100, 115, 32, 116, 104, 105, 115, 32, 116,
+    104, 114, 101, 115, 104, 111, 108, 100, 44, 32, 116, 104, 101, 32, 110, 101, 120, 116, 32, 112, 97, 116, 99, 104,
+    32, 105, 115, 32, 115, 101, 110, 116, 32, 116, 111, 32, 97, 32, 100, 105, 102, 102, 101, 114, 101, 110, 116, 32, 86,
+    71, 84, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 54, 48, 48, 49, 53, 57, 49, 57, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 50, 52, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 113, 117, 97, 100, 68,
+    105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 70, 97, 99, 116, 111, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 81, 117, 97, 100, 68, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110,
+    70, 97, 99, 116, 111, 114, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 100, 32, 98, 121, 32, 116, 104,
+    101, 32, 104, 97, 114, 100, 119, 97, 114, 101, 32, 119, 104, 101, 110, 32, 100, 105, 115, 116, 114, 105, 98, 117,
+    116, 101, 100, 32, 116, 101, 115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 32, 105, 115, 32, 105, 110, 32, 68,
+    79, 78, 85, 84, 32, 109, 111, 100, 101, 58, 32, 116, 104, 101, 32, 109, 105, 110, 32, 116, 101, 115, 115, 32, 102,
+    97, 99, 116, 111, 114, 32, 102, 111, 114, 32, 101, 97, 99, 104, 32, 112, 97, 116, 99, 104, 32, 105, 115, 32, 116,
+    101, 115, 116, 101, 100, 32, 97, 103, 97, 105, 110, 115, 116, 32, 116, 104, 105, 115, 32, 116, 104, 114, 101, 115,
+    104, 111, 108, 100, 32, 116, 111, 32, 100, 101, 116, 101, 114, 109, 105, 110, 101, 32, 119, 104, 101, 116, 104, 101,
+    114, 32, 97, 32, 112, 97, 116, 99, 104, 32, 103, 101, 116, 115, 32, 115, 112, 108, 105, 116, 32, 117, 112, 46, 32,
+    73, 102, 32, 116, 104, 101, 32, 112, 97, 116, 99, 104, 32, 105, 115, 110, 39, 116, 32, 115, 112, 108, 105, 116, 44,
+    32, 105, 116, 32, 115, 116, 105, 108, 108, 32, 105, 110, 99, 114, 101, 109, 101, 110, 116, 115, 32, 116, 104, 101,
+    32, 97, 99, 99, 117, 109, 117, 108, 97, 116, 111, 114, 32, 102, 111, 114, 32, 116, 104, 101, 32, 80, 97, 116, 99,
+    104, 32, 100, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 32, 102, 97, 99, 116, 111, 114, 46, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97,
+    112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 56, 57, 49, 56, 56, 49, 49, 56, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 50, 52, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 111, 110, 117, 116, 68, 105, 115, 116,
+    114, 105, 98, 117, 116, 105, 111, 110, 70, 97, 99, 116, 111, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 68, 111, 110, 117, 116, 68, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 70, 97,
+    99, 116, 111, 114, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 85, 115, 101, 100, 32, 119, 104, 101, 110, 32, 116,
+    104, 101, 32, 100, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 32, 109, 111, 100, 101, 32, 105, 115, 32,
+    84, 82, 65, 80, 69, 90, 79, 73, 68, 32, 102, 111, 114, 32, 113, 117, 97, 100, 32, 97, 110, 100, 32, 116, 114, 105,
+    32, 100, 111, 109, 97, 105, 110, 32, 116, 121, 112, 101, 115, 46, 32, 84, 104, 101, 32, 110, 117, 109, 98, 101, 114,
+    32, 111, 102, 32, 100, 111, 110, 117, 116, 115, 32, 105, 110, 32, 116, 104, 101, 32, 112, 97, 116, 99, 104, 32, 97,
+    114, 101, 32, 99, 111, 109, 112, 97, 114, 101, 100, 32, 97, 103, 97, 105, 110, 115, 116, 32, 116, 104, 105, 115, 32,
+    118, 97, 108, 117, 101, 32, 116, 111, 32, 100, 101, 116, 101, 109, 105, 110, 101, 32, 119, 104, 101, 116, 104, 101,
+    114, 32, 116, 104, 105, 115, 32, 100, 111, 110, 117, 116, 32, 103, 101, 116, 115, 32, 115, 112, 108, 105, 116, 32,
+    117, 112, 32, 105, 110, 116, 111, 32, 116, 114, 97, 112, 101, 122, 111, 105, 100, 115, 32, 40, 110, 101, 101, 100,
+    115, 32, 116, 104, 101, 32, 112, 97, 116, 99, 104, 32, 116, 111, 32, 98, 101, 32, 105, 110, 32, 100, 111, 110, 117,
+    116, 32, 109, 111, 100, 101, 41, 46, 32, 65, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 48, 32, 111, 114, 32, 49,
+    32, 119, 105, 108, 108, 32, 98, 101, 32, 116, 114, 101, 97, 116, 101, 100, 32, 97, 115, 32, 50, 46, 32, 84, 104,
+    101, 32, 105, 110, 110, 101, 114, 109, 111, 115, 116, 32, 100, 111, 110, 117, 116, 32, 105, 115, 32, 110, 101, 118,
+    101, 114, 32, 97, 108, 108, 111, 119, 101, 100, 32, 116, 111, 32, 98, 101, 32, 98, 114, 111, 107, 101, 110, 32, 105,
+    110, 116, 111, 32, 116, 114, 97, 112, 101, 122, 111, 105, 100, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80,
+    105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10,
+    32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 54,
+    55, 52, 57, 56, 52, 54, 52, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 54, 10, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97,
+    116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 114, 97, 112, 101, 122, 111, 105, 100, 68, 105, 115, 116, 114, 105, 98,
+    117, 116, 105, 111, 110, 70, 97, 99, 116, 111, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 84, 114, 97, 112, 101, 122, 111, 105, 100, 68, 105, 115, 116, 114, 105, 98, 117, 116, 105, 111, 110, 70,
+    97, 99, 116, 111, 114, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 78, 117, 109, 98, 101, 114, 32, 111, 102, 32, 112,
+    114, 105, 109, 105, 116, 105, 118, 101, 115, 32, 115, 101, 110, 116, 32, 116, 111, 32, 111, 110, 101, 32, 86, 71,
+    84, 32, 98, 101, 102, 111, 114, 101, 32, 115, 119, 105, 116, 99, 104, 105, 110, 103, 32, 116, 111, 32, 116, 104,
+    101, 32, 110, 101, 120, 116, 46, 32, 86, 97, 108, 105, 100, 32, 114, 97, 110, 103, 101, 32, 105, 115, 32, 49, 45,
+    54, 53, 53, 51, 54, 44, 32, 118, 97, 108, 117, 101, 115, 32, 108, 97, 114, 103, 101, 114, 32, 116, 104, 97, 110, 32,
+    50, 53, 54, 32, 97, 114, 101, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32, 116, 111, 32, 104, 117, 114, 116, 112,
+    101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 46, 32, 84, 104, 105, 115, 32, 115, 101, 116, 116, 105, 110, 103,
+    32, 111, 110, 108, 121, 32, 97, 102, 102, 101, 99, 116, 115, 32, 110, 111, 110, 45, 116, 101, 115, 115, 101, 108,
+    108, 97, 116, 105, 111, 110, 32, 97, 110, 100, 32, 110, 111, 110, 45, 78, 71, 71, 32, 112, 105, 112, 101, 108, 105,
+    110, 101, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 52, 48, 50, 53, 48, 52, 51, 50, 53, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 50, 56, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75,
+    101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 114,
+    105, 109, 71, 114, 111, 117, 112, 83, 105, 122, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 80, 114, 105, 109, 103, 114, 111, 117, 112, 83, 105, 122, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 82, 98, 80, 108, 117, 115, 32, 119, 105, 108, 108, 32, 98, 101, 32,
+    101, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 65, 83, 73, 67, 32, 111, 102, 32, 82, 98, 80, 108, 117, 115,
+    32, 99, 97, 112, 97, 98, 105, 108, 105, 116, 121, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108,
+    105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32,
+    32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 49, 50, 50, 49, 54,
+    52, 51, 48, 50, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 103, 102, 120, 57, 82, 98, 80, 108, 117, 115, 69, 110, 97, 98, 108, 101, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 82, 98, 80, 108, 117, 115, 69, 110, 97, 98, 108, 101, 34, 10,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 87, 104, 101, 110, 32, 118, 97, 108, 117, 101, 32, 105, 115, 32, 103, 114, 101,
+    97, 116, 101, 114, 32, 116, 104, 97, 110, 32, 122, 101, 114, 111, 44, 32, 116, 104, 101, 110, 32, 105, 116, 32, 115,
+    112, 101, 99, 105, 102, 105, 101, 115, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 80, 83,
+    32, 119, 97, 118, 101, 115, 32, 116, 111, 32, 98, 101, 32, 115, 111, 102, 116, 32, 103, 114, 111, 117, 112, 101,
+    100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 55, 49, 53, 57, 48, 54, 50, 49, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 110, 117, 109, 80, 115, 87,
+    97, 118, 101, 115, 83, 111, 102, 116, 71, 114, 111, 117, 112, 101, 100, 80, 101, 114, 67, 117, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 117, 109, 80, 115, 87, 97, 118, 101, 115, 83, 111, 102,
+    116, 71, 114, 111, 117, 112, 101, 100, 80, 101, 114, 67, 117, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 104,
+    101, 110, 32, 118, 97, 108, 117, 101, 32, 105, 115, 32, 103, 114, 101, 97, 116, 101, 114, 32, 116, 104, 97, 110, 32,
+    122, 101, 114, 111, 44, 32, 116, 104, 101, 110, 32, 105, 116, 32, 115, 112, 101, 99, 105, 102, 105, 101, 115, 32,
+    116, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 86, 83, 32, 119, 97, 118, 101, 115, 32, 116, 111,
+    32, 98, 101, 32, 115, 111, 102, 116, 32, 103, 114, 111, 117, 112, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115,
+    32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57,
+    34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 52, 48, 50, 49, 49, 51, 50, 55, 55, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 110, 117, 109, 86, 115, 87, 97, 118, 101, 115, 83, 111, 102,
+    116, 71, 114, 111, 117, 112, 101, 100, 80, 101, 114, 67, 117, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 78, 117, 109, 86, 115, 87, 97, 118, 101, 115, 83, 111, 102, 116, 71, 114, 111, 117, 112, 101,
+    100, 80, 101, 114, 67, 117, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32,
+    116, 104, 101, 32, 72, 87, 32, 119, 105, 108, 108, 32, 97, 108, 116, 101, 114, 110, 97, 116, 101, 32, 86, 71, 84,
+    39, 115, 32, 98, 101, 116, 119, 101, 101, 110, 32, 100, 114, 97, 119, 115, 32, 114, 97, 116, 104, 101, 114, 32, 116,
+    104, 97, 110, 32, 98, 101, 116, 119, 101, 101, 110, 32, 115, 101, 116, 115, 32, 111, 102, 32, 112, 114, 105, 109,
+    105, 116, 105, 118, 101, 115, 32, 119, 105, 116, 104, 105, 110, 32, 97, 32, 100, 114, 97, 119, 46, 32, 84, 114, 117,
+    101, 32, 105, 115, 32, 115, 97, 102, 101, 114, 44, 32, 98, 117, 116, 32, 108, 101, 115, 115, 32, 112, 101, 114, 102,
+    111, 114, 109, 97, 110, 116, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 49, 48, 50, 48, 49, 51, 57, 48, 49, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98,
+    111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 115, 119, 105, 116, 99, 104, 86, 103, 116, 79, 110, 68, 114, 97, 119, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 119, 105, 116, 99, 104, 86, 103, 116, 79, 110, 68, 114, 97, 119, 34, 10,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 115, 105, 122,
+    101, 32, 111, 102, 32, 116, 104, 101, 32, 116, 101, 115, 115, 45, 102, 97, 99, 116, 111, 114, 32, 98, 117, 102, 102,
+    101, 114, 46, 32, 84, 104, 105, 115, 32, 115, 105, 122, 101, 32, 105, 115, 32, 112, 101, 114, 45, 83, 69, 44, 32,
+    97, 110, 100, 109, 101, 97, 115, 117, 114, 101, 100, 32, 105, 110, 32, 68, 87, 79, 82, 68, 115, 46, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112,
+    104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 51, 49, 49, 50, 48, 49, 54, 54, 53, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 56, 49, 57, 50, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 116, 101, 115, 115, 70, 97, 99, 116,
+    111, 114, 66, 117, 102, 102, 101, 114, 83, 105, 122, 101, 80, 101, 114, 83, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 84, 101, 115, 115, 70, 97, 99, 116, 111, 114, 66, 117, 102, 102, 101, 114, 83,
+    105, 122, 101, 80, 101, 114, 83, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 86, 101, 114, 116, 101, 120, 32,
+    119, 97, 108, 107, 105, 110, 103, 32, 112, 97, 116, 116, 101, 114, 110, 32, 102, 111, 114, 32, 116, 101, 115, 115,
+    101, 108, 108, 97, 116, 105, 111, 110, 58, 32, 48, 58, 32, 40, 100, 101, 102, 97, 117, 108, 116, 41, 32, 68, 111,
+    110, 117, 116, 32, 119, 97, 108, 107, 105, 110, 103, 32, 112, 97, 116, 116, 101, 114, 110, 32, 102, 111, 114, 32,
+    111, 112, 116, 105, 109, 97, 108, 32, 114, 101, 117, 115, 101, 46, 32, 49, 58, 32, 83, 105, 110, 103, 108, 101, 45,
+    114, 105, 110, 103, 32, 119, 97, 108, 107, 105, 110, 103, 32, 112, 97, 116, 116, 101, 114, 110, 44, 32, 104, 97,
+    115, 32, 115, 117, 98, 111, 112, 116, 105, 109, 97, 108, 32, 114, 101, 117, 115, 101, 46, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104,
+    105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71,
+    102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 50, 57, 55, 50, 52, 52, 57, 52, 53, 51, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 84, 101, 115, 115, 68,
+    111, 110, 117, 116, 87, 97, 108, 107, 80, 97, 116, 116, 101, 114, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 84, 101, 115, 115, 87, 97, 108, 107, 80, 97, 116, 116, 101, 114, 110, 34, 10, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 111, 102, 102, 99, 104, 105, 112, 32, 116, 101,
+    115, 115, 101, 108, 108, 97, 116, 105, 111, 110, 32, 119, 105, 108, 108, 32, 97, 108, 119, 97, 121, 115, 32, 117,
+    115, 101, 32, 116, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102,
+    76, 68, 83, 32, 98, 117, 102, 102, 101, 114, 115, 32, 112, 111, 115, 115, 105, 98, 108, 101, 32, 40, 98, 97, 115,
+    101, 100, 32, 111, 110, 32, 67, 104, 105, 112, 32, 73, 68, 41, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105,
+    112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32,
+    32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 54,
+    53, 48, 56, 54, 52, 50, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98,
+    108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 117, 115, 101, 77, 97, 120, 79, 102, 102, 99, 104, 105, 112, 76, 100,
+    115, 66, 117, 102, 102, 101, 114, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 85,
+    115, 101, 77, 97, 120, 79, 102, 102, 99, 104, 105, 112, 76, 100, 115, 66, 117, 102, 102, 101, 114, 115, 34, 10, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 116, 104, 101, 32, 72, 87, 45, 86, 83, 32,
+    115, 116, 97, 103, 101, 32, 119, 105, 108, 108, 32, 112, 114, 101, 102, 101, 114, 32, 116, 111, 32, 115, 101, 110,
+    100, 32, 97, 32, 119, 97, 118, 101, 32, 116, 111, 32, 101, 97, 99, 104, 32, 83, 73, 77, 68, 32, 105, 110, 32, 97,
+    32, 67, 85, 32, 98, 101, 102, 111, 114, 101, 32, 109, 111, 118, 105, 110, 103, 32, 116, 111, 32, 116, 104, 101, 32,
+    110, 101, 120, 116, 32, 101, 110, 97, 98, 108, 101, 100, 32, 67, 85, 46, 32, 73, 102, 32, 102, 97, 108, 115, 101,
+    44, 32, 72, 87, 45, 86, 83, 32, 112, 114, 101, 102, 101, 114, 115, 32, 116, 111, 32, 115, 101, 110, 100, 32, 111,
+    110, 108, 121, 32, 111, 110, 101, 32, 119, 97, 118, 101, 32, 116, 111, 32, 101, 97, 99, 104, 32, 67, 85, 32, 98,
+    101, 102, 111, 114, 101, 32, 109, 111, 118, 105, 110, 103, 32, 116, 111, 32, 116, 104, 101, 32, 110, 101, 120, 116,
+    32, 101, 110, 97, 98, 108, 101, 100, 32, 67, 85, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108,
+    105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32,
+    32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 55, 49, 50, 50, 57,
+    51, 56, 52, 50, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97,
+    116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 118, 115, 67, 117, 71, 114, 111, 117, 112, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 115, 67, 117, 71, 114, 111, 117, 112, 69, 110, 97,
+    98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 76, 111, 97, 100, 32, 104, 97, 108, 102, 45, 112,
+    97, 99, 107, 101, 100, 32, 86, 83, 32, 119, 97, 118, 101, 115, 44, 32, 102, 111, 114, 99, 105, 110, 103, 32, 116,
+    104, 101, 109, 32, 116, 111, 32, 117, 115, 101, 32, 104, 97, 108, 102, 32, 97, 115, 32, 109, 117, 99, 104, 32, 115,
+    112, 97, 99, 101, 32, 105, 110, 32, 116, 104, 101, 32, 112, 97, 114, 97, 109, 32, 99, 97, 99, 104, 101, 32, 97, 116,
+    32, 116, 104, 101, 32, 101, 120, 112, 101, 110, 115, 101, 32, 111, 102, 32, 105, 110, 101, 102, 102, 105, 99, 105,
+    101, 110, 116, 32, 117, 115, 101, 32, 111, 102, 32, 65, 76, 85, 32, 114, 101, 115, 111, 117, 114, 99, 101, 115, 44,
+    32, 105, 102, 32, 116, 104, 101, 32, 101, 120, 112, 111, 114, 116, 32, 99, 111, 117, 110, 116, 32, 105, 115, 32, 62,
+    61, 32, 116, 104, 105, 115, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 46, 32, 84, 104, 105, 115, 32, 99, 97,
+    110, 32, 104, 101, 108, 112, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32, 105, 110, 32, 115, 111,
+    109, 101, 32, 99, 97, 115, 101, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110,
+    101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 57, 56, 55, 50, 52, 55, 51, 57, 51,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 54, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105,
+    110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 118, 115, 72, 97, 108, 102, 80, 97, 99, 107, 84, 104, 114, 101, 115, 104, 111, 108, 100, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 115, 72, 97, 108, 102, 80, 97, 99, 107, 84, 104, 114,
+    101, 115, 104, 111, 108, 100, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32,
+    102, 111, 114, 99, 101, 115, 32, 116, 104, 101, 32, 86, 71, 84, 32, 116, 111, 32, 105, 115, 115, 117, 101, 32, 97,
+    32, 86, 83, 32, 119, 97, 118, 101, 32, 97, 115, 32, 115, 111, 111, 110, 32, 97, 115, 32, 97, 32, 112, 114, 105, 109,
+    103, 114, 111, 117, 112, 32, 105, 115, 102, 105, 110, 105, 115, 104, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99,
+    115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120,
+    57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 49, 57, 52, 54, 49, 54, 49, 56, 54, 55, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 118, 115, 70, 111, 114, 99, 101, 80, 97, 114, 116,
+    105, 97, 108, 87, 97, 118, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 115,
+    70, 111, 114, 99, 101, 80, 97, 114, 116, 105, 97, 108, 87, 97, 118, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 67, 117, 114, 114, 101, 110, 116, 32, 114, 101, 99, 111, 109, 109, 101, 110, 100, 97, 116, 105, 111, 110, 32,
+    102, 114, 111, 109, 32, 116, 104, 101, 32, 104, 97, 114, 100, 119, 97, 114, 101, 32, 116, 101, 97, 109, 32, 105,
+    115, 32, 116, 111, 32, 102, 111, 114, 99, 101, 32, 80, 65, 95, 83, 67, 95, 67, 79, 78, 83, 69, 82, 86, 65, 84, 73,
+    86, 69, 95, 82, 65, 83, 84, 95, 67, 78, 84, 76, 46, 67, 79, 86, 69, 82, 65, 71, 69, 95, 65, 65, 95, 77, 65, 83, 75,
+    32, 61, 32, 48, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 56, 50, 57, 57, 57, 49, 48, 57, 49, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105,
+    115, 97, 98, 108, 101, 67, 111, 118, 101, 114, 97, 103, 101, 65, 97, 77, 97, 115, 107, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 67, 111, 118, 101, 114, 97, 103, 101,
+    65, 97, 77, 97, 115, 107, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115,
+    69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 120, 99,
+    108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 87, 100, 76, 111, 97, 100, 66, 97, 108,
+    97, 110, 99, 105, 110, 103, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 100, 46, 32, 83,
+    111, 102, 116, 119, 97, 114, 101, 32, 108, 111, 97, 100, 32, 98, 97, 108, 97, 110, 99, 105, 110, 103, 46, 34, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 87, 100, 76, 111, 97,
+    100, 66, 97, 108, 97, 110, 99, 105, 110, 103, 66, 97, 115, 105, 99, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 66, 97, 115, 105, 99, 46, 32, 69, 110, 97, 98,
+    108, 101, 115, 32, 115, 109, 97, 108, 108, 32, 105, 110, 115, 116, 97, 110, 99, 101, 32, 111, 112, 116, 105, 109,
+    105, 122, 97, 116, 105, 111, 110, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 71, 102, 120, 57, 87, 100, 76, 111, 97, 100, 66, 97, 108, 97, 110, 99, 105, 110, 103, 65, 100, 118, 97, 110, 99,
+    101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 65, 100, 118, 97, 110, 99, 101, 100, 46, 32, 69, 110, 97, 98, 108, 101, 100, 32, 98, 97, 115, 105, 99, 32,
+    109, 111, 100, 101, 32, 112, 108, 117, 115, 32, 115, 109, 97, 108, 108, 32, 105, 110, 115, 116, 97, 110, 99, 101,
+    32, 117, 110, 114, 111, 108, 108, 105, 110, 103, 32, 100, 114, 97, 119, 115, 32, 111, 112, 116, 105, 109, 105, 122,
+    97, 116, 105, 111, 110, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 87, 100, 76,
+    111, 97, 100, 66, 97, 108, 97, 110, 99, 105, 110, 103, 77, 111, 100, 101, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 101, 116,
+    116, 105, 110, 103, 32, 102, 111, 114, 32, 99, 111, 110, 116, 114, 111, 108, 108, 105, 110, 103, 32, 119, 111, 114,
+    107, 32, 100, 105, 115, 116, 114, 105, 98, 117, 116, 111, 114, 32, 108, 111, 97, 100, 32, 98, 97, 108, 97, 110, 99,
+    105, 110, 103, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 53, 55, 56, 54, 52, 48, 55, 52, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 71, 102, 120, 57, 87, 100, 76, 111, 97, 100, 66, 97, 108, 97, 110, 99,
+    105, 110, 103, 65, 100, 118, 97, 110, 99, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75,
+    101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 100, 76, 111,
+    97, 100, 66, 97, 108, 97, 110, 99, 105, 110, 103, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 87, 100, 76, 111, 97, 100, 66, 97, 108, 97, 110, 99, 105, 110, 103, 77, 111, 100, 101, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 84, 114, 117, 101, 32, 102, 111, 114, 99, 101, 115, 32, 97, 32, 66, 65, 84, 67, 72, 95, 66, 82, 69, 65,
+    75, 32, 101, 118, 101, 110, 116, 32, 119, 104, 101, 110, 32, 97, 32, 110, 101, 119, 32, 112, 105, 120, 101, 108, 32,
+    115, 104, 97, 100, 101, 114, 32, 105, 115, 32, 98, 111, 117, 110, 100, 46, 32, 70, 97, 108, 115, 101, 32, 98, 121,
+    32, 100, 101, 102, 97, 117, 108, 116, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110,
+    101, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 51, 51, 54, 55, 52, 53, 56, 51, 48, 52, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 97, 116, 99, 104, 66, 114, 101, 97, 107,
+    79, 110, 78, 101, 119, 80, 105, 120, 101, 108, 83, 104, 97, 100, 101, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 66, 97, 116, 99, 104, 66, 114, 101, 97, 107, 79, 110, 78, 101, 119, 80, 105, 120,
+    101, 108, 83, 104, 97, 100, 101, 114, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 105, 115, 32, 109, 97,
+    115, 107, 32, 105, 115, 32, 65, 78, 68, 45, 101, 100, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 100, 114, 105,
+    118, 101, 114, 45, 100, 101, 99, 105, 100, 101, 100, 32, 71, 83, 45, 115, 112, 101, 99, 105, 102, 105, 99, 32, 67,
+    85, 95, 69, 78, 32, 109, 97, 115, 107, 32, 116, 111, 32, 102, 117, 114, 116, 104, 101, 114, 32, 97, 108, 108, 111,
+    119, 32, 108, 105, 109, 105, 116, 105, 110, 103, 32, 111, 102, 32, 101, 110, 97, 98, 108, 101, 100, 32, 67, 85, 115,
+    32, 102, 111, 114, 32, 71, 83, 32, 119, 97, 118, 101, 115, 46, 32, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105,
+    112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32,
+    32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 48, 50,
+    49, 49, 48, 51, 49, 55, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 52, 50, 57, 52, 57, 54,
+    55, 50, 57, 53, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 115, 67, 117, 69, 110, 76, 105, 109, 105,
+    116, 77, 97, 115, 107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 115, 67, 117,
+    69, 110, 76, 105, 109, 105, 116, 77, 97, 115, 107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115,
+    34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10,
+    32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 105, 115, 32, 109, 97, 115, 107, 32,
+    105, 115, 32, 65, 78, 68, 45, 101, 100, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114,
+    45, 100, 101, 99, 105, 100, 101, 100, 32, 86, 83, 45, 115, 112, 101, 99, 105, 102, 105, 99, 32, 67, 85, 95, 69, 78,
+    32, 109, 97, 115, 107, 32, 116, 111, 32, 102, 117, 114, 116, 104, 101, 114, 32, 97, 108, 108, 111, 119, 32, 108,
+    105, 109, 105, 116, 105, 110, 103, 32, 111, 102, 32, 101, 110, 97, 98, 108, 101, 100, 32, 67, 85, 115, 32, 102, 111,
+    114, 32, 86, 83, 32, 119, 97, 118, 101, 115, 46, 32, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34,
+    58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108,
+    105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32,
+    32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 57, 56, 57, 51, 49, 48,
+    48, 51, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 52, 50, 57, 52, 57, 54, 55, 50, 57, 53, 10,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 118, 115, 67, 117, 69, 110, 76, 105, 109, 105, 116, 77, 97, 115,
+    107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 86, 115, 67, 117, 69, 110, 76, 105,
+    109, 105, 116, 77, 97, 115, 107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32,
+    32, 125, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 105, 115, 32, 109, 97, 115, 107, 32, 105, 115, 32, 65,
+    78, 68, 45, 101, 100, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 45, 100, 101, 99,
+    105, 100, 101, 100, 32, 80, 83, 45, 115, 112, 101, 99, 105, 102, 105, 99, 32, 67, 85, 95, 69, 78, 32, 109, 97, 115,
+    107, 32, 116, 111, 32, 102, 117, 114, 116, 104, 101, 114, 32, 97, 108, 108, 111, 119, 32, 108, 105, 109, 105, 116,
+    105, 110, 103, 32, 111, 102, 32, 101, 110, 97, 98, 108, 101, 100, 32, 67, 85, 115, 32, 102, 111, 114, 32, 80, 83,
+    32, 119, 97, 118, 101, 115, 46, 32, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101,
+    115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 53, 48, 57, 56, 49, 49, 53, 57, 56,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 52, 50, 57, 52, 57, 54, 55, 50, 57, 53, 10, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97,
+    116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 115, 67, 117, 69, 110, 76, 105, 109, 105, 116, 77, 97, 115, 107, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 115, 67, 117, 69, 110, 76, 105, 109, 105, 116,
+    77, 97, 115, 107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 10,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 105, 115, 32, 109, 97, 115, 107, 32, 105, 115, 32, 65, 78, 68, 45, 101,
+    100, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 100, 114, 105, 118, 101, 114, 45, 100, 101, 99, 105, 100, 101,
+    100, 32, 67, 83, 45, 115, 112, 101, 99, 105, 102, 105, 99, 32, 67, 85, 95, 69, 78, 32, 109, 97, 115, 107, 32, 116,
+    111, 32, 102, 117, 114, 116, 104, 101, 114, 32, 97, 108, 108, 111, 119, 32, 108, 105, 109, 105, 116, 105, 110, 103,
+    32, 111, 102, 32, 101, 110, 97, 98, 108, 101, 100, 32, 67, 85, 115, 32, 102, 111, 114, 32, 67, 83, 32, 119, 97, 118,
+    101, 115, 46, 32, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 71, 114, 97, 112, 104, 105, 99, 115, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 51, 56, 50, 51, 51, 49, 51, 53, 49, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 52, 50, 57, 52, 57, 54, 55, 50, 57, 53, 10, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117,
+    105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 99, 115, 67, 117, 69, 110, 76, 105, 109, 105, 116, 77, 97, 115, 107, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 115, 67, 117, 69, 110, 76, 105, 109, 105, 116, 77, 97, 115, 107, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117,
+    101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    71, 102, 120, 57, 79, 102, 102, 67, 104, 105, 112, 72, 115, 73, 109, 109, 101, 100, 105, 97, 116, 101, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111,
+    112, 121, 32, 72, 83, 32, 111, 117, 116, 112, 117, 116, 115, 32, 100, 105, 114, 101, 99, 116, 108, 121, 32, 116,
+    111, 32, 111, 102, 102, 45, 99, 104, 105, 112, 32, 109, 101, 109, 111, 114, 121, 46, 34, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 79, 102, 102, 67, 104, 105, 112, 72, 115, 67,
+    111, 112, 121, 65, 108, 108, 65, 116, 69, 110, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 114, 105, 116, 101, 32, 72, 83, 32, 111, 117, 116, 112, 117,
+    116, 115, 32, 116, 111, 32, 76, 68, 83, 44, 32, 116, 104, 101, 110, 32, 97, 116, 32, 101, 110, 100, 32, 111, 102,
+    32, 72, 83, 32, 117, 115, 101, 32, 109, 117, 108, 116, 105, 45, 116, 104, 114, 101, 97, 100, 101, 100, 32, 108, 111,
+    111, 112, 32, 116, 111, 32, 99, 111, 112, 121, 32, 102, 114, 111, 109, 32, 76, 68, 83, 32, 116, 111, 32, 111, 102,
+    102, 45, 99, 104, 105, 112, 32, 109, 101, 109, 111, 114, 121, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 79, 102, 102, 67, 104, 105, 112, 72, 115, 67, 111, 112, 121, 77,
+    117, 108, 116, 105, 69, 108, 101, 109, 101, 110, 116, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 87, 114, 105, 116, 101, 115, 32, 111, 117, 116, 112,
+    117, 116, 32, 99, 111, 110, 116, 114, 111, 108, 32, 112, 111, 105, 110, 116, 115, 32, 97, 110, 100, 32, 112, 97,
+    116, 99, 104, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 32, 100, 105, 114, 101, 99, 116, 108, 121, 32, 116,
+    111, 32, 111, 102, 102, 45, 99, 104, 105, 112, 32, 97, 110, 100, 32, 111, 110, 108, 121, 32, 99, 111, 112, 121, 32,
+    116, 104, 101, 105, 110, 112, 117, 116, 32, 99, 111, 110, 116, 114, 111, 108, 32, 112, 111, 105, 110, 116, 32, 116,
+    111, 32, 109, 101, 109, 111, 114, 121, 32, 97, 116, 32, 116, 104, 101, 32, 101, 110, 100, 46, 34, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 79, 102, 102, 67, 104, 105, 112, 72, 115, 67, 111, 112, 121, 77,
+    101, 116, 104, 111, 100, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 112, 101, 99, 105, 102, 105, 101, 115, 32, 116, 111, 32, 83,
+    67, 32, 104, 111, 119, 32, 116, 111, 32, 99, 111, 112, 121, 32, 72, 83, 32, 111, 117, 116, 112, 117, 116, 115, 32,
+    116, 111, 32, 111, 102, 102, 45, 99, 104, 105, 112, 32, 109, 101, 109, 111, 114, 121, 46, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 104, 97, 100, 101,
+    114, 32, 79, 112, 116, 105, 111, 110, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10,
+    32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49,
+    56, 56, 50, 52, 57, 49, 55, 53, 51, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34,
+    58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 71, 102, 120,
+    57, 79, 102, 102, 67, 104, 105, 112, 72, 115, 67, 111, 112, 121, 65, 108, 108, 65, 116, 69, 110, 100, 34, 10, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105,
+    118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121,
+    112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108,
+    101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 102, 120, 57, 79, 102, 102, 67, 104, 105, 112, 72, 115, 67, 111, 112,
+    121, 77, 101, 116, 104, 111, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 102,
+    102, 67, 104, 105, 112, 72, 115, 67, 111, 112, 121, 77, 101, 116, 104, 111, 100, 34, 10, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 83, 67, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111,
+    110, 32, 116, 111, 32, 115, 107, 105, 112, 32, 99, 111, 112, 121, 105, 110, 103, 32, 100, 97, 116, 97, 32, 102, 114,
+    111, 109, 32, 72, 83, 32, 102, 111, 114, 32, 110, 117, 108, 108, 32, 112, 97, 116, 99, 104, 101, 115, 32, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 104,
+    97, 100, 101, 114, 32, 79, 112, 116, 105, 111, 110, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102,
+    120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101,
+    34, 58, 32, 49, 57, 53, 50, 49, 54, 55, 51, 56, 56, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116,
+    114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97,
+    114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 102, 120, 57, 79, 102, 102, 67, 104, 105, 112,
+    72, 115, 83, 107, 105, 112, 68, 97, 116, 97, 67, 111, 112, 121, 78, 117, 108, 108, 80, 97, 116, 99, 104, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 102, 102, 67, 104, 105, 112, 72, 115, 83, 107,
+    105, 112, 68, 97, 116, 97, 67, 111, 112, 121, 78, 117, 108, 108, 80, 97, 116, 99, 104, 34, 10, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 83, 67, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105,
+    111, 110, 32, 116, 111, 32, 112, 101, 114, 102, 111, 114, 109, 32, 116, 104, 101, 32, 111, 102, 102, 99, 104, 105,
+    112, 32, 100, 97, 116, 97, 32, 99, 111, 112, 121, 32, 102, 114, 111, 109, 32, 116, 104, 101, 32, 104, 117, 108, 108,
+    32, 115, 104, 97, 100, 101, 114, 32, 116, 111, 32, 116, 104, 101, 32, 100, 111, 109, 97, 105, 110, 32, 115, 104, 97,
+    100, 101, 114, 32, 117, 115, 105, 110, 103, 32, 109, 117, 108, 116, 105, 112, 108, 101, 32, 119, 97, 118, 101, 115,
+    46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 83, 104, 97, 100, 101, 114, 32, 79, 112, 116, 105, 111, 110, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 50, 51, 57, 54, 55, 52, 56, 49, 52, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 103, 102, 120, 57, 79, 102, 102,
+    67, 104, 105, 112, 72, 115, 77, 117, 108, 116, 105, 87, 97, 118, 101, 80, 97, 116, 99, 104, 68, 97, 116, 97, 67,
+    111, 112, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 102, 102, 67, 104, 105,
+    112, 72, 115, 77, 117, 108, 116, 105, 87, 97, 118, 101, 80, 97, 116, 99, 104, 68, 97, 116, 97, 67, 111, 112, 121,
+    34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 115, 32, 83, 67, 32, 111, 112, 116, 105,
+    109, 105, 122, 97, 116, 105, 111, 110, 32, 102, 111, 114, 32, 111, 112, 116, 105, 109, 105, 122, 101, 100, 32, 68,
+    83, 32, 100, 97, 116, 97, 32, 102, 101, 116, 99, 104, 46, 32, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 83, 104, 97, 100, 101, 114, 32, 79, 112, 116, 105, 111,
+    110, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 52, 48, 53, 51, 48, 56, 53, 54,
+    57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 103, 102, 120, 57, 79, 112, 116, 105, 109, 105, 122, 101, 68, 115, 68, 97, 116, 97, 70, 101, 116, 99,
+    104, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 79, 112, 116, 105, 109, 105, 122,
+    101, 68, 115, 68, 97, 116, 97, 70, 101, 116, 99, 104, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112,
+    101, 108, 105, 110, 101, 84, 121, 112, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101,
+    100, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105,
+    112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 100, 32, 102, 111,
+    114, 32, 97, 108, 108, 32, 86, 115, 80, 115, 32, 40, 86, 115, 80, 115, 41, 32, 112, 105, 112, 101, 108, 105, 110,
+    101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80,
+    105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115, 71, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 100, 32,
+    102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 71, 115, 80, 115, 32, 40, 71, 115, 41, 32, 112, 105, 112, 101, 108,
+    105, 110, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103,
+    80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115, 72, 115, 68, 115, 80, 115, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98,
+    108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 72, 115, 68, 115, 80, 115, 32, 40, 84, 101, 115,
+    115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115, 72, 115,
+    68, 115, 71, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 72,
+    115, 68, 115, 71, 115, 80, 115, 32, 40, 71, 115, 84, 101, 115, 115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101,
+    115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105,
+    112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 65, 108, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 53, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 100, 32, 102, 111,
+    114, 32, 97, 108, 108, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 116, 121, 112, 101, 115, 46, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84,
+    121, 112, 101, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 101, 116, 116, 105, 110, 103, 32, 102, 111, 114, 32, 116, 104, 101, 32,
+    101, 110, 97, 98, 108, 101, 109, 101, 110, 116, 32, 111, 102, 32, 78, 71, 71, 32, 111, 110, 32, 97, 32, 112, 101,
+    114, 45, 112, 105, 112, 101, 108, 105, 110, 101, 32, 116, 121, 112, 101, 32, 98, 97, 115, 105, 115, 46, 32, 70, 111,
+    114, 32, 113, 117, 97, 108, 105, 116, 121, 32, 112, 117, 114, 112, 111, 115, 101, 115, 32, 111, 110, 108, 121, 46,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 71, 71, 32, 67, 111, 110, 116, 114, 111, 108, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120,
+    57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101,
+    108, 105, 110, 101, 84, 121, 112, 101, 65, 108, 108, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 57, 55, 51, 57, 53, 53, 50, 57, 49, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102,
+    120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117,
+    109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    110, 103, 103, 69, 110, 97, 98, 108, 101, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 78, 103, 103, 69, 110, 97, 98, 108, 101, 77, 111, 100, 101, 34, 10, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69, 120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117,
+    101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    78, 103, 103, 83, 117, 98, 103, 114, 111, 117, 112, 77, 97, 120, 105, 109, 117, 109, 83, 105, 122, 101, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 83, 117, 98, 103, 114, 111, 117, 112, 72, 97,
+    108, 102, 83, 105, 122, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 83,
+    117, 98, 103, 114, 111, 117, 112, 79, 112, 116, 105, 109, 105, 122, 101, 70, 111, 114, 86, 101, 114, 116, 115, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 83, 117, 98, 103, 114, 111, 117, 112,
+    79, 112, 116, 105, 109, 105, 122, 101, 70, 111, 114, 80, 114, 105, 109, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 51, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 78, 103, 103, 83, 117, 98, 103, 114, 111, 117, 112, 69, 120, 112, 108, 105, 99, 105, 116,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 83, 117, 98, 103, 114, 111, 117, 112, 83, 105, 122, 101, 34, 10,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 100, 101, 102, 97, 117, 108, 116,
+    32, 78, 71, 71, 32, 115, 117, 98, 103, 114, 111, 117, 112, 32, 115, 105, 122, 101, 32, 104, 97, 110, 100, 108, 105,
+    110, 103, 46, 32, 79, 110, 108, 121, 32, 117, 115, 101, 102, 117, 108, 32, 105, 102, 32, 99, 108, 105, 101, 110,
+    116, 32, 99, 97, 108, 108, 115, 32, 80, 97, 108, 58, 58, 73, 68, 101, 118, 105, 99, 101, 58, 58, 83, 99, 112, 99,
+    71, 114, 97, 112, 104, 105, 99, 115, 80, 105, 112, 101, 108, 105, 110, 101, 84, 117, 110, 105, 110, 103, 79, 112,
+    116, 105, 111, 110, 115, 40, 41, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 71, 71, 32, 67, 111, 110, 116, 114, 111, 108, 115, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 48, 55, 56, 52, 57, 55, 50, 54, 55, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 34, 78, 103, 103, 83, 117, 98, 103, 114, 111, 117, 112, 79, 112, 116, 105, 109, 105,
+    122, 101, 70, 111, 114, 80, 114, 105, 109, 115, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101,
+    121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 110, 103, 103, 83,
+    117, 98, 103, 114, 111, 117, 112, 83, 105, 122, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 78, 103, 103, 83, 117, 98, 103, 114, 111, 117, 112, 83, 105, 122, 101, 34, 10, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 118, 97, 108, 117, 101, 32, 102, 111, 114,
+    32, 112, 114, 105, 109, 105, 116, 105, 118, 101, 115, 32, 112, 101, 114, 32, 115, 117, 98, 103, 114, 111, 117, 112,
+    32, 102, 111, 114, 32, 78, 71, 71, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 32, 79, 110, 108, 121, 32,
+    117, 115, 101, 100, 32, 105, 102, 32, 78, 103, 103, 83, 117, 98, 103, 114, 111, 117, 112, 83, 105, 122, 101, 32,
+    105, 115, 32, 115, 101, 116, 32, 116, 111, 32, 69, 120, 112, 108, 105, 99, 105, 116, 46, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 71, 71, 32, 67, 111, 110,
+    116, 114, 111, 108, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32,
+    32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 57, 53, 56, 52, 53,
+    56, 49, 51, 48, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 50, 53, 54, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 110, 103, 103, 80, 114, 105, 109, 115, 80, 101, 114, 83, 117, 98, 103, 114, 111, 117, 112, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 114, 105, 109, 115, 80, 101,
+    114, 83, 117, 98, 103, 114, 111, 117, 112, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111,
+    108, 115, 32, 116, 104, 101, 32, 118, 97, 108, 117, 101, 32, 102, 111, 114, 32, 118, 101, 114, 116, 105, 99, 101,
+    115, 32, 112, 101, 114, 32, 115, 117, 98, 103, 114, 111, 117, 112, 32, 102, 111, 114, 32, 78, 71, 71, 32, 112, 105,
+    112, 101, 108, 105, 110, 101, 115, 46, 32, 79, 110, 108, 121, 32, 117, 115, 101, 100, 32, 105, 102, 32, 78, 103,
+    103, 83, 117, 98, 103, 114, 111, 117, 112, 83, 105, 122, 101, 32, 105, 115, 32, 115, 101, 116, 32, 116, 111, 32, 69,
+    120, 112, 108, 105, 99, 105, 116, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 71, 71, 32, 67, 111, 110, 116, 114, 111, 108, 115, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 48, 48, 53, 57, 52, 52, 55, 57, 51, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 50, 53, 54, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 110, 103, 103, 86,
+    101, 114, 116, 115, 80, 101, 114, 83, 117, 98, 103, 114, 111, 117, 112, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 86, 101, 114, 116, 115, 80, 101, 114, 83, 117, 98, 103, 114, 111, 117,
+    112, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32,
+    118, 97, 108, 117, 101, 32, 102, 111, 114, 32, 108, 97, 116, 101, 45, 97, 108, 108, 111, 99, 32, 71, 83, 32, 102,
+    111, 114, 32, 78, 71, 71, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 32, 67, 97, 110, 32, 98, 101, 32,
+    110, 111, 32, 109, 111, 114, 101, 32, 116, 104, 97, 110, 32, 49, 50, 55, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 71, 71, 32, 67, 111, 110, 116, 114,
+    111, 108, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 50, 49, 55, 57, 49, 53, 49,
+    57, 52, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 50, 55, 10, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117,
+    105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 110, 103, 103, 76, 97, 116, 101, 65, 108, 108, 111, 99, 71, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 76, 97, 116, 101, 65, 108, 108, 111, 99, 71, 115, 34, 10, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108,
+    117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 68, 105, 115, 97,
+    98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58,
+    32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 100, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115, 80, 115,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 80, 115, 32, 40, 86, 115, 80, 115,
+    41, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115, 71, 115,
+    80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 71, 115, 80, 115, 32, 40,
+    71, 115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115,
+    72, 115, 68, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 72,
+    115, 68, 115, 80, 115, 32, 40, 84, 101, 115, 115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 34, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105,
+    110, 101, 84, 121, 112, 101, 86, 115, 72, 115, 68, 115, 71, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 100, 32,
+    102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 72, 115, 68, 115, 71, 115, 80, 115, 32, 40, 71, 115, 84, 101, 115,
+    115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 65, 108, 108, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 53, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34,
+    69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32,
+    116, 121, 112, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 78, 103,
+    103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 101, 116, 116, 105,
+    110, 103, 32, 102, 111, 114, 32, 116, 104, 101, 32, 101, 110, 97, 98, 108, 101, 109, 101, 110, 116, 32, 111, 102,
+    32, 98, 97, 99, 107, 102, 97, 99, 101, 32, 99, 117, 108, 108, 105, 110, 103, 32, 111, 110, 32, 97, 32, 112, 101,
+    114, 45, 112, 105, 112, 101, 108, 105, 110, 101, 32, 116, 121, 112, 101, 32, 98, 97, 115, 105, 115, 46, 32, 70, 111,
+    114, 32, 113, 117, 97, 108, 105, 116, 121, 32, 112, 117, 114, 112, 111, 115, 101, 115, 32, 111, 110, 108, 121, 46,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 71, 71, 32, 67, 111, 110, 116, 114, 111, 108, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120,
+    57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101,
+    108, 105, 110, 101, 84, 121, 112, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 54, 57, 49, 54, 55, 48, 55,
+    50, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 101, 110, 97, 98, 108, 101, 66, 97, 99, 107, 102, 97, 99, 101, 67, 117, 108, 108, 77, 97, 115, 107,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 66, 97, 99,
+    107, 102, 97, 99, 101, 67, 117, 108, 108, 77, 97, 115, 107, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80,
+    105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98,
+    108, 101, 100, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80,
+    105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 100, 32, 102,
+    111, 114, 32, 97, 108, 108, 32, 86, 115, 80, 115, 32, 40, 86, 115, 80, 115, 41, 32, 112, 105, 112, 101, 108, 105,
+    110, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80,
+    105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115, 71, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 100, 32,
+    102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 71, 115, 80, 115, 32, 40, 71, 115, 41, 32, 112, 105, 112, 101, 108,
+    105, 110, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103,
+    80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115, 72, 115, 68, 115, 80, 115, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 52, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98,
+    108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 72, 115, 68, 115, 80, 115, 32, 40, 84, 101, 115,
+    115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115, 72, 115,
+    68, 115, 71, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101,
+    34, 58, 32, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 72,
+    115, 68, 115, 71, 115, 80, 115, 32, 40, 71, 115, 84, 101, 115, 115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101,
+    115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105,
+    112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 65, 108, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 53, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 100, 32, 102, 111,
+    114, 32, 97, 108, 108, 32, 112, 105, 112, 101, 108, 105, 110, 101, 32, 116, 121, 112, 101, 115, 46, 34, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84,
+    121, 112, 101, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 101, 116, 116, 105, 110, 103, 32, 102, 111, 114, 32, 116, 104, 101, 32,
+    101, 110, 97, 98, 108, 101, 109, 101, 110, 116, 32, 111, 102, 32, 97, 99, 99, 117, 114, 97, 116, 101, 32, 102, 114,
+    117, 115, 116, 117, 109, 32, 99, 117, 108, 108, 105, 110, 103, 32, 111, 110, 32, 97, 32, 112, 101, 114, 45, 112,
+    105, 112, 101, 108, 105, 110, 101, 32, 116, 121, 112, 101, 32, 98, 97, 115, 105, 115, 46, 32, 70, 111, 114, 32, 113,
+    117, 97, 108, 105, 116, 121, 32, 112, 117, 114, 112, 111, 115, 101, 115, 32, 111, 110, 108, 121, 46, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 71, 71, 32,
+    67, 111, 110, 116, 114, 111, 108, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32,
+    32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 73, 115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110,
+    101, 84, 121, 112, 101, 68, 105, 115, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 51, 56, 56, 50, 55, 53, 56, 51, 48, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110,
+    117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 101, 110, 97, 98, 108, 101, 65, 99, 99, 117, 114, 97, 116, 101, 70, 114, 117, 115, 116, 117, 109, 67, 117, 108,
+    108, 77, 97, 115, 107, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98,
+    108, 101, 65, 99, 99, 117, 114, 97, 116, 101, 70, 114, 117, 115, 116, 117, 109, 67, 117, 108, 108, 77, 97, 115, 107,
+    34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86,
+    97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58,
+    32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 68, 105, 115,
+    97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34,
+    58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 100, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115,
+    80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 80, 115, 32, 40, 86, 115,
+    80, 115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115,
+    71, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    50, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 71, 115, 80, 115,
+    32, 40, 71, 115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101,
+    86, 115, 72, 115, 68, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 52, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32,
+    86, 115, 72, 115, 68, 115, 80, 115, 32, 40, 84, 101, 115, 115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115,
+    46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112,
+    101, 108, 105, 110, 101, 84, 121, 112, 101, 86, 115, 72, 115, 68, 115, 71, 115, 80, 115, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 56, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101,
+    100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 86, 115, 72, 115, 68, 115, 71, 115, 80, 115, 32, 40, 71, 115, 84, 101,
+    115, 115, 41, 32, 112, 105, 112, 101, 108, 105, 110, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 65, 108,
+    108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 53, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 69, 110, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 97, 108, 108, 32, 112, 105, 112, 101, 108, 105, 110,
+    101, 32, 116, 121, 112, 101, 115, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 78,
+    103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 83, 101, 116, 116, 105,
+    110, 103, 32, 102, 111, 114, 32, 116, 104, 101, 32, 101, 110, 97, 98, 108, 101, 109, 101, 110, 116, 32, 111, 102,
+    32, 115, 109, 97, 108, 108, 32, 112, 114, 105, 109, 105, 116, 105, 118, 101, 32, 102, 105, 108, 116, 101, 114, 32,
+    99, 117, 108, 108, 105, 110, 103, 32, 111, 110, 32, 97, 32, 112, 101, 114, 45, 112, 105, 112, 101, 108, 105, 110,
+    101, 32, 116, 121, 112, 101, 32, 98, 97, 115, 105, 115, 46, 32, 70, 111, 114, 32, 113, 117, 97, 108, 105, 116, 121,
+    32, 112, 117, 114, 112, 111, 115, 101, 115, 32, 111, 110, 108, 121, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 71, 71, 32, 67, 111, 110, 116, 114, 111,
+    108, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73,
+    115, 66, 105, 116, 109, 97, 115, 107, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 34, 78, 103, 103, 80, 105, 112, 101, 108, 105, 110, 101, 84, 121, 112, 101, 68, 105,
+    115, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 56, 49, 51, 57, 53, 48, 54, 55, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97, 98, 108, 101,
+    83, 109, 97, 108, 108, 80, 114, 105, 109, 70, 105, 108, 116, 101, 114, 77, 97, 115, 107, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 83, 109, 97, 108, 108, 80, 114, 105, 109,
+    70, 105, 108, 116, 101, 114, 77, 97, 115, 107, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117,
+    101, 44, 32, 101, 110, 97, 98, 108, 101, 115, 32, 102, 97, 115, 116, 101, 114, 32, 108, 97, 117, 110, 99, 104, 32,
+    114, 97, 116, 101, 32, 102, 111, 114, 32, 97, 108, 108, 32, 78, 71, 71, 32, 112, 105, 112, 101, 108, 105, 110, 101,
+    115, 46, 32, 70, 111, 114, 32, 113, 117, 97, 108, 105, 116, 121, 32, 116, 101, 115, 116, 105, 110, 103, 32, 112,
+    117, 114, 112, 111, 115, 101, 115, 32, 111, 110, 108, 121, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 71, 71, 32, 67, 111, 110, 116, 114, 111, 108, 115,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 49, 52, 56, 55, 55, 51, 48, 52, 56, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97,
+    108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98,
+    111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58,
+    32, 34, 110, 103, 103, 69, 110, 97, 98, 108, 101, 70, 97, 115, 116, 101, 114, 76, 97, 117, 110, 99, 104, 82, 97,
+    116, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 69, 110, 97, 98,
+    108, 101, 70, 97, 115, 116, 101, 114, 76, 97, 117, 110, 99, 104, 82, 97, 116, 101, 34, 10, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 101, 110, 97, 98, 108, 101, 115, 32, 86, 71, 84, 95, 83, 72,
+    65, 68, 69, 82, 95, 83, 84, 65, 71, 69, 83, 95, 69, 78, 58, 58, 79, 82, 68, 69, 82, 69, 68, 95, 73, 68, 95, 77, 79,
+    68, 69, 46, 32, 79, 110, 108, 121, 32, 97, 112, 112, 108, 105, 101, 115, 32, 116, 111, 32, 78, 71, 71, 32, 112, 105,
+    112, 108, 105, 110, 101, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 78, 71, 71, 32, 67, 111, 110, 116, 114, 111, 108, 115, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72,
+    97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 56, 56, 51, 49, 52, 52, 48, 49, 55, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 101, 110, 97, 98, 108,
+    101, 79, 114, 100, 101, 114, 101, 100, 73, 100, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 69, 110, 97, 98, 108, 101, 79, 114, 100, 101, 114, 101, 100, 73, 100, 77, 111, 100, 101,
+    34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114,
+    105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 104, 111, 119, 32, 109, 97,
+    110, 121, 32, 105, 110, 115, 116, 97, 110, 99, 101, 115, 32, 111, 102, 32, 116, 104, 101, 32, 78, 71, 71, 32, 115,
+    104, 97, 100, 101, 114, 45, 100, 97, 116, 97, 32, 116, 97, 98, 108, 101, 115, 32, 119, 105, 108, 108, 32, 98, 101,
+    32, 99, 111, 110, 116, 97, 105, 110, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 114, 105, 110, 103, 32, 98, 117,
+    102, 102, 101, 114, 32, 109, 97, 110, 97, 103, 101, 100, 32, 98, 121, 32, 85, 110, 105, 118, 101, 114, 115, 97, 108,
+    32, 67, 111, 109, 109, 97, 110, 100, 32, 66, 117, 102, 102, 101, 114, 115, 46, 32, 65, 116, 32, 109, 111, 115, 116,
+    44, 32, 116, 104, 101, 32, 99, 111, 110, 115, 116, 97, 110, 116, 32, 101, 110, 103, 105, 110, 101, 32, 119, 105,
+    108, 108, 32, 98, 101, 32, 97, 98, 108, 101, 32, 116, 111, 32, 103, 101, 116, 32, 116, 104, 97, 116, 32, 109, 97,
+    110, 121, 32, 100, 114, 97, 119, 115, 32, 97, 104, 101, 97, 100, 32, 111, 102, 32, 116, 104, 101, 32, 100, 114, 97,
+    119, 32, 101, 110, 103, 105, 110, 101, 46, 32, 84, 104, 105, 115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 101, 105,
+    116, 104, 101, 114, 32, 122, 101, 114, 111, 44, 32, 111, 114, 32, 100, 105, 118, 105, 115, 105, 98, 108, 101, 32,
+    98, 121, 32, 102, 111, 117, 114, 46, 32, 73, 102, 32, 122, 101, 114, 111, 44, 32, 97, 110, 121, 32, 112, 105, 112,
+    101, 108, 105, 110, 101, 32, 119, 104, 105, 99, 104, 32, 114, 101, 113, 117, 105, 114, 101, 115, 32, 78, 71, 71, 32,
+    119, 105, 108, 108, 32, 102, 97, 105, 108, 32, 116, 111, 32, 99, 111, 109, 112, 105, 108, 101, 32, 98, 101, 99, 97,
+    117, 115, 101, 32, 110, 111, 32, 83, 82, 68, 32, 116, 97, 98, 108, 101, 32, 105, 115, 32, 112, 114, 101, 115, 101,
+    110, 116, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 78, 71, 71, 32, 67, 111, 110, 116, 114, 111, 108, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 51, 56, 53, 56, 50, 51, 48, 56, 54, 52, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 51, 50, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58,
+    32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 110, 103, 103, 82, 105, 110, 103, 83, 105,
+    122, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 82, 105, 110, 103,
+    83, 105, 122, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 65, 100, 100, 105, 110, 103, 32, 99, 117, 108, 108,
+    105, 110, 103, 32, 116, 111, 32, 97, 110, 32, 78, 71, 71, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 32, 99,
+    97, 110, 32, 99, 97, 117, 115, 101, 32, 86, 77, 69, 77, 32, 105, 110, 115, 116, 114, 117, 99, 116, 105, 111, 110,
+    115, 32, 116, 111, 32, 98, 101, 32, 100, 117, 112, 108, 105, 99, 97, 116, 101, 100, 46, 32, 73, 102, 32, 116, 104,
+    101, 32, 114, 97, 116, 105, 111, 32, 111, 102, 32, 100, 117, 112, 108, 105, 99, 97, 116, 101, 100, 32, 86, 77, 69,
+    77, 115, 32, 101, 120, 99, 101, 101, 100, 115, 32, 116, 104, 105, 115, 32, 116, 104, 114, 101, 115, 104, 111, 108,
+    100, 44, 32, 116, 104, 101, 110, 32, 99, 117, 108, 108, 105, 110, 103, 32, 119, 105, 108, 108, 32, 98, 101, 32, 100,
+    105, 115, 97, 98, 108, 101, 100, 32, 102, 111, 114, 32, 116, 104, 105, 115, 32, 115, 104, 97, 100, 101, 114, 46, 32,
+    65, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 48, 32, 109, 101, 97, 110, 115, 32, 117, 115, 101, 32, 99, 111,
+    109, 112, 105, 108, 101, 114, 39, 115, 32, 100, 101, 102, 97, 117, 108, 116, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 71, 71, 32, 80, 105, 112, 101,
+    108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32,
+    32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 51, 50, 57, 53,
+    52, 49, 49, 54, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 46, 48, 10, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 102, 108, 111, 97, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 110, 103, 103, 68, 105, 115, 97, 98, 108, 101, 67, 117, 108, 108, 105, 110, 103, 86, 109, 101,
+    109, 73, 110, 115, 116, 114, 84, 104, 114, 101, 115, 104, 111, 108, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78,
+    97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 68, 105, 115, 97, 98, 108, 101, 67, 117, 108, 108, 105, 110, 103, 86,
+    109, 101, 109, 73, 110, 115, 116, 114, 84, 104, 114, 101, 115, 104, 111, 108, 100, 34, 10, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34,
+    58, 32, 34, 65, 100, 100, 105, 110, 103, 32, 99, 117, 108, 108, 105, 110, 103, 32, 116, 111, 32, 97, 110, 32, 78,
+    71, 71, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 32, 99, 97, 110, 32, 99, 97, 117, 115, 101, 32, 86, 65, 76,
+    85, 32, 105, 110, 115, 116, 114, 117, 99, 116, 105, 111, 110, 115, 32, 116, 111, 32, 98, 101, 32, 100, 117, 112,
+    108, 105, 99, 97, 116, 101, 100, 46, 32, 73, 102, 32, 116, 104, 101, 32, 114, 97, 116, 105, 111, 32, 111, 102, 32,
+    100, 117, 112, 108, 105, 99, 97, 116, 101, 100, 32, 86, 65, 76, 85, 115, 32, 101, 120, 99, 101, 101, 100, 115, 32,
+    116, 104, 105, 115, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 44, 32, 116, 104, 101, 110, 32, 99, 117, 108,
+    108, 105, 110, 103, 32, 119, 105, 108, 108, 32, 98, 101, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 102, 111,
+    114, 32, 116, 104, 105, 115, 32, 115, 104, 97, 100, 101, 114, 46, 32, 65, 32, 118, 97, 108, 117, 101, 32, 111, 102,
+    32, 48, 32, 109, 101, 97, 110, 115, 32, 117, 115, 101, 32, 99, 111, 109, 112, 105, 108, 101, 114, 39, 115, 32, 100,
+    101, 102, 97, 117, 108, 116, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 78, 71, 71, 32, 80, 105, 112, 101, 108, 105, 110, 101, 115, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 55, 52, 50, 54, 52, 54, 57, 56, 52, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 48, 46, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 102, 108, 111, 97, 116, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 110, 103, 103, 68, 105, 115,
+    97, 98, 108, 101, 67, 117, 108, 108, 105, 110, 103, 86, 97, 108, 117, 73, 110, 115, 116, 114, 84, 104, 114, 101,
+    115, 104, 111, 108, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 78, 103, 103, 68,
+    105, 115, 97, 98, 108, 101, 67, 117, 108, 108, 105, 110, 103, 86, 97, 108, 117, 73, 110, 115, 116, 114, 84, 104,
+    114, 101, 115, 104, 111, 108, 100, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 73, 115, 69,
+    120, 99, 108, 117, 115, 105, 118, 101, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 68, 101, 102, 101, 114, 114,
+    101, 100, 66, 97, 116, 99, 104, 66, 105, 110, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 68, 101, 102, 101, 114, 114, 101, 100, 66, 97, 116, 99, 104, 66,
+    105, 110, 67, 117, 115, 116, 111, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108,
+    117, 101, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120,
+    57, 68, 101, 102, 101, 114, 114, 101, 100, 66, 97, 116, 99, 104, 66, 105, 110, 65, 99, 99, 117, 114, 97, 116, 101,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 50, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 66, 105, 110, 110, 105, 110, 103, 77, 111, 100, 101, 34, 10,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 111, 114, 32,
+    110, 111, 116, 32, 100, 101, 102, 101, 114, 114, 101, 100, 32, 98, 97, 116, 99, 104, 32, 98, 105, 110, 110, 105,
+    110, 103, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 32, 48, 32, 58, 32, 66, 97, 116, 99, 104, 32, 98, 105,
+    110, 110, 105, 110, 103, 32, 97, 108, 119, 97, 121, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 49, 32, 58,
+    32, 85, 115, 101, 32, 99, 117, 115, 116, 111, 109, 32, 98, 105, 110, 32, 115, 105, 122, 101, 115, 32, 50, 32, 58,
+    32, 79, 112, 116, 105, 109, 97, 108, 32, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 49, 51, 48, 50, 49, 52, 56, 52, 52, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 34, 71, 102, 120, 57, 68, 101, 102, 101, 114, 114, 101, 100, 66, 97, 116, 99, 104,
+    66, 105, 110, 65, 99, 99, 117, 114, 97, 116, 101, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75,
+    101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 105, 110, 110,
+    105, 110, 103, 77, 111, 100, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 101,
+    102, 101, 114, 114, 101, 100, 66, 97, 116, 99, 104, 66, 105, 110, 77, 111, 100, 101, 34, 10, 32, 32, 32, 32, 125,
+    44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110,
+    34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 99, 117, 115, 116, 111, 109, 32, 98,
+    97, 116, 99, 104, 32, 98, 105, 110, 32, 115, 105, 122, 101, 46, 32, 32, 79, 110, 108, 121, 32, 117, 115, 101, 100,
+    32, 119, 104, 101, 110, 32, 100, 101, 102, 101, 114, 114, 101, 100, 66, 97, 116, 99, 104, 66, 105, 110, 77, 111,
+    100, 101, 61, 61, 49, 32, 72, 105, 103, 104, 32, 119, 111, 114, 100, 32, 105, 115, 32, 102, 111, 114, 32, 120, 44,
+    32, 108, 111, 119, 32, 119, 111, 114, 100, 32, 105, 115, 32, 102, 111, 114, 32, 121, 46, 32, 32, 68, 101, 102, 97,
+    117, 108, 116, 32, 105, 115, 32, 49, 50, 56, 120, 49, 50, 56, 46, 32, 32, 86, 97, 108, 117, 101, 115, 32, 109, 117,
+    115, 116, 32, 98, 101, 32, 112, 111, 119, 101, 114, 45, 111, 102, 45, 116, 119, 111, 32, 98, 101, 116, 119, 101,
+    101, 110, 32, 49, 54, 32, 97, 110, 100, 32, 53, 49, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 48, 55, 50, 49, 48, 48, 55, 56, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 56, 51, 56, 56, 55, 51, 54, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105,
+    110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 99, 117, 115, 116, 111, 109, 66, 97, 116, 99, 104, 66, 105, 110, 83, 105, 122, 101, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 117, 115, 116, 111, 109, 66, 97, 116, 99, 104, 66, 105,
+    110, 83, 105, 122, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 73, 115, 72, 101, 120, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125,
+    10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 98, 105, 110, 110, 105, 110, 103,
+    32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 80, 83, 32,
+    104, 97, 115, 32, 97, 32, 100, 105, 115, 99, 97, 114, 100, 32, 105, 110, 115, 116, 114, 117, 99, 116, 105, 111, 110,
+    32, 111, 114, 32, 99, 97, 110, 32, 98, 101, 32, 116, 114, 105, 118, 105, 97, 108, 108, 121, 32, 114, 101, 106, 101,
+    99, 116, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 49, 49, 57, 55, 49, 54, 53, 51, 57, 53, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 66,
+    105, 110, 110, 105, 110, 103, 80, 115, 75, 105, 108, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 68, 105, 115, 97, 98, 108, 101, 66, 105, 110, 110, 105, 110, 103, 80, 115, 75, 105, 108, 108, 34,
+    10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 98, 105, 110, 110, 105, 110, 103,
+    32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 105, 102, 32, 116, 104, 101, 114, 101, 32, 105, 115, 32,
+    110, 111, 32, 100, 101, 112, 116, 104, 32, 98, 117, 102, 102, 101, 114, 32, 98, 111, 117, 110, 100, 46, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 66, 66,
+    32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32,
+    32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 49,
+    51, 57, 56, 54, 53, 53, 55, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115,
+    101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80,
+    114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97,
+    98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 66, 105, 110, 110, 105, 110, 103,
+    78, 111, 68, 98, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98,
+    108, 101, 66, 105, 110, 110, 105, 110, 103, 78, 111, 68, 98, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102,
+    32, 116, 114, 117, 101, 44, 32, 98, 105, 110, 110, 105, 110, 103, 32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101,
+    100, 32, 105, 102, 32, 98, 108, 101, 110, 100, 105, 110, 103, 32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101,
+    100, 32, 111, 114, 32, 98, 108, 101, 110, 100, 105, 110, 103, 32, 100, 111, 101, 115, 32, 110, 111, 116, 32, 114,
+    101, 113, 117, 105, 114, 101, 32, 116, 104, 101, 32, 100, 101, 115, 116, 105, 110, 97, 116, 105, 111, 110, 32, 99,
+    111, 108, 111, 114, 32, 116, 111, 32, 98, 101, 32, 114, 101, 97, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70,
+    83, 77, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 53, 54, 56, 56, 51, 53, 55, 56,
+    52, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 66, 105, 110, 110, 105, 110, 103, 66, 108, 101, 110, 100, 105, 110,
+    103, 79, 102, 102, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98,
+    108, 101, 66, 105, 110, 110, 105, 110, 103, 66, 108, 101, 110, 100, 105, 110, 103, 79, 102, 102, 34, 10, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 97, 109, 111, 117, 110, 116, 32, 111, 102, 32, 112,
+    97, 114, 97, 109, 101, 116, 101, 114, 32, 115, 116, 111, 114, 97, 103, 101, 32, 112, 101, 114, 32, 98, 97, 116, 99,
+    104, 32, 119, 104, 101, 110, 32, 110, 111, 116, 32, 117, 115, 105, 110, 103, 32, 78, 71, 71, 46, 32, 85, 110, 105,
+    116, 115, 32, 97, 114, 101, 32, 112, 97, 114, 97, 109, 101, 116, 101, 114, 32, 99, 97, 99, 104, 101, 32, 108, 105,
+    110, 101, 115, 32, 100, 105, 118, 105, 100, 101, 100, 32, 98, 121, 32, 116, 119, 111, 46, 32, 84, 104, 101, 32, 109,
+    97, 120, 105, 109, 117, 109, 32, 105, 115, 32, 118, 97, 108, 117, 101, 32, 49, 50, 56, 46, 32, 90, 101, 114, 111,
+    32, 109, 101, 97, 110, 115, 32, 99, 97, 108, 99, 117, 108, 97, 116, 101, 32, 97, 110, 32, 111, 112, 116, 105, 109,
+    97, 108, 32, 118, 97, 108, 117, 101, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 116, 104, 101, 32, 104, 97, 114,
+    100, 119, 97, 114, 101, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 46, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 66, 66, 32, 97,
+    110, 100, 32, 68, 70, 83, 77, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32,
+    32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 54, 56, 49, 54,
+    57, 56, 56, 57, 51, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 98, 105, 110, 110, 105, 110, 103, 77, 97, 120, 65, 108, 108, 111, 99, 67, 111, 117, 110, 116,
+    76, 101, 103, 97, 99, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 105, 110,
+    110, 105, 110, 103, 77, 97, 120, 65, 108, 108, 111, 99, 67, 111, 117, 110, 116, 76, 101, 103, 97, 99, 121, 34, 10,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 97, 109, 111, 117, 110, 116, 32, 111, 102,
+    32, 112, 97, 114, 97, 109, 101, 116, 101, 114, 32, 115, 116, 111, 114, 97, 103, 101, 32, 112, 101, 114, 32, 98, 97,
+    116, 99, 104, 32, 119, 104, 101, 110, 32, 117, 115, 105, 110, 103, 32, 78, 71, 71, 32, 119, 105, 116, 104, 32, 116,
+    104, 101, 32, 111, 110, 45, 99, 104, 105, 112, 32, 112, 97, 114, 97, 109, 101, 116, 101, 114, 32, 99, 97, 99, 104,
+    101, 46, 32, 85, 110, 105, 116, 115, 32, 97, 114, 101, 32, 112, 97, 114, 97, 109, 101, 116, 101, 114, 32, 99, 97,
+    99, 104, 101, 32, 108, 105, 110, 101, 115, 32, 100, 105, 118, 105, 100, 101, 100, 32, 98, 121, 32, 116, 119, 111,
+    46, 32, 90, 101, 114, 111, 32, 109, 101, 97, 110, 115, 32, 99, 97, 108, 99, 117, 108, 97, 116, 101, 32, 97, 110, 32,
+    111, 112, 116, 105, 109, 97, 108, 32, 118, 97, 108, 117, 101, 32, 98, 97, 115, 101, 100, 32, 111, 110, 32, 116, 104,
+    101, 32, 104, 97, 114, 100, 119, 97, 114, 101, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110,
+    46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120,
+    57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 50, 53, 52, 51, 48, 48, 51, 53, 48, 57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 105, 110, 110, 105, 110, 103, 77, 97, 120, 65, 108, 108,
+    111, 99, 67, 111, 117, 110, 116, 78, 103, 103, 79, 110, 67, 104, 105, 112, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 66, 105, 110, 110, 105, 110, 103, 77, 97, 120, 65, 108, 108, 111, 99, 67, 111,
+    117, 110, 116, 78, 103, 103, 79, 110, 67, 104, 105, 112, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120,
+    105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 112, 114, 105, 109, 105, 116, 105, 118, 101,
+    115, 32, 112, 101, 114, 32, 98, 97, 116, 99, 104, 46, 32, 84, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32,
+    118, 97, 108, 117, 101, 32, 105, 115, 32, 49, 48, 50, 52, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103,
+    115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 51, 49, 55, 48, 55, 57, 55, 54, 55, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 48, 50, 52, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105,
+    110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 98, 105, 110, 110, 105, 110, 103, 77, 97, 120, 80, 114, 105, 109, 80, 101, 114, 66, 97, 116, 99, 104,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 105, 110, 110, 105, 110, 103, 77, 97,
+    120, 80, 114, 105, 109, 80, 101, 114, 66, 97, 116, 99, 104, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97,
+    120, 105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 99, 111, 110, 116, 101, 120, 116, 32,
+    114, 111, 108, 108, 115, 32, 98, 101, 102, 111, 114, 101, 32, 98, 114, 101, 97, 107, 105, 110, 103, 32, 97, 32, 98,
+    97, 116, 99, 104, 46, 32, 84, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 118, 97, 108, 117, 101, 32, 105,
+    115, 32, 54, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 49, 54, 54, 49, 54, 51, 57, 51, 51, 51, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 105, 110, 110, 105, 110, 103, 67, 111, 110,
+    116, 101, 120, 116, 83, 116, 97, 116, 101, 115, 80, 101, 114, 66, 105, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 66, 105, 110, 110, 105, 110, 103, 67, 111, 110, 116, 101, 120, 116, 83, 116, 97,
+    116, 101, 115, 80, 101, 114, 66, 105, 110, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117,
+    109, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 32, 115,
+    116, 97, 116, 101, 115, 32, 112, 101, 114, 32, 98, 97, 116, 99, 104, 46, 32, 84, 104, 101, 32, 109, 97, 120, 105,
+    109, 117, 109, 32, 118, 97, 108, 117, 101, 32, 105, 115, 32, 51, 49, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83,
+    77, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 53, 48, 55, 52, 56, 53, 52, 55, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51,
+    50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    98, 105, 110, 110, 105, 110, 103, 80, 101, 114, 115, 105, 115, 116, 101, 110, 116, 83, 116, 97, 116, 101, 115, 80,
+    101, 114, 66, 105, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 105, 110, 110,
+    105, 110, 103, 80, 101, 114, 115, 105, 115, 116, 101, 110, 116, 83, 116, 97, 116, 101, 115, 80, 101, 114, 66, 105,
+    110, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 77, 97, 120, 105, 109, 117, 109, 32, 110, 117, 109, 98, 101, 114,
+    32, 111, 102, 32, 70, 80, 79, 86, 32, 116, 111, 107, 101, 110, 115, 32, 97, 108, 108, 111, 119, 101, 100, 32, 112,
+    101, 114, 32, 98, 97, 116, 99, 104, 46, 32, 90, 101, 114, 111, 32, 109, 101, 97, 110, 115, 32, 110, 111, 32, 108,
+    105, 109, 105, 116, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 50, 48, 57, 51, 55, 49, 48, 51, 49, 55, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 54, 51, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 105, 110, 110, 105, 110, 103, 70,
+    112, 111, 118, 115, 80, 101, 114, 66, 97, 116, 99, 104, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101,
+    34, 58, 32, 34, 66, 105, 110, 110, 105, 110, 103, 70, 112, 111, 118, 115, 80, 101, 114, 66, 97, 116, 99, 104, 34,
+    10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105,
+    112, 116, 105, 111, 110, 34, 58, 32, 34, 86, 97, 108, 117, 101, 32, 102, 111, 114, 32, 116, 104, 101, 32, 80, 65,
+    95, 83, 67, 95, 66, 73, 78, 78, 69, 82, 95, 67, 78, 84, 76, 95, 49, 58, 58, 79, 80, 84, 73, 77, 65, 76, 95, 66, 73,
+    78, 95, 83, 69, 76, 69, 67, 84, 73, 79, 78, 32, 114, 101, 103, 105, 115, 116, 101, 114, 32, 102, 105, 101, 108, 100,
+    46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120,
+    57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 52, 53, 54, 51, 54, 48, 52, 50, 55, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 116, 114,
+    117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32,
+    34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114,
+    105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 98, 105, 110, 110, 105, 110, 103, 79, 112, 116, 105, 109,
+    97, 108, 66, 105, 110, 83, 101, 108, 101, 99, 116, 105, 111, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 66, 105, 110, 110, 105, 110, 103, 79, 112, 116, 105, 109, 97, 108, 66, 105, 110, 83, 101,
+    108, 101, 99, 116, 105, 111, 110, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44,
+    32, 100, 105, 115, 97, 98, 108, 101, 32, 66, 105, 110, 110, 105, 110, 103, 32, 119, 104, 101, 110, 32, 116, 104,
+    101, 32, 80, 83, 32, 117, 115, 101, 115, 32, 85, 65, 86, 32, 97, 112, 112, 101, 110, 100, 32, 111, 114, 32, 99, 111,
+    110, 115, 117, 109, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 51, 56, 48, 49, 56, 57, 51, 55, 53, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101, 66,
+    105, 110, 110, 105, 110, 103, 65, 112, 112, 101, 110, 100, 67, 111, 110, 115, 117, 109, 101, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 66, 105, 110, 110, 105, 110, 103, 68, 105, 115, 97, 98, 108, 101,
+    66, 105, 110, 110, 105, 110, 103, 65, 112, 112, 101, 110, 100, 67, 111, 110, 115, 117, 109, 101, 34, 10, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32, 68, 70, 83, 77, 32, 105, 115, 32, 100, 105, 115,
+    97, 98, 108, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 50, 57, 52, 51, 55, 55, 57, 52, 48, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108, 101,
+    68, 102, 115, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 68, 105, 115, 97, 98,
+    108, 101, 68, 102, 115, 109, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 114, 117, 101, 44, 32,
+    68, 70, 83, 77, 32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 32, 119, 104, 101, 110, 32, 116, 104, 101,
+    32, 112, 105, 120, 101, 108, 32, 115, 104, 97, 100, 101, 114, 32, 117, 115, 101, 115, 32, 85, 65, 86, 115, 32, 111,
+    114, 32, 82, 79, 86, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 80, 66, 66, 32, 97, 110, 100, 32, 68, 70, 83, 77, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 49, 53, 57, 50, 56, 52, 51, 52, 50, 48, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83,
+    99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 100, 105, 115, 97, 98, 108,
+    101, 68, 102, 115, 109, 80, 115, 85, 97, 118, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32,
+    34, 68, 105, 115, 97, 98, 108, 101, 68, 102, 115, 109, 80, 115, 85, 97, 118, 34, 10, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 83, 101, 108, 101, 99, 116, 32, 109, 101, 116, 104, 111, 100, 32, 111, 102, 32, 115, 104, 97, 100, 101, 114,
+    32, 112, 114, 101, 102, 101, 116, 99, 104, 105, 110, 103, 58, 32, 32, 48, 58, 32, 67, 80, 32, 68, 77, 65, 32, 40,
+    112, 114, 105, 109, 101, 115, 32, 85, 84, 67, 76, 50, 32, 97, 110, 100, 32, 84, 67, 67, 41, 32, 49, 58, 32, 80, 82,
+    73, 77, 69, 95, 85, 84, 67, 76, 50, 32, 40, 112, 114, 105, 109, 101, 115, 32, 116, 104, 101, 32, 85, 84, 67, 76, 50,
+    41, 32, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 80, 114, 101, 102, 101, 116, 99, 104, 105, 110, 103, 32, 40, 76, 50, 32, 67, 97, 99, 104, 101, 32, 87, 97,
+    114, 109, 105, 110, 103, 41, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115,
+    104, 78, 97, 109, 101, 34, 58, 32, 51, 48, 50, 56, 57, 57, 52, 56, 50, 50, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 34, 58, 32, 34, 80, 114, 101, 102, 101, 116, 99, 104, 67, 112, 68, 109, 97, 34, 10, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 114, 101,
+    102, 101, 116, 99, 104, 67, 112, 68, 109, 97, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86,
+    97, 108, 117, 101, 34, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 80, 32, 68, 77, 65, 32, 112, 114, 101, 102, 101, 116, 99,
+    104, 105, 110, 103, 46, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 114, 101,
+    102, 101, 116, 99, 104, 80, 114, 105, 109, 101, 85, 116, 99, 76, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 80, 82, 73, 77, 69, 95, 85, 84, 67, 76, 50, 32,
+    40, 112, 114, 105, 109, 101, 115, 32, 116, 104, 101, 32, 85, 84, 67, 76, 50, 41, 46, 34, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 80, 114, 101, 102, 101, 116, 99, 104, 77, 101, 116, 104, 111, 100, 34, 10, 32, 32, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116,
+    101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58,
+    32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109,
+    101, 34, 58, 32, 34, 115, 104, 97, 100, 101, 114, 80, 114, 101, 102, 101, 116, 99, 104, 77, 101, 116, 104, 111, 100,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 104, 97, 100, 101, 114, 80, 114, 101,
+    102, 101, 116, 99, 104, 77, 101, 116, 104, 111, 100, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 105, 100, 86, 97, 108, 117, 101, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 73, 115, 69, 110, 117, 109, 34, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 108, 117, 101, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 80, 114, 101, 102, 101,
+    116, 99, 104, 67, 111, 109, 109, 97, 110, 100, 115, 68, 105, 115, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 80, 114, 101, 102, 101, 116, 99, 104, 67, 111, 109, 109, 97,
+    110, 100, 115, 66, 117, 105, 108, 100, 73, 110, 102, 111, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 86, 97, 108, 117, 101, 34, 58, 32, 49, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 71, 102, 120, 57, 80, 114, 101, 102, 101, 116, 99, 104, 67, 111, 109, 109, 97, 110, 100, 115, 70, 111, 114,
+    99, 101, 65, 108, 108, 68, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117,
+    101, 34, 58, 32, 50, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57,
+    80, 114, 101, 102, 101, 116, 99, 104, 67, 111, 109, 109, 97, 110, 100, 115, 70, 111, 114, 99, 101, 65, 108, 108, 68,
+    101, 65, 99, 101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 86, 97, 108, 117, 101, 34, 58, 32,
+    51, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 71, 102, 120, 57, 80, 114, 101, 102, 101, 116, 99, 104, 67,
+    111, 109, 109, 97, 110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104,
+    101, 116, 104, 101, 114, 32, 67, 80, 32, 99, 111, 109, 109, 97, 110, 100, 32, 98, 117, 102, 102, 101, 114, 115, 32,
+    97, 114, 101, 32, 112, 114, 101, 102, 101, 116, 99, 104, 101, 100, 32, 105, 110, 116, 111, 32, 116, 104, 101, 32,
+    71, 102, 120, 32, 76, 50, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 34, 80, 114, 101, 102, 101, 116, 99, 104, 105, 110, 103, 32, 40, 76, 50, 32, 67, 97, 99,
+    104, 101, 32, 87, 97, 114, 109, 105, 110, 103, 41, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57,
+    34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 51, 56, 54, 55, 53, 55, 52, 51, 50, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 34, 71,
+    102, 120, 57, 80, 114, 101, 102, 101, 116, 99, 104, 67, 111, 109, 109, 97, 110, 100, 115, 66, 117, 105, 108, 100,
+    73, 110, 102, 111, 34, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101,
+    34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 101, 110, 117, 109, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 112, 114, 101, 102, 101, 116, 99, 104, 67,
+    111, 109, 109, 97, 110, 100, 66, 117, 102, 102, 101, 114, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 80, 114, 101, 102, 101, 116, 99, 104, 67, 111, 109, 109, 97, 110, 100, 66, 117, 102, 102, 101,
+    114, 115, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 101,
+    116, 104, 101, 114, 32, 97, 110, 105, 115, 111, 116, 114, 111, 112, 105, 99, 32, 102, 105, 108, 116, 101, 114, 105,
+    110, 103, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 32, 97, 114, 101, 32, 101, 110, 97,
+    98, 108, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 84, 101, 120, 116, 117, 114, 101, 32, 70, 105, 108, 116, 101, 114, 105, 110, 103, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 57, 53, 56, 52, 55, 48, 50, 50, 55, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102,
+    120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 97,
+    110, 105, 115, 111, 70, 105, 108, 116, 101, 114, 79, 112, 116, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 65, 110, 105, 115, 111, 70, 105, 108, 116, 101, 114, 79, 112,
+    116, 69, 110, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108,
+    115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 116, 104, 101, 32, 114, 111, 117, 110, 100, 45, 117, 112, 32, 108,
+    111, 103, 105, 99, 32, 102, 111, 114, 32, 115, 97, 109, 112, 108, 101, 114, 115, 32, 105, 115, 32, 101, 110, 97, 98,
+    108, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 34, 84, 101, 120, 116, 117, 114, 101, 32, 70, 105, 108, 116, 101, 114, 105, 110, 103, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 57, 56, 54, 57, 57, 50, 56, 57, 57, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102,
+    120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115,
+    97, 109, 112, 108, 101, 114, 67, 101, 105, 108, 105, 110, 103, 76, 111, 103, 105, 99, 69, 110, 97, 98, 108, 101,
+    100, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 67, 101, 105, 108, 105, 110, 103, 76,
+    111, 103, 105, 99, 69, 110, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114,
+    111, 108, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 114, 111, 117, 110, 100, 105, 110, 103, 32, 111, 102, 32,
+    118, 97, 108, 117, 101, 115, 32, 99, 111, 109, 105, 110, 103, 32, 111, 117, 116, 32, 111, 102, 32, 116, 104, 101,
+    32, 110, 111, 114, 109, 97, 108, 105, 122, 101, 114, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 46, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 101,
+    120, 116, 117, 114, 101, 32, 70, 105, 108, 116, 101, 114, 105, 110, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 50, 56, 54, 56, 52, 55, 55, 55, 53, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 97, 109, 112, 108, 101, 114, 80, 114,
+    101, 99, 105, 115, 105, 111, 110, 70, 105, 120, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 78, 97, 109, 101, 34, 58, 32, 34, 80, 114, 101, 99, 105, 115, 105, 111, 110, 70, 105, 120, 69, 110, 97, 98, 108,
+    101, 100, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115,
+    99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32,
+    118, 97, 108, 117, 101, 32, 111, 102, 32, 116, 104, 101, 32, 80, 69, 82, 70, 95, 77, 73, 80, 32, 102, 105, 101, 108,
+    100, 32, 105, 110, 32, 83, 97, 109, 112, 108, 101, 114, 32, 83, 82, 68, 39, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 84, 101, 120, 116, 117, 114, 101,
+    32, 70, 105, 108, 116, 101, 114, 105, 110, 103, 34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57,
+    34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58,
+    32, 51, 54, 57, 54, 57, 48, 51, 53, 49, 48, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10,
+    32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114,
+    105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105,
+    97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 97, 109, 112, 108, 101, 114, 80, 101, 114, 102, 77, 105,
+    112, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 97, 109, 112, 108, 101, 114, 80,
+    101, 114, 102, 77, 105, 112, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32,
+    116, 104, 101, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 116, 104, 101, 32, 97, 110, 105, 115, 111, 116, 114,
+    111, 112, 121, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 32, 102, 111, 114, 32, 83, 97, 109, 112, 108, 101,
+    114, 32, 83, 82, 68, 39, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 84, 101, 120, 116, 117, 114, 101, 32, 70, 105, 108, 116, 101, 114, 105, 110, 103,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 53, 50, 49, 50, 56, 51, 49, 48, 56, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51,
+    50, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    115, 97, 109, 112, 108, 101, 114, 65, 110, 105, 115, 111, 84, 104, 114, 101, 115, 104, 111, 108, 100, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 83, 97, 109, 112, 108, 101, 114, 65, 110, 105, 115,
+    111, 84, 104, 114, 101, 115, 104, 111, 108, 100, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114,
+    111, 108, 115, 32, 116, 104, 101, 32, 118, 97, 108, 117, 101, 32, 111, 102, 32, 116, 104, 101, 32, 97, 110, 105,
+    115, 111, 116, 114, 111, 112, 121, 32, 98, 105, 97, 115, 32, 102, 111, 114, 32, 83, 97, 109, 112, 108, 101, 114, 32,
+    83, 82, 68, 39, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 84, 101, 120, 116, 117, 114, 101, 32, 70, 105, 108, 116, 101, 114, 105, 110, 103, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 52, 48, 56, 53, 56, 49, 50, 48, 57, 54, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75,
+    101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 97,
+    109, 112, 108, 101, 114, 65, 110, 105, 115, 111, 66, 105, 97, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 83, 97, 109, 112, 108, 101, 114, 65, 110, 105, 115, 111, 66, 105, 97, 115, 34, 10, 32, 32,
+    32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105,
+    111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 116, 104, 101, 32, 118, 97, 108, 117, 101, 32,
+    111, 102, 32, 116, 104, 101, 32, 115, 101, 99, 111, 110, 100, 97, 114, 121, 32, 97, 110, 105, 115, 111, 116, 114,
+    111, 112, 121, 32, 98, 105, 97, 115, 32, 102, 111, 114, 32, 83, 97, 109, 112, 108, 101, 114, 32, 83, 82, 68, 39,
+    115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 84, 101, 120, 116, 117, 114, 101, 32, 70, 105, 108, 116, 101, 114, 105, 110, 103, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 71, 102, 120, 57, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 54, 53, 52, 57, 54, 53, 50, 48, 49, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 48, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111,
+    112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 117, 105, 110, 116, 51, 50, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 115, 97, 109, 112, 108, 101,
+    114, 83, 101, 99, 65, 110, 105, 115, 111, 66, 105, 97, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109,
+    101, 34, 58, 32, 34, 83, 97, 109, 112, 108, 101, 114, 83, 101, 99, 65, 110, 105, 115, 111, 66, 105, 97, 115, 34, 10,
+    32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112,
+    116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 104, 101, 32, 119, 111, 114, 107, 97, 114, 111, 117, 110, 100,
+    32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 44, 32, 116, 104, 101, 110, 32, 111, 110, 108, 121, 32, 116, 104,
+    111, 115, 101, 32, 109, 105, 112, 115, 32, 117, 112, 32, 116, 111, 32, 97, 110, 100, 32, 105, 110, 99, 108, 117,
+    100, 105, 110, 103, 32, 116, 104, 101, 32, 102, 105, 114, 115, 116, 32, 109, 105, 112, 32, 105, 110, 32, 116, 104,
+    101, 32, 109, 105, 112, 32, 116, 97, 105, 108, 32, 119, 105, 108, 108, 32, 98, 101, 32, 99, 111, 109, 112, 114, 101,
+    115, 115, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100,
+    115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34,
+    58, 32, 53, 57, 57, 49, 50, 48, 57, 50, 56, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116,
+    115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97,
+    108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34,
+    58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112,
+    101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 82, 101, 115, 116, 114, 105, 99,
+    116, 77, 101, 116, 97, 68, 97, 116, 97, 85, 115, 101, 73, 110, 77, 105, 112, 84, 97, 105, 108, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 82, 101, 115, 116, 114, 105, 99, 116, 77, 101, 116,
+    97, 68, 97, 116, 97, 85, 115, 101, 73, 110, 77, 105, 112, 84, 97, 105, 108, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32,
+    34, 73, 102, 32, 116, 104, 101, 32, 119, 111, 114, 107, 97, 114, 111, 117, 110, 100, 32, 105, 115, 32, 101, 110, 97,
+    98, 108, 101, 100, 44, 32, 116, 104, 101, 110, 32, 110, 111, 110, 45, 99, 111, 112, 121, 32, 82, 79, 80, 51, 32,
+    119, 105, 108, 108, 32, 100, 105, 115, 97, 98, 108, 101, 32, 116, 104, 101, 32, 68, 67, 67, 32, 111, 118, 101, 114,
+    119, 114, 105, 116, 101, 32, 99, 111, 109, 98, 105, 110, 101, 114, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84,
+    97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87,
+    111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 53, 54, 54, 50, 48, 51, 52, 54, 57, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 114, 101, 97,
+    100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71,
+    102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111,
+    108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34,
+    119, 97, 76, 111, 103, 105, 99, 79, 112, 68, 105, 115, 97, 98, 108, 101, 115, 79, 118, 101, 114, 119, 114, 105, 116,
+    101, 67, 111, 109, 98, 105, 110, 101, 114, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34,
+    87, 97, 76, 111, 103, 105, 99, 79, 112, 68, 105, 115, 97, 98, 108, 101, 115, 79, 118, 101, 114, 119, 114, 105, 116,
+    101, 67, 111, 109, 98, 105, 110, 101, 114, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 116, 104, 101, 32,
+    119, 111, 114, 107, 97, 114, 111, 117, 110, 100, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 44, 32, 116,
+    104, 101, 110, 32, 114, 111, 116, 97, 116, 101, 100, 32, 115, 119, 105, 122, 122, 108, 101, 32, 109, 111, 100, 101,
+    115, 32, 119, 105, 108, 108, 32, 100, 105, 115, 97, 98, 108, 101, 32, 116, 104, 101, 32, 68, 67, 67, 32, 111, 118,
+    101, 114, 119, 114, 105, 116, 101, 32, 99, 111, 109, 98, 105, 110, 101, 114, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114, 101,
+    32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 54, 51, 52, 57, 56, 53, 54, 51, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68,
+    101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 114,
+    101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108,
+    71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111,
+    111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32,
+    34, 119, 97, 82, 111, 116, 97, 116, 101, 100, 83, 119, 105, 122, 122, 108, 101, 68, 105, 115, 97, 98, 108, 101, 115,
+    79, 118, 101, 114, 119, 114, 105, 116, 101, 67, 111, 109, 98, 105, 110, 101, 114, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 82, 111, 116, 97, 116, 101, 100, 83, 119, 105, 122, 122, 108, 101,
+    68, 105, 115, 97, 98, 108, 101, 115, 79, 118, 101, 114, 119, 114, 105, 116, 101, 67, 111, 109, 98, 105, 110, 101,
+    114, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99,
+    114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 119, 104, 101, 116,
+    104, 101, 114, 32, 116, 104, 101, 32, 119, 111, 114, 107, 97, 114, 111, 117, 110, 100, 32, 119, 97, 87, 114, 105,
+    116, 101, 49, 120, 65, 65, 83, 97, 109, 112, 108, 101, 76, 111, 99, 97, 116, 105, 111, 110, 115, 84, 111, 90, 101,
+    114, 111, 32, 105, 115, 32, 97, 99, 116, 105, 118, 101, 46, 32, 70, 65, 76, 83, 69, 58, 32, 32, 32, 70, 111, 114,
+    99, 101, 115, 32, 116, 104, 101, 32, 119, 111, 114, 107, 97, 114, 111, 117, 110, 100, 32, 111, 102, 102, 46, 32, 84,
+    82, 85, 69, 58, 32, 32, 32, 32, 70, 111, 114, 99, 101, 115, 32, 116, 104, 101, 32, 119, 111, 114, 107, 97, 114, 111,
+    117, 110, 100, 32, 111, 110, 46, 32, 78, 111, 116, 32, 83, 101, 116, 58, 32, 65, 108, 108, 111, 119, 115, 32, 116,
+    104, 101, 32, 100, 114, 105, 118, 101, 114, 32, 116, 111, 32, 100, 101, 99, 105, 100, 101, 44, 32, 98, 97, 115, 101,
+    100, 32, 111, 110, 32, 67, 104, 105, 112, 32, 73, 68, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107,
+    97, 114, 111, 117, 110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 50, 48, 52, 50, 51, 56, 48, 55, 50, 48, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 114, 101, 97, 100, 83,
+    101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97,
+    87, 114, 105, 116, 101, 49, 120, 65, 65, 83, 97, 109, 112, 108, 101, 76, 111, 99, 97, 116, 105, 111, 110, 115, 84,
+    111, 90, 101, 114, 111, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 87, 114,
+    105, 116, 101, 49, 120, 65, 65, 83, 97, 109, 112, 108, 101, 76, 111, 99, 97, 116, 105, 111, 110, 115, 84, 111, 90,
+    101, 114, 111, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84, 104, 101, 32, 111, 118, 101, 114, 119, 114, 105,
+    116, 101, 32, 99, 111, 109, 98, 105, 110, 101, 114, 32, 109, 97, 114, 107, 115, 32, 115, 111, 109, 101, 116, 104,
+    105, 110, 103, 32, 97, 115, 32, 111, 118, 101, 114, 119, 114, 105, 116, 116, 101, 110, 32, 101, 118, 101, 110, 32,
+    105, 102, 32, 116, 104, 101, 114, 101, 32, 97, 114, 101, 32, 101, 110, 115, 117, 105, 110, 103, 113, 117, 97, 100,
+    115, 32, 116, 111, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 115, 101, 99, 116, 111, 114, 32, 116, 104, 97, 116,
+    32, 110, 101, 101, 100, 32, 100, 101, 115, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58,
+    32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114,
+    111, 117, 110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 50, 51, 51, 48, 51, 54, 56, 52, 52, 52, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70,
+    108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 114, 101, 97, 100, 83, 101,
+    116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57,
+    75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 67,
+    111, 108, 111, 114, 67, 97, 99, 104, 101, 67, 111, 110, 116, 114, 111, 108, 108, 101, 114, 73, 110, 118, 97, 108,
+    105, 100, 69, 118, 105, 99, 116, 105, 111, 110, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58,
+    32, 34, 87, 97, 67, 111, 108, 111, 114, 67, 97, 99, 104, 101, 67, 111, 110, 116, 114, 111, 108, 108, 101, 114, 73,
+    110, 118, 97, 108, 105, 100, 69, 118, 105, 99, 116, 105, 111, 110, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 84,
+    104, 101, 32, 111, 118, 101, 114, 119, 114, 105, 116, 101, 32, 99, 111, 109, 98, 105, 110, 101, 114, 32, 116, 97,
+    107, 101, 115, 32, 111, 110, 108, 121, 32, 116, 104, 101, 32, 116, 97, 114, 103, 101, 116, 32, 109, 97, 115, 107,
+    32, 105, 110, 116, 111, 32, 99, 111, 110, 115, 105, 100, 101, 114, 97, 116, 105, 111, 110, 32, 119, 104, 105, 108,
+    101, 32, 100, 101, 99, 105, 100, 105, 110, 103, 116, 111, 32, 111, 118, 101, 114, 119, 114, 105, 116, 101, 32, 99,
+    111, 109, 98, 105, 110, 101, 32, 119, 104, 101, 114, 101, 97, 115, 32, 116, 104, 101, 32, 111, 116, 104, 101, 114,
+    32, 112, 97, 114, 116, 115, 32, 111, 102, 32, 116, 104, 101, 32, 67, 66, 32, 100, 101, 99, 105, 100, 101, 32, 111,
+    110, 32, 115, 104, 97, 100, 101, 114, 32, 109, 97, 115, 107, 32, 97, 110, 100, 116, 97, 114, 103, 101, 116, 32, 109,
+    97, 115, 107, 46, 32, 84, 104, 105, 115, 32, 100, 105, 115, 99, 114, 101, 112, 97, 110, 99, 121, 32, 109, 97, 121,
+    32, 108, 101, 97, 100, 32, 116, 111, 32, 116, 104, 101, 32, 111, 118, 101, 114, 119, 114, 105, 116, 101, 32, 99,
+    111, 109, 98, 105, 110, 101, 114, 32, 105, 110, 99, 111, 114, 114, 101, 99, 116, 108, 121, 32, 115, 105, 103, 110,
+    97, 108, 105, 110, 103, 97, 32, 114, 101, 97, 100, 32, 111, 112, 116, 105, 109, 105, 122, 97, 116, 105, 111, 110,
+    32, 119, 104, 101, 110, 32, 115, 104, 97, 100, 101, 114, 32, 97, 110, 100, 32, 116, 97, 114, 103, 101, 116, 32, 109,
+    97, 115, 107, 32, 97, 114, 101, 32, 100, 105, 102, 102, 101, 114, 101, 110, 116, 34, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114, 101,
+    32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 54, 55, 48, 55, 51, 50, 48, 52, 52, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101,
+    114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 119, 97, 79, 118, 101, 114, 119, 114, 105, 116, 101, 67, 111, 109, 98, 105, 110, 101, 114, 84, 97, 114,
+    103, 101, 116, 77, 97, 115, 107, 79, 110, 108, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 87, 97, 79, 118, 101, 114, 119, 114, 105, 116, 101, 67, 111, 109, 98, 105, 110, 101, 114, 84, 97, 114,
+    103, 101, 116, 77, 97, 115, 107, 79, 110, 108, 121, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116,
+    114, 111, 108, 115, 32, 105, 102, 32, 104, 84, 105, 108, 101, 32, 112, 114, 101, 102, 101, 116, 99, 104, 32, 105,
+    115, 32, 100, 105, 115, 98, 108, 101, 100, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32,
+    91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114,
+    111, 117, 110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104,
+    78, 97, 109, 101, 34, 58, 32, 52, 48, 49, 49, 50, 48, 57, 53, 50, 50, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101,
+    102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108,
+    116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70,
+    108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 114, 101, 97, 100, 83, 101,
+    116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57,
+    75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 68,
+    105, 115, 97, 98, 108, 101, 72, 116, 105, 108, 101, 80, 114, 101, 102, 101, 116, 99, 104, 34, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 68, 105, 115, 97, 98, 108, 101, 72, 116, 105, 108, 101,
+    80, 114, 101, 102, 101, 116, 99, 104, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108,
+    115, 32, 105, 102, 32, 83, 84, 65, 76, 76, 69, 68, 95, 80, 79, 80, 83, 32, 105, 115, 32, 117, 115, 101, 100, 32,
+    111, 114, 32, 110, 111, 116, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110,
+    100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109,
+    101, 34, 58, 32, 50, 49, 55, 48, 55, 49, 51, 54, 49, 49, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117,
+    108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32,
+    102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115,
+    34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110,
+    103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99,
+    111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32,
+    32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 77, 105, 115, 99, 80,
+    111, 112, 115, 77, 105, 115, 115, 101, 100, 79, 118, 101, 114, 108, 97, 112, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 77, 105, 115, 99, 80, 111, 112, 115, 77, 105, 115, 115, 101, 100, 79, 118,
+    101, 114, 108, 97, 112, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 105,
+    102, 32, 119, 104, 101, 110, 101, 118, 101, 114, 32, 97, 32, 99, 111, 110, 116, 101, 120, 116, 32, 114, 111, 108,
+    108, 32, 105, 115, 32, 100, 101, 116, 101, 99, 116, 101, 100, 32, 119, 104, 101, 116, 104, 101, 114, 32, 116, 104,
+    101, 32, 115, 99, 105, 115, 115, 111, 114, 32, 114, 101, 103, 105, 115, 116, 101, 114, 115, 32, 119, 105, 108, 108,
+    32, 98, 101, 32, 114, 101, 119, 114, 105, 116, 116, 101, 110, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111,
+    114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 53, 56, 48, 56, 55, 54, 51, 52, 52, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 114, 101, 97, 100,
+    83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102,
+    120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119,
+    97, 77, 105, 115, 99, 83, 99, 105, 115, 115, 111, 114, 82, 101, 103, 105, 115, 116, 101, 114, 67, 104, 97, 110, 103,
+    101, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 77, 105, 115, 99, 83, 99,
+    105, 115, 115, 111, 114, 82, 101, 103, 105, 115, 116, 101, 114, 67, 104, 97, 110, 103, 101, 34, 10, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 67, 111, 110, 116, 114, 111, 108, 115, 32, 105, 102, 32, 97, 32, 80, 83, 95, 80, 65, 82, 84,
+    73, 65, 76, 95, 70, 76, 85, 83, 72, 32, 105, 115, 32, 117, 115, 101, 100, 32, 119, 104, 101, 110, 101, 118, 101,
+    114, 32, 116, 104, 101, 32, 115, 99, 105, 115, 115, 111, 114, 32, 116, 111, 112, 45, 108, 101, 102, 116, 32, 111,
+    114, 32, 98, 111, 116, 116, 111, 109, 45, 114, 105, 103, 104, 116, 32, 114, 101, 103, 105, 115, 116, 101, 114, 115,
+    32, 99, 104, 97, 110, 103, 101, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117,
+    110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 50, 54, 49, 49, 50, 54, 56, 53, 54, 52, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97,
+    103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116,
+    105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 77, 105, 115, 99,
+    80, 115, 70, 108, 117, 115, 104, 83, 99, 105, 115, 115, 111, 114, 67, 104, 97, 110, 103, 101, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 77, 105, 115, 99, 80, 115, 70, 108, 117, 115, 104, 83,
+    99, 105, 115, 115, 111, 114, 67, 104, 97, 110, 103, 101, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32,
+    115, 101, 116, 44, 32, 104, 84, 105, 108, 101, 32, 98, 117, 102, 102, 101, 114, 115, 32, 115, 117, 112, 112, 111,
+    114, 116, 32, 110, 111, 110, 45, 122, 101, 114, 111, 32, 112, 105, 112, 101, 45, 98, 97, 110, 107, 32, 120, 111,
+    114, 32, 118, 97, 108, 117, 101, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111,
+    117, 110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78,
+    97, 109, 101, 34, 58, 32, 50, 54, 52, 51, 49, 50, 55, 54, 48, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97,
+    103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116,
+    105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 72, 116, 105,
+    108, 101, 80, 105, 112, 101, 66, 97, 110, 107, 88, 111, 114, 77, 117, 115, 116, 66, 101, 90, 101, 114, 111, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 72, 116, 105, 108, 101, 80, 105, 112, 101,
+    66, 97, 110, 107, 88, 111, 114, 77, 117, 115, 116, 66, 101, 90, 101, 114, 111, 34, 10, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 73, 102, 32, 115, 101, 116, 44, 32, 68, 70, 83, 77, 32, 119, 105, 108, 108, 32, 98, 101, 32, 100, 105, 115,
+    97, 98, 108, 101, 100, 32, 119, 104, 101, 110, 32, 69, 81, 65, 65, 32, 115, 117, 114, 102, 97, 99, 101, 115, 32, 97,
+    114, 101, 32, 98, 111, 117, 110, 100, 32, 116, 111, 32, 116, 104, 101, 32, 68, 66, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114,
+    101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 52, 51, 53, 55, 53, 49, 50, 49, 51, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82,
+    101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32,
+    32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101,
+    80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32,
+    34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101,
+    34, 58, 32, 34, 119, 97, 68, 105, 115, 97, 98, 108, 101, 68, 102, 115, 109, 87, 105, 116, 104, 69, 113, 97, 97, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 68, 105, 115, 97, 98, 108, 101, 68,
+    102, 115, 109, 87, 105, 116, 104, 69, 113, 97, 97, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32, 115, 101,
+    116, 32, 80, 65, 76, 32, 119, 105, 108, 108, 32, 110, 111, 116, 32, 115, 101, 116, 32, 50, 52, 95, 56, 32, 104, 119,
+    32, 102, 111, 114, 109, 97, 116, 32, 102, 111, 114, 32, 50, 52, 45, 51, 50, 98, 105, 116, 32, 99, 111, 110, 118,
+    101, 114, 116, 101, 100, 32, 100, 101, 112, 116, 104, 32, 115, 117, 114, 102, 97, 99, 101, 115, 44, 32, 116, 104,
+    105, 115, 32, 119, 105, 108, 108, 32, 102, 105, 120, 32, 102, 97, 115, 116, 32, 99, 108, 101, 97, 114, 32, 101, 120,
+    112, 97, 110, 115, 105, 111, 110, 32, 119, 105, 116, 104, 32, 84, 67, 32, 99, 111, 109, 112, 97, 116, 105, 98, 108,
+    101, 32, 115, 117, 114, 102, 97, 99, 101, 115, 32, 40, 98, 117, 116, 32, 97, 108, 115, 111, 32, 114, 101, 116, 117,
+    114, 110, 32, 105, 110, 99, 111, 114, 114, 101, 99, 116, 32, 117, 110, 99, 108, 97, 109, 112, 101, 100, 32, 98, 111,
+    114, 100, 101, 114, 32, 99, 111, 108, 111, 114, 46, 41, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115,
+    34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107,
+    97, 114, 111, 117, 110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97,
+    115, 104, 78, 97, 109, 101, 34, 58, 32, 49, 57, 50, 53, 51, 55, 48, 49, 50, 51, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 114, 101, 97, 100, 83,
+    101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97,
+    68, 105, 115, 97, 98, 108, 101, 50, 52, 66, 105, 116, 72, 87, 70, 111, 114, 109, 97, 116, 70, 111, 114, 84, 67, 67,
+    111, 109, 112, 97, 116, 105, 98, 108, 101, 68, 101, 112, 116, 104, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97,
+    109, 101, 34, 58, 32, 34, 87, 97, 68, 105, 115, 97, 98, 108, 101, 50, 52, 66, 105, 116, 72, 87, 70, 111, 114, 109,
+    97, 116, 70, 111, 114, 84, 67, 67, 111, 109, 112, 97, 116, 105, 98, 108, 101, 68, 101, 112, 116, 104, 34, 10, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116,
+    105, 111, 110, 34, 58, 32, 34, 79, 110, 32, 71, 102, 120, 57, 44, 32, 116, 104, 101, 32, 68, 66, 32, 99, 97, 110,
+    32, 100, 101, 108, 97, 121, 32, 116, 105, 108, 101, 32, 119, 114, 105, 116, 101, 32, 114, 101, 113, 117, 101, 115,
+    116, 115, 32, 105, 110, 32, 115, 117, 99, 104, 32, 97, 32, 119, 97, 121, 32, 116, 104, 97, 116, 32, 105, 116, 115,
+    32, 112, 101, 110, 100, 105, 110, 103, 32, 119, 114, 105, 116, 101, 32, 97, 99, 107, 32, 99, 111, 117, 110, 116,
+    101, 114, 115, 32, 99, 97, 110, 32, 117, 110, 100, 101, 114, 102, 108, 111, 119, 32, 119, 104, 105, 108, 101, 32,
+    112, 114, 111, 99, 101, 115, 115, 105, 110, 103, 32, 69, 79, 80, 32, 116, 105, 109, 101, 115, 116, 97, 109, 112,
+    115, 46, 32, 84, 104, 101, 32, 119, 111, 114, 107, 97, 114, 111, 117, 110, 100, 32, 105, 115, 32, 116, 111, 32, 105,
+    115, 115, 117, 101, 32, 97, 32, 90, 80, 65, 83, 83, 95, 68, 79, 78, 69, 32, 101, 118, 101, 110, 116, 32, 98, 101,
+    102, 111, 114, 101, 32, 101, 97, 99, 104, 32, 116, 105, 109, 101, 115, 116, 97, 109, 112, 32, 101, 118, 101, 110,
+    116, 32, 98, 101, 99, 97, 117, 115, 101, 32, 105, 116, 32, 119, 105, 108, 108, 32, 97, 100, 100, 32, 112, 101, 110,
+    100, 105, 110, 103, 32, 119, 114, 105, 116, 101, 115, 32, 119, 104, 105, 99, 104, 32, 97, 114, 101, 32, 108, 111,
+    119, 101, 114, 32, 112, 114, 105, 111, 114, 105, 116, 121, 32, 116, 104, 97, 110, 32, 116, 104, 101, 32, 116, 105,
+    108, 101, 32, 119, 114, 105, 116, 101, 115, 32, 115, 111, 32, 116, 104, 101, 121, 32, 119, 105, 108, 108, 32, 102,
+    101, 110, 99, 101, 32, 116, 104, 101, 32, 100, 101, 108, 97, 121, 101, 100, 32, 119, 114, 105, 116, 101, 115, 46,
+    32, 68, 101, 102, 97, 117, 108, 116, 115, 32, 116, 111, 32, 84, 82, 85, 69, 32, 102, 111, 114, 32, 71, 102, 120, 57,
+    44, 32, 70, 65, 76, 83, 69, 32, 102, 111, 114, 32, 111, 116, 104, 101, 114, 115, 46, 34, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114,
+    101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 56, 49, 52, 57, 49, 54, 52, 49, 50, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101,
+    114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80,
+    97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34,
+    98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34,
+    58, 32, 34, 119, 97, 68, 117, 109, 109, 121, 90, 112, 97, 115, 115, 68, 111, 110, 101, 66, 101, 102, 111, 114, 101,
+    84, 115, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 68, 117, 109, 109, 121,
+    90, 112, 97, 115, 115, 68, 111, 110, 101, 66, 101, 102, 111, 114, 101, 84, 115, 34, 10, 32, 32, 32, 32, 125, 44, 10,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58,
+    32, 34, 79, 110, 32, 71, 102, 120, 57, 44, 32, 116, 104, 101, 32, 109, 101, 116, 97, 45, 97, 100, 100, 114, 101,
+    115, 115, 105, 110, 103, 32, 101, 113, 117, 97, 116, 105, 111, 110, 32, 99, 97, 110, 32, 116, 104, 101, 111, 114,
+    101, 116, 105, 99, 97, 108, 108, 121, 32, 109, 97, 112, 32, 109, 117, 108, 116, 105, 112, 108, 101, 32, 112, 105,
+    120, 101, 108, 115, 32, 116, 111, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 84, 104, 105, 115, 32, 102, 105,
+    120, 32, 112, 114, 101, 118, 101, 110, 116, 115, 32, 116, 104, 97, 116, 32, 102, 114, 111, 109, 32, 104, 97, 112,
+    112, 101, 110, 105, 110, 103, 46, 32, 32, 77, 101, 116, 97, 45, 101, 113, 117, 97, 116, 105, 111, 110, 32, 103, 101,
+    110, 101, 114, 97, 116, 101, 100, 32, 98, 121, 32, 100, 114, 105, 118, 101, 114, 32, 109, 117, 115, 116, 32, 109,
+    97, 116, 99, 104, 32, 116, 104, 101, 32, 109, 101, 116, 97, 32, 101, 113, 117, 97, 116, 105, 111, 110, 32, 97, 115,
+    32, 103, 101, 110, 101, 114, 97, 116, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 115, 105, 108, 105, 99, 111,
+    110, 46, 32, 32, 80, 114, 111, 100, 117, 99, 116, 115, 32, 116, 104, 97, 116, 32, 100, 111, 32, 110, 111, 116, 32,
+    104, 97, 118, 101, 32, 116, 104, 101, 32, 102, 105, 120, 32, 104, 97, 118, 101, 32, 110, 111, 32, 72, 87, 32, 99,
+    111, 110, 102, 105, 103, 117, 114, 97, 116, 105, 111, 110, 115, 32, 116, 104, 97, 116, 32, 101, 120, 112, 111, 115,
+    101, 32, 116, 104, 101, 32, 112, 114, 111, 98, 108, 101, 109, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97,
+    103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111,
+    114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 49, 56, 50, 49, 53, 53, 54, 54, 56, 44, 10, 32, 32, 32, 32, 32,
+    32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102,
+    97, 117, 108, 116, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32,
+    34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 114, 101, 97, 100, 83,
+    101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32,
+    32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120,
+    57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34,
+    44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97,
+    77, 101, 116, 97, 65, 108, 105, 97, 115, 105, 110, 103, 70, 105, 120, 69, 110, 97, 98, 108, 101, 100, 34, 44, 10,
+    32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 77, 101, 116, 97, 65, 108, 105, 97, 115, 105,
+    110, 103, 70, 105, 120, 69, 110, 97, 98, 108, 101, 100, 34, 10, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111, 110, 34, 58, 32, 34, 73, 102, 32,
+    115, 101, 116, 32, 80, 65, 76, 32, 115, 101, 116, 115, 32, 67, 66, 95, 67, 79, 76, 79, 82, 95, 65, 84, 84, 82, 73,
+    66, 46, 76, 73, 77, 73, 84, 95, 67, 79, 76, 79, 82, 95, 70, 69, 84, 67, 72, 95, 84, 79, 95, 50, 53, 54, 66, 95, 77,
+    65, 88, 32, 61, 32, 49, 32, 102, 111, 114, 32, 109, 105, 112, 32, 108, 101, 118, 101, 108, 115, 32, 105, 110, 32,
+    116, 104, 101, 32, 116, 97, 105, 108, 32, 116, 104, 97, 116, 32, 97, 114, 101, 110, 39, 116, 32, 116, 104, 101, 32,
+    108, 97, 114, 103, 101, 115, 116, 46, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100, 119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117,
+    110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44, 10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97,
+    109, 101, 34, 58, 32, 50, 57, 52, 52, 51, 51, 51, 55, 49, 54, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97,
+    117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34,
+    58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97,
+    103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116,
+    105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34,
+    83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97, 116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121,
+    34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101, 34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32,
+    32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78, 97, 109, 101, 34, 58, 32, 34, 119, 97, 70, 111, 114, 99,
+    101, 50, 53, 54, 98, 67, 98, 70, 101, 116, 99, 104, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34,
+    58, 32, 34, 87, 97, 70, 111, 114, 99, 101, 50, 53, 54, 98, 67, 98, 70, 101, 116, 99, 104, 34, 10, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+    110, 34, 58, 32, 34, 73, 102, 32, 115, 101, 116, 44, 32, 97, 108, 105, 103, 110, 32, 105, 109, 97, 103, 101, 32, 97,
+    108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 115, 105, 122, 101, 32, 117, 112, 32, 116, 111, 32, 102, 114, 97,
+    103, 109, 101, 110, 116, 32, 115, 105, 122, 101, 32, 119, 104, 101, 110, 32, 67, 109, 97, 115, 107, 32, 105, 115,
+    32, 112, 114, 101, 115, 101, 110, 116, 44, 32, 98, 117, 116, 32, 99, 111, 110, 116, 105, 110, 117, 101, 32, 116,
+    111, 32, 105, 115, 115, 117, 101, 32, 71, 67, 78, 32, 114, 97, 110, 103, 101, 100, 32, 115, 121, 110, 99, 115, 32,
+    111, 112, 101, 114, 97, 116, 105, 111, 110, 115, 32, 117, 115, 105, 110, 103, 32, 116, 104, 101, 32, 111, 114, 105,
+    103, 105, 110, 97, 108, 44, 32, 117, 110, 112, 97, 100, 100, 101, 100, 32, 115, 105, 122, 101, 46, 34, 44, 10, 32,
+    32, 32, 32, 32, 32, 34, 84, 97, 103, 115, 34, 58, 32, 91, 10, 32, 32, 32, 32, 32, 32, 32, 32, 34, 72, 97, 114, 100,
+    119, 97, 114, 101, 32, 87, 111, 114, 107, 97, 114, 111, 117, 110, 100, 115, 34, 10, 32, 32, 32, 32, 32, 32, 93, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 72, 97, 115, 104, 78, 97, 109, 101, 34, 58, 32, 51, 48, 48, 50, 51, 56, 52, 51, 54,
+    57, 44, 10, 32, 32, 32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 34, 68, 101, 102, 97, 117, 108, 116, 34, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32,
+    125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 70, 108, 97, 103, 115, 34, 58, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    34, 82, 101, 114, 101, 97, 100, 83, 101, 116, 116, 105, 110, 103, 34, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32,
+    32, 32, 32, 125, 44, 10, 32, 32, 32, 32, 32, 32, 34, 83, 99, 111, 112, 101, 34, 58, 32, 34, 80, 114, 105, 118, 97,
+    116, 101, 80, 97, 108, 71, 102, 120, 57, 75, 101, 121, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 84, 121, 112, 101,
+    34, 58, 32, 34, 98, 111, 111, 108, 34, 44, 10, 32, 32, 32, 32, 32, 32, 34, 86, 97, 114, 105, 97, 98, 108, 101, 78,
+    97, 109, 101, 34, 58, 32, 34, 119, 97, 67, 109, 97, 115, 107, 73, 109, 97, 103, 101, 83, 121, 110, 99, 115, 34, 44,
+    10, 32, 32, 32, 32, 32, 32, 34, 78, 97, 109, 101, 34, 58, 32, 34, 87, 97, 67, 109, 97, 115, 107, 73, 109, 97, 103,
+    101, 83, 121, 110, 99, 115, 34, 10, 32, 32, 32, 32, 125, 10, 32, 32, 93, 10, 125
 };  // g_gfx9PalJsonData[]
 
 } // Gfx9
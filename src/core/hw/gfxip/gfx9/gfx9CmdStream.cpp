@@ -83,6 +83,7 @@ CmdStream::CmdStream(
     m_pChunkPreamble(nullptr),
     m_contextRollDetected(false)
 {
+    memset(&m_pm4OptStats, 0, sizeof(m_pm4OptStats));
 }
 
 // =====================================================================================================================
@@ -150,16 +151,37 @@ void CmdStream::Reset(
     // Reset all tracked state.
     m_pChunkPreamble      = nullptr;
     m_contextRollDetected = false;
+    memset(&m_pm4OptStats, 0, sizeof(m_pm4OptStats));
 
     GfxCmdStream::Reset(pNewAllocator, returnGpuMemory);
 }
 
+// =====================================================================================================================
+void CmdStream::AccumulateRecordingStats(
+    CmdBufferRecordingStats* pStats
+    ) const
+{
+    GfxCmdStream::AccumulateRecordingStats(pStats);
+
+    pStats->pm4OptDwordsEliminated       += m_pm4OptStats.pm4OptDwordsEliminated;
+    pStats->pm4OptContextRollsEliminated += m_pm4OptStats.pm4OptContextRollsEliminated;
+}
+
 // =====================================================================================================================
 void CmdStream::CleanupTempObjects()
 {
     // Clean up the temporary PM4 optimizer object.
     if (m_pMemAllocator != nullptr)
     {
+        if (m_pPm4Optimizer != nullptr)
+        {
+            const Pm4OptimizerStats& stats = m_pPm4Optimizer->GetStats();
+
+            // The optimizer is destroyed at the end of every build; keep its statistics for GetRecordingStats().
+            m_pm4OptStats.pm4OptDwordsEliminated       += stats.dwordsEliminated;
+            m_pm4OptStats.pm4OptContextRollsEliminated += stats.contextRollsEliminated;
+        }
+
         PAL_SAFE_DELETE(m_pPm4Optimizer, m_pMemAllocator);
     }
 }
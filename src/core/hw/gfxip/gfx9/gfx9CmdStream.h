@@ -57,6 +57,8 @@ public:
     virtual Result Begin(CmdStreamBeginFlags flags, Util::VirtualLinearAllocator* pMemAllocator) override;
     virtual void   Reset(CmdAllocator* pNewAllocator, bool returnGpuMemory) override;
 
+    virtual void AccumulateRecordingStats(CmdBufferRecordingStats* pStats) const override;
+
     // Public command interface:
     // The command stream client should call these special functions whenever it wishes to copy pre-built PM4 images
     // to the reserve buffer or wishes to build any of the relevant packets directly in the reserve buffer. These
@@ -160,11 +162,13 @@ private:
     virtual void BeginCurrentChunk() override;
     virtual void EndCurrentChunk(bool atEndOfStream) override;
 
-    const CmdUtil& m_cmdUtil;
-    Pm4Optimizer*  m_pPm4Optimizer;       // This will only be created if optimization is enabled for this stream.
-    uint32*        m_pChunkPreamble;      // If non-null, the current chunk preamble was allocated here.
-    bool           m_contextRollDetected; // This will only be set if a context roll has been detected since the
-                                          // last draw.
+    const CmdUtil&          m_cmdUtil;
+    Pm4Optimizer*           m_pPm4Optimizer;       // This will only be created if optimization is enabled for this
+                                                   // stream.
+    uint32*                 m_pChunkPreamble;      // If non-null, the current chunk preamble was allocated here.
+    bool                    m_contextRollDetected; // This will only be set if a context roll has been detected since
+                                                   // the last draw.
+    CmdBufferRecordingStats m_pm4OptStats;         // PM4 optimizer statistics gathered since the last Reset().
 
     PAL_DISALLOW_COPY_AND_ASSIGN(CmdStream);
     PAL_DISALLOW_DEFAULT_CTOR(CmdStream);
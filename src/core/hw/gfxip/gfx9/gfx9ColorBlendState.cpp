@@ -37,12 +37,15 @@ namespace Pal
 namespace Gfx9
 {
 
+uint64 ColorBlendState::s_numCreated = 0;
+
 // =====================================================================================================================
 ColorBlendState::ColorBlendState(
     const Device&                    device,
     const ColorBlendStateCreateInfo& createInfo)
     :
     Pal::ColorBlendState(*device.Parent()),
+    m_uniqueId(AtomicAdd64(&s_numCreated, 1)),
     m_dualSrcBlend(false),
     m_blendEnableMask(0),
     m_blendReadsDestMask(0),
@@ -65,6 +65,9 @@ public:
     static size_t Pm4ImgSize() { return sizeof(BlendStatePm4Img); }
     uint32* WriteCommands(CmdStream* pCmdStream, uint32* pCmdSpace) const;
 
+    // Returns an ID which no other color blend state object created in this process shares.
+    uint64 UniqueId() const { return m_uniqueId; }
+
     bool IsBlendEnabled(uint32 slot) const { return ((m_blendEnableMask & (1 << slot)) != 0); }
     bool IsDualSrcBlend() const { return m_dualSrcBlend; }
 
@@ -103,6 +106,9 @@ private:
     static CombFunc HwBlendFunc(BlendFunc blendFunc);
     static bool     IsDualSrcBlendOption(Blend blend);
 
+    static uint64 s_numCreated; // Number of ColorBlendState objects created so far.
+
+    const uint64                 m_uniqueId;
     // Image of PM4 commands needed to write this object to hardware.
     BlendStatePm4Img             m_pm4Commands;
     // Per MRT blend opts
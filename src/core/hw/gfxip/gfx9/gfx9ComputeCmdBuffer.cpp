@@ -1324,6 +1324,9 @@ void ComputeCmdBuffer::CmdExecuteNestedCmdBuffers(
         // state back to the caller.
         LeakNestedCmdBufferState(*pCallee);
     }
+
+    // Chained callees jump directly from one to the next; the last of them still has to return here.
+    m_cmdStream.EndCallChain();
 }
 
 // =====================================================================================================================
@@ -0,0 +1,299 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2016-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/hw/gfxip/gfx9/gfx9CpuTiler.h"
+#include "palInlineFuncs.h"
+
+#include <string.h>
+
+using namespace Util;
+
+namespace Pal
+{
+namespace Gfx9
+{
+
+// Copies one row of elements between the image and linear memory.  The element size is a template parameter so that
+// each element is moved with a single load and store.
+typedef void (*CopyRowFunc)(
+    const CpuTiler::AddrTerm* pXTerms,
+    uint32                    width,
+    gpusize                   rowLow,
+    gpusize                   rowHigh,
+    const uint8*              pSrc,
+    uint8*                    pDst);
+
+// =====================================================================================================================
+template <uint32 ElementBytes, bool ToImage>
+static void CopyRow(
+    const CpuTiler::AddrTerm* pXTerms,
+    uint32                    width,
+    gpusize                   rowLow,   // Low part of the address of the row's first element, without its X terms.
+    gpusize                   rowHigh,  // High part of the address of the row's first element, without its X terms.
+    const uint8*              pSrc,     // The start of the image data, or the row's first element in linear memory.
+    uint8*                    pDst)     // The row's first element in linear memory, or the start of the image data.
+{
+    for (uint32 x = 0; x < width; ++x)
+    {
+        const gpusize imageOffset  = (rowLow ^ pXTerms[x].low) + rowHigh + pXTerms[x].high;
+        const gpusize linearOffset = x * ElementBytes;
+
+        memcpy(pDst + (ToImage ? imageOffset : linearOffset),
+               pSrc + (ToImage ? linearOffset : imageOffset),
+               ElementBytes);
+    }
+}
+
+// Indexed by [toImage][log2(element bytes)].
+static const CopyRowFunc CopyRowFuncs[2][5] =
+{
+    { &CopyRow<1, false>, &CopyRow<2, false>, &CopyRow<4, false>, &CopyRow<8, false>, &CopyRow<16, false> },
+    { &CopyRow<1, true>,  &CopyRow<2, true>,  &CopyRow<4, true>,  &CopyRow<8, true>,  &CopyRow<16, true>  },
+};
+
+// =====================================================================================================================
+// Asks AddrLib for the byte offset of the element at the given coordinates.  Returns false if AddrLib fails.
+static bool ComputeElementAddr(
+    ADDR_HANDLE                                hAddrLib,
+    ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT* pInput,
+    uint32                                     x,
+    uint32                                     y,
+    uint32                                     z,
+    gpusize*                                   pAddr)
+{
+    ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_OUTPUT output = { };
+    output.size = sizeof(output);
+
+    // The slice input is used for both 2D arrays and 3D slices.
+    pInput->x     = x;
+    pInput->y     = y;
+    pInput->slice = z;
+
+    const bool succeeded = (Addr2ComputeSurfaceAddrFromCoord(hAddrLib, pInput, &output) == ADDR_OK);
+
+    *pAddr = output.addr;
+
+    return succeeded;
+}
+
+// =====================================================================================================================
+// Learns the address terms of every coordinate bit the region touches and expands the X terms of the region into
+// pXTerms, which must have room for one entry per column of the region.
+Result CpuTiler::Init(
+    ADDR_HANDLE                                      hAddrLib,
+    const ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT& surfInput,     // Describes the subresource; coords are ignored.
+    uint32                                           log2BlockSize, // Zero for linear swizzle modes.
+    gpusize                                          aspectOffset,  // Offset of the aspect from the image's start.
+    bool                                             is3dImage,
+    const CpuImageCopyRegion&                        region,
+    AddrTerm*                                        pXTerms)
+{
+    const uint32 numZ = is3dImage ? region.imageExtent.depth : region.numSlices;
+
+    m_region          = region;
+    m_pXTerms         = pXTerms;
+    m_elementBytes    = surfInput.bpp >> 3;
+    m_firstZ          = is3dImage ? region.imageOffset.z : region.imageSubres.arraySlice;
+    m_numRows         = (region.imageExtent.width > 0) ? (region.imageExtent.height * numZ) : 0;
+    m_rowIsContiguous = false;
+
+    Result result = Result::Success;
+
+    if (m_numRows > 0)
+    {
+        ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT input = surfInput;
+
+        const gpusize lowMask = (1ull << log2BlockSize) - 1;
+        gpusize       origin  = 0;
+        bool          addrOk  = ComputeElementAddr(hAddrLib, &input, 0, 0, 0, &origin);
+
+        m_baseLow  = (origin & lowMask);
+        m_baseHigh = (origin & ~lowMask) + aspectOffset;
+
+        const uint32 lastCoord[] =
+        {
+            region.imageOffset.x + region.imageExtent.width - 1,
+            region.imageOffset.y + region.imageExtent.height - 1,
+            m_firstZ + numZ - 1,
+        };
+
+        AxisTerms        xTerms;
+        AxisTerms*const  pAxes[] = { &xTerms, &m_yTerms, &m_zTerms };
+
+        for (uint32 axis = 0; axis < 3; ++axis)
+        {
+            AxisTerms*const pTerms = pAxes[axis];
+
+            pTerms->numBits = 0;
+
+            for (uint32 bit = 0; addrOk && (bit < MaxCoordBits) && ((1u << bit) <= lastCoord[axis]); ++bit)
+            {
+                uint32 coord[3] = { };
+                coord[axis]     = (1u << bit);
+
+                gpusize addr = 0;
+                addrOk = ComputeElementAddr(hAddrLib, &input, coord[0], coord[1], coord[2], &addr);
+
+                pTerms->low[bit]  = (addr & lowMask) ^ m_baseLow;
+                pTerms->high[bit] = (addr & ~lowMask) - (origin & ~lowMask);
+                pTerms->numBits   = bit + 1;
+            }
+        }
+
+        if (addrOk)
+        {
+            // Linear layouts have no XOR part, so a row may be a single contiguous run of bytes.
+            m_rowIsContiguous = (lowMask == 0);
+
+            for (uint32 xi = 0; xi < region.imageExtent.width; ++xi)
+            {
+                const uint32 x    = region.imageOffset.x + xi;
+                AddrTerm     term = { };
+
+                for (uint32 bit = 0; bit < xTerms.numBits; ++bit)
+                {
+                    if (TestAnyFlagSet(x, 1u << bit))
+                    {
+                        term.low  ^= xTerms.low[bit];
+                        term.high += xTerms.high[bit];
+                    }
+                }
+
+                pXTerms[xi] = term;
+
+                m_rowIsContiguous = m_rowIsContiguous &&
+                                    (term.high == (pXTerms[0].high + (xi * m_elementBytes)));
+            }
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+            // Make sure the terms reproduce AddrLib's address of the last element of the region.
+            gpusize lastAddr = 0;
+            gpusize rowLow   = 0;
+            gpusize rowHigh  = 0;
+            const AddrTerm& lastX = pXTerms[region.imageExtent.width - 1];
+
+            ComputeRowAddr(lastCoord[1], lastCoord[2], &rowLow, &rowHigh);
+
+            if (ComputeElementAddr(hAddrLib, &input, lastCoord[0], lastCoord[1], lastCoord[2], &lastAddr))
+            {
+                PAL_ASSERT((lastAddr + aspectOffset) == ((rowLow ^ lastX.low) + rowHigh + lastX.high));
+            }
+#endif
+        }
+        else
+        {
+            result = Result::ErrorUnknown;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Computes the address of the element at column zero of the region in the given absolute row and slice, minus the X
+// terms of that column.
+void CpuTiler::ComputeRowAddr(
+    uint32   y,
+    uint32   z,
+    gpusize* pRowLow,
+    gpusize* pRowHigh
+    ) const
+{
+    gpusize low  = m_baseLow;
+    gpusize high = m_baseHigh;
+
+    for (uint32 bit = 0; bit < m_yTerms.numBits; ++bit)
+    {
+        if (TestAnyFlagSet(y, 1u << bit))
+        {
+            low  ^= m_yTerms.low[bit];
+            high += m_yTerms.high[bit];
+        }
+    }
+
+    for (uint32 bit = 0; bit < m_zTerms.numBits; ++bit)
+    {
+        if (TestAnyFlagSet(z, 1u << bit))
+        {
+            low  ^= m_zTerms.low[bit];
+            high += m_zTerms.high[bit];
+        }
+    }
+
+    *pRowLow  = low;
+    *pRowHigh = high;
+}
+
+// =====================================================================================================================
+// Copies a range of the region's rows.  Distinct row ranges never touch the same bytes, so different threads may copy
+// different ranges of the same region at once.
+void CpuTiler::CopyRows(
+    uint32      firstRow,
+    uint32      numRows,
+    const void* pSrc,    // Linear memory if toImage is set, otherwise the image data.
+    void*       pDst,    // The image data if toImage is set, otherwise linear memory.
+    bool        toImage
+    ) const
+{
+    PAL_ASSERT((firstRow + numRows) <= m_numRows);
+
+    const uint32      width    = m_region.imageExtent.width;
+    const uint32      height   = m_region.imageExtent.height;
+    const CopyRowFunc pfnCopy  = CopyRowFuncs[toImage ? 1 : 0][Log2(m_elementBytes)];
+    const uint8*const pSrcData = static_cast<const uint8*>(pSrc);
+    uint8*const       pDstData = static_cast<uint8*>(pDst);
+
+    for (uint32 row = firstRow; row < (firstRow + numRows); ++row)
+    {
+        const uint32  yi           = row % height;
+        const uint32  zi           = row / height;
+        const gpusize linearOffset = m_region.memoryOffset + (zi * m_region.memoryDepthPitch) +
+                                     (yi * m_region.memoryRowPitch);
+
+        gpusize rowLow  = 0;
+        gpusize rowHigh = 0;
+        ComputeRowAddr(m_region.imageOffset.y + yi, m_firstZ + zi, &rowLow, &rowHigh);
+
+        if (m_rowIsContiguous)
+        {
+            const gpusize imageOffset = rowLow + rowHigh + m_pXTerms[0].high;
+
+            memcpy(pDstData + (toImage ? imageOffset : linearOffset),
+                   pSrcData + (toImage ? linearOffset : imageOffset),
+                   static_cast<size_t>(width) * m_elementBytes);
+        }
+        else if (toImage)
+        {
+            pfnCopy(m_pXTerms, width, rowLow, rowHigh, pSrcData + linearOffset, pDstData);
+        }
+        else
+        {
+            pfnCopy(m_pXTerms, width, rowLow, rowHigh, pSrcData, pDstData + linearOffset);
+        }
+    }
+}
+
+} // Gfx9
+} // Pal
@@ -0,0 +1,106 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2016-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "core/addrMgr/addrMgr2/addrMgr2.h"
+#include "palImage.h"
+
+namespace Pal
+{
+namespace Gfx9
+{
+
+// =====================================================================================================================
+// Copies one CpuImageCopyRegion between linear system memory and a swizzled image subresource using the CPU.
+//
+// AddrLib's swizzle patterns XOR coordinate bits together inside of a swizzle block, while whole blocks (as well as
+// slices, mip levels and the mip tail) are laid out by multiplying coordinates by pitches.  Thus the byte offset of
+// an element can be split into a part below the block size which is the XOR of one term per set coordinate bit, and
+// a part above it which is the sum of one term per set coordinate bit.  Init() asks AddrLib for the address of one
+// element per coordinate bit to learn these terms, after which every element's address can be computed with a few
+// XORs and adds.  The X terms of the whole region are expanded into a table up front; the Y and Z terms are combined
+// once per row.
+class CpuTiler
+{
+public:
+    // The contribution of one X coordinate to an element's image address.
+    struct AddrTerm
+    {
+        gpusize low;  // Part of the address below the swizzle block size; XOR'ed together.
+        gpusize high; // Part of the address at or above the swizzle block size; added together.
+    };
+
+    CpuTiler() : m_pXTerms(nullptr), m_elementBytes(0), m_numRows(0), m_rowIsContiguous(false) { }
+    ~CpuTiler() { }
+
+    Result Init(
+        ADDR_HANDLE                                      hAddrLib,
+        const ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT& surfInput,
+        uint32                                           log2BlockSize,
+        gpusize                                          aspectOffset,
+        bool                                             is3dImage,
+        const CpuImageCopyRegion&                        region,
+        AddrTerm*                                        pXTerms);
+
+    // Each row is one scanline of one array or depth slice of the region.
+    uint32 NumRows() const { return m_numRows; }
+
+    void CopyRows(
+        uint32      firstRow,
+        uint32      numRows,
+        const void* pSrc,
+        void*       pDst,
+        bool        toImage) const;
+
+private:
+    static constexpr uint32 MaxCoordBits = 32;
+
+    // The contributions of each bit of a coordinate to an element's image address.
+    struct AxisTerms
+    {
+        uint32  numBits;
+        gpusize low[MaxCoordBits];
+        gpusize high[MaxCoordBits];
+    };
+
+    void ComputeRowAddr(uint32 y, uint32 z, gpusize* pRowLow, gpusize* pRowHigh) const;
+
+    CpuImageCopyRegion m_region;
+    AddrTerm*          m_pXTerms;         // One entry per column of the region; owned by the caller.
+    AxisTerms          m_yTerms;
+    AxisTerms          m_zTerms;
+    gpusize            m_baseLow;         // Address of element (0, 0, 0), split like the terms.
+    gpusize            m_baseHigh;
+    uint32             m_firstZ;          // First array slice or depth slice of the region.
+    uint32             m_elementBytes;
+    uint32             m_numRows;
+    bool               m_rowIsContiguous; // Each row of the region is stored contiguously in the image.
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(CpuTiler);
+};
+
+} // Gfx9
+} // Pal
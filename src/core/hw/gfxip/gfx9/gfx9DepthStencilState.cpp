@@ -32,12 +32,15 @@ namespace Pal
 namespace Gfx9
 {
 
+uint64 DepthStencilState::s_numCreated = 0;
+
 // =====================================================================================================================
 DepthStencilState::DepthStencilState(
     const Device& device)
     :
     Pal::DepthStencilState(*device.Parent()),
-    m_device(device)
+    m_device(device),
+    m_uniqueId(Util::AtomicAdd64(&s_numCreated, 1))
 {
     memset(&m_pm4Commands, 0, sizeof(m_pm4Commands));
     memset(&m_flags, 0, sizeof(m_flags));
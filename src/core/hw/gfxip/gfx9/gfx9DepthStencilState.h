@@ -65,6 +65,9 @@ public:
 
     uint32* WriteCommands(CmdStream* pCmdStream, uint32* pCmdSpace) const;
 
+    // Returns an ID which no other depth stencil state object created in this process shares.
+    uint64 UniqueId() const { return m_uniqueId; }
+
     bool IsDepthEnabled() const { return (m_flags.isDepthEnabled != 0); }
     bool IsStencilEnabled() const { return (m_flags.isStencilEnabled != 0); }
     bool IsDepthWriteEnabled() const { return (m_flags.isDepthWriteEnabled != 0); }
@@ -82,7 +85,10 @@ private:
     static CompareFrag HwDepthCompare(CompareFunc func);
     static ::StencilOp HwStencilOp(StencilOp stencilOp);
 
+    static uint64 s_numCreated; // Number of DepthStencilState objects created so far.
+
     const Device&            m_device;
+    const uint64             m_uniqueId;
 
     // Image of PM4 commands needed to write this object to hardware.
     DepthStencilStatePm4Img  m_pm4Commands;
@@ -26,6 +26,7 @@
 #include "core/platform.h"
 #include "core/image.h"
 #include "core/hw/gfxip/gfxCmdBuffer.h"
+#include "core/hw/gfxip/gfx9/gfx9CpuTiler.h"
 #include "core/hw/gfxip/gfx9/gfx9Image.h"
 #include "core/hw/gfxip/gfx9/gfx9Device.h"
 #include "core/hw/gfxip/gfx9/gfx9FormatInfo.h"
@@ -33,6 +34,7 @@
 #include "core/hw/gfxip/gfx9/g_gfx9PalSettings.h"
 #include "core/addrMgr/addrMgr2/addrMgr2.h"
 #include "palMath.h"
+#include "palSysUtil.h"
 
 #include <limits.h>
 
@@ -2732,6 +2734,214 @@ gpusize Image::GetMipAddr(
     return addrWithXor;
 }
 
+// =====================================================================================================================
+// Shared state of the threads which take part in a single CPU copy.
+struct CpuCopyJob
+{
+    const CpuTiler*      pTilers;
+    const uint32*        pFirstBand;    // Index of the first band of each region; has an extra entry for the end.
+    uint32               regionCount;
+    const void*          pSrc;
+    void*                pDst;
+    bool                 toImage;
+    volatile uint32      nextBand;      // Index of the next band which no thread has started on.
+};
+
+// Number of rows in a band, the unit of work handed to the copy threads.
+constexpr uint32 CpuCopyRowsPerBand = 16;
+
+// Smallest number of bytes worth giving to another thread. Below this, waking a worker costs about as much as the
+// copy it would take over, so small copies stay on the calling thread.
+constexpr gpusize CpuCopyMinBytesPerThread = 256 * 1024;
+
+// =====================================================================================================================
+// Thread function which copies bands of rows until there are none left.
+static void CpuCopyThread(
+    void* pJobData)
+{
+    auto*const   pJob     = static_cast<CpuCopyJob*>(pJobData);
+    const uint32 numBands = pJob->pFirstBand[pJob->regionCount];
+    uint32       region   = 0;
+
+    for (uint32 band = AtomicIncrement(&pJob->nextBand) - 1;
+         band < numBands;
+         band = AtomicIncrement(&pJob->nextBand) - 1)
+    {
+        // Bands are handed out in increasing order, so each thread only ever needs to walk forward through the
+        // regions.
+        while (band >= pJob->pFirstBand[region + 1])
+        {
+            region++;
+        }
+
+        const CpuTiler& tiler    = pJob->pTilers[region];
+        const uint32    firstRow = (band - pJob->pFirstBand[region]) * CpuCopyRowsPerBand;
+
+        tiler.CopyRows(firstRow,
+                       Min(CpuCopyRowsPerBand, tiler.NumRows() - firstRow),
+                       pJob->pSrc,
+                       pJob->pDst,
+                       pJob->toImage);
+    }
+}
+
+// =====================================================================================================================
+// Copies between linear system memory and the image's data using the CPU.  Each region is set up by a CpuTiler and the
+// rows of all regions are then split into bands which are copied by the calling thread and, for large copies, the
+// platform's worker pool.
+Result Image::CpuCopy(
+    const void*               pSrc,
+    void*                     pDst,
+    uint32                    regionCount,
+    const CpuImageCopyRegion* pRegions,
+    uint32                    maxThreadCount,
+    bool                      toImage
+    ) const
+{
+    const Pal::Image*const pParent    = Parent();
+    const ImageCreateInfo& createInfo = pParent->GetImageCreateInfo();
+    const bool             is3dImage  = (createInfo.imageType == ImageType::Tex3d);
+    Platform*const         pPlatform  = m_device.GetPlatform();
+
+    Result  result     = Result::Success;
+    uint32  totalWidth = 0;
+    gpusize totalBytes = 0;
+
+    // The aspects of YUV planar images are interleaved per slice, which the tilers don't model.
+    if (Formats::IsYuvPlanar(createInfo.swizzledFormat.format))
+    {
+        result = Result::Unsupported;
+    }
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < regionCount); ++idx)
+    {
+        const auto*           pSubResInfo = pParent->SubresourceInfo(pRegions[idx].imageSubres);
+        const AddrSwizzleMode swizzleMode = GetAddrSettings(pSubResInfo).swizzleMode;
+        const uint32          bpp         = Formats::BitsPerPixel(pSubResInfo->format.format);
+
+        // The variable-sized swizzle blocks are never used by PAL and the tilers only move whole power-of-two sized
+        // elements.
+        if (AddrMgr2::IsVarSwizzle(swizzleMode) ||
+            (IsPowerOfTwo(bpp) == false) || (bpp < 8) || (bpp > 128))
+        {
+            result = Result::Unsupported;
+        }
+
+        const Extent3d& extent = pRegions[idx].imageExtent;
+
+        totalWidth += extent.width;
+        totalBytes += gpusize(extent.width) * extent.height * extent.depth * pRegions[idx].numSlices * (bpp >> 3);
+    }
+
+    CpuTiler*           pTilers    = nullptr;
+    CpuTiler::AddrTerm* pXTerms    = nullptr;
+    uint32*             pFirstBand = nullptr;
+
+    if (result == Result::Success)
+    {
+        pTilers    = PAL_NEW_ARRAY(CpuTiler, regionCount, pPlatform, AllocInternalTemp);
+        pXTerms    = PAL_NEW_ARRAY(CpuTiler::AddrTerm, Max(totalWidth, 1u), pPlatform, AllocInternalTemp);
+        pFirstBand = PAL_NEW_ARRAY(uint32, regionCount + 1, pPlatform, AllocInternalTemp);
+
+        if ((pTilers == nullptr) || (pXTerms == nullptr) || (pFirstBand == nullptr))
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        const ADDR_HANDLE   hAddrLib = m_device.AddrLibHandle();
+        CpuTiler::AddrTerm* pNextX   = pXTerms;
+
+        pFirstBand[0] = 0;
+
+        for (uint32 idx = 0; (result == Result::Success) && (idx < regionCount); ++idx)
+        {
+            const CpuImageCopyRegion& region          = pRegions[idx];
+            const auto*               pSubResInfo     = pParent->SubresourceInfo(region.imageSubres);
+            const auto&               surfSetting     = GetAddrSettings(pSubResInfo);
+            const SubresId            baseMipSubResId = { region.imageSubres.aspect, 0, region.imageSubres.arraySlice };
+            const auto*               pBaseSubResInfo = pParent->SubresourceInfo(baseMipSubResId);
+
+            ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT input = { };
+            input.size            = sizeof(ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT);
+            input.sample          = 0;
+            input.mipId           = region.imageSubres.mipLevel;
+            input.unalignedWidth  = pBaseSubResInfo->extentElements.width;
+            input.unalignedHeight = pBaseSubResInfo->extentElements.height;
+            input.numSlices       = is3dImage ? createInfo.extent.depth : createInfo.arraySize;
+            input.numMipLevels    = createInfo.mipLevels;
+            input.numSamples      = createInfo.samples;
+            input.numFrags        = createInfo.fragments;
+            input.swizzleMode     = surfSetting.swizzleMode;
+            input.resourceType    = surfSetting.resourceType;
+            input.pipeBankXor     = AddrMgr2::GetTileInfo(pParent, pSubResInfo->subresId)->pipeBankXor;
+            input.bpp             = Formats::BitsPerPixel(pSubResInfo->format.format);
+
+            const uint32 log2BlockSize = AddrMgr2::IsLinearSwizzleMode(surfSetting.swizzleMode)
+                                         ? 0
+                                         : Log2(AddrMgr2::GetBlockSize(surfSetting.swizzleMode));
+
+            result = pTilers[idx].Init(hAddrLib,
+                                       input,
+                                       log2BlockSize,
+                                       m_aspectOffset[GetAspectIndex(region.imageSubres.aspect)],
+                                       is3dImage,
+                                       region,
+                                       pNextX);
+
+            pNextX              += region.imageExtent.width;
+            pFirstBand[idx + 1]  = pFirstBand[idx] + RoundUpQuotient(pTilers[idx].NumRows(), CpuCopyRowsPerBand);
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        const uint32 numBands    = pFirstBand[regionCount];
+        uint32       threadCount = maxThreadCount;
+
+        if (threadCount == 0)
+        {
+            SystemInfo systemInfo = { };
+            threadCount = (QuerySystemInfo(&systemInfo) == Result::Success) ? systemInfo.cpuLogicalCoreCount : 1;
+        }
+        threadCount = Min(threadCount, numBands);
+
+        const gpusize maxUsefulThreads = totalBytes / CpuCopyMinBytesPerThread;
+        if (maxUsefulThreads < threadCount)
+        {
+            threadCount = static_cast<uint32>(maxUsefulThreads);
+        }
+
+        threadCount = Max(threadCount, 1u);
+
+        CpuCopyJob job = { };
+        job.pTilers     = pTilers;
+        job.pFirstBand  = pFirstBand;
+        job.regionCount = regionCount;
+        job.pSrc        = pSrc;
+        job.pDst        = pDst;
+        job.toImage     = toImage;
+        job.nextBand    = 0;
+
+        if (threadCount > 1)
+        {
+            pPlatform->GetWorkerPool()->Run(&CpuCopyThread, &job, threadCount);
+        }
+        else
+        {
+            CpuCopyThread(&job);
+        }
+    }
+
+    PAL_SAFE_DELETE_ARRAY(pFirstBand, pPlatform);
+    PAL_SAFE_DELETE_ARRAY(pXTerms, pPlatform);
+    PAL_SAFE_DELETE_ARRAY(pTilers, pPlatform);
+
+    return result;
+}
+
 // =====================================================================================================================
 // Returns the buffer view of metadata lookup table for specified mip level
 void Image::BuildMetadataLookupTableBufferView(
@@ -352,6 +352,14 @@ public:
 
     virtual gpusize GetAspectBaseAddr(ImageAspect  aspect) const override;
 
+    virtual Result CpuCopy(
+        const void*               pSrc,
+        void*                     pDst,
+        uint32                    regionCount,
+        const CpuImageCopyRegion* pRegions,
+        uint32                    maxThreadCount,
+        bool                      toImage) const override;
+
     virtual void GetSharedMetadataInfo(SharedMetadataInfo* pMetadataInfo) const override;
 
     gpusize GetMipAddr(SubresId subresId) const;
@@ -38,6 +38,8 @@ namespace Gfx9
 
 constexpr uint32 NumSampleLocations = 16;
 
+uint64 MsaaState::s_numCreated = 0;
+
 // =====================================================================================================================
 // Helper function which computes the maximum sample distance (from pixel center) based on the specified sample
 // positions.
@@ -64,6 +66,7 @@ MsaaState::MsaaState(
     :
     Pal::MsaaState(*device.Parent()),
     m_device(device),
+    m_uniqueId(AtomicAdd64(&s_numCreated, 1)),
     m_log2Samples(0),
     m_sampleMask(0),
     m_pixelShaderSamples(0),
@@ -132,6 +132,9 @@ public:
     static size_t Pm4ImgSize(const Device& device, const MsaaStateCreateInfo& msaaState);
     uint32* WriteCommands(CmdStream* pCmdStream, uint32* pCmdSpace) const;
 
+    // Returns an ID which no other MSAA state object created in this process shares.
+    uint64 UniqueId() const { return m_uniqueId; }
+
     bool UsesOverRasterization() const { return (m_pm4Image.dbEqaa.bits.OVERRASTERIZATION_AMOUNT != 0); }
     bool ShaderCanKill() const { return (m_pm4Image.dbAlphaToMask.bits.ALPHA_TO_MASK_ENABLE != 0); }
 
@@ -148,7 +151,10 @@ protected:
 private:
     void BuildPm4Headers();
 
+    static uint64 s_numCreated; // Number of MsaaState objects created so far.
+
     const Device&  m_device;
+    const uint64   m_uniqueId;
 
     uint32  m_log2Samples;
     uint32  m_sampleMask;
@@ -71,6 +71,8 @@ Pm4Optimizer::Pm4Optimizer(
     , m_dstContainsSrc(false)
 #endif
 {
+    memset(&m_stats, 0, sizeof(m_stats));
+
     Reset();
 }
 
@@ -120,6 +122,22 @@ void Pm4Optimizer::Reset()
 
     // Always start with no context rolls
     m_contextRollDetected = false;
+    m_cntxWindowKept      = false;
+    m_cntxWindowSkipped   = false;
+}
+
+// =====================================================================================================================
+// Called when a draw ends the current context window. If every context register write in the window was skipped, the
+// draw would have rolled the context without the optimizer.
+void Pm4Optimizer::EndContextWindow()
+{
+    if (m_cntxWindowSkipped && (m_cntxWindowKept == false))
+    {
+        m_stats.contextRollsEliminated++;
+    }
+
+    m_cntxWindowKept    = false;
+    m_cntxWindowSkipped = false;
 }
 
 // =====================================================================================================================
@@ -134,6 +152,13 @@ bool Pm4Optimizer::MustKeepSetContextReg(
     const bool mustKeep = UpdateRegState(regData, m_cntxRegs + (regAddr - CONTEXT_SPACE_START));
 
     m_contextRollDetected |= mustKeep;
+    TrackContextWindow(mustKeep);
+
+    if (mustKeep == false)
+    {
+        // The caller would have written a single-register SET packet.
+        m_stats.dwordsEliminated += CmdUtil::ContextRegSizeDwords + 1;
+    }
 
     return mustKeep;
 }
@@ -149,6 +174,12 @@ bool Pm4Optimizer::MustKeepSetShReg(
 
     const bool mustKeep = UpdateRegState(regData, m_shRegs + (regAddr - PERSISTENT_SPACE_START));
 
+    if (mustKeep == false)
+    {
+        // The caller would have written a single-register SET packet.
+        m_stats.dwordsEliminated += CmdUtil::ShRegSizeDwords + 1;
+    }
+
     return mustKeep;
 }
 
@@ -179,6 +210,12 @@ bool Pm4Optimizer::MustKeepContextRegRmw(
     }
 
     m_contextRollDetected |= mustKeep;
+    TrackContextWindow(mustKeep);
+
+    if (mustKeep == false)
+    {
+        m_stats.dwordsEliminated += CmdUtil::ContextRegRmwSizeDwords;
+    }
 
     return mustKeep;
 }
@@ -215,6 +252,7 @@ uint32* Pm4Optimizer::WriteOptimizedSetSeqContextRegs(
 
     uint32* pNewCmdSpace = OptimizePm4SetReg(setData, pData, pCmdSpace, m_cntxRegs);
     (*pContextRollDetected) |= ((pNewCmdSpace > pCmdSpace) != 0);
+    TrackContextWindow(pNewCmdSpace > pCmdSpace);
     return pNewCmdSpace;
 }
 
@@ -282,11 +320,7 @@ bool Pm4Optimizer::OptimizePm4Commands(
                                            pOptCmdCur,
                                            &m_cntxRegs[0]);
             m_contextRollDetected |= ((pOptCmdCur > pPreOptCmdCur) != 0);
-        }
-        else if (opcode == IT_SET_CONTEXT_REG_INDIRECT)
-        {
-            HandlePm4SetContextRegIndirect(reinterpret_cast<const PM4_PFP_SET_CONTEXT_REG&>(*pOrigCmdCur));
-            m_contextRollDetected = true;
+            TrackContextWindow(pOptCmdCur > pPreOptCmdCur);
         }
         else if ((opcode == IT_SET_SH_REG) || (opcode == IT_SET_SH_REG_INDEX))
         {
@@ -296,6 +330,12 @@ bool Pm4Optimizer::OptimizePm4Commands(
                                            pOptCmdCur,
                                            &m_shRegs[0]);
         }
+        else if (opcode == IT_SET_CONTEXT_REG_INDIRECT)
+        {
+            HandlePm4SetContextRegIndirect(reinterpret_cast<const PM4_PFP_SET_CONTEXT_REG&>(*pOrigCmdCur));
+            m_contextRollDetected = true;
+            TrackContextWindow(true);
+        }
         else if (opcode == IT_SET_SH_REG_OFFSET)
         {
             HandlePm4SetShRegOffset(reinterpret_cast<const PM4PFP_SET_SH_REG_OFFSET&>(*pOrigCmdCur));
@@ -304,12 +344,14 @@ bool Pm4Optimizer::OptimizePm4Commands(
         {
             HandlePm4LoadReg(reinterpret_cast<const PM4_PFP_LOAD_CONTEXT_REG&>(*pOrigCmdCur), &m_cntxRegs[0]);
             m_contextRollDetected = true;
+            TrackContextWindow(true);
         }
         else if (opcode == IT_LOAD_CONTEXT_REG_INDEX)
         {
             HandlePm4LoadRegIndex(reinterpret_cast<const PM4_PFP_LOAD_CONTEXT_REG_INDEX&>(*pOrigCmdCur),
                                   &m_cntxRegs[0]);
             m_contextRollDetected = true;
+            TrackContextWindow(true);
         }
         else if (opcode == IT_LOAD_SH_REG)
         {
@@ -374,6 +416,23 @@ bool Pm4Optimizer::OptimizePm4Commands(
             Reset();
         }
 
+        // A draw consumes the current context, so it closes the window of context register writes which precede it.
+        switch (opcode)
+        {
+        case IT_DRAW_INDIRECT:
+        case IT_DRAW_INDEX_INDIRECT:
+        case IT_DRAW_INDEX_2:
+        case IT_DRAW_INDIRECT_MULTI:
+        case IT_DRAW_INDEX_AUTO:
+        case IT_DRAW_INDEX_MULTI_AUTO:
+        case IT_DRAW_INDEX_OFFSET_2:
+        case IT_DRAW_INDEX_INDIRECT_MULTI:
+            EndContextWindow();
+            break;
+        default:
+            break;
+        }
+
         if (optimized == false)
         {
             // No optimization for this packet. Just copy it.
@@ -412,6 +471,7 @@ uint32* Pm4Optimizer::OptimizePm4SetReg(
     const uint32 numRegs   = setData.header.count;
     const uint32 regOffset = setData.bitfields2.reg_offset;
     RegState*    pRegState = pRegStateBase + regOffset;
+    uint32*const pDstStart = pDstCmd;
 
     // Determine which of the registers written by this set command can't be skipped because they must always be set or
     // are taking on a new value.
@@ -497,6 +557,10 @@ uint32* Pm4Optimizer::OptimizePm4SetReg(
         while (foundNewIdx);
     }
 
+    const uint32 dwordsWritten = static_cast<uint32>(pDstCmd - pDstStart);
+
+    m_stats.dwordsEliminated += (Util::NumBytesToNumDwords(sizeof(SetDataPacket)) + numRegs) - dwordsWritten;
+
     return pDstCmd;
 }
 
@@ -47,6 +47,14 @@ struct RegState
     uint32 value;
 };
 
+// Statistics gathered by a Pm4Optimizer over its lifetime. They are not cleared by Pm4Optimizer::Reset().
+struct Pm4OptimizerStats
+{
+    uint64 dwordsEliminated;       // Command DWORDs which were skipped.
+    uint64 contextRollsEliminated; // Draws whose preceding context register writes were all skipped. Each of these
+                                   // would otherwise have caused a context roll.
+};
+
 // =====================================================================================================================
 // Utility class which provides routines to optimize PM4 command streams. Currently it only optimizes SH register writes
 // and context register writes.
@@ -64,7 +72,9 @@ public:
     bool MustKeepContextRegRmw(uint32 regAddr, uint32 regMask, uint32 regData);
 
     bool GetContextRollState() const { return m_contextRollDetected; }
-    void ResetContextRollState() { m_contextRollDetected = false; }
+    void ResetContextRollState() { EndContextWindow(); m_contextRollDetected = false; }
+
+    const Pm4OptimizerStats& GetStats() const { return m_stats; }
 
     // These functions take a fully built packet header and the corresponding register data and will write the
     // optimized version into pCmdSpace.
@@ -96,6 +106,11 @@ private:
     template <typename SetDataPacket>
     uint32* OptimizePm4SetReg(SetDataPacket setData, const uint32* pRegData, uint32* pDstCmd, RegState* pRegStateBase);
 
+    // Context roll accounting: a context roll is avoided when every context register write since the previous draw was
+    // skipped, so we track whether any were kept or skipped and settle the count when the next draw is seen.
+    void TrackContextWindow(bool kept) { m_cntxWindowKept |= kept; m_cntxWindowSkipped |= (kept == false); }
+    void EndContextWindow();
+
     template <typename LoadDataPacket>
     void HandlePm4LoadReg(const LoadDataPacket& loadData, RegState* pRegStateBase);
 
@@ -119,6 +134,10 @@ private:
     RegState m_cntxRegs[CntxRegUsedRangeSize];
     RegState m_shRegs[ShRegUsedRangeSize];
     bool     m_contextRollDetected;
+    bool     m_cntxWindowKept;    // A context register write was kept since the last draw.
+    bool     m_cntxWindowSkipped; // A context register write was skipped since the last draw.
+
+    Pm4OptimizerStats m_stats;
 };
 
 } // Gfx9
@@ -241,6 +241,8 @@ UniversalCmdBuffer::UniversalCmdBuffer(
     m_pSignatureCs(&NullCsSignature),
     m_pSignatureGfx(&NullGfxSignature),
     m_pipelineCtxPm4Hash(0),
+    m_stateImagesWritten(0),
+    m_stateImagesSkipped(0),
     m_pfnValidateUserDataGfx(nullptr),
     m_pfnValidateUserDataGfxPipelineSwitch(nullptr),
     m_workaroundState(&device, createInfo.flags.nested, m_state),
@@ -273,6 +275,7 @@ UniversalCmdBuffer::UniversalCmdBuffer(
     memset(&m_currentBinSize,  0, sizeof(m_currentBinSize));
 
     memset(&m_pipelinePsHash, 0, sizeof(m_pipelinePsHash));
+    memset(&m_writtenStateIds, 0, sizeof(m_writtenStateIds));
     m_pipelineFlags.u32All = 0;
 
     // Setup default engine support - Universal Cmd Buffer supports Graphics, Compute and CPDMA.
@@ -294,6 +297,7 @@ UniversalCmdBuffer::UniversalCmdBuffer(
     m_cachedSettings.disableWdLoadBalancing     = (settings.wdLoadBalancingMode == Gfx9WdLoadBalancingDisabled);
     m_cachedSettings.ignoreCsBorderColorPalette = settings.disableBorderColorPaletteBinds;
     m_cachedSettings.blendOptimizationsEnable   = settings.blendOptimizationsEnable;
+    m_cachedSettings.deferStateObjectBinds      = settings.deferStateObjectBinds;
     m_cachedSettings.outOfOrderPrimsEnable      = static_cast<uint32>(settings.enableOutOfOrderPrimitives);
     m_cachedSettings.scissorChangeWa            = settings.waMiscScissorRegisterChange;
     m_cachedSettings.checkDfsmEqaaWa =
@@ -563,6 +567,10 @@ void UniversalCmdBuffer::ResetState()
     m_pipelinePsHash.upper = 0;
     m_pipelineFlags.u32All = 0;
 
+    memset(&m_writtenStateIds, 0, sizeof(m_writtenStateIds));
+    m_stateImagesWritten = 0;
+    m_stateImagesSkipped = 0;
+
     ResetUserDataTable(&m_spillTable.stateCs);
     ResetUserDataTable(&m_spillTable.stateGfx);
     ResetUserDataTable(&m_vbTable.state);
@@ -874,7 +882,8 @@ void UniversalCmdBuffer::CmdBindMsaaState(
 {
     const MsaaState*const pNewState = static_cast<const MsaaState*>(pMsaaState);
 
-    if (pNewState != nullptr)
+    // When binds are deferred, the state object's image is written by the next draw if it isn't already programmed.
+    if ((pNewState != nullptr) && (m_cachedSettings.deferStateObjectBinds == 0))
     {
         uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
         pDeCmdSpace = pNewState->WriteCommands(&m_deCmdStream, pDeCmdSpace);
@@ -891,7 +900,8 @@ void UniversalCmdBuffer::CmdBindColorBlendState(
 {
     const ColorBlendState*const pNewState = static_cast<const ColorBlendState*>(pColorBlendState);
 
-    if (pNewState != nullptr)
+    // When binds are deferred, the state object's image is written by the next draw if it isn't already programmed.
+    if ((pNewState != nullptr) && (m_cachedSettings.deferStateObjectBinds == 0))
     {
         uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
         pDeCmdSpace = pNewState->WriteCommands(&m_deCmdStream, pDeCmdSpace);
@@ -908,7 +918,8 @@ void UniversalCmdBuffer::CmdBindDepthStencilState(
 {
     const DepthStencilState*const pNewState = static_cast<const DepthStencilState*>(pDepthStencilState);
 
-    if (pNewState != nullptr)
+    // When binds are deferred, the state object's image is written by the next draw if it isn't already programmed.
+    if ((pNewState != nullptr) && (m_cachedSettings.deferStateObjectBinds == 0))
     {
         uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
         pDeCmdSpace = pNewState->WriteCommands(&m_deCmdStream, pDeCmdSpace);
@@ -2368,6 +2379,272 @@ void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndexedIndirectMulti(
     pThis->m_state.flags.containsDrawIndirect = 1;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+// =====================================================================================================================
+// Converts the arguments of one non-indexed draw of a CmdDrawMulti() batch into draw-time validation info.
+static ValidateDrawInfo GetDrawMultiInfo(
+    const DrawIndirectArgs& args)
+{
+    ValidateDrawInfo drawInfo;
+    drawInfo.vtxIdxCount   = args.vertexCount;
+    drawInfo.instanceCount = args.instanceCount;
+    drawInfo.firstVertex   = args.firstVertex;
+    drawInfo.firstInstance = args.firstInstance;
+    drawInfo.firstIndex    = 0;
+    drawInfo.useOpaque     = false;
+
+    return drawInfo;
+}
+
+// =====================================================================================================================
+// Converts the arguments of one indexed draw of a CmdDrawIndexedMulti() batch into draw-time validation info.
+static ValidateDrawInfo GetDrawMultiInfo(
+    const DrawIndexedIndirectArgs& args)
+{
+    ValidateDrawInfo drawInfo;
+    drawInfo.vtxIdxCount   = args.indexCount;
+    drawInfo.instanceCount = args.instanceCount;
+    drawInfo.firstVertex   = args.vertexOffset;
+    drawInfo.firstInstance = args.firstInstance;
+    drawInfo.firstIndex    = args.firstIndex;
+    drawInfo.useOpaque     = false;
+
+    return drawInfo;
+}
+
+// =====================================================================================================================
+// Returns true if the bound graphics pipeline reads the given user-data entry from the spill table.
+bool UniversalCmdBuffer::IsGfxUserDataEntrySpilled(
+    uint32 entry
+    ) const
+{
+    const auto*const pPipeline = static_cast<const GraphicsPipeline*>(m_graphicsState.pipelineState.pPipeline);
+
+    // If we're about to launch a draw we better have a pipeline bound.
+    PAL_ASSERT(pPipeline != nullptr);
+
+    const GraphicsPipelineSignature& signature = pPipeline->Signature();
+
+    return ((entry >= signature.spillThreshold) && (entry < signature.userDataLimit));
+}
+
+// =====================================================================================================================
+// Issues a batch of non-indexed draws, validating the bound state only once for the whole batch.
+void PAL_STDCALL UniversalCmdBuffer::CmdDrawMulti(
+    ICmdBuffer*             pCmdBuffer,
+    uint32                  drawCount,
+    const DrawIndirectArgs* pDrawArgs,
+    uint32                  userDataEntry,
+    const uint32*           pUserDataValues)
+{
+    auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
+
+    PAL_ASSERT((drawCount == 0) || (pDrawArgs != nullptr));
+
+    if ((pUserDataValues != nullptr) && pThis->IsGfxUserDataEntrySpilled(userDataEntry))
+    {
+        // A spilled entry can only be changed by re-uploading the spill table, which needs full validation per draw.
+        CmdDrawMultiSequential(pCmdBuffer, drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+    }
+    else if (drawCount > 0)
+    {
+        if (pThis->m_deCmdStream.Pm4ImmediateOptimizerEnabled())
+        {
+            pThis->DrawMulti<false, true>(drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+        }
+        else
+        {
+            pThis->DrawMulti<false, false>(drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+        }
+
+        // SEE: CmdDraw() for more details about why we do this.
+        pThis->m_drawTimeHwState.dirty.indexedIndexType = 1;
+    }
+}
+
+// =====================================================================================================================
+// Issues a batch of indexed draws, validating the bound state only once for the whole batch.
+void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndexedMulti(
+    ICmdBuffer*                    pCmdBuffer,
+    uint32                         drawCount,
+    const DrawIndexedIndirectArgs* pDrawArgs,
+    uint32                         userDataEntry,
+    const uint32*                  pUserDataValues)
+{
+    auto* pThis = static_cast<UniversalCmdBuffer*>(pCmdBuffer);
+
+    PAL_ASSERT((drawCount == 0) || (pDrawArgs != nullptr));
+
+    if ((pUserDataValues != nullptr) && pThis->IsGfxUserDataEntrySpilled(userDataEntry))
+    {
+        // A spilled entry can only be changed by re-uploading the spill table, which needs full validation per draw.
+        CmdDrawIndexedMultiSequential(pCmdBuffer, drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+    }
+    else if (drawCount > 0)
+    {
+        if (pThis->m_deCmdStream.Pm4ImmediateOptimizerEnabled())
+        {
+            pThis->DrawMulti<true, true>(drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+        }
+        else
+        {
+            pThis->DrawMulti<true, false>(drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Common implementation of CmdDrawMulti() and CmdDrawIndexedMulti().  The first draw of the batch goes through the full
+// draw-time validation.  Nothing which validation depends on can change between the draws of a batch, except for the
+// per-draw arguments and the per-draw user-data entry, so every later draw only writes the draw-time registers which
+// track its arguments, the user-SGPRs the entry is mapped to and the draw packet itself.
+//
+// This is only installed when view instancing, NGG fast launch, SQTT draw markers and the WD load balancing workaround
+// are all disabled, since each of those needs per-draw work beyond the above.
+template <bool indexed, bool pm4OptImmediate, typename DrawArgs>
+void UniversalCmdBuffer::DrawMulti(
+    uint32          drawCount,
+    const DrawArgs* pDrawArgs,
+    uint32          userDataEntry,
+    const uint32*   pUserDataValues)
+{
+    if (pUserDataValues != nullptr)
+    {
+        CmdSetUserData(PipelineBindPoint::Graphics, userDataEntry, 1, &pUserDataValues[0]);
+    }
+
+    ValidateDrawInfo drawInfo = GetDrawMultiInfo(pDrawArgs[0]);
+    ValidateDraw<indexed, false, pm4OptImmediate>(drawInfo);
+
+    // Find every user-SGPR which the per-draw entry is mapped to.  This has to wait until after validation since
+    // the validated pipeline's signature is only active from then on.
+    constexpr uint32 MaxUserSgprsPerStage = (NumUserDataRegisters - FastUserDataStartReg);
+
+    uint16 userDataRegs[NumHwShaderStagesGfx * MaxUserSgprsPerStage];
+    uint32 numUserDataRegs = 0;
+
+    if (pUserDataValues != nullptr)
+    {
+        for (uint32 stage = 0; stage < NumHwShaderStagesGfx; ++stage)
+        {
+            const UserDataEntryMap& entryMap = m_pSignatureGfx->stage[stage];
+
+            for (uint32 sgpr = 0; sgpr < entryMap.userSgprCount; ++sgpr)
+            {
+                if (entryMap.mappedEntry[sgpr] == userDataEntry)
+                {
+                    userDataRegs[numUserDataRegs++] = static_cast<uint16>(entryMap.firstUserSgprRegAddr + sgpr);
+                }
+            }
+        }
+    }
+
+    // Worst case for everything a draw after the first one can write: the vertex and instance offsets, the
+    // NUM_INSTANCES packet, the per-draw user-data entry and the draw packet.  The last draw is also followed by
+    // the DE counter increment.
+    const uint32 maxDwordsPerDraw = ((2 + numUserDataRegs) * (CmdUtil::ShRegSizeDwords + 1)) +
+                                    (sizeof(PM4_PFP_NUM_INSTANCES) / sizeof(uint32))          +
+                                    (sizeof(PM4_PFP_DRAW_INDEX_2) / sizeof(uint32))           +
+                                    (sizeof(PM4_ME_INCREMENT_DE_COUNTER) / sizeof(uint32));
+    PAL_ASSERT(maxDwordsPerDraw <= m_deCmdStream.ReserveLimit());
+
+    // Direct indexed draws don't need the IB base and size to be validated, see ValidateDrawTimeHwState().
+    const bool    useIndexOffset = indexed && IsNested() && (m_graphicsState.iaState.indexAddr == 0);
+    const uint32  indexSize      = 1 << static_cast<uint32>(m_graphicsState.iaState.indexType);
+    const gpusize indexAddr      = m_graphicsState.iaState.indexAddr;
+    const uint32  indexCount     = m_graphicsState.iaState.indexCount;
+
+    // These can't change after the first draw, so re-validating them below only compares against the cached state.
+    const regPA_SC_MODE_CNTL_1          paScModeCntl1         = m_drawTimeHwState.paScModeCntl1;
+    const regDB_COUNT_CONTROL           dbCountControl        = m_drawTimeHwState.dbCountControl;
+    const regVGT_MULTI_PRIM_IB_RESET_EN vgtMultiPrimIbResetEn = m_drawTimeHwState.vgtMultiPrimIbResetEn;
+
+    uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
+    uint32* pDeCmdLimit = pDeCmdSpace + m_deCmdStream.ReserveLimit();
+
+    pDeCmdSpace = WaitOnCeCounter(pDeCmdSpace);
+
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        if (i > 0)
+        {
+            if (static_cast<uint32>(pDeCmdLimit - pDeCmdSpace) < maxDwordsPerDraw)
+            {
+                m_deCmdStream.CommitCommands(pDeCmdSpace);
+                pDeCmdSpace = m_deCmdStream.ReserveCommands();
+                pDeCmdLimit = pDeCmdSpace + m_deCmdStream.ReserveLimit();
+            }
+
+            drawInfo    = GetDrawMultiInfo(pDrawArgs[i]);
+            pDeCmdSpace = ValidateDrawTimeHwState<indexed, false, false, false, pm4OptImmediate>(
+                              paScModeCntl1,
+                              dbCountControl,
+                              vgtMultiPrimIbResetEn,
+                              drawInfo,
+                              pDeCmdSpace);
+
+            if ((pUserDataValues != nullptr) &&
+                (m_graphicsState.gfxUserDataEntries.entries[userDataEntry] != pUserDataValues[i]))
+            {
+                // The user-SGPRs are written right away, so the entry doesn't need to be marked dirty.
+                m_graphicsState.gfxUserDataEntries.entries[userDataEntry] = pUserDataValues[i];
+
+                for (uint32 reg = 0; reg < numUserDataRegs; ++reg)
+                {
+                    pDeCmdSpace = m_deCmdStream.WriteSetOneShReg<ShaderGraphics, pm4OptImmediate>(
+                                      userDataRegs[reg],
+                                      pUserDataValues[i],
+                                      pDeCmdSpace);
+
+                    if (IsPatchableUserData(PipelineBindPoint::Graphics, userDataEntry))
+                    {
+                        AddUserDataPatchEntry(PipelineBindPoint::Graphics,
+                                              userDataEntry,
+                                              m_deCmdStream.GetLastChunk(),
+                                              (pDeCmdSpace - 1));
+                    }
+                }
+            }
+        }
+
+        if (indexed == false)
+        {
+            pDeCmdSpace += m_cmdUtil.BuildDrawIndexAuto(drawInfo.vtxIdxCount,
+                                                        false,
+                                                        PacketPredicate(),
+                                                        pDeCmdSpace);
+        }
+        else
+        {
+            PAL_ASSERT(drawInfo.firstIndex <= indexCount);
+
+            const uint32 validIndexCount = indexCount - drawInfo.firstIndex;
+
+            if (useIndexOffset)
+            {
+                pDeCmdSpace += m_cmdUtil.BuildDrawIndexOffset2(drawInfo.vtxIdxCount,
+                                                               validIndexCount,
+                                                               drawInfo.firstIndex,
+                                                               PacketPredicate(),
+                                                               pDeCmdSpace);
+            }
+            else
+            {
+                pDeCmdSpace += m_cmdUtil.BuildDrawIndex2(drawInfo.vtxIdxCount,
+                                                         validIndexCount,
+                                                         indexAddr + (indexSize * drawInfo.firstIndex),
+                                                         PacketPredicate(),
+                                                         pDeCmdSpace);
+            }
+        }
+    }
+
+    pDeCmdSpace = IncrementDeCounter(pDeCmdSpace);
+
+    m_deCmdStream.CommitCommands(pDeCmdSpace);
+}
+#endif
+
 // =====================================================================================================================
 // Issues a direct dispatch command. We must discard the dispatch if x, y, or z are zero. To avoid branching, we will
 // rely on the HW to discard the dispatch for us.
@@ -3317,30 +3594,22 @@ uint8 UniversalCmdBuffer::FixupUserSgprsOnPipelineSwitch(
     if (TessEnabled && (m_pSignatureGfx->userDataHash[HsStageId] != pPrevSignature->userDataHash[HsStageId]))
     {
         changedStageMask |= (1 << HsStageId);
-        pDeCmdSpace = m_deCmdStream.WriteUserDataEntriesToSgprsGfx<true>(m_pSignatureGfx->stage[HsStageId],
-                                                                         m_graphicsState.gfxUserDataEntries,
-                                                                         pDeCmdSpace);
+        pDeCmdSpace = WriteUserDataEntriesToSgprsGfx<true>(m_pSignatureGfx->stage[HsStageId], pDeCmdSpace);
     }
     if (GsEnabled && (m_pSignatureGfx->userDataHash[GsStageId] != pPrevSignature->userDataHash[GsStageId]))
     {
         changedStageMask |= (1 << GsStageId);
-        pDeCmdSpace = m_deCmdStream.WriteUserDataEntriesToSgprsGfx<true>(m_pSignatureGfx->stage[GsStageId],
-                                                                         m_graphicsState.gfxUserDataEntries,
-                                                                         pDeCmdSpace);
+        pDeCmdSpace = WriteUserDataEntriesToSgprsGfx<true>(m_pSignatureGfx->stage[GsStageId], pDeCmdSpace);
     }
     if (VsEnabled && (m_pSignatureGfx->userDataHash[VsStageId] != pPrevSignature->userDataHash[VsStageId]))
     {
         changedStageMask |= (1 << VsStageId);
-        pDeCmdSpace = m_deCmdStream.WriteUserDataEntriesToSgprsGfx<true>(m_pSignatureGfx->stage[VsStageId],
-                                                                         m_graphicsState.gfxUserDataEntries,
-                                                                         pDeCmdSpace);
+        pDeCmdSpace = WriteUserDataEntriesToSgprsGfx<true>(m_pSignatureGfx->stage[VsStageId], pDeCmdSpace);
     }
     if (m_pSignatureGfx->userDataHash[PsStageId] != pPrevSignature->userDataHash[PsStageId])
     {
         changedStageMask |= (1 << PsStageId);
-        pDeCmdSpace = m_deCmdStream.WriteUserDataEntriesToSgprsGfx<true>(m_pSignatureGfx->stage[PsStageId],
-                                                                         m_graphicsState.gfxUserDataEntries,
-                                                                         pDeCmdSpace);
+        pDeCmdSpace = WriteUserDataEntriesToSgprsGfx<true>(m_pSignatureGfx->stage[PsStageId], pDeCmdSpace);
     }
 
     (*ppDeCmdSpace) = pDeCmdSpace;
@@ -3489,33 +3758,82 @@ uint32* UniversalCmdBuffer::WriteDirtyUserDataEntriesToSgprsGfx(
     {
         if (TessEnabled && (dirtyStageMask & (1 << HsStageId)))
         {
-            pDeCmdSpace = m_deCmdStream.WriteUserDataEntriesToSgprsGfx<false>(m_pSignatureGfx->stage[HsStageId],
-                                                                              m_graphicsState.gfxUserDataEntries,
-                                                                              pDeCmdSpace);
+            pDeCmdSpace = WriteUserDataEntriesToSgprsGfx<false>(m_pSignatureGfx->stage[HsStageId], pDeCmdSpace);
         }
         if (GsEnabled && (dirtyStageMask & (1 << GsStageId)))
         {
-            pDeCmdSpace = m_deCmdStream.WriteUserDataEntriesToSgprsGfx<false>(m_pSignatureGfx->stage[GsStageId],
-                                                                              m_graphicsState.gfxUserDataEntries,
-                                                                              pDeCmdSpace);
+            pDeCmdSpace = WriteUserDataEntriesToSgprsGfx<false>(m_pSignatureGfx->stage[GsStageId], pDeCmdSpace);
         }
         if (VsEnabled && (dirtyStageMask & (1 << VsStageId)))
         {
-            pDeCmdSpace = m_deCmdStream.WriteUserDataEntriesToSgprsGfx<false>(m_pSignatureGfx->stage[VsStageId],
-                                                                              m_graphicsState.gfxUserDataEntries,
-                                                                              pDeCmdSpace);
+            pDeCmdSpace = WriteUserDataEntriesToSgprsGfx<false>(m_pSignatureGfx->stage[VsStageId], pDeCmdSpace);
         }
         if (dirtyStageMask & (1 << PsStageId))
         {
-            pDeCmdSpace = m_deCmdStream.WriteUserDataEntriesToSgprsGfx<false>(m_pSignatureGfx->stage[PsStageId],
-                                                                              m_graphicsState.gfxUserDataEntries,
-                                                                              pDeCmdSpace);
+            pDeCmdSpace = WriteUserDataEntriesToSgprsGfx<false>(m_pSignatureGfx->stage[PsStageId], pDeCmdSpace);
         }
     } // if any stages still need dirty state processing
 
     return pDeCmdSpace;
 }
 
+// =====================================================================================================================
+// Writes the user-SGPR's mapped to user-data entries for a graphics shader stage, recording a patch point for every
+// patchable entry which was written.  Returns the next unused DWORD in pDeCmdSpace.
+template <bool IgnoreDirtyFlags>
+uint32* UniversalCmdBuffer::WriteUserDataEntriesToSgprsGfx(
+    const UserDataEntryMap& entryMap,
+    uint32*                 pDeCmdSpace)
+{
+    const uint32*const pPackets = pDeCmdSpace;
+
+    pDeCmdSpace = m_deCmdStream.WriteUserDataEntriesToSgprsGfx<IgnoreDirtyFlags>(entryMap,
+                                                                                 m_graphicsState.gfxUserDataEntries,
+                                                                                 pDeCmdSpace);
+
+    if (IsUserDataPatchingEnabled())
+    {
+        AddUserSgprPatchEntries(entryMap, pPackets, pDeCmdSpace);
+    }
+
+    return pDeCmdSpace;
+}
+
+// =====================================================================================================================
+// Walks the SET_SH_REG packets which were just written for a graphics stage's user-SGPR's and records a patch point for
+// each value which belongs to a patchable user-data entry.  The PM4 optimizer is disabled when patching, so the
+// packets were written exactly as built.
+void UniversalCmdBuffer::AddUserSgprPatchEntries(
+    const UserDataEntryMap& entryMap,
+    const uint32*           pPackets,
+    const uint32*           pPacketsEnd)
+{
+    CmdStreamChunk*const pChunk = m_deCmdStream.GetLastChunk();
+
+    while (pPackets < pPacketsEnd)
+    {
+        const auto*const pSetShReg  = reinterpret_cast<const PM4_ME_SET_SH_REG*>(pPackets);
+        const uint32     packetSize = (pSetShReg->header.count + 2);
+        const uint32     firstSgpr  =
+            (PERSISTENT_SPACE_START + pSetShReg->bitfields2.reg_offset) - entryMap.firstUserSgprRegAddr;
+
+        for (uint32 sgpr = firstSgpr; sgpr < (firstSgpr + packetSize - CmdUtil::ShRegSizeDwords); ++sgpr)
+        {
+            const uint32 entry = entryMap.mappedEntry[sgpr];
+
+            if (IsPatchableUserData(PipelineBindPoint::Graphics, entry))
+            {
+                AddUserDataPatchEntry(PipelineBindPoint::Graphics,
+                                      entry,
+                                      pChunk,
+                                      (pPackets + CmdUtil::ShRegSizeDwords + (sgpr - firstSgpr)));
+            }
+        }
+
+        pPackets += packetSize;
+    }
+}
+
 // =====================================================================================================================
 // Helper function responsible for writing all dirty compute user-data entries to their respective user-SGPR's. Does not
 // do anything with entries which are mapped to the spill table.
@@ -3550,11 +3868,27 @@ uint32* UniversalCmdBuffer::WriteDirtyUserDataEntriesToUserSgprsCs(
         if (entryCount > 0)
         {
             const uint16 lastEntry = (firstEntry + entryCount - 1);
+            uint32*const pValues   = (pDeCmdSpace + CmdUtil::ShRegSizeDwords);
             pDeCmdSpace = m_deCmdStream.WriteSetSeqShRegs((baseUserSgpr + firstEntry),
                                                           (baseUserSgpr + lastEntry),
                                                           ShaderCompute,
                                                           &m_computeState.csUserDataEntries.entries[firstEntry],
                                                           pDeCmdSpace);
+
+            if (IsUserDataPatchingEnabled())
+            {
+                // The PM4 optimizer is disabled when patching, so the values directly follow the packet header.
+                for (uint16 entry = firstEntry; entry <= lastEntry; ++entry)
+                {
+                    if (IsPatchableUserData(PipelineBindPoint::Compute, entry))
+                    {
+                        AddUserDataPatchEntry(PipelineBindPoint::Compute,
+                                              entry,
+                                              m_deCmdStream.GetLastChunk(),
+                                              (pValues + (entry - firstEntry)));
+                    }
+                }
+            }
         }
     } // for each entry
 
@@ -3872,6 +4206,14 @@ uint32* UniversalCmdBuffer::ValidateGraphicsUserDataCpu(
                                    (userDataLimit - spillThreshold),
                                    spillThreshold,
                                    &m_graphicsState.gfxUserDataEntries.entries[0]);
+
+            if (IsUserDataPatchingEnabled())
+            {
+                AddUserDataTablePatchEntries(PipelineBindPoint::Graphics,
+                                             m_spillTable.stateGfx,
+                                             spillThreshold,
+                                             (userDataLimit - spillThreshold));
+            }
         }
 
         // NOTE: If the pipeline is changing, we may need to re-write the spill table address to any shader stage, even
@@ -4060,6 +4402,14 @@ uint32* UniversalCmdBuffer::ValidateComputeUserDataCpu(
                                    spillThreshold,
                                    &m_computeState.csUserDataEntries.entries[0]);
 
+            if (IsUserDataPatchingEnabled())
+            {
+                AddUserDataTablePatchEntries(PipelineBindPoint::Compute,
+                                             m_spillTable.stateCs,
+                                             spillThreshold,
+                                             (userDataLimit - spillThreshold));
+            }
+
             pDeCmdSpace = m_deCmdStream.WriteSetOneShReg<ShaderCompute>(m_pSignatureCs->stage.spillTableRegAddr,
                                                                         LowPart(m_spillTable.stateCs.gpuVirtAddr),
                                                                         pDeCmdSpace);
@@ -4107,6 +4457,18 @@ template <bool indexed, bool indirect, bool pm4OptImmediate>
 void UniversalCmdBuffer::ValidateDraw(
     const ValidateDrawInfo& drawInfo)
 {
+    const auto dirtyFlags = m_graphicsState.dirtyFlags.validationBits;
+
+    if (m_cachedSettings.deferStateObjectBinds &&
+        (dirtyFlags.colorBlendState || dirtyFlags.depthStencilState || dirtyFlags.msaaState))
+    {
+        // Write the rebound state objects first, in their own reserve/commit region, so they land in the same order
+        // relative to the rest of the draw-time state as they would have if they had been written when bound.
+        uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
+        pDeCmdSpace = WriteDirtyStateObjects(pDeCmdSpace);
+        m_deCmdStream.CommitCommands(pDeCmdSpace);
+    }
+
     if (m_graphicsState.pipelineState.dirtyFlags.pipelineDirty)
     {
         uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
@@ -7004,6 +7366,10 @@ void UniversalCmdBuffer::LeakNestedCmdBufferState(
         m_funcTable.pfnCmdDrawIndexed              = cmdBuffer.m_funcTable.pfnCmdDrawIndexed;
         m_funcTable.pfnCmdDrawIndirectMulti        = cmdBuffer.m_funcTable.pfnCmdDrawIndirectMulti;
         m_funcTable.pfnCmdDrawIndexedIndirectMulti = cmdBuffer.m_funcTable.pfnCmdDrawIndexedIndirectMulti;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+        m_funcTable.pfnCmdDrawMulti                = cmdBuffer.m_funcTable.pfnCmdDrawMulti;
+        m_funcTable.pfnCmdDrawIndexedMulti         = cmdBuffer.m_funcTable.pfnCmdDrawIndexedMulti;
+#endif
 
         if (m_rbPlusPm4Img.spaceNeeded != 0)
         {
@@ -7052,12 +7418,130 @@ void UniversalCmdBuffer::LeakNestedCmdBufferState(
     m_gfxCmdBufState.cpWriteCachesDirty        = cmdBuffer.m_gfxCmdBufState.cpWriteCachesDirty;
     m_gfxCmdBufState.cpMemoryWriteL2CacheStale = cmdBuffer.m_gfxCmdBufState.cpMemoryWriteL2CacheStale;
 
+    if (m_cachedSettings.deferStateObjectBinds)
+    {
+        // The callee leaves behind whichever state object images it wrote last. Any bound state object which is not
+        // the one programmed now must be rewritten by the next draw.
+        if (cmdBuffer.m_writtenStateIds.colorBlendState != 0)
+        {
+            m_writtenStateIds.colorBlendState = cmdBuffer.m_writtenStateIds.colorBlendState;
+        }
+        if (cmdBuffer.m_writtenStateIds.depthStencilState != 0)
+        {
+            m_writtenStateIds.depthStencilState = cmdBuffer.m_writtenStateIds.depthStencilState;
+        }
+        if (cmdBuffer.m_writtenStateIds.msaaState != 0)
+        {
+            m_writtenStateIds.msaaState = cmdBuffer.m_writtenStateIds.msaaState;
+        }
+
+        const auto*const pBlendState = static_cast<const ColorBlendState*>(m_graphicsState.pColorBlendState);
+        const auto*const pDepthState = static_cast<const DepthStencilState*>(m_graphicsState.pDepthStencilState);
+        const auto*const pMsaaState  = static_cast<const MsaaState*>(m_graphicsState.pMsaaState);
+
+        if ((pBlendState != nullptr) && (pBlendState->UniqueId() != m_writtenStateIds.colorBlendState))
+        {
+            m_graphicsState.dirtyFlags.validationBits.colorBlendState = 1;
+        }
+        if ((pDepthState != nullptr) && (pDepthState->UniqueId() != m_writtenStateIds.depthStencilState))
+        {
+            m_graphicsState.dirtyFlags.validationBits.depthStencilState = 1;
+        }
+        if ((pMsaaState != nullptr) && (pMsaaState->UniqueId() != m_writtenStateIds.msaaState))
+        {
+            m_graphicsState.dirtyFlags.validationBits.msaaState = 1;
+        }
+    }
+
     // Invalidate PM4 optimizer state on post-execute since the current command buffer state does not reflect
     // state changes from the nested command buffer. We will need to resolve the nested PM4 state onto the
     // current command buffer for this to work correctly.
     m_deCmdStream.NotifyNestedCmdBufferExecute();
 }
 
+// =====================================================================================================================
+// Writes the PM4 images of the color blend, depth stencil and MSAA state objects which were rebound since the last
+// draw, skipping any object whose image is still programmed. The images are gathered into one block so that they take
+// a single pass through the PM4 optimizer. Returns the next unused DWORD in pDeCmdSpace.
+uint32* UniversalCmdBuffer::WriteDirtyStateObjects(
+    uint32* pDeCmdSpace)
+{
+    constexpr uint32 MaxImageDwords =
+        (sizeof(BlendStatePm4Img) + sizeof(DepthStencilStatePm4Img) + sizeof(MsaaStatePm4Img)) / sizeof(uint32);
+
+    const auto*const pBlendState = static_cast<const ColorBlendState*>(m_graphicsState.pColorBlendState);
+    const auto*const pDepthState = static_cast<const DepthStencilState*>(m_graphicsState.pDepthStencilState);
+    const auto*const pMsaaState  = static_cast<const MsaaState*>(m_graphicsState.pMsaaState);
+    const auto       dirtyFlags  = m_graphicsState.dirtyFlags.validationBits;
+
+    uint32  image[MaxImageDwords];
+    uint32* pImage = &image[0];
+
+    if (dirtyFlags.colorBlendState && (pBlendState != nullptr))
+    {
+        if (pBlendState->UniqueId() != m_writtenStateIds.colorBlendState)
+        {
+            pImage = pBlendState->WriteCommands(nullptr, pImage);
+            m_writtenStateIds.colorBlendState = pBlendState->UniqueId();
+            m_stateImagesWritten++;
+        }
+        else
+        {
+            m_stateImagesSkipped++;
+        }
+    }
+
+    if (dirtyFlags.depthStencilState && (pDepthState != nullptr))
+    {
+        if (pDepthState->UniqueId() != m_writtenStateIds.depthStencilState)
+        {
+            pImage = pDepthState->WriteCommands(nullptr, pImage);
+            m_writtenStateIds.depthStencilState = pDepthState->UniqueId();
+            m_stateImagesWritten++;
+        }
+        else
+        {
+            m_stateImagesSkipped++;
+        }
+    }
+
+    if (dirtyFlags.msaaState && (pMsaaState != nullptr))
+    {
+        if (pMsaaState->UniqueId() != m_writtenStateIds.msaaState)
+        {
+            pImage = pMsaaState->WriteCommands(nullptr, pImage);
+            m_writtenStateIds.msaaState = pMsaaState->UniqueId();
+            m_stateImagesWritten++;
+        }
+        else
+        {
+            m_stateImagesSkipped++;
+        }
+    }
+
+    const size_t imageDwords = static_cast<size_t>(pImage - &image[0]);
+    PAL_ASSERT(imageDwords <= MaxImageDwords);
+
+    if (imageDwords > 0)
+    {
+        pDeCmdSpace = m_deCmdStream.WritePm4Image(imageDwords, &image[0], pDeCmdSpace);
+    }
+
+    return pDeCmdSpace;
+}
+
+// =====================================================================================================================
+// Adds the draw-time state object statistics to the statistics gathered from the command streams.
+void UniversalCmdBuffer::GetRecordingStats(
+    CmdBufferRecordingStats* pStats
+    ) const
+{
+    Pal::UniversalCmdBuffer::GetRecordingStats(pStats);
+
+    pStats->stateObjectImagesWritten += m_stateImagesWritten;
+    pStats->stateObjectImagesSkipped += m_stateImagesSkipped;
+}
+
 // =====================================================================================================================
 // Helper method responsible for checking if any of the stream-out buffer strides need to be updated on a pipeline
 // switch.
@@ -7206,6 +7690,14 @@ void UniversalCmdBuffer::CmdExecuteNestedCmdBuffers(
     uint32            cmdBufferCount,
     ICmdBuffer*const* ppCmdBuffers)
 {
+    if (m_cachedSettings.deferStateObjectBinds)
+    {
+        // The callees expect any state objects they inherit from this command buffer to be programmed already.
+        uint32* pDeCmdSpace = m_deCmdStream.ReserveCommands();
+        pDeCmdSpace = WriteDirtyStateObjects(pDeCmdSpace);
+        m_deCmdStream.CommitCommands(pDeCmdSpace);
+    }
+
     for (uint32 buf = 0; buf < cmdBufferCount; ++buf)
     {
         auto*const pCallee = static_cast<Gfx9::UniversalCmdBuffer*>(ppCmdBuffers[buf]);
@@ -7234,6 +7726,10 @@ void UniversalCmdBuffer::CmdExecuteNestedCmdBuffers(
         // state back to the caller.
         LeakNestedCmdBufferState(*pCallee);
     }
+
+    // Chained callees jump directly from one to the next; the last of them still has to return here.
+    m_deCmdStream.EndCallChain();
+    m_ceCmdStream.EndCallChain();
 }
 
 // =====================================================================================================================
@@ -7401,6 +7897,24 @@ void UniversalCmdBuffer::SwitchDrawFunctions(
     bool viewInstancingEnable,
     bool nggFastLuanch)
 {
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    // The batched draws skip validation after their first draw, so they have to fall back to one draw at a time if
+    // any of the per-draw work they don't replicate is needed.
+    if (viewInstancingEnable                  ||
+        nggFastLuanch                         ||
+        m_cachedSettings.issueSqttMarkerEvent ||
+        m_cachedSettings.disableWdLoadBalancing)
+    {
+        m_funcTable.pfnCmdDrawMulti        = CmdDrawMultiSequential;
+        m_funcTable.pfnCmdDrawIndexedMulti = CmdDrawIndexedMultiSequential;
+    }
+    else
+    {
+        m_funcTable.pfnCmdDrawMulti        = CmdDrawMulti;
+        m_funcTable.pfnCmdDrawIndexedMulti = CmdDrawIndexedMulti;
+    }
+#endif
+
     if (viewInstancingEnable)
     {
         if (m_cachedSettings.issueSqttMarkerEvent)
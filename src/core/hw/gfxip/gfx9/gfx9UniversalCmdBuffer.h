@@ -388,6 +388,8 @@ public:
 
     virtual Result Init(const CmdBufferInternalCreateInfo& internalInfo) override;
 
+    virtual void GetRecordingStats(CmdBufferRecordingStats* pStats) const override;
+
     virtual void CmdBindPipeline(
         const PipelineBindParams& params) override;
 
@@ -722,6 +724,8 @@ protected:
     virtual Result AddPreamble() override;
     virtual Result AddPostamble() override;
 
+    virtual bool SupportsUserDataPatching() const override { return true; }
+
     virtual void ResetState() override;
 
     virtual void WriteEventCmd(const BoundGpuMemory& boundMemObj, HwPipePoint pipePoint, uint32 data) override;
@@ -847,6 +851,30 @@ private:
         uint32            maximumCount,
         gpusize           countGpuAddr);
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    static void PAL_STDCALL CmdDrawMulti(
+        ICmdBuffer*             pCmdBuffer,
+        uint32                  drawCount,
+        const DrawIndirectArgs* pDrawArgs,
+        uint32                  userDataEntry,
+        const uint32*           pUserDataValues);
+    static void PAL_STDCALL CmdDrawIndexedMulti(
+        ICmdBuffer*                    pCmdBuffer,
+        uint32                         drawCount,
+        const DrawIndexedIndirectArgs* pDrawArgs,
+        uint32                         userDataEntry,
+        const uint32*                  pUserDataValues);
+
+    bool IsGfxUserDataEntrySpilled(uint32 entry) const;
+
+    template <bool indexed, bool pm4OptImmediate, typename DrawArgs>
+    void DrawMulti(
+        uint32          drawCount,
+        const DrawArgs* pDrawArgs,
+        uint32          userDataEntry,
+        const uint32*   pUserDataValues);
+#endif
+
     template <bool IssueSqttMarkerEvent, bool UseCpuPathForUserDataTables>
     static void PAL_STDCALL CmdDispatch(
         ICmdBuffer* pCmdBuffer,
@@ -959,6 +987,15 @@ private:
         uint8                            alreadyWrittenStageMask,
         uint32*                          pDeCmdSpace);
 
+    template <bool IgnoreDirtyFlags>
+    uint32* WriteUserDataEntriesToSgprsGfx(
+        const UserDataEntryMap& entryMap,
+        uint32*                 pDeCmdSpace);
+    void AddUserSgprPatchEntries(
+        const UserDataEntryMap& entryMap,
+        const uint32*           pPackets,
+        const uint32*           pPacketsEnd);
+
     uint32* WriteDirtyUserDataEntriesToUserSgprsCs(
         uint32* pDeCmdSpace);
 
@@ -981,6 +1018,8 @@ private:
     void LeakNestedCmdBufferState(
         const UniversalCmdBuffer& cmdBuffer);
 
+    uint32* WriteDirtyStateObjects(uint32* pDeCmdSpace);
+
     uint8 CheckStreamOutBufferStridesOnPipelineSwitch();
     uint32* UploadStreamOutBufferStridesToCeRam(
         uint8   dirtyStrideMask,
@@ -1025,6 +1064,18 @@ private:
 
     uint64      m_pipelineCtxPm4Hash;   // Hash of current pipeline's PM4 image for context registers.
     ShaderHash  m_pipelinePsHash;       // Hash of current pipeline's pixel shader program.
+
+    // Unique IDs of the state objects whose PM4 images were most recently written to the DE command stream, or zero if
+    // unknown.  Only maintained when the deferStateObjectBinds setting is enabled.
+    struct
+    {
+        uint64  colorBlendState;
+        uint64  depthStencilState;
+        uint64  msaaState;
+    } m_writtenStateIds;
+
+    uint64  m_stateImagesWritten;   // State object images written at draw-time since Begin().
+    uint64  m_stateImagesSkipped;   // Rebound state object images which were skipped because they were programmed.
     union
     {
         struct
@@ -1125,9 +1176,11 @@ private:
                                                     // shaders.
             uint32 padParamCacheSpace         :  1; // True if this command buffer should pad used param-cache space to
                                                     // reduce context rolls.
+            uint32 deferStateObjectBinds      :  1; // True if color blend, depth stencil and MSAA state objects are
+                                                    // written at draw-time instead of when they are bound.
             uint32 reserved0                  :  1;
             uint32 reserved1                  :  1;
-            uint32 reserved                   :  8;
+            uint32 reserved                   :  7;
         };
         uint32 u32All;
     } m_cachedSettings;
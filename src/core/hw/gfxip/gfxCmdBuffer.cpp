@@ -63,7 +63,8 @@ GfxCmdBuffer::GfxCmdBuffer(
     m_timestampGpuVa(0),
     m_computeStateFlags(0),
     m_spmTraceEnabled(false),
-    m_fceRefCountVec(device.GetPlatform())
+    m_fceRefCountVec(device.GetPlatform()),
+    m_userDataPatchEntries(device.GetPlatform())
 {
     PAL_ASSERT((createInfo.queueType == QueueTypeUniversal) || (createInfo.queueType == QueueTypeCompute));
 
@@ -78,6 +79,8 @@ GfxCmdBuffer::GfxCmdBuffer(
 
     m_gfxCmdBufState.u32All = 0;
 
+    memset(&m_patchableUserData[0], 0, sizeof(m_patchableUserData));
+    memset(&m_selectedUserData[0],  0, sizeof(m_selectedUserData));
 }
 
 // =====================================================================================================================
@@ -142,7 +145,38 @@ Result GfxCmdBuffer::Init(
 Result GfxCmdBuffer::Begin(
     const CmdBufferBuildInfo& info)
 {
-    const Result result = CmdBuffer::Begin(info);
+    Result result = CmdBuffer::Begin(info);
+
+    if (result == Result::Success)
+    {
+        m_userDataPatchEntries.Clear();
+        memset(&m_selectedUserData[0], 0, sizeof(m_selectedUserData));
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+        // CmdBuffer::Begin() has already cleared this flag if this command buffer can't record patch points.
+        if (IsUserDataPatchingEnabled())
+        {
+            for (uint32 idx = 0; idx < info.patchableUserDataRangeCount; ++idx)
+            {
+                const PatchableUserDataRange& range = info.pPatchableUserDataRanges[idx];
+
+                if ((range.bindPoint >= PipelineBindPoint::Count) ||
+                    ((range.firstEntry + range.entryCount) > MaxUserDataEntries))
+                {
+                    result = Result::ErrorInvalidValue;
+                    break;
+                }
+
+                for (uint32 entry = range.firstEntry; entry < (range.firstEntry + range.entryCount); ++entry)
+                {
+                    WideBitfieldSetBit(m_selectedUserData[static_cast<uint32>(range.bindPoint)], entry);
+                }
+            }
+        }
+#endif
+
+        memcpy(&m_patchableUserData[0], &m_selectedUserData[0], sizeof(m_patchableUserData));
+    }
 
     if (result == Result::Success)
     {
@@ -200,9 +234,138 @@ Result GfxCmdBuffer::Reset(
 
     ResetFastClearReferenceCounts();
 
+    // The patch points refer to chunks which are about to be returned.
+    m_userDataPatchEntries.Clear();
+
     return CmdBuffer::Reset(pCmdAllocator, returnGpuMemory);
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+// =====================================================================================================================
+// Overwrites every value recorded for the given patchable user-data entries with new values.  The command buffer's
+// commands are otherwise left exactly as they were recorded, so it can be resubmitted without being re-validated.
+Result GfxCmdBuffer::PatchUserData(
+    PipelineBindPoint bindPoint,
+    uint32            firstEntry,
+    uint32            entryCount,
+    const uint32*     pEntryValues)
+{
+    Result result = Result::Success;
+
+    if (SupportsUserDataPatching() == false)
+    {
+        result = Result::Unsupported;
+    }
+    else if (RecordState() != CmdBufferRecordState::Executable)
+    {
+        result = Result::ErrorIncompleteCommandBuffer;
+    }
+    else if (IsUserDataPatchingEnabled() == false)
+    {
+        result = Result::ErrorUnavailable;
+    }
+    else if ((bindPoint >= PipelineBindPoint::Count)               ||
+             (pEntryValues == nullptr)                             ||
+             ((firstEntry + entryCount) > MaxUserDataEntries))
+    {
+        result = Result::ErrorInvalidValue;
+    }
+    else
+    {
+        for (uint32 entry = firstEntry; entry < (firstEntry + entryCount); ++entry)
+        {
+            if (WideBitfieldIsSet(m_selectedUserData[static_cast<uint32>(bindPoint)], entry) == false)
+            {
+                result = Result::ErrorInvalidValue;
+                break;
+            }
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        const uint16 patchBindPoint = static_cast<uint16>(bindPoint);
+
+        for (auto iter = m_userDataPatchEntries.Begin(); iter.IsValid(); iter.Next())
+        {
+            const UserDataPatchEntry& patch = iter.Get();
+
+            if ((patch.bindPoint == patchBindPoint) &&
+                (patch.entry >= firstEntry)         &&
+                (patch.entry < (firstEntry + entryCount)))
+            {
+                // Recording wrote through the chunk's write address, which may be a staging buffer; once the command
+                // buffer has ended, the chunk's mapped memory is what the GPU reads.
+                patch.pChunk->GetRmwCpuAddr()[patch.chunkOffset] = pEntryValues[patch.entry - firstEntry];
+            }
+        }
+    }
+
+    return result;
+}
+#endif
+
+// =====================================================================================================================
+// Records that the DWORD at pValue, which was just written to pChunk, holds the value of a patchable user-data entry.
+void GfxCmdBuffer::AddUserDataPatchEntry(
+    PipelineBindPoint bindPoint,
+    uint32            entry,
+    CmdStreamChunk*   pChunk,
+    const uint32*     pValue)
+{
+    PAL_ASSERT(IsPatchableUserData(bindPoint, entry) && pChunk->ContainsAddress(pValue));
+    PAL_ASSERT(pChunk->CpuAddr() != nullptr);
+
+    UserDataPatchEntry patch = {};
+    patch.pChunk      = pChunk;
+    patch.chunkOffset = static_cast<uint32>(pValue - pChunk->WriteAddr());
+    patch.bindPoint   = static_cast<uint16>(bindPoint);
+    patch.entry       = static_cast<uint16>(entry);
+
+    if (m_userDataPatchEntries.PushBack(patch) != Result::Success)
+    {
+        NotifyAllocFailure();
+    }
+}
+
+// =====================================================================================================================
+// Records the patch points of a user-data table which was just uploaded to embedded data by UpdateUserDataTableCpu().
+// Entries [firstEntry, firstEntry + entryCount) of the table are checked.
+void GfxCmdBuffer::AddUserDataTablePatchEntries(
+    PipelineBindPoint         bindPoint,
+    const UserDataTableState& table,
+    uint32                    firstEntry,
+    uint32                    entryCount)
+{
+    CmdStreamChunk*const pChunk = m_embeddedData.chunkList.Back();
+
+    for (uint32 entry = firstEntry; entry < (firstEntry + entryCount); ++entry)
+    {
+        if (IsPatchableUserData(bindPoint, entry))
+        {
+            AddUserDataPatchEntry(bindPoint, entry, pChunk, (table.pCpuVirtAddr + entry));
+        }
+    }
+}
+
+// =====================================================================================================================
+// Stops recording patch points for a bind point while PAL's internal operations use its user-data.
+void GfxCmdBuffer::SuspendUserDataPatching(
+    PipelineBindPoint bindPoint)
+{
+    memset(&m_patchableUserData[static_cast<uint32>(bindPoint)], 0, sizeof(UserDataFlags));
+}
+
+// =====================================================================================================================
+// Resumes recording patch points for a bind point once the client's state has been restored.
+void GfxCmdBuffer::ResumeUserDataPatching(
+    PipelineBindPoint bindPoint)
+{
+    memcpy(&m_patchableUserData[static_cast<uint32>(bindPoint)],
+           &m_selectedUserData[static_cast<uint32>(bindPoint)],
+           sizeof(UserDataFlags));
+}
+
 // =====================================================================================================================
 // Decrements the ref count of images stored in the Fast clear eliminate ref count array.
 void GfxCmdBuffer::ResetFastClearReferenceCounts()
@@ -812,6 +975,8 @@ void GfxCmdBuffer::CmdSaveComputeState(
     PAL_ASSERT(m_computeStateFlags == 0);
     m_computeStateFlags = stateFlags;
 
+    SuspendUserDataPatching(PipelineBindPoint::Compute);
+
     if (TestAnyFlagSet(stateFlags, ComputeStatePipelineAndUserData))
     {
         // Copy over the bound pipeline and all non-indirect user-data state.
@@ -841,6 +1006,8 @@ void GfxCmdBuffer::CmdRestoreComputeState(
     PAL_ASSERT(TestAllFlagsSet(m_computeStateFlags, stateFlags));
     m_computeStateFlags = 0;
 
+    ResumeUserDataPatching(PipelineBindPoint::Compute);
+
     // Vulkan does allow blits in nested command buffers, but they do not support inheriting user-data values from
     // the caller. Therefore, simply "setting" the restored-state's user-data is sufficient, just like it is in a
     // root command buffer. (If Vulkan decides to support user-data inheritance in a later API version, we'll need
@@ -160,6 +160,16 @@ struct UserDataTableState
     };
 };
 
+// A location in a command or embedded data chunk which holds a value recorded for a patchable user-data entry.  Like a
+// GpuMemoryPatchEntry, the location is identified by its chunk and an offset into that chunk.
+struct UserDataPatchEntry
+{
+    CmdStreamChunk*  pChunk;       // Chunk which holds the value.
+    uint32           chunkOffset;  // Offset into that chunk of the value, in DWORDs.
+    uint16           bindPoint;    // The PipelineBindPoint whose user-data the value belongs to.
+    uint16           entry;        // User-data entry the value was recorded for.
+};
+
 // =====================================================================================================================
 // Abstract class for executing basic hardware-specific functionality common to GFXIP universal and compute command
 // buffers.
@@ -172,6 +182,9 @@ class GfxCmdBuffer : public CmdBuffer
     // Alias for a vector of pointers to gfx images.
     using FceRefCountsVector = Util::Vector<uint32*, MaxNumFastClearImageRefs, Platform>;
 
+    // Alias for a vector of user-data patch points.
+    using UserDataPatchVector = Util::Vector<UserDataPatchEntry, 16, Platform>;
+
 public:
     virtual Result Init(const CmdBufferInternalCreateInfo& internalInfo) override;
 
@@ -179,6 +192,14 @@ public:
     virtual Result End() override;
     virtual Result Reset(ICmdAllocator* pCmdAllocator, bool returnGpuMemory) override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+    virtual Result PatchUserData(
+        PipelineBindPoint bindPoint,
+        uint32            firstEntry,
+        uint32            entryCount,
+        const uint32*     pEntryValues) override;
+#endif
+
     virtual void CmdCopyImage(
         const IImage&          srcImage,
         ImageLayout            srcImageLayout,
@@ -459,6 +480,25 @@ protected:
         uint32              offsetInDwords,
         const uint32*       pSrcData);
 
+    // Returns true if the values written for a user-data entry of the given bind point must be recorded as patch
+    // points.  Always false while PAL's internal operations have the bind point's state pushed.
+    bool IsPatchableUserData(PipelineBindPoint bindPoint, uint32 entry) const
+        { return Util::WideBitfieldIsSet(m_patchableUserData[static_cast<uint32>(bindPoint)], entry); }
+
+    void AddUserDataPatchEntry(
+        PipelineBindPoint bindPoint,
+        uint32            entry,
+        CmdStreamChunk*   pChunk,
+        const uint32*     pValue);
+    void AddUserDataTablePatchEntries(
+        PipelineBindPoint         bindPoint,
+        const UserDataTableState& table,
+        uint32                    firstEntry,
+        uint32                    entryCount);
+
+    void SuspendUserDataPatching(PipelineBindPoint bindPoint);
+    void ResumeUserDataPatching(PipelineBindPoint bindPoint);
+
     static void PAL_STDCALL CmdSetUserDataCs(
         ICmdBuffer*   pCmdBuffer,
         uint32        firstEntry,
@@ -516,6 +556,12 @@ private:
 
     FceRefCountsVector m_fceRefCountVec;
 
+    // Masks of the user-data entries selected for patching, per bind point.  A bind point's mask is cleared while its
+    // state is pushed for internal operations, and restored from m_selectedUserData afterwards.
+    UserDataFlags        m_patchableUserData[static_cast<uint32>(PipelineBindPoint::Count)];
+    UserDataFlags        m_selectedUserData[static_cast<uint32>(PipelineBindPoint::Count)];
+    UserDataPatchVector  m_userDataPatchEntries;
+
     PAL_DISALLOW_COPY_AND_ASSIGN(GfxCmdBuffer);
     PAL_DISALLOW_DEFAULT_CTOR(GfxCmdBuffer);
 };
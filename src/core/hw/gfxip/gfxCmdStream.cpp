@@ -61,6 +61,7 @@ GfxCmdStream::GfxCmdStream(
     m_condIndirectBufferSize(condIndirectBufferSize),
     m_cmdBlockOffset(0),
     m_pTailChainLocation(nullptr),
+    m_pCallChainTail(nullptr),
     m_numCntlFlowStatements(0),
     m_numPendingChains(0)
 {
@@ -78,6 +79,7 @@ void GfxCmdStream::Reset(
     m_numCntlFlowStatements = 0;
     m_numPendingChains      = 0;
     m_pTailChainLocation    = nullptr;
+    m_pCallChainTail        = nullptr;
 
     Pal::CmdStream::Reset(pNewAllocator, returnGpuMemory);
 }
@@ -128,6 +130,9 @@ uint32* GfxCmdStream::EndCommandBlock(
     bool     atEndOfChunk,
     gpusize* pPostambleAddr) // [out,optional]: The postamble's virtual address will be stored here.
 {
+    // The last chained callee must be told where to return to before any more commands are recorded.
+    PAL_ASSERT(m_pCallChainTail == nullptr);
+
     // Compute some size measurements that we will use later on.
     uint32 paddingDwords = 0;
     uint32 allocDwords   = 0;
@@ -433,6 +438,9 @@ void GfxCmdStream::EndWhile()
 // Specialized implementation of "Call" for GFXIP command streams.  This will attempt to use either an IB2 packet or
 // take advantage of command buffer chaining instead of just copying the callee's command stream contents into this
 // stream.
+//
+// Consecutive calls which use chaining are linked directly to each other, so EndCallChain() must be called after the
+// last call in a sequence before anything else is recorded into this stream.
 void GfxCmdStream::Call(
     const CmdStream& targetStream,
     bool             exclusiveSubmit,      // If the target stream belongs to a cmd buffer with this option enabled!
@@ -450,6 +458,16 @@ void GfxCmdStream::Call(
         // If this command stream is preemptible, PAL assumes that the target command stream to also be preemptible.
         PAL_ASSERT(IsPreemptionEnabled() == targetStream.IsPreemptionEnabled());
 
+        const bool useChaining =
+            ((allowIb2Launch == false) && exclusiveSubmit &&
+             (m_chainIbSpaceInDwords != 0) && (gfxStream.m_chainIbSpaceInDwords != 0));
+
+        if (useChaining == false)
+        {
+            // The callee won't be chained to, so the previous chained callee must return here first.
+            EndCallChain();
+        }
+
         if (allowIb2Launch)
         {
             PAL_ASSERT(GetEngineType() != EngineTypeCompute);
@@ -483,36 +501,42 @@ void GfxCmdStream::Call(
                                     pIb2Packet);
             }
         }
-        else if (exclusiveSubmit && (m_chainIbSpaceInDwords != 0) && (gfxStream.m_chainIbSpaceInDwords != 0))
+        else if (useChaining)
         {
             // NOTE: To call a command stream which supports chaining and has the exclusive submit optmization enabled,
             // we only need to jump to the callee's first chunk, and then jump back here when the callee finishes.
 
-            if (IsEmpty())
+            // Chaining the same callee twice in a row would make it jump to itself forever.
+            PAL_ASSERT(&gfxStream != m_pCallChainTail);
+
+            if (m_pCallChainTail != nullptr)
             {
-                // The call to EndCommandBlock() below will not succeed if this command stream is currently empty. Add
-                // the smallest-possible NOP packet to prevent the stream from being empty.
-                uint32*const pNopPacket = AllocCommandSpace(m_minNopSizeInDwords);
-                BuildNop(m_minNopSizeInDwords, pNopPacket);
+                // The previous callee was also chained to, so it can jump straight to this callee instead of
+                // returning here first.  Both callees are exclusive-submit, so their tail-chains are ours to modify.
+                m_pCallChainTail->PatchTailChain(&targetStream);
             }
+            else
+            {
+                if (IsEmpty())
+                {
+                    // The call to EndCommandBlock() below will not succeed if this command stream is currently empty.
+                    // Add the smallest-possible NOP packet to prevent the stream from being empty.
+                    uint32*const pNopPacket = AllocCommandSpace(m_minNopSizeInDwords);
+                    BuildNop(m_minNopSizeInDwords, pNopPacket);
+                }
 
-            // End our current command block, using the jump to the callee's first chunk as our block postamble.
-            const auto*const pJumpChunk   = targetStream.GetFirstChunk();
-            uint32*const     pChainPacket = EndCommandBlock(m_chainIbSpaceInDwords, false);
-            BuildIndirectBuffer(pJumpChunk->GpuVirtAddr(),
-                                pJumpChunk->CmdDwordsToExecute(),
-                                targetStream.IsPreemptionEnabled(),
-                                true,
-                                pChainPacket);
-
-            // Returning to the call site requires patching the callee's tail-chain with a packet which brings us
-            // back here. However, we need to know the size of the current command block in order to fully construct
-            // a chaining packet. So, the solution is to add a chain patch at the callee's tail-chain location which
-            // will correspond to the current block.
+                // End our current command block, using the jump to the callee's first chunk as our block postamble.
+                const auto*const pJumpChunk   = targetStream.GetFirstChunk();
+                uint32*const     pChainPacket = EndCommandBlock(m_chainIbSpaceInDwords, false);
+                BuildIndirectBuffer(pJumpChunk->GpuVirtAddr(),
+                                    pJumpChunk->CmdDwordsToExecute(),
+                                    targetStream.IsPreemptionEnabled(),
+                                    true,
+                                    pChainPacket);
+            }
 
-            // NOTE: The callee's End() method was called after it was done being recorded. That call already built
-            // us a dummy NOP packet at the tail-chain location, so we don't need to build a new one at this time!
-            AddChainPatch(ChainPatchType::IndirectBuffer, gfxStream.m_pTailChainLocation);
+            // Returning to the call site is deferred to EndCallChain() in case the next call can be chained as well.
+            m_pCallChainTail = &gfxStream;
         }
         else
         {
@@ -531,6 +555,25 @@ void GfxCmdStream::Call(
     }
 }
 
+// =====================================================================================================================
+// Finishes a sequence of chained calls by making the last callee return to this command stream.
+void GfxCmdStream::EndCallChain()
+{
+    if (m_pCallChainTail != nullptr)
+    {
+        // Returning to the call site requires patching the callee's tail-chain with a packet which brings us back
+        // here. However, we need to know the size of the current command block in order to fully construct a chaining
+        // packet. So, the solution is to add a chain patch at the callee's tail-chain location which will correspond
+        // to the current block.
+
+        // NOTE: The callee's End() method was called after it was done being recorded. That call already built us a
+        // dummy NOP packet at the tail-chain location, so we don't need to build a new one at this time!
+        AddChainPatch(ChainPatchType::IndirectBuffer, m_pCallChainTail->m_pTailChainLocation);
+
+        m_pCallChainTail = nullptr;
+    }
+}
+
 // =====================================================================================================================
 // Uses command buffer chaining to "execute" a series of GPU-generated command chunks. All chunks starting at the given
 // iterator until the end of whichever list it belongs to are chained together. Additionally, the final chunk chains
@@ -87,6 +87,7 @@ public:
     virtual void EndWhile();
 
     virtual void Call(const CmdStream& targetStream, bool exclusiveSubmit, bool allowIb2Launch) override;
+    void EndCallChain();
 
     void ExecuteGeneratedCommands(ChunkRefList::Iter chunkIter);
 
@@ -163,6 +164,10 @@ private:
     uint32         m_cmdBlockOffset;         // The current command block began at this DW offset in the current chunk
     uint32*        m_pTailChainLocation;     // Put a chain packet here to chain this command stream to another.
 
+    // The last command stream called by chaining whose tail-chain doesn't jump anywhere yet.  Consecutive chained calls
+    // jump straight from one callee to the next; only the last callee returns to this stream.  See EndCallChain().
+    const GfxCmdStream* m_pCallChainTail;
+
     // We need a stack of control flow frames to manage nested control flow statements.
     CntlFlowFrame  m_cntlFlowStack[CntlFlowNestingLimit];
     uint32         m_numCntlFlowStatements;
@@ -67,6 +67,7 @@ class      IPipeline;
 class      IQueryPool;
 class      IShader;
 class      MsaaState;
+class      PipelineCreateBatch;
 class      Platform;
 class      Queue;
 class      QueueContext;
@@ -175,6 +176,8 @@ struct GraphicsPipelineInternalCreateInfo
         };
         uint32 u32All;
     } flags;
+
+    PipelineCreateBatch* pCreateBatch; // Optional: batch of pipelines which this pipeline is created as part of.
 };
 
 // Additional information for creating PAL-internal compound state.
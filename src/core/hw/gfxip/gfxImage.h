@@ -143,6 +143,17 @@ public:
 
     virtual gpusize GetAspectBaseAddr(ImageAspect  aspect) const { PAL_NEVER_CALLED(); return 0; }
 
+    // Copies between linear system memory and the image's data using the CPU.  The regions have already been validated
+    // by the parent image.  If toImage is set, pSrc is the linear memory and pDst is the image data; otherwise the
+    // roles are reversed.
+    virtual Result CpuCopy(
+        const void*               pSrc,
+        void*                     pDst,
+        uint32                    regionCount,
+        const CpuImageCopyRegion* pRegions,
+        uint32                    maxThreadCount,
+        bool                      toImage) const { return Result::Unsupported; }
+
     uint32 TranslateClearCodeOneToNativeFmt(uint32 cmpIdx) const;
 
     // Returns an integer that represents the tiling mode associated with the specified subresource.
@@ -31,6 +31,7 @@
 #include "palMetroHash.h"
 #include "palPipelineAbi.h"
 #include "palPipelineAbiProcessorImpl.h"
+#include "palSysUtil.h"
 
 using namespace Util;
 
@@ -65,6 +66,9 @@ Result GraphicsPipeline::Init(
 {
     Result result = Result::Success;
 
+    m_pCreateBatch = internalInfo.pCreateBatch;
+    const int64 startTime = GetPerfCpuTime();
+
     if ((createInfo.pPipelineBinary != nullptr) && (createInfo.pipelineBinarySize != 0))
     {
         m_pipelineBinaryLen = createInfo.pipelineBinarySize;
@@ -83,12 +87,19 @@ Result GraphicsPipeline::Init(
         result = Result::ErrorInvalidPointer;
     }
 
+    if (m_pCreateBatch != nullptr)
+    {
+        m_pCreateBatch->AddStageTime(PipelineCreateStage::ElfLoad, GetPerfCpuTime() - startTime);
+    }
+
     if (result == Result::Success)
     {
         PAL_ASSERT(m_pPipelineBinary != nullptr);
         result = InitFromPipelineBinary(createInfo, internalInfo);
     }
 
+    m_pCreateBatch = nullptr;
+
     return result;
 }
 
@@ -164,15 +175,31 @@ Result GraphicsPipeline::InitFromPipelineBinary(
 
 #endif
 
+    int64 stageStartTime = GetPerfCpuTime();
+
     AbiProcessor abiProcessor(m_pDevice->GetPlatform());
-    Result result = abiProcessor.LoadFromBuffer(m_pPipelineBinary, m_pipelineBinaryLen);
+    Result result = abiProcessor.LoadFromBufferView(m_pPipelineBinary, m_pipelineBinaryLen);
+
+    if (m_pCreateBatch != nullptr)
+    {
+        const int64 time = GetPerfCpuTime();
+        m_pCreateBatch->AddStageTime(PipelineCreateStage::ElfLoad, time - stageStartTime);
+        stageStartTime = time;
+    }
 
     MsgPackReader      metadataReader;
     CodeObjectMetadata metadata;
 
     if (result == Result::Success)
     {
-        result = abiProcessor.GetMetadata(&metadataReader, &metadata);
+        result = GetMetadata(abiProcessor, &metadataReader, &metadata);
+    }
+
+    if (m_pCreateBatch != nullptr)
+    {
+        const int64 time = GetPerfCpuTime();
+        m_pCreateBatch->AddStageTime(PipelineCreateStage::Metadata, time - stageStartTime);
+        stageStartTime = time;
     }
 
     if (result == Result::Success)
@@ -217,6 +244,12 @@ Result GraphicsPipeline::InitFromPipelineBinary(
         m_flags.psUsesAppendConsume = (psStageMetadata.flags.usesAppendConsume != 0);
 
         result = HwlInit(createInfo, abiProcessor, metadata, &metadataReader);
+
+        if (m_pCreateBatch != nullptr)
+        {
+            // This includes the upload, which PerformRelocationsAndUploadToGpuMemory() moves to its own stage.
+            m_pCreateBatch->AddStageTime(PipelineCreateStage::RegisterSetup, GetPerfCpuTime() - stageStartTime);
+        }
     }
 
     // Finalize the hash.
@@ -28,8 +28,11 @@
 #include "core/platform.h"
 #include "core/hw/gfxip/gfxDevice.h"
 #include "core/hw/gfxip/pipeline.h"
+#include "palElfCache.h"
 #include "palFile.h"
 #include "palPipelineAbiProcessorImpl.h"
+#include "palSysUtil.h"
+#include "palVectorImpl.h"
 
 #include "core/devDriverUtil.h"
 
@@ -69,6 +72,31 @@ struct SerializedData
     ShaderMetadata  shaderMetadata;
 };
 
+// Entry stored in the device's ELF metadata cache: the deserialized metadata of a pipeline ELF, plus what is needed to
+// position a MsgPackReader at the ELF's register map without deserializing the metadata again.  Entries are only
+// valid for the PAL build which stored them, because CodeObjectMetadata is stored as a raw struct.
+struct CachedPipelineMetadata
+{
+    uint64             palBuildId;          // Device::ElfCacheBuildId() of the build which stored the entry.
+    uint32             metadataSize;        // sizeof(CodeObjectMetadata) in the build which stored the entry.
+    uint32             blobSize;            // Size of the ELF's metadata blob.
+    uint32             registersOffset;     // Offset of the register map in the metadata blob.
+    uint32             apiCreateInfoOffset; // Offset of metadata.pipeline.apiCreateInfo in the metadata blob, or
+                                            // UINT_MAX if there is none.
+    CodeObjectMetadata metadata;            // The apiCreateInfo pointer must be rebased before this can be used.
+};
+
+// =====================================================================================================================
+// Converts an interval measured with GetPerfCpuTime() to nanoseconds.
+uint64 PerfTicksToNanoseconds(
+    int64 ticks)
+{
+    constexpr double NanosecsPerSec = 1000000000.0;
+
+    // A stage which had time moved to a nested stage can be negative for a moment, but never once the batch is done.
+    return (ticks > 0) ? static_cast<uint64>((ticks * NanosecsPerSec) / GetPerfFrequency()) : 0;
+}
+
 // =====================================================================================================================
 Pipeline::Pipeline(
     Device* pDevice,
@@ -79,7 +107,8 @@ Pipeline::Pipeline(
     m_gpuMemSize(0),
     m_pPipelineBinary(nullptr),
     m_pipelineBinaryLen(0),
-    m_apiHwMapping()
+    m_apiHwMapping(),
+    m_pCreateBatch(nullptr)
 {
     m_flags.value      = 0;
     m_flags.isInternal = isInternal;
@@ -124,13 +153,112 @@ Result Pipeline::PerformRelocationsAndUploadToGpuMemory(
 {
     PAL_ASSERT(pUploader != nullptr);
 
-    Result result = pUploader->Begin(m_pDevice, abiProcessor, metadata, &m_perfDataInfo[0]);
+    const int64 startTime = GetPerfCpuTime();
+
+    Result result = pUploader->Begin(m_pDevice, abiProcessor, metadata, &m_perfDataInfo[0], m_pCreateBatch);
     if (result == Result::Success)
     {
         m_gpuMemSize = pUploader->GpuMemSize();
         m_gpuMem.Update(pUploader->GpuMem(), pUploader->GpuMemOffset());
     }
 
+    if (m_pCreateBatch != nullptr)
+    {
+        // The upload is nested inside of the hardware-specific register setup, which is timed as a whole by the caller.
+        const int64 uploadTime = (GetPerfCpuTime() - startTime);
+        m_pCreateBatch->AddStageTime(PipelineCreateStage::Upload,        uploadTime);
+        m_pCreateBatch->AddStageTime(PipelineCreateStage::RegisterSetup, -uploadTime);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Deserializes the pipeline metadata of the given pipeline ELF and positions the reader at the start of its register
+// map, like AbiProcessor::GetMetadata().  If the device has an ELF metadata cache, the deserialized metadata is loaded
+// from it on a hit, and stored into it on a miss.
+Result Pipeline::GetMetadata(
+    const AbiProcessor& abiProcessor,
+    MsgPackReader*      pReader,
+    CodeObjectMetadata* pMetadata
+    ) const
+{
+    ElfCache*const pElfCache = m_pDevice->GetElfCache();
+
+    uint32 majorVer = 0;
+    uint32 minorVer = 0;
+    abiProcessor.GetMetadataVersion(&majorVer, &minorVer);
+
+    const void* pBlob    = nullptr;
+    size_t      blobSize = 0;
+    abiProcessor.GetMetadata(&pBlob, &blobSize);
+
+    Result result = Result::NotFound;
+
+    // Legacy metadata is translated rather than read from the blob, so there is no register map offset to cache.
+    if ((pElfCache != nullptr) && (majorVer != 0) && (pBlob != nullptr))
+    {
+        const auto& chipProps = m_pDevice->ChipProperties();
+
+        ElfCacheKey key = { };
+        ElfCache::ComputeElfHash(m_pPipelineBinary, m_pipelineBinaryLen, &key.elfHash);
+        key.deviceKey = ((static_cast<uint64>(chipProps.familyId) << 48) |
+                         (static_cast<uint64>(chipProps.eRevId)   << 32) |
+                         chipProps.deviceId);
+
+        CachedPipelineMetadata cached     = { };
+        const uint64           palBuildId = m_pDevice->ElfCacheBuildId();
+
+        size_t cachedSize = sizeof(cached);
+        if ((pElfCache->Load(key, &cached, &cachedSize) == Result::Success) &&
+            (cachedSize          == sizeof(cached))                          &&
+            (cached.palBuildId   == palBuildId)                              &&
+            (cached.metadataSize == sizeof(CodeObjectMetadata))              &&
+            (cached.blobSize     == blobSize)                                &&
+            ((cached.apiCreateInfoOffset == UINT_MAX) ||
+             ((cached.apiCreateInfoOffset + cached.metadata.pipeline.apiCreateInfo.sizeInBytes) <= blobSize)))
+        {
+            memcpy(pMetadata, &cached.metadata, sizeof(CodeObjectMetadata));
+
+            pMetadata->pipeline.apiCreateInfo.pBuffer =
+                (cached.apiCreateInfoOffset != UINT_MAX) ? VoidPtrInc(pBlob, cached.apiCreateInfoOffset) : nullptr;
+
+            result = pReader->InitFromBuffer(pBlob, static_cast<uint32>(blobSize));
+
+            if (result == Result::Success)
+            {
+                result = pReader->Seek(cached.registersOffset);
+            }
+        }
+
+        if (result != Result::Success)
+        {
+            uint32 registersOffset = UINT_MAX;
+            result = abiProcessor.GetMetadata(pReader, pMetadata, &registersOffset);
+
+            if (result == Result::Success)
+            {
+                const void*const pApiCreateInfo = pMetadata->pipeline.apiCreateInfo.pBuffer;
+
+                cached.palBuildId          = palBuildId;
+                cached.metadataSize        = sizeof(CodeObjectMetadata);
+                cached.blobSize            = static_cast<uint32>(blobSize);
+                cached.registersOffset     = registersOffset;
+                cached.apiCreateInfoOffset = (pApiCreateInfo != nullptr)
+                                                 ? static_cast<uint32>(VoidPtrDiff(pApiCreateInfo, pBlob))
+                                                 : UINT_MAX;
+                memcpy(&cached.metadata, pMetadata, sizeof(CodeObjectMetadata));
+
+                // The cache is only an optimization, so a failure to store the entry is ignored.
+                pElfCache->Store(key, &cached, sizeof(cached));
+            }
+        }
+    }
+    else
+    {
+        result = abiProcessor.GetMetadata(pReader, pMetadata);
+    }
+
     return result;
 }
 
@@ -261,7 +389,7 @@ Result Pipeline::GetShaderCode(
             // To extract the shader code, we can re-parse the saved ELF binary and lookup the shader's program
             // instructions by examining the symbol table entry for that shader's entrypoint.
             AbiProcessor abiProcessor(m_pDevice->GetPlatform());
-            result = abiProcessor.LoadFromBuffer(m_pPipelineBinary, m_pipelineBinaryLen);
+            result = abiProcessor.LoadFromBufferView(m_pPipelineBinary, m_pipelineBinaryLen);
             if (result == Result::Success)
             {
                 const auto& symbol = abiProcessor.GetPipelineSymbolEntry(
@@ -338,7 +466,7 @@ Result Pipeline::GetShaderStatsForStage(
 
     // We can re-parse the saved pipeline ELF binary to extract shader statistics.
     AbiProcessor abiProcessor(m_pDevice->GetPlatform());
-    Result result = abiProcessor.LoadFromBuffer(m_pPipelineBinary, m_pipelineBinaryLen);
+    Result result = abiProcessor.LoadFromBufferView(m_pPipelineBinary, m_pipelineBinaryLen);
 
     MsgPackReader      metadataReader;
     CodeObjectMetadata metadata;
@@ -466,6 +594,7 @@ PipelineUploader::PipelineUploader(
     m_pGpuMemory(nullptr),
     m_baseOffset(0),
     m_gpuMemSize(0),
+    m_pCreateBatch(nullptr),
     m_codeGpuVirtAddr(0),
     m_dataGpuVirtAddr(0),
     m_ctxRegGpuVirtAddr(0),
@@ -496,7 +625,8 @@ Result PipelineUploader::Begin(
     Device*                   pDevice,
     const AbiProcessor&       abiProcessor,
     const CodeObjectMetadata& metadata,
-    PerfDataInfo*             pPerfDataInfoList)
+    PerfDataInfo*             pPerfDataInfoList,
+    PipelineCreateBatch*      pCreateBatch)       // Optional: batch which should keep the GPU memory mapped.
 {
     PAL_ASSERT(pPerfDataInfoList != nullptr);
 
@@ -566,7 +696,18 @@ Result PipelineUploader::Begin(
     Result result = pDevice->MemMgr()->AllocateGpuMem(createInfo, internalInfo, false, &m_pGpuMemory, &m_baseOffset);
     if (result == Result::Success)
     {
-        result = m_pGpuMemory->Map(&m_pMappedPtr);
+        // Only pooled allocations are mapped through the batch: they are shared with other pipelines of the batch and
+        // outlive it.  A dedicated allocation would be freed along with its pipeline if the pipeline fails.
+        if ((pCreateBatch != nullptr) && m_pGpuMemory->WasBuddyAllocated())
+        {
+            m_pCreateBatch = pCreateBatch;
+            result = m_pCreateBatch->Map(m_pGpuMemory, &m_pMappedPtr);
+        }
+        else
+        {
+            result = m_pGpuMemory->Map(&m_pMappedPtr);
+        }
+
         if (result == Result::Success)
         {
             m_gpuMemSize = createInfo.size;
@@ -680,8 +821,106 @@ void PipelineUploader::End()
         m_pShRegWritePtr  = nullptr;
         m_pMappedPtr      = nullptr;
 
-        m_pGpuMemory->Unmap();
+        // The batch unmaps the memory once all of its pipelines are done with it.
+        if (m_pCreateBatch == nullptr)
+        {
+            m_pGpuMemory->Unmap();
+        }
+    }
+}
+
+// =====================================================================================================================
+PipelineCreateBatch::PipelineCreateBatch(
+    Device* pDevice)
+    :
+    m_pDevice(pDevice),
+    m_mappedMemory(pDevice->GetPlatform())
+{
+    for (uint32 i = 0; i < static_cast<uint32>(PipelineCreateStage::Count); ++i)
+    {
+        m_stageTicks[i] = 0;
+    }
+}
+
+// =====================================================================================================================
+PipelineCreateBatch::~PipelineCreateBatch()
+{
+    PAL_ASSERT(m_mappedMemory.IsEmpty()); // If this fires, the caller forgot to call UnmapAll()!
+}
+
+// =====================================================================================================================
+// Returns a CPU pointer to the given GPU memory, mapping it the first time any pipeline of the batch asks for it.
+Result PipelineCreateBatch::Map(
+    GpuMemory* pGpuMemory,
+    void**     ppData)
+{
+    MutexAuto lock(&m_mapLock);
+
+    Result result = Result::Success;
+    void*  pData  = nullptr;
+
+    for (uint32 i = 0; i < m_mappedMemory.NumElements(); ++i)
+    {
+        if (m_mappedMemory.At(i).pGpuMemory == pGpuMemory)
+        {
+            pData = m_mappedMemory.At(i).pData;
+            break;
+        }
     }
+
+    if (pData == nullptr)
+    {
+        result = pGpuMemory->Map(&pData);
+
+        if (result == Result::Success)
+        {
+            const MappedGpuMemory mapped = { pGpuMemory, pData };
+            result = m_mappedMemory.PushBack(mapped);
+
+            if (result != Result::Success)
+            {
+                pGpuMemory->Unmap();
+            }
+        }
+    }
+
+    (*ppData) = pData;
+
+    return result;
+}
+
+// =====================================================================================================================
+// Unmaps all GPU memory mapped by the batch.  Must be called once no pipeline of the batch is uploading anymore.
+void PipelineCreateBatch::UnmapAll()
+{
+    MutexAuto lock(&m_mapLock);
+
+    for (uint32 i = 0; i < m_mappedMemory.NumElements(); ++i)
+    {
+        m_mappedMemory.At(i).pGpuMemory->Unmap();
+    }
+
+    m_mappedMemory.Clear();
+}
+
+// =====================================================================================================================
+// Reports the stage times and the number of allocations mapped so far.  Doesn't fill in the thread count or wall time,
+// which are only known to the caller.
+void PipelineCreateBatch::GetStats(
+    PipelineBatchStats* pStats
+    ) const
+{
+    uint64 stageTime[static_cast<uint32>(PipelineCreateStage::Count)] = { };
+    for (uint32 i = 0; i < static_cast<uint32>(PipelineCreateStage::Count); ++i)
+    {
+        stageTime[i] = PerfTicksToNanoseconds(static_cast<int64>(m_stageTicks[i]));
+    }
+
+    pStats->mappedAllocations = m_mappedMemory.NumElements();
+    pStats->elfLoadTime       = stageTime[static_cast<uint32>(PipelineCreateStage::ElfLoad)];
+    pStats->metadataTime      = stageTime[static_cast<uint32>(PipelineCreateStage::Metadata)];
+    pStats->registerSetupTime = stageTime[static_cast<uint32>(PipelineCreateStage::RegisterSetup)];
+    pStats->uploadTime        = stageTime[static_cast<uint32>(PipelineCreateStage::Upload)];
 }
 
 } // Pal
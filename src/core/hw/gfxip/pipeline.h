@@ -31,14 +31,17 @@
 #include "palElfPackager.h"
 #include "palLib.h"
 #include "palMetroHash.h"
+#include "palMutex.h"
 #include "palSparseVectorImpl.h"
 #include "palPipeline.h"
 #include "palPipelineAbiProcessor.h"
+#include "palVector.h"
 
 namespace Pal
 {
 
 class CmdStream;
+class PipelineCreateBatch;
 class PipelineUploader;
 
 // Represents information about shader operations stored obtained as shader metadata flags during processing of shader
@@ -100,6 +103,19 @@ typedef Util::Abi::PipelineAbiProcessor<Platform>  AbiProcessor;
 // Shorthand for the PAL code object metadata structure.
 typedef Util::Abi::PalCodeObjectMetadata  CodeObjectMetadata;
 
+// Converts an interval measured with Util::GetPerfCpuTime() to nanoseconds.
+extern uint64 PerfTicksToNanoseconds(int64 ticks);
+
+// Stages of pipeline creation which are timed when a pipeline is created as part of a PipelineCreateBatch.
+enum class PipelineCreateStage : uint32
+{
+    ElfLoad = 0,    // Copying and parsing the pipeline ELF.
+    Metadata,       // Decoding the pipeline metadata.
+    RegisterSetup,  // Decoding the register map and building the hardware state, excluding the upload.
+    Upload,         // Allocating GPU memory, applying relocations and uploading the pipeline.
+    Count
+};
+
 // =====================================================================================================================
 // Monolithic object containing all shaders and a large amount of "shader adjacent" state.  Separate concrete
 // implementations will support compute or graphics pipelines.
@@ -144,6 +160,11 @@ protected:
         const CodeObjectMetadata& metadata,
         PipelineUploader*         pUploader);
 
+    Result GetMetadata(
+        const AbiProcessor&  abiProcessor,
+        Util::MsgPackReader* pReader,
+        CodeObjectMetadata*  pMetadata) const;
+
     void ExtractPipelineInfo(
         const CodeObjectMetadata& metadata,
         ShaderType                firstShader,
@@ -180,6 +201,9 @@ protected:
     PerfDataInfo m_perfDataInfo[static_cast<size_t>(Util::Abi::HardwareStage::Count)];
     Util::Abi::ApiHwShaderMapping m_apiHwMapping;
 
+    // The batch this pipeline is being created in, if any.  Only valid during Init().
+    PipelineCreateBatch* m_pCreateBatch;
+
 private:
     union
     {
@@ -209,7 +233,8 @@ public:
         Device*                   pDevice,
         const AbiProcessor&       abiProcessor,
         const CodeObjectMetadata& metadata,
-        PerfDataInfo*             pPerfDataInfoList);
+        PerfDataInfo*             pPerfDataInfoList,
+        PipelineCreateBatch*      pCreateBatch);
 
     void End();
 
@@ -248,9 +273,10 @@ protected:
     }
 
 private:
-    GpuMemory*  m_pGpuMemory;
-    gpusize     m_baseOffset;
-    gpusize     m_gpuMemSize;
+    GpuMemory*            m_pGpuMemory;
+    gpusize               m_baseOffset;
+    gpusize               m_gpuMemSize;
+    PipelineCreateBatch*  m_pCreateBatch;   // If non-null, owns the CPU mapping of m_pGpuMemory.
 
     gpusize     m_prefetchGpuVirtAddr;
     gpusize     m_prefetchSize;
@@ -275,4 +301,46 @@ private:
     PAL_DISALLOW_COPY_AND_ASSIGN(PipelineUploader);
 };
 
+// =====================================================================================================================
+// Shared state of the pipelines created by a single IDevice::CreateGraphicsPipelines() call, which may be initialized
+// concurrently on several threads.
+//
+// Pipelines are sub-allocated out of a few large GPU memory pools, so most of a batch is uploaded into the same few
+// allocations.  Rather than having every pipeline map and unmap its allocation, the batch maps each pool allocation
+// once and keeps it mapped until the whole batch is done.  The batch also accumulates the time spent in each stage of
+// pipeline creation.
+class PipelineCreateBatch
+{
+public:
+    explicit PipelineCreateBatch(Device* pDevice);
+    ~PipelineCreateBatch();
+
+    Result Init() { return m_mapLock.Init(); }
+
+    Result Map(GpuMemory* pGpuMemory, void** ppData);
+    void UnmapAll();
+
+    // Adds a number of performance counter ticks to the time of a stage.  The value may be negative to move time which
+    // was measured as part of one stage to a nested stage; the unsigned addition wraps to the same result.
+    void AddStageTime(PipelineCreateStage stage, int64 ticks)
+        { Util::AtomicAdd64(&m_stageTicks[static_cast<uint32>(stage)], static_cast<uint64>(ticks)); }
+
+    void GetStats(PipelineBatchStats* pStats) const;
+
+private:
+    struct MappedGpuMemory
+    {
+        GpuMemory* pGpuMemory;
+        void*      pData;
+    };
+
+    Device*const                                m_pDevice;
+    Util::Mutex                                 m_mapLock;       // Protects m_mappedMemory.
+    Util::Vector<MappedGpuMemory, 8, Platform>  m_mappedMemory;  // Every allocation currently mapped by this batch.
+    volatile uint64                             m_stageTicks[static_cast<uint32>(PipelineCreateStage::Count)];
+
+    PAL_DISALLOW_DEFAULT_CTOR(PipelineCreateBatch);
+    PAL_DISALLOW_COPY_AND_ASSIGN(PipelineCreateBatch);
+};
+
 } // Pal
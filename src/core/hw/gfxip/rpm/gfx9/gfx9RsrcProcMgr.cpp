@@ -3128,8 +3128,9 @@ Extent3d RsrcProcMgr::GetCopyViaSrdCopyDims(
 }
 
 // ====================================================================================================================
-// Implement a horribly inefficient copy on a pixel-by-pixel basis of the pixels that were missed by the standard
-// copy algorithm.
+// Copies the pixels that were missed by the standard copy algorithm on a scanline-by-scanline basis. AddrLib computes
+// the image address of every pixel in a scanline at once and pixels which turn out to be contiguous in both the image
+// and the memory are merged into a single copy region.
 void RsrcProcMgr::CmdCopyMemoryFromToImageViaPixels(
     GfxCmdBuffer*                 pCmdBuffer,
     const Pal::Image&             image,
@@ -3153,6 +3154,8 @@ void RsrcProcMgr::CmdCopyMemoryFromToImageViaPixels(
     const bool      is3dImage        = (createInfo.imageType == ImageType::Tex3d);
     const uint32    sliceOffset      = (is3dImage ? region.imageOffset.z : region.imageSubres.arraySlice);
     const uint32    sliceDepth       = (is3dImage ? region.imageExtent.depth : region.numSlices);
+    const uint32    bytesPerPixel    = Formats::BitsPerPixel(createInfo.swizzledFormat.format) >> 3;
+    const gpusize   imgBaseOffset    = image.GetBoundGpuMemory().Offset();
     ADDR_HANDLE     hAddrLib         = pPalDevice->AddrLibHandle();
 
     ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT  input = {};
@@ -3170,69 +3173,92 @@ void RsrcProcMgr::CmdCopyMemoryFromToImageViaPixels(
     input.pipeBankXor     = pTileInfo->pipeBankXor;
     input.bpp             = Formats::BitsPerPixel(createInfo.swizzledFormat.format);
 
-    for (uint32  sliceIdx = 0; sliceIdx < sliceDepth; sliceIdx++)
-    {
-        // the slice input is used for both 2D arrays and 3D slices.
-        input.slice = sliceOffset + sliceIdx;
+    ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_INPUT  spanInput  = {};
+    ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_OUTPUT spanOutput = {};
+    spanInput.size  = sizeof(ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_INPUT);
+    spanOutput.size = sizeof(ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_OUTPUT);
+
+    // No scanline needs more than one address or copy region per pixel.
+    AutoBuffer<UINT_64, 32, Platform>          imgAddrs(region.imageExtent.width, m_pDevice->GetPlatform());
+    AutoBuffer<MemoryCopyRegion, 32, Platform> newRegions(region.imageExtent.width, m_pDevice->GetPlatform());
 
-        for (uint32  yIdx = 0; yIdx < region.imageExtent.height; yIdx++)
+    if ((imgAddrs.Capacity() < region.imageExtent.width) || (newRegions.Capacity() < region.imageExtent.width))
+    {
+        pCmdBuffer->NotifyAllocFailure();
+    }
+    else
+    {
+        for (uint32  sliceIdx = 0; sliceIdx < sliceDepth; sliceIdx++)
         {
-            input.y = yIdx + region.imageOffset.y;
-
-            // If the default copy algorithm (done previously) has already seen this scanline, then we can bias
-            // the starting X coordinate over to skip the region already copied by the default copy implementation.
-            // If this entire scanline was invisible to default copy function though, we have to do the entire thing.
-            const uint32  startX = ((input.y < hwCopyDims.height)
-                                    ? hwCopyDims.width
-                                    : 0);
-
-            // It's possible that the default copy algorithm already handled an entire scanline of this region.  If
-            // so, there's nothing to do here.
-            if (startX < region.imageExtent.width)
-            {
-                // Batch up all the copies in the "X" direction in one auto-buffer that we can submit in
-                // one swell foop
-                AutoBuffer<MemoryCopyRegion, 32, Platform> newRegions(region.imageExtent.width,
-                                                                      m_pDevice->GetPlatform());
+            // the slice input is used for both 2D arrays and 3D slices.
+            input.slice = sliceOffset + sliceIdx;
 
-                uint32  newRegionsIdx = 0;
-                for (uint32  xIdx = startX; xIdx < region.imageExtent.width; xIdx++)
+            for (uint32  yIdx = 0; yIdx < region.imageExtent.height; yIdx++)
+            {
+                input.y = yIdx + region.imageOffset.y;
+
+                // If the default copy algorithm (done previously) has already seen this scanline, then we can bias
+                // the starting X coordinate over to skip the region already copied by the default copy
+                // implementation. If this entire scanline was invisible to default copy function though, we have to
+                // do the entire thing.
+                const uint32  startX = ((input.y < hwCopyDims.height)
+                                        ? hwCopyDims.width
+                                        : 0);
+
+                // It's possible that the default copy algorithm already handled an entire scanline of this region.
+                // If so, there's nothing to do here.
+                if (startX < region.imageExtent.width)
                 {
-                    input.x = xIdx + region.imageOffset.x;
+                    input.x = startX + region.imageOffset.x;
 
-                    ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_OUTPUT  output = {};
-                    output.size = sizeof(ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_OUTPUT);
+                    spanInput.coordIn  = input;
+                    spanInput.numElems = region.imageExtent.width - startX;
+                    spanOutput.pAddr   = &imgAddrs[0];
 
-                    const ADDR_E_RETURNCODE retCode = Addr2ComputeSurfaceAddrFromCoord(
-                                                        hAddrLib,
-                                                        &input,
-                                                        &output);
+                    const ADDR_E_RETURNCODE retCode = Addr2ComputeSurfaceAddrFromCoordSpan(hAddrLib,
+                                                                                            &spanInput,
+                                                                                            &spanOutput);
 
                     if (retCode == ADDR_OK)
                     {
-                        const gpusize  imgOffset = image.GetBoundGpuMemory().Offset() + output.addr;
-                        const gpusize  memOffset = region.gpuMemoryOffset                +
-                                                   sliceIdx * region.gpuMemoryDepthPitch +
-                                                   yIdx     * region.gpuMemoryRowPitch   +
-                                                   xIdx     * (input.bpp >> 3);
-
-                        newRegions[newRegionsIdx].srcOffset = (imageIsSrc ? imgOffset : memOffset);
-                        newRegions[newRegionsIdx].dstOffset = (imageIsSrc ? memOffset : imgOffset);
-                        newRegions[newRegionsIdx].copySize  = input.bpp >> 3;
+                        const gpusize rowMemOffset = region.gpuMemoryOffset                +
+                                                     sliceIdx * region.gpuMemoryDepthPitch +
+                                                     yIdx     * region.gpuMemoryRowPitch;
+
+                        // The memory side of the copy is linear, so a pixel can be appended to the previous region
+                        // whenever its image address immediately follows the previous pixel's.
+                        uint32 newRegionsIdx = 0;
+                        for (uint32  pixelIdx = 0; pixelIdx < spanInput.numElems; pixelIdx++)
+                        {
+                            const gpusize  imgOffset = imgBaseOffset + imgAddrs[pixelIdx];
+
+                            if ((pixelIdx > 0) && (imgAddrs[pixelIdx] == (imgAddrs[pixelIdx - 1] + bytesPerPixel)))
+                            {
+                                newRegions[newRegionsIdx - 1].copySize += bytesPerPixel;
+                            }
+                            else
+                            {
+                                const gpusize  memOffset = rowMemOffset + (startX + pixelIdx) * bytesPerPixel;
+
+                                newRegions[newRegionsIdx].srcOffset = (imageIsSrc ? imgOffset : memOffset);
+                                newRegions[newRegionsIdx].dstOffset = (imageIsSrc ? memOffset : imgOffset);
+                                newRegions[newRegionsIdx].copySize  = bytesPerPixel;
+
+                                newRegionsIdx++;
+                            }
+                        }
 
-                        newRegionsIdx++;
+                        CmdCopyMemory(pCmdBuffer, *pSrcMem, *pDstMem, newRegionsIdx, &newRegions[0]);
                     }
                     else
                     {
                         // What happens?
                         PAL_ASSERT_ALWAYS();
                     }
-                } // End loop through "x" pixels
-
-                CmdCopyMemory(pCmdBuffer, *pSrcMem, *pDstMem, newRegionsIdx, &newRegions[0]);
-            }
-        } // End loop through "y" pixels
-    } // end loop through the slices
+                }
+            } // End loop through "y" pixels
+        } // end loop through the slices
+    }
 }
 
 // ====================================================================================================================
@@ -69,6 +69,12 @@ UniversalCmdBuffer::UniversalCmdBuffer(
 
     SwitchCmdSetUserDataFunc(PipelineBindPoint::Compute,  &GfxCmdBuffer::CmdSetUserDataCs);
     SwitchCmdSetUserDataFunc(PipelineBindPoint::Graphics, &CmdSetUserDataGfx<true>);
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    // Hardware layers which can batch draws more efficiently will overwrite these.
+    m_funcTable.pfnCmdDrawMulti        = CmdDrawMultiSequential;
+    m_funcTable.pfnCmdDrawIndexedMulti = CmdDrawIndexedMultiSequential;
+#endif
 }
 
 // =====================================================================================================================
@@ -155,6 +161,8 @@ Result UniversalCmdBuffer::End()
         m_graphicsState.leakFlags.u32All |= m_graphicsState.dirtyFlags.u32All;
 
 #if PAL_ENABLE_PRINTS_ASSERTS
+        LogRecordingStats();
+
         if (IsDumpingEnabled() && DumpFile()->IsOpen())
         {
             if (m_device.Parent()->Settings().cmdBufDumpFormat == CmdBufDumpFormatBinaryHeaders)
@@ -327,6 +335,60 @@ void PAL_STDCALL UniversalCmdBuffer::CmdSetUserDataGfx<true>(
     uint32        entryCount,
     const uint32* pEntryValues);
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+// =====================================================================================================================
+// Issues a batch of non-indexed draws one at a time through the command buffer's CmdDraw callback.  This is the
+// fallback for hardware layers (or states) which have no batched path.
+void PAL_STDCALL UniversalCmdBuffer::CmdDrawMultiSequential(
+    ICmdBuffer*             pCmdBuffer,
+    uint32                  drawCount,
+    const DrawIndirectArgs* pDrawArgs,
+    uint32                  userDataEntry,
+    const uint32*           pUserDataValues)
+{
+    PAL_ASSERT((drawCount == 0) || (pDrawArgs != nullptr));
+
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        if (pUserDataValues != nullptr)
+        {
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics, userDataEntry, 1, &pUserDataValues[i]);
+        }
+
+        const DrawIndirectArgs& args = pDrawArgs[i];
+        pCmdBuffer->CmdDraw(args.firstVertex, args.vertexCount, args.firstInstance, args.instanceCount);
+    }
+}
+
+// =====================================================================================================================
+// Issues a batch of indexed draws one at a time through the command buffer's CmdDrawIndexed callback.  This is the
+// fallback for hardware layers (or states) which have no batched path.
+void PAL_STDCALL UniversalCmdBuffer::CmdDrawIndexedMultiSequential(
+    ICmdBuffer*                    pCmdBuffer,
+    uint32                         drawCount,
+    const DrawIndexedIndirectArgs* pDrawArgs,
+    uint32                         userDataEntry,
+    const uint32*                  pUserDataValues)
+{
+    PAL_ASSERT((drawCount == 0) || (pDrawArgs != nullptr));
+
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        if (pUserDataValues != nullptr)
+        {
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Graphics, userDataEntry, 1, &pUserDataValues[i]);
+        }
+
+        const DrawIndexedIndirectArgs& args = pDrawArgs[i];
+        pCmdBuffer->CmdDrawIndexed(args.firstIndex,
+                                   args.indexCount,
+                                   args.vertexOffset,
+                                   args.firstInstance,
+                                   args.instanceCount);
+    }
+}
+#endif
+
 // =====================================================================================================================
 // Compares the client-specified user data update parameters against the current user data values, and filters any
 // redundant updates at the beginning of ending of the range.  Filtering redundant values in the middle of the range
@@ -482,6 +544,8 @@ void UniversalCmdBuffer::PushGraphicsState()
     m_graphicsRestoreState = m_graphicsState;
     memset(&m_graphicsState.gfxUserDataEntries.touched[0], 0, sizeof(m_graphicsState.gfxUserDataEntries.touched));
 
+    SuspendUserDataPatching(PipelineBindPoint::Graphics);
+
     if (m_pCurrentExperiment != nullptr)
     {
         // Inform the performance experiment that we're starting some internal operations.
@@ -505,6 +569,8 @@ void UniversalCmdBuffer::PopGraphicsState()
 
     SetGraphicsState(m_graphicsRestoreState);
 
+    ResumeUserDataPatching(PipelineBindPoint::Graphics);
+
     // All RMP GFX Blts should push/pop command buffer's graphics state,
     // so this is a safe opprotunity to mark that a GFX Blt is active
     SetGfxCmdBufGfxBltState(true);
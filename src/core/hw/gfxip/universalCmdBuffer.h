@@ -247,6 +247,21 @@ protected:
 
     bool FilterSetUserDataGfx(UserDataArgs* pUserDataArgs);
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    static void PAL_STDCALL CmdDrawMultiSequential(
+        ICmdBuffer*             pCmdBuffer,
+        uint32                  drawCount,
+        const DrawIndirectArgs* pDrawArgs,
+        uint32                  userDataEntry,
+        const uint32*           pUserDataValues);
+    static void PAL_STDCALL CmdDrawIndexedMultiSequential(
+        ICmdBuffer*                    pCmdBuffer,
+        uint32                         drawCount,
+        const DrawIndexedIndirectArgs* pDrawArgs,
+        uint32                         userDataEntry,
+        const uint32*                  pUserDataValues);
+#endif
+
     virtual void SetGraphicsState(const GraphicsState& newGraphicsState);
 
     GraphicsState  m_graphicsState;        // Currently bound graphics command buffer state.
@@ -924,6 +924,99 @@ Result Image::GetSubresourceLayout(
     return ret;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 489
+// =====================================================================================================================
+// Checks the parameters which are common to CpuCopyToImage() and CpuCopyFromImage().
+Result Image::ValidateCpuCopy(
+    const void*               pSrc,
+    const void*               pDst,
+    uint32                    regionCount,
+    const CpuImageCopyRegion* pRegions
+    ) const
+{
+    Result result = Result::Success;
+
+    if ((pSrc == nullptr) || (pDst == nullptr) || ((regionCount > 0) && (pRegions == nullptr)))
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else if ((m_gpuMemLayout.metadataSize > 0) || (m_createInfo.samples > 1))
+    {
+        // The CPU can neither read nor write compressed data, and there is no CPU path for MSAA surfaces.
+        result = Result::ErrorUnavailable;
+    }
+
+    const bool is3dImage = (m_createInfo.imageType == ImageType::Tex3d);
+
+    for (uint32 idx = 0; (result == Result::Success) && (idx < regionCount); ++idx)
+    {
+        const CpuImageCopyRegion& region = pRegions[idx];
+
+        if ((IsSubresourceValid(region.imageSubres) == false) ||
+            (region.numSlices == 0)                           ||
+            (is3dImage && (region.numSlices != 1))            ||
+            ((region.imageSubres.arraySlice + region.numSlices) > m_createInfo.arraySize))
+        {
+            result = Result::ErrorInvalidValue;
+        }
+        else
+        {
+            const Extent3d& extent = SubresourceInfo(region.imageSubres)->extentElements;
+
+            if ((region.imageOffset.x < 0) ||
+                (region.imageOffset.y < 0) ||
+                (region.imageOffset.z < 0) ||
+                ((region.imageOffset.x + region.imageExtent.width)  > extent.width)  ||
+                ((region.imageOffset.y + region.imageExtent.height) > extent.height) ||
+                ((region.imageOffset.z + region.imageExtent.depth)  > extent.depth))
+            {
+                result = Result::ErrorInvalidValue;
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result Image::CpuCopyToImage(
+    const void*               pSrcData,
+    void*                     pImageData,
+    uint32                    regionCount,
+    const CpuImageCopyRegion* pRegions,
+    uint32                    maxThreadCount
+    ) const
+{
+    Result result = ValidateCpuCopy(pSrcData, pImageData, regionCount, pRegions);
+
+    if ((result == Result::Success) && (regionCount > 0))
+    {
+        result = m_pGfxImage->CpuCopy(pSrcData, pImageData, regionCount, pRegions, maxThreadCount, true);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result Image::CpuCopyFromImage(
+    const void*               pImageData,
+    void*                     pDstData,
+    uint32                    regionCount,
+    const CpuImageCopyRegion* pRegions,
+    uint32                    maxThreadCount
+    ) const
+{
+    Result result = ValidateCpuCopy(pImageData, pDstData, regionCount, pRegions);
+
+    if ((result == Result::Success) && (regionCount > 0))
+    {
+        result = m_pGfxImage->CpuCopy(pImageData, pDstData, regionCount, pRegions, maxThreadCount, false);
+    }
+
+    return result;
+}
+#endif
+
 // =====================================================================================================================
 Result Image::BindGpuMemory(
     IGpuMemory* pGpuMemory,
@@ -272,6 +272,20 @@ public:
     void DestroyInternal();
 
     virtual Result GetSubresourceLayout(SubresId subresId, SubresLayout* pLayout) const override;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 489
+    virtual Result CpuCopyToImage(
+        const void*               pSrcData,
+        void*                     pImageData,
+        uint32                    regionCount,
+        const CpuImageCopyRegion* pRegions,
+        uint32                    maxThreadCount) const override;
+    virtual Result CpuCopyFromImage(
+        const void*               pImageData,
+        void*                     pDstData,
+        uint32                    regionCount,
+        const CpuImageCopyRegion* pRegions,
+        uint32                    maxThreadCount) const override;
+#endif
     virtual Result BindGpuMemory(IGpuMemory* pGpuMemory, gpusize offset) override;
 
     Device* GetDevice() const { return m_pDevice; }
@@ -486,6 +500,14 @@ protected:
 private:
     uint32 DegradeMipDimension(uint32  mipDimension) const;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 489
+    Result ValidateCpuCopy(
+        const void*               pSrc,
+        const void*               pDst,
+        uint32                    regionCount,
+        const CpuImageCopyRegion* pRegions) const;
+#endif
+
     static Result CreatePrivateScreenImageMemoryObject(
         Device*      pDevice,
         IImage*      pImage,
@@ -2319,6 +2319,7 @@ ADDR_E_RETURNCODE ADDR_API AddrGetMaxMetaAlignments(
 ****************************************************************************************************
 *     Addr2ComputeSurfaceInfo()
 *     Addr2ComputeSurfaceAddrFromCoord()
+*     Addr2ComputeSurfaceAddrFromCoordSpan()
 *     Addr2ComputeSurfaceCoordFromAddr()
 
 *     Addr2ComputeHtileInfo()
@@ -2566,6 +2567,55 @@ ADDR_E_RETURNCODE ADDR_API Addr2ComputeSurfaceAddrFromCoord(
     const ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT*    pIn,
     ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_OUTPUT*         pOut);
 
+/**
+****************************************************************************************************
+*   ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_INPUT
+*
+*   @brief
+*       Input structure for Addr2ComputeSurfaceAddrFromCoordSpan
+****************************************************************************************************
+*/
+typedef struct _ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_INPUT
+{
+    UINT_32                                   size;      ///< Size of this structure in bytes
+
+    ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT coordIn;   ///< Surface info and the coordinate of the first
+                                                         ///  element of the span
+    UINT_32                                   numElems;  ///< Number of consecutive X coordinates, starting
+                                                         ///  at coordIn.x, to compute addresses for
+} ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_INPUT;
+
+/**
+****************************************************************************************************
+*   ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_OUTPUT
+*
+*   @brief
+*       Output structure for Addr2ComputeSurfaceAddrFromCoordSpan
+****************************************************************************************************
+*/
+typedef struct _ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_OUTPUT
+{
+    UINT_32    size;             ///< Size of this structure in bytes
+
+    UINT_64*   pAddr;            ///< Client provided array of numElems entries which receives the
+                                 ///  byte address of each element of the span
+} ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_OUTPUT;
+
+/**
+****************************************************************************************************
+*   Addr2ComputeSurfaceAddrFromCoordSpan
+*
+*   @brief
+*       Compute surface addresses for a run of consecutive X coordinates on one row. This is
+*       equivalent to calling Addr2ComputeSurfaceAddrFromCoord once per element, but the surface
+*       layout is only computed a handful of times per span rather than once per element.
+****************************************************************************************************
+*/
+ADDR_E_RETURNCODE ADDR_API Addr2ComputeSurfaceAddrFromCoordSpan(
+    ADDR_HANDLE                                             hLib,
+    const ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_INPUT*   pIn,
+    ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_OUTPUT*        pOut);
+
 /**
 ****************************************************************************************************
 *   ADDR2_COMPUTE_SURFACE_COORDFROMADDR_INPUT
@@ -1189,6 +1189,38 @@ ADDR_E_RETURNCODE ADDR_API Addr2ComputeSurfaceAddrFromCoord(
     return returnCode;
 }
 
+/**
+****************************************************************************************************
+*   Addr2ComputeSurfaceAddrFromCoordSpan
+*
+*   @brief
+*       Compute surface addresses for a run of consecutive X coordinates
+*
+*   @return
+*       ADDR_OK if successful, otherwise an error code of ADDR_E_RETURNCODE
+****************************************************************************************************
+*/
+ADDR_E_RETURNCODE ADDR_API Addr2ComputeSurfaceAddrFromCoordSpan(
+    ADDR_HANDLE                                             hLib, ///< address lib handle
+    const ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_INPUT*   pIn,  ///< [in] surface info and span
+    ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_OUTPUT*        pOut) ///< [out] surface addresses
+{
+    V2::Lib* pLib = V2::Lib::GetLib(hLib);
+
+    ADDR_E_RETURNCODE returnCode = ADDR_OK;
+
+    if (pLib != NULL)
+    {
+        returnCode = pLib->ComputeSurfaceAddrFromCoordSpan(pIn, pOut);
+    }
+    else
+    {
+        returnCode = ADDR_ERROR;
+    }
+
+    return returnCode;
+}
+
 /**
 ****************************************************************************************************
 *   Addr2ComputeSurfaceCoordFromAddr
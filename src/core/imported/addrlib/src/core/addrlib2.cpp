@@ -384,6 +384,81 @@ ADDR_E_RETURNCODE Lib::ComputeSurfaceAddrFromCoord(
     return returnCode;
 }
 
+/**
+************************************************************************************************************************
+*   Lib::ComputeSurfaceAddrFromCoordSpan
+*
+*   @brief
+*       Interface function stub of Addr2ComputeSurfaceAddrFromCoordSpan.
+*
+*   @return
+*       ADDR_E_RETURNCODE
+************************************************************************************************************************
+*/
+ADDR_E_RETURNCODE Lib::ComputeSurfaceAddrFromCoordSpan(
+    const ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_INPUT* pIn,    ///< [in] input structure
+    ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_OUTPUT*      pOut    ///< [out] output structure
+    ) const
+{
+    ADDR_E_RETURNCODE returnCode = ADDR_OK;
+
+    if (GetFillSizeFieldsFlags() == TRUE)
+    {
+        if ((pIn->size != sizeof(ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_INPUT)) ||
+            (pOut->size != sizeof(ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_OUTPUT)))
+        {
+            returnCode = ADDR_PARAMSIZEMISMATCH;
+        }
+    }
+
+    const UINT_32 firstX   = pIn->coordIn.x;
+    const UINT_32 numElems = pIn->numElems;
+
+    if ((pOut->pAddr == NULL) ||
+        (numElems == 0)       ||
+        ((firstX + (numElems - 1)) < firstX))
+    {
+        returnCode = ADDR_INVALIDPARAMS;
+    }
+
+    ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT localIn = pIn->coordIn;
+    localIn.size            = sizeof(ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT);
+    localIn.unalignedWidth  = Max(localIn.unalignedWidth, 1u);
+    localIn.unalignedHeight = Max(localIn.unalignedHeight, 1u);
+    localIn.numMipLevels    = Max(localIn.numMipLevels, 1u);
+    localIn.numSlices       = Max(localIn.numSlices, 1u);
+    localIn.numSamples      = Max(localIn.numSamples, 1u);
+    localIn.numFrags        = Max(localIn.numFrags, 1u);
+
+    ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_OUTPUT localOut = {0};
+    localOut.size = sizeof(ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_OUTPUT);
+
+    if (returnCode == ADDR_OK)
+    {
+        // This validates the rest of the input.
+        returnCode = ComputeSurfaceAddrFromCoord(&localIn, &localOut);
+    }
+
+    if (returnCode == ADDR_OK)
+    {
+        if (IsLinear(localIn.swizzleMode))
+        {
+            const UINT_32 elementBytes = localIn.bpp >> 3;
+
+            for (UINT_32 i = 0; i < numElems; i++)
+            {
+                pOut->pAddr[i] = localOut.addr + (static_cast<UINT_64>(i) * elementBytes);
+            }
+        }
+        else
+        {
+            returnCode = ComputeSurfaceAddrFromCoordSpanTiled(&localIn, numElems, localOut.addr, pOut->pAddr);
+        }
+    }
+
+    return returnCode;
+}
+
 /**
 ************************************************************************************************************************
 *   Lib::ComputeSurfaceCoordFromAddr
@@ -1182,6 +1257,101 @@ ADDR_E_RETURNCODE Lib::ComputeSurfaceAddrFromCoordTiled(
     return HwlComputeSurfaceAddrFromCoordTiled(pIn, pOut);
 }
 
+/**
+************************************************************************************************************************
+*   Lib::ComputeSurfaceAddrFromCoordSpanTiled
+*
+*   @brief
+*       Internal function to calculate addresses for a run of X coordinates on a tiled swizzle surface.
+*
+*       Every tiled swizzle mode computes each bit of the offset within a block as the XOR of a set of coordinate bits
+*       (see ADDR_EQUATION), so along one row the block offset of x is the block offset of the first element XORed
+*       with one term for every bit in which x differs from the first X coordinate. Only those terms are computed
+*       through the per-element path; every other element costs one XOR. The block index part of the address simply
+*       advances by one every blockWidth elements.
+*
+*   @return
+*       ADDR_E_RETURNCODE
+************************************************************************************************************************
+*/
+ADDR_E_RETURNCODE Lib::ComputeSurfaceAddrFromCoordSpanTiled(
+    const ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT* pIn,       ///< [in] input structure, x is the first element
+    UINT_32                                          numElems,  ///< [in] number of elements in the span
+    UINT_64                                          firstAddr, ///< [in] address of the first element
+    UINT_64*                                         pAddr      ///< [out] address of each element
+    ) const
+{
+    UINT_32 blockWidth  = 0;
+    UINT_32 blockHeight = 0;
+    UINT_32 blockDepth  = 0;
+
+    ADDR_E_RETURNCODE returnCode = ComputeBlockDimensionForSurf(&blockWidth,
+                                                                &blockHeight,
+                                                                &blockDepth,
+                                                                pIn->bpp,
+                                                                pIn->numFrags,
+                                                                pIn->resourceType,
+                                                                pIn->swizzleMode);
+
+    if (returnCode == ADDR_OK)
+    {
+        const UINT_32 log2BlkSize  = GetBlockSizeLog2(pIn->swizzleMode);
+        const UINT_64 blkMask      = (static_cast<UINT_64>(1) << log2BlkSize) - 1;
+        const UINT_32 log2BlkWidth = Log2(blockWidth);
+        const UINT_32 firstX       = pIn->x;
+        const UINT_32 lastX        = firstX + (numElems - 1);
+
+        // Bits of X which don't change anywhere in the span are already accounted for by firstAddr.
+        const UINT_32 numVaryingBits = (firstX == lastX) ? 0 : (Log2NonPow2(firstX ^ lastX) + 1);
+
+        // stepXor[i] holds the XOR of the terms of X bits 0 to i, which is what changes in the block offset when an
+        // increment of X carries into bit i.
+        UINT_64 stepXor[32] = {0};
+        UINT_64 termXor     = 0;
+
+        ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT  probeIn  = *pIn;
+        ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_OUTPUT probeOut = {0};
+        probeOut.size = sizeof(ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_OUTPUT);
+
+        for (UINT_32 bit = 0; (bit < numVaryingBits) && (returnCode == ADDR_OK); bit++)
+        {
+            probeIn.x  = firstX ^ (1u << bit);
+            returnCode = ComputeSurfaceAddrFromCoordTiled(&probeIn, &probeOut);
+
+            termXor     ^= ((probeOut.addr ^ firstAddr) & blkMask);
+            stepXor[bit] = termXor;
+        }
+
+        if (returnCode == ADDR_OK)
+        {
+            const UINT_64 rowBlockIndex = (firstAddr >> log2BlkSize) - (firstX >> log2BlkWidth);
+            UINT_64       blockOffset   = firstAddr & blkMask;
+
+            pAddr[0] = firstAddr;
+
+            for (UINT_32 i = 1; i < numElems; i++)
+            {
+                const UINT_32 x = firstX + i;
+
+                // Going from x - 1 to x flips bit 0 up to the lowest set bit of x.
+                blockOffset ^= stepXor[Log2NonPow2(x ^ (x - 1))];
+
+                pAddr[i] = blockOffset | ((rowBlockIndex + (x >> log2BlkWidth)) << log2BlkSize);
+            }
+
+#if DEBUG
+            probeIn.x = lastX;
+            if (ComputeSurfaceAddrFromCoordTiled(&probeIn, &probeOut) == ADDR_OK)
+            {
+                ADDR_ASSERT(probeOut.addr == pAddr[numElems - 1]);
+            }
+#endif
+        }
+    }
+
+    return returnCode;
+}
+
 /**
 ************************************************************************************************************************
 *   Lib::ComputeSurfaceCoordFromAddrLinear
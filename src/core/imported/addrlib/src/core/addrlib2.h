@@ -141,6 +141,10 @@ public:
         const ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT* pIn,
         ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_OUTPUT*      pOut) const;
 
+    ADDR_E_RETURNCODE ComputeSurfaceAddrFromCoordSpan(
+        const ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_INPUT* pIn,
+        ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_SPAN_OUTPUT*      pOut) const;
+
     ADDR_E_RETURNCODE ComputeSurfaceCoordFromAddr(
         const ADDR2_COMPUTE_SURFACE_COORDFROMADDR_INPUT* pIn,
         ADDR2_COMPUTE_SURFACE_COORDFROMADDR_OUTPUT*      pOut) const;
@@ -616,6 +620,12 @@ protected:
         const ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT* pIn,
         ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_OUTPUT*      pOut) const;
 
+    ADDR_E_RETURNCODE ComputeSurfaceAddrFromCoordSpanTiled(
+        const ADDR2_COMPUTE_SURFACE_ADDRFROMCOORD_INPUT* pIn,
+        UINT_32                                          numElems,
+        UINT_64                                          firstAddr,
+        UINT_64*                                         pAddr) const;
+
     ADDR_E_RETURNCODE ComputeSurfaceCoordFromAddrLinear(
         const ADDR2_COMPUTE_SURFACE_COORDFROMADDR_INPUT* pIn,
         ADDR2_COMPUTE_SURFACE_COORDFROMADDR_OUTPUT*      pOut) const;
@@ -904,6 +904,10 @@ CmdBuffer::CmdBuffer(
     m_funcTable.pfnCmdDrawIndexed              = CmdDrawIndexed;
     m_funcTable.pfnCmdDrawIndirectMulti        = CmdDrawIndirectMulti;
     m_funcTable.pfnCmdDrawIndexedIndirectMulti = CmdDrawIndexedIndirectMulti;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    m_funcTable.pfnCmdDrawMulti                = CmdDrawMulti;
+    m_funcTable.pfnCmdDrawIndexedMulti         = CmdDrawIndexedMulti;
+#endif
     m_funcTable.pfnCmdDispatch                 = CmdDispatch;
     m_funcTable.pfnCmdDispatchIndirect         = CmdDispatchIndirect;
     m_funcTable.pfnCmdDispatchOffset           = CmdDispatchOffset;
@@ -2797,6 +2801,123 @@ void PAL_STDCALL CmdBuffer::CmdDrawIndexedIndirectMulti(
     pThis->HandleDrawDispatch(true);
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+// =====================================================================================================================
+void PAL_STDCALL CmdBuffer::CmdDrawMulti(
+    ICmdBuffer*             pCmdBuffer,
+    uint32                  drawCount,
+    const DrawIndirectArgs* pDrawArgs,
+    uint32                  userDataEntry,
+    const uint32*           pUserDataValues)
+{
+    auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+
+    if (pThis->m_annotations.logCmdDraws)
+    {
+        pThis->GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdDrawMulti));
+
+        LinearAllocatorAuto<VirtualLinearAllocator> allocator(pThis->Allocator(), false);
+        char* pString = PAL_NEW_ARRAY(char, StringLength, &allocator, AllocInternalTemp);
+
+        Snprintf(pString, StringLength, "Draw Count      = 0x%08x", drawCount);
+        pThis->GetNextLayer()->CmdCommentString(pString);
+        Snprintf(pString, StringLength, "User Data Entry = 0x%08x", userDataEntry);
+        pThis->GetNextLayer()->CmdCommentString(pString);
+
+        for (uint32 i = 0; i < drawCount; ++i)
+        {
+            Snprintf(pString, StringLength, "pDrawArgs[%u] = { vertexCount = 0x%08x, instanceCount = 0x%08x, "
+                     "firstVertex = 0x%08x, firstInstance = 0x%08x }", i, pDrawArgs[i].vertexCount,
+                     pDrawArgs[i].instanceCount, pDrawArgs[i].firstVertex, pDrawArgs[i].firstInstance);
+            pThis->GetNextLayer()->CmdCommentString(pString);
+
+            if (pUserDataValues != nullptr)
+            {
+                Snprintf(pString, StringLength, "pUserDataValues[%u] = 0x%08x", i, pUserDataValues[i]);
+                pThis->GetNextLayer()->CmdCommentString(pString);
+            }
+        }
+
+        PAL_SAFE_DELETE_ARRAY(pString, &allocator);
+    }
+
+    if (pThis->m_singleStep.timestampDraws || pThis->m_singleStep.waitIdleDraws)
+    {
+        // Single-stepping needs its barrier or timestamp after every draw, so the batch must be split up.
+        for (uint32 i = 0; i < drawCount; ++i)
+        {
+            pThis->GetNextLayer()->CmdDrawMulti(1,
+                                                &pDrawArgs[i],
+                                                userDataEntry,
+                                                (pUserDataValues != nullptr) ? &pUserDataValues[i] : nullptr);
+            pThis->HandleDrawDispatch(true);
+        }
+    }
+    else
+    {
+        pThis->GetNextLayer()->CmdDrawMulti(drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+    }
+}
+
+// =====================================================================================================================
+void PAL_STDCALL CmdBuffer::CmdDrawIndexedMulti(
+    ICmdBuffer*                    pCmdBuffer,
+    uint32                         drawCount,
+    const DrawIndexedIndirectArgs* pDrawArgs,
+    uint32                         userDataEntry,
+    const uint32*                  pUserDataValues)
+{
+    auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+
+    if (pThis->m_annotations.logCmdDraws)
+    {
+        pThis->GetNextLayer()->CmdCommentString(GetCmdBufCallIdString(CmdBufCallId::CmdDrawIndexedMulti));
+
+        LinearAllocatorAuto<VirtualLinearAllocator> allocator(pThis->Allocator(), false);
+        char* pString = PAL_NEW_ARRAY(char, StringLength, &allocator, AllocInternalTemp);
+
+        Snprintf(pString, StringLength, "Draw Count      = 0x%08x", drawCount);
+        pThis->GetNextLayer()->CmdCommentString(pString);
+        Snprintf(pString, StringLength, "User Data Entry = 0x%08x", userDataEntry);
+        pThis->GetNextLayer()->CmdCommentString(pString);
+
+        for (uint32 i = 0; i < drawCount; ++i)
+        {
+            Snprintf(pString, StringLength, "pDrawArgs[%u] = { indexCount = 0x%08x, instanceCount = 0x%08x, "
+                     "firstIndex = 0x%08x, vertexOffset = 0x%08x, firstInstance = 0x%08x }", i,
+                     pDrawArgs[i].indexCount, pDrawArgs[i].instanceCount, pDrawArgs[i].firstIndex,
+                     pDrawArgs[i].vertexOffset, pDrawArgs[i].firstInstance);
+            pThis->GetNextLayer()->CmdCommentString(pString);
+
+            if (pUserDataValues != nullptr)
+            {
+                Snprintf(pString, StringLength, "pUserDataValues[%u] = 0x%08x", i, pUserDataValues[i]);
+                pThis->GetNextLayer()->CmdCommentString(pString);
+            }
+        }
+
+        PAL_SAFE_DELETE_ARRAY(pString, &allocator);
+    }
+
+    if (pThis->m_singleStep.timestampDraws || pThis->m_singleStep.waitIdleDraws)
+    {
+        // Single-stepping needs its barrier or timestamp after every draw, so the batch must be split up.
+        for (uint32 i = 0; i < drawCount; ++i)
+        {
+            pThis->GetNextLayer()->CmdDrawIndexedMulti(1,
+                                                       &pDrawArgs[i],
+                                                       userDataEntry,
+                                                       (pUserDataValues != nullptr) ? &pUserDataValues[i] : nullptr);
+            pThis->HandleDrawDispatch(true);
+        }
+    }
+    else
+    {
+        pThis->GetNextLayer()->CmdDrawIndexedMulti(drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+    }
+}
+#endif
+
 // =====================================================================================================================
 void PAL_STDCALL CmdBuffer::CmdDispatch(
     ICmdBuffer* pCmdBuffer,
@@ -4348,6 +4469,18 @@ uint32 CmdBuffer::GetEmbeddedDataLimit() const
     return GetNextLayer()->GetEmbeddedDataLimit();
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+// =====================================================================================================================
+Result CmdBuffer::PatchUserData(
+    PipelineBindPoint bindPoint,
+    uint32            firstEntry,
+    uint32            entryCount,
+    const uint32*     pEntryValues)
+{
+    return GetNextLayer()->PatchUserData(bindPoint, firstEntry, entryCount, pEntryValues);
+}
+#endif
+
 // =====================================================================================================================
 uint32* CmdBuffer::CmdAllocateEmbeddedData(
     uint32   sizeInDwords,
@@ -1128,6 +1128,106 @@ Result DeviceDecorator::CreateGraphicsPipeline(
     return result;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 487
+// =====================================================================================================================
+// Helper for layers which wrap the pipelines of a CreateGraphicsPipelines() call.  Creates the next layer's pipelines,
+// which each follow a layer object of the given size in their placement address, and returns them in ppNextPipelines.
+// Every pipeline which was not created is returned as null.
+Result DeviceDecorator::CreateNextLayerGraphicsPipelines(
+    uint32                            count,
+    const GraphicsPipelineCreateInfo* pCreateInfos,
+    void*const*                       ppPlacementAddrs,
+    size_t                            layerObjectSize,
+    IPipeline**                       ppNextPipelines,
+    Result*                           pResults,
+    PipelineBatchStats*               pStats)
+{
+    Result result               = Result::Success;
+    void** ppNextPlacementAddrs = nullptr;
+
+    if ((count > 0) && ((pCreateInfos == nullptr) || (ppPlacementAddrs == nullptr) || (ppNextPipelines == nullptr)))
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else if (count > 0)
+    {
+        ppNextPlacementAddrs = PAL_NEW_ARRAY(void*, count, m_pPlatform, AllocInternalTemp);
+
+        if (ppNextPlacementAddrs == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+        else
+        {
+            for (uint32 i = 0; i < count; ++i)
+            {
+                ppNextPlacementAddrs[i] = VoidPtrInc(ppPlacementAddrs[i], layerObjectSize);
+            }
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pNextLayer->CreateGraphicsPipelines(count,
+                                                       pCreateInfos,
+                                                       ppNextPlacementAddrs,
+                                                       ppNextPipelines,
+                                                       pResults,
+                                                       pStats);
+    }
+    else if (ppNextPipelines != nullptr)
+    {
+        for (uint32 i = 0; i < count; ++i)
+        {
+            ppNextPipelines[i] = nullptr;
+
+            if (pResults != nullptr)
+            {
+                pResults[i] = result;
+            }
+        }
+    }
+
+    PAL_SAFE_DELETE_ARRAY(ppNextPlacementAddrs, m_pPlatform);
+
+    return result;
+}
+#endif
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 487
+// =====================================================================================================================
+Result DeviceDecorator::CreateGraphicsPipelines(
+    uint32                            count,
+    const GraphicsPipelineCreateInfo* pCreateInfos,
+    void*const*                       ppPlacementAddrs,
+    IPipeline**                       ppPipelines,
+    Result*                           pResults,
+    PipelineBatchStats*               pStats)
+{
+    const Result result = CreateNextLayerGraphicsPipelines(count,
+                                                           pCreateInfos,
+                                                           ppPlacementAddrs,
+                                                           sizeof(PipelineDecorator),
+                                                           ppPipelines,
+                                                           pResults,
+                                                           pStats);
+
+    for (uint32 i = 0; (ppPipelines != nullptr) && (i < count); ++i)
+    {
+        IPipeline*const pNextPipeline = ppPipelines[i];
+
+        if (pNextPipeline != nullptr)
+        {
+            pNextPipeline->SetClientData(ppPlacementAddrs[i]);
+
+            ppPipelines[i] = PAL_PLACEMENT_NEW(ppPlacementAddrs[i]) PipelineDecorator(pNextPipeline, this);
+        }
+    }
+
+    return result;
+}
+#endif
+
 // =====================================================================================================================
 size_t DeviceDecorator::GetMsaaStateSize(
     const MsaaStateCreateInfo& createInfo,
@@ -773,6 +773,16 @@ public:
         void*                             pPlacementAddr,
         IPipeline**                       ppPipeline) override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 487
+    virtual Result CreateGraphicsPipelines(
+        uint32                            count,
+        const GraphicsPipelineCreateInfo* pCreateInfos,
+        void*const*                       ppPlacementAddrs,
+        IPipeline**                       ppPipelines,
+        Result*                           pResults,
+        PipelineBatchStats*               pStats) override;
+#endif
+
     virtual size_t GetMsaaStateSize(
         const MsaaStateCreateInfo& createInfo,
         Result*                    pResult) const override;
@@ -1079,6 +1089,17 @@ public:
     PlatformDecorator*        GetPlatform()  const { return m_pPlatform; }
 
 protected:
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 487
+    Result CreateNextLayerGraphicsPipelines(
+        uint32                            count,
+        const GraphicsPipelineCreateInfo* pCreateInfos,
+        void*const*                       ppPlacementAddrs,
+        size_t                            layerObjectSize,
+        IPipeline**                       ppNextPipelines,
+        Result*                           pResults,
+        PipelineBatchStats*               pStats);
+#endif
+
     DeviceFinalizeInfo      m_finalizeInfo;
     IDevice*const           m_pNextLayer;
     PlatformDecorator*      m_pPlatform;
@@ -1209,6 +1230,10 @@ public:
         m_funcTable.pfnCmdDrawIndexed              = CmdDrawIndexedDecorator;
         m_funcTable.pfnCmdDrawIndirectMulti        = CmdDrawIndirectMultiDecorator;
         m_funcTable.pfnCmdDrawIndexedIndirectMulti = CmdDrawIndexedIndirectMultiDecorator;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+        m_funcTable.pfnCmdDrawMulti                = CmdDrawMultiDecorator;
+        m_funcTable.pfnCmdDrawIndexedMulti         = CmdDrawIndexedMultiDecorator;
+#endif
         m_funcTable.pfnCmdDispatch                 = CmdDispatchDecorator;
         m_funcTable.pfnCmdDispatchIndirect         = CmdDispatchIndirectDecorator;
         m_funcTable.pfnCmdDispatchOffset           = CmdDispatchOffsetDecorator;
@@ -1226,6 +1251,15 @@ public:
     virtual uint32 GetEmbeddedDataLimit() const override
         { return m_pNextLayer->GetEmbeddedDataLimit(); }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+    virtual Result PatchUserData(
+        PipelineBindPoint bindPoint,
+        uint32            firstEntry,
+        uint32            entryCount,
+        const uint32*     pEntryValues) override
+        { return m_pNextLayer->PatchUserData(bindPoint, firstEntry, entryCount, pEntryValues); }
+#endif
+
     virtual void CmdBindPipeline(
         const PipelineBindParams& params) override
         { m_pNextLayer->CmdBindPipeline(NextPipelineBindParams(params)); }
@@ -2073,6 +2107,30 @@ private:
         pNextLayer->CmdDrawIndexedIndirectMulti(*NextGpuMemory(&gpuMemory), offset, stride, maximumCount, countGpuAddr);
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    static void PAL_STDCALL CmdDrawMultiDecorator(
+        ICmdBuffer*             pCmdBuffer,
+        uint32                  drawCount,
+        const DrawIndirectArgs* pDrawArgs,
+        uint32                  userDataEntry,
+        const uint32*           pUserDataValues)
+    {
+        ICmdBuffer* pNextLayer = static_cast<CmdBufferFwdDecorator*>(pCmdBuffer)->m_pNextLayer;
+        pNextLayer->CmdDrawMulti(drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+    }
+
+    static void PAL_STDCALL CmdDrawIndexedMultiDecorator(
+        ICmdBuffer*                    pCmdBuffer,
+        uint32                         drawCount,
+        const DrawIndexedIndirectArgs* pDrawArgs,
+        uint32                         userDataEntry,
+        const uint32*                  pUserDataValues)
+    {
+        ICmdBuffer* pNextLayer = static_cast<CmdBufferFwdDecorator*>(pCmdBuffer)->m_pNextLayer;
+        pNextLayer->CmdDrawIndexedMulti(drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+    }
+#endif
+
     static void PAL_STDCALL CmdDispatchDecorator(
         ICmdBuffer* pCmdBuffer,
         uint32      x,
@@ -2379,6 +2437,24 @@ public:
         SubresLayout* pLayout) const override
         { return m_pNextLayer->GetSubresourceLayout(subresId, pLayout); }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 489
+    virtual Result CpuCopyToImage(
+        const void*               pSrcData,
+        void*                     pImageData,
+        uint32                    regionCount,
+        const CpuImageCopyRegion* pRegions,
+        uint32                    maxThreadCount) const override
+        { return m_pNextLayer->CpuCopyToImage(pSrcData, pImageData, regionCount, pRegions, maxThreadCount); }
+
+    virtual Result CpuCopyFromImage(
+        const void*               pImageData,
+        void*                     pDstData,
+        uint32                    regionCount,
+        const CpuImageCopyRegion* pRegions,
+        uint32                    maxThreadCount) const override
+        { return m_pNextLayer->CpuCopyFromImage(pImageData, pDstData, regionCount, pRegions, maxThreadCount); }
+#endif
+
     virtual void GetGpuMemoryRequirements(
         GpuMemoryRequirements* pGpuMemReqs) const override
         { m_pNextLayer->GetGpuMemoryRequirements(pGpuMemReqs); }
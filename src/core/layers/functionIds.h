@@ -74,6 +74,10 @@ enum class CmdBufCallId : uint32
     CmdDrawIndexed,
     CmdDrawIndirectMulti,
     CmdDrawIndexedIndirectMulti,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    CmdDrawMulti,
+    CmdDrawIndexedMulti,
+#endif
     CmdDispatch,
     CmdDispatchIndirect,
     CmdDispatchOffset,
@@ -192,6 +196,10 @@ static const char* CmdBufCallIdStrings[] =
     "CmdDrawIndexed()",
     "CmdDrawIndirectMulti()",
     "CmdDrawIndexedIndirectMulti()",
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    "CmdDrawMulti()",
+    "CmdDrawIndexedMulti()",
+#endif
     "CmdDispatch()",
     "CmdDispatchIndirect()",
     "CmdDispatchOffset()",
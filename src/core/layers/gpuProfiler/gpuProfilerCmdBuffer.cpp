@@ -74,6 +74,10 @@ CmdBuffer::CmdBuffer(
     m_funcTable.pfnCmdDrawIndexed              = CmdDrawIndexed;
     m_funcTable.pfnCmdDrawIndirectMulti        = CmdDrawIndirectMulti;
     m_funcTable.pfnCmdDrawIndexedIndirectMulti = CmdDrawIndexedIndirectMulti;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    m_funcTable.pfnCmdDrawMulti                = CmdDrawMulti;
+    m_funcTable.pfnCmdDrawIndexedMulti         = CmdDrawIndexedMulti;
+#endif
     m_funcTable.pfnCmdDispatch                 = CmdDispatch;
     m_funcTable.pfnCmdDispatchIndirect         = CmdDispatchIndirect;
     m_funcTable.pfnCmdDispatchOffset           = CmdDispatchOffset;
@@ -1327,6 +1331,92 @@ void CmdBuffer::ReplayCmdDrawIndexedIndirectMulti(
     LogPostTimedCall(pQueue, pTgtCmdBuffer, &logItem);
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+// =====================================================================================================================
+void PAL_STDCALL CmdBuffer::CmdDrawMulti(
+    ICmdBuffer*             pCmdBuffer,
+    uint32                  drawCount,
+    const DrawIndirectArgs* pDrawArgs,
+    uint32                  userDataEntry,
+    const uint32*           pUserDataValues)
+{
+    auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+
+    pThis->InsertToken(CmdBufCallId::CmdDrawMulti);
+    pThis->InsertTokenArray(pDrawArgs, drawCount);
+    pThis->InsertToken(userDataEntry);
+    pThis->InsertTokenArray(pUserDataValues, (pUserDataValues != nullptr) ? drawCount : 0);
+}
+
+// =====================================================================================================================
+void CmdBuffer::ReplayCmdDrawMulti(
+    Queue*           pQueue,
+    TargetCmdBuffer* pTgtCmdBuffer)
+{
+    const DrawIndirectArgs* pDrawArgs       = nullptr;
+    const uint32            drawCount       = ReadTokenArray(&pDrawArgs);
+    const uint32            userDataEntry   = ReadTokenVal<uint32>();
+    const uint32*           pUserDataValues = nullptr;
+    ReadTokenArray(&pUserDataValues);
+
+    // The whole batch is timed as one call, so report the totals of all of its draws.
+    LogItem logItem = { };
+    logItem.cmdBufCall.flags.draw = 1;
+
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        logItem.cmdBufCall.draw.vertexCount   += pDrawArgs[i].vertexCount;
+        logItem.cmdBufCall.draw.instanceCount += pDrawArgs[i].instanceCount;
+    }
+
+    LogPreTimedCall(pQueue, pTgtCmdBuffer, &logItem, CmdBufCallId::CmdDrawMulti);
+    pTgtCmdBuffer->CmdDrawMulti(drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+    LogPostTimedCall(pQueue, pTgtCmdBuffer, &logItem);
+}
+
+// =====================================================================================================================
+void PAL_STDCALL CmdBuffer::CmdDrawIndexedMulti(
+    ICmdBuffer*                    pCmdBuffer,
+    uint32                         drawCount,
+    const DrawIndexedIndirectArgs* pDrawArgs,
+    uint32                         userDataEntry,
+    const uint32*                  pUserDataValues)
+{
+    auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+
+    pThis->InsertToken(CmdBufCallId::CmdDrawIndexedMulti);
+    pThis->InsertTokenArray(pDrawArgs, drawCount);
+    pThis->InsertToken(userDataEntry);
+    pThis->InsertTokenArray(pUserDataValues, (pUserDataValues != nullptr) ? drawCount : 0);
+}
+
+// =====================================================================================================================
+void CmdBuffer::ReplayCmdDrawIndexedMulti(
+    Queue*           pQueue,
+    TargetCmdBuffer* pTgtCmdBuffer)
+{
+    const DrawIndexedIndirectArgs* pDrawArgs       = nullptr;
+    const uint32                   drawCount       = ReadTokenArray(&pDrawArgs);
+    const uint32                   userDataEntry   = ReadTokenVal<uint32>();
+    const uint32*                  pUserDataValues = nullptr;
+    ReadTokenArray(&pUserDataValues);
+
+    // The whole batch is timed as one call, so report the totals of all of its draws.
+    LogItem logItem = { };
+    logItem.cmdBufCall.flags.draw = 1;
+
+    for (uint32 i = 0; i < drawCount; ++i)
+    {
+        logItem.cmdBufCall.draw.vertexCount   += pDrawArgs[i].indexCount;
+        logItem.cmdBufCall.draw.instanceCount += pDrawArgs[i].instanceCount;
+    }
+
+    LogPreTimedCall(pQueue, pTgtCmdBuffer, &logItem, CmdBufCallId::CmdDrawIndexedMulti);
+    pTgtCmdBuffer->CmdDrawIndexedMulti(drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+    LogPostTimedCall(pQueue, pTgtCmdBuffer, &logItem);
+}
+#endif
+
 // =====================================================================================================================
 void PAL_STDCALL CmdBuffer::CmdDispatch(
     ICmdBuffer* pCmdBuffer,
@@ -2847,6 +2937,20 @@ uint32 CmdBuffer::GetEmbeddedDataLimit() const
     return NextLayer()->GetEmbeddedDataLimit();
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+// =====================================================================================================================
+// Commands recorded in this layer are replayed into separate target command buffers at submit time, so the next layer's
+// command buffer contains nothing which could be patched.
+Result CmdBuffer::PatchUserData(
+    PipelineBindPoint bindPoint,
+    uint32            firstEntry,
+    uint32            entryCount,
+    const uint32*     pEntryValues)
+{
+    return Result::Unsupported;
+}
+#endif
+
 // =====================================================================================================================
 uint32* CmdBuffer::CmdAllocateEmbeddedData(
     uint32   sizeInDwords,
@@ -3458,6 +3562,10 @@ void CmdBuffer::Replay(
         &CmdBuffer::ReplayCmdDrawIndexed,
         &CmdBuffer::ReplayCmdDrawIndirectMulti,
         &CmdBuffer::ReplayCmdDrawIndexedIndirectMulti,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+        &CmdBuffer::ReplayCmdDrawMulti,
+        &CmdBuffer::ReplayCmdDrawIndexedMulti,
+#endif
         &CmdBuffer::ReplayCmdDispatch,
         &CmdBuffer::ReplayCmdDispatchIndirect,
         &CmdBuffer::ReplayCmdDispatchOffset,
@@ -390,6 +390,13 @@ public:
         uint32            currRingPos,
         uint32            ringSize) override;
     virtual uint32 GetEmbeddedDataLimit() const override;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+    virtual Result PatchUserData(
+        PipelineBindPoint bindPoint,
+        uint32            firstEntry,
+        uint32            entryCount,
+        const uint32*     pEntryValues) override;
+#endif
     virtual uint32* CmdAllocateEmbeddedData(
         uint32   sizeInDwords,
         uint32   alignmentInDwords,
@@ -529,6 +536,20 @@ private:
         uint32            stride,
         uint32            maximumCount,
         gpusize           countGpuAddr);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    static void PAL_STDCALL CmdDrawMulti(
+        ICmdBuffer*             pCmdBuffer,
+        uint32                  drawCount,
+        const DrawIndirectArgs* pDrawArgs,
+        uint32                  userDataEntry,
+        const uint32*           pUserDataValues);
+    static void PAL_STDCALL CmdDrawIndexedMulti(
+        ICmdBuffer*                    pCmdBuffer,
+        uint32                         drawCount,
+        const DrawIndexedIndirectArgs* pDrawArgs,
+        uint32                         userDataEntry,
+        const uint32*                  pUserDataValues);
+#endif
     static void PAL_STDCALL CmdDispatch(
         ICmdBuffer* pCmdBuffer,
         uint32      x,
@@ -645,6 +666,10 @@ private:
     void ReplayCmdDrawIndexed(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdDrawIndirectMulti(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdDrawIndexedIndirectMulti(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    void ReplayCmdDrawMulti(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
+    void ReplayCmdDrawIndexedMulti(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
+#endif
     void ReplayCmdDispatch(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdDispatchIndirect(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
     void ReplayCmdDispatchOffset(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer);
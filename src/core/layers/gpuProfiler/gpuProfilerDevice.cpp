@@ -386,6 +386,61 @@ Result Device::CreateGraphicsPipeline(
     return result;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 487
+// =====================================================================================================================
+Result Device::CreateGraphicsPipelines(
+    uint32                            count,
+    const GraphicsPipelineCreateInfo* pCreateInfos,
+    void*const*                       ppPlacementAddrs,
+    IPipeline**                       ppPipelines,
+    Result*                           pResults,
+    PipelineBatchStats*               pStats)
+{
+    Result result = CreateNextLayerGraphicsPipelines(count,
+                                                     pCreateInfos,
+                                                     ppPlacementAddrs,
+                                                     sizeof(Pipeline),
+                                                     ppPipelines,
+                                                     pResults,
+                                                     pStats);
+
+    for (uint32 i = 0; (ppPipelines != nullptr) && (i < count); ++i)
+    {
+        IPipeline*const pNextPipeline = ppPipelines[i];
+
+        if (pNextPipeline != nullptr)
+        {
+            pNextPipeline->SetClientData(ppPlacementAddrs[i]);
+
+            Pipeline*const pPipeline = PAL_PLACEMENT_NEW(ppPlacementAddrs[i]) Pipeline(pNextPipeline, this);
+            const Result   initResult = pPipeline->InitGfx(pCreateInfos[i]);
+
+            if (initResult == Result::Success)
+            {
+                ppPipelines[i] = pPipeline;
+            }
+            else
+            {
+                pPipeline->Destroy();
+                ppPipelines[i] = nullptr;
+
+                if (pResults != nullptr)
+                {
+                    pResults[i] = initResult;
+                }
+
+                if (result == Result::Success)
+                {
+                    result = initResult;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+#endif
+
 // =====================================================================================================================
 size_t Device::GetComputePipelineSize(
     const ComputePipelineCreateInfo& createInfo,
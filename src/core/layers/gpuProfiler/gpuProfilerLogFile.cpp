@@ -0,0 +1,601 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/layers/gpuProfiler/gpuProfilerLogFile.h"
+#include "core/layers/gpuProfiler/gpuProfilerPlatform.h"
+#include "palFlatHashMapImpl.h"
+#include "palInlineFuncs.h"
+
+using namespace Util;
+
+namespace Pal
+{
+namespace GpuProfiler
+{
+
+// The number of bytes each column type takes up in a binary row.
+constexpr uint32 ColumnCellSizes[] =
+{
+    sizeof(uint64),     // Uint
+    sizeof(uint64),     // Hex64
+    2 * sizeof(uint64), // Hex128
+    sizeof(double),     // Double
+    sizeof(uint32),     // String
+};
+
+static_assert(ArrayLen(ColumnCellSizes) == static_cast<uint32>(LogColumnType::Count),
+              "Missing entry in ColumnCellSizes.");
+
+// =====================================================================================================================
+// Writes the given value as exactly 16 lowercase hexadecimal digits, matching printf's "%016llx".
+static void WriteHexDigits(
+    uint64 value,
+    char*  pOutput)
+{
+    constexpr char Digits[] = "0123456789abcdef";
+
+    for (int32 i = 15; i >= 0; i--)
+    {
+        pOutput[i] = Digits[value & 0xF];
+        value    >>= 4;
+    }
+}
+
+// =====================================================================================================================
+LogFile::LogFile(
+    Platform* pPlatform)
+    :
+    m_pPlatform(pPlatform),
+    m_binary(false),
+    m_pText(nullptr),
+    m_textCapacity(0),
+    m_textSize(0),
+    m_numColumns(0),
+    m_maskSize(0),
+    m_rowSize(0),
+    m_curColumn(0),
+    m_pRows(nullptr),
+    m_numRows(0),
+    m_maxRows(0),
+    m_numStrings(0),
+    m_nextStringId(0),
+    m_stringIds(256, pPlatform)
+{
+    memset(&m_columnTypes[0],   0, sizeof(m_columnTypes));
+    memset(&m_columnOffsets[0], 0, sizeof(m_columnOffsets));
+}
+
+// =====================================================================================================================
+LogFile::~LogFile()
+{
+    Close();
+    PAL_SAFE_FREE(m_pText, m_pPlatform);
+}
+
+// =====================================================================================================================
+Result LogFile::Init()
+{
+    return m_stringIds.Init();
+}
+
+// =====================================================================================================================
+// Closes the current file (if any) and opens a new one.  Columns must be added next, followed by EndHeader().
+Result LogFile::Open(
+    const char* pFilePath,
+    bool        binary)
+{
+    Close();
+
+    m_binary = binary;
+
+    Result result = m_file.Open(pFilePath, binary ? (FileAccessWrite | FileAccessBinary) : FileAccessWrite);
+
+    if ((result == Result::Success) && binary)
+    {
+        m_file.Write(&BinaryLogMagic[0], sizeof(BinaryLogMagic));
+        m_file.Write(&BinaryLogVersion, sizeof(BinaryLogVersion));
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Writes out any buffered binary rows and closes the file.
+void LogFile::Close()
+{
+    if (m_file.IsOpen())
+    {
+        if (m_binary)
+        {
+            FlushRows();
+        }
+
+        m_file.Close();
+    }
+
+    PAL_SAFE_FREE(m_pRows, m_pPlatform);
+    ResetStrings();
+
+    m_numColumns = 0;
+    m_curColumn  = 0;
+    m_numRows    = 0;
+    m_maxRows    = 0;
+}
+
+// =====================================================================================================================
+// Writes out any buffered binary rows and flushes the file to disk.
+void LogFile::Flush()
+{
+    if (m_file.IsOpen())
+    {
+        if (m_binary)
+        {
+            FlushRows();
+        }
+
+        m_file.Flush();
+    }
+}
+
+// =====================================================================================================================
+// Appends a column to the header row.
+void LogFile::AddColumn(
+    const char*   pName,
+    LogColumnType type)
+{
+    const uint32 length = static_cast<uint32>(strlen(pName));
+
+    if (m_binary == false)
+    {
+        AppendCell(pName, length);
+    }
+    else if (m_numColumns < MaxColumns)
+    {
+        const uint32 typeValue = static_cast<uint32>(type);
+
+        m_columnTypes[m_numColumns++] = type;
+
+        AppendText(&typeValue, sizeof(typeValue));
+        AppendText(&length, sizeof(length));
+        AppendText(pName, length);
+    }
+    else
+    {
+        PAL_ASSERT_ALWAYS();
+    }
+}
+
+// =====================================================================================================================
+// Writes out the header row.  In binary mode this also lays out the row format and allocates the row buffer.
+Result LogFile::EndHeader()
+{
+    Result result = Result::Success;
+
+    if (m_binary == false)
+    {
+        AppendText("\n", 1);
+        m_file.Write(m_pText, m_textSize);
+        m_textSize = 0;
+    }
+    else
+    {
+        WriteBlock(BinaryLogBlockColumns, m_numColumns, m_pText, m_textSize);
+        m_textSize = 0;
+
+        // Each row begins with one validity bit per column, padded out so that the cells which follow stay aligned.
+        m_maskSize = static_cast<uint32>(Pow2Align(m_numColumns, 64) / 8);
+        m_rowSize  = m_maskSize;
+
+        for (uint32 i = 0; i < m_numColumns; i++)
+        {
+            m_columnOffsets[i] = m_rowSize;
+            m_rowSize         += ColumnCellSizes[static_cast<uint32>(m_columnTypes[i])];
+        }
+
+        m_rowSize = static_cast<uint32>(Pow2Align(m_rowSize, sizeof(uint64)));
+        m_maxRows = Max(RowBlockSize / m_rowSize, 1u);
+        m_pRows   = static_cast<char*>(PAL_MALLOC(m_maxRows * m_rowSize, m_pPlatform, AllocInternal));
+
+        if (m_pRows == nullptr)
+        {
+            m_maxRows = 0;
+            result    = Result::ErrorOutOfMemory;
+        }
+    }
+
+    StartRow();
+
+    return result;
+}
+
+// =====================================================================================================================
+void LogFile::Uint(
+    uint64 value)
+{
+    if (m_binary)
+    {
+        void*const pCell = NextCell(LogColumnType::Uint);
+
+        if (pCell != nullptr)
+        {
+            memcpy(pCell, &value, sizeof(value));
+        }
+    }
+    else
+    {
+        // Integers are formatted by hand; they make up most of each row and vsnprintf is comparatively slow.
+        char   text[20];
+        uint32 start = sizeof(text);
+
+        do
+        {
+            text[--start] = static_cast<char>('0' + (value % 10));
+            value        /= 10;
+        }
+        while (value != 0);
+
+        AppendCell(&text[start], sizeof(text) - start);
+    }
+}
+
+// =====================================================================================================================
+void LogFile::Hex64(
+    uint64 value)
+{
+    if (m_binary)
+    {
+        void*const pCell = NextCell(LogColumnType::Hex64);
+
+        if (pCell != nullptr)
+        {
+            memcpy(pCell, &value, sizeof(value));
+        }
+    }
+    else
+    {
+        char text[18] = { '0', 'x' };
+        WriteHexDigits(value, &text[2]);
+        AppendCell(&text[0], sizeof(text));
+    }
+}
+
+// =====================================================================================================================
+void LogFile::Hex128(
+    uint64 upper,
+    uint64 lower)
+{
+    if (m_binary)
+    {
+        void*const pCell = NextCell(LogColumnType::Hex128);
+
+        if (pCell != nullptr)
+        {
+            const uint64 value[2] = { upper, lower };
+            memcpy(pCell, &value[0], sizeof(value));
+        }
+    }
+    else
+    {
+        char text[34] = { '0', 'x' };
+        WriteHexDigits(upper, &text[2]);
+        WriteHexDigits(lower, &text[18]);
+        AppendCell(&text[0], sizeof(text));
+    }
+}
+
+// =====================================================================================================================
+void LogFile::Double(
+    double value)
+{
+    if (m_binary)
+    {
+        void*const pCell = NextCell(LogColumnType::Double);
+
+        if (pCell != nullptr)
+        {
+            memcpy(pCell, &value, sizeof(value));
+        }
+    }
+    else
+    {
+        char      text[64];
+        const int length = Snprintf(&text[0], sizeof(text), "%.2lf", value);
+        AppendCell(&text[0], Min(static_cast<uint32>(length), static_cast<uint32>(sizeof(text) - 1)));
+    }
+}
+
+// =====================================================================================================================
+void LogFile::String(
+    const char* pValue)
+{
+    if (m_binary)
+    {
+        const uint32 id    = InternString(pValue);
+        void*const   pCell = NextCell(LogColumnType::String);
+
+        if (pCell != nullptr)
+        {
+            memcpy(pCell, &id, sizeof(id));
+        }
+    }
+    else
+    {
+        AppendCell(pValue, static_cast<uint32>(strlen(pValue)));
+    }
+}
+
+// =====================================================================================================================
+// Same as String() except that CSV logs wrap the value in double quotes so that it may contain commas.
+void LogFile::QuotedString(
+    const char* pValue)
+{
+    if (m_binary)
+    {
+        String(pValue);
+    }
+    else
+    {
+        AppendText("\"", 1);
+        AppendText(pValue, static_cast<uint32>(strlen(pValue)));
+        AppendCell("\"", 1);
+    }
+}
+
+// =====================================================================================================================
+// Skips over the given number of cells, leaving them without a value.
+void LogFile::Empty(
+    uint32 count)
+{
+    if (m_binary)
+    {
+        m_curColumn += count;
+    }
+    else if (ReserveText(count))
+    {
+        memset(m_pText + m_textSize, ',', count);
+        m_textSize += count;
+    }
+}
+
+// =====================================================================================================================
+// Finishes the current row.  CSV rows are written out immediately while binary rows are buffered.
+void LogFile::EndRow()
+{
+    if (m_binary == false)
+    {
+        AppendText("\n", 1);
+        m_file.Write(m_pText, m_textSize);
+        m_textSize = 0;
+    }
+    else if (m_pRows != nullptr)
+    {
+        if (++m_numRows == m_maxRows)
+        {
+            FlushRows();
+        }
+
+        StartRow();
+    }
+}
+
+// =====================================================================================================================
+// Makes sure that the text buffer has room for another size bytes, growing it if needed.
+bool LogFile::ReserveText(
+    uint32 size)
+{
+    bool success = true;
+
+    if ((m_textSize + size) > m_textCapacity)
+    {
+        const uint32 newCapacity = Max(Max(m_textCapacity * 2, m_textSize + size), 4096u);
+        char*const   pNewText    = static_cast<char*>(PAL_MALLOC(newCapacity, m_pPlatform, AllocInternal));
+
+        if (pNewText != nullptr)
+        {
+            if (m_textSize > 0)
+            {
+                memcpy(pNewText, m_pText, m_textSize);
+            }
+
+            PAL_SAFE_FREE(m_pText, m_pPlatform);
+
+            m_pText        = pNewText;
+            m_textCapacity = newCapacity;
+        }
+        else
+        {
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+// =====================================================================================================================
+void LogFile::AppendText(
+    const void* pData,
+    uint32      size)
+{
+    if (ReserveText(size))
+    {
+        memcpy(m_pText + m_textSize, pData, size);
+        m_textSize += size;
+    }
+}
+
+// =====================================================================================================================
+// Appends a CSV cell: the given text followed by a comma.
+void LogFile::AppendCell(
+    const char* pText,
+    uint32      length)
+{
+    if (ReserveText(length + 1))
+    {
+        memcpy(m_pText + m_textSize, pText, length);
+        m_pText[m_textSize + length] = ',';
+        m_textSize += length + 1;
+    }
+}
+
+// =====================================================================================================================
+// Marks the next cell of the current binary row as valid and returns a pointer to it.  Returns null if the cell can't
+// be stored.
+void* LogFile::NextCell(
+    LogColumnType type)
+{
+    void* pCell = nullptr;
+
+    if ((m_curColumn < m_numColumns) && (m_pRows != nullptr))
+    {
+        PAL_ASSERT(m_columnTypes[m_curColumn] == type);
+
+        if (m_columnTypes[m_curColumn] == type)
+        {
+            char*const pRow = m_pRows + (m_numRows * m_rowSize);
+
+            pRow[m_curColumn / 8] |= static_cast<char>(1 << (m_curColumn % 8));
+            pCell = pRow + m_columnOffsets[m_curColumn];
+        }
+    }
+    else
+    {
+        PAL_ASSERT(m_pRows == nullptr);
+    }
+
+    m_curColumn++;
+
+    return pCell;
+}
+
+// =====================================================================================================================
+// Returns the string table ID of the given string, defining it first if this file hasn't seen it before.
+uint32 LogFile::InternString(
+    const char* pValue)
+{
+    const uint32*const pExistingId = m_stringIds.FindKey(pValue);
+    uint32             id          = 0;
+
+    if (pExistingId != nullptr)
+    {
+        id = *pExistingId;
+    }
+    else
+    {
+        const uint32 length = static_cast<uint32>(strlen(pValue));
+
+        id = m_nextStringId++;
+        m_numStrings++;
+
+        AppendText(&length, sizeof(length));
+        AppendText(pValue, length);
+
+        // The caller's string may not outlive this call so the map needs its own copy.  If we can't remember the
+        // string the next use of it will simply define it again.
+        char*const pCopy = static_cast<char*>(PAL_MALLOC(length + 1, m_pPlatform, AllocInternal));
+
+        if (pCopy != nullptr)
+        {
+            memcpy(pCopy, pValue, length + 1);
+
+            if (m_stringIds.Insert(pCopy, id) != Result::Success)
+            {
+                PAL_FREE(pCopy, m_pPlatform);
+            }
+        }
+    }
+
+    return id;
+}
+
+// =====================================================================================================================
+void LogFile::WriteBlock(
+    BinaryLogBlock type,
+    uint32         count,
+    const void*    pPayload,
+    uint32         payloadSize)
+{
+    const uint32 header[3] = { type, static_cast<uint32>(sizeof(count)) + payloadSize, count };
+
+    m_file.Write(&header[0], sizeof(header));
+
+    if (payloadSize > 0)
+    {
+        m_file.Write(pPayload, payloadSize);
+    }
+}
+
+// =====================================================================================================================
+// Writes out the buffered binary rows, preceded by any strings they reference.  A partially built row is kept.
+void LogFile::FlushRows()
+{
+    if (m_numStrings > 0)
+    {
+        WriteBlock(BinaryLogBlockStrings, m_numStrings, m_pText, m_textSize);
+        m_numStrings = 0;
+        m_textSize   = 0;
+    }
+
+    if (m_numRows > 0)
+    {
+        WriteBlock(BinaryLogBlockRows, m_numRows, m_pRows, m_numRows * m_rowSize);
+
+        if (m_numRows < m_maxRows)
+        {
+            memcpy(m_pRows, m_pRows + (m_numRows * m_rowSize), m_rowSize);
+        }
+
+        m_numRows = 0;
+    }
+}
+
+// =====================================================================================================================
+void LogFile::StartRow()
+{
+    m_curColumn = 0;
+
+    if (m_pRows != nullptr)
+    {
+        memset(m_pRows + (m_numRows * m_rowSize), 0, m_rowSize);
+    }
+}
+
+// =====================================================================================================================
+// Forgets every string defined so far.  String IDs start over in each file.
+void LogFile::ResetStrings()
+{
+    for (auto iter = m_stringIds.Begin(); iter.Get() != nullptr; iter.Next())
+    {
+        PAL_FREE(const_cast<char*>(iter.Get()->key), m_pPlatform);
+    }
+
+    m_stringIds.Reset();
+
+    m_nextStringId = 0;
+    m_numStrings   = 0;
+    m_textSize     = 0;
+}
+
+} // GpuProfiler
+} // Pal
@@ -0,0 +1,156 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "pal.h"
+#include "palFile.h"
+#include "palFlatHashMap.h"
+
+namespace Pal
+{
+namespace GpuProfiler
+{
+
+class Platform;
+
+// Every binary log begins with these eight bytes followed by a little-endian uint32 format version.
+constexpr char   BinaryLogMagic[8] = { 'P', 'A', 'L', 'G', 'P', 'R', 'O', 'F' };
+constexpr uint32 BinaryLogVersion  = 1;
+
+// The type of each log column. In binary logs this also decides how many bytes the column's cell takes up in a row.
+enum class LogColumnType : uint32
+{
+    Uint   = 0, // 8 bytes. Printed in decimal.
+    Hex64  = 1, // 8 bytes. Printed as a 0x-prefixed, 16-digit hexadecimal number.
+    Hex128 = 2, // 16 bytes, upper half first. Printed as a 0x-prefixed, 32-digit hexadecimal number.
+    Double = 3, // 8 bytes. Printed with two decimal places.
+    String = 4, // 4 bytes: a string table ID. Printed verbatim (or in double quotes, see LogFile::QuotedString).
+    Count
+};
+
+// Binary logs are a sequence of blocks, each one a little-endian uint32 BinaryLogBlock and uint32 payload size followed
+// by the payload.
+enum BinaryLogBlock : uint32
+{
+    // Always the first block: uint32 column count then, for each column, uint32 LogColumnType, uint32 name length and
+    // the name's characters.
+    BinaryLogBlockColumns = 0,
+    // uint32 string count then, for each string, uint32 length and the string's characters. Strings are assigned IDs
+    // in the order they appear across all string blocks, starting at zero.
+    BinaryLogBlockStrings = 1,
+    // uint32 row count then that many fixed-width rows. A row starts with a bitmask of which columns have a value
+    // (one bit per column, padded to a multiple of 8 bytes) followed by every column's cell in column order and then
+    // padding up to a multiple of 8 bytes. Cells without a value are zero. All string IDs used by a row block are
+    // defined by earlier string blocks.
+    BinaryLogBlockRows    = 2,
+};
+
+// =====================================================================================================================
+// A GPU profiler log file: a table with a header row naming each column followed by one row per logged item. Rows are
+// built by calling the cell functions in column order, followed by EndRow().
+//
+// The table is either written as CSV text or, in binary mode, as fixed-width binary rows plus a string table (see
+// BinaryLogBlock). Nothing is formatted as text in binary mode: cells are copied into a row, repeated strings are
+// written once, and rows are written out in large blocks. tools/gpuProfilerTools/timingReport.py reads both formats.
+class LogFile
+{
+public:
+    explicit LogFile(Platform* pPlatform);
+    ~LogFile();
+
+    Result Init();
+
+    Result Open(const char* pFilePath, bool binary);
+    void   Close();
+    void   Flush();
+
+    bool IsOpen() const   { return m_file.IsOpen(); }
+    bool IsBinary() const { return m_binary; }
+
+    // The header row must be finished before any other rows are added.
+    void   AddColumn(const char* pName, LogColumnType type);
+    Result EndHeader();
+
+    void Uint(uint64 value);
+    void Hex64(uint64 value);
+    void Hex128(uint64 upper, uint64 lower);
+    void Double(double value);
+    void String(const char* pValue);
+    void QuotedString(const char* pValue);
+    void Empty(uint32 count);
+    void EndRow();
+
+private:
+    // Binary rows are collected into a buffer of this size before being written out as a single block.
+    static constexpr uint32 RowBlockSize = 256 * 1024;
+    // The most columns a binary log can have.
+    static constexpr uint32 MaxColumns   = 256;
+
+    typedef Util::FlatHashMap<const char*,
+                              uint32,
+                              Platform,
+                              Util::StringJenkinsHashFunc,
+                              Util::StringEqualFunc> StringIdMap;
+
+    bool   ReserveText(uint32 size);
+    void   AppendText(const void* pData, uint32 size);
+    void   AppendCell(const char* pText, uint32 length);
+    void*  NextCell(LogColumnType type);
+    uint32 InternString(const char* pValue);
+    void   WriteBlock(BinaryLogBlock type, uint32 count, const void* pPayload, uint32 payloadSize);
+    void   FlushRows();
+    void   StartRow();
+    void   ResetStrings();
+
+    Platform*const   m_pPlatform;
+    Util::File       m_file;
+    bool             m_binary;
+
+    // CSV text for the current row, or the columns and strings blocks which are being built in binary mode.
+    char*            m_pText;
+    uint32           m_textCapacity;
+    uint32           m_textSize;
+
+    // Binary mode state.
+    uint32           m_numColumns;
+    LogColumnType    m_columnTypes[MaxColumns];
+    uint32           m_columnOffsets[MaxColumns]; // Byte offset of each column's cell within a row.
+    uint32           m_maskSize;                  // Size of the validity bitmask at the start of each row.
+    uint32           m_rowSize;
+    uint32           m_curColumn;                 // The column the next cell belongs to.
+    char*            m_pRows;                     // Rows which haven't been written yet, including the current row.
+    uint32           m_numRows;                   // Complete rows in m_pRows.
+    uint32           m_maxRows;                   // How many rows fit in m_pRows.
+    uint32           m_numStrings;                // Strings defined in m_pText which haven't been written yet.
+    uint32           m_nextStringId;
+    StringIdMap      m_stringIds;                 // IDs of every string written to this file. The keys are copies.
+
+    PAL_DISALLOW_DEFAULT_CTOR(LogFile);
+    PAL_DISALLOW_COPY_AND_ASSIGN(LogFile);
+};
+
+} // GpuProfiler
+} // Pal
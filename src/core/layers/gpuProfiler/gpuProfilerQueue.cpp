@@ -68,9 +68,15 @@ Queue::Queue(
     m_pendingSubmits(static_cast<Platform*>(pDevice->GetPlatform())),
     m_profilingModeEnabled(false),
     m_logItems(static_cast<Platform*>(pDevice->GetPlatform())),
+    m_logFile(static_cast<Platform*>(pDevice->GetPlatform())),
     m_curLogFrame(0),
     m_curLogCmdBufIdx(0),
-    m_curLogSqttIdx(0)
+    m_curLogSqttIdx(0),
+    m_logWorkerActive(false),
+    m_loggingSubmits(static_cast<Platform*>(pDevice->GetPlatform())),
+    m_loggingItems(static_cast<Platform*>(pDevice->GetPlatform())),
+    m_loggedSubmits(static_cast<Platform*>(pDevice->GetPlatform())),
+    m_numLoggingSubmits(0)
 {
     memset(&m_nestedAllocatorCreateInfo, 0, sizeof(m_nestedAllocatorCreateInfo));
     memset(&m_gpaSessionSampleConfig,    0, sizeof(m_gpaSessionSampleConfig));
@@ -97,6 +103,8 @@ Queue::~Queue()
     // Ensure all log items are flushed out before we shut down.
     WaitIdle();
     ProcessIdleSubmits();
+    StopLogWorker();
+    RecycleLoggedSubmits(false);
     m_logFile.Close();
 
     PAL_ASSERT(m_busyCmdBufs.NumElements() == 0);
@@ -163,6 +171,11 @@ Result Queue::Init()
 {
     Result result = m_replayAllocator.Init();
 
+    if (result == Result::Success)
+    {
+        result = m_logFile.Init();
+    }
+
     if (result == Result::Success)
     {
         CmdAllocatorCreateInfo createInfo = { };
@@ -213,6 +226,11 @@ Result Queue::Init()
         m_numReportedPerfCounters = numGlobalPerfCounters;
     }
 
+    if (result == Result::Success)
+    {
+        result = StartLogWorker();
+    }
+
     return result;
 }
 
@@ -825,7 +843,8 @@ IFence* Queue::AcquireFence()
 }
 
 // =====================================================================================================================
-// Determine if any pending submits have completed, and perform accounting on busy/idle command buffers and fences.
+// Determine if any pending submits have completed and hand them to the log worker, then perform accounting on the
+// busy/idle command buffers and fences of the submits it has finished logging.
 void Queue::ProcessIdleSubmits()
 {
     while ((m_pendingSubmits.NumElements() > 0) &&
@@ -834,46 +853,201 @@ void Queue::ProcessIdleSubmits()
         PendingSubmitInfo submitInfo = { };
         m_pendingSubmits.PopFront(&submitInfo);
 
-        // Output items from the log item queue that are now known to be idle.
-        OutputLogItemsToFile(submitInfo.logItemCount);
+        // Move the log items that are now known to be idle over to the log worker along with their submit.
+        m_logWorkerLock.Lock();
 
-        for (uint32 i = 0; i < submitInfo.cmdBufCount; i++)
+        for (uint32 i = 0; i < submitInfo.logItemCount; i++)
         {
-            TargetCmdBuffer* pCmdBuffer = nullptr;
-            m_busyCmdBufs.PopFront(&pCmdBuffer);
-            pCmdBuffer->SetClientData(nullptr);
-            m_availableCmdBufs.PushBack(pCmdBuffer);
+            LogItem logItem = { };
+            m_logItems.PopFront(&logItem);
+            m_loggingItems.PushBack(logItem);
         }
 
-        for (uint32 i = 0; i < submitInfo.nestedCmdBufCount; i++)
+        m_loggingSubmits.PushBack(submitInfo);
+        m_logWorkerLock.Unlock();
+
+        m_numLoggingSubmits++;
+
+        if (m_logWorkerActive)
+        {
+            m_loggingSemaphore.Post();
+        }
+        else
         {
-            NestedInfo info = {};
-            m_busyNestedCmdBufs.PopFront(&info);
+            LogNextSubmit();
+        }
 
-            // Automatic memory reuse is not enabled so we must manually reset the command buffer and allocator.
-            Result result = info.pCmdBuffer->Reset(nullptr, true);
+        // Resources can't be reused until their submit has been logged, so the pools keep growing while the log
+        // worker is behind.  Limit that by waiting for it once too many submits are outstanding.
+        RecycleLoggedSubmits(m_numLoggingSubmits >= MaxLoggingSubmits);
+    }
 
-            if (result == Result::Success)
-            {
-                result = info.pCmdAllocator->Reset();
-            }
+    RecycleLoggedSubmits(false);
+}
+
+// =====================================================================================================================
+// Returns the busy command buffers, GPA sessions and fence of each submit the log worker has finished with to their
+// available pools.  If wait is true, this first waits for the log worker to finish at least one submit.
+void Queue::RecycleLoggedSubmits(
+    bool wait)
+{
+    while ((m_numLoggingSubmits > 0) && (m_loggedSemaphore.Wait(wait ? UINT32_MAX : 0) == Result::Success))
+    {
+        PendingSubmitInfo submitInfo = { };
 
-            PAL_ASSERT(result == Result::Success);
+        m_logWorkerLock.Lock();
+        m_loggedSubmits.PopFront(&submitInfo);
+        m_logWorkerLock.Unlock();
 
-            m_availableNestedCmdBufs.PushBack(info);
-        }
+        RecycleSubmit(submitInfo);
+
+        m_numLoggingSubmits--;
+        wait = false;
+    }
+}
+
+// =====================================================================================================================
+// Perform accounting on the busy/idle command buffers and fences of a submit which has been logged.
+void Queue::RecycleSubmit(
+    const PendingSubmitInfo& submitInfo)
+{
+    for (uint32 i = 0; i < submitInfo.cmdBufCount; i++)
+    {
+        TargetCmdBuffer* pCmdBuffer = nullptr;
+        m_busyCmdBufs.PopFront(&pCmdBuffer);
+        pCmdBuffer->SetClientData(nullptr);
+        m_availableCmdBufs.PushBack(pCmdBuffer);
+    }
 
-        for (uint32 i = 0; i < submitInfo.gpaSessionCount; i++)
+    for (uint32 i = 0; i < submitInfo.nestedCmdBufCount; i++)
+    {
+        NestedInfo info = {};
+        m_busyNestedCmdBufs.PopFront(&info);
+
+        // Automatic memory reuse is not enabled so we must manually reset the command buffer and allocator.
+        Result result = info.pCmdBuffer->Reset(nullptr, true);
+
+        if (result == Result::Success)
         {
-            GpuUtil::GpaSession* pGpaSession = nullptr;
-            m_busyGpaSessions.PopFront(&pGpaSession);
-            pGpaSession->Reset();
-            m_availableGpaSessions.PushBack(pGpaSession);
+            result = info.pCmdAllocator->Reset();
         }
 
-        m_pDevice->ResetFences(1, &submitInfo.pFence);
-        m_availableFences.PushBack(submitInfo.pFence);
+        PAL_ASSERT(result == Result::Success);
+
+        m_availableNestedCmdBufs.PushBack(info);
+    }
+
+    for (uint32 i = 0; i < submitInfo.gpaSessionCount; i++)
+    {
+        GpuUtil::GpaSession* pGpaSession = nullptr;
+        m_busyGpaSessions.PopFront(&pGpaSession);
+        pGpaSession->Reset();
+        m_availableGpaSessions.PushBack(pGpaSession);
     }
+
+    m_pDevice->ResetFences(1, &submitInfo.pFence);
+    m_availableFences.PushBack(submitInfo.pFence);
+}
+
+// =====================================================================================================================
+// Initializes the log worker's synchronization objects and starts its thread.  If the thread can't be started, each
+// idle submit is logged on the submitting thread instead.
+Result Queue::StartLogWorker()
+{
+    Result result = m_logWorkerLock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_loggingSemaphore.Init(MaxLoggingSubmits + 1, 0);
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_loggedSemaphore.Init(MaxLoggingSubmits, 0);
+    }
+
+    if (result == Result::Success)
+    {
+        const Result threadResult = m_logWorker.Begin(&LogWorkerThread, this);
+        PAL_ALERT(threadResult != Result::Success);
+
+        m_logWorkerActive = (threadResult == Result::Success);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Waits for the log worker to log every submit handed to it so far and then exit.
+void Queue::StopLogWorker()
+{
+    if (m_logWorkerActive)
+    {
+        const PendingSubmitInfo exitInfo = { };
+
+        m_logWorkerLock.Lock();
+        m_loggingSubmits.PushBack(exitInfo);
+        m_logWorkerLock.Unlock();
+
+        m_loggingSemaphore.Post();
+        m_logWorker.Join();
+
+        m_logWorkerActive = false;
+    }
+}
+
+// =====================================================================================================================
+// Entry point of the log worker thread: logs each submit handed to it in order until it finds the exit marker.
+void Queue::LogWorkerThread(
+    void* pParam)
+{
+    Queue*const pQueue = static_cast<Queue*>(pParam);
+    bool        exit   = false;
+
+    while (exit == false)
+    {
+        // Sleep until we have a submit to log.
+        const Result result = pQueue->m_loggingSemaphore.Wait(UINT32_MAX);
+        PAL_ASSERT(result == Result::Success);
+
+        if (result == Result::Success)
+        {
+            pQueue->m_logWorkerLock.Lock();
+
+            if (pQueue->m_loggingSubmits.Front().pFence == nullptr)
+            {
+                PendingSubmitInfo exitInfo = { };
+                pQueue->m_loggingSubmits.PopFront(&exitInfo);
+                exit = true;
+            }
+
+            pQueue->m_logWorkerLock.Unlock();
+
+            if (exit == false)
+            {
+                pQueue->LogNextSubmit();
+            }
+        }
+    }
+}
+
+// =====================================================================================================================
+// Writes out the log items of the oldest submit waiting for the log worker, then hands the submit back to be recycled.
+void Queue::LogNextSubmit()
+{
+    PendingSubmitInfo submitInfo = { };
+
+    m_logWorkerLock.Lock();
+    m_loggingSubmits.PopFront(&submitInfo);
+    m_logWorkerLock.Unlock();
+
+    OutputLogItemsToFile(submitInfo.logItemCount);
+
+    m_logWorkerLock.Lock();
+    m_loggedSubmits.PushBack(submitInfo);
+    m_logWorkerLock.Unlock();
+
+    m_loggedSemaphore.Post();
 }
 
 // =====================================================================================================================
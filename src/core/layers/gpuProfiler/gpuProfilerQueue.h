@@ -27,10 +27,14 @@
 
 #include "core/layers/decorators.h"
 #include "core/layers/functionIds.h"
+#include "core/layers/gpuProfiler/gpuProfilerLogFile.h"
 #include "palDeque.h"
 #include "palFile.h"
 #include "palGpaSession.h"
 #include "palLinearAllocator.h"
+#include "palMutex.h"
+#include "palSemaphore.h"
+#include "palThread.h"
 
 namespace Pal
 {
@@ -285,8 +289,10 @@ private:
 
     // Tracks a list of pending (not retired yet) submits on this queue.  When the corresponding pFence object is
     // signaled, we know we can:
-    //     - Process logItemCount items in m_logItems - all timestamps, queries, etc. are idle and ready to be logged.
-    //     - Reclaim the first cmdBufCount/gpuMemCount/etc. entries in each of the "m_busyFoo" deques.
+    //     - Hand logItemCount items in m_logItems to the log worker - all timestamps, queries, etc. are idle and ready
+    //       to be logged.
+    //     - Once the log worker is done with them, reclaim the first cmdBufCount/gpuMemCount/etc. entries in each of
+    //       the "m_busyFoo" deques.
     //     - Reclaim that fence as available.
     struct PendingSubmitInfo
     {
@@ -306,7 +312,7 @@ private:
     bool                              m_profilingModeEnabled;
 
     Util::Deque<LogItem, Platform>    m_logItems;         // List of outstanding calls waiting to be logged.
-    Util::File                        m_logFile;          // File logging is currently outputted to (changes per frame).
+    LogFile                           m_logFile;          // File logging is currently outputted to (changes per frame).
     uint32                            m_curLogFrame;      // Used to determine when a new frame is started and a new log
                                                           // file should be opened.
     uint32                            m_curLogCmdBufIdx;  // Current command buffer index for the frame being logged.
@@ -314,6 +320,32 @@ private:
 
     LogItem                           m_perFrameLogItem;  // Log item used when the profiling granularity is per frame.
 
+    // Reading back results and writing the log files is done by a worker thread so that it doesn't stall the
+    // application's submits.  Idle submits are handed to it in order along with their log items.  Their command
+    // buffers, GPA sessions and fence stay busy until the worker hands the submit back, so at most MaxLoggingSubmits
+    // submits may be waiting on it before the submitting thread waits for it to catch up.
+    static constexpr uint32 MaxLoggingSubmits = 32;
+
+    Result StartLogWorker();
+    void   StopLogWorker();
+    static void LogWorkerThread(void* pParam);
+    void   LogNextSubmit();
+    void   RecycleLoggedSubmits(bool wait);
+    void   RecycleSubmit(const PendingSubmitInfo& submitInfo);
+
+    Util::Thread                             m_logWorker;
+    bool                                     m_logWorkerActive;   // If false, submits are logged by the submitting
+                                                                  // thread instead.
+    Util::Mutex                              m_logWorkerLock;     // Protects the three deques below.
+    Util::Deque<PendingSubmitInfo, Platform> m_loggingSubmits;    // Idle submits waiting for the log worker.  A null
+                                                                  // fence tells the worker to exit.
+    Util::Deque<LogItem, Platform>           m_loggingItems;      // Log items of the submits in m_loggingSubmits.
+    Util::Deque<PendingSubmitInfo, Platform> m_loggedSubmits;     // Logged submits waiting to be recycled.
+    Util::Semaphore                          m_loggingSemaphore;  // Posted for each submit added to m_loggingSubmits.
+    Util::Semaphore                          m_loggedSemaphore;   // Posted for each submit added to m_loggedSubmits.
+    uint32                                   m_numLoggingSubmits; // Submits handed to the log worker but not yet
+                                                                  // recycled.
+
     PAL_DISALLOW_DEFAULT_CTOR(Queue);
     PAL_DISALLOW_COPY_AND_ASSIGN(Queue);
 };
@@ -52,14 +52,27 @@ constexpr const char* EngineTypeStrings[] =
 
 static_assert(ArrayLen(EngineTypeStrings) == EngineTypeCount, "Missing entry in EngineTypeStrings.");
 
+constexpr const char* PipelineStatsColumnNames[] =
+{
+    "IaVertices",
+    "IaPrimitives",
+    "VsInvocations",
+    "GsInvocations",
+    "GsPrimitives",
+    "CInvocations",
+    "CPrimitives",
+    "PsInvocations",
+    "HsInvocations",
+    "DsInvocations",
+    "CsInvocations",
+};
+
 // =====================================================================================================================
-// Writes .csv entries to file corresponding to the first count items in the m_logItems deque.  The caller guarantees
-// that all of these calls are idle.
+// Writes log entries to file corresponding to the first count items in the m_loggingItems deque.  The caller
+// guarantees that all of these calls are idle.  This runs on the log worker thread.
 void Queue::OutputLogItemsToFile(
     size_t count)
 {
-    PAL_ASSERT(count <= m_logItems.NumElements());
-
     // Log items from a nested command buffer are flattened so that they appear the same as regular command buffer
     // calls.  activeCmdBufs tracks how many "open" command buffers there are - 0 during queue calls, 1 inside a submit,
     // and 2 inside a nested command buffer.  m_curLogCmdBufIdx is used to log which command buffer we are logging out
@@ -70,7 +83,12 @@ void Queue::OutputLogItemsToFile(
     for (uint32 i = 0; i < count; i++)
     {
         LogItem logItem = { };
-        m_logItems.PopFront(&logItem);
+
+        m_logWorkerLock.Lock();
+        const Result result = m_loggingItems.PopFront(&logItem);
+        m_logWorkerLock.Unlock();
+
+        PAL_ASSERT(result == Result::Success);
 
         // The fence bundled to this submit wave should promise GpaSession ready.
         PAL_ASSERT((logItem.pGpaSession == nullptr) || logItem.pGpaSession->IsReady());
@@ -139,7 +157,10 @@ void Queue::OpenLogFile(
 
     m_logFile.Close();
 
-    // Build a file name for this frame's log file.  It will have the pattern frameAAAAAADevBEngCD-EE.csv, where:
+    const bool binary = settings.gpuProfilerConfig.binaryOutput;
+
+    // Build a file name for this frame's log file.  It will have the pattern frameAAAAAADevBEngCD-EE.csv (or .bin for
+    // binary logs), where:
     //     - AAAAAA: Frame number.
     //     - B:      Device index (mostly relevant when profiling MGPU systems).
     //     - C:      Engine type (U = universal, C = compute, D = DMA, and T = timer).
@@ -148,31 +169,46 @@ void Queue::OpenLogFile(
     char tempString[512];
     Snprintf(&tempString[0],
              sizeof(tempString),
-             "%s/frame%06uDev%uEng%s%u-%02u.csv",
+             "%s/frame%06uDev%uEng%s%u-%02u.%s",
              m_pDevice->GetPlatform()->LogDirPath(),
              frameId,
              m_pDevice->Id(),
              EngineTypeStrings[static_cast<uint32>(m_engineType)],
              m_engineIndex,
-             m_queueId);
+             m_queueId,
+             binary ? "bin" : "csv");
 
-    Result result = m_logFile.Open(&tempString[0], FileAccessWrite);
+    Result result = m_logFile.Open(&tempString[0], binary);
     PAL_ASSERT(result == Result::Success);
 
-    // Write the CSV column headers to the newly opened file.
-    const char* pCsvHeader = "Queue Call,CmdBuffer Index,CmdBuffer Call,Start Clock,End Clock,Time (us) "
-                             "[Frequency: %llu],PipelineHash,CompilerHash,VS/CS,HS,DS,GS,PS,"
-                             "Verts/ThreadGroups,Instances,Comments,";
-    Snprintf(&tempString[0], sizeof(tempString), pCsvHeader, m_pDevice->TimestampFreq());
-    m_logFile.Write(&tempString[0], strlen(&tempString[0]));
+    // Write the column headers to the newly opened file.
+    m_logFile.AddColumn("Queue Call",      LogColumnType::String);
+    m_logFile.AddColumn("CmdBuffer Index", LogColumnType::Uint);
+    m_logFile.AddColumn("CmdBuffer Call",  LogColumnType::String);
+    m_logFile.AddColumn("Start Clock",     LogColumnType::Uint);
+    m_logFile.AddColumn("End Clock",       LogColumnType::Uint);
+
+    Snprintf(&tempString[0], sizeof(tempString), "Time (us) [Frequency: %llu]", m_pDevice->TimestampFreq());
+    m_logFile.AddColumn(&tempString[0], LogColumnType::Double);
+
+    m_logFile.AddColumn("PipelineHash",       LogColumnType::Hex64);
+    m_logFile.AddColumn("CompilerHash",       LogColumnType::Hex64);
+    m_logFile.AddColumn("VS/CS",              LogColumnType::Hex128);
+    m_logFile.AddColumn("HS",                 LogColumnType::Hex128);
+    m_logFile.AddColumn("DS",                 LogColumnType::Hex128);
+    m_logFile.AddColumn("GS",                 LogColumnType::Hex128);
+    m_logFile.AddColumn("PS",                 LogColumnType::Hex128);
+    m_logFile.AddColumn("Verts/ThreadGroups", LogColumnType::Uint);
+    m_logFile.AddColumn("Instances",          LogColumnType::Uint);
+    m_logFile.AddColumn("Comments",           LogColumnType::String);
 
     // Add some additional column headers based on enabled profiling features.
     if (settings.gpuProfilerConfig.recordPipelineStats)
     {
-        const char* pCsvPipelineStatsHeader = "IaVertices,IaPrimitives,VsInvocations,GsInvocations,"
-                                              "GsPrimitives,CInvocations,CPrimitives,PsInvocations,"
-                                              "HsInvocations,DsInvocations,CsInvocations,";
-        m_logFile.Write(pCsvPipelineStatsHeader, strlen(pCsvPipelineStatsHeader));
+        for (uint32 i = 0; i < ArrayLen(PipelineStatsColumnNames); i++)
+        {
+            m_logFile.AddColumn(PipelineStatsColumnNames[i], LogColumnType::Uint);
+        }
     }
 
     const uint32 numGlobalPerfCounters = m_pDevice->NumGlobalPerfCounters();
@@ -181,16 +217,19 @@ void Queue::OpenLogFile(
     {
         for (uint32 i = 0; i < numGlobalPerfCounters; i++)
         {
-            m_logFile.Printf("%s,", &pPerfCounters[i].name[0]);
+            m_logFile.AddColumn(&pPerfCounters[i].name[0], LogColumnType::Uint);
         }
     }
 
-    if (m_pDevice->IsThreadTraceEnabled())
+    // Command buffer rows always end with a thread trace cell which may hold an error message even if thread traces
+    // are disabled.  Binary rows only have room for declared columns so they always get this column.
+    if (m_pDevice->IsThreadTraceEnabled() || binary)
     {
-        m_logFile.Printf("ThreadTraceId,");
+        m_logFile.AddColumn("ThreadTraceId", LogColumnType::String);
     }
 
-    m_logFile.Printf("\n");
+    result = m_logFile.EndHeader();
+    PAL_ASSERT(result == Result::Success);
 }
 
 // =====================================================================================================================
@@ -358,19 +397,16 @@ void Queue::OutputQueueCallToFile(
 {
     PAL_ASSERT(logItem.type == QueueCall);
 
-    m_logFile.Printf("%s,,,,,,,,,,,,,,,,", QueueCallIdStrings[static_cast<uint32>(logItem.queueCall.callId)]);
+    m_logFile.String(QueueCallIdStrings[static_cast<uint32>(logItem.queueCall.callId)]);
+    m_logFile.Empty(15);
 
     if (m_pDevice->GetPlatform()->PlatformSettings().gpuProfilerConfig.recordPipelineStats)
     {
-        m_logFile.Printf(",,,,,,,,,,,");
+        m_logFile.Empty(ArrayLen(PipelineStatsColumnNames));
     }
 
-    for (uint32 i = 0; i < m_numReportedPerfCounters; i++)
-    {
-        m_logFile.Printf(",");
-    }
-
-    m_logFile.Printf("\n");
+    m_logFile.Empty(m_numReportedPerfCounters);
+    m_logFile.EndRow();
 }
 
 //======================================================================================================================
@@ -391,61 +427,68 @@ void Queue::OutputCmdBufCallToFile(
 
     const auto& cmdBufItem = logItem.cmdBufCall;
 
-    m_logFile.Printf(",%d,%s%s,",
-                     m_curLogCmdBufIdx,
-                     pNestedCmdBufPrefix,
-                     CmdBufCallIdStrings[static_cast<uint32>(cmdBufItem.callId)]);
+    const char* pCallName = CmdBufCallIdStrings[static_cast<uint32>(cmdBufItem.callId)];
+    char        nestedCallName[128];
+
+    if (pNestedCmdBufPrefix[0] != '\0')
+    {
+        Snprintf(&nestedCallName[0], sizeof(nestedCallName), "%s%s", pNestedCmdBufPrefix, pCallName);
+        pCallName = &nestedCallName[0];
+    }
+
+    m_logFile.Empty(1);
+    m_logFile.Uint(m_curLogCmdBufIdx);
+    m_logFile.String(pCallName);
 
     OutputTimestampsToFile(logItem);
 
     // Print any draw/dispatch specific info (shader hashes, etc.).
     if (cmdBufItem.flags.draw)
     {
-        m_logFile.Printf("0x%016llx,0x%016llx,0x%016llx%016llx,0x%016llx%016llx,0x%016llx%016llx,"
-                         "0x%016llx%016llx,0x%016llx%016llx,%u,%u,,",
-                         cmdBufItem.draw.apiPsoHash,
-                         cmdBufItem.draw.pipelineInfo.internalPipelineHash.stable,
-                         cmdBufItem.draw.pipelineInfo.shader[VsIdx].hash.upper,
-                         cmdBufItem.draw.pipelineInfo.shader[VsIdx].hash.lower,
-                         cmdBufItem.draw.pipelineInfo.shader[HsIdx].hash.upper,
-                         cmdBufItem.draw.pipelineInfo.shader[HsIdx].hash.lower,
-                         cmdBufItem.draw.pipelineInfo.shader[DsIdx].hash.upper,
-                         cmdBufItem.draw.pipelineInfo.shader[DsIdx].hash.lower,
-                         cmdBufItem.draw.pipelineInfo.shader[GsIdx].hash.upper,
-                         cmdBufItem.draw.pipelineInfo.shader[GsIdx].hash.lower,
-                         cmdBufItem.draw.pipelineInfo.shader[PsIdx].hash.upper,
-                         cmdBufItem.draw.pipelineInfo.shader[PsIdx].hash.lower,
-                         cmdBufItem.draw.vertexCount,
-                         cmdBufItem.draw.instanceCount);
+        const auto& shaders = cmdBufItem.draw.pipelineInfo.shader;
+
+        m_logFile.Hex64(cmdBufItem.draw.apiPsoHash);
+        m_logFile.Hex64(cmdBufItem.draw.pipelineInfo.internalPipelineHash.stable);
+        m_logFile.Hex128(shaders[VsIdx].hash.upper, shaders[VsIdx].hash.lower);
+        m_logFile.Hex128(shaders[HsIdx].hash.upper, shaders[HsIdx].hash.lower);
+        m_logFile.Hex128(shaders[DsIdx].hash.upper, shaders[DsIdx].hash.lower);
+        m_logFile.Hex128(shaders[GsIdx].hash.upper, shaders[GsIdx].hash.lower);
+        m_logFile.Hex128(shaders[PsIdx].hash.upper, shaders[PsIdx].hash.lower);
+        m_logFile.Uint(cmdBufItem.draw.vertexCount);
+        m_logFile.Uint(cmdBufItem.draw.instanceCount);
+        m_logFile.Empty(1);
     }
     else if (cmdBufItem.flags.dispatch)
     {
-        m_logFile.Printf("0x%016llx,0x%016llx,0x%016llx%016llx,,,,,%u,,,",
-                         cmdBufItem.dispatch.apiPsoHash,
-                         cmdBufItem.dispatch.pipelineInfo.internalPipelineHash.stable,
-                         cmdBufItem.draw.pipelineInfo.shader[CsIdx].hash.upper,
-                         cmdBufItem.draw.pipelineInfo.shader[CsIdx].hash.lower,
-                         cmdBufItem.dispatch.threadGroupCount);
+        const auto& shaders = cmdBufItem.draw.pipelineInfo.shader;
+
+        m_logFile.Hex64(cmdBufItem.dispatch.apiPsoHash);
+        m_logFile.Hex64(cmdBufItem.dispatch.pipelineInfo.internalPipelineHash.stable);
+        m_logFile.Hex128(shaders[CsIdx].hash.upper, shaders[CsIdx].hash.lower);
+        m_logFile.Empty(4);
+        m_logFile.Uint(cmdBufItem.dispatch.threadGroupCount);
+        m_logFile.Empty(2);
     }
     else if (cmdBufItem.flags.barrier)
     {
-        m_logFile.Printf(",,,,,,,,,\"%s\",",
-                         (cmdBufItem.barrier.pComment != nullptr) ? cmdBufItem.barrier.pComment : "");
+        m_logFile.Empty(9);
+        m_logFile.QuotedString((cmdBufItem.barrier.pComment != nullptr) ? cmdBufItem.barrier.pComment : "");
     }
     else if (cmdBufItem.flags.comment)
     {
-        m_logFile.Printf(",,,,,,,,,\"%s\",", cmdBufItem.comment.string);
+        m_logFile.Empty(9);
+        m_logFile.QuotedString(cmdBufItem.comment.string);
     }
     else
     {
-        m_logFile.Printf(",,,,,,,,,,");
+        m_logFile.Empty(10);
     }
 
     OutputPipelineStatsToFile(logItem);
     OutputGlobalPerfCountersToFile(logItem);
     OutputTraceDataToFile(logItem);
 
-    m_logFile.Printf("\n");
+    m_logFile.EndRow();
 }
 
 //======================================================================================================================
@@ -455,20 +498,26 @@ void Queue::OutputFrameToFile(
 {
     if (m_logFile.IsOpen() == false)
     {
+        const bool binary = m_pDevice->GetPlatform()->PlatformSettings().gpuProfilerConfig.binaryOutput;
+
         // Build a file name for this frame's log file.
         char tempString[512];
         Snprintf(&tempString[0],
                  sizeof(tempString),
-                 "%s/frameLog.csv",
-                 m_pDevice->GetPlatform()->LogDirPath());
+                 "%s/frameLog.%s",
+                 m_pDevice->GetPlatform()->LogDirPath(),
+                 binary ? "bin" : "csv");
 
-        Result result = m_logFile.Open(&tempString[0], FileAccessWrite);
+        Result result = m_logFile.Open(&tempString[0], binary);
         PAL_ASSERT(result == Result::Success);
 
-        // Write the CSV column headers to the newly opened file.
-        const char* pCsvHeader = "Frame #,Start Clock,End Clock,Time (us) [Frequency: %llu],";
-        Snprintf(&tempString[0], sizeof(tempString), pCsvHeader, m_pDevice->TimestampFreq());
-        m_logFile.Write(&tempString[0], strlen(&tempString[0]));
+        // Write the column headers to the newly opened file.
+        m_logFile.AddColumn("Frame #",     LogColumnType::Uint);
+        m_logFile.AddColumn("Start Clock", LogColumnType::Uint);
+        m_logFile.AddColumn("End Clock",   LogColumnType::Uint);
+
+        Snprintf(&tempString[0], sizeof(tempString), "Time (us) [Frequency: %llu]", m_pDevice->TimestampFreq());
+        m_logFile.AddColumn(&tempString[0], LogColumnType::Double);
 
         const uint32 numGlobalPerfCounters = m_pDevice->NumGlobalPerfCounters();
         const PerfCounter* pPerfCounters   = m_pDevice->GlobalPerfCounters();
@@ -476,30 +525,32 @@ void Queue::OutputFrameToFile(
         {
             for (uint32 i = 0; i < numGlobalPerfCounters; i++)
             {
-                m_logFile.Printf("%s,", &pPerfCounters[i].name[0]);
+                m_logFile.AddColumn(&pPerfCounters[i].name[0], LogColumnType::Uint);
             }
         }
 
-        if (m_pDevice->IsThreadTraceEnabled())
+        // See OpenLogFile() for why binary logs always have this column.
+        if (m_pDevice->IsThreadTraceEnabled() || binary)
         {
-            m_logFile.Printf("ThreadTraceId,");
+            m_logFile.AddColumn("ThreadTraceId", LogColumnType::String);
         }
 
-        m_logFile.Printf("\n");
+        result = m_logFile.EndHeader();
+        PAL_ASSERT(result == Result::Success);
     }
 
-    m_logFile.Printf("%u,", logItem.frameId);
+    m_logFile.Uint(logItem.frameId);
 
     OutputTimestampsToFile(logItem);
     OutputGlobalPerfCountersToFile(logItem);
     OutputTraceDataToFile(logItem);
 
-    m_logFile.Printf("\n");
+    m_logFile.EndRow();
     m_logFile.Flush();
 }
 
 // =====================================================================================================================
-// Output the portion of a .csv with the start/end clock values and time elapsed.  Shared code by all profile
+// Output the portion of a log entry with the start/end clock values and time elapsed.  Shared code by all profile
 // granularities.
 void Queue::OutputTimestampsToFile(
     const LogItem& logItem)
@@ -511,7 +562,8 @@ void Queue::OutputTimestampsToFile(
                                                             nullptr,
                                                             pResult);
 
-        m_logFile.Printf("%llu,%llu,", pResult[0], pResult[1]);
+        m_logFile.Uint(pResult[0]);
+        m_logFile.Uint(pResult[1]);
 
         bool hideElapsedTime =
             (m_pDevice->GetPlatform()->PlatformSettings().gpuProfilerPerfCounterConfig.granularity ==
@@ -525,16 +577,16 @@ void Queue::OutputTimestampsToFile(
             const double tsDiff   = static_cast<double>(pResult[1] - pResult[0]);
             const double timeInUs = 1000000 * tsDiff / m_pDevice->TimestampFreq();
 
-            m_logFile.Printf("%.2lf,", timeInUs);
+            m_logFile.Double(timeInUs);
         }
         else
         {
-            m_logFile.Printf(",");
+            m_logFile.Empty(1);
         }
     }
     else
     {
-        m_logFile.Printf(",,,");
+        m_logFile.Empty(3);
     }
 }
 
@@ -545,7 +597,7 @@ void Queue::OutputPipelineStatsToFile(
 {
     if (HasValidGpaSample(&logItem, GpuUtil::GpaSampleType::Query))
     {
-        uint64 pipelineStats[11] = {};
+        uint64 pipelineStats[ArrayLen(PipelineStatsColumnNames)] = {};
         size_t pipelineStatsSize = sizeof(pipelineStats);
         const Result result = logItem.pGpaSession->GetResults(logItem.gpaSampleIdQuery,
                                                               &pipelineStatsSize,
@@ -556,13 +608,14 @@ void Queue::OutputPipelineStatsToFile(
 
         // PAL hardcodes the layout of the return pipeline stats values based on the client, leading to different
         // versions of this code to a uniform log layout.
-        m_logFile.Printf("%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,", pipelineStats[0],
-                         pipelineStats[1], pipelineStats[2], pipelineStats[3], pipelineStats[4], pipelineStats[5],
-                         pipelineStats[6], pipelineStats[7], pipelineStats[8], pipelineStats[9], pipelineStats[10]);
+        for (uint32 i = 0; i < ArrayLen(pipelineStats); i++)
+        {
+            m_logFile.Uint(pipelineStats[i]);
+        }
     }
     else if (m_pDevice->GetPlatform()->PlatformSettings().gpuProfilerConfig.recordPipelineStats)
     {
-        m_logFile.Printf(",,,,,,,,,,,");
+        m_logFile.Empty(ArrayLen(PipelineStatsColumnNames));
     }
 }
 
@@ -624,19 +677,16 @@ void Queue::OutputGlobalPerfCountersToFile(
 
             PAL_SAFE_FREE(pResult, m_pDevice->GetPlatform());
 
-            // Output into .csv file.
+            // Output into the log file.
             for (uint32 i = 0; i < m_numReportedPerfCounters; i++)
             {
-                m_logFile.Printf("%llu,", data[i]);
+                m_logFile.Uint(data[i]);
             }
         }
     }
     else
     {
-        for (uint32 i = 0; i < m_numReportedPerfCounters; i++)
-        {
-            m_logFile.Printf(",");
-        }
+        m_logFile.Empty(m_numReportedPerfCounters);
     }
 }
 
@@ -658,11 +708,14 @@ void Queue::OutputTraceDataToFile(
                 GpuProfilerGranularity::GpuProfilerGranularityFrame)
             {
                 OutputRgpFile(*logItem.pGpaSession, logItem.gpaSampleId);
-                m_logFile.Printf("%u,", m_curLogFrame);
+
+                char traceId[16];
+                Snprintf(&traceId[0], sizeof(traceId), "%u", m_curLogFrame);
+                m_logFile.String(&traceId[0]);
             }
             else
             {
-                m_logFile.Printf("USE FRAME-GRANULARITY FOR RGP,");
+                m_logFile.String("USE FRAME-GRANULARITY FOR RGP");
             }
         }
         else if (m_pDevice->GetProfilerMode() == GpuProfilerTraceEnabledTtv)
@@ -728,7 +781,9 @@ void Queue::OutputTraceDataToFile(
                         pDesc = static_cast<const SqttFileChunkSqttDesc*>(VoidPtrInc(pResult, offset));
                     }
 
-                    m_logFile.Printf("%u,", m_curLogSqttIdx++);
+                    char traceId[16];
+                    Snprintf(&traceId[0], sizeof(traceId), "%u", m_curLogSqttIdx++);
+                    m_logFile.String(&traceId[0]);
                 }
 
                 // Spm trace chunk: Begin output of Spm trace data as a separate .csv file
@@ -818,15 +873,15 @@ void Queue::OutputTraceDataToFile(
     {
         // TODO: this error is set under none case yet.
         // GpaSession::BeginSample hits an ASSERT if this error happens.
-        m_logFile.Printf("ERROR: OUT OF MEMORY,");
+        m_logFile.String("ERROR: OUT OF MEMORY");
     }
     else if (logItem.errors.perfExpUnsupported != 0)
     {
-        m_logFile.Printf("ERROR: THREAD TRACE UNSUPPORTED,");
+        m_logFile.String("ERROR: THREAD TRACE UNSUPPORTED");
     }
     else
     {
-        m_logFile.Printf(",");
+        m_logFile.Empty(1);
     }
 }
 
@@ -0,0 +1,340 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/layers/interfaceLogger/interfaceLoggerBinaryWriter.h"
+#include "core/layers/interfaceLogger/interfaceLoggerPlatform.h"
+#include "palFlatHashMapImpl.h"
+
+using namespace Util;
+
+namespace Pal
+{
+namespace InterfaceLogger
+{
+
+// =====================================================================================================================
+BinaryWriter::BinaryWriter(
+    Platform*   pPlatform,
+    JsonStream* pStream)
+    :
+    m_pPlatform(pPlatform),
+    m_pStream(pStream),
+    m_nextStringId(0),
+    m_prevCallTime(0),
+    m_addressIds(1024, pPlatform),
+    m_stringIds(256, pPlatform)
+{
+    PAL_ASSERT(m_pStream != nullptr);
+}
+
+// =====================================================================================================================
+BinaryWriter::~BinaryWriter()
+{
+    // Free our copies of the interned string values.
+    for (auto iter = m_stringIds.Begin(); iter.Get() != nullptr; iter.Next())
+    {
+        PAL_FREE(const_cast<char*>(iter.Get()->key), m_pPlatform);
+    }
+}
+
+// =====================================================================================================================
+Result BinaryWriter::Init()
+{
+    Result result = m_addressIds.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_stringIds.Init();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+uint32 BinaryWriter::EncodePreamble(
+    uint32 textLength,
+    void*  pHeader)
+{
+    uint8* pOut = static_cast<uint8*>(pHeader);
+
+    memcpy(pOut, BinaryLogMagic, sizeof(BinaryLogMagic));
+    uint32 size = sizeof(BinaryLogMagic);
+
+    for (uint32 byte = 0; byte < sizeof(uint32); ++byte)
+    {
+        pOut[size++] = static_cast<uint8>(BinaryLogVersion >> (byte * 8));
+    }
+
+    pOut[size++] = static_cast<uint8>(BinaryTag::Text);
+    size += EncodeVarint(textLength, pOut + size);
+
+    PAL_ASSERT(size <= MaxPreambleSize);
+
+    return size;
+}
+
+// =====================================================================================================================
+void BinaryWriter::Key(
+    const char* pKey)
+{
+    const uint32 id = InternAddress(pKey);
+
+    uint8  record[MaxRecordSize];
+    uint32 size = 0;
+
+    record[size++] = static_cast<uint8>(BinaryTag::Key);
+    size += EncodeVarint(id, record + size);
+
+    m_pStream->WriteString(reinterpret_cast<const char*>(record), size);
+}
+
+// =====================================================================================================================
+void BinaryWriter::Value(
+    const char* pValue)
+{
+    const uint32 length   = static_cast<uint32>(strlen(pValue));
+    bool         interned = false;
+    uint32       id       = 0;
+
+    if (length <= MaxInternedLength)
+    {
+        const uint32*const pId = m_stringIds.FindKey(pValue);
+
+        if (pId != nullptr)
+        {
+            id       = *pId;
+            interned = true;
+        }
+        else if (m_stringIds.GetNumEntries() < MaxInternedStrings)
+        {
+            // The caller's string may not outlive this call so the map needs its own copy.
+            char*const pCopy = static_cast<char*>(PAL_MALLOC(length + 1, m_pPlatform, AllocInternal));
+
+            if (pCopy != nullptr)
+            {
+                memcpy(pCopy, pValue, length + 1);
+
+                if (m_stringIds.Insert(pCopy, m_nextStringId) == Result::Success)
+                {
+                    WriteString(BinaryTag::DefineString, pValue, length);
+
+                    id       = m_nextStringId++;
+                    interned = true;
+                }
+                else
+                {
+                    PAL_FREE(pCopy, m_pPlatform);
+                }
+            }
+        }
+    }
+
+    if (interned)
+    {
+        uint8  record[MaxRecordSize];
+        uint32 size = 0;
+
+        record[size++] = static_cast<uint8>(BinaryTag::String);
+        size += EncodeVarint(id, record + size);
+
+        m_pStream->WriteString(reinterpret_cast<const char*>(record), size);
+    }
+    else
+    {
+        WriteString(BinaryTag::InlineString, pValue, length);
+    }
+}
+
+// =====================================================================================================================
+void BinaryWriter::Value(
+    uint64 value)
+{
+    uint8  record[MaxRecordSize];
+    uint32 size = 0;
+
+    record[size++] = static_cast<uint8>(BinaryTag::Uint);
+    size += EncodeVarint(value, record + size);
+
+    m_pStream->WriteString(reinterpret_cast<const char*>(record), size);
+}
+
+// =====================================================================================================================
+void BinaryWriter::Value(
+    int64 value)
+{
+    uint8  record[MaxRecordSize];
+    uint32 size = 0;
+
+    record[size++] = static_cast<uint8>(BinaryTag::Int);
+    size += EncodeZigzag(value, record + size);
+
+    m_pStream->WriteString(reinterpret_cast<const char*>(record), size);
+}
+
+// =====================================================================================================================
+void BinaryWriter::Value(
+    float value)
+{
+    uint32 bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint8  record[MaxRecordSize];
+    uint32 size = 0;
+
+    record[size++] = static_cast<uint8>(BinaryTag::Float);
+
+    for (uint32 byte = 0; byte < sizeof(bits); ++byte)
+    {
+        record[size++] = static_cast<uint8>(bits >> (byte * 8));
+    }
+
+    m_pStream->WriteString(reinterpret_cast<const char*>(record), size);
+}
+
+// =====================================================================================================================
+// Writes a record which the converter expands into LogContext's standard object map: {"class": name, "id": objectId}.
+void BinaryWriter::Object(
+    const char* pClassName,
+    uint32      objectId)
+{
+    const uint32 classId = InternAddress(pClassName);
+
+    uint8  record[MaxRecordSize];
+    uint32 size = 0;
+
+    record[size++] = static_cast<uint8>(BinaryTag::Object);
+    size += EncodeVarint(classId, record + size);
+    size += EncodeVarint(objectId, record + size);
+
+    m_pStream->WriteString(reinterpret_cast<const char*>(record), size);
+}
+
+// =====================================================================================================================
+// Writes a record which the converter expands into the opening of an "InterfaceFunc" entry: the entry's map and all of
+// the keys which LogContext::BeginFunc writes. Consecutive calls are usually close together in time, so storing the
+// timestamps as deltas keeps them down to a few bytes.
+void BinaryWriter::BeginFunc(
+    const char* pClassName,
+    uint32      objectId,
+    const char* pFuncName,
+    uint32      threadId,
+    uint64      preCallTime,
+    uint64      postCallTime)
+{
+    const uint32 classId = InternAddress(pClassName);
+    const uint32 funcId  = InternAddress(pFuncName);
+
+    uint8  record[MaxRecordSize];
+    uint32 size = 0;
+
+    record[size++] = static_cast<uint8>(BinaryTag::BeginFunc);
+    size += EncodeVarint(classId, record + size);
+    size += EncodeVarint(objectId, record + size);
+    size += EncodeVarint(funcId, record + size);
+    size += EncodeVarint(threadId, record + size);
+    size += EncodeZigzag(static_cast<int64>(preCallTime - m_prevCallTime), record + size);
+    size += EncodeZigzag(static_cast<int64>(postCallTime - preCallTime), record + size);
+
+    PAL_ASSERT(size <= MaxRecordSize);
+
+    m_pStream->WriteString(reinterpret_cast<const char*>(record), size);
+
+    m_prevCallTime = preCallTime;
+}
+
+// =====================================================================================================================
+void BinaryWriter::WriteTag(
+    BinaryTag tag)
+{
+    m_pStream->WriteCharacter(static_cast<char>(tag));
+}
+
+// =====================================================================================================================
+// Writes a record made of the given tag, the string's length and its characters.
+void BinaryWriter::WriteString(
+    BinaryTag   tag,
+    const char* pString,
+    uint32      length)
+{
+    uint8  record[MaxRecordSize];
+    uint32 size = 0;
+
+    record[size++] = static_cast<uint8>(tag);
+    size += EncodeVarint(length, record + size);
+
+    m_pStream->WriteString(reinterpret_cast<const char*>(record), size);
+    m_pStream->WriteString(pString, length);
+}
+
+// =====================================================================================================================
+// Returns the ID of a string with static storage duration, defining it first if this is the first time it's been used.
+uint32 BinaryWriter::InternAddress(
+    const char* pString)
+{
+    bool    existed = false;
+    uint32* pId     = nullptr;
+    uint32  id      = 0;
+
+    if (m_addressIds.FindAllocate(pString, &existed, &pId) != Result::Success)
+    {
+        // If the map can't grow we just define the string again each time it's used.
+        id = m_nextStringId++;
+        WriteString(BinaryTag::DefineString, pString, static_cast<uint32>(strlen(pString)));
+    }
+    else if (existed == false)
+    {
+        id   = m_nextStringId++;
+        *pId = id;
+        WriteString(BinaryTag::DefineString, pString, static_cast<uint32>(strlen(pString)));
+    }
+    else
+    {
+        id = *pId;
+    }
+
+    return id;
+}
+
+// =====================================================================================================================
+// Writes value as an unsigned LEB128 number. Returns the number of bytes written, which is at most ten.
+uint32 BinaryWriter::EncodeVarint(
+    uint64 value,
+    uint8* pOut)
+{
+    uint32 size = 0;
+
+    while (value >= 0x80)
+    {
+        pOut[size++] = static_cast<uint8>(value | 0x80);
+        value >>= 7;
+    }
+
+    pOut[size++] = static_cast<uint8>(value);
+
+    return size;
+}
+
+} // InterfaceLogger
+} // Pal
@@ -0,0 +1,153 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "pal.h"
+#include "palFlatHashMap.h"
+#include "palJsonWriter.h"
+
+namespace Pal
+{
+namespace InterfaceLogger
+{
+
+class Platform;
+
+// Every binary log begins with these eight bytes, followed by a little-endian uint32 format version and a Text record.
+constexpr char   BinaryLogMagic[8]   = { 'P', 'A', 'L', 'I', 'L', 'O', 'G', 'B' };
+constexpr uint32 BinaryLogVersion    = 1;
+constexpr uint32 BinaryLogHeaderSize = sizeof(BinaryLogMagic) + sizeof(uint32);
+
+// Record tags of the binary log format. Each record is a tag byte followed by the fields listed next to its tag. A
+// "varint" is an unsigned LEB128 number and a "zigzag" is a signed number folded into a varint. Strings are written
+// once in a DefineString record and referenced by ID afterwards; IDs count up from zero in definition order.
+enum class BinaryTag : uint8
+{
+    Text            = 0x00, // varint length, chars: JSON text logged before the file was opened. Only appears first.
+    DefineString    = 0x01, // varint length, chars: assigns the next string ID to this string.
+    BeginList       = 0x02,
+    BeginInlineList = 0x03,
+    EndList         = 0x04,
+    BeginMap        = 0x05,
+    BeginInlineMap  = 0x06,
+    EndMap          = 0x07,
+    Key             = 0x08, // varint string ID.
+    String          = 0x09, // varint string ID.
+    InlineString    = 0x0A, // varint length, chars: a string value which was too long or too late to be interned.
+    Uint            = 0x0B, // varint.
+    Int             = 0x0C, // zigzag.
+    Float           = 0x0D, // 4 bytes: IEEE-754 single precision, little-endian.
+    False           = 0x0E,
+    True            = 0x0F,
+    Null            = 0x10,
+    Object          = 0x11, // varint class name ID, varint object ID.
+    BeginFunc       = 0x12, // varint class name ID, varint object ID, varint function name ID, varint thread ID,
+                            // zigzag preCallTime minus the previous BeginFunc's preCallTime,
+                            // zigzag postCallTime minus preCallTime.
+};
+
+// =====================================================================================================================
+// Encodes the same token stream as Util::JsonWriter into the compact binary log format described above. None of the
+// values are formatted as text: integers are varint-encoded, floats are stored raw, keys and string values are interned
+// and PAL objects and function headers get dedicated records. tools/interfaceLoggerTools/convertBinaryLog.py expands a
+// binary log into exactly the JSON text the JsonWriter would have produced.
+//
+// Keys, class names and function names are interned by address, so they must point to strings with static storage
+// duration (string literals or the constant name tables). String values are interned by content because some of them
+// are built in temporary buffers.
+class BinaryWriter
+{
+public:
+    BinaryWriter(Platform* pPlatform, Util::JsonStream* pStream);
+    ~BinaryWriter();
+
+    Result Init();
+
+    // Enough space for the file header plus a Text record tag and length.
+    static constexpr uint32 MaxPreambleSize = BinaryLogHeaderSize + 1 + 5;
+
+    // Fills pHeader (which must hold MaxPreambleSize bytes) with the file header and the Text record header which
+    // introduces textLength characters of JSON text. Returns the number of bytes written.
+    static uint32 EncodePreamble(uint32 textLength, void* pHeader);
+
+    void BeginList(bool isInline) { WriteTag(isInline ? BinaryTag::BeginInlineList : BinaryTag::BeginList); }
+    void EndList()                { WriteTag(BinaryTag::EndList); }
+    void BeginMap(bool isInline)  { WriteTag(isInline ? BinaryTag::BeginInlineMap : BinaryTag::BeginMap); }
+    void EndMap()                 { WriteTag(BinaryTag::EndMap); }
+    void NullValue()              { WriteTag(BinaryTag::Null); }
+    void Value(bool value)        { WriteTag(value ? BinaryTag::True : BinaryTag::False); }
+
+    void Key(const char* pKey);
+    void Value(const char* pValue);
+    void Value(uint64 value);
+    void Value(int64 value);
+    void Value(float value);
+
+    void Object(const char* pClassName, uint32 objectId);
+    void BeginFunc(
+        const char* pClassName,
+        uint32      objectId,
+        const char* pFuncName,
+        uint32      threadId,
+        uint64      preCallTime,
+        uint64      postCallTime);
+
+private:
+    // Strings longer than this are written inline instead of being interned.
+    static constexpr uint32 MaxInternedLength  = 256;
+    // String values are no longer interned once this many of them have been seen.
+    static constexpr uint32 MaxInternedStrings = 64 * 1024;
+    // The largest record which doesn't contain a string: a BeginFunc record with maximal varints.
+    static constexpr uint32 MaxRecordSize      = 1 + (4 * 5) + (2 * 10);
+
+    typedef Util::FlatHashMap<const char*, uint32, Platform> AddressIdMap;
+    typedef Util::FlatHashMap<const char*,
+                              uint32,
+                              Platform,
+                              Util::StringJenkinsHashFunc,
+                              Util::StringEqualFunc> StringIdMap;
+
+    void   WriteTag(BinaryTag tag);
+    void   WriteString(BinaryTag tag, const char* pString, uint32 length);
+    uint32 InternAddress(const char* pString);
+
+    static uint32 EncodeVarint(uint64 value, uint8* pOut);
+    static uint32 EncodeZigzag(int64 value, uint8* pOut)
+        { return EncodeVarint((static_cast<uint64>(value) << 1) ^ static_cast<uint64>(value >> 63), pOut); }
+
+    Platform*const          m_pPlatform;
+    Util::JsonStream*const  m_pStream;
+    uint32                  m_nextStringId;  // The ID the next DefineString record will assign.
+    uint64                  m_prevCallTime;  // The preCallTime of the last BeginFunc record.
+    AddressIdMap            m_addressIds;    // IDs of keys and names, by address.
+    StringIdMap             m_stringIds;     // IDs of string values, by content. The keys are owned copies.
+
+    PAL_DISALLOW_DEFAULT_CTOR(BinaryWriter);
+    PAL_DISALLOW_COPY_AND_ASSIGN(BinaryWriter);
+};
+
+} // InterfaceLogger
+} // Pal
@@ -57,6 +57,10 @@ CmdBuffer::CmdBuffer(
     m_funcTable.pfnCmdDrawIndexed              = CmdDrawIndexed;
     m_funcTable.pfnCmdDrawIndirectMulti        = CmdDrawIndirectMulti;
     m_funcTable.pfnCmdDrawIndexedIndirectMulti = CmdDrawIndexedIndirectMulti;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    m_funcTable.pfnCmdDrawMulti                = CmdDrawMulti;
+    m_funcTable.pfnCmdDrawIndexedMulti         = CmdDrawIndexedMulti;
+#endif
     m_funcTable.pfnCmdDispatch                 = CmdDispatch;
     m_funcTable.pfnCmdDispatchIndirect         = CmdDispatchIndirect;
     m_funcTable.pfnCmdDispatchOffset           = CmdDispatchOffset;
@@ -150,6 +154,48 @@ uint32 CmdBuffer::GetEmbeddedDataLimit() const
     return m_pNextLayer->GetEmbeddedDataLimit();
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+// =====================================================================================================================
+Result CmdBuffer::PatchUserData(
+    PipelineBindPoint bindPoint,
+    uint32            firstEntry,
+    uint32            entryCount,
+    const uint32*     pEntryValues)
+{
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::CmdBufferPatchUserData;
+    funcInfo.objectId     = m_objectId;
+    funcInfo.preCallTime  = m_pPlatform->GetTime();
+    const Result result   = m_pNextLayer->PatchUserData(bindPoint, firstEntry, entryCount, pEntryValues);
+    funcInfo.postCallTime = m_pPlatform->GetTime();
+
+    LogContext* pLogContext = nullptr;
+    if (m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        pLogContext->BeginInput();
+        pLogContext->KeyAndEnum("bindPoint", bindPoint);
+        pLogContext->KeyAndValue("firstEntry", firstEntry);
+        pLogContext->KeyAndBeginList("values", false);
+
+        for (uint32 idx = 0; idx < entryCount; ++idx)
+        {
+            pLogContext->Value(pEntryValues[idx]);
+        }
+
+        pLogContext->EndList();
+        pLogContext->EndInput();
+
+        pLogContext->BeginOutput();
+        pLogContext->KeyAndEnum("result", result);
+        pLogContext->EndOutput();
+
+        m_pPlatform->LogEndFunc(pLogContext);
+    }
+
+    return result;
+}
+#endif
+
 // =====================================================================================================================
 void CmdBuffer::CmdBindPipeline(
     const PipelineBindParams& params)
@@ -3257,6 +3303,114 @@ void PAL_STDCALL CmdBuffer::CmdDrawIndexedIndirectMulti(
     }
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+// =====================================================================================================================
+void PAL_STDCALL CmdBuffer::CmdDrawMulti(
+    ICmdBuffer*             pCmdBuffer,
+    uint32                  drawCount,
+    const DrawIndirectArgs* pDrawArgs,
+    uint32                  userDataEntry,
+    const uint32*           pUserDataValues)
+{
+    auto*const pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::CmdBufferCmdDrawMulti;
+    funcInfo.objectId     = pThis->m_objectId;
+    funcInfo.preCallTime  = pThis->m_pPlatform->GetTime();
+    pThis->m_pNextLayer->CmdDrawMulti(drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+    funcInfo.postCallTime = pThis->m_pPlatform->GetTime();
+
+    LogContext* pLogContext = nullptr;
+    if (pThis->m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        pLogContext->BeginInput();
+        pLogContext->KeyAndBeginList("drawArgs", false);
+
+        for (uint32 idx = 0; idx < drawCount; ++idx)
+        {
+            pLogContext->Struct(pDrawArgs[idx]);
+        }
+
+        pLogContext->EndList();
+        pLogContext->KeyAndValue("userDataEntry", userDataEntry);
+
+        if (pUserDataValues != nullptr)
+        {
+            pLogContext->KeyAndBeginList("userDataValues", false);
+
+            for (uint32 idx = 0; idx < drawCount; ++idx)
+            {
+                pLogContext->Value(pUserDataValues[idx]);
+            }
+
+            pLogContext->EndList();
+        }
+        else
+        {
+            pLogContext->KeyAndNullValue("userDataValues");
+        }
+
+        pLogContext->EndInput();
+
+        pThis->m_pPlatform->LogEndFunc(pLogContext);
+    }
+}
+
+// =====================================================================================================================
+void PAL_STDCALL CmdBuffer::CmdDrawIndexedMulti(
+    ICmdBuffer*                    pCmdBuffer,
+    uint32                         drawCount,
+    const DrawIndexedIndirectArgs* pDrawArgs,
+    uint32                         userDataEntry,
+    const uint32*                  pUserDataValues)
+{
+    auto*const pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::CmdBufferCmdDrawIndexedMulti;
+    funcInfo.objectId     = pThis->m_objectId;
+    funcInfo.preCallTime  = pThis->m_pPlatform->GetTime();
+    pThis->m_pNextLayer->CmdDrawIndexedMulti(drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+    funcInfo.postCallTime = pThis->m_pPlatform->GetTime();
+
+    LogContext* pLogContext = nullptr;
+    if (pThis->m_pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+    {
+        pLogContext->BeginInput();
+        pLogContext->KeyAndBeginList("drawArgs", false);
+
+        for (uint32 idx = 0; idx < drawCount; ++idx)
+        {
+            pLogContext->Struct(pDrawArgs[idx]);
+        }
+
+        pLogContext->EndList();
+        pLogContext->KeyAndValue("userDataEntry", userDataEntry);
+
+        if (pUserDataValues != nullptr)
+        {
+            pLogContext->KeyAndBeginList("userDataValues", false);
+
+            for (uint32 idx = 0; idx < drawCount; ++idx)
+            {
+                pLogContext->Value(pUserDataValues[idx]);
+            }
+
+            pLogContext->EndList();
+        }
+        else
+        {
+            pLogContext->KeyAndNullValue("userDataValues");
+        }
+
+        pLogContext->EndInput();
+
+        pThis->m_pPlatform->LogEndFunc(pLogContext);
+    }
+}
+#endif
+
 // =====================================================================================================================
 void PAL_STDCALL CmdBuffer::CmdDispatch(
     ICmdBuffer* pCmdBuffer,
@@ -52,6 +52,13 @@ public:
         ICmdAllocator* pCmdAllocator,
         bool           returnGpuMemory) override;
     virtual uint32 GetEmbeddedDataLimit() const override;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+    virtual Result PatchUserData(
+        PipelineBindPoint bindPoint,
+        uint32            firstEntry,
+        uint32            entryCount,
+        const uint32*     pEntryValues) override;
+#endif
     virtual void CmdBindPipeline(
         const PipelineBindParams& params) override;
     virtual void CmdBindMsaaState(
@@ -504,6 +511,20 @@ private:
         uint32            stride,
         uint32            maximumCount,
         gpusize           countGpuAddr);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    static void PAL_STDCALL CmdDrawMulti(
+        ICmdBuffer*             pCmdBuffer,
+        uint32                  drawCount,
+        const DrawIndirectArgs* pDrawArgs,
+        uint32                  userDataEntry,
+        const uint32*           pUserDataValues);
+    static void PAL_STDCALL CmdDrawIndexedMulti(
+        ICmdBuffer*                    pCmdBuffer,
+        uint32                         drawCount,
+        const DrawIndexedIndirectArgs* pDrawArgs,
+        uint32                         userDataEntry,
+        const uint32*                  pUserDataValues);
+#endif
     static void PAL_STDCALL CmdDispatch(
         ICmdBuffer* pCmdBuffer,
         uint32      x,
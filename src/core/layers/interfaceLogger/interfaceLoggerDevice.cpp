@@ -1538,6 +1538,72 @@ Result Device::CreateGraphicsPipeline(
     return result;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 487
+// =====================================================================================================================
+Result Device::CreateGraphicsPipelines(
+    uint32                            count,
+    const GraphicsPipelineCreateInfo* pCreateInfos,
+    void*const*                       ppPlacementAddrs,
+    IPipeline**                       ppPipelines,
+    Result*                           pResults,
+    PipelineBatchStats*               pStats)
+{
+    auto*const pPlatform = static_cast<Platform*>(m_pPlatform);
+
+    BeginFuncInfo funcInfo;
+    funcInfo.funcId       = InterfaceFunc::DeviceCreateGraphicsPipeline;
+    funcInfo.objectId     = m_objectId;
+    funcInfo.preCallTime  = pPlatform->GetTime();
+    const Result result   = CreateNextLayerGraphicsPipelines(count,
+                                                             pCreateInfos,
+                                                             ppPlacementAddrs,
+                                                             sizeof(Pipeline),
+                                                             ppPipelines,
+                                                             pResults,
+                                                             pStats);
+    funcInfo.postCallTime = pPlatform->GetTime();
+
+    // The log has no notion of a batch, so each pipeline is logged as if it was created by its own
+    // CreateGraphicsPipeline() call which took as long as the whole batch.
+    for (uint32 i = 0; (ppPipelines != nullptr) && (i < count); ++i)
+    {
+        IPipeline*const pNextPipeline = ppPipelines[i];
+
+        if (pNextPipeline != nullptr)
+        {
+            pNextPipeline->SetClientData(ppPlacementAddrs[i]);
+
+            const uint32 objectId = pPlatform->NewObjectId(InterfaceObject::Pipeline);
+
+            ppPipelines[i] = PAL_PLACEMENT_NEW(ppPlacementAddrs[i]) Pipeline(pNextPipeline, this, objectId);
+        }
+
+        LogContext* pLogContext = nullptr;
+        if (pPlatform->LogBeginFunc(funcInfo, &pLogContext))
+        {
+            Result pipelineResult = (ppPipelines[i] != nullptr) ? Result::Success : result;
+            if (pResults != nullptr)
+            {
+                pipelineResult = pResults[i];
+            }
+
+            pLogContext->BeginInput();
+            pLogContext->KeyAndStruct("createInfo", pCreateInfos[i]);
+            pLogContext->EndInput();
+
+            pLogContext->BeginOutput();
+            pLogContext->KeyAndEnum("result", pipelineResult);
+            pLogContext->KeyAndObject("createdObj", ppPipelines[i]);
+            pLogContext->EndOutput();
+
+            pPlatform->LogEndFunc(pLogContext);
+        }
+    }
+
+    return result;
+}
+#endif
+
 // =====================================================================================================================
 size_t Device::GetMsaaStateSize(
     const MsaaStateCreateInfo& createInfo,
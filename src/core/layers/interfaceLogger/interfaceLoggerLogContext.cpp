@@ -46,6 +46,10 @@
 #include "core/layers/interfaceLogger/interfaceLoggerQueueSemaphore.h"
 #include "core/layers/interfaceLogger/interfaceLoggerScreen.h"
 #include "core/layers/interfaceLogger/interfaceLoggerSwapChain.h"
+#include "core/g_palPlatformSettings.h"
+#include "palLockFreeRingBufferImpl.h"
+#include "palSysUtil.h"
+#include <csignal>
 
 using namespace Util;
 
@@ -102,6 +106,9 @@ static constexpr FuncFormattingEntry FuncFormattingTable[] =
     { InterfaceFunc::CmdBufferBegin,                                            InterfaceObject::CmdBuffer,            "Begin"                                   },
     { InterfaceFunc::CmdBufferEnd,                                              InterfaceObject::CmdBuffer,            "End"                                     },
     { InterfaceFunc::CmdBufferReset,                                            InterfaceObject::CmdBuffer,            "Reset"                                   },
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+    { InterfaceFunc::CmdBufferPatchUserData,                                    InterfaceObject::CmdBuffer,            "PatchUserData"                           },
+#endif
     { InterfaceFunc::CmdBufferCmdBindPipeline,                                  InterfaceObject::CmdBuffer,            "CmdBindPipeline"                         },
     { InterfaceFunc::CmdBufferCmdBindMsaaState,                                 InterfaceObject::CmdBuffer,            "CmdBindMsaaState"                        },
     { InterfaceFunc::CmdBufferCmdBindColorBlendState,                           InterfaceObject::CmdBuffer,            "CmdBindColorBlendState"                  },
@@ -136,6 +143,10 @@ static constexpr FuncFormattingEntry FuncFormattingTable[] =
     { InterfaceFunc::CmdBufferCmdDrawIndexed,                                   InterfaceObject::CmdBuffer,            "CmdDrawIndexed"                          },
     { InterfaceFunc::CmdBufferCmdDrawIndirectMulti,                             InterfaceObject::CmdBuffer,            "CmdDrawIndirectMulti"                    },
     { InterfaceFunc::CmdBufferCmdDrawIndexedIndirectMulti,                      InterfaceObject::CmdBuffer,            "CmdDrawIndexedIndirectMulti"             },
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    { InterfaceFunc::CmdBufferCmdDrawMulti,                                     InterfaceObject::CmdBuffer,            "CmdDrawMulti"                            },
+    { InterfaceFunc::CmdBufferCmdDrawIndexedMulti,                              InterfaceObject::CmdBuffer,            "CmdDrawIndexedMulti"                     },
+#endif
     { InterfaceFunc::CmdBufferCmdDispatch,                                      InterfaceObject::CmdBuffer,            "CmdDispatch"                             },
     { InterfaceFunc::CmdBufferCmdDispatchIndirect,                              InterfaceObject::CmdBuffer,            "CmdDispatchIndirect"                     },
     { InterfaceFunc::CmdBufferCmdDispatchOffset,                                InterfaceObject::CmdBuffer,            "CmdDispatchOffset"                       },
@@ -340,6 +351,95 @@ static constexpr FuncFormattingEntry FuncFormattingTable[] =
 static_assert(ArrayLen(FuncFormattingTable) == static_cast<size_t>(InterfaceFunc::Count),
               "The FuncFormattingTable must be updated.");
 
+// Log streams in CrashSafeFlush mode. A fatal signal waits for each of their writer threads to drain. The slots are
+// only changed while holding s_crashSafeLock, which also covers s_numCrashSafeStreams and installing the signal
+// handlers; the signal handler reads the slots without it.
+constexpr uint32 MaxCrashSafeStreams = 64;
+static LogStream* volatile s_crashSafeStreams[MaxCrashSafeStreams];
+static uint32              s_numCrashSafeStreams = 0;
+static volatile uint32     s_crashSafeLock       = 0;
+
+// The fatal signals which drain the crash-safe log streams, and whatever handled them before.
+static const int FatalSignals[] =
+{
+    SIGSEGV,
+    SIGILL,
+    SIGFPE,
+    SIGABRT,
+#if defined(SIGBUS)
+    SIGBUS,
+#endif
+};
+static struct sigaction s_prevSignalActions[ArrayLen(FatalSignals)];
+
+// How long a fatal signal waits for each crash-safe writer thread to drain its ring.
+constexpr uint32 SignalDrainTimeoutMs = 1000;
+
+// =====================================================================================================================
+// Adds a log stream to the crash-safe streams, installing the fatal signal handlers if it is the first one.
+static void RegisterCrashSafeStream(
+    LogStream* pStream,
+    void       (*pfnSignalHandler)(int))
+{
+    while (AtomicCompareAndSwap(&s_crashSafeLock, 0, 1) != 0)
+    {
+        YieldThread();
+    }
+
+    for (uint32 idx = 0; idx < MaxCrashSafeStreams; ++idx)
+    {
+        if (s_crashSafeStreams[idx] == nullptr)
+        {
+            s_crashSafeStreams[idx] = pStream;
+
+            if (s_numCrashSafeStreams++ == 0)
+            {
+                struct sigaction action = {};
+                action.sa_handler = pfnSignalHandler;
+                sigemptyset(&action.sa_mask);
+
+                for (uint32 sigIdx = 0; sigIdx < ArrayLen(FatalSignals); ++sigIdx)
+                {
+                    sigaction(FatalSignals[sigIdx], &action, &s_prevSignalActions[sigIdx]);
+                }
+            }
+            break;
+        }
+    }
+
+    AtomicExchange(&s_crashSafeLock, 0);
+}
+
+// =====================================================================================================================
+// Removes a log stream from the crash-safe streams, restoring the previous signal actions if it was the last one.
+static void UnregisterCrashSafeStream(
+    const LogStream* pStream)
+{
+    while (AtomicCompareAndSwap(&s_crashSafeLock, 0, 1) != 0)
+    {
+        YieldThread();
+    }
+
+    for (uint32 idx = 0; idx < MaxCrashSafeStreams; ++idx)
+    {
+        if (s_crashSafeStreams[idx] == pStream)
+        {
+            s_crashSafeStreams[idx] = nullptr;
+
+            if (--s_numCrashSafeStreams == 0)
+            {
+                for (uint32 sigIdx = 0; sigIdx < ArrayLen(FatalSignals); ++sigIdx)
+                {
+                    sigaction(FatalSignals[sigIdx], &s_prevSignalActions[sigIdx], nullptr);
+                }
+            }
+            break;
+        }
+    }
+
+    AtomicExchange(&s_crashSafeLock, 0);
+}
+
 // =====================================================================================================================
 LogStream::LogStream(
     Platform* pPlatform)
@@ -347,14 +447,36 @@ LogStream::LogStream(
     m_pPlatform(pPlatform),
     m_pBuffer(nullptr),
     m_bufferSize(0),
-    m_bufferUsed(0)
+    m_bufferUsed(0),
+    m_pRing(nullptr),
+    m_pRingBuffer(nullptr),
+    m_crashSafe(false),
+    m_numSubmitted(0),
+    m_numWritten(0)
 {
 }
 
 // =====================================================================================================================
 LogStream::~LogStream()
 {
-    if (m_file.IsOpen())
+    if (m_pRing != nullptr)
+    {
+        if (m_crashSafe)
+        {
+            UnregisterCrashSafeStream(this);
+        }
+
+        // Hand over whatever is left and let the writer thread finish up.
+        SubmitBuffer(AsyncBufferFlush | AsyncBufferLast);
+        m_writerThread.Join();
+
+        m_pRing->Destroy(nullptr, nullptr);
+        PAL_SAFE_DELETE(m_pRing, m_pPlatform);
+
+        // m_pBuffer pointed into the ring, so there's nothing else to free.
+        m_pBuffer = nullptr;
+    }
+    else if (m_file.IsOpen())
     {
         // Write out anything left in the buffer. If the file was never opened nothing gets written.
         const Result result = WriteFile();
@@ -366,9 +488,11 @@ LogStream::~LogStream()
 
 // =====================================================================================================================
 Result LogStream::OpenFile(
-    const char* pFilePath)
+    const char* pFilePath,
+    bool        binary)
 {
-    Result result = m_file.Open(pFilePath, Util::FileAccessWrite);
+    const uint32 accessFlags = binary ? (FileAccessWrite | FileAccessBinary) : FileAccessWrite;
+    Result       result      = m_file.Open(pFilePath, accessFlags);
 
     if (result == Result::Success)
     {
@@ -376,10 +500,24 @@ Result LogStream::OpenFile(
         result = WriteFile();
     }
 
+    if (result == Result::Success)
+    {
+        const auto& settings = m_pPlatform->PlatformSettings().interfaceLoggerConfig;
+
+        if (settings.asyncBufferCount > 0)
+        {
+            // If the writer thread can't be started we just keep writing on the logging thread.
+            const Result threadResult = StartWriterThread(settings.asyncBufferCount, settings.crashSafeFlush);
+            PAL_ALERT(threadResult != Result::Success);
+        }
+    }
+
     return result;
 }
 
 // =====================================================================================================================
+// Writes all buffered text to the log file and flushes it to disk. If a writer thread is running, this waits for it to
+// catch up.
 Result LogStream::WriteFile()
 {
     Result result = Result::Success;
@@ -388,6 +526,11 @@ Result LogStream::WriteFile()
     {
         result = Result::ErrorUnavailable;
     }
+    else if (m_pRing != nullptr)
+    {
+        SubmitBuffer(AsyncBufferFlush);
+        WaitForWriter(UINT32_MAX);
+    }
     else if (m_bufferUsed > 0)
     {
         result       = m_file.Write(m_pBuffer, m_bufferUsed * sizeof(char));
@@ -403,24 +546,89 @@ Result LogStream::WriteFile()
     return result;
 }
 
+// =====================================================================================================================
+// Called after each complete log entry. Without a writer thread the entry is written immediately; otherwise it stays in
+// the current ring buffer until that fills up, unless the stream is in CrashSafeFlush mode.
+Result LogStream::Commit()
+{
+    Result result = Result::Success;
+
+    if (m_pRing == nullptr)
+    {
+        result = WriteFile();
+    }
+    else if (m_crashSafe && (m_bufferUsed > 0))
+    {
+        SubmitBuffer(AsyncBufferFlush);
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 void LogStream::WriteString(
     const char* pString,
     uint32      length)
 {
-    VerifyUnusedSpace(length);
-    memcpy(m_pBuffer + m_bufferUsed, pString, length * sizeof(char));
-    m_bufferUsed += length;
+    if (m_pRing != nullptr)
+    {
+        // Split the text across as many ring buffers as it takes.
+        while (length > 0)
+        {
+            if (m_bufferUsed == m_bufferSize)
+            {
+                SubmitBuffer(0);
+            }
+
+            const uint32 count = Min(length, m_bufferSize - m_bufferUsed);
+            memcpy(m_pBuffer + m_bufferUsed, pString, count * sizeof(char));
+
+            m_bufferUsed += count;
+            pString      += count;
+            length       -= count;
+        }
+    }
+    else
+    {
+        VerifyUnusedSpace(length);
+        memcpy(m_pBuffer + m_bufferUsed, pString, length * sizeof(char));
+        m_bufferUsed += length;
+    }
 }
 
 // =====================================================================================================================
 void LogStream::WriteCharacter(
     char character)
 {
-    VerifyUnusedSpace(1);
+    if (m_pRing != nullptr)
+    {
+        if (m_bufferUsed == m_bufferSize)
+        {
+            SubmitBuffer(0);
+        }
+    }
+    else
+    {
+        VerifyUnusedSpace(1);
+    }
+
     m_pBuffer[m_bufferUsed++] = character;
 }
 
+// =====================================================================================================================
+void LogStream::Prepend(
+    const char* pData,
+    uint32      size)
+{
+    // Nothing has been handed to the writer thread yet so everything still lives in our growable buffer.
+    PAL_ASSERT((IsFileOpen() == false) && (m_pRing == nullptr));
+
+    VerifyUnusedSpace(size);
+    memmove(m_pBuffer + size, m_pBuffer, m_bufferUsed * sizeof(char));
+    memcpy(m_pBuffer, pData, size * sizeof(char));
+    m_bufferUsed += size;
+}
+
 // =====================================================================================================================
 // Verifies that the buffer has enough space for an additional "size" characters, reallocating if necessary.
 void LogStream::VerifyUnusedSpace(
@@ -441,12 +649,190 @@ void LogStream::VerifyUnusedSpace(
     }
 }
 
+// =====================================================================================================================
+// Switches the stream over to a background writer thread with a ring of numBuffers fixed-size buffers. The staging
+// buffer must be empty when this is called.
+Result LogStream::StartWriterThread(
+    uint32 numBuffers,
+    bool   crashSafe)
+{
+    PAL_ASSERT(m_bufferUsed == 0);
+
+    Result result = Result::ErrorOutOfMemory;
+
+    m_pRing = PAL_NEW(BufferRing, m_pPlatform, AllocInternal)(numBuffers,
+                                                               sizeof(AsyncBufferHeader) + AsyncBufferChars,
+                                                               m_pPlatform);
+
+    if (m_pRing != nullptr)
+    {
+        result = m_pRing->Init(nullptr, nullptr);
+    }
+
+    void* pFirstBuffer = nullptr;
+
+    if (result == Result::Success)
+    {
+        result = m_pRing->GetBufferForWriting(0, &pFirstBuffer);
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_writerThread.Begin(&WriterThread, this);
+
+        if (result != Result::Success)
+        {
+            // Hand the buffer back so that the ring is in a consistent state when it's destroyed.
+            m_pRing->ReleaseWriteBuffer(pFirstBuffer);
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        PAL_SAFE_FREE(m_pBuffer, m_pPlatform);
+
+        m_pRingBuffer = static_cast<AsyncBufferHeader*>(pFirstBuffer);
+        m_pBuffer     = reinterpret_cast<char*>(m_pRingBuffer + 1);
+        m_bufferSize  = AsyncBufferChars;
+        m_bufferUsed  = 0;
+        m_crashSafe   = crashSafe;
+
+        if (crashSafe)
+        {
+            RegisterCrashSafeStream(this, &SignalHandler);
+        }
+    }
+    else if (m_pRing != nullptr)
+    {
+        m_pRing->Destroy(nullptr, nullptr);
+        PAL_SAFE_DELETE(m_pRing, m_pPlatform);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Hands the current ring buffer to the writer thread and, unless it is the last one, acquires the next. This blocks if
+// the writer thread hasn't yet finished with any of the other buffers.
+void LogStream::SubmitBuffer(
+    uint32 flags)
+{
+    m_pRingBuffer->numChars = m_bufferUsed;
+    m_pRingBuffer->flags    = flags;
+
+    AtomicIncrement(&m_numSubmitted);
+    m_pRing->ReleaseWriteBuffer(m_pRingBuffer);
+
+    m_pRingBuffer = nullptr;
+    m_bufferUsed  = 0;
+
+    if (TestAnyFlagSet(flags, AsyncBufferLast) == false)
+    {
+        void*        pBuffer = nullptr;
+        const Result result  = m_pRing->GetBufferForWriting(UINT32_MAX, &pBuffer);
+        PAL_ASSERT(result == Result::Success);
+
+        m_pRingBuffer = static_cast<AsyncBufferHeader*>(pBuffer);
+        m_pBuffer     = reinterpret_cast<char*>(m_pRingBuffer + 1);
+    }
+}
+
+// =====================================================================================================================
+// Waits until the writer thread has finished with every submitted buffer or the timeout expires.
+void LogStream::WaitForWriter(
+    uint32 timeoutMs
+    ) const
+{
+    const int64 deadline = GetPerfCpuTime() + ((static_cast<int64>(timeoutMs) * GetPerfFrequency()) / 1000);
+
+    while ((m_numWritten != m_numSubmitted) &&
+           ((timeoutMs == UINT32_MAX) || (GetPerfCpuTime() < deadline)))
+    {
+        YieldThread();
+    }
+}
+
+// =====================================================================================================================
+// Entry point of the background writer thread: writes each submitted ring buffer to the log file in order.
+void LogStream::WriterThread(
+    void* pParam)
+{
+    LogStream*const pThis  = static_cast<LogStream*>(pParam);
+    bool            isLast = false;
+
+    while (isLast == false)
+    {
+        const void* pBuffer = nullptr;
+
+        if (pThis->m_pRing->GetBufferForReading(UINT32_MAX, &pBuffer) == Result::Success)
+        {
+            const auto*const pHeader = static_cast<const AsyncBufferHeader*>(pBuffer);
+            Result           result  = Result::Success;
+
+            if (pHeader->numChars > 0)
+            {
+                result = pThis->m_file.Write(pHeader + 1, pHeader->numChars * sizeof(char));
+            }
+
+            if ((result == Result::Success) &&
+                (pThis->m_crashSafe || TestAnyFlagSet(pHeader->flags, AsyncBufferFlush)))
+            {
+                result = pThis->m_file.Flush();
+            }
+
+            PAL_ASSERT(result == Result::Success);
+
+            isLast = TestAnyFlagSet(pHeader->flags, AsyncBufferLast);
+
+            pThis->m_pRing->ReleaseReadBuffer(pBuffer);
+            AtomicIncrement(&pThis->m_numWritten);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Handles fatal signals in CrashSafeFlush mode: gives each writer thread a chance to drain its ring, then hands the
+// signal to whoever handled it before.
+void LogStream::SignalHandler(
+    int signalId)
+{
+    for (uint32 idx = 0; idx < MaxCrashSafeStreams; ++idx)
+    {
+        const LogStream*const pStream = s_crashSafeStreams[idx];
+
+        if (pStream != nullptr)
+        {
+            pStream->WaitForWriter(SignalDrainTimeoutMs);
+        }
+    }
+
+    for (uint32 idx = 0; idx < ArrayLen(FatalSignals); ++idx)
+    {
+        if (FatalSignals[idx] == signalId)
+        {
+            struct sigaction prevAction = s_prevSignalActions[idx];
+
+            // An ignored fault would just happen again, so let the default action take the process down instead.
+            if (((prevAction.sa_flags & SA_SIGINFO) == 0) && (prevAction.sa_handler == SIG_IGN))
+            {
+                prevAction.sa_handler = SIG_DFL;
+            }
+
+            sigaction(signalId, &prevAction, nullptr);
+        }
+    }
+
+    raise(signalId);
+}
+
 // =====================================================================================================================
 LogContext::LogContext(
     Platform* pPlatform)
     :
     JsonWriter(&m_stream),
-    m_stream(pPlatform)
+    m_stream(pPlatform),
+    m_binaryWriter(pPlatform, &m_stream),
+    m_binary(false)
 {
 #if PAL_ENABLE_PRINTS_ASSERTS
     for (uint32 idx = 0; idx < static_cast<uint32>(InterfaceFunc::Count); ++idx)
@@ -466,6 +852,37 @@ LogContext::~LogContext()
     EndList();
 }
 
+// =====================================================================================================================
+Result LogContext::OpenFile(
+    const char* pFilePath,
+    bool        binary)
+{
+    Result result = Result::Success;
+
+    if (binary)
+    {
+        result = m_binaryWriter.Init();
+
+        if (result == Result::Success)
+        {
+            // Whatever was logged before now is already JSON text. It goes into the file as-is, right after the
+            // binary log's header, and the converter copies it straight into its output.
+            char         preamble[BinaryWriter::MaxPreambleSize];
+            const uint32 preambleSize = BinaryWriter::EncodePreamble(m_stream.BufferedSize(), preamble);
+
+            m_stream.Prepend(preamble, preambleSize);
+            m_binary = true;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_stream.OpenFile(pFilePath, binary);
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 void LogContext::BeginFunc(
     const BeginFuncInfo& info,
@@ -473,14 +890,26 @@ void LogContext::BeginFunc(
 {
     auto const& funcData = FuncFormattingTable[static_cast<uint32>(info.funcId)];
 
-    BeginMap(false);
-    KeyAndValue("_type", "InterfaceFunc");
-    Key("this");
-    Object(funcData.objectType, info.objectId);
-    KeyAndValue("name", funcData.pFuncName);
-    KeyAndValue("thread", threadId);
-    KeyAndValue("preCallTime", info.preCallTime);
-    KeyAndValue("postCallTime", info.postCallTime);
+    if (m_binary)
+    {
+        m_binaryWriter.BeginFunc(ObjectNames[static_cast<uint32>(funcData.objectType)],
+                                 info.objectId,
+                                 funcData.pFuncName,
+                                 threadId,
+                                 info.preCallTime,
+                                 info.postCallTime);
+    }
+    else
+    {
+        BeginMap(false);
+        KeyAndValue("_type", "InterfaceFunc");
+        Key("this");
+        Object(funcData.objectType, info.objectId);
+        KeyAndValue("name", funcData.pFuncName);
+        KeyAndValue("thread", threadId);
+        KeyAndValue("preCallTime", info.preCallTime);
+        KeyAndValue("postCallTime", info.postCallTime);
+    }
 }
 
 // =====================================================================================================================
@@ -488,10 +917,10 @@ void LogContext::EndFunc()
 {
     EndMap();
 
-    // Flush our buffered JSON text to our log file if it's already been opened.
+    // Hand our buffered JSON text to our log file if it's already been opened.
     if (m_stream.IsFileOpen())
     {
-        const Result result = m_stream.WriteFile();
+        const Result result = m_stream.Commit();
         PAL_ASSERT(result == Result::Success);
     }
 }
@@ -795,10 +1224,17 @@ void LogContext::Object(
     InterfaceObject objectType,
     uint32          objectId)
 {
-    BeginMap(true);
-    KeyAndValue("class", ObjectNames[static_cast<uint32>(objectType)]);
-    KeyAndValue("id", objectId);
-    EndMap();
+    if (m_binary)
+    {
+        m_binaryWriter.Object(ObjectNames[static_cast<uint32>(objectType)], objectId);
+    }
+    else
+    {
+        BeginMap(true);
+        KeyAndValue("class", ObjectNames[static_cast<uint32>(objectType)]);
+        KeyAndValue("id", objectId);
+        EndMap();
+    }
 }
 
 // =====================================================================================================================
@@ -26,8 +26,11 @@
 #pragma once
 
 #include "core/layers/decorators.h"
+#include "core/layers/interfaceLogger/interfaceLoggerBinaryWriter.h"
 #include "palFile.h"
 #include "palJsonWriter.h"
+#include "palLockFreeRingBuffer.h"
+#include "palThread.h"
 
 namespace Pal
 {
@@ -77,6 +80,9 @@ enum class InterfaceFunc : uint32
     CmdBufferBegin,
     CmdBufferEnd,
     CmdBufferReset,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+    CmdBufferPatchUserData,
+#endif
     CmdBufferCmdBindPipeline,
     CmdBufferCmdBindMsaaState,
     CmdBufferCmdBindColorBlendState,
@@ -111,6 +117,10 @@ enum class InterfaceFunc : uint32
     CmdBufferCmdDrawIndexed,
     CmdBufferCmdDrawIndirectMulti,
     CmdBufferCmdDrawIndexedIndirectMulti,
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    CmdBufferCmdDrawMulti,
+    CmdBufferCmdDrawIndexedMulti,
+#endif
     CmdBufferCmdDispatch,
     CmdBufferCmdDispatchIndirect,
     CmdBufferCmdDispatchOffset,
@@ -325,14 +335,27 @@ struct BeginFuncInfo
 // =====================================================================================================================
 // JSON stream that records the text stream using a staging buffer and a log file. WriteFile must be called explicitly
 // to flush all buffered text. Note that this makes it possible to generate JSON text before OpenFile has been called.
+//
+// Unless the AsyncBufferCount setting is zero, opening the file also starts a background writer thread. From then on
+// text is staged in fixed-size buffers which are handed to the writer through a lock-free ring, so the logging thread
+// never touches the file. The ring bounds the memory used by each log; if the writer falls behind, the logging thread
+// waits for it to free up a buffer. In CrashSafeFlush mode every logged call is handed over immediately, the writer
+// flushes after each write, and a fatal signal waits for the writers to drain before the process goes down.
 class LogStream : public Util::JsonStream
 {
 public:
     explicit LogStream(Platform* pPlatform);
     virtual ~LogStream();
 
-    Result OpenFile(const char* pFilePath);
+    Result OpenFile(const char* pFilePath, bool binary);
     Result WriteFile();
+    Result Commit();
+
+    // Inserts data in front of everything buffered so far. Must be called before the file has been opened.
+    void Prepend(const char* pData, uint32 size);
+
+    // Returns the number of characters which have been buffered but not yet handed to the file.
+    uint32 BufferedSize() const { return m_bufferUsed; }
 
     // Returns true if the log file has already been opened.
     bool IsFileOpen() const { return m_file.IsOpen(); }
@@ -341,13 +364,44 @@ public:
     virtual void WriteCharacter(char character) override;
 
 private:
-    void VerifyUnusedSpace(uint32 size);
-
-    Platform*const m_pPlatform;
-    Util::File     m_file;       // The text stream is being written here.
-    char*          m_pBuffer;    // Buffered text data that needs to be written to the file.
-    uint32         m_bufferSize; // The size of the buffer in characters.
-    uint32         m_bufferUsed; // How many characters of the buffer are in use.
+    typedef Util::LockFreeRingBuffer<Platform, Util::RingBufferConcurrency::SingleProducerSingleConsumer> BufferRing;
+
+    // Each buffer in the ring begins with this header, followed by the text.
+    struct AsyncBufferHeader
+    {
+        uint32 numChars;    // How many characters of text follow the header.
+        uint32 flags;       // AsyncBufferFlags telling the writer thread what to do after writing the text.
+    };
+
+    enum AsyncBufferFlags : uint32
+    {
+        AsyncBufferFlush = 0x1, // Flush the file to disk.
+        AsyncBufferLast  = 0x2, // Exit the writer thread; no more buffers will follow.
+    };
+
+    // The number of characters of text which fit in one ring buffer.
+    static constexpr uint32 AsyncBufferChars = (64 * 1024) - sizeof(AsyncBufferHeader);
+
+    void   VerifyUnusedSpace(uint32 size);
+    Result StartWriterThread(uint32 numBuffers, bool crashSafe);
+    void   SubmitBuffer(uint32 flags);
+    void   WaitForWriter(uint32 timeoutMs) const;
+
+    static void WriterThread(void* pParam);
+    static void SignalHandler(int signalId);
+
+    Platform*const      m_pPlatform;
+    Util::File          m_file;         // The text stream is being written here.
+    char*               m_pBuffer;      // Buffered text data that needs to be written to the file.
+    uint32              m_bufferSize;   // The size of the buffer in characters.
+    uint32              m_bufferUsed;   // How many characters of the buffer are in use.
+
+    BufferRing*         m_pRing;        // Buffers queued for the writer thread, or null if writes are synchronous.
+    AsyncBufferHeader*  m_pRingBuffer;  // The ring buffer m_pBuffer currently points into.
+    Util::Thread        m_writerThread;
+    bool                m_crashSafe;
+    volatile uint32     m_numSubmitted; // Ring buffers handed to the writer thread.
+    volatile uint32     m_numWritten;   // Ring buffers the writer thread has finished with.
 
     PAL_DISALLOW_DEFAULT_CTOR(LogStream);
     PAL_DISALLOW_COPY_AND_ASSIGN(LogStream);
@@ -392,14 +446,18 @@ private:
 // Note that the LogContext also defines a common format for logging instances of PAL interface objects. Each object is
 // represented by a map containing a "class" key identifying the PAL interface class (e.g., IDevice) and an "id" key
 // identifying the particular instance of the class. All IDs are unique and zero-based.
+//
+// If the BinaryCapture setting is enabled the same entries are written in the binary log format instead (see
+// BinaryWriter), which tools/interfaceLoggerTools/convertBinaryLog.py turns back into this JSON.
 class LogContext : public Util::JsonWriter
 {
 public:
     explicit LogContext(Platform* pPlatform);
     virtual ~LogContext();
 
-    // Must be called once to associate a context with a log file. Logging can occur before the log is opened.
-    Result OpenFile(const char* pFilePath) { return m_stream.OpenFile(pFilePath); }
+    // Must be called once to associate a context with a log file. Logging can occur before the log is opened. If binary
+    // is true everything logged from now on is written in the binary log format (see BinaryWriter).
+    Result OpenFile(const char* pFilePath, bool binary);
 
     // These functions begin and end a specially formatted map which represents a PAL interface function.
     void BeginFunc(const BeginFuncInfo& info, uint32 threadId);
@@ -412,6 +470,58 @@ public:
     void BeginOutput() { KeyAndBeginMap("output", false); }
     void EndOutput()   { EndMap(); }
 
+    // These hide the Util::JsonWriter functions of the same names so that each token goes to the BinaryWriter instead
+    // once a binary log has been opened. Everything else in this class is built on top of them.
+    void BeginList(bool isInline)
+        { if (m_binary) { m_binaryWriter.BeginList(isInline); } else { JsonWriter::BeginList(isInline); } }
+    void EndList()
+        { if (m_binary) { m_binaryWriter.EndList(); } else { JsonWriter::EndList(); } }
+    void BeginMap(bool isInline)
+        { if (m_binary) { m_binaryWriter.BeginMap(isInline); } else { JsonWriter::BeginMap(isInline); } }
+    void EndMap()
+        { if (m_binary) { m_binaryWriter.EndMap(); } else { JsonWriter::EndMap(); } }
+    void Key(const char* pKey)
+        { if (m_binary) { m_binaryWriter.Key(pKey); } else { JsonWriter::Key(pKey); } }
+    void Value(const char* pValue)
+        { if (m_binary) { m_binaryWriter.Value(pValue); } else { JsonWriter::Value(pValue); } }
+    void Value(uint64 value)
+        { if (m_binary) { m_binaryWriter.Value(value); } else { JsonWriter::Value(value); } }
+    void Value(uint32 value)
+        { if (m_binary) { m_binaryWriter.Value(uint64(value)); } else { JsonWriter::Value(value); } }
+    void Value(uint16 value)
+        { if (m_binary) { m_binaryWriter.Value(uint64(value)); } else { JsonWriter::Value(value); } }
+    void Value(uint8 value)
+        { if (m_binary) { m_binaryWriter.Value(uint64(value)); } else { JsonWriter::Value(value); } }
+    void Value(int64 value)
+        { if (m_binary) { m_binaryWriter.Value(value); } else { JsonWriter::Value(value); } }
+    void Value(int32 value)
+        { if (m_binary) { m_binaryWriter.Value(int64(value)); } else { JsonWriter::Value(value); } }
+    void Value(int16 value)
+        { if (m_binary) { m_binaryWriter.Value(int64(value)); } else { JsonWriter::Value(value); } }
+    void Value(int8 value)
+        { if (m_binary) { m_binaryWriter.Value(int64(value)); } else { JsonWriter::Value(value); } }
+    void Value(float value)
+        { if (m_binary) { m_binaryWriter.Value(value); } else { JsonWriter::Value(value); } }
+    void Value(bool value)
+        { if (m_binary) { m_binaryWriter.Value(value); } else { JsonWriter::Value(value); } }
+    void NullValue()
+        { if (m_binary) { m_binaryWriter.NullValue(); } else { JsonWriter::NullValue(); } }
+
+    void KeyAndBeginList(const char* pKey, bool isInline)  { Key(pKey); BeginList(isInline); }
+    void KeyAndBeginMap(const char* pKey, bool isInline)   { Key(pKey); BeginMap(isInline); }
+    void KeyAndValue(const char* pKey, const char* pValue) { Key(pKey); Value(pValue); }
+    void KeyAndValue(const char* pKey, uint64 value)       { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, uint32 value)       { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, uint16 value)       { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, uint8 value)        { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, int64 value)        { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, int32 value)        { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, int16 value)        { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, int8 value)         { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, float value)        { Key(pKey); Value(value); }
+    void KeyAndValue(const char* pKey, bool value)         { Key(pKey); Value(value); }
+    void KeyAndNullValue(const char* pKey)                 { Key(pKey); NullValue(); }
+
     // These functions create a map that represents a particular InterfaceLogger decorated PAL object.
     void Object(const IBorderColorPalette* pDecorator);
     void Object(const ICmdAllocator* pDecorator);
@@ -469,6 +579,8 @@ public:
     void Struct(const DeviceGdsAllocInfo& value);
     void Struct(const DoppDesktopInfo& value);
     void Struct(const DoppRef& value);
+    void Struct(const DrawIndexedIndirectArgs& value);
+    void Struct(const DrawIndirectArgs& value);
     void Struct(const DynamicComputeShaderInfo& value);
     void Struct(const DynamicGraphicsShaderInfo& value);
     void Struct(const DynamicGraphicsShaderInfos& value);
@@ -897,7 +1009,9 @@ public:
 private:
     void Object(InterfaceObject objectType, uint32 objectId);
 
-    LogStream m_stream;
+    LogStream    m_stream;
+    BinaryWriter m_binaryWriter;
+    bool         m_binary;       // True once a binary log file has been opened.
 
     PAL_DISALLOW_DEFAULT_CTOR(LogContext);
     PAL_DISALLOW_COPY_AND_ASSIGN(LogContext);
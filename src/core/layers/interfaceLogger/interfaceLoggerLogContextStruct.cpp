@@ -634,8 +634,36 @@ void LogContext::Struct(
         Value("disallowNestedLaunchViaIb2");
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+    if (value.flags.enableUserDataPatching)
+    {
+        Value("enableUserDataPatching");
+    }
+#endif
+
     EndList();
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+    // The ranges are only meaningful (and only need to be initialized by the client) if patching is enabled.
+    if (value.flags.enableUserDataPatching)
+    {
+        KeyAndBeginList("patchableUserDataRanges", false);
+
+        for (uint32 idx = 0; idx < value.patchableUserDataRangeCount; ++idx)
+        {
+            const PatchableUserDataRange& range = value.pPatchableUserDataRanges[idx];
+
+            BeginMap(false);
+            KeyAndEnum("bindPoint", range.bindPoint);
+            KeyAndValue("firstEntry", range.firstEntry);
+            KeyAndValue("entryCount", range.entryCount);
+            EndMap();
+        }
+
+        EndList();
+    }
+#endif
+
     if (value.pInheritedState != nullptr)
     {
         KeyAndStruct("inheritedState", *value.pInheritedState);
@@ -912,6 +940,31 @@ void LogContext::Struct(
     EndMap();
 }
 
+// =====================================================================================================================
+void LogContext::Struct(
+    const DrawIndexedIndirectArgs& value)
+{
+    BeginMap(true);
+    KeyAndValue("indexCount", value.indexCount);
+    KeyAndValue("instanceCount", value.instanceCount);
+    KeyAndValue("firstIndex", value.firstIndex);
+    KeyAndValue("vertexOffset", value.vertexOffset);
+    KeyAndValue("firstInstance", value.firstInstance);
+    EndMap();
+}
+
+// =====================================================================================================================
+void LogContext::Struct(
+    const DrawIndirectArgs& value)
+{
+    BeginMap(true);
+    KeyAndValue("vertexCount", value.vertexCount);
+    KeyAndValue("instanceCount", value.instanceCount);
+    KeyAndValue("firstVertex", value.firstVertex);
+    KeyAndValue("firstInstance", value.firstInstance);
+    EndMap();
+}
+
 // =====================================================================================================================
 void LogContext::Struct(
     const DynamicComputeShaderInfo& value)
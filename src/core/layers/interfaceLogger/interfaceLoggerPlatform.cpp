@@ -61,6 +61,9 @@ static constexpr FuncLoggingTableEntry FuncLoggingTable[] =
     { InterfaceFunc::CmdBufferBegin,                                (CmdBuild)            },
     { InterfaceFunc::CmdBufferEnd,                                  (CmdBuild)            },
     { InterfaceFunc::CmdBufferReset,                                (CmdBuild)            },
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 491
+    { InterfaceFunc::CmdBufferPatchUserData,                        (CmdBuild)            },
+#endif
     { InterfaceFunc::CmdBufferCmdBindPipeline,                      (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdBindMsaaState,                     (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdBindColorBlendState,               (CmdBuild)            },
@@ -95,6 +98,10 @@ static constexpr FuncLoggingTableEntry FuncLoggingTable[] =
     { InterfaceFunc::CmdBufferCmdDrawIndexed,                       (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdDrawIndirectMulti,                 (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdDrawIndexedIndirectMulti,          (CmdBuild)            },
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    { InterfaceFunc::CmdBufferCmdDrawMulti,                         (CmdBuild)            },
+    { InterfaceFunc::CmdBufferCmdDrawIndexedMulti,                  (CmdBuild)            },
+#endif
     { InterfaceFunc::CmdBufferCmdDispatch,                          (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdDispatchIndirect,                  (CmdBuild)            },
     { InterfaceFunc::CmdBufferCmdDispatchOffset,                    (CmdBuild)            },
@@ -484,10 +491,12 @@ Result Platform::CommitLoggingSettings()
         if (result == Result::Success)
         {
             // We can finally open the main log's file; this will flush out any data it already buffered.
+            const bool binary = settings.interfaceLoggerConfig.binaryCapture;
+
             char logFilePath[512];
-            Snprintf(logFilePath, sizeof(logFilePath), "%s/pal_calls.json", LogDirPath());
+            Snprintf(logFilePath, sizeof(logFilePath), "%s/pal_calls.%s", LogDirPath(), binary ? "bin" : "json");
 
-            result = m_pMainLog->OpenFile(logFilePath);
+            result = m_pMainLog->OpenFile(logFilePath, binary);
         }
 
         // If multithreaded logging is enabled, we need to go back over our previously allocated ThreadData and give
@@ -919,14 +928,18 @@ LogContext* Platform::CreateThreadLogContext(
 
     if (pContext != nullptr)
     {
-        // Create a file name and path for this log.
+        const bool binary = PlatformSettings().interfaceLoggerConfig.binaryCapture;
+
+        // Create a file name and path for this log. The main log always names the JSON file; binary logs are converted
+        // into a JSON file of the same name before anything reads them.
         char logFileName[64];
         Snprintf(logFileName, sizeof(logFileName), "pal_calls_thread_%u.json", threadId);
 
         char logFilePath[512];
-        Snprintf(logFilePath, sizeof(logFilePath), "%s/%s", LogDirPath(), logFileName);
+        Snprintf(logFilePath, sizeof(logFilePath), "%s/pal_calls_thread_%u.%s", LogDirPath(), threadId,
+                 binary ? "bin" : "json");
 
-        const Result result = pContext->OpenFile(logFilePath);
+        const Result result = pContext->OpenFile(logFilePath, binary);
 
         if (result == Result::Success)
         {
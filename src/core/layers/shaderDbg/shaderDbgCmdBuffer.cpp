@@ -102,6 +102,10 @@ CmdBuffer::CmdBuffer(
     m_funcTable.pfnCmdDrawIndexed              = CmdDrawIndexed;
     m_funcTable.pfnCmdDrawIndirectMulti        = CmdDrawIndirectMulti;
     m_funcTable.pfnCmdDrawIndexedIndirectMulti = CmdDrawIndexedIndirectMulti;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+    m_funcTable.pfnCmdDrawMulti                = CmdDrawMulti;
+    m_funcTable.pfnCmdDrawIndexedMulti         = CmdDrawIndexedMulti;
+#endif
     m_funcTable.pfnCmdDispatch                 = CmdDispatch;
     m_funcTable.pfnCmdDispatchIndirect         = CmdDispatchIndirect;
     m_funcTable.pfnCmdDispatchOffset           = CmdDispatchOffset;
@@ -315,6 +319,48 @@ void PAL_STDCALL CmdBuffer::CmdDrawIndexedIndirectMulti(
     pThis->PostDrawDispatch(true);
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 490
+// =====================================================================================================================
+void PAL_STDCALL CmdBuffer::CmdDrawMulti(
+    ICmdBuffer*             pCmdBuffer,
+    uint32                  drawCount,
+    const DrawIndirectArgs* pDrawArgs,
+    uint32                  userDataEntry,
+    const uint32*           pUserDataValues)
+{
+    auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+#if PAL_ENABLE_PRINTS_ASSERTS
+    char stringBuf[256] = {};
+    Snprintf(&stringBuf[0], 256, "CmdDrawMulti - ID #%d", pThis->m_currentDraw);
+    pThis->CmdCommentString(&stringBuf[0]);
+#endif
+
+    pThis->AllocateHwShaderDbg(true, pThis->m_currentDraw++);
+    pThis->GetNextLayer()->CmdDrawMulti(drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+    pThis->PostDrawDispatch(true);
+}
+
+// =====================================================================================================================
+void PAL_STDCALL CmdBuffer::CmdDrawIndexedMulti(
+    ICmdBuffer*                    pCmdBuffer,
+    uint32                         drawCount,
+    const DrawIndexedIndirectArgs* pDrawArgs,
+    uint32                         userDataEntry,
+    const uint32*                  pUserDataValues)
+{
+    auto* pThis = static_cast<CmdBuffer*>(pCmdBuffer);
+#if PAL_ENABLE_PRINTS_ASSERTS
+    char stringBuf[256] = {};
+    Snprintf(&stringBuf[0], 256, "CmdDrawIndexedMulti - ID #%d", pThis->m_currentDraw);
+    pThis->CmdCommentString(&stringBuf[0]);
+#endif
+
+    pThis->AllocateHwShaderDbg(true, pThis->m_currentDraw++);
+    pThis->GetNextLayer()->CmdDrawIndexedMulti(drawCount, pDrawArgs, userDataEntry, pUserDataValues);
+    pThis->PostDrawDispatch(true);
+}
+#endif
+
 // =====================================================================================================================
 void PAL_STDCALL CmdBuffer::CmdDispatch(
     ICmdBuffer* pCmdBuffer,
@@ -68,6 +68,16 @@ public:
         void*                             pPlacementAddr,
         IPipeline**                       ppPipeline) override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 487
+    virtual Result CreateGraphicsPipelines(
+        uint32                            count,
+        const GraphicsPipelineCreateInfo* pCreateInfos,
+        void*const*                       ppPlacementAddrs,
+        IPipeline**                       ppPipelines,
+        Result*                           pResults,
+        PipelineBatchStats*               pStats) override;
+#endif
+
     virtual size_t GetQueueSize(
         const QueueCreateInfo& createInfo,
         Result*                pResult) const override;
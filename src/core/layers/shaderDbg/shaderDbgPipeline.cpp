@@ -122,7 +122,7 @@ Result Pipeline::Init(
 {
     PAL_ASSERT((pPipelineBinary != nullptr) && (pipelineBinarySize > 0));
     PipelineAbiProcessor<Platform> abiProcessor(m_pPlatform);
-    Result result = abiProcessor.LoadFromBuffer(pPipelineBinary, pipelineBinarySize);
+    Result result = abiProcessor.LoadFromBufferView(pPipelineBinary, pipelineBinarySize);
 
     MsgPackReader              metadataReader;
     Abi::PalCodeObjectMetadata metadata;
@@ -3764,8 +3764,12 @@ Result Device::AddQueue(
     {
         MutexAuto lock(&m_globalRefLock);
 
-        // Then update the new queue with the list of memory already added to this device.
-        numEntries = m_globalRefMap.GetNumEntries();
+        // Then update the new queue with the list of memory already added to this device.  Queues count their
+        // references, so each allocation is added as many times as it has been referenced.
+        for (auto iter = m_globalRefMap.Begin(); iter.Get() != nullptr; iter.Next())
+        {
+            numEntries += iter.Get()->value;
+        }
 
         if (numEntries > 0)
         {
@@ -3777,11 +3781,14 @@ Result Device::AddQueue(
             }
             else
             {
-                auto iter = m_globalRefMap.Begin();
-                for (uint32 i = 0; i < numEntries; i++, iter.Next())
+                uint32 i = 0;
+                for (auto iter = m_globalRefMap.Begin(); iter.Get() != nullptr; iter.Next())
                 {
-                    pMemRefList[i].flags.u32All = 0;
-                    pMemRefList[i].pGpuMemory   = iter.Get()->key;
+                    for (uint32 ref = 0; ref < iter.Get()->value; ++ref, ++i)
+                    {
+                        pMemRefList[i].flags.u32All = 0;
+                        pMemRefList[i].pGpuMemory   = iter.Get()->key;
+                    }
                 }
             }
         }
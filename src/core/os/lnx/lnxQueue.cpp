@@ -41,6 +41,7 @@
 #include "core/queueSemaphore.h"
 #include "palAutoBuffer.h"
 #include "palDequeImpl.h"
+#include "palFlatHashMapImpl.h"
 #include "palListImpl.h"
 #include "palHashMapImpl.h"
 #include "palVectorImpl.h"
@@ -200,7 +201,8 @@ Queue::Queue(
     m_appMemRefCount(0),
     m_pendingWait(false),
     m_pCmdUploadRing(nullptr),
-    m_memList(pDevice->GetPlatform()),
+    m_residencySet(ResidencySetInitialSlots, pDevice->GetPlatform()),
+    m_residentMem(pDevice->GetPlatform()),
     m_numIbs(0),
     m_lastSignaledSyncObject(0),
     m_waitSemList(pDevice->GetPlatform())
@@ -235,13 +237,6 @@ Queue::~Queue()
     {
         static_cast<Device*>(m_pDevice)->DestroySyncObject(m_lastSignaledSyncObject);
     }
-
-    auto memListIterator = m_memList.Begin();
-
-    while ((memListIterator.Get() != nullptr))
-    {
-        m_memList.Erase(&memListIterator);
-    }
 }
 
 // =====================================================================================================================
@@ -265,6 +260,11 @@ Result Queue::Init(
         result = m_memListLock.Init();
     }
 
+    if (result == Result::Success)
+    {
+        result = m_residencySet.Init();
+    }
+
     // Note that the presence of the command upload ring will be used later to determine if these conditions are true.
     if ((result == Result::Success)                               &&
         (m_device.ChipProperties().ossLevel != OssIpLevel::_None) &&
@@ -326,7 +326,8 @@ Result Queue::Init(
 }
 
 // =====================================================================================================================
-// Adds GPU memory references to the per-queue global list which gets added to the patch/alloc list at submit time.
+// Adds GPU memory references to the per-queue residency set which gets added to the patch/alloc list at submit time.
+// Each reference is counted, so memory stays resident until it has been removed as many times as it has been added.
 Result Queue::AddGpuMemoryReferences(
     uint32              gpuMemRefCount,
     const GpuMemoryRef* pGpuMemoryRefs)
@@ -334,28 +335,44 @@ Result Queue::AddGpuMemoryReferences(
     Result result = Result::Success;
     RWLockAuto<RWLock::ReadWrite> lock(&m_memListLock);
 
-    for (uint32 idx = 0; idx < gpuMemRefCount; ++idx)
+    for (uint32 idx = 0; (idx < gpuMemRefCount) && (result == Result::Success); ++idx)
     {
-        bool found = false;
-        auto listIterator = m_memList.Begin();
+        IGpuMemory*const pMem    = pGpuMemoryRefs[idx].pGpuMemory;
+        ResidencyEntry*  pEntry  = nullptr;
+        bool             existed = false;
+
+        result = m_residencySet.FindAllocate(pMem, &existed, &pEntry);
 
-        while (listIterator.Get() != nullptr)
+        if ((result == Result::Success) && existed)
         {
-            IGpuMemory* pMem = (*listIterator.Get());
+            pEntry->refCount++;
+        }
+        else if (result == Result::Success)
+        {
+            const GpuMemory*const pGpuMemory = static_cast<GpuMemory*>(pMem);
 
-            if (pGpuMemoryRefs[idx].pGpuMemory == pMem)
+            pEntry->refCount  = 1;
+            pEntry->listIndex = InvalidListIndex;
+
+            // If VM is always valid, the memory never needs to be in the resource list.
+            if (pGpuMemory->IsVmAlwaysValid() == false)
             {
-                found = true;
-                break;
-            }
+                const uint32 listIndex = m_residentMem.NumElements();
 
-            listIterator.Next();
-        }
+                result = (listIndex < m_resourceListSize) ? m_residentMem.PushBack(pMem)
+                                                          : Result::ErrorTooManyMemoryReferences;
 
-        if (found == false)
-        {
-            m_memList.PushFront(pGpuMemoryRefs[idx].pGpuMemory);
-            m_memListDirty = true;
+                if (result == Result::Success)
+                {
+                    pEntry->listIndex = listIndex;
+                    WriteResourceListEntry(listIndex, pGpuMemory);
+                    m_memListDirty = true;
+                }
+                else
+                {
+                    m_residencySet.Erase(pMem);
+                }
+            }
         }
     }
 
@@ -363,7 +380,7 @@ Result Queue::AddGpuMemoryReferences(
 }
 
 // =====================================================================================================================
-// Decrements the GPU memory reference count and if necessary removes it from the per-queue global list.
+// Decrements the GPU memory reference count and if necessary removes it from the per-queue residency set.
 Result Queue::RemoveGpuMemoryReferences(
     uint32            gpuMemoryCount,
     IGpuMemory*const* ppGpuMemory)
@@ -373,21 +390,41 @@ Result Queue::RemoveGpuMemoryReferences(
 
     for (uint32 idx = 0; idx < gpuMemoryCount; ++idx)
     {
-        auto listIterator = m_memList.Begin();
+        ResidencyEntry*const pEntry = m_residencySet.FindKey(ppGpuMemory[idx]);
 
-        while (listIterator.Get() != nullptr)
+        if (pEntry != nullptr)
         {
-            IGpuMemory* pMem = (*listIterator.Get());
+            PAL_ASSERT(pEntry->refCount > 0);
 
-            if (ppGpuMemory[idx] == pMem)
+            if (--pEntry->refCount == 0)
             {
-                // Erase will advance the iterator.
-                m_memList.Erase(&listIterator);
-                m_memListDirty = true;
-            }
-            else
-            {
-                listIterator.Next();
+                const uint32 listIndex = pEntry->listIndex;
+
+                m_residencySet.Erase(ppGpuMemory[idx]);
+
+                if (listIndex != InvalidListIndex)
+                {
+                    // Keep the resident bos packed by moving the last one into the hole left by this one.
+                    IGpuMemory* pLastMem = nullptr;
+                    m_residentMem.PopBack(&pLastMem);
+
+                    const uint32 lastIndex = m_residentMem.NumElements();
+
+                    if (listIndex < lastIndex)
+                    {
+                        m_residentMem.At(listIndex) = pLastMem;
+                        m_residencySet.FindKey(pLastMem)->listIndex = listIndex;
+
+                        m_pResourceList[listIndex] = m_pResourceList[lastIndex];
+
+                        if (m_pResourcePriorityList != nullptr)
+                        {
+                            m_pResourcePriorityList[listIndex] = m_pResourcePriorityList[lastIndex];
+                        }
+                    }
+
+                    m_memListDirty = true;
+                }
             }
         }
     }
@@ -1081,41 +1118,13 @@ Result Queue::UpdateResourceList(
                 m_hResourceList = nullptr;
             }
 
-            bool memListDirty = m_memListDirty;
+            const bool memListDirty = m_memListDirty;
 
-            // First add all of the global memory references.
-            if (result == Result::Success)
-            {
-                // If the global memory references haven't been modified since the last submit,
-                // the resources in our UMD-side list (m_pResourceList) should be up to date.
-                // So, there is no need to re-walk through m_memList.
-                if (m_memListDirty == false)
-                {
-                    m_numResourcesInList += m_memListResourcesInList;
-                }
-                else
-                {
-                    m_memListDirty = false;
-
-                    auto listIterator = m_memList.Begin();
-
-                    while (listIterator.Get() != nullptr)
-                    {
-                        const GpuMemory* pGpuMemory = static_cast<GpuMemory*>(*listIterator.Get());
-
-                        result = AppendResourceToList(pGpuMemory);
-                        if (result != Result::_Success)
-                        {
-                            m_memListDirty = true;
-                            break;
-                        }
-
-                        listIterator.Next();
-                    }
-
-                    m_memListResourcesInList = m_numResourcesInList;
-                }
-            }
+            // The residency set keeps its bos packed at the start of the list as it changes, so they are always up to
+            // date and never need to be walked here.  A change in their number only moves the sections after them.
+            m_memListDirty           = false;
+            m_memListResourcesInList = m_residentMem.NumElements();
+            m_numResourcesInList     = m_memListResourcesInList;
 
             // Then, add all of the internal memory manager's memory references to the resource list. This should
             // include things like shader rings as well as UDMA buffer chunks.
@@ -1152,6 +1161,9 @@ Result Queue::UpdateResourceList(
                 }
             }
 
+            // amdgpu has no way to apply a delta to a kernel bo list: even amdgpu_bo_list_update() replaces the whole
+            // list. So the kernel list is always created from the complete array, and its cost scales with the
+            // number of resident allocations whenever anything has changed.
             if ((result == Result::Success) && (m_numResourcesInList > 0))
             {
                 result = static_cast<Device*>(m_pDevice)->CreateResourceList(m_numResourcesInList,
@@ -1178,22 +1190,7 @@ Result Queue::AppendResourceToList(
         // If VM is always valid, not necessary to add into the resource list.
         if (pGpuMemory->IsVmAlwaysValid() == false)
         {
-            m_pResourceList[m_numResourcesInList] = pGpuMemory->SurfaceHandle();
-
-            if (m_pResourcePriorityList != nullptr)
-            {
-                // Max priority that Os accepts is 32, see AMDGPU_BO_LIST_MAX_PRIORITY.
-                // We reserve 3 bits for priority while 2 bits for offset
-                const uint8 offsetBits = static_cast<uint8>(pGpuMemory->PriorityOffset()) / 2;
-
-                static_assert(
-                    (static_cast<uint32_t>(Pal::GpuMemPriority::Count) == 6) &&
-                     static_cast<uint32_t>(Pal::GpuMemPriorityOffset::Count) == 8,
-                    "Pal GpuMemPriority or GpuMemPriorityOffset values changed. Consider to update strategy to convert"
-                    "Pal GpuMemPriority and GpuMemPriorityOffset to lnx resource priority");
-                m_pResourcePriorityList[m_numResourcesInList] =
-                    (LnxResourcePriorityTable[static_cast<size_t>(pGpuMemory->Priority())] << 2) | offsetBits;
-            }
+            WriteResourceListEntry(m_numResourcesInList, pGpuMemory);
 
             ++m_numResourcesInList;
         }
@@ -1204,6 +1201,32 @@ Result Queue::AppendResourceToList(
     return result;
 }
 
+// =====================================================================================================================
+// Stores a bo, and its priority if priorities are enabled, at the given index of the resource list.
+void Queue::WriteResourceListEntry(
+    size_t           index,
+    const GpuMemory* pGpuMemory)
+{
+    PAL_ASSERT(index < m_resourceListSize);
+
+    m_pResourceList[index] = pGpuMemory->SurfaceHandle();
+
+    if (m_pResourcePriorityList != nullptr)
+    {
+        // Max priority that Os accepts is 32, see AMDGPU_BO_LIST_MAX_PRIORITY.
+        // We reserve 3 bits for priority while 2 bits for offset
+        const uint8 offsetBits = static_cast<uint8>(pGpuMemory->PriorityOffset()) / 2;
+
+        static_assert(
+            (static_cast<uint32_t>(Pal::GpuMemPriority::Count) == 6) &&
+             static_cast<uint32_t>(Pal::GpuMemPriorityOffset::Count) == 8,
+            "Pal GpuMemPriority or GpuMemPriorityOffset values changed. Consider to update strategy to convert"
+            "Pal GpuMemPriority and GpuMemPriorityOffset to lnx resource priority");
+        m_pResourcePriorityList[index] =
+            (LnxResourcePriorityTable[static_cast<size_t>(pGpuMemory->Priority())] << 2) | offsetBits;
+    }
+}
+
 // =====================================================================================================================
 // Calls AddIb on the first chunk from the given command stream.
 Result Queue::AddCmdStream(
@@ -26,8 +26,9 @@
 #pragma once
 #include "core/queue.h"
 #include "core/os/lnx/lnxHeaders.h"
-#include "palList.h"
+#include "palFlatHashMap.h"
 #include "palVector.h"
+#include <climits>
 
 // It is a temporary solution while we are waiting for open source promotion.
 // The VCN IPs are going to be added in the open source header Dk/drm/amdgpu_drm.h.
@@ -172,6 +173,10 @@ private:
     Result AppendResourceToList(
         const GpuMemory* pGpuMemory);
 
+    void WriteResourceListEntry(
+        size_t           index,
+        const GpuMemory* pGpuMemory);
+
     Result AddCmdStream(
         const CmdStream& cmdStream,
         bool             isDummySubmission);
@@ -223,14 +228,29 @@ private:
     amdgpu_bo_list_handle m_hResourceList;
     amdgpu_bo_list_handle m_hDummyResourceList;   // The dummy resource list used by dummy submission.
     Pal::CmdStream*       m_pDummyCmdStream;      // The dummy command stream used by dummy submission.
-    bool                  m_memListDirty;         // Indicates m_memList has changed since the last submit.
-    Util::RWLock          m_memListLock;          // Protect m_memListLock from muli-thread access.
+    bool                  m_memListDirty;         // Indicates the residency set has changed since the last submit.
+    Util::RWLock          m_memListLock;          // Protects the residency set from multi-thread access.
     uint32                m_internalMgrTimestamp; // Store timestamp of internal memory mgr.
     uint32                m_appMemRefCount;       // Store count of application's submission memory references.
     bool                  m_pendingWait;          // Queue needs a dummy submission between wait and signal.
     CmdUploadRing*        m_pCmdUploadRing;       // Uploads gfxip command streams to a large local memory buffer.
 
-    Util::List<IGpuMemory*, Platform> m_memList;  // List of memory which is referenced by Queue.
+    // Tracks one GPU memory allocation in the queue's residency set.
+    struct ResidencyEntry
+    {
+        uint32 refCount;  // Number of AddGpuMemoryReferences() calls not yet matched by a removal.
+        uint32 listIndex; // Index of the allocation's bo in m_pResourceList, or InvalidListIndex if it has none.
+    };
+
+    static constexpr uint32 InvalidListIndex         = UINT_MAX;
+    static constexpr uint32 ResidencySetInitialSlots = 1024;
+
+    // The residency set is the memory which is referenced by every submit on this queue.  The bos of its members are
+    // kept packed at the start of m_pResourceList and are updated in place as members come and go, so a submit only
+    // has to append the internal and per-submit references after them.  m_residentMem holds the allocation of each of
+    // those bos so that a removal can move the last one into the hole it leaves.
+    Util::FlatHashMap<IGpuMemory*, ResidencyEntry, Platform> m_residencySet;
+    Util::Vector<IGpuMemory*, 16, Platform>                  m_residentMem;
 
     // These IBs will be sent to the kernel when SubmitIbs is called.
     uint32                m_numIbs;
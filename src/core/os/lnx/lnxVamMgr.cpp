@@ -42,6 +42,7 @@ VamMgr::VamMgr()
     :
     Pal::VamMgr()
 {
+    memset(&m_pVaAllocator[0], 0, sizeof(m_pVaAllocator));
 }
 
 // =====================================================================================================================
@@ -59,7 +60,7 @@ Result VamMgr::LateInit(
     Pal::Device*const pDevice)
 {
     const auto& memProps = pDevice->MemoryProperties();
-    Result      result   = Result::Success;
+    Result      result   = m_vamLock.Init();
 
     m_ptbSize = CalcPtbSize(pDevice);
 
@@ -90,16 +91,78 @@ Result VamMgr::LateInit(
     vamCreateIn.hSyncObj     = nullptr;
 
     // Create the VAM library instance.
-    m_hVamInstance = VAMCreate(this, &vamCreateIn);
-    if (m_hVamInstance == nullptr)
+    if (result == Result::Success)
     {
-        PAL_ALERT_ALWAYS();
-        result = Result::ErrorInitializationFailed;
+        m_hVamInstance = VAMCreate(this, &vamCreateIn);
+        if (m_hVamInstance == nullptr)
+        {
+            PAL_ALERT_ALWAYS();
+            result = Result::ErrorInitializationFailed;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Sets up the VAM sections and, if enabled, a scalable VA allocator for each VAM partition.  The VAM sections remain
+// in place so that any partition whose allocator can't be created falls back to the VAM library.
+Result VamMgr::Finalize(
+    Pal::Device*const pDevice)
+{
+    Result result = Pal::VamMgr::Finalize(pDevice);
+
+    if ((result == Result::Success) && pDevice->Settings().enableScalableVaAllocator)
+    {
+        const auto& memProps = pDevice->MemoryProperties();
+
+        for (uint32 i = 0; (result == Result::Success) && (i < static_cast<uint32>(VaPartition::Count)); ++i)
+        {
+            if (IsVamPartition(static_cast<VaPartition>(i)) && (memProps.vaRange[i].size > 0))
+            {
+                VaAllocator*const pVaAllocator = PAL_NEW(VaAllocator, pDevice->GetPlatform(), AllocInternal)
+                                                        (pDevice->GetPlatform());
+                if (pVaAllocator == nullptr)
+                {
+                    result = Result::ErrorOutOfMemory;
+                }
+                else
+                {
+                    m_pVaAllocator[i] = pVaAllocator;
+                    result = pVaAllocator->Init(memProps.vaRange[i].baseVirtAddr,
+                                                memProps.vaRange[i].size,
+                                                memProps.virtualMemAllocGranularity);
+                }
+
+                for (uint32 j = 0; (result == Result::Success) && (j < memProps.numExcludedVaRanges); ++j)
+                {
+                    result = pVaAllocator->Exclude(memProps.excludedRange[j].baseVirtAddr,
+                                                   memProps.excludedRange[j].size);
+                }
+            }
+        }
     }
 
     return result;
 }
 
+// =====================================================================================================================
+// Destroys the scalable VA allocators along with the VAM instance.
+Result VamMgr::Cleanup(
+    Pal::Device*const pDevice)
+{
+    for (uint32 i = 0; i < static_cast<uint32>(VaPartition::Count); ++i)
+    {
+        if (m_pVaAllocator[i] != nullptr)
+        {
+            PAL_DELETE(m_pVaAllocator[i], pDevice->GetPlatform());
+            m_pVaAllocator[i] = nullptr;
+        }
+    }
+
+    return Pal::VamMgr::Cleanup(pDevice);
+}
+
 // =====================================================================================================================
 // Assigns a GPU virtual address for the specified allocation.
 Result VamMgr::AssignVirtualAddress(
@@ -109,38 +172,49 @@ Result VamMgr::AssignVirtualAddress(
 {
     Result result = Result::ErrorInvalidFlags;
 
-    VAM_ALLOC_INPUT  vamAllocIn  = { };
-    VAM_ALLOC_OUTPUT vamAllocOut = { };
-
-    vamAllocIn.virtualAddress = *pGpuVirtAddr;
-    vamAllocIn.sizeInBytes    = vaInfo.size;
-    vamAllocIn.alignment      = Max(LowPart(vaInfo.alignment), MinVamAllocAlignment);
-
-    // VAM takes a 32-bit alignment so the high part needs to be zero.
-    PAL_ASSERT(HighPart(vaInfo.alignment) == 0);
+    VaAllocator*const pVaAllocator = m_pVaAllocator[static_cast<uint32>(vaInfo.partition)];
 
-    vamAllocIn.hSection = m_hSection[static_cast<uint32>(vaInfo.partition)];
-    PAL_ASSERT(vamAllocIn.hSection != nullptr);
-
-    if (VAMAlloc(m_hVamInstance, &vamAllocIn, &vamAllocOut) == VAM_OK)
+    if (pVaAllocator != nullptr)
     {
-        result = Result::Success;
+        result = pVaAllocator->Allocate(vaInfo.size, vaInfo.alignment, pGpuVirtAddr);
     }
     else
     {
-        result = Result::ErrorOutOfGpuMemory;
-    }
+        VAM_ALLOC_INPUT  vamAllocIn  = { };
+        VAM_ALLOC_OUTPUT vamAllocOut = { };
 
-    if (result == Result::Success)
-    {
-        // Applications are expected to size-align their allocations to the largest size-alignment amongst the
-        // heaps they want the allocation to go into.
-        PAL_ASSERT(vamAllocOut.actualSize == vamAllocIn.sizeInBytes);
+        vamAllocIn.virtualAddress = *pGpuVirtAddr;
+        vamAllocIn.sizeInBytes    = vaInfo.size;
+        vamAllocIn.alignment      = Max(LowPart(vaInfo.alignment), MinVamAllocAlignment);
+
+        // VAM takes a 32-bit alignment so the high part needs to be zero.
+        PAL_ASSERT(HighPart(vaInfo.alignment) == 0);
 
-        // If the caller had a particular VA in mind we should make sure VAM gave it to us.
-        PAL_ASSERT((*pGpuVirtAddr == 0) || (*pGpuVirtAddr == vamAllocOut.virtualAddress));
+        vamAllocIn.hSection = m_hSection[static_cast<uint32>(vaInfo.partition)];
+        PAL_ASSERT(vamAllocIn.hSection != nullptr);
 
-        (*pGpuVirtAddr) = vamAllocOut.virtualAddress;
+        MutexAuto lock(&m_vamLock);
+
+        if (VAMAlloc(m_hVamInstance, &vamAllocIn, &vamAllocOut) == VAM_OK)
+        {
+            result = Result::Success;
+        }
+        else
+        {
+            result = Result::ErrorOutOfGpuMemory;
+        }
+
+        if (result == Result::Success)
+        {
+            // Applications are expected to size-align their allocations to the largest size-alignment amongst the
+            // heaps they want the allocation to go into.
+            PAL_ASSERT(vamAllocOut.actualSize == vamAllocIn.sizeInBytes);
+
+            // If the caller had a particular VA in mind we should make sure VAM gave it to us.
+            PAL_ASSERT((*pGpuVirtAddr == 0) || (*pGpuVirtAddr == vamAllocOut.virtualAddress));
+
+            (*pGpuVirtAddr) = vamAllocOut.virtualAddress;
+        }
     }
 
     return result;
@@ -155,30 +229,47 @@ Result VamMgr::FreeVirtualAddress(
     Pal::Device*const     pDevice,
     const Pal::GpuMemory* pGpuMemory)
 {
-    VAM_FREE_INPUT vamFreeIn = { };
-
     Result result = Result::ErrorInvalidPointer;
 
     if (pGpuMemory != nullptr)
     {
-        vamFreeIn.virtualAddress = pGpuMemory->Desc().gpuVirtAddr;
-        vamFreeIn.actualSize     = pGpuMemory->Desc().size;
+        const gpusize virtAddr  = pGpuMemory->Desc().gpuVirtAddr;
+        const gpusize size      = pGpuMemory->Desc().size;
+        uint32        partition = static_cast<uint32>(VaPartition::Count);
 
         for (uint32 i = 0; i < static_cast<uint32>(VaPartition::Count); ++i)
         {
             const auto& vaRange = pDevice->MemoryProperties().vaRange[i];
 
-            if ((vaRange.baseVirtAddr <= vamFreeIn.virtualAddress) &&
-                ((vaRange.baseVirtAddr + vaRange.size) >= (vamFreeIn.virtualAddress + vamFreeIn.actualSize)))
+            if ((vaRange.baseVirtAddr <= virtAddr) && ((vaRange.baseVirtAddr + vaRange.size) >= (virtAddr + size)))
             {
-                vamFreeIn.hSection = m_hSection[i];
+                partition = i;
                 break;
             }
         }
 
-        if (VAMFree(m_hVamInstance, &vamFreeIn) != VAM_OK)
+        if ((partition < static_cast<uint32>(VaPartition::Count)) && (m_pVaAllocator[partition] != nullptr))
+        {
+            m_pVaAllocator[partition]->Free(virtAddr, size);
+        }
+        else
         {
-            PAL_ASSERT_ALWAYS();
+            VAM_FREE_INPUT vamFreeIn = { };
+
+            vamFreeIn.virtualAddress = virtAddr;
+            vamFreeIn.actualSize     = size;
+
+            if (partition < static_cast<uint32>(VaPartition::Count))
+            {
+                vamFreeIn.hSection = m_hSection[partition];
+            }
+
+            MutexAuto lock(&m_vamLock);
+
+            if (VAMFree(m_hVamInstance, &vamFreeIn) != VAM_OK)
+            {
+                PAL_ASSERT_ALWAYS();
+            }
         }
 
         result = Result::Success;
@@ -368,7 +459,7 @@ VamMgrSingleton::VamMgrSingleton()
     m_reservedVaMap(InitialGpuNumber, &m_mapAllocator),
     m_vaMapLock(),
     m_vamMgrMap(InitialGpuNumber, &m_mapAllocator),
-    m_mutex()
+    m_vamMgrMapLock()
 {
 }
 
@@ -383,7 +474,7 @@ void VamMgrSingleton::Cleanup(
     Device* pDevice)
 {
     PAL_ASSERT(pVamMgrSingleton != nullptr);
-    MutexAuto lock(&pVamMgrSingleton->m_mutex);
+    RWLockAuto<RWLock::ReadWrite> lock(&pVamMgrSingleton->m_vamMgrMapLock);
     VamMgrInfo* pVamMgrInfo = pVamMgrSingleton->m_vamMgrMap.FindKey(pDevice->DeviceHandle());
 
     if (pVamMgrInfo != nullptr)
@@ -404,7 +495,7 @@ Result VamMgrSingleton::InitVaRangesAndFinalizeVam(
 {
     Result result = Result::Success;
     PAL_ASSERT(pVamMgrSingleton != nullptr);
-    MutexAuto lock(&pVamMgrSingleton->m_mutex);
+    RWLockAuto<RWLock::ReadWrite> lock(&pVamMgrSingleton->m_vamMgrMapLock);
 
     // Initialize reserved VA ranges on the GPU device.
     // Note: Each device requires a reservation, otherwise mem allocation will have an address conflict on VA reserve
@@ -464,7 +555,7 @@ Result VamMgrSingleton::Init()
         }
         if (result == Result::Success)
         {
-            result = pVamMgrSingleton->m_mutex.Init();
+            result = pVamMgrSingleton->m_vamMgrMapLock.Init();
         }
         if (result == Result::Success)
         {
@@ -496,14 +587,15 @@ Result VamMgrSingleton::Init()
 }
 
 // =====================================================================================================================
-// Thread safe VA allocate function.
+// Thread safe VA allocate function.  Each VamMgr synchronizes its own allocations, so the map lock is only taken in
+// shared mode to keep the VamMgr alive.
 Result VamMgrSingleton::AssignVirtualAddress(
     Device*const                   pDevice,
     const Pal::VirtAddrAssignInfo& vaInfo,
     gpusize*                       pGpuVirtAddr)
 {
     PAL_ASSERT(pVamMgrSingleton != nullptr);
-    MutexAuto lock(&pVamMgrSingleton->m_mutex);
+    RWLockAuto<RWLock::ReadOnly> lock(&pVamMgrSingleton->m_vamMgrMapLock);
     Result result = Result::ErrorInvalidValue;
     VamMgrInfo* pVamMgrInfo = pVamMgrSingleton->m_vamMgrMap.FindKey(pDevice->DeviceHandle());
 
@@ -522,7 +614,7 @@ void VamMgrSingleton::FreeVirtualAddress(
     const Pal::GpuMemory&        gpuMemory)
 {
     PAL_ASSERT(pVamMgrSingleton != nullptr);
-    MutexAuto lock(&pVamMgrSingleton->m_mutex);
+    RWLockAuto<RWLock::ReadOnly> lock(&pVamMgrSingleton->m_vamMgrMapLock);
 
     VamMgrInfo* pVamMgrInfo = pVamMgrSingleton->m_vamMgrMap.FindKey(pDevice->DeviceHandle());
 
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "core/vamMgr.h"
+#include "core/vaAllocator.h"
 #include "core/os/lnx/lnxPlatform.h"
 #include "palMutex.h"
 #include "palSysMemory.h"
@@ -58,6 +59,12 @@ public:
     virtual Result LateInit(
         Pal::Device*const pDevice) override;
 
+    virtual Result Finalize(
+        Pal::Device*const pDevice) override;
+
+    virtual Result Cleanup(
+        Pal::Device*const pDevice) override;
+
     virtual Result AssignVirtualAddress(
         Pal::Device*const         pDevice,
         const VirtAddrAssignInfo& vaInfo,
@@ -90,6 +97,11 @@ protected:
     static VAM_RETURNCODE    VAM_STDCALL ReclaimVidMemCb(VAM_CLIENT_HANDLE hPal, VAM_VIDMEM_HANDLE hVidMem);
     static VAM_RETURNCODE    VAM_STDCALL NeedPtbCb();
 
+    // Scalable allocator for each VAM partition, or null if the partition is managed by the VAM library.
+    VaAllocator* m_pVaAllocator[static_cast<uint32>(VaPartition::Count)];
+    // The VAM library itself is not thread-safe; this serializes the partitions which still go through it.
+    Util::Mutex  m_vamLock;
+
     PAL_DISALLOW_COPY_AND_ASSIGN(VamMgr);
 };
 
@@ -159,7 +171,7 @@ private:
     ReservedVaMap        m_reservedVaMap;
     Util::Mutex          m_vaMapLock;
     VamMgrMap            m_vamMgrMap;
-    Util::Mutex          m_mutex;
+    Util::RWLock         m_vamMgrMapLock; // VA assignment only reads m_vamMgrMap, so it takes this in shared mode.
 
     PAL_DISALLOW_COPY_AND_ASSIGN(VamMgrSingleton);
 };
@@ -29,6 +29,7 @@
 #include "core/os/nullDevice/ndPlatform.h"
 #include "palAssert.h"
 #include "palDbgPrint.h"
+#include "palMutex.h"
 #include "palSysMemory.h"
 
 #if PAL_BUILD_LAYERS
@@ -99,7 +100,11 @@ Platform::Platform(
     m_pClientPrivateData(nullptr),
     m_svmRangeStart(0),
     m_maxSvmSize(createInfo.maxSvmSize),
-    m_logCb()
+    m_logCb(),
+    m_threadSlotKey(),
+    m_threadSlotKeyValid(false),
+    m_nextThreadSlot(0),
+    m_workerPool(this)
 {
     memset(&m_pDevice[0], 0, sizeof(m_pDevice));
     memset(&m_properties, 0, sizeof(m_properties));
@@ -136,6 +141,11 @@ Platform::~Platform()
     Util::DbgPrintCallback dbgPrintCallback = {};
     Util::SetDbgPrintCallback(dbgPrintCallback);
 #endif
+
+    if (m_threadSlotKeyValid)
+    {
+        DeleteThreadLocalKey(m_threadSlotKey);
+    }
 }
 
 // =====================================================================================================================
@@ -337,6 +347,18 @@ Result Platform::Init()
 {
     Result result = IPlatform::Init();
 
+    // Thread slots are only a load-balancing hint, so failing to create their key isn't fatal; every thread will just
+    // share slot zero.
+    if (result == Result::Success)
+    {
+        m_threadSlotKeyValid = (CreateThreadLocalKey(&m_threadSlotKey) == Result::Success);
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_workerPool.Init();
+    }
+
     // Perform early initialization of the developer driver after the platform is available.
     if (result == Result::Success)
     {
@@ -365,6 +387,15 @@ Result Platform::Init()
     if (result == Result::Success)
     {
         LateInitDevDriver();
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 492
+        // The platform settings are only available once the developer driver has been fully initialized.  Any memory
+        // allocated before this point comes from the client and is still freed correctly by the slab allocator.
+        if (PlatformSettings().slabAllocatorEnabled)
+        {
+            m_slabAllocator.Enable();
+        }
+#endif
     }
 
     if (result == Result::Success)
@@ -548,6 +579,31 @@ void Platform::DestroyDevDriver()
     }
 }
 
+// =====================================================================================================================
+// Returns the calling thread's slot, assigning it the next one on first use.
+uint32 Platform::GetThreadSlot()
+{
+    uint32 slot = 0;
+
+    if (m_threadSlotKeyValid)
+    {
+        slot = static_cast<uint32>(reinterpret_cast<uintptr_t>(GetThreadLocalValue(m_threadSlotKey)));
+
+        if (slot == 0)
+        {
+            // Skip zero on wrap-around because it means the slot hasn't been assigned yet.
+            do
+            {
+                slot = AtomicIncrement(&m_nextThreadSlot);
+            } while (slot == 0);
+
+            SetThreadLocalValue(m_threadSlotKey, reinterpret_cast<void*>(static_cast<uintptr_t>(slot)));
+        }
+    }
+
+    return slot;
+}
+
 // =====================================================================================================================
 // Initializes the platform's properties structure. Assume that the constructor zeroed the properties and fill out all
 // os-independent properties.
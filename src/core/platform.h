@@ -27,7 +27,9 @@
 
 #include "palLib.h"
 #include "palPlatform.h"
+#include "palThread.h"
 #include "platformSettingsLoader.h"
+#include "core/workerPool.h"
 #include "core/g_palSettings.h"
 #include "core/g_palPlatformSettings.h"
 #include "ver.h"
@@ -150,6 +152,13 @@ public:
     void SetSvmRangeStart(gpusize svmRangeStart) { m_svmRangeStart = svmRangeStart; }
     gpusize GetMaxSizeOfSvm() const { return m_maxSvmSize; }
 
+    // Returns a small nonzero integer which is unique to the calling thread (modulo wrap-around). Slots are handed out
+    // in the order threads first ask for them, so they can be used to spread threads evenly over per-thread state.
+    uint32 GetThreadSlot();
+
+    // Returns the pool of worker threads which helps with data-parallel work such as batched pipeline creation.
+    WorkerPool* GetWorkerPool() { return &m_workerPool; }
+
     virtual void LogMessage(LogLevel        level,
                             LogCategoryMask categoryMask,
                             const char*     pFormat,
@@ -250,6 +259,12 @@ private:
     gpusize                m_maxSvmSize;
     Util::LogCallbackInfo  m_logCb;
 
+    Util::ThreadLocalKey   m_threadSlotKey;      // Holds each thread's slot for GetThreadSlot().
+    bool                   m_threadSlotKeyValid;
+    volatile uint32        m_nextThreadSlot;     // Last slot handed out by GetThreadSlot().
+
+    WorkerPool             m_workerPool;
+
     PAL_DISALLOW_COPY_AND_ASSIGN(Platform);
 };
 
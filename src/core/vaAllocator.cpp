@@ -0,0 +1,748 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/vaAllocator.h"
+#include "palHashSetImpl.h"
+#include "palInlineFuncs.h"
+#include "palSysMemory.h"
+
+using namespace Util;
+
+namespace Pal
+{
+
+// Number of free ranges the index has room for before it first needs to grow.
+constexpr uint32 InitialRangeCapacity = 64;
+
+// Number of buckets in the set of fixed-address requests.  They are rare, so it is kept small.
+constexpr uint32 FixedAddrBuckets = 16;
+
+// =====================================================================================================================
+VaAllocator::VaAllocator(
+    Platform* pPlatform)
+    :
+    m_pPlatform(pPlatform),
+    m_baseVirtAddr(0),
+    m_size(0),
+    m_granularity(0),
+    m_threadCachingEnabled(false),
+    m_pRanges(nullptr),
+    m_numRanges(0),
+    m_rangeCapacity(0),
+    m_fixedAddrs(FixedAddrBuckets, pPlatform),
+    m_numFixedAddrs(0),
+    m_pCacheList(nullptr)
+{
+    memset(&m_cacheKey, 0, sizeof(m_cacheKey));
+
+    for (uint32 i = 0; i < NumSizeClasses; ++i)
+    {
+        m_depots[i].pBlocks   = nullptr;
+        m_depots[i].numBlocks = 0;
+        m_depots[i].capacity  = 0;
+    }
+}
+
+// =====================================================================================================================
+// Releases all bookkeeping.  Any addresses which are still assigned simply become unmanaged.
+VaAllocator::~VaAllocator()
+{
+    if (m_threadCachingEnabled)
+    {
+        DeleteThreadLocalKey(m_cacheKey);
+    }
+
+    while (m_pCacheList != nullptr)
+    {
+        ThreadCache*const pCache = m_pCacheList;
+        m_pCacheList = pCache->pNext;
+        PAL_FREE(pCache, m_pPlatform);
+    }
+
+    for (uint32 i = 0; i < NumSizeClasses; ++i)
+    {
+        PAL_SAFE_FREE(m_depots[i].pBlocks, m_pPlatform);
+    }
+
+    PAL_SAFE_FREE(m_pRanges, m_pPlatform);
+}
+
+// =====================================================================================================================
+// Takes ownership of the VA range [baseVirtAddr, baseVirtAddr + size).  All assigned addresses and sizes will be
+// multiples of granularity, which must be a power of two.
+Result VaAllocator::Init(
+    gpusize baseVirtAddr,
+    gpusize size,
+    gpusize granularity)
+{
+    PAL_ASSERT(IsPowerOfTwo(granularity));
+
+    m_granularity  = granularity;
+    m_baseVirtAddr = Pow2Align(baseVirtAddr, granularity);
+    m_size         = Pow2AlignDown(baseVirtAddr + size, granularity) - m_baseVirtAddr;
+
+    Result result = m_indexLock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_cacheListLock.Init();
+    }
+
+    for (uint32 i = 0; (result == Result::Success) && (i < NumSizeClasses); ++i)
+    {
+        result = m_depots[i].lock.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_fixedAddrs.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        m_pRanges = static_cast<FreeRange*>(PAL_MALLOC(sizeof(FreeRange) * InitialRangeCapacity,
+                                                       m_pPlatform,
+                                                       AllocInternal));
+        if (m_pRanges == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        m_rangeCapacity = InitialRangeCapacity;
+
+        if (m_size > 0)
+        {
+            m_pRanges[0].baseVirtAddr = m_baseVirtAddr;
+            m_pRanges[0].size         = m_size;
+            m_numRanges               = 1;
+        }
+
+        // Without a thread-local key every small request simply goes through the depots.
+        m_threadCachingEnabled = (CreateThreadLocalKey(&m_cacheKey, &DestroyThreadCache) == Result::Success);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Removes a range of addresses from the pool of assignable addresses.  This must be called before any addresses are
+// assigned.  The excluded range may extend past either end of the managed range.
+Result VaAllocator::Exclude(
+    gpusize virtAddr,
+    gpusize size)
+{
+    const gpusize start = Max(Pow2AlignDown(virtAddr, m_granularity), m_baseVirtAddr);
+    const gpusize end   = Min(Pow2Align(virtAddr + size, m_granularity), m_baseVirtAddr + m_size);
+
+    return (start < end) ? AllocFixedFromIndex(start, end - start, false) : Result::Success;
+}
+
+// =====================================================================================================================
+// Assigns a GPU virtual address for an allocation of the given size and alignment.
+Result VaAllocator::Allocate(
+    gpusize  size,
+    gpusize  alignment,
+    gpusize* pGpuVirtAddr) // [in/out] In: Zero, or the desired VA. Out: The assigned VA.
+{
+    PAL_ASSERT(IsInitialized() && (size > 0));
+
+    size      = Pow2Align(size, m_granularity);
+    alignment = Max(alignment, m_granularity);
+
+    uint32        sizeClass = 0;
+    const bool    isSmall   = GetSizeClass(size, &sizeClass);
+    const gpusize rangeSize = isSmall ? SizeClassBytes(sizeClass) : size;
+
+    Result result = Result::ErrorOutOfGpuMemory;
+
+    if (*pGpuVirtAddr != 0)
+    {
+        // Fixed-address requests are rare; they always go through the free-range index and take exactly their size.
+        result = AllocFixedFromIndex(*pGpuVirtAddr, size, true);
+    }
+    else if (isSmall && (alignment <= rangeSize))
+    {
+        ThreadCache*const pCache = m_threadCachingEnabled ? GetThreadCache() : nullptr;
+
+        if ((pCache != nullptr) && (pCache->classes[sizeClass].count > 0))
+        {
+            (*pGpuVirtAddr) = pCache->classes[sizeClass].virtAddr[--pCache->classes[sizeClass].count];
+            result          = Result::Success;
+        }
+        else
+        {
+            result = AllocFromDepot(sizeClass, pCache, pGpuVirtAddr);
+
+            if (result == Result::ErrorOutOfGpuMemory)
+            {
+                TrimDepots();
+                result = AllocFromDepot(sizeClass, pCache, pGpuVirtAddr);
+            }
+        }
+    }
+    else
+    {
+        result = AllocFromIndex(rangeSize, alignment, pGpuVirtAddr);
+
+        if (result == Result::ErrorOutOfGpuMemory)
+        {
+            TrimDepots();
+            result = AllocFromIndex(rangeSize, alignment, pGpuVirtAddr);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Returns a previously assigned GPU virtual address.  The size must match the size passed to Allocate().
+void VaAllocator::Free(
+    gpusize virtAddr,
+    gpusize size)
+{
+    PAL_ASSERT(IsInitialized() && Contains(virtAddr, size));
+
+    size = Pow2Align(size, m_granularity);
+
+    uint32 sizeClass = 0;
+
+    // Fixed-address requests were assigned exactly their size, which needn't be a size class or naturally aligned.
+    if (((m_numFixedAddrs > 0) && ForgetFixed(virtAddr)) || (GetSizeClass(size, &sizeClass) == false))
+    {
+        FreeToIndex(virtAddr, size);
+    }
+    else
+    {
+        PAL_ASSERT(IsPow2Aligned(virtAddr, SizeClassBytes(sizeClass)));
+
+        ThreadCache*const pCache = m_threadCachingEnabled ? GetThreadCache() : nullptr;
+
+        if (pCache != nullptr)
+        {
+            auto*const pClass = &pCache->classes[sizeClass];
+
+            if (pClass->count == CacheCapacity)
+            {
+                FreeToDepot(sizeClass, &pClass->virtAddr[CacheCapacity - BatchSize], BatchSize);
+                pClass->count -= BatchSize;
+            }
+
+            pClass->virtAddr[pClass->count++] = virtAddr;
+        }
+        else
+        {
+            FreeToDepot(sizeClass, &virtAddr, 1);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Determines the size class of an allocation of the given granularity-aligned size.  Returns false if the allocation is
+// too large to be served from a size class.
+bool VaAllocator::GetSizeClass(
+    gpusize size,
+    uint32* pSizeClass
+    ) const
+{
+    const bool isSmall = (size <= SizeClassBytes(NumSizeClasses - 1));
+
+    if (isSmall)
+    {
+        (*pSizeClass) = Log2(Pow2Pad(size / m_granularity));
+    }
+
+    return isSmall;
+}
+
+// =====================================================================================================================
+// Returns the calling thread's cache, creating it on first use.  Returns null if the cache could not be created.
+VaAllocator::ThreadCache* VaAllocator::GetThreadCache()
+{
+    ThreadCache* pCache = static_cast<ThreadCache*>(GetThreadLocalValue(m_cacheKey));
+
+    if (pCache == nullptr)
+    {
+        pCache = static_cast<ThreadCache*>(PAL_CALLOC(sizeof(ThreadCache), m_pPlatform, AllocInternal));
+
+        if ((pCache != nullptr) && (SetThreadLocalValue(m_cacheKey, pCache) != Result::Success))
+        {
+            PAL_SAFE_FREE(pCache, m_pPlatform);
+        }
+
+        if (pCache != nullptr)
+        {
+            MutexAuto lock(&m_cacheListLock);
+
+            pCache->pOwner = this;
+            pCache->pNext  = m_pCacheList;
+            m_pCacheList   = pCache;
+        }
+    }
+
+    return pCache;
+}
+
+// =====================================================================================================================
+// Called when a thread which has a cache exits.  Parks the thread's cached blocks in the depots and destroys the cache.
+void VaAllocator::DestroyThreadCache(
+    void* pValue)
+{
+    ThreadCache*const pCache = static_cast<ThreadCache*>(pValue);
+    VaAllocator*const pOwner = pCache->pOwner;
+
+    for (uint32 sizeClass = 0; sizeClass < NumSizeClasses; ++sizeClass)
+    {
+        if (pCache->classes[sizeClass].count > 0)
+        {
+            pOwner->FreeToDepot(sizeClass, &pCache->classes[sizeClass].virtAddr[0], pCache->classes[sizeClass].count);
+        }
+    }
+
+    {
+        MutexAuto lock(&pOwner->m_cacheListLock);
+
+        ThreadCache** ppLink = &pOwner->m_pCacheList;
+        while (*ppLink != pCache)
+        {
+            ppLink = &(*ppLink)->pNext;
+        }
+
+        (*ppLink) = pCache->pNext;
+    }
+
+    PAL_FREE(pCache, pOwner->m_pPlatform);
+}
+
+// =====================================================================================================================
+// Takes one block of the given size class from its depot, refilling the depot from the free-range index if necessary.
+// If a thread cache is given, a batch of additional blocks is moved into it as well.
+Result VaAllocator::AllocFromDepot(
+    uint32       sizeClass,
+    ThreadCache* pCache,
+    gpusize*     pGpuVirtAddr)
+{
+    Depot*const pDepot = &m_depots[sizeClass];
+    MutexAuto   lock(&pDepot->lock);
+
+    Result result = (pDepot->numBlocks == 0) ? CarveChunk(sizeClass, pDepot) : Result::Success;
+
+    if (result == Result::Success)
+    {
+        (*pGpuVirtAddr) = pDepot->pBlocks[--pDepot->numBlocks];
+
+        if (pCache != nullptr)
+        {
+            auto*const   pClass = &pCache->classes[sizeClass];
+            const uint32 count  = Min(BatchSize, pDepot->numBlocks);
+
+            pDepot->numBlocks -= count;
+            memcpy(&pClass->virtAddr[pClass->count], &pDepot->pBlocks[pDepot->numBlocks], sizeof(gpusize) * count);
+            pClass->count += count;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Parks free blocks of the given size class in its depot.  Blocks which can't be recorded there go back to the
+// free-range index.
+void VaAllocator::FreeToDepot(
+    uint32         sizeClass,
+    const gpusize* pVirtAddrs,
+    uint32         count)
+{
+    Depot*const pDepot = &m_depots[sizeClass];
+    MutexAuto   lock(&pDepot->lock);
+
+    if ((pDepot->numBlocks + count) > pDepot->capacity)
+    {
+        const uint32 newCapacity = Max(pDepot->capacity * 2, pDepot->numBlocks + count);
+        gpusize*const pNewBlocks = static_cast<gpusize*>(PAL_MALLOC(sizeof(gpusize) * newCapacity,
+                                                                    m_pPlatform,
+                                                                    AllocInternal));
+        if (pNewBlocks != nullptr)
+        {
+            if (pDepot->numBlocks > 0)
+            {
+                memcpy(pNewBlocks, pDepot->pBlocks, sizeof(gpusize) * pDepot->numBlocks);
+            }
+
+            PAL_FREE(pDepot->pBlocks, m_pPlatform);
+            pDepot->pBlocks  = pNewBlocks;
+            pDepot->capacity = newCapacity;
+        }
+    }
+
+    if ((pDepot->numBlocks + count) <= pDepot->capacity)
+    {
+        memcpy(&pDepot->pBlocks[pDepot->numBlocks], pVirtAddrs, sizeof(gpusize) * count);
+        pDepot->numBlocks += count;
+    }
+    else
+    {
+        for (uint32 i = 0; i < count; ++i)
+        {
+            FreeToIndex(pVirtAddrs[i], SizeClassBytes(sizeClass));
+        }
+    }
+}
+
+// =====================================================================================================================
+// Refills an empty depot with blocks carved out of a chunk of the free-range index.  The caller must hold the depot's
+// lock.  If no chunk is available, a single block is carved instead.
+Result VaAllocator::CarveChunk(
+    uint32 sizeClass,
+    Depot* pDepot)
+{
+    PAL_ASSERT(pDepot->numBlocks == 0);
+
+    const gpusize blockSize = SizeClassBytes(sizeClass);
+    gpusize       chunkSize = Max(MinChunkSize, blockSize * BatchSize);
+    gpusize       chunkAddr = 0;
+
+    Result result = AllocFromIndex(chunkSize, blockSize, &chunkAddr);
+
+    if (result == Result::ErrorOutOfGpuMemory)
+    {
+        chunkSize = blockSize;
+        result    = AllocFromIndex(chunkSize, blockSize, &chunkAddr);
+    }
+
+    const uint32 numBlocks = static_cast<uint32>(chunkSize / blockSize);
+
+    if ((result == Result::Success) && (numBlocks > pDepot->capacity))
+    {
+        gpusize*const pNewBlocks = static_cast<gpusize*>(PAL_MALLOC(sizeof(gpusize) * numBlocks,
+                                                                    m_pPlatform,
+                                                                    AllocInternal));
+        if (pNewBlocks != nullptr)
+        {
+            PAL_FREE(pDepot->pBlocks, m_pPlatform);
+            pDepot->pBlocks  = pNewBlocks;
+            pDepot->capacity = numBlocks;
+        }
+        else
+        {
+            FreeToIndex(chunkAddr, chunkSize);
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        // Store the blocks in descending order so that they are handed out in ascending address order.
+        for (uint32 i = 0; i < numBlocks; ++i)
+        {
+            pDepot->pBlocks[i] = chunkAddr + (blockSize * (numBlocks - 1 - i));
+        }
+
+        pDepot->numBlocks = numBlocks;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Hands the blocks cached by the calling thread and every block parked in the depots back to the free-range index so
+// that they can be coalesced.  This is called when the index can't satisfy a request.
+void VaAllocator::TrimDepots()
+{
+    ThreadCache*const pCache = m_threadCachingEnabled ? GetThreadCache() : nullptr;
+
+    for (uint32 sizeClass = 0; sizeClass < NumSizeClasses; ++sizeClass)
+    {
+        if ((pCache != nullptr) && (pCache->classes[sizeClass].count > 0))
+        {
+            FreeToDepot(sizeClass, &pCache->classes[sizeClass].virtAddr[0], pCache->classes[sizeClass].count);
+            pCache->classes[sizeClass].count = 0;
+        }
+
+        Depot*const pDepot = &m_depots[sizeClass];
+        MutexAuto   lock(&pDepot->lock);
+
+        for (uint32 i = 0; i < pDepot->numBlocks; ++i)
+        {
+            FreeToIndex(pDepot->pBlocks[i], SizeClassBytes(sizeClass));
+        }
+
+        pDepot->numBlocks = 0;
+    }
+}
+
+// =====================================================================================================================
+// Assigns the lowest suitably aligned address range of the given size from the free-range index.
+Result VaAllocator::AllocFromIndex(
+    gpusize  size,
+    gpusize  alignment,
+    gpusize* pGpuVirtAddr)
+{
+    MutexAuto lock(&m_indexLock);
+
+    Result result = Result::ErrorOutOfGpuMemory;
+
+    for (uint32 i = 0; i < m_numRanges; ++i)
+    {
+        const FreeRange& range     = m_pRanges[i];
+        const gpusize    alignedVa = Pow2Align(range.baseVirtAddr, alignment);
+
+        if ((alignedVa + size) <= (range.baseVirtAddr + range.size))
+        {
+            result = CarveRange(i, alignedVa, size);
+
+            if (result == Result::Success)
+            {
+                (*pGpuVirtAddr) = alignedVa;
+            }
+            break;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Assigns a specific address range from the free-range index.  Fails if any part of the range is already in use.  If
+// track is set, the range is remembered as a fixed-address request so that Free() returns it to the index.
+Result VaAllocator::AllocFixedFromIndex(
+    gpusize virtAddr,
+    gpusize size,
+    bool    track)
+{
+    MutexAuto lock(&m_indexLock);
+
+    Result       result = Result::ErrorOutOfGpuMemory;
+    const uint32 next   = FindRange(virtAddr);
+
+    if (next > 0)
+    {
+        const FreeRange& range = m_pRanges[next - 1];
+
+        if ((virtAddr + size) <= (range.baseVirtAddr + range.size))
+        {
+            // Remember the request first so that nothing needs to be undone in the index if that fails.
+            result = track ? m_fixedAddrs.Insert(virtAddr) : Result::Success;
+
+            if (result == Result::Success)
+            {
+                result = CarveRange(next - 1, virtAddr, size);
+            }
+
+            if (track && (result == Result::Success))
+            {
+                m_numFixedAddrs++;
+            }
+            else if (track)
+            {
+                m_fixedAddrs.Erase(virtAddr);
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Stops tracking the fixed-address request at the given address.  Returns false if there is no such request.
+bool VaAllocator::ForgetFixed(
+    gpusize virtAddr)
+{
+    MutexAuto lock(&m_indexLock);
+
+    const bool isFixed = m_fixedAddrs.Erase(virtAddr);
+
+    if (isFixed)
+    {
+        m_numFixedAddrs--;
+    }
+
+    return isFixed;
+}
+
+// =====================================================================================================================
+// Returns an address range to the free-range index, merging it with its neighbors.
+Result VaAllocator::FreeToIndex(
+    gpusize virtAddr,
+    gpusize size)
+{
+    MutexAuto lock(&m_indexLock);
+
+    Result       result   = Result::Success;
+    const uint32 next     = FindRange(virtAddr);
+    const bool   joinPrev = (next > 0) &&
+                            ((m_pRanges[next - 1].baseVirtAddr + m_pRanges[next - 1].size) == virtAddr);
+    const bool   joinNext = (next < m_numRanges) && (m_pRanges[next].baseVirtAddr == (virtAddr + size));
+
+    // The range must not overlap any free range.
+    PAL_ASSERT((next == 0) || ((m_pRanges[next - 1].baseVirtAddr + m_pRanges[next - 1].size) <= virtAddr));
+    PAL_ASSERT((next == m_numRanges) || (m_pRanges[next].baseVirtAddr >= (virtAddr + size)));
+
+    if (joinPrev && joinNext)
+    {
+        m_pRanges[next - 1].size += size + m_pRanges[next].size;
+        RemoveRange(next);
+    }
+    else if (joinPrev)
+    {
+        m_pRanges[next - 1].size += size;
+    }
+    else if (joinNext)
+    {
+        m_pRanges[next].baseVirtAddr  = virtAddr;
+        m_pRanges[next].size         += size;
+    }
+    else
+    {
+        result = InsertRange(next, virtAddr, size);
+
+        // The range is lost for good if we run out of system memory here.
+        PAL_ALERT(result != Result::Success);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Removes [virtAddr, virtAddr + size) from the free range at the given index, which must contain it.  The caller must
+// hold the index lock.
+Result VaAllocator::CarveRange(
+    uint32  index,
+    gpusize virtAddr,
+    gpusize size)
+{
+    FreeRange*const pRange   = &m_pRanges[index];
+    const gpusize   headSize = virtAddr - pRange->baseVirtAddr;
+    const gpusize   tailAddr = virtAddr + size;
+    const gpusize   tailSize = (pRange->baseVirtAddr + pRange->size) - tailAddr;
+
+    PAL_ASSERT((virtAddr >= pRange->baseVirtAddr) && (tailAddr <= (pRange->baseVirtAddr + pRange->size)));
+
+    Result result = Result::Success;
+
+    if ((headSize > 0) && (tailSize > 0))
+    {
+        result = InsertRange(index + 1, tailAddr, tailSize);
+
+        if (result == Result::Success)
+        {
+            // InsertRange may have moved the array.
+            m_pRanges[index].size = headSize;
+        }
+    }
+    else if (headSize > 0)
+    {
+        pRange->size = headSize;
+    }
+    else if (tailSize > 0)
+    {
+        pRange->baseVirtAddr = tailAddr;
+        pRange->size         = tailSize;
+    }
+    else
+    {
+        RemoveRange(index);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Returns the index of the first free range which starts above the given address.  The caller must hold the index lock.
+uint32 VaAllocator::FindRange(
+    gpusize virtAddr
+    ) const
+{
+    uint32 low  = 0;
+    uint32 high = m_numRanges;
+
+    while (low < high)
+    {
+        const uint32 mid = low + ((high - low) / 2);
+
+        if (m_pRanges[mid].baseVirtAddr <= virtAddr)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+// =====================================================================================================================
+// Inserts a new free range at the given index, growing the index if needed.  The caller must hold the index lock.
+Result VaAllocator::InsertRange(
+    uint32  index,
+    gpusize virtAddr,
+    gpusize size)
+{
+    Result result = Result::Success;
+
+    if (m_numRanges == m_rangeCapacity)
+    {
+        const uint32    newCapacity = m_rangeCapacity * 2;
+        FreeRange*const pNewRanges  = static_cast<FreeRange*>(PAL_MALLOC(sizeof(FreeRange) * newCapacity,
+                                                                           m_pPlatform,
+                                                                           AllocInternal));
+        if (pNewRanges != nullptr)
+        {
+            memcpy(pNewRanges, m_pRanges, sizeof(FreeRange) * m_numRanges);
+            PAL_FREE(m_pRanges, m_pPlatform);
+            m_pRanges       = pNewRanges;
+            m_rangeCapacity = newCapacity;
+        }
+        else
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        memmove(&m_pRanges[index + 1], &m_pRanges[index], sizeof(FreeRange) * (m_numRanges - index));
+        m_pRanges[index].baseVirtAddr = virtAddr;
+        m_pRanges[index].size         = size;
+        m_numRanges++;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Removes the free range at the given index.  The caller must hold the index lock.
+void VaAllocator::RemoveRange(
+    uint32 index)
+{
+    memmove(&m_pRanges[index], &m_pRanges[index + 1], sizeof(FreeRange) * (m_numRanges - index - 1));
+    m_numRanges--;
+}
+
+} // Pal
@@ -0,0 +1,156 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "core/platform.h"
+#include "palHashSet.h"
+#include "palMutex.h"
+#include "palThread.h"
+
+namespace Pal
+{
+
+// =====================================================================================================================
+// VaAllocator assigns GPU virtual addresses from a single contiguous VA range.  It is meant to sit behind
+// VamMgr::AssignVirtualAddress() and VamMgr::FreeVirtualAddress() when many threads create and destroy GPU memory
+// objects concurrently.
+//
+// Requests are split into two groups:
+// + Small requests are rounded up to a power-of-two size class and served from a per-thread cache of free, naturally
+//   aligned blocks of that class.  The cache is refilled from (and spilled to) a per-class depot in batches, so the
+//   common path touches only thread-local state and the depot locks are taken once per batch.  Depots are refilled by
+//   carving large chunks out of the free-range index.
+// + Large, over-aligned and fixed-address requests go straight to the free-range index: an address-ordered array of
+//   free ranges which is searched with a binary search and coalesces neighbors on free.  It is protected by its own
+//   lock which is only reached on the slow paths.  Fixed-address requests take exactly their granularity-aligned size
+//   and are remembered, so that they are always freed back to the index rather than into a size class.
+//
+// Blocks parked in the depots or cached by the requesting thread are handed back to the free-range index if the index
+// runs out of space.  Blocks held in the cache of another thread are not reclaimed until that cache spills or its
+// thread exits.
+class VaAllocator
+{
+public:
+    explicit VaAllocator(Platform* pPlatform);
+    ~VaAllocator();
+
+    Result Init(gpusize baseVirtAddr, gpusize size, gpusize granularity);
+
+    Result Exclude(gpusize virtAddr, gpusize size);
+
+    Result Allocate(gpusize size, gpusize alignment, gpusize* pGpuVirtAddr);
+    void   Free(gpusize virtAddr, gpusize size);
+
+    bool IsInitialized() const { return (m_pRanges != nullptr); }
+    bool Contains(gpusize virtAddr, gpusize size) const
+        { return (virtAddr >= m_baseVirtAddr) && ((virtAddr + size) <= (m_baseVirtAddr + m_size)); }
+
+private:
+    // Size classes cover the allocation granularity up to this many doublings of it.
+    static constexpr uint32 NumSizeClasses = 10;
+    // Number of free blocks each thread may hold per size class.
+    static constexpr uint32 CacheCapacity  = 32;
+    // Number of blocks moved between a thread cache and a depot at a time.
+    static constexpr uint32 BatchSize      = CacheCapacity / 2;
+    // Minimum amount of VA space carved out of the free-range index when a depot runs dry.
+    static constexpr gpusize MinChunkSize  = 4 * 1024 * 1024;
+
+    // A free, contiguous piece of the managed VA range.
+    struct FreeRange
+    {
+        gpusize baseVirtAddr;
+        gpusize size;
+    };
+
+    // Per-thread state.  Only ever touched by its owning thread, except during destruction.
+    struct ThreadCache
+    {
+        VaAllocator* pOwner;
+        ThreadCache* pNext;                       // Next cache in the list of all caches owned by this allocator.
+        struct
+        {
+            uint32  count;
+            gpusize virtAddr[CacheCapacity];
+        } classes[NumSizeClasses];
+    };
+
+    // Global, lock-protected free blocks of a single size class.
+    struct Depot
+    {
+        Util::Mutex lock;
+        gpusize*    pBlocks;
+        uint32      numBlocks;
+        uint32      capacity;
+    };
+
+    bool         GetSizeClass(gpusize size, uint32* pSizeClass) const;
+    gpusize      SizeClassBytes(uint32 sizeClass) const { return (m_granularity << sizeClass); }
+    ThreadCache* GetThreadCache();
+
+    static void DestroyThreadCache(void* pValue);
+
+    Result AllocFromDepot(uint32 sizeClass, ThreadCache* pCache, gpusize* pGpuVirtAddr);
+    void   FreeToDepot(uint32 sizeClass, const gpusize* pVirtAddrs, uint32 count);
+    Result CarveChunk(uint32 sizeClass, Depot* pDepot);
+    void   TrimDepots();
+
+    Result AllocFromIndex(gpusize size, gpusize alignment, gpusize* pGpuVirtAddr);
+    Result AllocFixedFromIndex(gpusize virtAddr, gpusize size, bool track);
+    bool   ForgetFixed(gpusize virtAddr);
+    Result FreeToIndex(gpusize virtAddr, gpusize size);
+    Result CarveRange(uint32 index, gpusize virtAddr, gpusize size);
+    uint32 FindRange(gpusize virtAddr) const;
+    Result InsertRange(uint32 index, gpusize virtAddr, gpusize size);
+    void   RemoveRange(uint32 index);
+
+    Platform*const       m_pPlatform;
+    gpusize              m_baseVirtAddr;
+    gpusize              m_size;
+    gpusize              m_granularity;
+    bool                 m_threadCachingEnabled;
+    Util::ThreadLocalKey m_cacheKey;
+
+    Depot                m_depots[NumSizeClasses];
+
+    Util::Mutex          m_indexLock;      // Protects the free-range index.
+    FreeRange*           m_pRanges;        // Free ranges, sorted by address.  Adjacent ranges are always merged.
+    uint32               m_numRanges;
+    uint32               m_rangeCapacity;
+
+    typedef Util::HashSet<gpusize, Platform> FixedAddrSet;
+
+    FixedAddrSet         m_fixedAddrs;     // Base addresses of the live fixed-address requests.  Protected by the index
+                                           // lock.
+    volatile uint32      m_numFixedAddrs;  // Lets Free() skip the index lock while there are no fixed-address requests.
+
+    Util::Mutex          m_cacheListLock;  // Serializes updates to the list of thread caches.
+    ThreadCache*         m_pCacheList;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(VaAllocator);
+    PAL_DISALLOW_DEFAULT_CTOR(VaAllocator);
+};
+
+} // Pal
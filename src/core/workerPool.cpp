@@ -0,0 +1,194 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/platform.h"
+#include "core/workerPool.h"
+#include "palSysUtil.h"
+
+using namespace Util;
+
+namespace Pal
+{
+
+// =====================================================================================================================
+WorkerPool::WorkerPool(
+    Platform* pPlatform)
+    :
+    m_pPlatform(pPlatform),
+    m_pThreads(nullptr),
+    m_maxWorkers(0),
+    m_numWorkers(0),
+    m_pfnJob(nullptr),
+    m_pJobData(nullptr),
+    m_shutdown(false)
+{
+}
+
+// =====================================================================================================================
+WorkerPool::~WorkerPool()
+{
+    if (m_numWorkers > 0)
+    {
+        m_shutdown = true;
+
+        for (uint32 i = 0; i < m_numWorkers; ++i)
+        {
+            m_jobSemaphore.Post();
+        }
+
+        for (uint32 i = 0; i < m_numWorkers; ++i)
+        {
+            m_pThreads[i].Join();
+        }
+    }
+
+    PAL_SAFE_DELETE_ARRAY(m_pThreads, m_pPlatform);
+}
+
+// =====================================================================================================================
+// Sizes the pool to one worker per logical CPU core besides the calling thread. No threads are started yet.
+Result WorkerPool::Init()
+{
+    Result result = m_runLock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_jobSemaphore.Init(Semaphore::MaximumCountLimit, 0);
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_doneSemaphore.Init(Semaphore::MaximumCountLimit, 0);
+    }
+
+    if (result == Result::Success)
+    {
+        SystemInfo systemInfo = { };
+
+        if ((QuerySystemInfo(&systemInfo) == Result::Success) && (systemInfo.cpuLogicalCoreCount > 1))
+        {
+            m_maxWorkers = systemInfo.cpuLogicalCoreCount - 1;
+            m_pThreads   = PAL_NEW_ARRAY(Thread, m_maxWorkers, m_pPlatform, AllocInternal);
+
+            // The pool only speeds things up, so jobs can still run on their calling threads without it.
+            if (m_pThreads == nullptr)
+            {
+                m_maxWorkers = 0;
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Starts workers until at least the given number are running, or the pool is full. Returns the number of running
+// workers. The run lock must be held.
+uint32 WorkerPool::StartWorkers(
+    uint32 count)
+{
+    const uint32 targetCount = Min(count, m_maxWorkers);
+
+    while ((m_numWorkers < targetCount) &&
+           (m_pThreads[m_numWorkers].Begin(&WorkerThreadFunc, this) == Result::Success))
+    {
+        m_numWorkers++;
+    }
+
+    return m_numWorkers;
+}
+
+// =====================================================================================================================
+uint32 WorkerPool::Run(
+    JobFunction pfnJob,
+    void*       pJobData,
+    uint32      maxThreads)
+{
+    uint32 numHelpers = 0;
+
+    if ((maxThreads > 1) && m_runLock.TryLock())
+    {
+        numHelpers = Min(maxThreads - 1, StartWorkers(maxThreads - 1));
+
+        // The semaphores order these writes before the workers' reads.
+        m_pfnJob   = pfnJob;
+        m_pJobData = pJobData;
+
+        for (uint32 i = 0; i < numHelpers; ++i)
+        {
+            m_jobSemaphore.Post();
+        }
+
+        pfnJob(pJobData);
+
+        // A wait interrupted by a signal fails without consuming a post, so only successful waits are counted.
+        for (uint32 numDone = 0; numDone < numHelpers; )
+        {
+            if (m_doneSemaphore.Wait(UINT32_MAX) == Result::Success)
+            {
+                numDone++;
+            }
+        }
+
+        m_runLock.Unlock();
+    }
+    else
+    {
+        pfnJob(pJobData);
+    }
+
+    return (numHelpers + 1);
+}
+
+// =====================================================================================================================
+void WorkerPool::WorkerThreadFunc(
+    void* pParameter)
+{
+    static_cast<WorkerPool*>(pParameter)->RunWorker();
+}
+
+// =====================================================================================================================
+// Main loop of a worker: runs the current job each time the job semaphore is posted, until the pool is destroyed.
+void WorkerPool::RunWorker()
+{
+    bool exit = false;
+
+    while (exit == false)
+    {
+        // A wait interrupted by a signal fails without consuming a post, so just wait again.
+        if (m_jobSemaphore.Wait(UINT32_MAX) == Result::Success)
+        {
+            exit = m_shutdown;
+
+            if (exit == false)
+            {
+                m_pfnJob(m_pJobData);
+                m_doneSemaphore.Post();
+            }
+        }
+    }
+}
+
+} // Pal
@@ -0,0 +1,81 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "palMutex.h"
+#include "palSemaphore.h"
+#include "palThread.h"
+
+namespace Pal
+{
+
+class Platform;
+
+// =====================================================================================================================
+// A set of persistent worker threads which help a calling thread with data-parallel work, such as creating a batch of
+// pipelines.  The threads are started the first time they are needed and live until the platform is destroyed, so
+// callers don't pay for creating threads, and thread-local caches aren't orphaned by short-lived threads.
+//
+// Only one job runs on the pool at a time.  If another thread's job is already running, Run() simply executes the job
+// on the calling thread alone.
+class WorkerPool
+{
+public:
+    // Entrypoint of a job.  It is called concurrently on every participating thread and must split its work between
+    // those calls itself, e.g. by handing out indices from a shared counter.
+    typedef void (*JobFunction)(void* pJobData);
+
+    explicit WorkerPool(Platform* pPlatform);
+    ~WorkerPool();
+
+    Result Init();
+
+    // Runs pfnJob(pJobData) on the calling thread and on up to (maxThreads - 1) workers, and returns once every call
+    // has returned.  Returns the number of threads which ran the job, including the calling thread.
+    uint32 Run(JobFunction pfnJob, void* pJobData, uint32 maxThreads);
+
+private:
+    static void WorkerThreadFunc(void* pParameter);
+    void RunWorker();
+
+    uint32 StartWorkers(uint32 count);
+
+    Platform*const    m_pPlatform;
+    Util::Thread*     m_pThreads;       // Storage for up to m_maxWorkers threads, of which m_numWorkers were started.
+    uint32            m_maxWorkers;
+    uint32            m_numWorkers;
+    Util::Mutex       m_runLock;        // Held by the thread whose job the workers are currently running.
+    Util::Semaphore   m_jobSemaphore;   // Posted once for each worker which should run the current job.
+    Util::Semaphore   m_doneSemaphore;  // Posted by each worker when it returns from the current job.
+    JobFunction       m_pfnJob;
+    void*             m_pJobData;
+    bool              m_shutdown;       // Tells the workers to exit instead of running a job.
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(WorkerPool);
+    PAL_DISALLOW_DEFAULT_CTOR(WorkerPool);
+};
+
+} // Pal
@@ -0,0 +1,929 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palElfCache.h"
+#include "palFile.h"
+#include "palInlineFuncs.h"
+#include "palSysUtil.h"
+#include <cstdio>
+
+namespace Util
+{
+
+// Identifies a valid index file, and the layout of its contents.
+constexpr uint32 ElfCacheIndexMagic   = 0x48434C45; // 'ELCH'
+constexpr uint32 ElfCacheIndexVersion = 2;
+
+// Initial size of the data file.  It grows on demand.
+constexpr size_t ElfCacheInitialDataSize = 1024 * 1024;
+
+// Upper bound on ElfCacheCreateInfo::maxEntries, which keeps the slot count within 32 bits.
+constexpr uint32 ElfCacheMaxEntriesLimit = 1u << 24;
+
+// Terminates the LRU list.
+constexpr uint32 InvalidSlot = UINT32_MAX;
+
+// =====================================================================================================================
+ElfCache::ElfCache()
+    :
+    m_maxDataSize(0),
+    m_maxEntries(0),
+    m_numSlots(0),
+    m_indexSize(0),
+    m_numFileReaders(0),
+    m_validGeneration(0),
+    m_indexValid(false),
+    m_numPendingTouches(0)
+{
+    memset(&m_indexFileName[0],  0, sizeof(m_indexFileName));
+    memset(&m_dataFileName[0],   0, sizeof(m_dataFileName));
+    memset(&m_lockFileName[0],   0, sizeof(m_lockFileName));
+    memset(&m_pendingTouches[0], 0, sizeof(m_pendingTouches));
+    memset(&m_stats,             0, sizeof(m_stats));
+}
+
+// =====================================================================================================================
+ElfCache::~ElfCache()
+{
+    if (m_indexView.IsValid())
+    {
+        FlushTouches();
+    }
+
+    m_indexView.UnMap(false);
+    m_indexFile.CloseStorageFile();
+    m_dataFile.CloseStorageFile();
+}
+
+// =====================================================================================================================
+// Opens or creates the cache files and makes sure the index is usable.
+Result ElfCache::Init(
+    const ElfCacheCreateInfo& createInfo)
+{
+    static_assert(sizeof(IndexHeader) == 64, "Changing the index layout requires a new ElfCacheIndexVersion.");
+    static_assert(sizeof(IndexEntry)  == 64, "Changing the index layout requires a new ElfCacheIndexVersion.");
+
+    PAL_ASSERT((createInfo.pDirectory != nullptr) && (createInfo.pName != nullptr));
+    PAL_ASSERT((createInfo.maxEntries > 0) && (createInfo.maxEntries <= ElfCacheMaxEntriesLimit));
+
+    Result result = m_lock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_fileReaderLock.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_touchLock.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        // MkDirRecursively only creates directories which are followed by a separator.
+        char directory[MaxFileNameLen];
+        Snprintf(&directory[0], sizeof(directory), "%s/", createInfo.pDirectory);
+
+        result = MkDirRecursively(&directory[0]);
+
+        if (result == Result::AlreadyExists)
+        {
+            result = Result::Success;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        Snprintf(&m_indexFileName[0], sizeof(m_indexFileName), "%s/%s.idx",  createInfo.pDirectory, createInfo.pName);
+        Snprintf(&m_dataFileName[0],  sizeof(m_dataFileName),  "%s/%s.bin",  createInfo.pDirectory, createInfo.pName);
+        Snprintf(&m_lockFileName[0],  sizeof(m_lockFileName),  "%s/%s.lock", createInfo.pDirectory, createInfo.pName);
+
+        m_maxDataSize = createInfo.maxDataSize;
+        m_maxEntries  = Min(Max(createInfo.maxEntries, 1u), ElfCacheMaxEntriesLimit);
+
+        // At most three quarters of the slots may be occupied, which keeps the probe sequences short.
+        m_numSlots  = Pow2Pad(m_maxEntries + ((m_maxEntries + 2) / 3));
+        m_indexSize = sizeof(IndexHeader) + ((sizeof(IndexEntry) + sizeof(uint32)) * m_numSlots);
+
+        result = m_lockFile.Create(&m_lockFileName[0], true, 0, nullptr);
+    }
+
+    // Opening a MemMapFile resizes the file and may initialize its header, so the lock must be held before either of
+    // the cache files is touched.
+    if ((result == Result::Success) && (m_lockFile.Lock(true) == Result::Success))
+    {
+        result = OpenFile(&m_indexFile, &m_indexFileName[0], m_indexSize, false);
+
+        if (result == Result::Success)
+        {
+            result = OpenFile(&m_dataFile, &m_dataFileName[0], ElfCacheInitialDataSize, true);
+        }
+
+        if (result == Result::Success)
+        {
+            result = Result::ErrorInitializationFailed;
+
+            if ((m_indexFile.GetStorageSize() >= m_indexSize) &&
+                (m_indexFile.GetExistingStorage(0, m_indexSize, &m_indexView) == Result::Success) &&
+                m_indexView.IsValid())
+            {
+                result = ValidateFiles();
+            }
+        }
+
+        // Start from scratch if another process left the cache in a state we don't understand.
+        if ((result == Result::Success) && (IndexIsValid() == false))
+        {
+            ResetIndex();
+        }
+
+        if (result == Result::Success)
+        {
+            m_validGeneration = IndexHdr()->generation;
+            m_indexValid      = true;
+        }
+
+        m_lockFile.Unlock();
+    }
+    else if (result == Result::Success)
+    {
+        result = Result::ErrorInitializationFailed;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Opens one of the cache files. If the existing file is unusable it is replaced by a new one.
+Result ElfCache::OpenFile(
+    MemMapFile* pFile,
+    const char* pFileName,
+    size_t      minSize,      // Minimum usable size of the file, not counting its header.
+    bool        allowGrowth)
+{
+    const uint32 accessFlags = StorageAccessModeFlags::Writeable |
+                               (allowGrowth ? StorageAccessModeFlags::AllowGrowth : 0);
+
+    // MemMapFile resizes the file to the requested mapping size, so never ask for less than the file already holds.
+    size_t mappingSize = minSize + sizeof(MemMapFileHeader);
+    if (File::Exists(pFileName))
+    {
+        mappingSize = Max(mappingSize, File::GetFileSize(pFileName));
+    }
+
+    Result result = pFile->OpenStorageFile(accessFlags, mappingSize, pFileName, nullptr);
+
+    if ((result != Result::Success) && File::Exists(pFileName))
+    {
+        pFile->CloseStorageFile();
+        remove(pFileName);
+
+        result = pFile->OpenStorageFile(accessFlags, minSize + sizeof(MemMapFileHeader), pFileName, nullptr);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Picks up any growth of the data file by other processes and checks both storage headers. The lock file must be held.
+Result ElfCache::ValidateFiles()
+{
+    bool   reloaded = false;
+    Result result   = m_dataFile.ReloadIfNeeded(&reloaded);
+
+    if (result == Result::Success)
+    {
+        result = m_indexFile.ValidateStorage();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_dataFile.ValidateStorage();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Revalidates the files after another process changed them, and records the generation they were validated at.
+void ElfCache::Revalidate()
+{
+    RWLockAuto<RWLock::ReadWrite> lock(&m_lock);
+
+    if (m_lockFile.Lock(false) == Result::Success)
+    {
+        m_indexValid      = (ValidateFiles() == Result::Success) && IndexIsValid();
+        m_validGeneration = IndexHdr()->generation;
+
+        m_lockFile.Unlock();
+    }
+}
+
+// =====================================================================================================================
+// Returns true if the index was written by this version of the cache with the same capacity and is consistent with the
+// data file. The lock file must be held.
+bool ElfCache::IndexIsValid() const
+{
+    bool isValid = false;
+
+    TRY_ACCESS_FILE_VIEW(m_indexView.IsValid())
+    {
+        const IndexHeader& header = *IndexHdr();
+
+        isValid = (header.magic      == ElfCacheIndexMagic)                                   &&
+                  (header.version    == ElfCacheIndexVersion)                                 &&
+                  (header.numSlots   == m_numSlots)                                           &&
+                  (header.numEntries <= m_maxEntries)                                         &&
+                  (header.liveBytes  <= m_dataFile.GetUsedStorageSize())                      &&
+                  ((header.lruHead   <  m_numSlots) || (header.lruHead == InvalidSlot))        &&
+                  ((header.lruTail   <  m_numSlots) || (header.lruTail == InvalidSlot))        &&
+                  ((header.lruHead   == InvalidSlot) == (header.numEntries == 0));
+    }
+    CATCH_ACCESS_FILE_VIEW
+    {
+        PAL_ASSERT_ALWAYS();
+    }
+
+    return isValid;
+}
+
+// =====================================================================================================================
+// Discards every entry and all cached data. The lock file must be held exclusively.
+void ElfCache::ResetIndex()
+{
+    TRY_ACCESS_FILE_VIEW(m_indexView.IsValid())
+    {
+        IndexHeader*const pHeader = IndexHdr();
+
+        // The generation keeps counting so that other processes notice the reset.
+        const uint64 generation = pHeader->generation;
+
+        memset(m_indexView.Ptr(), 0, m_indexSize);
+
+        pHeader->magic      = ElfCacheIndexMagic;
+        pHeader->version    = ElfCacheIndexVersion;
+        pHeader->numSlots   = m_numSlots;
+        pHeader->generation = generation + 1;
+        pHeader->lruHead    = InvalidSlot;
+        pHeader->lruTail    = InvalidSlot;
+    }
+    CATCH_ACCESS_FILE_VIEW
+    {
+        PAL_ASSERT_ALWAYS();
+    }
+
+    m_dataFile.TruncateStorage(0);
+}
+
+// =====================================================================================================================
+// Takes the shared file lock on behalf of a Load() call. The advisory lock belongs to the file descriptor rather than
+// the thread, so only the first concurrent reader locks the file and only the last one unlocks it. m_lock must be held
+// for reading.
+Result ElfCache::LockShared()
+{
+    MutexAuto lock(&m_fileReaderLock);
+
+    Result result = Result::Success;
+
+    if (m_numFileReaders == 0)
+    {
+        result = m_lockFile.Lock(false);
+    }
+
+    if (result == Result::Success)
+    {
+        m_numFileReaders++;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Releases the shared file lock taken by LockShared().
+void ElfCache::UnlockShared()
+{
+    MutexAuto lock(&m_fileReaderLock);
+
+    PAL_ASSERT(m_numFileReaders > 0);
+
+    if (--m_numFileReaders == 0)
+    {
+        m_lockFile.Unlock();
+    }
+}
+
+// =====================================================================================================================
+// Records that Load() hit the given entry. If the queue is full the update is dropped, which only makes the LRU order a
+// little less accurate. Returns true if the queue is full.
+bool ElfCache::QueueTouch(
+    const ElfCacheKey& key)
+{
+    MutexAuto lock(&m_touchLock);
+
+    if (m_numPendingTouches < PendingTouchCount)
+    {
+        m_pendingTouches[m_numPendingTouches++] = key;
+    }
+
+    return (m_numPendingTouches >= PendingTouchCount);
+}
+
+// =====================================================================================================================
+// Moves every entry hit since the last call to the most-recently used end of the LRU list. The lock file must be held
+// exclusively and the index must be valid.
+void ElfCache::ApplyTouches()
+{
+    MutexAuto lock(&m_touchLock);
+
+    for (uint32 i = 0; i < m_numPendingTouches; ++i)
+    {
+        uint32 slot = 0;
+
+        if (FindSlot(m_pendingTouches[i], &slot))
+        {
+            Unlink(slot);
+            LinkMru(slot);
+        }
+    }
+
+    m_numPendingTouches = 0;
+}
+
+// =====================================================================================================================
+// Applies the queued LRU updates when no entry is going to be stored soon enough to do it.
+void ElfCache::FlushTouches()
+{
+    RWLockAuto<RWLock::ReadWrite> lock(&m_lock);
+
+    if (m_lockFile.Lock(true) == Result::Success)
+    {
+        if ((ValidateFiles() == Result::Success) && IndexIsValid())
+        {
+            ApplyTouches();
+        }
+
+        m_lockFile.Unlock();
+    }
+}
+
+// =====================================================================================================================
+void ElfCache::ComputeElfHash(
+    const void*      pElf,
+    size_t           elfSize,
+    MetroHash::Hash* pHash)
+{
+    MetroHash128::Hash(static_cast<const uint8*>(pElf), elfSize, &pHash->bytes[0]);
+}
+
+// =====================================================================================================================
+// Returns the first slot in the probe sequence for the given key.
+uint32 ElfCache::HomeSlot(
+    const ElfCacheKey& key
+    ) const
+{
+    return (MetroHash::Compact32(&key.elfHash) ^ MetroHash::Compact32(key.deviceKey)) & (m_numSlots - 1);
+}
+
+// =====================================================================================================================
+// Searches the index for the given key. Returns true and the entry's slot if it was found.
+bool ElfCache::FindSlot(
+    const ElfCacheKey& key,
+    uint32*            pSlot
+    ) const
+{
+    const IndexEntry*const pEntries = Entries();
+
+    uint32 slot  = HomeSlot(key);
+    bool   found = false;
+
+    // The index is never full, so every probe sequence ends at an empty slot.
+    while (pEntries[slot].valid != 0)
+    {
+        if (memcmp(&pEntries[slot].key, &key, sizeof(key)) == 0)
+        {
+            found = true;
+            break;
+        }
+
+        slot = (slot + 1) & (m_numSlots - 1);
+    }
+
+    *pSlot = slot;
+
+    return found;
+}
+
+// =====================================================================================================================
+// Appends the entry in the given slot to the most-recently used end of the LRU list. The lock file must be held
+// exclusively.
+void ElfCache::LinkMru(
+    uint32 slot)
+{
+    IndexHeader*const pHeader  = IndexHdr();
+    IndexEntry*const  pEntries = Entries();
+
+    pEntries[slot].lruPrev = pHeader->lruTail;
+    pEntries[slot].lruNext = InvalidSlot;
+
+    if (pHeader->lruTail != InvalidSlot)
+    {
+        pEntries[pHeader->lruTail].lruNext = slot;
+    }
+    else
+    {
+        pHeader->lruHead = slot;
+    }
+
+    pHeader->lruTail = slot;
+}
+
+// =====================================================================================================================
+// Removes the entry in the given slot from the LRU list. The lock file must be held exclusively.
+void ElfCache::Unlink(
+    uint32 slot)
+{
+    IndexHeader*const pHeader  = IndexHdr();
+    IndexEntry*const  pEntries = Entries();
+
+    const uint32 prev = pEntries[slot].lruPrev;
+    const uint32 next = pEntries[slot].lruNext;
+
+    if (prev != InvalidSlot)
+    {
+        pEntries[prev].lruNext = next;
+    }
+    else
+    {
+        pHeader->lruHead = next;
+    }
+
+    if (next != InvalidSlot)
+    {
+        pEntries[next].lruPrev = prev;
+    }
+    else
+    {
+        pHeader->lruTail = prev;
+    }
+}
+
+// =====================================================================================================================
+// Removes the entry in the given slot. Rather than leaving a tombstone behind, later entries in the same cluster are
+// shifted back so that lookups can keep stopping at the first empty slot. The lock file must be held exclusively.
+void ElfCache::EraseSlot(
+    uint32 slot)
+{
+    const uint32 slotMask = m_numSlots - 1;
+
+    IndexHeader*const pHeader  = IndexHdr();
+    IndexEntry*const  pEntries = Entries();
+
+    PAL_ASSERT((pEntries[slot].valid != 0) && (pHeader->numEntries > 0));
+
+    pHeader->liveBytes -= pEntries[slot].dataSize;
+    pHeader->numEntries--;
+
+    Unlink(slot);
+
+    uint32 hole = slot;
+    for (uint32 next = (slot + 1) & slotMask; pEntries[next].valid != 0; next = (next + 1) & slotMask)
+    {
+        const uint32 home = HomeSlot(pEntries[next].key);
+
+        // The entry can fill the hole if the hole lies between its home slot and its current slot.
+        if (((next - home) & slotMask) >= ((next - hole) & slotMask))
+        {
+            IndexEntry*const pMoved = &pEntries[hole];
+
+            memcpy(pMoved, &pEntries[next], sizeof(IndexEntry));
+
+            // Point the entry's LRU neighbors at its new slot.
+            if (pMoved->lruPrev != InvalidSlot)
+            {
+                pEntries[pMoved->lruPrev].lruNext = hole;
+            }
+            else
+            {
+                pHeader->lruHead = hole;
+            }
+
+            if (pMoved->lruNext != InvalidSlot)
+            {
+                pEntries[pMoved->lruNext].lruPrev = hole;
+            }
+            else
+            {
+                pHeader->lruTail = hole;
+            }
+
+            hole = next;
+        }
+    }
+
+    memset(&pEntries[hole], 0, sizeof(IndexEntry));
+}
+
+// =====================================================================================================================
+// Evicts the least-recently used entry. Returns false if there was nothing to evict. The lock file must be held
+// exclusively.
+bool ElfCache::EvictLru()
+{
+    const uint32 victim = IndexHdr()->lruHead;
+    const bool   found  = (victim != InvalidSlot) && (Entries()[victim].valid != 0);
+
+    if (found)
+    {
+        EraseSlot(victim);
+        m_stats.evictions++;
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Restores the max-heap property, ordered by data offset, of the subtree at the given root of the first heapSize
+// elements of pOrder.
+void ElfCache::SiftDown(
+    uint32* pOrder,
+    uint32  root,
+    uint32  heapSize
+    ) const
+{
+    const IndexEntry*const pEntries = Entries();
+
+    for (uint32 child = (2 * root) + 1; child < heapSize; child = (2 * root) + 1)
+    {
+        if (((child + 1) < heapSize) &&
+            (pEntries[pOrder[child + 1]].dataOffset > pEntries[pOrder[child]].dataOffset))
+        {
+            child++;
+        }
+
+        if (pEntries[pOrder[root]].dataOffset >= pEntries[pOrder[child]].dataOffset)
+        {
+            break;
+        }
+
+        const uint32 tmp = pOrder[root];
+        pOrder[root]     = pOrder[child];
+        pOrder[child]    = tmp;
+        root             = child;
+    }
+}
+
+// =====================================================================================================================
+// Sorts a list of occupied slots by the data offset of their entries. Entries stored after the last compaction can be
+// in any order, so this is a heap sort rather than something which degrades to quadratic time on a large cache.
+void ElfCache::SortByDataOffset(
+    uint32* pOrder,
+    uint32  count
+    ) const
+{
+    for (uint32 root = count / 2; root > 0; --root)
+    {
+        SiftDown(pOrder, root - 1, count);
+    }
+
+    for (uint32 heapSize = count; heapSize > 1; --heapSize)
+    {
+        const uint32 largest = pOrder[0];
+        pOrder[0]            = pOrder[heapSize - 1];
+        pOrder[heapSize - 1] = largest;
+
+        SiftDown(pOrder, 0, heapSize - 1);
+    }
+}
+
+// =====================================================================================================================
+// Packs the data of all live entries at the start of the data file, dropping the space used by evicted entries. The
+// lock file must be held exclusively, which guarantees that no other process is reading the data file.
+Result ElfCache::CompactData()
+{
+    IndexEntry*const pEntries = Entries();
+    uint32*const     pOrder   = CompactOrder();
+
+    // Gather the live entries and sort them by data offset so that every move is towards the start of the file.
+    uint32 numLive = 0;
+    for (uint32 slot = 0; slot < m_numSlots; ++slot)
+    {
+        if (pEntries[slot].valid != 0)
+        {
+            PAL_ASSERT(numLive < m_maxEntries);
+            pOrder[numLive++] = slot;
+        }
+    }
+
+    SortByDataOffset(pOrder, numLive);
+
+    const size_t usedSize = m_dataFile.GetUsedStorageSize();
+
+    Result   result     = Result::Success;
+    uint64   liveOffset = 0;
+    FileView dataView;
+
+    if ((numLive > 0) && (usedSize > 0))
+    {
+        result = m_dataFile.GetExistingStorage(0, usedSize, &dataView);
+    }
+
+    if ((result == Result::Success) && (numLive > 0))
+    {
+        TRY_ACCESS_FILE_VIEW(dataView.IsValid())
+        {
+            for (uint32 i = 0; i < numLive; ++i)
+            {
+                IndexEntry*const pEntry = &pEntries[pOrder[i]];
+
+                PAL_ASSERT((pEntry->dataOffset + pEntry->dataSize) <= usedSize);
+
+                if (pEntry->dataOffset != liveOffset)
+                {
+                    memmove(VoidPtrInc(dataView.Ptr(), static_cast<size_t>(liveOffset)),
+                            VoidPtrInc(dataView.Ptr(), static_cast<size_t>(pEntry->dataOffset)),
+                            pEntry->dataSize);
+
+                    pEntry->dataOffset = liveOffset;
+                }
+
+                liveOffset += pEntry->dataSize;
+            }
+        }
+        CATCH_ACCESS_FILE_VIEW
+        {
+            result = Result::ErrorUnknown;
+        }
+    }
+
+    dataView.UnMap(false);
+
+    if (result == Result::Success)
+    {
+        result = m_dataFile.TruncateStorage(static_cast<size_t>(liveOffset));
+        m_stats.compactions++;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Looks up an entry and copies out its data.
+Result ElfCache::Load(
+    const ElfCacheKey& key,
+    void*              pData,
+    size_t*            pDataSize)
+{
+    PAL_ASSERT(pDataSize != nullptr);
+
+    // The index view stays mapped for the lifetime of the cache, so the generation can be peeked at without any locks.
+    // The files only need to be validated again once another process (or a Store() on another thread) changed them.
+    if (*static_cast<volatile const uint64*>(&IndexHdr()->generation) != m_validGeneration)
+    {
+        Revalidate();
+    }
+
+    Result result       = Result::NotFound;
+    bool   flushTouches = false;
+
+    {
+        RWLockAuto<RWLock::ReadOnly> lock(&m_lock);
+
+        if (LockShared() == Result::Success)
+        {
+            uint32 slot = 0;
+
+            // If the files changed again since they were validated, report a miss; the next call will revalidate.
+            if (m_indexValid && (IndexHdr()->generation == m_validGeneration) && FindSlot(key, &slot))
+            {
+                const IndexEntry& entry     = Entries()[slot];
+                const size_t      entrySize = entry.dataSize;
+
+                if (pData == nullptr)
+                {
+                    *pDataSize = entrySize;
+                    result     = Result::Success;
+                }
+                else if (*pDataSize < entrySize)
+                {
+                    *pDataSize = entrySize;
+                    result     = Result::ErrorInvalidMemorySize;
+                }
+                else
+                {
+                    FileView dataView;
+
+                    if (((entry.dataOffset + entrySize) <= m_dataFile.GetUsedStorageSize()) &&
+                        (m_dataFile.GetExistingStorage(static_cast<size_t>(entry.dataOffset),
+                                                       entrySize,
+                                                       &dataView) == Result::Success))
+                    {
+                        TRY_ACCESS_FILE_VIEW(dataView.IsValid())
+                        {
+                            memcpy(pData, dataView.Ptr(), entrySize);
+                        }
+                        CATCH_ACCESS_FILE_VIEW
+                        {
+                            PAL_ASSERT_ALWAYS();
+                        }
+
+                        dataView.UnMap(false);
+
+                        uint64 checksum = 0;
+                        MetroHash64::Hash(static_cast<const uint8*>(pData),
+                                          entrySize,
+                                          reinterpret_cast<uint8*>(&checksum));
+
+                        if (checksum == entry.checksum)
+                        {
+                            *pDataSize = entrySize;
+                            result     = Result::Success;
+
+                            AtomicAdd64(&m_stats.hits,      1);
+                            AtomicAdd64(&m_stats.bytesRead, entrySize);
+                        }
+                    }
+
+                    if (result != Result::Success)
+                    {
+                        AtomicAdd64(&m_stats.corruptEntries, 1);
+                    }
+                }
+
+                if (result == Result::Success)
+                {
+                    flushTouches = QueueTouch(key);
+                }
+            }
+
+            UnlockShared();
+        }
+    }
+
+    // A cache which is only read from still needs its LRU order maintained.
+    if (flushTouches)
+    {
+        FlushTouches();
+    }
+
+    if (result == Result::NotFound)
+    {
+        AtomicAdd64(&m_stats.misses, 1);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Adds an entry to the cache, replacing any existing entry with the same key.
+Result ElfCache::Store(
+    const ElfCacheKey& key,
+    const void*        pData,
+    size_t             dataSize)
+{
+    Result result = Result::ErrorInvalidValue;
+
+    if ((pData != nullptr) && (dataSize > 0) && (dataSize <= m_maxDataSize) && (dataSize <= UINT32_MAX))
+    {
+        RWLockAuto<RWLock::ReadWrite> lock(&m_lock);
+
+        result = m_lockFile.Lock(true);
+
+        if (result == Result::Success)
+        {
+            result = ValidateFiles();
+
+            const bool filesValid = (result == Result::Success);
+
+            if (filesValid && (IndexIsValid() == false))
+            {
+                ResetIndex();
+            }
+
+            IndexHeader*const pHeader  = IndexHdr();
+            IndexEntry*const  pEntries = Entries();
+
+            uint32 slot = 0;
+            if (result == Result::Success)
+            {
+                ApplyTouches();
+
+                if (FindSlot(key, &slot))
+                {
+                    EraseSlot(slot);
+                }
+
+                while ((pHeader->numEntries >= m_maxEntries) || ((pHeader->liveBytes + dataSize) > m_maxDataSize))
+                {
+                    if (EvictLru() == false)
+                    {
+                        break;
+                    }
+                }
+
+                // Evicted entries leave holes in the data file. Reclaim them once they take up half of the size cap.
+                if ((m_dataFile.GetUsedStorageSize() - pHeader->liveBytes) > (m_maxDataSize / 2))
+                {
+                    result = CompactData();
+                }
+            }
+
+            const size_t dataOffset = m_dataFile.GetUsedStorageSize();
+            FileView     dataView;
+
+            if (result == Result::Success)
+            {
+                result = m_dataFile.GetNewStorageSpace(dataSize, true, &dataView);
+            }
+
+            if (result == Result::Success)
+            {
+                result = Result::ErrorUnknown;
+
+                TRY_ACCESS_FILE_VIEW(dataView.IsValid())
+                {
+                    memcpy(dataView.Ptr(), pData, dataSize);
+                    result = Result::Success;
+                }
+                CATCH_ACCESS_FILE_VIEW
+                {
+                    PAL_ASSERT_ALWAYS();
+                }
+
+                dataView.UnMap(false);
+            }
+
+            if (result == Result::Success)
+            {
+                // The data is in place, so the entry can be published. The slot must be looked up again because
+                // evictions may have shifted entries around.
+                FindSlot(key, &slot);
+
+                IndexEntry*const pEntry = &pEntries[slot];
+
+                pEntry->key        = key;
+                pEntry->dataOffset = dataOffset;
+                pEntry->dataSize   = static_cast<uint32>(dataSize);
+                MetroHash64::Hash(static_cast<const uint8*>(pData),
+                                  dataSize,
+                                  reinterpret_cast<uint8*>(&pEntry->checksum));
+                pEntry->valid      = 1;
+
+                LinkMru(slot);
+
+                pHeader->numEntries++;
+                pHeader->liveBytes += dataSize;
+
+                m_stats.stores++;
+                m_stats.bytesWritten += dataSize;
+            }
+
+            // Even a failed store may have evicted or moved entries, so other processes and this one's readers must
+            // notice the change.
+            if (filesValid)
+            {
+                pHeader->generation++;
+
+                m_indexValid      = IndexIsValid();
+                m_validGeneration = pHeader->generation;
+            }
+
+            m_lockFile.Unlock();
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Reports this process' counters. They are read without taking the lock, so they may be slightly out of date.
+void ElfCache::GetStats(
+    ElfCacheStats* pStats
+    ) const
+{
+    PAL_ASSERT(pStats != nullptr);
+
+    memcpy(pStats, &m_stats, sizeof(m_stats));
+}
+
+} // Util
@@ -27,8 +27,10 @@
 #include "palAssert.h"
 #include "palFile.h"
 #include "core/os/lnx/lnxHeaders.h"
+#include <cerrno>
 #include <cstdio>
 #include <unistd.h>
+#include <sys/file.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -109,6 +111,7 @@ void FileMapping::Close()
     if (IsValid())
     {
         close(m_fileHandle);
+        m_fileHandle = InvalidFd;
     }
 }
 
@@ -120,6 +123,42 @@ bool FileMapping::Flush()
     return true;
 }
 
+// =====================================================================================================================
+// Acquires an advisory lock on the file. Blocks until the lock is available.
+Result FileMapping::Lock(
+    bool exclusive)  // Whether to acquire an exclusive or a shared lock.
+{
+    Result result = Result::ErrorUnknown;
+
+    if (IsValid())
+    {
+        int ret = 0;
+
+        do
+        {
+            ret = flock(m_fileHandle, exclusive ? LOCK_EX : LOCK_SH);
+        }
+        while ((ret != 0) && (errno == EINTR));
+
+        if (ret == 0)
+        {
+            result = Result::Success;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Releases a lock acquired by Lock().
+void FileMapping::Unlock()
+{
+    if (IsValid())
+    {
+        flock(m_fileHandle, LOCK_UN);
+    }
+}
+
 // =====================================================================================================================
 FileView::FileView()
     :
@@ -143,7 +182,7 @@ void* FileView::Map(
     // offset should be aligned to page
     const int pageSize = sysconf(_SC_PAGE_SIZE);
     m_offestIntoView = offset - offset / pageSize * pageSize;
-    m_requestedSize = (size + m_offestIntoView - 1);
+    m_requestedSize = (size + m_offestIntoView);
 
     m_pMappedMem = mmap(nullptr, m_requestedSize, PROT_READ|PROT_WRITE, MAP_SHARED,
                         mappedFile.GetHandle(), offset / pageSize * pageSize );
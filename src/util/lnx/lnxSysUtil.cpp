@@ -48,6 +48,7 @@
 #include <dirent.h>
 #include <string.h>
 #include <poll.h>
+#include <link.h>
 
 namespace Util
 {
@@ -495,6 +496,105 @@ bool IsKeyPressed(
     return isKeySet;
 }
 
+// State shared with FindBuildIdNote() while walking the loaded modules.
+struct BuildIdSearch
+{
+    ElfW(Addr)   address;    // Address of a function inside the module being searched for.
+    const void*  pBuildId;   // Receives the location of the module's build ID.
+    uint32       buildIdSize;
+};
+
+// =====================================================================================================================
+// dl_iterate_phdr() callback which looks for the GNU build ID note of the module containing BuildIdSearch::address.
+// Returns nonzero to stop the iteration once that module was found.
+static int FindBuildIdNote(
+    struct dl_phdr_info* pInfo,
+    size_t               size,
+    void*                pData)
+{
+    BuildIdSearch*const pSearch = static_cast<BuildIdSearch*>(pData);
+
+    bool containsAddress = false;
+    for (uint32 i = 0; (i < pInfo->dlpi_phnum) && (containsAddress == false); ++i)
+    {
+        const ElfW(Phdr)& phdr  = pInfo->dlpi_phdr[i];
+        const ElfW(Addr)  start = pInfo->dlpi_addr + phdr.p_vaddr;
+
+        containsAddress = (phdr.p_type == PT_LOAD) &&
+                          (pSearch->address >= start) &&
+                          (pSearch->address < (start + phdr.p_memsz));
+    }
+
+    for (uint32 i = 0; containsAddress && (i < pInfo->dlpi_phnum) && (pSearch->pBuildId == nullptr); ++i)
+    {
+        const ElfW(Phdr)& phdr = pInfo->dlpi_phdr[i];
+
+        if (phdr.p_type == PT_NOTE)
+        {
+            const uint8* pNote = reinterpret_cast<const uint8*>(pInfo->dlpi_addr + phdr.p_vaddr);
+            const uint8* pEnd  = pNote + phdr.p_memsz;
+
+            // Note names and descriptors are padded to four bytes.
+            while ((pNote + sizeof(ElfW(Nhdr))) <= pEnd)
+            {
+                const ElfW(Nhdr)*const pHeader = reinterpret_cast<const ElfW(Nhdr)*>(pNote);
+                const uint8*const      pName   = pNote + sizeof(ElfW(Nhdr));
+                const uint8*const      pDesc   = pName + Pow2Align(pHeader->n_namesz, 4);
+
+                if ((pHeader->n_type   == NT_GNU_BUILD_ID) &&
+                    (pHeader->n_namesz == sizeof(ELF_NOTE_GNU)) &&
+                    (memcmp(pName, ELF_NOTE_GNU, sizeof(ELF_NOTE_GNU)) == 0))
+                {
+                    pSearch->pBuildId    = pDesc;
+                    pSearch->buildIdSize = pHeader->n_descsz;
+                    break;
+                }
+
+                pNote = pDesc + Pow2Align(pHeader->n_descsz, 4);
+            }
+        }
+    }
+
+    return containsAddress ? 1 : 0;
+}
+
+// =====================================================================================================================
+// Retrieves the GNU build ID note of the module which contains this function.
+Result GetCurrentModuleBuildId(
+    void*   pBuildId,
+    uint32* pBuildIdSize)
+{
+    PAL_ASSERT(pBuildIdSize != nullptr);
+
+    BuildIdSearch search = { };
+    search.address = reinterpret_cast<ElfW(Addr)>(&GetCurrentModuleBuildId);
+
+    dl_iterate_phdr(&FindBuildIdNote, &search);
+
+    Result result = Result::Unsupported;
+
+    if (search.pBuildId != nullptr)
+    {
+        if (pBuildId == nullptr)
+        {
+            result = Result::Success;
+        }
+        else if (*pBuildIdSize < search.buildIdSize)
+        {
+            result = Result::ErrorInvalidMemorySize;
+        }
+        else
+        {
+            memcpy(pBuildId, search.pBuildId, search.buildIdSize);
+            result = Result::Success;
+        }
+
+        *pBuildIdSize = search.buildIdSize;
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Retrieves the path and filename of the current executable.
 Result GetExecutableName(
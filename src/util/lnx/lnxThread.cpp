@@ -175,6 +175,16 @@ void* Thread::StartThread(
 // Creates a new key for this process to store and retrieve thread-local data.
 Result CreateThreadLocalKey(
     ThreadLocalKey* pKey)
+{
+    return CreateThreadLocalKey(pKey, nullptr);
+}
+
+// =====================================================================================================================
+// Creates a new key for this process to store and retrieve thread-local data, calling pfnDestructor on each thread's
+// value when that thread exits.
+Result CreateThreadLocalKey(
+    ThreadLocalKey*       pKey,
+    ThreadLocalDestructor pfnDestructor)
 {
     Result result = Result::Success;
 
@@ -182,7 +192,7 @@ Result CreateThreadLocalKey(
     {
         result = Result::ErrorInvalidPointer;
     }
-    else if (pthread_key_create(pKey, nullptr) != 0)
+    else if (pthread_key_create(pKey, pfnDestructor) != 0)
     {
         result = Result::ErrorUnavailable;
     }
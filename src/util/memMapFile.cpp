@@ -230,6 +230,50 @@ Result MemMapFile::ManualStorageAdvance(
     return result;
 }
 
+// =====================================================================================================================
+// Returns the amount of used storage, not counting the header, or InvalidOffset on failure.
+size_t MemMapFile::GetUsedStorageSize() const
+{
+    const size_t storageEnd = GetStorageEnd();
+
+    return (storageEnd != InvalidOffset) ? LocalToExternalOffset(storageEnd) : InvalidOffset;
+}
+
+// =====================================================================================================================
+// Moves the storage container end back to the given size, discarding all data after it.
+Result MemMapFile::TruncateStorage(
+    size_t dataSize)    // New used storage size, not counting the header.
+{
+    PAL_ASSERT(IsWriteable());
+
+    Result result = Result::ErrorInvalidValue;
+
+    if (dataSize <= GetUsedStorageSize())
+    {
+        result = SetStorageEnd(ExternalToLocalOffset(dataSize));
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Validates the shared storage container header. Returns Success if it is valid, an error code otherwise.
+Result MemMapFile::ValidateStorage() const
+{
+    Result result = Result::ErrorUnknown;
+
+    TRY_ACCESS_FILE_VIEW(m_pActiveContainerHeader != nullptr)
+    {
+        result = ValidateHeader(m_pActiveContainerHeader);
+    }
+    CATCH_ACCESS_FILE_VIEW
+    {
+        PAL_ASSERT_ALWAYS();
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Reloads an open storage conatiner if changed by another instance. Returns true if successful, false otherwise. On
 // failure to reload, the storage container will no longer be valid.
@@ -244,7 +288,11 @@ Result MemMapFile::ReloadIfNeeded(
     {
         result = m_memoryMapping.ReloadMap(curFileSize);
 
-        if (result != Result::Success)
+        if (result == Result::Success)
+        {
+            m_mappingSize = curFileSize;
+        }
+        else
         {
             CloseStorageFile();
             PAL_ASSERT_ALWAYS();
@@ -255,6 +303,10 @@ Result MemMapFile::ReloadIfNeeded(
             *pWasReloaded = true;
         }
     }
+    else if (pWasReloaded != nullptr)
+    {
+        *pWasReloaded = false;
+    }
 
     return result;
 }
@@ -292,6 +344,7 @@ Result MemMapFile::ExpandStorage(
     result = m_memoryMapping.ReloadMap(nextCapacity);
     if (result == Result::Success)
     {
+        m_mappingSize = nextCapacity;
         SetStorageCapacity(nextCapacity);
     }
 
@@ -0,0 +1,176 @@
+##
+ #######################################################################################################################
+ #
+ #  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ #
+ #  Permission is hereby granted, free of charge, to any person obtaining a copy
+ #  of this software and associated documentation files (the "Software"), to deal
+ #  in the Software without restriction, including without limitation the rights
+ #  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ #  copies of the Software, and to permit persons to whom the Software is
+ #  furnished to do so, subject to the following conditions:
+ #
+ #  The above copyright notice and this permission notice shall be included in all
+ #  copies or substantial portions of the Software.
+ #
+ #  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ #  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ #  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ #  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ #  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ #  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ #  SOFTWARE.
+ #
+ #######################################################################################################################
+
+# Regenerates the seed, pivots, slot map and key lengths of every Util::PerfectHashKeyTable initializer in a header.
+#
+# Each table is located by its "PerfectHashKeyTable<NumKeys, TableBits> KeyTable =" declaration.  Only the key list of
+# the initializer is read; everything else is recomputed from it.  Keys are either string literals or references to the
+# key-name constants of a metadata header (e.g. PipelineMetadataKey::Name), which are resolved through --keyHeader.
+#
+# The search is deterministic: pivot pairs are tried in increasing order and, for each pair, seeds 1 through
+# --maxSeed - 1.  The first seed which gives every key its own slot wins.  TableBits is kept unless no seed works for
+# it, in which case it is raised until one does.  NumKeys is always set to the length of the key list, so adding or
+# removing a key only requires editing the key list (and the matching key-index enum) and rerunning this script.
+
+import re
+import sys
+import argparse
+
+# 4 space indentation
+indt = "    "
+
+maxLineLength = 120
+
+# Must match Util::Fnv1aPrime and Util::PerfectHashSample() in inc/util/palHashLiteralString.h.
+fnv1aPrime = 16777619
+
+def perfectHashMix(hashValue, value):
+    return ((hashValue ^ value) * fnv1aPrime) & 0xFFFFFFFF
+
+def perfectHashSample(key, seed, pivot0, pivot1):
+    length = len(key)
+    return perfectHashMix(perfectHashMix(perfectHashMix(seed ^ length,
+                                                        key[min(pivot0, length - 1)]),
+                                         key[min(pivot1, length - 1)]),
+                          key[length - 1])
+
+def findSlots(keys, tableBits, seed, pivot0, pivot1):
+    slots = [len(keys)] * (1 << tableBits)
+    for index, key in enumerate(keys):
+        slot = perfectHashSample(key, seed, pivot0, pivot1) >> (32 - tableBits)
+        if slots[slot] != len(keys):
+            return None
+        slots[slot] = index
+    return slots
+
+def searchTable(keys, tableBits, maxSeed):
+    # A single key still needs two distinct pivot offsets.
+    maxLength = max(2, max(len(key) for key in keys))
+    for pivot0 in range(maxLength):
+        for pivot1 in range(pivot0 + 1, maxLength):
+            for seed in range(1, maxSeed):
+                slots = findSlots(keys, tableBits, seed, pivot0, pivot1)
+                if slots is not None:
+                    return (seed, pivot0, pivot1, slots)
+    return None
+
+# Formats a list of integers as a brace-enclosed initializer at the given indentation.  Short lists stay on one line;
+# longer ones are broken into rows of rowLength values.
+def formatIntList(values, indent, rowLength, inlineMaxCount):
+    oneLine = "{ " + ", ".join(str(v) for v in values) + " }"
+    if (len(values) <= inlineMaxCount) and (len(indent + oneLine) <= maxLineLength):
+        return indent + oneLine
+    rows = [", ".join(str(v) for v in values[i:i + rowLength]) for i in range(0, len(values), rowLength)]
+    return (indent + "{\n" +
+            ",\n".join(indent + indt + row for row in rows) + "\n" +
+            indent + "}")
+
+def loadKeyConstants(headerFilename):
+    constants = {}
+    if headerFilename != "":
+        text = open(headerFilename, 'r').read()
+        for namespace, body in re.findall(r'namespace\s+(\w+)\s*\{(.*?)\}', text, re.S):
+            for name, value in re.findall(r'(\w+)\[\]\s*=\s*"([^"]*)"\s*;', body):
+                constants[namespace + "::" + name] = value
+    return constants
+
+def resolveKey(token, constants):
+    if token.startswith('"'):
+        return token[1:-1]
+    if token not in constants:
+        sys.exit("Unknown key constant " + token + "; pass the header that defines it with --keyHeader.")
+    return constants[token]
+
+tablePattern = re.compile(r'(?P<indent>[ ]*)static constexpr PerfectHashKeyTable<\d+, (?P<bits>\d+)> KeyTable =\n'
+                          r'(?P=indent)\{\n'
+                          r'.*?\n'                                    # seed
+                          r'(?:[ ]*\{[^{}\n]*\},\n)'                  # pivots
+                          r'(?:[ ]*\{[^{}\n]*\},\n|[ ]*\{\n[^{}]*\},\n)' # slots
+                          r'(?P<keysIndent>[ ]*)\{\n(?P<keys>[^{}]*)\n(?P=keysIndent)\},\n'
+                          r'(?:[ ]*\{[^{}\n]*\}\n|[ ]*\{\n[^{}]*\}\n)' # key lengths
+                          r'(?P=indent)\};', re.S)
+
+def regenerateTable(match, constants, maxSeed):
+    indent     = match.group('indent')
+    tableBits  = int(match.group('bits'))
+    keyTokens  = [token.strip() for token in match.group('keys').split(',')]
+    keys       = [resolveKey(token, constants).encode('ascii') for token in keyTokens]
+
+    if len(keys) >= 255:
+        sys.exit("PerfectHashKeyTable supports at most 254 keys.")
+    if len(set(keys)) != len(keys):
+        sys.exit("Duplicate key in table: " + ", ".join(keyTokens))
+
+    tableBits = max(tableBits, (len(keys) - 1).bit_length(), 1)
+    result    = searchTable(keys, tableBits, maxSeed)
+    while result is None:
+        tableBits += 1
+        result     = searchTable(keys, tableBits, maxSeed)
+    (seed, pivot0, pivot1, slots) = result
+
+    inner = indent + indt
+    return (indent + "static constexpr PerfectHashKeyTable<" + str(len(keys)) + ", " + str(tableBits) +
+            "> KeyTable =\n" +
+            indent + "{\n" +
+            inner + str(seed) + "u,\n" +
+            inner + "{ " + str(pivot0) + ", " + str(pivot1) + " },\n" +
+            formatIntList(slots, inner, 16, 16) + ",\n" +
+            inner + "{\n" +
+            ",\n".join(inner + indt + token for token in keyTokens) + "\n" +
+            inner + "},\n" +
+            formatIntList([len(key) for key in keys], inner, 16, 255) + "\n" +
+            indent + "};")
+
+description = sys.argv[0] + " PerfectHashKeyTable generation script. \
+Sample usage: python genPerfectHashKeyTables.py --file inc/core/g_palPipelineAbiMetadataImpl.h \
+--keyHeader inc/core/g_palPipelineAbiMetadata.h"
+
+parser = argparse.ArgumentParser(description=description)
+
+parser.add_argument('--file', dest='filename', type=str,
+                    help='Header whose PerfectHashKeyTable initializers are regenerated in place.', required=True)
+
+parser.add_argument('--keyHeader', dest='keyHeaderFilename', type=str,
+                    help='Header defining the key-name constants referenced by the key lists.', default="")
+
+parser.add_argument('--maxSeed', dest='maxSeed', type=int,
+                    help='Exclusive upper bound of the seeds tried for each pivot pair.', default=256)
+
+parser.add_argument('--check', dest='check', action='store_true',
+                    help='Only report whether the file is up to date; exits with 1 if it is not.')
+
+args = parser.parse_args()
+
+constants = loadKeyConstants(args.keyHeaderFilename)
+
+text    = open(args.filename, 'r').read()
+newText = tablePattern.sub(lambda match: regenerateTable(match, constants, args.maxSeed), text)
+
+if args.check:
+    if newText != text:
+        print(args.filename + " has stale PerfectHashKeyTable initializers.")
+        sys.exit(1)
+elif newText != text:
+    open(args.filename, 'w').write(newText)
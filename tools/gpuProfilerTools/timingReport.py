@@ -30,6 +30,7 @@ import csv
 import glob
 import os
 import re
+import struct
 import sys
 
 try:
@@ -64,6 +65,98 @@ VertsThdGrpsCol  = PsCol + 1
 InstancesCol     = VertsThdGrpsCol + 1
 CommentsCol      = InstancesCol + 1
 
+# Per-queue log files are named like frame000042Dev0EngGfx0-00.csv, or .bin when the GPU profiler writes binary logs.
+LogFileNamePattern = "frame([0-9]*)Dev([0-9]*)Eng(\D*)([0-9]*)-([0-9]*)\.(csv|bin)$"
+
+# Binary log layout; see gpuProfilerLogFile.h.
+BinaryLogMagic     = b"PALGPROF"
+BinaryBlockColumns = 0
+BinaryBlockStrings = 1
+BinaryBlockRows    = 2
+
+# Struct format of each binary column type's cell, indexed by LogColumnType.
+BinaryColumnFormats = [ "Q", "Q", "QQ", "d", "I" ]
+
+# One row of a binary log.  Cells are only formatted as CSV text when they are looked at.
+class BinaryLogRow(object):
+    def __init__(self, layout, strings, values):
+        self.layout  = layout  # (column type, index of first value) for each column
+        self.strings = strings
+        self.values  = values  # Unpacked row, starting with the validity bitmask as 64-bit words.
+
+    def __len__(self):
+        return len(self.layout)
+
+    def __getitem__(self, col):
+        if not ((self.values[col >> 6] >> (col & 63)) & 1):
+            return ""
+        (colType, index) = self.layout[col]
+        value = self.values[index]
+        if colType == 0:
+            return str(value)
+        elif colType == 1:
+            return "0x{0:016x}".format(value)
+        elif colType == 2:
+            return "0x{0:016x}{1:016x}".format(value, self.values[index + 1])
+        elif colType == 3:
+            return "{0:.2f}".format(value)
+        else:
+            return self.strings[value]
+
+def ReadBinaryLogFile(fileName):
+    with open(fileName, "rb") as binFile:
+        data = binFile.read()
+
+    if data[0:8] != BinaryLogMagic:
+        sys.exit("ERROR: <{0}> is not a GPU profiler binary log.".format(fileName))
+
+    layout      = [ ]
+    strings     = [ ]
+    rowStruct   = None
+    offset      = 12
+    # A truncated trailing block (e.g., the app crashed mid-write) is ignored.
+    while offset + 12 <= len(data):
+        (blockType, blockSize, count) = struct.unpack_from("<III", data, offset)
+        offset += 8
+        if offset + blockSize > len(data):
+            break
+        pos = offset + 4
+        if blockType == BinaryBlockColumns:
+            names  = [ ]
+            index  = (count + 63) // 64
+            format = "<" + "Q" * index
+            for i in range(count):
+                (colType, length) = struct.unpack_from("<II", data, pos)
+                names.append(data[pos + 8 : pos + 8 + length].decode("utf-8", "replace"))
+                layout.append((colType, index))
+                format += BinaryColumnFormats[colType]
+                index  += len(BinaryColumnFormats[colType])
+                pos    += 8 + length
+            format += "x" * ((8 - struct.calcsize(format) % 8) % 8)
+            rowStruct = struct.Struct(format)
+            yield names
+        elif blockType == BinaryBlockStrings:
+            for i in range(count):
+                (length,) = struct.unpack_from("<I", data, pos)
+                strings.append(data[pos + 4 : pos + 4 + length].decode("utf-8", "replace"))
+                pos += 4 + length
+        elif blockType == BinaryBlockRows:
+            for i in range(count):
+                yield BinaryLogRow(layout, strings, rowStruct.unpack_from(data, pos))
+                pos += rowStruct.size
+        offset += blockSize
+
+# Yields the header row and then every other row of a CSV or binary log file.  Rows are indexed by column and give
+# the same strings csv.reader would for a CSV log.
+def ReadLogFile(fileName):
+    if fileName.endswith(".bin"):
+        for row in ReadBinaryLogFile(fileName):
+            yield row
+    else:
+        with open(fileName) as csvFile:
+            for row in csv.reader(csvFile, skipinitialspace=True):
+                yield row
+
 def isValidHash(string):
     # A valid hash is a non-empty string that represents a non-zero hex value.
     return string and (int(string, 16) != 0)
@@ -96,10 +189,10 @@ elif len(sys.argv) == 3:
 gpuFrameTime = 0
 
 os.chdir(sys.argv[1])
-files = glob.glob("frame*.csv")
+files = [ f for f in glob.glob("frame*.csv") + glob.glob("frame*.bin") if re.search(LogFileNamePattern, f) ]
 
 if (len(files) == 0):
-    sys.exit("ERROR: Looking at directory <{0}> but cannot find any files that match the \"frame*.csv\" pattern.".format(os.getcwd()))
+    sys.exit("ERROR: Looking at directory <{0}> but cannot find any files that match the \"frame*.csv\" or \"frame*.bin\" patterns.".format(os.getcwd()))
 
 frames               = { }  # Frame num -> [ tsFreq, cmdBufClockPairs, total barrier time ]
 perCallTable         = { }  # Device -> Engine -> QueueId -> Call -> [ count, totalTime ]
@@ -119,7 +212,7 @@ for file in files:
     filesProcessedSoFar += 1
 
     # Decode file name.
-    searchObj  = re.search("frame([0-9]*)Dev([0-9]*)Eng(\D*)([0-9]*)-([0-9]*)\.csv", file)
+    searchObj  = re.search(LogFileNamePattern, file)
     frameNum   = int(searchObj.group(1))
     deviceNum  = int(searchObj.group(2))
     engineType = searchObj.group(3)
@@ -155,63 +248,60 @@ for file in files:
     if not queueKey in perCallTable[deviceKey][engineKey].keys():
         perCallTable[deviceKey][engineKey][queueKey] = { }
 
-    with open(file) as csvFile:
-        reader = csv.reader(csvFile, skipinitialspace=True)
-        headers = next(reader)
-
-        tsFreqSearch        = re.search(".*Frequency: (\d+).*", headers[TimeCol])
-        frames[frameNum][0] = int(tsFreqSearch.group(1))
-
-        for row in reader:
-            if row[QueueCallCol] == "Submit()":
-                submitCount += 1
-            if row[CmdBufCallCol] == "Begin()" and row[StartClockCol]:
-                frames[frameNum][1].append((int(row[StartClockCol]), int(row[EndClockCol])))
-                cmdBufCount += 1
-            if row[TimeCol]:
-                if row[CmdBufCallCol] in perCallTable[deviceKey][engineKey][queueKey].keys():
-                    perCallTable[deviceKey][engineKey][queueKey][row[CmdBufCallCol]][0] += 1
-                    perCallTable[deviceKey][engineKey][queueKey][row[CmdBufCallCol]][1] += float(row[TimeCol])
-                else:
-                    perCallTable[deviceKey][engineKey][queueKey][row[CmdBufCallCol]] = [ 1, float(row[TimeCol]) ]
+    reader = ReadLogFile(file)
+    headers = next(reader)
+
+    tsFreqSearch        = re.search(".*Frequency: (\d+).*", headers[TimeCol])
+    frames[frameNum][0] = int(tsFreqSearch.group(1))
+
+    for row in reader:
+        if row[QueueCallCol] == "Submit()":
+            submitCount += 1
+        if row[CmdBufCallCol] == "Begin()" and row[StartClockCol]:
+            frames[frameNum][1].append((int(row[StartClockCol]), int(row[EndClockCol])))
+            cmdBufCount += 1
+        if row[TimeCol]:
+            if row[CmdBufCallCol] in perCallTable[deviceKey][engineKey][queueKey].keys():
+                perCallTable[deviceKey][engineKey][queueKey][row[CmdBufCallCol]][0] += 1
+                perCallTable[deviceKey][engineKey][queueKey][row[CmdBufCallCol]][1] += float(row[TimeCol])
+            else:
+                perCallTable[deviceKey][engineKey][queueKey][row[CmdBufCallCol]] = [ 1, float(row[TimeCol]) ]
 
-                pipelineType = DeterminePipelineType(row)
-                if pipelineType in perPipelineTypeTable:
-                    perPipelineTypeTable[pipelineType][0] += 1
-                    perPipelineTypeTable[pipelineType][1] += float(row[TimeCol])
+            pipelineType = DeterminePipelineType(row)
+            if pipelineType in perPipelineTypeTable:
+                perPipelineTypeTable[pipelineType][0] += 1
+                perPipelineTypeTable[pipelineType][1] += float(row[TimeCol])
+            else:
+                perPipelineTypeTable[pipelineType] = [ 1, float(row[TimeCol]) ]
+
+            if row[CompilerHashCol]:
+                # Update the perPipelineTable totals.
+                # Note that in practice the compiler hash is most useful because it's in all of the pipeline dumps.
+                if row[CompilerHashCol] in perPipelineTable:
+                    perPipelineTable[row[CompilerHashCol]][1] += 1
+                    perPipelineTable[row[CompilerHashCol]][2] += float(row[TimeCol])
                 else:
-                    perPipelineTypeTable[pipelineType] = [ 1, float(row[TimeCol]) ]
-
-                if row[CompilerHashCol]:
-                    # Update the perPipelineTable totals.
-                    # Note that in practice the compiler hash is most useful because it's in all of the pipeline dumps.
-                    if row[CompilerHashCol] in perPipelineTable:
-                        perPipelineTable[row[CompilerHashCol]][1] += 1
-                        perPipelineTable[row[CompilerHashCol]][2] += float(row[TimeCol])
+                    perPipelineTable[row[CompilerHashCol]] = [ pipelineType, 1, float(row[TimeCol]), row[VsCsCol], row[HsCol], row[DsCol], row[GsCol], row[PsCol] ]
+
+                # Record the start and end clocks and the time of this shader work in the pipelineRangeTable.
+                # Note that we may divide by zero later unless we exclude rows with identical start and end clocks.
+                startClock = int(row[StartClockCol])
+                endClock   = int(row[EndClockCol])
+                if endClock - startClock > 0:
+                    if row[CompilerHashCol] in pipelineRangeTable[frameNum][engineType]:
+                        pipelineRangeTable[frameNum][engineType][row[CompilerHashCol]].append((startClock, endClock, float(row[TimeCol])))
                     else:
-                        perPipelineTable[row[CompilerHashCol]] = [ pipelineType, 1, float(row[TimeCol]), row[VsCsCol], row[HsCol], row[DsCol], row[GsCol], row[PsCol] ]
-
-                    # Record the start and end clocks and the time of this shader work in the pipelineRangeTable.
-                    # Note that we may divide by zero later unless we exclude rows with identical start and end clocks.
-                    startClock = int(row[StartClockCol])
-                    endClock   = int(row[EndClockCol])
-                    if endClock - startClock > 0:
-                        if row[CompilerHashCol] in pipelineRangeTable[frameNum][engineType]:
-                            pipelineRangeTable[frameNum][engineType][row[CompilerHashCol]].append((startClock, endClock, float(row[TimeCol])))
-                        else:
-                            pipelineRangeTable[frameNum][engineType][row[CompilerHashCol]] = [(startClock, endClock, float(row[TimeCol]))]
-
-                if row[PsCol]:
-                    if row[PsCol] in perPsTable:
-                        perPsTable[row[PsCol]][0] += 1
-                        perPsTable[row[PsCol]][1] += float(row[TimeCol])
-                    else:
-                        perPsTable[row[PsCol]] = [ 1, float(row[TimeCol]) ]
+                        pipelineRangeTable[frameNum][engineType][row[CompilerHashCol]] = [(startClock, endClock, float(row[TimeCol]))]
 
-                if row[CmdBufCallCol] == "CmdBarrier()":
-                    frames[frameNum][2] += float(row[TimeCol])
+            if row[PsCol]:
+                if row[PsCol] in perPsTable:
+                    perPsTable[row[PsCol]][0] += 1
+                    perPsTable[row[PsCol]][1] += float(row[TimeCol])
+                else:
+                    perPsTable[row[PsCol]] = [ 1, float(row[TimeCol]) ]
 
-        csvFile.close
+            if row[CmdBufCallCol] == "CmdBarrier()":
+                frames[frameNum][2] += float(row[TimeCol])
 
 # Compute the sum of all GPU frame times, where the time of a single frame is the amount of time the GPU spent being busy.
 # We can do this by creating a list of all GPU clock ranges when the GPU was busy from the list of all command buffer clock ranges like so:
@@ -356,7 +446,7 @@ barrierTime = 0
 barrierReportTable = [ ] # [time, [desc, ...] ]
 for file in files:
     # Decode file name.
-    searchObj  = re.search("frame([0-9]*)Dev([0-9]*)Eng(\D*)([0-9]*)-([0-9]*)\.csv", file)
+    searchObj  = re.search(LogFileNamePattern, file)
     frameNum   = int(searchObj.group(1))
     engineType = searchObj.group(3)
 
@@ -364,33 +454,31 @@ for file in files:
         continue
 
     if frameNum == medianBarrierFrame:
-        with open(file) as csvFile:
-            reader = csv.reader(csvFile, skipinitialspace=True)
-            next(reader)
-            for row in reader:
-                if row[CmdBufCallCol] == "CmdBarrier()":
-                    barrierTime += float(row[TimeCol])
-                    entry = [float(row[TimeCol]), [ ] ]
-
-                    if row[CommentsCol] == "":
-                        entry[1].append(["-", "", 0, 0])
-                    else:
-                        actionList = row[CommentsCol].split("\n")
-                        for action in actionList:
-                            if ('CacheMask' not in action) and ('OldLayout' not in action) and ('NewLayout' not in action):
-                                searchObj = re.search("(.*): ([0-9]*)x([0-9]*) (.*)", action)
-                                if searchObj != None:
-                                    actionType = searchObj.group(1)
-                                    width = int(searchObj.group(2))
-                                    height = int(searchObj.group(3))
-                                    format = searchObj.group(4)
-
-                                    entry[1].append([actionType, format, width, height])
-                                else:
-                                    entry[1].append([action, "", 0, 0])
-
-                    barrierReportTable.append(entry)
-            csvFile.close
+        reader = ReadLogFile(file)
+        next(reader)
+        for row in reader:
+            if row[CmdBufCallCol] == "CmdBarrier()":
+                barrierTime += float(row[TimeCol])
+                entry = [float(row[TimeCol]), [ ] ]
+
+                if row[CommentsCol] == "":
+                    entry[1].append(["-", "", 0, 0])
+                else:
+                    actionList = row[CommentsCol].split("\n")
+                    for action in actionList:
+                        if ('CacheMask' not in action) and ('OldLayout' not in action) and ('NewLayout' not in action):
+                            searchObj = re.search("(.*): ([0-9]*)x([0-9]*) (.*)", action)
+                            if searchObj != None:
+                                actionType = searchObj.group(1)
+                                width = int(searchObj.group(2))
+                                height = int(searchObj.group(3))
+                                format = searchObj.group(4)
+
+                                entry[1].append([actionType, format, width, height])
+                            else:
+                                entry[1].append([action, "", 0, 0])
+
+                barrierReportTable.append(entry)
 
 print("== Median Frame Top CmdBarrier() Calls (>= 10us): ===============================================================================================\n")
 print("Frame #{0:d} total barrier time: {1:,.2f} us\n".format(medianBarrierFrame, barrierTime))
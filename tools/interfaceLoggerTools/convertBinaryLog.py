@@ -0,0 +1,316 @@
+##
+ #######################################################################################################################
+ #
+ #  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ #
+ #  Permission is hereby granted, free of charge, to any person obtaining a copy
+ #  of this software and associated documentation files (the "Software"), to deal
+ #  in the Software without restriction, including without limitation the rights
+ #  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ #  copies of the Software, and to permit persons to whom the Software is
+ #  furnished to do so, subject to the following conditions:
+ #
+ #  The above copyright notice and this permission notice shall be included in all
+ #  copies or substantial portions of the Software.
+ #
+ #  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ #  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ #  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ #  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ #  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ #  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ #  SOFTWARE.
+ #
+ #######################################################################################################################
+
+#!/usr/bin/python
+
+# Converts binary interface logger captures (written when the InterfaceLoggerConfig.BinaryCapture setting is enabled)
+# into the JSON logs the interface logger writes by default.
+#
+# Every pal_calls*.bin file in the given folder (or each .bin file given directly) is converted into a .json file of the
+# same name next to it. The output is the exact JSON text the interface logger would have written, whitespace included,
+# so the converted folder can be fed to any tool which reads the JSON logs (e.g., recordingReport.py).
+#
+# The format is described next to BinaryTag in src/core/layers/interfaceLogger/interfaceLoggerBinaryWriter.h. A capture
+# which was cut short is converted up to its last complete record, just like its JSON text would have ended there.
+
+import glob
+import math
+import os
+import struct
+import sys
+
+Magic   = b"PALILOGB"
+Version = 1
+
+# Record tags, see BinaryTag.
+TagText            = 0x00
+TagDefineString    = 0x01
+TagBeginList       = 0x02
+TagBeginInlineList = 0x03
+TagEndList         = 0x04
+TagBeginMap        = 0x05
+TagBeginInlineMap  = 0x06
+TagEndMap          = 0x07
+TagKey             = 0x08
+TagString          = 0x09
+TagInlineString    = 0x0A
+TagUint            = 0x0B
+TagInt             = 0x0C
+TagFloat           = 0x0D
+TagFalse           = 0x0E
+TagTrue            = 0x0F
+TagNull            = 0x10
+TagObject          = 0x11
+TagBeginFunc       = 0x12
+
+# JSON tokens and scopes, mirroring Util::JsonWriter so that the output is formatted identically.
+TokenNone     = 0
+TokenLBrace   = 1
+TokenRBrace   = 2
+TokenLBracket = 3
+TokenRBracket = 4
+TokenComma    = 5
+TokenKey      = 6
+TokenValue    = 7
+
+ScopeOutside = 0x1
+ScopeList    = 0x2
+ScopeMap     = 0x4
+ScopeInline  = 0x8
+
+SpaceOne  = 1
+SpaceLine = 2
+
+SpaceTable = [
+    # To: None LBrace     RBrace     LBracket   RBracket   Comma Key        Value
+    [ 0, 0,         0,         0,         0,         0,    0,         0         ], # From None
+    [ 0, 0,         0,         SpaceLine, 0,         0,    SpaceLine, 0         ], # From LBrace
+    [ 0, 0,         SpaceLine, 0,         SpaceLine, 0,    0,         0         ], # From RBrace
+    [ 0, SpaceLine, 0,         SpaceLine, 0,         0,    0,         SpaceLine ], # From LBracket
+    [ 0, 0,         SpaceLine, 0,         SpaceLine, 0,    0,         0         ], # From RBracket
+    [ 0, SpaceLine, 0,         SpaceLine, 0,         0,    SpaceLine, SpaceLine ], # From Comma
+    [ 0, SpaceOne,  0,         SpaceOne,  0,         0,    0,         SpaceOne  ], # From Key
+    [ 0, 0,         SpaceLine, 0,         SpaceLine, 0,    0,         0         ], # From Value
+]
+
+IndentSize = 2
+
+class TruncatedLog(Exception):
+    pass
+
+class JsonTextWriter:
+    def __init__(self, outFile):
+        self.out       = outFile
+        self.prevToken = TokenNone
+        self.scopes    = [ ScopeOutside ]
+
+    def transition(self, nextToken, leavingScope):
+        spacing = SpaceTable[self.prevToken][nextToken]
+        scope   = self.scopes[-1]
+        if (spacing == SpaceOne) or ((spacing == SpaceLine) and (scope & ScopeInline)):
+            self.out.write(b" ")
+        elif spacing == SpaceLine:
+            depth = len(self.scopes) - (2 if leavingScope else 1)
+            self.out.write(b"\n" + b" " * (depth * IndentSize))
+        self.prevToken = nextToken
+
+    def maybeNextListEntry(self):
+        if (self.scopes[-1] & ScopeList) and (self.prevToken != TokenLBracket):
+            self.transition(TokenComma, False)
+            self.out.write(b",")
+
+    def beginCollection(self, token, text, scope):
+        self.maybeNextListEntry()
+        self.transition(token, False)
+        self.out.write(text)
+        self.scopes.append(scope)
+
+    def endCollection(self, token, text):
+        self.transition(token, True)
+        self.out.write(text)
+        self.scopes.pop()
+
+    def key(self, name):
+        if (self.scopes[-1] & ScopeMap) and (self.prevToken != TokenLBrace):
+            self.transition(TokenComma, False)
+            self.out.write(b",")
+        self.transition(TokenKey, False)
+        self.out.write(b"\"" + name + b"\":")
+
+    def value(self, text):
+        self.maybeNextListEntry()
+        self.transition(TokenValue, False)
+        self.out.write(text)
+
+    def string(self, text):
+        self.value(b"\"" + text + b"\"")
+
+    # Resumes writing after JSON text which was written by the interface logger itself. That text always ends inside
+    # the top-level list of entries, either right after its opening bracket or after a complete entry.
+    def resumeAfter(self, text):
+        self.out.write(text)
+        self.scopes    = [ ScopeOutside, ScopeList ]
+        self.prevToken = TokenLBracket if text.endswith(b"[") else TokenRBrace
+
+class Reader:
+    def __init__(self, data):
+        self.data   = data
+        self.offset = 0
+
+    def byte(self):
+        if self.offset >= len(self.data):
+            raise TruncatedLog()
+        value = self.data[self.offset]
+        self.offset += 1
+        return value
+
+    def bytes(self, count):
+        if self.offset + count > len(self.data):
+            raise TruncatedLog()
+        value = self.data[self.offset:self.offset + count]
+        self.offset += count
+        return value
+
+    def varint(self):
+        value = 0
+        shift = 0
+        while True:
+            byte   = self.byte()
+            value |= (byte & 0x7F) << shift
+            shift += 7
+            if (byte & 0x80) == 0:
+                return value
+
+    def zigzag(self):
+        value = self.varint()
+        return (value >> 1) ^ -(value & 1)
+
+def formatFloat(value):
+    # Match the C library's "%g", which prints the sign of a NaN.
+    if math.isnan(value):
+        return b"-nan" if math.copysign(1.0, value) < 0 else b"nan"
+    return ("%g" % value).encode()
+
+def convert(data, outFile):
+    reader = Reader(data)
+    writer = JsonTextWriter(outFile)
+
+    if reader.bytes(len(Magic)) != Magic:
+        raise ValueError("not a binary interface logger capture")
+    version = struct.unpack("<I", reader.bytes(4))[0]
+    if version != Version:
+        raise ValueError("unsupported format version %d" % version)
+    if reader.byte() != TagText:
+        raise ValueError("missing initial text record")
+    writer.resumeAfter(reader.bytes(reader.varint()))
+
+    strings      = []
+    prevCallTime = 0
+
+    try:
+        while reader.offset < len(data):
+            # Each record is decoded in full before anything is written, so a truncated record writes nothing.
+            start = reader.offset
+            tag   = reader.byte()
+
+            if tag == TagDefineString:
+                strings.append(reader.bytes(reader.varint()))
+            elif tag == TagBeginList:
+                writer.beginCollection(TokenLBracket, b"[", ScopeList)
+            elif tag == TagBeginInlineList:
+                writer.beginCollection(TokenLBracket, b"[", ScopeList | ScopeInline)
+            elif tag == TagEndList:
+                writer.endCollection(TokenRBracket, b"]")
+            elif tag == TagBeginMap:
+                writer.beginCollection(TokenLBrace, b"{", ScopeMap)
+            elif tag == TagBeginInlineMap:
+                writer.beginCollection(TokenLBrace, b"{", ScopeMap | ScopeInline)
+            elif tag == TagEndMap:
+                writer.endCollection(TokenRBrace, b"}")
+            elif tag == TagKey:
+                writer.key(strings[reader.varint()])
+            elif tag == TagString:
+                writer.string(strings[reader.varint()])
+            elif tag == TagInlineString:
+                writer.string(reader.bytes(reader.varint()))
+            elif tag == TagUint:
+                writer.value(b"%d" % reader.varint())
+            elif tag == TagInt:
+                writer.value(b"%d" % reader.zigzag())
+            elif tag == TagFloat:
+                writer.value(formatFloat(struct.unpack("<f", reader.bytes(4))[0]))
+            elif tag == TagFalse:
+                writer.value(b"false")
+            elif tag == TagTrue:
+                writer.value(b"true")
+            elif tag == TagNull:
+                writer.value(b"null")
+            elif tag == TagObject:
+                className = strings[reader.varint()]
+                objectId  = reader.varint()
+                writeObject(writer, className, objectId)
+            elif tag == TagBeginFunc:
+                className    = strings[reader.varint()]
+                objectId     = reader.varint()
+                funcName     = strings[reader.varint()]
+                threadId     = reader.varint()
+                preCallTime  = (prevCallTime + reader.zigzag()) & 0xFFFFFFFFFFFFFFFF
+                postCallTime = (preCallTime + reader.zigzag()) & 0xFFFFFFFFFFFFFFFF
+                prevCallTime = preCallTime
+
+                writer.beginCollection(TokenLBrace, b"{", ScopeMap)
+                writer.key(b"_type")
+                writer.string(b"InterfaceFunc")
+                writer.key(b"this")
+                writeObject(writer, className, objectId)
+                writer.key(b"name")
+                writer.string(funcName)
+                writer.key(b"thread")
+                writer.value(b"%d" % threadId)
+                writer.key(b"preCallTime")
+                writer.value(b"%d" % preCallTime)
+                writer.key(b"postCallTime")
+                writer.value(b"%d" % postCallTime)
+            else:
+                raise ValueError("unknown record tag 0x%02x at offset %d" % (tag, start))
+    except TruncatedLog:
+        print("warning: capture ends in the middle of a record at offset %d" % start)
+
+def writeObject(writer, className, objectId):
+    writer.beginCollection(TokenLBrace, b"{", ScopeMap | ScopeInline)
+    writer.key(b"class")
+    writer.string(className)
+    writer.key(b"id")
+    writer.value(b"%d" % objectId)
+    writer.endCollection(TokenRBrace, b"}")
+
+def usage():
+    sys.exit("Usage: convertBinaryLog.py <full path to log folder | .bin file> ...")
+
+if len(sys.argv) < 2:
+    usage()
+
+binPaths = []
+for arg in sys.argv[1:]:
+    if os.path.isdir(arg):
+        binPaths += sorted(glob.glob(os.path.join(arg, "pal_calls*.bin")))
+    elif os.path.isfile(arg):
+        binPaths.append(arg)
+    else:
+        usage()
+
+if len(binPaths) == 0:
+    sys.exit("No binary interface logger captures (pal_calls*.bin) found")
+
+for binPath in binPaths:
+    jsonPath = os.path.splitext(binPath)[0] + ".json"
+    with open(binPath, "rb") as binFile:
+        data = binFile.read()
+    with open(jsonPath, "wb") as jsonFile:
+        try:
+            convert(data, jsonFile)
+        except ValueError as error:
+            sys.exit("%s: %s" % (binPath, error))
+    print("%s -> %s" % (binPath, jsonPath))
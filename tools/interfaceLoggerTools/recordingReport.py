@@ -0,0 +1,166 @@
+##
+ #######################################################################################################################
+ #
+ #  Copyright (c) 2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ #
+ #  Permission is hereby granted, free of charge, to any person obtaining a copy
+ #  of this software and associated documentation files (the "Software"), to deal
+ #  in the Software without restriction, including without limitation the rights
+ #  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ #  copies of the Software, and to permit persons to whom the Software is
+ #  furnished to do so, subject to the following conditions:
+ #
+ #  The above copyright notice and this permission notice shall be included in all
+ #  copies or substantial portions of the Software.
+ #
+ #  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ #  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ #  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ #  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ #  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ #  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ #  SOFTWARE.
+ #
+ #######################################################################################################################
+
+#!/usr/bin/python
+
+# Summarizes the CPU cost of command buffer recording from an interface logger capture.
+#
+# The interface logger timestamps every call it forwards, so a capture of a recording workload is also a recording
+# benchmark.  The cleanest numbers come from running the workload against a null device (set
+# PlatformCreateInfo::flags::createNullDevice and pick a NullGpuId) with the interface logger enabled, because nothing
+# is ever submitted and the log contains nothing but recording work.
+#
+# Debug builds of PAL can also sum the recording statistics of every command buffer (command DWORDs, PM4 optimizer
+# savings and state object images written or skipped) into commitLog.csv when the LogCmdBufCommitSizes setting is
+# enabled.  Pass that file with -commitLog to add the totals of every data set in it to the report, which lets the
+# report track PM4 optimizer effectiveness over time.
+#
+# The report is printed as a table by default.  Use -csv or -json to emit a machine readable summary which can be
+# checked in or diffed against an earlier run to catch recording regressions.
+
+import glob
+import json
+import os
+import sys
+
+# Calls which are summarized unless the caller asks for every ICmdBuffer function.
+DefaultCalls = [ "CmdBindPipeline", "CmdBarrier", "CmdDraw", "CmdDrawOpaque", "CmdDrawIndexed", "CmdDrawIndirectMulti",
+                 "CmdDrawIndexedIndirectMulti", "CmdDrawMulti", "CmdDrawIndexedMulti", "CmdDispatch",
+                 "CmdDispatchIndirect", "Begin", "End" ]
+
+# Maps the rows CmdAllocator::PrintCommitLog() writes to commitLog.csv to the names used in this report.
+StatRows = [ ("Command Buffers Recorded",               "cmdBuffers"),
+             ("Command DWORDs",                         "cmdDwords"),
+             ("PM4 Optimizer DWORDs Eliminated",        "pm4OptDwordsEliminated"),
+             ("PM4 Optimizer Context Rolls Eliminated", "pm4OptContextRollsEliminated"),
+             ("State Object Images Written",            "stateObjectImagesWritten"),
+             ("State Object Images Skipped",            "stateObjectImagesSkipped") ]
+
+def usage():
+    sys.exit("Usage: recordingReport.py <full path to log folder> [-commitLog <path to commitLog.csv>] [-all] "
+             "[-csv | -json]")
+
+def loadEntries(path):
+    # A capture which was cut short (the application crashed or was killed) is missing its closing bracket.
+    with open(path, "r") as logFile:
+        text = logFile.read().rstrip()
+    if text.endswith(","):
+        text = text[:-1]
+    if not text.endswith("]"):
+        text += "]"
+    return json.loads(text)
+
+def loadStats(path):
+    # The commit log holds one data set per command allocator, so the statistics of every data set are summed.
+    stats = dict((name, 0) for (row, name) in StatRows)
+    rows  = dict(StatRows)
+    with open(path, "r") as logFile:
+        for line in logFile:
+            fields = line.strip().split(",")
+            if (len(fields) == 2) and (fields[0] in rows):
+                stats[rows[fields[0]]] += int(fields[1])
+    return stats
+
+def median(values):
+    ordered = sorted(values)
+    mid     = len(ordered) // 2
+    if len(ordered) % 2 == 1:
+        return float(ordered[mid])
+    return (ordered[mid - 1] + ordered[mid]) / 2.0
+
+enAllCalls    = False
+outFormat     = "table"
+commitLogPath = None
+
+if len(sys.argv) < 2:
+    usage()
+
+argIdx = 2
+while argIdx < len(sys.argv):
+    arg = sys.argv[argIdx]
+    if arg == "-all":
+        enAllCalls = True
+    elif arg == "-csv":
+        outFormat = "csv"
+    elif arg == "-json":
+        outFormat = "json"
+    elif (arg == "-commitLog") and (argIdx + 1 < len(sys.argv)):
+        argIdx       += 1
+        commitLogPath = sys.argv[argIdx]
+    else:
+        usage()
+    argIdx += 1
+
+logFiles = glob.glob(os.path.join(sys.argv[1], "pal_calls*.json"))
+if len(logFiles) == 0:
+    sys.exit("No interface logger captures (pal_calls*.json) found in " + sys.argv[1])
+
+callTimes = {}
+
+for logPath in logFiles:
+    for entry in loadEntries(logPath):
+        if (entry.get("_type") != "InterfaceFunc") or (entry["this"]["class"] != "ICmdBuffer"):
+            continue
+
+        name = entry["name"]
+        if enAllCalls or (name in DefaultCalls):
+            callTimes.setdefault(name, []).append(entry["postCallTime"] - entry["preCallTime"])
+
+stats = None
+if commitLogPath is not None:
+    stats = loadStats(commitLogPath)
+
+rows = []
+for name in sorted(callTimes.keys()):
+    times = callTimes[name]
+    rows.append({ "call":     name,
+                  "count":    len(times),
+                  "meanNs":   float(sum(times)) / len(times),
+                  "medianNs": median(times),
+                  "totalNs":  sum(times) })
+
+if outFormat == "json":
+    report = { "calls": rows }
+    if stats is not None:
+        report["recordingStats"] = stats
+    print(json.dumps(report, indent=4, sort_keys=True))
+elif outFormat == "csv":
+    print("Call,Count,Mean (ns),Median (ns),Total (ns)")
+    for row in rows:
+        print("%s,%d,%.1f,%.1f,%d" % (row["call"], row["count"], row["meanNs"], row["medianNs"], row["totalNs"]))
+    if stats is not None:
+        print("")
+        print("Stat,Total")
+        for (statRow, statName) in StatRows:
+            print("%s,%d" % (statName, stats[statName]))
+else:
+    print("%-32s %10s %12s %12s %16s" % ("Call", "Count", "Mean (ns)", "Median (ns)", "Total (ns)"))
+    for row in rows:
+        print("%-32s %10d %12.1f %12.1f %16d" %
+              (row["call"], row["count"], row["meanNs"], row["medianNs"], row["totalNs"]))
+    if stats is not None:
+        print("")
+        for (statRow, statName) in StatRows:
+            print("%-32s %d" % (statName + ":", stats[statName]))